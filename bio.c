@@ -1,6 +1,6 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a set of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
@@ -17,79 +17,339 @@
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+//
+// The cache starts with NBUF buffers and grows a page of buffers
+// at a time, from kalloc, while memory is plentiful: up to
+// 1/BCACHEFRAC of memory, and only while more than a quarter of
+// memory is free. It never shrinks.
+//
+// Buffers are hashed by block into NBHASH chains. Each chain is
+// protected by one of NBSTRIPE stripe locks, which also guard the
+// stripe's hit and miss counts, so lookups of different blocks
+// from different CPUs rarely contend.
+//
+// Replacement resists scans, after 2Q. A block read in joins the
+// probation queue, a FIFO. A buffer used again while queued,
+// after the tick it was read in, is marked, and when it reaches
+// the old end of probation it moves to the protected queue
+// instead of being recycled. The protected queue holds at most
+// three quarters of the buffers and is swept like a clock. So a
+// block read once, as by grep over a large file, passes through
+// probation without pushing out blocks in use. Blocks read
+// ahead (see breadahead) join probation unused, so read-ahead
+// the reader never gets to goes first. bcache.lock
+// protects the queues and allows one recycling at a time, which
+// keeps a block from being given two buffers.
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "memstats.h"
+
+#define NBHASH     4096
+#define NBSTRIPE   64
+#define BCACHEFRAC 16
+#define BPP        (PGSIZE / BSIZE)   // buffers per page of data
+
+// Queues, for buf.queue.
+#define BQPROB  1   // probation
+#define BQPROT  2   // protected
+
+struct stripe {
+  struct spinlock lock;   // Protects the chains of the stripe
+  uint hits;
+  uint misses;
+};
 
 struct {
   struct spinlock lock;
-  struct buf buf[NBUF];
+  struct buf *hash[NBHASH];         // Chains through hnext
+  struct stripe stripe[NBSTRIPE];   // Stripe of chain h is h % NBSTRIPE
+
+  // Replacement queues, through prev/next; head.next is newest.
+  struct buf prob;
+  struct buf prot;
+  int nprob;
+  int nprot;
 
-  // Linked list of all buffers, through prev/next.
-  // head.next is most recently used.
-  struct buf head;
+  struct buf *fresh;      // Buffers never used, through next
+  struct buf *spare;      // Headers without data, through next
+  uint nbuf;
+  uint npages;            // Pages of data and headers
 } bcache;
 
+static uint
+bhash(uint dev, uint blockno)
+{
+  return (dev + blockno) % NBHASH;
+}
+
+static struct stripe*
+bstripe(uint dev, uint blockno)
+{
+  return &bcache.stripe[bhash(dev, blockno) % NBSTRIPE];
+}
+
+// Add a page of fresh buffers to the cache.
+// Returns -1 if memory is exhausted.
+static int
+bgrow(void)
+{
+  struct buf *b, *hdrs;
+  char *data;
+  int i;
+
+  if((data = kalloc()) == 0)
+    return -1;
+  for(i = 0; i < BPP; i++){
+    if(bcache.spare == 0){
+      if((hdrs = (struct buf*)kalloc()) == 0){
+        kfree(data);
+        return -1;
+      }
+      bcache.npages++;
+      for(b = hdrs; b + 1 <= hdrs + PGSIZE / sizeof(*b); b++){
+        initsleeplock(&b->lock, "buffer");
+        b->next = bcache.spare;
+        bcache.spare = b;
+      }
+    }
+    b = bcache.spare;
+    bcache.spare = b->next;
+    b->data = (uchar*)data + i*BSIZE;
+    b->next = bcache.fresh;
+    bcache.fresh = b;
+  }
+  bcache.npages++;
+  bcache.nbuf += BPP;
+  return 0;
+}
+
+// Should the cache take more memory rather than recycle?
+static int
+bwantmore(void)
+{
+  uint total, free;
+
+  kcount(&total, &free);
+  return bcache.npages < total / BCACHEFRAC && free > total / 4;
+}
+
 void
 binit(void)
 {
-  struct buf *b;
+  int i;
 
   initlock(&bcache.lock, "bcache");
+  for(i = 0; i < NBSTRIPE; i++)
+    initlock(&bcache.stripe[i].lock, "bcache.stripe");
 
 //PAGEBREAK!
-  // Create linked list of buffers
-  bcache.head.prev = &bcache.head;
-  bcache.head.next = &bcache.head;
-  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
-  }
+  bcache.prob.prev = bcache.prob.next = &bcache.prob;
+  bcache.prot.prev = bcache.prot.next = &bcache.prot;
+  while(bcache.nbuf < NBUF)
+    if(bgrow() < 0)
+      panic("binit");
 }
 
-// Look through buffer cache for block on device dev.
-// If not found, allocate a buffer.
-// In either case, return locked buffer.
+// Queue b at the new end of q.
+static void
+qpush(struct buf *q, struct buf *b)
+{
+  b->next = q->next;
+  b->prev = q;
+  q->next->prev = b;
+  q->next = b;
+  b->queue = q == &bcache.prob ? BQPROB : BQPROT;
+  if(b->queue == BQPROB)
+    bcache.nprob++;
+  else
+    bcache.nprot++;
+}
+
+// Take the buffer at the old end of q off it.
 static struct buf*
-bget(uint dev, uint blockno)
+qpop(struct buf *q)
 {
   struct buf *b;
 
-  acquire(&bcache.lock);
+  b = q->prev;
+  b->prev->next = b->next;
+  b->next->prev = b->prev;
+  if(b->queue == BQPROB)
+    bcache.nprob--;
+  else
+    bcache.nprot--;
+  b->queue = 0;
+  return b;
+}
 
-  // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
+// Return the cached buffer for block blockno on dev with a new
+// reference, or 0. Caller holds the block's stripe lock.
+static struct buf*
+bfind(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  for(b = bcache.hash[bhash(dev, blockno)]; b; b = b->hnext){
     if(b->dev == dev && b->blockno == blockno){
       b->refcnt++;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
+      // Uses in the tick of the read are one use, as when
+      // a file is read a few bytes at a time. A block read
+      // ahead counts as read at its first use.
+      if(b->ahead){
+        b->ahead = 0;
+        b->born = ticks;
+      } else if(b->queue == BQPROT || ticks != b->born)
+        b->used = 1;
       return b;
     }
   }
+  return 0;
+}
+
+// Take b out of its chain if no one is using it.
+// Returns 0 if b is in use.
+static int
+btake(struct buf *b)
+{
+  struct stripe *s;
+  struct buf **pp;
 
-  // Not cached; recycle an unused buffer.
+  s = bstripe(b->dev, b->blockno);
+  acquire(&s->lock);
   // Even if refcnt==0, B_DIRTY indicates a buffer is in use
   // because log.c has modified it but not yet committed it.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
-      b->dev = dev;
-      b->blockno = blockno;
-      b->flags = 0;
-      b->refcnt = 1;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
+  if(b->refcnt != 0 || (b->flags & B_DIRTY)){
+    release(&s->lock);
+    return 0;
+  }
+  for(pp = &bcache.hash[bhash(b->dev, b->blockno)]; *pp != b; pp = &(*pp)->hnext)
+    ;
+  *pp = b->hnext;
+  release(&s->lock);
+  return 1;
+}
+
+// Find a buffer to recycle and take it out of its chain.
+// Returns 0 if all the buffers seem to be in use.
+// Caller holds bcache.lock.
+static struct buf*
+bvictim(void)
+{
+  struct buf *b;
+  uint n;
+
+  for(n = 0; n < 3*bcache.nbuf; n++){
+    if(bcache.nprot > bcache.nbuf/4*3 || bcache.nprob == 0){
+      // Sweep the protected queue: buffers used since the
+      // last pass stay, the others go back on probation.
+      if(bcache.nprot == 0)
+        break;
+      b = qpop(&bcache.prot);
+      if(b->used){
+        b->used = 0;
+        qpush(&bcache.prot, b);
+      } else
+        qpush(&bcache.prob, b);
+      continue;
     }
+    b = qpop(&bcache.prob);
+    if(b->used){
+      b->used = 0;
+      qpush(&bcache.prot, b);
+    } else if(btake(b)){
+      return b;
+    } else
+      qpush(&bcache.prob, b);
   }
-  panic("bget: no buffers");
+  return 0;
+}
+
+// Return a buffer for a block not in the cache: a fresh one,
+// or a recycled one. Caller holds bcache.lock.
+static struct buf*
+balloc(void)
+{
+  struct buf *b;
+
+  if(bcache.fresh == 0 && bwantmore())
+    bgrow();
+  if(bcache.fresh == 0 && (b = bvictim()) != 0)
+    return b;
+  if(bcache.fresh == 0)
+    bgrow();  // everything is in use: grow anyway
+  if((b = bcache.fresh) == 0)
+    panic("bget: no buffers");
+  bcache.fresh = b->next;
+  return b;
+}
+
+// Cache block blockno on dev in a new buffer, not yet valid,
+// with one reference. Caller holds bcache.lock and has found
+// the block is not cached.
+static struct buf*
+binsert(uint dev, uint blockno, int ahead)
+{
+  struct stripe *s;
+  struct buf *b, **head;
+
+  b = balloc();
+  b->dev = dev;
+  b->blockno = blockno;
+  b->flags = 0;
+  b->refcnt = 1;
+  b->born = ticks;
+  b->used = 0;
+  b->ahead = ahead;
+  qpush(&bcache.prob, b);
+  s = bstripe(dev, blockno);
+  head = &bcache.hash[bhash(dev, blockno)];
+  acquire(&s->lock);
+  b->hnext = *head;
+  *head = b;
+  release(&s->lock);
+  return b;
+}
+
+// Look through buffer cache for block on device dev.
+// If not found, allocate a buffer.
+// In either case, return locked buffer.
+static struct buf*
+bget(uint dev, uint blockno)
+{
+  struct stripe *s;
+  struct buf *b;
+
+  s = bstripe(dev, blockno);
+  acquire(&s->lock);
+  if((b = bfind(dev, blockno)) != 0)
+    s->hits++;
+  release(&s->lock);
+  if(b){
+    acquiresleep(&b->lock);
+    return b;
+  }
+
+  // Not cached; recycle an unused buffer, unless another
+  // process cached the block while this one waited.
+  acquire(&bcache.lock);
+  acquire(&s->lock);
+  if((b = bfind(dev, blockno)) != 0)
+    s->hits++;
+  else
+    s->misses++;
+  release(&s->lock);
+  if(b == 0)
+    b = binsert(dev, blockno, 0);
+  release(&bcache.lock);
+  acquiresleep(&b->lock);
+  return b;
 }
 
 // Return a locked buf with the contents of the indicated block.
@@ -105,6 +365,55 @@ bread(uint dev, uint blockno)
   return b;
 }
 
+// Start reading block blockno on dev into the cache, unless it
+// is there already, and return without waiting for the disk.
+void
+breadahead(uint dev, uint blockno)
+{
+  struct stripe *s;
+  struct buf *b;
+
+  s = bstripe(dev, blockno);
+  acquire(&bcache.lock);
+  acquire(&s->lock);
+  for(b = bcache.hash[bhash(dev, blockno)]; b; b = b->hnext)
+    if(b->dev == dev && b->blockno == blockno)
+      break;
+  release(&s->lock);
+  if(b){
+    release(&bcache.lock);
+    return;
+  }
+  b = binsert(dev, blockno, 1);
+  release(&bcache.lock);
+
+  // Someone may have found the new buffer and read it first.
+  acquiresleep(&b->lock);
+  if(b->flags & B_VALID){
+    brelse(b);
+    return;
+  }
+  b->flags |= B_ASYNC;
+  iderwasync(b);
+}
+
+// Finish an asynchronous request for b, releasing b for the
+// process that started it. Called by the disk driver, maybe
+// from an interrupt.
+void
+bdone(struct buf *b)
+{
+  struct stripe *s;
+
+  b->flags &= ~B_ASYNC;
+  releasesleep(&b->lock);
+
+  s = bstripe(b->dev, b->blockno);
+  acquire(&s->lock);
+  b->refcnt--;
+  release(&s->lock);
+}
+
 // Write b's contents to disk.  Must be locked.
 void
 bwrite(struct buf *b)
@@ -116,29 +425,39 @@ bwrite(struct buf *b)
 }
 
 // Release a locked buffer.
-// Move to the head of the MRU list.
 void
 brelse(struct buf *b)
 {
+  struct stripe *s;
+
   if(!holdingsleep(&b->lock))
     panic("brelse");
 
   releasesleep(&b->lock);
 
-  acquire(&bcache.lock);
+  s = bstripe(b->dev, b->blockno);
+  acquire(&s->lock);
   b->refcnt--;
-  if (b->refcnt == 0) {
-    // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
-  }
-  
+  release(&s->lock);
+}
+
+// Fill in the buffer cache's part of ms.
+void
+bstats(struct memstats *ms)
+{
+  struct stripe *s;
+
+  acquire(&bcache.lock);
+  ms->bufpages = bcache.npages;
+  ms->nbuf = bcache.nbuf;
   release(&bcache.lock);
+  ms->bhits = ms->bmisses = 0;
+  for(s = bcache.stripe; s < &bcache.stripe[NBSTRIPE]; s++){
+    acquire(&s->lock);
+    ms->bhits += s->hits;
+    ms->bmisses += s->misses;
+    release(&s->lock);
+  }
 }
 //PAGEBREAK!
 // Blank page.
-
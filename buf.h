@@ -4,11 +4,18 @@ struct buf {
   uint blockno;
   struct sleeplock lock;
   uint refcnt;
-  struct buf *prev; // LRU cache list
+  uint born;         // ticks when read in
+  char queue;        // replacement queue (see bio.c)
+  char used;         // used again since it was queued
+  char ahead;        // read ahead and not yet used
+  struct buf *hnext; // hash chain
+  struct buf *prev;  // replacement queue
   struct buf *next;
   struct buf *qnext; // disk queue
-  uchar data[BSIZE];
+  uint deadline;     // ticks by which the disk should get to it
+  uchar *data;       // BSIZE bytes
 };
 #define B_VALID 0x2  // buffer has been read from disk
 #define B_DIRTY 0x4  // buffer needs to be written to disk
+#define B_ASYNC 0x8  // no one waits for the disk: call bdone when done
 
@@ -0,0 +1,1793 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 01 00 00 00       	mov    $0x1,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7f 26                	jg     4f <main+0x4f>
+  29:	eb 52                	jmp    7d <main+0x7d>
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+  30:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 1; i < argc; i++){
+  33:	83 c6 01             	add    $0x1,%esi
+  36:	83 c3 04             	add    $0x4,%ebx
+    cat(fd);
+  39:	50                   	push   %eax
+  3a:	e8 51 00 00 00       	call   90 <cat>
+    close(fd);
+  3f:	89 3c 24             	mov    %edi,(%esp)
+  42:	e8 74 03 00 00       	call   3bb <close>
+  for(i = 1; i < argc; i++){
+  47:	83 c4 10             	add    $0x10,%esp
+  4a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  4d:	74 29                	je     78 <main+0x78>
+    if((fd = open(argv[i], 0)) < 0){
+  4f:	83 ec 08             	sub    $0x8,%esp
+  52:	6a 00                	push   $0x0
+  54:	ff 33                	push   (%ebx)
+  56:	e8 78 03 00 00       	call   3d3 <open>
+  5b:	83 c4 10             	add    $0x10,%esp
+  5e:	89 c7                	mov    %eax,%edi
+  60:	85 c0                	test   %eax,%eax
+  62:	79 cc                	jns    30 <main+0x30>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+  64:	50                   	push   %eax
+  65:	ff 33                	push   (%ebx)
+  67:	68 53 0c 00 00       	push   $0xc53
+  6c:	6a 01                	push   $0x1
+  6e:	e8 cd 04 00 00       	call   540 <printf>
+      exit();
+  73:	e8 1b 03 00 00       	call   393 <exit>
+  }
+  exit();
+  78:	e8 16 03 00 00       	call   393 <exit>
+    cat(0);
+  7d:	83 ec 0c             	sub    $0xc,%esp
+  80:	6a 00                	push   $0x0
+  82:	e8 09 00 00 00       	call   90 <cat>
+    exit();
+  87:	e8 07 03 00 00       	call   393 <exit>
+  8c:	66 90                	xchg   %ax,%ax
+  8e:	66 90                	xchg   %ax,%ax
+
+00000090 <cat>:
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	56                   	push   %esi
+  94:	53                   	push   %ebx
+  95:	8b 75 08             	mov    0x8(%ebp),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  98:	eb 1d                	jmp    b7 <cat+0x27>
+  9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if (write(1, buf, n) != n) {
+  a0:	83 ec 04             	sub    $0x4,%esp
+  a3:	53                   	push   %ebx
+  a4:	68 20 10 00 00       	push   $0x1020
+  a9:	6a 01                	push   $0x1
+  ab:	e8 03 03 00 00       	call   3b3 <write>
+  b0:	83 c4 10             	add    $0x10,%esp
+  b3:	39 d8                	cmp    %ebx,%eax
+  b5:	75 25                	jne    dc <cat+0x4c>
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  b7:	83 ec 04             	sub    $0x4,%esp
+  ba:	68 00 02 00 00       	push   $0x200
+  bf:	68 20 10 00 00       	push   $0x1020
+  c4:	56                   	push   %esi
+  c5:	e8 e1 02 00 00       	call   3ab <read>
+  ca:	83 c4 10             	add    $0x10,%esp
+  cd:	89 c3                	mov    %eax,%ebx
+  cf:	85 c0                	test   %eax,%eax
+  d1:	7f cd                	jg     a0 <cat+0x10>
+  if(n < 0){
+  d3:	75 1b                	jne    f0 <cat+0x60>
+}
+  d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  d8:	5b                   	pop    %ebx
+  d9:	5e                   	pop    %esi
+  da:	5d                   	pop    %ebp
+  db:	c3                   	ret
+      printf(1, "cat: write error\n");
+  dc:	83 ec 08             	sub    $0x8,%esp
+  df:	68 30 0c 00 00       	push   $0xc30
+  e4:	6a 01                	push   $0x1
+  e6:	e8 55 04 00 00       	call   540 <printf>
+      exit();
+  eb:	e8 a3 02 00 00       	call   393 <exit>
+    printf(1, "cat: read error\n");
+  f0:	50                   	push   %eax
+  f1:	50                   	push   %eax
+  f2:	68 42 0c 00 00       	push   $0xc42
+  f7:	6a 01                	push   $0x1
+  f9:	e8 42 04 00 00       	call   540 <printf>
+    exit();
+  fe:	e8 90 02 00 00       	call   393 <exit>
+ 103:	66 90                	xchg   %ax,%ax
+ 105:	66 90                	xchg   %ax,%ax
+ 107:	66 90                	xchg   %ax,%ax
+ 109:	66 90                	xchg   %ax,%ax
+ 10b:	66 90                	xchg   %ax,%ax
+ 10d:	66 90                	xchg   %ax,%ax
+ 10f:	90                   	nop
+
+00000110 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 110:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 111:	31 c0                	xor    %eax,%eax
+{
+ 113:	89 e5                	mov    %esp,%ebp
+ 115:	53                   	push   %ebx
+ 116:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 119:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 11c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 120:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 124:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 127:	83 c0 01             	add    $0x1,%eax
+ 12a:	84 d2                	test   %dl,%dl
+ 12c:	75 f2                	jne    120 <strcpy+0x10>
+    ;
+  return os;
+}
+ 12e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 131:	89 c8                	mov    %ecx,%eax
+ 133:	c9                   	leave
+ 134:	c3                   	ret
+ 135:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000140 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	53                   	push   %ebx
+ 144:	8b 55 08             	mov    0x8(%ebp),%edx
+ 147:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 14a:	0f b6 02             	movzbl (%edx),%eax
+ 14d:	84 c0                	test   %al,%al
+ 14f:	75 17                	jne    168 <strcmp+0x28>
+ 151:	eb 3a                	jmp    18d <strcmp+0x4d>
+ 153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 157:	90                   	nop
+ 158:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 15c:	83 c2 01             	add    $0x1,%edx
+ 15f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 162:	84 c0                	test   %al,%al
+ 164:	74 1a                	je     180 <strcmp+0x40>
+    p++, q++;
+ 166:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 168:	0f b6 19             	movzbl (%ecx),%ebx
+ 16b:	38 c3                	cmp    %al,%bl
+ 16d:	74 e9                	je     158 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 16f:	29 d8                	sub    %ebx,%eax
+}
+ 171:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 174:	c9                   	leave
+ 175:	c3                   	ret
+ 176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 180:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 184:	31 c0                	xor    %eax,%eax
+ 186:	29 d8                	sub    %ebx,%eax
+}
+ 188:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 18b:	c9                   	leave
+ 18c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 18d:	0f b6 19             	movzbl (%ecx),%ebx
+ 190:	31 c0                	xor    %eax,%eax
+ 192:	eb db                	jmp    16f <strcmp+0x2f>
+ 194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+
+000001a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1a6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1a9:	74 15                	je     1c0 <strlen+0x20>
+ 1ab:	31 c0                	xor    %eax,%eax
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+ 1b0:	83 c0 01             	add    $0x1,%eax
+ 1b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1b7:	89 c1                	mov    %eax,%ecx
+ 1b9:	75 f5                	jne    1b0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1bb:	89 c8                	mov    %ecx,%eax
+ 1bd:	5d                   	pop    %ebp
+ 1be:	c3                   	ret
+ 1bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1c0:	31 c9                	xor    %ecx,%ecx
+}
+ 1c2:	5d                   	pop    %ebp
+ 1c3:	89 c8                	mov    %ecx,%eax
+ 1c5:	c3                   	ret
+ 1c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	57                   	push   %edi
+ 1d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1da:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1dd:	89 d7                	mov    %edx,%edi
+ 1df:	fc                   	cld
+ 1e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1e5:	89 d0                	mov    %edx,%eax
+ 1e7:	c9                   	leave
+ 1e8:	c3                   	ret
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1fa:	0f b6 10             	movzbl (%eax),%edx
+ 1fd:	84 d2                	test   %dl,%dl
+ 1ff:	75 12                	jne    213 <strchr+0x23>
+ 201:	eb 1d                	jmp    220 <strchr+0x30>
+ 203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 207:	90                   	nop
+ 208:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 20c:	83 c0 01             	add    $0x1,%eax
+ 20f:	84 d2                	test   %dl,%dl
+ 211:	74 0d                	je     220 <strchr+0x30>
+    if(*s == c)
+ 213:	38 d1                	cmp    %dl,%cl
+ 215:	75 f1                	jne    208 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 217:	5d                   	pop    %ebp
+ 218:	c3                   	ret
+ 219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 220:	31 c0                	xor    %eax,%eax
+}
+ 222:	5d                   	pop    %ebp
+ 223:	c3                   	ret
+ 224:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 22f:	90                   	nop
+
+00000230 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	57                   	push   %edi
+ 234:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 235:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 238:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 239:	31 db                	xor    %ebx,%ebx
+{
+ 23b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 23e:	eb 27                	jmp    267 <gets+0x37>
+    cc = read(0, &c, 1);
+ 240:	83 ec 04             	sub    $0x4,%esp
+ 243:	6a 01                	push   $0x1
+ 245:	56                   	push   %esi
+ 246:	6a 00                	push   $0x0
+ 248:	e8 5e 01 00 00       	call   3ab <read>
+    if(cc < 1)
+ 24d:	83 c4 10             	add    $0x10,%esp
+ 250:	85 c0                	test   %eax,%eax
+ 252:	7e 1d                	jle    271 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 254:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 258:	8b 55 08             	mov    0x8(%ebp),%edx
+ 25b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 25f:	3c 0a                	cmp    $0xa,%al
+ 261:	74 10                	je     273 <gets+0x43>
+ 263:	3c 0d                	cmp    $0xd,%al
+ 265:	74 0c                	je     273 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 267:	89 df                	mov    %ebx,%edi
+ 269:	83 c3 01             	add    $0x1,%ebx
+ 26c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 26f:	7c cf                	jl     240 <gets+0x10>
+ 271:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 273:	8b 45 08             	mov    0x8(%ebp),%eax
+ 276:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 27a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 27d:	5b                   	pop    %ebx
+ 27e:	5e                   	pop    %esi
+ 27f:	5f                   	pop    %edi
+ 280:	5d                   	pop    %ebp
+ 281:	c3                   	ret
+ 282:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	56                   	push   %esi
+ 294:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 295:	83 ec 08             	sub    $0x8,%esp
+ 298:	6a 00                	push   $0x0
+ 29a:	ff 75 08             	push   0x8(%ebp)
+ 29d:	e8 31 01 00 00       	call   3d3 <open>
+  if(fd < 0)
+ 2a2:	83 c4 10             	add    $0x10,%esp
+ 2a5:	85 c0                	test   %eax,%eax
+ 2a7:	78 27                	js     2d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2a9:	83 ec 08             	sub    $0x8,%esp
+ 2ac:	ff 75 0c             	push   0xc(%ebp)
+ 2af:	89 c3                	mov    %eax,%ebx
+ 2b1:	50                   	push   %eax
+ 2b2:	e8 34 01 00 00       	call   3eb <fstat>
+  close(fd);
+ 2b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2bc:	e8 fa 00 00 00       	call   3bb <close>
+  return r;
+ 2c1:	83 c4 10             	add    $0x10,%esp
+}
+ 2c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2c7:	89 f0                	mov    %esi,%eax
+ 2c9:	5b                   	pop    %ebx
+ 2ca:	5e                   	pop    %esi
+ 2cb:	5d                   	pop    %ebp
+ 2cc:	c3                   	ret
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2d5:	eb ed                	jmp    2c4 <stat+0x34>
+ 2d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2de:	66 90                	xchg   %ax,%ax
+
+000002e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	53                   	push   %ebx
+ 2e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2e7:	0f be 02             	movsbl (%edx),%eax
+ 2ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2f5:	77 1e                	ja     315 <atoi+0x35>
+ 2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 300:	83 c2 01             	add    $0x1,%edx
+ 303:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 306:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 30a:	0f be 02             	movsbl (%edx),%eax
+ 30d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 310:	80 fb 09             	cmp    $0x9,%bl
+ 313:	76 eb                	jbe    300 <atoi+0x20>
+  return n;
+}
+ 315:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 318:	89 c8                	mov    %ecx,%eax
+ 31a:	c9                   	leave
+ 31b:	c3                   	ret
+ 31c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000320 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	57                   	push   %edi
+ 324:	56                   	push   %esi
+ 325:	8b 45 10             	mov    0x10(%ebp),%eax
+ 328:	8b 55 08             	mov    0x8(%ebp),%edx
+ 32b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 32e:	85 c0                	test   %eax,%eax
+ 330:	7e 13                	jle    345 <memmove+0x25>
+ 332:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 334:	89 d7                	mov    %edx,%edi
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 340:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 341:	39 f8                	cmp    %edi,%eax
+ 343:	75 fb                	jne    340 <memmove+0x20>
+  return vdst;
+}
+ 345:	5e                   	pop    %esi
+ 346:	89 d0                	mov    %edx,%eax
+ 348:	5f                   	pop    %edi
+ 349:	5d                   	pop    %ebp
+ 34a:	c3                   	ret
+
+0000034b <ccreate>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(ccreate)
+ 34b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <cfork>:
+SYSCALL(cfork)
+ 353:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <cgetrootdir>:
+SYSCALL(cgetrootdir)
+ 35b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <getcontrootdir>:
+SYSCALL(getcontrootdir)
+ 363:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <cpause>:
+SYSCALL(cpause)
+ 36b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <cresume>:
+SYSCALL(cresume)
+ 373:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <cstart>:
+SYSCALL(cstart)
+ 37b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <cstop>:
+SYSCALL(cstop)
+ 383:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <fork>:
+SYSCALL(fork)
+ 38b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <exit>:
+SYSCALL(exit)
+ 393:	b8 02 00 00 00       	mov    $0x2,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <wait>:
+SYSCALL(wait)
+ 39b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <pipe>:
+SYSCALL(pipe)
+ 3a3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <read>:
+SYSCALL(read)
+ 3ab:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <write>:
+SYSCALL(write)
+ 3b3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <close>:
+SYSCALL(close)
+ 3bb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <kill>:
+SYSCALL(kill)
+ 3c3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <exec>:
+SYSCALL(exec)
+ 3cb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <open>:
+SYSCALL(open)
+ 3d3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <mknod>:
+SYSCALL(mknod)
+ 3db:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <unlink>:
+SYSCALL(unlink)
+ 3e3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <fstat>:
+SYSCALL(fstat)
+ 3eb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <link>:
+SYSCALL(link)
+ 3f3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <mkdir>:
+SYSCALL(mkdir)
+ 3fb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <chdir>:
+SYSCALL(chdir)
+ 403:	b8 09 00 00 00       	mov    $0x9,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <dup>:
+SYSCALL(dup)
+ 40b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <getpid>:
+SYSCALL(getpid)
+ 413:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <sbrk>:
+SYSCALL(sbrk)
+ 41b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <sleep>:
+SYSCALL(sleep)
+ 423:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <uptime>:
+SYSCALL(uptime)
+ 42b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <cps>:
+SYSCALL(cps)
+ 433:	b8 16 00 00 00       	mov    $0x16,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <mmap>:
+SYSCALL(mmap)
+ 43b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <munmap>:
+SYSCALL(munmap)
+ 443:	b8 20 00 00 00       	mov    $0x20,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <shmget>:
+SYSCALL(shmget)
+ 44b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <climit>:
+SYSCALL(climit)
+ 453:	b8 22 00 00 00       	mov    $0x22,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <spawn>:
+SYSCALL(spawn)
+ 45b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <clone>:
+SYSCALL(clone)
+ 463:	b8 24 00 00 00       	mov    $0x24,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <join>:
+SYSCALL(join)
+ 46b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <futex>:
+SYSCALL(futex)
+ 473:	b8 26 00 00 00       	mov    $0x26,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <ccheckpoint>:
+SYSCALL(ccheckpoint)
+ 47b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <crestore>:
+SYSCALL(crestore)
+ 483:	b8 28 00 00 00       	mov    $0x28,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <czygote>:
+SYSCALL(czygote)
+ 48b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <memstats>:
+SYSCALL(memstats)
+ 493:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+ 49b:	66 90                	xchg   %ax,%ax
+ 49d:	66 90                	xchg   %ax,%ax
+ 49f:	90                   	nop
+
+000004a0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	57                   	push   %edi
+ 4a4:	56                   	push   %esi
+ 4a5:	53                   	push   %ebx
+ 4a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 4a8:	89 d1                	mov    %edx,%ecx
+{
+ 4aa:	83 ec 3c             	sub    $0x3c,%esp
+ 4ad:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 4b0:	85 d2                	test   %edx,%edx
+ 4b2:	0f 89 80 00 00 00    	jns    538 <printint+0x98>
+ 4b8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 4bc:	74 7a                	je     538 <printint+0x98>
+    x = -xx;
+ 4be:	f7 d9                	neg    %ecx
+    neg = 1;
+ 4c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 4c5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 4c8:	31 f6                	xor    %esi,%esi
+ 4ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 4d0:	89 c8                	mov    %ecx,%eax
+ 4d2:	31 d2                	xor    %edx,%edx
+ 4d4:	89 f7                	mov    %esi,%edi
+ 4d6:	f7 f3                	div    %ebx
+ 4d8:	8d 76 01             	lea    0x1(%esi),%esi
+ 4db:	0f b6 92 c8 0c 00 00 	movzbl 0xcc8(%edx),%edx
+ 4e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 4e6:	89 ca                	mov    %ecx,%edx
+ 4e8:	89 c1                	mov    %eax,%ecx
+ 4ea:	39 da                	cmp    %ebx,%edx
+ 4ec:	73 e2                	jae    4d0 <printint+0x30>
+  if(neg)
+ 4ee:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 4f1:	85 c0                	test   %eax,%eax
+ 4f3:	74 07                	je     4fc <printint+0x5c>
+    buf[i++] = '-';
+ 4f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 4fa:	89 f7                	mov    %esi,%edi
+ 4fc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 4ff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 502:	01 df                	add    %ebx,%edi
+ 504:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 508:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 50b:	83 ec 04             	sub    $0x4,%esp
+ 50e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 511:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 514:	6a 01                	push   $0x1
+ 516:	50                   	push   %eax
+ 517:	56                   	push   %esi
+ 518:	e8 96 fe ff ff       	call   3b3 <write>
+  while(--i >= 0)
+ 51d:	89 f8                	mov    %edi,%eax
+ 51f:	83 c4 10             	add    $0x10,%esp
+ 522:	83 ef 01             	sub    $0x1,%edi
+ 525:	39 d8                	cmp    %ebx,%eax
+ 527:	75 df                	jne    508 <printint+0x68>
+}
+ 529:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 52c:	5b                   	pop    %ebx
+ 52d:	5e                   	pop    %esi
+ 52e:	5f                   	pop    %edi
+ 52f:	5d                   	pop    %ebp
+ 530:	c3                   	ret
+ 531:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 538:	31 c0                	xor    %eax,%eax
+ 53a:	eb 89                	jmp    4c5 <printint+0x25>
+ 53c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000540 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	57                   	push   %edi
+ 544:	56                   	push   %esi
+ 545:	53                   	push   %ebx
+ 546:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 549:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 54c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 54f:	0f b6 1e             	movzbl (%esi),%ebx
+ 552:	83 c6 01             	add    $0x1,%esi
+ 555:	84 db                	test   %bl,%bl
+ 557:	74 67                	je     5c0 <printf+0x80>
+ 559:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 55c:	31 d2                	xor    %edx,%edx
+ 55e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 561:	eb 34                	jmp    597 <printf+0x57>
+ 563:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 567:	90                   	nop
+ 568:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 56b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 570:	83 f8 25             	cmp    $0x25,%eax
+ 573:	74 18                	je     58d <printf+0x4d>
+  write(fd, &c, 1);
+ 575:	83 ec 04             	sub    $0x4,%esp
+ 578:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 57b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 57e:	6a 01                	push   $0x1
+ 580:	50                   	push   %eax
+ 581:	57                   	push   %edi
+ 582:	e8 2c fe ff ff       	call   3b3 <write>
+ 587:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 58a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 58d:	0f b6 1e             	movzbl (%esi),%ebx
+ 590:	83 c6 01             	add    $0x1,%esi
+ 593:	84 db                	test   %bl,%bl
+ 595:	74 29                	je     5c0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 597:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 59a:	85 d2                	test   %edx,%edx
+ 59c:	74 ca                	je     568 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 59e:	83 fa 25             	cmp    $0x25,%edx
+ 5a1:	75 ea                	jne    58d <printf+0x4d>
+      if(c == 'd'){
+ 5a3:	83 f8 25             	cmp    $0x25,%eax
+ 5a6:	0f 84 24 01 00 00    	je     6d0 <printf+0x190>
+ 5ac:	83 e8 63             	sub    $0x63,%eax
+ 5af:	83 f8 15             	cmp    $0x15,%eax
+ 5b2:	77 1c                	ja     5d0 <printf+0x90>
+ 5b4:	ff 24 85 70 0c 00 00 	jmp    *0xc70(,%eax,4)
+ 5bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5bf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 5c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5c3:	5b                   	pop    %ebx
+ 5c4:	5e                   	pop    %esi
+ 5c5:	5f                   	pop    %edi
+ 5c6:	5d                   	pop    %ebp
+ 5c7:	c3                   	ret
+ 5c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cf:	90                   	nop
+  write(fd, &c, 1);
+ 5d0:	83 ec 04             	sub    $0x4,%esp
+ 5d3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5d6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 5da:	6a 01                	push   $0x1
+ 5dc:	52                   	push   %edx
+ 5dd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 5e0:	57                   	push   %edi
+ 5e1:	e8 cd fd ff ff       	call   3b3 <write>
+ 5e6:	83 c4 0c             	add    $0xc,%esp
+ 5e9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5ec:	6a 01                	push   $0x1
+ 5ee:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 5f1:	52                   	push   %edx
+ 5f2:	57                   	push   %edi
+ 5f3:	e8 bb fd ff ff       	call   3b3 <write>
+        putc(fd, c);
+ 5f8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5fb:	31 d2                	xor    %edx,%edx
+ 5fd:	eb 8e                	jmp    58d <printf+0x4d>
+ 5ff:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 600:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 603:	83 ec 0c             	sub    $0xc,%esp
+ 606:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 60b:	8b 13                	mov    (%ebx),%edx
+ 60d:	6a 00                	push   $0x0
+ 60f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 611:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 614:	e8 87 fe ff ff       	call   4a0 <printint>
+        ap++;
+ 619:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 61c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 61f:	31 d2                	xor    %edx,%edx
+ 621:	e9 67 ff ff ff       	jmp    58d <printf+0x4d>
+ 626:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 62d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 630:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 633:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 635:	83 c0 04             	add    $0x4,%eax
+ 638:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 63b:	85 db                	test   %ebx,%ebx
+ 63d:	0f 84 9d 00 00 00    	je     6e0 <printf+0x1a0>
+        while(*s != 0){
+ 643:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 646:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 648:	84 c0                	test   %al,%al
+ 64a:	0f 84 3d ff ff ff    	je     58d <printf+0x4d>
+ 650:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 653:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 656:	89 de                	mov    %ebx,%esi
+ 658:	89 d3                	mov    %edx,%ebx
+ 65a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 660:	83 ec 04             	sub    $0x4,%esp
+ 663:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 666:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 669:	6a 01                	push   $0x1
+ 66b:	53                   	push   %ebx
+ 66c:	57                   	push   %edi
+ 66d:	e8 41 fd ff ff       	call   3b3 <write>
+        while(*s != 0){
+ 672:	0f b6 06             	movzbl (%esi),%eax
+ 675:	83 c4 10             	add    $0x10,%esp
+ 678:	84 c0                	test   %al,%al
+ 67a:	75 e4                	jne    660 <printf+0x120>
+      state = 0;
+ 67c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 67f:	31 d2                	xor    %edx,%edx
+ 681:	e9 07 ff ff ff       	jmp    58d <printf+0x4d>
+ 686:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 68d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 690:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 693:	83 ec 0c             	sub    $0xc,%esp
+ 696:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 69b:	8b 13                	mov    (%ebx),%edx
+ 69d:	6a 01                	push   $0x1
+ 69f:	e9 6b ff ff ff       	jmp    60f <printf+0xcf>
+ 6a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 6a8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 6ab:	83 ec 04             	sub    $0x4,%esp
+ 6ae:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 6b1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 6b3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 6b6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6b9:	6a 01                	push   $0x1
+ 6bb:	52                   	push   %edx
+ 6bc:	57                   	push   %edi
+ 6bd:	e8 f1 fc ff ff       	call   3b3 <write>
+        ap++;
+ 6c2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6c5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6c8:	31 d2                	xor    %edx,%edx
+ 6ca:	e9 be fe ff ff       	jmp    58d <printf+0x4d>
+ 6cf:	90                   	nop
+  write(fd, &c, 1);
+ 6d0:	83 ec 04             	sub    $0x4,%esp
+ 6d3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6d6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6d9:	6a 01                	push   $0x1
+ 6db:	e9 11 ff ff ff       	jmp    5f1 <printf+0xb1>
+ 6e0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 6e5:	bb 68 0c 00 00       	mov    $0xc68,%ebx
+ 6ea:	e9 61 ff ff ff       	jmp    650 <printf+0x110>
+ 6ef:	90                   	nop
+
+000006f0 <runfree>:
+
+// Give the n pages at r back to the free runs, merging them with
+// adjacent runs, and shrink the heap if the end of it is free.
+static void
+runfree(struct page *r, uint n)
+{
+ 6f0:	55                   	push   %ebp
+  struct page **pp, *prev;
+
+  r->kind = PFREE;
+ 6f1:	b9 03 00 00 00       	mov    $0x3,%ecx
+{
+ 6f6:	89 e5                	mov    %esp,%ebp
+ 6f8:	57                   	push   %edi
+ 6f9:	56                   	push   %esi
+ 6fa:	53                   	push   %ebx
+ 6fb:	89 c3                	mov    %eax,%ebx
+ 6fd:	83 ec 0c             	sub    $0xc,%esp
+  r->kind = PFREE;
+ 700:	66 89 08             	mov    %cx,(%eax)
+  r->npages = n;
+  prev = 0;
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 703:	8b 0d 24 12 00 00    	mov    0x1224,%ecx
+  r->npages = n;
+ 709:	89 50 04             	mov    %edx,0x4(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 70c:	85 c9                	test   %ecx,%ecx
+ 70e:	0f 84 1f 01 00 00    	je     833 <runfree+0x143>
+ 714:	39 c1                	cmp    %eax,%ecx
+ 716:	0f 83 f7 00 00 00    	jae    813 <runfree+0x123>
+ 71c:	89 c8                	mov    %ecx,%eax
+ 71e:	eb 04                	jmp    724 <runfree+0x34>
+ 720:	39 d8                	cmp    %ebx,%eax
+ 722:	73 09                	jae    72d <runfree+0x3d>
+ 724:	89 c2                	mov    %eax,%edx
+ 726:	8b 40 14             	mov    0x14(%eax),%eax
+ 729:	85 c0                	test   %eax,%eax
+ 72b:	75 f3                	jne    720 <runfree+0x30>
+    prev = *pp;
+  r->next = *pp;
+ 72d:	89 43 14             	mov    %eax,0x14(%ebx)
+  *pp = r;
+ 730:	89 5a 14             	mov    %ebx,0x14(%edx)
+
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 733:	8b 43 14             	mov    0x14(%ebx),%eax
+ 736:	85 c0                	test   %eax,%eax
+ 738:	74 12                	je     74c <runfree+0x5c>
+ 73a:	8b 7b 04             	mov    0x4(%ebx),%edi
+ 73d:	89 fe                	mov    %edi,%esi
+ 73f:	c1 e6 0c             	shl    $0xc,%esi
+ 742:	01 de                	add    %ebx,%esi
+ 744:	39 f0                	cmp    %esi,%eax
+ 746:	0f 84 a4 00 00 00    	je     7f0 <runfree+0x100>
+    r->npages += r->next->npages;
+    r->next = r->next->next;
+  }
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 74c:	8b 72 04             	mov    0x4(%edx),%esi
+ 74f:	89 f0                	mov    %esi,%eax
+ 751:	c1 e0 0c             	shl    $0xc,%eax
+ 754:	01 d0                	add    %edx,%eax
+ 756:	39 c3                	cmp    %eax,%ebx
+ 758:	74 16                	je     770 <runfree+0x80>
+    pp = &runs;
+    while(*pp != r)
+      pp = &(*pp)->next;
+  }
+
+  if(r->next == 0 && r->npages >= TRIM &&
+ 75a:	8b 43 14             	mov    0x14(%ebx),%eax
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 75d:	8d 72 14             	lea    0x14(%edx),%esi
+  if(r->next == 0 && r->npages >= TRIM &&
+ 760:	85 c0                	test   %eax,%eax
+ 762:	74 3c                	je     7a0 <runfree+0xb0>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+    *pp = 0;
+    sbrk(-(int)(r->npages*PGSIZE));
+    heapend = (char*)r;
+  }
+}
+ 764:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 767:	5b                   	pop    %ebx
+ 768:	5e                   	pop    %esi
+ 769:	5f                   	pop    %edi
+ 76a:	5d                   	pop    %ebp
+ 76b:	c3                   	ret
+ 76c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    prev->npages += r->npages;
+ 770:	03 73 04             	add    0x4(%ebx),%esi
+ 773:	89 72 04             	mov    %esi,0x4(%edx)
+    prev->next = r->next;
+ 776:	8b 43 14             	mov    0x14(%ebx),%eax
+ 779:	89 42 14             	mov    %eax,0x14(%edx)
+    while(*pp != r)
+ 77c:	39 d1                	cmp    %edx,%ecx
+ 77e:	0f 84 c5 00 00 00    	je     849 <runfree+0x159>
+ 784:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      pp = &(*pp)->next;
+ 788:	89 cb                	mov    %ecx,%ebx
+ 78a:	8b 49 14             	mov    0x14(%ecx),%ecx
+    while(*pp != r)
+ 78d:	39 d1                	cmp    %edx,%ecx
+ 78f:	75 f7                	jne    788 <runfree+0x98>
+      pp = &(*pp)->next;
+ 791:	8d 73 14             	lea    0x14(%ebx),%esi
+ 794:	89 cb                	mov    %ecx,%ebx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 796:	85 c0                	test   %eax,%eax
+ 798:	75 ca                	jne    764 <runfree+0x74>
+ 79a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 7a0:	8b 53 04             	mov    0x4(%ebx),%edx
+ 7a3:	83 fa 1f             	cmp    $0x1f,%edx
+ 7a6:	76 bc                	jbe    764 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 7a8:	c1 e2 0c             	shl    $0xc,%edx
+ 7ab:	01 da                	add    %ebx,%edx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 7ad:	39 15 20 12 00 00    	cmp    %edx,0x1220
+ 7b3:	75 af                	jne    764 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 7b5:	83 ec 0c             	sub    $0xc,%esp
+ 7b8:	6a 00                	push   $0x0
+ 7ba:	e8 5c fc ff ff       	call   41b <sbrk>
+ 7bf:	83 c4 10             	add    $0x10,%esp
+ 7c2:	39 05 20 12 00 00    	cmp    %eax,0x1220
+ 7c8:	75 9a                	jne    764 <runfree+0x74>
+    *pp = 0;
+ 7ca:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    sbrk(-(int)(r->npages*PGSIZE));
+ 7d0:	8b 43 04             	mov    0x4(%ebx),%eax
+ 7d3:	83 ec 0c             	sub    $0xc,%esp
+ 7d6:	c1 e0 0c             	shl    $0xc,%eax
+ 7d9:	f7 d8                	neg    %eax
+ 7db:	50                   	push   %eax
+ 7dc:	e8 3a fc ff ff       	call   41b <sbrk>
+    heapend = (char*)r;
+ 7e1:	89 1d 20 12 00 00    	mov    %ebx,0x1220
+ 7e7:	83 c4 10             	add    $0x10,%esp
+}
+ 7ea:	e9 75 ff ff ff       	jmp    764 <runfree+0x74>
+ 7ef:	90                   	nop
+    r->npages += r->next->npages;
+ 7f0:	03 78 04             	add    0x4(%eax),%edi
+ 7f3:	89 7b 04             	mov    %edi,0x4(%ebx)
+    r->next = r->next->next;
+ 7f6:	8b 40 14             	mov    0x14(%eax),%eax
+ 7f9:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 7fc:	8b 72 04             	mov    0x4(%edx),%esi
+ 7ff:	89 f0                	mov    %esi,%eax
+ 801:	c1 e0 0c             	shl    $0xc,%eax
+ 804:	01 d0                	add    %edx,%eax
+ 806:	39 c3                	cmp    %eax,%ebx
+ 808:	0f 85 4c ff ff ff    	jne    75a <runfree+0x6a>
+ 80e:	e9 5d ff ff ff       	jmp    770 <runfree+0x80>
+  r->next = *pp;
+ 813:	89 48 14             	mov    %ecx,0x14(%eax)
+  *pp = r;
+ 816:	a3 24 12 00 00       	mov    %eax,0x1224
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 81b:	89 d0                	mov    %edx,%eax
+ 81d:	c1 e0 0c             	shl    $0xc,%eax
+ 820:	01 d8                	add    %ebx,%eax
+ 822:	39 c1                	cmp    %eax,%ecx
+ 824:	74 2f                	je     855 <runfree+0x165>
+  if(r->next == 0 && r->npages >= TRIM &&
+ 826:	8b 43 14             	mov    0x14(%ebx),%eax
+ 829:	be 24 12 00 00       	mov    $0x1224,%esi
+ 82e:	e9 2d ff ff ff       	jmp    760 <runfree+0x70>
+  r->next = *pp;
+ 833:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 83a:	be 24 12 00 00       	mov    $0x1224,%esi
+  *pp = r;
+ 83f:	a3 24 12 00 00       	mov    %eax,0x1224
+  if(r->next == 0 && r->npages >= TRIM &&
+ 844:	e9 5a ff ff ff       	jmp    7a3 <runfree+0xb3>
+    while(*pp != r)
+ 849:	89 cb                	mov    %ecx,%ebx
+    pp = &runs;
+ 84b:	be 24 12 00 00       	mov    $0x1224,%esi
+ 850:	e9 0b ff ff ff       	jmp    760 <runfree+0x70>
+    r->npages += r->next->npages;
+ 855:	03 51 04             	add    0x4(%ecx),%edx
+ 858:	89 53 04             	mov    %edx,0x4(%ebx)
+    r->next = r->next->next;
+ 85b:	8b 41 14             	mov    0x14(%ecx),%eax
+ 85e:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 861:	eb c3                	jmp    826 <runfree+0x136>
+ 863:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 86a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000870 <runalloc>:
+
+// Take a run of n pages from the start of the first free run
+// long enough, which keeps the end of the heap free to trim.
+static struct page*
+runalloc(uint n)
+{
+ 870:	55                   	push   %ebp
+ 871:	89 e5                	mov    %esp,%ebp
+ 873:	57                   	push   %edi
+ 874:	56                   	push   %esi
+ 875:	89 c6                	mov    %eax,%esi
+ 877:	53                   	push   %ebx
+ 878:	83 ec 1c             	sub    $0x1c,%esp
+  struct page **pp, *r, *rest;
+
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ 87b:	8b 1d 24 12 00 00    	mov    0x1224,%ebx
+ 881:	85 db                	test   %ebx,%ebx
+ 883:	74 4d                	je     8d2 <runalloc+0x62>
+ 885:	b9 24 12 00 00       	mov    $0x1224,%ecx
+    if(r->npages < n)
+ 88a:	39 73 04             	cmp    %esi,0x4(%ebx)
+ 88d:	72 39                	jb     8c8 <runalloc+0x58>
+      continue;
+    if(r->npages == n){
+ 88f:	0f 84 9b 00 00 00    	je     930 <runalloc+0xc0>
+      *pp = r->next;
+    } else {
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ 895:	89 f0                	mov    %esi,%eax
+      rest->kind = PFREE;
+ 897:	ba 03 00 00 00       	mov    $0x3,%edx
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ 89c:	c1 e0 0c             	shl    $0xc,%eax
+ 89f:	01 d8                	add    %ebx,%eax
+      rest->kind = PFREE;
+ 8a1:	66 89 10             	mov    %dx,(%eax)
+      rest->npages = r->npages - n;
+ 8a4:	8b 53 04             	mov    0x4(%ebx),%edx
+ 8a7:	29 f2                	sub    %esi,%edx
+ 8a9:	89 50 04             	mov    %edx,0x4(%eax)
+      rest->next = r->next;
+ 8ac:	8b 53 14             	mov    0x14(%ebx),%edx
+ 8af:	89 50 14             	mov    %edx,0x14(%eax)
+      *pp = rest;
+ 8b2:	89 01                	mov    %eax,(%ecx)
+      r->npages = n;
+ 8b4:	89 73 04             	mov    %esi,0x4(%ebx)
+    }
+    return r;
+  }
+  return morecore(n);
+}
+ 8b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8ba:	89 d8                	mov    %ebx,%eax
+ 8bc:	5b                   	pop    %ebx
+ 8bd:	5e                   	pop    %esi
+ 8be:	5f                   	pop    %edi
+ 8bf:	5d                   	pop    %ebp
+ 8c0:	c3                   	ret
+ 8c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ 8c8:	8d 4b 14             	lea    0x14(%ebx),%ecx
+ 8cb:	8b 5b 14             	mov    0x14(%ebx),%ebx
+ 8ce:	85 db                	test   %ebx,%ebx
+ 8d0:	75 b8                	jne    88a <runalloc+0x1a>
+  m = n < MINCORE ? MINCORE : n;
+ 8d2:	bf 08 00 00 00       	mov    $0x8,%edi
+ 8d7:	39 fe                	cmp    %edi,%esi
+ 8d9:	0f 43 fe             	cmovae %esi,%edi
+  brk = sbrk(0);
+ 8dc:	83 ec 0c             	sub    $0xc,%esp
+ 8df:	6a 00                	push   $0x0
+ 8e1:	e8 35 fb ff ff       	call   41b <sbrk>
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 8e6:	89 fa                	mov    %edi,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 8e8:	89 c3                	mov    %eax,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 8ea:	c1 e2 0c             	shl    $0xc,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 8ed:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 8f0:	f7 db                	neg    %ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 8f2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 8f5:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 8fb:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+ 8fe:	89 04 24             	mov    %eax,(%esp)
+ 901:	e8 15 fb ff ff       	call   41b <sbrk>
+ 906:	83 c4 10             	add    $0x10,%esp
+ 909:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 90c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 90f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 912:	74 3e                	je     952 <runalloc+0xe2>
+  r = (struct page*)(brk + pad);
+ 914:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ 916:	01 da                	add    %ebx,%edx
+ 918:	89 15 20 12 00 00    	mov    %edx,0x1220
+  if(m > n)
+ 91e:	39 fe                	cmp    %edi,%esi
+ 920:	72 1e                	jb     940 <runalloc+0xd0>
+  r->npages = n;
+ 922:	89 73 04             	mov    %esi,0x4(%ebx)
+  return r;
+ 925:	eb 90                	jmp    8b7 <runalloc+0x47>
+ 927:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 92e:	66 90                	xchg   %ax,%ax
+      *pp = r->next;
+ 930:	8b 43 14             	mov    0x14(%ebx),%eax
+ 933:	89 01                	mov    %eax,(%ecx)
+}
+ 935:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 938:	89 d8                	mov    %ebx,%eax
+ 93a:	5b                   	pop    %ebx
+ 93b:	5e                   	pop    %esi
+ 93c:	5f                   	pop    %edi
+ 93d:	5d                   	pop    %ebp
+ 93e:	c3                   	ret
+ 93f:	90                   	nop
+    runfree((struct page*)((char*)r + n*PGSIZE), m - n);
+ 940:	89 f0                	mov    %esi,%eax
+ 942:	29 f7                	sub    %esi,%edi
+ 944:	c1 e0 0c             	shl    $0xc,%eax
+ 947:	89 fa                	mov    %edi,%edx
+ 949:	01 d8                	add    %ebx,%eax
+ 94b:	e8 a0 fd ff ff       	call   6f0 <runfree>
+ 950:	eb d0                	jmp    922 <runalloc+0xb2>
+    if(sbrk(pad + m*PGSIZE) == (char*)-1)
+ 952:	89 f7                	mov    %esi,%edi
+ 954:	83 ec 0c             	sub    $0xc,%esp
+ 957:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 95a:	c1 e7 0c             	shl    $0xc,%edi
+ 95d:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+ 960:	50                   	push   %eax
+ 961:	e8 b5 fa ff ff       	call   41b <sbrk>
+ 966:	83 c4 10             	add    $0x10,%esp
+ 969:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 96c:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 96f:	74 0c                	je     97d <runalloc+0x10d>
+  r = (struct page*)(brk + pad);
+ 971:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ 973:	01 df                	add    %ebx,%edi
+ 975:	89 3d 20 12 00 00    	mov    %edi,0x1220
+  if(m > n)
+ 97b:	eb a5                	jmp    922 <runalloc+0xb2>
+      return 0;
+ 97d:	31 db                	xor    %ebx,%ebx
+ 97f:	e9 33 ff ff ff       	jmp    8b7 <runalloc+0x47>
+ 984:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 98b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 98f:	90                   	nop
+
+00000990 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+ 990:	55                   	push   %ebp
+ 991:	89 e5                	mov    %esp,%ebp
+ 993:	56                   	push   %esi
+ 994:	53                   	push   %ebx
+ 995:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  struct page *p;
+
+  if(ap == 0)
+ 998:	85 c9                	test   %ecx,%ecx
+ 99a:	74 1c                	je     9b8 <free+0x28>
+    return;
+  p = (struct page*)((uint)ap & ~(PGSIZE-1));
+ 99c:	89 c8                	mov    %ecx,%eax
+ 99e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  switch(p->kind){
+ 9a3:	0f b7 10             	movzwl (%eax),%edx
+ 9a6:	66 83 fa 02          	cmp    $0x2,%dx
+ 9aa:	74 14                	je     9c0 <free+0x30>
+ 9ac:	66 83 fa 04          	cmp    $0x4,%dx
+ 9b0:	74 66                	je     a18 <free+0x88>
+ 9b2:	66 83 fa 01          	cmp    $0x1,%dx
+ 9b6:	74 18                	je     9d0 <free+0x40>
+    break;
+  case PMAP:
+    munmap(p, p->npages*PGSIZE);
+    break;
+  }
+}
+ 9b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 9bb:	5b                   	pop    %ebx
+ 9bc:	5e                   	pop    %esi
+ 9bd:	5d                   	pop    %ebp
+ 9be:	c3                   	ret
+ 9bf:	90                   	nop
+    runfree(p, p->npages);
+ 9c0:	8b 50 04             	mov    0x4(%eax),%edx
+}
+ 9c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 9c6:	5b                   	pop    %ebx
+ 9c7:	5e                   	pop    %esi
+ 9c8:	5d                   	pop    %ebp
+    runfree(p, p->npages);
+ 9c9:	e9 22 fd ff ff       	jmp    6f0 <runfree>
+ 9ce:	66 90                	xchg   %ax,%ax
+  b->next = p->free;
+ 9d0:	8b 50 0c             	mov    0xc(%eax),%edx
+ 9d3:	89 11                	mov    %edx,(%ecx)
+  if(p->nfree++ == 0)
+ 9d5:	8b 50 08             	mov    0x8(%eax),%edx
+  p->free = b;
+ 9d8:	89 48 0c             	mov    %ecx,0xc(%eax)
+  if(p->nfree++ == 0)
+ 9db:	8d 5a 01             	lea    0x1(%edx),%ebx
+ 9de:	89 58 08             	mov    %ebx,0x8(%eax)
+ 9e1:	85 d2                	test   %edx,%edx
+ 9e3:	74 53                	je     a38 <free+0xa8>
+  if(p->nfree == nblocks(p->class)){
+ 9e5:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ 9e9:	8d 4e 04             	lea    0x4(%esi),%ecx
+ 9ec:	ba e0 0f 00 00       	mov    $0xfe0,%edx
+ 9f1:	d3 fa                	sar    %cl,%edx
+  if(p->nfree == nblocks(p->class)){
+ 9f3:	39 da                	cmp    %ebx,%edx
+ 9f5:	75 c1                	jne    9b8 <free+0x28>
+  if(p->prev)
+ 9f7:	8b 48 18             	mov    0x18(%eax),%ecx
+    p->prev->next = p->next;
+ 9fa:	8b 50 14             	mov    0x14(%eax),%edx
+  if(p->prev)
+ 9fd:	85 c9                	test   %ecx,%ecx
+ 9ff:	74 6f                	je     a70 <free+0xe0>
+    p->prev->next = p->next;
+ a01:	89 51 14             	mov    %edx,0x14(%ecx)
+  if(p->next)
+ a04:	85 d2                	test   %edx,%edx
+ a06:	74 06                	je     a0e <free+0x7e>
+    p->next->prev = p->prev;
+ a08:	8b 48 18             	mov    0x18(%eax),%ecx
+ a0b:	89 4a 18             	mov    %ecx,0x18(%edx)
+    runfree(p, 1);
+ a0e:	ba 01 00 00 00       	mov    $0x1,%edx
+ a13:	eb ae                	jmp    9c3 <free+0x33>
+ a15:	8d 76 00             	lea    0x0(%esi),%esi
+    munmap(p, p->npages*PGSIZE);
+ a18:	8b 50 04             	mov    0x4(%eax),%edx
+ a1b:	83 ec 08             	sub    $0x8,%esp
+ a1e:	c1 e2 0c             	shl    $0xc,%edx
+ a21:	52                   	push   %edx
+ a22:	50                   	push   %eax
+ a23:	e8 1b fa ff ff       	call   443 <munmap>
+    break;
+ a28:	83 c4 10             	add    $0x10,%esp
+}
+ a2b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a2e:	5b                   	pop    %ebx
+ a2f:	5e                   	pop    %esi
+ a30:	5d                   	pop    %ebp
+ a31:	c3                   	ret
+ a32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  p->next = partial[p->class];
+ a38:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  p->prev = 0;
+ a3c:	c7 40 18 00 00 00 00 	movl   $0x0,0x18(%eax)
+  p->next = partial[p->class];
+ a43:	bb 01 00 00 00       	mov    $0x1,%ebx
+ a48:	8b 14 b5 28 12 00 00 	mov    0x1228(,%esi,4),%edx
+ a4f:	89 50 14             	mov    %edx,0x14(%eax)
+  if(p->next)
+ a52:	85 d2                	test   %edx,%edx
+ a54:	74 0a                	je     a60 <free+0xd0>
+    p->next->prev = p;
+ a56:	89 42 18             	mov    %eax,0x18(%edx)
+  partial[p->class] = p;
+ a59:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  if(p->nfree == nblocks(p->class)){
+ a5d:	8b 58 08             	mov    0x8(%eax),%ebx
+  partial[p->class] = p;
+ a60:	89 04 b5 28 12 00 00 	mov    %eax,0x1228(,%esi,4)
+}
+ a67:	eb 80                	jmp    9e9 <free+0x59>
+ a69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ a70:	89 14 b5 28 12 00 00 	mov    %edx,0x1228(,%esi,4)
+ a77:	eb 8b                	jmp    a04 <free+0x74>
+ a79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000a80 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ a80:	55                   	push   %ebp
+ a81:	89 e5                	mov    %esp,%ebp
+ a83:	56                   	push   %esi
+ a84:	53                   	push   %ebx
+ a85:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct page *p;
+  uint n;
+
+  if(nbytes <= MAXSMALL)
+ a88:	3d 00 04 00 00       	cmp    $0x400,%eax
+ a8d:	76 71                	jbe    b00 <malloc+0x80>
+    return smallalloc(sizeclass(nbytes));
+  if(nbytes > 0x7fffffff)
+ a8f:	85 c0                	test   %eax,%eax
+ a91:	0f 88 d9 00 00 00    	js     b70 <malloc+0xf0>
+    return 0;
+  n = (nbytes + HDRSIZE + PGSIZE-1) / PGSIZE;
+ a97:	8d 90 1f 10 00 00    	lea    0x101f(%eax),%edx
+ a9d:	89 d3                	mov    %edx,%ebx
+ a9f:	c1 eb 0c             	shr    $0xc,%ebx
+  if(nbytes >= MAPMIN){
+ aa2:	3d ff ff 00 00       	cmp    $0xffff,%eax
+ aa7:	77 27                	ja     ad0 <malloc+0x50>
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    if(p == MAP_FAILED)
+      return 0;
+    p->kind = PMAP;
+  } else {
+    if((p = runalloc(n)) == 0)
+ aa9:	89 d8                	mov    %ebx,%eax
+ aab:	e8 c0 fd ff ff       	call   870 <runalloc>
+ ab0:	85 c0                	test   %eax,%eax
+ ab2:	0f 84 b8 00 00 00    	je     b70 <malloc+0xf0>
+      return 0;
+    p->kind = PRUN;
+ ab8:	ba 02 00 00 00       	mov    $0x2,%edx
+ abd:	66 89 10             	mov    %dx,(%eax)
+  }
+  p->npages = n;
+ ac0:	89 58 04             	mov    %ebx,0x4(%eax)
+  return (char*)p + HDRSIZE;
+ ac3:	8d 58 20             	lea    0x20(%eax),%ebx
+}
+ ac6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ ac9:	89 d8                	mov    %ebx,%eax
+ acb:	5b                   	pop    %ebx
+ acc:	5e                   	pop    %esi
+ acd:	5d                   	pop    %ebp
+ ace:	c3                   	ret
+ acf:	90                   	nop
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+ ad0:	83 ec 08             	sub    $0x8,%esp
+ ad3:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+ ad9:	6a 00                	push   $0x0
+ adb:	6a ff                	push   $0xffffffff
+ add:	6a 22                	push   $0x22
+ adf:	6a 03                	push   $0x3
+ ae1:	52                   	push   %edx
+ ae2:	6a 00                	push   $0x0
+ ae4:	e8 52 f9 ff ff       	call   43b <mmap>
+    if(p == MAP_FAILED)
+ ae9:	83 c4 20             	add    $0x20,%esp
+ aec:	83 f8 ff             	cmp    $0xffffffff,%eax
+ aef:	74 7f                	je     b70 <malloc+0xf0>
+    p->kind = PMAP;
+ af1:	b9 04 00 00 00       	mov    $0x4,%ecx
+ af6:	66 89 08             	mov    %cx,(%eax)
+ af9:	eb c5                	jmp    ac0 <malloc+0x40>
+ afb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ aff:	90                   	nop
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ b00:	83 f8 10             	cmp    $0x10,%eax
+ b03:	0f 86 07 01 00 00    	jbe    c10 <malloc+0x190>
+ b09:	31 db                	xor    %ebx,%ebx
+ b0b:	ba 10 00 00 00       	mov    $0x10,%edx
+ b10:	83 c3 01             	add    $0x1,%ebx
+ b13:	89 d6                	mov    %edx,%esi
+ b15:	89 d9                	mov    %ebx,%ecx
+ b17:	d3 e6                	shl    %cl,%esi
+ b19:	39 c6                	cmp    %eax,%esi
+ b1b:	72 f3                	jb     b10 <malloc+0x90>
+  if((p = partial[c]) == 0){
+ b1d:	8b 14 9d 28 12 00 00 	mov    0x1228(,%ebx,4),%edx
+ b24:	85 d2                	test   %edx,%edx
+ b26:	74 58                	je     b80 <malloc+0x100>
+  if((b = p->free) != 0){
+ b28:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ b2b:	8b 4a 08             	mov    0x8(%edx),%ecx
+  if((b = p->free) != 0){
+ b2e:	85 db                	test   %ebx,%ebx
+ b30:	0f 84 aa 00 00 00    	je     be0 <malloc+0x160>
+    p->free = b->next;
+ b36:	8b 03                	mov    (%ebx),%eax
+ b38:	89 42 0c             	mov    %eax,0xc(%edx)
+  if(--p->nfree == 0)
+ b3b:	83 e9 01             	sub    $0x1,%ecx
+ b3e:	89 4a 08             	mov    %ecx,0x8(%edx)
+ b41:	75 83                	jne    ac6 <malloc+0x46>
+  if(p->prev)
+ b43:	8b 4a 18             	mov    0x18(%edx),%ecx
+    p->prev->next = p->next;
+ b46:	8b 42 14             	mov    0x14(%edx),%eax
+  if(p->prev)
+ b49:	85 c9                	test   %ecx,%ecx
+ b4b:	0f 84 cf 00 00 00    	je     c20 <malloc+0x1a0>
+    p->prev->next = p->next;
+ b51:	89 41 14             	mov    %eax,0x14(%ecx)
+  if(p->next)
+ b54:	85 c0                	test   %eax,%eax
+ b56:	0f 84 6a ff ff ff    	je     ac6 <malloc+0x46>
+    p->next->prev = p->prev;
+ b5c:	8b 52 18             	mov    0x18(%edx),%edx
+ b5f:	89 50 18             	mov    %edx,0x18(%eax)
+ b62:	e9 5f ff ff ff       	jmp    ac6 <malloc+0x46>
+ b67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b6e:	66 90                	xchg   %ax,%ax
+}
+ b70:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+ b73:	31 db                	xor    %ebx,%ebx
+}
+ b75:	89 d8                	mov    %ebx,%eax
+ b77:	5b                   	pop    %ebx
+ b78:	5e                   	pop    %esi
+ b79:	5d                   	pop    %ebp
+ b7a:	c3                   	ret
+ b7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b7f:	90                   	nop
+    if((p = runalloc(1)) == 0)
+ b80:	b8 01 00 00 00       	mov    $0x1,%eax
+ b85:	e8 e6 fc ff ff       	call   870 <runalloc>
+ b8a:	89 c2                	mov    %eax,%edx
+ b8c:	85 c0                	test   %eax,%eax
+ b8e:	74 e0                	je     b70 <malloc+0xf0>
+    p->kind = PSMALL;
+ b90:	b8 01 00 00 00       	mov    $0x1,%eax
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ b95:	8d 4b 04             	lea    0x4(%ebx),%ecx
+    p->class = c;
+ b98:	66 89 5a 02          	mov    %bx,0x2(%edx)
+ b9c:	0f b7 db             	movzwl %bx,%ebx
+    p->kind = PSMALL;
+ b9f:	66 89 02             	mov    %ax,(%edx)
+    p->fresh = (char*)p + HDRSIZE;
+ ba2:	8d 42 20             	lea    0x20(%edx),%eax
+ ba5:	89 42 10             	mov    %eax,0x10(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ ba8:	b8 e0 0f 00 00       	mov    $0xfe0,%eax
+ bad:	d3 f8                	sar    %cl,%eax
+    p->free = 0;
+ baf:	c7 42 0c 00 00 00 00 	movl   $0x0,0xc(%edx)
+    p->nfree = nblocks(c);
+ bb6:	89 42 08             	mov    %eax,0x8(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ bb9:	89 c1                	mov    %eax,%ecx
+  p->next = partial[p->class];
+ bbb:	8b 04 9d 28 12 00 00 	mov    0x1228(,%ebx,4),%eax
+  p->prev = 0;
+ bc2:	c7 42 18 00 00 00 00 	movl   $0x0,0x18(%edx)
+  p->next = partial[p->class];
+ bc9:	89 42 14             	mov    %eax,0x14(%edx)
+  if(p->next)
+ bcc:	85 c0                	test   %eax,%eax
+ bce:	75 20                	jne    bf0 <malloc+0x170>
+  partial[p->class] = p;
+ bd0:	89 14 9d 28 12 00 00 	mov    %edx,0x1228(,%ebx,4)
+  if((b = p->free) != 0){
+ bd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bde:	66 90                	xchg   %ax,%ax
+    b = (struct block*)p->fresh;
+ be0:	8b 5a 10             	mov    0x10(%edx),%ebx
+    p->fresh += MINSMALL << c;
+ be3:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+ be6:	89 42 10             	mov    %eax,0x10(%edx)
+ be9:	e9 4d ff ff ff       	jmp    b3b <malloc+0xbb>
+ bee:	66 90                	xchg   %ax,%ax
+    p->next->prev = p;
+ bf0:	89 50 18             	mov    %edx,0x18(%eax)
+  partial[p->class] = p;
+ bf3:	0f b7 42 02          	movzwl 0x2(%edx),%eax
+  if((b = p->free) != 0){
+ bf7:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ bfa:	8b 4a 08             	mov    0x8(%edx),%ecx
+  partial[p->class] = p;
+ bfd:	89 14 85 28 12 00 00 	mov    %edx,0x1228(,%eax,4)
+}
+ c04:	e9 25 ff ff ff       	jmp    b2e <malloc+0xae>
+ c09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ c10:	be 10 00 00 00       	mov    $0x10,%esi
+ c15:	31 db                	xor    %ebx,%ebx
+ c17:	e9 01 ff ff ff       	jmp    b1d <malloc+0x9d>
+ c1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ c20:	0f b7 4a 02          	movzwl 0x2(%edx),%ecx
+ c24:	89 04 8d 28 12 00 00 	mov    %eax,0x1228(,%ecx,4)
+ c2b:	e9 24 ff ff ff       	jmp    b54 <malloc+0xd4>
@@ -0,0 +1,484 @@
+// Container checkpoint and restore.
+//
+// ccheckpoint() saves the processes of a paused container to a
+// file, and crestore() starts them again from it in a container,
+// later or after a reboot. The image begins with a struct ckhdr
+// and one struct ckproc per process, padded to a page, and goes
+// on with each process's memory, page by page.
+//
+// Restore reads only the headers. Each process gets private
+// writable vmas over its part of the image, and its pages come
+// in on first touch through the page cache like those of any
+// other file mapping (see vmafill in vm.c). So the image must not
+// change while processes restored from it are running.
+//
+// Open files and the working directory are saved by inode
+// number, so an image can only be restored on the file system it
+// was taken on. An image is an ordinary file that anyone may have
+// written, so restore trusts none of those numbers: each must
+// name a file (or for a descriptor a directory open for reading,
+// or the console) in the tree under the root of the container
+// restored into, and the working directory a directory there.
+// A container can only restore what it could open itself. Pipes are not saved, and a saved shared memory
+// mapping comes back as private memory. A process caught inside
+// a system call makes the call again when restored. Processes
+// with threads cannot be saved.
+//
+// The image is one ordinary file, so it can be at most MAXFILE
+// blocks: 70KB with 512-byte blocks, enough for a page of headers
+// and one or two small processes, and about 4MB with 4096-byte
+// blocks. A container whose image would be larger is refused
+// with CKPT_TOOBIG before anything is written.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "stat.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+#include "ckpt.h"
+
+#define CKMAGIC 0x74706b63   // "ckpt"
+
+// Flags a process may set in eflags: CF PF AF ZF SF DF OF.
+#define FL_USER 0x00000cd5
+
+struct ckhdr {
+  uint magic;
+  int nproc;
+};
+
+// A vma of a saved process. Vma 0 is the program and heap, from
+// 0 up to sz. A shared file mapping names its file by inum;
+// otherwise inum is 0 and the pages are in the image at off.
+struct ckvma {
+  uint start;
+  uint end;
+  int flags;
+  uint inum;
+  uint off;
+  uint filesz;
+};
+
+struct ckfile {
+  uint inum;       // Inode of the file; 0 if the descriptor is not saved
+  uint off;
+  char readable;
+  char writable;
+  int same;        // 1 + index of an earlier descriptor on the same open file, or 0
+};
+
+struct ckproc {
+  char name[16];
+  int parent;                  // Index of the parent in the image, or -1
+  int insyscall;
+  uint sz;
+  struct trapframe tf;
+  uint cwd;                    // Inode of the working directory
+  int nvma;
+  struct ckvma vma[NVMA];
+  struct ckfile file[NOFILE];
+};
+
+// Processes that a checkpoint saves. Embryos and zombies are
+// left out; the container is paused, so none are running.
+static int
+saved(struct proc *p)
+{
+  return p->state == SLEEPING || p->state == RUNNABLE;
+}
+
+// Return the number of bytes of p's memory that saveproc
+// puts in the image.
+static uint
+imagesize(struct proc *p)
+{
+  struct vma *v;
+  uint n;
+
+  n = PGROUNDUP(p->sz);
+  for(v = p->vma; v < &p->vma[NVMA]; v++)
+    if(v->end != 0 && v->start >= MMAPBASE && !(v->ip && (v->flags & VM_SHARED)))
+      n += v->end - v->start;
+  return n;
+}
+
+// Return the index of p among the saved processes of c, or -1.
+static int
+ckindex(struct container *c, struct proc *p)
+{
+  struct proc *q;
+  int i;
+
+  i = 0;
+  for(q = c->ptable; q < &c->ptable[NPROC]; q++){
+    if(!saved(q))
+      continue;
+    if(q == p)
+      return i;
+    i++;
+  }
+  return -1;
+}
+
+// Find a descriptor saved before descriptor fd of p, a saved
+// process of c, that is open on the same file, and return 1 +
+// its index in the image, or 0 if there is none.
+static int
+cksame(struct container *c, struct proc *p, int fd)
+{
+  struct proc *q;
+  int j, k;
+
+  j = 0;
+  for(q = c->ptable; q <= p; q++){
+    if(!saved(q))
+      continue;
+    for(k = 0; k < (q == p ? fd : NOFILE); k++)
+      if(q->ofile[k] == p->ofile[fd])
+        return 1 + j*NOFILE + k;
+    j++;
+  }
+  return 0;
+}
+
+// Fill in ck for p, a saved process of c, and append its
+// memory to f.
+static int
+saveproc(struct container *c, struct proc *p, struct ckproc *ck,
+         struct file *f)
+{
+  struct ckvma *cv;
+  struct ckfile *cf;
+  struct file *of;
+  struct vma *v;
+  int fd;
+
+  memset(ck, 0, sizeof(*ck));
+  safestrcpy(ck->name, p->name, sizeof(ck->name));
+  ck->parent = ckindex(c, p->parent);
+  ck->insyscall = p->insyscall;
+  ck->sz = p->sz;
+  ck->tf = *p->tf;
+  ck->cwd = p->cwd->inum;
+
+  // Shared file mappings are saved as their files,
+  // so bring the files up to date first.
+  if(vmaflush(p->pgdir, p->vma) < 0)
+    return -1;
+
+  // The program and heap, with the vmas of exec in it.
+  cv = &ck->vma[ck->nvma++];
+  cv->start = 0;
+  cv->end = PGROUNDUP(p->sz);
+  cv->flags = VM_WRITE;
+  cv->off = f->off;
+  cv->filesz = cv->end;
+  if(ckptuvm(p, cv->start, cv->end, f) < 0)
+    return -1;
+
+  for(v = p->vma; v < &p->vma[NVMA]; v++){
+    if(v->end == 0 || v->start < MMAPBASE)
+      continue;
+    if(ck->nvma == NVMA){
+      cprintf("checkpoint: %s has too many mappings\n", p->name);
+      return -1;
+    }
+    cv = &ck->vma[ck->nvma++];
+    cv->start = v->start;
+    cv->end = v->end;
+    if(v->ip && (v->flags & VM_SHARED)){
+      cv->flags = v->flags;
+      cv->inum = v->ip->inum;
+      cv->off = v->off;
+      cv->filesz = v->filesz;
+    } else {
+      cv->flags = v->flags & VM_WRITE;
+      cv->off = f->off;
+      cv->filesz = v->end - v->start;
+      if(ckptuvm(p, v->start, v->end, f) < 0)
+        return -1;
+    }
+  }
+
+  for(fd = 0; fd < NOFILE; fd++){
+    if((of = p->ofile[fd]) == 0 || of->type != FD_INODE)
+      continue;
+    cf = &ck->file[fd];
+    cf->inum = of->ip->inum;
+    cf->off = of->off;
+    cf->readable = of->readable;
+    cf->writable = of->writable;
+    cf->same = cksame(c, p, fd);
+  }
+  return 0;
+}
+
+// Save the processes of c, which must be paused with none of
+// them running, to f, an empty file open for reading and
+// writing. Returns the number of processes saved, CKPT_TOOBIG
+// if the image would be larger than a file can be, or -1.
+int
+checkpoint(struct container *c, struct file *f)
+{
+  struct ckhdr hdr;
+  struct ckproc *ck;
+  struct proc *p;
+  uint hdrsz, off, size;
+  int i, n;
+
+  n = 0;
+  size = 0;
+  for(p = c->ptable; p < &c->ptable[NPROC]; p++){
+    if(!saved(p))
+      continue;
+    if(p->leader != p || p->nthread > 1){
+      cprintf("checkpoint: %s has threads\n", p->name);
+      return -1;
+    }
+    n++;
+    if(size <= MAXFILE*BSIZE)
+      size += imagesize(p);
+  }
+  hdrsz = PGROUNDUP(sizeof(hdr) + n*sizeof(*ck));
+  if(size > MAXFILE*BSIZE || hdrsz + size > MAXFILE*BSIZE){
+    cprintf("checkpoint: image larger than the %d bytes a file can hold\n",
+            MAXFILE*BSIZE);
+    return CKPT_TOOBIG;
+  }
+
+  if((ck = (struct ckproc*)kalloc()) == 0)
+    return -1;
+  // Leave room for the headers, written last, so that
+  // each process's memory starts on a page boundary.
+  memset(ck, 0, PGSIZE);
+  f->off = 0;
+  for(off = 0; off < hdrsz; off += PGSIZE)
+    if(filewrite(f, (char*)ck, PGSIZE) != PGSIZE)
+      goto bad;
+
+  i = 0;
+  for(p = c->ptable; p < &c->ptable[NPROC]; p++){
+    if(!saved(p))
+      continue;
+    if(i == n)
+      goto bad;  // a process came in, from crestore or spawn
+    if(saveproc(c, p, ck, f) < 0)
+      goto bad;
+    off = f->off;
+    f->off = sizeof(hdr) + i*sizeof(*ck);
+    if(filewrite(f, (char*)ck, sizeof(*ck)) != sizeof(*ck))
+      goto bad;
+    f->off = off;
+    i++;
+  }
+
+  hdr.magic = CKMAGIC;
+  hdr.nproc = n;
+  f->off = 0;
+  if(filewrite(f, (char*)&hdr, sizeof(hdr)) != sizeof(hdr))
+    goto bad;
+  kfree((char*)ck);
+  return n;
+
+ bad:
+  kfree((char*)ck);
+  return -1;
+}
+
+// Return the inode numbered inum, referenced and unlocked, if its
+// type is one of the bits of types and it is in the tree that
+// map marks (see itreemap), or is the console. Otherwise 0.
+static struct inode*
+ckinode(uchar *map, uint inum, int types)
+{
+  struct inode *ip;
+  int ok;
+
+  if((ip = igetused(ROOTDEV, inum)) == 0)
+    return 0;
+  ilock(ip);
+  if(ip->type == T_DEV)
+    ok = (types & 1 << T_DEV) && ip->major == CONSOLE;
+  else
+    ok = (types & 1 << ip->type) && (map[inum/8] & 1 << inum%8);
+  iunlock(ip);
+  if(!ok){
+    begin_op();
+    iput(ip);
+    end_op();
+    return 0;
+  }
+  return ip;
+}
+
+// Undo a partly restored process.
+static void
+unload(struct proc *p)
+{
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++){
+    if(p->ofile[fd]){
+      fileclose(p->ofile[fd]);
+      p->ofile[fd] = 0;
+    }
+  }
+  if(p->cwd){
+    begin_op();
+    iput(p->cwd);
+    end_op();
+    p->cwd = 0;
+  }
+  vmaput(p->vma);
+  if(p->pgdir)
+    freevm(p->pgdir);
+  p->pgdir = 0;
+  kfree(p->kstack);
+  p->kstack = 0;
+  p->state = UNUSED;
+}
+
+// Make a process in c from ck, the i'th process of image img,
+// with its pages left in the image. The ones before it are in
+// np, and map marks the inodes under c's root. Returns the
+// process as an embryo, or 0.
+static struct proc*
+loadproc(struct container *c, struct ckproc *ck, struct file *img,
+         struct proc **np, int i, uchar *map)
+{
+  struct proc *p;
+  struct ckvma *cv;
+  struct ckfile *cf;
+  struct file *of;
+  struct inode *ip;
+  int j, k;
+
+  if(ck->nvma < 1 || ck->nvma > NVMA || ck->sz == 0 || ck->sz > MMAPBASE)
+    return 0;
+  if((p = allocproc(c)) == 0)
+    return 0;
+  if((p->pgdir = setupkvm()) == 0)
+    goto bad;
+  p->sz = ck->sz;
+
+  for(j = 0; j < ck->nvma; j++){
+    cv = &ck->vma[j];
+    if(j == 0 ? cv->start != 0 || cv->end != PGROUNDUP(ck->sz)
+              : cv->start < MMAPBASE || cv->end > KERNBASE || cv->start >= cv->end)
+      goto bad;
+    if(cv->start % PGSIZE || cv->end % PGSIZE || cv->off % PGSIZE)
+      goto bad;
+    if(cv->inum == 0)
+      ip = idup(img->ip);
+    else if((ip = ckinode(map, cv->inum, 1 << T_FILE)) == 0)
+      goto bad;
+    p->vma[j].start = cv->start;
+    p->vma[j].end = cv->end;
+    // Pages of the image are private: writes never reach it.
+    p->vma[j].flags = cv->flags & (cv->inum ? VM_WRITE|VM_SHARED : VM_WRITE);
+    p->vma[j].ip = ip;
+    p->vma[j].off = cv->off;
+    p->vma[j].filesz = cv->filesz;
+  }
+
+  // Same user segments as a new process, whatever the image says.
+  *p->tf = ck->tf;
+  p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+  p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+  p->tf->es = p->tf->ds;
+  p->tf->ss = p->tf->ds;
+  p->tf->fs = 0;
+  p->tf->gs = 0;
+  p->tf->eflags = (ck->tf.eflags & FL_USER) | FL_IF;
+  // Back up over the int instruction to make the call again;
+  // eax still holds the system call number.
+  if(ck->insyscall)
+    p->tf->eip -= 2;
+
+  for(j = 0; j < NOFILE; j++){
+    cf = &ck->file[j];
+    if(cf->same > 0 && (k = cf->same - 1) < i*NOFILE + j){
+      of = k / NOFILE == i ? p->ofile[k % NOFILE] : np[k / NOFILE]->ofile[k % NOFILE];
+      if(of){
+        p->ofile[j] = filedup(of);
+        continue;
+      }
+    }
+    if(cf->inum == 0)
+      continue;
+    if((of = filealloc()) == 0)
+      goto bad;
+    // As open() allows: no writing to a directory.
+    if((of->ip = ckinode(map, cf->inum, 1 << T_FILE | 1 << T_DEV |
+                         (cf->writable ? 0 : 1 << T_DIR))) == 0){
+      fileclose(of);
+      goto bad;
+    }
+    of->type = FD_INODE;
+    of->off = cf->off;
+    of->readable = cf->readable != 0;
+    of->writable = cf->writable != 0;
+    p->ofile[j] = of;
+  }
+  if((p->cwd = ckinode(map, ck->cwd, 1 << T_DIR)) == 0)
+    goto bad;
+
+  safestrcpy(p->name, ck->name, sizeof(p->name));
+  return p;
+
+ bad:
+  unload(p);
+  return 0;
+}
+
+// Make processes in c from the image in f, open for reading,
+// and put them in np, as embryos for the caller to set going.
+// Processes whose parent was not saved get parent instead.
+// Returns the number of processes, or -1.
+int
+restore(struct container *c, struct file *f, struct proc *parent,
+        struct proc **np)
+{
+  struct ckhdr hdr;
+  struct ckproc *ck;
+  uchar *map;
+  int pi[NPROC];
+  int i, n;
+
+  f->off = 0;
+  if(fileread(f, (char*)&hdr, sizeof(hdr)) != sizeof(hdr) ||
+     hdr.magic != CKMAGIC || hdr.nproc < 0 || hdr.nproc > NPROC)
+    return -1;
+  if((map = itreemap(c->rootdir)) == 0)
+    return -1;
+  if((ck = (struct ckproc*)kalloc()) == 0){
+    kfree((char*)map);
+    return -1;
+  }
+
+  for(n = 0; n < hdr.nproc; n++){
+    if(fileread(f, (char*)ck, sizeof(*ck)) != sizeof(*ck) ||
+       (np[n] = loadproc(c, ck, f, np, n, map)) == 0)
+      goto bad;
+    pi[n] = ck->parent;
+  }
+  for(i = 0; i < n; i++)
+    np[i]->parent = pi[i] >= 0 && pi[i] < n ? np[pi[i]] : parent;
+  kfree((char*)ck);
+  kfree((char*)map);
+  return n;
+
+ bad:
+  while(--n >= 0)
+    unload(np[n]);
+  kfree((char*)ck);
+  kfree((char*)map);
+  return -1;
+}
@@ -0,0 +1,4 @@
+// Errors from ccheckpoint() other than -1.
+// Both the kernel and user programs use this header file.
+
+#define CKPT_TOOBIG -2   // the image would not fit in a file; see ckpt.c
@@ -0,0 +1,3356 @@
+
+_cont:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  } else {
+    printf(1, "Container %s: %d zygotes of %s loaded.\n", name, n, argv[4]);
+  }
+}
+
+int main(int argc, char **argv) {
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	56                   	push   %esi
+       e:	53                   	push   %ebx
+       f:	51                   	push   %ecx
+      10:	83 ec 0c             	sub    $0xc,%esp
+      13:	8b 31                	mov    (%ecx),%esi
+      15:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if (argc < 2) {
+      18:	83 fe 01             	cmp    $0x1,%esi
+      1b:	7e 61                	jle    7e <main+0x7e>
+    printf(2, "cont <cmd> [arg...]\n");
+    exit();
+  }
+
+  if (strcmp(argv[1], "create") == 0) {
+      1d:	50                   	push   %eax
+      1e:	50                   	push   %eax
+      1f:	68 df 1a 00 00       	push   $0x1adf
+      24:	ff 73 04             	push   0x4(%ebx)
+      27:	e8 e4 0d 00 00       	call   e10 <strcmp>
+      2c:	83 c4 10             	add    $0x10,%esp
+      2f:	85 c0                	test   %eax,%eax
+      31:	75 11                	jne    44 <main+0x44>
+    cont_create(argc, argv);
+      33:	50                   	push   %eax
+      34:	50                   	push   %eax
+      35:	53                   	push   %ebx
+      36:	56                   	push   %esi
+      37:	e8 b4 07 00 00       	call   7f0 <cont_create>
+      3c:	83 c4 10             	add    $0x10,%esp
+    cont_zygote(argc, argv);
+  } else {
+    printf(2, "Command option cannot be identified\n");
+  }
+
+  exit();
+      3f:	e8 1f 10 00 00       	call   1063 <exit>
+  } else if (strcmp(argv[1], "stop") == 0) {
+      44:	51                   	push   %ecx
+      45:	51                   	push   %ecx
+      46:	68 e6 1a 00 00       	push   $0x1ae6
+      4b:	ff 73 04             	push   0x4(%ebx)
+      4e:	e8 bd 0d 00 00       	call   e10 <strcmp>
+      53:	83 c4 10             	add    $0x10,%esp
+      56:	85 c0                	test   %eax,%eax
+      58:	74 37                	je     91 <main+0x91>
+  } else if (strcmp(argv[1], "resume") == 0) {
+      5a:	50                   	push   %eax
+      5b:	50                   	push   %eax
+      5c:	68 eb 1a 00 00       	push   $0x1aeb
+      61:	ff 73 04             	push   0x4(%ebx)
+      64:	e8 a7 0d 00 00       	call   e10 <strcmp>
+      69:	83 c4 10             	add    $0x10,%esp
+      6c:	85 c0                	test   %eax,%eax
+      6e:	75 2f                	jne    9f <main+0x9f>
+    cont_resume(argc, argv);
+      70:	50                   	push   %eax
+      71:	50                   	push   %eax
+      72:	53                   	push   %ebx
+      73:	56                   	push   %esi
+      74:	e8 57 0a 00 00       	call   ad0 <cont_resume>
+      79:	83 c4 10             	add    $0x10,%esp
+      7c:	eb c1                	jmp    3f <main+0x3f>
+    printf(2, "cont <cmd> [arg...]\n");
+      7e:	50                   	push   %eax
+      7f:	50                   	push   %eax
+      80:	68 ca 1a 00 00       	push   $0x1aca
+      85:	6a 02                	push   $0x2
+      87:	e8 84 11 00 00       	call   1210 <printf>
+    exit();
+      8c:	e8 d2 0f 00 00       	call   1063 <exit>
+    cont_stop(argc, argv);
+      91:	52                   	push   %edx
+      92:	52                   	push   %edx
+      93:	53                   	push   %ebx
+      94:	56                   	push   %esi
+      95:	e8 c6 0a 00 00       	call   b60 <cont_stop>
+      9a:	83 c4 10             	add    $0x10,%esp
+      9d:	eb a0                	jmp    3f <main+0x3f>
+  } else if (strcmp(argv[1], "pause") == 0) {
+      9f:	50                   	push   %eax
+      a0:	50                   	push   %eax
+      a1:	68 f2 1a 00 00       	push   $0x1af2
+      a6:	ff 73 04             	push   0x4(%ebx)
+      a9:	e8 62 0d 00 00       	call   e10 <strcmp>
+      ae:	83 c4 10             	add    $0x10,%esp
+      b1:	85 c0                	test   %eax,%eax
+      b3:	74 27                	je     dc <main+0xdc>
+  } else if (strcmp(argv[1], "start") == 0) {
+      b5:	50                   	push   %eax
+      b6:	50                   	push   %eax
+      b7:	68 f8 1a 00 00       	push   $0x1af8
+      bc:	ff 73 04             	push   0x4(%ebx)
+      bf:	e8 4c 0d 00 00       	call   e10 <strcmp>
+      c4:	83 c4 10             	add    $0x10,%esp
+      c7:	85 c0                	test   %eax,%eax
+      c9:	75 22                	jne    ed <main+0xed>
+    cont_start(argc, argv);
+      cb:	51                   	push   %ecx
+      cc:	51                   	push   %ecx
+      cd:	53                   	push   %ebx
+      ce:	56                   	push   %esi
+      cf:	e8 3c 08 00 00       	call   910 <cont_start>
+      d4:	83 c4 10             	add    $0x10,%esp
+      d7:	e9 63 ff ff ff       	jmp    3f <main+0x3f>
+    cont_pause(argc, argv);
+      dc:	50                   	push   %eax
+      dd:	50                   	push   %eax
+      de:	53                   	push   %ebx
+      df:	56                   	push   %esi
+      e0:	e8 7b 09 00 00       	call   a60 <cont_pause>
+      e5:	83 c4 10             	add    $0x10,%esp
+      e8:	e9 52 ff ff ff       	jmp    3f <main+0x3f>
+  } else if (strcmp(argv[1], "limit") == 0) {
+      ed:	52                   	push   %edx
+      ee:	52                   	push   %edx
+      ef:	68 fe 1a 00 00       	push   $0x1afe
+      f4:	ff 73 04             	push   0x4(%ebx)
+      f7:	e8 14 0d 00 00       	call   e10 <strcmp>
+      fc:	83 c4 10             	add    $0x10,%esp
+      ff:	85 c0                	test   %eax,%eax
+     101:	75 11                	jne    114 <main+0x114>
+    cont_limit(argc, argv);
+     103:	50                   	push   %eax
+     104:	50                   	push   %eax
+     105:	53                   	push   %ebx
+     106:	56                   	push   %esi
+     107:	e8 c4 0a 00 00       	call   bd0 <cont_limit>
+     10c:	83 c4 10             	add    $0x10,%esp
+     10f:	e9 2b ff ff ff       	jmp    3f <main+0x3f>
+  } else if (strcmp(argv[1], "checkpoint") == 0) {
+     114:	50                   	push   %eax
+     115:	50                   	push   %eax
+     116:	68 04 1b 00 00       	push   $0x1b04
+     11b:	ff 73 04             	push   0x4(%ebx)
+     11e:	e8 ed 0c 00 00       	call   e10 <strcmp>
+     123:	83 c4 10             	add    $0x10,%esp
+     126:	85 c0                	test   %eax,%eax
+     128:	75 11                	jne    13b <main+0x13b>
+    cont_checkpoint(argc, argv);
+     12a:	50                   	push   %eax
+     12b:	50                   	push   %eax
+     12c:	53                   	push   %ebx
+     12d:	56                   	push   %esi
+     12e:	e8 1d 0b 00 00       	call   c50 <cont_checkpoint>
+     133:	83 c4 10             	add    $0x10,%esp
+     136:	e9 04 ff ff ff       	jmp    3f <main+0x3f>
+  } else if (strcmp(argv[1], "restore") == 0) {
+     13b:	50                   	push   %eax
+     13c:	50                   	push   %eax
+     13d:	68 0f 1b 00 00       	push   $0x1b0f
+     142:	ff 73 04             	push   0x4(%ebx)
+     145:	e8 c6 0c 00 00       	call   e10 <strcmp>
+     14a:	83 c4 10             	add    $0x10,%esp
+     14d:	85 c0                	test   %eax,%eax
+     14f:	75 11                	jne    162 <main+0x162>
+    cont_restore(argc, argv);
+     151:	50                   	push   %eax
+     152:	50                   	push   %eax
+     153:	53                   	push   %ebx
+     154:	56                   	push   %esi
+     155:	e8 96 0b 00 00       	call   cf0 <cont_restore>
+     15a:	83 c4 10             	add    $0x10,%esp
+     15d:	e9 dd fe ff ff       	jmp    3f <main+0x3f>
+  } else if (strcmp(argv[1], "zygote") == 0) {
+     162:	51                   	push   %ecx
+     163:	51                   	push   %ecx
+     164:	68 17 1b 00 00       	push   $0x1b17
+     169:	ff 73 04             	push   0x4(%ebx)
+     16c:	e8 9f 0c 00 00       	call   e10 <strcmp>
+     171:	83 c4 10             	add    $0x10,%esp
+     174:	85 c0                	test   %eax,%eax
+     176:	75 11                	jne    189 <main+0x189>
+    cont_zygote(argc, argv);
+     178:	52                   	push   %edx
+     179:	52                   	push   %edx
+     17a:	53                   	push   %ebx
+     17b:	56                   	push   %esi
+     17c:	e8 df 0b 00 00       	call   d60 <cont_zygote>
+     181:	83 c4 10             	add    $0x10,%esp
+     184:	e9 b6 fe ff ff       	jmp    3f <main+0x3f>
+    printf(2, "Command option cannot be identified\n");
+     189:	50                   	push   %eax
+     18a:	50                   	push   %eax
+     18b:	68 a4 1f 00 00       	push   $0x1fa4
+     190:	6a 02                	push   $0x2
+     192:	e8 79 10 00 00       	call   1210 <printf>
+     197:	83 c4 10             	add    $0x10,%esp
+     19a:	e9 a0 fe ff ff       	jmp    3f <main+0x3f>
+     19f:	90                   	nop
+
+000001a0 <search_upward>:
+  int len2 = strlen(filename);
+     1a0:	55                   	push   %ebp
+     1a1:	89 e5                	mov    %esp,%ebp
+     1a3:	57                   	push   %edi
+     1a4:	56                   	push   %esi
+     1a5:	89 c6                	mov    %eax,%esi
+     1a7:	53                   	push   %ebx
+     1a8:	89 d3                	mov    %edx,%ebx
+     1aa:	83 ec 58             	sub    $0x58,%esp
+     1ad:	89 4d b4             	mov    %ecx,-0x4c(%ebp)
+  fpath[len1] = '/';
+     1b0:	52                   	push   %edx
+     1b1:	e8 ba 0c 00 00       	call   e70 <strlen>
+     1b6:	5a                   	pop    %edx
+     1b7:	59                   	pop    %ecx
+     1b8:	68 00 19 00 00       	push   $0x1900
+     1bd:	01 d8                	add    %ebx,%eax
+     1bf:	50                   	push   %eax
+     1c0:	e8 1b 0c 00 00       	call   de0 <strcpy>
+  fpath[len1 + len2 + 1] = '\0';
+     1c5:	5f                   	pop    %edi
+     1c6:	58                   	pop    %eax
+     1c7:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     1ca:	50                   	push   %eax
+     1cb:	53                   	push   %ebx
+     1cc:	e8 8f 0d 00 00       	call   f60 <stat>
+     1d1:	83 c4 10             	add    $0x10,%esp
+     1d4:	85 c0                	test   %eax,%eax
+     1d6:	78 6c                	js     244 <search_upward+0xa4>
+
+     1d8:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+  get_filepath(fpath, rootdir, filename);
+     1db:	39 75 dc             	cmp    %esi,-0x24(%ebp)
+     1de:	74 66                	je     246 <search_upward+0xa6>
+    printf(2, "Open src file %s error.\n", filename);
+     1e0:	83 ec 08             	sub    $0x8,%esp
+     1e3:	6a 00                	push   $0x0
+     1e5:	53                   	push   %ebx
+     1e6:	e8 b8 0e 00 00       	call   10a3 <open>
+    goto bad;
+     1eb:	83 c4 10             	add    $0x10,%esp
+    printf(2, "Open src file %s error.\n", filename);
+     1ee:	89 c7                	mov    %eax,%edi
+    goto bad;
+     1f0:	85 c0                	test   %eax,%eax
+     1f2:	78 50                	js     244 <search_upward+0xa4>
+  }
+     1f4:	8b 4d b4             	mov    -0x4c(%ebp),%ecx
+     1f7:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     1fa:	89 da                	mov    %ebx,%edx
+     1fc:	e8 9f ff ff ff       	call   1a0 <search_upward>
+     201:	89 c2                	mov    %eax,%edx
+  if ((dst_fd = open(fpath, O_CREATE | O_WRONLY)) < 0) {
+     203:	85 c0                	test   %eax,%eax
+     205:	74 70                	je     277 <search_upward+0xd7>
+    goto bad;
+     207:	83 ec 08             	sub    $0x8,%esp
+     20a:	8d 40 01             	lea    0x1(%eax),%eax
+     20d:	8d 5d c4             	lea    -0x3c(%ebp),%ebx
+     210:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+     213:	68 04 19 00 00       	push   $0x1904
+     218:	52                   	push   %edx
+     219:	e8 c2 0b 00 00       	call   de0 <strcpy>
+#define BUFFER_SIZE 1024
+     21e:	83 c4 10             	add    $0x10,%esp
+     221:	eb 0d                	jmp    230 <search_upward+0x90>
+     223:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     227:	90                   	nop
+#define MAX_PATH_LEN 512
+     228:	0f b7 45 c4          	movzwl -0x3c(%ebp),%eax
+     22c:	39 c6                	cmp    %eax,%esi
+     22e:	74 20                	je     250 <search_upward+0xb0>
+#define BUFFER_SIZE 1024
+     230:	83 ec 04             	sub    $0x4,%esp
+     233:	6a 10                	push   $0x10
+     235:	53                   	push   %ebx
+     236:	57                   	push   %edi
+     237:	e8 3f 0e 00 00       	call   107b <read>
+     23c:	83 c4 10             	add    $0x10,%esp
+     23f:	83 f8 10             	cmp    $0x10,%eax
+     242:	74 e4                	je     228 <search_upward+0x88>
+}
+     244:	31 d2                	xor    %edx,%edx
+  close(dst_fd);
+     246:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     249:	89 d0                	mov    %edx,%eax
+     24b:	5b                   	pop    %ebx
+     24c:	5e                   	pop    %esi
+     24d:	5f                   	pop    %edi
+     24e:	5d                   	pop    %ebp
+     24f:	c3                   	ret
+#define MAX_CONT_NAME_LEN 15
+     250:	83 ec 0c             	sub    $0xc,%esp
+     253:	8d 75 c6             	lea    -0x3a(%ebp),%esi
+     256:	56                   	push   %esi
+     257:	e8 14 0c 00 00       	call   e70 <strlen>
+
+     25c:	83 c4 0c             	add    $0xc,%esp
+     25f:	50                   	push   %eax
+#define MAX_CONT_NAME_LEN 15
+     260:	89 c3                	mov    %eax,%ebx
+
+     262:	56                   	push   %esi
+     263:	ff 75 b4             	push   -0x4c(%ebp)
+     266:	e8 85 0d 00 00       	call   ff0 <memmove>
+
+     26b:	83 c4 10             	add    $0x10,%esp
+     26e:	85 db                	test   %ebx,%ebx
+     270:	78 d2                	js     244 <search_upward+0xa4>
+  while ((sz = read(src_fd, buffer, BUFFER_SIZE)) != 0) {
+     272:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     275:	01 da                	add    %ebx,%edx
+  }
+     277:	83 ec 0c             	sub    $0xc,%esp
+     27a:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+     27d:	57                   	push   %edi
+     27e:	e8 08 0e 00 00       	call   108b <close>
+     283:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     286:	83 c4 10             	add    $0x10,%esp
+  close(dst_fd);
+     289:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     28c:	5b                   	pop    %ebx
+     28d:	5e                   	pop    %esi
+     28e:	89 d0                	mov    %edx,%eax
+     290:	5f                   	pop    %edi
+     291:	5d                   	pop    %ebp
+     292:	c3                   	ret
+     293:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     29a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000002a0 <getcwd>:
+
+     2a0:	55                   	push   %ebp
+     2a1:	89 e5                	mov    %esp,%ebp
+     2a3:	56                   	push   %esi
+     2a4:	53                   	push   %ebx
+  if (src_fd > 0) {
+     2a5:	8d 9d f8 fd ff ff    	lea    -0x208(%ebp),%ebx
+
+     2ab:	81 ec 24 02 00 00    	sub    $0x224,%esp
+     2b1:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (src_fd > 0) {
+     2b4:	68 00 02 00 00       	push   $0x200
+     2b9:	6a 00                	push   $0x0
+     2bb:	53                   	push   %ebx
+     2bc:	e8 df 0b 00 00       	call   ea0 <memset>
+    close(src_fd);
+     2c1:	c6 85 f8 fd ff ff 2e 	movb   $0x2e,-0x208(%ebp)
+    close(dst_fd);
+     2c8:	58                   	pop    %eax
+     2c9:	8d 85 e4 fd ff ff    	lea    -0x21c(%ebp),%eax
+     2cf:	5a                   	pop    %edx
+     2d0:	50                   	push   %eax
+     2d1:	53                   	push   %ebx
+     2d2:	e8 89 0c 00 00       	call   f60 <stat>
+     2d7:	83 c4 10             	add    $0x10,%esp
+     2da:	85 c0                	test   %eax,%eax
+     2dc:	78 2a                	js     308 <getcwd+0x68>
+int get_cont_fullpath(char *fpath, char *cont_name) {
+     2de:	8b 85 ec fd ff ff    	mov    -0x214(%ebp),%eax
+     2e4:	89 f1                	mov    %esi,%ecx
+     2e6:	89 da                	mov    %ebx,%edx
+     2e8:	e8 b3 fe ff ff       	call   1a0 <search_upward>
+  // Get current working directory as prefix.
+     2ed:	85 c0                	test   %eax,%eax
+     2ef:	74 17                	je     308 <getcwd+0x68>
+  if (getcwd(cur_path) != 0) {
+     2f1:	80 3e 00             	cmpb   $0x0,(%esi)
+     2f4:	74 0a                	je     300 <getcwd+0x60>
+  }
+     2f6:	31 c0                	xor    %eax,%eax
+  printf(1, "Current working directory is %s\n", cur_path);
+     2f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     2fb:	5b                   	pop    %ebx
+     2fc:	5e                   	pop    %esi
+     2fd:	5d                   	pop    %ebp
+     2fe:	c3                   	ret
+     2ff:	90                   	nop
+    printf(2, "Get current working directory error\n");
+     300:	c6 06 2f             	movb   $0x2f,(%esi)
+     303:	eb f1                	jmp    2f6 <getcwd+0x56>
+     305:	8d 76 00             	lea    0x0(%esi),%esi
+  }
+     308:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     30d:	eb e9                	jmp    2f8 <getcwd+0x58>
+     30f:	90                   	nop
+
+00000310 <parse_subdirectory>:
+  return 0;
+     310:	55                   	push   %ebp
+     311:	89 e5                	mov    %esp,%ebp
+     313:	57                   	push   %edi
+     314:	56                   	push   %esi
+     315:	53                   	push   %ebx
+     316:	83 ec 0c             	sub    $0xc,%esp
+     319:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     31c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+// Start and resume container needs path checking: current working directory
+     31f:	0f b6 13             	movzbl (%ebx),%edx
+     322:	84 d2                	test   %dl,%dl
+     324:	74 4a                	je     370 <parse_subdirectory+0x60>
+     326:	89 d8                	mov    %ebx,%eax
+
+     328:	31 f6                	xor    %esi,%esi
+}
+     32a:	31 c9                	xor    %ecx,%ecx
+     32c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if (getcwd(cwd) != 0) {
+     330:	83 c1 01             	add    $0x1,%ecx
+// to be rootdir for container.
+     333:	80 fa 2f             	cmp    $0x2f,%dl
+     336:	75 09                	jne    341 <parse_subdirectory+0x31>
+  char cwd[MAX_PATH_LEN];
+     338:	89 c6                	mov    %eax,%esi
+int can_start_container(char *cont_name) {
+     33a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  char cwd[MAX_PATH_LEN];
+     33f:	29 de                	sub    %ebx,%esi
+// Start and resume container needs path checking: current working directory
+     341:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     345:	83 c0 01             	add    $0x1,%eax
+     348:	84 d2                	test   %dl,%dl
+     34a:	75 e4                	jne    330 <parse_subdirectory+0x20>
+  }
+     34c:	01 f3                	add    %esi,%ebx
+
+     34e:	8d 34 0f             	lea    (%edi,%ecx,1),%esi
+  }
+     351:	83 ec 04             	sub    $0x4,%esp
+     354:	51                   	push   %ecx
+     355:	53                   	push   %ebx
+     356:	57                   	push   %edi
+     357:	e8 94 0c 00 00       	call   ff0 <memmove>
+
+     35c:	c6 06 00             	movb   $0x0,(%esi)
+  char crootdir[MAX_PATH_LEN];
+     35f:	83 c4 10             	add    $0x10,%esp
+     362:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     365:	5b                   	pop    %ebx
+     366:	5e                   	pop    %esi
+     367:	5f                   	pop    %edi
+     368:	5d                   	pop    %ebp
+     369:	c3                   	ret
+     36a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+// Start and resume container needs path checking: current working directory
+     370:	89 fe                	mov    %edi,%esi
+}
+     372:	31 c9                	xor    %ecx,%ecx
+     374:	eb db                	jmp    351 <parse_subdirectory+0x41>
+     376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     37d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000380 <concatenate_path>:
+  }
+     380:	55                   	push   %ebp
+     381:	89 e5                	mov    %esp,%ebp
+     383:	57                   	push   %edi
+     384:	56                   	push   %esi
+     385:	53                   	push   %ebx
+     386:	83 ec 28             	sub    $0x28,%esp
+     389:	8b 75 10             	mov    0x10(%ebp),%esi
+     38c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  printf(1, "directory %s has been created successfully\n", fpath);
+     38f:	ff 75 0c             	push   0xc(%ebp)
+     392:	e8 d9 0a 00 00       	call   e70 <strlen>
+
+     397:	89 34 24             	mov    %esi,(%esp)
+  printf(1, "directory %s has been created successfully\n", fpath);
+     39a:	89 c3                	mov    %eax,%ebx
+
+     39c:	e8 cf 0a 00 00       	call   e70 <strlen>
+    printf(1, "Container %s created at %s successfully.\n", cont_name, fpath);
+     3a1:	83 c4 10             	add    $0x10,%esp
+     3a4:	80 3e 2f             	cmpb   $0x2f,(%esi)
+     3a7:	0f 84 03 01 00 00    	je     4b0 <concatenate_path+0x130>
+    printf(2, "Create container %s at %s fails.\n", cont_name, fpath);
+     3ad:	83 ec 04             	sub    $0x4,%esp
+     3b0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     3b3:	53                   	push   %ebx
+     3b4:	ff 75 0c             	push   0xc(%ebp)
+     3b7:	57                   	push   %edi
+     3b8:	e8 33 0c 00 00       	call   ff0 <memmove>
+}
+     3bd:	83 c4 10             	add    $0x10,%esp
+     3c0:	83 fb 01             	cmp    $0x1,%ebx
+     3c3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     3c6:	74 78                	je     440 <concatenate_path+0xc0>
+
+     3c8:	83 ec 04             	sub    $0x4,%esp
+     3cb:	8d 44 1f 01          	lea    0x1(%edi,%ebx,1),%eax
+  }
+     3cf:	c6 04 1f 2f          	movb   $0x2f,(%edi,%ebx,1)
+
+     3d3:	51                   	push   %ecx
+     3d4:	56                   	push   %esi
+     3d5:	50                   	push   %eax
+     3d6:	e8 15 0c 00 00       	call   ff0 <memmove>
+     3db:	83 c4 10             	add    $0x10,%esp
+  }
+     3de:	0f b6 0f             	movzbl (%edi),%ecx
+     3e1:	31 db                	xor    %ebx,%ebx
+     3e3:	31 c0                	xor    %eax,%eax
+     3e5:	31 f6                	xor    %esi,%esi
+     3e7:	84 c9                	test   %cl,%cl
+     3e9:	75 1a                	jne    405 <concatenate_path+0x85>
+     3eb:	eb 45                	jmp    432 <concatenate_path+0xb2>
+     3ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+     3f0:	89 de                	mov    %ebx,%esi
+    exit();
+     3f2:	88 0c 37             	mov    %cl,(%edi,%esi,1)
+     3f5:	83 c3 01             	add    $0x1,%ebx
+  }
+     3f8:	83 c0 01             	add    $0x1,%eax
+     3fb:	0f b6 0c 07          	movzbl (%edi,%eax,1),%ecx
+     3ff:	89 c6                	mov    %eax,%esi
+     401:	84 c9                	test   %cl,%cl
+     403:	74 2b                	je     430 <concatenate_path+0xb0>
+  printf(1, "Current working directory is %s\n", cwd);
+     405:	80 f9 2f             	cmp    $0x2f,%cl
+     408:	75 e6                	jne    3f0 <concatenate_path+0x70>
+     40a:	80 7c 37 01 2e       	cmpb   $0x2e,0x1(%edi,%esi,1)
+     40f:	74 4f                	je     460 <concatenate_path+0xe0>
+
+     411:	85 db                	test   %ebx,%ebx
+     413:	74 43                	je     458 <concatenate_path+0xd8>
+     415:	80 7c 1f ff 2f       	cmpb   $0x2f,-0x1(%edi,%ebx,1)
+     41a:	89 de                	mov    %ebx,%esi
+     41c:	75 d4                	jne    3f2 <concatenate_path+0x72>
+  }
+     41e:	83 c0 01             	add    $0x1,%eax
+     421:	0f b6 0c 07          	movzbl (%edi,%eax,1),%ecx
+     425:	89 c6                	mov    %eax,%esi
+     427:	84 c9                	test   %cl,%cl
+     429:	75 da                	jne    405 <concatenate_path+0x85>
+     42b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     42f:	90                   	nop
+
+     430:	01 df                	add    %ebx,%edi
+     432:	c6 07 00             	movb   $0x0,(%edi)
+    exit();
+     435:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     438:	5b                   	pop    %ebx
+     439:	5e                   	pop    %esi
+     43a:	5f                   	pop    %edi
+     43b:	5d                   	pop    %ebp
+     43c:	c3                   	ret
+     43d:	8d 76 00             	lea    0x0(%esi),%esi
+
+     440:	83 ec 04             	sub    $0x4,%esp
+     443:	8d 47 01             	lea    0x1(%edi),%eax
+     446:	51                   	push   %ecx
+     447:	56                   	push   %esi
+     448:	50                   	push   %eax
+     449:	e8 a2 0b 00 00       	call   ff0 <memmove>
+     44e:	83 c4 10             	add    $0x10,%esp
+     451:	eb 8b                	jmp    3de <concatenate_path+0x5e>
+     453:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     457:	90                   	nop
+
+     458:	31 f6                	xor    %esi,%esi
+     45a:	eb 96                	jmp    3f2 <concatenate_path+0x72>
+     45c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  printf(1, "Current working directory is %s\n", cwd);
+     460:	0f b6 54 37 02       	movzbl 0x2(%edi,%esi,1),%edx
+     465:	80 fa 2f             	cmp    $0x2f,%dl
+     468:	74 36                	je     4a0 <concatenate_path+0x120>
+     46a:	84 d2                	test   %dl,%dl
+     46c:	74 32                	je     4a0 <concatenate_path+0x120>
+void cont_create(int argc, char **argv) {
+     46e:	80 fa 2e             	cmp    $0x2e,%dl
+     471:	75 9e                	jne    411 <concatenate_path+0x91>
+  if (argc != 3) {
+     473:	85 db                	test   %ebx,%ebx
+     475:	75 0e                	jne    485 <concatenate_path+0x105>
+     477:	eb 1b                	jmp    494 <concatenate_path+0x114>
+     479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     480:	83 eb 01             	sub    $0x1,%ebx
+     483:	74 0f                	je     494 <concatenate_path+0x114>
+     485:	80 7c 1f ff 2f       	cmpb   $0x2f,-0x1(%edi,%ebx,1)
+     48a:	75 f4                	jne    480 <concatenate_path+0x100>
+
+     48c:	83 fb 01             	cmp    $0x1,%ebx
+     48f:	74 03                	je     494 <concatenate_path+0x114>
+  // Check container name is within length limit.
+     491:	83 eb 01             	sub    $0x1,%ebx
+  if (strlen(cont_name) > MAX_CONT_NAME_LEN) {
+     494:	83 c0 02             	add    $0x2,%eax
+     497:	e9 5c ff ff ff       	jmp    3f8 <concatenate_path+0x78>
+     49c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  printf(1, "Root directory for container %s is %s\n", cont_name, crootdir);
+     4a0:	83 c0 01             	add    $0x1,%eax
+     4a3:	e9 50 ff ff ff       	jmp    3f8 <concatenate_path+0x78>
+     4a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4af:	90                   	nop
+  } else {
+     4b0:	83 ec 04             	sub    $0x4,%esp
+     4b3:	50                   	push   %eax
+     4b4:	56                   	push   %esi
+     4b5:	57                   	push   %edi
+     4b6:	e8 35 0b 00 00       	call   ff0 <memmove>
+     4bb:	83 c4 10             	add    $0x10,%esp
+     4be:	e9 1b ff ff ff       	jmp    3de <concatenate_path+0x5e>
+     4c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000004d0 <is_prefix_path>:
+  // Set the container status as CRUNNABLE.
+     4d0:	55                   	push   %ebp
+     4d1:	89 e5                	mov    %esp,%ebp
+     4d3:	56                   	push   %esi
+     4d4:	53                   	push   %ebx
+     4d5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     4d8:	8b 75 08             	mov    0x8(%ebp),%esi
+  if ((cid = cstart(cont_name)) < 0) {
+     4db:	0f b6 13             	movzbl (%ebx),%edx
+     4de:	80 fa 2f             	cmp    $0x2f,%dl
+     4e1:	74 4d                	je     530 <is_prefix_path+0x60>
+
+     4e3:	0f b6 0e             	movzbl (%esi),%ecx
+     4e6:	84 c9                	test   %cl,%cl
+     4e8:	74 36                	je     520 <is_prefix_path+0x50>
+  // Set the container status as CRUNNABLE.
+     4ea:	31 c0                	xor    %eax,%eax
+     4ec:	eb 15                	jmp    503 <is_prefix_path+0x33>
+     4ee:	66 90                	xchg   %ax,%ax
+  // Get process and its argument, ready to execute.
+     4f0:	38 ca                	cmp    %cl,%dl
+     4f2:	75 30                	jne    524 <is_prefix_path+0x54>
+  int jj = 0; // index of args
+     4f4:	83 c0 01             	add    $0x1,%eax
+
+     4f7:	0f b6 0c 06          	movzbl (%esi,%eax,1),%ecx
+    char *arg = argv[ii];
+     4fb:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+
+     4ff:	84 c9                	test   %cl,%cl
+     501:	74 1d                	je     520 <is_prefix_path+0x50>
+     503:	84 d2                	test   %dl,%dl
+     505:	75 e9                	jne    4f0 <is_prefix_path+0x20>
+    char *arg = argv[ii];
+     507:	84 c9                	test   %cl,%cl
+    int len = strlen(arg);
+     509:	5b                   	pop    %ebx
+     50a:	5e                   	pop    %esi
+    char *arg = argv[ii];
+     50b:	0f 94 c0             	sete   %al
+     50e:	80 f9 2f             	cmp    $0x2f,%cl
+    int len = strlen(arg);
+     511:	5d                   	pop    %ebp
+    char *arg = argv[ii];
+     512:	0f 94 c2             	sete   %dl
+     515:	09 d0                	or     %edx,%eax
+     517:	0f b6 c0             	movzbl %al,%eax
+    int len = strlen(arg);
+     51a:	c3                   	ret
+     51b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     51f:	90                   	nop
+    char *arg = argv[ii];
+     520:	84 d2                	test   %dl,%dl
+     522:	74 20                	je     544 <is_prefix_path+0x74>
+  char *args[MAX_ARG + 1];
+     524:	31 c0                	xor    %eax,%eax
+    int len = strlen(arg);
+     526:	5b                   	pop    %ebx
+     527:	5e                   	pop    %esi
+     528:	5d                   	pop    %ebp
+     529:	c3                   	ret
+     52a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if ((cid = cstart(cont_name)) < 0) {
+     530:	80 7b 01 00          	cmpb   $0x0,0x1(%ebx)
+    printf(2, "Start container %s fails.\n");
+     534:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((cid = cstart(cont_name)) < 0) {
+     539:	74 eb                	je     526 <is_prefix_path+0x56>
+
+     53b:	0f b6 0e             	movzbl (%esi),%ecx
+     53e:	84 c9                	test   %cl,%cl
+     540:	75 a8                	jne    4ea <is_prefix_path+0x1a>
+     542:	eb e0                	jmp    524 <is_prefix_path+0x54>
+     544:	31 c9                	xor    %ecx,%ecx
+     546:	eb bf                	jmp    507 <is_prefix_path+0x37>
+     548:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     54f:	90                   	nop
+
+00000550 <usage>:
+void usage(char *usage) {
+     550:	55                   	push   %ebp
+     551:	89 e5                	mov    %esp,%ebp
+     553:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "usage: %s\n", usage);
+     556:	ff 75 08             	push   0x8(%ebp)
+     559:	68 06 19 00 00       	push   $0x1906
+     55e:	6a 02                	push   $0x2
+     560:	e8 ab 0c 00 00       	call   1210 <printf>
+  exit();
+     565:	e8 f9 0a 00 00       	call   1063 <exit>
+     56a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000570 <get_filepath>:
+void get_filepath(char *fpath, char *rootdir, char *filename) {
+     570:	55                   	push   %ebp
+     571:	89 e5                	mov    %esp,%ebp
+     573:	57                   	push   %edi
+     574:	56                   	push   %esi
+     575:	53                   	push   %ebx
+     576:	83 ec 18             	sub    $0x18,%esp
+     579:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len1 = strlen(rootdir);
+     57c:	ff 75 0c             	push   0xc(%ebp)
+     57f:	e8 ec 08 00 00       	call   e70 <strlen>
+     584:	89 c6                	mov    %eax,%esi
+  int len2 = strlen(filename);
+     586:	58                   	pop    %eax
+     587:	ff 75 10             	push   0x10(%ebp)
+     58a:	e8 e1 08 00 00       	call   e70 <strlen>
+  memmove(fpath, rootdir, len1);
+     58f:	83 c4 0c             	add    $0xc,%esp
+     592:	56                   	push   %esi
+  int len2 = strlen(filename);
+     593:	89 c7                	mov    %eax,%edi
+  memmove(fpath, rootdir, len1);
+     595:	ff 75 0c             	push   0xc(%ebp)
+     598:	53                   	push   %ebx
+     599:	e8 52 0a 00 00       	call   ff0 <memmove>
+  memmove(fpath + len1 + 1, filename, len2);
+     59e:	83 c4 0c             	add    $0xc,%esp
+     5a1:	8d 44 33 01          	lea    0x1(%ebx,%esi,1),%eax
+  fpath[len1] = '/';
+     5a5:	c6 04 33 2f          	movb   $0x2f,(%ebx,%esi,1)
+  memmove(fpath + len1 + 1, filename, len2);
+     5a9:	57                   	push   %edi
+  fpath[len1 + len2 + 1] = '\0';
+     5aa:	01 f3                	add    %esi,%ebx
+  memmove(fpath + len1 + 1, filename, len2);
+     5ac:	ff 75 10             	push   0x10(%ebp)
+     5af:	50                   	push   %eax
+     5b0:	e8 3b 0a 00 00       	call   ff0 <memmove>
+  fpath[len1 + len2 + 1] = '\0';
+     5b5:	c6 44 1f 01 00       	movb   $0x0,0x1(%edi,%ebx,1)
+}
+     5ba:	83 c4 10             	add    $0x10,%esp
+     5bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     5c0:	5b                   	pop    %ebx
+     5c1:	5e                   	pop    %esi
+     5c2:	5f                   	pop    %edi
+     5c3:	5d                   	pop    %ebp
+     5c4:	c3                   	ret
+     5c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005d0 <cp_file_to_rootdir>:
+int cp_file_to_rootdir(char *rootdir, char *filename) {
+     5d0:	55                   	push   %ebp
+     5d1:	89 e5                	mov    %esp,%ebp
+     5d3:	57                   	push   %edi
+     5d4:	56                   	push   %esi
+     5d5:	53                   	push   %ebx
+  get_filepath(fpath, rootdir, filename);
+     5d6:	8d 9d e8 f9 ff ff    	lea    -0x618(%ebp),%ebx
+int cp_file_to_rootdir(char *rootdir, char *filename) {
+     5dc:	81 ec 20 06 00 00    	sub    $0x620,%esp
+     5e2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  get_filepath(fpath, rootdir, filename);
+     5e5:	57                   	push   %edi
+     5e6:	ff 75 08             	push   0x8(%ebp)
+     5e9:	53                   	push   %ebx
+     5ea:	e8 81 ff ff ff       	call   570 <get_filepath>
+  if ((src_fd = open(filename, O_RDONLY)) < 0) {
+     5ef:	58                   	pop    %eax
+     5f0:	5a                   	pop    %edx
+     5f1:	6a 00                	push   $0x0
+     5f3:	57                   	push   %edi
+     5f4:	e8 aa 0a 00 00       	call   10a3 <open>
+     5f9:	83 c4 10             	add    $0x10,%esp
+     5fc:	85 c0                	test   %eax,%eax
+     5fe:	78 78                	js     678 <cp_file_to_rootdir+0xa8>
+  if ((dst_fd = open(fpath, O_CREATE | O_WRONLY)) < 0) {
+     600:	83 ec 08             	sub    $0x8,%esp
+     603:	89 c6                	mov    %eax,%esi
+     605:	68 01 02 00 00       	push   $0x201
+     60a:	53                   	push   %ebx
+     60b:	e8 93 0a 00 00       	call   10a3 <open>
+     610:	83 c4 10             	add    $0x10,%esp
+     613:	89 c7                	mov    %eax,%edi
+     615:	85 c0                	test   %eax,%eax
+     617:	78 77                	js     690 <cp_file_to_rootdir+0xc0>
+     619:	8d 9d e8 fb ff ff    	lea    -0x418(%ebp),%ebx
+     61f:	eb 15                	jmp    636 <cp_file_to_rootdir+0x66>
+     621:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+		write(dst_fd, buffer, sz);
+     628:	83 ec 04             	sub    $0x4,%esp
+     62b:	52                   	push   %edx
+     62c:	53                   	push   %ebx
+     62d:	57                   	push   %edi
+     62e:	e8 50 0a 00 00       	call   1083 <write>
+     633:	83 c4 10             	add    $0x10,%esp
+  while ((sz = read(src_fd, buffer, BUFFER_SIZE)) != 0) {
+     636:	83 ec 04             	sub    $0x4,%esp
+     639:	68 00 04 00 00       	push   $0x400
+     63e:	53                   	push   %ebx
+     63f:	56                   	push   %esi
+     640:	e8 36 0a 00 00       	call   107b <read>
+     645:	83 c4 10             	add    $0x10,%esp
+     648:	89 c2                	mov    %eax,%edx
+     64a:	85 c0                	test   %eax,%eax
+     64c:	75 da                	jne    628 <cp_file_to_rootdir+0x58>
+  close(src_fd);
+     64e:	83 ec 0c             	sub    $0xc,%esp
+     651:	89 85 e4 f9 ff ff    	mov    %eax,-0x61c(%ebp)
+     657:	56                   	push   %esi
+     658:	e8 2e 0a 00 00       	call   108b <close>
+  close(dst_fd);
+     65d:	89 3c 24             	mov    %edi,(%esp)
+     660:	e8 26 0a 00 00       	call   108b <close>
+  return 0;
+     665:	8b 95 e4 f9 ff ff    	mov    -0x61c(%ebp),%edx
+     66b:	83 c4 10             	add    $0x10,%esp
+}
+     66e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     671:	89 d0                	mov    %edx,%eax
+     673:	5b                   	pop    %ebx
+     674:	5e                   	pop    %esi
+     675:	5f                   	pop    %edi
+     676:	5d                   	pop    %ebp
+     677:	c3                   	ret
+    printf(2, "Open src file %s error.\n", filename);
+     678:	83 ec 04             	sub    $0x4,%esp
+     67b:	57                   	push   %edi
+     67c:	68 11 19 00 00       	push   $0x1911
+     681:	6a 02                	push   $0x2
+     683:	e8 88 0b 00 00       	call   1210 <printf>
+     688:	83 c4 10             	add    $0x10,%esp
+  return -1;
+     68b:	83 ca ff             	or     $0xffffffff,%edx
+     68e:	eb de                	jmp    66e <cp_file_to_rootdir+0x9e>
+    printf(2, "Open dst file %s error.\n", fpath);
+     690:	83 ec 04             	sub    $0x4,%esp
+     693:	53                   	push   %ebx
+     694:	68 2a 19 00 00       	push   $0x192a
+     699:	6a 02                	push   $0x2
+     69b:	e8 70 0b 00 00       	call   1210 <printf>
+  if (src_fd > 0) {
+     6a0:	83 c4 10             	add    $0x10,%esp
+     6a3:	85 f6                	test   %esi,%esi
+     6a5:	74 e4                	je     68b <cp_file_to_rootdir+0xbb>
+    close(src_fd);
+     6a7:	83 ec 0c             	sub    $0xc,%esp
+     6aa:	56                   	push   %esi
+     6ab:	e8 db 09 00 00       	call   108b <close>
+     6b0:	83 c4 10             	add    $0x10,%esp
+     6b3:	eb d6                	jmp    68b <cp_file_to_rootdir+0xbb>
+     6b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006c0 <get_cont_fullpath>:
+int get_cont_fullpath(char *fpath, char *cont_name) {
+     6c0:	55                   	push   %ebp
+     6c1:	89 e5                	mov    %esp,%ebp
+     6c3:	56                   	push   %esi
+     6c4:	53                   	push   %ebx
+  memset(cur_path, '\0', MAX_PATH_LEN);
+     6c5:	8d b5 f8 fd ff ff    	lea    -0x208(%ebp),%esi
+int get_cont_fullpath(char *fpath, char *cont_name) {
+     6cb:	81 ec 04 02 00 00    	sub    $0x204,%esp
+  memset(cur_path, '\0', MAX_PATH_LEN);
+     6d1:	68 00 02 00 00       	push   $0x200
+     6d6:	6a 00                	push   $0x0
+     6d8:	56                   	push   %esi
+     6d9:	e8 c2 07 00 00       	call   ea0 <memset>
+  if (getcwd(cur_path) != 0) {
+     6de:	89 34 24             	mov    %esi,(%esp)
+     6e1:	e8 ba fb ff ff       	call   2a0 <getcwd>
+     6e6:	83 c4 10             	add    $0x10,%esp
+     6e9:	85 c0                	test   %eax,%eax
+     6eb:	75 33                	jne    720 <get_cont_fullpath+0x60>
+  printf(1, "Current working directory is %s\n", cur_path);
+     6ed:	83 ec 04             	sub    $0x4,%esp
+     6f0:	89 c3                	mov    %eax,%ebx
+     6f2:	56                   	push   %esi
+     6f3:	68 48 1b 00 00       	push   $0x1b48
+     6f8:	6a 01                	push   $0x1
+     6fa:	e8 11 0b 00 00       	call   1210 <printf>
+  concatenate_path(fpath, cur_path, cont_name);
+     6ff:	83 c4 0c             	add    $0xc,%esp
+     702:	ff 75 0c             	push   0xc(%ebp)
+     705:	56                   	push   %esi
+     706:	ff 75 08             	push   0x8(%ebp)
+     709:	e8 72 fc ff ff       	call   380 <concatenate_path>
+  return 0;
+     70e:	83 c4 10             	add    $0x10,%esp
+}
+     711:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     714:	89 d8                	mov    %ebx,%eax
+     716:	5b                   	pop    %ebx
+     717:	5e                   	pop    %esi
+     718:	5d                   	pop    %ebp
+     719:	c3                   	ret
+     71a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(2, "Get current working directory error\n");
+     720:	83 ec 08             	sub    $0x8,%esp
+     723:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+     728:	68 20 1b 00 00       	push   $0x1b20
+     72d:	6a 02                	push   $0x2
+     72f:	e8 dc 0a 00 00       	call   1210 <printf>
+     734:	83 c4 10             	add    $0x10,%esp
+     737:	eb d8                	jmp    711 <get_cont_fullpath+0x51>
+     739:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000740 <can_start_container>:
+int can_start_container(char *cont_name) {
+     740:	55                   	push   %ebp
+     741:	89 e5                	mov    %esp,%ebp
+     743:	57                   	push   %edi
+     744:	56                   	push   %esi
+     745:	53                   	push   %ebx
+  memset(cwd, 0, MAX_PATH_LEN);
+     746:	8d 9d e8 fb ff ff    	lea    -0x418(%ebp),%ebx
+int can_start_container(char *cont_name) {
+     74c:	81 ec 10 04 00 00    	sub    $0x410,%esp
+     752:	8b 7d 08             	mov    0x8(%ebp),%edi
+  memset(cwd, 0, MAX_PATH_LEN);
+     755:	68 00 02 00 00       	push   $0x200
+     75a:	6a 00                	push   $0x0
+     75c:	53                   	push   %ebx
+     75d:	e8 3e 07 00 00       	call   ea0 <memset>
+  if (getcwd(cwd) != 0) {
+     762:	89 1c 24             	mov    %ebx,(%esp)
+     765:	e8 36 fb ff ff       	call   2a0 <getcwd>
+     76a:	83 c4 10             	add    $0x10,%esp
+     76d:	85 c0                	test   %eax,%eax
+     76f:	75 59                	jne    7ca <can_start_container+0x8a>
+  memset(crootdir, 0, MAX_PATH_LEN);
+     771:	83 ec 04             	sub    $0x4,%esp
+     774:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+     77a:	68 00 02 00 00       	push   $0x200
+     77f:	6a 00                	push   $0x0
+     781:	56                   	push   %esi
+     782:	e8 19 07 00 00       	call   ea0 <memset>
+  if (getcontrootdir(cont_name, crootdir) != 0) {
+     787:	5a                   	pop    %edx
+     788:	59                   	pop    %ecx
+     789:	56                   	push   %esi
+     78a:	57                   	push   %edi
+     78b:	e8 a3 08 00 00       	call   1033 <getcontrootdir>
+     790:	83 c4 10             	add    $0x10,%esp
+     793:	85 c0                	test   %eax,%eax
+     795:	75 46                	jne    7dd <can_start_container+0x9d>
+  printf(1, "Current working directory is %s\n", cwd);
+     797:	83 ec 04             	sub    $0x4,%esp
+     79a:	53                   	push   %ebx
+     79b:	68 48 1b 00 00       	push   $0x1b48
+     7a0:	6a 01                	push   $0x1
+     7a2:	e8 69 0a 00 00       	call   1210 <printf>
+  printf(1, "Root directory for container %s is %s\n", cont_name, crootdir);
+     7a7:	56                   	push   %esi
+     7a8:	57                   	push   %edi
+     7a9:	68 d4 1b 00 00       	push   $0x1bd4
+     7ae:	6a 01                	push   $0x1
+     7b0:	e8 5b 0a 00 00       	call   1210 <printf>
+  return is_prefix_path(cwd, crootdir);
+     7b5:	83 c4 18             	add    $0x18,%esp
+     7b8:	56                   	push   %esi
+     7b9:	53                   	push   %ebx
+     7ba:	e8 11 fd ff ff       	call   4d0 <is_prefix_path>
+     7bf:	83 c4 10             	add    $0x10,%esp
+}
+     7c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     7c5:	5b                   	pop    %ebx
+     7c6:	5e                   	pop    %esi
+     7c7:	5f                   	pop    %edi
+     7c8:	5d                   	pop    %ebp
+     7c9:	c3                   	ret
+    printf(2, "Getting working directory when starting container error\n");
+     7ca:	53                   	push   %ebx
+     7cb:	53                   	push   %ebx
+     7cc:	68 6c 1b 00 00       	push   $0x1b6c
+     7d1:	6a 02                	push   $0x2
+     7d3:	e8 38 0a 00 00       	call   1210 <printf>
+    exit();
+     7d8:	e8 86 08 00 00       	call   1063 <exit>
+    printf(2, "Get root directory for container %s error\n", cont_name);
+     7dd:	50                   	push   %eax
+     7de:	57                   	push   %edi
+     7df:	68 a8 1b 00 00       	push   $0x1ba8
+     7e4:	6a 02                	push   $0x2
+     7e6:	e8 25 0a 00 00       	call   1210 <printf>
+    exit();
+     7eb:	e8 73 08 00 00       	call   1063 <exit>
+
+000007f0 <cont_create>:
+void cont_create(int argc, char **argv) {
+     7f0:	55                   	push   %ebp
+     7f1:	89 e5                	mov    %esp,%ebp
+     7f3:	56                   	push   %esi
+     7f4:	53                   	push   %ebx
+     7f5:	81 ec 00 02 00 00    	sub    $0x200,%esp
+  if (argc != 3) {
+     7fb:	83 7d 08 03          	cmpl   $0x3,0x8(%ebp)
+     7ff:	0f 85 98 00 00 00    	jne    89d <cont_create+0xad>
+  char *cont_name = argv[2];
+     805:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if (strlen(cont_name) > MAX_CONT_NAME_LEN) {
+     808:	83 ec 0c             	sub    $0xc,%esp
+  char *cont_name = argv[2];
+     80b:	8b 70 08             	mov    0x8(%eax),%esi
+  if (strlen(cont_name) > MAX_CONT_NAME_LEN) {
+     80e:	56                   	push   %esi
+     80f:	e8 5c 06 00 00       	call   e70 <strlen>
+     814:	83 c4 10             	add    $0x10,%esp
+     817:	83 f8 0f             	cmp    $0xf,%eax
+     81a:	0f 87 c5 00 00 00    	ja     8e5 <cont_create+0xf5>
+  memset(fpath, '\0', MAX_PATH_LEN);
+     820:	83 ec 04             	sub    $0x4,%esp
+     823:	8d 9d f8 fd ff ff    	lea    -0x208(%ebp),%ebx
+     829:	68 00 02 00 00       	push   $0x200
+     82e:	6a 00                	push   $0x0
+     830:	53                   	push   %ebx
+     831:	e8 6a 06 00 00       	call   ea0 <memset>
+  if (get_cont_fullpath(fpath, cont_name) != 0) {
+     836:	59                   	pop    %ecx
+     837:	58                   	pop    %eax
+     838:	56                   	push   %esi
+     839:	53                   	push   %ebx
+     83a:	e8 81 fe ff ff       	call   6c0 <get_cont_fullpath>
+     83f:	83 c4 10             	add    $0x10,%esp
+     842:	85 c0                	test   %eax,%eax
+     844:	0f 85 96 00 00 00    	jne    8e0 <cont_create+0xf0>
+  printf(1, "full path is : %s \n", fpath);
+     84a:	83 ec 04             	sub    $0x4,%esp
+     84d:	53                   	push   %ebx
+     84e:	68 5c 19 00 00       	push   $0x195c
+     853:	6a 01                	push   $0x1
+     855:	e8 b6 09 00 00       	call   1210 <printf>
+  if (mkdir(fpath) != 0) {
+     85a:	89 1c 24             	mov    %ebx,(%esp)
+     85d:	e8 69 08 00 00       	call   10cb <mkdir>
+     862:	83 c4 10             	add    $0x10,%esp
+     865:	85 c0                	test   %eax,%eax
+     867:	75 64                	jne    8cd <cont_create+0xdd>
+  printf(1, "directory %s has been created successfully\n", fpath);
+     869:	83 ec 04             	sub    $0x4,%esp
+     86c:	53                   	push   %ebx
+     86d:	68 60 1c 00 00       	push   $0x1c60
+     872:	6a 01                	push   $0x1
+     874:	e8 97 09 00 00       	call   1210 <printf>
+  if (ccreate(fpath) == 0) {
+     879:	89 1c 24             	mov    %ebx,(%esp)
+     87c:	e8 9a 07 00 00       	call   101b <ccreate>
+     881:	83 c4 10             	add    $0x10,%esp
+     884:	85 c0                	test   %eax,%eax
+     886:	75 22                	jne    8aa <cont_create+0xba>
+    printf(1, "Container %s created at %s successfully.\n", cont_name, fpath);
+     888:	53                   	push   %ebx
+     889:	56                   	push   %esi
+     88a:	68 8c 1c 00 00       	push   $0x1c8c
+     88f:	6a 01                	push   $0x1
+     891:	e8 7a 09 00 00       	call   1210 <printf>
+}
+     896:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     899:	5b                   	pop    %ebx
+     89a:	5e                   	pop    %esi
+     89b:	5d                   	pop    %ebp
+     89c:	c3                   	ret
+    usage("cont create <cont name>\n");
+     89d:	83 ec 0c             	sub    $0xc,%esp
+     8a0:	68 43 19 00 00       	push   $0x1943
+     8a5:	e8 a6 fc ff ff       	call   550 <usage>
+    if (unlink(fpath) != 0) {
+     8aa:	83 ec 0c             	sub    $0xc,%esp
+     8ad:	53                   	push   %ebx
+     8ae:	e8 00 08 00 00       	call   10b3 <unlink>
+     8b3:	83 c4 10             	add    $0x10,%esp
+     8b6:	85 c0                	test   %eax,%eax
+     8b8:	75 3e                	jne    8f8 <cont_create+0x108>
+    printf(2, "Create container %s at %s fails.\n", cont_name, fpath);
+     8ba:	53                   	push   %ebx
+     8bb:	56                   	push   %esi
+     8bc:	68 d8 1c 00 00       	push   $0x1cd8
+     8c1:	6a 02                	push   $0x2
+     8c3:	e8 48 09 00 00       	call   1210 <printf>
+    exit();
+     8c8:	e8 96 07 00 00       	call   1063 <exit>
+    printf(2, "Create directory as the rootdir %s for container fail.\n", fpath);
+     8cd:	52                   	push   %edx
+     8ce:	53                   	push   %ebx
+     8cf:	68 28 1c 00 00       	push   $0x1c28
+     8d4:	6a 02                	push   $0x2
+     8d6:	e8 35 09 00 00       	call   1210 <printf>
+    exit();
+     8db:	e8 83 07 00 00       	call   1063 <exit>
+    exit();
+     8e0:	e8 7e 07 00 00       	call   1063 <exit>
+    printf(2, "Container name shouldn't exceed 15 bytes\n");
+     8e5:	50                   	push   %eax
+     8e6:	50                   	push   %eax
+     8e7:	68 fc 1b 00 00       	push   $0x1bfc
+     8ec:	6a 02                	push   $0x2
+     8ee:	e8 1d 09 00 00       	call   1210 <printf>
+    exit();
+     8f3:	e8 6b 07 00 00       	call   1063 <exit>
+      printf(2, "Remove root directory %s fail.\n", fpath);
+     8f8:	50                   	push   %eax
+     8f9:	53                   	push   %ebx
+     8fa:	68 b8 1c 00 00       	push   $0x1cb8
+     8ff:	6a 02                	push   $0x2
+     901:	e8 0a 09 00 00       	call   1210 <printf>
+     906:	83 c4 10             	add    $0x10,%esp
+     909:	eb af                	jmp    8ba <cont_create+0xca>
+     90b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     90f:	90                   	nop
+
+00000910 <cont_start>:
+void cont_start(int argc, char **argv) {
+     910:	55                   	push   %ebp
+     911:	89 e5                	mov    %esp,%ebp
+     913:	57                   	push   %edi
+     914:	56                   	push   %esi
+     915:	53                   	push   %ebx
+     916:	83 ec 4c             	sub    $0x4c,%esp
+  if (argc < 4 || argc > MAX_ARG + 3) {
+     919:	8b 45 08             	mov    0x8(%ebp),%eax
+     91c:	83 e8 04             	sub    $0x4,%eax
+     91f:	83 f8 09             	cmp    $0x9,%eax
+     922:	0f 87 21 01 00 00    	ja     a49 <cont_start+0x139>
+  char *cont_name = argv[2];
+     928:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if (!can_start_container(cont_name)) {
+     92b:	83 ec 0c             	sub    $0xc,%esp
+  char *cont_name = argv[2];
+     92e:	8b 40 08             	mov    0x8(%eax),%eax
+     931:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  if (!can_start_container(cont_name)) {
+     934:	50                   	push   %eax
+     935:	e8 06 fe ff ff       	call   740 <can_start_container>
+     93a:	83 c4 10             	add    $0x10,%esp
+     93d:	85 c0                	test   %eax,%eax
+     93f:	0f 84 f1 00 00 00    	je     a36 <cont_start+0x126>
+  if ((cid = cstart(cont_name)) < 0) {
+     945:	83 ec 0c             	sub    $0xc,%esp
+     948:	ff 75 b4             	push   -0x4c(%ebp)
+     94b:	e8 fb 06 00 00       	call   104b <cstart>
+     950:	83 c4 10             	add    $0x10,%esp
+     953:	85 c0                	test   %eax,%eax
+     955:	0f 88 c8 00 00 00    	js     a23 <cont_start+0x113>
+  printf(1, "Start container %s with cid %d succeeds.\n", cont_name, cid);
+     95b:	50                   	push   %eax
+  int ii = 3; // index of argv
+     95c:	bf 03 00 00 00       	mov    $0x3,%edi
+     961:	8d 5d bc             	lea    -0x44(%ebp),%ebx
+  printf(1, "Start container %s with cid %d succeeds.\n", cont_name, cid);
+     964:	89 45 b0             	mov    %eax,-0x50(%ebp)
+     967:	ff 75 b4             	push   -0x4c(%ebp)
+     96a:	68 60 1d 00 00       	push   $0x1d60
+     96f:	6a 01                	push   $0x1
+     971:	e8 9a 08 00 00       	call   1210 <printf>
+     976:	83 c4 10             	add    $0x10,%esp
+     979:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    int len = strlen(arg);
+     980:	8b 45 0c             	mov    0xc(%ebp),%eax
+     983:	83 ec 0c             	sub    $0xc,%esp
+     986:	ff 34 b8             	push   (%eax,%edi,4)
+     989:	e8 e2 04 00 00       	call   e70 <strlen>
+     98e:	89 c6                	mov    %eax,%esi
+    args[jj] = malloc(len + 1);
+     990:	8d 40 01             	lea    0x1(%eax),%eax
+     993:	89 04 24             	mov    %eax,(%esp)
+     996:	e8 b5 0d 00 00       	call   1750 <malloc>
+    memmove(args[jj], argv[ii], len);
+     99b:	83 c4 0c             	add    $0xc,%esp
+    args[jj] = malloc(len + 1);
+     99e:	89 44 bb f4          	mov    %eax,-0xc(%ebx,%edi,4)
+    memmove(args[jj], argv[ii], len);
+     9a2:	56                   	push   %esi
+     9a3:	8b 55 0c             	mov    0xc(%ebp),%edx
+     9a6:	ff 34 ba             	push   (%edx,%edi,4)
+     9a9:	50                   	push   %eax
+     9aa:	e8 41 06 00 00       	call   ff0 <memmove>
+    args[jj][len] = '\0';
+     9af:	8b 44 bb f4          	mov    -0xc(%ebx,%edi,4),%eax
+  for (; ii < argc; ++ii, ++jj) {
+     9b3:	83 c4 10             	add    $0x10,%esp
+     9b6:	83 c7 01             	add    $0x1,%edi
+    args[jj][len] = '\0';
+     9b9:	c6 04 30 00          	movb   $0x0,(%eax,%esi,1)
+  for (; ii < argc; ++ii, ++jj) {
+     9bd:	39 7d 08             	cmp    %edi,0x8(%ebp)
+     9c0:	75 be                	jne    980 <cont_start+0x70>
+     9c2:	8b 45 08             	mov    0x8(%ebp),%eax
+     9c5:	8b 4d b0             	mov    -0x50(%ebp),%ecx
+  for (; jj <= MAX_ARG; ++jj) {
+     9c8:	8d 55 f4             	lea    -0xc(%ebp),%edx
+     9cb:	8d 04 83             	lea    (%ebx,%eax,4),%eax
+     9ce:	66 90                	xchg   %ax,%ax
+    args[jj] = 0;
+     9d0:	c7 40 f4 00 00 00 00 	movl   $0x0,-0xc(%eax)
+  for (; jj <= MAX_ARG; ++jj) {
+     9d7:	83 c0 04             	add    $0x4,%eax
+     9da:	39 d0                	cmp    %edx,%eax
+     9dc:	75 f2                	jne    9d0 <cont_start+0xc0>
+  if (spawn(args[0], args, 0, 0, cid) < 0) {
+     9de:	83 ec 0c             	sub    $0xc,%esp
+     9e1:	51                   	push   %ecx
+     9e2:	6a 00                	push   $0x0
+     9e4:	6a 00                	push   $0x0
+     9e6:	53                   	push   %ebx
+     9e7:	ff 75 bc             	push   -0x44(%ebp)
+     9ea:	e8 3c 07 00 00       	call   112b <spawn>
+     9ef:	83 c4 20             	add    $0x20,%esp
+     9f2:	85 c0                	test   %eax,%eax
+     9f4:	78 0a                	js     a00 <cont_start+0xf0>
+}
+     9f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     9f9:	5b                   	pop    %ebx
+     9fa:	5e                   	pop    %esi
+     9fb:	5f                   	pop    %edi
+     9fc:	5d                   	pop    %ebp
+     9fd:	c3                   	ret
+     9fe:	66 90                	xchg   %ax,%ax
+    printf(2, "Execute process fails.\n");
+     a00:	83 ec 08             	sub    $0x8,%esp
+     a03:	68 8b 19 00 00       	push   $0x198b
+     a08:	6a 02                	push   $0x2
+     a0a:	e8 01 08 00 00       	call   1210 <printf>
+    cstop(cont_name);
+     a0f:	58                   	pop    %eax
+     a10:	ff 75 b4             	push   -0x4c(%ebp)
+     a13:	e8 3b 06 00 00       	call   1053 <cstop>
+     a18:	83 c4 10             	add    $0x10,%esp
+}
+     a1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a1e:	5b                   	pop    %ebx
+     a1f:	5e                   	pop    %esi
+     a20:	5f                   	pop    %edi
+     a21:	5d                   	pop    %ebp
+     a22:	c3                   	ret
+    printf(2, "Start container %s fails.\n");
+     a23:	52                   	push   %edx
+     a24:	52                   	push   %edx
+     a25:	68 70 19 00 00       	push   $0x1970
+     a2a:	6a 02                	push   $0x2
+     a2c:	e8 df 07 00 00       	call   1210 <printf>
+    exit();
+     a31:	e8 2d 06 00 00       	call   1063 <exit>
+    printf(2, "Error, starting container has to be in its root directory\n");
+     a36:	51                   	push   %ecx
+     a37:	51                   	push   %ecx
+     a38:	68 24 1d 00 00       	push   $0x1d24
+     a3d:	6a 02                	push   $0x2
+     a3f:	e8 cc 07 00 00       	call   1210 <printf>
+    exit();
+     a44:	e8 1a 06 00 00       	call   1063 <exit>
+    usage("cont start <cont name> prog [arg..]\n");
+     a49:	83 ec 0c             	sub    $0xc,%esp
+     a4c:	68 fc 1c 00 00       	push   $0x1cfc
+     a51:	e8 fa fa ff ff       	call   550 <usage>
+     a56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a60 <cont_pause>:
+void cont_pause(int argc, char **argv) {
+     a60:	55                   	push   %ebp
+     a61:	89 e5                	mov    %esp,%ebp
+     a63:	53                   	push   %ebx
+     a64:	83 ec 04             	sub    $0x4,%esp
+  if (argc < 3) {
+     a67:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+     a6b:	7e 4b                	jle    ab8 <cont_pause+0x58>
+  char *cont_name = argv[2];
+     a6d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if (cpause(cont_name) != 0) {
+     a70:	83 ec 0c             	sub    $0xc,%esp
+  char *cont_name = argv[2];
+     a73:	8b 58 08             	mov    0x8(%eax),%ebx
+  if (cpause(cont_name) != 0) {
+     a76:	53                   	push   %ebx
+     a77:	e8 bf 05 00 00       	call   103b <cpause>
+     a7c:	83 c4 10             	add    $0x10,%esp
+     a7f:	85 c0                	test   %eax,%eax
+     a81:	75 1d                	jne    aa0 <cont_pause+0x40>
+    printf(1, "Container %s pause succeeds\n", cont_name);
+     a83:	83 ec 04             	sub    $0x4,%esp
+     a86:	53                   	push   %ebx
+     a87:	68 d5 19 00 00       	push   $0x19d5
+     a8c:	6a 01                	push   $0x1
+     a8e:	e8 7d 07 00 00       	call   1210 <printf>
+}
+     a93:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    printf(1, "Container %s pause succeeds\n", cont_name);
+     a96:	83 c4 10             	add    $0x10,%esp
+}
+     a99:	c9                   	leave
+     a9a:	c3                   	ret
+     a9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a9f:	90                   	nop
+    printf(2, "Container %s pause error\n", cont_name);
+     aa0:	83 ec 04             	sub    $0x4,%esp
+     aa3:	53                   	push   %ebx
+     aa4:	68 bb 19 00 00       	push   $0x19bb
+     aa9:	6a 02                	push   $0x2
+     aab:	e8 60 07 00 00       	call   1210 <printf>
+}
+     ab0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ab3:	83 c4 10             	add    $0x10,%esp
+     ab6:	c9                   	leave
+     ab7:	c3                   	ret
+    usage("cont pause <cont name>\n");
+     ab8:	83 ec 0c             	sub    $0xc,%esp
+     abb:	68 a3 19 00 00       	push   $0x19a3
+     ac0:	e8 8b fa ff ff       	call   550 <usage>
+     ac5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     acc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ad0 <cont_resume>:
+void cont_resume(int argc, char **argv) {
+     ad0:	55                   	push   %ebp
+     ad1:	89 e5                	mov    %esp,%ebp
+     ad3:	53                   	push   %ebx
+     ad4:	83 ec 04             	sub    $0x4,%esp
+  if (argc < 3) {
+     ad7:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+     adb:	7e 6e                	jle    b4b <cont_resume+0x7b>
+  char *cont_name = argv[2];
+     add:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if (!can_start_container(cont_name)) {
+     ae0:	83 ec 0c             	sub    $0xc,%esp
+  char *cont_name = argv[2];
+     ae3:	8b 58 08             	mov    0x8(%eax),%ebx
+  if (!can_start_container(cont_name)) {
+     ae6:	53                   	push   %ebx
+     ae7:	e8 54 fc ff ff       	call   740 <can_start_container>
+     aec:	83 c4 10             	add    $0x10,%esp
+     aef:	85 c0                	test   %eax,%eax
+     af1:	74 45                	je     b38 <cont_resume+0x68>
+  if (cresume(cont_name) != 0) {
+     af3:	83 ec 0c             	sub    $0xc,%esp
+     af6:	53                   	push   %ebx
+     af7:	e8 47 05 00 00       	call   1043 <cresume>
+     afc:	83 c4 10             	add    $0x10,%esp
+     aff:	85 c0                	test   %eax,%eax
+     b01:	75 1d                	jne    b20 <cont_resume+0x50>
+    printf(1, "Container %s resume succeeds\n", cont_name);
+     b03:	83 ec 04             	sub    $0x4,%esp
+     b06:	53                   	push   %ebx
+     b07:	68 26 1a 00 00       	push   $0x1a26
+     b0c:	6a 01                	push   $0x1
+     b0e:	e8 fd 06 00 00       	call   1210 <printf>
+}
+     b13:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    printf(1, "Container %s resume succeeds\n", cont_name);
+     b16:	83 c4 10             	add    $0x10,%esp
+}
+     b19:	c9                   	leave
+     b1a:	c3                   	ret
+     b1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b1f:	90                   	nop
+    printf(2, "Container %s resume error\n", cont_name);
+     b20:	83 ec 04             	sub    $0x4,%esp
+     b23:	53                   	push   %ebx
+     b24:	68 0b 1a 00 00       	push   $0x1a0b
+     b29:	6a 02                	push   $0x2
+     b2b:	e8 e0 06 00 00       	call   1210 <printf>
+}
+     b30:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b33:	83 c4 10             	add    $0x10,%esp
+     b36:	c9                   	leave
+     b37:	c3                   	ret
+    printf(2, "Error, resuming container has to be in its root directory\n");
+     b38:	50                   	push   %eax
+     b39:	50                   	push   %eax
+     b3a:	68 8c 1d 00 00       	push   $0x1d8c
+     b3f:	6a 02                	push   $0x2
+     b41:	e8 ca 06 00 00       	call   1210 <printf>
+    exit();
+     b46:	e8 18 05 00 00       	call   1063 <exit>
+    usage("cont resume <cont name>\n");
+     b4b:	83 ec 0c             	sub    $0xc,%esp
+     b4e:	68 f2 19 00 00       	push   $0x19f2
+     b53:	e8 f8 f9 ff ff       	call   550 <usage>
+     b58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b5f:	90                   	nop
+
+00000b60 <cont_stop>:
+void cont_stop(int argc, char **argv) {
+     b60:	55                   	push   %ebp
+     b61:	89 e5                	mov    %esp,%ebp
+     b63:	53                   	push   %ebx
+     b64:	83 ec 04             	sub    $0x4,%esp
+  if (argc != 3) {
+     b67:	83 7d 08 03          	cmpl   $0x3,0x8(%ebp)
+     b6b:	75 4b                	jne    bb8 <cont_stop+0x58>
+  char *name = argv[2];
+     b6d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if (cstop(name) != 0) {
+     b70:	83 ec 0c             	sub    $0xc,%esp
+  char *name = argv[2];
+     b73:	8b 58 08             	mov    0x8(%eax),%ebx
+  if (cstop(name) != 0) {
+     b76:	53                   	push   %ebx
+     b77:	e8 d7 04 00 00       	call   1053 <cstop>
+     b7c:	83 c4 10             	add    $0x10,%esp
+     b7f:	85 c0                	test   %eax,%eax
+     b81:	75 1d                	jne    ba0 <cont_stop+0x40>
+    printf(1, "Container %s stop succeeds.\n", name);
+     b83:	83 ec 04             	sub    $0x4,%esp
+     b86:	53                   	push   %ebx
+     b87:	68 75 1a 00 00       	push   $0x1a75
+     b8c:	6a 01                	push   $0x1
+     b8e:	e8 7d 06 00 00       	call   1210 <printf>
+}
+     b93:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    printf(1, "Container %s stop succeeds.\n", name);
+     b96:	83 c4 10             	add    $0x10,%esp
+}
+     b99:	c9                   	leave
+     b9a:	c3                   	ret
+     b9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b9f:	90                   	nop
+    printf(2, "Container %s stop fails.\n", name);
+     ba0:	83 ec 04             	sub    $0x4,%esp
+     ba3:	53                   	push   %ebx
+     ba4:	68 5b 1a 00 00       	push   $0x1a5b
+     ba9:	6a 02                	push   $0x2
+     bab:	e8 60 06 00 00       	call   1210 <printf>
+}
+     bb0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     bb3:	83 c4 10             	add    $0x10,%esp
+     bb6:	c9                   	leave
+     bb7:	c3                   	ret
+    usage("cont stop <cont name>\n");
+     bb8:	83 ec 0c             	sub    $0xc,%esp
+     bbb:	68 44 1a 00 00       	push   $0x1a44
+     bc0:	e8 8b f9 ff ff       	call   550 <usage>
+     bc5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000bd0 <cont_limit>:
+void cont_limit(int argc, char **argv) {
+     bd0:	55                   	push   %ebp
+     bd1:	89 e5                	mov    %esp,%ebp
+     bd3:	56                   	push   %esi
+     bd4:	53                   	push   %ebx
+  if (argc != 4) {
+     bd5:	83 7d 08 04          	cmpl   $0x4,0x8(%ebp)
+void cont_limit(int argc, char **argv) {
+     bd9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if (argc != 4) {
+     bdc:	75 5c                	jne    c3a <cont_limit+0x6a>
+  if (climit(name, atoi(argv[3])) != 0) {
+     bde:	83 ec 0c             	sub    $0xc,%esp
+  char *name = argv[2];
+     be1:	8b 73 08             	mov    0x8(%ebx),%esi
+  if (climit(name, atoi(argv[3])) != 0) {
+     be4:	ff 73 0c             	push   0xc(%ebx)
+     be7:	e8 c4 03 00 00       	call   fb0 <atoi>
+     bec:	5a                   	pop    %edx
+     bed:	59                   	pop    %ecx
+     bee:	50                   	push   %eax
+     bef:	56                   	push   %esi
+     bf0:	e8 2e 05 00 00       	call   1123 <climit>
+     bf5:	83 c4 10             	add    $0x10,%esp
+     bf8:	85 c0                	test   %eax,%eax
+     bfa:	75 24                	jne    c20 <cont_limit+0x50>
+    printf(1, "Container %s memory limited to %s KB.\n", name, argv[3]);
+     bfc:	ff 73 0c             	push   0xc(%ebx)
+     bff:	56                   	push   %esi
+     c00:	68 f4 1d 00 00       	push   $0x1df4
+     c05:	6a 01                	push   $0x1
+     c07:	e8 04 06 00 00       	call   1210 <printf>
+     c0c:	83 c4 10             	add    $0x10,%esp
+}
+     c0f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     c12:	5b                   	pop    %ebx
+     c13:	5e                   	pop    %esi
+     c14:	5d                   	pop    %ebp
+     c15:	c3                   	ret
+     c16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c1d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(2, "Container %s limit fails.\n", name);
+     c20:	83 ec 04             	sub    $0x4,%esp
+     c23:	56                   	push   %esi
+     c24:	68 92 1a 00 00       	push   $0x1a92
+     c29:	6a 02                	push   $0x2
+     c2b:	e8 e0 05 00 00       	call   1210 <printf>
+     c30:	83 c4 10             	add    $0x10,%esp
+}
+     c33:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     c36:	5b                   	pop    %ebx
+     c37:	5e                   	pop    %esi
+     c38:	5d                   	pop    %ebp
+     c39:	c3                   	ret
+    usage("cont limit <cont name> <KB, 0 for none>\n");
+     c3a:	83 ec 0c             	sub    $0xc,%esp
+     c3d:	68 c8 1d 00 00       	push   $0x1dc8
+     c42:	e8 09 f9 ff ff       	call   550 <usage>
+     c47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c4e:	66 90                	xchg   %ax,%ax
+
+00000c50 <cont_checkpoint>:
+void cont_checkpoint(int argc, char **argv) {
+     c50:	55                   	push   %ebp
+     c51:	89 e5                	mov    %esp,%ebp
+     c53:	56                   	push   %esi
+     c54:	53                   	push   %ebx
+  if (argc != 4) {
+     c55:	83 7d 08 04          	cmpl   $0x4,0x8(%ebp)
+void cont_checkpoint(int argc, char **argv) {
+     c59:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if (argc != 4) {
+     c5c:	75 7c                	jne    cda <cont_checkpoint+0x8a>
+  char *name = argv[2];
+     c5e:	8b 73 08             	mov    0x8(%ebx),%esi
+  int n = ccheckpoint(name, argv[3]);
+     c61:	83 ec 08             	sub    $0x8,%esp
+     c64:	ff 73 0c             	push   0xc(%ebx)
+     c67:	56                   	push   %esi
+     c68:	e8 de 04 00 00       	call   114b <ccheckpoint>
+  if (n == CKPT_TOOBIG) {
+     c6d:	83 c4 10             	add    $0x10,%esp
+     c70:	83 f8 fe             	cmp    $0xfffffffe,%eax
+     c73:	74 4b                	je     cc0 <cont_checkpoint+0x70>
+  } else if (n < 0) {
+     c75:	85 c0                	test   %eax,%eax
+     c77:	78 27                	js     ca0 <cont_checkpoint+0x50>
+    printf(1, "Container %s: %d processes saved to %s.\n", name, n, argv[3]);
+     c79:	83 ec 0c             	sub    $0xc,%esp
+     c7c:	ff 73 0c             	push   0xc(%ebx)
+     c7f:	50                   	push   %eax
+     c80:	56                   	push   %esi
+     c81:	68 a8 1e 00 00       	push   $0x1ea8
+     c86:	6a 01                	push   $0x1
+     c88:	e8 83 05 00 00       	call   1210 <printf>
+     c8d:	83 c4 20             	add    $0x20,%esp
+}
+     c90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     c93:	5b                   	pop    %ebx
+     c94:	5e                   	pop    %esi
+     c95:	5d                   	pop    %ebp
+     c96:	c3                   	ret
+     c97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c9e:	66 90                	xchg   %ax,%ax
+    printf(2, "Container %s checkpoint fails.\n", name);
+     ca0:	83 ec 04             	sub    $0x4,%esp
+     ca3:	56                   	push   %esi
+     ca4:	68 88 1e 00 00       	push   $0x1e88
+     ca9:	6a 02                	push   $0x2
+     cab:	e8 60 05 00 00       	call   1210 <printf>
+     cb0:	83 c4 10             	add    $0x10,%esp
+}
+     cb3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     cb6:	5b                   	pop    %ebx
+     cb7:	5e                   	pop    %esi
+     cb8:	5d                   	pop    %ebp
+     cb9:	c3                   	ret
+     cba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(2, "Container %s checkpoint fails: the image would be larger than a file.\n", name);
+     cc0:	83 ec 04             	sub    $0x4,%esp
+     cc3:	56                   	push   %esi
+     cc4:	68 40 1e 00 00       	push   $0x1e40
+     cc9:	6a 02                	push   $0x2
+     ccb:	e8 40 05 00 00       	call   1210 <printf>
+     cd0:	83 c4 10             	add    $0x10,%esp
+}
+     cd3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     cd6:	5b                   	pop    %ebx
+     cd7:	5e                   	pop    %esi
+     cd8:	5d                   	pop    %ebp
+     cd9:	c3                   	ret
+    usage("cont checkpoint <cont name> <file>\n");
+     cda:	83 ec 0c             	sub    $0xc,%esp
+     cdd:	68 1c 1e 00 00       	push   $0x1e1c
+     ce2:	e8 69 f8 ff ff       	call   550 <usage>
+     ce7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cee:	66 90                	xchg   %ax,%ax
+
+00000cf0 <cont_restore>:
+void cont_restore(int argc, char **argv) {
+     cf0:	55                   	push   %ebp
+     cf1:	89 e5                	mov    %esp,%ebp
+     cf3:	56                   	push   %esi
+     cf4:	53                   	push   %ebx
+  if (argc != 4) {
+     cf5:	83 7d 08 04          	cmpl   $0x4,0x8(%ebp)
+void cont_restore(int argc, char **argv) {
+     cf9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if (argc != 4) {
+     cfc:	75 54                	jne    d52 <cont_restore+0x62>
+  char *name = argv[2];
+     cfe:	8b 73 08             	mov    0x8(%ebx),%esi
+  int n = crestore(name, argv[3]);
+     d01:	83 ec 08             	sub    $0x8,%esp
+     d04:	ff 73 0c             	push   0xc(%ebx)
+     d07:	56                   	push   %esi
+     d08:	e8 46 04 00 00       	call   1153 <crestore>
+  if (n < 0) {
+     d0d:	83 c4 10             	add    $0x10,%esp
+     d10:	85 c0                	test   %eax,%eax
+     d12:	78 24                	js     d38 <cont_restore+0x48>
+    printf(1, "Container %s: %d processes restored from %s.\n", name, n, argv[3]);
+     d14:	83 ec 0c             	sub    $0xc,%esp
+     d17:	ff 73 0c             	push   0xc(%ebx)
+     d1a:	50                   	push   %eax
+     d1b:	56                   	push   %esi
+     d1c:	68 f8 1e 00 00       	push   $0x1ef8
+     d21:	6a 01                	push   $0x1
+     d23:	e8 e8 04 00 00       	call   1210 <printf>
+     d28:	83 c4 20             	add    $0x20,%esp
+}
+     d2b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d2e:	5b                   	pop    %ebx
+     d2f:	5e                   	pop    %esi
+     d30:	5d                   	pop    %ebp
+     d31:	c3                   	ret
+     d32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(2, "Container %s restore fails.\n", name);
+     d38:	83 ec 04             	sub    $0x4,%esp
+     d3b:	56                   	push   %esi
+     d3c:	68 ad 1a 00 00       	push   $0x1aad
+     d41:	6a 02                	push   $0x2
+     d43:	e8 c8 04 00 00       	call   1210 <printf>
+     d48:	83 c4 10             	add    $0x10,%esp
+}
+     d4b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d4e:	5b                   	pop    %ebx
+     d4f:	5e                   	pop    %esi
+     d50:	5d                   	pop    %ebp
+     d51:	c3                   	ret
+    usage("cont restore <cont name> <file>\n");
+     d52:	83 ec 0c             	sub    $0xc,%esp
+     d55:	68 d4 1e 00 00       	push   $0x1ed4
+     d5a:	e8 f1 f7 ff ff       	call   550 <usage>
+     d5f:	90                   	nop
+
+00000d60 <cont_zygote>:
+void cont_zygote(int argc, char **argv) {
+     d60:	55                   	push   %ebp
+     d61:	89 e5                	mov    %esp,%ebp
+     d63:	56                   	push   %esi
+     d64:	53                   	push   %ebx
+  if (argc != 5) {
+     d65:	83 7d 08 05          	cmpl   $0x5,0x8(%ebp)
+void cont_zygote(int argc, char **argv) {
+     d69:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if (argc != 5) {
+     d6c:	75 5c                	jne    dca <cont_zygote+0x6a>
+  char *name = argv[2];
+     d6e:	8b 73 08             	mov    0x8(%ebx),%esi
+  int n = czygote(name, argv[4], atoi(argv[3]));
+     d71:	83 ec 0c             	sub    $0xc,%esp
+     d74:	ff 73 0c             	push   0xc(%ebx)
+     d77:	e8 34 02 00 00       	call   fb0 <atoi>
+     d7c:	83 c4 0c             	add    $0xc,%esp
+     d7f:	50                   	push   %eax
+     d80:	ff 73 10             	push   0x10(%ebx)
+     d83:	56                   	push   %esi
+     d84:	e8 d2 03 00 00       	call   115b <czygote>
+  if (n < 0) {
+     d89:	83 c4 10             	add    $0x10,%esp
+     d8c:	85 c0                	test   %eax,%eax
+     d8e:	78 20                	js     db0 <cont_zygote+0x50>
+    printf(1, "Container %s: %d zygotes of %s loaded.\n", name, n, argv[4]);
+     d90:	83 ec 0c             	sub    $0xc,%esp
+     d93:	ff 73 10             	push   0x10(%ebx)
+     d96:	50                   	push   %eax
+     d97:	56                   	push   %esi
+     d98:	68 7c 1f 00 00       	push   $0x1f7c
+     d9d:	6a 01                	push   $0x1
+     d9f:	e8 6c 04 00 00       	call   1210 <printf>
+     da4:	83 c4 20             	add    $0x20,%esp
+}
+     da7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     daa:	5b                   	pop    %ebx
+     dab:	5e                   	pop    %esi
+     dac:	5d                   	pop    %ebp
+     dad:	c3                   	ret
+     dae:	66 90                	xchg   %ax,%ax
+    printf(2, "Container %s zygote pool fails.\n", name);
+     db0:	83 ec 04             	sub    $0x4,%esp
+     db3:	56                   	push   %esi
+     db4:	68 58 1f 00 00       	push   $0x1f58
+     db9:	6a 02                	push   $0x2
+     dbb:	e8 50 04 00 00       	call   1210 <printf>
+     dc0:	83 c4 10             	add    $0x10,%esp
+}
+     dc3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     dc6:	5b                   	pop    %ebx
+     dc7:	5e                   	pop    %esi
+     dc8:	5d                   	pop    %ebp
+     dc9:	c3                   	ret
+    usage("cont zygote <cont name> <n, 0 for none> prog\n");
+     dca:	83 ec 0c             	sub    $0xc,%esp
+     dcd:	68 28 1f 00 00       	push   $0x1f28
+     dd2:	e8 79 f7 ff ff       	call   550 <usage>
+     dd7:	66 90                	xchg   %ax,%ax
+     dd9:	66 90                	xchg   %ax,%ax
+     ddb:	66 90                	xchg   %ax,%ax
+     ddd:	66 90                	xchg   %ax,%ax
+     ddf:	90                   	nop
+
+00000de0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     de0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     de1:	31 c0                	xor    %eax,%eax
+{
+     de3:	89 e5                	mov    %esp,%ebp
+     de5:	53                   	push   %ebx
+     de6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     de9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     dec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     df0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     df4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     df7:	83 c0 01             	add    $0x1,%eax
+     dfa:	84 d2                	test   %dl,%dl
+     dfc:	75 f2                	jne    df0 <strcpy+0x10>
+    ;
+  return os;
+}
+     dfe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e01:	89 c8                	mov    %ecx,%eax
+     e03:	c9                   	leave
+     e04:	c3                   	ret
+     e05:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000e10 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     e10:	55                   	push   %ebp
+     e11:	89 e5                	mov    %esp,%ebp
+     e13:	53                   	push   %ebx
+     e14:	8b 55 08             	mov    0x8(%ebp),%edx
+     e17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     e1a:	0f b6 02             	movzbl (%edx),%eax
+     e1d:	84 c0                	test   %al,%al
+     e1f:	75 17                	jne    e38 <strcmp+0x28>
+     e21:	eb 3a                	jmp    e5d <strcmp+0x4d>
+     e23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e27:	90                   	nop
+     e28:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     e2c:	83 c2 01             	add    $0x1,%edx
+     e2f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     e32:	84 c0                	test   %al,%al
+     e34:	74 1a                	je     e50 <strcmp+0x40>
+    p++, q++;
+     e36:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     e38:	0f b6 19             	movzbl (%ecx),%ebx
+     e3b:	38 c3                	cmp    %al,%bl
+     e3d:	74 e9                	je     e28 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     e3f:	29 d8                	sub    %ebx,%eax
+}
+     e41:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e44:	c9                   	leave
+     e45:	c3                   	ret
+     e46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e4d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     e50:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     e54:	31 c0                	xor    %eax,%eax
+     e56:	29 d8                	sub    %ebx,%eax
+}
+     e58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e5b:	c9                   	leave
+     e5c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     e5d:	0f b6 19             	movzbl (%ecx),%ebx
+     e60:	31 c0                	xor    %eax,%eax
+     e62:	eb db                	jmp    e3f <strcmp+0x2f>
+     e64:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e6f:	90                   	nop
+
+00000e70 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     e70:	55                   	push   %ebp
+     e71:	89 e5                	mov    %esp,%ebp
+     e73:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     e76:	80 3a 00             	cmpb   $0x0,(%edx)
+     e79:	74 15                	je     e90 <strlen+0x20>
+     e7b:	31 c0                	xor    %eax,%eax
+     e7d:	8d 76 00             	lea    0x0(%esi),%esi
+     e80:	83 c0 01             	add    $0x1,%eax
+     e83:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     e87:	89 c1                	mov    %eax,%ecx
+     e89:	75 f5                	jne    e80 <strlen+0x10>
+    ;
+  return n;
+}
+     e8b:	89 c8                	mov    %ecx,%eax
+     e8d:	5d                   	pop    %ebp
+     e8e:	c3                   	ret
+     e8f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     e90:	31 c9                	xor    %ecx,%ecx
+}
+     e92:	5d                   	pop    %ebp
+     e93:	89 c8                	mov    %ecx,%eax
+     e95:	c3                   	ret
+     e96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ea0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     ea0:	55                   	push   %ebp
+     ea1:	89 e5                	mov    %esp,%ebp
+     ea3:	57                   	push   %edi
+     ea4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     ea7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     eaa:	8b 45 0c             	mov    0xc(%ebp),%eax
+     ead:	89 d7                	mov    %edx,%edi
+     eaf:	fc                   	cld
+     eb0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     eb2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     eb5:	89 d0                	mov    %edx,%eax
+     eb7:	c9                   	leave
+     eb8:	c3                   	ret
+     eb9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000ec0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     ec0:	55                   	push   %ebp
+     ec1:	89 e5                	mov    %esp,%ebp
+     ec3:	8b 45 08             	mov    0x8(%ebp),%eax
+     ec6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     eca:	0f b6 10             	movzbl (%eax),%edx
+     ecd:	84 d2                	test   %dl,%dl
+     ecf:	75 12                	jne    ee3 <strchr+0x23>
+     ed1:	eb 1d                	jmp    ef0 <strchr+0x30>
+     ed3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ed7:	90                   	nop
+     ed8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     edc:	83 c0 01             	add    $0x1,%eax
+     edf:	84 d2                	test   %dl,%dl
+     ee1:	74 0d                	je     ef0 <strchr+0x30>
+    if(*s == c)
+     ee3:	38 d1                	cmp    %dl,%cl
+     ee5:	75 f1                	jne    ed8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     ee7:	5d                   	pop    %ebp
+     ee8:	c3                   	ret
+     ee9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     ef0:	31 c0                	xor    %eax,%eax
+}
+     ef2:	5d                   	pop    %ebp
+     ef3:	c3                   	ret
+     ef4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     efb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     eff:	90                   	nop
+
+00000f00 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     f00:	55                   	push   %ebp
+     f01:	89 e5                	mov    %esp,%ebp
+     f03:	57                   	push   %edi
+     f04:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     f05:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     f08:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     f09:	31 db                	xor    %ebx,%ebx
+{
+     f0b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     f0e:	eb 27                	jmp    f37 <gets+0x37>
+    cc = read(0, &c, 1);
+     f10:	83 ec 04             	sub    $0x4,%esp
+     f13:	6a 01                	push   $0x1
+     f15:	56                   	push   %esi
+     f16:	6a 00                	push   $0x0
+     f18:	e8 5e 01 00 00       	call   107b <read>
+    if(cc < 1)
+     f1d:	83 c4 10             	add    $0x10,%esp
+     f20:	85 c0                	test   %eax,%eax
+     f22:	7e 1d                	jle    f41 <gets+0x41>
+      break;
+    buf[i++] = c;
+     f24:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     f28:	8b 55 08             	mov    0x8(%ebp),%edx
+     f2b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     f2f:	3c 0a                	cmp    $0xa,%al
+     f31:	74 10                	je     f43 <gets+0x43>
+     f33:	3c 0d                	cmp    $0xd,%al
+     f35:	74 0c                	je     f43 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     f37:	89 df                	mov    %ebx,%edi
+     f39:	83 c3 01             	add    $0x1,%ebx
+     f3c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     f3f:	7c cf                	jl     f10 <gets+0x10>
+     f41:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     f43:	8b 45 08             	mov    0x8(%ebp),%eax
+     f46:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     f4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f4d:	5b                   	pop    %ebx
+     f4e:	5e                   	pop    %esi
+     f4f:	5f                   	pop    %edi
+     f50:	5d                   	pop    %ebp
+     f51:	c3                   	ret
+     f52:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000f60 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     f60:	55                   	push   %ebp
+     f61:	89 e5                	mov    %esp,%ebp
+     f63:	56                   	push   %esi
+     f64:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     f65:	83 ec 08             	sub    $0x8,%esp
+     f68:	6a 00                	push   $0x0
+     f6a:	ff 75 08             	push   0x8(%ebp)
+     f6d:	e8 31 01 00 00       	call   10a3 <open>
+  if(fd < 0)
+     f72:	83 c4 10             	add    $0x10,%esp
+     f75:	85 c0                	test   %eax,%eax
+     f77:	78 27                	js     fa0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     f79:	83 ec 08             	sub    $0x8,%esp
+     f7c:	ff 75 0c             	push   0xc(%ebp)
+     f7f:	89 c3                	mov    %eax,%ebx
+     f81:	50                   	push   %eax
+     f82:	e8 34 01 00 00       	call   10bb <fstat>
+  close(fd);
+     f87:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     f8a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     f8c:	e8 fa 00 00 00       	call   108b <close>
+  return r;
+     f91:	83 c4 10             	add    $0x10,%esp
+}
+     f94:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f97:	89 f0                	mov    %esi,%eax
+     f99:	5b                   	pop    %ebx
+     f9a:	5e                   	pop    %esi
+     f9b:	5d                   	pop    %ebp
+     f9c:	c3                   	ret
+     f9d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     fa0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     fa5:	eb ed                	jmp    f94 <stat+0x34>
+     fa7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fae:	66 90                	xchg   %ax,%ax
+
+00000fb0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     fb0:	55                   	push   %ebp
+     fb1:	89 e5                	mov    %esp,%ebp
+     fb3:	53                   	push   %ebx
+     fb4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     fb7:	0f be 02             	movsbl (%edx),%eax
+     fba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     fbd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     fc0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     fc5:	77 1e                	ja     fe5 <atoi+0x35>
+     fc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     fd0:	83 c2 01             	add    $0x1,%edx
+     fd3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     fd6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     fda:	0f be 02             	movsbl (%edx),%eax
+     fdd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     fe0:	80 fb 09             	cmp    $0x9,%bl
+     fe3:	76 eb                	jbe    fd0 <atoi+0x20>
+  return n;
+}
+     fe5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     fe8:	89 c8                	mov    %ecx,%eax
+     fea:	c9                   	leave
+     feb:	c3                   	ret
+     fec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ff0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     ff0:	55                   	push   %ebp
+     ff1:	89 e5                	mov    %esp,%ebp
+     ff3:	57                   	push   %edi
+     ff4:	56                   	push   %esi
+     ff5:	8b 45 10             	mov    0x10(%ebp),%eax
+     ff8:	8b 55 08             	mov    0x8(%ebp),%edx
+     ffb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     ffe:	85 c0                	test   %eax,%eax
+    1000:	7e 13                	jle    1015 <memmove+0x25>
+    1002:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1004:	89 d7                	mov    %edx,%edi
+    1006:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    100d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1010:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1011:	39 f8                	cmp    %edi,%eax
+    1013:	75 fb                	jne    1010 <memmove+0x20>
+  return vdst;
+}
+    1015:	5e                   	pop    %esi
+    1016:	89 d0                	mov    %edx,%eax
+    1018:	5f                   	pop    %edi
+    1019:	5d                   	pop    %ebp
+    101a:	c3                   	ret
+
+0000101b <ccreate>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(ccreate)
+    101b:	b8 17 00 00 00       	mov    $0x17,%eax
+    1020:	cd 40                	int    $0x40
+    1022:	c3                   	ret
+
+00001023 <cfork>:
+SYSCALL(cfork)
+    1023:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1028:	cd 40                	int    $0x40
+    102a:	c3                   	ret
+
+0000102b <cgetrootdir>:
+SYSCALL(cgetrootdir)
+    102b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1030:	cd 40                	int    $0x40
+    1032:	c3                   	ret
+
+00001033 <getcontrootdir>:
+SYSCALL(getcontrootdir)
+    1033:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1038:	cd 40                	int    $0x40
+    103a:	c3                   	ret
+
+0000103b <cpause>:
+SYSCALL(cpause)
+    103b:	b8 19 00 00 00       	mov    $0x19,%eax
+    1040:	cd 40                	int    $0x40
+    1042:	c3                   	ret
+
+00001043 <cresume>:
+SYSCALL(cresume)
+    1043:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1048:	cd 40                	int    $0x40
+    104a:	c3                   	ret
+
+0000104b <cstart>:
+SYSCALL(cstart)
+    104b:	b8 18 00 00 00       	mov    $0x18,%eax
+    1050:	cd 40                	int    $0x40
+    1052:	c3                   	ret
+
+00001053 <cstop>:
+SYSCALL(cstop)
+    1053:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1058:	cd 40                	int    $0x40
+    105a:	c3                   	ret
+
+0000105b <fork>:
+SYSCALL(fork)
+    105b:	b8 01 00 00 00       	mov    $0x1,%eax
+    1060:	cd 40                	int    $0x40
+    1062:	c3                   	ret
+
+00001063 <exit>:
+SYSCALL(exit)
+    1063:	b8 02 00 00 00       	mov    $0x2,%eax
+    1068:	cd 40                	int    $0x40
+    106a:	c3                   	ret
+
+0000106b <wait>:
+SYSCALL(wait)
+    106b:	b8 03 00 00 00       	mov    $0x3,%eax
+    1070:	cd 40                	int    $0x40
+    1072:	c3                   	ret
+
+00001073 <pipe>:
+SYSCALL(pipe)
+    1073:	b8 04 00 00 00       	mov    $0x4,%eax
+    1078:	cd 40                	int    $0x40
+    107a:	c3                   	ret
+
+0000107b <read>:
+SYSCALL(read)
+    107b:	b8 05 00 00 00       	mov    $0x5,%eax
+    1080:	cd 40                	int    $0x40
+    1082:	c3                   	ret
+
+00001083 <write>:
+SYSCALL(write)
+    1083:	b8 10 00 00 00       	mov    $0x10,%eax
+    1088:	cd 40                	int    $0x40
+    108a:	c3                   	ret
+
+0000108b <close>:
+SYSCALL(close)
+    108b:	b8 15 00 00 00       	mov    $0x15,%eax
+    1090:	cd 40                	int    $0x40
+    1092:	c3                   	ret
+
+00001093 <kill>:
+SYSCALL(kill)
+    1093:	b8 06 00 00 00       	mov    $0x6,%eax
+    1098:	cd 40                	int    $0x40
+    109a:	c3                   	ret
+
+0000109b <exec>:
+SYSCALL(exec)
+    109b:	b8 07 00 00 00       	mov    $0x7,%eax
+    10a0:	cd 40                	int    $0x40
+    10a2:	c3                   	ret
+
+000010a3 <open>:
+SYSCALL(open)
+    10a3:	b8 0f 00 00 00       	mov    $0xf,%eax
+    10a8:	cd 40                	int    $0x40
+    10aa:	c3                   	ret
+
+000010ab <mknod>:
+SYSCALL(mknod)
+    10ab:	b8 11 00 00 00       	mov    $0x11,%eax
+    10b0:	cd 40                	int    $0x40
+    10b2:	c3                   	ret
+
+000010b3 <unlink>:
+SYSCALL(unlink)
+    10b3:	b8 12 00 00 00       	mov    $0x12,%eax
+    10b8:	cd 40                	int    $0x40
+    10ba:	c3                   	ret
+
+000010bb <fstat>:
+SYSCALL(fstat)
+    10bb:	b8 08 00 00 00       	mov    $0x8,%eax
+    10c0:	cd 40                	int    $0x40
+    10c2:	c3                   	ret
+
+000010c3 <link>:
+SYSCALL(link)
+    10c3:	b8 13 00 00 00       	mov    $0x13,%eax
+    10c8:	cd 40                	int    $0x40
+    10ca:	c3                   	ret
+
+000010cb <mkdir>:
+SYSCALL(mkdir)
+    10cb:	b8 14 00 00 00       	mov    $0x14,%eax
+    10d0:	cd 40                	int    $0x40
+    10d2:	c3                   	ret
+
+000010d3 <chdir>:
+SYSCALL(chdir)
+    10d3:	b8 09 00 00 00       	mov    $0x9,%eax
+    10d8:	cd 40                	int    $0x40
+    10da:	c3                   	ret
+
+000010db <dup>:
+SYSCALL(dup)
+    10db:	b8 0a 00 00 00       	mov    $0xa,%eax
+    10e0:	cd 40                	int    $0x40
+    10e2:	c3                   	ret
+
+000010e3 <getpid>:
+SYSCALL(getpid)
+    10e3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    10e8:	cd 40                	int    $0x40
+    10ea:	c3                   	ret
+
+000010eb <sbrk>:
+SYSCALL(sbrk)
+    10eb:	b8 0c 00 00 00       	mov    $0xc,%eax
+    10f0:	cd 40                	int    $0x40
+    10f2:	c3                   	ret
+
+000010f3 <sleep>:
+SYSCALL(sleep)
+    10f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    10f8:	cd 40                	int    $0x40
+    10fa:	c3                   	ret
+
+000010fb <uptime>:
+SYSCALL(uptime)
+    10fb:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1100:	cd 40                	int    $0x40
+    1102:	c3                   	ret
+
+00001103 <cps>:
+SYSCALL(cps)
+    1103:	b8 16 00 00 00       	mov    $0x16,%eax
+    1108:	cd 40                	int    $0x40
+    110a:	c3                   	ret
+
+0000110b <mmap>:
+SYSCALL(mmap)
+    110b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1110:	cd 40                	int    $0x40
+    1112:	c3                   	ret
+
+00001113 <munmap>:
+SYSCALL(munmap)
+    1113:	b8 20 00 00 00       	mov    $0x20,%eax
+    1118:	cd 40                	int    $0x40
+    111a:	c3                   	ret
+
+0000111b <shmget>:
+SYSCALL(shmget)
+    111b:	b8 21 00 00 00       	mov    $0x21,%eax
+    1120:	cd 40                	int    $0x40
+    1122:	c3                   	ret
+
+00001123 <climit>:
+SYSCALL(climit)
+    1123:	b8 22 00 00 00       	mov    $0x22,%eax
+    1128:	cd 40                	int    $0x40
+    112a:	c3                   	ret
+
+0000112b <spawn>:
+SYSCALL(spawn)
+    112b:	b8 23 00 00 00       	mov    $0x23,%eax
+    1130:	cd 40                	int    $0x40
+    1132:	c3                   	ret
+
+00001133 <clone>:
+SYSCALL(clone)
+    1133:	b8 24 00 00 00       	mov    $0x24,%eax
+    1138:	cd 40                	int    $0x40
+    113a:	c3                   	ret
+
+0000113b <join>:
+SYSCALL(join)
+    113b:	b8 25 00 00 00       	mov    $0x25,%eax
+    1140:	cd 40                	int    $0x40
+    1142:	c3                   	ret
+
+00001143 <futex>:
+SYSCALL(futex)
+    1143:	b8 26 00 00 00       	mov    $0x26,%eax
+    1148:	cd 40                	int    $0x40
+    114a:	c3                   	ret
+
+0000114b <ccheckpoint>:
+SYSCALL(ccheckpoint)
+    114b:	b8 27 00 00 00       	mov    $0x27,%eax
+    1150:	cd 40                	int    $0x40
+    1152:	c3                   	ret
+
+00001153 <crestore>:
+SYSCALL(crestore)
+    1153:	b8 28 00 00 00       	mov    $0x28,%eax
+    1158:	cd 40                	int    $0x40
+    115a:	c3                   	ret
+
+0000115b <czygote>:
+SYSCALL(czygote)
+    115b:	b8 29 00 00 00       	mov    $0x29,%eax
+    1160:	cd 40                	int    $0x40
+    1162:	c3                   	ret
+
+00001163 <memstats>:
+SYSCALL(memstats)
+    1163:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1168:	cd 40                	int    $0x40
+    116a:	c3                   	ret
+    116b:	66 90                	xchg   %ax,%ax
+    116d:	66 90                	xchg   %ax,%ax
+    116f:	90                   	nop
+
+00001170 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1170:	55                   	push   %ebp
+    1171:	89 e5                	mov    %esp,%ebp
+    1173:	57                   	push   %edi
+    1174:	56                   	push   %esi
+    1175:	53                   	push   %ebx
+    1176:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1178:	89 d1                	mov    %edx,%ecx
+{
+    117a:	83 ec 3c             	sub    $0x3c,%esp
+    117d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1180:	85 d2                	test   %edx,%edx
+    1182:	0f 89 80 00 00 00    	jns    1208 <printint+0x98>
+    1188:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    118c:	74 7a                	je     1208 <printint+0x98>
+    x = -xx;
+    118e:	f7 d9                	neg    %ecx
+    neg = 1;
+    1190:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1195:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1198:	31 f6                	xor    %esi,%esi
+    119a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    11a0:	89 c8                	mov    %ecx,%eax
+    11a2:	31 d2                	xor    %edx,%edx
+    11a4:	89 f7                	mov    %esi,%edi
+    11a6:	f7 f3                	div    %ebx
+    11a8:	8d 76 01             	lea    0x1(%esi),%esi
+    11ab:	0f b6 92 28 20 00 00 	movzbl 0x2028(%edx),%edx
+    11b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    11b6:	89 ca                	mov    %ecx,%edx
+    11b8:	89 c1                	mov    %eax,%ecx
+    11ba:	39 da                	cmp    %ebx,%edx
+    11bc:	73 e2                	jae    11a0 <printint+0x30>
+  if(neg)
+    11be:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    11c1:	85 c0                	test   %eax,%eax
+    11c3:	74 07                	je     11cc <printint+0x5c>
+    buf[i++] = '-';
+    11c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    11ca:	89 f7                	mov    %esi,%edi
+    11cc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    11cf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    11d2:	01 df                	add    %ebx,%edi
+    11d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    11d8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    11db:	83 ec 04             	sub    $0x4,%esp
+    11de:	88 45 d7             	mov    %al,-0x29(%ebp)
+    11e1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    11e4:	6a 01                	push   $0x1
+    11e6:	50                   	push   %eax
+    11e7:	56                   	push   %esi
+    11e8:	e8 96 fe ff ff       	call   1083 <write>
+  while(--i >= 0)
+    11ed:	89 f8                	mov    %edi,%eax
+    11ef:	83 c4 10             	add    $0x10,%esp
+    11f2:	83 ef 01             	sub    $0x1,%edi
+    11f5:	39 d8                	cmp    %ebx,%eax
+    11f7:	75 df                	jne    11d8 <printint+0x68>
+}
+    11f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11fc:	5b                   	pop    %ebx
+    11fd:	5e                   	pop    %esi
+    11fe:	5f                   	pop    %edi
+    11ff:	5d                   	pop    %ebp
+    1200:	c3                   	ret
+    1201:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1208:	31 c0                	xor    %eax,%eax
+    120a:	eb 89                	jmp    1195 <printint+0x25>
+    120c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001210 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1210:	55                   	push   %ebp
+    1211:	89 e5                	mov    %esp,%ebp
+    1213:	57                   	push   %edi
+    1214:	56                   	push   %esi
+    1215:	53                   	push   %ebx
+    1216:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1219:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    121c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    121f:	0f b6 1e             	movzbl (%esi),%ebx
+    1222:	83 c6 01             	add    $0x1,%esi
+    1225:	84 db                	test   %bl,%bl
+    1227:	74 67                	je     1290 <printf+0x80>
+    1229:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    122c:	31 d2                	xor    %edx,%edx
+    122e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1231:	eb 34                	jmp    1267 <printf+0x57>
+    1233:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1237:	90                   	nop
+    1238:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    123b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1240:	83 f8 25             	cmp    $0x25,%eax
+    1243:	74 18                	je     125d <printf+0x4d>
+  write(fd, &c, 1);
+    1245:	83 ec 04             	sub    $0x4,%esp
+    1248:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    124b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    124e:	6a 01                	push   $0x1
+    1250:	50                   	push   %eax
+    1251:	57                   	push   %edi
+    1252:	e8 2c fe ff ff       	call   1083 <write>
+    1257:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    125a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    125d:	0f b6 1e             	movzbl (%esi),%ebx
+    1260:	83 c6 01             	add    $0x1,%esi
+    1263:	84 db                	test   %bl,%bl
+    1265:	74 29                	je     1290 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1267:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    126a:	85 d2                	test   %edx,%edx
+    126c:	74 ca                	je     1238 <printf+0x28>
+      }
+    } else if(state == '%'){
+    126e:	83 fa 25             	cmp    $0x25,%edx
+    1271:	75 ea                	jne    125d <printf+0x4d>
+      if(c == 'd'){
+    1273:	83 f8 25             	cmp    $0x25,%eax
+    1276:	0f 84 24 01 00 00    	je     13a0 <printf+0x190>
+    127c:	83 e8 63             	sub    $0x63,%eax
+    127f:	83 f8 15             	cmp    $0x15,%eax
+    1282:	77 1c                	ja     12a0 <printf+0x90>
+    1284:	ff 24 85 d0 1f 00 00 	jmp    *0x1fd0(,%eax,4)
+    128b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    128f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    1290:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1293:	5b                   	pop    %ebx
+    1294:	5e                   	pop    %esi
+    1295:	5f                   	pop    %edi
+    1296:	5d                   	pop    %ebp
+    1297:	c3                   	ret
+    1298:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    129f:	90                   	nop
+  write(fd, &c, 1);
+    12a0:	83 ec 04             	sub    $0x4,%esp
+    12a3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    12a6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    12aa:	6a 01                	push   $0x1
+    12ac:	52                   	push   %edx
+    12ad:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    12b0:	57                   	push   %edi
+    12b1:	e8 cd fd ff ff       	call   1083 <write>
+    12b6:	83 c4 0c             	add    $0xc,%esp
+    12b9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    12bc:	6a 01                	push   $0x1
+    12be:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    12c1:	52                   	push   %edx
+    12c2:	57                   	push   %edi
+    12c3:	e8 bb fd ff ff       	call   1083 <write>
+        putc(fd, c);
+    12c8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    12cb:	31 d2                	xor    %edx,%edx
+    12cd:	eb 8e                	jmp    125d <printf+0x4d>
+    12cf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    12d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    12d3:	83 ec 0c             	sub    $0xc,%esp
+    12d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    12db:	8b 13                	mov    (%ebx),%edx
+    12dd:	6a 00                	push   $0x0
+    12df:	89 f8                	mov    %edi,%eax
+        ap++;
+    12e1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    12e4:	e8 87 fe ff ff       	call   1170 <printint>
+        ap++;
+    12e9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    12ec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    12ef:	31 d2                	xor    %edx,%edx
+    12f1:	e9 67 ff ff ff       	jmp    125d <printf+0x4d>
+    12f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12fd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1300:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1303:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1305:	83 c0 04             	add    $0x4,%eax
+    1308:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    130b:	85 db                	test   %ebx,%ebx
+    130d:	0f 84 9d 00 00 00    	je     13b0 <printf+0x1a0>
+        while(*s != 0){
+    1313:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1316:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1318:	84 c0                	test   %al,%al
+    131a:	0f 84 3d ff ff ff    	je     125d <printf+0x4d>
+    1320:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1323:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1326:	89 de                	mov    %ebx,%esi
+    1328:	89 d3                	mov    %edx,%ebx
+    132a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1330:	83 ec 04             	sub    $0x4,%esp
+    1333:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1336:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1339:	6a 01                	push   $0x1
+    133b:	53                   	push   %ebx
+    133c:	57                   	push   %edi
+    133d:	e8 41 fd ff ff       	call   1083 <write>
+        while(*s != 0){
+    1342:	0f b6 06             	movzbl (%esi),%eax
+    1345:	83 c4 10             	add    $0x10,%esp
+    1348:	84 c0                	test   %al,%al
+    134a:	75 e4                	jne    1330 <printf+0x120>
+      state = 0;
+    134c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    134f:	31 d2                	xor    %edx,%edx
+    1351:	e9 07 ff ff ff       	jmp    125d <printf+0x4d>
+    1356:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    135d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1360:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1363:	83 ec 0c             	sub    $0xc,%esp
+    1366:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    136b:	8b 13                	mov    (%ebx),%edx
+    136d:	6a 01                	push   $0x1
+    136f:	e9 6b ff ff ff       	jmp    12df <printf+0xcf>
+    1374:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1378:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    137b:	83 ec 04             	sub    $0x4,%esp
+    137e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1381:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1383:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1386:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1389:	6a 01                	push   $0x1
+    138b:	52                   	push   %edx
+    138c:	57                   	push   %edi
+    138d:	e8 f1 fc ff ff       	call   1083 <write>
+        ap++;
+    1392:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1395:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1398:	31 d2                	xor    %edx,%edx
+    139a:	e9 be fe ff ff       	jmp    125d <printf+0x4d>
+    139f:	90                   	nop
+  write(fd, &c, 1);
+    13a0:	83 ec 04             	sub    $0x4,%esp
+    13a3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    13a6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    13a9:	6a 01                	push   $0x1
+    13ab:	e9 11 ff ff ff       	jmp    12c1 <printf+0xb1>
+    13b0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    13b5:	bb c9 1f 00 00       	mov    $0x1fc9,%ebx
+    13ba:	e9 61 ff ff ff       	jmp    1320 <printf+0x110>
+    13bf:	90                   	nop
+
+000013c0 <runfree>:
+
+// Give the n pages at r back to the free runs, merging them with
+// adjacent runs, and shrink the heap if the end of it is free.
+static void
+runfree(struct page *r, uint n)
+{
+    13c0:	55                   	push   %ebp
+  struct page **pp, *prev;
+
+  r->kind = PFREE;
+    13c1:	b9 03 00 00 00       	mov    $0x3,%ecx
+{
+    13c6:	89 e5                	mov    %esp,%ebp
+    13c8:	57                   	push   %edi
+    13c9:	56                   	push   %esi
+    13ca:	53                   	push   %ebx
+    13cb:	89 c3                	mov    %eax,%ebx
+    13cd:	83 ec 0c             	sub    $0xc,%esp
+  r->kind = PFREE;
+    13d0:	66 89 08             	mov    %cx,(%eax)
+  r->npages = n;
+  prev = 0;
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+    13d3:	8b 0d fc 26 00 00    	mov    0x26fc,%ecx
+  r->npages = n;
+    13d9:	89 50 04             	mov    %edx,0x4(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+    13dc:	85 c9                	test   %ecx,%ecx
+    13de:	0f 84 1f 01 00 00    	je     1503 <runfree+0x143>
+    13e4:	39 c1                	cmp    %eax,%ecx
+    13e6:	0f 83 f7 00 00 00    	jae    14e3 <runfree+0x123>
+    13ec:	89 c8                	mov    %ecx,%eax
+    13ee:	eb 04                	jmp    13f4 <runfree+0x34>
+    13f0:	39 d8                	cmp    %ebx,%eax
+    13f2:	73 09                	jae    13fd <runfree+0x3d>
+    13f4:	89 c2                	mov    %eax,%edx
+    13f6:	8b 40 14             	mov    0x14(%eax),%eax
+    13f9:	85 c0                	test   %eax,%eax
+    13fb:	75 f3                	jne    13f0 <runfree+0x30>
+    prev = *pp;
+  r->next = *pp;
+    13fd:	89 43 14             	mov    %eax,0x14(%ebx)
+  *pp = r;
+    1400:	89 5a 14             	mov    %ebx,0x14(%edx)
+
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+    1403:	8b 43 14             	mov    0x14(%ebx),%eax
+    1406:	85 c0                	test   %eax,%eax
+    1408:	74 12                	je     141c <runfree+0x5c>
+    140a:	8b 7b 04             	mov    0x4(%ebx),%edi
+    140d:	89 fe                	mov    %edi,%esi
+    140f:	c1 e6 0c             	shl    $0xc,%esi
+    1412:	01 de                	add    %ebx,%esi
+    1414:	39 f0                	cmp    %esi,%eax
+    1416:	0f 84 a4 00 00 00    	je     14c0 <runfree+0x100>
+    r->npages += r->next->npages;
+    r->next = r->next->next;
+  }
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+    141c:	8b 72 04             	mov    0x4(%edx),%esi
+    141f:	89 f0                	mov    %esi,%eax
+    1421:	c1 e0 0c             	shl    $0xc,%eax
+    1424:	01 d0                	add    %edx,%eax
+    1426:	39 c3                	cmp    %eax,%ebx
+    1428:	74 16                	je     1440 <runfree+0x80>
+    pp = &runs;
+    while(*pp != r)
+      pp = &(*pp)->next;
+  }
+
+  if(r->next == 0 && r->npages >= TRIM &&
+    142a:	8b 43 14             	mov    0x14(%ebx),%eax
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+    142d:	8d 72 14             	lea    0x14(%edx),%esi
+  if(r->next == 0 && r->npages >= TRIM &&
+    1430:	85 c0                	test   %eax,%eax
+    1432:	74 3c                	je     1470 <runfree+0xb0>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+    *pp = 0;
+    sbrk(-(int)(r->npages*PGSIZE));
+    heapend = (char*)r;
+  }
+}
+    1434:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1437:	5b                   	pop    %ebx
+    1438:	5e                   	pop    %esi
+    1439:	5f                   	pop    %edi
+    143a:	5d                   	pop    %ebp
+    143b:	c3                   	ret
+    143c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    prev->npages += r->npages;
+    1440:	03 73 04             	add    0x4(%ebx),%esi
+    1443:	89 72 04             	mov    %esi,0x4(%edx)
+    prev->next = r->next;
+    1446:	8b 43 14             	mov    0x14(%ebx),%eax
+    1449:	89 42 14             	mov    %eax,0x14(%edx)
+    while(*pp != r)
+    144c:	39 d1                	cmp    %edx,%ecx
+    144e:	0f 84 c5 00 00 00    	je     1519 <runfree+0x159>
+    1454:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      pp = &(*pp)->next;
+    1458:	89 cb                	mov    %ecx,%ebx
+    145a:	8b 49 14             	mov    0x14(%ecx),%ecx
+    while(*pp != r)
+    145d:	39 d1                	cmp    %edx,%ecx
+    145f:	75 f7                	jne    1458 <runfree+0x98>
+      pp = &(*pp)->next;
+    1461:	8d 73 14             	lea    0x14(%ebx),%esi
+    1464:	89 cb                	mov    %ecx,%ebx
+  if(r->next == 0 && r->npages >= TRIM &&
+    1466:	85 c0                	test   %eax,%eax
+    1468:	75 ca                	jne    1434 <runfree+0x74>
+    146a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1470:	8b 53 04             	mov    0x4(%ebx),%edx
+    1473:	83 fa 1f             	cmp    $0x1f,%edx
+    1476:	76 bc                	jbe    1434 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+    1478:	c1 e2 0c             	shl    $0xc,%edx
+    147b:	01 da                	add    %ebx,%edx
+  if(r->next == 0 && r->npages >= TRIM &&
+    147d:	39 15 f8 26 00 00    	cmp    %edx,0x26f8
+    1483:	75 af                	jne    1434 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+    1485:	83 ec 0c             	sub    $0xc,%esp
+    1488:	6a 00                	push   $0x0
+    148a:	e8 5c fc ff ff       	call   10eb <sbrk>
+    148f:	83 c4 10             	add    $0x10,%esp
+    1492:	39 05 f8 26 00 00    	cmp    %eax,0x26f8
+    1498:	75 9a                	jne    1434 <runfree+0x74>
+    *pp = 0;
+    149a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    sbrk(-(int)(r->npages*PGSIZE));
+    14a0:	8b 43 04             	mov    0x4(%ebx),%eax
+    14a3:	83 ec 0c             	sub    $0xc,%esp
+    14a6:	c1 e0 0c             	shl    $0xc,%eax
+    14a9:	f7 d8                	neg    %eax
+    14ab:	50                   	push   %eax
+    14ac:	e8 3a fc ff ff       	call   10eb <sbrk>
+    heapend = (char*)r;
+    14b1:	89 1d f8 26 00 00    	mov    %ebx,0x26f8
+    14b7:	83 c4 10             	add    $0x10,%esp
+}
+    14ba:	e9 75 ff ff ff       	jmp    1434 <runfree+0x74>
+    14bf:	90                   	nop
+    r->npages += r->next->npages;
+    14c0:	03 78 04             	add    0x4(%eax),%edi
+    14c3:	89 7b 04             	mov    %edi,0x4(%ebx)
+    r->next = r->next->next;
+    14c6:	8b 40 14             	mov    0x14(%eax),%eax
+    14c9:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+    14cc:	8b 72 04             	mov    0x4(%edx),%esi
+    14cf:	89 f0                	mov    %esi,%eax
+    14d1:	c1 e0 0c             	shl    $0xc,%eax
+    14d4:	01 d0                	add    %edx,%eax
+    14d6:	39 c3                	cmp    %eax,%ebx
+    14d8:	0f 85 4c ff ff ff    	jne    142a <runfree+0x6a>
+    14de:	e9 5d ff ff ff       	jmp    1440 <runfree+0x80>
+  r->next = *pp;
+    14e3:	89 48 14             	mov    %ecx,0x14(%eax)
+  *pp = r;
+    14e6:	a3 fc 26 00 00       	mov    %eax,0x26fc
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+    14eb:	89 d0                	mov    %edx,%eax
+    14ed:	c1 e0 0c             	shl    $0xc,%eax
+    14f0:	01 d8                	add    %ebx,%eax
+    14f2:	39 c1                	cmp    %eax,%ecx
+    14f4:	74 2f                	je     1525 <runfree+0x165>
+  if(r->next == 0 && r->npages >= TRIM &&
+    14f6:	8b 43 14             	mov    0x14(%ebx),%eax
+    14f9:	be fc 26 00 00       	mov    $0x26fc,%esi
+    14fe:	e9 2d ff ff ff       	jmp    1430 <runfree+0x70>
+  r->next = *pp;
+    1503:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+    150a:	be fc 26 00 00       	mov    $0x26fc,%esi
+  *pp = r;
+    150f:	a3 fc 26 00 00       	mov    %eax,0x26fc
+  if(r->next == 0 && r->npages >= TRIM &&
+    1514:	e9 5a ff ff ff       	jmp    1473 <runfree+0xb3>
+    while(*pp != r)
+    1519:	89 cb                	mov    %ecx,%ebx
+    pp = &runs;
+    151b:	be fc 26 00 00       	mov    $0x26fc,%esi
+    1520:	e9 0b ff ff ff       	jmp    1430 <runfree+0x70>
+    r->npages += r->next->npages;
+    1525:	03 51 04             	add    0x4(%ecx),%edx
+    1528:	89 53 04             	mov    %edx,0x4(%ebx)
+    r->next = r->next->next;
+    152b:	8b 41 14             	mov    0x14(%ecx),%eax
+    152e:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+    1531:	eb c3                	jmp    14f6 <runfree+0x136>
+    1533:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    153a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001540 <runalloc>:
+
+// Take a run of n pages from the start of the first free run
+// long enough, which keeps the end of the heap free to trim.
+static struct page*
+runalloc(uint n)
+{
+    1540:	55                   	push   %ebp
+    1541:	89 e5                	mov    %esp,%ebp
+    1543:	57                   	push   %edi
+    1544:	56                   	push   %esi
+    1545:	89 c6                	mov    %eax,%esi
+    1547:	53                   	push   %ebx
+    1548:	83 ec 1c             	sub    $0x1c,%esp
+  struct page **pp, *r, *rest;
+
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+    154b:	8b 1d fc 26 00 00    	mov    0x26fc,%ebx
+    1551:	85 db                	test   %ebx,%ebx
+    1553:	74 4d                	je     15a2 <runalloc+0x62>
+    1555:	b9 fc 26 00 00       	mov    $0x26fc,%ecx
+    if(r->npages < n)
+    155a:	39 73 04             	cmp    %esi,0x4(%ebx)
+    155d:	72 39                	jb     1598 <runalloc+0x58>
+      continue;
+    if(r->npages == n){
+    155f:	0f 84 9b 00 00 00    	je     1600 <runalloc+0xc0>
+      *pp = r->next;
+    } else {
+      rest = (struct page*)((char*)r + n*PGSIZE);
+    1565:	89 f0                	mov    %esi,%eax
+      rest->kind = PFREE;
+    1567:	ba 03 00 00 00       	mov    $0x3,%edx
+      rest = (struct page*)((char*)r + n*PGSIZE);
+    156c:	c1 e0 0c             	shl    $0xc,%eax
+    156f:	01 d8                	add    %ebx,%eax
+      rest->kind = PFREE;
+    1571:	66 89 10             	mov    %dx,(%eax)
+      rest->npages = r->npages - n;
+    1574:	8b 53 04             	mov    0x4(%ebx),%edx
+    1577:	29 f2                	sub    %esi,%edx
+    1579:	89 50 04             	mov    %edx,0x4(%eax)
+      rest->next = r->next;
+    157c:	8b 53 14             	mov    0x14(%ebx),%edx
+    157f:	89 50 14             	mov    %edx,0x14(%eax)
+      *pp = rest;
+    1582:	89 01                	mov    %eax,(%ecx)
+      r->npages = n;
+    1584:	89 73 04             	mov    %esi,0x4(%ebx)
+    }
+    return r;
+  }
+  return morecore(n);
+}
+    1587:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    158a:	89 d8                	mov    %ebx,%eax
+    158c:	5b                   	pop    %ebx
+    158d:	5e                   	pop    %esi
+    158e:	5f                   	pop    %edi
+    158f:	5d                   	pop    %ebp
+    1590:	c3                   	ret
+    1591:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+    1598:	8d 4b 14             	lea    0x14(%ebx),%ecx
+    159b:	8b 5b 14             	mov    0x14(%ebx),%ebx
+    159e:	85 db                	test   %ebx,%ebx
+    15a0:	75 b8                	jne    155a <runalloc+0x1a>
+  m = n < MINCORE ? MINCORE : n;
+    15a2:	bf 08 00 00 00       	mov    $0x8,%edi
+    15a7:	39 fe                	cmp    %edi,%esi
+    15a9:	0f 43 fe             	cmovae %esi,%edi
+  brk = sbrk(0);
+    15ac:	83 ec 0c             	sub    $0xc,%esp
+    15af:	6a 00                	push   $0x0
+    15b1:	e8 35 fb ff ff       	call   10eb <sbrk>
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+    15b6:	89 fa                	mov    %edi,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+    15b8:	89 c3                	mov    %eax,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+    15ba:	c1 e2 0c             	shl    $0xc,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+    15bd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    15c0:	f7 db                	neg    %ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+    15c2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+    15c5:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+    15cb:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+    15ce:	89 04 24             	mov    %eax,(%esp)
+    15d1:	e8 15 fb ff ff       	call   10eb <sbrk>
+    15d6:	83 c4 10             	add    $0x10,%esp
+    15d9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    15dc:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    15df:	83 f8 ff             	cmp    $0xffffffff,%eax
+    15e2:	74 3e                	je     1622 <runalloc+0xe2>
+  r = (struct page*)(brk + pad);
+    15e4:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+    15e6:	01 da                	add    %ebx,%edx
+    15e8:	89 15 f8 26 00 00    	mov    %edx,0x26f8
+  if(m > n)
+    15ee:	39 fe                	cmp    %edi,%esi
+    15f0:	72 1e                	jb     1610 <runalloc+0xd0>
+  r->npages = n;
+    15f2:	89 73 04             	mov    %esi,0x4(%ebx)
+  return r;
+    15f5:	eb 90                	jmp    1587 <runalloc+0x47>
+    15f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15fe:	66 90                	xchg   %ax,%ax
+      *pp = r->next;
+    1600:	8b 43 14             	mov    0x14(%ebx),%eax
+    1603:	89 01                	mov    %eax,(%ecx)
+}
+    1605:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1608:	89 d8                	mov    %ebx,%eax
+    160a:	5b                   	pop    %ebx
+    160b:	5e                   	pop    %esi
+    160c:	5f                   	pop    %edi
+    160d:	5d                   	pop    %ebp
+    160e:	c3                   	ret
+    160f:	90                   	nop
+    runfree((struct page*)((char*)r + n*PGSIZE), m - n);
+    1610:	89 f0                	mov    %esi,%eax
+    1612:	29 f7                	sub    %esi,%edi
+    1614:	c1 e0 0c             	shl    $0xc,%eax
+    1617:	89 fa                	mov    %edi,%edx
+    1619:	01 d8                	add    %ebx,%eax
+    161b:	e8 a0 fd ff ff       	call   13c0 <runfree>
+    1620:	eb d0                	jmp    15f2 <runalloc+0xb2>
+    if(sbrk(pad + m*PGSIZE) == (char*)-1)
+    1622:	89 f7                	mov    %esi,%edi
+    1624:	83 ec 0c             	sub    $0xc,%esp
+    1627:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    162a:	c1 e7 0c             	shl    $0xc,%edi
+    162d:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+    1630:	50                   	push   %eax
+    1631:	e8 b5 fa ff ff       	call   10eb <sbrk>
+    1636:	83 c4 10             	add    $0x10,%esp
+    1639:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    163c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    163f:	74 0c                	je     164d <runalloc+0x10d>
+  r = (struct page*)(brk + pad);
+    1641:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+    1643:	01 df                	add    %ebx,%edi
+    1645:	89 3d f8 26 00 00    	mov    %edi,0x26f8
+  if(m > n)
+    164b:	eb a5                	jmp    15f2 <runalloc+0xb2>
+      return 0;
+    164d:	31 db                	xor    %ebx,%ebx
+    164f:	e9 33 ff ff ff       	jmp    1587 <runalloc+0x47>
+    1654:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    165b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    165f:	90                   	nop
+
+00001660 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+    1660:	55                   	push   %ebp
+    1661:	89 e5                	mov    %esp,%ebp
+    1663:	56                   	push   %esi
+    1664:	53                   	push   %ebx
+    1665:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  struct page *p;
+
+  if(ap == 0)
+    1668:	85 c9                	test   %ecx,%ecx
+    166a:	74 1c                	je     1688 <free+0x28>
+    return;
+  p = (struct page*)((uint)ap & ~(PGSIZE-1));
+    166c:	89 c8                	mov    %ecx,%eax
+    166e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  switch(p->kind){
+    1673:	0f b7 10             	movzwl (%eax),%edx
+    1676:	66 83 fa 02          	cmp    $0x2,%dx
+    167a:	74 14                	je     1690 <free+0x30>
+    167c:	66 83 fa 04          	cmp    $0x4,%dx
+    1680:	74 66                	je     16e8 <free+0x88>
+    1682:	66 83 fa 01          	cmp    $0x1,%dx
+    1686:	74 18                	je     16a0 <free+0x40>
+    break;
+  case PMAP:
+    munmap(p, p->npages*PGSIZE);
+    break;
+  }
+}
+    1688:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    168b:	5b                   	pop    %ebx
+    168c:	5e                   	pop    %esi
+    168d:	5d                   	pop    %ebp
+    168e:	c3                   	ret
+    168f:	90                   	nop
+    runfree(p, p->npages);
+    1690:	8b 50 04             	mov    0x4(%eax),%edx
+}
+    1693:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1696:	5b                   	pop    %ebx
+    1697:	5e                   	pop    %esi
+    1698:	5d                   	pop    %ebp
+    runfree(p, p->npages);
+    1699:	e9 22 fd ff ff       	jmp    13c0 <runfree>
+    169e:	66 90                	xchg   %ax,%ax
+  b->next = p->free;
+    16a0:	8b 50 0c             	mov    0xc(%eax),%edx
+    16a3:	89 11                	mov    %edx,(%ecx)
+  if(p->nfree++ == 0)
+    16a5:	8b 50 08             	mov    0x8(%eax),%edx
+  p->free = b;
+    16a8:	89 48 0c             	mov    %ecx,0xc(%eax)
+  if(p->nfree++ == 0)
+    16ab:	8d 5a 01             	lea    0x1(%edx),%ebx
+    16ae:	89 58 08             	mov    %ebx,0x8(%eax)
+    16b1:	85 d2                	test   %edx,%edx
+    16b3:	74 53                	je     1708 <free+0xa8>
+  if(p->nfree == nblocks(p->class)){
+    16b5:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+    16b9:	8d 4e 04             	lea    0x4(%esi),%ecx
+    16bc:	ba e0 0f 00 00       	mov    $0xfe0,%edx
+    16c1:	d3 fa                	sar    %cl,%edx
+  if(p->nfree == nblocks(p->class)){
+    16c3:	39 da                	cmp    %ebx,%edx
+    16c5:	75 c1                	jne    1688 <free+0x28>
+  if(p->prev)
+    16c7:	8b 48 18             	mov    0x18(%eax),%ecx
+    p->prev->next = p->next;
+    16ca:	8b 50 14             	mov    0x14(%eax),%edx
+  if(p->prev)
+    16cd:	85 c9                	test   %ecx,%ecx
+    16cf:	74 6f                	je     1740 <free+0xe0>
+    p->prev->next = p->next;
+    16d1:	89 51 14             	mov    %edx,0x14(%ecx)
+  if(p->next)
+    16d4:	85 d2                	test   %edx,%edx
+    16d6:	74 06                	je     16de <free+0x7e>
+    p->next->prev = p->prev;
+    16d8:	8b 48 18             	mov    0x18(%eax),%ecx
+    16db:	89 4a 18             	mov    %ecx,0x18(%edx)
+    runfree(p, 1);
+    16de:	ba 01 00 00 00       	mov    $0x1,%edx
+    16e3:	eb ae                	jmp    1693 <free+0x33>
+    16e5:	8d 76 00             	lea    0x0(%esi),%esi
+    munmap(p, p->npages*PGSIZE);
+    16e8:	8b 50 04             	mov    0x4(%eax),%edx
+    16eb:	83 ec 08             	sub    $0x8,%esp
+    16ee:	c1 e2 0c             	shl    $0xc,%edx
+    16f1:	52                   	push   %edx
+    16f2:	50                   	push   %eax
+    16f3:	e8 1b fa ff ff       	call   1113 <munmap>
+    break;
+    16f8:	83 c4 10             	add    $0x10,%esp
+}
+    16fb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    16fe:	5b                   	pop    %ebx
+    16ff:	5e                   	pop    %esi
+    1700:	5d                   	pop    %ebp
+    1701:	c3                   	ret
+    1702:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  p->next = partial[p->class];
+    1708:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  p->prev = 0;
+    170c:	c7 40 18 00 00 00 00 	movl   $0x0,0x18(%eax)
+  p->next = partial[p->class];
+    1713:	bb 01 00 00 00       	mov    $0x1,%ebx
+    1718:	8b 14 b5 00 27 00 00 	mov    0x2700(,%esi,4),%edx
+    171f:	89 50 14             	mov    %edx,0x14(%eax)
+  if(p->next)
+    1722:	85 d2                	test   %edx,%edx
+    1724:	74 0a                	je     1730 <free+0xd0>
+    p->next->prev = p;
+    1726:	89 42 18             	mov    %eax,0x18(%edx)
+  partial[p->class] = p;
+    1729:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  if(p->nfree == nblocks(p->class)){
+    172d:	8b 58 08             	mov    0x8(%eax),%ebx
+  partial[p->class] = p;
+    1730:	89 04 b5 00 27 00 00 	mov    %eax,0x2700(,%esi,4)
+}
+    1737:	eb 80                	jmp    16b9 <free+0x59>
+    1739:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+    1740:	89 14 b5 00 27 00 00 	mov    %edx,0x2700(,%esi,4)
+    1747:	eb 8b                	jmp    16d4 <free+0x74>
+    1749:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001750 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1750:	55                   	push   %ebp
+    1751:	89 e5                	mov    %esp,%ebp
+    1753:	56                   	push   %esi
+    1754:	53                   	push   %ebx
+    1755:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct page *p;
+  uint n;
+
+  if(nbytes <= MAXSMALL)
+    1758:	3d 00 04 00 00       	cmp    $0x400,%eax
+    175d:	76 71                	jbe    17d0 <malloc+0x80>
+    return smallalloc(sizeclass(nbytes));
+  if(nbytes > 0x7fffffff)
+    175f:	85 c0                	test   %eax,%eax
+    1761:	0f 88 d9 00 00 00    	js     1840 <malloc+0xf0>
+    return 0;
+  n = (nbytes + HDRSIZE + PGSIZE-1) / PGSIZE;
+    1767:	8d 90 1f 10 00 00    	lea    0x101f(%eax),%edx
+    176d:	89 d3                	mov    %edx,%ebx
+    176f:	c1 eb 0c             	shr    $0xc,%ebx
+  if(nbytes >= MAPMIN){
+    1772:	3d ff ff 00 00       	cmp    $0xffff,%eax
+    1777:	77 27                	ja     17a0 <malloc+0x50>
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    if(p == MAP_FAILED)
+      return 0;
+    p->kind = PMAP;
+  } else {
+    if((p = runalloc(n)) == 0)
+    1779:	89 d8                	mov    %ebx,%eax
+    177b:	e8 c0 fd ff ff       	call   1540 <runalloc>
+    1780:	85 c0                	test   %eax,%eax
+    1782:	0f 84 b8 00 00 00    	je     1840 <malloc+0xf0>
+      return 0;
+    p->kind = PRUN;
+    1788:	ba 02 00 00 00       	mov    $0x2,%edx
+    178d:	66 89 10             	mov    %dx,(%eax)
+  }
+  p->npages = n;
+    1790:	89 58 04             	mov    %ebx,0x4(%eax)
+  return (char*)p + HDRSIZE;
+    1793:	8d 58 20             	lea    0x20(%eax),%ebx
+}
+    1796:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1799:	89 d8                	mov    %ebx,%eax
+    179b:	5b                   	pop    %ebx
+    179c:	5e                   	pop    %esi
+    179d:	5d                   	pop    %ebp
+    179e:	c3                   	ret
+    179f:	90                   	nop
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    17a0:	83 ec 08             	sub    $0x8,%esp
+    17a3:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+    17a9:	6a 00                	push   $0x0
+    17ab:	6a ff                	push   $0xffffffff
+    17ad:	6a 22                	push   $0x22
+    17af:	6a 03                	push   $0x3
+    17b1:	52                   	push   %edx
+    17b2:	6a 00                	push   $0x0
+    17b4:	e8 52 f9 ff ff       	call   110b <mmap>
+    if(p == MAP_FAILED)
+    17b9:	83 c4 20             	add    $0x20,%esp
+    17bc:	83 f8 ff             	cmp    $0xffffffff,%eax
+    17bf:	74 7f                	je     1840 <malloc+0xf0>
+    p->kind = PMAP;
+    17c1:	b9 04 00 00 00       	mov    $0x4,%ecx
+    17c6:	66 89 08             	mov    %cx,(%eax)
+    17c9:	eb c5                	jmp    1790 <malloc+0x40>
+    17cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    17cf:	90                   	nop
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+    17d0:	83 f8 10             	cmp    $0x10,%eax
+    17d3:	0f 86 07 01 00 00    	jbe    18e0 <malloc+0x190>
+    17d9:	31 db                	xor    %ebx,%ebx
+    17db:	ba 10 00 00 00       	mov    $0x10,%edx
+    17e0:	83 c3 01             	add    $0x1,%ebx
+    17e3:	89 d6                	mov    %edx,%esi
+    17e5:	89 d9                	mov    %ebx,%ecx
+    17e7:	d3 e6                	shl    %cl,%esi
+    17e9:	39 c6                	cmp    %eax,%esi
+    17eb:	72 f3                	jb     17e0 <malloc+0x90>
+  if((p = partial[c]) == 0){
+    17ed:	8b 14 9d 00 27 00 00 	mov    0x2700(,%ebx,4),%edx
+    17f4:	85 d2                	test   %edx,%edx
+    17f6:	74 58                	je     1850 <malloc+0x100>
+  if((b = p->free) != 0){
+    17f8:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+    17fb:	8b 4a 08             	mov    0x8(%edx),%ecx
+  if((b = p->free) != 0){
+    17fe:	85 db                	test   %ebx,%ebx
+    1800:	0f 84 aa 00 00 00    	je     18b0 <malloc+0x160>
+    p->free = b->next;
+    1806:	8b 03                	mov    (%ebx),%eax
+    1808:	89 42 0c             	mov    %eax,0xc(%edx)
+  if(--p->nfree == 0)
+    180b:	83 e9 01             	sub    $0x1,%ecx
+    180e:	89 4a 08             	mov    %ecx,0x8(%edx)
+    1811:	75 83                	jne    1796 <malloc+0x46>
+  if(p->prev)
+    1813:	8b 4a 18             	mov    0x18(%edx),%ecx
+    p->prev->next = p->next;
+    1816:	8b 42 14             	mov    0x14(%edx),%eax
+  if(p->prev)
+    1819:	85 c9                	test   %ecx,%ecx
+    181b:	0f 84 cf 00 00 00    	je     18f0 <malloc+0x1a0>
+    p->prev->next = p->next;
+    1821:	89 41 14             	mov    %eax,0x14(%ecx)
+  if(p->next)
+    1824:	85 c0                	test   %eax,%eax
+    1826:	0f 84 6a ff ff ff    	je     1796 <malloc+0x46>
+    p->next->prev = p->prev;
+    182c:	8b 52 18             	mov    0x18(%edx),%edx
+    182f:	89 50 18             	mov    %edx,0x18(%eax)
+    1832:	e9 5f ff ff ff       	jmp    1796 <malloc+0x46>
+    1837:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    183e:	66 90                	xchg   %ax,%ax
+}
+    1840:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+    1843:	31 db                	xor    %ebx,%ebx
+}
+    1845:	89 d8                	mov    %ebx,%eax
+    1847:	5b                   	pop    %ebx
+    1848:	5e                   	pop    %esi
+    1849:	5d                   	pop    %ebp
+    184a:	c3                   	ret
+    184b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    184f:	90                   	nop
+    if((p = runalloc(1)) == 0)
+    1850:	b8 01 00 00 00       	mov    $0x1,%eax
+    1855:	e8 e6 fc ff ff       	call   1540 <runalloc>
+    185a:	89 c2                	mov    %eax,%edx
+    185c:	85 c0                	test   %eax,%eax
+    185e:	74 e0                	je     1840 <malloc+0xf0>
+    p->kind = PSMALL;
+    1860:	b8 01 00 00 00       	mov    $0x1,%eax
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+    1865:	8d 4b 04             	lea    0x4(%ebx),%ecx
+    p->class = c;
+    1868:	66 89 5a 02          	mov    %bx,0x2(%edx)
+    186c:	0f b7 db             	movzwl %bx,%ebx
+    p->kind = PSMALL;
+    186f:	66 89 02             	mov    %ax,(%edx)
+    p->fresh = (char*)p + HDRSIZE;
+    1872:	8d 42 20             	lea    0x20(%edx),%eax
+    1875:	89 42 10             	mov    %eax,0x10(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+    1878:	b8 e0 0f 00 00       	mov    $0xfe0,%eax
+    187d:	d3 f8                	sar    %cl,%eax
+    p->free = 0;
+    187f:	c7 42 0c 00 00 00 00 	movl   $0x0,0xc(%edx)
+    p->nfree = nblocks(c);
+    1886:	89 42 08             	mov    %eax,0x8(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+    1889:	89 c1                	mov    %eax,%ecx
+  p->next = partial[p->class];
+    188b:	8b 04 9d 00 27 00 00 	mov    0x2700(,%ebx,4),%eax
+  p->prev = 0;
+    1892:	c7 42 18 00 00 00 00 	movl   $0x0,0x18(%edx)
+  p->next = partial[p->class];
+    1899:	89 42 14             	mov    %eax,0x14(%edx)
+  if(p->next)
+    189c:	85 c0                	test   %eax,%eax
+    189e:	75 20                	jne    18c0 <malloc+0x170>
+  partial[p->class] = p;
+    18a0:	89 14 9d 00 27 00 00 	mov    %edx,0x2700(,%ebx,4)
+  if((b = p->free) != 0){
+    18a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18ae:	66 90                	xchg   %ax,%ax
+    b = (struct block*)p->fresh;
+    18b0:	8b 5a 10             	mov    0x10(%edx),%ebx
+    p->fresh += MINSMALL << c;
+    18b3:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+    18b6:	89 42 10             	mov    %eax,0x10(%edx)
+    18b9:	e9 4d ff ff ff       	jmp    180b <malloc+0xbb>
+    18be:	66 90                	xchg   %ax,%ax
+    p->next->prev = p;
+    18c0:	89 50 18             	mov    %edx,0x18(%eax)
+  partial[p->class] = p;
+    18c3:	0f b7 42 02          	movzwl 0x2(%edx),%eax
+  if((b = p->free) != 0){
+    18c7:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+    18ca:	8b 4a 08             	mov    0x8(%edx),%ecx
+  partial[p->class] = p;
+    18cd:	89 14 85 00 27 00 00 	mov    %edx,0x2700(,%eax,4)
+}
+    18d4:	e9 25 ff ff ff       	jmp    17fe <malloc+0xae>
+    18d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+    18e0:	be 10 00 00 00       	mov    $0x10,%esi
+    18e5:	31 db                	xor    %ebx,%ebx
+    18e7:	e9 01 ff ff ff       	jmp    17ed <malloc+0x9d>
+    18ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+    18f0:	0f b7 4a 02          	movzwl 0x2(%edx),%ecx
+    18f4:	89 04 8d 00 27 00 00 	mov    %eax,0x2700(,%ecx,4)
+    18fb:	e9 24 ff ff ff       	jmp    1824 <malloc+0xd4>
@@ -6,12 +6,17 @@
  * cont pause <cont name>
  * cont resume <cont name>
  * cont stop <cont name>
+ * cont limit <cont name> <KB, 0 for none>
+ * cont checkpoint <cont name> <file>
+ * cont restore <cont name> <file>
+ * cont zygote <cont name> <n, 0 for none> prog
  */
 
 #include "fcntl.h" 
 #include "path_util.h"
 #include "types.h"
 #include "user.h"
+#include "ckpt.h"
 #define MAX_ARG 10
 #define BUFFER_SIZE 1024
 #define MAX_PATH_LEN 512
@@ -162,7 +167,7 @@ void cont_start(int argc, char **argv) {
   printf(1, "Start container %s with cid %d succeeds.\n", cont_name, cid);
 
   // Get process and its argument, ready to execute.
-  char *args[MAX_ARG];
+  char *args[MAX_ARG + 1];
   int ii = 3; // index of argv
   int jj = 0; // index of args
   for (; ii < argc; ++ii, ++jj) {
@@ -172,16 +177,14 @@ void cont_start(int argc, char **argv) {
     memmove(args[jj], argv[ii], len);
     args[jj][len] = '\0';
   }
-  for (; ii < MAX_ARG; ++ii) {
-    args[ii] = 0;
+  for (; jj <= MAX_ARG; ++jj) {
+    args[jj] = 0;
   }
 
-  int pid = cfork(cid);
-  if (pid == 0) {
-    exec(args[0], args);
+  // Start the program straight in the container, without a copy of cont.
+  if (spawn(args[0], args, 0, 0, cid) < 0) {
     printf(2, "Execute process fails.\n");
     cstop(cont_name);
-    exit();
   }
 }
 
@@ -231,6 +234,66 @@ void cont_stop(int argc, char **argv) {
   }
 }
 
+void cont_limit(int argc, char **argv) {
+  if (argc != 4) {
+    usage("cont limit <cont name> <KB, 0 for none>\n");
+  }
+
+  char *name = argv[2];
+  if (climit(name, atoi(argv[3])) != 0) {
+    printf(2, "Container %s limit fails.\n", name);
+  } else {
+    printf(1, "Container %s memory limited to %s KB.\n", name, argv[3]);
+  }
+}
+
+// Save the processes of a paused container. The file must not exist yet.
+void cont_checkpoint(int argc, char **argv) {
+  if (argc != 4) {
+    usage("cont checkpoint <cont name> <file>\n");
+  }
+
+  char *name = argv[2];
+  int n = ccheckpoint(name, argv[3]);
+  if (n == CKPT_TOOBIG) {
+    printf(2, "Container %s checkpoint fails: the image would be larger than a file.\n", name);
+  } else if (n < 0) {
+    printf(2, "Container %s checkpoint fails.\n", name);
+  } else {
+    printf(1, "Container %s: %d processes saved to %s.\n", name, n, argv[3]);
+  }
+}
+
+// Start saved processes in a container; their memory is read on demand.
+void cont_restore(int argc, char **argv) {
+  if (argc != 4) {
+    usage("cont restore <cont name> <file>\n");
+  }
+
+  char *name = argv[2];
+  int n = crestore(name, argv[3]);
+  if (n < 0) {
+    printf(2, "Container %s restore fails.\n", name);
+  } else {
+    printf(1, "Container %s: %d processes restored from %s.\n", name, n, argv[3]);
+  }
+}
+
+// Keep n processes of prog loaded in a container for "cont start".
+void cont_zygote(int argc, char **argv) {
+  if (argc != 5) {
+    usage("cont zygote <cont name> <n, 0 for none> prog\n");
+  }
+
+  char *name = argv[2];
+  int n = czygote(name, argv[4], atoi(argv[3]));
+  if (n < 0) {
+    printf(2, "Container %s zygote pool fails.\n", name);
+  } else {
+    printf(1, "Container %s: %d zygotes of %s loaded.\n", name, n, argv[4]);
+  }
+}
+
 int main(int argc, char **argv) {
   if (argc < 2) {
     printf(2, "cont <cmd> [arg...]\n");
@@ -247,6 +310,14 @@ int main(int argc, char **argv) {
     cont_pause(argc, argv);
   } else if (strcmp(argv[1], "start") == 0) {
     cont_start(argc, argv);
+  } else if (strcmp(argv[1], "limit") == 0) {
+    cont_limit(argc, argv);
+  } else if (strcmp(argv[1], "checkpoint") == 0) {
+    cont_checkpoint(argc, argv);
+  } else if (strcmp(argv[1], "restore") == 0) {
+    cont_restore(argc, argv);
+  } else if (strcmp(argv[1], "zygote") == 0) {
+    cont_zygote(argc, argv);
   } else {
     printf(2, "Command option cannot be identified\n");
   }
@@ -10,12 +10,24 @@ struct spinlock;
 struct sleeplock;
 struct stat;
 struct superblock;
+struct vma;
+struct shm;
+struct memstats;
+struct readahead;
+struct procmem;
 
 // bio.c
 void            binit(void);
 struct buf*     bread(uint, uint);
 void            brelse(struct buf*);
+void            breadahead(uint, uint);
+void            bdone(struct buf*);
 void            bwrite(struct buf*);
+void            bstats(struct memstats*);
+
+// ckpt.c
+int             checkpoint(struct container*, struct file*);
+int             restore(struct container*, struct file*, struct proc*, struct proc**);
 
 // console.c
 void            consoleinit(void);
@@ -25,6 +37,8 @@ void            panic(char*) __attribute__((noreturn));
 
 // exec.c
 int             exec(char*, char**);
+int             execinto(struct proc*, char*, char**);
+int             execargs(struct proc*, char**);
 
 // file.c
 struct file*    filealloc(void);
@@ -41,6 +55,8 @@ int             dirlink(struct inode*, char*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
 struct inode*   ialloc(uint, short);
 struct inode*   idup(struct inode*);
+struct inode*   igetused(uint, uint);
+uchar*          itreemap(struct inode*);
 void            iinit(int dev);
 void            ilock(struct inode*);
 void            iput(struct inode*);
@@ -51,13 +67,20 @@ int             namecmp(const char*, const char*);
 struct inode*   namei(char*);
 struct inode*   nameiparent(char*, char*);
 int             readi(struct inode*, char*, uint, uint);
+void            ireadahead(struct inode*, struct readahead*, uint, uint);
 void            stati(struct inode*, struct stat*);
 int             writei(struct inode*, char*, uint, uint);
 
+// futex.c
+void            futexinit(void);
+int             futexwait(uint, uint);
+int             futexwake(uint, int);
+
 // ide.c
 void            ideinit(void);
 void            ideintr(void);
 void            iderw(struct buf*);
+void            iderwasync(struct buf*);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
@@ -69,6 +92,17 @@ char*           kalloc(void);
 void            kfree(char*);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
+void            kref(char*);
+int             krefcnt(char*);
+int             kcharge(char*, struct container*);
+char*           kzalloc(void);
+char*           kalloclarge(void);
+void            kfreelarge(char*);
+void            kidle(void);
+void            ksetlimit(struct container*, uint);
+void            kresetcont(struct container*);
+void            kmemstats(struct memstats*);
+void            kcount(uint*, uint*);
 
 // kbd.c
 void            kbdintr(void);
@@ -78,6 +112,7 @@ void            cmostime(struct rtcdate *r);
 int             lapicid(void);
 extern volatile uint*    lapic;
 void            lapiceoi(void);
+void            lapicipi(int, int);
 void            lapicinit(void);
 void            lapicstartap(uchar, uint);
 void            microdelay(int);
@@ -85,6 +120,9 @@ void            microdelay(int);
 // log.c
 void            initlog(int dev);
 void            log_write(struct buf*);
+void            log_freed(uint);
+int             log_reusable(uint);
+void            log_revoke(uint);
 void            begin_op();
 void            end_op();
 
@@ -92,10 +130,29 @@ void            end_op();
 extern int      ismp;
 void            mpinit(void);
 
+// pcache.c
+void            pcinit(void);
+char*           pcget(struct inode*, uint);
+void            pcinval(struct inode*);
+void            pcupdate(struct inode*, uint, char*, uint);
+void            pcread(struct inode*, char*, uint, uint);
+
 // picirq.c
 void            picenable(int);
 void            picinit(void);
 
+// pci.c
+uint            pciread(uint, uint);
+void            pciwrite(uint, uint, uint);
+int             pcifindclass(uint, uint);
+int             pcifindid(uint, uint);
+
+// virtio.c
+extern int      virtioirq;
+void            virtioinit(void);
+void            virtiointr(void);
+int             virtiorw(struct buf*);
+
 // pipe.c
 int             pipealloc(struct file**, struct file**);
 void            pipeclose(struct pipe*, int);
@@ -104,6 +161,13 @@ int             pipewrite(struct pipe*, char*, int);
 
 //PAGEBREAK: 16
 // proc.c
+struct proc*    allocproc(struct container*);
+int             ccheckpoint(char*, struct file*);
+int             crestore(char*, struct file*);
+int             czygote(char*, char*, int);
+int             memstats(struct memstats*, struct procmem*, int);
+void            kthread(char*, void (*)(void));
+pde_t*          setpgdir(struct proc*, pde_t*);
 int             ccreate(char*);
 int             cfork(int);
 int             cgetrootdir(char*);
@@ -112,13 +176,18 @@ int             cpause(char*);
 int             cresume(char*);
 int             cstart(char*);
 int             cstop(char*);
+int             climit(char*, int);
+char*           swapvictim(uint);
 void            cinit(void);
 int             cps(void);
+int             clone(uint, uint, uint);
 int             cpuid(void);
 void            exit(void);
 int             fork(struct container*);
+int             spawn(char*, char**, struct file**, int);
 int             growproc(int);
 struct proc*	  initprocess(struct container*);
+int             join(int, uint*);
 int             kill(int);
 struct cpu*     mycpu(void);
 struct proc*    myproc();
@@ -128,12 +197,33 @@ void            procdump(void);
 void            scheduler(void) __attribute__((noreturn));
 void            sched(void);
 void            setproc(struct proc*);
+int             wakeupn(void*, int);
+void            vmlock(struct proc*);
+void            vmunlock(struct proc*);
+void            vmlockrange(struct proc*, uint, uint);
+void            pinuvm(uint, uint);
+void            unpinuvm(void);
 void            sleep(void*, struct spinlock*);
 void            userinit(void);
 int             wait(void);
 void            wakeup(void*);
 void            yield(void);
 
+// shm.c
+void            shminit(void);
+struct shm*     shmget(char*, uint);
+struct shm*     shmanon(uint);
+void            shmdup(struct shm*);
+void            shmput(struct shm*);
+char*           shmpage(struct shm*, uint);
+
+// swap.c
+void            swapinit(int);
+int             swapout(void);
+void            swapread(uint, char*);
+void            swappeek(uint, char*);
+void            swapfree(uint);
+
 // swtch.S
 void            swtch(struct context**, struct context*);
 
@@ -164,6 +254,7 @@ char*           strncpy(char*, const char*, int);
 // syscall.c
 int             argint(int, int*);
 int             argptr(int, char**, int);
+int             argoutptr(int, char**, int);
 int             argstr(int, char**);
 int             fetchint(uint, int*);
 int             fetchstr(uint, char**);
@@ -188,16 +279,28 @@ void            seginit(void);
 void            kvmalloc(void);
 pde_t*          setupkvm(void);
 char*           uva2ka(pde_t*, char*);
-int             allocuvm(pde_t*, uint, uint);
+int             allocuvm(pde_t*, uint, uint, struct container*);
 int             deallocuvm(pde_t*, uint, uint);
 void            freevm(pde_t*);
 void            inituvm(pde_t*, char*, uint);
-int             loaduvm(pde_t*, char*, struct inode*, uint, uint);
-pde_t*          copyuvm(pde_t*, uint);
+pde_t*          copyuvm(pde_t*, uint, struct container*);
 void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
+int             pagefault(uint, uint);
+int             touchuvm(uint, uint, int);
+void            vmadup(struct vma*, struct vma*);
+void            vmaput(struct vma*);
+uint            uvaend(struct proc*, uint);
+char*           swapscan(pde_t*, uint, uint*, uint);
+int             mmapuvm(struct inode*, struct shm*, uint, uint, uint, int);
+int             munmapuvm(pde_t*, struct vma*, uint, uint);
+void            tlbshootdown(pde_t*);
+void            tlbflushintr(void);
+int             vmaflush(pde_t*, struct vma*);
+int             ckptuvm(struct proc*, uint, uint, struct file*);
+void            pgdirstats(pde_t*, uint*, uint*);
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
@@ -0,0 +1,1707 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  for(i = 1; i < argc; i++)
+  19:	83 fe 01             	cmp    $0x1,%esi
+  1c:	7e 47                	jle    65 <main+0x65>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  1e:	8b 47 04             	mov    0x4(%edi),%eax
+  21:	83 fe 02             	cmp    $0x2,%esi
+  24:	74 2a                	je     50 <main+0x50>
+  26:	bb 02 00 00 00       	mov    $0x2,%ebx
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  30:	68 90 0b 00 00       	push   $0xb90
+  35:	83 c3 01             	add    $0x1,%ebx
+  38:	50                   	push   %eax
+  39:	68 92 0b 00 00       	push   $0xb92
+  3e:	6a 01                	push   $0x1
+  40:	e8 5b 04 00 00       	call   4a0 <printf>
+  45:	8b 44 9f fc          	mov    -0x4(%edi,%ebx,4),%eax
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 f3                	cmp    %esi,%ebx
+  4e:	75 e0                	jne    30 <main+0x30>
+  50:	68 97 0b 00 00       	push   $0xb97
+  55:	50                   	push   %eax
+  56:	68 92 0b 00 00       	push   $0xb92
+  5b:	6a 01                	push   $0x1
+  5d:	e8 3e 04 00 00       	call   4a0 <printf>
+  62:	83 c4 10             	add    $0x10,%esp
+  exit();
+  65:	e8 89 02 00 00       	call   2f3 <exit>
+  6a:	66 90                	xchg   %ax,%ax
+  6c:	66 90                	xchg   %ax,%ax
+  6e:	66 90                	xchg   %ax,%ax
+
+00000070 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  70:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  71:	31 c0                	xor    %eax,%eax
+{
+  73:	89 e5                	mov    %esp,%ebp
+  75:	53                   	push   %ebx
+  76:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  79:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  80:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  84:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  87:	83 c0 01             	add    $0x1,%eax
+  8a:	84 d2                	test   %dl,%dl
+  8c:	75 f2                	jne    80 <strcpy+0x10>
+    ;
+  return os;
+}
+  8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  91:	89 c8                	mov    %ecx,%eax
+  93:	c9                   	leave
+  94:	c3                   	ret
+  95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  a0:	55                   	push   %ebp
+  a1:	89 e5                	mov    %esp,%ebp
+  a3:	53                   	push   %ebx
+  a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  aa:	0f b6 02             	movzbl (%edx),%eax
+  ad:	84 c0                	test   %al,%al
+  af:	75 17                	jne    c8 <strcmp+0x28>
+  b1:	eb 3a                	jmp    ed <strcmp+0x4d>
+  b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  b7:	90                   	nop
+  b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  bc:	83 c2 01             	add    $0x1,%edx
+  bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  c2:	84 c0                	test   %al,%al
+  c4:	74 1a                	je     e0 <strcmp+0x40>
+    p++, q++;
+  c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  c8:	0f b6 19             	movzbl (%ecx),%ebx
+  cb:	38 c3                	cmp    %al,%bl
+  cd:	74 e9                	je     b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  cf:	29 d8                	sub    %ebx,%eax
+}
+  d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  d4:	c9                   	leave
+  d5:	c3                   	ret
+  d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  e4:	31 c0                	xor    %eax,%eax
+  e6:	29 d8                	sub    %ebx,%eax
+}
+  e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  eb:	c9                   	leave
+  ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  ed:	0f b6 19             	movzbl (%ecx),%ebx
+  f0:	31 c0                	xor    %eax,%eax
+  f2:	eb db                	jmp    cf <strcmp+0x2f>
+  f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ff:	90                   	nop
+
+00000100 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 106:	80 3a 00             	cmpb   $0x0,(%edx)
+ 109:	74 15                	je     120 <strlen+0x20>
+ 10b:	31 c0                	xor    %eax,%eax
+ 10d:	8d 76 00             	lea    0x0(%esi),%esi
+ 110:	83 c0 01             	add    $0x1,%eax
+ 113:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 117:	89 c1                	mov    %eax,%ecx
+ 119:	75 f5                	jne    110 <strlen+0x10>
+    ;
+  return n;
+}
+ 11b:	89 c8                	mov    %ecx,%eax
+ 11d:	5d                   	pop    %ebp
+ 11e:	c3                   	ret
+ 11f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 120:	31 c9                	xor    %ecx,%ecx
+}
+ 122:	5d                   	pop    %ebp
+ 123:	89 c8                	mov    %ecx,%eax
+ 125:	c3                   	ret
+ 126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000130 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	57                   	push   %edi
+ 134:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 137:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 13a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 13d:	89 d7                	mov    %edx,%edi
+ 13f:	fc                   	cld
+ 140:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 142:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 145:	89 d0                	mov    %edx,%eax
+ 147:	c9                   	leave
+ 148:	c3                   	ret
+ 149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	8b 45 08             	mov    0x8(%ebp),%eax
+ 156:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 15a:	0f b6 10             	movzbl (%eax),%edx
+ 15d:	84 d2                	test   %dl,%dl
+ 15f:	75 12                	jne    173 <strchr+0x23>
+ 161:	eb 1d                	jmp    180 <strchr+0x30>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 16c:	83 c0 01             	add    $0x1,%eax
+ 16f:	84 d2                	test   %dl,%dl
+ 171:	74 0d                	je     180 <strchr+0x30>
+    if(*s == c)
+ 173:	38 d1                	cmp    %dl,%cl
+ 175:	75 f1                	jne    168 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 177:	5d                   	pop    %ebp
+ 178:	c3                   	ret
+ 179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 180:	31 c0                	xor    %eax,%eax
+}
+ 182:	5d                   	pop    %ebp
+ 183:	c3                   	ret
+ 184:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 18f:	90                   	nop
+
+00000190 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	57                   	push   %edi
+ 194:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 195:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 198:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 199:	31 db                	xor    %ebx,%ebx
+{
+ 19b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 19e:	eb 27                	jmp    1c7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1a0:	83 ec 04             	sub    $0x4,%esp
+ 1a3:	6a 01                	push   $0x1
+ 1a5:	56                   	push   %esi
+ 1a6:	6a 00                	push   $0x0
+ 1a8:	e8 5e 01 00 00       	call   30b <read>
+    if(cc < 1)
+ 1ad:	83 c4 10             	add    $0x10,%esp
+ 1b0:	85 c0                	test   %eax,%eax
+ 1b2:	7e 1d                	jle    1d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1bf:	3c 0a                	cmp    $0xa,%al
+ 1c1:	74 10                	je     1d3 <gets+0x43>
+ 1c3:	3c 0d                	cmp    $0xd,%al
+ 1c5:	74 0c                	je     1d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1c7:	89 df                	mov    %ebx,%edi
+ 1c9:	83 c3 01             	add    $0x1,%ebx
+ 1cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1cf:	7c cf                	jl     1a0 <gets+0x10>
+ 1d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1dd:	5b                   	pop    %ebx
+ 1de:	5e                   	pop    %esi
+ 1df:	5f                   	pop    %edi
+ 1e0:	5d                   	pop    %ebp
+ 1e1:	c3                   	ret
+ 1e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	56                   	push   %esi
+ 1f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1f5:	83 ec 08             	sub    $0x8,%esp
+ 1f8:	6a 00                	push   $0x0
+ 1fa:	ff 75 08             	push   0x8(%ebp)
+ 1fd:	e8 31 01 00 00       	call   333 <open>
+  if(fd < 0)
+ 202:	83 c4 10             	add    $0x10,%esp
+ 205:	85 c0                	test   %eax,%eax
+ 207:	78 27                	js     230 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 209:	83 ec 08             	sub    $0x8,%esp
+ 20c:	ff 75 0c             	push   0xc(%ebp)
+ 20f:	89 c3                	mov    %eax,%ebx
+ 211:	50                   	push   %eax
+ 212:	e8 34 01 00 00       	call   34b <fstat>
+  close(fd);
+ 217:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 21a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 21c:	e8 fa 00 00 00       	call   31b <close>
+  return r;
+ 221:	83 c4 10             	add    $0x10,%esp
+}
+ 224:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 227:	89 f0                	mov    %esi,%eax
+ 229:	5b                   	pop    %ebx
+ 22a:	5e                   	pop    %esi
+ 22b:	5d                   	pop    %ebp
+ 22c:	c3                   	ret
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 230:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 235:	eb ed                	jmp    224 <stat+0x34>
+ 237:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23e:	66 90                	xchg   %ax,%ax
+
+00000240 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	53                   	push   %ebx
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 247:	0f be 02             	movsbl (%edx),%eax
+ 24a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 24d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 250:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 255:	77 1e                	ja     275 <atoi+0x35>
+ 257:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 260:	83 c2 01             	add    $0x1,%edx
+ 263:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 266:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 26a:	0f be 02             	movsbl (%edx),%eax
+ 26d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 270:	80 fb 09             	cmp    $0x9,%bl
+ 273:	76 eb                	jbe    260 <atoi+0x20>
+  return n;
+}
+ 275:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 278:	89 c8                	mov    %ecx,%eax
+ 27a:	c9                   	leave
+ 27b:	c3                   	ret
+ 27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	57                   	push   %edi
+ 284:	56                   	push   %esi
+ 285:	8b 45 10             	mov    0x10(%ebp),%eax
+ 288:	8b 55 08             	mov    0x8(%ebp),%edx
+ 28b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 28e:	85 c0                	test   %eax,%eax
+ 290:	7e 13                	jle    2a5 <memmove+0x25>
+ 292:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 294:	89 d7                	mov    %edx,%edi
+ 296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2a1:	39 f8                	cmp    %edi,%eax
+ 2a3:	75 fb                	jne    2a0 <memmove+0x20>
+  return vdst;
+}
+ 2a5:	5e                   	pop    %esi
+ 2a6:	89 d0                	mov    %edx,%eax
+ 2a8:	5f                   	pop    %edi
+ 2a9:	5d                   	pop    %ebp
+ 2aa:	c3                   	ret
+
+000002ab <ccreate>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(ccreate)
+ 2ab:	b8 17 00 00 00       	mov    $0x17,%eax
+ 2b0:	cd 40                	int    $0x40
+ 2b2:	c3                   	ret
+
+000002b3 <cfork>:
+SYSCALL(cfork)
+ 2b3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 2b8:	cd 40                	int    $0x40
+ 2ba:	c3                   	ret
+
+000002bb <cgetrootdir>:
+SYSCALL(cgetrootdir)
+ 2bb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 2c0:	cd 40                	int    $0x40
+ 2c2:	c3                   	ret
+
+000002c3 <getcontrootdir>:
+SYSCALL(getcontrootdir)
+ 2c3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 2c8:	cd 40                	int    $0x40
+ 2ca:	c3                   	ret
+
+000002cb <cpause>:
+SYSCALL(cpause)
+ 2cb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 2d0:	cd 40                	int    $0x40
+ 2d2:	c3                   	ret
+
+000002d3 <cresume>:
+SYSCALL(cresume)
+ 2d3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 2d8:	cd 40                	int    $0x40
+ 2da:	c3                   	ret
+
+000002db <cstart>:
+SYSCALL(cstart)
+ 2db:	b8 18 00 00 00       	mov    $0x18,%eax
+ 2e0:	cd 40                	int    $0x40
+ 2e2:	c3                   	ret
+
+000002e3 <cstop>:
+SYSCALL(cstop)
+ 2e3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 2e8:	cd 40                	int    $0x40
+ 2ea:	c3                   	ret
+
+000002eb <fork>:
+SYSCALL(fork)
+ 2eb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2f0:	cd 40                	int    $0x40
+ 2f2:	c3                   	ret
+
+000002f3 <exit>:
+SYSCALL(exit)
+ 2f3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2f8:	cd 40                	int    $0x40
+ 2fa:	c3                   	ret
+
+000002fb <wait>:
+SYSCALL(wait)
+ 2fb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <pipe>:
+SYSCALL(pipe)
+ 303:	b8 04 00 00 00       	mov    $0x4,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <read>:
+SYSCALL(read)
+ 30b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <write>:
+SYSCALL(write)
+ 313:	b8 10 00 00 00       	mov    $0x10,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <close>:
+SYSCALL(close)
+ 31b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <kill>:
+SYSCALL(kill)
+ 323:	b8 06 00 00 00       	mov    $0x6,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <exec>:
+SYSCALL(exec)
+ 32b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <open>:
+SYSCALL(open)
+ 333:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <mknod>:
+SYSCALL(mknod)
+ 33b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <unlink>:
+SYSCALL(unlink)
+ 343:	b8 12 00 00 00       	mov    $0x12,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <fstat>:
+SYSCALL(fstat)
+ 34b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <link>:
+SYSCALL(link)
+ 353:	b8 13 00 00 00       	mov    $0x13,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <mkdir>:
+SYSCALL(mkdir)
+ 35b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <chdir>:
+SYSCALL(chdir)
+ 363:	b8 09 00 00 00       	mov    $0x9,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <dup>:
+SYSCALL(dup)
+ 36b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <getpid>:
+SYSCALL(getpid)
+ 373:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <sbrk>:
+SYSCALL(sbrk)
+ 37b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <sleep>:
+SYSCALL(sleep)
+ 383:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <uptime>:
+SYSCALL(uptime)
+ 38b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <cps>:
+SYSCALL(cps)
+ 393:	b8 16 00 00 00       	mov    $0x16,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <mmap>:
+SYSCALL(mmap)
+ 39b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <munmap>:
+SYSCALL(munmap)
+ 3a3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <shmget>:
+SYSCALL(shmget)
+ 3ab:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <climit>:
+SYSCALL(climit)
+ 3b3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <spawn>:
+SYSCALL(spawn)
+ 3bb:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <clone>:
+SYSCALL(clone)
+ 3c3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <join>:
+SYSCALL(join)
+ 3cb:	b8 25 00 00 00       	mov    $0x25,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <futex>:
+SYSCALL(futex)
+ 3d3:	b8 26 00 00 00       	mov    $0x26,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <ccheckpoint>:
+SYSCALL(ccheckpoint)
+ 3db:	b8 27 00 00 00       	mov    $0x27,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <crestore>:
+SYSCALL(crestore)
+ 3e3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <czygote>:
+SYSCALL(czygote)
+ 3eb:	b8 29 00 00 00       	mov    $0x29,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <memstats>:
+SYSCALL(memstats)
+ 3f3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+ 3fb:	66 90                	xchg   %ax,%ax
+ 3fd:	66 90                	xchg   %ax,%ax
+ 3ff:	90                   	nop
+
+00000400 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	56                   	push   %esi
+ 405:	53                   	push   %ebx
+ 406:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 408:	89 d1                	mov    %edx,%ecx
+{
+ 40a:	83 ec 3c             	sub    $0x3c,%esp
+ 40d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 410:	85 d2                	test   %edx,%edx
+ 412:	0f 89 80 00 00 00    	jns    498 <printint+0x98>
+ 418:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 41c:	74 7a                	je     498 <printint+0x98>
+    x = -xx;
+ 41e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 420:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 425:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 428:	31 f6                	xor    %esi,%esi
+ 42a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 430:	89 c8                	mov    %ecx,%eax
+ 432:	31 d2                	xor    %edx,%edx
+ 434:	89 f7                	mov    %esi,%edi
+ 436:	f7 f3                	div    %ebx
+ 438:	8d 76 01             	lea    0x1(%esi),%esi
+ 43b:	0f b6 92 f8 0b 00 00 	movzbl 0xbf8(%edx),%edx
+ 442:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 446:	89 ca                	mov    %ecx,%edx
+ 448:	89 c1                	mov    %eax,%ecx
+ 44a:	39 da                	cmp    %ebx,%edx
+ 44c:	73 e2                	jae    430 <printint+0x30>
+  if(neg)
+ 44e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 451:	85 c0                	test   %eax,%eax
+ 453:	74 07                	je     45c <printint+0x5c>
+    buf[i++] = '-';
+ 455:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 45a:	89 f7                	mov    %esi,%edi
+ 45c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 45f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 462:	01 df                	add    %ebx,%edi
+ 464:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 468:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 46b:	83 ec 04             	sub    $0x4,%esp
+ 46e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 471:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 474:	6a 01                	push   $0x1
+ 476:	50                   	push   %eax
+ 477:	56                   	push   %esi
+ 478:	e8 96 fe ff ff       	call   313 <write>
+  while(--i >= 0)
+ 47d:	89 f8                	mov    %edi,%eax
+ 47f:	83 c4 10             	add    $0x10,%esp
+ 482:	83 ef 01             	sub    $0x1,%edi
+ 485:	39 d8                	cmp    %ebx,%eax
+ 487:	75 df                	jne    468 <printint+0x68>
+}
+ 489:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 48c:	5b                   	pop    %ebx
+ 48d:	5e                   	pop    %esi
+ 48e:	5f                   	pop    %edi
+ 48f:	5d                   	pop    %ebp
+ 490:	c3                   	ret
+ 491:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 498:	31 c0                	xor    %eax,%eax
+ 49a:	eb 89                	jmp    425 <printint+0x25>
+ 49c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004a0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	57                   	push   %edi
+ 4a4:	56                   	push   %esi
+ 4a5:	53                   	push   %ebx
+ 4a6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 4a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 4ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 4af:	0f b6 1e             	movzbl (%esi),%ebx
+ 4b2:	83 c6 01             	add    $0x1,%esi
+ 4b5:	84 db                	test   %bl,%bl
+ 4b7:	74 67                	je     520 <printf+0x80>
+ 4b9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 4bc:	31 d2                	xor    %edx,%edx
+ 4be:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 4c1:	eb 34                	jmp    4f7 <printf+0x57>
+ 4c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4c7:	90                   	nop
+ 4c8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 4cb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 4d0:	83 f8 25             	cmp    $0x25,%eax
+ 4d3:	74 18                	je     4ed <printf+0x4d>
+  write(fd, &c, 1);
+ 4d5:	83 ec 04             	sub    $0x4,%esp
+ 4d8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 4db:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 4de:	6a 01                	push   $0x1
+ 4e0:	50                   	push   %eax
+ 4e1:	57                   	push   %edi
+ 4e2:	e8 2c fe ff ff       	call   313 <write>
+ 4e7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 4ea:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 4ed:	0f b6 1e             	movzbl (%esi),%ebx
+ 4f0:	83 c6 01             	add    $0x1,%esi
+ 4f3:	84 db                	test   %bl,%bl
+ 4f5:	74 29                	je     520 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 4f7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 4fa:	85 d2                	test   %edx,%edx
+ 4fc:	74 ca                	je     4c8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 4fe:	83 fa 25             	cmp    $0x25,%edx
+ 501:	75 ea                	jne    4ed <printf+0x4d>
+      if(c == 'd'){
+ 503:	83 f8 25             	cmp    $0x25,%eax
+ 506:	0f 84 24 01 00 00    	je     630 <printf+0x190>
+ 50c:	83 e8 63             	sub    $0x63,%eax
+ 50f:	83 f8 15             	cmp    $0x15,%eax
+ 512:	77 1c                	ja     530 <printf+0x90>
+ 514:	ff 24 85 a0 0b 00 00 	jmp    *0xba0(,%eax,4)
+ 51b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 51f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 520:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 523:	5b                   	pop    %ebx
+ 524:	5e                   	pop    %esi
+ 525:	5f                   	pop    %edi
+ 526:	5d                   	pop    %ebp
+ 527:	c3                   	ret
+ 528:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52f:	90                   	nop
+  write(fd, &c, 1);
+ 530:	83 ec 04             	sub    $0x4,%esp
+ 533:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 536:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 53a:	6a 01                	push   $0x1
+ 53c:	52                   	push   %edx
+ 53d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 540:	57                   	push   %edi
+ 541:	e8 cd fd ff ff       	call   313 <write>
+ 546:	83 c4 0c             	add    $0xc,%esp
+ 549:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 54c:	6a 01                	push   $0x1
+ 54e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 551:	52                   	push   %edx
+ 552:	57                   	push   %edi
+ 553:	e8 bb fd ff ff       	call   313 <write>
+        putc(fd, c);
+ 558:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 55b:	31 d2                	xor    %edx,%edx
+ 55d:	eb 8e                	jmp    4ed <printf+0x4d>
+ 55f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 560:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 563:	83 ec 0c             	sub    $0xc,%esp
+ 566:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 56b:	8b 13                	mov    (%ebx),%edx
+ 56d:	6a 00                	push   $0x0
+ 56f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 571:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 574:	e8 87 fe ff ff       	call   400 <printint>
+        ap++;
+ 579:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 57c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 57f:	31 d2                	xor    %edx,%edx
+ 581:	e9 67 ff ff ff       	jmp    4ed <printf+0x4d>
+ 586:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 590:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 593:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 595:	83 c0 04             	add    $0x4,%eax
+ 598:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 59b:	85 db                	test   %ebx,%ebx
+ 59d:	0f 84 9d 00 00 00    	je     640 <printf+0x1a0>
+        while(*s != 0){
+ 5a3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 5a6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 5a8:	84 c0                	test   %al,%al
+ 5aa:	0f 84 3d ff ff ff    	je     4ed <printf+0x4d>
+ 5b0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5b3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 5b6:	89 de                	mov    %ebx,%esi
+ 5b8:	89 d3                	mov    %edx,%ebx
+ 5ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 5c0:	83 ec 04             	sub    $0x4,%esp
+ 5c3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 5c6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 5c9:	6a 01                	push   $0x1
+ 5cb:	53                   	push   %ebx
+ 5cc:	57                   	push   %edi
+ 5cd:	e8 41 fd ff ff       	call   313 <write>
+        while(*s != 0){
+ 5d2:	0f b6 06             	movzbl (%esi),%eax
+ 5d5:	83 c4 10             	add    $0x10,%esp
+ 5d8:	84 c0                	test   %al,%al
+ 5da:	75 e4                	jne    5c0 <printf+0x120>
+      state = 0;
+ 5dc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 5df:	31 d2                	xor    %edx,%edx
+ 5e1:	e9 07 ff ff ff       	jmp    4ed <printf+0x4d>
+ 5e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ed:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 5f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5f3:	83 ec 0c             	sub    $0xc,%esp
+ 5f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5fb:	8b 13                	mov    (%ebx),%edx
+ 5fd:	6a 01                	push   $0x1
+ 5ff:	e9 6b ff ff ff       	jmp    56f <printf+0xcf>
+ 604:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 608:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 60b:	83 ec 04             	sub    $0x4,%esp
+ 60e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 611:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 613:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 616:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 619:	6a 01                	push   $0x1
+ 61b:	52                   	push   %edx
+ 61c:	57                   	push   %edi
+ 61d:	e8 f1 fc ff ff       	call   313 <write>
+        ap++;
+ 622:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 625:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 628:	31 d2                	xor    %edx,%edx
+ 62a:	e9 be fe ff ff       	jmp    4ed <printf+0x4d>
+ 62f:	90                   	nop
+  write(fd, &c, 1);
+ 630:	83 ec 04             	sub    $0x4,%esp
+ 633:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 636:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 639:	6a 01                	push   $0x1
+ 63b:	e9 11 ff ff ff       	jmp    551 <printf+0xb1>
+ 640:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 645:	bb 99 0b 00 00       	mov    $0xb99,%ebx
+ 64a:	e9 61 ff ff ff       	jmp    5b0 <printf+0x110>
+ 64f:	90                   	nop
+
+00000650 <runfree>:
+
+// Give the n pages at r back to the free runs, merging them with
+// adjacent runs, and shrink the heap if the end of it is free.
+static void
+runfree(struct page *r, uint n)
+{
+ 650:	55                   	push   %ebp
+  struct page **pp, *prev;
+
+  r->kind = PFREE;
+ 651:	b9 03 00 00 00       	mov    $0x3,%ecx
+{
+ 656:	89 e5                	mov    %esp,%ebp
+ 658:	57                   	push   %edi
+ 659:	56                   	push   %esi
+ 65a:	53                   	push   %ebx
+ 65b:	89 c3                	mov    %eax,%ebx
+ 65d:	83 ec 0c             	sub    $0xc,%esp
+  r->kind = PFREE;
+ 660:	66 89 08             	mov    %cx,(%eax)
+  r->npages = n;
+  prev = 0;
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 663:	8b 0d 14 0f 00 00    	mov    0xf14,%ecx
+  r->npages = n;
+ 669:	89 50 04             	mov    %edx,0x4(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 66c:	85 c9                	test   %ecx,%ecx
+ 66e:	0f 84 1f 01 00 00    	je     793 <runfree+0x143>
+ 674:	39 c1                	cmp    %eax,%ecx
+ 676:	0f 83 f7 00 00 00    	jae    773 <runfree+0x123>
+ 67c:	89 c8                	mov    %ecx,%eax
+ 67e:	eb 04                	jmp    684 <runfree+0x34>
+ 680:	39 d8                	cmp    %ebx,%eax
+ 682:	73 09                	jae    68d <runfree+0x3d>
+ 684:	89 c2                	mov    %eax,%edx
+ 686:	8b 40 14             	mov    0x14(%eax),%eax
+ 689:	85 c0                	test   %eax,%eax
+ 68b:	75 f3                	jne    680 <runfree+0x30>
+    prev = *pp;
+  r->next = *pp;
+ 68d:	89 43 14             	mov    %eax,0x14(%ebx)
+  *pp = r;
+ 690:	89 5a 14             	mov    %ebx,0x14(%edx)
+
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 693:	8b 43 14             	mov    0x14(%ebx),%eax
+ 696:	85 c0                	test   %eax,%eax
+ 698:	74 12                	je     6ac <runfree+0x5c>
+ 69a:	8b 7b 04             	mov    0x4(%ebx),%edi
+ 69d:	89 fe                	mov    %edi,%esi
+ 69f:	c1 e6 0c             	shl    $0xc,%esi
+ 6a2:	01 de                	add    %ebx,%esi
+ 6a4:	39 f0                	cmp    %esi,%eax
+ 6a6:	0f 84 a4 00 00 00    	je     750 <runfree+0x100>
+    r->npages += r->next->npages;
+    r->next = r->next->next;
+  }
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 6ac:	8b 72 04             	mov    0x4(%edx),%esi
+ 6af:	89 f0                	mov    %esi,%eax
+ 6b1:	c1 e0 0c             	shl    $0xc,%eax
+ 6b4:	01 d0                	add    %edx,%eax
+ 6b6:	39 c3                	cmp    %eax,%ebx
+ 6b8:	74 16                	je     6d0 <runfree+0x80>
+    pp = &runs;
+    while(*pp != r)
+      pp = &(*pp)->next;
+  }
+
+  if(r->next == 0 && r->npages >= TRIM &&
+ 6ba:	8b 43 14             	mov    0x14(%ebx),%eax
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 6bd:	8d 72 14             	lea    0x14(%edx),%esi
+  if(r->next == 0 && r->npages >= TRIM &&
+ 6c0:	85 c0                	test   %eax,%eax
+ 6c2:	74 3c                	je     700 <runfree+0xb0>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+    *pp = 0;
+    sbrk(-(int)(r->npages*PGSIZE));
+    heapend = (char*)r;
+  }
+}
+ 6c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6c7:	5b                   	pop    %ebx
+ 6c8:	5e                   	pop    %esi
+ 6c9:	5f                   	pop    %edi
+ 6ca:	5d                   	pop    %ebp
+ 6cb:	c3                   	ret
+ 6cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    prev->npages += r->npages;
+ 6d0:	03 73 04             	add    0x4(%ebx),%esi
+ 6d3:	89 72 04             	mov    %esi,0x4(%edx)
+    prev->next = r->next;
+ 6d6:	8b 43 14             	mov    0x14(%ebx),%eax
+ 6d9:	89 42 14             	mov    %eax,0x14(%edx)
+    while(*pp != r)
+ 6dc:	39 d1                	cmp    %edx,%ecx
+ 6de:	0f 84 c5 00 00 00    	je     7a9 <runfree+0x159>
+ 6e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      pp = &(*pp)->next;
+ 6e8:	89 cb                	mov    %ecx,%ebx
+ 6ea:	8b 49 14             	mov    0x14(%ecx),%ecx
+    while(*pp != r)
+ 6ed:	39 d1                	cmp    %edx,%ecx
+ 6ef:	75 f7                	jne    6e8 <runfree+0x98>
+      pp = &(*pp)->next;
+ 6f1:	8d 73 14             	lea    0x14(%ebx),%esi
+ 6f4:	89 cb                	mov    %ecx,%ebx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 6f6:	85 c0                	test   %eax,%eax
+ 6f8:	75 ca                	jne    6c4 <runfree+0x74>
+ 6fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 700:	8b 53 04             	mov    0x4(%ebx),%edx
+ 703:	83 fa 1f             	cmp    $0x1f,%edx
+ 706:	76 bc                	jbe    6c4 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 708:	c1 e2 0c             	shl    $0xc,%edx
+ 70b:	01 da                	add    %ebx,%edx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 70d:	39 15 10 0f 00 00    	cmp    %edx,0xf10
+ 713:	75 af                	jne    6c4 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 715:	83 ec 0c             	sub    $0xc,%esp
+ 718:	6a 00                	push   $0x0
+ 71a:	e8 5c fc ff ff       	call   37b <sbrk>
+ 71f:	83 c4 10             	add    $0x10,%esp
+ 722:	39 05 10 0f 00 00    	cmp    %eax,0xf10
+ 728:	75 9a                	jne    6c4 <runfree+0x74>
+    *pp = 0;
+ 72a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    sbrk(-(int)(r->npages*PGSIZE));
+ 730:	8b 43 04             	mov    0x4(%ebx),%eax
+ 733:	83 ec 0c             	sub    $0xc,%esp
+ 736:	c1 e0 0c             	shl    $0xc,%eax
+ 739:	f7 d8                	neg    %eax
+ 73b:	50                   	push   %eax
+ 73c:	e8 3a fc ff ff       	call   37b <sbrk>
+    heapend = (char*)r;
+ 741:	89 1d 10 0f 00 00    	mov    %ebx,0xf10
+ 747:	83 c4 10             	add    $0x10,%esp
+}
+ 74a:	e9 75 ff ff ff       	jmp    6c4 <runfree+0x74>
+ 74f:	90                   	nop
+    r->npages += r->next->npages;
+ 750:	03 78 04             	add    0x4(%eax),%edi
+ 753:	89 7b 04             	mov    %edi,0x4(%ebx)
+    r->next = r->next->next;
+ 756:	8b 40 14             	mov    0x14(%eax),%eax
+ 759:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 75c:	8b 72 04             	mov    0x4(%edx),%esi
+ 75f:	89 f0                	mov    %esi,%eax
+ 761:	c1 e0 0c             	shl    $0xc,%eax
+ 764:	01 d0                	add    %edx,%eax
+ 766:	39 c3                	cmp    %eax,%ebx
+ 768:	0f 85 4c ff ff ff    	jne    6ba <runfree+0x6a>
+ 76e:	e9 5d ff ff ff       	jmp    6d0 <runfree+0x80>
+  r->next = *pp;
+ 773:	89 48 14             	mov    %ecx,0x14(%eax)
+  *pp = r;
+ 776:	a3 14 0f 00 00       	mov    %eax,0xf14
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 77b:	89 d0                	mov    %edx,%eax
+ 77d:	c1 e0 0c             	shl    $0xc,%eax
+ 780:	01 d8                	add    %ebx,%eax
+ 782:	39 c1                	cmp    %eax,%ecx
+ 784:	74 2f                	je     7b5 <runfree+0x165>
+  if(r->next == 0 && r->npages >= TRIM &&
+ 786:	8b 43 14             	mov    0x14(%ebx),%eax
+ 789:	be 14 0f 00 00       	mov    $0xf14,%esi
+ 78e:	e9 2d ff ff ff       	jmp    6c0 <runfree+0x70>
+  r->next = *pp;
+ 793:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 79a:	be 14 0f 00 00       	mov    $0xf14,%esi
+  *pp = r;
+ 79f:	a3 14 0f 00 00       	mov    %eax,0xf14
+  if(r->next == 0 && r->npages >= TRIM &&
+ 7a4:	e9 5a ff ff ff       	jmp    703 <runfree+0xb3>
+    while(*pp != r)
+ 7a9:	89 cb                	mov    %ecx,%ebx
+    pp = &runs;
+ 7ab:	be 14 0f 00 00       	mov    $0xf14,%esi
+ 7b0:	e9 0b ff ff ff       	jmp    6c0 <runfree+0x70>
+    r->npages += r->next->npages;
+ 7b5:	03 51 04             	add    0x4(%ecx),%edx
+ 7b8:	89 53 04             	mov    %edx,0x4(%ebx)
+    r->next = r->next->next;
+ 7bb:	8b 41 14             	mov    0x14(%ecx),%eax
+ 7be:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 7c1:	eb c3                	jmp    786 <runfree+0x136>
+ 7c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000007d0 <runalloc>:
+
+// Take a run of n pages from the start of the first free run
+// long enough, which keeps the end of the heap free to trim.
+static struct page*
+runalloc(uint n)
+{
+ 7d0:	55                   	push   %ebp
+ 7d1:	89 e5                	mov    %esp,%ebp
+ 7d3:	57                   	push   %edi
+ 7d4:	56                   	push   %esi
+ 7d5:	89 c6                	mov    %eax,%esi
+ 7d7:	53                   	push   %ebx
+ 7d8:	83 ec 1c             	sub    $0x1c,%esp
+  struct page **pp, *r, *rest;
+
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ 7db:	8b 1d 14 0f 00 00    	mov    0xf14,%ebx
+ 7e1:	85 db                	test   %ebx,%ebx
+ 7e3:	74 4d                	je     832 <runalloc+0x62>
+ 7e5:	b9 14 0f 00 00       	mov    $0xf14,%ecx
+    if(r->npages < n)
+ 7ea:	39 73 04             	cmp    %esi,0x4(%ebx)
+ 7ed:	72 39                	jb     828 <runalloc+0x58>
+      continue;
+    if(r->npages == n){
+ 7ef:	0f 84 9b 00 00 00    	je     890 <runalloc+0xc0>
+      *pp = r->next;
+    } else {
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ 7f5:	89 f0                	mov    %esi,%eax
+      rest->kind = PFREE;
+ 7f7:	ba 03 00 00 00       	mov    $0x3,%edx
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ 7fc:	c1 e0 0c             	shl    $0xc,%eax
+ 7ff:	01 d8                	add    %ebx,%eax
+      rest->kind = PFREE;
+ 801:	66 89 10             	mov    %dx,(%eax)
+      rest->npages = r->npages - n;
+ 804:	8b 53 04             	mov    0x4(%ebx),%edx
+ 807:	29 f2                	sub    %esi,%edx
+ 809:	89 50 04             	mov    %edx,0x4(%eax)
+      rest->next = r->next;
+ 80c:	8b 53 14             	mov    0x14(%ebx),%edx
+ 80f:	89 50 14             	mov    %edx,0x14(%eax)
+      *pp = rest;
+ 812:	89 01                	mov    %eax,(%ecx)
+      r->npages = n;
+ 814:	89 73 04             	mov    %esi,0x4(%ebx)
+    }
+    return r;
+  }
+  return morecore(n);
+}
+ 817:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 81a:	89 d8                	mov    %ebx,%eax
+ 81c:	5b                   	pop    %ebx
+ 81d:	5e                   	pop    %esi
+ 81e:	5f                   	pop    %edi
+ 81f:	5d                   	pop    %ebp
+ 820:	c3                   	ret
+ 821:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ 828:	8d 4b 14             	lea    0x14(%ebx),%ecx
+ 82b:	8b 5b 14             	mov    0x14(%ebx),%ebx
+ 82e:	85 db                	test   %ebx,%ebx
+ 830:	75 b8                	jne    7ea <runalloc+0x1a>
+  m = n < MINCORE ? MINCORE : n;
+ 832:	bf 08 00 00 00       	mov    $0x8,%edi
+ 837:	39 fe                	cmp    %edi,%esi
+ 839:	0f 43 fe             	cmovae %esi,%edi
+  brk = sbrk(0);
+ 83c:	83 ec 0c             	sub    $0xc,%esp
+ 83f:	6a 00                	push   $0x0
+ 841:	e8 35 fb ff ff       	call   37b <sbrk>
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 846:	89 fa                	mov    %edi,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 848:	89 c3                	mov    %eax,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 84a:	c1 e2 0c             	shl    $0xc,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 84d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 850:	f7 db                	neg    %ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 852:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 855:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 85b:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+ 85e:	89 04 24             	mov    %eax,(%esp)
+ 861:	e8 15 fb ff ff       	call   37b <sbrk>
+ 866:	83 c4 10             	add    $0x10,%esp
+ 869:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 86c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 86f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 872:	74 3e                	je     8b2 <runalloc+0xe2>
+  r = (struct page*)(brk + pad);
+ 874:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ 876:	01 da                	add    %ebx,%edx
+ 878:	89 15 10 0f 00 00    	mov    %edx,0xf10
+  if(m > n)
+ 87e:	39 fe                	cmp    %edi,%esi
+ 880:	72 1e                	jb     8a0 <runalloc+0xd0>
+  r->npages = n;
+ 882:	89 73 04             	mov    %esi,0x4(%ebx)
+  return r;
+ 885:	eb 90                	jmp    817 <runalloc+0x47>
+ 887:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 88e:	66 90                	xchg   %ax,%ax
+      *pp = r->next;
+ 890:	8b 43 14             	mov    0x14(%ebx),%eax
+ 893:	89 01                	mov    %eax,(%ecx)
+}
+ 895:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 898:	89 d8                	mov    %ebx,%eax
+ 89a:	5b                   	pop    %ebx
+ 89b:	5e                   	pop    %esi
+ 89c:	5f                   	pop    %edi
+ 89d:	5d                   	pop    %ebp
+ 89e:	c3                   	ret
+ 89f:	90                   	nop
+    runfree((struct page*)((char*)r + n*PGSIZE), m - n);
+ 8a0:	89 f0                	mov    %esi,%eax
+ 8a2:	29 f7                	sub    %esi,%edi
+ 8a4:	c1 e0 0c             	shl    $0xc,%eax
+ 8a7:	89 fa                	mov    %edi,%edx
+ 8a9:	01 d8                	add    %ebx,%eax
+ 8ab:	e8 a0 fd ff ff       	call   650 <runfree>
+ 8b0:	eb d0                	jmp    882 <runalloc+0xb2>
+    if(sbrk(pad + m*PGSIZE) == (char*)-1)
+ 8b2:	89 f7                	mov    %esi,%edi
+ 8b4:	83 ec 0c             	sub    $0xc,%esp
+ 8b7:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 8ba:	c1 e7 0c             	shl    $0xc,%edi
+ 8bd:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+ 8c0:	50                   	push   %eax
+ 8c1:	e8 b5 fa ff ff       	call   37b <sbrk>
+ 8c6:	83 c4 10             	add    $0x10,%esp
+ 8c9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 8cc:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8cf:	74 0c                	je     8dd <runalloc+0x10d>
+  r = (struct page*)(brk + pad);
+ 8d1:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ 8d3:	01 df                	add    %ebx,%edi
+ 8d5:	89 3d 10 0f 00 00    	mov    %edi,0xf10
+  if(m > n)
+ 8db:	eb a5                	jmp    882 <runalloc+0xb2>
+      return 0;
+ 8dd:	31 db                	xor    %ebx,%ebx
+ 8df:	e9 33 ff ff ff       	jmp    817 <runalloc+0x47>
+ 8e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8ef:	90                   	nop
+
+000008f0 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+ 8f0:	55                   	push   %ebp
+ 8f1:	89 e5                	mov    %esp,%ebp
+ 8f3:	56                   	push   %esi
+ 8f4:	53                   	push   %ebx
+ 8f5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  struct page *p;
+
+  if(ap == 0)
+ 8f8:	85 c9                	test   %ecx,%ecx
+ 8fa:	74 1c                	je     918 <free+0x28>
+    return;
+  p = (struct page*)((uint)ap & ~(PGSIZE-1));
+ 8fc:	89 c8                	mov    %ecx,%eax
+ 8fe:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  switch(p->kind){
+ 903:	0f b7 10             	movzwl (%eax),%edx
+ 906:	66 83 fa 02          	cmp    $0x2,%dx
+ 90a:	74 14                	je     920 <free+0x30>
+ 90c:	66 83 fa 04          	cmp    $0x4,%dx
+ 910:	74 66                	je     978 <free+0x88>
+ 912:	66 83 fa 01          	cmp    $0x1,%dx
+ 916:	74 18                	je     930 <free+0x40>
+    break;
+  case PMAP:
+    munmap(p, p->npages*PGSIZE);
+    break;
+  }
+}
+ 918:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 91b:	5b                   	pop    %ebx
+ 91c:	5e                   	pop    %esi
+ 91d:	5d                   	pop    %ebp
+ 91e:	c3                   	ret
+ 91f:	90                   	nop
+    runfree(p, p->npages);
+ 920:	8b 50 04             	mov    0x4(%eax),%edx
+}
+ 923:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 926:	5b                   	pop    %ebx
+ 927:	5e                   	pop    %esi
+ 928:	5d                   	pop    %ebp
+    runfree(p, p->npages);
+ 929:	e9 22 fd ff ff       	jmp    650 <runfree>
+ 92e:	66 90                	xchg   %ax,%ax
+  b->next = p->free;
+ 930:	8b 50 0c             	mov    0xc(%eax),%edx
+ 933:	89 11                	mov    %edx,(%ecx)
+  if(p->nfree++ == 0)
+ 935:	8b 50 08             	mov    0x8(%eax),%edx
+  p->free = b;
+ 938:	89 48 0c             	mov    %ecx,0xc(%eax)
+  if(p->nfree++ == 0)
+ 93b:	8d 5a 01             	lea    0x1(%edx),%ebx
+ 93e:	89 58 08             	mov    %ebx,0x8(%eax)
+ 941:	85 d2                	test   %edx,%edx
+ 943:	74 53                	je     998 <free+0xa8>
+  if(p->nfree == nblocks(p->class)){
+ 945:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ 949:	8d 4e 04             	lea    0x4(%esi),%ecx
+ 94c:	ba e0 0f 00 00       	mov    $0xfe0,%edx
+ 951:	d3 fa                	sar    %cl,%edx
+  if(p->nfree == nblocks(p->class)){
+ 953:	39 da                	cmp    %ebx,%edx
+ 955:	75 c1                	jne    918 <free+0x28>
+  if(p->prev)
+ 957:	8b 48 18             	mov    0x18(%eax),%ecx
+    p->prev->next = p->next;
+ 95a:	8b 50 14             	mov    0x14(%eax),%edx
+  if(p->prev)
+ 95d:	85 c9                	test   %ecx,%ecx
+ 95f:	74 6f                	je     9d0 <free+0xe0>
+    p->prev->next = p->next;
+ 961:	89 51 14             	mov    %edx,0x14(%ecx)
+  if(p->next)
+ 964:	85 d2                	test   %edx,%edx
+ 966:	74 06                	je     96e <free+0x7e>
+    p->next->prev = p->prev;
+ 968:	8b 48 18             	mov    0x18(%eax),%ecx
+ 96b:	89 4a 18             	mov    %ecx,0x18(%edx)
+    runfree(p, 1);
+ 96e:	ba 01 00 00 00       	mov    $0x1,%edx
+ 973:	eb ae                	jmp    923 <free+0x33>
+ 975:	8d 76 00             	lea    0x0(%esi),%esi
+    munmap(p, p->npages*PGSIZE);
+ 978:	8b 50 04             	mov    0x4(%eax),%edx
+ 97b:	83 ec 08             	sub    $0x8,%esp
+ 97e:	c1 e2 0c             	shl    $0xc,%edx
+ 981:	52                   	push   %edx
+ 982:	50                   	push   %eax
+ 983:	e8 1b fa ff ff       	call   3a3 <munmap>
+    break;
+ 988:	83 c4 10             	add    $0x10,%esp
+}
+ 98b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 98e:	5b                   	pop    %ebx
+ 98f:	5e                   	pop    %esi
+ 990:	5d                   	pop    %ebp
+ 991:	c3                   	ret
+ 992:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  p->next = partial[p->class];
+ 998:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  p->prev = 0;
+ 99c:	c7 40 18 00 00 00 00 	movl   $0x0,0x18(%eax)
+  p->next = partial[p->class];
+ 9a3:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 9a8:	8b 14 b5 18 0f 00 00 	mov    0xf18(,%esi,4),%edx
+ 9af:	89 50 14             	mov    %edx,0x14(%eax)
+  if(p->next)
+ 9b2:	85 d2                	test   %edx,%edx
+ 9b4:	74 0a                	je     9c0 <free+0xd0>
+    p->next->prev = p;
+ 9b6:	89 42 18             	mov    %eax,0x18(%edx)
+  partial[p->class] = p;
+ 9b9:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  if(p->nfree == nblocks(p->class)){
+ 9bd:	8b 58 08             	mov    0x8(%eax),%ebx
+  partial[p->class] = p;
+ 9c0:	89 04 b5 18 0f 00 00 	mov    %eax,0xf18(,%esi,4)
+}
+ 9c7:	eb 80                	jmp    949 <free+0x59>
+ 9c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ 9d0:	89 14 b5 18 0f 00 00 	mov    %edx,0xf18(,%esi,4)
+ 9d7:	eb 8b                	jmp    964 <free+0x74>
+ 9d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000009e0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 9e0:	55                   	push   %ebp
+ 9e1:	89 e5                	mov    %esp,%ebp
+ 9e3:	56                   	push   %esi
+ 9e4:	53                   	push   %ebx
+ 9e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct page *p;
+  uint n;
+
+  if(nbytes <= MAXSMALL)
+ 9e8:	3d 00 04 00 00       	cmp    $0x400,%eax
+ 9ed:	76 71                	jbe    a60 <malloc+0x80>
+    return smallalloc(sizeclass(nbytes));
+  if(nbytes > 0x7fffffff)
+ 9ef:	85 c0                	test   %eax,%eax
+ 9f1:	0f 88 d9 00 00 00    	js     ad0 <malloc+0xf0>
+    return 0;
+  n = (nbytes + HDRSIZE + PGSIZE-1) / PGSIZE;
+ 9f7:	8d 90 1f 10 00 00    	lea    0x101f(%eax),%edx
+ 9fd:	89 d3                	mov    %edx,%ebx
+ 9ff:	c1 eb 0c             	shr    $0xc,%ebx
+  if(nbytes >= MAPMIN){
+ a02:	3d ff ff 00 00       	cmp    $0xffff,%eax
+ a07:	77 27                	ja     a30 <malloc+0x50>
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    if(p == MAP_FAILED)
+      return 0;
+    p->kind = PMAP;
+  } else {
+    if((p = runalloc(n)) == 0)
+ a09:	89 d8                	mov    %ebx,%eax
+ a0b:	e8 c0 fd ff ff       	call   7d0 <runalloc>
+ a10:	85 c0                	test   %eax,%eax
+ a12:	0f 84 b8 00 00 00    	je     ad0 <malloc+0xf0>
+      return 0;
+    p->kind = PRUN;
+ a18:	ba 02 00 00 00       	mov    $0x2,%edx
+ a1d:	66 89 10             	mov    %dx,(%eax)
+  }
+  p->npages = n;
+ a20:	89 58 04             	mov    %ebx,0x4(%eax)
+  return (char*)p + HDRSIZE;
+ a23:	8d 58 20             	lea    0x20(%eax),%ebx
+}
+ a26:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a29:	89 d8                	mov    %ebx,%eax
+ a2b:	5b                   	pop    %ebx
+ a2c:	5e                   	pop    %esi
+ a2d:	5d                   	pop    %ebp
+ a2e:	c3                   	ret
+ a2f:	90                   	nop
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+ a30:	83 ec 08             	sub    $0x8,%esp
+ a33:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+ a39:	6a 00                	push   $0x0
+ a3b:	6a ff                	push   $0xffffffff
+ a3d:	6a 22                	push   $0x22
+ a3f:	6a 03                	push   $0x3
+ a41:	52                   	push   %edx
+ a42:	6a 00                	push   $0x0
+ a44:	e8 52 f9 ff ff       	call   39b <mmap>
+    if(p == MAP_FAILED)
+ a49:	83 c4 20             	add    $0x20,%esp
+ a4c:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a4f:	74 7f                	je     ad0 <malloc+0xf0>
+    p->kind = PMAP;
+ a51:	b9 04 00 00 00       	mov    $0x4,%ecx
+ a56:	66 89 08             	mov    %cx,(%eax)
+ a59:	eb c5                	jmp    a20 <malloc+0x40>
+ a5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a5f:	90                   	nop
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ a60:	83 f8 10             	cmp    $0x10,%eax
+ a63:	0f 86 07 01 00 00    	jbe    b70 <malloc+0x190>
+ a69:	31 db                	xor    %ebx,%ebx
+ a6b:	ba 10 00 00 00       	mov    $0x10,%edx
+ a70:	83 c3 01             	add    $0x1,%ebx
+ a73:	89 d6                	mov    %edx,%esi
+ a75:	89 d9                	mov    %ebx,%ecx
+ a77:	d3 e6                	shl    %cl,%esi
+ a79:	39 c6                	cmp    %eax,%esi
+ a7b:	72 f3                	jb     a70 <malloc+0x90>
+  if((p = partial[c]) == 0){
+ a7d:	8b 14 9d 18 0f 00 00 	mov    0xf18(,%ebx,4),%edx
+ a84:	85 d2                	test   %edx,%edx
+ a86:	74 58                	je     ae0 <malloc+0x100>
+  if((b = p->free) != 0){
+ a88:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ a8b:	8b 4a 08             	mov    0x8(%edx),%ecx
+  if((b = p->free) != 0){
+ a8e:	85 db                	test   %ebx,%ebx
+ a90:	0f 84 aa 00 00 00    	je     b40 <malloc+0x160>
+    p->free = b->next;
+ a96:	8b 03                	mov    (%ebx),%eax
+ a98:	89 42 0c             	mov    %eax,0xc(%edx)
+  if(--p->nfree == 0)
+ a9b:	83 e9 01             	sub    $0x1,%ecx
+ a9e:	89 4a 08             	mov    %ecx,0x8(%edx)
+ aa1:	75 83                	jne    a26 <malloc+0x46>
+  if(p->prev)
+ aa3:	8b 4a 18             	mov    0x18(%edx),%ecx
+    p->prev->next = p->next;
+ aa6:	8b 42 14             	mov    0x14(%edx),%eax
+  if(p->prev)
+ aa9:	85 c9                	test   %ecx,%ecx
+ aab:	0f 84 cf 00 00 00    	je     b80 <malloc+0x1a0>
+    p->prev->next = p->next;
+ ab1:	89 41 14             	mov    %eax,0x14(%ecx)
+  if(p->next)
+ ab4:	85 c0                	test   %eax,%eax
+ ab6:	0f 84 6a ff ff ff    	je     a26 <malloc+0x46>
+    p->next->prev = p->prev;
+ abc:	8b 52 18             	mov    0x18(%edx),%edx
+ abf:	89 50 18             	mov    %edx,0x18(%eax)
+ ac2:	e9 5f ff ff ff       	jmp    a26 <malloc+0x46>
+ ac7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ace:	66 90                	xchg   %ax,%ax
+}
+ ad0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+ ad3:	31 db                	xor    %ebx,%ebx
+}
+ ad5:	89 d8                	mov    %ebx,%eax
+ ad7:	5b                   	pop    %ebx
+ ad8:	5e                   	pop    %esi
+ ad9:	5d                   	pop    %ebp
+ ada:	c3                   	ret
+ adb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ adf:	90                   	nop
+    if((p = runalloc(1)) == 0)
+ ae0:	b8 01 00 00 00       	mov    $0x1,%eax
+ ae5:	e8 e6 fc ff ff       	call   7d0 <runalloc>
+ aea:	89 c2                	mov    %eax,%edx
+ aec:	85 c0                	test   %eax,%eax
+ aee:	74 e0                	je     ad0 <malloc+0xf0>
+    p->kind = PSMALL;
+ af0:	b8 01 00 00 00       	mov    $0x1,%eax
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ af5:	8d 4b 04             	lea    0x4(%ebx),%ecx
+    p->class = c;
+ af8:	66 89 5a 02          	mov    %bx,0x2(%edx)
+ afc:	0f b7 db             	movzwl %bx,%ebx
+    p->kind = PSMALL;
+ aff:	66 89 02             	mov    %ax,(%edx)
+    p->fresh = (char*)p + HDRSIZE;
+ b02:	8d 42 20             	lea    0x20(%edx),%eax
+ b05:	89 42 10             	mov    %eax,0x10(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ b08:	b8 e0 0f 00 00       	mov    $0xfe0,%eax
+ b0d:	d3 f8                	sar    %cl,%eax
+    p->free = 0;
+ b0f:	c7 42 0c 00 00 00 00 	movl   $0x0,0xc(%edx)
+    p->nfree = nblocks(c);
+ b16:	89 42 08             	mov    %eax,0x8(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ b19:	89 c1                	mov    %eax,%ecx
+  p->next = partial[p->class];
+ b1b:	8b 04 9d 18 0f 00 00 	mov    0xf18(,%ebx,4),%eax
+  p->prev = 0;
+ b22:	c7 42 18 00 00 00 00 	movl   $0x0,0x18(%edx)
+  p->next = partial[p->class];
+ b29:	89 42 14             	mov    %eax,0x14(%edx)
+  if(p->next)
+ b2c:	85 c0                	test   %eax,%eax
+ b2e:	75 20                	jne    b50 <malloc+0x170>
+  partial[p->class] = p;
+ b30:	89 14 9d 18 0f 00 00 	mov    %edx,0xf18(,%ebx,4)
+  if((b = p->free) != 0){
+ b37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b3e:	66 90                	xchg   %ax,%ax
+    b = (struct block*)p->fresh;
+ b40:	8b 5a 10             	mov    0x10(%edx),%ebx
+    p->fresh += MINSMALL << c;
+ b43:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+ b46:	89 42 10             	mov    %eax,0x10(%edx)
+ b49:	e9 4d ff ff ff       	jmp    a9b <malloc+0xbb>
+ b4e:	66 90                	xchg   %ax,%ax
+    p->next->prev = p;
+ b50:	89 50 18             	mov    %edx,0x18(%eax)
+  partial[p->class] = p;
+ b53:	0f b7 42 02          	movzwl 0x2(%edx),%eax
+  if((b = p->free) != 0){
+ b57:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ b5a:	8b 4a 08             	mov    0x8(%edx),%ecx
+  partial[p->class] = p;
+ b5d:	89 14 85 18 0f 00 00 	mov    %edx,0xf18(,%eax,4)
+}
+ b64:	e9 25 ff ff ff       	jmp    a8e <malloc+0xae>
+ b69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ b70:	be 10 00 00 00       	mov    $0x10,%esi
+ b75:	31 db                	xor    %ebx,%ebx
+ b77:	e9 01 ff ff ff       	jmp    a7d <malloc+0x9d>
+ b7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ b80:	0f b7 4a 02          	movzwl 0x2(%edx),%ecx
+ b84:	89 04 8d 18 0f 00 00 	mov    %eax,0xf18(,%ecx,4)
+ b8b:	e9 24 ff ff ff       	jmp    ab4 <malloc+0xd4>
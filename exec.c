@@ -7,17 +7,54 @@
 #include "x86.h"
 #include "elf.h"
 
+// Push argv onto the user stack in pgdir that ends at sp, as
+// main's arguments. Returns the new stack pointer, or 0.
+static uint
+pushargs(pde_t *pgdir, uint sp, char **argv)
+{
+  uint argc, ustack[3+MAXARG+1];
+
+  // Push argument strings, prepare rest of stack in ustack.
+  for(argc = 0; argv[argc]; argc++) {
+    if(argc >= MAXARG)
+      return 0;
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+      return 0;
+    ustack[3+argc] = sp;
+  }
+  ustack[3+argc] = 0;
+
+  ustack[0] = 0xffffffff;  // fake return PC
+  ustack[1] = argc;
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+
+  sp -= (3+argc+1) * 4;
+  if(copyout(pgdir, sp, ustack, (3+argc+1)*4) < 0)
+    return 0;
+  return sp;
+}
+
+// Load the program at path into a new address space for p, set
+// p up to start it with argv, and free p's old address space.
+// p is the current process, from exec, or a new one with no
+// address space yet, from spawn; its memory is charged to p's
+// container either way. A relative path is looked up from the
+// caller's working directory, not p's. If argv is 0, p is left
+// for execargs to give it arguments later.
 int
-exec(char *path, char **argv)
+execinto(struct proc *p, char *path, char **argv)
 {
   char *s, *last;
   int i, off;
-  uint argc, sz, sp, ustack[3+MAXARG+1];
+  uint sz, sp;
   struct elfhdr elf;
   struct inode *ip;
   struct proghdr ph;
+  struct vma vma[NVMA], *v;
   pde_t *pgdir, *oldpgdir;
-  struct proc *curproc = myproc();
+
+  memset(vma, 0, sizeof(vma));
 
   begin_op();
 
@@ -53,8 +90,10 @@ exec(char *path, char **argv)
   if((pgdir = setupkvm()) == 0)
     goto bad;
 
-  // Load program into memory.
+  // Map the program. Nothing is read here: each segment
+  // becomes a vma and its pages are faulted in on first use.
   sz = 0;
+  v = vma;
   for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
     if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
       goto bad;
@@ -64,12 +103,30 @@ exec(char *path, char **argv)
       goto bad;
     if(ph.vaddr + ph.memsz < ph.vaddr)
       goto bad;
-    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
+    if(ph.vaddr + ph.memsz >= KERNBASE)
       goto bad;
-    if(ph.vaddr % PGSIZE != 0)
+    if(ph.vaddr % PGSIZE != 0 || ph.vaddr < PGROUNDUP(sz))
       goto bad;
-    if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
+    if(ph.vaddr > PGROUNDUP(sz)){
+      // A gap before the segment is below sz, so system calls
+      // may use it: make it zero-filled memory.
+      if(v == &vma[NVMA])
+        goto bad;
+      v->start = PGROUNDUP(sz);
+      v->end = ph.vaddr;
+      v->flags = VM_WRITE;
+      v++;
+    }
+    if(v == &vma[NVMA])
       goto bad;
+    v->start = ph.vaddr;
+    v->end = PGROUNDUP(ph.vaddr + ph.memsz);
+    v->flags = (ph.flags & ELF_PROG_FLAG_WRITE) ? VM_WRITE : 0;
+    v->ip = idup(ip);
+    v->off = ph.off;
+    v->filesz = ph.filesz;
+    v++;
+    sz = ph.vaddr + ph.memsz;
   }
   iunlockput(ip);
   end_op();
@@ -78,44 +135,35 @@ exec(char *path, char **argv)
   // Allocate two pages at the next page boundary.
   // Make the first inaccessible.  Use the second as the user stack.
   sz = PGROUNDUP(sz);
-  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
+  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE, p->cont)) == 0)
     goto bad;
   clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
   sp = sz;
-
-  // Push argument strings, prepare rest of stack in ustack.
-  for(argc = 0; argv[argc]; argc++) {
-    if(argc >= MAXARG)
-      goto bad;
-    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
-    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
-      goto bad;
-    ustack[3+argc] = sp;
-  }
-  ustack[3+argc] = 0;
-
-  ustack[0] = 0xffffffff;  // fake return PC
-  ustack[1] = argc;
-  ustack[2] = sp - (argc+1)*4;  // argv pointer
-
-  sp -= (3+argc+1) * 4;
-  if(copyout(pgdir, sp, ustack, (3+argc+1)*4) < 0)
+  if(argv && (sp = pushargs(pgdir, sp, argv)) == 0)
     goto bad;
 
   // Save program name for debugging.
   for(last=s=path; *s; s++)
     if(*s == '/')
       last = s+1;
-  safestrcpy(curproc->name, last, sizeof(curproc->name));
+  safestrcpy(p->name, last, sizeof(p->name));
 
   // Commit to the user image.
-  oldpgdir = curproc->pgdir;
-  curproc->pgdir = pgdir;
-  curproc->sz = sz;
-  curproc->tf->eip = elf.entry;  // main
-  curproc->tf->esp = sp;
-  switchuvm(curproc);
-  freevm(oldpgdir);
+  oldpgdir = setpgdir(p, pgdir);
+  p->sz = sz;
+  p->tf->eip = elf.entry;  // main
+  p->tf->esp = sp;
+  if(oldpgdir){
+    switchuvm(p);
+    // Unmapping everything needs no vma slot or 4MB page split, so
+    // this fails only if a shared file mapping cannot be written
+    // back. It is too late to fail exec; the old pages go anyway.
+    if(munmapuvm(oldpgdir, p->vma, MMAPBASE, KERNBASE) < 0)
+      cprintf("exec: %s: writing back a shared mapping failed\n", p->name);
+    freevm(oldpgdir);
+    vmaput(p->vma);
+  }
+  memmove(p->vma, vma, sizeof(vma));
   return 0;
 
  bad:
@@ -125,5 +173,30 @@ exec(char *path, char **argv)
     iunlockput(ip);
     end_op();
   }
+  vmaput(vma);
   return -1;
 }
+
+// Give argv to p, which execinto loaded without arguments
+// and which has not run since.
+int
+execargs(struct proc *p, char **argv)
+{
+  uint sp;
+
+  if((sp = pushargs(p->pgdir, p->sz, argv)) == 0)
+    return -1;
+  p->tf->esp = sp;
+  return 0;
+}
+
+int
+exec(char *path, char **argv)
+{
+  struct proc *curproc = myproc();
+
+  // The other threads would lose their address space.
+  if(curproc->leader != curproc || curproc->nthread > 1)
+    return -1;
+  return execinto(curproc, path, argv);
+}
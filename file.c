@@ -32,6 +32,7 @@ filealloc(void)
   for(f = ftable.file; f < ftable.file + NFILE; f++){
     if(f->ref == 0){
       f->ref = 1;
+      memset(&f->ra, 0, sizeof(f->ra));
       release(&ftable.lock);
       return f;
     }
@@ -104,8 +105,10 @@ fileread(struct file *f, char *addr, int n)
     return piperead(f->pipe, addr, n);
   if(f->type == FD_INODE){
     ilock(f->ip);
-    if((r = readi(f->ip, addr, f->off, n)) > 0)
+    if((r = readi(f->ip, addr, f->off, n)) > 0){
+      ireadahead(f->ip, &f->ra, f->off, r);
       f->off += r;
+    }
     iunlock(f->ip);
     return r;
   }
@@ -125,12 +128,13 @@ filewrite(struct file *f, char *addr, int n)
     return pipewrite(f->pipe, addr, n);
   if(f->type == FD_INODE){
     // write a few blocks at a time to avoid exceeding
-    // the maximum log transaction size, including
-    // i-node, indirect block, allocation blocks,
-    // and 2 blocks of slop for non-aligned writes.
+    // the maximum log transaction size. file data does
+    // not go through the log (see writei), so that is
+    // the i-node, indirect block, and the allocation
+    // blocks: at most two, for BPB blocks or fewer.
     // this really belongs lower down, since writei()
     // might be writing a device like the console.
-    int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
+    int max = BPB * BSIZE;
     int i = 0;
     while(i < n){
       int n1 = n - i;
@@ -1,3 +1,10 @@
+// Read-ahead state of a sequential reader (see ireadahead).
+struct readahead {
+  uint next;     // block the next read should start at
+  uint end;      // block after the last one read ahead
+  uint win;      // blocks to read ahead, 0 if not sequential
+};
+
 struct file {
   enum { FD_NONE, FD_PIPE, FD_INODE } type;
   int ref; // reference count
@@ -6,6 +13,7 @@ struct file {
   struct pipe *pipe;
   struct inode *ip;
   uint off;
+  struct readahead ra;  // protected by ip->lock
 };
 
 
@@ -23,6 +31,8 @@ struct inode {
   short nlink;
   uint size;
   uint addrs[NDIRECT+1];
+  struct readahead ra;  // for page faults on mappings
+  int mapshared;      // ever mapped shared and writable; see pcread
 };
 
 // table mapping major device number to
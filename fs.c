@@ -52,9 +52,10 @@ bzero(int dev, int bno)
 
 // Blocks.
 
-// Allocate a zeroed disk block.
+// Allocate a disk block, zeroed if zero is set. Skips blocks
+// whose freeing has not committed (see log_reusable).
 static uint
-balloc(uint dev)
+balloc(uint dev, int zero)
 {
   int b, bi, m;
   struct buf *bp;
@@ -64,11 +65,13 @@ balloc(uint dev)
     bp = bread(dev, BBLOCK(b, sb));
     for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
       m = 1 << (bi % 8);
-      if((bp->data[bi/8] & m) == 0){  // Is block free?
+      if((bp->data[bi/8] & m) == 0 && log_reusable(b + bi)){  // Is block free?
         bp->data[bi/8] |= m;  // Mark block in use.
         log_write(bp);
         brelse(bp);
-        bzero(dev, b + bi);
+        log_revoke(b + bi);
+        if(zero)
+          bzero(dev, b + bi);
         return b + bi;
       }
     }
@@ -92,6 +95,7 @@ bfree(int dev, uint b)
   bp->data[bi/8] &= ~m;
   log_write(bp);
   brelse(bp);
+  log_freed(b);
 }
 
 // Inodes.
@@ -266,11 +270,32 @@ iget(uint dev, uint inum)
   ip->inum = inum;
   ip->ref = 1;
   ip->valid = 0;
+  memset(&ip->ra, 0, sizeof(ip->ra));
+  ip->mapshared = 0;
   release(&icache.lock);
 
   return ip;
 }
 
+// Find the inode numbered inum on device dev, as iget does,
+// but only if it is in use on disk. Returns 0 for a free or
+// out-of-range inum, as one saved by an earlier boot may be.
+struct inode*
+igetused(uint dev, uint inum)
+{
+  struct buf *bp;
+  struct dinode *dip;
+  short type;
+
+  if(inum < 1 || inum >= sb.ninodes)
+    return 0;
+  bp = bread(dev, IBLOCK(inum, sb));
+  dip = (struct dinode*)bp->data + inum%IPB;
+  type = dip->type;
+  brelse(bp);
+  return type ? iget(dev, inum) : 0;
+}
+
 // Increment reference count for ip.
 // Returns ip to enable ip = idup(ip1) idiom.
 struct inode*
@@ -368,16 +393,19 @@ iunlockput(struct inode *ip)
 // listed in block ip->addrs[NDIRECT].
 
 // Return the disk block address of the nth block in inode ip.
-// If there is no such block, bmap allocates one.
+// If there is no such block, bmap allocates one. A new block of
+// a plain file is not zeroed; writei fills it (see there).
 static uint
 bmap(struct inode *ip, uint bn)
 {
   uint addr, *a;
   struct buf *bp;
+  int zero;
 
+  zero = ip->type != T_FILE;
   if(bn < NDIRECT){
     if((addr = ip->addrs[bn]) == 0)
-      ip->addrs[bn] = addr = balloc(ip->dev);
+      ip->addrs[bn] = addr = balloc(ip->dev, zero);
     return addr;
   }
   bn -= NDIRECT;
@@ -385,11 +413,11 @@ bmap(struct inode *ip, uint bn)
   if(bn < NINDIRECT){
     // Load indirect block, allocating if necessary.
     if((addr = ip->addrs[NDIRECT]) == 0)
-      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+      ip->addrs[NDIRECT] = addr = balloc(ip->dev, 1);
     bp = bread(ip->dev, addr);
     a = (uint*)bp->data;
     if((addr = a[bn]) == 0){
-      a[bn] = addr = balloc(ip->dev);
+      a[bn] = addr = balloc(ip->dev, zero);
       log_write(bp);
     }
     brelse(bp);
@@ -432,6 +460,7 @@ itrunc(struct inode *ip)
 
   ip->size = 0;
   iupdate(ip);
+  pcinval(ip);
 }
 
 // Copy stat information from inode.
@@ -472,16 +501,59 @@ readi(struct inode *ip, char *dst, uint off, uint n)
     memmove(dst, bp->data + off%BSIZE, m);
     brelse(bp);
   }
+  if(ip->mapshared)
+    pcread(ip, dst - n, off - n, n);
   return n;
 }
 
+// Note that the caller has read n bytes of ip at off, and
+// if it is reading sequentially, start reading the blocks
+// after them so they are cached by the time it gets there.
+// The window starts at RAMIN blocks and doubles, up to
+// RAMAX, each time the reader gets halfway through what
+// was read ahead; a read anywhere else closes it.
+// Caller must hold ip->lock.
+void
+ireadahead(struct inode *ip, struct readahead *ra, uint off, uint n)
+{
+  uint first, last, bn, end;
+
+  if(ip->type != T_FILE || n == 0)
+    return;
+  first = off / BSIZE;
+  last = (off + n - 1) / BSIZE;
+  // A read may start in the block the last one ended in.
+  if(first != ra->next && first + 1 != ra->next){
+    ra->next = last + 1;
+    ra->win = 0;
+    return;
+  }
+  ra->next = last + 1;
+  if(ra->win > 0 && ra->end > last + ra->win/2)
+    return;
+
+  ra->win = ra->win == 0 ? RAMIN : min(2*ra->win, RAMAX);
+  bn = ra->win == RAMIN || ra->end <= last ? last + 1 : ra->end;
+  end = min(last + 1 + ra->win, (ip->size + BSIZE - 1) / BSIZE);
+  for(; bn < end; bn++)
+    breadahead(ip->dev, bmap(ip, bn));
+  ra->end = end;
+}
+
 // PAGEBREAK!
 // Write data to inode.
 // Caller must hold ip->lock.
+//
+// Only metadata goes through the log. The data of a plain
+// file is written straight to its home location, before the
+// transaction that allocates its blocks commits, so a crash
+// leaves the file with either its old blocks or new blocks
+// holding the new data. New blocks are zeroed here rather
+// than by balloc, which would log them.
 int
 writei(struct inode *ip, char *src, uint off, uint n)
 {
-  uint tot, m;
+  uint tot, m, bn, newbn;
   struct buf *bp;
 
   if(ip->type == T_DEV){
@@ -495,11 +567,19 @@ writei(struct inode *ip, char *src, uint off, uint n)
   if(off + n > MAXFILE*BSIZE)
     return -1;
 
+  newbn = (ip->size + BSIZE - 1) / BSIZE;
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    bn = off/BSIZE;
+    bp = bread(ip->dev, bmap(ip, bn));
     m = min(n - tot, BSIZE - off%BSIZE);
+    if(ip->type == T_FILE && bn >= newbn && m < BSIZE)
+      memset(bp->data, 0, BSIZE);
     memmove(bp->data + off%BSIZE, src, m);
-    log_write(bp);
+    if(ip->type == T_FILE)
+      bwrite(bp);
+    else
+      log_write(bp);
+    pcupdate(ip, off, (char*)bp->data + off%BSIZE, m);
     brelse(bp);
   }
 
@@ -519,6 +599,51 @@ namecmp(const char *s, const char *t)
   return strncmp(s, t, DIRSIZ);
 }
 
+// Find the inodes in the tree under directory dp. Returns a
+// page whose first half has bit inum set for each, dp included,
+// for the caller to kfree, or 0 if the file system has too many
+// inodes for it. The second half marks the directories read.
+uchar*
+itreemap(struct inode *dp)
+{
+  uchar *map, *done;
+  struct inode *ip;
+  struct dirent de;
+  uint inum, off;
+  int more;
+
+  if(sb.ninodes > PGSIZE*8/2 || (map = (uchar*)kalloc()) == 0)
+    return 0;
+  memset(map, 0, PGSIZE);
+  done = map + PGSIZE/2;
+  map[dp->inum/8] |= 1 << dp->inum%8;
+  do {
+    more = 0;
+    for(inum = 1; inum < sb.ninodes; inum++){
+      if(!(map[inum/8] & 1 << inum%8) || (done[inum/8] & 1 << inum%8))
+        continue;
+      done[inum/8] |= 1 << inum%8;
+      ip = iget(dp->dev, inum);
+      ilock(ip);
+      for(off = 0; ip->type == T_DIR && off < ip->size; off += sizeof(de)){
+        if(readi(ip, (char*)&de, off, sizeof(de)) != sizeof(de))
+          break;
+        if(de.inum == 0 || de.inum >= sb.ninodes ||
+           namecmp(de.name, ".") == 0 || namecmp(de.name, "..") == 0 ||
+           (map[de.inum/8] & 1 << de.inum%8))
+          continue;
+        map[de.inum/8] |= 1 << de.inum%8;
+        more = 1;
+      }
+      iunlock(ip);
+      begin_op();
+      iput(ip);
+      end_op();
+    }
+  } while(more);
+  return map;
+}
+
 // Look for a directory entry in a directory.
 // If found, set *poff to byte offset of entry.
 struct inode*
@@ -3,11 +3,16 @@
 
 
 #define ROOTINO 1  // root i-number
-#define BSIZE 512  // block size
+// Block size, a multiple of the 512-byte sector no larger than a
+// page. "make BSIZE=4096" builds the kernel, mkfs and fs.img for
+// 4KB blocks.
+#ifndef BSIZE
+#define BSIZE 512
+#endif
 
 // Disk layout:
 // [ boot block | super block | log | inode blocks |
-//                                          free bit map | data blocks]
+//                                   free bit map | data blocks | swap ]
 //
 // mkfs computes the super block and builds an initial file system. The
 // super block describes the disk layout:
@@ -19,6 +24,8 @@ struct superblock {
   uint logstart;     // Block number of first log block
   uint inodestart;   // Block number of first inode block
   uint bmapstart;    // Block number of first free map block
+  uint swapstart;    // Block number of first swap block
+  uint nswap;        // Number of swap blocks
 };
 
 #define NDIRECT 12
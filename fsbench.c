@@ -0,0 +1,67 @@
+// Measure sequential file I/O, to compare file systems built
+// with different block sizes (make BSIZE=4096): write NFILE
+// files of FILESZ bytes, read them back, and remove them.
+// File data goes straight to disk a block at a time, so larger
+// blocks mean fewer disk requests for the same bytes.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fs.h"
+#include "fcntl.h"
+
+#define NFILE  16
+#define FILESZ (64*1024)  // fits MAXFILE even with 512-byte blocks
+#define CHUNK  4096
+
+char data[CHUNK];
+
+int
+main(int argc, char *argv[])
+{
+  char path[] = "fsbench.a";
+  int fd, i, n, start, wticks, rticks, uticks;
+
+  memset(data, 'f', sizeof(data));
+
+  start = uptime();
+  for(i = 0; i < NFILE; i++){
+    path[8] = 'a' + i;
+    if((fd = open(path, O_CREATE | O_RDWR)) < 0){
+      printf(1, "fsbench: cannot create %s\n", path);
+      exit();
+    }
+    for(n = 0; n < FILESZ; n += sizeof(data)){
+      if(write(fd, data, sizeof(data)) != sizeof(data)){
+        printf(1, "fsbench: write %s failed\n", path);
+        exit();
+      }
+    }
+    close(fd);
+  }
+  wticks = uptime() - start;
+
+  start = uptime();
+  for(i = 0; i < NFILE; i++){
+    path[8] = 'a' + i;
+    if((fd = open(path, O_RDONLY)) < 0){
+      printf(1, "fsbench: cannot open %s\n", path);
+      exit();
+    }
+    while(read(fd, data, sizeof(data)) > 0)
+      ;
+    close(fd);
+  }
+  rticks = uptime() - start;
+
+  start = uptime();
+  for(i = 0; i < NFILE; i++){
+    path[8] = 'a' + i;
+    unlink(path);
+  }
+  uticks = uptime() - start;
+
+  printf(1, "%d-byte blocks, %dKB in %d files: write %d ticks, read %d ticks, unlink %d ticks\n",
+         BSIZE, NFILE*FILESZ/1024, NFILE, wticks, rticks, uticks);
+  exit();
+}
@@ -0,0 +1,83 @@
+// Futexes.
+//
+// A futex is a word of user memory that threads, or processes
+// sharing memory, use to block without spinning. futex(addr,
+// FUTEX_WAIT, val) sleeps as long as *addr holds val, and
+// futex(addr, FUTEX_WAKE, n) wakes up at most n sleepers. A lock
+// built on them (see usync.c) only enters the kernel when it is
+// contended.
+//
+// Sleepers are keyed by the physical address of the word, through
+// its kernel mapping, so processes that map the same page at
+// different addresses (shmget, MAP_SHARED) use the same channel.
+// futex.lock makes checking the word and going to sleep atomic
+// with respect to wakes.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+
+struct {
+  struct spinlock lock;
+} futex;
+
+void
+futexinit(void)
+{
+  initlock(&futex.lock, "futex");
+}
+
+// Return the kernel address of the user word at addr, which the
+// caller has faulted in, or 0 if it is not mapped.
+static uint*
+futexword(uint addr)
+{
+  char *page;
+
+  if((page = uva2ka(myproc()->pgdir, (char*)addr)) == 0)
+    return 0;
+  return (uint*)(page + addr % PGSIZE);
+}
+
+// Sleep until woken if the word at addr holds val.
+// Returns -1 at once if it does not.
+int
+futexwait(uint addr, uint val)
+{
+  uint *w;
+
+  if(addr % 4 != 0 || touchuvm(addr, 4, 0) < 0)
+    return -1;
+  // futexword finds the page itself, and another thread
+  // may unmap the word while this one waits.
+  unpinuvm();
+  acquire(&futex.lock);
+  if((w = futexword(addr)) == 0 || *w != val){
+    release(&futex.lock);
+    return -1;
+  }
+  sleep(w, &futex.lock);
+  release(&futex.lock);
+  return 0;
+}
+
+// Wake up at most n processes sleeping on the word at addr,
+// and return how many were woken.
+int
+futexwake(uint addr, int n)
+{
+  uint *w;
+  int r;
+
+  if(addr % 4 != 0 || touchuvm(addr, 4, 0) < 0)
+    return -1;
+  acquire(&futex.lock);
+  r = -1;
+  if((w = futexword(addr)) != 0)
+    r = wakeupn(w, n);
+  release(&futex.lock);
+  return r;
+}
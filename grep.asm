@@ -0,0 +1,2141 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 01                	mov    (%ecx),%eax
+  16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  19:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int fd, i;
+  char *pattern;
+
+  if(argc <= 1){
+  1c:	83 f8 01             	cmp    $0x1,%eax
+  1f:	7e 6f                	jle    90 <main+0x90>
+    printf(2, "usage: grep pattern [file ...]\n");
+    exit();
+  }
+  pattern = argv[1];
+  21:	8b 43 04             	mov    0x4(%ebx),%eax
+  24:	83 c3 08             	add    $0x8,%ebx
+
+  if(argc <= 2){
+  27:	83 7d e4 02          	cmpl   $0x2,-0x1c(%ebp)
+    grep(pattern, 0);
+    exit();
+  }
+
+  for(i = 2; i < argc; i++){
+  2b:	be 02 00 00 00       	mov    $0x2,%esi
+  pattern = argv[1];
+  30:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(argc <= 2){
+  33:	75 2d                	jne    62 <main+0x62>
+  35:	eb 6c                	jmp    a3 <main+0xa3>
+  37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  3e:	66 90                	xchg   %ax,%ax
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "grep: cannot open %s\n", argv[i]);
+      exit();
+    }
+    grep(pattern, fd);
+  40:	83 ec 08             	sub    $0x8,%esp
+  for(i = 2; i < argc; i++){
+  43:	83 c6 01             	add    $0x1,%esi
+  46:	83 c3 04             	add    $0x4,%ebx
+    grep(pattern, fd);
+  49:	50                   	push   %eax
+  4a:	ff 75 e0             	push   -0x20(%ebp)
+  4d:	e8 9e 01 00 00       	call   1f0 <grep>
+    close(fd);
+  52:	89 3c 24             	mov    %edi,(%esp)
+  55:	e8 f1 05 00 00       	call   64b <close>
+  for(i = 2; i < argc; i++){
+  5a:	83 c4 10             	add    $0x10,%esp
+  5d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  60:	7e 29                	jle    8b <main+0x8b>
+    if((fd = open(argv[i], 0)) < 0){
+  62:	83 ec 08             	sub    $0x8,%esp
+  65:	6a 00                	push   $0x0
+  67:	ff 33                	push   (%ebx)
+  69:	e8 f5 05 00 00       	call   663 <open>
+  6e:	83 c4 10             	add    $0x10,%esp
+  71:	89 c7                	mov    %eax,%edi
+  73:	85 c0                	test   %eax,%eax
+  75:	79 c9                	jns    40 <main+0x40>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+  77:	50                   	push   %eax
+  78:	ff 33                	push   (%ebx)
+  7a:	68 e0 0e 00 00       	push   $0xee0
+  7f:	6a 01                	push   $0x1
+  81:	e8 4a 07 00 00       	call   7d0 <printf>
+      exit();
+  86:	e8 98 05 00 00       	call   623 <exit>
+  }
+  exit();
+  8b:	e8 93 05 00 00       	call   623 <exit>
+    printf(2, "usage: grep pattern [file ...]\n");
+  90:	51                   	push   %ecx
+  91:	51                   	push   %ecx
+  92:	68 c0 0e 00 00       	push   $0xec0
+  97:	6a 02                	push   $0x2
+  99:	e8 32 07 00 00       	call   7d0 <printf>
+    exit();
+  9e:	e8 80 05 00 00       	call   623 <exit>
+    grep(pattern, 0);
+  a3:	52                   	push   %edx
+  a4:	52                   	push   %edx
+  a5:	6a 00                	push   $0x0
+  a7:	50                   	push   %eax
+  a8:	e8 43 01 00 00       	call   1f0 <grep>
+    exit();
+  ad:	e8 71 05 00 00       	call   623 <exit>
+  b2:	66 90                	xchg   %ax,%ax
+  b4:	66 90                	xchg   %ax,%ax
+  b6:	66 90                	xchg   %ax,%ax
+  b8:	66 90                	xchg   %ax,%ax
+  ba:	66 90                	xchg   %ax,%ax
+  bc:	66 90                	xchg   %ax,%ax
+  be:	66 90                	xchg   %ax,%ax
+
+000000c0 <matchhere>:
+  return 0;
+}
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	57                   	push   %edi
+  c4:	56                   	push   %esi
+  c5:	53                   	push   %ebx
+  c6:	83 ec 0c             	sub    $0xc,%esp
+  c9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(re[0] == '\0')
+  cf:	0f b6 0f             	movzbl (%edi),%ecx
+  d2:	84 c9                	test   %cl,%cl
+  d4:	0f 84 96 00 00 00    	je     170 <matchhere+0xb0>
+    return 1;
+  if(re[1] == '*')
+  da:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+  de:	3c 2a                	cmp    $0x2a,%al
+  e0:	74 2d                	je     10f <matchhere+0x4f>
+  e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return matchstar(re[0], re+2, text);
+  if(re[0] == '$' && re[1] == '\0')
+    return *text == '\0';
+  e8:	0f b6 33             	movzbl (%ebx),%esi
+  if(re[0] == '$' && re[1] == '\0')
+  eb:	80 f9 24             	cmp    $0x24,%cl
+  ee:	74 50                	je     140 <matchhere+0x80>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+  f0:	89 f2                	mov    %esi,%edx
+  f2:	84 d2                	test   %dl,%dl
+  f4:	74 6e                	je     164 <matchhere+0xa4>
+  f6:	80 f9 2e             	cmp    $0x2e,%cl
+  f9:	75 65                	jne    160 <matchhere+0xa0>
+    return matchhere(re+1, text+1);
+  fb:	83 c3 01             	add    $0x1,%ebx
+  fe:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+ 101:	84 c0                	test   %al,%al
+ 103:	74 6b                	je     170 <matchhere+0xb0>
+ 105:	89 c1                	mov    %eax,%ecx
+  if(re[1] == '*')
+ 107:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+ 10b:	3c 2a                	cmp    $0x2a,%al
+ 10d:	75 d9                	jne    e8 <matchhere+0x28>
+    return matchstar(re[0], re+2, text);
+ 10f:	8d 77 02             	lea    0x2(%edi),%esi
+ 112:	0f be f9             	movsbl %cl,%edi
+  return 0;
+}
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+ 115:	8d 76 00             	lea    0x0(%esi),%esi
+{
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+ 118:	83 ec 08             	sub    $0x8,%esp
+ 11b:	53                   	push   %ebx
+ 11c:	56                   	push   %esi
+ 11d:	e8 9e ff ff ff       	call   c0 <matchhere>
+ 122:	83 c4 10             	add    $0x10,%esp
+ 125:	85 c0                	test   %eax,%eax
+ 127:	75 47                	jne    170 <matchhere+0xb0>
+      return 1;
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 129:	0f be 13             	movsbl (%ebx),%edx
+ 12c:	84 d2                	test   %dl,%dl
+ 12e:	74 45                	je     175 <matchhere+0xb5>
+ 130:	83 c3 01             	add    $0x1,%ebx
+ 133:	39 fa                	cmp    %edi,%edx
+ 135:	74 e1                	je     118 <matchhere+0x58>
+ 137:	83 ff 2e             	cmp    $0x2e,%edi
+ 13a:	74 dc                	je     118 <matchhere+0x58>
+ 13c:	eb 37                	jmp    175 <matchhere+0xb5>
+ 13e:	66 90                	xchg   %ax,%ax
+  if(re[0] == '$' && re[1] == '\0')
+ 140:	84 c0                	test   %al,%al
+ 142:	74 39                	je     17d <matchhere+0xbd>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 144:	89 f2                	mov    %esi,%edx
+ 146:	84 d2                	test   %dl,%dl
+ 148:	74 1a                	je     164 <matchhere+0xa4>
+ 14a:	80 fa 24             	cmp    $0x24,%dl
+ 14d:	75 15                	jne    164 <matchhere+0xa4>
+    return matchhere(re+1, text+1);
+ 14f:	83 c3 01             	add    $0x1,%ebx
+ 152:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+ 155:	89 c1                	mov    %eax,%ecx
+ 157:	eb ae                	jmp    107 <matchhere+0x47>
+ 159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 160:	38 ca                	cmp    %cl,%dl
+ 162:	74 97                	je     fb <matchhere+0x3b>
+}
+ 164:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+ 167:	31 c0                	xor    %eax,%eax
+}
+ 169:	5b                   	pop    %ebx
+ 16a:	5e                   	pop    %esi
+ 16b:	5f                   	pop    %edi
+ 16c:	5d                   	pop    %ebp
+ 16d:	c3                   	ret
+ 16e:	66 90                	xchg   %ax,%ax
+    return 1;
+ 170:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 175:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 178:	5b                   	pop    %ebx
+ 179:	5e                   	pop    %esi
+ 17a:	5f                   	pop    %edi
+ 17b:	5d                   	pop    %ebp
+ 17c:	c3                   	ret
+    return *text == '\0';
+ 17d:	89 f0                	mov    %esi,%eax
+ 17f:	84 c0                	test   %al,%al
+ 181:	0f 94 c0             	sete   %al
+ 184:	0f b6 c0             	movzbl %al,%eax
+ 187:	eb ec                	jmp    175 <matchhere+0xb5>
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000190 <match>:
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	56                   	push   %esi
+ 194:	53                   	push   %ebx
+ 195:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 198:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(re[0] == '^')
+ 19b:	80 3b 5e             	cmpb   $0x5e,(%ebx)
+ 19e:	75 11                	jne    1b1 <match+0x21>
+ 1a0:	eb 2e                	jmp    1d0 <match+0x40>
+ 1a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  }while(*text++ != '\0');
+ 1a8:	83 c6 01             	add    $0x1,%esi
+ 1ab:	80 7e ff 00          	cmpb   $0x0,-0x1(%esi)
+ 1af:	74 16                	je     1c7 <match+0x37>
+    if(matchhere(re, text))
+ 1b1:	83 ec 08             	sub    $0x8,%esp
+ 1b4:	56                   	push   %esi
+ 1b5:	53                   	push   %ebx
+ 1b6:	e8 05 ff ff ff       	call   c0 <matchhere>
+ 1bb:	83 c4 10             	add    $0x10,%esp
+ 1be:	85 c0                	test   %eax,%eax
+ 1c0:	74 e6                	je     1a8 <match+0x18>
+      return 1;
+ 1c2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 1c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1ca:	5b                   	pop    %ebx
+ 1cb:	5e                   	pop    %esi
+ 1cc:	5d                   	pop    %ebp
+ 1cd:	c3                   	ret
+ 1ce:	66 90                	xchg   %ax,%ax
+    return matchhere(re+1, text);
+ 1d0:	83 c3 01             	add    $0x1,%ebx
+ 1d3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 1d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1d9:	5b                   	pop    %ebx
+ 1da:	5e                   	pop    %esi
+ 1db:	5d                   	pop    %ebp
+    return matchhere(re+1, text);
+ 1dc:	e9 df fe ff ff       	jmp    c0 <matchhere>
+ 1e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ef:	90                   	nop
+
+000001f0 <grep>:
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	57                   	push   %edi
+  m = 0;
+ 1f4:	31 ff                	xor    %edi,%edi
+{
+ 1f6:	56                   	push   %esi
+ 1f7:	53                   	push   %ebx
+ 1f8:	83 ec 1c             	sub    $0x1c,%esp
+ 1fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 1fe:	89 7d e0             	mov    %edi,-0x20(%ebp)
+    return matchhere(re+1, text);
+ 201:	8d 43 01             	lea    0x1(%ebx),%eax
+ 204:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+ 210:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 213:	b8 ff 03 00 00       	mov    $0x3ff,%eax
+ 218:	83 ec 04             	sub    $0x4,%esp
+ 21b:	29 c8                	sub    %ecx,%eax
+ 21d:	50                   	push   %eax
+ 21e:	8d 81 60 13 00 00    	lea    0x1360(%ecx),%eax
+ 224:	50                   	push   %eax
+ 225:	ff 75 0c             	push   0xc(%ebp)
+ 228:	e8 0e 04 00 00       	call   63b <read>
+ 22d:	83 c4 10             	add    $0x10,%esp
+ 230:	85 c0                	test   %eax,%eax
+ 232:	0f 8e fd 00 00 00    	jle    335 <grep+0x145>
+    m += n;
+ 238:	01 45 e0             	add    %eax,-0x20(%ebp)
+ 23b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    buf[m] = '\0';
+ 23e:	bf 60 13 00 00       	mov    $0x1360,%edi
+ 243:	89 de                	mov    %ebx,%esi
+ 245:	c6 81 60 13 00 00 00 	movb   $0x0,0x1360(%ecx)
+    while((q = strchr(p, '\n')) != 0){
+ 24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 250:	83 ec 08             	sub    $0x8,%esp
+ 253:	6a 0a                	push   $0xa
+ 255:	57                   	push   %edi
+ 256:	e8 25 02 00 00       	call   480 <strchr>
+ 25b:	83 c4 10             	add    $0x10,%esp
+ 25e:	89 c2                	mov    %eax,%edx
+ 260:	85 c0                	test   %eax,%eax
+ 262:	0f 84 88 00 00 00    	je     2f0 <grep+0x100>
+      *q = 0;
+ 268:	c6 02 00             	movb   $0x0,(%edx)
+  if(re[0] == '^')
+ 26b:	80 3e 5e             	cmpb   $0x5e,(%esi)
+ 26e:	74 58                	je     2c8 <grep+0xd8>
+ 270:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 273:	89 d3                	mov    %edx,%ebx
+ 275:	eb 12                	jmp    289 <grep+0x99>
+ 277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27e:	66 90                	xchg   %ax,%ax
+  }while(*text++ != '\0');
+ 280:	83 c7 01             	add    $0x1,%edi
+ 283:	80 7f ff 00          	cmpb   $0x0,-0x1(%edi)
+ 287:	74 37                	je     2c0 <grep+0xd0>
+    if(matchhere(re, text))
+ 289:	83 ec 08             	sub    $0x8,%esp
+ 28c:	57                   	push   %edi
+ 28d:	56                   	push   %esi
+ 28e:	e8 2d fe ff ff       	call   c0 <matchhere>
+ 293:	83 c4 10             	add    $0x10,%esp
+ 296:	85 c0                	test   %eax,%eax
+ 298:	74 e6                	je     280 <grep+0x90>
+        write(1, p, q+1 - p);
+ 29a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 29d:	89 da                	mov    %ebx,%edx
+ 29f:	8d 5b 01             	lea    0x1(%ebx),%ebx
+ 2a2:	89 d8                	mov    %ebx,%eax
+ 2a4:	83 ec 04             	sub    $0x4,%esp
+        *q = '\n';
+ 2a7:	c6 02 0a             	movb   $0xa,(%edx)
+        write(1, p, q+1 - p);
+ 2aa:	29 f8                	sub    %edi,%eax
+ 2ac:	50                   	push   %eax
+ 2ad:	57                   	push   %edi
+ 2ae:	89 df                	mov    %ebx,%edi
+ 2b0:	6a 01                	push   $0x1
+ 2b2:	e8 8c 03 00 00       	call   643 <write>
+ 2b7:	83 c4 10             	add    $0x10,%esp
+ 2ba:	eb 94                	jmp    250 <grep+0x60>
+ 2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2c0:	8d 7b 01             	lea    0x1(%ebx),%edi
+      p = q+1;
+ 2c3:	eb 8b                	jmp    250 <grep+0x60>
+ 2c5:	8d 76 00             	lea    0x0(%esi),%esi
+    return matchhere(re+1, text);
+ 2c8:	83 ec 08             	sub    $0x8,%esp
+ 2cb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 2ce:	57                   	push   %edi
+ 2cf:	ff 75 dc             	push   -0x24(%ebp)
+ 2d2:	e8 e9 fd ff ff       	call   c0 <matchhere>
+        write(1, p, q+1 - p);
+ 2d7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    return matchhere(re+1, text);
+ 2da:	83 c4 10             	add    $0x10,%esp
+        write(1, p, q+1 - p);
+ 2dd:	8d 5a 01             	lea    0x1(%edx),%ebx
+      if(match(pattern, p)){
+ 2e0:	85 c0                	test   %eax,%eax
+ 2e2:	75 be                	jne    2a2 <grep+0xb2>
+        write(1, p, q+1 - p);
+ 2e4:	89 df                	mov    %ebx,%edi
+ 2e6:	e9 65 ff ff ff       	jmp    250 <grep+0x60>
+ 2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+    if(p == buf)
+ 2f0:	89 f3                	mov    %esi,%ebx
+ 2f2:	81 ff 60 13 00 00    	cmp    $0x1360,%edi
+ 2f8:	74 2f                	je     329 <grep+0x139>
+    if(m > 0){
+ 2fa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 2fd:	85 c0                	test   %eax,%eax
+ 2ff:	0f 8e 0b ff ff ff    	jle    210 <grep+0x20>
+      m -= p - buf;
+ 305:	89 f8                	mov    %edi,%eax
+      memmove(buf, p, m);
+ 307:	83 ec 04             	sub    $0x4,%esp
+      m -= p - buf;
+ 30a:	2d 60 13 00 00       	sub    $0x1360,%eax
+ 30f:	29 45 e0             	sub    %eax,-0x20(%ebp)
+ 312:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      memmove(buf, p, m);
+ 315:	51                   	push   %ecx
+ 316:	57                   	push   %edi
+ 317:	68 60 13 00 00       	push   $0x1360
+ 31c:	e8 8f 02 00 00       	call   5b0 <memmove>
+ 321:	83 c4 10             	add    $0x10,%esp
+ 324:	e9 e7 fe ff ff       	jmp    210 <grep+0x20>
+      m = 0;
+ 329:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+ 330:	e9 db fe ff ff       	jmp    210 <grep+0x20>
+}
+ 335:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 338:	5b                   	pop    %ebx
+ 339:	5e                   	pop    %esi
+ 33a:	5f                   	pop    %edi
+ 33b:	5d                   	pop    %ebp
+ 33c:	c3                   	ret
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000340 <matchstar>:
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	56                   	push   %esi
+ 345:	53                   	push   %ebx
+ 346:	83 ec 0c             	sub    $0xc,%esp
+ 349:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 34c:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 34f:	8b 7d 10             	mov    0x10(%ebp),%edi
+ 352:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(matchhere(re, text))
+ 358:	83 ec 08             	sub    $0x8,%esp
+ 35b:	57                   	push   %edi
+ 35c:	56                   	push   %esi
+ 35d:	e8 5e fd ff ff       	call   c0 <matchhere>
+ 362:	83 c4 10             	add    $0x10,%esp
+ 365:	85 c0                	test   %eax,%eax
+ 367:	75 1f                	jne    388 <matchstar+0x48>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 369:	0f be 17             	movsbl (%edi),%edx
+ 36c:	84 d2                	test   %dl,%dl
+ 36e:	74 0c                	je     37c <matchstar+0x3c>
+ 370:	83 c7 01             	add    $0x1,%edi
+ 373:	39 da                	cmp    %ebx,%edx
+ 375:	74 e1                	je     358 <matchstar+0x18>
+ 377:	83 fb 2e             	cmp    $0x2e,%ebx
+ 37a:	74 dc                	je     358 <matchstar+0x18>
+}
+ 37c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 37f:	5b                   	pop    %ebx
+ 380:	5e                   	pop    %esi
+ 381:	5f                   	pop    %edi
+ 382:	5d                   	pop    %ebp
+ 383:	c3                   	ret
+ 384:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 388:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 1;
+ 38b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 390:	5b                   	pop    %ebx
+ 391:	5e                   	pop    %esi
+ 392:	5f                   	pop    %edi
+ 393:	5d                   	pop    %ebp
+ 394:	c3                   	ret
+ 395:	66 90                	xchg   %ax,%ax
+ 397:	66 90                	xchg   %ax,%ax
+ 399:	66 90                	xchg   %ax,%ax
+ 39b:	66 90                	xchg   %ax,%ax
+ 39d:	66 90                	xchg   %ax,%ax
+ 39f:	90                   	nop
+
+000003a0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 3a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 3a1:	31 c0                	xor    %eax,%eax
+{
+ 3a3:	89 e5                	mov    %esp,%ebp
+ 3a5:	53                   	push   %ebx
+ 3a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 3b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 3b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 3b7:	83 c0 01             	add    $0x1,%eax
+ 3ba:	84 d2                	test   %dl,%dl
+ 3bc:	75 f2                	jne    3b0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 3be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3c1:	89 c8                	mov    %ecx,%eax
+ 3c3:	c9                   	leave
+ 3c4:	c3                   	ret
+ 3c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	53                   	push   %ebx
+ 3d4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 3da:	0f b6 02             	movzbl (%edx),%eax
+ 3dd:	84 c0                	test   %al,%al
+ 3df:	75 17                	jne    3f8 <strcmp+0x28>
+ 3e1:	eb 3a                	jmp    41d <strcmp+0x4d>
+ 3e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3e7:	90                   	nop
+ 3e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 3ec:	83 c2 01             	add    $0x1,%edx
+ 3ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 3f2:	84 c0                	test   %al,%al
+ 3f4:	74 1a                	je     410 <strcmp+0x40>
+    p++, q++;
+ 3f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 3f8:	0f b6 19             	movzbl (%ecx),%ebx
+ 3fb:	38 c3                	cmp    %al,%bl
+ 3fd:	74 e9                	je     3e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 3ff:	29 d8                	sub    %ebx,%eax
+}
+ 401:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 404:	c9                   	leave
+ 405:	c3                   	ret
+ 406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 410:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 414:	31 c0                	xor    %eax,%eax
+ 416:	29 d8                	sub    %ebx,%eax
+}
+ 418:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 41b:	c9                   	leave
+ 41c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 41d:	0f b6 19             	movzbl (%ecx),%ebx
+ 420:	31 c0                	xor    %eax,%eax
+ 422:	eb db                	jmp    3ff <strcmp+0x2f>
+ 424:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 42f:	90                   	nop
+
+00000430 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 436:	80 3a 00             	cmpb   $0x0,(%edx)
+ 439:	74 15                	je     450 <strlen+0x20>
+ 43b:	31 c0                	xor    %eax,%eax
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+ 440:	83 c0 01             	add    $0x1,%eax
+ 443:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 447:	89 c1                	mov    %eax,%ecx
+ 449:	75 f5                	jne    440 <strlen+0x10>
+    ;
+  return n;
+}
+ 44b:	89 c8                	mov    %ecx,%eax
+ 44d:	5d                   	pop    %ebp
+ 44e:	c3                   	ret
+ 44f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 450:	31 c9                	xor    %ecx,%ecx
+}
+ 452:	5d                   	pop    %ebp
+ 453:	89 c8                	mov    %ecx,%eax
+ 455:	c3                   	ret
+ 456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000460 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 467:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 46a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 46d:	89 d7                	mov    %edx,%edi
+ 46f:	fc                   	cld
+ 470:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 472:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 475:	89 d0                	mov    %edx,%eax
+ 477:	c9                   	leave
+ 478:	c3                   	ret
+ 479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	8b 45 08             	mov    0x8(%ebp),%eax
+ 486:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 48a:	0f b6 10             	movzbl (%eax),%edx
+ 48d:	84 d2                	test   %dl,%dl
+ 48f:	75 12                	jne    4a3 <strchr+0x23>
+ 491:	eb 1d                	jmp    4b0 <strchr+0x30>
+ 493:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 497:	90                   	nop
+ 498:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 49c:	83 c0 01             	add    $0x1,%eax
+ 49f:	84 d2                	test   %dl,%dl
+ 4a1:	74 0d                	je     4b0 <strchr+0x30>
+    if(*s == c)
+ 4a3:	38 d1                	cmp    %dl,%cl
+ 4a5:	75 f1                	jne    498 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 4a7:	5d                   	pop    %ebp
+ 4a8:	c3                   	ret
+ 4a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 4b0:	31 c0                	xor    %eax,%eax
+}
+ 4b2:	5d                   	pop    %ebp
+ 4b3:	c3                   	ret
+ 4b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4bf:	90                   	nop
+
+000004c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	57                   	push   %edi
+ 4c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 4c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 4c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 4c9:	31 db                	xor    %ebx,%ebx
+{
+ 4cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 4ce:	eb 27                	jmp    4f7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 4d0:	83 ec 04             	sub    $0x4,%esp
+ 4d3:	6a 01                	push   $0x1
+ 4d5:	56                   	push   %esi
+ 4d6:	6a 00                	push   $0x0
+ 4d8:	e8 5e 01 00 00       	call   63b <read>
+    if(cc < 1)
+ 4dd:	83 c4 10             	add    $0x10,%esp
+ 4e0:	85 c0                	test   %eax,%eax
+ 4e2:	7e 1d                	jle    501 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 4e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 4e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 4ef:	3c 0a                	cmp    $0xa,%al
+ 4f1:	74 10                	je     503 <gets+0x43>
+ 4f3:	3c 0d                	cmp    $0xd,%al
+ 4f5:	74 0c                	je     503 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 4f7:	89 df                	mov    %ebx,%edi
+ 4f9:	83 c3 01             	add    $0x1,%ebx
+ 4fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 4ff:	7c cf                	jl     4d0 <gets+0x10>
+ 501:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 503:	8b 45 08             	mov    0x8(%ebp),%eax
+ 506:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 50a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 50d:	5b                   	pop    %ebx
+ 50e:	5e                   	pop    %esi
+ 50f:	5f                   	pop    %edi
+ 510:	5d                   	pop    %ebp
+ 511:	c3                   	ret
+ 512:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 519:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000520 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	56                   	push   %esi
+ 524:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 525:	83 ec 08             	sub    $0x8,%esp
+ 528:	6a 00                	push   $0x0
+ 52a:	ff 75 08             	push   0x8(%ebp)
+ 52d:	e8 31 01 00 00       	call   663 <open>
+  if(fd < 0)
+ 532:	83 c4 10             	add    $0x10,%esp
+ 535:	85 c0                	test   %eax,%eax
+ 537:	78 27                	js     560 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 539:	83 ec 08             	sub    $0x8,%esp
+ 53c:	ff 75 0c             	push   0xc(%ebp)
+ 53f:	89 c3                	mov    %eax,%ebx
+ 541:	50                   	push   %eax
+ 542:	e8 34 01 00 00       	call   67b <fstat>
+  close(fd);
+ 547:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 54a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 54c:	e8 fa 00 00 00       	call   64b <close>
+  return r;
+ 551:	83 c4 10             	add    $0x10,%esp
+}
+ 554:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 557:	89 f0                	mov    %esi,%eax
+ 559:	5b                   	pop    %ebx
+ 55a:	5e                   	pop    %esi
+ 55b:	5d                   	pop    %ebp
+ 55c:	c3                   	ret
+ 55d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 560:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 565:	eb ed                	jmp    554 <stat+0x34>
+ 567:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56e:	66 90                	xchg   %ax,%ax
+
+00000570 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	53                   	push   %ebx
+ 574:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 577:	0f be 02             	movsbl (%edx),%eax
+ 57a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 57d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 580:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 585:	77 1e                	ja     5a5 <atoi+0x35>
+ 587:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 590:	83 c2 01             	add    $0x1,%edx
+ 593:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 596:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 59a:	0f be 02             	movsbl (%edx),%eax
+ 59d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 5a0:	80 fb 09             	cmp    $0x9,%bl
+ 5a3:	76 eb                	jbe    590 <atoi+0x20>
+  return n;
+}
+ 5a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5a8:	89 c8                	mov    %ecx,%eax
+ 5aa:	c9                   	leave
+ 5ab:	c3                   	ret
+ 5ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+ 5b4:	56                   	push   %esi
+ 5b5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 5be:	85 c0                	test   %eax,%eax
+ 5c0:	7e 13                	jle    5d5 <memmove+0x25>
+ 5c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 5c4:	89 d7                	mov    %edx,%edi
+ 5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 5d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 5d1:	39 f8                	cmp    %edi,%eax
+ 5d3:	75 fb                	jne    5d0 <memmove+0x20>
+  return vdst;
+}
+ 5d5:	5e                   	pop    %esi
+ 5d6:	89 d0                	mov    %edx,%eax
+ 5d8:	5f                   	pop    %edi
+ 5d9:	5d                   	pop    %ebp
+ 5da:	c3                   	ret
+
+000005db <ccreate>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(ccreate)
+ 5db:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <cfork>:
+SYSCALL(cfork)
+ 5e3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <cgetrootdir>:
+SYSCALL(cgetrootdir)
+ 5eb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <getcontrootdir>:
+SYSCALL(getcontrootdir)
+ 5f3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <cpause>:
+SYSCALL(cpause)
+ 5fb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <cresume>:
+SYSCALL(cresume)
+ 603:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <cstart>:
+SYSCALL(cstart)
+ 60b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <cstop>:
+SYSCALL(cstop)
+ 613:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <fork>:
+SYSCALL(fork)
+ 61b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <exit>:
+SYSCALL(exit)
+ 623:	b8 02 00 00 00       	mov    $0x2,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <wait>:
+SYSCALL(wait)
+ 62b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <pipe>:
+SYSCALL(pipe)
+ 633:	b8 04 00 00 00       	mov    $0x4,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <read>:
+SYSCALL(read)
+ 63b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <write>:
+SYSCALL(write)
+ 643:	b8 10 00 00 00       	mov    $0x10,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <close>:
+SYSCALL(close)
+ 64b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <kill>:
+SYSCALL(kill)
+ 653:	b8 06 00 00 00       	mov    $0x6,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <exec>:
+SYSCALL(exec)
+ 65b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <open>:
+SYSCALL(open)
+ 663:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <mknod>:
+SYSCALL(mknod)
+ 66b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <unlink>:
+SYSCALL(unlink)
+ 673:	b8 12 00 00 00       	mov    $0x12,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <fstat>:
+SYSCALL(fstat)
+ 67b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <link>:
+SYSCALL(link)
+ 683:	b8 13 00 00 00       	mov    $0x13,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <mkdir>:
+SYSCALL(mkdir)
+ 68b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <chdir>:
+SYSCALL(chdir)
+ 693:	b8 09 00 00 00       	mov    $0x9,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <dup>:
+SYSCALL(dup)
+ 69b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <getpid>:
+SYSCALL(getpid)
+ 6a3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <sbrk>:
+SYSCALL(sbrk)
+ 6ab:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <sleep>:
+SYSCALL(sleep)
+ 6b3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <uptime>:
+SYSCALL(uptime)
+ 6bb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <cps>:
+SYSCALL(cps)
+ 6c3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <mmap>:
+SYSCALL(mmap)
+ 6cb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <munmap>:
+SYSCALL(munmap)
+ 6d3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <shmget>:
+SYSCALL(shmget)
+ 6db:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <climit>:
+SYSCALL(climit)
+ 6e3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <spawn>:
+SYSCALL(spawn)
+ 6eb:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <clone>:
+SYSCALL(clone)
+ 6f3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <join>:
+SYSCALL(join)
+ 6fb:	b8 25 00 00 00       	mov    $0x25,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <futex>:
+SYSCALL(futex)
+ 703:	b8 26 00 00 00       	mov    $0x26,%eax
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <ccheckpoint>:
+SYSCALL(ccheckpoint)
+ 70b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+
+00000713 <crestore>:
+SYSCALL(crestore)
+ 713:	b8 28 00 00 00       	mov    $0x28,%eax
+ 718:	cd 40                	int    $0x40
+ 71a:	c3                   	ret
+
+0000071b <czygote>:
+SYSCALL(czygote)
+ 71b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <memstats>:
+SYSCALL(memstats)
+ 723:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 728:	cd 40                	int    $0x40
+ 72a:	c3                   	ret
+ 72b:	66 90                	xchg   %ax,%ax
+ 72d:	66 90                	xchg   %ax,%ax
+ 72f:	90                   	nop
+
+00000730 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 730:	55                   	push   %ebp
+ 731:	89 e5                	mov    %esp,%ebp
+ 733:	57                   	push   %edi
+ 734:	56                   	push   %esi
+ 735:	53                   	push   %ebx
+ 736:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 738:	89 d1                	mov    %edx,%ecx
+{
+ 73a:	83 ec 3c             	sub    $0x3c,%esp
+ 73d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 740:	85 d2                	test   %edx,%edx
+ 742:	0f 89 80 00 00 00    	jns    7c8 <printint+0x98>
+ 748:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 74c:	74 7a                	je     7c8 <printint+0x98>
+    x = -xx;
+ 74e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 750:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 755:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 758:	31 f6                	xor    %esi,%esi
+ 75a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 760:	89 c8                	mov    %ecx,%eax
+ 762:	31 d2                	xor    %edx,%edx
+ 764:	89 f7                	mov    %esi,%edi
+ 766:	f7 f3                	div    %ebx
+ 768:	8d 76 01             	lea    0x1(%esi),%esi
+ 76b:	0f b6 92 58 0f 00 00 	movzbl 0xf58(%edx),%edx
+ 772:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 776:	89 ca                	mov    %ecx,%edx
+ 778:	89 c1                	mov    %eax,%ecx
+ 77a:	39 da                	cmp    %ebx,%edx
+ 77c:	73 e2                	jae    760 <printint+0x30>
+  if(neg)
+ 77e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 781:	85 c0                	test   %eax,%eax
+ 783:	74 07                	je     78c <printint+0x5c>
+    buf[i++] = '-';
+ 785:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 78a:	89 f7                	mov    %esi,%edi
+ 78c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 78f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 792:	01 df                	add    %ebx,%edi
+ 794:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 798:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 79b:	83 ec 04             	sub    $0x4,%esp
+ 79e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 7a1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 7a4:	6a 01                	push   $0x1
+ 7a6:	50                   	push   %eax
+ 7a7:	56                   	push   %esi
+ 7a8:	e8 96 fe ff ff       	call   643 <write>
+  while(--i >= 0)
+ 7ad:	89 f8                	mov    %edi,%eax
+ 7af:	83 c4 10             	add    $0x10,%esp
+ 7b2:	83 ef 01             	sub    $0x1,%edi
+ 7b5:	39 d8                	cmp    %ebx,%eax
+ 7b7:	75 df                	jne    798 <printint+0x68>
+}
+ 7b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7bc:	5b                   	pop    %ebx
+ 7bd:	5e                   	pop    %esi
+ 7be:	5f                   	pop    %edi
+ 7bf:	5d                   	pop    %ebp
+ 7c0:	c3                   	ret
+ 7c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 7c8:	31 c0                	xor    %eax,%eax
+ 7ca:	eb 89                	jmp    755 <printint+0x25>
+ 7cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 7d0:	55                   	push   %ebp
+ 7d1:	89 e5                	mov    %esp,%ebp
+ 7d3:	57                   	push   %edi
+ 7d4:	56                   	push   %esi
+ 7d5:	53                   	push   %ebx
+ 7d6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 7d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 7dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 7df:	0f b6 1e             	movzbl (%esi),%ebx
+ 7e2:	83 c6 01             	add    $0x1,%esi
+ 7e5:	84 db                	test   %bl,%bl
+ 7e7:	74 67                	je     850 <printf+0x80>
+ 7e9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 7ec:	31 d2                	xor    %edx,%edx
+ 7ee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 7f1:	eb 34                	jmp    827 <printf+0x57>
+ 7f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7f7:	90                   	nop
+ 7f8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 7fb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 800:	83 f8 25             	cmp    $0x25,%eax
+ 803:	74 18                	je     81d <printf+0x4d>
+  write(fd, &c, 1);
+ 805:	83 ec 04             	sub    $0x4,%esp
+ 808:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 80b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 80e:	6a 01                	push   $0x1
+ 810:	50                   	push   %eax
+ 811:	57                   	push   %edi
+ 812:	e8 2c fe ff ff       	call   643 <write>
+ 817:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 81a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 81d:	0f b6 1e             	movzbl (%esi),%ebx
+ 820:	83 c6 01             	add    $0x1,%esi
+ 823:	84 db                	test   %bl,%bl
+ 825:	74 29                	je     850 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 827:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 82a:	85 d2                	test   %edx,%edx
+ 82c:	74 ca                	je     7f8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 82e:	83 fa 25             	cmp    $0x25,%edx
+ 831:	75 ea                	jne    81d <printf+0x4d>
+      if(c == 'd'){
+ 833:	83 f8 25             	cmp    $0x25,%eax
+ 836:	0f 84 24 01 00 00    	je     960 <printf+0x190>
+ 83c:	83 e8 63             	sub    $0x63,%eax
+ 83f:	83 f8 15             	cmp    $0x15,%eax
+ 842:	77 1c                	ja     860 <printf+0x90>
+ 844:	ff 24 85 00 0f 00 00 	jmp    *0xf00(,%eax,4)
+ 84b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 84f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 850:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 853:	5b                   	pop    %ebx
+ 854:	5e                   	pop    %esi
+ 855:	5f                   	pop    %edi
+ 856:	5d                   	pop    %ebp
+ 857:	c3                   	ret
+ 858:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 85f:	90                   	nop
+  write(fd, &c, 1);
+ 860:	83 ec 04             	sub    $0x4,%esp
+ 863:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 866:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 86a:	6a 01                	push   $0x1
+ 86c:	52                   	push   %edx
+ 86d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 870:	57                   	push   %edi
+ 871:	e8 cd fd ff ff       	call   643 <write>
+ 876:	83 c4 0c             	add    $0xc,%esp
+ 879:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 87c:	6a 01                	push   $0x1
+ 87e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 881:	52                   	push   %edx
+ 882:	57                   	push   %edi
+ 883:	e8 bb fd ff ff       	call   643 <write>
+        putc(fd, c);
+ 888:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 88b:	31 d2                	xor    %edx,%edx
+ 88d:	eb 8e                	jmp    81d <printf+0x4d>
+ 88f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 890:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 893:	83 ec 0c             	sub    $0xc,%esp
+ 896:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 89b:	8b 13                	mov    (%ebx),%edx
+ 89d:	6a 00                	push   $0x0
+ 89f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 8a1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 8a4:	e8 87 fe ff ff       	call   730 <printint>
+        ap++;
+ 8a9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8af:	31 d2                	xor    %edx,%edx
+ 8b1:	e9 67 ff ff ff       	jmp    81d <printf+0x4d>
+ 8b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 8c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 8c3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 8c5:	83 c0 04             	add    $0x4,%eax
+ 8c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 8cb:	85 db                	test   %ebx,%ebx
+ 8cd:	0f 84 9d 00 00 00    	je     970 <printf+0x1a0>
+        while(*s != 0){
+ 8d3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 8d6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 8d8:	84 c0                	test   %al,%al
+ 8da:	0f 84 3d ff ff ff    	je     81d <printf+0x4d>
+ 8e0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8e3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 8e6:	89 de                	mov    %ebx,%esi
+ 8e8:	89 d3                	mov    %edx,%ebx
+ 8ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 8f0:	83 ec 04             	sub    $0x4,%esp
+ 8f3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 8f6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 8f9:	6a 01                	push   $0x1
+ 8fb:	53                   	push   %ebx
+ 8fc:	57                   	push   %edi
+ 8fd:	e8 41 fd ff ff       	call   643 <write>
+        while(*s != 0){
+ 902:	0f b6 06             	movzbl (%esi),%eax
+ 905:	83 c4 10             	add    $0x10,%esp
+ 908:	84 c0                	test   %al,%al
+ 90a:	75 e4                	jne    8f0 <printf+0x120>
+      state = 0;
+ 90c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 90f:	31 d2                	xor    %edx,%edx
+ 911:	e9 07 ff ff ff       	jmp    81d <printf+0x4d>
+ 916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 91d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 920:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 923:	83 ec 0c             	sub    $0xc,%esp
+ 926:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 92b:	8b 13                	mov    (%ebx),%edx
+ 92d:	6a 01                	push   $0x1
+ 92f:	e9 6b ff ff ff       	jmp    89f <printf+0xcf>
+ 934:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 938:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 93b:	83 ec 04             	sub    $0x4,%esp
+ 93e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 941:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 943:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 946:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 949:	6a 01                	push   $0x1
+ 94b:	52                   	push   %edx
+ 94c:	57                   	push   %edi
+ 94d:	e8 f1 fc ff ff       	call   643 <write>
+        ap++;
+ 952:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 955:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 958:	31 d2                	xor    %edx,%edx
+ 95a:	e9 be fe ff ff       	jmp    81d <printf+0x4d>
+ 95f:	90                   	nop
+  write(fd, &c, 1);
+ 960:	83 ec 04             	sub    $0x4,%esp
+ 963:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 966:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 969:	6a 01                	push   $0x1
+ 96b:	e9 11 ff ff ff       	jmp    881 <printf+0xb1>
+ 970:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 975:	bb f6 0e 00 00       	mov    $0xef6,%ebx
+ 97a:	e9 61 ff ff ff       	jmp    8e0 <printf+0x110>
+ 97f:	90                   	nop
+
+00000980 <runfree>:
+
+// Give the n pages at r back to the free runs, merging them with
+// adjacent runs, and shrink the heap if the end of it is free.
+static void
+runfree(struct page *r, uint n)
+{
+ 980:	55                   	push   %ebp
+  struct page **pp, *prev;
+
+  r->kind = PFREE;
+ 981:	b9 03 00 00 00       	mov    $0x3,%ecx
+{
+ 986:	89 e5                	mov    %esp,%ebp
+ 988:	57                   	push   %edi
+ 989:	56                   	push   %esi
+ 98a:	53                   	push   %ebx
+ 98b:	89 c3                	mov    %eax,%ebx
+ 98d:	83 ec 0c             	sub    $0xc,%esp
+  r->kind = PFREE;
+ 990:	66 89 08             	mov    %cx,(%eax)
+  r->npages = n;
+  prev = 0;
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 993:	8b 0d 64 17 00 00    	mov    0x1764,%ecx
+  r->npages = n;
+ 999:	89 50 04             	mov    %edx,0x4(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 99c:	85 c9                	test   %ecx,%ecx
+ 99e:	0f 84 1f 01 00 00    	je     ac3 <runfree+0x143>
+ 9a4:	39 c1                	cmp    %eax,%ecx
+ 9a6:	0f 83 f7 00 00 00    	jae    aa3 <runfree+0x123>
+ 9ac:	89 c8                	mov    %ecx,%eax
+ 9ae:	eb 04                	jmp    9b4 <runfree+0x34>
+ 9b0:	39 d8                	cmp    %ebx,%eax
+ 9b2:	73 09                	jae    9bd <runfree+0x3d>
+ 9b4:	89 c2                	mov    %eax,%edx
+ 9b6:	8b 40 14             	mov    0x14(%eax),%eax
+ 9b9:	85 c0                	test   %eax,%eax
+ 9bb:	75 f3                	jne    9b0 <runfree+0x30>
+    prev = *pp;
+  r->next = *pp;
+ 9bd:	89 43 14             	mov    %eax,0x14(%ebx)
+  *pp = r;
+ 9c0:	89 5a 14             	mov    %ebx,0x14(%edx)
+
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 9c3:	8b 43 14             	mov    0x14(%ebx),%eax
+ 9c6:	85 c0                	test   %eax,%eax
+ 9c8:	74 12                	je     9dc <runfree+0x5c>
+ 9ca:	8b 7b 04             	mov    0x4(%ebx),%edi
+ 9cd:	89 fe                	mov    %edi,%esi
+ 9cf:	c1 e6 0c             	shl    $0xc,%esi
+ 9d2:	01 de                	add    %ebx,%esi
+ 9d4:	39 f0                	cmp    %esi,%eax
+ 9d6:	0f 84 a4 00 00 00    	je     a80 <runfree+0x100>
+    r->npages += r->next->npages;
+    r->next = r->next->next;
+  }
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 9dc:	8b 72 04             	mov    0x4(%edx),%esi
+ 9df:	89 f0                	mov    %esi,%eax
+ 9e1:	c1 e0 0c             	shl    $0xc,%eax
+ 9e4:	01 d0                	add    %edx,%eax
+ 9e6:	39 c3                	cmp    %eax,%ebx
+ 9e8:	74 16                	je     a00 <runfree+0x80>
+    pp = &runs;
+    while(*pp != r)
+      pp = &(*pp)->next;
+  }
+
+  if(r->next == 0 && r->npages >= TRIM &&
+ 9ea:	8b 43 14             	mov    0x14(%ebx),%eax
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 9ed:	8d 72 14             	lea    0x14(%edx),%esi
+  if(r->next == 0 && r->npages >= TRIM &&
+ 9f0:	85 c0                	test   %eax,%eax
+ 9f2:	74 3c                	je     a30 <runfree+0xb0>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+    *pp = 0;
+    sbrk(-(int)(r->npages*PGSIZE));
+    heapend = (char*)r;
+  }
+}
+ 9f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9f7:	5b                   	pop    %ebx
+ 9f8:	5e                   	pop    %esi
+ 9f9:	5f                   	pop    %edi
+ 9fa:	5d                   	pop    %ebp
+ 9fb:	c3                   	ret
+ 9fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    prev->npages += r->npages;
+ a00:	03 73 04             	add    0x4(%ebx),%esi
+ a03:	89 72 04             	mov    %esi,0x4(%edx)
+    prev->next = r->next;
+ a06:	8b 43 14             	mov    0x14(%ebx),%eax
+ a09:	89 42 14             	mov    %eax,0x14(%edx)
+    while(*pp != r)
+ a0c:	39 d1                	cmp    %edx,%ecx
+ a0e:	0f 84 c5 00 00 00    	je     ad9 <runfree+0x159>
+ a14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      pp = &(*pp)->next;
+ a18:	89 cb                	mov    %ecx,%ebx
+ a1a:	8b 49 14             	mov    0x14(%ecx),%ecx
+    while(*pp != r)
+ a1d:	39 d1                	cmp    %edx,%ecx
+ a1f:	75 f7                	jne    a18 <runfree+0x98>
+      pp = &(*pp)->next;
+ a21:	8d 73 14             	lea    0x14(%ebx),%esi
+ a24:	89 cb                	mov    %ecx,%ebx
+  if(r->next == 0 && r->npages >= TRIM &&
+ a26:	85 c0                	test   %eax,%eax
+ a28:	75 ca                	jne    9f4 <runfree+0x74>
+ a2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ a30:	8b 53 04             	mov    0x4(%ebx),%edx
+ a33:	83 fa 1f             	cmp    $0x1f,%edx
+ a36:	76 bc                	jbe    9f4 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ a38:	c1 e2 0c             	shl    $0xc,%edx
+ a3b:	01 da                	add    %ebx,%edx
+  if(r->next == 0 && r->npages >= TRIM &&
+ a3d:	39 15 60 17 00 00    	cmp    %edx,0x1760
+ a43:	75 af                	jne    9f4 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ a45:	83 ec 0c             	sub    $0xc,%esp
+ a48:	6a 00                	push   $0x0
+ a4a:	e8 5c fc ff ff       	call   6ab <sbrk>
+ a4f:	83 c4 10             	add    $0x10,%esp
+ a52:	39 05 60 17 00 00    	cmp    %eax,0x1760
+ a58:	75 9a                	jne    9f4 <runfree+0x74>
+    *pp = 0;
+ a5a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    sbrk(-(int)(r->npages*PGSIZE));
+ a60:	8b 43 04             	mov    0x4(%ebx),%eax
+ a63:	83 ec 0c             	sub    $0xc,%esp
+ a66:	c1 e0 0c             	shl    $0xc,%eax
+ a69:	f7 d8                	neg    %eax
+ a6b:	50                   	push   %eax
+ a6c:	e8 3a fc ff ff       	call   6ab <sbrk>
+    heapend = (char*)r;
+ a71:	89 1d 60 17 00 00    	mov    %ebx,0x1760
+ a77:	83 c4 10             	add    $0x10,%esp
+}
+ a7a:	e9 75 ff ff ff       	jmp    9f4 <runfree+0x74>
+ a7f:	90                   	nop
+    r->npages += r->next->npages;
+ a80:	03 78 04             	add    0x4(%eax),%edi
+ a83:	89 7b 04             	mov    %edi,0x4(%ebx)
+    r->next = r->next->next;
+ a86:	8b 40 14             	mov    0x14(%eax),%eax
+ a89:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ a8c:	8b 72 04             	mov    0x4(%edx),%esi
+ a8f:	89 f0                	mov    %esi,%eax
+ a91:	c1 e0 0c             	shl    $0xc,%eax
+ a94:	01 d0                	add    %edx,%eax
+ a96:	39 c3                	cmp    %eax,%ebx
+ a98:	0f 85 4c ff ff ff    	jne    9ea <runfree+0x6a>
+ a9e:	e9 5d ff ff ff       	jmp    a00 <runfree+0x80>
+  r->next = *pp;
+ aa3:	89 48 14             	mov    %ecx,0x14(%eax)
+  *pp = r;
+ aa6:	a3 64 17 00 00       	mov    %eax,0x1764
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ aab:	89 d0                	mov    %edx,%eax
+ aad:	c1 e0 0c             	shl    $0xc,%eax
+ ab0:	01 d8                	add    %ebx,%eax
+ ab2:	39 c1                	cmp    %eax,%ecx
+ ab4:	74 2f                	je     ae5 <runfree+0x165>
+  if(r->next == 0 && r->npages >= TRIM &&
+ ab6:	8b 43 14             	mov    0x14(%ebx),%eax
+ ab9:	be 64 17 00 00       	mov    $0x1764,%esi
+ abe:	e9 2d ff ff ff       	jmp    9f0 <runfree+0x70>
+  r->next = *pp;
+ ac3:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ aca:	be 64 17 00 00       	mov    $0x1764,%esi
+  *pp = r;
+ acf:	a3 64 17 00 00       	mov    %eax,0x1764
+  if(r->next == 0 && r->npages >= TRIM &&
+ ad4:	e9 5a ff ff ff       	jmp    a33 <runfree+0xb3>
+    while(*pp != r)
+ ad9:	89 cb                	mov    %ecx,%ebx
+    pp = &runs;
+ adb:	be 64 17 00 00       	mov    $0x1764,%esi
+ ae0:	e9 0b ff ff ff       	jmp    9f0 <runfree+0x70>
+    r->npages += r->next->npages;
+ ae5:	03 51 04             	add    0x4(%ecx),%edx
+ ae8:	89 53 04             	mov    %edx,0x4(%ebx)
+    r->next = r->next->next;
+ aeb:	8b 41 14             	mov    0x14(%ecx),%eax
+ aee:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ af1:	eb c3                	jmp    ab6 <runfree+0x136>
+ af3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ afa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000b00 <runalloc>:
+
+// Take a run of n pages from the start of the first free run
+// long enough, which keeps the end of the heap free to trim.
+static struct page*
+runalloc(uint n)
+{
+ b00:	55                   	push   %ebp
+ b01:	89 e5                	mov    %esp,%ebp
+ b03:	57                   	push   %edi
+ b04:	56                   	push   %esi
+ b05:	89 c6                	mov    %eax,%esi
+ b07:	53                   	push   %ebx
+ b08:	83 ec 1c             	sub    $0x1c,%esp
+  struct page **pp, *r, *rest;
+
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ b0b:	8b 1d 64 17 00 00    	mov    0x1764,%ebx
+ b11:	85 db                	test   %ebx,%ebx
+ b13:	74 4d                	je     b62 <runalloc+0x62>
+ b15:	b9 64 17 00 00       	mov    $0x1764,%ecx
+    if(r->npages < n)
+ b1a:	39 73 04             	cmp    %esi,0x4(%ebx)
+ b1d:	72 39                	jb     b58 <runalloc+0x58>
+      continue;
+    if(r->npages == n){
+ b1f:	0f 84 9b 00 00 00    	je     bc0 <runalloc+0xc0>
+      *pp = r->next;
+    } else {
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ b25:	89 f0                	mov    %esi,%eax
+      rest->kind = PFREE;
+ b27:	ba 03 00 00 00       	mov    $0x3,%edx
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ b2c:	c1 e0 0c             	shl    $0xc,%eax
+ b2f:	01 d8                	add    %ebx,%eax
+      rest->kind = PFREE;
+ b31:	66 89 10             	mov    %dx,(%eax)
+      rest->npages = r->npages - n;
+ b34:	8b 53 04             	mov    0x4(%ebx),%edx
+ b37:	29 f2                	sub    %esi,%edx
+ b39:	89 50 04             	mov    %edx,0x4(%eax)
+      rest->next = r->next;
+ b3c:	8b 53 14             	mov    0x14(%ebx),%edx
+ b3f:	89 50 14             	mov    %edx,0x14(%eax)
+      *pp = rest;
+ b42:	89 01                	mov    %eax,(%ecx)
+      r->npages = n;
+ b44:	89 73 04             	mov    %esi,0x4(%ebx)
+    }
+    return r;
+  }
+  return morecore(n);
+}
+ b47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b4a:	89 d8                	mov    %ebx,%eax
+ b4c:	5b                   	pop    %ebx
+ b4d:	5e                   	pop    %esi
+ b4e:	5f                   	pop    %edi
+ b4f:	5d                   	pop    %ebp
+ b50:	c3                   	ret
+ b51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ b58:	8d 4b 14             	lea    0x14(%ebx),%ecx
+ b5b:	8b 5b 14             	mov    0x14(%ebx),%ebx
+ b5e:	85 db                	test   %ebx,%ebx
+ b60:	75 b8                	jne    b1a <runalloc+0x1a>
+  m = n < MINCORE ? MINCORE : n;
+ b62:	bf 08 00 00 00       	mov    $0x8,%edi
+ b67:	39 fe                	cmp    %edi,%esi
+ b69:	0f 43 fe             	cmovae %esi,%edi
+  brk = sbrk(0);
+ b6c:	83 ec 0c             	sub    $0xc,%esp
+ b6f:	6a 00                	push   $0x0
+ b71:	e8 35 fb ff ff       	call   6ab <sbrk>
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ b76:	89 fa                	mov    %edi,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ b78:	89 c3                	mov    %eax,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ b7a:	c1 e2 0c             	shl    $0xc,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ b7d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ b80:	f7 db                	neg    %ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ b82:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ b85:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ b8b:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+ b8e:	89 04 24             	mov    %eax,(%esp)
+ b91:	e8 15 fb ff ff       	call   6ab <sbrk>
+ b96:	83 c4 10             	add    $0x10,%esp
+ b99:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ b9c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ b9f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ ba2:	74 3e                	je     be2 <runalloc+0xe2>
+  r = (struct page*)(brk + pad);
+ ba4:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ ba6:	01 da                	add    %ebx,%edx
+ ba8:	89 15 60 17 00 00    	mov    %edx,0x1760
+  if(m > n)
+ bae:	39 fe                	cmp    %edi,%esi
+ bb0:	72 1e                	jb     bd0 <runalloc+0xd0>
+  r->npages = n;
+ bb2:	89 73 04             	mov    %esi,0x4(%ebx)
+  return r;
+ bb5:	eb 90                	jmp    b47 <runalloc+0x47>
+ bb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bbe:	66 90                	xchg   %ax,%ax
+      *pp = r->next;
+ bc0:	8b 43 14             	mov    0x14(%ebx),%eax
+ bc3:	89 01                	mov    %eax,(%ecx)
+}
+ bc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ bc8:	89 d8                	mov    %ebx,%eax
+ bca:	5b                   	pop    %ebx
+ bcb:	5e                   	pop    %esi
+ bcc:	5f                   	pop    %edi
+ bcd:	5d                   	pop    %ebp
+ bce:	c3                   	ret
+ bcf:	90                   	nop
+    runfree((struct page*)((char*)r + n*PGSIZE), m - n);
+ bd0:	89 f0                	mov    %esi,%eax
+ bd2:	29 f7                	sub    %esi,%edi
+ bd4:	c1 e0 0c             	shl    $0xc,%eax
+ bd7:	89 fa                	mov    %edi,%edx
+ bd9:	01 d8                	add    %ebx,%eax
+ bdb:	e8 a0 fd ff ff       	call   980 <runfree>
+ be0:	eb d0                	jmp    bb2 <runalloc+0xb2>
+    if(sbrk(pad + m*PGSIZE) == (char*)-1)
+ be2:	89 f7                	mov    %esi,%edi
+ be4:	83 ec 0c             	sub    $0xc,%esp
+ be7:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ bea:	c1 e7 0c             	shl    $0xc,%edi
+ bed:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+ bf0:	50                   	push   %eax
+ bf1:	e8 b5 fa ff ff       	call   6ab <sbrk>
+ bf6:	83 c4 10             	add    $0x10,%esp
+ bf9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ bfc:	83 f8 ff             	cmp    $0xffffffff,%eax
+ bff:	74 0c                	je     c0d <runalloc+0x10d>
+  r = (struct page*)(brk + pad);
+ c01:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ c03:	01 df                	add    %ebx,%edi
+ c05:	89 3d 60 17 00 00    	mov    %edi,0x1760
+  if(m > n)
+ c0b:	eb a5                	jmp    bb2 <runalloc+0xb2>
+      return 0;
+ c0d:	31 db                	xor    %ebx,%ebx
+ c0f:	e9 33 ff ff ff       	jmp    b47 <runalloc+0x47>
+ c14:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c1f:	90                   	nop
+
+00000c20 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+ c20:	55                   	push   %ebp
+ c21:	89 e5                	mov    %esp,%ebp
+ c23:	56                   	push   %esi
+ c24:	53                   	push   %ebx
+ c25:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  struct page *p;
+
+  if(ap == 0)
+ c28:	85 c9                	test   %ecx,%ecx
+ c2a:	74 1c                	je     c48 <free+0x28>
+    return;
+  p = (struct page*)((uint)ap & ~(PGSIZE-1));
+ c2c:	89 c8                	mov    %ecx,%eax
+ c2e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  switch(p->kind){
+ c33:	0f b7 10             	movzwl (%eax),%edx
+ c36:	66 83 fa 02          	cmp    $0x2,%dx
+ c3a:	74 14                	je     c50 <free+0x30>
+ c3c:	66 83 fa 04          	cmp    $0x4,%dx
+ c40:	74 66                	je     ca8 <free+0x88>
+ c42:	66 83 fa 01          	cmp    $0x1,%dx
+ c46:	74 18                	je     c60 <free+0x40>
+    break;
+  case PMAP:
+    munmap(p, p->npages*PGSIZE);
+    break;
+  }
+}
+ c48:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ c4b:	5b                   	pop    %ebx
+ c4c:	5e                   	pop    %esi
+ c4d:	5d                   	pop    %ebp
+ c4e:	c3                   	ret
+ c4f:	90                   	nop
+    runfree(p, p->npages);
+ c50:	8b 50 04             	mov    0x4(%eax),%edx
+}
+ c53:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ c56:	5b                   	pop    %ebx
+ c57:	5e                   	pop    %esi
+ c58:	5d                   	pop    %ebp
+    runfree(p, p->npages);
+ c59:	e9 22 fd ff ff       	jmp    980 <runfree>
+ c5e:	66 90                	xchg   %ax,%ax
+  b->next = p->free;
+ c60:	8b 50 0c             	mov    0xc(%eax),%edx
+ c63:	89 11                	mov    %edx,(%ecx)
+  if(p->nfree++ == 0)
+ c65:	8b 50 08             	mov    0x8(%eax),%edx
+  p->free = b;
+ c68:	89 48 0c             	mov    %ecx,0xc(%eax)
+  if(p->nfree++ == 0)
+ c6b:	8d 5a 01             	lea    0x1(%edx),%ebx
+ c6e:	89 58 08             	mov    %ebx,0x8(%eax)
+ c71:	85 d2                	test   %edx,%edx
+ c73:	74 53                	je     cc8 <free+0xa8>
+  if(p->nfree == nblocks(p->class)){
+ c75:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ c79:	8d 4e 04             	lea    0x4(%esi),%ecx
+ c7c:	ba e0 0f 00 00       	mov    $0xfe0,%edx
+ c81:	d3 fa                	sar    %cl,%edx
+  if(p->nfree == nblocks(p->class)){
+ c83:	39 da                	cmp    %ebx,%edx
+ c85:	75 c1                	jne    c48 <free+0x28>
+  if(p->prev)
+ c87:	8b 48 18             	mov    0x18(%eax),%ecx
+    p->prev->next = p->next;
+ c8a:	8b 50 14             	mov    0x14(%eax),%edx
+  if(p->prev)
+ c8d:	85 c9                	test   %ecx,%ecx
+ c8f:	74 6f                	je     d00 <free+0xe0>
+    p->prev->next = p->next;
+ c91:	89 51 14             	mov    %edx,0x14(%ecx)
+  if(p->next)
+ c94:	85 d2                	test   %edx,%edx
+ c96:	74 06                	je     c9e <free+0x7e>
+    p->next->prev = p->prev;
+ c98:	8b 48 18             	mov    0x18(%eax),%ecx
+ c9b:	89 4a 18             	mov    %ecx,0x18(%edx)
+    runfree(p, 1);
+ c9e:	ba 01 00 00 00       	mov    $0x1,%edx
+ ca3:	eb ae                	jmp    c53 <free+0x33>
+ ca5:	8d 76 00             	lea    0x0(%esi),%esi
+    munmap(p, p->npages*PGSIZE);
+ ca8:	8b 50 04             	mov    0x4(%eax),%edx
+ cab:	83 ec 08             	sub    $0x8,%esp
+ cae:	c1 e2 0c             	shl    $0xc,%edx
+ cb1:	52                   	push   %edx
+ cb2:	50                   	push   %eax
+ cb3:	e8 1b fa ff ff       	call   6d3 <munmap>
+    break;
+ cb8:	83 c4 10             	add    $0x10,%esp
+}
+ cbb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ cbe:	5b                   	pop    %ebx
+ cbf:	5e                   	pop    %esi
+ cc0:	5d                   	pop    %ebp
+ cc1:	c3                   	ret
+ cc2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  p->next = partial[p->class];
+ cc8:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  p->prev = 0;
+ ccc:	c7 40 18 00 00 00 00 	movl   $0x0,0x18(%eax)
+  p->next = partial[p->class];
+ cd3:	bb 01 00 00 00       	mov    $0x1,%ebx
+ cd8:	8b 14 b5 68 17 00 00 	mov    0x1768(,%esi,4),%edx
+ cdf:	89 50 14             	mov    %edx,0x14(%eax)
+  if(p->next)
+ ce2:	85 d2                	test   %edx,%edx
+ ce4:	74 0a                	je     cf0 <free+0xd0>
+    p->next->prev = p;
+ ce6:	89 42 18             	mov    %eax,0x18(%edx)
+  partial[p->class] = p;
+ ce9:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  if(p->nfree == nblocks(p->class)){
+ ced:	8b 58 08             	mov    0x8(%eax),%ebx
+  partial[p->class] = p;
+ cf0:	89 04 b5 68 17 00 00 	mov    %eax,0x1768(,%esi,4)
+}
+ cf7:	eb 80                	jmp    c79 <free+0x59>
+ cf9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ d00:	89 14 b5 68 17 00 00 	mov    %edx,0x1768(,%esi,4)
+ d07:	eb 8b                	jmp    c94 <free+0x74>
+ d09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000d10 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ d10:	55                   	push   %ebp
+ d11:	89 e5                	mov    %esp,%ebp
+ d13:	56                   	push   %esi
+ d14:	53                   	push   %ebx
+ d15:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct page *p;
+  uint n;
+
+  if(nbytes <= MAXSMALL)
+ d18:	3d 00 04 00 00       	cmp    $0x400,%eax
+ d1d:	76 71                	jbe    d90 <malloc+0x80>
+    return smallalloc(sizeclass(nbytes));
+  if(nbytes > 0x7fffffff)
+ d1f:	85 c0                	test   %eax,%eax
+ d21:	0f 88 d9 00 00 00    	js     e00 <malloc+0xf0>
+    return 0;
+  n = (nbytes + HDRSIZE + PGSIZE-1) / PGSIZE;
+ d27:	8d 90 1f 10 00 00    	lea    0x101f(%eax),%edx
+ d2d:	89 d3                	mov    %edx,%ebx
+ d2f:	c1 eb 0c             	shr    $0xc,%ebx
+  if(nbytes >= MAPMIN){
+ d32:	3d ff ff 00 00       	cmp    $0xffff,%eax
+ d37:	77 27                	ja     d60 <malloc+0x50>
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    if(p == MAP_FAILED)
+      return 0;
+    p->kind = PMAP;
+  } else {
+    if((p = runalloc(n)) == 0)
+ d39:	89 d8                	mov    %ebx,%eax
+ d3b:	e8 c0 fd ff ff       	call   b00 <runalloc>
+ d40:	85 c0                	test   %eax,%eax
+ d42:	0f 84 b8 00 00 00    	je     e00 <malloc+0xf0>
+      return 0;
+    p->kind = PRUN;
+ d48:	ba 02 00 00 00       	mov    $0x2,%edx
+ d4d:	66 89 10             	mov    %dx,(%eax)
+  }
+  p->npages = n;
+ d50:	89 58 04             	mov    %ebx,0x4(%eax)
+  return (char*)p + HDRSIZE;
+ d53:	8d 58 20             	lea    0x20(%eax),%ebx
+}
+ d56:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ d59:	89 d8                	mov    %ebx,%eax
+ d5b:	5b                   	pop    %ebx
+ d5c:	5e                   	pop    %esi
+ d5d:	5d                   	pop    %ebp
+ d5e:	c3                   	ret
+ d5f:	90                   	nop
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+ d60:	83 ec 08             	sub    $0x8,%esp
+ d63:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+ d69:	6a 00                	push   $0x0
+ d6b:	6a ff                	push   $0xffffffff
+ d6d:	6a 22                	push   $0x22
+ d6f:	6a 03                	push   $0x3
+ d71:	52                   	push   %edx
+ d72:	6a 00                	push   $0x0
+ d74:	e8 52 f9 ff ff       	call   6cb <mmap>
+    if(p == MAP_FAILED)
+ d79:	83 c4 20             	add    $0x20,%esp
+ d7c:	83 f8 ff             	cmp    $0xffffffff,%eax
+ d7f:	74 7f                	je     e00 <malloc+0xf0>
+    p->kind = PMAP;
+ d81:	b9 04 00 00 00       	mov    $0x4,%ecx
+ d86:	66 89 08             	mov    %cx,(%eax)
+ d89:	eb c5                	jmp    d50 <malloc+0x40>
+ d8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d8f:	90                   	nop
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ d90:	83 f8 10             	cmp    $0x10,%eax
+ d93:	0f 86 07 01 00 00    	jbe    ea0 <malloc+0x190>
+ d99:	31 db                	xor    %ebx,%ebx
+ d9b:	ba 10 00 00 00       	mov    $0x10,%edx
+ da0:	83 c3 01             	add    $0x1,%ebx
+ da3:	89 d6                	mov    %edx,%esi
+ da5:	89 d9                	mov    %ebx,%ecx
+ da7:	d3 e6                	shl    %cl,%esi
+ da9:	39 c6                	cmp    %eax,%esi
+ dab:	72 f3                	jb     da0 <malloc+0x90>
+  if((p = partial[c]) == 0){
+ dad:	8b 14 9d 68 17 00 00 	mov    0x1768(,%ebx,4),%edx
+ db4:	85 d2                	test   %edx,%edx
+ db6:	74 58                	je     e10 <malloc+0x100>
+  if((b = p->free) != 0){
+ db8:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ dbb:	8b 4a 08             	mov    0x8(%edx),%ecx
+  if((b = p->free) != 0){
+ dbe:	85 db                	test   %ebx,%ebx
+ dc0:	0f 84 aa 00 00 00    	je     e70 <malloc+0x160>
+    p->free = b->next;
+ dc6:	8b 03                	mov    (%ebx),%eax
+ dc8:	89 42 0c             	mov    %eax,0xc(%edx)
+  if(--p->nfree == 0)
+ dcb:	83 e9 01             	sub    $0x1,%ecx
+ dce:	89 4a 08             	mov    %ecx,0x8(%edx)
+ dd1:	75 83                	jne    d56 <malloc+0x46>
+  if(p->prev)
+ dd3:	8b 4a 18             	mov    0x18(%edx),%ecx
+    p->prev->next = p->next;
+ dd6:	8b 42 14             	mov    0x14(%edx),%eax
+  if(p->prev)
+ dd9:	85 c9                	test   %ecx,%ecx
+ ddb:	0f 84 cf 00 00 00    	je     eb0 <malloc+0x1a0>
+    p->prev->next = p->next;
+ de1:	89 41 14             	mov    %eax,0x14(%ecx)
+  if(p->next)
+ de4:	85 c0                	test   %eax,%eax
+ de6:	0f 84 6a ff ff ff    	je     d56 <malloc+0x46>
+    p->next->prev = p->prev;
+ dec:	8b 52 18             	mov    0x18(%edx),%edx
+ def:	89 50 18             	mov    %edx,0x18(%eax)
+ df2:	e9 5f ff ff ff       	jmp    d56 <malloc+0x46>
+ df7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dfe:	66 90                	xchg   %ax,%ax
+}
+ e00:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+ e03:	31 db                	xor    %ebx,%ebx
+}
+ e05:	89 d8                	mov    %ebx,%eax
+ e07:	5b                   	pop    %ebx
+ e08:	5e                   	pop    %esi
+ e09:	5d                   	pop    %ebp
+ e0a:	c3                   	ret
+ e0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ e0f:	90                   	nop
+    if((p = runalloc(1)) == 0)
+ e10:	b8 01 00 00 00       	mov    $0x1,%eax
+ e15:	e8 e6 fc ff ff       	call   b00 <runalloc>
+ e1a:	89 c2                	mov    %eax,%edx
+ e1c:	85 c0                	test   %eax,%eax
+ e1e:	74 e0                	je     e00 <malloc+0xf0>
+    p->kind = PSMALL;
+ e20:	b8 01 00 00 00       	mov    $0x1,%eax
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ e25:	8d 4b 04             	lea    0x4(%ebx),%ecx
+    p->class = c;
+ e28:	66 89 5a 02          	mov    %bx,0x2(%edx)
+ e2c:	0f b7 db             	movzwl %bx,%ebx
+    p->kind = PSMALL;
+ e2f:	66 89 02             	mov    %ax,(%edx)
+    p->fresh = (char*)p + HDRSIZE;
+ e32:	8d 42 20             	lea    0x20(%edx),%eax
+ e35:	89 42 10             	mov    %eax,0x10(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ e38:	b8 e0 0f 00 00       	mov    $0xfe0,%eax
+ e3d:	d3 f8                	sar    %cl,%eax
+    p->free = 0;
+ e3f:	c7 42 0c 00 00 00 00 	movl   $0x0,0xc(%edx)
+    p->nfree = nblocks(c);
+ e46:	89 42 08             	mov    %eax,0x8(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ e49:	89 c1                	mov    %eax,%ecx
+  p->next = partial[p->class];
+ e4b:	8b 04 9d 68 17 00 00 	mov    0x1768(,%ebx,4),%eax
+  p->prev = 0;
+ e52:	c7 42 18 00 00 00 00 	movl   $0x0,0x18(%edx)
+  p->next = partial[p->class];
+ e59:	89 42 14             	mov    %eax,0x14(%edx)
+  if(p->next)
+ e5c:	85 c0                	test   %eax,%eax
+ e5e:	75 20                	jne    e80 <malloc+0x170>
+  partial[p->class] = p;
+ e60:	89 14 9d 68 17 00 00 	mov    %edx,0x1768(,%ebx,4)
+  if((b = p->free) != 0){
+ e67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e6e:	66 90                	xchg   %ax,%ax
+    b = (struct block*)p->fresh;
+ e70:	8b 5a 10             	mov    0x10(%edx),%ebx
+    p->fresh += MINSMALL << c;
+ e73:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+ e76:	89 42 10             	mov    %eax,0x10(%edx)
+ e79:	e9 4d ff ff ff       	jmp    dcb <malloc+0xbb>
+ e7e:	66 90                	xchg   %ax,%ax
+    p->next->prev = p;
+ e80:	89 50 18             	mov    %edx,0x18(%eax)
+  partial[p->class] = p;
+ e83:	0f b7 42 02          	movzwl 0x2(%edx),%eax
+  if((b = p->free) != 0){
+ e87:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ e8a:	8b 4a 08             	mov    0x8(%edx),%ecx
+  partial[p->class] = p;
+ e8d:	89 14 85 68 17 00 00 	mov    %edx,0x1768(,%eax,4)
+}
+ e94:	e9 25 ff ff ff       	jmp    dbe <malloc+0xae>
+ e99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ ea0:	be 10 00 00 00       	mov    $0x10,%esi
+ ea5:	31 db                	xor    %ebx,%ebx
+ ea7:	e9 01 ff ff ff       	jmp    dad <malloc+0x9d>
+ eac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ eb0:	0f b7 4a 02          	movzwl 0x2(%edx),%ecx
+ eb4:	89 04 8d 68 17 00 00 	mov    %eax,0x1768(,%ecx,4)
+ ebb:	e9 24 ff ff ff       	jmp    de4 <malloc+0xd4>
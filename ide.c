@@ -1,4 +1,12 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// Simple IDE driver code.
+//
+// If the PCI IDE controller can be a bus master, as QEMU's PIIX
+// can, the disk moves the data itself (DMA): idestart fills in a
+// table of physical regions (PRDs) and the CPU is free until the
+// interrupt. A run of queued requests for consecutive blocks in
+// the same direction becomes one transfer, gathered from or
+// scattered to the buffers. Otherwise the driver moves every
+// word with programmed I/O (PIO).
 
 #include "types.h"
 #include "defs.h"
@@ -23,9 +31,41 @@
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_RDDMA 0xc8
+#define IDE_CMD_WRDMA 0xca
+#define IDE_CMD_SETMUL 0xc6
 
-// idequeue points to the buf now being read/written to the disk.
-// idequeue->qnext points to the next buf to be processed.
+#define MAXMULT       16    // most sectors QEMU moves per READ/WRITE MULTIPLE interrupt
+
+// Bus master registers of the primary channel.
+#define BM_CMD        0
+#define BM_STATUS     2
+#define BM_PRDT       4
+#define BM_START      0x01  // in BM_CMD
+#define BM_READ       0x08  // in BM_CMD: disk to memory
+#define BM_ERR        0x02  // in BM_STATUS
+#define BM_INTR       0x04  // in BM_STATUS
+
+#define READDL        50    // ticks a read may wait before it goes next
+#define WRITEDL       500   // ticks a write may wait
+
+#define NPRD          32    // most buffers in one transfer
+#define PRD_EOT       0x8000
+
+// Physical region descriptor.
+struct prd {
+  uint addr;
+  ushort len;
+  ushort flags;
+};
+
+// idequeue points to the buf now being read/written to the disk,
+// followed by the others in the same transfer (idenbuf in all).
+// The rest of the queue waits, sorted for the elevator: C-LOOK,
+// in ascending block order from idepos, where the last transfer
+// ended, then from the lowest block again. A request that has
+// waited past its deadline, which is shorter for reads so that
+// a burst of writes does not starve them, goes next instead.
 // You must hold idelock while manipulating queue.
 
 static struct spinlock idelock;
@@ -33,6 +73,14 @@ static struct buf *idequeue;
 
 static int havedisk1;
 static void idestart(struct buf*);
+static void idedmainit(void);
+static void idedeadline(void);
+
+static ushort bmbase;  // bus master registers; 0 for PIO
+static int idenbuf;    // buffers in the transfer now running
+static uint idepos;    // block after the last transfer started
+// The PRD table must not cross a 64KB boundary.
+static struct prd prdt[NPRD] __attribute__((aligned(sizeof(struct prd)*NPRD)));
 
 // Wait for IDE disk to become ready.
 static int
@@ -65,8 +113,82 @@ ideinit(void)
     }
   }
 
+  // Have READ/WRITE MULTIPLE move a whole block per interrupt.
+  if(BSIZE/SECTOR_SIZE > 1){
+    for(i = 0; i <= havedisk1; i++){
+      outb(0x1f6, 0xe0 | (i<<4));
+      outb(0x1f2, BSIZE/SECTOR_SIZE);
+      outb(0x1f7, IDE_CMD_SETMUL);
+      idewait(0);
+    }
+  }
+
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0<<4));
+
+  idedmainit();
+}
+
+// Find the PCI IDE controller and let it be a bus master,
+// if it can. Its bus master registers are in BAR4.
+static void
+idedmainit(void)
+{
+  int f;
+  uint bar;
+
+  if((f = pcifindclass(0x01, 0x01)) < 0)  // mass storage, IDE
+    return;
+  if((pciread(f, 0x08) & (0x80 << 8)) == 0)  // prog if: no bus master
+    return;
+  bar = pciread(f, 0x20);
+  if((bar & 1) == 0)  // not in I/O space
+    return;
+  pciwrite(f, 0x04, pciread(f, 0x04) | 0x5);  // I/O space, bus master
+  bmbase = bar & ~3;
+}
+
+// Start a DMA transfer for b and the requests queued after it
+// for the blocks that follow, in the same direction.
+// Caller must hold idelock.
+static void
+idestartdma(struct buf *b)
+{
+  int sector_per_block = BSIZE/SECTOR_SIZE;
+  int sector = b->blockno * sector_per_block;
+  int write = (b->flags & B_DIRTY) != 0;
+  struct buf *q;
+  int n;
+
+  n = 0;
+  for(q = b; q && n < NPRD && (n+1) * sector_per_block <= 256; q = q->qnext){
+    if(q->dev != b->dev || q->blockno != b->blockno + n ||
+       ((q->flags & B_DIRTY) != 0) != write)
+      break;
+    if(q->blockno >= FSSIZE + SWAPSIZE)
+      panic("incorrect blockno");
+    prdt[n].addr = V2P(q->data);
+    prdt[n].len = BSIZE;
+    prdt[n].flags = 0;
+    n++;
+  }
+  prdt[n-1].flags = PRD_EOT;
+  idenbuf = n;
+  idepos = b->blockno + n;
+
+  outl(bmbase + BM_PRDT, V2P(prdt));
+  outb(bmbase + BM_CMD, write ? 0 : BM_READ);
+  outb(bmbase + BM_STATUS, BM_ERR | BM_INTR);  // clear
+
+  idewait(0);
+  outb(0x3f6, 0);  // generate interrupt
+  outb(0x1f2, (n * sector_per_block) & 0xff);  // number of sectors, 0 is 256
+  outb(0x1f3, sector & 0xff);
+  outb(0x1f4, (sector >> 8) & 0xff);
+  outb(0x1f5, (sector >> 16) & 0xff);
+  outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
+  outb(0x1f7, write ? IDE_CMD_WRDMA : IDE_CMD_RDDMA);
+  outb(bmbase + BM_CMD, (write ? 0 : BM_READ) | BM_START);
 }
 
 // Start the request for b.  Caller must hold idelock.
@@ -75,14 +197,20 @@ idestart(struct buf *b)
 {
   if(b == 0)
     panic("idestart");
-  if(b->blockno >= FSSIZE)
+  if(b->blockno >= FSSIZE + SWAPSIZE)
     panic("incorrect blockno");
   int sector_per_block =  BSIZE/SECTOR_SIZE;
   int sector = b->blockno * sector_per_block;
   int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
   int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
 
-  if (sector_per_block > 7) panic("idestart");
+  if(bmbase){
+    idestartdma(b);
+    return;
+  }
+  idenbuf = 1;
+  idepos = b->blockno + 1;
+  if (sector_per_block > MAXMULT) panic("idestart");
 
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
@@ -99,11 +227,27 @@ idestart(struct buf *b)
   }
 }
 
+// Finish the request for b, which is off the queue.
+// Caller must hold idelock.
+static void
+idedone(struct buf *b)
+{
+  // Wake process waiting for this buf.
+  b->flags |= B_VALID;
+  b->flags &= ~B_DIRTY;
+  if(b->flags & B_ASYNC)
+    bdone(b);
+  else
+    wakeup(b);
+}
+
 // Interrupt handler.
 void
 ideintr(void)
 {
   struct buf *b;
+  uchar st;
+  int i;
 
   // First queued buffer is the active request.
   acquire(&idelock);
@@ -112,32 +256,83 @@ ideintr(void)
     release(&idelock);
     return;
   }
-  idequeue = b->qnext;
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE/4);
+  if(bmbase){
+    // The transfer covers the first idenbuf buffers.
+    st = inb(bmbase + BM_STATUS);
+    if((st & BM_INTR) == 0){  // not done; not ours
+      release(&idelock);
+      return;
+    }
+    outb(bmbase + BM_CMD, 0);
+    outb(bmbase + BM_STATUS, BM_ERR | BM_INTR);
+    if(idewait(1) < 0 || (st & BM_ERR))
+      cprintf("ide: dma error, block %d\n", b->blockno);
+    for(i = 0; i < idenbuf; i++){
+      b = idequeue;
+      idequeue = b->qnext;
+      idedone(b);
+    }
+  } else {
+    idequeue = b->qnext;
+
+    // Read data if needed.
+    if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
+      insl(0x1f0, b->data, BSIZE/4);
 
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+    idedone(b);
+  }
 
   // Start disk on next buf in queue.
-  if(idequeue != 0)
+  if(idequeue != 0){
+    idedeadline();
     idestart(idequeue);
+  }
 
   release(&idelock);
 }
 
 //PAGEBREAK!
-// Sync buf with disk.
-// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
-// Else if B_VALID is not set, read buf from disk, set B_VALID.
-void
-iderw(struct buf *b)
+// Does a go before b in C-LOOK order from idepos?
+static int
+idebefore(struct buf *a, struct buf *b)
+{
+  int wrapa = a->blockno < idepos;
+  int wrapb = b->blockno < idepos;
+
+  if(wrapa != wrapb)
+    return wrapb;
+  return a->blockno < b->blockno;
+}
+
+// Move the waiting request whose deadline passed longest ago,
+// if any, to the head of the queue. The disk is idle.
+// Caller must hold idelock.
+static void
+idedeadline(void)
+{
+  struct buf **pp, **late, *b;
+
+  late = 0;
+  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)
+    if((int)(ticks - (*pp)->deadline) >= 0 &&
+       (late == 0 || (int)((*pp)->deadline - (*late)->deadline) < 0))
+      late = pp;
+  if(late == 0 || *late == idequeue)
+    return;
+  b = *late;
+  *late = b->qnext;
+  b->qnext = idequeue;
+  idequeue = b;
+}
+
+// Queue b's request and start the disk if it is idle.
+// Caller must hold idelock.
+static void
+idequeueb(struct buf *b)
 {
   struct buf **pp;
+  int i;
 
   if(!holdingsleep(&b->lock))
     panic("iderw: buf not locked");
@@ -146,23 +341,53 @@ iderw(struct buf *b)
   if(b->dev != 0 && !havedisk1)
     panic("iderw: ide disk 1 not present");
 
-  acquire(&idelock);  //DOC:acquire-lock
-
-  // Append b to idequeue.
-  b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+  // Insert b into idequeue in elevator order, after
+  // the transfer in progress.
+  b->deadline = ticks + ((b->flags & B_DIRTY) ? WRITEDL : READDL);
+  pp = &idequeue;
+  for(i = 0; i < idenbuf && *pp; i++)
+    pp = &(*pp)->qnext;
+  for(; *pp && !idebefore(b, *pp); pp=&(*pp)->qnext)  //DOC:insert-queue
     ;
+  b->qnext = *pp;
   *pp = b;
 
   // Start disk if necessary.
   if(idequeue == b)
     idestart(b);
+}
+
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderw(struct buf *b)
+{
+  // The root disk may be a virtio disk instead.
+  if(b->dev == ROOTDEV && virtiorw(b) == 0)
+    return;
+
+  acquire(&idelock);  //DOC:acquire-lock
+
+  idequeueb(b);
 
   // Wait for request to finish.
   while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
     sleep(b, &idelock);
   }
 
+  release(&idelock);
+}
 
+// Start syncing b, which has B_ASYNC set, with disk and return.
+// The interrupt handler calls bdone(b) when the disk is done.
+void
+iderwasync(struct buf *b)
+{
+  if(b->dev == ROOTDEV && virtiorw(b) == 0)
+    return;
+
+  acquire(&idelock);
+  idequeueb(b);
   release(&idelock);
 }
@@ -0,0 +1,1764 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+   f:	83 ec 08             	sub    $0x8,%esp
+  12:	6a 02                	push   $0x2
+  14:	68 00 0c 00 00       	push   $0xc00
+  19:	e8 85 03 00 00       	call   3a3 <open>
+  1e:	83 c4 10             	add    $0x10,%esp
+  21:	85 c0                	test   %eax,%eax
+  23:	0f 88 8d 00 00 00    	js     b6 <main+0xb6>
+    mknod("console", 1, 1);
+    open("console", O_RDWR);
+  }
+  dup(0);  // stdout
+  29:	83 ec 0c             	sub    $0xc,%esp
+  2c:	6a 00                	push   $0x0
+  2e:	e8 a8 03 00 00       	call   3db <dup>
+  dup(0);  // stderr
+  33:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  3a:	e8 9c 03 00 00       	call   3db <dup>
+  3f:	83 c4 10             	add    $0x10,%esp
+  42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+  48:	83 ec 08             	sub    $0x8,%esp
+  4b:	68 08 0c 00 00       	push   $0xc08
+  50:	6a 01                	push   $0x1
+  52:	e8 b9 04 00 00       	call   510 <printf>
+    pid = fork();
+  57:	e8 ff 02 00 00       	call   35b <fork>
+    if(pid < 0){
+  5c:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+  5f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+  61:	85 c0                	test   %eax,%eax
+  63:	78 1a                	js     7f <main+0x7f>
+      printf(1, "init: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+  65:	74 2b                	je     92 <main+0x92>
+  67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6e:	66 90                	xchg   %ax,%ax
+      exec("sh", argv);
+      printf(1, "init: exec sh failed\n");
+      exit();
+    }
+    while((wpid=wait()) >= 0 && wpid != pid);
+  70:	e8 f6 02 00 00       	call   36b <wait>
+  75:	85 c0                	test   %eax,%eax
+  77:	78 cf                	js     48 <main+0x48>
+  79:	39 c3                	cmp    %eax,%ebx
+  7b:	75 f3                	jne    70 <main+0x70>
+  7d:	eb c9                	jmp    48 <main+0x48>
+      printf(1, "init: fork failed\n");
+  7f:	53                   	push   %ebx
+  80:	53                   	push   %ebx
+  81:	68 1b 0c 00 00       	push   $0xc1b
+  86:	6a 01                	push   $0x1
+  88:	e8 83 04 00 00       	call   510 <printf>
+      exit();
+  8d:	e8 d1 02 00 00       	call   363 <exit>
+      exec("sh", argv);
+  92:	50                   	push   %eax
+  93:	50                   	push   %eax
+  94:	68 b8 0f 00 00       	push   $0xfb8
+  99:	68 2e 0c 00 00       	push   $0xc2e
+  9e:	e8 f8 02 00 00       	call   39b <exec>
+      printf(1, "init: exec sh failed\n");
+  a3:	5a                   	pop    %edx
+  a4:	59                   	pop    %ecx
+  a5:	68 31 0c 00 00       	push   $0xc31
+  aa:	6a 01                	push   $0x1
+  ac:	e8 5f 04 00 00       	call   510 <printf>
+      exit();
+  b1:	e8 ad 02 00 00       	call   363 <exit>
+    mknod("console", 1, 1);
+  b6:	50                   	push   %eax
+  b7:	6a 01                	push   $0x1
+  b9:	6a 01                	push   $0x1
+  bb:	68 00 0c 00 00       	push   $0xc00
+  c0:	e8 e6 02 00 00       	call   3ab <mknod>
+    open("console", O_RDWR);
+  c5:	58                   	pop    %eax
+  c6:	5a                   	pop    %edx
+  c7:	6a 02                	push   $0x2
+  c9:	68 00 0c 00 00       	push   $0xc00
+  ce:	e8 d0 02 00 00       	call   3a3 <open>
+  d3:	83 c4 10             	add    $0x10,%esp
+  d6:	e9 4e ff ff ff       	jmp    29 <main+0x29>
+  db:	66 90                	xchg   %ax,%ax
+  dd:	66 90                	xchg   %ax,%ax
+  df:	90                   	nop
+
+000000e0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  e0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  e1:	31 c0                	xor    %eax,%eax
+{
+  e3:	89 e5                	mov    %esp,%ebp
+  e5:	53                   	push   %ebx
+  e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  f7:	83 c0 01             	add    $0x1,%eax
+  fa:	84 d2                	test   %dl,%dl
+  fc:	75 f2                	jne    f0 <strcpy+0x10>
+    ;
+  return os;
+}
+  fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 101:	89 c8                	mov    %ecx,%eax
+ 103:	c9                   	leave
+ 104:	c3                   	ret
+ 105:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000110 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	53                   	push   %ebx
+ 114:	8b 55 08             	mov    0x8(%ebp),%edx
+ 117:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 11a:	0f b6 02             	movzbl (%edx),%eax
+ 11d:	84 c0                	test   %al,%al
+ 11f:	75 17                	jne    138 <strcmp+0x28>
+ 121:	eb 3a                	jmp    15d <strcmp+0x4d>
+ 123:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 127:	90                   	nop
+ 128:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 12c:	83 c2 01             	add    $0x1,%edx
+ 12f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 132:	84 c0                	test   %al,%al
+ 134:	74 1a                	je     150 <strcmp+0x40>
+    p++, q++;
+ 136:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 138:	0f b6 19             	movzbl (%ecx),%ebx
+ 13b:	38 c3                	cmp    %al,%bl
+ 13d:	74 e9                	je     128 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 13f:	29 d8                	sub    %ebx,%eax
+}
+ 141:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 144:	c9                   	leave
+ 145:	c3                   	ret
+ 146:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 150:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 154:	31 c0                	xor    %eax,%eax
+ 156:	29 d8                	sub    %ebx,%eax
+}
+ 158:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 15b:	c9                   	leave
+ 15c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 15d:	0f b6 19             	movzbl (%ecx),%ebx
+ 160:	31 c0                	xor    %eax,%eax
+ 162:	eb db                	jmp    13f <strcmp+0x2f>
+ 164:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 16f:	90                   	nop
+
+00000170 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 170:	55                   	push   %ebp
+ 171:	89 e5                	mov    %esp,%ebp
+ 173:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 176:	80 3a 00             	cmpb   $0x0,(%edx)
+ 179:	74 15                	je     190 <strlen+0x20>
+ 17b:	31 c0                	xor    %eax,%eax
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+ 180:	83 c0 01             	add    $0x1,%eax
+ 183:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 187:	89 c1                	mov    %eax,%ecx
+ 189:	75 f5                	jne    180 <strlen+0x10>
+    ;
+  return n;
+}
+ 18b:	89 c8                	mov    %ecx,%eax
+ 18d:	5d                   	pop    %ebp
+ 18e:	c3                   	ret
+ 18f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 190:	31 c9                	xor    %ecx,%ecx
+}
+ 192:	5d                   	pop    %ebp
+ 193:	89 c8                	mov    %ecx,%eax
+ 195:	c3                   	ret
+ 196:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001a0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ad:	89 d7                	mov    %edx,%edi
+ 1af:	fc                   	cld
+ 1b0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1b5:	89 d0                	mov    %edx,%eax
+ 1b7:	c9                   	leave
+ 1b8:	c3                   	ret
+ 1b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001c0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1ca:	0f b6 10             	movzbl (%eax),%edx
+ 1cd:	84 d2                	test   %dl,%dl
+ 1cf:	75 12                	jne    1e3 <strchr+0x23>
+ 1d1:	eb 1d                	jmp    1f0 <strchr+0x30>
+ 1d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1d7:	90                   	nop
+ 1d8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1dc:	83 c0 01             	add    $0x1,%eax
+ 1df:	84 d2                	test   %dl,%dl
+ 1e1:	74 0d                	je     1f0 <strchr+0x30>
+    if(*s == c)
+ 1e3:	38 d1                	cmp    %dl,%cl
+ 1e5:	75 f1                	jne    1d8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1e7:	5d                   	pop    %ebp
+ 1e8:	c3                   	ret
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 1f0:	31 c0                	xor    %eax,%eax
+}
+ 1f2:	5d                   	pop    %ebp
+ 1f3:	c3                   	ret
+ 1f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1ff:	90                   	nop
+
+00000200 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	57                   	push   %edi
+ 204:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 205:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 208:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 209:	31 db                	xor    %ebx,%ebx
+{
+ 20b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 20e:	eb 27                	jmp    237 <gets+0x37>
+    cc = read(0, &c, 1);
+ 210:	83 ec 04             	sub    $0x4,%esp
+ 213:	6a 01                	push   $0x1
+ 215:	56                   	push   %esi
+ 216:	6a 00                	push   $0x0
+ 218:	e8 5e 01 00 00       	call   37b <read>
+    if(cc < 1)
+ 21d:	83 c4 10             	add    $0x10,%esp
+ 220:	85 c0                	test   %eax,%eax
+ 222:	7e 1d                	jle    241 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 224:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 228:	8b 55 08             	mov    0x8(%ebp),%edx
+ 22b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 22f:	3c 0a                	cmp    $0xa,%al
+ 231:	74 10                	je     243 <gets+0x43>
+ 233:	3c 0d                	cmp    $0xd,%al
+ 235:	74 0c                	je     243 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 237:	89 df                	mov    %ebx,%edi
+ 239:	83 c3 01             	add    $0x1,%ebx
+ 23c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 23f:	7c cf                	jl     210 <gets+0x10>
+ 241:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 243:	8b 45 08             	mov    0x8(%ebp),%eax
+ 246:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 24a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 24d:	5b                   	pop    %ebx
+ 24e:	5e                   	pop    %esi
+ 24f:	5f                   	pop    %edi
+ 250:	5d                   	pop    %ebp
+ 251:	c3                   	ret
+ 252:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	56                   	push   %esi
+ 264:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 265:	83 ec 08             	sub    $0x8,%esp
+ 268:	6a 00                	push   $0x0
+ 26a:	ff 75 08             	push   0x8(%ebp)
+ 26d:	e8 31 01 00 00       	call   3a3 <open>
+  if(fd < 0)
+ 272:	83 c4 10             	add    $0x10,%esp
+ 275:	85 c0                	test   %eax,%eax
+ 277:	78 27                	js     2a0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 279:	83 ec 08             	sub    $0x8,%esp
+ 27c:	ff 75 0c             	push   0xc(%ebp)
+ 27f:	89 c3                	mov    %eax,%ebx
+ 281:	50                   	push   %eax
+ 282:	e8 34 01 00 00       	call   3bb <fstat>
+  close(fd);
+ 287:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 28a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 28c:	e8 fa 00 00 00       	call   38b <close>
+  return r;
+ 291:	83 c4 10             	add    $0x10,%esp
+}
+ 294:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 297:	89 f0                	mov    %esi,%eax
+ 299:	5b                   	pop    %ebx
+ 29a:	5e                   	pop    %esi
+ 29b:	5d                   	pop    %ebp
+ 29c:	c3                   	ret
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2a5:	eb ed                	jmp    294 <stat+0x34>
+ 2a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ae:	66 90                	xchg   %ax,%ax
+
+000002b0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	53                   	push   %ebx
+ 2b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2b7:	0f be 02             	movsbl (%edx),%eax
+ 2ba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2bd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2c5:	77 1e                	ja     2e5 <atoi+0x35>
+ 2c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 2d0:	83 c2 01             	add    $0x1,%edx
+ 2d3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 2d6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 2da:	0f be 02             	movsbl (%edx),%eax
+ 2dd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2e0:	80 fb 09             	cmp    $0x9,%bl
+ 2e3:	76 eb                	jbe    2d0 <atoi+0x20>
+  return n;
+}
+ 2e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2e8:	89 c8                	mov    %ecx,%eax
+ 2ea:	c9                   	leave
+ 2eb:	c3                   	ret
+ 2ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002f0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	57                   	push   %edi
+ 2f4:	56                   	push   %esi
+ 2f5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 2fe:	85 c0                	test   %eax,%eax
+ 300:	7e 13                	jle    315 <memmove+0x25>
+ 302:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 304:	89 d7                	mov    %edx,%edi
+ 306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 310:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 311:	39 f8                	cmp    %edi,%eax
+ 313:	75 fb                	jne    310 <memmove+0x20>
+  return vdst;
+}
+ 315:	5e                   	pop    %esi
+ 316:	89 d0                	mov    %edx,%eax
+ 318:	5f                   	pop    %edi
+ 319:	5d                   	pop    %ebp
+ 31a:	c3                   	ret
+
+0000031b <ccreate>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(ccreate)
+ 31b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <cfork>:
+SYSCALL(cfork)
+ 323:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <cgetrootdir>:
+SYSCALL(cgetrootdir)
+ 32b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <getcontrootdir>:
+SYSCALL(getcontrootdir)
+ 333:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <cpause>:
+SYSCALL(cpause)
+ 33b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <cresume>:
+SYSCALL(cresume)
+ 343:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <cstart>:
+SYSCALL(cstart)
+ 34b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <cstop>:
+SYSCALL(cstop)
+ 353:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <fork>:
+SYSCALL(fork)
+ 35b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <exit>:
+SYSCALL(exit)
+ 363:	b8 02 00 00 00       	mov    $0x2,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <wait>:
+SYSCALL(wait)
+ 36b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <pipe>:
+SYSCALL(pipe)
+ 373:	b8 04 00 00 00       	mov    $0x4,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <read>:
+SYSCALL(read)
+ 37b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <write>:
+SYSCALL(write)
+ 383:	b8 10 00 00 00       	mov    $0x10,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <close>:
+SYSCALL(close)
+ 38b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <kill>:
+SYSCALL(kill)
+ 393:	b8 06 00 00 00       	mov    $0x6,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <exec>:
+SYSCALL(exec)
+ 39b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <open>:
+SYSCALL(open)
+ 3a3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <mknod>:
+SYSCALL(mknod)
+ 3ab:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <unlink>:
+SYSCALL(unlink)
+ 3b3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <fstat>:
+SYSCALL(fstat)
+ 3bb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <link>:
+SYSCALL(link)
+ 3c3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <mkdir>:
+SYSCALL(mkdir)
+ 3cb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <chdir>:
+SYSCALL(chdir)
+ 3d3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <dup>:
+SYSCALL(dup)
+ 3db:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <getpid>:
+SYSCALL(getpid)
+ 3e3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <sbrk>:
+SYSCALL(sbrk)
+ 3eb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <sleep>:
+SYSCALL(sleep)
+ 3f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <uptime>:
+SYSCALL(uptime)
+ 3fb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <cps>:
+SYSCALL(cps)
+ 403:	b8 16 00 00 00       	mov    $0x16,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <mmap>:
+SYSCALL(mmap)
+ 40b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <munmap>:
+SYSCALL(munmap)
+ 413:	b8 20 00 00 00       	mov    $0x20,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <shmget>:
+SYSCALL(shmget)
+ 41b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <climit>:
+SYSCALL(climit)
+ 423:	b8 22 00 00 00       	mov    $0x22,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <spawn>:
+SYSCALL(spawn)
+ 42b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <clone>:
+SYSCALL(clone)
+ 433:	b8 24 00 00 00       	mov    $0x24,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <join>:
+SYSCALL(join)
+ 43b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <futex>:
+SYSCALL(futex)
+ 443:	b8 26 00 00 00       	mov    $0x26,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <ccheckpoint>:
+SYSCALL(ccheckpoint)
+ 44b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <crestore>:
+SYSCALL(crestore)
+ 453:	b8 28 00 00 00       	mov    $0x28,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <czygote>:
+SYSCALL(czygote)
+ 45b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <memstats>:
+SYSCALL(memstats)
+ 463:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+ 46b:	66 90                	xchg   %ax,%ax
+ 46d:	66 90                	xchg   %ax,%ax
+ 46f:	90                   	nop
+
+00000470 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	57                   	push   %edi
+ 474:	56                   	push   %esi
+ 475:	53                   	push   %ebx
+ 476:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 478:	89 d1                	mov    %edx,%ecx
+{
+ 47a:	83 ec 3c             	sub    $0x3c,%esp
+ 47d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 480:	85 d2                	test   %edx,%edx
+ 482:	0f 89 80 00 00 00    	jns    508 <printint+0x98>
+ 488:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 48c:	74 7a                	je     508 <printint+0x98>
+    x = -xx;
+ 48e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 490:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 495:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 498:	31 f6                	xor    %esi,%esi
+ 49a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 4a0:	89 c8                	mov    %ecx,%eax
+ 4a2:	31 d2                	xor    %edx,%edx
+ 4a4:	89 f7                	mov    %esi,%edi
+ 4a6:	f7 f3                	div    %ebx
+ 4a8:	8d 76 01             	lea    0x1(%esi),%esi
+ 4ab:	0f b6 92 a8 0c 00 00 	movzbl 0xca8(%edx),%edx
+ 4b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 4b6:	89 ca                	mov    %ecx,%edx
+ 4b8:	89 c1                	mov    %eax,%ecx
+ 4ba:	39 da                	cmp    %ebx,%edx
+ 4bc:	73 e2                	jae    4a0 <printint+0x30>
+  if(neg)
+ 4be:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 4c1:	85 c0                	test   %eax,%eax
+ 4c3:	74 07                	je     4cc <printint+0x5c>
+    buf[i++] = '-';
+ 4c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 4ca:	89 f7                	mov    %esi,%edi
+ 4cc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 4cf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 4d2:	01 df                	add    %ebx,%edi
+ 4d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 4d8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 4db:	83 ec 04             	sub    $0x4,%esp
+ 4de:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 4e1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 4e4:	6a 01                	push   $0x1
+ 4e6:	50                   	push   %eax
+ 4e7:	56                   	push   %esi
+ 4e8:	e8 96 fe ff ff       	call   383 <write>
+  while(--i >= 0)
+ 4ed:	89 f8                	mov    %edi,%eax
+ 4ef:	83 c4 10             	add    $0x10,%esp
+ 4f2:	83 ef 01             	sub    $0x1,%edi
+ 4f5:	39 d8                	cmp    %ebx,%eax
+ 4f7:	75 df                	jne    4d8 <printint+0x68>
+}
+ 4f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4fc:	5b                   	pop    %ebx
+ 4fd:	5e                   	pop    %esi
+ 4fe:	5f                   	pop    %edi
+ 4ff:	5d                   	pop    %ebp
+ 500:	c3                   	ret
+ 501:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 508:	31 c0                	xor    %eax,%eax
+ 50a:	eb 89                	jmp    495 <printint+0x25>
+ 50c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000510 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	57                   	push   %edi
+ 514:	56                   	push   %esi
+ 515:	53                   	push   %ebx
+ 516:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 519:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 51c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 51f:	0f b6 1e             	movzbl (%esi),%ebx
+ 522:	83 c6 01             	add    $0x1,%esi
+ 525:	84 db                	test   %bl,%bl
+ 527:	74 67                	je     590 <printf+0x80>
+ 529:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 52c:	31 d2                	xor    %edx,%edx
+ 52e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 531:	eb 34                	jmp    567 <printf+0x57>
+ 533:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 537:	90                   	nop
+ 538:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 53b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 540:	83 f8 25             	cmp    $0x25,%eax
+ 543:	74 18                	je     55d <printf+0x4d>
+  write(fd, &c, 1);
+ 545:	83 ec 04             	sub    $0x4,%esp
+ 548:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 54b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 54e:	6a 01                	push   $0x1
+ 550:	50                   	push   %eax
+ 551:	57                   	push   %edi
+ 552:	e8 2c fe ff ff       	call   383 <write>
+ 557:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 55a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 55d:	0f b6 1e             	movzbl (%esi),%ebx
+ 560:	83 c6 01             	add    $0x1,%esi
+ 563:	84 db                	test   %bl,%bl
+ 565:	74 29                	je     590 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 567:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 56a:	85 d2                	test   %edx,%edx
+ 56c:	74 ca                	je     538 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 56e:	83 fa 25             	cmp    $0x25,%edx
+ 571:	75 ea                	jne    55d <printf+0x4d>
+      if(c == 'd'){
+ 573:	83 f8 25             	cmp    $0x25,%eax
+ 576:	0f 84 24 01 00 00    	je     6a0 <printf+0x190>
+ 57c:	83 e8 63             	sub    $0x63,%eax
+ 57f:	83 f8 15             	cmp    $0x15,%eax
+ 582:	77 1c                	ja     5a0 <printf+0x90>
+ 584:	ff 24 85 50 0c 00 00 	jmp    *0xc50(,%eax,4)
+ 58b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 58f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 590:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 593:	5b                   	pop    %ebx
+ 594:	5e                   	pop    %esi
+ 595:	5f                   	pop    %edi
+ 596:	5d                   	pop    %ebp
+ 597:	c3                   	ret
+ 598:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59f:	90                   	nop
+  write(fd, &c, 1);
+ 5a0:	83 ec 04             	sub    $0x4,%esp
+ 5a3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5a6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 5aa:	6a 01                	push   $0x1
+ 5ac:	52                   	push   %edx
+ 5ad:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 5b0:	57                   	push   %edi
+ 5b1:	e8 cd fd ff ff       	call   383 <write>
+ 5b6:	83 c4 0c             	add    $0xc,%esp
+ 5b9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5bc:	6a 01                	push   $0x1
+ 5be:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 5c1:	52                   	push   %edx
+ 5c2:	57                   	push   %edi
+ 5c3:	e8 bb fd ff ff       	call   383 <write>
+        putc(fd, c);
+ 5c8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5cb:	31 d2                	xor    %edx,%edx
+ 5cd:	eb 8e                	jmp    55d <printf+0x4d>
+ 5cf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 5d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5d3:	83 ec 0c             	sub    $0xc,%esp
+ 5d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 5db:	8b 13                	mov    (%ebx),%edx
+ 5dd:	6a 00                	push   $0x0
+ 5df:	89 f8                	mov    %edi,%eax
+        ap++;
+ 5e1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 5e4:	e8 87 fe ff ff       	call   470 <printint>
+        ap++;
+ 5e9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 5ec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5ef:	31 d2                	xor    %edx,%edx
+ 5f1:	e9 67 ff ff ff       	jmp    55d <printf+0x4d>
+ 5f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5fd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 600:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 603:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 605:	83 c0 04             	add    $0x4,%eax
+ 608:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 60b:	85 db                	test   %ebx,%ebx
+ 60d:	0f 84 9d 00 00 00    	je     6b0 <printf+0x1a0>
+        while(*s != 0){
+ 613:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 616:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 618:	84 c0                	test   %al,%al
+ 61a:	0f 84 3d ff ff ff    	je     55d <printf+0x4d>
+ 620:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 623:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 626:	89 de                	mov    %ebx,%esi
+ 628:	89 d3                	mov    %edx,%ebx
+ 62a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 630:	83 ec 04             	sub    $0x4,%esp
+ 633:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 636:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 639:	6a 01                	push   $0x1
+ 63b:	53                   	push   %ebx
+ 63c:	57                   	push   %edi
+ 63d:	e8 41 fd ff ff       	call   383 <write>
+        while(*s != 0){
+ 642:	0f b6 06             	movzbl (%esi),%eax
+ 645:	83 c4 10             	add    $0x10,%esp
+ 648:	84 c0                	test   %al,%al
+ 64a:	75 e4                	jne    630 <printf+0x120>
+      state = 0;
+ 64c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 64f:	31 d2                	xor    %edx,%edx
+ 651:	e9 07 ff ff ff       	jmp    55d <printf+0x4d>
+ 656:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 65d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 660:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 663:	83 ec 0c             	sub    $0xc,%esp
+ 666:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 66b:	8b 13                	mov    (%ebx),%edx
+ 66d:	6a 01                	push   $0x1
+ 66f:	e9 6b ff ff ff       	jmp    5df <printf+0xcf>
+ 674:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 678:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 67b:	83 ec 04             	sub    $0x4,%esp
+ 67e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 681:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 683:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 686:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 689:	6a 01                	push   $0x1
+ 68b:	52                   	push   %edx
+ 68c:	57                   	push   %edi
+ 68d:	e8 f1 fc ff ff       	call   383 <write>
+        ap++;
+ 692:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 695:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 698:	31 d2                	xor    %edx,%edx
+ 69a:	e9 be fe ff ff       	jmp    55d <printf+0x4d>
+ 69f:	90                   	nop
+  write(fd, &c, 1);
+ 6a0:	83 ec 04             	sub    $0x4,%esp
+ 6a3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6a6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6a9:	6a 01                	push   $0x1
+ 6ab:	e9 11 ff ff ff       	jmp    5c1 <printf+0xb1>
+ 6b0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 6b5:	bb 47 0c 00 00       	mov    $0xc47,%ebx
+ 6ba:	e9 61 ff ff ff       	jmp    620 <printf+0x110>
+ 6bf:	90                   	nop
+
+000006c0 <runfree>:
+
+// Give the n pages at r back to the free runs, merging them with
+// adjacent runs, and shrink the heap if the end of it is free.
+static void
+runfree(struct page *r, uint n)
+{
+ 6c0:	55                   	push   %ebp
+  struct page **pp, *prev;
+
+  r->kind = PFREE;
+ 6c1:	b9 03 00 00 00       	mov    $0x3,%ecx
+{
+ 6c6:	89 e5                	mov    %esp,%ebp
+ 6c8:	57                   	push   %edi
+ 6c9:	56                   	push   %esi
+ 6ca:	53                   	push   %ebx
+ 6cb:	89 c3                	mov    %eax,%ebx
+ 6cd:	83 ec 0c             	sub    $0xc,%esp
+  r->kind = PFREE;
+ 6d0:	66 89 08             	mov    %cx,(%eax)
+  r->npages = n;
+  prev = 0;
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 6d3:	8b 0d c4 0f 00 00    	mov    0xfc4,%ecx
+  r->npages = n;
+ 6d9:	89 50 04             	mov    %edx,0x4(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 6dc:	85 c9                	test   %ecx,%ecx
+ 6de:	0f 84 1f 01 00 00    	je     803 <runfree+0x143>
+ 6e4:	39 c1                	cmp    %eax,%ecx
+ 6e6:	0f 83 f7 00 00 00    	jae    7e3 <runfree+0x123>
+ 6ec:	89 c8                	mov    %ecx,%eax
+ 6ee:	eb 04                	jmp    6f4 <runfree+0x34>
+ 6f0:	39 d8                	cmp    %ebx,%eax
+ 6f2:	73 09                	jae    6fd <runfree+0x3d>
+ 6f4:	89 c2                	mov    %eax,%edx
+ 6f6:	8b 40 14             	mov    0x14(%eax),%eax
+ 6f9:	85 c0                	test   %eax,%eax
+ 6fb:	75 f3                	jne    6f0 <runfree+0x30>
+    prev = *pp;
+  r->next = *pp;
+ 6fd:	89 43 14             	mov    %eax,0x14(%ebx)
+  *pp = r;
+ 700:	89 5a 14             	mov    %ebx,0x14(%edx)
+
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 703:	8b 43 14             	mov    0x14(%ebx),%eax
+ 706:	85 c0                	test   %eax,%eax
+ 708:	74 12                	je     71c <runfree+0x5c>
+ 70a:	8b 7b 04             	mov    0x4(%ebx),%edi
+ 70d:	89 fe                	mov    %edi,%esi
+ 70f:	c1 e6 0c             	shl    $0xc,%esi
+ 712:	01 de                	add    %ebx,%esi
+ 714:	39 f0                	cmp    %esi,%eax
+ 716:	0f 84 a4 00 00 00    	je     7c0 <runfree+0x100>
+    r->npages += r->next->npages;
+    r->next = r->next->next;
+  }
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 71c:	8b 72 04             	mov    0x4(%edx),%esi
+ 71f:	89 f0                	mov    %esi,%eax
+ 721:	c1 e0 0c             	shl    $0xc,%eax
+ 724:	01 d0                	add    %edx,%eax
+ 726:	39 c3                	cmp    %eax,%ebx
+ 728:	74 16                	je     740 <runfree+0x80>
+    pp = &runs;
+    while(*pp != r)
+      pp = &(*pp)->next;
+  }
+
+  if(r->next == 0 && r->npages >= TRIM &&
+ 72a:	8b 43 14             	mov    0x14(%ebx),%eax
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 72d:	8d 72 14             	lea    0x14(%edx),%esi
+  if(r->next == 0 && r->npages >= TRIM &&
+ 730:	85 c0                	test   %eax,%eax
+ 732:	74 3c                	je     770 <runfree+0xb0>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+    *pp = 0;
+    sbrk(-(int)(r->npages*PGSIZE));
+    heapend = (char*)r;
+  }
+}
+ 734:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 737:	5b                   	pop    %ebx
+ 738:	5e                   	pop    %esi
+ 739:	5f                   	pop    %edi
+ 73a:	5d                   	pop    %ebp
+ 73b:	c3                   	ret
+ 73c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    prev->npages += r->npages;
+ 740:	03 73 04             	add    0x4(%ebx),%esi
+ 743:	89 72 04             	mov    %esi,0x4(%edx)
+    prev->next = r->next;
+ 746:	8b 43 14             	mov    0x14(%ebx),%eax
+ 749:	89 42 14             	mov    %eax,0x14(%edx)
+    while(*pp != r)
+ 74c:	39 d1                	cmp    %edx,%ecx
+ 74e:	0f 84 c5 00 00 00    	je     819 <runfree+0x159>
+ 754:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      pp = &(*pp)->next;
+ 758:	89 cb                	mov    %ecx,%ebx
+ 75a:	8b 49 14             	mov    0x14(%ecx),%ecx
+    while(*pp != r)
+ 75d:	39 d1                	cmp    %edx,%ecx
+ 75f:	75 f7                	jne    758 <runfree+0x98>
+      pp = &(*pp)->next;
+ 761:	8d 73 14             	lea    0x14(%ebx),%esi
+ 764:	89 cb                	mov    %ecx,%ebx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 766:	85 c0                	test   %eax,%eax
+ 768:	75 ca                	jne    734 <runfree+0x74>
+ 76a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 770:	8b 53 04             	mov    0x4(%ebx),%edx
+ 773:	83 fa 1f             	cmp    $0x1f,%edx
+ 776:	76 bc                	jbe    734 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 778:	c1 e2 0c             	shl    $0xc,%edx
+ 77b:	01 da                	add    %ebx,%edx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 77d:	39 15 c0 0f 00 00    	cmp    %edx,0xfc0
+ 783:	75 af                	jne    734 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 785:	83 ec 0c             	sub    $0xc,%esp
+ 788:	6a 00                	push   $0x0
+ 78a:	e8 5c fc ff ff       	call   3eb <sbrk>
+ 78f:	83 c4 10             	add    $0x10,%esp
+ 792:	39 05 c0 0f 00 00    	cmp    %eax,0xfc0
+ 798:	75 9a                	jne    734 <runfree+0x74>
+    *pp = 0;
+ 79a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    sbrk(-(int)(r->npages*PGSIZE));
+ 7a0:	8b 43 04             	mov    0x4(%ebx),%eax
+ 7a3:	83 ec 0c             	sub    $0xc,%esp
+ 7a6:	c1 e0 0c             	shl    $0xc,%eax
+ 7a9:	f7 d8                	neg    %eax
+ 7ab:	50                   	push   %eax
+ 7ac:	e8 3a fc ff ff       	call   3eb <sbrk>
+    heapend = (char*)r;
+ 7b1:	89 1d c0 0f 00 00    	mov    %ebx,0xfc0
+ 7b7:	83 c4 10             	add    $0x10,%esp
+}
+ 7ba:	e9 75 ff ff ff       	jmp    734 <runfree+0x74>
+ 7bf:	90                   	nop
+    r->npages += r->next->npages;
+ 7c0:	03 78 04             	add    0x4(%eax),%edi
+ 7c3:	89 7b 04             	mov    %edi,0x4(%ebx)
+    r->next = r->next->next;
+ 7c6:	8b 40 14             	mov    0x14(%eax),%eax
+ 7c9:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 7cc:	8b 72 04             	mov    0x4(%edx),%esi
+ 7cf:	89 f0                	mov    %esi,%eax
+ 7d1:	c1 e0 0c             	shl    $0xc,%eax
+ 7d4:	01 d0                	add    %edx,%eax
+ 7d6:	39 c3                	cmp    %eax,%ebx
+ 7d8:	0f 85 4c ff ff ff    	jne    72a <runfree+0x6a>
+ 7de:	e9 5d ff ff ff       	jmp    740 <runfree+0x80>
+  r->next = *pp;
+ 7e3:	89 48 14             	mov    %ecx,0x14(%eax)
+  *pp = r;
+ 7e6:	a3 c4 0f 00 00       	mov    %eax,0xfc4
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 7eb:	89 d0                	mov    %edx,%eax
+ 7ed:	c1 e0 0c             	shl    $0xc,%eax
+ 7f0:	01 d8                	add    %ebx,%eax
+ 7f2:	39 c1                	cmp    %eax,%ecx
+ 7f4:	74 2f                	je     825 <runfree+0x165>
+  if(r->next == 0 && r->npages >= TRIM &&
+ 7f6:	8b 43 14             	mov    0x14(%ebx),%eax
+ 7f9:	be c4 0f 00 00       	mov    $0xfc4,%esi
+ 7fe:	e9 2d ff ff ff       	jmp    730 <runfree+0x70>
+  r->next = *pp;
+ 803:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 80a:	be c4 0f 00 00       	mov    $0xfc4,%esi
+  *pp = r;
+ 80f:	a3 c4 0f 00 00       	mov    %eax,0xfc4
+  if(r->next == 0 && r->npages >= TRIM &&
+ 814:	e9 5a ff ff ff       	jmp    773 <runfree+0xb3>
+    while(*pp != r)
+ 819:	89 cb                	mov    %ecx,%ebx
+    pp = &runs;
+ 81b:	be c4 0f 00 00       	mov    $0xfc4,%esi
+ 820:	e9 0b ff ff ff       	jmp    730 <runfree+0x70>
+    r->npages += r->next->npages;
+ 825:	03 51 04             	add    0x4(%ecx),%edx
+ 828:	89 53 04             	mov    %edx,0x4(%ebx)
+    r->next = r->next->next;
+ 82b:	8b 41 14             	mov    0x14(%ecx),%eax
+ 82e:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 831:	eb c3                	jmp    7f6 <runfree+0x136>
+ 833:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 83a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000840 <runalloc>:
+
+// Take a run of n pages from the start of the first free run
+// long enough, which keeps the end of the heap free to trim.
+static struct page*
+runalloc(uint n)
+{
+ 840:	55                   	push   %ebp
+ 841:	89 e5                	mov    %esp,%ebp
+ 843:	57                   	push   %edi
+ 844:	56                   	push   %esi
+ 845:	89 c6                	mov    %eax,%esi
+ 847:	53                   	push   %ebx
+ 848:	83 ec 1c             	sub    $0x1c,%esp
+  struct page **pp, *r, *rest;
+
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ 84b:	8b 1d c4 0f 00 00    	mov    0xfc4,%ebx
+ 851:	85 db                	test   %ebx,%ebx
+ 853:	74 4d                	je     8a2 <runalloc+0x62>
+ 855:	b9 c4 0f 00 00       	mov    $0xfc4,%ecx
+    if(r->npages < n)
+ 85a:	39 73 04             	cmp    %esi,0x4(%ebx)
+ 85d:	72 39                	jb     898 <runalloc+0x58>
+      continue;
+    if(r->npages == n){
+ 85f:	0f 84 9b 00 00 00    	je     900 <runalloc+0xc0>
+      *pp = r->next;
+    } else {
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ 865:	89 f0                	mov    %esi,%eax
+      rest->kind = PFREE;
+ 867:	ba 03 00 00 00       	mov    $0x3,%edx
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ 86c:	c1 e0 0c             	shl    $0xc,%eax
+ 86f:	01 d8                	add    %ebx,%eax
+      rest->kind = PFREE;
+ 871:	66 89 10             	mov    %dx,(%eax)
+      rest->npages = r->npages - n;
+ 874:	8b 53 04             	mov    0x4(%ebx),%edx
+ 877:	29 f2                	sub    %esi,%edx
+ 879:	89 50 04             	mov    %edx,0x4(%eax)
+      rest->next = r->next;
+ 87c:	8b 53 14             	mov    0x14(%ebx),%edx
+ 87f:	89 50 14             	mov    %edx,0x14(%eax)
+      *pp = rest;
+ 882:	89 01                	mov    %eax,(%ecx)
+      r->npages = n;
+ 884:	89 73 04             	mov    %esi,0x4(%ebx)
+    }
+    return r;
+  }
+  return morecore(n);
+}
+ 887:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 88a:	89 d8                	mov    %ebx,%eax
+ 88c:	5b                   	pop    %ebx
+ 88d:	5e                   	pop    %esi
+ 88e:	5f                   	pop    %edi
+ 88f:	5d                   	pop    %ebp
+ 890:	c3                   	ret
+ 891:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ 898:	8d 4b 14             	lea    0x14(%ebx),%ecx
+ 89b:	8b 5b 14             	mov    0x14(%ebx),%ebx
+ 89e:	85 db                	test   %ebx,%ebx
+ 8a0:	75 b8                	jne    85a <runalloc+0x1a>
+  m = n < MINCORE ? MINCORE : n;
+ 8a2:	bf 08 00 00 00       	mov    $0x8,%edi
+ 8a7:	39 fe                	cmp    %edi,%esi
+ 8a9:	0f 43 fe             	cmovae %esi,%edi
+  brk = sbrk(0);
+ 8ac:	83 ec 0c             	sub    $0xc,%esp
+ 8af:	6a 00                	push   $0x0
+ 8b1:	e8 35 fb ff ff       	call   3eb <sbrk>
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 8b6:	89 fa                	mov    %edi,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 8b8:	89 c3                	mov    %eax,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 8ba:	c1 e2 0c             	shl    $0xc,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 8bd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 8c0:	f7 db                	neg    %ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 8c2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 8c5:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 8cb:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+ 8ce:	89 04 24             	mov    %eax,(%esp)
+ 8d1:	e8 15 fb ff ff       	call   3eb <sbrk>
+ 8d6:	83 c4 10             	add    $0x10,%esp
+ 8d9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 8dc:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 8df:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8e2:	74 3e                	je     922 <runalloc+0xe2>
+  r = (struct page*)(brk + pad);
+ 8e4:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ 8e6:	01 da                	add    %ebx,%edx
+ 8e8:	89 15 c0 0f 00 00    	mov    %edx,0xfc0
+  if(m > n)
+ 8ee:	39 fe                	cmp    %edi,%esi
+ 8f0:	72 1e                	jb     910 <runalloc+0xd0>
+  r->npages = n;
+ 8f2:	89 73 04             	mov    %esi,0x4(%ebx)
+  return r;
+ 8f5:	eb 90                	jmp    887 <runalloc+0x47>
+ 8f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8fe:	66 90                	xchg   %ax,%ax
+      *pp = r->next;
+ 900:	8b 43 14             	mov    0x14(%ebx),%eax
+ 903:	89 01                	mov    %eax,(%ecx)
+}
+ 905:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 908:	89 d8                	mov    %ebx,%eax
+ 90a:	5b                   	pop    %ebx
+ 90b:	5e                   	pop    %esi
+ 90c:	5f                   	pop    %edi
+ 90d:	5d                   	pop    %ebp
+ 90e:	c3                   	ret
+ 90f:	90                   	nop
+    runfree((struct page*)((char*)r + n*PGSIZE), m - n);
+ 910:	89 f0                	mov    %esi,%eax
+ 912:	29 f7                	sub    %esi,%edi
+ 914:	c1 e0 0c             	shl    $0xc,%eax
+ 917:	89 fa                	mov    %edi,%edx
+ 919:	01 d8                	add    %ebx,%eax
+ 91b:	e8 a0 fd ff ff       	call   6c0 <runfree>
+ 920:	eb d0                	jmp    8f2 <runalloc+0xb2>
+    if(sbrk(pad + m*PGSIZE) == (char*)-1)
+ 922:	89 f7                	mov    %esi,%edi
+ 924:	83 ec 0c             	sub    $0xc,%esp
+ 927:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 92a:	c1 e7 0c             	shl    $0xc,%edi
+ 92d:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+ 930:	50                   	push   %eax
+ 931:	e8 b5 fa ff ff       	call   3eb <sbrk>
+ 936:	83 c4 10             	add    $0x10,%esp
+ 939:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 93c:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 93f:	74 0c                	je     94d <runalloc+0x10d>
+  r = (struct page*)(brk + pad);
+ 941:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ 943:	01 df                	add    %ebx,%edi
+ 945:	89 3d c0 0f 00 00    	mov    %edi,0xfc0
+  if(m > n)
+ 94b:	eb a5                	jmp    8f2 <runalloc+0xb2>
+      return 0;
+ 94d:	31 db                	xor    %ebx,%ebx
+ 94f:	e9 33 ff ff ff       	jmp    887 <runalloc+0x47>
+ 954:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 95b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 95f:	90                   	nop
+
+00000960 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+ 960:	55                   	push   %ebp
+ 961:	89 e5                	mov    %esp,%ebp
+ 963:	56                   	push   %esi
+ 964:	53                   	push   %ebx
+ 965:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  struct page *p;
+
+  if(ap == 0)
+ 968:	85 c9                	test   %ecx,%ecx
+ 96a:	74 1c                	je     988 <free+0x28>
+    return;
+  p = (struct page*)((uint)ap & ~(PGSIZE-1));
+ 96c:	89 c8                	mov    %ecx,%eax
+ 96e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  switch(p->kind){
+ 973:	0f b7 10             	movzwl (%eax),%edx
+ 976:	66 83 fa 02          	cmp    $0x2,%dx
+ 97a:	74 14                	je     990 <free+0x30>
+ 97c:	66 83 fa 04          	cmp    $0x4,%dx
+ 980:	74 66                	je     9e8 <free+0x88>
+ 982:	66 83 fa 01          	cmp    $0x1,%dx
+ 986:	74 18                	je     9a0 <free+0x40>
+    break;
+  case PMAP:
+    munmap(p, p->npages*PGSIZE);
+    break;
+  }
+}
+ 988:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 98b:	5b                   	pop    %ebx
+ 98c:	5e                   	pop    %esi
+ 98d:	5d                   	pop    %ebp
+ 98e:	c3                   	ret
+ 98f:	90                   	nop
+    runfree(p, p->npages);
+ 990:	8b 50 04             	mov    0x4(%eax),%edx
+}
+ 993:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 996:	5b                   	pop    %ebx
+ 997:	5e                   	pop    %esi
+ 998:	5d                   	pop    %ebp
+    runfree(p, p->npages);
+ 999:	e9 22 fd ff ff       	jmp    6c0 <runfree>
+ 99e:	66 90                	xchg   %ax,%ax
+  b->next = p->free;
+ 9a0:	8b 50 0c             	mov    0xc(%eax),%edx
+ 9a3:	89 11                	mov    %edx,(%ecx)
+  if(p->nfree++ == 0)
+ 9a5:	8b 50 08             	mov    0x8(%eax),%edx
+  p->free = b;
+ 9a8:	89 48 0c             	mov    %ecx,0xc(%eax)
+  if(p->nfree++ == 0)
+ 9ab:	8d 5a 01             	lea    0x1(%edx),%ebx
+ 9ae:	89 58 08             	mov    %ebx,0x8(%eax)
+ 9b1:	85 d2                	test   %edx,%edx
+ 9b3:	74 53                	je     a08 <free+0xa8>
+  if(p->nfree == nblocks(p->class)){
+ 9b5:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ 9b9:	8d 4e 04             	lea    0x4(%esi),%ecx
+ 9bc:	ba e0 0f 00 00       	mov    $0xfe0,%edx
+ 9c1:	d3 fa                	sar    %cl,%edx
+  if(p->nfree == nblocks(p->class)){
+ 9c3:	39 da                	cmp    %ebx,%edx
+ 9c5:	75 c1                	jne    988 <free+0x28>
+  if(p->prev)
+ 9c7:	8b 48 18             	mov    0x18(%eax),%ecx
+    p->prev->next = p->next;
+ 9ca:	8b 50 14             	mov    0x14(%eax),%edx
+  if(p->prev)
+ 9cd:	85 c9                	test   %ecx,%ecx
+ 9cf:	74 6f                	je     a40 <free+0xe0>
+    p->prev->next = p->next;
+ 9d1:	89 51 14             	mov    %edx,0x14(%ecx)
+  if(p->next)
+ 9d4:	85 d2                	test   %edx,%edx
+ 9d6:	74 06                	je     9de <free+0x7e>
+    p->next->prev = p->prev;
+ 9d8:	8b 48 18             	mov    0x18(%eax),%ecx
+ 9db:	89 4a 18             	mov    %ecx,0x18(%edx)
+    runfree(p, 1);
+ 9de:	ba 01 00 00 00       	mov    $0x1,%edx
+ 9e3:	eb ae                	jmp    993 <free+0x33>
+ 9e5:	8d 76 00             	lea    0x0(%esi),%esi
+    munmap(p, p->npages*PGSIZE);
+ 9e8:	8b 50 04             	mov    0x4(%eax),%edx
+ 9eb:	83 ec 08             	sub    $0x8,%esp
+ 9ee:	c1 e2 0c             	shl    $0xc,%edx
+ 9f1:	52                   	push   %edx
+ 9f2:	50                   	push   %eax
+ 9f3:	e8 1b fa ff ff       	call   413 <munmap>
+    break;
+ 9f8:	83 c4 10             	add    $0x10,%esp
+}
+ 9fb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 9fe:	5b                   	pop    %ebx
+ 9ff:	5e                   	pop    %esi
+ a00:	5d                   	pop    %ebp
+ a01:	c3                   	ret
+ a02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  p->next = partial[p->class];
+ a08:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  p->prev = 0;
+ a0c:	c7 40 18 00 00 00 00 	movl   $0x0,0x18(%eax)
+  p->next = partial[p->class];
+ a13:	bb 01 00 00 00       	mov    $0x1,%ebx
+ a18:	8b 14 b5 c8 0f 00 00 	mov    0xfc8(,%esi,4),%edx
+ a1f:	89 50 14             	mov    %edx,0x14(%eax)
+  if(p->next)
+ a22:	85 d2                	test   %edx,%edx
+ a24:	74 0a                	je     a30 <free+0xd0>
+    p->next->prev = p;
+ a26:	89 42 18             	mov    %eax,0x18(%edx)
+  partial[p->class] = p;
+ a29:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  if(p->nfree == nblocks(p->class)){
+ a2d:	8b 58 08             	mov    0x8(%eax),%ebx
+  partial[p->class] = p;
+ a30:	89 04 b5 c8 0f 00 00 	mov    %eax,0xfc8(,%esi,4)
+}
+ a37:	eb 80                	jmp    9b9 <free+0x59>
+ a39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ a40:	89 14 b5 c8 0f 00 00 	mov    %edx,0xfc8(,%esi,4)
+ a47:	eb 8b                	jmp    9d4 <free+0x74>
+ a49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000a50 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ a50:	55                   	push   %ebp
+ a51:	89 e5                	mov    %esp,%ebp
+ a53:	56                   	push   %esi
+ a54:	53                   	push   %ebx
+ a55:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct page *p;
+  uint n;
+
+  if(nbytes <= MAXSMALL)
+ a58:	3d 00 04 00 00       	cmp    $0x400,%eax
+ a5d:	76 71                	jbe    ad0 <malloc+0x80>
+    return smallalloc(sizeclass(nbytes));
+  if(nbytes > 0x7fffffff)
+ a5f:	85 c0                	test   %eax,%eax
+ a61:	0f 88 d9 00 00 00    	js     b40 <malloc+0xf0>
+    return 0;
+  n = (nbytes + HDRSIZE + PGSIZE-1) / PGSIZE;
+ a67:	8d 90 1f 10 00 00    	lea    0x101f(%eax),%edx
+ a6d:	89 d3                	mov    %edx,%ebx
+ a6f:	c1 eb 0c             	shr    $0xc,%ebx
+  if(nbytes >= MAPMIN){
+ a72:	3d ff ff 00 00       	cmp    $0xffff,%eax
+ a77:	77 27                	ja     aa0 <malloc+0x50>
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    if(p == MAP_FAILED)
+      return 0;
+    p->kind = PMAP;
+  } else {
+    if((p = runalloc(n)) == 0)
+ a79:	89 d8                	mov    %ebx,%eax
+ a7b:	e8 c0 fd ff ff       	call   840 <runalloc>
+ a80:	85 c0                	test   %eax,%eax
+ a82:	0f 84 b8 00 00 00    	je     b40 <malloc+0xf0>
+      return 0;
+    p->kind = PRUN;
+ a88:	ba 02 00 00 00       	mov    $0x2,%edx
+ a8d:	66 89 10             	mov    %dx,(%eax)
+  }
+  p->npages = n;
+ a90:	89 58 04             	mov    %ebx,0x4(%eax)
+  return (char*)p + HDRSIZE;
+ a93:	8d 58 20             	lea    0x20(%eax),%ebx
+}
+ a96:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a99:	89 d8                	mov    %ebx,%eax
+ a9b:	5b                   	pop    %ebx
+ a9c:	5e                   	pop    %esi
+ a9d:	5d                   	pop    %ebp
+ a9e:	c3                   	ret
+ a9f:	90                   	nop
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+ aa0:	83 ec 08             	sub    $0x8,%esp
+ aa3:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+ aa9:	6a 00                	push   $0x0
+ aab:	6a ff                	push   $0xffffffff
+ aad:	6a 22                	push   $0x22
+ aaf:	6a 03                	push   $0x3
+ ab1:	52                   	push   %edx
+ ab2:	6a 00                	push   $0x0
+ ab4:	e8 52 f9 ff ff       	call   40b <mmap>
+    if(p == MAP_FAILED)
+ ab9:	83 c4 20             	add    $0x20,%esp
+ abc:	83 f8 ff             	cmp    $0xffffffff,%eax
+ abf:	74 7f                	je     b40 <malloc+0xf0>
+    p->kind = PMAP;
+ ac1:	b9 04 00 00 00       	mov    $0x4,%ecx
+ ac6:	66 89 08             	mov    %cx,(%eax)
+ ac9:	eb c5                	jmp    a90 <malloc+0x40>
+ acb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ acf:	90                   	nop
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ ad0:	83 f8 10             	cmp    $0x10,%eax
+ ad3:	0f 86 07 01 00 00    	jbe    be0 <malloc+0x190>
+ ad9:	31 db                	xor    %ebx,%ebx
+ adb:	ba 10 00 00 00       	mov    $0x10,%edx
+ ae0:	83 c3 01             	add    $0x1,%ebx
+ ae3:	89 d6                	mov    %edx,%esi
+ ae5:	89 d9                	mov    %ebx,%ecx
+ ae7:	d3 e6                	shl    %cl,%esi
+ ae9:	39 c6                	cmp    %eax,%esi
+ aeb:	72 f3                	jb     ae0 <malloc+0x90>
+  if((p = partial[c]) == 0){
+ aed:	8b 14 9d c8 0f 00 00 	mov    0xfc8(,%ebx,4),%edx
+ af4:	85 d2                	test   %edx,%edx
+ af6:	74 58                	je     b50 <malloc+0x100>
+  if((b = p->free) != 0){
+ af8:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ afb:	8b 4a 08             	mov    0x8(%edx),%ecx
+  if((b = p->free) != 0){
+ afe:	85 db                	test   %ebx,%ebx
+ b00:	0f 84 aa 00 00 00    	je     bb0 <malloc+0x160>
+    p->free = b->next;
+ b06:	8b 03                	mov    (%ebx),%eax
+ b08:	89 42 0c             	mov    %eax,0xc(%edx)
+  if(--p->nfree == 0)
+ b0b:	83 e9 01             	sub    $0x1,%ecx
+ b0e:	89 4a 08             	mov    %ecx,0x8(%edx)
+ b11:	75 83                	jne    a96 <malloc+0x46>
+  if(p->prev)
+ b13:	8b 4a 18             	mov    0x18(%edx),%ecx
+    p->prev->next = p->next;
+ b16:	8b 42 14             	mov    0x14(%edx),%eax
+  if(p->prev)
+ b19:	85 c9                	test   %ecx,%ecx
+ b1b:	0f 84 cf 00 00 00    	je     bf0 <malloc+0x1a0>
+    p->prev->next = p->next;
+ b21:	89 41 14             	mov    %eax,0x14(%ecx)
+  if(p->next)
+ b24:	85 c0                	test   %eax,%eax
+ b26:	0f 84 6a ff ff ff    	je     a96 <malloc+0x46>
+    p->next->prev = p->prev;
+ b2c:	8b 52 18             	mov    0x18(%edx),%edx
+ b2f:	89 50 18             	mov    %edx,0x18(%eax)
+ b32:	e9 5f ff ff ff       	jmp    a96 <malloc+0x46>
+ b37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b3e:	66 90                	xchg   %ax,%ax
+}
+ b40:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+ b43:	31 db                	xor    %ebx,%ebx
+}
+ b45:	89 d8                	mov    %ebx,%eax
+ b47:	5b                   	pop    %ebx
+ b48:	5e                   	pop    %esi
+ b49:	5d                   	pop    %ebp
+ b4a:	c3                   	ret
+ b4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b4f:	90                   	nop
+    if((p = runalloc(1)) == 0)
+ b50:	b8 01 00 00 00       	mov    $0x1,%eax
+ b55:	e8 e6 fc ff ff       	call   840 <runalloc>
+ b5a:	89 c2                	mov    %eax,%edx
+ b5c:	85 c0                	test   %eax,%eax
+ b5e:	74 e0                	je     b40 <malloc+0xf0>
+    p->kind = PSMALL;
+ b60:	b8 01 00 00 00       	mov    $0x1,%eax
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ b65:	8d 4b 04             	lea    0x4(%ebx),%ecx
+    p->class = c;
+ b68:	66 89 5a 02          	mov    %bx,0x2(%edx)
+ b6c:	0f b7 db             	movzwl %bx,%ebx
+    p->kind = PSMALL;
+ b6f:	66 89 02             	mov    %ax,(%edx)
+    p->fresh = (char*)p + HDRSIZE;
+ b72:	8d 42 20             	lea    0x20(%edx),%eax
+ b75:	89 42 10             	mov    %eax,0x10(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ b78:	b8 e0 0f 00 00       	mov    $0xfe0,%eax
+ b7d:	d3 f8                	sar    %cl,%eax
+    p->free = 0;
+ b7f:	c7 42 0c 00 00 00 00 	movl   $0x0,0xc(%edx)
+    p->nfree = nblocks(c);
+ b86:	89 42 08             	mov    %eax,0x8(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ b89:	89 c1                	mov    %eax,%ecx
+  p->next = partial[p->class];
+ b8b:	8b 04 9d c8 0f 00 00 	mov    0xfc8(,%ebx,4),%eax
+  p->prev = 0;
+ b92:	c7 42 18 00 00 00 00 	movl   $0x0,0x18(%edx)
+  p->next = partial[p->class];
+ b99:	89 42 14             	mov    %eax,0x14(%edx)
+  if(p->next)
+ b9c:	85 c0                	test   %eax,%eax
+ b9e:	75 20                	jne    bc0 <malloc+0x170>
+  partial[p->class] = p;
+ ba0:	89 14 9d c8 0f 00 00 	mov    %edx,0xfc8(,%ebx,4)
+  if((b = p->free) != 0){
+ ba7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bae:	66 90                	xchg   %ax,%ax
+    b = (struct block*)p->fresh;
+ bb0:	8b 5a 10             	mov    0x10(%edx),%ebx
+    p->fresh += MINSMALL << c;
+ bb3:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+ bb6:	89 42 10             	mov    %eax,0x10(%edx)
+ bb9:	e9 4d ff ff ff       	jmp    b0b <malloc+0xbb>
+ bbe:	66 90                	xchg   %ax,%ax
+    p->next->prev = p;
+ bc0:	89 50 18             	mov    %edx,0x18(%eax)
+  partial[p->class] = p;
+ bc3:	0f b7 42 02          	movzwl 0x2(%edx),%eax
+  if((b = p->free) != 0){
+ bc7:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ bca:	8b 4a 08             	mov    0x8(%edx),%ecx
+  partial[p->class] = p;
+ bcd:	89 14 85 c8 0f 00 00 	mov    %edx,0xfc8(,%eax,4)
+}
+ bd4:	e9 25 ff ff ff       	jmp    afe <malloc+0xae>
+ bd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ be0:	be 10 00 00 00       	mov    $0x10,%esi
+ be5:	31 db                	xor    %ebx,%ebx
+ be7:	e9 01 ff ff ff       	jmp    aed <malloc+0x9d>
+ bec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ bf0:	0f b7 4a 02          	movzwl 0x2(%edx),%ecx
+ bf4:	89 04 8d c8 0f 00 00 	mov    %eax,0xfc8(,%ecx,4)
+ bfb:	e9 24 ff ff ff       	jmp    b24 <malloc+0xd4>
@@ -7,9 +7,12 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "proc.h"
 #include "spinlock.h"
+#include "memstats.h"
 
 void freerange(void *vstart, void *vend);
+static void uncharge(char *v);
 extern char end[]; // first address after kernel loaded from ELF file
                    // defined by the kernel linker script in kernel.ld
 
@@ -21,6 +24,16 @@ struct {
   struct spinlock lock;
   int use_lock;
   struct run *freelist;
+  int nfree;             // pages on freelist
+  struct run *zerolist;  // free pages already filled with zeroes
+  int nzero;             // pages on zerolist
+  char *uninit;          // free memory not yet put on freelist,
+  char *uninitend;       //   from uninit up to uninitend
+  struct run *largelist; // free 4MB pages, kept whole
+  int nlarge;            // pages on largelist
+  uint npages;           // 4KB pages managed, free or not
+  ushort ref[PHYSTOP/PGSIZE]; // number of users of each physical page
+  struct container *owner[PHYSTOP/PGSIZE]; // container charged for page
 } kmem;
 
 // Initialization happens in two phases.
@@ -28,6 +41,9 @@ struct {
 // the pages mapped by entrypgdir on free list.
 // 2. main() calls kinit2() with the rest of the physical pages
 // after installing a full page table that maps them on all cores.
+// Rather than freeing every page during boot, kinit2() only records
+// the range; pages are moved to the free list KCHUNK at a time,
+// when kalloc() runs out or by idle CPUs (see kidle).
 void
 kinit1(void *vstart, void *vend)
 {
@@ -39,10 +55,44 @@ kinit1(void *vstart, void *vend)
 void
 kinit2(void *vstart, void *vend)
 {
-  freerange(vstart, vend);
+  kmem.uninit = (char*)PGROUNDUP((uint)vstart);
+  kmem.uninitend = vend;
+  kmem.npages = kmem.nfree + (kmem.uninitend - kmem.uninit) / PGSIZE;
   kmem.use_lock = 1;
 }
 
+// Move up to KCHUNK pages of uninitialized memory to the
+// free list, or break up a free 4MB page if there is no
+// uninitialized memory left. Returns 0 if there was neither.
+// Caller must hold kmem.lock.
+static int
+kgrow(void)
+{
+  struct run *r;
+  char *v, *vend;
+  int n;
+
+  v = kmem.uninit;
+  vend = v + KCHUNK*PGSIZE;
+  if(vend > kmem.uninitend)
+    vend = kmem.uninitend;
+  if(v >= vend && (r = kmem.largelist) != 0){
+    kmem.largelist = r->next;
+    kmem.nlarge--;
+    v = (char*)r;
+    vend = v + LPGSIZE;
+  } else
+    kmem.uninit = vend;
+
+  for(n = 0; v + PGSIZE <= vend; v += PGSIZE, n++){
+    r = (struct run*)v;
+    r->next = kmem.freelist;
+    kmem.freelist = r;
+    kmem.nfree++;
+  }
+  return n;
+}
+
 void
 freerange(void *vstart, void *vend)
 {
@@ -56,22 +106,42 @@ freerange(void *vstart, void *vend)
 // which normally should have been returned by a
 // call to kalloc().  (The exception is when
 // initializing the allocator; see kinit above.)
+// A page shared through kref() only goes back on the
+// free list when its last user frees it.
 void
 kfree(char *v)
 {
   struct run *r;
+  ushort *ref;
 
   if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
     panic("kfree");
 
+  ref = &kmem.ref[V2P(v) / PGSIZE];
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  if(*ref > 1){
+    (*ref)--;
+    if(kmem.use_lock)
+      release(&kmem.lock);
+    return;
+  }
+  *ref = 0;
+  uncharge(v);
+
+#ifdef KFREEJUNK
+  if(kmem.use_lock)
+    release(&kmem.lock);
   // Fill with junk to catch dangling refs.
   memset(v, 1, PGSIZE);
-
   if(kmem.use_lock)
     acquire(&kmem.lock);
+#endif
+
   r = (struct run*)v;
   r->next = kmem.freelist;
   kmem.freelist = r;
+  kmem.nfree++;
   if(kmem.use_lock)
     release(&kmem.lock);
 }
@@ -86,11 +156,292 @@ kalloc(void)
 
   if(kmem.use_lock)
     acquire(&kmem.lock);
+  if(kmem.freelist == 0)
+    kgrow();
   r = kmem.freelist;
-  if(r)
+  if(r){
     kmem.freelist = r->next;
+    kmem.nfree--;
+  }
+  else if((r = kmem.zerolist) != 0){
+    kmem.zerolist = r->next;
+    kmem.nzero--;
+  }
+  if(r)
+    kmem.ref[V2P(r) / PGSIZE] = 1;
+  if(kmem.use_lock)
+    release(&kmem.lock);
+  return (char*)r;
+}
+
+// Allocate a page filled with zeroes, taking one from the
+// pool of pages zeroed in advance by kzerofill() if there
+// is one. Returns 0 if the memory cannot be allocated.
+char*
+kzalloc(void)
+{
+  struct run *r;
+
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  r = kmem.zerolist;
+  if(r){
+    kmem.zerolist = r->next;
+    kmem.nzero--;
+    kmem.ref[V2P(r) / PGSIZE] = 1;
+    // The link is the only non-zero word.
+    r->next = 0;
+  }
   if(kmem.use_lock)
     release(&kmem.lock);
+  if(r)
+    return (char*)r;
+
+  if((r = (struct run*)kalloc()) != 0)
+    memset(r, 0, PGSIZE);
   return (char*)r;
 }
 
+// Zero one free page for the kzalloc() pool, unless the
+// pool is full. Returns 1 if it zeroed a page.
+static int
+kzerofill(void)
+{
+  struct run *r;
+
+  acquire(&kmem.lock);
+  if(kmem.nzero >= NZEROPAGE || (r = kmem.freelist) == 0){
+    release(&kmem.lock);
+    return 0;
+  }
+  kmem.freelist = r->next;
+  kmem.nfree--;
+  release(&kmem.lock);
+
+  memset(r, 0, PGSIZE);
+
+  acquire(&kmem.lock);
+  r->next = kmem.zerolist;
+  kmem.zerolist = r;
+  kmem.nzero++;
+  release(&kmem.lock);
+  return 1;
+}
+
+// Add a user to the page at v, which must have come
+// from kalloc(). Used to share one physical page between
+// several page tables; each user later calls kfree().
+void
+kref(char *v)
+{
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+    panic("kref");
+
+  acquire(&kmem.lock);
+  if(kmem.ref[V2P(v) / PGSIZE] < 1)
+    panic("kref: free page");
+  kmem.ref[V2P(v) / PGSIZE]++;
+  release(&kmem.lock);
+}
+
+// Return the number of users of the page at v.
+int
+krefcnt(char *v)
+{
+  int n;
+
+  acquire(&kmem.lock);
+  n = kmem.ref[V2P(v) / PGSIZE];
+  release(&kmem.lock);
+  return n;
+}
+
+
+// Allocate a 4MB page: LPGSIZE bytes of physical memory,
+// aligned to LPGSIZE, for mapping with a single PTE_PS entry.
+// Each of its 4096-byte pages counts as allocated, so it can
+// later be split up and freed a page at a time. Returns 0 if
+// no such run of memory is left.
+char*
+kalloclarge(void)
+{
+  char *v, *a;
+  struct run *r;
+  int i;
+
+  acquire(&kmem.lock);
+  if((r = kmem.largelist) != 0){
+    kmem.largelist = r->next;
+    kmem.nlarge--;
+    v = (char*)r;
+  } else {
+    // Carve one from memory not yet on the free list,
+    // freeing the pages skipped to reach an aligned one.
+    v = P2V((V2P(kmem.uninit) + LPGSIZE-1) & ~(LPGSIZE-1));
+    if(kmem.uninit == 0 || v + LPGSIZE > kmem.uninitend){
+      release(&kmem.lock);
+      return 0;
+    }
+    for(a = kmem.uninit; a < v; a += PGSIZE){
+      r = (struct run*)a;
+      r->next = kmem.freelist;
+      kmem.freelist = r;
+      kmem.nfree++;
+    }
+    kmem.uninit = v + LPGSIZE;
+  }
+  for(i = 0; i < NPTENTRIES; i++)
+    kmem.ref[V2P(v) / PGSIZE + i] = 1;
+  release(&kmem.lock);
+  return v;
+}
+
+// Free the 4MB page at v, from kalloclarge(), keeping it whole.
+void
+kfreelarge(char *v)
+{
+  struct run *r;
+  int i;
+
+  if(V2P(v) % LPGSIZE || v < end || V2P(v) + LPGSIZE > PHYSTOP)
+    panic("kfreelarge");
+
+  acquire(&kmem.lock);
+  for(i = 0; i < NPTENTRIES; i++){
+    if(kmem.ref[V2P(v) / PGSIZE + i] != 1)
+      panic("kfreelarge: shared");
+    kmem.ref[V2P(v) / PGSIZE + i] = 0;
+    uncharge(v + i*PGSIZE);
+  }
+  r = (struct run*)v;
+  r->next = kmem.largelist;
+  kmem.largelist = r;
+  kmem.nlarge++;
+  release(&kmem.lock);
+}
+
+// Do a little memory housekeeping. Called by the scheduler
+// when the CPU has nothing else to do: keep at least KCHUNK
+// pages on the free list and the kzalloc() pool topped up.
+// The rest of memory stays untouched until it is needed, and
+// in 4MB runs from which kalloclarge() can carve pages.
+void
+kidle(void)
+{
+  int n;
+
+  n = 0;
+  acquire(&kmem.lock);
+  if(kmem.nfree < KCHUNK)
+    n = kgrow();
+  release(&kmem.lock);
+  if(n == 0)
+    kzerofill();
+}
+
+// Charge the page at v to container c as user memory, taking
+// the charge from any container that had it, as when a process
+// takes over a copy-on-write page its parent no longer maps.
+// Returns -1, leaving the page as it was, if that would take c
+// past its memory limit. The page is uncharged when it is
+// finally freed. The containers' memory counters are protected
+// by kmem.lock.
+int
+kcharge(char *v, struct container *c)
+{
+  if(c == 0)
+    return 0;
+  acquire(&kmem.lock);
+  if(kmem.owner[V2P(v) / PGSIZE] == c){
+    release(&kmem.lock);
+    return 0;
+  }
+  if(c->memlimit != 0 && c->mem >= c->memlimit){
+    release(&kmem.lock);
+    return -1;
+  }
+  uncharge(v);
+  kmem.owner[V2P(v) / PGSIZE] = c;
+  c->mem++;
+  if(c->mem > c->peakmem)
+    c->peakmem = c->mem;
+  release(&kmem.lock);
+  return 0;
+}
+
+// Stop charging the page at v to its container.
+// Caller holds kmem.lock if it is in use.
+static void
+uncharge(char *v)
+{
+  struct container **owner;
+
+  owner = &kmem.owner[V2P(v) / PGSIZE];
+  if(*owner){
+    (*owner)->mem--;
+    *owner = 0;
+  }
+}
+
+// Set the memory limit of c to limit pages, 0 for none.
+void
+ksetlimit(struct container *c, uint limit)
+{
+  acquire(&kmem.lock);
+  c->memlimit = limit;
+  release(&kmem.lock);
+}
+
+// Start the counters of c over for a new container in its
+// slot: no limit, and nothing charged, not even pages that
+// the old container's processes left behind.
+void
+kresetcont(struct container *c)
+{
+  uint i;
+
+  acquire(&kmem.lock);
+  if(c->mem != 0)
+    for(i = 0; i < PHYSTOP/PGSIZE; i++)
+      if(kmem.owner[i] == c)
+        kmem.owner[i] = 0;
+  c->mem = 0;
+  c->peakmem = 0;
+  c->memlimit = 0;
+  release(&kmem.lock);
+}
+
+// Return in *total the pages of memory there are and in
+// *free how many of them are free. Caller holds kmem.lock
+// if it is in use.
+static void
+kcountlocked(uint *total, uint *free)
+{
+  *total = kmem.npages;
+  *free = kmem.nfree + kmem.nzero + kmem.nlarge * NPTENTRIES +
+          (kmem.uninitend - kmem.uninit) / PGSIZE;
+}
+
+// Return in *total the pages of memory there are and in
+// *free how many of them are free.
+void
+kcount(uint *total, uint *free)
+{
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  kcountlocked(total, free);
+  if(kmem.use_lock)
+    release(&kmem.lock);
+}
+
+// Fill in the allocator's part of ms: how much memory
+// there is and how much of it is free.
+void
+kmemstats(struct memstats *ms)
+{
+  acquire(&kmem.lock);
+  kcountlocked(&ms->total, &ms->free);
+  ms->zeroed = kmem.nzero;
+  ms->largefree = kmem.nlarge * NPTENTRIES;
+  release(&kmem.lock);
+}
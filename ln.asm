@@ -0,0 +1,1707 @@
+
+_ln:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  if(argc != 3){
+   f:	83 39 03             	cmpl   $0x3,(%ecx)
+{
+  12:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc != 3){
+  15:	74 13                	je     2a <main+0x2a>
+    printf(2, "Usage: ln old new\n");
+  17:	52                   	push   %edx
+  18:	52                   	push   %edx
+  19:	68 80 0b 00 00       	push   $0xb80
+  1e:	6a 02                	push   $0x2
+  20:	e8 6b 04 00 00       	call   490 <printf>
+    exit();
+  25:	e8 b9 02 00 00       	call   2e3 <exit>
+  }
+  if(link(argv[1], argv[2]) < 0)
+  2a:	50                   	push   %eax
+  2b:	50                   	push   %eax
+  2c:	ff 73 08             	push   0x8(%ebx)
+  2f:	ff 73 04             	push   0x4(%ebx)
+  32:	e8 0c 03 00 00       	call   343 <link>
+  37:	83 c4 10             	add    $0x10,%esp
+  3a:	85 c0                	test   %eax,%eax
+  3c:	78 05                	js     43 <main+0x43>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  exit();
+  3e:	e8 a0 02 00 00       	call   2e3 <exit>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  43:	ff 73 08             	push   0x8(%ebx)
+  46:	ff 73 04             	push   0x4(%ebx)
+  49:	68 93 0b 00 00       	push   $0xb93
+  4e:	6a 02                	push   $0x2
+  50:	e8 3b 04 00 00       	call   490 <printf>
+  55:	83 c4 10             	add    $0x10,%esp
+  58:	eb e4                	jmp    3e <main+0x3e>
+  5a:	66 90                	xchg   %ax,%ax
+  5c:	66 90                	xchg   %ax,%ax
+  5e:	66 90                	xchg   %ax,%ax
+
+00000060 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  60:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  61:	31 c0                	xor    %eax,%eax
+{
+  63:	89 e5                	mov    %esp,%ebp
+  65:	53                   	push   %ebx
+  66:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  69:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  70:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  74:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  77:	83 c0 01             	add    $0x1,%eax
+  7a:	84 d2                	test   %dl,%dl
+  7c:	75 f2                	jne    70 <strcpy+0x10>
+    ;
+  return os;
+}
+  7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  81:	89 c8                	mov    %ecx,%eax
+  83:	c9                   	leave
+  84:	c3                   	ret
+  85:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000090 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	53                   	push   %ebx
+  94:	8b 55 08             	mov    0x8(%ebp),%edx
+  97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  9a:	0f b6 02             	movzbl (%edx),%eax
+  9d:	84 c0                	test   %al,%al
+  9f:	75 17                	jne    b8 <strcmp+0x28>
+  a1:	eb 3a                	jmp    dd <strcmp+0x4d>
+  a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  a7:	90                   	nop
+  a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  ac:	83 c2 01             	add    $0x1,%edx
+  af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  b2:	84 c0                	test   %al,%al
+  b4:	74 1a                	je     d0 <strcmp+0x40>
+    p++, q++;
+  b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  b8:	0f b6 19             	movzbl (%ecx),%ebx
+  bb:	38 c3                	cmp    %al,%bl
+  bd:	74 e9                	je     a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  bf:	29 d8                	sub    %ebx,%eax
+}
+  c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  c4:	c9                   	leave
+  c5:	c3                   	ret
+  c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  d4:	31 c0                	xor    %eax,%eax
+  d6:	29 d8                	sub    %ebx,%eax
+}
+  d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  db:	c9                   	leave
+  dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  dd:	0f b6 19             	movzbl (%ecx),%ebx
+  e0:	31 c0                	xor    %eax,%eax
+  e2:	eb db                	jmp    bf <strcmp+0x2f>
+  e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ef:	90                   	nop
+
+000000f0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  f6:	80 3a 00             	cmpb   $0x0,(%edx)
+  f9:	74 15                	je     110 <strlen+0x20>
+  fb:	31 c0                	xor    %eax,%eax
+  fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 100:	83 c0 01             	add    $0x1,%eax
+ 103:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 107:	89 c1                	mov    %eax,%ecx
+ 109:	75 f5                	jne    100 <strlen+0x10>
+    ;
+  return n;
+}
+ 10b:	89 c8                	mov    %ecx,%eax
+ 10d:	5d                   	pop    %ebp
+ 10e:	c3                   	ret
+ 10f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 110:	31 c9                	xor    %ecx,%ecx
+}
+ 112:	5d                   	pop    %ebp
+ 113:	89 c8                	mov    %ecx,%eax
+ 115:	c3                   	ret
+ 116:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000120 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	57                   	push   %edi
+ 124:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 127:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 12a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 12d:	89 d7                	mov    %edx,%edi
+ 12f:	fc                   	cld
+ 130:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 132:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 135:	89 d0                	mov    %edx,%eax
+ 137:	c9                   	leave
+ 138:	c3                   	ret
+ 139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000140 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	8b 45 08             	mov    0x8(%ebp),%eax
+ 146:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 14a:	0f b6 10             	movzbl (%eax),%edx
+ 14d:	84 d2                	test   %dl,%dl
+ 14f:	75 12                	jne    163 <strchr+0x23>
+ 151:	eb 1d                	jmp    170 <strchr+0x30>
+ 153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 157:	90                   	nop
+ 158:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 15c:	83 c0 01             	add    $0x1,%eax
+ 15f:	84 d2                	test   %dl,%dl
+ 161:	74 0d                	je     170 <strchr+0x30>
+    if(*s == c)
+ 163:	38 d1                	cmp    %dl,%cl
+ 165:	75 f1                	jne    158 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 167:	5d                   	pop    %ebp
+ 168:	c3                   	ret
+ 169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 170:	31 c0                	xor    %eax,%eax
+}
+ 172:	5d                   	pop    %ebp
+ 173:	c3                   	ret
+ 174:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 17f:	90                   	nop
+
+00000180 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	57                   	push   %edi
+ 184:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 185:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 188:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 189:	31 db                	xor    %ebx,%ebx
+{
+ 18b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 18e:	eb 27                	jmp    1b7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 190:	83 ec 04             	sub    $0x4,%esp
+ 193:	6a 01                	push   $0x1
+ 195:	56                   	push   %esi
+ 196:	6a 00                	push   $0x0
+ 198:	e8 5e 01 00 00       	call   2fb <read>
+    if(cc < 1)
+ 19d:	83 c4 10             	add    $0x10,%esp
+ 1a0:	85 c0                	test   %eax,%eax
+ 1a2:	7e 1d                	jle    1c1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1ab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1af:	3c 0a                	cmp    $0xa,%al
+ 1b1:	74 10                	je     1c3 <gets+0x43>
+ 1b3:	3c 0d                	cmp    $0xd,%al
+ 1b5:	74 0c                	je     1c3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1b7:	89 df                	mov    %ebx,%edi
+ 1b9:	83 c3 01             	add    $0x1,%ebx
+ 1bc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1bf:	7c cf                	jl     190 <gets+0x10>
+ 1c1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1cd:	5b                   	pop    %ebx
+ 1ce:	5e                   	pop    %esi
+ 1cf:	5f                   	pop    %edi
+ 1d0:	5d                   	pop    %ebp
+ 1d1:	c3                   	ret
+ 1d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001e0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	56                   	push   %esi
+ 1e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1e5:	83 ec 08             	sub    $0x8,%esp
+ 1e8:	6a 00                	push   $0x0
+ 1ea:	ff 75 08             	push   0x8(%ebp)
+ 1ed:	e8 31 01 00 00       	call   323 <open>
+  if(fd < 0)
+ 1f2:	83 c4 10             	add    $0x10,%esp
+ 1f5:	85 c0                	test   %eax,%eax
+ 1f7:	78 27                	js     220 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1f9:	83 ec 08             	sub    $0x8,%esp
+ 1fc:	ff 75 0c             	push   0xc(%ebp)
+ 1ff:	89 c3                	mov    %eax,%ebx
+ 201:	50                   	push   %eax
+ 202:	e8 34 01 00 00       	call   33b <fstat>
+  close(fd);
+ 207:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 20a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 20c:	e8 fa 00 00 00       	call   30b <close>
+  return r;
+ 211:	83 c4 10             	add    $0x10,%esp
+}
+ 214:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 217:	89 f0                	mov    %esi,%eax
+ 219:	5b                   	pop    %ebx
+ 21a:	5e                   	pop    %esi
+ 21b:	5d                   	pop    %ebp
+ 21c:	c3                   	ret
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 220:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 225:	eb ed                	jmp    214 <stat+0x34>
+ 227:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22e:	66 90                	xchg   %ax,%ax
+
+00000230 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	53                   	push   %ebx
+ 234:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 237:	0f be 02             	movsbl (%edx),%eax
+ 23a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 23d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 240:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 245:	77 1e                	ja     265 <atoi+0x35>
+ 247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 250:	83 c2 01             	add    $0x1,%edx
+ 253:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 256:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 25a:	0f be 02             	movsbl (%edx),%eax
+ 25d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 260:	80 fb 09             	cmp    $0x9,%bl
+ 263:	76 eb                	jbe    250 <atoi+0x20>
+  return n;
+}
+ 265:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 268:	89 c8                	mov    %ecx,%eax
+ 26a:	c9                   	leave
+ 26b:	c3                   	ret
+ 26c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000270 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	57                   	push   %edi
+ 274:	56                   	push   %esi
+ 275:	8b 45 10             	mov    0x10(%ebp),%eax
+ 278:	8b 55 08             	mov    0x8(%ebp),%edx
+ 27b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 27e:	85 c0                	test   %eax,%eax
+ 280:	7e 13                	jle    295 <memmove+0x25>
+ 282:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 284:	89 d7                	mov    %edx,%edi
+ 286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 290:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 291:	39 f8                	cmp    %edi,%eax
+ 293:	75 fb                	jne    290 <memmove+0x20>
+  return vdst;
+}
+ 295:	5e                   	pop    %esi
+ 296:	89 d0                	mov    %edx,%eax
+ 298:	5f                   	pop    %edi
+ 299:	5d                   	pop    %ebp
+ 29a:	c3                   	ret
+
+0000029b <ccreate>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(ccreate)
+ 29b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 2a0:	cd 40                	int    $0x40
+ 2a2:	c3                   	ret
+
+000002a3 <cfork>:
+SYSCALL(cfork)
+ 2a3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 2a8:	cd 40                	int    $0x40
+ 2aa:	c3                   	ret
+
+000002ab <cgetrootdir>:
+SYSCALL(cgetrootdir)
+ 2ab:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 2b0:	cd 40                	int    $0x40
+ 2b2:	c3                   	ret
+
+000002b3 <getcontrootdir>:
+SYSCALL(getcontrootdir)
+ 2b3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 2b8:	cd 40                	int    $0x40
+ 2ba:	c3                   	ret
+
+000002bb <cpause>:
+SYSCALL(cpause)
+ 2bb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 2c0:	cd 40                	int    $0x40
+ 2c2:	c3                   	ret
+
+000002c3 <cresume>:
+SYSCALL(cresume)
+ 2c3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 2c8:	cd 40                	int    $0x40
+ 2ca:	c3                   	ret
+
+000002cb <cstart>:
+SYSCALL(cstart)
+ 2cb:	b8 18 00 00 00       	mov    $0x18,%eax
+ 2d0:	cd 40                	int    $0x40
+ 2d2:	c3                   	ret
+
+000002d3 <cstop>:
+SYSCALL(cstop)
+ 2d3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 2d8:	cd 40                	int    $0x40
+ 2da:	c3                   	ret
+
+000002db <fork>:
+SYSCALL(fork)
+ 2db:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2e0:	cd 40                	int    $0x40
+ 2e2:	c3                   	ret
+
+000002e3 <exit>:
+SYSCALL(exit)
+ 2e3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2e8:	cd 40                	int    $0x40
+ 2ea:	c3                   	ret
+
+000002eb <wait>:
+SYSCALL(wait)
+ 2eb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2f0:	cd 40                	int    $0x40
+ 2f2:	c3                   	ret
+
+000002f3 <pipe>:
+SYSCALL(pipe)
+ 2f3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2f8:	cd 40                	int    $0x40
+ 2fa:	c3                   	ret
+
+000002fb <read>:
+SYSCALL(read)
+ 2fb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <write>:
+SYSCALL(write)
+ 303:	b8 10 00 00 00       	mov    $0x10,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <close>:
+SYSCALL(close)
+ 30b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <kill>:
+SYSCALL(kill)
+ 313:	b8 06 00 00 00       	mov    $0x6,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <exec>:
+SYSCALL(exec)
+ 31b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <open>:
+SYSCALL(open)
+ 323:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <mknod>:
+SYSCALL(mknod)
+ 32b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <unlink>:
+SYSCALL(unlink)
+ 333:	b8 12 00 00 00       	mov    $0x12,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <fstat>:
+SYSCALL(fstat)
+ 33b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <link>:
+SYSCALL(link)
+ 343:	b8 13 00 00 00       	mov    $0x13,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <mkdir>:
+SYSCALL(mkdir)
+ 34b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <chdir>:
+SYSCALL(chdir)
+ 353:	b8 09 00 00 00       	mov    $0x9,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <dup>:
+SYSCALL(dup)
+ 35b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <getpid>:
+SYSCALL(getpid)
+ 363:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <sbrk>:
+SYSCALL(sbrk)
+ 36b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <sleep>:
+SYSCALL(sleep)
+ 373:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <uptime>:
+SYSCALL(uptime)
+ 37b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <cps>:
+SYSCALL(cps)
+ 383:	b8 16 00 00 00       	mov    $0x16,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <mmap>:
+SYSCALL(mmap)
+ 38b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <munmap>:
+SYSCALL(munmap)
+ 393:	b8 20 00 00 00       	mov    $0x20,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <shmget>:
+SYSCALL(shmget)
+ 39b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <climit>:
+SYSCALL(climit)
+ 3a3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <spawn>:
+SYSCALL(spawn)
+ 3ab:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <clone>:
+SYSCALL(clone)
+ 3b3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <join>:
+SYSCALL(join)
+ 3bb:	b8 25 00 00 00       	mov    $0x25,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <futex>:
+SYSCALL(futex)
+ 3c3:	b8 26 00 00 00       	mov    $0x26,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <ccheckpoint>:
+SYSCALL(ccheckpoint)
+ 3cb:	b8 27 00 00 00       	mov    $0x27,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <crestore>:
+SYSCALL(crestore)
+ 3d3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <czygote>:
+SYSCALL(czygote)
+ 3db:	b8 29 00 00 00       	mov    $0x29,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <memstats>:
+SYSCALL(memstats)
+ 3e3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+ 3eb:	66 90                	xchg   %ax,%ax
+ 3ed:	66 90                	xchg   %ax,%ax
+ 3ef:	90                   	nop
+
+000003f0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	57                   	push   %edi
+ 3f4:	56                   	push   %esi
+ 3f5:	53                   	push   %ebx
+ 3f6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 3f8:	89 d1                	mov    %edx,%ecx
+{
+ 3fa:	83 ec 3c             	sub    $0x3c,%esp
+ 3fd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 400:	85 d2                	test   %edx,%edx
+ 402:	0f 89 80 00 00 00    	jns    488 <printint+0x98>
+ 408:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 40c:	74 7a                	je     488 <printint+0x98>
+    x = -xx;
+ 40e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 410:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 415:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 418:	31 f6                	xor    %esi,%esi
+ 41a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 420:	89 c8                	mov    %ecx,%eax
+ 422:	31 d2                	xor    %edx,%edx
+ 424:	89 f7                	mov    %esi,%edi
+ 426:	f7 f3                	div    %ebx
+ 428:	8d 76 01             	lea    0x1(%esi),%esi
+ 42b:	0f b6 92 08 0c 00 00 	movzbl 0xc08(%edx),%edx
+ 432:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 436:	89 ca                	mov    %ecx,%edx
+ 438:	89 c1                	mov    %eax,%ecx
+ 43a:	39 da                	cmp    %ebx,%edx
+ 43c:	73 e2                	jae    420 <printint+0x30>
+  if(neg)
+ 43e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 441:	85 c0                	test   %eax,%eax
+ 443:	74 07                	je     44c <printint+0x5c>
+    buf[i++] = '-';
+ 445:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 44a:	89 f7                	mov    %esi,%edi
+ 44c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 44f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 452:	01 df                	add    %ebx,%edi
+ 454:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 458:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 45b:	83 ec 04             	sub    $0x4,%esp
+ 45e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 461:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 464:	6a 01                	push   $0x1
+ 466:	50                   	push   %eax
+ 467:	56                   	push   %esi
+ 468:	e8 96 fe ff ff       	call   303 <write>
+  while(--i >= 0)
+ 46d:	89 f8                	mov    %edi,%eax
+ 46f:	83 c4 10             	add    $0x10,%esp
+ 472:	83 ef 01             	sub    $0x1,%edi
+ 475:	39 d8                	cmp    %ebx,%eax
+ 477:	75 df                	jne    458 <printint+0x68>
+}
+ 479:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 47c:	5b                   	pop    %ebx
+ 47d:	5e                   	pop    %esi
+ 47e:	5f                   	pop    %edi
+ 47f:	5d                   	pop    %ebp
+ 480:	c3                   	ret
+ 481:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 488:	31 c0                	xor    %eax,%eax
+ 48a:	eb 89                	jmp    415 <printint+0x25>
+ 48c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	56                   	push   %esi
+ 495:	53                   	push   %ebx
+ 496:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 499:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 49c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 49f:	0f b6 1e             	movzbl (%esi),%ebx
+ 4a2:	83 c6 01             	add    $0x1,%esi
+ 4a5:	84 db                	test   %bl,%bl
+ 4a7:	74 67                	je     510 <printf+0x80>
+ 4a9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 4ac:	31 d2                	xor    %edx,%edx
+ 4ae:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 4b1:	eb 34                	jmp    4e7 <printf+0x57>
+ 4b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4b7:	90                   	nop
+ 4b8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 4bb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 4c0:	83 f8 25             	cmp    $0x25,%eax
+ 4c3:	74 18                	je     4dd <printf+0x4d>
+  write(fd, &c, 1);
+ 4c5:	83 ec 04             	sub    $0x4,%esp
+ 4c8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 4cb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 4ce:	6a 01                	push   $0x1
+ 4d0:	50                   	push   %eax
+ 4d1:	57                   	push   %edi
+ 4d2:	e8 2c fe ff ff       	call   303 <write>
+ 4d7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 4da:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 4dd:	0f b6 1e             	movzbl (%esi),%ebx
+ 4e0:	83 c6 01             	add    $0x1,%esi
+ 4e3:	84 db                	test   %bl,%bl
+ 4e5:	74 29                	je     510 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 4e7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 4ea:	85 d2                	test   %edx,%edx
+ 4ec:	74 ca                	je     4b8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 4ee:	83 fa 25             	cmp    $0x25,%edx
+ 4f1:	75 ea                	jne    4dd <printf+0x4d>
+      if(c == 'd'){
+ 4f3:	83 f8 25             	cmp    $0x25,%eax
+ 4f6:	0f 84 24 01 00 00    	je     620 <printf+0x190>
+ 4fc:	83 e8 63             	sub    $0x63,%eax
+ 4ff:	83 f8 15             	cmp    $0x15,%eax
+ 502:	77 1c                	ja     520 <printf+0x90>
+ 504:	ff 24 85 b0 0b 00 00 	jmp    *0xbb0(,%eax,4)
+ 50b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 50f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 510:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 513:	5b                   	pop    %ebx
+ 514:	5e                   	pop    %esi
+ 515:	5f                   	pop    %edi
+ 516:	5d                   	pop    %ebp
+ 517:	c3                   	ret
+ 518:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 51f:	90                   	nop
+  write(fd, &c, 1);
+ 520:	83 ec 04             	sub    $0x4,%esp
+ 523:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 526:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 52a:	6a 01                	push   $0x1
+ 52c:	52                   	push   %edx
+ 52d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 530:	57                   	push   %edi
+ 531:	e8 cd fd ff ff       	call   303 <write>
+ 536:	83 c4 0c             	add    $0xc,%esp
+ 539:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 53c:	6a 01                	push   $0x1
+ 53e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 541:	52                   	push   %edx
+ 542:	57                   	push   %edi
+ 543:	e8 bb fd ff ff       	call   303 <write>
+        putc(fd, c);
+ 548:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 54b:	31 d2                	xor    %edx,%edx
+ 54d:	eb 8e                	jmp    4dd <printf+0x4d>
+ 54f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 550:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 553:	83 ec 0c             	sub    $0xc,%esp
+ 556:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 55b:	8b 13                	mov    (%ebx),%edx
+ 55d:	6a 00                	push   $0x0
+ 55f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 561:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 564:	e8 87 fe ff ff       	call   3f0 <printint>
+        ap++;
+ 569:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 56c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 56f:	31 d2                	xor    %edx,%edx
+ 571:	e9 67 ff ff ff       	jmp    4dd <printf+0x4d>
+ 576:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 57d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 580:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 583:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 585:	83 c0 04             	add    $0x4,%eax
+ 588:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 58b:	85 db                	test   %ebx,%ebx
+ 58d:	0f 84 9d 00 00 00    	je     630 <printf+0x1a0>
+        while(*s != 0){
+ 593:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 596:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 598:	84 c0                	test   %al,%al
+ 59a:	0f 84 3d ff ff ff    	je     4dd <printf+0x4d>
+ 5a0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5a3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 5a6:	89 de                	mov    %ebx,%esi
+ 5a8:	89 d3                	mov    %edx,%ebx
+ 5aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 5b0:	83 ec 04             	sub    $0x4,%esp
+ 5b3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 5b6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 5b9:	6a 01                	push   $0x1
+ 5bb:	53                   	push   %ebx
+ 5bc:	57                   	push   %edi
+ 5bd:	e8 41 fd ff ff       	call   303 <write>
+        while(*s != 0){
+ 5c2:	0f b6 06             	movzbl (%esi),%eax
+ 5c5:	83 c4 10             	add    $0x10,%esp
+ 5c8:	84 c0                	test   %al,%al
+ 5ca:	75 e4                	jne    5b0 <printf+0x120>
+      state = 0;
+ 5cc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 5cf:	31 d2                	xor    %edx,%edx
+ 5d1:	e9 07 ff ff ff       	jmp    4dd <printf+0x4d>
+ 5d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5dd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 5e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5e3:	83 ec 0c             	sub    $0xc,%esp
+ 5e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5eb:	8b 13                	mov    (%ebx),%edx
+ 5ed:	6a 01                	push   $0x1
+ 5ef:	e9 6b ff ff ff       	jmp    55f <printf+0xcf>
+ 5f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 5f8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 5fb:	83 ec 04             	sub    $0x4,%esp
+ 5fe:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 601:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 603:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 606:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 609:	6a 01                	push   $0x1
+ 60b:	52                   	push   %edx
+ 60c:	57                   	push   %edi
+ 60d:	e8 f1 fc ff ff       	call   303 <write>
+        ap++;
+ 612:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 615:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 618:	31 d2                	xor    %edx,%edx
+ 61a:	e9 be fe ff ff       	jmp    4dd <printf+0x4d>
+ 61f:	90                   	nop
+  write(fd, &c, 1);
+ 620:	83 ec 04             	sub    $0x4,%esp
+ 623:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 626:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 629:	6a 01                	push   $0x1
+ 62b:	e9 11 ff ff ff       	jmp    541 <printf+0xb1>
+ 630:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 635:	bb a7 0b 00 00       	mov    $0xba7,%ebx
+ 63a:	e9 61 ff ff ff       	jmp    5a0 <printf+0x110>
+ 63f:	90                   	nop
+
+00000640 <runfree>:
+
+// Give the n pages at r back to the free runs, merging them with
+// adjacent runs, and shrink the heap if the end of it is free.
+static void
+runfree(struct page *r, uint n)
+{
+ 640:	55                   	push   %ebp
+  struct page **pp, *prev;
+
+  r->kind = PFREE;
+ 641:	b9 03 00 00 00       	mov    $0x3,%ecx
+{
+ 646:	89 e5                	mov    %esp,%ebp
+ 648:	57                   	push   %edi
+ 649:	56                   	push   %esi
+ 64a:	53                   	push   %ebx
+ 64b:	89 c3                	mov    %eax,%ebx
+ 64d:	83 ec 0c             	sub    $0xc,%esp
+  r->kind = PFREE;
+ 650:	66 89 08             	mov    %cx,(%eax)
+  r->npages = n;
+  prev = 0;
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 653:	8b 0d 1c 0f 00 00    	mov    0xf1c,%ecx
+  r->npages = n;
+ 659:	89 50 04             	mov    %edx,0x4(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 65c:	85 c9                	test   %ecx,%ecx
+ 65e:	0f 84 1f 01 00 00    	je     783 <runfree+0x143>
+ 664:	39 c1                	cmp    %eax,%ecx
+ 666:	0f 83 f7 00 00 00    	jae    763 <runfree+0x123>
+ 66c:	89 c8                	mov    %ecx,%eax
+ 66e:	eb 04                	jmp    674 <runfree+0x34>
+ 670:	39 d8                	cmp    %ebx,%eax
+ 672:	73 09                	jae    67d <runfree+0x3d>
+ 674:	89 c2                	mov    %eax,%edx
+ 676:	8b 40 14             	mov    0x14(%eax),%eax
+ 679:	85 c0                	test   %eax,%eax
+ 67b:	75 f3                	jne    670 <runfree+0x30>
+    prev = *pp;
+  r->next = *pp;
+ 67d:	89 43 14             	mov    %eax,0x14(%ebx)
+  *pp = r;
+ 680:	89 5a 14             	mov    %ebx,0x14(%edx)
+
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 683:	8b 43 14             	mov    0x14(%ebx),%eax
+ 686:	85 c0                	test   %eax,%eax
+ 688:	74 12                	je     69c <runfree+0x5c>
+ 68a:	8b 7b 04             	mov    0x4(%ebx),%edi
+ 68d:	89 fe                	mov    %edi,%esi
+ 68f:	c1 e6 0c             	shl    $0xc,%esi
+ 692:	01 de                	add    %ebx,%esi
+ 694:	39 f0                	cmp    %esi,%eax
+ 696:	0f 84 a4 00 00 00    	je     740 <runfree+0x100>
+    r->npages += r->next->npages;
+    r->next = r->next->next;
+  }
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 69c:	8b 72 04             	mov    0x4(%edx),%esi
+ 69f:	89 f0                	mov    %esi,%eax
+ 6a1:	c1 e0 0c             	shl    $0xc,%eax
+ 6a4:	01 d0                	add    %edx,%eax
+ 6a6:	39 c3                	cmp    %eax,%ebx
+ 6a8:	74 16                	je     6c0 <runfree+0x80>
+    pp = &runs;
+    while(*pp != r)
+      pp = &(*pp)->next;
+  }
+
+  if(r->next == 0 && r->npages >= TRIM &&
+ 6aa:	8b 43 14             	mov    0x14(%ebx),%eax
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 6ad:	8d 72 14             	lea    0x14(%edx),%esi
+  if(r->next == 0 && r->npages >= TRIM &&
+ 6b0:	85 c0                	test   %eax,%eax
+ 6b2:	74 3c                	je     6f0 <runfree+0xb0>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+    *pp = 0;
+    sbrk(-(int)(r->npages*PGSIZE));
+    heapend = (char*)r;
+  }
+}
+ 6b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6b7:	5b                   	pop    %ebx
+ 6b8:	5e                   	pop    %esi
+ 6b9:	5f                   	pop    %edi
+ 6ba:	5d                   	pop    %ebp
+ 6bb:	c3                   	ret
+ 6bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    prev->npages += r->npages;
+ 6c0:	03 73 04             	add    0x4(%ebx),%esi
+ 6c3:	89 72 04             	mov    %esi,0x4(%edx)
+    prev->next = r->next;
+ 6c6:	8b 43 14             	mov    0x14(%ebx),%eax
+ 6c9:	89 42 14             	mov    %eax,0x14(%edx)
+    while(*pp != r)
+ 6cc:	39 d1                	cmp    %edx,%ecx
+ 6ce:	0f 84 c5 00 00 00    	je     799 <runfree+0x159>
+ 6d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      pp = &(*pp)->next;
+ 6d8:	89 cb                	mov    %ecx,%ebx
+ 6da:	8b 49 14             	mov    0x14(%ecx),%ecx
+    while(*pp != r)
+ 6dd:	39 d1                	cmp    %edx,%ecx
+ 6df:	75 f7                	jne    6d8 <runfree+0x98>
+      pp = &(*pp)->next;
+ 6e1:	8d 73 14             	lea    0x14(%ebx),%esi
+ 6e4:	89 cb                	mov    %ecx,%ebx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 6e6:	85 c0                	test   %eax,%eax
+ 6e8:	75 ca                	jne    6b4 <runfree+0x74>
+ 6ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 6f0:	8b 53 04             	mov    0x4(%ebx),%edx
+ 6f3:	83 fa 1f             	cmp    $0x1f,%edx
+ 6f6:	76 bc                	jbe    6b4 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 6f8:	c1 e2 0c             	shl    $0xc,%edx
+ 6fb:	01 da                	add    %ebx,%edx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 6fd:	39 15 18 0f 00 00    	cmp    %edx,0xf18
+ 703:	75 af                	jne    6b4 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 705:	83 ec 0c             	sub    $0xc,%esp
+ 708:	6a 00                	push   $0x0
+ 70a:	e8 5c fc ff ff       	call   36b <sbrk>
+ 70f:	83 c4 10             	add    $0x10,%esp
+ 712:	39 05 18 0f 00 00    	cmp    %eax,0xf18
+ 718:	75 9a                	jne    6b4 <runfree+0x74>
+    *pp = 0;
+ 71a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    sbrk(-(int)(r->npages*PGSIZE));
+ 720:	8b 43 04             	mov    0x4(%ebx),%eax
+ 723:	83 ec 0c             	sub    $0xc,%esp
+ 726:	c1 e0 0c             	shl    $0xc,%eax
+ 729:	f7 d8                	neg    %eax
+ 72b:	50                   	push   %eax
+ 72c:	e8 3a fc ff ff       	call   36b <sbrk>
+    heapend = (char*)r;
+ 731:	89 1d 18 0f 00 00    	mov    %ebx,0xf18
+ 737:	83 c4 10             	add    $0x10,%esp
+}
+ 73a:	e9 75 ff ff ff       	jmp    6b4 <runfree+0x74>
+ 73f:	90                   	nop
+    r->npages += r->next->npages;
+ 740:	03 78 04             	add    0x4(%eax),%edi
+ 743:	89 7b 04             	mov    %edi,0x4(%ebx)
+    r->next = r->next->next;
+ 746:	8b 40 14             	mov    0x14(%eax),%eax
+ 749:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 74c:	8b 72 04             	mov    0x4(%edx),%esi
+ 74f:	89 f0                	mov    %esi,%eax
+ 751:	c1 e0 0c             	shl    $0xc,%eax
+ 754:	01 d0                	add    %edx,%eax
+ 756:	39 c3                	cmp    %eax,%ebx
+ 758:	0f 85 4c ff ff ff    	jne    6aa <runfree+0x6a>
+ 75e:	e9 5d ff ff ff       	jmp    6c0 <runfree+0x80>
+  r->next = *pp;
+ 763:	89 48 14             	mov    %ecx,0x14(%eax)
+  *pp = r;
+ 766:	a3 1c 0f 00 00       	mov    %eax,0xf1c
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 76b:	89 d0                	mov    %edx,%eax
+ 76d:	c1 e0 0c             	shl    $0xc,%eax
+ 770:	01 d8                	add    %ebx,%eax
+ 772:	39 c1                	cmp    %eax,%ecx
+ 774:	74 2f                	je     7a5 <runfree+0x165>
+  if(r->next == 0 && r->npages >= TRIM &&
+ 776:	8b 43 14             	mov    0x14(%ebx),%eax
+ 779:	be 1c 0f 00 00       	mov    $0xf1c,%esi
+ 77e:	e9 2d ff ff ff       	jmp    6b0 <runfree+0x70>
+  r->next = *pp;
+ 783:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 78a:	be 1c 0f 00 00       	mov    $0xf1c,%esi
+  *pp = r;
+ 78f:	a3 1c 0f 00 00       	mov    %eax,0xf1c
+  if(r->next == 0 && r->npages >= TRIM &&
+ 794:	e9 5a ff ff ff       	jmp    6f3 <runfree+0xb3>
+    while(*pp != r)
+ 799:	89 cb                	mov    %ecx,%ebx
+    pp = &runs;
+ 79b:	be 1c 0f 00 00       	mov    $0xf1c,%esi
+ 7a0:	e9 0b ff ff ff       	jmp    6b0 <runfree+0x70>
+    r->npages += r->next->npages;
+ 7a5:	03 51 04             	add    0x4(%ecx),%edx
+ 7a8:	89 53 04             	mov    %edx,0x4(%ebx)
+    r->next = r->next->next;
+ 7ab:	8b 41 14             	mov    0x14(%ecx),%eax
+ 7ae:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 7b1:	eb c3                	jmp    776 <runfree+0x136>
+ 7b3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000007c0 <runalloc>:
+
+// Take a run of n pages from the start of the first free run
+// long enough, which keeps the end of the heap free to trim.
+static struct page*
+runalloc(uint n)
+{
+ 7c0:	55                   	push   %ebp
+ 7c1:	89 e5                	mov    %esp,%ebp
+ 7c3:	57                   	push   %edi
+ 7c4:	56                   	push   %esi
+ 7c5:	89 c6                	mov    %eax,%esi
+ 7c7:	53                   	push   %ebx
+ 7c8:	83 ec 1c             	sub    $0x1c,%esp
+  struct page **pp, *r, *rest;
+
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ 7cb:	8b 1d 1c 0f 00 00    	mov    0xf1c,%ebx
+ 7d1:	85 db                	test   %ebx,%ebx
+ 7d3:	74 4d                	je     822 <runalloc+0x62>
+ 7d5:	b9 1c 0f 00 00       	mov    $0xf1c,%ecx
+    if(r->npages < n)
+ 7da:	39 73 04             	cmp    %esi,0x4(%ebx)
+ 7dd:	72 39                	jb     818 <runalloc+0x58>
+      continue;
+    if(r->npages == n){
+ 7df:	0f 84 9b 00 00 00    	je     880 <runalloc+0xc0>
+      *pp = r->next;
+    } else {
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ 7e5:	89 f0                	mov    %esi,%eax
+      rest->kind = PFREE;
+ 7e7:	ba 03 00 00 00       	mov    $0x3,%edx
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ 7ec:	c1 e0 0c             	shl    $0xc,%eax
+ 7ef:	01 d8                	add    %ebx,%eax
+      rest->kind = PFREE;
+ 7f1:	66 89 10             	mov    %dx,(%eax)
+      rest->npages = r->npages - n;
+ 7f4:	8b 53 04             	mov    0x4(%ebx),%edx
+ 7f7:	29 f2                	sub    %esi,%edx
+ 7f9:	89 50 04             	mov    %edx,0x4(%eax)
+      rest->next = r->next;
+ 7fc:	8b 53 14             	mov    0x14(%ebx),%edx
+ 7ff:	89 50 14             	mov    %edx,0x14(%eax)
+      *pp = rest;
+ 802:	89 01                	mov    %eax,(%ecx)
+      r->npages = n;
+ 804:	89 73 04             	mov    %esi,0x4(%ebx)
+    }
+    return r;
+  }
+  return morecore(n);
+}
+ 807:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 80a:	89 d8                	mov    %ebx,%eax
+ 80c:	5b                   	pop    %ebx
+ 80d:	5e                   	pop    %esi
+ 80e:	5f                   	pop    %edi
+ 80f:	5d                   	pop    %ebp
+ 810:	c3                   	ret
+ 811:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ 818:	8d 4b 14             	lea    0x14(%ebx),%ecx
+ 81b:	8b 5b 14             	mov    0x14(%ebx),%ebx
+ 81e:	85 db                	test   %ebx,%ebx
+ 820:	75 b8                	jne    7da <runalloc+0x1a>
+  m = n < MINCORE ? MINCORE : n;
+ 822:	bf 08 00 00 00       	mov    $0x8,%edi
+ 827:	39 fe                	cmp    %edi,%esi
+ 829:	0f 43 fe             	cmovae %esi,%edi
+  brk = sbrk(0);
+ 82c:	83 ec 0c             	sub    $0xc,%esp
+ 82f:	6a 00                	push   $0x0
+ 831:	e8 35 fb ff ff       	call   36b <sbrk>
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 836:	89 fa                	mov    %edi,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 838:	89 c3                	mov    %eax,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 83a:	c1 e2 0c             	shl    $0xc,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 83d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 840:	f7 db                	neg    %ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 842:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 845:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 84b:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+ 84e:	89 04 24             	mov    %eax,(%esp)
+ 851:	e8 15 fb ff ff       	call   36b <sbrk>
+ 856:	83 c4 10             	add    $0x10,%esp
+ 859:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 85c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 85f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 862:	74 3e                	je     8a2 <runalloc+0xe2>
+  r = (struct page*)(brk + pad);
+ 864:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ 866:	01 da                	add    %ebx,%edx
+ 868:	89 15 18 0f 00 00    	mov    %edx,0xf18
+  if(m > n)
+ 86e:	39 fe                	cmp    %edi,%esi
+ 870:	72 1e                	jb     890 <runalloc+0xd0>
+  r->npages = n;
+ 872:	89 73 04             	mov    %esi,0x4(%ebx)
+  return r;
+ 875:	eb 90                	jmp    807 <runalloc+0x47>
+ 877:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 87e:	66 90                	xchg   %ax,%ax
+      *pp = r->next;
+ 880:	8b 43 14             	mov    0x14(%ebx),%eax
+ 883:	89 01                	mov    %eax,(%ecx)
+}
+ 885:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 888:	89 d8                	mov    %ebx,%eax
+ 88a:	5b                   	pop    %ebx
+ 88b:	5e                   	pop    %esi
+ 88c:	5f                   	pop    %edi
+ 88d:	5d                   	pop    %ebp
+ 88e:	c3                   	ret
+ 88f:	90                   	nop
+    runfree((struct page*)((char*)r + n*PGSIZE), m - n);
+ 890:	89 f0                	mov    %esi,%eax
+ 892:	29 f7                	sub    %esi,%edi
+ 894:	c1 e0 0c             	shl    $0xc,%eax
+ 897:	89 fa                	mov    %edi,%edx
+ 899:	01 d8                	add    %ebx,%eax
+ 89b:	e8 a0 fd ff ff       	call   640 <runfree>
+ 8a0:	eb d0                	jmp    872 <runalloc+0xb2>
+    if(sbrk(pad + m*PGSIZE) == (char*)-1)
+ 8a2:	89 f7                	mov    %esi,%edi
+ 8a4:	83 ec 0c             	sub    $0xc,%esp
+ 8a7:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 8aa:	c1 e7 0c             	shl    $0xc,%edi
+ 8ad:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+ 8b0:	50                   	push   %eax
+ 8b1:	e8 b5 fa ff ff       	call   36b <sbrk>
+ 8b6:	83 c4 10             	add    $0x10,%esp
+ 8b9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 8bc:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8bf:	74 0c                	je     8cd <runalloc+0x10d>
+  r = (struct page*)(brk + pad);
+ 8c1:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ 8c3:	01 df                	add    %ebx,%edi
+ 8c5:	89 3d 18 0f 00 00    	mov    %edi,0xf18
+  if(m > n)
+ 8cb:	eb a5                	jmp    872 <runalloc+0xb2>
+      return 0;
+ 8cd:	31 db                	xor    %ebx,%ebx
+ 8cf:	e9 33 ff ff ff       	jmp    807 <runalloc+0x47>
+ 8d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8df:	90                   	nop
+
+000008e0 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+ 8e0:	55                   	push   %ebp
+ 8e1:	89 e5                	mov    %esp,%ebp
+ 8e3:	56                   	push   %esi
+ 8e4:	53                   	push   %ebx
+ 8e5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  struct page *p;
+
+  if(ap == 0)
+ 8e8:	85 c9                	test   %ecx,%ecx
+ 8ea:	74 1c                	je     908 <free+0x28>
+    return;
+  p = (struct page*)((uint)ap & ~(PGSIZE-1));
+ 8ec:	89 c8                	mov    %ecx,%eax
+ 8ee:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  switch(p->kind){
+ 8f3:	0f b7 10             	movzwl (%eax),%edx
+ 8f6:	66 83 fa 02          	cmp    $0x2,%dx
+ 8fa:	74 14                	je     910 <free+0x30>
+ 8fc:	66 83 fa 04          	cmp    $0x4,%dx
+ 900:	74 66                	je     968 <free+0x88>
+ 902:	66 83 fa 01          	cmp    $0x1,%dx
+ 906:	74 18                	je     920 <free+0x40>
+    break;
+  case PMAP:
+    munmap(p, p->npages*PGSIZE);
+    break;
+  }
+}
+ 908:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 90b:	5b                   	pop    %ebx
+ 90c:	5e                   	pop    %esi
+ 90d:	5d                   	pop    %ebp
+ 90e:	c3                   	ret
+ 90f:	90                   	nop
+    runfree(p, p->npages);
+ 910:	8b 50 04             	mov    0x4(%eax),%edx
+}
+ 913:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 916:	5b                   	pop    %ebx
+ 917:	5e                   	pop    %esi
+ 918:	5d                   	pop    %ebp
+    runfree(p, p->npages);
+ 919:	e9 22 fd ff ff       	jmp    640 <runfree>
+ 91e:	66 90                	xchg   %ax,%ax
+  b->next = p->free;
+ 920:	8b 50 0c             	mov    0xc(%eax),%edx
+ 923:	89 11                	mov    %edx,(%ecx)
+  if(p->nfree++ == 0)
+ 925:	8b 50 08             	mov    0x8(%eax),%edx
+  p->free = b;
+ 928:	89 48 0c             	mov    %ecx,0xc(%eax)
+  if(p->nfree++ == 0)
+ 92b:	8d 5a 01             	lea    0x1(%edx),%ebx
+ 92e:	89 58 08             	mov    %ebx,0x8(%eax)
+ 931:	85 d2                	test   %edx,%edx
+ 933:	74 53                	je     988 <free+0xa8>
+  if(p->nfree == nblocks(p->class)){
+ 935:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ 939:	8d 4e 04             	lea    0x4(%esi),%ecx
+ 93c:	ba e0 0f 00 00       	mov    $0xfe0,%edx
+ 941:	d3 fa                	sar    %cl,%edx
+  if(p->nfree == nblocks(p->class)){
+ 943:	39 da                	cmp    %ebx,%edx
+ 945:	75 c1                	jne    908 <free+0x28>
+  if(p->prev)
+ 947:	8b 48 18             	mov    0x18(%eax),%ecx
+    p->prev->next = p->next;
+ 94a:	8b 50 14             	mov    0x14(%eax),%edx
+  if(p->prev)
+ 94d:	85 c9                	test   %ecx,%ecx
+ 94f:	74 6f                	je     9c0 <free+0xe0>
+    p->prev->next = p->next;
+ 951:	89 51 14             	mov    %edx,0x14(%ecx)
+  if(p->next)
+ 954:	85 d2                	test   %edx,%edx
+ 956:	74 06                	je     95e <free+0x7e>
+    p->next->prev = p->prev;
+ 958:	8b 48 18             	mov    0x18(%eax),%ecx
+ 95b:	89 4a 18             	mov    %ecx,0x18(%edx)
+    runfree(p, 1);
+ 95e:	ba 01 00 00 00       	mov    $0x1,%edx
+ 963:	eb ae                	jmp    913 <free+0x33>
+ 965:	8d 76 00             	lea    0x0(%esi),%esi
+    munmap(p, p->npages*PGSIZE);
+ 968:	8b 50 04             	mov    0x4(%eax),%edx
+ 96b:	83 ec 08             	sub    $0x8,%esp
+ 96e:	c1 e2 0c             	shl    $0xc,%edx
+ 971:	52                   	push   %edx
+ 972:	50                   	push   %eax
+ 973:	e8 1b fa ff ff       	call   393 <munmap>
+    break;
+ 978:	83 c4 10             	add    $0x10,%esp
+}
+ 97b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 97e:	5b                   	pop    %ebx
+ 97f:	5e                   	pop    %esi
+ 980:	5d                   	pop    %ebp
+ 981:	c3                   	ret
+ 982:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  p->next = partial[p->class];
+ 988:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  p->prev = 0;
+ 98c:	c7 40 18 00 00 00 00 	movl   $0x0,0x18(%eax)
+  p->next = partial[p->class];
+ 993:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 998:	8b 14 b5 20 0f 00 00 	mov    0xf20(,%esi,4),%edx
+ 99f:	89 50 14             	mov    %edx,0x14(%eax)
+  if(p->next)
+ 9a2:	85 d2                	test   %edx,%edx
+ 9a4:	74 0a                	je     9b0 <free+0xd0>
+    p->next->prev = p;
+ 9a6:	89 42 18             	mov    %eax,0x18(%edx)
+  partial[p->class] = p;
+ 9a9:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  if(p->nfree == nblocks(p->class)){
+ 9ad:	8b 58 08             	mov    0x8(%eax),%ebx
+  partial[p->class] = p;
+ 9b0:	89 04 b5 20 0f 00 00 	mov    %eax,0xf20(,%esi,4)
+}
+ 9b7:	eb 80                	jmp    939 <free+0x59>
+ 9b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ 9c0:	89 14 b5 20 0f 00 00 	mov    %edx,0xf20(,%esi,4)
+ 9c7:	eb 8b                	jmp    954 <free+0x74>
+ 9c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000009d0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 9d0:	55                   	push   %ebp
+ 9d1:	89 e5                	mov    %esp,%ebp
+ 9d3:	56                   	push   %esi
+ 9d4:	53                   	push   %ebx
+ 9d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct page *p;
+  uint n;
+
+  if(nbytes <= MAXSMALL)
+ 9d8:	3d 00 04 00 00       	cmp    $0x400,%eax
+ 9dd:	76 71                	jbe    a50 <malloc+0x80>
+    return smallalloc(sizeclass(nbytes));
+  if(nbytes > 0x7fffffff)
+ 9df:	85 c0                	test   %eax,%eax
+ 9e1:	0f 88 d9 00 00 00    	js     ac0 <malloc+0xf0>
+    return 0;
+  n = (nbytes + HDRSIZE + PGSIZE-1) / PGSIZE;
+ 9e7:	8d 90 1f 10 00 00    	lea    0x101f(%eax),%edx
+ 9ed:	89 d3                	mov    %edx,%ebx
+ 9ef:	c1 eb 0c             	shr    $0xc,%ebx
+  if(nbytes >= MAPMIN){
+ 9f2:	3d ff ff 00 00       	cmp    $0xffff,%eax
+ 9f7:	77 27                	ja     a20 <malloc+0x50>
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    if(p == MAP_FAILED)
+      return 0;
+    p->kind = PMAP;
+  } else {
+    if((p = runalloc(n)) == 0)
+ 9f9:	89 d8                	mov    %ebx,%eax
+ 9fb:	e8 c0 fd ff ff       	call   7c0 <runalloc>
+ a00:	85 c0                	test   %eax,%eax
+ a02:	0f 84 b8 00 00 00    	je     ac0 <malloc+0xf0>
+      return 0;
+    p->kind = PRUN;
+ a08:	ba 02 00 00 00       	mov    $0x2,%edx
+ a0d:	66 89 10             	mov    %dx,(%eax)
+  }
+  p->npages = n;
+ a10:	89 58 04             	mov    %ebx,0x4(%eax)
+  return (char*)p + HDRSIZE;
+ a13:	8d 58 20             	lea    0x20(%eax),%ebx
+}
+ a16:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a19:	89 d8                	mov    %ebx,%eax
+ a1b:	5b                   	pop    %ebx
+ a1c:	5e                   	pop    %esi
+ a1d:	5d                   	pop    %ebp
+ a1e:	c3                   	ret
+ a1f:	90                   	nop
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+ a20:	83 ec 08             	sub    $0x8,%esp
+ a23:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+ a29:	6a 00                	push   $0x0
+ a2b:	6a ff                	push   $0xffffffff
+ a2d:	6a 22                	push   $0x22
+ a2f:	6a 03                	push   $0x3
+ a31:	52                   	push   %edx
+ a32:	6a 00                	push   $0x0
+ a34:	e8 52 f9 ff ff       	call   38b <mmap>
+    if(p == MAP_FAILED)
+ a39:	83 c4 20             	add    $0x20,%esp
+ a3c:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a3f:	74 7f                	je     ac0 <malloc+0xf0>
+    p->kind = PMAP;
+ a41:	b9 04 00 00 00       	mov    $0x4,%ecx
+ a46:	66 89 08             	mov    %cx,(%eax)
+ a49:	eb c5                	jmp    a10 <malloc+0x40>
+ a4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a4f:	90                   	nop
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ a50:	83 f8 10             	cmp    $0x10,%eax
+ a53:	0f 86 07 01 00 00    	jbe    b60 <malloc+0x190>
+ a59:	31 db                	xor    %ebx,%ebx
+ a5b:	ba 10 00 00 00       	mov    $0x10,%edx
+ a60:	83 c3 01             	add    $0x1,%ebx
+ a63:	89 d6                	mov    %edx,%esi
+ a65:	89 d9                	mov    %ebx,%ecx
+ a67:	d3 e6                	shl    %cl,%esi
+ a69:	39 c6                	cmp    %eax,%esi
+ a6b:	72 f3                	jb     a60 <malloc+0x90>
+  if((p = partial[c]) == 0){
+ a6d:	8b 14 9d 20 0f 00 00 	mov    0xf20(,%ebx,4),%edx
+ a74:	85 d2                	test   %edx,%edx
+ a76:	74 58                	je     ad0 <malloc+0x100>
+  if((b = p->free) != 0){
+ a78:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ a7b:	8b 4a 08             	mov    0x8(%edx),%ecx
+  if((b = p->free) != 0){
+ a7e:	85 db                	test   %ebx,%ebx
+ a80:	0f 84 aa 00 00 00    	je     b30 <malloc+0x160>
+    p->free = b->next;
+ a86:	8b 03                	mov    (%ebx),%eax
+ a88:	89 42 0c             	mov    %eax,0xc(%edx)
+  if(--p->nfree == 0)
+ a8b:	83 e9 01             	sub    $0x1,%ecx
+ a8e:	89 4a 08             	mov    %ecx,0x8(%edx)
+ a91:	75 83                	jne    a16 <malloc+0x46>
+  if(p->prev)
+ a93:	8b 4a 18             	mov    0x18(%edx),%ecx
+    p->prev->next = p->next;
+ a96:	8b 42 14             	mov    0x14(%edx),%eax
+  if(p->prev)
+ a99:	85 c9                	test   %ecx,%ecx
+ a9b:	0f 84 cf 00 00 00    	je     b70 <malloc+0x1a0>
+    p->prev->next = p->next;
+ aa1:	89 41 14             	mov    %eax,0x14(%ecx)
+  if(p->next)
+ aa4:	85 c0                	test   %eax,%eax
+ aa6:	0f 84 6a ff ff ff    	je     a16 <malloc+0x46>
+    p->next->prev = p->prev;
+ aac:	8b 52 18             	mov    0x18(%edx),%edx
+ aaf:	89 50 18             	mov    %edx,0x18(%eax)
+ ab2:	e9 5f ff ff ff       	jmp    a16 <malloc+0x46>
+ ab7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ abe:	66 90                	xchg   %ax,%ax
+}
+ ac0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+ ac3:	31 db                	xor    %ebx,%ebx
+}
+ ac5:	89 d8                	mov    %ebx,%eax
+ ac7:	5b                   	pop    %ebx
+ ac8:	5e                   	pop    %esi
+ ac9:	5d                   	pop    %ebp
+ aca:	c3                   	ret
+ acb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ acf:	90                   	nop
+    if((p = runalloc(1)) == 0)
+ ad0:	b8 01 00 00 00       	mov    $0x1,%eax
+ ad5:	e8 e6 fc ff ff       	call   7c0 <runalloc>
+ ada:	89 c2                	mov    %eax,%edx
+ adc:	85 c0                	test   %eax,%eax
+ ade:	74 e0                	je     ac0 <malloc+0xf0>
+    p->kind = PSMALL;
+ ae0:	b8 01 00 00 00       	mov    $0x1,%eax
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ ae5:	8d 4b 04             	lea    0x4(%ebx),%ecx
+    p->class = c;
+ ae8:	66 89 5a 02          	mov    %bx,0x2(%edx)
+ aec:	0f b7 db             	movzwl %bx,%ebx
+    p->kind = PSMALL;
+ aef:	66 89 02             	mov    %ax,(%edx)
+    p->fresh = (char*)p + HDRSIZE;
+ af2:	8d 42 20             	lea    0x20(%edx),%eax
+ af5:	89 42 10             	mov    %eax,0x10(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ af8:	b8 e0 0f 00 00       	mov    $0xfe0,%eax
+ afd:	d3 f8                	sar    %cl,%eax
+    p->free = 0;
+ aff:	c7 42 0c 00 00 00 00 	movl   $0x0,0xc(%edx)
+    p->nfree = nblocks(c);
+ b06:	89 42 08             	mov    %eax,0x8(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ b09:	89 c1                	mov    %eax,%ecx
+  p->next = partial[p->class];
+ b0b:	8b 04 9d 20 0f 00 00 	mov    0xf20(,%ebx,4),%eax
+  p->prev = 0;
+ b12:	c7 42 18 00 00 00 00 	movl   $0x0,0x18(%edx)
+  p->next = partial[p->class];
+ b19:	89 42 14             	mov    %eax,0x14(%edx)
+  if(p->next)
+ b1c:	85 c0                	test   %eax,%eax
+ b1e:	75 20                	jne    b40 <malloc+0x170>
+  partial[p->class] = p;
+ b20:	89 14 9d 20 0f 00 00 	mov    %edx,0xf20(,%ebx,4)
+  if((b = p->free) != 0){
+ b27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b2e:	66 90                	xchg   %ax,%ax
+    b = (struct block*)p->fresh;
+ b30:	8b 5a 10             	mov    0x10(%edx),%ebx
+    p->fresh += MINSMALL << c;
+ b33:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+ b36:	89 42 10             	mov    %eax,0x10(%edx)
+ b39:	e9 4d ff ff ff       	jmp    a8b <malloc+0xbb>
+ b3e:	66 90                	xchg   %ax,%ax
+    p->next->prev = p;
+ b40:	89 50 18             	mov    %edx,0x18(%eax)
+  partial[p->class] = p;
+ b43:	0f b7 42 02          	movzwl 0x2(%edx),%eax
+  if((b = p->free) != 0){
+ b47:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ b4a:	8b 4a 08             	mov    0x8(%edx),%ecx
+  partial[p->class] = p;
+ b4d:	89 14 85 20 0f 00 00 	mov    %edx,0xf20(,%eax,4)
+}
+ b54:	e9 25 ff ff ff       	jmp    a7e <malloc+0xae>
+ b59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ b60:	be 10 00 00 00       	mov    $0x10,%esi
+ b65:	31 db                	xor    %ebx,%ebx
+ b67:	e9 01 ff ff ff       	jmp    a6d <malloc+0x9d>
+ b6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ b70:	0f b7 4a 02          	movzwl 0x2(%edx),%ecx
+ b74:	89 04 8d 20 0f 00 00 	mov    %eax,0xf20(,%ecx,4)
+ b7b:	e9 24 ff ff ff       	jmp    aa4 <malloc+0xd4>
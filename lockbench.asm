@@ -0,0 +1,2269 @@
+
+_lockbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return uptime() - start;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+  int n, i, start;
+
+  mutex_init(&mu);
+   e:	be 03 00 00 00       	mov    $0x3,%esi
+{
+  13:	53                   	push   %ebx
+  for(n = 1; n <= MAXTHREAD; n *= 2){
+  14:	bb 01 00 00 00       	mov    $0x1,%ebx
+{
+  19:	51                   	push   %ecx
+  1a:	83 ec 18             	sub    $0x18,%esp
+  mutex_init(&mu);
+  1d:	68 68 15 00 00       	push   $0x1568
+  22:	e8 b9 0d 00 00       	call   de0 <mutex_init>
+  27:	83 c4 10             	add    $0x10,%esp
+    usemutex = 1;
+  2a:	c7 05 5c 15 00 00 01 	movl   $0x1,0x155c
+  31:	00 00 00 
+    printf(1, "%d threads x %d: mutex %d ticks, ", n, NITER, run(n));
+  34:	83 ec 0c             	sub    $0xc,%esp
+  37:	53                   	push   %ebx
+  38:	e8 03 01 00 00       	call   140 <run>
+  3d:	89 04 24             	mov    %eax,(%esp)
+  40:	68 40 0d 03 00       	push   $0x30d40
+  45:	53                   	push   %ebx
+  46:	68 9c 0f 00 00       	push   $0xf9c
+  4b:	6a 01                	push   $0x1
+  4d:	e8 ce 05 00 00       	call   620 <printf>
+    usemutex = 0;
+    printf(1, "spin lock %d ticks\n", run(n));
+  52:	83 c4 14             	add    $0x14,%esp
+    usemutex = 0;
+  55:	c7 05 5c 15 00 00 00 	movl   $0x0,0x155c
+  5c:	00 00 00 
+    printf(1, "spin lock %d ticks\n", run(n));
+  5f:	53                   	push   %ebx
+  for(n = 1; n <= MAXTHREAD; n *= 2){
+  60:	01 db                	add    %ebx,%ebx
+    printf(1, "spin lock %d ticks\n", run(n));
+  62:	e8 d9 00 00 00       	call   140 <run>
+  67:	83 c4 0c             	add    $0xc,%esp
+  6a:	50                   	push   %eax
+  6b:	68 be 0f 00 00       	push   $0xfbe
+  70:	6a 01                	push   $0x1
+  72:	e8 a9 05 00 00       	call   620 <printf>
+  for(n = 1; n <= MAXTHREAD; n *= 2){
+  77:	83 c4 10             	add    $0x10,%esp
+  7a:	83 ee 01             	sub    $0x1,%esi
+  7d:	75 ab                	jne    2a <main+0x2a>
+  }
+
+  start = uptime();
+  7f:	e8 87 04 00 00       	call   50b <uptime>
+  84:	bb 40 0d 03 00       	mov    $0x30d40,%ebx
+  89:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < NITER; i++)
+  8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8f:	90                   	nop
+    getpid();
+  90:	e8 5e 04 00 00       	call   4f3 <getpid>
+  for(i = 0; i < NITER; i++)
+  95:	83 eb 01             	sub    $0x1,%ebx
+  98:	75 f6                	jne    90 <main+0x90>
+  printf(1, "%d getpid calls: %d ticks\n", NITER, uptime() - start);
+  9a:	e8 6c 04 00 00       	call   50b <uptime>
+  9f:	29 f0                	sub    %esi,%eax
+  a1:	50                   	push   %eax
+  a2:	68 40 0d 03 00       	push   $0x30d40
+  a7:	68 d2 0f 00 00       	push   $0xfd2
+  ac:	6a 01                	push   $0x1
+  ae:	e8 6d 05 00 00       	call   620 <printf>
+  exit();
+  b3:	e8 bb 03 00 00       	call   473 <exit>
+  b8:	66 90                	xchg   %ax,%ax
+  ba:	66 90                	xchg   %ax,%ax
+  bc:	66 90                	xchg   %ax,%ax
+  be:	66 90                	xchg   %ax,%ax
+
+000000c0 <worker>:
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	56                   	push   %esi
+  c4:	be 40 0d 03 00       	mov    $0x30d40,%esi
+  c9:	53                   	push   %ebx
+      while(__sync_lock_test_and_set(&spin, 1) != 0)
+  ca:	bb 01 00 00 00       	mov    $0x1,%ebx
+  cf:	eb 35                	jmp    106 <worker+0x46>
+  d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      mutex_lock(&mu);
+  d8:	83 ec 0c             	sub    $0xc,%esp
+  db:	68 68 15 00 00       	push   $0x1568
+  e0:	e8 0b 0d 00 00       	call   df0 <mutex_lock>
+      counter++;
+  e5:	a1 60 15 00 00       	mov    0x1560,%eax
+  ea:	83 c0 01             	add    $0x1,%eax
+  ed:	a3 60 15 00 00       	mov    %eax,0x1560
+      mutex_unlock(&mu);
+  f2:	c7 04 24 68 15 00 00 	movl   $0x1568,(%esp)
+  f9:	e8 82 0d 00 00       	call   e80 <mutex_unlock>
+  fe:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NITER; i++){
+ 101:	83 ee 01             	sub    $0x1,%esi
+ 104:	74 32                	je     138 <worker+0x78>
+    if(usemutex){
+ 106:	a1 5c 15 00 00       	mov    0x155c,%eax
+ 10b:	85 c0                	test   %eax,%eax
+ 10d:	75 c9                	jne    d8 <worker+0x18>
+ 10f:	90                   	nop
+      while(__sync_lock_test_and_set(&spin, 1) != 0)
+ 110:	89 d8                	mov    %ebx,%eax
+ 112:	87 05 64 15 00 00    	xchg   %eax,0x1564
+ 118:	85 c0                	test   %eax,%eax
+ 11a:	75 f4                	jne    110 <worker+0x50>
+      counter++;
+ 11c:	a1 60 15 00 00       	mov    0x1560,%eax
+ 121:	83 c0 01             	add    $0x1,%eax
+ 124:	a3 60 15 00 00       	mov    %eax,0x1560
+      __sync_lock_release(&spin);
+ 129:	c7 05 64 15 00 00 00 	movl   $0x0,0x1564
+ 130:	00 00 00 
+  for(i = 0; i < NITER; i++){
+ 133:	83 ee 01             	sub    $0x1,%esi
+ 136:	75 ce                	jne    106 <worker+0x46>
+}
+ 138:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 13b:	5b                   	pop    %ebx
+ 13c:	5e                   	pop    %esi
+ 13d:	5d                   	pop    %ebp
+ 13e:	c3                   	ret
+ 13f:	90                   	nop
+
+00000140 <run>:
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	57                   	push   %edi
+ 144:	56                   	push   %esi
+ 145:	53                   	push   %ebx
+ 146:	83 ec 2c             	sub    $0x2c,%esp
+ 149:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  counter = 0;
+ 14c:	c7 05 60 15 00 00 00 	movl   $0x0,0x1560
+ 153:	00 00 00 
+  start = uptime();
+ 156:	e8 b0 03 00 00       	call   50b <uptime>
+ 15b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  for(i = 0; i < nthread; i++){
+ 15e:	85 db                	test   %ebx,%ebx
+ 160:	7e 41                	jle    1a3 <run+0x63>
+ 162:	31 ff                	xor    %edi,%edi
+ 164:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((tid[i] = thread_create(worker, 0)) < 0){
+ 168:	83 ec 08             	sub    $0x8,%esp
+ 16b:	6a 00                	push   $0x0
+ 16d:	68 c0 00 00 00       	push   $0xc0
+ 172:	e8 b9 0b 00 00       	call   d30 <thread_create>
+ 177:	83 c4 10             	add    $0x10,%esp
+ 17a:	89 44 bd d8          	mov    %eax,-0x28(%ebp,%edi,4)
+ 17e:	85 c0                	test   %eax,%eax
+ 180:	78 5a                	js     1dc <run+0x9c>
+  for(i = 0; i < nthread; i++){
+ 182:	83 c7 01             	add    $0x1,%edi
+ 185:	39 fb                	cmp    %edi,%ebx
+ 187:	75 df                	jne    168 <run+0x28>
+ 189:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 18c:	8d 3c 9e             	lea    (%esi,%ebx,4),%edi
+    thread_join(tid[i]);
+ 18f:	83 ec 0c             	sub    $0xc,%esp
+ 192:	ff 36                	push   (%esi)
+  for(i = 0; i < nthread; i++)
+ 194:	83 c6 04             	add    $0x4,%esi
+    thread_join(tid[i]);
+ 197:	e8 04 0c 00 00       	call   da0 <thread_join>
+  for(i = 0; i < nthread; i++)
+ 19c:	83 c4 10             	add    $0x10,%esp
+ 19f:	39 fe                	cmp    %edi,%esi
+ 1a1:	75 ec                	jne    18f <run+0x4f>
+  if(counter != nthread * NITER)
+ 1a3:	69 db 40 0d 03 00    	imul   $0x30d40,%ebx,%ebx
+ 1a9:	a1 60 15 00 00       	mov    0x1560,%eax
+ 1ae:	39 c3                	cmp    %eax,%ebx
+ 1b0:	74 18                	je     1ca <run+0x8a>
+    printf(1, "lockbench: lost updates, counter %d\n", counter);
+ 1b2:	a1 60 15 00 00       	mov    0x1560,%eax
+ 1b7:	83 ec 04             	sub    $0x4,%esp
+ 1ba:	50                   	push   %eax
+ 1bb:	68 74 0f 00 00       	push   $0xf74
+ 1c0:	6a 01                	push   $0x1
+ 1c2:	e8 59 04 00 00       	call   620 <printf>
+ 1c7:	83 c4 10             	add    $0x10,%esp
+  return uptime() - start;
+ 1ca:	e8 3c 03 00 00       	call   50b <uptime>
+ 1cf:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+}
+ 1d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1d5:	5b                   	pop    %ebx
+ 1d6:	5e                   	pop    %esi
+  return uptime() - start;
+ 1d7:	29 d0                	sub    %edx,%eax
+}
+ 1d9:	5f                   	pop    %edi
+ 1da:	5d                   	pop    %ebp
+ 1db:	c3                   	ret
+      printf(1, "lockbench: thread_create failed\n");
+ 1dc:	83 ec 08             	sub    $0x8,%esp
+ 1df:	68 50 0f 00 00       	push   $0xf50
+ 1e4:	6a 01                	push   $0x1
+ 1e6:	e8 35 04 00 00       	call   620 <printf>
+      exit();
+ 1eb:	e8 83 02 00 00       	call   473 <exit>
+
+000001f0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1f1:	31 c0                	xor    %eax,%eax
+{
+ 1f3:	89 e5                	mov    %esp,%ebp
+ 1f5:	53                   	push   %ebx
+ 1f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 200:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 204:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 207:	83 c0 01             	add    $0x1,%eax
+ 20a:	84 d2                	test   %dl,%dl
+ 20c:	75 f2                	jne    200 <strcpy+0x10>
+    ;
+  return os;
+}
+ 20e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 211:	89 c8                	mov    %ecx,%eax
+ 213:	c9                   	leave
+ 214:	c3                   	ret
+ 215:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000220 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	53                   	push   %ebx
+ 224:	8b 55 08             	mov    0x8(%ebp),%edx
+ 227:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 22a:	0f b6 02             	movzbl (%edx),%eax
+ 22d:	84 c0                	test   %al,%al
+ 22f:	75 17                	jne    248 <strcmp+0x28>
+ 231:	eb 3a                	jmp    26d <strcmp+0x4d>
+ 233:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 237:	90                   	nop
+ 238:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 23c:	83 c2 01             	add    $0x1,%edx
+ 23f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 242:	84 c0                	test   %al,%al
+ 244:	74 1a                	je     260 <strcmp+0x40>
+    p++, q++;
+ 246:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 248:	0f b6 19             	movzbl (%ecx),%ebx
+ 24b:	38 c3                	cmp    %al,%bl
+ 24d:	74 e9                	je     238 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 24f:	29 d8                	sub    %ebx,%eax
+}
+ 251:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 254:	c9                   	leave
+ 255:	c3                   	ret
+ 256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 260:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 264:	31 c0                	xor    %eax,%eax
+ 266:	29 d8                	sub    %ebx,%eax
+}
+ 268:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 26b:	c9                   	leave
+ 26c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 26d:	0f b6 19             	movzbl (%ecx),%ebx
+ 270:	31 c0                	xor    %eax,%eax
+ 272:	eb db                	jmp    24f <strcmp+0x2f>
+ 274:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 27f:	90                   	nop
+
+00000280 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 286:	80 3a 00             	cmpb   $0x0,(%edx)
+ 289:	74 15                	je     2a0 <strlen+0x20>
+ 28b:	31 c0                	xor    %eax,%eax
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+ 290:	83 c0 01             	add    $0x1,%eax
+ 293:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 297:	89 c1                	mov    %eax,%ecx
+ 299:	75 f5                	jne    290 <strlen+0x10>
+    ;
+  return n;
+}
+ 29b:	89 c8                	mov    %ecx,%eax
+ 29d:	5d                   	pop    %ebp
+ 29e:	c3                   	ret
+ 29f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 2a0:	31 c9                	xor    %ecx,%ecx
+}
+ 2a2:	5d                   	pop    %ebp
+ 2a3:	89 c8                	mov    %ecx,%eax
+ 2a5:	c3                   	ret
+ 2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	57                   	push   %edi
+ 2b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2bd:	89 d7                	mov    %edx,%edi
+ 2bf:	fc                   	cld
+ 2c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2c5:	89 d0                	mov    %edx,%eax
+ 2c7:	c9                   	leave
+ 2c8:	c3                   	ret
+ 2c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2da:	0f b6 10             	movzbl (%eax),%edx
+ 2dd:	84 d2                	test   %dl,%dl
+ 2df:	75 12                	jne    2f3 <strchr+0x23>
+ 2e1:	eb 1d                	jmp    300 <strchr+0x30>
+ 2e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2e7:	90                   	nop
+ 2e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2ec:	83 c0 01             	add    $0x1,%eax
+ 2ef:	84 d2                	test   %dl,%dl
+ 2f1:	74 0d                	je     300 <strchr+0x30>
+    if(*s == c)
+ 2f3:	38 d1                	cmp    %dl,%cl
+ 2f5:	75 f1                	jne    2e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2f7:	5d                   	pop    %ebp
+ 2f8:	c3                   	ret
+ 2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 300:	31 c0                	xor    %eax,%eax
+}
+ 302:	5d                   	pop    %ebp
+ 303:	c3                   	ret
+ 304:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 30f:	90                   	nop
+
+00000310 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	57                   	push   %edi
+ 314:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 315:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 318:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 319:	31 db                	xor    %ebx,%ebx
+{
+ 31b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 31e:	eb 27                	jmp    347 <gets+0x37>
+    cc = read(0, &c, 1);
+ 320:	83 ec 04             	sub    $0x4,%esp
+ 323:	6a 01                	push   $0x1
+ 325:	56                   	push   %esi
+ 326:	6a 00                	push   $0x0
+ 328:	e8 5e 01 00 00       	call   48b <read>
+    if(cc < 1)
+ 32d:	83 c4 10             	add    $0x10,%esp
+ 330:	85 c0                	test   %eax,%eax
+ 332:	7e 1d                	jle    351 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 334:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 338:	8b 55 08             	mov    0x8(%ebp),%edx
+ 33b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 33f:	3c 0a                	cmp    $0xa,%al
+ 341:	74 10                	je     353 <gets+0x43>
+ 343:	3c 0d                	cmp    $0xd,%al
+ 345:	74 0c                	je     353 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 347:	89 df                	mov    %ebx,%edi
+ 349:	83 c3 01             	add    $0x1,%ebx
+ 34c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 34f:	7c cf                	jl     320 <gets+0x10>
+ 351:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 353:	8b 45 08             	mov    0x8(%ebp),%eax
+ 356:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 35a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 35d:	5b                   	pop    %ebx
+ 35e:	5e                   	pop    %esi
+ 35f:	5f                   	pop    %edi
+ 360:	5d                   	pop    %ebp
+ 361:	c3                   	ret
+ 362:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 369:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	56                   	push   %esi
+ 374:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 375:	83 ec 08             	sub    $0x8,%esp
+ 378:	6a 00                	push   $0x0
+ 37a:	ff 75 08             	push   0x8(%ebp)
+ 37d:	e8 31 01 00 00       	call   4b3 <open>
+  if(fd < 0)
+ 382:	83 c4 10             	add    $0x10,%esp
+ 385:	85 c0                	test   %eax,%eax
+ 387:	78 27                	js     3b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 389:	83 ec 08             	sub    $0x8,%esp
+ 38c:	ff 75 0c             	push   0xc(%ebp)
+ 38f:	89 c3                	mov    %eax,%ebx
+ 391:	50                   	push   %eax
+ 392:	e8 34 01 00 00       	call   4cb <fstat>
+  close(fd);
+ 397:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 39a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 39c:	e8 fa 00 00 00       	call   49b <close>
+  return r;
+ 3a1:	83 c4 10             	add    $0x10,%esp
+}
+ 3a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3a7:	89 f0                	mov    %esi,%eax
+ 3a9:	5b                   	pop    %ebx
+ 3aa:	5e                   	pop    %esi
+ 3ab:	5d                   	pop    %ebp
+ 3ac:	c3                   	ret
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3b5:	eb ed                	jmp    3a4 <stat+0x34>
+ 3b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3be:	66 90                	xchg   %ax,%ax
+
+000003c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	53                   	push   %ebx
+ 3c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3c7:	0f be 02             	movsbl (%edx),%eax
+ 3ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3d5:	77 1e                	ja     3f5 <atoi+0x35>
+ 3d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3e0:	83 c2 01             	add    $0x1,%edx
+ 3e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3ea:	0f be 02             	movsbl (%edx),%eax
+ 3ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3f0:	80 fb 09             	cmp    $0x9,%bl
+ 3f3:	76 eb                	jbe    3e0 <atoi+0x20>
+  return n;
+}
+ 3f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3f8:	89 c8                	mov    %ecx,%eax
+ 3fa:	c9                   	leave
+ 3fb:	c3                   	ret
+ 3fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000400 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	56                   	push   %esi
+ 405:	8b 45 10             	mov    0x10(%ebp),%eax
+ 408:	8b 55 08             	mov    0x8(%ebp),%edx
+ 40b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 40e:	85 c0                	test   %eax,%eax
+ 410:	7e 13                	jle    425 <memmove+0x25>
+ 412:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 414:	89 d7                	mov    %edx,%edi
+ 416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 420:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 421:	39 f8                	cmp    %edi,%eax
+ 423:	75 fb                	jne    420 <memmove+0x20>
+  return vdst;
+}
+ 425:	5e                   	pop    %esi
+ 426:	89 d0                	mov    %edx,%eax
+ 428:	5f                   	pop    %edi
+ 429:	5d                   	pop    %ebp
+ 42a:	c3                   	ret
+
+0000042b <ccreate>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(ccreate)
+ 42b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <cfork>:
+SYSCALL(cfork)
+ 433:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <cgetrootdir>:
+SYSCALL(cgetrootdir)
+ 43b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <getcontrootdir>:
+SYSCALL(getcontrootdir)
+ 443:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <cpause>:
+SYSCALL(cpause)
+ 44b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <cresume>:
+SYSCALL(cresume)
+ 453:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <cstart>:
+SYSCALL(cstart)
+ 45b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <cstop>:
+SYSCALL(cstop)
+ 463:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <fork>:
+SYSCALL(fork)
+ 46b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <exit>:
+SYSCALL(exit)
+ 473:	b8 02 00 00 00       	mov    $0x2,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <wait>:
+SYSCALL(wait)
+ 47b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <pipe>:
+SYSCALL(pipe)
+ 483:	b8 04 00 00 00       	mov    $0x4,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <read>:
+SYSCALL(read)
+ 48b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <write>:
+SYSCALL(write)
+ 493:	b8 10 00 00 00       	mov    $0x10,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <close>:
+SYSCALL(close)
+ 49b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <kill>:
+SYSCALL(kill)
+ 4a3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <exec>:
+SYSCALL(exec)
+ 4ab:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <open>:
+SYSCALL(open)
+ 4b3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <mknod>:
+SYSCALL(mknod)
+ 4bb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <unlink>:
+SYSCALL(unlink)
+ 4c3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <fstat>:
+SYSCALL(fstat)
+ 4cb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <link>:
+SYSCALL(link)
+ 4d3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <mkdir>:
+SYSCALL(mkdir)
+ 4db:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <chdir>:
+SYSCALL(chdir)
+ 4e3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <dup>:
+SYSCALL(dup)
+ 4eb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <getpid>:
+SYSCALL(getpid)
+ 4f3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <sbrk>:
+SYSCALL(sbrk)
+ 4fb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <sleep>:
+SYSCALL(sleep)
+ 503:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <uptime>:
+SYSCALL(uptime)
+ 50b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <cps>:
+SYSCALL(cps)
+ 513:	b8 16 00 00 00       	mov    $0x16,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <mmap>:
+SYSCALL(mmap)
+ 51b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <munmap>:
+SYSCALL(munmap)
+ 523:	b8 20 00 00 00       	mov    $0x20,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <shmget>:
+SYSCALL(shmget)
+ 52b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <climit>:
+SYSCALL(climit)
+ 533:	b8 22 00 00 00       	mov    $0x22,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <spawn>:
+SYSCALL(spawn)
+ 53b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <clone>:
+SYSCALL(clone)
+ 543:	b8 24 00 00 00       	mov    $0x24,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <join>:
+SYSCALL(join)
+ 54b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <futex>:
+SYSCALL(futex)
+ 553:	b8 26 00 00 00       	mov    $0x26,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <ccheckpoint>:
+SYSCALL(ccheckpoint)
+ 55b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <crestore>:
+SYSCALL(crestore)
+ 563:	b8 28 00 00 00       	mov    $0x28,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <czygote>:
+SYSCALL(czygote)
+ 56b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <memstats>:
+SYSCALL(memstats)
+ 573:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+ 57b:	66 90                	xchg   %ax,%ax
+ 57d:	66 90                	xchg   %ax,%ax
+ 57f:	90                   	nop
+
+00000580 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	57                   	push   %edi
+ 584:	56                   	push   %esi
+ 585:	53                   	push   %ebx
+ 586:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 588:	89 d1                	mov    %edx,%ecx
+{
+ 58a:	83 ec 3c             	sub    $0x3c,%esp
+ 58d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 590:	85 d2                	test   %edx,%edx
+ 592:	0f 89 80 00 00 00    	jns    618 <printint+0x98>
+ 598:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 59c:	74 7a                	je     618 <printint+0x98>
+    x = -xx;
+ 59e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5a8:	31 f6                	xor    %esi,%esi
+ 5aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 5b0:	89 c8                	mov    %ecx,%eax
+ 5b2:	31 d2                	xor    %edx,%edx
+ 5b4:	89 f7                	mov    %esi,%edi
+ 5b6:	f7 f3                	div    %ebx
+ 5b8:	8d 76 01             	lea    0x1(%esi),%esi
+ 5bb:	0f b6 92 4c 10 00 00 	movzbl 0x104c(%edx),%edx
+ 5c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 5c6:	89 ca                	mov    %ecx,%edx
+ 5c8:	89 c1                	mov    %eax,%ecx
+ 5ca:	39 da                	cmp    %ebx,%edx
+ 5cc:	73 e2                	jae    5b0 <printint+0x30>
+  if(neg)
+ 5ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 5d1:	85 c0                	test   %eax,%eax
+ 5d3:	74 07                	je     5dc <printint+0x5c>
+    buf[i++] = '-';
+ 5d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5da:	89 f7                	mov    %esi,%edi
+ 5dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 5e2:	01 df                	add    %ebx,%edi
+ 5e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 5eb:	83 ec 04             	sub    $0x4,%esp
+ 5ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5f4:	6a 01                	push   $0x1
+ 5f6:	50                   	push   %eax
+ 5f7:	56                   	push   %esi
+ 5f8:	e8 96 fe ff ff       	call   493 <write>
+  while(--i >= 0)
+ 5fd:	89 f8                	mov    %edi,%eax
+ 5ff:	83 c4 10             	add    $0x10,%esp
+ 602:	83 ef 01             	sub    $0x1,%edi
+ 605:	39 d8                	cmp    %ebx,%eax
+ 607:	75 df                	jne    5e8 <printint+0x68>
+}
+ 609:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 60c:	5b                   	pop    %ebx
+ 60d:	5e                   	pop    %esi
+ 60e:	5f                   	pop    %edi
+ 60f:	5d                   	pop    %ebp
+ 610:	c3                   	ret
+ 611:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 618:	31 c0                	xor    %eax,%eax
+ 61a:	eb 89                	jmp    5a5 <printint+0x25>
+ 61c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000620 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	57                   	push   %edi
+ 624:	56                   	push   %esi
+ 625:	53                   	push   %ebx
+ 626:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 629:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 62c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 62f:	0f b6 1e             	movzbl (%esi),%ebx
+ 632:	83 c6 01             	add    $0x1,%esi
+ 635:	84 db                	test   %bl,%bl
+ 637:	74 67                	je     6a0 <printf+0x80>
+ 639:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 63c:	31 d2                	xor    %edx,%edx
+ 63e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 641:	eb 34                	jmp    677 <printf+0x57>
+ 643:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 647:	90                   	nop
+ 648:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 64b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 650:	83 f8 25             	cmp    $0x25,%eax
+ 653:	74 18                	je     66d <printf+0x4d>
+  write(fd, &c, 1);
+ 655:	83 ec 04             	sub    $0x4,%esp
+ 658:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 65b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 65e:	6a 01                	push   $0x1
+ 660:	50                   	push   %eax
+ 661:	57                   	push   %edi
+ 662:	e8 2c fe ff ff       	call   493 <write>
+ 667:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 66a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 66d:	0f b6 1e             	movzbl (%esi),%ebx
+ 670:	83 c6 01             	add    $0x1,%esi
+ 673:	84 db                	test   %bl,%bl
+ 675:	74 29                	je     6a0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 677:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 67a:	85 d2                	test   %edx,%edx
+ 67c:	74 ca                	je     648 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 67e:	83 fa 25             	cmp    $0x25,%edx
+ 681:	75 ea                	jne    66d <printf+0x4d>
+      if(c == 'd'){
+ 683:	83 f8 25             	cmp    $0x25,%eax
+ 686:	0f 84 24 01 00 00    	je     7b0 <printf+0x190>
+ 68c:	83 e8 63             	sub    $0x63,%eax
+ 68f:	83 f8 15             	cmp    $0x15,%eax
+ 692:	77 1c                	ja     6b0 <printf+0x90>
+ 694:	ff 24 85 f4 0f 00 00 	jmp    *0xff4(,%eax,4)
+ 69b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 69f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6a3:	5b                   	pop    %ebx
+ 6a4:	5e                   	pop    %esi
+ 6a5:	5f                   	pop    %edi
+ 6a6:	5d                   	pop    %ebp
+ 6a7:	c3                   	ret
+ 6a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6af:	90                   	nop
+  write(fd, &c, 1);
+ 6b0:	83 ec 04             	sub    $0x4,%esp
+ 6b3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6b6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 6ba:	6a 01                	push   $0x1
+ 6bc:	52                   	push   %edx
+ 6bd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 6c0:	57                   	push   %edi
+ 6c1:	e8 cd fd ff ff       	call   493 <write>
+ 6c6:	83 c4 0c             	add    $0xc,%esp
+ 6c9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6cc:	6a 01                	push   $0x1
+ 6ce:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6d1:	52                   	push   %edx
+ 6d2:	57                   	push   %edi
+ 6d3:	e8 bb fd ff ff       	call   493 <write>
+        putc(fd, c);
+ 6d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6db:	31 d2                	xor    %edx,%edx
+ 6dd:	eb 8e                	jmp    66d <printf+0x4d>
+ 6df:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 6e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6e3:	83 ec 0c             	sub    $0xc,%esp
+ 6e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6eb:	8b 13                	mov    (%ebx),%edx
+ 6ed:	6a 00                	push   $0x0
+ 6ef:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6f1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6f4:	e8 87 fe ff ff       	call   580 <printint>
+        ap++;
+ 6f9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6ff:	31 d2                	xor    %edx,%edx
+ 701:	e9 67 ff ff ff       	jmp    66d <printf+0x4d>
+ 706:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 70d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 710:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 713:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 715:	83 c0 04             	add    $0x4,%eax
+ 718:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 71b:	85 db                	test   %ebx,%ebx
+ 71d:	0f 84 9d 00 00 00    	je     7c0 <printf+0x1a0>
+        while(*s != 0){
+ 723:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 726:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 728:	84 c0                	test   %al,%al
+ 72a:	0f 84 3d ff ff ff    	je     66d <printf+0x4d>
+ 730:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 733:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 736:	89 de                	mov    %ebx,%esi
+ 738:	89 d3                	mov    %edx,%ebx
+ 73a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 740:	83 ec 04             	sub    $0x4,%esp
+ 743:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 746:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 749:	6a 01                	push   $0x1
+ 74b:	53                   	push   %ebx
+ 74c:	57                   	push   %edi
+ 74d:	e8 41 fd ff ff       	call   493 <write>
+        while(*s != 0){
+ 752:	0f b6 06             	movzbl (%esi),%eax
+ 755:	83 c4 10             	add    $0x10,%esp
+ 758:	84 c0                	test   %al,%al
+ 75a:	75 e4                	jne    740 <printf+0x120>
+      state = 0;
+ 75c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 75f:	31 d2                	xor    %edx,%edx
+ 761:	e9 07 ff ff ff       	jmp    66d <printf+0x4d>
+ 766:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 770:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 773:	83 ec 0c             	sub    $0xc,%esp
+ 776:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 77b:	8b 13                	mov    (%ebx),%edx
+ 77d:	6a 01                	push   $0x1
+ 77f:	e9 6b ff ff ff       	jmp    6ef <printf+0xcf>
+ 784:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 788:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 78b:	83 ec 04             	sub    $0x4,%esp
+ 78e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 791:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 793:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 796:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 799:	6a 01                	push   $0x1
+ 79b:	52                   	push   %edx
+ 79c:	57                   	push   %edi
+ 79d:	e8 f1 fc ff ff       	call   493 <write>
+        ap++;
+ 7a2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7a5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7a8:	31 d2                	xor    %edx,%edx
+ 7aa:	e9 be fe ff ff       	jmp    66d <printf+0x4d>
+ 7af:	90                   	nop
+  write(fd, &c, 1);
+ 7b0:	83 ec 04             	sub    $0x4,%esp
+ 7b3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7b6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7b9:	6a 01                	push   $0x1
+ 7bb:	e9 11 ff ff ff       	jmp    6d1 <printf+0xb1>
+ 7c0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 7c5:	bb ed 0f 00 00       	mov    $0xfed,%ebx
+ 7ca:	e9 61 ff ff ff       	jmp    730 <printf+0x110>
+ 7cf:	90                   	nop
+
+000007d0 <runfree>:
+
+// Give the n pages at r back to the free runs, merging them with
+// adjacent runs, and shrink the heap if the end of it is free.
+static void
+runfree(struct page *r, uint n)
+{
+ 7d0:	55                   	push   %ebp
+  struct page **pp, *prev;
+
+  r->kind = PFREE;
+ 7d1:	b9 03 00 00 00       	mov    $0x3,%ecx
+{
+ 7d6:	89 e5                	mov    %esp,%ebp
+ 7d8:	57                   	push   %edi
+ 7d9:	56                   	push   %esi
+ 7da:	53                   	push   %ebx
+ 7db:	89 c3                	mov    %eax,%ebx
+ 7dd:	83 ec 0c             	sub    $0xc,%esp
+  r->kind = PFREE;
+ 7e0:	66 89 08             	mov    %cx,(%eax)
+  r->npages = n;
+  prev = 0;
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 7e3:	8b 0d 70 15 00 00    	mov    0x1570,%ecx
+  r->npages = n;
+ 7e9:	89 50 04             	mov    %edx,0x4(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 7ec:	85 c9                	test   %ecx,%ecx
+ 7ee:	0f 84 1f 01 00 00    	je     913 <runfree+0x143>
+ 7f4:	39 c1                	cmp    %eax,%ecx
+ 7f6:	0f 83 f7 00 00 00    	jae    8f3 <runfree+0x123>
+ 7fc:	89 c8                	mov    %ecx,%eax
+ 7fe:	eb 04                	jmp    804 <runfree+0x34>
+ 800:	39 d8                	cmp    %ebx,%eax
+ 802:	73 09                	jae    80d <runfree+0x3d>
+ 804:	89 c2                	mov    %eax,%edx
+ 806:	8b 40 14             	mov    0x14(%eax),%eax
+ 809:	85 c0                	test   %eax,%eax
+ 80b:	75 f3                	jne    800 <runfree+0x30>
+    prev = *pp;
+  r->next = *pp;
+ 80d:	89 43 14             	mov    %eax,0x14(%ebx)
+  *pp = r;
+ 810:	89 5a 14             	mov    %ebx,0x14(%edx)
+
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 813:	8b 43 14             	mov    0x14(%ebx),%eax
+ 816:	85 c0                	test   %eax,%eax
+ 818:	74 12                	je     82c <runfree+0x5c>
+ 81a:	8b 7b 04             	mov    0x4(%ebx),%edi
+ 81d:	89 fe                	mov    %edi,%esi
+ 81f:	c1 e6 0c             	shl    $0xc,%esi
+ 822:	01 de                	add    %ebx,%esi
+ 824:	39 f0                	cmp    %esi,%eax
+ 826:	0f 84 a4 00 00 00    	je     8d0 <runfree+0x100>
+    r->npages += r->next->npages;
+    r->next = r->next->next;
+  }
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 82c:	8b 72 04             	mov    0x4(%edx),%esi
+ 82f:	89 f0                	mov    %esi,%eax
+ 831:	c1 e0 0c             	shl    $0xc,%eax
+ 834:	01 d0                	add    %edx,%eax
+ 836:	39 c3                	cmp    %eax,%ebx
+ 838:	74 16                	je     850 <runfree+0x80>
+    pp = &runs;
+    while(*pp != r)
+      pp = &(*pp)->next;
+  }
+
+  if(r->next == 0 && r->npages >= TRIM &&
+ 83a:	8b 43 14             	mov    0x14(%ebx),%eax
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 83d:	8d 72 14             	lea    0x14(%edx),%esi
+  if(r->next == 0 && r->npages >= TRIM &&
+ 840:	85 c0                	test   %eax,%eax
+ 842:	74 3c                	je     880 <runfree+0xb0>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+    *pp = 0;
+    sbrk(-(int)(r->npages*PGSIZE));
+    heapend = (char*)r;
+  }
+}
+ 844:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 847:	5b                   	pop    %ebx
+ 848:	5e                   	pop    %esi
+ 849:	5f                   	pop    %edi
+ 84a:	5d                   	pop    %ebp
+ 84b:	c3                   	ret
+ 84c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    prev->npages += r->npages;
+ 850:	03 73 04             	add    0x4(%ebx),%esi
+ 853:	89 72 04             	mov    %esi,0x4(%edx)
+    prev->next = r->next;
+ 856:	8b 43 14             	mov    0x14(%ebx),%eax
+ 859:	89 42 14             	mov    %eax,0x14(%edx)
+    while(*pp != r)
+ 85c:	39 d1                	cmp    %edx,%ecx
+ 85e:	0f 84 c5 00 00 00    	je     929 <runfree+0x159>
+ 864:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      pp = &(*pp)->next;
+ 868:	89 cb                	mov    %ecx,%ebx
+ 86a:	8b 49 14             	mov    0x14(%ecx),%ecx
+    while(*pp != r)
+ 86d:	39 d1                	cmp    %edx,%ecx
+ 86f:	75 f7                	jne    868 <runfree+0x98>
+      pp = &(*pp)->next;
+ 871:	8d 73 14             	lea    0x14(%ebx),%esi
+ 874:	89 cb                	mov    %ecx,%ebx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 876:	85 c0                	test   %eax,%eax
+ 878:	75 ca                	jne    844 <runfree+0x74>
+ 87a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 880:	8b 53 04             	mov    0x4(%ebx),%edx
+ 883:	83 fa 1f             	cmp    $0x1f,%edx
+ 886:	76 bc                	jbe    844 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 888:	c1 e2 0c             	shl    $0xc,%edx
+ 88b:	01 da                	add    %ebx,%edx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 88d:	39 15 6c 15 00 00    	cmp    %edx,0x156c
+ 893:	75 af                	jne    844 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 895:	83 ec 0c             	sub    $0xc,%esp
+ 898:	6a 00                	push   $0x0
+ 89a:	e8 5c fc ff ff       	call   4fb <sbrk>
+ 89f:	83 c4 10             	add    $0x10,%esp
+ 8a2:	39 05 6c 15 00 00    	cmp    %eax,0x156c
+ 8a8:	75 9a                	jne    844 <runfree+0x74>
+    *pp = 0;
+ 8aa:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    sbrk(-(int)(r->npages*PGSIZE));
+ 8b0:	8b 43 04             	mov    0x4(%ebx),%eax
+ 8b3:	83 ec 0c             	sub    $0xc,%esp
+ 8b6:	c1 e0 0c             	shl    $0xc,%eax
+ 8b9:	f7 d8                	neg    %eax
+ 8bb:	50                   	push   %eax
+ 8bc:	e8 3a fc ff ff       	call   4fb <sbrk>
+    heapend = (char*)r;
+ 8c1:	89 1d 6c 15 00 00    	mov    %ebx,0x156c
+ 8c7:	83 c4 10             	add    $0x10,%esp
+}
+ 8ca:	e9 75 ff ff ff       	jmp    844 <runfree+0x74>
+ 8cf:	90                   	nop
+    r->npages += r->next->npages;
+ 8d0:	03 78 04             	add    0x4(%eax),%edi
+ 8d3:	89 7b 04             	mov    %edi,0x4(%ebx)
+    r->next = r->next->next;
+ 8d6:	8b 40 14             	mov    0x14(%eax),%eax
+ 8d9:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 8dc:	8b 72 04             	mov    0x4(%edx),%esi
+ 8df:	89 f0                	mov    %esi,%eax
+ 8e1:	c1 e0 0c             	shl    $0xc,%eax
+ 8e4:	01 d0                	add    %edx,%eax
+ 8e6:	39 c3                	cmp    %eax,%ebx
+ 8e8:	0f 85 4c ff ff ff    	jne    83a <runfree+0x6a>
+ 8ee:	e9 5d ff ff ff       	jmp    850 <runfree+0x80>
+  r->next = *pp;
+ 8f3:	89 48 14             	mov    %ecx,0x14(%eax)
+  *pp = r;
+ 8f6:	a3 70 15 00 00       	mov    %eax,0x1570
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 8fb:	89 d0                	mov    %edx,%eax
+ 8fd:	c1 e0 0c             	shl    $0xc,%eax
+ 900:	01 d8                	add    %ebx,%eax
+ 902:	39 c1                	cmp    %eax,%ecx
+ 904:	74 2f                	je     935 <runfree+0x165>
+  if(r->next == 0 && r->npages >= TRIM &&
+ 906:	8b 43 14             	mov    0x14(%ebx),%eax
+ 909:	be 70 15 00 00       	mov    $0x1570,%esi
+ 90e:	e9 2d ff ff ff       	jmp    840 <runfree+0x70>
+  r->next = *pp;
+ 913:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 91a:	be 70 15 00 00       	mov    $0x1570,%esi
+  *pp = r;
+ 91f:	a3 70 15 00 00       	mov    %eax,0x1570
+  if(r->next == 0 && r->npages >= TRIM &&
+ 924:	e9 5a ff ff ff       	jmp    883 <runfree+0xb3>
+    while(*pp != r)
+ 929:	89 cb                	mov    %ecx,%ebx
+    pp = &runs;
+ 92b:	be 70 15 00 00       	mov    $0x1570,%esi
+ 930:	e9 0b ff ff ff       	jmp    840 <runfree+0x70>
+    r->npages += r->next->npages;
+ 935:	03 51 04             	add    0x4(%ecx),%edx
+ 938:	89 53 04             	mov    %edx,0x4(%ebx)
+    r->next = r->next->next;
+ 93b:	8b 41 14             	mov    0x14(%ecx),%eax
+ 93e:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 941:	eb c3                	jmp    906 <runfree+0x136>
+ 943:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 94a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000950 <runalloc>:
+
+// Take a run of n pages from the start of the first free run
+// long enough, which keeps the end of the heap free to trim.
+static struct page*
+runalloc(uint n)
+{
+ 950:	55                   	push   %ebp
+ 951:	89 e5                	mov    %esp,%ebp
+ 953:	57                   	push   %edi
+ 954:	56                   	push   %esi
+ 955:	89 c6                	mov    %eax,%esi
+ 957:	53                   	push   %ebx
+ 958:	83 ec 1c             	sub    $0x1c,%esp
+  struct page **pp, *r, *rest;
+
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ 95b:	8b 1d 70 15 00 00    	mov    0x1570,%ebx
+ 961:	85 db                	test   %ebx,%ebx
+ 963:	74 4d                	je     9b2 <runalloc+0x62>
+ 965:	b9 70 15 00 00       	mov    $0x1570,%ecx
+    if(r->npages < n)
+ 96a:	39 73 04             	cmp    %esi,0x4(%ebx)
+ 96d:	72 39                	jb     9a8 <runalloc+0x58>
+      continue;
+    if(r->npages == n){
+ 96f:	0f 84 9b 00 00 00    	je     a10 <runalloc+0xc0>
+      *pp = r->next;
+    } else {
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ 975:	89 f0                	mov    %esi,%eax
+      rest->kind = PFREE;
+ 977:	ba 03 00 00 00       	mov    $0x3,%edx
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ 97c:	c1 e0 0c             	shl    $0xc,%eax
+ 97f:	01 d8                	add    %ebx,%eax
+      rest->kind = PFREE;
+ 981:	66 89 10             	mov    %dx,(%eax)
+      rest->npages = r->npages - n;
+ 984:	8b 53 04             	mov    0x4(%ebx),%edx
+ 987:	29 f2                	sub    %esi,%edx
+ 989:	89 50 04             	mov    %edx,0x4(%eax)
+      rest->next = r->next;
+ 98c:	8b 53 14             	mov    0x14(%ebx),%edx
+ 98f:	89 50 14             	mov    %edx,0x14(%eax)
+      *pp = rest;
+ 992:	89 01                	mov    %eax,(%ecx)
+      r->npages = n;
+ 994:	89 73 04             	mov    %esi,0x4(%ebx)
+    }
+    return r;
+  }
+  return morecore(n);
+}
+ 997:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 99a:	89 d8                	mov    %ebx,%eax
+ 99c:	5b                   	pop    %ebx
+ 99d:	5e                   	pop    %esi
+ 99e:	5f                   	pop    %edi
+ 99f:	5d                   	pop    %ebp
+ 9a0:	c3                   	ret
+ 9a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ 9a8:	8d 4b 14             	lea    0x14(%ebx),%ecx
+ 9ab:	8b 5b 14             	mov    0x14(%ebx),%ebx
+ 9ae:	85 db                	test   %ebx,%ebx
+ 9b0:	75 b8                	jne    96a <runalloc+0x1a>
+  m = n < MINCORE ? MINCORE : n;
+ 9b2:	bf 08 00 00 00       	mov    $0x8,%edi
+ 9b7:	39 fe                	cmp    %edi,%esi
+ 9b9:	0f 43 fe             	cmovae %esi,%edi
+  brk = sbrk(0);
+ 9bc:	83 ec 0c             	sub    $0xc,%esp
+ 9bf:	6a 00                	push   $0x0
+ 9c1:	e8 35 fb ff ff       	call   4fb <sbrk>
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 9c6:	89 fa                	mov    %edi,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 9c8:	89 c3                	mov    %eax,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 9ca:	c1 e2 0c             	shl    $0xc,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 9cd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 9d0:	f7 db                	neg    %ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 9d2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 9d5:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 9db:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+ 9de:	89 04 24             	mov    %eax,(%esp)
+ 9e1:	e8 15 fb ff ff       	call   4fb <sbrk>
+ 9e6:	83 c4 10             	add    $0x10,%esp
+ 9e9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 9ec:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 9ef:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 9f2:	74 3e                	je     a32 <runalloc+0xe2>
+  r = (struct page*)(brk + pad);
+ 9f4:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ 9f6:	01 da                	add    %ebx,%edx
+ 9f8:	89 15 6c 15 00 00    	mov    %edx,0x156c
+  if(m > n)
+ 9fe:	39 fe                	cmp    %edi,%esi
+ a00:	72 1e                	jb     a20 <runalloc+0xd0>
+  r->npages = n;
+ a02:	89 73 04             	mov    %esi,0x4(%ebx)
+  return r;
+ a05:	eb 90                	jmp    997 <runalloc+0x47>
+ a07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a0e:	66 90                	xchg   %ax,%ax
+      *pp = r->next;
+ a10:	8b 43 14             	mov    0x14(%ebx),%eax
+ a13:	89 01                	mov    %eax,(%ecx)
+}
+ a15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a18:	89 d8                	mov    %ebx,%eax
+ a1a:	5b                   	pop    %ebx
+ a1b:	5e                   	pop    %esi
+ a1c:	5f                   	pop    %edi
+ a1d:	5d                   	pop    %ebp
+ a1e:	c3                   	ret
+ a1f:	90                   	nop
+    runfree((struct page*)((char*)r + n*PGSIZE), m - n);
+ a20:	89 f0                	mov    %esi,%eax
+ a22:	29 f7                	sub    %esi,%edi
+ a24:	c1 e0 0c             	shl    $0xc,%eax
+ a27:	89 fa                	mov    %edi,%edx
+ a29:	01 d8                	add    %ebx,%eax
+ a2b:	e8 a0 fd ff ff       	call   7d0 <runfree>
+ a30:	eb d0                	jmp    a02 <runalloc+0xb2>
+    if(sbrk(pad + m*PGSIZE) == (char*)-1)
+ a32:	89 f7                	mov    %esi,%edi
+ a34:	83 ec 0c             	sub    $0xc,%esp
+ a37:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ a3a:	c1 e7 0c             	shl    $0xc,%edi
+ a3d:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+ a40:	50                   	push   %eax
+ a41:	e8 b5 fa ff ff       	call   4fb <sbrk>
+ a46:	83 c4 10             	add    $0x10,%esp
+ a49:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ a4c:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a4f:	74 0c                	je     a5d <runalloc+0x10d>
+  r = (struct page*)(brk + pad);
+ a51:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ a53:	01 df                	add    %ebx,%edi
+ a55:	89 3d 6c 15 00 00    	mov    %edi,0x156c
+  if(m > n)
+ a5b:	eb a5                	jmp    a02 <runalloc+0xb2>
+      return 0;
+ a5d:	31 db                	xor    %ebx,%ebx
+ a5f:	e9 33 ff ff ff       	jmp    997 <runalloc+0x47>
+ a64:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a6f:	90                   	nop
+
+00000a70 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+ a70:	55                   	push   %ebp
+ a71:	89 e5                	mov    %esp,%ebp
+ a73:	56                   	push   %esi
+ a74:	53                   	push   %ebx
+ a75:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  struct page *p;
+
+  if(ap == 0)
+ a78:	85 c9                	test   %ecx,%ecx
+ a7a:	74 1c                	je     a98 <free+0x28>
+    return;
+  p = (struct page*)((uint)ap & ~(PGSIZE-1));
+ a7c:	89 c8                	mov    %ecx,%eax
+ a7e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  switch(p->kind){
+ a83:	0f b7 10             	movzwl (%eax),%edx
+ a86:	66 83 fa 02          	cmp    $0x2,%dx
+ a8a:	74 14                	je     aa0 <free+0x30>
+ a8c:	66 83 fa 04          	cmp    $0x4,%dx
+ a90:	74 66                	je     af8 <free+0x88>
+ a92:	66 83 fa 01          	cmp    $0x1,%dx
+ a96:	74 18                	je     ab0 <free+0x40>
+    break;
+  case PMAP:
+    munmap(p, p->npages*PGSIZE);
+    break;
+  }
+}
+ a98:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a9b:	5b                   	pop    %ebx
+ a9c:	5e                   	pop    %esi
+ a9d:	5d                   	pop    %ebp
+ a9e:	c3                   	ret
+ a9f:	90                   	nop
+    runfree(p, p->npages);
+ aa0:	8b 50 04             	mov    0x4(%eax),%edx
+}
+ aa3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ aa6:	5b                   	pop    %ebx
+ aa7:	5e                   	pop    %esi
+ aa8:	5d                   	pop    %ebp
+    runfree(p, p->npages);
+ aa9:	e9 22 fd ff ff       	jmp    7d0 <runfree>
+ aae:	66 90                	xchg   %ax,%ax
+  b->next = p->free;
+ ab0:	8b 50 0c             	mov    0xc(%eax),%edx
+ ab3:	89 11                	mov    %edx,(%ecx)
+  if(p->nfree++ == 0)
+ ab5:	8b 50 08             	mov    0x8(%eax),%edx
+  p->free = b;
+ ab8:	89 48 0c             	mov    %ecx,0xc(%eax)
+  if(p->nfree++ == 0)
+ abb:	8d 5a 01             	lea    0x1(%edx),%ebx
+ abe:	89 58 08             	mov    %ebx,0x8(%eax)
+ ac1:	85 d2                	test   %edx,%edx
+ ac3:	74 53                	je     b18 <free+0xa8>
+  if(p->nfree == nblocks(p->class)){
+ ac5:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ ac9:	8d 4e 04             	lea    0x4(%esi),%ecx
+ acc:	ba e0 0f 00 00       	mov    $0xfe0,%edx
+ ad1:	d3 fa                	sar    %cl,%edx
+  if(p->nfree == nblocks(p->class)){
+ ad3:	39 da                	cmp    %ebx,%edx
+ ad5:	75 c1                	jne    a98 <free+0x28>
+  if(p->prev)
+ ad7:	8b 48 18             	mov    0x18(%eax),%ecx
+    p->prev->next = p->next;
+ ada:	8b 50 14             	mov    0x14(%eax),%edx
+  if(p->prev)
+ add:	85 c9                	test   %ecx,%ecx
+ adf:	74 6f                	je     b50 <free+0xe0>
+    p->prev->next = p->next;
+ ae1:	89 51 14             	mov    %edx,0x14(%ecx)
+  if(p->next)
+ ae4:	85 d2                	test   %edx,%edx
+ ae6:	74 06                	je     aee <free+0x7e>
+    p->next->prev = p->prev;
+ ae8:	8b 48 18             	mov    0x18(%eax),%ecx
+ aeb:	89 4a 18             	mov    %ecx,0x18(%edx)
+    runfree(p, 1);
+ aee:	ba 01 00 00 00       	mov    $0x1,%edx
+ af3:	eb ae                	jmp    aa3 <free+0x33>
+ af5:	8d 76 00             	lea    0x0(%esi),%esi
+    munmap(p, p->npages*PGSIZE);
+ af8:	8b 50 04             	mov    0x4(%eax),%edx
+ afb:	83 ec 08             	sub    $0x8,%esp
+ afe:	c1 e2 0c             	shl    $0xc,%edx
+ b01:	52                   	push   %edx
+ b02:	50                   	push   %eax
+ b03:	e8 1b fa ff ff       	call   523 <munmap>
+    break;
+ b08:	83 c4 10             	add    $0x10,%esp
+}
+ b0b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ b0e:	5b                   	pop    %ebx
+ b0f:	5e                   	pop    %esi
+ b10:	5d                   	pop    %ebp
+ b11:	c3                   	ret
+ b12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  p->next = partial[p->class];
+ b18:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  p->prev = 0;
+ b1c:	c7 40 18 00 00 00 00 	movl   $0x0,0x18(%eax)
+  p->next = partial[p->class];
+ b23:	bb 01 00 00 00       	mov    $0x1,%ebx
+ b28:	8b 14 b5 74 15 00 00 	mov    0x1574(,%esi,4),%edx
+ b2f:	89 50 14             	mov    %edx,0x14(%eax)
+  if(p->next)
+ b32:	85 d2                	test   %edx,%edx
+ b34:	74 0a                	je     b40 <free+0xd0>
+    p->next->prev = p;
+ b36:	89 42 18             	mov    %eax,0x18(%edx)
+  partial[p->class] = p;
+ b39:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  if(p->nfree == nblocks(p->class)){
+ b3d:	8b 58 08             	mov    0x8(%eax),%ebx
+  partial[p->class] = p;
+ b40:	89 04 b5 74 15 00 00 	mov    %eax,0x1574(,%esi,4)
+}
+ b47:	eb 80                	jmp    ac9 <free+0x59>
+ b49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ b50:	89 14 b5 74 15 00 00 	mov    %edx,0x1574(,%esi,4)
+ b57:	eb 8b                	jmp    ae4 <free+0x74>
+ b59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000b60 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ b60:	55                   	push   %ebp
+ b61:	89 e5                	mov    %esp,%ebp
+ b63:	56                   	push   %esi
+ b64:	53                   	push   %ebx
+ b65:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct page *p;
+  uint n;
+
+  if(nbytes <= MAXSMALL)
+ b68:	3d 00 04 00 00       	cmp    $0x400,%eax
+ b6d:	76 71                	jbe    be0 <malloc+0x80>
+    return smallalloc(sizeclass(nbytes));
+  if(nbytes > 0x7fffffff)
+ b6f:	85 c0                	test   %eax,%eax
+ b71:	0f 88 d9 00 00 00    	js     c50 <malloc+0xf0>
+    return 0;
+  n = (nbytes + HDRSIZE + PGSIZE-1) / PGSIZE;
+ b77:	8d 90 1f 10 00 00    	lea    0x101f(%eax),%edx
+ b7d:	89 d3                	mov    %edx,%ebx
+ b7f:	c1 eb 0c             	shr    $0xc,%ebx
+  if(nbytes >= MAPMIN){
+ b82:	3d ff ff 00 00       	cmp    $0xffff,%eax
+ b87:	77 27                	ja     bb0 <malloc+0x50>
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    if(p == MAP_FAILED)
+      return 0;
+    p->kind = PMAP;
+  } else {
+    if((p = runalloc(n)) == 0)
+ b89:	89 d8                	mov    %ebx,%eax
+ b8b:	e8 c0 fd ff ff       	call   950 <runalloc>
+ b90:	85 c0                	test   %eax,%eax
+ b92:	0f 84 b8 00 00 00    	je     c50 <malloc+0xf0>
+      return 0;
+    p->kind = PRUN;
+ b98:	ba 02 00 00 00       	mov    $0x2,%edx
+ b9d:	66 89 10             	mov    %dx,(%eax)
+  }
+  p->npages = n;
+ ba0:	89 58 04             	mov    %ebx,0x4(%eax)
+  return (char*)p + HDRSIZE;
+ ba3:	8d 58 20             	lea    0x20(%eax),%ebx
+}
+ ba6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ ba9:	89 d8                	mov    %ebx,%eax
+ bab:	5b                   	pop    %ebx
+ bac:	5e                   	pop    %esi
+ bad:	5d                   	pop    %ebp
+ bae:	c3                   	ret
+ baf:	90                   	nop
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+ bb0:	83 ec 08             	sub    $0x8,%esp
+ bb3:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+ bb9:	6a 00                	push   $0x0
+ bbb:	6a ff                	push   $0xffffffff
+ bbd:	6a 22                	push   $0x22
+ bbf:	6a 03                	push   $0x3
+ bc1:	52                   	push   %edx
+ bc2:	6a 00                	push   $0x0
+ bc4:	e8 52 f9 ff ff       	call   51b <mmap>
+    if(p == MAP_FAILED)
+ bc9:	83 c4 20             	add    $0x20,%esp
+ bcc:	83 f8 ff             	cmp    $0xffffffff,%eax
+ bcf:	74 7f                	je     c50 <malloc+0xf0>
+    p->kind = PMAP;
+ bd1:	b9 04 00 00 00       	mov    $0x4,%ecx
+ bd6:	66 89 08             	mov    %cx,(%eax)
+ bd9:	eb c5                	jmp    ba0 <malloc+0x40>
+ bdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ bdf:	90                   	nop
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ be0:	83 f8 10             	cmp    $0x10,%eax
+ be3:	0f 86 07 01 00 00    	jbe    cf0 <malloc+0x190>
+ be9:	31 db                	xor    %ebx,%ebx
+ beb:	ba 10 00 00 00       	mov    $0x10,%edx
+ bf0:	83 c3 01             	add    $0x1,%ebx
+ bf3:	89 d6                	mov    %edx,%esi
+ bf5:	89 d9                	mov    %ebx,%ecx
+ bf7:	d3 e6                	shl    %cl,%esi
+ bf9:	39 c6                	cmp    %eax,%esi
+ bfb:	72 f3                	jb     bf0 <malloc+0x90>
+  if((p = partial[c]) == 0){
+ bfd:	8b 14 9d 74 15 00 00 	mov    0x1574(,%ebx,4),%edx
+ c04:	85 d2                	test   %edx,%edx
+ c06:	74 58                	je     c60 <malloc+0x100>
+  if((b = p->free) != 0){
+ c08:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ c0b:	8b 4a 08             	mov    0x8(%edx),%ecx
+  if((b = p->free) != 0){
+ c0e:	85 db                	test   %ebx,%ebx
+ c10:	0f 84 aa 00 00 00    	je     cc0 <malloc+0x160>
+    p->free = b->next;
+ c16:	8b 03                	mov    (%ebx),%eax
+ c18:	89 42 0c             	mov    %eax,0xc(%edx)
+  if(--p->nfree == 0)
+ c1b:	83 e9 01             	sub    $0x1,%ecx
+ c1e:	89 4a 08             	mov    %ecx,0x8(%edx)
+ c21:	75 83                	jne    ba6 <malloc+0x46>
+  if(p->prev)
+ c23:	8b 4a 18             	mov    0x18(%edx),%ecx
+    p->prev->next = p->next;
+ c26:	8b 42 14             	mov    0x14(%edx),%eax
+  if(p->prev)
+ c29:	85 c9                	test   %ecx,%ecx
+ c2b:	0f 84 cf 00 00 00    	je     d00 <malloc+0x1a0>
+    p->prev->next = p->next;
+ c31:	89 41 14             	mov    %eax,0x14(%ecx)
+  if(p->next)
+ c34:	85 c0                	test   %eax,%eax
+ c36:	0f 84 6a ff ff ff    	je     ba6 <malloc+0x46>
+    p->next->prev = p->prev;
+ c3c:	8b 52 18             	mov    0x18(%edx),%edx
+ c3f:	89 50 18             	mov    %edx,0x18(%eax)
+ c42:	e9 5f ff ff ff       	jmp    ba6 <malloc+0x46>
+ c47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c4e:	66 90                	xchg   %ax,%ax
+}
+ c50:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+ c53:	31 db                	xor    %ebx,%ebx
+}
+ c55:	89 d8                	mov    %ebx,%eax
+ c57:	5b                   	pop    %ebx
+ c58:	5e                   	pop    %esi
+ c59:	5d                   	pop    %ebp
+ c5a:	c3                   	ret
+ c5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c5f:	90                   	nop
+    if((p = runalloc(1)) == 0)
+ c60:	b8 01 00 00 00       	mov    $0x1,%eax
+ c65:	e8 e6 fc ff ff       	call   950 <runalloc>
+ c6a:	89 c2                	mov    %eax,%edx
+ c6c:	85 c0                	test   %eax,%eax
+ c6e:	74 e0                	je     c50 <malloc+0xf0>
+    p->kind = PSMALL;
+ c70:	b8 01 00 00 00       	mov    $0x1,%eax
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ c75:	8d 4b 04             	lea    0x4(%ebx),%ecx
+    p->class = c;
+ c78:	66 89 5a 02          	mov    %bx,0x2(%edx)
+ c7c:	0f b7 db             	movzwl %bx,%ebx
+    p->kind = PSMALL;
+ c7f:	66 89 02             	mov    %ax,(%edx)
+    p->fresh = (char*)p + HDRSIZE;
+ c82:	8d 42 20             	lea    0x20(%edx),%eax
+ c85:	89 42 10             	mov    %eax,0x10(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ c88:	b8 e0 0f 00 00       	mov    $0xfe0,%eax
+ c8d:	d3 f8                	sar    %cl,%eax
+    p->free = 0;
+ c8f:	c7 42 0c 00 00 00 00 	movl   $0x0,0xc(%edx)
+    p->nfree = nblocks(c);
+ c96:	89 42 08             	mov    %eax,0x8(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ c99:	89 c1                	mov    %eax,%ecx
+  p->next = partial[p->class];
+ c9b:	8b 04 9d 74 15 00 00 	mov    0x1574(,%ebx,4),%eax
+  p->prev = 0;
+ ca2:	c7 42 18 00 00 00 00 	movl   $0x0,0x18(%edx)
+  p->next = partial[p->class];
+ ca9:	89 42 14             	mov    %eax,0x14(%edx)
+  if(p->next)
+ cac:	85 c0                	test   %eax,%eax
+ cae:	75 20                	jne    cd0 <malloc+0x170>
+  partial[p->class] = p;
+ cb0:	89 14 9d 74 15 00 00 	mov    %edx,0x1574(,%ebx,4)
+  if((b = p->free) != 0){
+ cb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cbe:	66 90                	xchg   %ax,%ax
+    b = (struct block*)p->fresh;
+ cc0:	8b 5a 10             	mov    0x10(%edx),%ebx
+    p->fresh += MINSMALL << c;
+ cc3:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+ cc6:	89 42 10             	mov    %eax,0x10(%edx)
+ cc9:	e9 4d ff ff ff       	jmp    c1b <malloc+0xbb>
+ cce:	66 90                	xchg   %ax,%ax
+    p->next->prev = p;
+ cd0:	89 50 18             	mov    %edx,0x18(%eax)
+  partial[p->class] = p;
+ cd3:	0f b7 42 02          	movzwl 0x2(%edx),%eax
+  if((b = p->free) != 0){
+ cd7:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ cda:	8b 4a 08             	mov    0x8(%edx),%ecx
+  partial[p->class] = p;
+ cdd:	89 14 85 74 15 00 00 	mov    %edx,0x1574(,%eax,4)
+}
+ ce4:	e9 25 ff ff ff       	jmp    c0e <malloc+0xae>
+ ce9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ cf0:	be 10 00 00 00       	mov    $0x10,%esi
+ cf5:	31 db                	xor    %ebx,%ebx
+ cf7:	e9 01 ff ff ff       	jmp    bfd <malloc+0x9d>
+ cfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ d00:	0f b7 4a 02          	movzwl 0x2(%edx),%ecx
+ d04:	89 04 8d 74 15 00 00 	mov    %eax,0x1574(,%ecx,4)
+ d0b:	e9 24 ff ff ff       	jmp    c34 <malloc+0xd4>
+
+00000d10 <tmain>:
+  void *arg;
+};
+
+static void
+tmain(void *a)
+{
+ d10:	55                   	push   %ebp
+ d11:	89 e5                	mov    %esp,%ebp
+ d13:	83 ec 14             	sub    $0x14,%esp
+ d16:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+ d19:	ff 70 04             	push   0x4(%eax)
+ d1c:	ff 10                	call   *(%eax)
+  exit();
+ d1e:	e8 50 f7 ff ff       	call   473 <exit>
+ d23:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000d30 <thread_create>:
+// Start a thread running fn(arg), and return its id for
+// thread_join, or -1. A thread that returns from fn exits.
+// Uses malloc, which only one thread may call at a time.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ d30:	55                   	push   %ebp
+ d31:	89 e5                	mov    %esp,%ebp
+ d33:	53                   	push   %ebx
+ d34:	83 ec 20             	sub    $0x20,%esp
+  char *stack;
+  struct tstart *t;
+  int tid;
+
+  if((stack = malloc(TSTACK)) == 0)
+ d37:	68 00 20 00 00       	push   $0x2000
+ d3c:	e8 1f fe ff ff       	call   b60 <malloc>
+ d41:	83 c4 10             	add    $0x10,%esp
+ d44:	85 c0                	test   %eax,%eax
+ d46:	74 4f                	je     d97 <thread_create+0x67>
+    return -1;
+  t = (struct tstart*)(stack + TSTACK) - 1;
+  t->fn = fn;
+ d48:	8b 55 08             	mov    0x8(%ebp),%edx
+ d4b:	89 c3                	mov    %eax,%ebx
+  t->arg = arg;
+  if((tid = clone(tmain, t, t)) < 0)
+ d4d:	83 ec 04             	sub    $0x4,%esp
+  t = (struct tstart*)(stack + TSTACK) - 1;
+ d50:	8d 80 f8 1f 00 00    	lea    0x1ff8(%eax),%eax
+  t->fn = fn;
+ d56:	89 93 f8 1f 00 00    	mov    %edx,0x1ff8(%ebx)
+  t->arg = arg;
+ d5c:	8b 55 0c             	mov    0xc(%ebp),%edx
+ d5f:	89 93 fc 1f 00 00    	mov    %edx,0x1ffc(%ebx)
+  if((tid = clone(tmain, t, t)) < 0)
+ d65:	50                   	push   %eax
+ d66:	50                   	push   %eax
+ d67:	68 10 0d 00 00       	push   $0xd10
+ d6c:	e8 d2 f7 ff ff       	call   543 <clone>
+ d71:	83 c4 10             	add    $0x10,%esp
+ d74:	85 c0                	test   %eax,%eax
+ d76:	78 08                	js     d80 <thread_create+0x50>
+    free(stack);
+  return tid;
+}
+ d78:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ d7b:	c9                   	leave
+ d7c:	c3                   	ret
+ d7d:	8d 76 00             	lea    0x0(%esi),%esi
+    free(stack);
+ d80:	83 ec 0c             	sub    $0xc,%esp
+ d83:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d86:	53                   	push   %ebx
+ d87:	e8 e4 fc ff ff       	call   a70 <free>
+ d8c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ d8f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(stack);
+ d92:	83 c4 10             	add    $0x10,%esp
+}
+ d95:	c9                   	leave
+ d96:	c3                   	ret
+    return -1;
+ d97:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ d9c:	eb da                	jmp    d78 <thread_create+0x48>
+ d9e:	66 90                	xchg   %ax,%ax
+
+00000da0 <thread_join>:
+// Wait for the thread tid to exit, or for any thread if tid
+// is -1, and free its stack. Returns the thread's id, or -1
+// if there is no such thread.
+int
+thread_join(int tid)
+{
+ da0:	55                   	push   %ebp
+ da1:	89 e5                	mov    %esp,%ebp
+ da3:	53                   	push   %ebx
+  void *top;
+
+  if((tid = join(tid, &top)) >= 0)
+ da4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ da7:	83 ec 1c             	sub    $0x1c,%esp
+  if((tid = join(tid, &top)) >= 0)
+ daa:	50                   	push   %eax
+ dab:	ff 75 08             	push   0x8(%ebp)
+ dae:	e8 98 f7 ff ff       	call   54b <join>
+ db3:	83 c4 10             	add    $0x10,%esp
+ db6:	89 c3                	mov    %eax,%ebx
+ db8:	85 c0                	test   %eax,%eax
+ dba:	78 14                	js     dd0 <thread_join+0x30>
+    free((char*)top + sizeof(struct tstart) - TSTACK);
+ dbc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ dbf:	83 ec 0c             	sub    $0xc,%esp
+ dc2:	2d f8 1f 00 00       	sub    $0x1ff8,%eax
+ dc7:	50                   	push   %eax
+ dc8:	e8 a3 fc ff ff       	call   a70 <free>
+ dcd:	83 c4 10             	add    $0x10,%esp
+  return tid;
+}
+ dd0:	89 d8                	mov    %ebx,%eax
+ dd2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ dd5:	c9                   	leave
+ dd6:	c3                   	ret
+ dd7:	66 90                	xchg   %ax,%ax
+ dd9:	66 90                	xchg   %ax,%ax
+ ddb:	66 90                	xchg   %ax,%ax
+ ddd:	66 90                	xchg   %ax,%ax
+ ddf:	90                   	nop
+
+00000de0 <mutex_init>:
+#define LOCKED    1   // no one is waiting
+#define CONTENDED 2   // someone may be sleeping in futex()
+
+void
+mutex_init(struct mutex *m)
+{
+ de0:	55                   	push   %ebp
+ de1:	89 e5                	mov    %esp,%ebp
+  m->state = UNLOCKED;
+ de3:	8b 45 08             	mov    0x8(%ebp),%eax
+ de6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ dec:	5d                   	pop    %ebp
+ ded:	c3                   	ret
+ dee:	66 90                	xchg   %ax,%ax
+
+00000df0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ df0:	55                   	push   %ebp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, UNLOCKED, LOCKED)) == UNLOCKED)
+ df1:	31 c0                	xor    %eax,%eax
+ df3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ df8:	89 e5                	mov    %esp,%ebp
+ dfa:	56                   	push   %esi
+ dfb:	53                   	push   %ebx
+ dfc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->state, UNLOCKED, LOCKED)) == UNLOCKED)
+ dff:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ e03:	85 c0                	test   %eax,%eax
+ e05:	74 29                	je     e30 <mutex_lock+0x40>
+    return;
+  // Mark the mutex contended, so that the holder wakes us
+  // when it unlocks, and sleep until it is free.
+  if(c != CONTENDED)
+ e07:	83 f8 02             	cmp    $0x2,%eax
+ e0a:	75 34                	jne    e40 <mutex_lock+0x50>
+    c = __sync_lock_test_and_set(&m->state, CONTENDED);
+  while(c != UNLOCKED){
+    futex(&m->state, FUTEX_WAIT, CONTENDED);
+    c = __sync_lock_test_and_set(&m->state, CONTENDED);
+ e0c:	be 02 00 00 00       	mov    $0x2,%esi
+ e11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAIT, CONTENDED);
+ e18:	83 ec 04             	sub    $0x4,%esp
+ e1b:	6a 02                	push   $0x2
+ e1d:	6a 00                	push   $0x0
+ e1f:	53                   	push   %ebx
+ e20:	e8 2e f7 ff ff       	call   553 <futex>
+    c = __sync_lock_test_and_set(&m->state, CONTENDED);
+ e25:	89 f0                	mov    %esi,%eax
+ e27:	87 03                	xchg   %eax,(%ebx)
+  while(c != UNLOCKED){
+ e29:	83 c4 10             	add    $0x10,%esp
+ e2c:	85 c0                	test   %eax,%eax
+ e2e:	75 e8                	jne    e18 <mutex_lock+0x28>
+  }
+}
+ e30:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ e33:	5b                   	pop    %ebx
+ e34:	5e                   	pop    %esi
+ e35:	5d                   	pop    %ebp
+ e36:	c3                   	ret
+ e37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e3e:	66 90                	xchg   %ax,%ax
+    c = __sync_lock_test_and_set(&m->state, CONTENDED);
+ e40:	b8 02 00 00 00       	mov    $0x2,%eax
+ e45:	87 03                	xchg   %eax,(%ebx)
+  while(c != UNLOCKED){
+ e47:	85 c0                	test   %eax,%eax
+ e49:	75 c1                	jne    e0c <mutex_lock+0x1c>
+}
+ e4b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ e4e:	5b                   	pop    %ebx
+ e4f:	5e                   	pop    %esi
+ e50:	5d                   	pop    %ebp
+ e51:	c3                   	ret
+ e52:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000e60 <mutex_trylock>:
+
+// Returns 0 if it got the mutex, -1 if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+ e60:	55                   	push   %ebp
+  if(__sync_val_compare_and_swap(&m->state, UNLOCKED, LOCKED) == UNLOCKED)
+ e61:	31 c0                	xor    %eax,%eax
+ e63:	b9 01 00 00 00       	mov    $0x1,%ecx
+{
+ e68:	89 e5                	mov    %esp,%ebp
+ e6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  if(__sync_val_compare_and_swap(&m->state, UNLOCKED, LOCKED) == UNLOCKED)
+ e6d:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+    return 0;
+  return -1;
+}
+ e71:	5d                   	pop    %ebp
+  if(__sync_val_compare_and_swap(&m->state, UNLOCKED, LOCKED) == UNLOCKED)
+ e72:	f7 d8                	neg    %eax
+ e74:	19 c0                	sbb    %eax,%eax
+}
+ e76:	c3                   	ret
+ e77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e7e:	66 90                	xchg   %ax,%ax
+
+00000e80 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ e80:	55                   	push   %ebp
+ e81:	89 e5                	mov    %esp,%ebp
+ e83:	83 ec 08             	sub    $0x8,%esp
+ e86:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != LOCKED){
+ e89:	f0 83 28 01          	lock subl $0x1,(%eax)
+ e8d:	75 09                	jne    e98 <mutex_unlock+0x18>
+    m->state = UNLOCKED;
+    futex(&m->state, FUTEX_WAKE, 1);
+  }
+}
+ e8f:	c9                   	leave
+ e90:	c3                   	ret
+ e91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ e98:	83 ec 04             	sub    $0x4,%esp
+    m->state = UNLOCKED;
+ e9b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex(&m->state, FUTEX_WAKE, 1);
+ ea1:	6a 01                	push   $0x1
+ ea3:	6a 01                	push   $0x1
+ ea5:	50                   	push   %eax
+ ea6:	e8 a8 f6 ff ff       	call   553 <futex>
+ eab:	83 c4 10             	add    $0x10,%esp
+}
+ eae:	c9                   	leave
+ eaf:	c3                   	ret
+
+00000eb0 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ eb0:	55                   	push   %ebp
+ eb1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ eb3:	8b 45 08             	mov    0x8(%ebp),%eax
+ eb6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ ebc:	5d                   	pop    %ebp
+ ebd:	c3                   	ret
+ ebe:	66 90                	xchg   %ax,%ax
+
+00000ec0 <cond_wait>:
+
+// Unlock m, wait for a signal, and lock m again. As with any
+// condition variable, the caller should recheck its condition.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ ec0:	55                   	push   %ebp
+ ec1:	89 e5                	mov    %esp,%ebp
+ ec3:	57                   	push   %edi
+ ec4:	56                   	push   %esi
+ ec5:	53                   	push   %ebx
+ ec6:	83 ec 0c             	sub    $0xc,%esp
+ ec9:	8b 75 08             	mov    0x8(%ebp),%esi
+ ecc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ ecf:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->state, 1) != LOCKED){
+ ed1:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ ed5:	75 21                	jne    ef8 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ ed7:	83 ec 04             	sub    $0x4,%esp
+ eda:	57                   	push   %edi
+ edb:	6a 00                	push   $0x0
+ edd:	56                   	push   %esi
+ ede:	e8 70 f6 ff ff       	call   553 <futex>
+  mutex_lock(m);
+ ee3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ ee6:	83 c4 10             	add    $0x10,%esp
+}
+ ee9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ eec:	5b                   	pop    %ebx
+ eed:	5e                   	pop    %esi
+ eee:	5f                   	pop    %edi
+ eef:	5d                   	pop    %ebp
+  mutex_lock(m);
+ ef0:	e9 fb fe ff ff       	jmp    df0 <mutex_lock>
+ ef5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ ef8:	83 ec 04             	sub    $0x4,%esp
+    m->state = UNLOCKED;
+ efb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex(&m->state, FUTEX_WAKE, 1);
+ f01:	6a 01                	push   $0x1
+ f03:	6a 01                	push   $0x1
+ f05:	53                   	push   %ebx
+ f06:	e8 48 f6 ff ff       	call   553 <futex>
+ f0b:	83 c4 10             	add    $0x10,%esp
+ f0e:	eb c7                	jmp    ed7 <cond_wait+0x17>
+
+00000f10 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ f10:	55                   	push   %ebp
+ f11:	89 e5                	mov    %esp,%ebp
+ f13:	83 ec 0c             	sub    $0xc,%esp
+ f16:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ f19:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+ f1d:	6a 01                	push   $0x1
+ f1f:	6a 01                	push   $0x1
+ f21:	50                   	push   %eax
+ f22:	e8 2c f6 ff ff       	call   553 <futex>
+}
+ f27:	83 c4 10             	add    $0x10,%esp
+ f2a:	c9                   	leave
+ f2b:	c3                   	ret
+ f2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000f30 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ f30:	55                   	push   %ebp
+ f31:	89 e5                	mov    %esp,%ebp
+ f33:	83 ec 0c             	sub    $0xc,%esp
+ f36:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ f39:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 0x7fffffff);
+ f3d:	68 ff ff ff 7f       	push   $0x7fffffff
+ f42:	6a 01                	push   $0x1
+ f44:	50                   	push   %eax
+ f45:	e8 09 f6 ff ff       	call   553 <futex>
+}
+ f4a:	83 c4 10             	add    $0x10,%esp
+ f4d:	c9                   	leave
+ f4e:	c3                   	ret
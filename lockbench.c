@@ -0,0 +1,77 @@
+// Measure lock contention: threads add to a shared counter under
+// a futex-based mutex and, for comparison, under a spin lock.
+// A single thread shows the uncontended cost, which for the mutex
+// involves no system call; getpid() is timed for reference.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "usync.h"
+
+#define NITER 200000
+#define MAXTHREAD 4
+
+struct mutex mu;
+volatile uint spin;
+volatile uint counter;
+int usemutex;
+
+void
+worker(void *arg)
+{
+  int i;
+
+  for(i = 0; i < NITER; i++){
+    if(usemutex){
+      mutex_lock(&mu);
+      counter++;
+      mutex_unlock(&mu);
+    } else {
+      while(__sync_lock_test_and_set(&spin, 1) != 0)
+        ;
+      counter++;
+      __sync_lock_release(&spin);
+    }
+  }
+}
+
+// Run nthread workers and return the ticks they took.
+int
+run(int nthread)
+{
+  int i, start, tid[MAXTHREAD];
+
+  counter = 0;
+  start = uptime();
+  for(i = 0; i < nthread; i++){
+    if((tid[i] = thread_create(worker, 0)) < 0){
+      printf(1, "lockbench: thread_create failed\n");
+      exit();
+    }
+  }
+  for(i = 0; i < nthread; i++)
+    thread_join(tid[i]);
+  if(counter != nthread * NITER)
+    printf(1, "lockbench: lost updates, counter %d\n", counter);
+  return uptime() - start;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int n, i, start;
+
+  mutex_init(&mu);
+  for(n = 1; n <= MAXTHREAD; n *= 2){
+    usemutex = 1;
+    printf(1, "%d threads x %d: mutex %d ticks, ", n, NITER, run(n));
+    usemutex = 0;
+    printf(1, "spin lock %d ticks\n", run(n));
+  }
+
+  start = uptime();
+  for(i = 0; i < NITER; i++)
+    getpid();
+  printf(1, "%d getpid calls: %d ticks\n", NITER, uptime() - start);
+  exit();
+}
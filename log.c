@@ -28,6 +28,39 @@
 //   block C
 //   ...
 // Log appends are synchronous.
+//
+// Only metadata is logged; writei writes file data home
+// directly. A block freed by a transaction is not reused until
+// the transaction commits, and when it is reused, any copies
+// of it in the log are revoked (see log_revoke), so recovery
+// does not replay stale metadata over file data.
+//
+// Blocks are not written to their home locations at commit.
+// A committed block stays dirty in the buffer cache, and the
+// log keeps it: each commit appends its blocks after those
+// of earlier transactions, and recovery replays them all in
+// order. The flusher kernel thread writes committed blocks
+// home once they are DIRTYAGE ticks old, or all of them once
+// committed blocks fill more than DIRTYRATIO percent of the
+// log, and empties the log when they are all home. So a
+// system call returns once its transaction is in the log.
+// If the log fills anyway, begin_op writes the blocks home
+// itself (see empty_log).
+//
+// The flusher must not write home a block that the open
+// transaction has changed. log_write is called with the
+// block's buffer locked, so holding the buffer and seeing
+// the block is not in log.cur is enough.
+//
+// Commits are grouped and overlap the next transaction.
+// The last end_op of a transaction first yields, so that
+// processes ready to run can join it, and waits for the
+// previous commit. Then commit() copies the transaction's
+// blocks into log buffers, with begin_op held off only for
+// that copy, and writes them and the header while new
+// system calls run in the next transaction. There are two
+// in-memory headers: log.cur for the open transaction and
+// log.com for the one being committed.
 
 // Contents of the header block, used for both the on-disk header block
 // and to keep track in memory of logged block# before commit.
@@ -36,19 +69,35 @@ struct logheader {
   int block[LOGSIZE];
 };
 
+#define DIRTYAGE   300  // ticks before the flusher writes a committed block home
+#define DIRTYRATIO 50   // percent of the log committed blocks may fill
+
 struct log {
   struct spinlock lock;
   int start;
   int size;
   int outstanding; // how many FS sys calls are executing.
-  int committing;  // in commit(), please wait.
+  int committing;  // in commit().
+  int copying;     // commit() is copying blocks, please wait.
+  int emptying;    // in empty_log(), please wait.
   int dev;
-  struct logheader lh;
+  struct logheader lh;     // committed blocks, as on disk
+  uint age[LOGSIZE];       // ticks when lh.block[i] committed
+  char home[LOGSIZE];      // lh.block[i] has been written home
+  int gen;                 // count of empty_log calls
+  struct logheader com;    // transaction being committed
+  struct logheader cur;    // open transaction
+  // Blocks freed by the open and committing transactions,
+  // which balloc must not reuse until the frees commit.
+  uchar freed[2][(FSSIZE+7)/8];
+  int curfreed;            // index in freed of the open transaction
 };
 struct log log;
 
 static void recover_from_log(void);
 static void commit();
+static void empty_log(void);
+static void flusher(void);
 
 void
 initlog(int dev)
@@ -63,15 +112,19 @@ initlog(int dev)
   log.size = sb.nlog;
   log.dev = dev;
   recover_from_log();
+  kthread("flusher", flusher);
 }
 
-// Copy committed blocks from log to their home location
+// Copy committed blocks from log to their home location,
+// during recovery.
 static void
 install_trans(void)
 {
   int tail;
 
   for (tail = 0; tail < log.lh.n; tail++) {
+    if (log.lh.block[tail] == 0)  // revoked
+      continue;
     struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
     struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
     memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
@@ -127,11 +180,22 @@ begin_op(void)
 {
   acquire(&log.lock);
   while(1){
-    if(log.committing){
-      sleep(&log, &log.lock);
-    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
-      // this op might exhaust log space; wait for commit.
+    if(log.copying || log.emptying){
       sleep(&log, &log.lock);
+    } else if(log.lh.n + log.com.n + log.cur.n +
+              (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
+      if(log.outstanding == 0 && log.cur.n == 0 && !log.committing){
+        // the log is full of committed blocks; make room.
+        log.emptying = 1;
+        release(&log.lock);
+        empty_log();
+        acquire(&log.lock);
+        log.emptying = 0;
+        wakeup(&log);
+      } else {
+        // this op might exhaust log space; wait for commit.
+        sleep(&log, &log.lock);
+      }
     } else {
       log.outstanding += 1;
       release(&log.lock);
@@ -145,65 +209,222 @@ begin_op(void)
 void
 end_op(void)
 {
-  int do_commit = 0;
-
   acquire(&log.lock);
   log.outstanding -= 1;
-  if(log.committing)
-    panic("log.committing");
-  if(log.outstanding == 0){
-    do_commit = 1;
-    log.committing = 1;
-  } else {
-    // begin_op() may be waiting for log space,
-    // and decrementing log.outstanding has decreased
-    // the amount of reserved space.
-    wakeup(&log);
+  // begin_op() may be waiting for log space,
+  // and decrementing log.outstanding has decreased
+  // the amount of reserved space.
+  wakeup(&log);
+  if(log.outstanding > 0 || log.cur.n == 0){
+    release(&log.lock);
+    return;
   }
-  release(&log.lock);
 
-  if(do_commit){
-    // call commit w/o holding locks, since not allowed
-    // to sleep with locks.
-    commit();
-    acquire(&log.lock);
-    log.committing = 0;
-    wakeup(&log);
+  // Let processes that are ready join the transaction,
+  // and wait for the previous commit. If another op
+  // begins meanwhile, its end_op will commit.
+  release(&log.lock);
+  yield();
+  acquire(&log.lock);
+  while(log.committing && log.outstanding == 0)
+    sleep(&log, &log.lock);
+  if(log.outstanding > 0 || log.cur.n == 0){
     release(&log.lock);
+    return;
   }
+  log.committing = 1;
+  log.copying = 1;
+  log.com = log.cur;
+  log.cur.n = 0;
+  log.curfreed = !log.curfreed;
+  release(&log.lock);
+
+  // call commit w/o holding locks, since not allowed
+  // to sleep with locks.
+  commit();
+  acquire(&log.lock);
+  log.committing = 0;
+  wakeup(&log);
+  release(&log.lock);
 }
 
-// Copy modified blocks from cache to log.
+// Copy the committing transaction's blocks from cache to
+// log buffers, after the blocks of committed transactions,
+// and pin them until write_log writes them.
 static void
-write_log(void)
+copy_log(void)
 {
   int tail;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *to = bread(log.dev, log.start+tail+1); // log block
-    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
+  for (tail = 0; tail < log.com.n; tail++) {
+    struct buf *to = bread(log.dev, log.start+log.lh.n+tail+1); // log block
+    struct buf *from = bread(log.dev, log.com.block[tail]); // cache block
     memmove(to->data, from->data, BSIZE);
-    bwrite(to);  // write the log
+    to->flags |= B_DIRTY;
     brelse(from);
     brelse(to);
   }
 }
 
+// Write the log buffers filled by copy_log to the log.
+static void
+write_log(void)
+{
+  int tail;
+
+  for (tail = 0; tail < log.com.n; tail++) {
+    struct buf *to = bread(log.dev, log.start+log.lh.n+tail+1);
+    bwrite(to);  // write the log
+    brelse(to);
+  }
+}
+
 static void
 commit()
 {
-  if (log.lh.n > 0) {
-    write_log();     // Write modified blocks from cache to log
-    write_head();    // Write header to disk -- the real commit
-    install_trans(); // Now install writes to home locations
-    log.lh.n = 0;
-    write_head();    // Erase the transaction from the log
+  int i, n;
+
+  copy_log();      // Copy modified blocks from cache to log buffers
+  acquire(&log.lock);
+  log.copying = 0; // Let the next transaction begin
+  wakeup(&log);
+  release(&log.lock);
+  write_log();     // Write the log buffers to disk
+
+  // Keep the flusher off the blocks until they are committed.
+  acquire(&log.lock);
+  n = log.lh.n;
+  for (i = 0; i < log.com.n; i++) {
+    log.lh.block[log.lh.n] = log.com.block[i];
+    log.home[log.lh.n] = 1;
+    log.lh.n++;
+  }
+  log.com.n = 0;
+  release(&log.lock);
+  write_head();    // Write header to disk -- the real commit
+  acquire(&log.lock);
+  for (i = n; i < log.lh.n; i++) {
+    log.age[i] = ticks;
+    log.home[i] = log.lh.block[i] == 0;
+  }
+  // Blocks it freed may be reused now.
+  memset(log.freed[!log.curfreed], 0, sizeof(log.freed[0]));
+  release(&log.lock);
+  // The flusher writes the blocks home later.
+}
+
+// Write committed block i home, if the running transaction
+// has not changed it since. Returns 0 if it is home.
+static int
+install(int i)
+{
+  struct buf *b;
+  int blockno, gen, busy;
+
+  acquire(&log.lock);
+  blockno = log.lh.block[i];
+  gen = log.gen;
+  release(&log.lock);
+  if (blockno == 0)  // revoked
+    return 0;
+
+  b = bread(log.dev, blockno);
+  acquire(&log.lock);
+  for (busy = 0; busy < log.cur.n; busy++)
+    if (log.cur.block[busy] == blockno)
+      break;
+  busy = busy < log.cur.n;
+  release(&log.lock);
+  // Still dirty unless an earlier copy in the log
+  // was written home after this one committed.
+  if (!busy && (b->flags & B_DIRTY))
+    bwrite(b);
+  brelse(b);
+
+  acquire(&log.lock);
+  if (!busy && gen == log.gen)
+    log.home[i] = 1;
+  release(&log.lock);
+  return busy ? -1 : 0;
+}
+
+// Write home the committed blocks that have waited DIRTYAGE
+// ticks, or all of them if all is set. Returns the number
+// of blocks not home.
+static int
+flush(int all)
+{
+  int i, n, left;
+
+  left = 0;
+  acquire(&log.lock);
+  n = log.lh.n;
+  if (n * 100 > (log.size - 1) * DIRTYRATIO)
+    all = 1;
+  for (i = 0; i < n && i < log.lh.n; i++) {
+    if (log.home[i])
+      continue;
+    if (!all && ticks - log.age[i] < DIRTYAGE) {
+      left++;
+      continue;
+    }
+    release(&log.lock);
+    if (install(i) < 0)
+      left++;
+    acquire(&log.lock);
+  }
+  release(&log.lock);
+  return left;
+}
+
+// Write every committed block home and empty the log.
+// Caller has set log.emptying and no transaction is open
+// or committing, so none of the blocks can change.
+static void
+empty_log(void)
+{
+  if (flush(1) != 0)
+    panic("empty_log");
+  acquire(&log.lock);
+  log.lh.n = 0;
+  log.gen++;
+  release(&log.lock);
+  write_head();
+}
+
+// Flusher kernel thread: once a tick, write home committed
+// blocks that are old enough, and empty the log when they
+// are all home and no transaction is running.
+static void
+flusher(void)
+{
+  for (;;) {
+    acquire(&tickslock);
+    sleep(&ticks, &tickslock);
+    release(&tickslock);
+
+    if (flush(0) != 0)
+      continue;
+    acquire(&log.lock);
+    if (log.lh.n == 0 || log.outstanding > 0 || log.cur.n > 0 ||
+       log.committing || log.emptying) {
+      release(&log.lock);
+      continue;
+    }
+    log.emptying = 1;
+    release(&log.lock);
+    empty_log();
+    acquire(&log.lock);
+    log.emptying = 0;
+    wakeup(&log);
+    release(&log.lock);
   }
 }
 
 // Caller has modified b->data and is done with the buffer.
 // Record the block number and pin in the cache with B_DIRTY.
-// commit()/write_log() will do the disk write.
+// commit()/write_log() will write it to the log, and the
+// flusher home.
 //
 // log_write() replaces bwrite(); a typical use is:
 //   bp = bread(...)
@@ -215,20 +436,66 @@ log_write(struct buf *b)
 {
   int i;
 
-  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+  if (log.lh.n + log.com.n + log.cur.n >= LOGSIZE ||
+      log.lh.n + log.com.n + log.cur.n >= log.size - 1)
     panic("too big a transaction");
   if (log.outstanding < 1)
     panic("log_write outside of trans");
 
   acquire(&log.lock);
-  for (i = 0; i < log.lh.n; i++) {
-    if (log.lh.block[i] == b->blockno)   // log absorbtion
+  for (i = 0; i < log.cur.n; i++) {
+    if (log.cur.block[i] == b->blockno)   // log absorbtion
       break;
   }
-  log.lh.block[i] = b->blockno;
-  if (i == log.lh.n)
-    log.lh.n++;
+  log.cur.block[i] = b->blockno;
+  if (i == log.cur.n)
+    log.cur.n++;
   b->flags |= B_DIRTY; // prevent eviction
   release(&log.lock);
 }
 
+// Note that the open transaction freed block b.
+void
+log_freed(uint b)
+{
+  if (b >= FSSIZE)
+    panic("log_freed");
+  acquire(&log.lock);
+  log.freed[log.curfreed][b/8] |= 1 << (b%8);
+  release(&log.lock);
+}
+
+// Return whether free block b may be allocated: its
+// freeing has committed.
+int
+log_reusable(uint b)
+{
+  int m, r;
+
+  if (b >= FSSIZE)
+    return 1;
+  m = 1 << (b%8);
+  acquire(&log.lock);
+  r = ((log.freed[0][b/8] | log.freed[1][b/8]) & m) == 0;
+  release(&log.lock);
+  return r;
+}
+
+// Block b, freed, is being allocated again. Drop committed
+// copies of it from the log, so that recovery cannot write
+// them over b's new contents. The next commit writes the
+// header without them, before the allocation counts.
+void
+log_revoke(uint b)
+{
+  int i;
+
+  acquire(&log.lock);
+  for (i = 0; i < log.lh.n; i++) {
+    if (log.lh.block[i] == b) {
+      log.lh.block[i] = 0;
+      log.home[i] = 1;
+    }
+  }
+  release(&log.lock);
+}
@@ -0,0 +1,1881 @@
+
+_logbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return uptime() - start;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 03 00 00 00       	mov    $0x3,%esi
+  14:	53                   	push   %ebx
+  int n, ticks, ops;
+
+  for(n = 1; n <= MAXWRITER; n *= 2){
+  15:	bb 01 00 00 00       	mov    $0x1,%ebx
+{
+  1a:	51                   	push   %ecx
+  1b:	83 ec 08             	sub    $0x8,%esp
+    ticks = run(n);
+  1e:	83 ec 0c             	sub    $0xc,%esp
+    // create, NBLK writes and unlink for each file
+    ops = n * NCREATE * (NBLK + 2);
+  21:	69 fb 20 03 00 00    	imul   $0x320,%ebx,%edi
+    ticks = run(n);
+  27:	53                   	push   %ebx
+  28:	e8 23 01 00 00       	call   150 <run>
+    printf(1, "%d writers: %d ops in %d ticks, %d ops/100 ticks\n",
+           n, ops, ticks, ops * 100 / (ticks ? ticks : 1));
+  2d:	83 c4 10             	add    $0x10,%esp
+    ticks = run(n);
+  30:	89 c1                	mov    %eax,%ecx
+           n, ops, ticks, ops * 100 / (ticks ? ticks : 1));
+  32:	69 c3 80 38 01 00    	imul   $0x13880,%ebx,%eax
+  38:	85 c9                	test   %ecx,%ecx
+  3a:	74 03                	je     3f <main+0x3f>
+    printf(1, "%d writers: %d ops in %d ticks, %d ops/100 ticks\n",
+  3c:	99                   	cltd
+  3d:	f7 f9                	idiv   %ecx
+  3f:	83 ec 08             	sub    $0x8,%esp
+  42:	50                   	push   %eax
+  43:	51                   	push   %ecx
+  44:	57                   	push   %edi
+  45:	53                   	push   %ebx
+  for(n = 1; n <= MAXWRITER; n *= 2){
+  46:	01 db                	add    %ebx,%ebx
+    printf(1, "%d writers: %d ops in %d ticks, %d ops/100 ticks\n",
+  48:	68 fc 0c 00 00       	push   $0xcfc
+  4d:	6a 01                	push   $0x1
+  4f:	e8 9c 05 00 00       	call   5f0 <printf>
+  for(n = 1; n <= MAXWRITER; n *= 2){
+  54:	83 c4 20             	add    $0x20,%esp
+  57:	83 ee 01             	sub    $0x1,%esi
+  5a:	75 c2                	jne    1e <main+0x1e>
+  }
+  exit();
+  5c:	e8 e2 03 00 00       	call   443 <exit>
+  61:	66 90                	xchg   %ax,%ax
+  63:	66 90                	xchg   %ax,%ax
+  65:	66 90                	xchg   %ax,%ax
+  67:	66 90                	xchg   %ax,%ax
+  69:	66 90                	xchg   %ax,%ax
+  6b:	66 90                	xchg   %ax,%ax
+  6d:	66 90                	xchg   %ax,%ax
+  6f:	90                   	nop
+
+00000070 <writer>:
+{
+  70:	55                   	push   %ebp
+  71:	89 e5                	mov    %esp,%ebp
+  73:	57                   	push   %edi
+  for(i = 0; i < NCREATE; i++){
+  74:	31 ff                	xor    %edi,%edi
+{
+  76:	56                   	push   %esi
+  77:	8d 75 dd             	lea    -0x23(%ebp),%esi
+  7a:	53                   	push   %ebx
+  7b:	83 ec 20             	sub    $0x20,%esp
+  7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  char path[] = "logbench00";
+  81:	c7 45 e1 65 6e 63 68 	movl   $0x68636e65,-0x1f(%ebp)
+  88:	c7 45 dd 6c 6f 67 62 	movl   $0x62676f6c,-0x23(%ebp)
+  path[8] += id;
+  8f:	8d 50 30             	lea    0x30(%eax),%edx
+  memset(data, 'a' + id, sizeof(data));
+  92:	83 c0 61             	add    $0x61,%eax
+  char path[] = "logbench00";
+  95:	c7 45 e4 68 30 30 00 	movl   $0x303068,-0x1c(%ebp)
+  path[8] += id;
+  9c:	88 55 e5             	mov    %dl,-0x1b(%ebp)
+  memset(data, 'a' + id, sizeof(data));
+  9f:	68 00 02 00 00       	push   $0x200
+  a4:	50                   	push   %eax
+  a5:	68 20 11 00 00       	push   $0x1120
+  aa:	e8 d1 01 00 00       	call   280 <memset>
+  af:	83 c4 10             	add    $0x10,%esp
+  b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    path[9] = '0' + i % 10;
+  b8:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+    if((fd = open(path, O_CREATE | O_RDWR)) < 0){
+  bd:	83 ec 08             	sub    $0x8,%esp
+    path[9] = '0' + i % 10;
+  c0:	f7 e7                	mul    %edi
+  c2:	89 f8                	mov    %edi,%eax
+  c4:	c1 ea 03             	shr    $0x3,%edx
+  c7:	8d 14 92             	lea    (%edx,%edx,4),%edx
+  ca:	01 d2                	add    %edx,%edx
+  cc:	29 d0                	sub    %edx,%eax
+  ce:	83 c0 30             	add    $0x30,%eax
+  d1:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    if((fd = open(path, O_CREATE | O_RDWR)) < 0){
+  d4:	68 02 02 00 00       	push   $0x202
+  d9:	56                   	push   %esi
+  da:	e8 a4 03 00 00       	call   483 <open>
+  df:	83 c4 10             	add    $0x10,%esp
+  e2:	89 c3                	mov    %eax,%ebx
+  e4:	85 c0                	test   %eax,%eax
+  e6:	78 4c                	js     134 <writer+0xc4>
+      write(fd, data, sizeof(data));
+  e8:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < NCREATE; i++){
+  eb:	83 c7 01             	add    $0x1,%edi
+      write(fd, data, sizeof(data));
+  ee:	68 00 02 00 00       	push   $0x200
+  f3:	68 20 11 00 00       	push   $0x1120
+  f8:	50                   	push   %eax
+  f9:	e8 65 03 00 00       	call   463 <write>
+  fe:	83 c4 0c             	add    $0xc,%esp
+ 101:	68 00 02 00 00       	push   $0x200
+ 106:	68 20 11 00 00       	push   $0x1120
+ 10b:	53                   	push   %ebx
+ 10c:	e8 52 03 00 00       	call   463 <write>
+    close(fd);
+ 111:	89 1c 24             	mov    %ebx,(%esp)
+ 114:	e8 52 03 00 00       	call   46b <close>
+    unlink(path);
+ 119:	89 34 24             	mov    %esi,(%esp)
+ 11c:	e8 72 03 00 00       	call   493 <unlink>
+  for(i = 0; i < NCREATE; i++){
+ 121:	83 c4 10             	add    $0x10,%esp
+ 124:	81 ff c8 00 00 00    	cmp    $0xc8,%edi
+ 12a:	75 8c                	jne    b8 <writer+0x48>
+}
+ 12c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 12f:	5b                   	pop    %ebx
+ 130:	5e                   	pop    %esi
+ 131:	5f                   	pop    %edi
+ 132:	5d                   	pop    %ebp
+ 133:	c3                   	ret
+      printf(1, "logbench: cannot create %s\n", path);
+ 134:	83 ec 04             	sub    $0x4,%esp
+ 137:	56                   	push   %esi
+ 138:	68 e0 0c 00 00       	push   $0xce0
+ 13d:	6a 01                	push   $0x1
+ 13f:	e8 ac 04 00 00       	call   5f0 <printf>
+      exit();
+ 144:	e8 fa 02 00 00       	call   443 <exit>
+ 149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <run>:
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	57                   	push   %edi
+ 154:	56                   	push   %esi
+ 155:	53                   	push   %ebx
+ 156:	83 ec 0c             	sub    $0xc,%esp
+ 159:	8b 75 08             	mov    0x8(%ebp),%esi
+  start = uptime();
+ 15c:	e8 7a 03 00 00       	call   4db <uptime>
+ 161:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < nwriter; i++){
+ 163:	85 f6                	test   %esi,%esi
+ 165:	7e 2f                	jle    196 <run+0x46>
+ 167:	31 db                	xor    %ebx,%ebx
+ 169:	eb 07                	jmp    172 <run+0x22>
+ 16b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 16f:	90                   	nop
+ 170:	89 c3                	mov    %eax,%ebx
+    if(fork() == 0){
+ 172:	e8 c4 02 00 00       	call   43b <fork>
+ 177:	85 c0                	test   %eax,%eax
+ 179:	74 2a                	je     1a5 <run+0x55>
+  for(i = 0; i < nwriter; i++){
+ 17b:	8d 43 01             	lea    0x1(%ebx),%eax
+ 17e:	39 c6                	cmp    %eax,%esi
+ 180:	75 ee                	jne    170 <run+0x20>
+  for(i = 0; i < nwriter; i++)
+ 182:	31 f6                	xor    %esi,%esi
+ 184:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    wait();
+ 188:	e8 be 02 00 00       	call   44b <wait>
+  for(i = 0; i < nwriter; i++)
+ 18d:	89 f0                	mov    %esi,%eax
+ 18f:	83 c6 01             	add    $0x1,%esi
+ 192:	39 c3                	cmp    %eax,%ebx
+ 194:	75 f2                	jne    188 <run+0x38>
+  return uptime() - start;
+ 196:	e8 40 03 00 00       	call   4db <uptime>
+}
+ 19b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 19e:	5b                   	pop    %ebx
+  return uptime() - start;
+ 19f:	29 f8                	sub    %edi,%eax
+}
+ 1a1:	5e                   	pop    %esi
+ 1a2:	5f                   	pop    %edi
+ 1a3:	5d                   	pop    %ebp
+ 1a4:	c3                   	ret
+      writer(i);
+ 1a5:	83 ec 0c             	sub    $0xc,%esp
+ 1a8:	53                   	push   %ebx
+ 1a9:	e8 c2 fe ff ff       	call   70 <writer>
+      exit();
+ 1ae:	e8 90 02 00 00       	call   443 <exit>
+ 1b3:	66 90                	xchg   %ax,%ax
+ 1b5:	66 90                	xchg   %ax,%ax
+ 1b7:	66 90                	xchg   %ax,%ax
+ 1b9:	66 90                	xchg   %ax,%ax
+ 1bb:	66 90                	xchg   %ax,%ax
+ 1bd:	66 90                	xchg   %ax,%ax
+ 1bf:	90                   	nop
+
+000001c0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1c0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1c1:	31 c0                	xor    %eax,%eax
+{
+ 1c3:	89 e5                	mov    %esp,%ebp
+ 1c5:	53                   	push   %ebx
+ 1c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1d7:	83 c0 01             	add    $0x1,%eax
+ 1da:	84 d2                	test   %dl,%dl
+ 1dc:	75 f2                	jne    1d0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1e1:	89 c8                	mov    %ecx,%eax
+ 1e3:	c9                   	leave
+ 1e4:	c3                   	ret
+ 1e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	53                   	push   %ebx
+ 1f4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1fa:	0f b6 02             	movzbl (%edx),%eax
+ 1fd:	84 c0                	test   %al,%al
+ 1ff:	75 17                	jne    218 <strcmp+0x28>
+ 201:	eb 3a                	jmp    23d <strcmp+0x4d>
+ 203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 207:	90                   	nop
+ 208:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 20c:	83 c2 01             	add    $0x1,%edx
+ 20f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 212:	84 c0                	test   %al,%al
+ 214:	74 1a                	je     230 <strcmp+0x40>
+    p++, q++;
+ 216:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 218:	0f b6 19             	movzbl (%ecx),%ebx
+ 21b:	38 c3                	cmp    %al,%bl
+ 21d:	74 e9                	je     208 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 21f:	29 d8                	sub    %ebx,%eax
+}
+ 221:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 224:	c9                   	leave
+ 225:	c3                   	ret
+ 226:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 230:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 234:	31 c0                	xor    %eax,%eax
+ 236:	29 d8                	sub    %ebx,%eax
+}
+ 238:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 23b:	c9                   	leave
+ 23c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 23d:	0f b6 19             	movzbl (%ecx),%ebx
+ 240:	31 c0                	xor    %eax,%eax
+ 242:	eb db                	jmp    21f <strcmp+0x2f>
+ 244:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 24f:	90                   	nop
+
+00000250 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 256:	80 3a 00             	cmpb   $0x0,(%edx)
+ 259:	74 15                	je     270 <strlen+0x20>
+ 25b:	31 c0                	xor    %eax,%eax
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+ 260:	83 c0 01             	add    $0x1,%eax
+ 263:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 267:	89 c1                	mov    %eax,%ecx
+ 269:	75 f5                	jne    260 <strlen+0x10>
+    ;
+  return n;
+}
+ 26b:	89 c8                	mov    %ecx,%eax
+ 26d:	5d                   	pop    %ebp
+ 26e:	c3                   	ret
+ 26f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 270:	31 c9                	xor    %ecx,%ecx
+}
+ 272:	5d                   	pop    %ebp
+ 273:	89 c8                	mov    %ecx,%eax
+ 275:	c3                   	ret
+ 276:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000280 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	57                   	push   %edi
+ 284:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 287:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 28a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 28d:	89 d7                	mov    %edx,%edi
+ 28f:	fc                   	cld
+ 290:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 292:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 295:	89 d0                	mov    %edx,%eax
+ 297:	c9                   	leave
+ 298:	c3                   	ret
+ 299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2aa:	0f b6 10             	movzbl (%eax),%edx
+ 2ad:	84 d2                	test   %dl,%dl
+ 2af:	75 12                	jne    2c3 <strchr+0x23>
+ 2b1:	eb 1d                	jmp    2d0 <strchr+0x30>
+ 2b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2b7:	90                   	nop
+ 2b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2bc:	83 c0 01             	add    $0x1,%eax
+ 2bf:	84 d2                	test   %dl,%dl
+ 2c1:	74 0d                	je     2d0 <strchr+0x30>
+    if(*s == c)
+ 2c3:	38 d1                	cmp    %dl,%cl
+ 2c5:	75 f1                	jne    2b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2c7:	5d                   	pop    %ebp
+ 2c8:	c3                   	ret
+ 2c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2d0:	31 c0                	xor    %eax,%eax
+}
+ 2d2:	5d                   	pop    %ebp
+ 2d3:	c3                   	ret
+ 2d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2df:	90                   	nop
+
+000002e0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	57                   	push   %edi
+ 2e4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2e5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2e8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2e9:	31 db                	xor    %ebx,%ebx
+{
+ 2eb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2ee:	eb 27                	jmp    317 <gets+0x37>
+    cc = read(0, &c, 1);
+ 2f0:	83 ec 04             	sub    $0x4,%esp
+ 2f3:	6a 01                	push   $0x1
+ 2f5:	56                   	push   %esi
+ 2f6:	6a 00                	push   $0x0
+ 2f8:	e8 5e 01 00 00       	call   45b <read>
+    if(cc < 1)
+ 2fd:	83 c4 10             	add    $0x10,%esp
+ 300:	85 c0                	test   %eax,%eax
+ 302:	7e 1d                	jle    321 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 304:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 308:	8b 55 08             	mov    0x8(%ebp),%edx
+ 30b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 30f:	3c 0a                	cmp    $0xa,%al
+ 311:	74 10                	je     323 <gets+0x43>
+ 313:	3c 0d                	cmp    $0xd,%al
+ 315:	74 0c                	je     323 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 317:	89 df                	mov    %ebx,%edi
+ 319:	83 c3 01             	add    $0x1,%ebx
+ 31c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 31f:	7c cf                	jl     2f0 <gets+0x10>
+ 321:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 323:	8b 45 08             	mov    0x8(%ebp),%eax
+ 326:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 32a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 32d:	5b                   	pop    %ebx
+ 32e:	5e                   	pop    %esi
+ 32f:	5f                   	pop    %edi
+ 330:	5d                   	pop    %ebp
+ 331:	c3                   	ret
+ 332:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 339:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000340 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	56                   	push   %esi
+ 344:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 345:	83 ec 08             	sub    $0x8,%esp
+ 348:	6a 00                	push   $0x0
+ 34a:	ff 75 08             	push   0x8(%ebp)
+ 34d:	e8 31 01 00 00       	call   483 <open>
+  if(fd < 0)
+ 352:	83 c4 10             	add    $0x10,%esp
+ 355:	85 c0                	test   %eax,%eax
+ 357:	78 27                	js     380 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 359:	83 ec 08             	sub    $0x8,%esp
+ 35c:	ff 75 0c             	push   0xc(%ebp)
+ 35f:	89 c3                	mov    %eax,%ebx
+ 361:	50                   	push   %eax
+ 362:	e8 34 01 00 00       	call   49b <fstat>
+  close(fd);
+ 367:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 36a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 36c:	e8 fa 00 00 00       	call   46b <close>
+  return r;
+ 371:	83 c4 10             	add    $0x10,%esp
+}
+ 374:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 377:	89 f0                	mov    %esi,%eax
+ 379:	5b                   	pop    %ebx
+ 37a:	5e                   	pop    %esi
+ 37b:	5d                   	pop    %ebp
+ 37c:	c3                   	ret
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 380:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 385:	eb ed                	jmp    374 <stat+0x34>
+ 387:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38e:	66 90                	xchg   %ax,%ax
+
+00000390 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	53                   	push   %ebx
+ 394:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 397:	0f be 02             	movsbl (%edx),%eax
+ 39a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 39d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3a5:	77 1e                	ja     3c5 <atoi+0x35>
+ 3a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3b0:	83 c2 01             	add    $0x1,%edx
+ 3b3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3b6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3ba:	0f be 02             	movsbl (%edx),%eax
+ 3bd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3c0:	80 fb 09             	cmp    $0x9,%bl
+ 3c3:	76 eb                	jbe    3b0 <atoi+0x20>
+  return n;
+}
+ 3c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3c8:	89 c8                	mov    %ecx,%eax
+ 3ca:	c9                   	leave
+ 3cb:	c3                   	ret
+ 3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	57                   	push   %edi
+ 3d4:	56                   	push   %esi
+ 3d5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3de:	85 c0                	test   %eax,%eax
+ 3e0:	7e 13                	jle    3f5 <memmove+0x25>
+ 3e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3e4:	89 d7                	mov    %edx,%edi
+ 3e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3f1:	39 f8                	cmp    %edi,%eax
+ 3f3:	75 fb                	jne    3f0 <memmove+0x20>
+  return vdst;
+}
+ 3f5:	5e                   	pop    %esi
+ 3f6:	89 d0                	mov    %edx,%eax
+ 3f8:	5f                   	pop    %edi
+ 3f9:	5d                   	pop    %ebp
+ 3fa:	c3                   	ret
+
+000003fb <ccreate>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(ccreate)
+ 3fb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <cfork>:
+SYSCALL(cfork)
+ 403:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <cgetrootdir>:
+SYSCALL(cgetrootdir)
+ 40b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <getcontrootdir>:
+SYSCALL(getcontrootdir)
+ 413:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <cpause>:
+SYSCALL(cpause)
+ 41b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <cresume>:
+SYSCALL(cresume)
+ 423:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <cstart>:
+SYSCALL(cstart)
+ 42b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <cstop>:
+SYSCALL(cstop)
+ 433:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <fork>:
+SYSCALL(fork)
+ 43b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <exit>:
+SYSCALL(exit)
+ 443:	b8 02 00 00 00       	mov    $0x2,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <wait>:
+SYSCALL(wait)
+ 44b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <pipe>:
+SYSCALL(pipe)
+ 453:	b8 04 00 00 00       	mov    $0x4,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <read>:
+SYSCALL(read)
+ 45b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <write>:
+SYSCALL(write)
+ 463:	b8 10 00 00 00       	mov    $0x10,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <close>:
+SYSCALL(close)
+ 46b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <kill>:
+SYSCALL(kill)
+ 473:	b8 06 00 00 00       	mov    $0x6,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <exec>:
+SYSCALL(exec)
+ 47b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <open>:
+SYSCALL(open)
+ 483:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <mknod>:
+SYSCALL(mknod)
+ 48b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <unlink>:
+SYSCALL(unlink)
+ 493:	b8 12 00 00 00       	mov    $0x12,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <fstat>:
+SYSCALL(fstat)
+ 49b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <link>:
+SYSCALL(link)
+ 4a3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <mkdir>:
+SYSCALL(mkdir)
+ 4ab:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <chdir>:
+SYSCALL(chdir)
+ 4b3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <dup>:
+SYSCALL(dup)
+ 4bb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <getpid>:
+SYSCALL(getpid)
+ 4c3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <sbrk>:
+SYSCALL(sbrk)
+ 4cb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <sleep>:
+SYSCALL(sleep)
+ 4d3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <uptime>:
+SYSCALL(uptime)
+ 4db:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <cps>:
+SYSCALL(cps)
+ 4e3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <mmap>:
+SYSCALL(mmap)
+ 4eb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <munmap>:
+SYSCALL(munmap)
+ 4f3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <shmget>:
+SYSCALL(shmget)
+ 4fb:	b8 21 00 00 00       	mov    $0x21,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <climit>:
+SYSCALL(climit)
+ 503:	b8 22 00 00 00       	mov    $0x22,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <spawn>:
+SYSCALL(spawn)
+ 50b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <clone>:
+SYSCALL(clone)
+ 513:	b8 24 00 00 00       	mov    $0x24,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <join>:
+SYSCALL(join)
+ 51b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <futex>:
+SYSCALL(futex)
+ 523:	b8 26 00 00 00       	mov    $0x26,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <ccheckpoint>:
+SYSCALL(ccheckpoint)
+ 52b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <crestore>:
+SYSCALL(crestore)
+ 533:	b8 28 00 00 00       	mov    $0x28,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <czygote>:
+SYSCALL(czygote)
+ 53b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <memstats>:
+SYSCALL(memstats)
+ 543:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+ 54b:	66 90                	xchg   %ax,%ax
+ 54d:	66 90                	xchg   %ax,%ax
+ 54f:	90                   	nop
+
+00000550 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	56                   	push   %esi
+ 555:	53                   	push   %ebx
+ 556:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 558:	89 d1                	mov    %edx,%ecx
+{
+ 55a:	83 ec 3c             	sub    $0x3c,%esp
+ 55d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 560:	85 d2                	test   %edx,%edx
+ 562:	0f 89 80 00 00 00    	jns    5e8 <printint+0x98>
+ 568:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 56c:	74 7a                	je     5e8 <printint+0x98>
+    x = -xx;
+ 56e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 570:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 575:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 578:	31 f6                	xor    %esi,%esi
+ 57a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 580:	89 c8                	mov    %ecx,%eax
+ 582:	31 d2                	xor    %edx,%edx
+ 584:	89 f7                	mov    %esi,%edi
+ 586:	f7 f3                	div    %ebx
+ 588:	8d 76 01             	lea    0x1(%esi),%esi
+ 58b:	0f b6 92 90 0d 00 00 	movzbl 0xd90(%edx),%edx
+ 592:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 596:	89 ca                	mov    %ecx,%edx
+ 598:	89 c1                	mov    %eax,%ecx
+ 59a:	39 da                	cmp    %ebx,%edx
+ 59c:	73 e2                	jae    580 <printint+0x30>
+  if(neg)
+ 59e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 5a1:	85 c0                	test   %eax,%eax
+ 5a3:	74 07                	je     5ac <printint+0x5c>
+    buf[i++] = '-';
+ 5a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5aa:	89 f7                	mov    %esi,%edi
+ 5ac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5af:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 5b2:	01 df                	add    %ebx,%edi
+ 5b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5b8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 5bb:	83 ec 04             	sub    $0x4,%esp
+ 5be:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5c1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5c4:	6a 01                	push   $0x1
+ 5c6:	50                   	push   %eax
+ 5c7:	56                   	push   %esi
+ 5c8:	e8 96 fe ff ff       	call   463 <write>
+  while(--i >= 0)
+ 5cd:	89 f8                	mov    %edi,%eax
+ 5cf:	83 c4 10             	add    $0x10,%esp
+ 5d2:	83 ef 01             	sub    $0x1,%edi
+ 5d5:	39 d8                	cmp    %ebx,%eax
+ 5d7:	75 df                	jne    5b8 <printint+0x68>
+}
+ 5d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5dc:	5b                   	pop    %ebx
+ 5dd:	5e                   	pop    %esi
+ 5de:	5f                   	pop    %edi
+ 5df:	5d                   	pop    %ebp
+ 5e0:	c3                   	ret
+ 5e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5e8:	31 c0                	xor    %eax,%eax
+ 5ea:	eb 89                	jmp    575 <printint+0x25>
+ 5ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005f0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	57                   	push   %edi
+ 5f4:	56                   	push   %esi
+ 5f5:	53                   	push   %ebx
+ 5f6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 5fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 5ff:	0f b6 1e             	movzbl (%esi),%ebx
+ 602:	83 c6 01             	add    $0x1,%esi
+ 605:	84 db                	test   %bl,%bl
+ 607:	74 67                	je     670 <printf+0x80>
+ 609:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 60c:	31 d2                	xor    %edx,%edx
+ 60e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 611:	eb 34                	jmp    647 <printf+0x57>
+ 613:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 617:	90                   	nop
+ 618:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 61b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 620:	83 f8 25             	cmp    $0x25,%eax
+ 623:	74 18                	je     63d <printf+0x4d>
+  write(fd, &c, 1);
+ 625:	83 ec 04             	sub    $0x4,%esp
+ 628:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 62b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 62e:	6a 01                	push   $0x1
+ 630:	50                   	push   %eax
+ 631:	57                   	push   %edi
+ 632:	e8 2c fe ff ff       	call   463 <write>
+ 637:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 63a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 63d:	0f b6 1e             	movzbl (%esi),%ebx
+ 640:	83 c6 01             	add    $0x1,%esi
+ 643:	84 db                	test   %bl,%bl
+ 645:	74 29                	je     670 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 647:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 64a:	85 d2                	test   %edx,%edx
+ 64c:	74 ca                	je     618 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 64e:	83 fa 25             	cmp    $0x25,%edx
+ 651:	75 ea                	jne    63d <printf+0x4d>
+      if(c == 'd'){
+ 653:	83 f8 25             	cmp    $0x25,%eax
+ 656:	0f 84 24 01 00 00    	je     780 <printf+0x190>
+ 65c:	83 e8 63             	sub    $0x63,%eax
+ 65f:	83 f8 15             	cmp    $0x15,%eax
+ 662:	77 1c                	ja     680 <printf+0x90>
+ 664:	ff 24 85 38 0d 00 00 	jmp    *0xd38(,%eax,4)
+ 66b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 66f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 670:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 673:	5b                   	pop    %ebx
+ 674:	5e                   	pop    %esi
+ 675:	5f                   	pop    %edi
+ 676:	5d                   	pop    %ebp
+ 677:	c3                   	ret
+ 678:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67f:	90                   	nop
+  write(fd, &c, 1);
+ 680:	83 ec 04             	sub    $0x4,%esp
+ 683:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 686:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 68a:	6a 01                	push   $0x1
+ 68c:	52                   	push   %edx
+ 68d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 690:	57                   	push   %edi
+ 691:	e8 cd fd ff ff       	call   463 <write>
+ 696:	83 c4 0c             	add    $0xc,%esp
+ 699:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 69c:	6a 01                	push   $0x1
+ 69e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6a1:	52                   	push   %edx
+ 6a2:	57                   	push   %edi
+ 6a3:	e8 bb fd ff ff       	call   463 <write>
+        putc(fd, c);
+ 6a8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6ab:	31 d2                	xor    %edx,%edx
+ 6ad:	eb 8e                	jmp    63d <printf+0x4d>
+ 6af:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 6b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6b3:	83 ec 0c             	sub    $0xc,%esp
+ 6b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6bb:	8b 13                	mov    (%ebx),%edx
+ 6bd:	6a 00                	push   $0x0
+ 6bf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6c1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6c4:	e8 87 fe ff ff       	call   550 <printint>
+        ap++;
+ 6c9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6cc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6cf:	31 d2                	xor    %edx,%edx
+ 6d1:	e9 67 ff ff ff       	jmp    63d <printf+0x4d>
+ 6d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6dd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6e3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6e5:	83 c0 04             	add    $0x4,%eax
+ 6e8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6eb:	85 db                	test   %ebx,%ebx
+ 6ed:	0f 84 9d 00 00 00    	je     790 <printf+0x1a0>
+        while(*s != 0){
+ 6f3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 6f6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 6f8:	84 c0                	test   %al,%al
+ 6fa:	0f 84 3d ff ff ff    	je     63d <printf+0x4d>
+ 700:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 703:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 706:	89 de                	mov    %ebx,%esi
+ 708:	89 d3                	mov    %edx,%ebx
+ 70a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 710:	83 ec 04             	sub    $0x4,%esp
+ 713:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 716:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 719:	6a 01                	push   $0x1
+ 71b:	53                   	push   %ebx
+ 71c:	57                   	push   %edi
+ 71d:	e8 41 fd ff ff       	call   463 <write>
+        while(*s != 0){
+ 722:	0f b6 06             	movzbl (%esi),%eax
+ 725:	83 c4 10             	add    $0x10,%esp
+ 728:	84 c0                	test   %al,%al
+ 72a:	75 e4                	jne    710 <printf+0x120>
+      state = 0;
+ 72c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 72f:	31 d2                	xor    %edx,%edx
+ 731:	e9 07 ff ff ff       	jmp    63d <printf+0x4d>
+ 736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 740:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 743:	83 ec 0c             	sub    $0xc,%esp
+ 746:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 74b:	8b 13                	mov    (%ebx),%edx
+ 74d:	6a 01                	push   $0x1
+ 74f:	e9 6b ff ff ff       	jmp    6bf <printf+0xcf>
+ 754:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 758:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 75b:	83 ec 04             	sub    $0x4,%esp
+ 75e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 761:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 763:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 766:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 769:	6a 01                	push   $0x1
+ 76b:	52                   	push   %edx
+ 76c:	57                   	push   %edi
+ 76d:	e8 f1 fc ff ff       	call   463 <write>
+        ap++;
+ 772:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 775:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 778:	31 d2                	xor    %edx,%edx
+ 77a:	e9 be fe ff ff       	jmp    63d <printf+0x4d>
+ 77f:	90                   	nop
+  write(fd, &c, 1);
+ 780:	83 ec 04             	sub    $0x4,%esp
+ 783:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 786:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 789:	6a 01                	push   $0x1
+ 78b:	e9 11 ff ff ff       	jmp    6a1 <printf+0xb1>
+ 790:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 795:	bb 2e 0d 00 00       	mov    $0xd2e,%ebx
+ 79a:	e9 61 ff ff ff       	jmp    700 <printf+0x110>
+ 79f:	90                   	nop
+
+000007a0 <runfree>:
+
+// Give the n pages at r back to the free runs, merging them with
+// adjacent runs, and shrink the heap if the end of it is free.
+static void
+runfree(struct page *r, uint n)
+{
+ 7a0:	55                   	push   %ebp
+  struct page **pp, *prev;
+
+  r->kind = PFREE;
+ 7a1:	b9 03 00 00 00       	mov    $0x3,%ecx
+{
+ 7a6:	89 e5                	mov    %esp,%ebp
+ 7a8:	57                   	push   %edi
+ 7a9:	56                   	push   %esi
+ 7aa:	53                   	push   %ebx
+ 7ab:	89 c3                	mov    %eax,%ebx
+ 7ad:	83 ec 0c             	sub    $0xc,%esp
+  r->kind = PFREE;
+ 7b0:	66 89 08             	mov    %cx,(%eax)
+  r->npages = n;
+  prev = 0;
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 7b3:	8b 0d 24 13 00 00    	mov    0x1324,%ecx
+  r->npages = n;
+ 7b9:	89 50 04             	mov    %edx,0x4(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 7bc:	85 c9                	test   %ecx,%ecx
+ 7be:	0f 84 1f 01 00 00    	je     8e3 <runfree+0x143>
+ 7c4:	39 c1                	cmp    %eax,%ecx
+ 7c6:	0f 83 f7 00 00 00    	jae    8c3 <runfree+0x123>
+ 7cc:	89 c8                	mov    %ecx,%eax
+ 7ce:	eb 04                	jmp    7d4 <runfree+0x34>
+ 7d0:	39 d8                	cmp    %ebx,%eax
+ 7d2:	73 09                	jae    7dd <runfree+0x3d>
+ 7d4:	89 c2                	mov    %eax,%edx
+ 7d6:	8b 40 14             	mov    0x14(%eax),%eax
+ 7d9:	85 c0                	test   %eax,%eax
+ 7db:	75 f3                	jne    7d0 <runfree+0x30>
+    prev = *pp;
+  r->next = *pp;
+ 7dd:	89 43 14             	mov    %eax,0x14(%ebx)
+  *pp = r;
+ 7e0:	89 5a 14             	mov    %ebx,0x14(%edx)
+
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 7e3:	8b 43 14             	mov    0x14(%ebx),%eax
+ 7e6:	85 c0                	test   %eax,%eax
+ 7e8:	74 12                	je     7fc <runfree+0x5c>
+ 7ea:	8b 7b 04             	mov    0x4(%ebx),%edi
+ 7ed:	89 fe                	mov    %edi,%esi
+ 7ef:	c1 e6 0c             	shl    $0xc,%esi
+ 7f2:	01 de                	add    %ebx,%esi
+ 7f4:	39 f0                	cmp    %esi,%eax
+ 7f6:	0f 84 a4 00 00 00    	je     8a0 <runfree+0x100>
+    r->npages += r->next->npages;
+    r->next = r->next->next;
+  }
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 7fc:	8b 72 04             	mov    0x4(%edx),%esi
+ 7ff:	89 f0                	mov    %esi,%eax
+ 801:	c1 e0 0c             	shl    $0xc,%eax
+ 804:	01 d0                	add    %edx,%eax
+ 806:	39 c3                	cmp    %eax,%ebx
+ 808:	74 16                	je     820 <runfree+0x80>
+    pp = &runs;
+    while(*pp != r)
+      pp = &(*pp)->next;
+  }
+
+  if(r->next == 0 && r->npages >= TRIM &&
+ 80a:	8b 43 14             	mov    0x14(%ebx),%eax
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 80d:	8d 72 14             	lea    0x14(%edx),%esi
+  if(r->next == 0 && r->npages >= TRIM &&
+ 810:	85 c0                	test   %eax,%eax
+ 812:	74 3c                	je     850 <runfree+0xb0>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+    *pp = 0;
+    sbrk(-(int)(r->npages*PGSIZE));
+    heapend = (char*)r;
+  }
+}
+ 814:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 817:	5b                   	pop    %ebx
+ 818:	5e                   	pop    %esi
+ 819:	5f                   	pop    %edi
+ 81a:	5d                   	pop    %ebp
+ 81b:	c3                   	ret
+ 81c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    prev->npages += r->npages;
+ 820:	03 73 04             	add    0x4(%ebx),%esi
+ 823:	89 72 04             	mov    %esi,0x4(%edx)
+    prev->next = r->next;
+ 826:	8b 43 14             	mov    0x14(%ebx),%eax
+ 829:	89 42 14             	mov    %eax,0x14(%edx)
+    while(*pp != r)
+ 82c:	39 d1                	cmp    %edx,%ecx
+ 82e:	0f 84 c5 00 00 00    	je     8f9 <runfree+0x159>
+ 834:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      pp = &(*pp)->next;
+ 838:	89 cb                	mov    %ecx,%ebx
+ 83a:	8b 49 14             	mov    0x14(%ecx),%ecx
+    while(*pp != r)
+ 83d:	39 d1                	cmp    %edx,%ecx
+ 83f:	75 f7                	jne    838 <runfree+0x98>
+      pp = &(*pp)->next;
+ 841:	8d 73 14             	lea    0x14(%ebx),%esi
+ 844:	89 cb                	mov    %ecx,%ebx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 846:	85 c0                	test   %eax,%eax
+ 848:	75 ca                	jne    814 <runfree+0x74>
+ 84a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 850:	8b 53 04             	mov    0x4(%ebx),%edx
+ 853:	83 fa 1f             	cmp    $0x1f,%edx
+ 856:	76 bc                	jbe    814 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 858:	c1 e2 0c             	shl    $0xc,%edx
+ 85b:	01 da                	add    %ebx,%edx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 85d:	39 15 20 13 00 00    	cmp    %edx,0x1320
+ 863:	75 af                	jne    814 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 865:	83 ec 0c             	sub    $0xc,%esp
+ 868:	6a 00                	push   $0x0
+ 86a:	e8 5c fc ff ff       	call   4cb <sbrk>
+ 86f:	83 c4 10             	add    $0x10,%esp
+ 872:	39 05 20 13 00 00    	cmp    %eax,0x1320
+ 878:	75 9a                	jne    814 <runfree+0x74>
+    *pp = 0;
+ 87a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    sbrk(-(int)(r->npages*PGSIZE));
+ 880:	8b 43 04             	mov    0x4(%ebx),%eax
+ 883:	83 ec 0c             	sub    $0xc,%esp
+ 886:	c1 e0 0c             	shl    $0xc,%eax
+ 889:	f7 d8                	neg    %eax
+ 88b:	50                   	push   %eax
+ 88c:	e8 3a fc ff ff       	call   4cb <sbrk>
+    heapend = (char*)r;
+ 891:	89 1d 20 13 00 00    	mov    %ebx,0x1320
+ 897:	83 c4 10             	add    $0x10,%esp
+}
+ 89a:	e9 75 ff ff ff       	jmp    814 <runfree+0x74>
+ 89f:	90                   	nop
+    r->npages += r->next->npages;
+ 8a0:	03 78 04             	add    0x4(%eax),%edi
+ 8a3:	89 7b 04             	mov    %edi,0x4(%ebx)
+    r->next = r->next->next;
+ 8a6:	8b 40 14             	mov    0x14(%eax),%eax
+ 8a9:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 8ac:	8b 72 04             	mov    0x4(%edx),%esi
+ 8af:	89 f0                	mov    %esi,%eax
+ 8b1:	c1 e0 0c             	shl    $0xc,%eax
+ 8b4:	01 d0                	add    %edx,%eax
+ 8b6:	39 c3                	cmp    %eax,%ebx
+ 8b8:	0f 85 4c ff ff ff    	jne    80a <runfree+0x6a>
+ 8be:	e9 5d ff ff ff       	jmp    820 <runfree+0x80>
+  r->next = *pp;
+ 8c3:	89 48 14             	mov    %ecx,0x14(%eax)
+  *pp = r;
+ 8c6:	a3 24 13 00 00       	mov    %eax,0x1324
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 8cb:	89 d0                	mov    %edx,%eax
+ 8cd:	c1 e0 0c             	shl    $0xc,%eax
+ 8d0:	01 d8                	add    %ebx,%eax
+ 8d2:	39 c1                	cmp    %eax,%ecx
+ 8d4:	74 2f                	je     905 <runfree+0x165>
+  if(r->next == 0 && r->npages >= TRIM &&
+ 8d6:	8b 43 14             	mov    0x14(%ebx),%eax
+ 8d9:	be 24 13 00 00       	mov    $0x1324,%esi
+ 8de:	e9 2d ff ff ff       	jmp    810 <runfree+0x70>
+  r->next = *pp;
+ 8e3:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 8ea:	be 24 13 00 00       	mov    $0x1324,%esi
+  *pp = r;
+ 8ef:	a3 24 13 00 00       	mov    %eax,0x1324
+  if(r->next == 0 && r->npages >= TRIM &&
+ 8f4:	e9 5a ff ff ff       	jmp    853 <runfree+0xb3>
+    while(*pp != r)
+ 8f9:	89 cb                	mov    %ecx,%ebx
+    pp = &runs;
+ 8fb:	be 24 13 00 00       	mov    $0x1324,%esi
+ 900:	e9 0b ff ff ff       	jmp    810 <runfree+0x70>
+    r->npages += r->next->npages;
+ 905:	03 51 04             	add    0x4(%ecx),%edx
+ 908:	89 53 04             	mov    %edx,0x4(%ebx)
+    r->next = r->next->next;
+ 90b:	8b 41 14             	mov    0x14(%ecx),%eax
+ 90e:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 911:	eb c3                	jmp    8d6 <runfree+0x136>
+ 913:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 91a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000920 <runalloc>:
+
+// Take a run of n pages from the start of the first free run
+// long enough, which keeps the end of the heap free to trim.
+static struct page*
+runalloc(uint n)
+{
+ 920:	55                   	push   %ebp
+ 921:	89 e5                	mov    %esp,%ebp
+ 923:	57                   	push   %edi
+ 924:	56                   	push   %esi
+ 925:	89 c6                	mov    %eax,%esi
+ 927:	53                   	push   %ebx
+ 928:	83 ec 1c             	sub    $0x1c,%esp
+  struct page **pp, *r, *rest;
+
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ 92b:	8b 1d 24 13 00 00    	mov    0x1324,%ebx
+ 931:	85 db                	test   %ebx,%ebx
+ 933:	74 4d                	je     982 <runalloc+0x62>
+ 935:	b9 24 13 00 00       	mov    $0x1324,%ecx
+    if(r->npages < n)
+ 93a:	39 73 04             	cmp    %esi,0x4(%ebx)
+ 93d:	72 39                	jb     978 <runalloc+0x58>
+      continue;
+    if(r->npages == n){
+ 93f:	0f 84 9b 00 00 00    	je     9e0 <runalloc+0xc0>
+      *pp = r->next;
+    } else {
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ 945:	89 f0                	mov    %esi,%eax
+      rest->kind = PFREE;
+ 947:	ba 03 00 00 00       	mov    $0x3,%edx
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ 94c:	c1 e0 0c             	shl    $0xc,%eax
+ 94f:	01 d8                	add    %ebx,%eax
+      rest->kind = PFREE;
+ 951:	66 89 10             	mov    %dx,(%eax)
+      rest->npages = r->npages - n;
+ 954:	8b 53 04             	mov    0x4(%ebx),%edx
+ 957:	29 f2                	sub    %esi,%edx
+ 959:	89 50 04             	mov    %edx,0x4(%eax)
+      rest->next = r->next;
+ 95c:	8b 53 14             	mov    0x14(%ebx),%edx
+ 95f:	89 50 14             	mov    %edx,0x14(%eax)
+      *pp = rest;
+ 962:	89 01                	mov    %eax,(%ecx)
+      r->npages = n;
+ 964:	89 73 04             	mov    %esi,0x4(%ebx)
+    }
+    return r;
+  }
+  return morecore(n);
+}
+ 967:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 96a:	89 d8                	mov    %ebx,%eax
+ 96c:	5b                   	pop    %ebx
+ 96d:	5e                   	pop    %esi
+ 96e:	5f                   	pop    %edi
+ 96f:	5d                   	pop    %ebp
+ 970:	c3                   	ret
+ 971:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ 978:	8d 4b 14             	lea    0x14(%ebx),%ecx
+ 97b:	8b 5b 14             	mov    0x14(%ebx),%ebx
+ 97e:	85 db                	test   %ebx,%ebx
+ 980:	75 b8                	jne    93a <runalloc+0x1a>
+  m = n < MINCORE ? MINCORE : n;
+ 982:	bf 08 00 00 00       	mov    $0x8,%edi
+ 987:	39 fe                	cmp    %edi,%esi
+ 989:	0f 43 fe             	cmovae %esi,%edi
+  brk = sbrk(0);
+ 98c:	83 ec 0c             	sub    $0xc,%esp
+ 98f:	6a 00                	push   $0x0
+ 991:	e8 35 fb ff ff       	call   4cb <sbrk>
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 996:	89 fa                	mov    %edi,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 998:	89 c3                	mov    %eax,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 99a:	c1 e2 0c             	shl    $0xc,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 99d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 9a0:	f7 db                	neg    %ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 9a2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 9a5:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 9ab:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+ 9ae:	89 04 24             	mov    %eax,(%esp)
+ 9b1:	e8 15 fb ff ff       	call   4cb <sbrk>
+ 9b6:	83 c4 10             	add    $0x10,%esp
+ 9b9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 9bc:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 9bf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 9c2:	74 3e                	je     a02 <runalloc+0xe2>
+  r = (struct page*)(brk + pad);
+ 9c4:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ 9c6:	01 da                	add    %ebx,%edx
+ 9c8:	89 15 20 13 00 00    	mov    %edx,0x1320
+  if(m > n)
+ 9ce:	39 fe                	cmp    %edi,%esi
+ 9d0:	72 1e                	jb     9f0 <runalloc+0xd0>
+  r->npages = n;
+ 9d2:	89 73 04             	mov    %esi,0x4(%ebx)
+  return r;
+ 9d5:	eb 90                	jmp    967 <runalloc+0x47>
+ 9d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9de:	66 90                	xchg   %ax,%ax
+      *pp = r->next;
+ 9e0:	8b 43 14             	mov    0x14(%ebx),%eax
+ 9e3:	89 01                	mov    %eax,(%ecx)
+}
+ 9e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9e8:	89 d8                	mov    %ebx,%eax
+ 9ea:	5b                   	pop    %ebx
+ 9eb:	5e                   	pop    %esi
+ 9ec:	5f                   	pop    %edi
+ 9ed:	5d                   	pop    %ebp
+ 9ee:	c3                   	ret
+ 9ef:	90                   	nop
+    runfree((struct page*)((char*)r + n*PGSIZE), m - n);
+ 9f0:	89 f0                	mov    %esi,%eax
+ 9f2:	29 f7                	sub    %esi,%edi
+ 9f4:	c1 e0 0c             	shl    $0xc,%eax
+ 9f7:	89 fa                	mov    %edi,%edx
+ 9f9:	01 d8                	add    %ebx,%eax
+ 9fb:	e8 a0 fd ff ff       	call   7a0 <runfree>
+ a00:	eb d0                	jmp    9d2 <runalloc+0xb2>
+    if(sbrk(pad + m*PGSIZE) == (char*)-1)
+ a02:	89 f7                	mov    %esi,%edi
+ a04:	83 ec 0c             	sub    $0xc,%esp
+ a07:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ a0a:	c1 e7 0c             	shl    $0xc,%edi
+ a0d:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+ a10:	50                   	push   %eax
+ a11:	e8 b5 fa ff ff       	call   4cb <sbrk>
+ a16:	83 c4 10             	add    $0x10,%esp
+ a19:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ a1c:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a1f:	74 0c                	je     a2d <runalloc+0x10d>
+  r = (struct page*)(brk + pad);
+ a21:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ a23:	01 df                	add    %ebx,%edi
+ a25:	89 3d 20 13 00 00    	mov    %edi,0x1320
+  if(m > n)
+ a2b:	eb a5                	jmp    9d2 <runalloc+0xb2>
+      return 0;
+ a2d:	31 db                	xor    %ebx,%ebx
+ a2f:	e9 33 ff ff ff       	jmp    967 <runalloc+0x47>
+ a34:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a3f:	90                   	nop
+
+00000a40 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+ a40:	55                   	push   %ebp
+ a41:	89 e5                	mov    %esp,%ebp
+ a43:	56                   	push   %esi
+ a44:	53                   	push   %ebx
+ a45:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  struct page *p;
+
+  if(ap == 0)
+ a48:	85 c9                	test   %ecx,%ecx
+ a4a:	74 1c                	je     a68 <free+0x28>
+    return;
+  p = (struct page*)((uint)ap & ~(PGSIZE-1));
+ a4c:	89 c8                	mov    %ecx,%eax
+ a4e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  switch(p->kind){
+ a53:	0f b7 10             	movzwl (%eax),%edx
+ a56:	66 83 fa 02          	cmp    $0x2,%dx
+ a5a:	74 14                	je     a70 <free+0x30>
+ a5c:	66 83 fa 04          	cmp    $0x4,%dx
+ a60:	74 66                	je     ac8 <free+0x88>
+ a62:	66 83 fa 01          	cmp    $0x1,%dx
+ a66:	74 18                	je     a80 <free+0x40>
+    break;
+  case PMAP:
+    munmap(p, p->npages*PGSIZE);
+    break;
+  }
+}
+ a68:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a6b:	5b                   	pop    %ebx
+ a6c:	5e                   	pop    %esi
+ a6d:	5d                   	pop    %ebp
+ a6e:	c3                   	ret
+ a6f:	90                   	nop
+    runfree(p, p->npages);
+ a70:	8b 50 04             	mov    0x4(%eax),%edx
+}
+ a73:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a76:	5b                   	pop    %ebx
+ a77:	5e                   	pop    %esi
+ a78:	5d                   	pop    %ebp
+    runfree(p, p->npages);
+ a79:	e9 22 fd ff ff       	jmp    7a0 <runfree>
+ a7e:	66 90                	xchg   %ax,%ax
+  b->next = p->free;
+ a80:	8b 50 0c             	mov    0xc(%eax),%edx
+ a83:	89 11                	mov    %edx,(%ecx)
+  if(p->nfree++ == 0)
+ a85:	8b 50 08             	mov    0x8(%eax),%edx
+  p->free = b;
+ a88:	89 48 0c             	mov    %ecx,0xc(%eax)
+  if(p->nfree++ == 0)
+ a8b:	8d 5a 01             	lea    0x1(%edx),%ebx
+ a8e:	89 58 08             	mov    %ebx,0x8(%eax)
+ a91:	85 d2                	test   %edx,%edx
+ a93:	74 53                	je     ae8 <free+0xa8>
+  if(p->nfree == nblocks(p->class)){
+ a95:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ a99:	8d 4e 04             	lea    0x4(%esi),%ecx
+ a9c:	ba e0 0f 00 00       	mov    $0xfe0,%edx
+ aa1:	d3 fa                	sar    %cl,%edx
+  if(p->nfree == nblocks(p->class)){
+ aa3:	39 da                	cmp    %ebx,%edx
+ aa5:	75 c1                	jne    a68 <free+0x28>
+  if(p->prev)
+ aa7:	8b 48 18             	mov    0x18(%eax),%ecx
+    p->prev->next = p->next;
+ aaa:	8b 50 14             	mov    0x14(%eax),%edx
+  if(p->prev)
+ aad:	85 c9                	test   %ecx,%ecx
+ aaf:	74 6f                	je     b20 <free+0xe0>
+    p->prev->next = p->next;
+ ab1:	89 51 14             	mov    %edx,0x14(%ecx)
+  if(p->next)
+ ab4:	85 d2                	test   %edx,%edx
+ ab6:	74 06                	je     abe <free+0x7e>
+    p->next->prev = p->prev;
+ ab8:	8b 48 18             	mov    0x18(%eax),%ecx
+ abb:	89 4a 18             	mov    %ecx,0x18(%edx)
+    runfree(p, 1);
+ abe:	ba 01 00 00 00       	mov    $0x1,%edx
+ ac3:	eb ae                	jmp    a73 <free+0x33>
+ ac5:	8d 76 00             	lea    0x0(%esi),%esi
+    munmap(p, p->npages*PGSIZE);
+ ac8:	8b 50 04             	mov    0x4(%eax),%edx
+ acb:	83 ec 08             	sub    $0x8,%esp
+ ace:	c1 e2 0c             	shl    $0xc,%edx
+ ad1:	52                   	push   %edx
+ ad2:	50                   	push   %eax
+ ad3:	e8 1b fa ff ff       	call   4f3 <munmap>
+    break;
+ ad8:	83 c4 10             	add    $0x10,%esp
+}
+ adb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ ade:	5b                   	pop    %ebx
+ adf:	5e                   	pop    %esi
+ ae0:	5d                   	pop    %ebp
+ ae1:	c3                   	ret
+ ae2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  p->next = partial[p->class];
+ ae8:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  p->prev = 0;
+ aec:	c7 40 18 00 00 00 00 	movl   $0x0,0x18(%eax)
+  p->next = partial[p->class];
+ af3:	bb 01 00 00 00       	mov    $0x1,%ebx
+ af8:	8b 14 b5 28 13 00 00 	mov    0x1328(,%esi,4),%edx
+ aff:	89 50 14             	mov    %edx,0x14(%eax)
+  if(p->next)
+ b02:	85 d2                	test   %edx,%edx
+ b04:	74 0a                	je     b10 <free+0xd0>
+    p->next->prev = p;
+ b06:	89 42 18             	mov    %eax,0x18(%edx)
+  partial[p->class] = p;
+ b09:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  if(p->nfree == nblocks(p->class)){
+ b0d:	8b 58 08             	mov    0x8(%eax),%ebx
+  partial[p->class] = p;
+ b10:	89 04 b5 28 13 00 00 	mov    %eax,0x1328(,%esi,4)
+}
+ b17:	eb 80                	jmp    a99 <free+0x59>
+ b19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ b20:	89 14 b5 28 13 00 00 	mov    %edx,0x1328(,%esi,4)
+ b27:	eb 8b                	jmp    ab4 <free+0x74>
+ b29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000b30 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ b30:	55                   	push   %ebp
+ b31:	89 e5                	mov    %esp,%ebp
+ b33:	56                   	push   %esi
+ b34:	53                   	push   %ebx
+ b35:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct page *p;
+  uint n;
+
+  if(nbytes <= MAXSMALL)
+ b38:	3d 00 04 00 00       	cmp    $0x400,%eax
+ b3d:	76 71                	jbe    bb0 <malloc+0x80>
+    return smallalloc(sizeclass(nbytes));
+  if(nbytes > 0x7fffffff)
+ b3f:	85 c0                	test   %eax,%eax
+ b41:	0f 88 d9 00 00 00    	js     c20 <malloc+0xf0>
+    return 0;
+  n = (nbytes + HDRSIZE + PGSIZE-1) / PGSIZE;
+ b47:	8d 90 1f 10 00 00    	lea    0x101f(%eax),%edx
+ b4d:	89 d3                	mov    %edx,%ebx
+ b4f:	c1 eb 0c             	shr    $0xc,%ebx
+  if(nbytes >= MAPMIN){
+ b52:	3d ff ff 00 00       	cmp    $0xffff,%eax
+ b57:	77 27                	ja     b80 <malloc+0x50>
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    if(p == MAP_FAILED)
+      return 0;
+    p->kind = PMAP;
+  } else {
+    if((p = runalloc(n)) == 0)
+ b59:	89 d8                	mov    %ebx,%eax
+ b5b:	e8 c0 fd ff ff       	call   920 <runalloc>
+ b60:	85 c0                	test   %eax,%eax
+ b62:	0f 84 b8 00 00 00    	je     c20 <malloc+0xf0>
+      return 0;
+    p->kind = PRUN;
+ b68:	ba 02 00 00 00       	mov    $0x2,%edx
+ b6d:	66 89 10             	mov    %dx,(%eax)
+  }
+  p->npages = n;
+ b70:	89 58 04             	mov    %ebx,0x4(%eax)
+  return (char*)p + HDRSIZE;
+ b73:	8d 58 20             	lea    0x20(%eax),%ebx
+}
+ b76:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ b79:	89 d8                	mov    %ebx,%eax
+ b7b:	5b                   	pop    %ebx
+ b7c:	5e                   	pop    %esi
+ b7d:	5d                   	pop    %ebp
+ b7e:	c3                   	ret
+ b7f:	90                   	nop
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+ b80:	83 ec 08             	sub    $0x8,%esp
+ b83:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+ b89:	6a 00                	push   $0x0
+ b8b:	6a ff                	push   $0xffffffff
+ b8d:	6a 22                	push   $0x22
+ b8f:	6a 03                	push   $0x3
+ b91:	52                   	push   %edx
+ b92:	6a 00                	push   $0x0
+ b94:	e8 52 f9 ff ff       	call   4eb <mmap>
+    if(p == MAP_FAILED)
+ b99:	83 c4 20             	add    $0x20,%esp
+ b9c:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b9f:	74 7f                	je     c20 <malloc+0xf0>
+    p->kind = PMAP;
+ ba1:	b9 04 00 00 00       	mov    $0x4,%ecx
+ ba6:	66 89 08             	mov    %cx,(%eax)
+ ba9:	eb c5                	jmp    b70 <malloc+0x40>
+ bab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ baf:	90                   	nop
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ bb0:	83 f8 10             	cmp    $0x10,%eax
+ bb3:	0f 86 07 01 00 00    	jbe    cc0 <malloc+0x190>
+ bb9:	31 db                	xor    %ebx,%ebx
+ bbb:	ba 10 00 00 00       	mov    $0x10,%edx
+ bc0:	83 c3 01             	add    $0x1,%ebx
+ bc3:	89 d6                	mov    %edx,%esi
+ bc5:	89 d9                	mov    %ebx,%ecx
+ bc7:	d3 e6                	shl    %cl,%esi
+ bc9:	39 c6                	cmp    %eax,%esi
+ bcb:	72 f3                	jb     bc0 <malloc+0x90>
+  if((p = partial[c]) == 0){
+ bcd:	8b 14 9d 28 13 00 00 	mov    0x1328(,%ebx,4),%edx
+ bd4:	85 d2                	test   %edx,%edx
+ bd6:	74 58                	je     c30 <malloc+0x100>
+  if((b = p->free) != 0){
+ bd8:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ bdb:	8b 4a 08             	mov    0x8(%edx),%ecx
+  if((b = p->free) != 0){
+ bde:	85 db                	test   %ebx,%ebx
+ be0:	0f 84 aa 00 00 00    	je     c90 <malloc+0x160>
+    p->free = b->next;
+ be6:	8b 03                	mov    (%ebx),%eax
+ be8:	89 42 0c             	mov    %eax,0xc(%edx)
+  if(--p->nfree == 0)
+ beb:	83 e9 01             	sub    $0x1,%ecx
+ bee:	89 4a 08             	mov    %ecx,0x8(%edx)
+ bf1:	75 83                	jne    b76 <malloc+0x46>
+  if(p->prev)
+ bf3:	8b 4a 18             	mov    0x18(%edx),%ecx
+    p->prev->next = p->next;
+ bf6:	8b 42 14             	mov    0x14(%edx),%eax
+  if(p->prev)
+ bf9:	85 c9                	test   %ecx,%ecx
+ bfb:	0f 84 cf 00 00 00    	je     cd0 <malloc+0x1a0>
+    p->prev->next = p->next;
+ c01:	89 41 14             	mov    %eax,0x14(%ecx)
+  if(p->next)
+ c04:	85 c0                	test   %eax,%eax
+ c06:	0f 84 6a ff ff ff    	je     b76 <malloc+0x46>
+    p->next->prev = p->prev;
+ c0c:	8b 52 18             	mov    0x18(%edx),%edx
+ c0f:	89 50 18             	mov    %edx,0x18(%eax)
+ c12:	e9 5f ff ff ff       	jmp    b76 <malloc+0x46>
+ c17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c1e:	66 90                	xchg   %ax,%ax
+}
+ c20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+ c23:	31 db                	xor    %ebx,%ebx
+}
+ c25:	89 d8                	mov    %ebx,%eax
+ c27:	5b                   	pop    %ebx
+ c28:	5e                   	pop    %esi
+ c29:	5d                   	pop    %ebp
+ c2a:	c3                   	ret
+ c2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c2f:	90                   	nop
+    if((p = runalloc(1)) == 0)
+ c30:	b8 01 00 00 00       	mov    $0x1,%eax
+ c35:	e8 e6 fc ff ff       	call   920 <runalloc>
+ c3a:	89 c2                	mov    %eax,%edx
+ c3c:	85 c0                	test   %eax,%eax
+ c3e:	74 e0                	je     c20 <malloc+0xf0>
+    p->kind = PSMALL;
+ c40:	b8 01 00 00 00       	mov    $0x1,%eax
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ c45:	8d 4b 04             	lea    0x4(%ebx),%ecx
+    p->class = c;
+ c48:	66 89 5a 02          	mov    %bx,0x2(%edx)
+ c4c:	0f b7 db             	movzwl %bx,%ebx
+    p->kind = PSMALL;
+ c4f:	66 89 02             	mov    %ax,(%edx)
+    p->fresh = (char*)p + HDRSIZE;
+ c52:	8d 42 20             	lea    0x20(%edx),%eax
+ c55:	89 42 10             	mov    %eax,0x10(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ c58:	b8 e0 0f 00 00       	mov    $0xfe0,%eax
+ c5d:	d3 f8                	sar    %cl,%eax
+    p->free = 0;
+ c5f:	c7 42 0c 00 00 00 00 	movl   $0x0,0xc(%edx)
+    p->nfree = nblocks(c);
+ c66:	89 42 08             	mov    %eax,0x8(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ c69:	89 c1                	mov    %eax,%ecx
+  p->next = partial[p->class];
+ c6b:	8b 04 9d 28 13 00 00 	mov    0x1328(,%ebx,4),%eax
+  p->prev = 0;
+ c72:	c7 42 18 00 00 00 00 	movl   $0x0,0x18(%edx)
+  p->next = partial[p->class];
+ c79:	89 42 14             	mov    %eax,0x14(%edx)
+  if(p->next)
+ c7c:	85 c0                	test   %eax,%eax
+ c7e:	75 20                	jne    ca0 <malloc+0x170>
+  partial[p->class] = p;
+ c80:	89 14 9d 28 13 00 00 	mov    %edx,0x1328(,%ebx,4)
+  if((b = p->free) != 0){
+ c87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c8e:	66 90                	xchg   %ax,%ax
+    b = (struct block*)p->fresh;
+ c90:	8b 5a 10             	mov    0x10(%edx),%ebx
+    p->fresh += MINSMALL << c;
+ c93:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+ c96:	89 42 10             	mov    %eax,0x10(%edx)
+ c99:	e9 4d ff ff ff       	jmp    beb <malloc+0xbb>
+ c9e:	66 90                	xchg   %ax,%ax
+    p->next->prev = p;
+ ca0:	89 50 18             	mov    %edx,0x18(%eax)
+  partial[p->class] = p;
+ ca3:	0f b7 42 02          	movzwl 0x2(%edx),%eax
+  if((b = p->free) != 0){
+ ca7:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ caa:	8b 4a 08             	mov    0x8(%edx),%ecx
+  partial[p->class] = p;
+ cad:	89 14 85 28 13 00 00 	mov    %edx,0x1328(,%eax,4)
+}
+ cb4:	e9 25 ff ff ff       	jmp    bde <malloc+0xae>
+ cb9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ cc0:	be 10 00 00 00       	mov    $0x10,%esi
+ cc5:	31 db                	xor    %ebx,%ebx
+ cc7:	e9 01 ff ff ff       	jmp    bcd <malloc+0x9d>
+ ccc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ cd0:	0f b7 4a 02          	movzwl 0x2(%edx),%ecx
+ cd4:	89 04 8d 28 13 00 00 	mov    %eax,0x1328(,%ecx,4)
+ cdb:	e9 24 ff ff ff       	jmp    c04 <malloc+0xd4>
@@ -0,0 +1,71 @@
+// Measure file system write throughput from parallel writers,
+// in the manner of usertests' fourfiles and createdelete: each
+// writer creates, writes and unlinks its own small files. Every
+// one of those is a log transaction, so the rate shows how well
+// commits of different processes are grouped and overlapped.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fs.h"
+#include "fcntl.h"
+
+#define MAXWRITER 4
+#define NCREATE     200     // files per writer
+#define NBLK      2       // blocks written per file
+
+char data[BSIZE];
+
+void
+writer(int id)
+{
+  char path[] = "logbench00";
+  int fd, i, j;
+
+  path[8] += id;
+  memset(data, 'a' + id, sizeof(data));
+  for(i = 0; i < NCREATE; i++){
+    path[9] = '0' + i % 10;
+    if((fd = open(path, O_CREATE | O_RDWR)) < 0){
+      printf(1, "logbench: cannot create %s\n", path);
+      exit();
+    }
+    for(j = 0; j < NBLK; j++)
+      write(fd, data, sizeof(data));
+    close(fd);
+    unlink(path);
+  }
+}
+
+// Run nwriter writers at once and return the ticks they took.
+int
+run(int nwriter)
+{
+  int i, start;
+
+  start = uptime();
+  for(i = 0; i < nwriter; i++){
+    if(fork() == 0){
+      writer(i);
+      exit();
+    }
+  }
+  for(i = 0; i < nwriter; i++)
+    wait();
+  return uptime() - start;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int n, ticks, ops;
+
+  for(n = 1; n <= MAXWRITER; n *= 2){
+    ticks = run(n);
+    // create, NBLK writes and unlink for each file
+    ops = n * NCREATE * (NBLK + 2);
+    printf(1, "%d writers: %d ops in %d ticks, %d ops/100 ticks\n",
+           n, ops, ticks, ops * 100 / (ticks ? ticks : 1));
+  }
+  exit();
+}
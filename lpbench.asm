@@ -0,0 +1,1823 @@
+
+_lpbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return ticks;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  int small, large;
+
+  // A region one page short of 4MB cannot hold a 4MB page.
+  small = run(LARGE - 4096);
+   f:	83 ec 0c             	sub    $0xc,%esp
+  12:	68 00 f0 3f 00       	push   $0x3ff000
+  17:	e8 54 00 00 00       	call   70 <run>
+  large = run(LARGE);
+  1c:	c7 04 24 00 00 40 00 	movl   $0x400000,(%esp)
+  small = run(LARGE - 4096);
+  23:	89 c3                	mov    %eax,%ebx
+  large = run(LARGE);
+  25:	e8 46 00 00 00       	call   70 <run>
+  printf(1, "%d random touches over %dMB: 4KB pages %d ticks, 4MB pages %d ticks\n",
+  2a:	5a                   	pop    %edx
+  2b:	59                   	pop    %ecx
+  2c:	50                   	push   %eax
+  2d:	53                   	push   %ebx
+  2e:	6a 10                	push   $0x10
+  30:	68 00 00 40 00       	push   $0x400000
+  35:	68 88 0c 00 00       	push   $0xc88
+  3a:	6a 01                	push   $0x1
+  3c:	e8 3f 05 00 00       	call   580 <printf>
+         NTOUCH, NREGION*LARGE/(1024*1024), small, large);
+  exit();
+  41:	83 c4 20             	add    $0x20,%esp
+  44:	e8 8a 03 00 00       	call   3d3 <exit>
+  49:	66 90                	xchg   %ax,%ax
+  4b:	66 90                	xchg   %ax,%ax
+  4d:	66 90                	xchg   %ax,%ax
+  4f:	90                   	nop
+
+00000050 <rand>:
+  seed = seed * 1103515245 + 12345;
+  50:	69 05 80 10 00 00 6d 	imul   $0x41c64e6d,0x1080,%eax
+  57:	4e c6 41 
+  5a:	05 39 30 00 00       	add    $0x3039,%eax
+  5f:	a3 80 10 00 00       	mov    %eax,0x1080
+  return seed >> 8;
+  64:	c1 e8 08             	shr    $0x8,%eax
+}
+  67:	c3                   	ret
+  68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6f:	90                   	nop
+
+00000070 <run>:
+{
+  70:	55                   	push   %ebp
+  71:	89 e5                	mov    %esp,%ebp
+  73:	57                   	push   %edi
+  74:	56                   	push   %esi
+  75:	8d 7d d8             	lea    -0x28(%ebp),%edi
+  78:	53                   	push   %ebx
+  79:	89 fb                	mov    %edi,%ebx
+  7b:	83 ec 2c             	sub    $0x2c,%esp
+  7e:	8b 75 08             	mov    0x8(%ebp),%esi
+    r[i] = mmap(0, size, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+  81:	83 ec 08             	sub    $0x8,%esp
+  84:	6a 00                	push   $0x0
+  86:	6a ff                	push   $0xffffffff
+  88:	6a 22                	push   $0x22
+  8a:	6a 03                	push   $0x3
+  8c:	56                   	push   %esi
+  8d:	6a 00                	push   $0x0
+  8f:	e8 e7 03 00 00       	call   47b <mmap>
+    if(r[i] == MAP_FAILED){
+  94:	83 c4 20             	add    $0x20,%esp
+    r[i] = mmap(0, size, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+  97:	89 03                	mov    %eax,(%ebx)
+    if(r[i] == MAP_FAILED){
+  99:	83 f8 ff             	cmp    $0xffffffff,%eax
+  9c:	0f 84 8c 00 00 00    	je     12e <run+0xbe>
+    memset(r[i], 1, size);  // fault everything in first
+  a2:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < NREGION; i++){
+  a5:	83 c3 04             	add    $0x4,%ebx
+    memset(r[i], 1, size);  // fault everything in first
+  a8:	56                   	push   %esi
+  a9:	6a 01                	push   $0x1
+  ab:	50                   	push   %eax
+  ac:	e8 5f 01 00 00       	call   210 <memset>
+  for(i = 0; i < NREGION; i++){
+  b1:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  b4:	83 c4 10             	add    $0x10,%esp
+  b7:	39 d8                	cmp    %ebx,%eax
+  b9:	75 c6                	jne    81 <run+0x11>
+  start = uptime();
+  bb:	e8 ab 03 00 00       	call   46b <uptime>
+  c0:	bb 00 00 40 00       	mov    $0x400000,%ebx
+  c5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  cf:	90                   	nop
+  seed = seed * 1103515245 + 12345;
+  d0:	69 05 80 10 00 00 6d 	imul   $0x41c64e6d,0x1080,%eax
+  d7:	4e c6 41 
+    r[x % NREGION][(x / NREGION) % size]++;
+  da:	31 d2                	xor    %edx,%edx
+  seed = seed * 1103515245 + 12345;
+  dc:	05 39 30 00 00       	add    $0x3039,%eax
+  e1:	a3 80 10 00 00       	mov    %eax,0x1080
+  return seed >> 8;
+  e6:	89 c1                	mov    %eax,%ecx
+    r[x % NREGION][(x / NREGION) % size]++;
+  e8:	c1 e8 0a             	shr    $0xa,%eax
+  eb:	f7 f6                	div    %esi
+  return seed >> 8;
+  ed:	c1 e9 08             	shr    $0x8,%ecx
+    r[x % NREGION][(x / NREGION) % size]++;
+  f0:	83 e1 03             	and    $0x3,%ecx
+  f3:	03 54 8d d8          	add    -0x28(%ebp,%ecx,4),%edx
+  f7:	80 02 01             	addb   $0x1,(%edx)
+  for(i = 0; i < NTOUCH; i++){
+  fa:	83 eb 01             	sub    $0x1,%ebx
+  fd:	75 d1                	jne    d0 <run+0x60>
+  ticks = uptime() - start;
+  ff:	e8 67 03 00 00       	call   46b <uptime>
+ 104:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 107:	29 c8                	sub    %ecx,%eax
+ 109:	89 c3                	mov    %eax,%ebx
+    munmap(r[i], size);
+ 10b:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < NREGION; i++)
+ 10e:	83 c7 04             	add    $0x4,%edi
+    munmap(r[i], size);
+ 111:	56                   	push   %esi
+ 112:	ff 77 fc             	push   -0x4(%edi)
+ 115:	e8 69 03 00 00       	call   483 <munmap>
+  for(i = 0; i < NREGION; i++)
+ 11a:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 11d:	83 c4 10             	add    $0x10,%esp
+ 120:	39 f8                	cmp    %edi,%eax
+ 122:	75 e7                	jne    10b <run+0x9b>
+}
+ 124:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 127:	89 d8                	mov    %ebx,%eax
+ 129:	5b                   	pop    %ebx
+ 12a:	5e                   	pop    %esi
+ 12b:	5f                   	pop    %edi
+ 12c:	5d                   	pop    %ebp
+ 12d:	c3                   	ret
+      printf(1, "lpbench: mmap failed\n");
+ 12e:	83 ec 08             	sub    $0x8,%esp
+ 131:	68 70 0c 00 00       	push   $0xc70
+ 136:	6a 01                	push   $0x1
+ 138:	e8 43 04 00 00       	call   580 <printf>
+      exit();
+ 13d:	e8 91 02 00 00       	call   3d3 <exit>
+ 142:	66 90                	xchg   %ax,%ax
+ 144:	66 90                	xchg   %ax,%ax
+ 146:	66 90                	xchg   %ax,%ax
+ 148:	66 90                	xchg   %ax,%ax
+ 14a:	66 90                	xchg   %ax,%ax
+ 14c:	66 90                	xchg   %ax,%ax
+ 14e:	66 90                	xchg   %ax,%ax
+
+00000150 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 150:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 151:	31 c0                	xor    %eax,%eax
+{
+ 153:	89 e5                	mov    %esp,%ebp
+ 155:	53                   	push   %ebx
+ 156:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 159:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 15c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 160:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 164:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 167:	83 c0 01             	add    $0x1,%eax
+ 16a:	84 d2                	test   %dl,%dl
+ 16c:	75 f2                	jne    160 <strcpy+0x10>
+    ;
+  return os;
+}
+ 16e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 171:	89 c8                	mov    %ecx,%eax
+ 173:	c9                   	leave
+ 174:	c3                   	ret
+ 175:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000180 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	53                   	push   %ebx
+ 184:	8b 55 08             	mov    0x8(%ebp),%edx
+ 187:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 18a:	0f b6 02             	movzbl (%edx),%eax
+ 18d:	84 c0                	test   %al,%al
+ 18f:	75 17                	jne    1a8 <strcmp+0x28>
+ 191:	eb 3a                	jmp    1cd <strcmp+0x4d>
+ 193:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 197:	90                   	nop
+ 198:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 19c:	83 c2 01             	add    $0x1,%edx
+ 19f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1a2:	84 c0                	test   %al,%al
+ 1a4:	74 1a                	je     1c0 <strcmp+0x40>
+    p++, q++;
+ 1a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1a8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1ab:	38 c3                	cmp    %al,%bl
+ 1ad:	74 e9                	je     198 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1af:	29 d8                	sub    %ebx,%eax
+}
+ 1b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1b4:	c9                   	leave
+ 1b5:	c3                   	ret
+ 1b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 1c4:	31 c0                	xor    %eax,%eax
+ 1c6:	29 d8                	sub    %ebx,%eax
+}
+ 1c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1cb:	c9                   	leave
+ 1cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1cd:	0f b6 19             	movzbl (%ecx),%ebx
+ 1d0:	31 c0                	xor    %eax,%eax
+ 1d2:	eb db                	jmp    1af <strcmp+0x2f>
+ 1d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1df:	90                   	nop
+
+000001e0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1e6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1e9:	74 15                	je     200 <strlen+0x20>
+ 1eb:	31 c0                	xor    %eax,%eax
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+ 1f0:	83 c0 01             	add    $0x1,%eax
+ 1f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1f7:	89 c1                	mov    %eax,%ecx
+ 1f9:	75 f5                	jne    1f0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1fb:	89 c8                	mov    %ecx,%eax
+ 1fd:	5d                   	pop    %ebp
+ 1fe:	c3                   	ret
+ 1ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 200:	31 c9                	xor    %ecx,%ecx
+}
+ 202:	5d                   	pop    %ebp
+ 203:	89 c8                	mov    %ecx,%eax
+ 205:	c3                   	ret
+ 206:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000210 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	57                   	push   %edi
+ 214:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 217:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 21a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 21d:	89 d7                	mov    %edx,%edi
+ 21f:	fc                   	cld
+ 220:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 222:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 225:	89 d0                	mov    %edx,%eax
+ 227:	c9                   	leave
+ 228:	c3                   	ret
+ 229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000230 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	8b 45 08             	mov    0x8(%ebp),%eax
+ 236:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 23a:	0f b6 10             	movzbl (%eax),%edx
+ 23d:	84 d2                	test   %dl,%dl
+ 23f:	75 12                	jne    253 <strchr+0x23>
+ 241:	eb 1d                	jmp    260 <strchr+0x30>
+ 243:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 247:	90                   	nop
+ 248:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 24c:	83 c0 01             	add    $0x1,%eax
+ 24f:	84 d2                	test   %dl,%dl
+ 251:	74 0d                	je     260 <strchr+0x30>
+    if(*s == c)
+ 253:	38 d1                	cmp    %dl,%cl
+ 255:	75 f1                	jne    248 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 257:	5d                   	pop    %ebp
+ 258:	c3                   	ret
+ 259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 260:	31 c0                	xor    %eax,%eax
+}
+ 262:	5d                   	pop    %ebp
+ 263:	c3                   	ret
+ 264:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 26f:	90                   	nop
+
+00000270 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	57                   	push   %edi
+ 274:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 275:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 278:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 279:	31 db                	xor    %ebx,%ebx
+{
+ 27b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 27e:	eb 27                	jmp    2a7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 280:	83 ec 04             	sub    $0x4,%esp
+ 283:	6a 01                	push   $0x1
+ 285:	56                   	push   %esi
+ 286:	6a 00                	push   $0x0
+ 288:	e8 5e 01 00 00       	call   3eb <read>
+    if(cc < 1)
+ 28d:	83 c4 10             	add    $0x10,%esp
+ 290:	85 c0                	test   %eax,%eax
+ 292:	7e 1d                	jle    2b1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 294:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 298:	8b 55 08             	mov    0x8(%ebp),%edx
+ 29b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 29f:	3c 0a                	cmp    $0xa,%al
+ 2a1:	74 10                	je     2b3 <gets+0x43>
+ 2a3:	3c 0d                	cmp    $0xd,%al
+ 2a5:	74 0c                	je     2b3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 2a7:	89 df                	mov    %ebx,%edi
+ 2a9:	83 c3 01             	add    $0x1,%ebx
+ 2ac:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2af:	7c cf                	jl     280 <gets+0x10>
+ 2b1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 2b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 2ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2bd:	5b                   	pop    %ebx
+ 2be:	5e                   	pop    %esi
+ 2bf:	5f                   	pop    %edi
+ 2c0:	5d                   	pop    %ebp
+ 2c1:	c3                   	ret
+ 2c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002d0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	56                   	push   %esi
+ 2d4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2d5:	83 ec 08             	sub    $0x8,%esp
+ 2d8:	6a 00                	push   $0x0
+ 2da:	ff 75 08             	push   0x8(%ebp)
+ 2dd:	e8 31 01 00 00       	call   413 <open>
+  if(fd < 0)
+ 2e2:	83 c4 10             	add    $0x10,%esp
+ 2e5:	85 c0                	test   %eax,%eax
+ 2e7:	78 27                	js     310 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2e9:	83 ec 08             	sub    $0x8,%esp
+ 2ec:	ff 75 0c             	push   0xc(%ebp)
+ 2ef:	89 c3                	mov    %eax,%ebx
+ 2f1:	50                   	push   %eax
+ 2f2:	e8 34 01 00 00       	call   42b <fstat>
+  close(fd);
+ 2f7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2fa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2fc:	e8 fa 00 00 00       	call   3fb <close>
+  return r;
+ 301:	83 c4 10             	add    $0x10,%esp
+}
+ 304:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 307:	89 f0                	mov    %esi,%eax
+ 309:	5b                   	pop    %ebx
+ 30a:	5e                   	pop    %esi
+ 30b:	5d                   	pop    %ebp
+ 30c:	c3                   	ret
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 310:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 315:	eb ed                	jmp    304 <stat+0x34>
+ 317:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31e:	66 90                	xchg   %ax,%ax
+
+00000320 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	53                   	push   %ebx
+ 324:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 327:	0f be 02             	movsbl (%edx),%eax
+ 32a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 32d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 330:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 335:	77 1e                	ja     355 <atoi+0x35>
+ 337:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 340:	83 c2 01             	add    $0x1,%edx
+ 343:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 346:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 34a:	0f be 02             	movsbl (%edx),%eax
+ 34d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 350:	80 fb 09             	cmp    $0x9,%bl
+ 353:	76 eb                	jbe    340 <atoi+0x20>
+  return n;
+}
+ 355:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 358:	89 c8                	mov    %ecx,%eax
+ 35a:	c9                   	leave
+ 35b:	c3                   	ret
+ 35c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000360 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	57                   	push   %edi
+ 364:	56                   	push   %esi
+ 365:	8b 45 10             	mov    0x10(%ebp),%eax
+ 368:	8b 55 08             	mov    0x8(%ebp),%edx
+ 36b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 36e:	85 c0                	test   %eax,%eax
+ 370:	7e 13                	jle    385 <memmove+0x25>
+ 372:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 374:	89 d7                	mov    %edx,%edi
+ 376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 380:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 381:	39 f8                	cmp    %edi,%eax
+ 383:	75 fb                	jne    380 <memmove+0x20>
+  return vdst;
+}
+ 385:	5e                   	pop    %esi
+ 386:	89 d0                	mov    %edx,%eax
+ 388:	5f                   	pop    %edi
+ 389:	5d                   	pop    %ebp
+ 38a:	c3                   	ret
+
+0000038b <ccreate>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(ccreate)
+ 38b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <cfork>:
+SYSCALL(cfork)
+ 393:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <cgetrootdir>:
+SYSCALL(cgetrootdir)
+ 39b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <getcontrootdir>:
+SYSCALL(getcontrootdir)
+ 3a3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <cpause>:
+SYSCALL(cpause)
+ 3ab:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <cresume>:
+SYSCALL(cresume)
+ 3b3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <cstart>:
+SYSCALL(cstart)
+ 3bb:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <cstop>:
+SYSCALL(cstop)
+ 3c3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <fork>:
+SYSCALL(fork)
+ 3cb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <exit>:
+SYSCALL(exit)
+ 3d3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <wait>:
+SYSCALL(wait)
+ 3db:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <pipe>:
+SYSCALL(pipe)
+ 3e3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <read>:
+SYSCALL(read)
+ 3eb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <write>:
+SYSCALL(write)
+ 3f3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <close>:
+SYSCALL(close)
+ 3fb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <kill>:
+SYSCALL(kill)
+ 403:	b8 06 00 00 00       	mov    $0x6,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <exec>:
+SYSCALL(exec)
+ 40b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <open>:
+SYSCALL(open)
+ 413:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <mknod>:
+SYSCALL(mknod)
+ 41b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <unlink>:
+SYSCALL(unlink)
+ 423:	b8 12 00 00 00       	mov    $0x12,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <fstat>:
+SYSCALL(fstat)
+ 42b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <link>:
+SYSCALL(link)
+ 433:	b8 13 00 00 00       	mov    $0x13,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <mkdir>:
+SYSCALL(mkdir)
+ 43b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <chdir>:
+SYSCALL(chdir)
+ 443:	b8 09 00 00 00       	mov    $0x9,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <dup>:
+SYSCALL(dup)
+ 44b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <getpid>:
+SYSCALL(getpid)
+ 453:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <sbrk>:
+SYSCALL(sbrk)
+ 45b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <sleep>:
+SYSCALL(sleep)
+ 463:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <uptime>:
+SYSCALL(uptime)
+ 46b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <cps>:
+SYSCALL(cps)
+ 473:	b8 16 00 00 00       	mov    $0x16,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <mmap>:
+SYSCALL(mmap)
+ 47b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <munmap>:
+SYSCALL(munmap)
+ 483:	b8 20 00 00 00       	mov    $0x20,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <shmget>:
+SYSCALL(shmget)
+ 48b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <climit>:
+SYSCALL(climit)
+ 493:	b8 22 00 00 00       	mov    $0x22,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <spawn>:
+SYSCALL(spawn)
+ 49b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <clone>:
+SYSCALL(clone)
+ 4a3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <join>:
+SYSCALL(join)
+ 4ab:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <futex>:
+SYSCALL(futex)
+ 4b3:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <ccheckpoint>:
+SYSCALL(ccheckpoint)
+ 4bb:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <crestore>:
+SYSCALL(crestore)
+ 4c3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <czygote>:
+SYSCALL(czygote)
+ 4cb:	b8 29 00 00 00       	mov    $0x29,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <memstats>:
+SYSCALL(memstats)
+ 4d3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+ 4db:	66 90                	xchg   %ax,%ax
+ 4dd:	66 90                	xchg   %ax,%ax
+ 4df:	90                   	nop
+
+000004e0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	57                   	push   %edi
+ 4e4:	56                   	push   %esi
+ 4e5:	53                   	push   %ebx
+ 4e6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 4e8:	89 d1                	mov    %edx,%ecx
+{
+ 4ea:	83 ec 3c             	sub    $0x3c,%esp
+ 4ed:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 4f0:	85 d2                	test   %edx,%edx
+ 4f2:	0f 89 80 00 00 00    	jns    578 <printint+0x98>
+ 4f8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 4fc:	74 7a                	je     578 <printint+0x98>
+    x = -xx;
+ 4fe:	f7 d9                	neg    %ecx
+    neg = 1;
+ 500:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 505:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 508:	31 f6                	xor    %esi,%esi
+ 50a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 510:	89 c8                	mov    %ecx,%eax
+ 512:	31 d2                	xor    %edx,%edx
+ 514:	89 f7                	mov    %esi,%edi
+ 516:	f7 f3                	div    %ebx
+ 518:	8d 76 01             	lea    0x1(%esi),%esi
+ 51b:	0f b6 92 2c 0d 00 00 	movzbl 0xd2c(%edx),%edx
+ 522:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 526:	89 ca                	mov    %ecx,%edx
+ 528:	89 c1                	mov    %eax,%ecx
+ 52a:	39 da                	cmp    %ebx,%edx
+ 52c:	73 e2                	jae    510 <printint+0x30>
+  if(neg)
+ 52e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 531:	85 c0                	test   %eax,%eax
+ 533:	74 07                	je     53c <printint+0x5c>
+    buf[i++] = '-';
+ 535:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 53a:	89 f7                	mov    %esi,%edi
+ 53c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 53f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 542:	01 df                	add    %ebx,%edi
+ 544:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 548:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 54b:	83 ec 04             	sub    $0x4,%esp
+ 54e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 551:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 554:	6a 01                	push   $0x1
+ 556:	50                   	push   %eax
+ 557:	56                   	push   %esi
+ 558:	e8 96 fe ff ff       	call   3f3 <write>
+  while(--i >= 0)
+ 55d:	89 f8                	mov    %edi,%eax
+ 55f:	83 c4 10             	add    $0x10,%esp
+ 562:	83 ef 01             	sub    $0x1,%edi
+ 565:	39 d8                	cmp    %ebx,%eax
+ 567:	75 df                	jne    548 <printint+0x68>
+}
+ 569:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 56c:	5b                   	pop    %ebx
+ 56d:	5e                   	pop    %esi
+ 56e:	5f                   	pop    %edi
+ 56f:	5d                   	pop    %ebp
+ 570:	c3                   	ret
+ 571:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 578:	31 c0                	xor    %eax,%eax
+ 57a:	eb 89                	jmp    505 <printint+0x25>
+ 57c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000580 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	57                   	push   %edi
+ 584:	56                   	push   %esi
+ 585:	53                   	push   %ebx
+ 586:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 589:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 58c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 58f:	0f b6 1e             	movzbl (%esi),%ebx
+ 592:	83 c6 01             	add    $0x1,%esi
+ 595:	84 db                	test   %bl,%bl
+ 597:	74 67                	je     600 <printf+0x80>
+ 599:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 59c:	31 d2                	xor    %edx,%edx
+ 59e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 5a1:	eb 34                	jmp    5d7 <printf+0x57>
+ 5a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5a7:	90                   	nop
+ 5a8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 5ab:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 5b0:	83 f8 25             	cmp    $0x25,%eax
+ 5b3:	74 18                	je     5cd <printf+0x4d>
+  write(fd, &c, 1);
+ 5b5:	83 ec 04             	sub    $0x4,%esp
+ 5b8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5bb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5be:	6a 01                	push   $0x1
+ 5c0:	50                   	push   %eax
+ 5c1:	57                   	push   %edi
+ 5c2:	e8 2c fe ff ff       	call   3f3 <write>
+ 5c7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 5ca:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 5cd:	0f b6 1e             	movzbl (%esi),%ebx
+ 5d0:	83 c6 01             	add    $0x1,%esi
+ 5d3:	84 db                	test   %bl,%bl
+ 5d5:	74 29                	je     600 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 5d7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 5da:	85 d2                	test   %edx,%edx
+ 5dc:	74 ca                	je     5a8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 5de:	83 fa 25             	cmp    $0x25,%edx
+ 5e1:	75 ea                	jne    5cd <printf+0x4d>
+      if(c == 'd'){
+ 5e3:	83 f8 25             	cmp    $0x25,%eax
+ 5e6:	0f 84 24 01 00 00    	je     710 <printf+0x190>
+ 5ec:	83 e8 63             	sub    $0x63,%eax
+ 5ef:	83 f8 15             	cmp    $0x15,%eax
+ 5f2:	77 1c                	ja     610 <printf+0x90>
+ 5f4:	ff 24 85 d4 0c 00 00 	jmp    *0xcd4(,%eax,4)
+ 5fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5ff:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 600:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 603:	5b                   	pop    %ebx
+ 604:	5e                   	pop    %esi
+ 605:	5f                   	pop    %edi
+ 606:	5d                   	pop    %ebp
+ 607:	c3                   	ret
+ 608:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 60f:	90                   	nop
+  write(fd, &c, 1);
+ 610:	83 ec 04             	sub    $0x4,%esp
+ 613:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 616:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 61a:	6a 01                	push   $0x1
+ 61c:	52                   	push   %edx
+ 61d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 620:	57                   	push   %edi
+ 621:	e8 cd fd ff ff       	call   3f3 <write>
+ 626:	83 c4 0c             	add    $0xc,%esp
+ 629:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 62c:	6a 01                	push   $0x1
+ 62e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 631:	52                   	push   %edx
+ 632:	57                   	push   %edi
+ 633:	e8 bb fd ff ff       	call   3f3 <write>
+        putc(fd, c);
+ 638:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 63b:	31 d2                	xor    %edx,%edx
+ 63d:	eb 8e                	jmp    5cd <printf+0x4d>
+ 63f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 640:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 643:	83 ec 0c             	sub    $0xc,%esp
+ 646:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 64b:	8b 13                	mov    (%ebx),%edx
+ 64d:	6a 00                	push   $0x0
+ 64f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 651:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 654:	e8 87 fe ff ff       	call   4e0 <printint>
+        ap++;
+ 659:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 65c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 65f:	31 d2                	xor    %edx,%edx
+ 661:	e9 67 ff ff ff       	jmp    5cd <printf+0x4d>
+ 666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 66d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 670:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 673:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 675:	83 c0 04             	add    $0x4,%eax
+ 678:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 67b:	85 db                	test   %ebx,%ebx
+ 67d:	0f 84 9d 00 00 00    	je     720 <printf+0x1a0>
+        while(*s != 0){
+ 683:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 686:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 688:	84 c0                	test   %al,%al
+ 68a:	0f 84 3d ff ff ff    	je     5cd <printf+0x4d>
+ 690:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 693:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 696:	89 de                	mov    %ebx,%esi
+ 698:	89 d3                	mov    %edx,%ebx
+ 69a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 6a0:	83 ec 04             	sub    $0x4,%esp
+ 6a3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 6a6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 6a9:	6a 01                	push   $0x1
+ 6ab:	53                   	push   %ebx
+ 6ac:	57                   	push   %edi
+ 6ad:	e8 41 fd ff ff       	call   3f3 <write>
+        while(*s != 0){
+ 6b2:	0f b6 06             	movzbl (%esi),%eax
+ 6b5:	83 c4 10             	add    $0x10,%esp
+ 6b8:	84 c0                	test   %al,%al
+ 6ba:	75 e4                	jne    6a0 <printf+0x120>
+      state = 0;
+ 6bc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 6bf:	31 d2                	xor    %edx,%edx
+ 6c1:	e9 07 ff ff ff       	jmp    5cd <printf+0x4d>
+ 6c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6cd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 6d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6d3:	83 ec 0c             	sub    $0xc,%esp
+ 6d6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 6db:	8b 13                	mov    (%ebx),%edx
+ 6dd:	6a 01                	push   $0x1
+ 6df:	e9 6b ff ff ff       	jmp    64f <printf+0xcf>
+ 6e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 6e8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 6eb:	83 ec 04             	sub    $0x4,%esp
+ 6ee:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 6f1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 6f3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 6f6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6f9:	6a 01                	push   $0x1
+ 6fb:	52                   	push   %edx
+ 6fc:	57                   	push   %edi
+ 6fd:	e8 f1 fc ff ff       	call   3f3 <write>
+        ap++;
+ 702:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 705:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 708:	31 d2                	xor    %edx,%edx
+ 70a:	e9 be fe ff ff       	jmp    5cd <printf+0x4d>
+ 70f:	90                   	nop
+  write(fd, &c, 1);
+ 710:	83 ec 04             	sub    $0x4,%esp
+ 713:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 716:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 719:	6a 01                	push   $0x1
+ 71b:	e9 11 ff ff ff       	jmp    631 <printf+0xb1>
+ 720:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 725:	bb cd 0c 00 00       	mov    $0xccd,%ebx
+ 72a:	e9 61 ff ff ff       	jmp    690 <printf+0x110>
+ 72f:	90                   	nop
+
+00000730 <runfree>:
+
+// Give the n pages at r back to the free runs, merging them with
+// adjacent runs, and shrink the heap if the end of it is free.
+static void
+runfree(struct page *r, uint n)
+{
+ 730:	55                   	push   %ebp
+  struct page **pp, *prev;
+
+  r->kind = PFREE;
+ 731:	b9 03 00 00 00       	mov    $0x3,%ecx
+{
+ 736:	89 e5                	mov    %esp,%ebp
+ 738:	57                   	push   %edi
+ 739:	56                   	push   %esi
+ 73a:	53                   	push   %ebx
+ 73b:	89 c3                	mov    %eax,%ebx
+ 73d:	83 ec 0c             	sub    $0xc,%esp
+  r->kind = PFREE;
+ 740:	66 89 08             	mov    %cx,(%eax)
+  r->npages = n;
+  prev = 0;
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 743:	8b 0d 88 10 00 00    	mov    0x1088,%ecx
+  r->npages = n;
+ 749:	89 50 04             	mov    %edx,0x4(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 74c:	85 c9                	test   %ecx,%ecx
+ 74e:	0f 84 1f 01 00 00    	je     873 <runfree+0x143>
+ 754:	39 c1                	cmp    %eax,%ecx
+ 756:	0f 83 f7 00 00 00    	jae    853 <runfree+0x123>
+ 75c:	89 c8                	mov    %ecx,%eax
+ 75e:	eb 04                	jmp    764 <runfree+0x34>
+ 760:	39 d8                	cmp    %ebx,%eax
+ 762:	73 09                	jae    76d <runfree+0x3d>
+ 764:	89 c2                	mov    %eax,%edx
+ 766:	8b 40 14             	mov    0x14(%eax),%eax
+ 769:	85 c0                	test   %eax,%eax
+ 76b:	75 f3                	jne    760 <runfree+0x30>
+    prev = *pp;
+  r->next = *pp;
+ 76d:	89 43 14             	mov    %eax,0x14(%ebx)
+  *pp = r;
+ 770:	89 5a 14             	mov    %ebx,0x14(%edx)
+
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 773:	8b 43 14             	mov    0x14(%ebx),%eax
+ 776:	85 c0                	test   %eax,%eax
+ 778:	74 12                	je     78c <runfree+0x5c>
+ 77a:	8b 7b 04             	mov    0x4(%ebx),%edi
+ 77d:	89 fe                	mov    %edi,%esi
+ 77f:	c1 e6 0c             	shl    $0xc,%esi
+ 782:	01 de                	add    %ebx,%esi
+ 784:	39 f0                	cmp    %esi,%eax
+ 786:	0f 84 a4 00 00 00    	je     830 <runfree+0x100>
+    r->npages += r->next->npages;
+    r->next = r->next->next;
+  }
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 78c:	8b 72 04             	mov    0x4(%edx),%esi
+ 78f:	89 f0                	mov    %esi,%eax
+ 791:	c1 e0 0c             	shl    $0xc,%eax
+ 794:	01 d0                	add    %edx,%eax
+ 796:	39 c3                	cmp    %eax,%ebx
+ 798:	74 16                	je     7b0 <runfree+0x80>
+    pp = &runs;
+    while(*pp != r)
+      pp = &(*pp)->next;
+  }
+
+  if(r->next == 0 && r->npages >= TRIM &&
+ 79a:	8b 43 14             	mov    0x14(%ebx),%eax
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 79d:	8d 72 14             	lea    0x14(%edx),%esi
+  if(r->next == 0 && r->npages >= TRIM &&
+ 7a0:	85 c0                	test   %eax,%eax
+ 7a2:	74 3c                	je     7e0 <runfree+0xb0>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+    *pp = 0;
+    sbrk(-(int)(r->npages*PGSIZE));
+    heapend = (char*)r;
+  }
+}
+ 7a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7a7:	5b                   	pop    %ebx
+ 7a8:	5e                   	pop    %esi
+ 7a9:	5f                   	pop    %edi
+ 7aa:	5d                   	pop    %ebp
+ 7ab:	c3                   	ret
+ 7ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    prev->npages += r->npages;
+ 7b0:	03 73 04             	add    0x4(%ebx),%esi
+ 7b3:	89 72 04             	mov    %esi,0x4(%edx)
+    prev->next = r->next;
+ 7b6:	8b 43 14             	mov    0x14(%ebx),%eax
+ 7b9:	89 42 14             	mov    %eax,0x14(%edx)
+    while(*pp != r)
+ 7bc:	39 d1                	cmp    %edx,%ecx
+ 7be:	0f 84 c5 00 00 00    	je     889 <runfree+0x159>
+ 7c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      pp = &(*pp)->next;
+ 7c8:	89 cb                	mov    %ecx,%ebx
+ 7ca:	8b 49 14             	mov    0x14(%ecx),%ecx
+    while(*pp != r)
+ 7cd:	39 d1                	cmp    %edx,%ecx
+ 7cf:	75 f7                	jne    7c8 <runfree+0x98>
+      pp = &(*pp)->next;
+ 7d1:	8d 73 14             	lea    0x14(%ebx),%esi
+ 7d4:	89 cb                	mov    %ecx,%ebx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 7d6:	85 c0                	test   %eax,%eax
+ 7d8:	75 ca                	jne    7a4 <runfree+0x74>
+ 7da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 7e0:	8b 53 04             	mov    0x4(%ebx),%edx
+ 7e3:	83 fa 1f             	cmp    $0x1f,%edx
+ 7e6:	76 bc                	jbe    7a4 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 7e8:	c1 e2 0c             	shl    $0xc,%edx
+ 7eb:	01 da                	add    %ebx,%edx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 7ed:	39 15 84 10 00 00    	cmp    %edx,0x1084
+ 7f3:	75 af                	jne    7a4 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 7f5:	83 ec 0c             	sub    $0xc,%esp
+ 7f8:	6a 00                	push   $0x0
+ 7fa:	e8 5c fc ff ff       	call   45b <sbrk>
+ 7ff:	83 c4 10             	add    $0x10,%esp
+ 802:	39 05 84 10 00 00    	cmp    %eax,0x1084
+ 808:	75 9a                	jne    7a4 <runfree+0x74>
+    *pp = 0;
+ 80a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    sbrk(-(int)(r->npages*PGSIZE));
+ 810:	8b 43 04             	mov    0x4(%ebx),%eax
+ 813:	83 ec 0c             	sub    $0xc,%esp
+ 816:	c1 e0 0c             	shl    $0xc,%eax
+ 819:	f7 d8                	neg    %eax
+ 81b:	50                   	push   %eax
+ 81c:	e8 3a fc ff ff       	call   45b <sbrk>
+    heapend = (char*)r;
+ 821:	89 1d 84 10 00 00    	mov    %ebx,0x1084
+ 827:	83 c4 10             	add    $0x10,%esp
+}
+ 82a:	e9 75 ff ff ff       	jmp    7a4 <runfree+0x74>
+ 82f:	90                   	nop
+    r->npages += r->next->npages;
+ 830:	03 78 04             	add    0x4(%eax),%edi
+ 833:	89 7b 04             	mov    %edi,0x4(%ebx)
+    r->next = r->next->next;
+ 836:	8b 40 14             	mov    0x14(%eax),%eax
+ 839:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 83c:	8b 72 04             	mov    0x4(%edx),%esi
+ 83f:	89 f0                	mov    %esi,%eax
+ 841:	c1 e0 0c             	shl    $0xc,%eax
+ 844:	01 d0                	add    %edx,%eax
+ 846:	39 c3                	cmp    %eax,%ebx
+ 848:	0f 85 4c ff ff ff    	jne    79a <runfree+0x6a>
+ 84e:	e9 5d ff ff ff       	jmp    7b0 <runfree+0x80>
+  r->next = *pp;
+ 853:	89 48 14             	mov    %ecx,0x14(%eax)
+  *pp = r;
+ 856:	a3 88 10 00 00       	mov    %eax,0x1088
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 85b:	89 d0                	mov    %edx,%eax
+ 85d:	c1 e0 0c             	shl    $0xc,%eax
+ 860:	01 d8                	add    %ebx,%eax
+ 862:	39 c1                	cmp    %eax,%ecx
+ 864:	74 2f                	je     895 <runfree+0x165>
+  if(r->next == 0 && r->npages >= TRIM &&
+ 866:	8b 43 14             	mov    0x14(%ebx),%eax
+ 869:	be 88 10 00 00       	mov    $0x1088,%esi
+ 86e:	e9 2d ff ff ff       	jmp    7a0 <runfree+0x70>
+  r->next = *pp;
+ 873:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 87a:	be 88 10 00 00       	mov    $0x1088,%esi
+  *pp = r;
+ 87f:	a3 88 10 00 00       	mov    %eax,0x1088
+  if(r->next == 0 && r->npages >= TRIM &&
+ 884:	e9 5a ff ff ff       	jmp    7e3 <runfree+0xb3>
+    while(*pp != r)
+ 889:	89 cb                	mov    %ecx,%ebx
+    pp = &runs;
+ 88b:	be 88 10 00 00       	mov    $0x1088,%esi
+ 890:	e9 0b ff ff ff       	jmp    7a0 <runfree+0x70>
+    r->npages += r->next->npages;
+ 895:	03 51 04             	add    0x4(%ecx),%edx
+ 898:	89 53 04             	mov    %edx,0x4(%ebx)
+    r->next = r->next->next;
+ 89b:	8b 41 14             	mov    0x14(%ecx),%eax
+ 89e:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 8a1:	eb c3                	jmp    866 <runfree+0x136>
+ 8a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000008b0 <runalloc>:
+
+// Take a run of n pages from the start of the first free run
+// long enough, which keeps the end of the heap free to trim.
+static struct page*
+runalloc(uint n)
+{
+ 8b0:	55                   	push   %ebp
+ 8b1:	89 e5                	mov    %esp,%ebp
+ 8b3:	57                   	push   %edi
+ 8b4:	56                   	push   %esi
+ 8b5:	89 c6                	mov    %eax,%esi
+ 8b7:	53                   	push   %ebx
+ 8b8:	83 ec 1c             	sub    $0x1c,%esp
+  struct page **pp, *r, *rest;
+
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ 8bb:	8b 1d 88 10 00 00    	mov    0x1088,%ebx
+ 8c1:	85 db                	test   %ebx,%ebx
+ 8c3:	74 4d                	je     912 <runalloc+0x62>
+ 8c5:	b9 88 10 00 00       	mov    $0x1088,%ecx
+    if(r->npages < n)
+ 8ca:	39 73 04             	cmp    %esi,0x4(%ebx)
+ 8cd:	72 39                	jb     908 <runalloc+0x58>
+      continue;
+    if(r->npages == n){
+ 8cf:	0f 84 9b 00 00 00    	je     970 <runalloc+0xc0>
+      *pp = r->next;
+    } else {
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ 8d5:	89 f0                	mov    %esi,%eax
+      rest->kind = PFREE;
+ 8d7:	ba 03 00 00 00       	mov    $0x3,%edx
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ 8dc:	c1 e0 0c             	shl    $0xc,%eax
+ 8df:	01 d8                	add    %ebx,%eax
+      rest->kind = PFREE;
+ 8e1:	66 89 10             	mov    %dx,(%eax)
+      rest->npages = r->npages - n;
+ 8e4:	8b 53 04             	mov    0x4(%ebx),%edx
+ 8e7:	29 f2                	sub    %esi,%edx
+ 8e9:	89 50 04             	mov    %edx,0x4(%eax)
+      rest->next = r->next;
+ 8ec:	8b 53 14             	mov    0x14(%ebx),%edx
+ 8ef:	89 50 14             	mov    %edx,0x14(%eax)
+      *pp = rest;
+ 8f2:	89 01                	mov    %eax,(%ecx)
+      r->npages = n;
+ 8f4:	89 73 04             	mov    %esi,0x4(%ebx)
+    }
+    return r;
+  }
+  return morecore(n);
+}
+ 8f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8fa:	89 d8                	mov    %ebx,%eax
+ 8fc:	5b                   	pop    %ebx
+ 8fd:	5e                   	pop    %esi
+ 8fe:	5f                   	pop    %edi
+ 8ff:	5d                   	pop    %ebp
+ 900:	c3                   	ret
+ 901:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ 908:	8d 4b 14             	lea    0x14(%ebx),%ecx
+ 90b:	8b 5b 14             	mov    0x14(%ebx),%ebx
+ 90e:	85 db                	test   %ebx,%ebx
+ 910:	75 b8                	jne    8ca <runalloc+0x1a>
+  m = n < MINCORE ? MINCORE : n;
+ 912:	bf 08 00 00 00       	mov    $0x8,%edi
+ 917:	39 fe                	cmp    %edi,%esi
+ 919:	0f 43 fe             	cmovae %esi,%edi
+  brk = sbrk(0);
+ 91c:	83 ec 0c             	sub    $0xc,%esp
+ 91f:	6a 00                	push   $0x0
+ 921:	e8 35 fb ff ff       	call   45b <sbrk>
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 926:	89 fa                	mov    %edi,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 928:	89 c3                	mov    %eax,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 92a:	c1 e2 0c             	shl    $0xc,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 92d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 930:	f7 db                	neg    %ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 932:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 935:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 93b:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+ 93e:	89 04 24             	mov    %eax,(%esp)
+ 941:	e8 15 fb ff ff       	call   45b <sbrk>
+ 946:	83 c4 10             	add    $0x10,%esp
+ 949:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 94c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 94f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 952:	74 3e                	je     992 <runalloc+0xe2>
+  r = (struct page*)(brk + pad);
+ 954:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ 956:	01 da                	add    %ebx,%edx
+ 958:	89 15 84 10 00 00    	mov    %edx,0x1084
+  if(m > n)
+ 95e:	39 fe                	cmp    %edi,%esi
+ 960:	72 1e                	jb     980 <runalloc+0xd0>
+  r->npages = n;
+ 962:	89 73 04             	mov    %esi,0x4(%ebx)
+  return r;
+ 965:	eb 90                	jmp    8f7 <runalloc+0x47>
+ 967:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 96e:	66 90                	xchg   %ax,%ax
+      *pp = r->next;
+ 970:	8b 43 14             	mov    0x14(%ebx),%eax
+ 973:	89 01                	mov    %eax,(%ecx)
+}
+ 975:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 978:	89 d8                	mov    %ebx,%eax
+ 97a:	5b                   	pop    %ebx
+ 97b:	5e                   	pop    %esi
+ 97c:	5f                   	pop    %edi
+ 97d:	5d                   	pop    %ebp
+ 97e:	c3                   	ret
+ 97f:	90                   	nop
+    runfree((struct page*)((char*)r + n*PGSIZE), m - n);
+ 980:	89 f0                	mov    %esi,%eax
+ 982:	29 f7                	sub    %esi,%edi
+ 984:	c1 e0 0c             	shl    $0xc,%eax
+ 987:	89 fa                	mov    %edi,%edx
+ 989:	01 d8                	add    %ebx,%eax
+ 98b:	e8 a0 fd ff ff       	call   730 <runfree>
+ 990:	eb d0                	jmp    962 <runalloc+0xb2>
+    if(sbrk(pad + m*PGSIZE) == (char*)-1)
+ 992:	89 f7                	mov    %esi,%edi
+ 994:	83 ec 0c             	sub    $0xc,%esp
+ 997:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 99a:	c1 e7 0c             	shl    $0xc,%edi
+ 99d:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+ 9a0:	50                   	push   %eax
+ 9a1:	e8 b5 fa ff ff       	call   45b <sbrk>
+ 9a6:	83 c4 10             	add    $0x10,%esp
+ 9a9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 9ac:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 9af:	74 0c                	je     9bd <runalloc+0x10d>
+  r = (struct page*)(brk + pad);
+ 9b1:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ 9b3:	01 df                	add    %ebx,%edi
+ 9b5:	89 3d 84 10 00 00    	mov    %edi,0x1084
+  if(m > n)
+ 9bb:	eb a5                	jmp    962 <runalloc+0xb2>
+      return 0;
+ 9bd:	31 db                	xor    %ebx,%ebx
+ 9bf:	e9 33 ff ff ff       	jmp    8f7 <runalloc+0x47>
+ 9c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9cf:	90                   	nop
+
+000009d0 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+ 9d0:	55                   	push   %ebp
+ 9d1:	89 e5                	mov    %esp,%ebp
+ 9d3:	56                   	push   %esi
+ 9d4:	53                   	push   %ebx
+ 9d5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  struct page *p;
+
+  if(ap == 0)
+ 9d8:	85 c9                	test   %ecx,%ecx
+ 9da:	74 1c                	je     9f8 <free+0x28>
+    return;
+  p = (struct page*)((uint)ap & ~(PGSIZE-1));
+ 9dc:	89 c8                	mov    %ecx,%eax
+ 9de:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  switch(p->kind){
+ 9e3:	0f b7 10             	movzwl (%eax),%edx
+ 9e6:	66 83 fa 02          	cmp    $0x2,%dx
+ 9ea:	74 14                	je     a00 <free+0x30>
+ 9ec:	66 83 fa 04          	cmp    $0x4,%dx
+ 9f0:	74 66                	je     a58 <free+0x88>
+ 9f2:	66 83 fa 01          	cmp    $0x1,%dx
+ 9f6:	74 18                	je     a10 <free+0x40>
+    break;
+  case PMAP:
+    munmap(p, p->npages*PGSIZE);
+    break;
+  }
+}
+ 9f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 9fb:	5b                   	pop    %ebx
+ 9fc:	5e                   	pop    %esi
+ 9fd:	5d                   	pop    %ebp
+ 9fe:	c3                   	ret
+ 9ff:	90                   	nop
+    runfree(p, p->npages);
+ a00:	8b 50 04             	mov    0x4(%eax),%edx
+}
+ a03:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a06:	5b                   	pop    %ebx
+ a07:	5e                   	pop    %esi
+ a08:	5d                   	pop    %ebp
+    runfree(p, p->npages);
+ a09:	e9 22 fd ff ff       	jmp    730 <runfree>
+ a0e:	66 90                	xchg   %ax,%ax
+  b->next = p->free;
+ a10:	8b 50 0c             	mov    0xc(%eax),%edx
+ a13:	89 11                	mov    %edx,(%ecx)
+  if(p->nfree++ == 0)
+ a15:	8b 50 08             	mov    0x8(%eax),%edx
+  p->free = b;
+ a18:	89 48 0c             	mov    %ecx,0xc(%eax)
+  if(p->nfree++ == 0)
+ a1b:	8d 5a 01             	lea    0x1(%edx),%ebx
+ a1e:	89 58 08             	mov    %ebx,0x8(%eax)
+ a21:	85 d2                	test   %edx,%edx
+ a23:	74 53                	je     a78 <free+0xa8>
+  if(p->nfree == nblocks(p->class)){
+ a25:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ a29:	8d 4e 04             	lea    0x4(%esi),%ecx
+ a2c:	ba e0 0f 00 00       	mov    $0xfe0,%edx
+ a31:	d3 fa                	sar    %cl,%edx
+  if(p->nfree == nblocks(p->class)){
+ a33:	39 da                	cmp    %ebx,%edx
+ a35:	75 c1                	jne    9f8 <free+0x28>
+  if(p->prev)
+ a37:	8b 48 18             	mov    0x18(%eax),%ecx
+    p->prev->next = p->next;
+ a3a:	8b 50 14             	mov    0x14(%eax),%edx
+  if(p->prev)
+ a3d:	85 c9                	test   %ecx,%ecx
+ a3f:	74 6f                	je     ab0 <free+0xe0>
+    p->prev->next = p->next;
+ a41:	89 51 14             	mov    %edx,0x14(%ecx)
+  if(p->next)
+ a44:	85 d2                	test   %edx,%edx
+ a46:	74 06                	je     a4e <free+0x7e>
+    p->next->prev = p->prev;
+ a48:	8b 48 18             	mov    0x18(%eax),%ecx
+ a4b:	89 4a 18             	mov    %ecx,0x18(%edx)
+    runfree(p, 1);
+ a4e:	ba 01 00 00 00       	mov    $0x1,%edx
+ a53:	eb ae                	jmp    a03 <free+0x33>
+ a55:	8d 76 00             	lea    0x0(%esi),%esi
+    munmap(p, p->npages*PGSIZE);
+ a58:	8b 50 04             	mov    0x4(%eax),%edx
+ a5b:	83 ec 08             	sub    $0x8,%esp
+ a5e:	c1 e2 0c             	shl    $0xc,%edx
+ a61:	52                   	push   %edx
+ a62:	50                   	push   %eax
+ a63:	e8 1b fa ff ff       	call   483 <munmap>
+    break;
+ a68:	83 c4 10             	add    $0x10,%esp
+}
+ a6b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a6e:	5b                   	pop    %ebx
+ a6f:	5e                   	pop    %esi
+ a70:	5d                   	pop    %ebp
+ a71:	c3                   	ret
+ a72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  p->next = partial[p->class];
+ a78:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  p->prev = 0;
+ a7c:	c7 40 18 00 00 00 00 	movl   $0x0,0x18(%eax)
+  p->next = partial[p->class];
+ a83:	bb 01 00 00 00       	mov    $0x1,%ebx
+ a88:	8b 14 b5 8c 10 00 00 	mov    0x108c(,%esi,4),%edx
+ a8f:	89 50 14             	mov    %edx,0x14(%eax)
+  if(p->next)
+ a92:	85 d2                	test   %edx,%edx
+ a94:	74 0a                	je     aa0 <free+0xd0>
+    p->next->prev = p;
+ a96:	89 42 18             	mov    %eax,0x18(%edx)
+  partial[p->class] = p;
+ a99:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  if(p->nfree == nblocks(p->class)){
+ a9d:	8b 58 08             	mov    0x8(%eax),%ebx
+  partial[p->class] = p;
+ aa0:	89 04 b5 8c 10 00 00 	mov    %eax,0x108c(,%esi,4)
+}
+ aa7:	eb 80                	jmp    a29 <free+0x59>
+ aa9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ ab0:	89 14 b5 8c 10 00 00 	mov    %edx,0x108c(,%esi,4)
+ ab7:	eb 8b                	jmp    a44 <free+0x74>
+ ab9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000ac0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ ac0:	55                   	push   %ebp
+ ac1:	89 e5                	mov    %esp,%ebp
+ ac3:	56                   	push   %esi
+ ac4:	53                   	push   %ebx
+ ac5:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct page *p;
+  uint n;
+
+  if(nbytes <= MAXSMALL)
+ ac8:	3d 00 04 00 00       	cmp    $0x400,%eax
+ acd:	76 71                	jbe    b40 <malloc+0x80>
+    return smallalloc(sizeclass(nbytes));
+  if(nbytes > 0x7fffffff)
+ acf:	85 c0                	test   %eax,%eax
+ ad1:	0f 88 d9 00 00 00    	js     bb0 <malloc+0xf0>
+    return 0;
+  n = (nbytes + HDRSIZE + PGSIZE-1) / PGSIZE;
+ ad7:	8d 90 1f 10 00 00    	lea    0x101f(%eax),%edx
+ add:	89 d3                	mov    %edx,%ebx
+ adf:	c1 eb 0c             	shr    $0xc,%ebx
+  if(nbytes >= MAPMIN){
+ ae2:	3d ff ff 00 00       	cmp    $0xffff,%eax
+ ae7:	77 27                	ja     b10 <malloc+0x50>
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    if(p == MAP_FAILED)
+      return 0;
+    p->kind = PMAP;
+  } else {
+    if((p = runalloc(n)) == 0)
+ ae9:	89 d8                	mov    %ebx,%eax
+ aeb:	e8 c0 fd ff ff       	call   8b0 <runalloc>
+ af0:	85 c0                	test   %eax,%eax
+ af2:	0f 84 b8 00 00 00    	je     bb0 <malloc+0xf0>
+      return 0;
+    p->kind = PRUN;
+ af8:	ba 02 00 00 00       	mov    $0x2,%edx
+ afd:	66 89 10             	mov    %dx,(%eax)
+  }
+  p->npages = n;
+ b00:	89 58 04             	mov    %ebx,0x4(%eax)
+  return (char*)p + HDRSIZE;
+ b03:	8d 58 20             	lea    0x20(%eax),%ebx
+}
+ b06:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ b09:	89 d8                	mov    %ebx,%eax
+ b0b:	5b                   	pop    %ebx
+ b0c:	5e                   	pop    %esi
+ b0d:	5d                   	pop    %ebp
+ b0e:	c3                   	ret
+ b0f:	90                   	nop
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+ b10:	83 ec 08             	sub    $0x8,%esp
+ b13:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+ b19:	6a 00                	push   $0x0
+ b1b:	6a ff                	push   $0xffffffff
+ b1d:	6a 22                	push   $0x22
+ b1f:	6a 03                	push   $0x3
+ b21:	52                   	push   %edx
+ b22:	6a 00                	push   $0x0
+ b24:	e8 52 f9 ff ff       	call   47b <mmap>
+    if(p == MAP_FAILED)
+ b29:	83 c4 20             	add    $0x20,%esp
+ b2c:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b2f:	74 7f                	je     bb0 <malloc+0xf0>
+    p->kind = PMAP;
+ b31:	b9 04 00 00 00       	mov    $0x4,%ecx
+ b36:	66 89 08             	mov    %cx,(%eax)
+ b39:	eb c5                	jmp    b00 <malloc+0x40>
+ b3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b3f:	90                   	nop
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ b40:	83 f8 10             	cmp    $0x10,%eax
+ b43:	0f 86 07 01 00 00    	jbe    c50 <malloc+0x190>
+ b49:	31 db                	xor    %ebx,%ebx
+ b4b:	ba 10 00 00 00       	mov    $0x10,%edx
+ b50:	83 c3 01             	add    $0x1,%ebx
+ b53:	89 d6                	mov    %edx,%esi
+ b55:	89 d9                	mov    %ebx,%ecx
+ b57:	d3 e6                	shl    %cl,%esi
+ b59:	39 c6                	cmp    %eax,%esi
+ b5b:	72 f3                	jb     b50 <malloc+0x90>
+  if((p = partial[c]) == 0){
+ b5d:	8b 14 9d 8c 10 00 00 	mov    0x108c(,%ebx,4),%edx
+ b64:	85 d2                	test   %edx,%edx
+ b66:	74 58                	je     bc0 <malloc+0x100>
+  if((b = p->free) != 0){
+ b68:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ b6b:	8b 4a 08             	mov    0x8(%edx),%ecx
+  if((b = p->free) != 0){
+ b6e:	85 db                	test   %ebx,%ebx
+ b70:	0f 84 aa 00 00 00    	je     c20 <malloc+0x160>
+    p->free = b->next;
+ b76:	8b 03                	mov    (%ebx),%eax
+ b78:	89 42 0c             	mov    %eax,0xc(%edx)
+  if(--p->nfree == 0)
+ b7b:	83 e9 01             	sub    $0x1,%ecx
+ b7e:	89 4a 08             	mov    %ecx,0x8(%edx)
+ b81:	75 83                	jne    b06 <malloc+0x46>
+  if(p->prev)
+ b83:	8b 4a 18             	mov    0x18(%edx),%ecx
+    p->prev->next = p->next;
+ b86:	8b 42 14             	mov    0x14(%edx),%eax
+  if(p->prev)
+ b89:	85 c9                	test   %ecx,%ecx
+ b8b:	0f 84 cf 00 00 00    	je     c60 <malloc+0x1a0>
+    p->prev->next = p->next;
+ b91:	89 41 14             	mov    %eax,0x14(%ecx)
+  if(p->next)
+ b94:	85 c0                	test   %eax,%eax
+ b96:	0f 84 6a ff ff ff    	je     b06 <malloc+0x46>
+    p->next->prev = p->prev;
+ b9c:	8b 52 18             	mov    0x18(%edx),%edx
+ b9f:	89 50 18             	mov    %edx,0x18(%eax)
+ ba2:	e9 5f ff ff ff       	jmp    b06 <malloc+0x46>
+ ba7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bae:	66 90                	xchg   %ax,%ax
+}
+ bb0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+ bb3:	31 db                	xor    %ebx,%ebx
+}
+ bb5:	89 d8                	mov    %ebx,%eax
+ bb7:	5b                   	pop    %ebx
+ bb8:	5e                   	pop    %esi
+ bb9:	5d                   	pop    %ebp
+ bba:	c3                   	ret
+ bbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ bbf:	90                   	nop
+    if((p = runalloc(1)) == 0)
+ bc0:	b8 01 00 00 00       	mov    $0x1,%eax
+ bc5:	e8 e6 fc ff ff       	call   8b0 <runalloc>
+ bca:	89 c2                	mov    %eax,%edx
+ bcc:	85 c0                	test   %eax,%eax
+ bce:	74 e0                	je     bb0 <malloc+0xf0>
+    p->kind = PSMALL;
+ bd0:	b8 01 00 00 00       	mov    $0x1,%eax
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ bd5:	8d 4b 04             	lea    0x4(%ebx),%ecx
+    p->class = c;
+ bd8:	66 89 5a 02          	mov    %bx,0x2(%edx)
+ bdc:	0f b7 db             	movzwl %bx,%ebx
+    p->kind = PSMALL;
+ bdf:	66 89 02             	mov    %ax,(%edx)
+    p->fresh = (char*)p + HDRSIZE;
+ be2:	8d 42 20             	lea    0x20(%edx),%eax
+ be5:	89 42 10             	mov    %eax,0x10(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ be8:	b8 e0 0f 00 00       	mov    $0xfe0,%eax
+ bed:	d3 f8                	sar    %cl,%eax
+    p->free = 0;
+ bef:	c7 42 0c 00 00 00 00 	movl   $0x0,0xc(%edx)
+    p->nfree = nblocks(c);
+ bf6:	89 42 08             	mov    %eax,0x8(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ bf9:	89 c1                	mov    %eax,%ecx
+  p->next = partial[p->class];
+ bfb:	8b 04 9d 8c 10 00 00 	mov    0x108c(,%ebx,4),%eax
+  p->prev = 0;
+ c02:	c7 42 18 00 00 00 00 	movl   $0x0,0x18(%edx)
+  p->next = partial[p->class];
+ c09:	89 42 14             	mov    %eax,0x14(%edx)
+  if(p->next)
+ c0c:	85 c0                	test   %eax,%eax
+ c0e:	75 20                	jne    c30 <malloc+0x170>
+  partial[p->class] = p;
+ c10:	89 14 9d 8c 10 00 00 	mov    %edx,0x108c(,%ebx,4)
+  if((b = p->free) != 0){
+ c17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c1e:	66 90                	xchg   %ax,%ax
+    b = (struct block*)p->fresh;
+ c20:	8b 5a 10             	mov    0x10(%edx),%ebx
+    p->fresh += MINSMALL << c;
+ c23:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+ c26:	89 42 10             	mov    %eax,0x10(%edx)
+ c29:	e9 4d ff ff ff       	jmp    b7b <malloc+0xbb>
+ c2e:	66 90                	xchg   %ax,%ax
+    p->next->prev = p;
+ c30:	89 50 18             	mov    %edx,0x18(%eax)
+  partial[p->class] = p;
+ c33:	0f b7 42 02          	movzwl 0x2(%edx),%eax
+  if((b = p->free) != 0){
+ c37:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ c3a:	8b 4a 08             	mov    0x8(%edx),%ecx
+  partial[p->class] = p;
+ c3d:	89 14 85 8c 10 00 00 	mov    %edx,0x108c(,%eax,4)
+}
+ c44:	e9 25 ff ff ff       	jmp    b6e <malloc+0xae>
+ c49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ c50:	be 10 00 00 00       	mov    $0x10,%esi
+ c55:	31 db                	xor    %ebx,%ebx
+ c57:	e9 01 ff ff ff       	jmp    b5d <malloc+0x9d>
+ c5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ c60:	0f b7 4a 02          	movzwl 0x2(%edx),%ecx
+ c64:	89 04 8d 8c 10 00 00 	mov    %eax,0x108c(,%ecx,4)
+ c6b:	e9 24 ff ff ff       	jmp    b94 <malloc+0xd4>
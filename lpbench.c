@@ -0,0 +1,64 @@
+// Measure what 4MB pages save on TLB misses: touch 16MB of
+// memory at random, once where the kernel can map it with 4MB
+// pages and once where it has to use 4KB pages.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "mman.h"
+
+#define NREGION 4
+#define LARGE   (4*1024*1024)  // a 4MB page
+#define NTOUCH  (4*1024*1024)
+
+uint seed = 1;
+
+uint
+rand(void)
+{
+  seed = seed * 1103515245 + 12345;
+  return seed >> 8;
+}
+
+// Map NREGION regions of size bytes each and return
+// the ticks taken by NTOUCH random reads and writes.
+int
+run(uint size)
+{
+  char *r[NREGION];
+  int i, start, ticks;
+  uint x;
+
+  for(i = 0; i < NREGION; i++){
+    r[i] = mmap(0, size, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    if(r[i] == MAP_FAILED){
+      printf(1, "lpbench: mmap failed\n");
+      exit();
+    }
+    memset(r[i], 1, size);  // fault everything in first
+  }
+
+  start = uptime();
+  for(i = 0; i < NTOUCH; i++){
+    x = rand();
+    r[x % NREGION][(x / NREGION) % size]++;
+  }
+  ticks = uptime() - start;
+
+  for(i = 0; i < NREGION; i++)
+    munmap(r[i], size);
+  return ticks;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int small, large;
+
+  // A region one page short of 4MB cannot hold a 4MB page.
+  small = run(LARGE - 4096);
+  large = run(LARGE);
+  printf(1, "%d random touches over %dMB: 4KB pages %d ticks, 4MB pages %d ticks\n",
+         NTOUCH, NREGION*LARGE/(1024*1024), small, large);
+  exit();
+}
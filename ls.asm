@@ -0,0 +1,1992 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  close(fd);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	bb 01 00 00 00       	mov    $0x1,%ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 31                	mov    (%ecx),%esi
+  1b:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+  1e:	83 fe 01             	cmp    $0x1,%esi
+  21:	7e 1f                	jle    42 <main+0x42>
+  23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  27:	90                   	nop
+    ls(".");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+    ls(argv[i]);
+  28:	83 ec 0c             	sub    $0xc,%esp
+  2b:	ff 34 9f             	push   (%edi,%ebx,4)
+  for(i=1; i<argc; i++)
+  2e:	83 c3 01             	add    $0x1,%ebx
+    ls(argv[i]);
+  31:	e8 ca 00 00 00       	call   100 <ls>
+  for(i=1; i<argc; i++)
+  36:	83 c4 10             	add    $0x10,%esp
+  39:	39 de                	cmp    %ebx,%esi
+  3b:	75 eb                	jne    28 <main+0x28>
+  exit();
+  3d:	e8 81 05 00 00       	call   5c3 <exit>
+    ls(".");
+  42:	83 ec 0c             	sub    $0xc,%esp
+  45:	68 a8 0e 00 00       	push   $0xea8
+  4a:	e8 b1 00 00 00       	call   100 <ls>
+    exit();
+  4f:	e8 6f 05 00 00       	call   5c3 <exit>
+  54:	66 90                	xchg   %ax,%ax
+  56:	66 90                	xchg   %ax,%ax
+  58:	66 90                	xchg   %ax,%ax
+  5a:	66 90                	xchg   %ax,%ax
+  5c:	66 90                	xchg   %ax,%ax
+  5e:	66 90                	xchg   %ax,%ax
+
+00000060 <fmtname>:
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	56                   	push   %esi
+  64:	53                   	push   %ebx
+  65:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+  68:	83 ec 0c             	sub    $0xc,%esp
+  6b:	56                   	push   %esi
+  6c:	e8 5f 03 00 00       	call   3d0 <strlen>
+  71:	83 c4 10             	add    $0x10,%esp
+  74:	01 f0                	add    %esi,%eax
+  76:	89 c3                	mov    %eax,%ebx
+  78:	73 0f                	jae    89 <fmtname+0x29>
+  7a:	eb 12                	jmp    8e <fmtname+0x2e>
+  7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  83:	39 f0                	cmp    %esi,%eax
+  85:	72 0a                	jb     91 <fmtname+0x31>
+  87:	89 c3                	mov    %eax,%ebx
+  89:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+  8c:	75 f2                	jne    80 <fmtname+0x20>
+  p++;
+  8e:	83 c3 01             	add    $0x1,%ebx
+  if(strlen(p) >= DIRSIZ)
+  91:	83 ec 0c             	sub    $0xc,%esp
+  94:	53                   	push   %ebx
+  95:	e8 36 03 00 00       	call   3d0 <strlen>
+  9a:	83 c4 10             	add    $0x10,%esp
+  9d:	83 f8 0d             	cmp    $0xd,%eax
+  a0:	77 4a                	ja     ec <fmtname+0x8c>
+  memmove(buf, p, strlen(p));
+  a2:	83 ec 0c             	sub    $0xc,%esp
+  a5:	53                   	push   %ebx
+  a6:	e8 25 03 00 00       	call   3d0 <strlen>
+  ab:	83 c4 0c             	add    $0xc,%esp
+  ae:	50                   	push   %eax
+  af:	53                   	push   %ebx
+  b0:	68 a0 12 00 00       	push   $0x12a0
+  b5:	e8 96 04 00 00       	call   550 <memmove>
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  ba:	89 1c 24             	mov    %ebx,(%esp)
+  bd:	e8 0e 03 00 00       	call   3d0 <strlen>
+  c2:	89 1c 24             	mov    %ebx,(%esp)
+  return buf;
+  c5:	bb a0 12 00 00       	mov    $0x12a0,%ebx
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  ca:	89 c6                	mov    %eax,%esi
+  cc:	e8 ff 02 00 00       	call   3d0 <strlen>
+  d1:	ba 0e 00 00 00       	mov    $0xe,%edx
+  d6:	83 c4 0c             	add    $0xc,%esp
+  d9:	29 f2                	sub    %esi,%edx
+  db:	05 a0 12 00 00       	add    $0x12a0,%eax
+  e0:	52                   	push   %edx
+  e1:	6a 20                	push   $0x20
+  e3:	50                   	push   %eax
+  e4:	e8 17 03 00 00       	call   400 <memset>
+  return buf;
+  e9:	83 c4 10             	add    $0x10,%esp
+}
+  ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  ef:	89 d8                	mov    %ebx,%eax
+  f1:	5b                   	pop    %ebx
+  f2:	5e                   	pop    %esi
+  f3:	5d                   	pop    %ebp
+  f4:	c3                   	ret
+  f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000100 <ls>:
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	57                   	push   %edi
+ 104:	56                   	push   %esi
+ 105:	53                   	push   %ebx
+ 106:	81 ec 64 02 00 00    	sub    $0x264,%esp
+ 10c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if((fd = open(path, 0)) < 0){
+ 10f:	6a 00                	push   $0x0
+ 111:	57                   	push   %edi
+ 112:	e8 ec 04 00 00       	call   603 <open>
+ 117:	83 c4 10             	add    $0x10,%esp
+ 11a:	85 c0                	test   %eax,%eax
+ 11c:	0f 88 9e 01 00 00    	js     2c0 <ls+0x1c0>
+  if(fstat(fd, &st) < 0){
+ 122:	83 ec 08             	sub    $0x8,%esp
+ 125:	8d b5 d4 fd ff ff    	lea    -0x22c(%ebp),%esi
+ 12b:	89 c3                	mov    %eax,%ebx
+ 12d:	56                   	push   %esi
+ 12e:	50                   	push   %eax
+ 12f:	e8 e7 04 00 00       	call   61b <fstat>
+ 134:	83 c4 10             	add    $0x10,%esp
+ 137:	85 c0                	test   %eax,%eax
+ 139:	0f 88 c1 01 00 00    	js     300 <ls+0x200>
+  switch(st.type){
+ 13f:	0f b7 85 d4 fd ff ff 	movzwl -0x22c(%ebp),%eax
+ 146:	66 83 f8 01          	cmp    $0x1,%ax
+ 14a:	74 64                	je     1b0 <ls+0xb0>
+ 14c:	66 83 f8 02          	cmp    $0x2,%ax
+ 150:	74 1e                	je     170 <ls+0x70>
+  close(fd);
+ 152:	83 ec 0c             	sub    $0xc,%esp
+ 155:	53                   	push   %ebx
+ 156:	e8 90 04 00 00       	call   5eb <close>
+ 15b:	83 c4 10             	add    $0x10,%esp
+}
+ 15e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 161:	5b                   	pop    %ebx
+ 162:	5e                   	pop    %esi
+ 163:	5f                   	pop    %edi
+ 164:	5d                   	pop    %ebp
+ 165:	c3                   	ret
+ 166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+ 170:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+ 176:	83 ec 0c             	sub    $0xc,%esp
+ 179:	8b b5 dc fd ff ff    	mov    -0x224(%ebp),%esi
+ 17f:	89 95 b4 fd ff ff    	mov    %edx,-0x24c(%ebp)
+ 185:	57                   	push   %edi
+ 186:	e8 d5 fe ff ff       	call   60 <fmtname>
+ 18b:	8b 95 b4 fd ff ff    	mov    -0x24c(%ebp),%edx
+ 191:	59                   	pop    %ecx
+ 192:	5f                   	pop    %edi
+ 193:	52                   	push   %edx
+ 194:	56                   	push   %esi
+ 195:	6a 02                	push   $0x2
+ 197:	50                   	push   %eax
+ 198:	68 88 0e 00 00       	push   $0xe88
+ 19d:	6a 01                	push   $0x1
+ 19f:	e8 cc 05 00 00       	call   770 <printf>
+    break;
+ 1a4:	83 c4 20             	add    $0x20,%esp
+ 1a7:	eb a9                	jmp    152 <ls+0x52>
+ 1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+ 1b0:	83 ec 0c             	sub    $0xc,%esp
+ 1b3:	57                   	push   %edi
+ 1b4:	e8 17 02 00 00       	call   3d0 <strlen>
+ 1b9:	83 c4 10             	add    $0x10,%esp
+ 1bc:	83 c0 10             	add    $0x10,%eax
+ 1bf:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 1c4:	0f 87 16 01 00 00    	ja     2e0 <ls+0x1e0>
+    strcpy(buf, path);
+ 1ca:	83 ec 08             	sub    $0x8,%esp
+ 1cd:	57                   	push   %edi
+ 1ce:	8d bd e8 fd ff ff    	lea    -0x218(%ebp),%edi
+ 1d4:	57                   	push   %edi
+ 1d5:	e8 66 01 00 00       	call   340 <strcpy>
+    p = buf+strlen(buf);
+ 1da:	89 3c 24             	mov    %edi,(%esp)
+ 1dd:	e8 ee 01 00 00       	call   3d0 <strlen>
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1e2:	83 c4 10             	add    $0x10,%esp
+    p = buf+strlen(buf);
+ 1e5:	01 f8                	add    %edi,%eax
+    *p++ = '/';
+ 1e7:	8d 48 01             	lea    0x1(%eax),%ecx
+    p = buf+strlen(buf);
+ 1ea:	89 85 a8 fd ff ff    	mov    %eax,-0x258(%ebp)
+    *p++ = '/';
+ 1f0:	89 8d a4 fd ff ff    	mov    %ecx,-0x25c(%ebp)
+ 1f6:	c6 00 2f             	movb   $0x2f,(%eax)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 200:	83 ec 04             	sub    $0x4,%esp
+ 203:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+ 209:	6a 10                	push   $0x10
+ 20b:	50                   	push   %eax
+ 20c:	53                   	push   %ebx
+ 20d:	e8 c9 03 00 00       	call   5db <read>
+ 212:	83 c4 10             	add    $0x10,%esp
+ 215:	83 f8 10             	cmp    $0x10,%eax
+ 218:	0f 85 34 ff ff ff    	jne    152 <ls+0x52>
+      if(de.inum == 0)
+ 21e:	66 83 bd c4 fd ff ff 	cmpw   $0x0,-0x23c(%ebp)
+ 225:	00 
+ 226:	74 d8                	je     200 <ls+0x100>
+      memmove(p, de.name, DIRSIZ);
+ 228:	83 ec 04             	sub    $0x4,%esp
+ 22b:	8d 85 c6 fd ff ff    	lea    -0x23a(%ebp),%eax
+ 231:	6a 0e                	push   $0xe
+ 233:	50                   	push   %eax
+ 234:	ff b5 a4 fd ff ff    	push   -0x25c(%ebp)
+ 23a:	e8 11 03 00 00       	call   550 <memmove>
+      p[DIRSIZ] = 0;
+ 23f:	8b 85 a8 fd ff ff    	mov    -0x258(%ebp),%eax
+ 245:	c6 40 0f 00          	movb   $0x0,0xf(%eax)
+      if(stat(buf, &st) < 0){
+ 249:	58                   	pop    %eax
+ 24a:	5a                   	pop    %edx
+ 24b:	56                   	push   %esi
+ 24c:	57                   	push   %edi
+ 24d:	e8 6e 02 00 00       	call   4c0 <stat>
+ 252:	83 c4 10             	add    $0x10,%esp
+ 255:	85 c0                	test   %eax,%eax
+ 257:	0f 88 cb 00 00 00    	js     328 <ls+0x228>
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+ 25d:	8b 8d e4 fd ff ff    	mov    -0x21c(%ebp),%ecx
+ 263:	8b 95 dc fd ff ff    	mov    -0x224(%ebp),%edx
+ 269:	83 ec 0c             	sub    $0xc,%esp
+ 26c:	0f bf 85 d4 fd ff ff 	movswl -0x22c(%ebp),%eax
+ 273:	89 8d ac fd ff ff    	mov    %ecx,-0x254(%ebp)
+ 279:	89 95 b0 fd ff ff    	mov    %edx,-0x250(%ebp)
+ 27f:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+ 285:	57                   	push   %edi
+ 286:	e8 d5 fd ff ff       	call   60 <fmtname>
+ 28b:	5a                   	pop    %edx
+ 28c:	59                   	pop    %ecx
+ 28d:	8b 8d ac fd ff ff    	mov    -0x254(%ebp),%ecx
+ 293:	51                   	push   %ecx
+ 294:	8b 95 b0 fd ff ff    	mov    -0x250(%ebp),%edx
+ 29a:	52                   	push   %edx
+ 29b:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+ 2a1:	50                   	push   %eax
+ 2a2:	68 88 0e 00 00       	push   $0xe88
+ 2a7:	6a 01                	push   $0x1
+ 2a9:	e8 c2 04 00 00       	call   770 <printf>
+ 2ae:	83 c4 20             	add    $0x20,%esp
+ 2b1:	e9 4a ff ff ff       	jmp    200 <ls+0x100>
+ 2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(2, "ls: cannot open %s\n", path);
+ 2c0:	83 ec 04             	sub    $0x4,%esp
+ 2c3:	57                   	push   %edi
+ 2c4:	68 60 0e 00 00       	push   $0xe60
+ 2c9:	6a 02                	push   $0x2
+ 2cb:	e8 a0 04 00 00       	call   770 <printf>
+    return;
+ 2d0:	83 c4 10             	add    $0x10,%esp
+}
+ 2d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2d6:	5b                   	pop    %ebx
+ 2d7:	5e                   	pop    %esi
+ 2d8:	5f                   	pop    %edi
+ 2d9:	5d                   	pop    %ebp
+ 2da:	c3                   	ret
+ 2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2df:	90                   	nop
+      printf(1, "ls: path too long\n");
+ 2e0:	83 ec 08             	sub    $0x8,%esp
+ 2e3:	68 95 0e 00 00       	push   $0xe95
+ 2e8:	6a 01                	push   $0x1
+ 2ea:	e8 81 04 00 00       	call   770 <printf>
+      break;
+ 2ef:	83 c4 10             	add    $0x10,%esp
+ 2f2:	e9 5b fe ff ff       	jmp    152 <ls+0x52>
+ 2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fe:	66 90                	xchg   %ax,%ax
+    printf(2, "ls: cannot stat %s\n", path);
+ 300:	83 ec 04             	sub    $0x4,%esp
+ 303:	57                   	push   %edi
+ 304:	68 74 0e 00 00       	push   $0xe74
+ 309:	6a 02                	push   $0x2
+ 30b:	e8 60 04 00 00       	call   770 <printf>
+    close(fd);
+ 310:	89 1c 24             	mov    %ebx,(%esp)
+ 313:	e8 d3 02 00 00       	call   5eb <close>
+    return;
+ 318:	83 c4 10             	add    $0x10,%esp
+}
+ 31b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 31e:	5b                   	pop    %ebx
+ 31f:	5e                   	pop    %esi
+ 320:	5f                   	pop    %edi
+ 321:	5d                   	pop    %ebp
+ 322:	c3                   	ret
+ 323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 327:	90                   	nop
+        printf(1, "ls: cannot stat %s\n", buf);
+ 328:	83 ec 04             	sub    $0x4,%esp
+ 32b:	57                   	push   %edi
+ 32c:	68 74 0e 00 00       	push   $0xe74
+ 331:	6a 01                	push   $0x1
+ 333:	e8 38 04 00 00       	call   770 <printf>
+        continue;
+ 338:	83 c4 10             	add    $0x10,%esp
+ 33b:	e9 c0 fe ff ff       	jmp    200 <ls+0x100>
+
+00000340 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 340:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 341:	31 c0                	xor    %eax,%eax
+{
+ 343:	89 e5                	mov    %esp,%ebp
+ 345:	53                   	push   %ebx
+ 346:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 349:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 350:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 354:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 357:	83 c0 01             	add    $0x1,%eax
+ 35a:	84 d2                	test   %dl,%dl
+ 35c:	75 f2                	jne    350 <strcpy+0x10>
+    ;
+  return os;
+}
+ 35e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 361:	89 c8                	mov    %ecx,%eax
+ 363:	c9                   	leave
+ 364:	c3                   	ret
+ 365:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	53                   	push   %ebx
+ 374:	8b 55 08             	mov    0x8(%ebp),%edx
+ 377:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 37a:	0f b6 02             	movzbl (%edx),%eax
+ 37d:	84 c0                	test   %al,%al
+ 37f:	75 17                	jne    398 <strcmp+0x28>
+ 381:	eb 3a                	jmp    3bd <strcmp+0x4d>
+ 383:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 387:	90                   	nop
+ 388:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 38c:	83 c2 01             	add    $0x1,%edx
+ 38f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 392:	84 c0                	test   %al,%al
+ 394:	74 1a                	je     3b0 <strcmp+0x40>
+    p++, q++;
+ 396:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 398:	0f b6 19             	movzbl (%ecx),%ebx
+ 39b:	38 c3                	cmp    %al,%bl
+ 39d:	74 e9                	je     388 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 39f:	29 d8                	sub    %ebx,%eax
+}
+ 3a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3a4:	c9                   	leave
+ 3a5:	c3                   	ret
+ 3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 3b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 3b4:	31 c0                	xor    %eax,%eax
+ 3b6:	29 d8                	sub    %ebx,%eax
+}
+ 3b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3bb:	c9                   	leave
+ 3bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 3bd:	0f b6 19             	movzbl (%ecx),%ebx
+ 3c0:	31 c0                	xor    %eax,%eax
+ 3c2:	eb db                	jmp    39f <strcmp+0x2f>
+ 3c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3cf:	90                   	nop
+
+000003d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 3d6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 3d9:	74 15                	je     3f0 <strlen+0x20>
+ 3db:	31 c0                	xor    %eax,%eax
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 3e0:	83 c0 01             	add    $0x1,%eax
+ 3e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 3e7:	89 c1                	mov    %eax,%ecx
+ 3e9:	75 f5                	jne    3e0 <strlen+0x10>
+    ;
+  return n;
+}
+ 3eb:	89 c8                	mov    %ecx,%eax
+ 3ed:	5d                   	pop    %ebp
+ 3ee:	c3                   	ret
+ 3ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 3f0:	31 c9                	xor    %ecx,%ecx
+}
+ 3f2:	5d                   	pop    %ebp
+ 3f3:	89 c8                	mov    %ecx,%eax
+ 3f5:	c3                   	ret
+ 3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000400 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 407:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 40a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 40d:	89 d7                	mov    %edx,%edi
+ 40f:	fc                   	cld
+ 410:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 412:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 415:	89 d0                	mov    %edx,%eax
+ 417:	c9                   	leave
+ 418:	c3                   	ret
+ 419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	8b 45 08             	mov    0x8(%ebp),%eax
+ 426:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 42a:	0f b6 10             	movzbl (%eax),%edx
+ 42d:	84 d2                	test   %dl,%dl
+ 42f:	75 12                	jne    443 <strchr+0x23>
+ 431:	eb 1d                	jmp    450 <strchr+0x30>
+ 433:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 437:	90                   	nop
+ 438:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 43c:	83 c0 01             	add    $0x1,%eax
+ 43f:	84 d2                	test   %dl,%dl
+ 441:	74 0d                	je     450 <strchr+0x30>
+    if(*s == c)
+ 443:	38 d1                	cmp    %dl,%cl
+ 445:	75 f1                	jne    438 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 447:	5d                   	pop    %ebp
+ 448:	c3                   	ret
+ 449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 450:	31 c0                	xor    %eax,%eax
+}
+ 452:	5d                   	pop    %ebp
+ 453:	c3                   	ret
+ 454:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 45f:	90                   	nop
+
+00000460 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 465:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 468:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 469:	31 db                	xor    %ebx,%ebx
+{
+ 46b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 46e:	eb 27                	jmp    497 <gets+0x37>
+    cc = read(0, &c, 1);
+ 470:	83 ec 04             	sub    $0x4,%esp
+ 473:	6a 01                	push   $0x1
+ 475:	56                   	push   %esi
+ 476:	6a 00                	push   $0x0
+ 478:	e8 5e 01 00 00       	call   5db <read>
+    if(cc < 1)
+ 47d:	83 c4 10             	add    $0x10,%esp
+ 480:	85 c0                	test   %eax,%eax
+ 482:	7e 1d                	jle    4a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 484:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 488:	8b 55 08             	mov    0x8(%ebp),%edx
+ 48b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 48f:	3c 0a                	cmp    $0xa,%al
+ 491:	74 10                	je     4a3 <gets+0x43>
+ 493:	3c 0d                	cmp    $0xd,%al
+ 495:	74 0c                	je     4a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 497:	89 df                	mov    %ebx,%edi
+ 499:	83 c3 01             	add    $0x1,%ebx
+ 49c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 49f:	7c cf                	jl     470 <gets+0x10>
+ 4a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 4a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 4aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4ad:	5b                   	pop    %ebx
+ 4ae:	5e                   	pop    %esi
+ 4af:	5f                   	pop    %edi
+ 4b0:	5d                   	pop    %ebp
+ 4b1:	c3                   	ret
+ 4b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	56                   	push   %esi
+ 4c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4c5:	83 ec 08             	sub    $0x8,%esp
+ 4c8:	6a 00                	push   $0x0
+ 4ca:	ff 75 08             	push   0x8(%ebp)
+ 4cd:	e8 31 01 00 00       	call   603 <open>
+  if(fd < 0)
+ 4d2:	83 c4 10             	add    $0x10,%esp
+ 4d5:	85 c0                	test   %eax,%eax
+ 4d7:	78 27                	js     500 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 4d9:	83 ec 08             	sub    $0x8,%esp
+ 4dc:	ff 75 0c             	push   0xc(%ebp)
+ 4df:	89 c3                	mov    %eax,%ebx
+ 4e1:	50                   	push   %eax
+ 4e2:	e8 34 01 00 00       	call   61b <fstat>
+  close(fd);
+ 4e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 4ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 4ec:	e8 fa 00 00 00       	call   5eb <close>
+  return r;
+ 4f1:	83 c4 10             	add    $0x10,%esp
+}
+ 4f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4f7:	89 f0                	mov    %esi,%eax
+ 4f9:	5b                   	pop    %ebx
+ 4fa:	5e                   	pop    %esi
+ 4fb:	5d                   	pop    %ebp
+ 4fc:	c3                   	ret
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 500:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 505:	eb ed                	jmp    4f4 <stat+0x34>
+ 507:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50e:	66 90                	xchg   %ax,%ax
+
+00000510 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	53                   	push   %ebx
+ 514:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 517:	0f be 02             	movsbl (%edx),%eax
+ 51a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 51d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 520:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 525:	77 1e                	ja     545 <atoi+0x35>
+ 527:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 530:	83 c2 01             	add    $0x1,%edx
+ 533:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 536:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 53a:	0f be 02             	movsbl (%edx),%eax
+ 53d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 540:	80 fb 09             	cmp    $0x9,%bl
+ 543:	76 eb                	jbe    530 <atoi+0x20>
+  return n;
+}
+ 545:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 548:	89 c8                	mov    %ecx,%eax
+ 54a:	c9                   	leave
+ 54b:	c3                   	ret
+ 54c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	56                   	push   %esi
+ 555:	8b 45 10             	mov    0x10(%ebp),%eax
+ 558:	8b 55 08             	mov    0x8(%ebp),%edx
+ 55b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 55e:	85 c0                	test   %eax,%eax
+ 560:	7e 13                	jle    575 <memmove+0x25>
+ 562:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 564:	89 d7                	mov    %edx,%edi
+ 566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 570:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 571:	39 f8                	cmp    %edi,%eax
+ 573:	75 fb                	jne    570 <memmove+0x20>
+  return vdst;
+}
+ 575:	5e                   	pop    %esi
+ 576:	89 d0                	mov    %edx,%eax
+ 578:	5f                   	pop    %edi
+ 579:	5d                   	pop    %ebp
+ 57a:	c3                   	ret
+
+0000057b <ccreate>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(ccreate)
+ 57b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <cfork>:
+SYSCALL(cfork)
+ 583:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <cgetrootdir>:
+SYSCALL(cgetrootdir)
+ 58b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <getcontrootdir>:
+SYSCALL(getcontrootdir)
+ 593:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <cpause>:
+SYSCALL(cpause)
+ 59b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <cresume>:
+SYSCALL(cresume)
+ 5a3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <cstart>:
+SYSCALL(cstart)
+ 5ab:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <cstop>:
+SYSCALL(cstop)
+ 5b3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <fork>:
+SYSCALL(fork)
+ 5bb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <exit>:
+SYSCALL(exit)
+ 5c3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <wait>:
+SYSCALL(wait)
+ 5cb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <pipe>:
+SYSCALL(pipe)
+ 5d3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <read>:
+SYSCALL(read)
+ 5db:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <write>:
+SYSCALL(write)
+ 5e3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <close>:
+SYSCALL(close)
+ 5eb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <kill>:
+SYSCALL(kill)
+ 5f3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <exec>:
+SYSCALL(exec)
+ 5fb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <open>:
+SYSCALL(open)
+ 603:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <mknod>:
+SYSCALL(mknod)
+ 60b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <unlink>:
+SYSCALL(unlink)
+ 613:	b8 12 00 00 00       	mov    $0x12,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <fstat>:
+SYSCALL(fstat)
+ 61b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <link>:
+SYSCALL(link)
+ 623:	b8 13 00 00 00       	mov    $0x13,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <mkdir>:
+SYSCALL(mkdir)
+ 62b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <chdir>:
+SYSCALL(chdir)
+ 633:	b8 09 00 00 00       	mov    $0x9,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <dup>:
+SYSCALL(dup)
+ 63b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <getpid>:
+SYSCALL(getpid)
+ 643:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <sbrk>:
+SYSCALL(sbrk)
+ 64b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <sleep>:
+SYSCALL(sleep)
+ 653:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <uptime>:
+SYSCALL(uptime)
+ 65b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <cps>:
+SYSCALL(cps)
+ 663:	b8 16 00 00 00       	mov    $0x16,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <mmap>:
+SYSCALL(mmap)
+ 66b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <munmap>:
+SYSCALL(munmap)
+ 673:	b8 20 00 00 00       	mov    $0x20,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <shmget>:
+SYSCALL(shmget)
+ 67b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <climit>:
+SYSCALL(climit)
+ 683:	b8 22 00 00 00       	mov    $0x22,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <spawn>:
+SYSCALL(spawn)
+ 68b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <clone>:
+SYSCALL(clone)
+ 693:	b8 24 00 00 00       	mov    $0x24,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <join>:
+SYSCALL(join)
+ 69b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <futex>:
+SYSCALL(futex)
+ 6a3:	b8 26 00 00 00       	mov    $0x26,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <ccheckpoint>:
+SYSCALL(ccheckpoint)
+ 6ab:	b8 27 00 00 00       	mov    $0x27,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <crestore>:
+SYSCALL(crestore)
+ 6b3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <czygote>:
+SYSCALL(czygote)
+ 6bb:	b8 29 00 00 00       	mov    $0x29,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <memstats>:
+SYSCALL(memstats)
+ 6c3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+ 6cb:	66 90                	xchg   %ax,%ax
+ 6cd:	66 90                	xchg   %ax,%ax
+ 6cf:	90                   	nop
+
+000006d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6d0:	55                   	push   %ebp
+ 6d1:	89 e5                	mov    %esp,%ebp
+ 6d3:	57                   	push   %edi
+ 6d4:	56                   	push   %esi
+ 6d5:	53                   	push   %ebx
+ 6d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 6d8:	89 d1                	mov    %edx,%ecx
+{
+ 6da:	83 ec 3c             	sub    $0x3c,%esp
+ 6dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 6e0:	85 d2                	test   %edx,%edx
+ 6e2:	0f 89 80 00 00 00    	jns    768 <printint+0x98>
+ 6e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 6ec:	74 7a                	je     768 <printint+0x98>
+    x = -xx;
+ 6ee:	f7 d9                	neg    %ecx
+    neg = 1;
+ 6f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 6f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 6f8:	31 f6                	xor    %esi,%esi
+ 6fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 700:	89 c8                	mov    %ecx,%eax
+ 702:	31 d2                	xor    %edx,%edx
+ 704:	89 f7                	mov    %esi,%edi
+ 706:	f7 f3                	div    %ebx
+ 708:	8d 76 01             	lea    0x1(%esi),%esi
+ 70b:	0f b6 92 0c 0f 00 00 	movzbl 0xf0c(%edx),%edx
+ 712:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 716:	89 ca                	mov    %ecx,%edx
+ 718:	89 c1                	mov    %eax,%ecx
+ 71a:	39 da                	cmp    %ebx,%edx
+ 71c:	73 e2                	jae    700 <printint+0x30>
+  if(neg)
+ 71e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 721:	85 c0                	test   %eax,%eax
+ 723:	74 07                	je     72c <printint+0x5c>
+    buf[i++] = '-';
+ 725:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 72a:	89 f7                	mov    %esi,%edi
+ 72c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 72f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 732:	01 df                	add    %ebx,%edi
+ 734:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 738:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 73b:	83 ec 04             	sub    $0x4,%esp
+ 73e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 741:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 744:	6a 01                	push   $0x1
+ 746:	50                   	push   %eax
+ 747:	56                   	push   %esi
+ 748:	e8 96 fe ff ff       	call   5e3 <write>
+  while(--i >= 0)
+ 74d:	89 f8                	mov    %edi,%eax
+ 74f:	83 c4 10             	add    $0x10,%esp
+ 752:	83 ef 01             	sub    $0x1,%edi
+ 755:	39 d8                	cmp    %ebx,%eax
+ 757:	75 df                	jne    738 <printint+0x68>
+}
+ 759:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 75c:	5b                   	pop    %ebx
+ 75d:	5e                   	pop    %esi
+ 75e:	5f                   	pop    %edi
+ 75f:	5d                   	pop    %ebp
+ 760:	c3                   	ret
+ 761:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 768:	31 c0                	xor    %eax,%eax
+ 76a:	eb 89                	jmp    6f5 <printint+0x25>
+ 76c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000770 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 770:	55                   	push   %ebp
+ 771:	89 e5                	mov    %esp,%ebp
+ 773:	57                   	push   %edi
+ 774:	56                   	push   %esi
+ 775:	53                   	push   %ebx
+ 776:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 779:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 77c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 77f:	0f b6 1e             	movzbl (%esi),%ebx
+ 782:	83 c6 01             	add    $0x1,%esi
+ 785:	84 db                	test   %bl,%bl
+ 787:	74 67                	je     7f0 <printf+0x80>
+ 789:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 78c:	31 d2                	xor    %edx,%edx
+ 78e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 791:	eb 34                	jmp    7c7 <printf+0x57>
+ 793:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 797:	90                   	nop
+ 798:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 79b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 7a0:	83 f8 25             	cmp    $0x25,%eax
+ 7a3:	74 18                	je     7bd <printf+0x4d>
+  write(fd, &c, 1);
+ 7a5:	83 ec 04             	sub    $0x4,%esp
+ 7a8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 7ab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7ae:	6a 01                	push   $0x1
+ 7b0:	50                   	push   %eax
+ 7b1:	57                   	push   %edi
+ 7b2:	e8 2c fe ff ff       	call   5e3 <write>
+ 7b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 7ba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 7bd:	0f b6 1e             	movzbl (%esi),%ebx
+ 7c0:	83 c6 01             	add    $0x1,%esi
+ 7c3:	84 db                	test   %bl,%bl
+ 7c5:	74 29                	je     7f0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 7c7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 7ca:	85 d2                	test   %edx,%edx
+ 7cc:	74 ca                	je     798 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 7ce:	83 fa 25             	cmp    $0x25,%edx
+ 7d1:	75 ea                	jne    7bd <printf+0x4d>
+      if(c == 'd'){
+ 7d3:	83 f8 25             	cmp    $0x25,%eax
+ 7d6:	0f 84 24 01 00 00    	je     900 <printf+0x190>
+ 7dc:	83 e8 63             	sub    $0x63,%eax
+ 7df:	83 f8 15             	cmp    $0x15,%eax
+ 7e2:	77 1c                	ja     800 <printf+0x90>
+ 7e4:	ff 24 85 b4 0e 00 00 	jmp    *0xeb4(,%eax,4)
+ 7eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7ef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 7f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7f3:	5b                   	pop    %ebx
+ 7f4:	5e                   	pop    %esi
+ 7f5:	5f                   	pop    %edi
+ 7f6:	5d                   	pop    %ebp
+ 7f7:	c3                   	ret
+ 7f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ff:	90                   	nop
+  write(fd, &c, 1);
+ 800:	83 ec 04             	sub    $0x4,%esp
+ 803:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 806:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 80a:	6a 01                	push   $0x1
+ 80c:	52                   	push   %edx
+ 80d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 810:	57                   	push   %edi
+ 811:	e8 cd fd ff ff       	call   5e3 <write>
+ 816:	83 c4 0c             	add    $0xc,%esp
+ 819:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 81c:	6a 01                	push   $0x1
+ 81e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 821:	52                   	push   %edx
+ 822:	57                   	push   %edi
+ 823:	e8 bb fd ff ff       	call   5e3 <write>
+        putc(fd, c);
+ 828:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 82b:	31 d2                	xor    %edx,%edx
+ 82d:	eb 8e                	jmp    7bd <printf+0x4d>
+ 82f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 830:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 833:	83 ec 0c             	sub    $0xc,%esp
+ 836:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 83b:	8b 13                	mov    (%ebx),%edx
+ 83d:	6a 00                	push   $0x0
+ 83f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 841:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 844:	e8 87 fe ff ff       	call   6d0 <printint>
+        ap++;
+ 849:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 84c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 84f:	31 d2                	xor    %edx,%edx
+ 851:	e9 67 ff ff ff       	jmp    7bd <printf+0x4d>
+ 856:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 85d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 860:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 863:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 865:	83 c0 04             	add    $0x4,%eax
+ 868:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 86b:	85 db                	test   %ebx,%ebx
+ 86d:	0f 84 9d 00 00 00    	je     910 <printf+0x1a0>
+        while(*s != 0){
+ 873:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 876:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 878:	84 c0                	test   %al,%al
+ 87a:	0f 84 3d ff ff ff    	je     7bd <printf+0x4d>
+ 880:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 883:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 886:	89 de                	mov    %ebx,%esi
+ 888:	89 d3                	mov    %edx,%ebx
+ 88a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 890:	83 ec 04             	sub    $0x4,%esp
+ 893:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 896:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 899:	6a 01                	push   $0x1
+ 89b:	53                   	push   %ebx
+ 89c:	57                   	push   %edi
+ 89d:	e8 41 fd ff ff       	call   5e3 <write>
+        while(*s != 0){
+ 8a2:	0f b6 06             	movzbl (%esi),%eax
+ 8a5:	83 c4 10             	add    $0x10,%esp
+ 8a8:	84 c0                	test   %al,%al
+ 8aa:	75 e4                	jne    890 <printf+0x120>
+      state = 0;
+ 8ac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 8af:	31 d2                	xor    %edx,%edx
+ 8b1:	e9 07 ff ff ff       	jmp    7bd <printf+0x4d>
+ 8b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8bd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 8c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8c3:	83 ec 0c             	sub    $0xc,%esp
+ 8c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 8cb:	8b 13                	mov    (%ebx),%edx
+ 8cd:	6a 01                	push   $0x1
+ 8cf:	e9 6b ff ff ff       	jmp    83f <printf+0xcf>
+ 8d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 8d8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 8db:	83 ec 04             	sub    $0x4,%esp
+ 8de:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 8e1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 8e3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 8e6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 8e9:	6a 01                	push   $0x1
+ 8eb:	52                   	push   %edx
+ 8ec:	57                   	push   %edi
+ 8ed:	e8 f1 fc ff ff       	call   5e3 <write>
+        ap++;
+ 8f2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8f5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8f8:	31 d2                	xor    %edx,%edx
+ 8fa:	e9 be fe ff ff       	jmp    7bd <printf+0x4d>
+ 8ff:	90                   	nop
+  write(fd, &c, 1);
+ 900:	83 ec 04             	sub    $0x4,%esp
+ 903:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 906:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 909:	6a 01                	push   $0x1
+ 90b:	e9 11 ff ff ff       	jmp    821 <printf+0xb1>
+ 910:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 915:	bb aa 0e 00 00       	mov    $0xeaa,%ebx
+ 91a:	e9 61 ff ff ff       	jmp    880 <printf+0x110>
+ 91f:	90                   	nop
+
+00000920 <runfree>:
+
+// Give the n pages at r back to the free runs, merging them with
+// adjacent runs, and shrink the heap if the end of it is free.
+static void
+runfree(struct page *r, uint n)
+{
+ 920:	55                   	push   %ebp
+  struct page **pp, *prev;
+
+  r->kind = PFREE;
+ 921:	b9 03 00 00 00       	mov    $0x3,%ecx
+{
+ 926:	89 e5                	mov    %esp,%ebp
+ 928:	57                   	push   %edi
+ 929:	56                   	push   %esi
+ 92a:	53                   	push   %ebx
+ 92b:	89 c3                	mov    %eax,%ebx
+ 92d:	83 ec 0c             	sub    $0xc,%esp
+  r->kind = PFREE;
+ 930:	66 89 08             	mov    %cx,(%eax)
+  r->npages = n;
+  prev = 0;
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 933:	8b 0d b4 12 00 00    	mov    0x12b4,%ecx
+  r->npages = n;
+ 939:	89 50 04             	mov    %edx,0x4(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 93c:	85 c9                	test   %ecx,%ecx
+ 93e:	0f 84 1f 01 00 00    	je     a63 <runfree+0x143>
+ 944:	39 c1                	cmp    %eax,%ecx
+ 946:	0f 83 f7 00 00 00    	jae    a43 <runfree+0x123>
+ 94c:	89 c8                	mov    %ecx,%eax
+ 94e:	eb 04                	jmp    954 <runfree+0x34>
+ 950:	39 d8                	cmp    %ebx,%eax
+ 952:	73 09                	jae    95d <runfree+0x3d>
+ 954:	89 c2                	mov    %eax,%edx
+ 956:	8b 40 14             	mov    0x14(%eax),%eax
+ 959:	85 c0                	test   %eax,%eax
+ 95b:	75 f3                	jne    950 <runfree+0x30>
+    prev = *pp;
+  r->next = *pp;
+ 95d:	89 43 14             	mov    %eax,0x14(%ebx)
+  *pp = r;
+ 960:	89 5a 14             	mov    %ebx,0x14(%edx)
+
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 963:	8b 43 14             	mov    0x14(%ebx),%eax
+ 966:	85 c0                	test   %eax,%eax
+ 968:	74 12                	je     97c <runfree+0x5c>
+ 96a:	8b 7b 04             	mov    0x4(%ebx),%edi
+ 96d:	89 fe                	mov    %edi,%esi
+ 96f:	c1 e6 0c             	shl    $0xc,%esi
+ 972:	01 de                	add    %ebx,%esi
+ 974:	39 f0                	cmp    %esi,%eax
+ 976:	0f 84 a4 00 00 00    	je     a20 <runfree+0x100>
+    r->npages += r->next->npages;
+    r->next = r->next->next;
+  }
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 97c:	8b 72 04             	mov    0x4(%edx),%esi
+ 97f:	89 f0                	mov    %esi,%eax
+ 981:	c1 e0 0c             	shl    $0xc,%eax
+ 984:	01 d0                	add    %edx,%eax
+ 986:	39 c3                	cmp    %eax,%ebx
+ 988:	74 16                	je     9a0 <runfree+0x80>
+    pp = &runs;
+    while(*pp != r)
+      pp = &(*pp)->next;
+  }
+
+  if(r->next == 0 && r->npages >= TRIM &&
+ 98a:	8b 43 14             	mov    0x14(%ebx),%eax
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 98d:	8d 72 14             	lea    0x14(%edx),%esi
+  if(r->next == 0 && r->npages >= TRIM &&
+ 990:	85 c0                	test   %eax,%eax
+ 992:	74 3c                	je     9d0 <runfree+0xb0>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+    *pp = 0;
+    sbrk(-(int)(r->npages*PGSIZE));
+    heapend = (char*)r;
+  }
+}
+ 994:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 997:	5b                   	pop    %ebx
+ 998:	5e                   	pop    %esi
+ 999:	5f                   	pop    %edi
+ 99a:	5d                   	pop    %ebp
+ 99b:	c3                   	ret
+ 99c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    prev->npages += r->npages;
+ 9a0:	03 73 04             	add    0x4(%ebx),%esi
+ 9a3:	89 72 04             	mov    %esi,0x4(%edx)
+    prev->next = r->next;
+ 9a6:	8b 43 14             	mov    0x14(%ebx),%eax
+ 9a9:	89 42 14             	mov    %eax,0x14(%edx)
+    while(*pp != r)
+ 9ac:	39 d1                	cmp    %edx,%ecx
+ 9ae:	0f 84 c5 00 00 00    	je     a79 <runfree+0x159>
+ 9b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      pp = &(*pp)->next;
+ 9b8:	89 cb                	mov    %ecx,%ebx
+ 9ba:	8b 49 14             	mov    0x14(%ecx),%ecx
+    while(*pp != r)
+ 9bd:	39 d1                	cmp    %edx,%ecx
+ 9bf:	75 f7                	jne    9b8 <runfree+0x98>
+      pp = &(*pp)->next;
+ 9c1:	8d 73 14             	lea    0x14(%ebx),%esi
+ 9c4:	89 cb                	mov    %ecx,%ebx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 9c6:	85 c0                	test   %eax,%eax
+ 9c8:	75 ca                	jne    994 <runfree+0x74>
+ 9ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 9d0:	8b 53 04             	mov    0x4(%ebx),%edx
+ 9d3:	83 fa 1f             	cmp    $0x1f,%edx
+ 9d6:	76 bc                	jbe    994 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 9d8:	c1 e2 0c             	shl    $0xc,%edx
+ 9db:	01 da                	add    %ebx,%edx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 9dd:	39 15 b0 12 00 00    	cmp    %edx,0x12b0
+ 9e3:	75 af                	jne    994 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 9e5:	83 ec 0c             	sub    $0xc,%esp
+ 9e8:	6a 00                	push   $0x0
+ 9ea:	e8 5c fc ff ff       	call   64b <sbrk>
+ 9ef:	83 c4 10             	add    $0x10,%esp
+ 9f2:	39 05 b0 12 00 00    	cmp    %eax,0x12b0
+ 9f8:	75 9a                	jne    994 <runfree+0x74>
+    *pp = 0;
+ 9fa:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    sbrk(-(int)(r->npages*PGSIZE));
+ a00:	8b 43 04             	mov    0x4(%ebx),%eax
+ a03:	83 ec 0c             	sub    $0xc,%esp
+ a06:	c1 e0 0c             	shl    $0xc,%eax
+ a09:	f7 d8                	neg    %eax
+ a0b:	50                   	push   %eax
+ a0c:	e8 3a fc ff ff       	call   64b <sbrk>
+    heapend = (char*)r;
+ a11:	89 1d b0 12 00 00    	mov    %ebx,0x12b0
+ a17:	83 c4 10             	add    $0x10,%esp
+}
+ a1a:	e9 75 ff ff ff       	jmp    994 <runfree+0x74>
+ a1f:	90                   	nop
+    r->npages += r->next->npages;
+ a20:	03 78 04             	add    0x4(%eax),%edi
+ a23:	89 7b 04             	mov    %edi,0x4(%ebx)
+    r->next = r->next->next;
+ a26:	8b 40 14             	mov    0x14(%eax),%eax
+ a29:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ a2c:	8b 72 04             	mov    0x4(%edx),%esi
+ a2f:	89 f0                	mov    %esi,%eax
+ a31:	c1 e0 0c             	shl    $0xc,%eax
+ a34:	01 d0                	add    %edx,%eax
+ a36:	39 c3                	cmp    %eax,%ebx
+ a38:	0f 85 4c ff ff ff    	jne    98a <runfree+0x6a>
+ a3e:	e9 5d ff ff ff       	jmp    9a0 <runfree+0x80>
+  r->next = *pp;
+ a43:	89 48 14             	mov    %ecx,0x14(%eax)
+  *pp = r;
+ a46:	a3 b4 12 00 00       	mov    %eax,0x12b4
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ a4b:	89 d0                	mov    %edx,%eax
+ a4d:	c1 e0 0c             	shl    $0xc,%eax
+ a50:	01 d8                	add    %ebx,%eax
+ a52:	39 c1                	cmp    %eax,%ecx
+ a54:	74 2f                	je     a85 <runfree+0x165>
+  if(r->next == 0 && r->npages >= TRIM &&
+ a56:	8b 43 14             	mov    0x14(%ebx),%eax
+ a59:	be b4 12 00 00       	mov    $0x12b4,%esi
+ a5e:	e9 2d ff ff ff       	jmp    990 <runfree+0x70>
+  r->next = *pp;
+ a63:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ a6a:	be b4 12 00 00       	mov    $0x12b4,%esi
+  *pp = r;
+ a6f:	a3 b4 12 00 00       	mov    %eax,0x12b4
+  if(r->next == 0 && r->npages >= TRIM &&
+ a74:	e9 5a ff ff ff       	jmp    9d3 <runfree+0xb3>
+    while(*pp != r)
+ a79:	89 cb                	mov    %ecx,%ebx
+    pp = &runs;
+ a7b:	be b4 12 00 00       	mov    $0x12b4,%esi
+ a80:	e9 0b ff ff ff       	jmp    990 <runfree+0x70>
+    r->npages += r->next->npages;
+ a85:	03 51 04             	add    0x4(%ecx),%edx
+ a88:	89 53 04             	mov    %edx,0x4(%ebx)
+    r->next = r->next->next;
+ a8b:	8b 41 14             	mov    0x14(%ecx),%eax
+ a8e:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ a91:	eb c3                	jmp    a56 <runfree+0x136>
+ a93:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000aa0 <runalloc>:
+
+// Take a run of n pages from the start of the first free run
+// long enough, which keeps the end of the heap free to trim.
+static struct page*
+runalloc(uint n)
+{
+ aa0:	55                   	push   %ebp
+ aa1:	89 e5                	mov    %esp,%ebp
+ aa3:	57                   	push   %edi
+ aa4:	56                   	push   %esi
+ aa5:	89 c6                	mov    %eax,%esi
+ aa7:	53                   	push   %ebx
+ aa8:	83 ec 1c             	sub    $0x1c,%esp
+  struct page **pp, *r, *rest;
+
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ aab:	8b 1d b4 12 00 00    	mov    0x12b4,%ebx
+ ab1:	85 db                	test   %ebx,%ebx
+ ab3:	74 4d                	je     b02 <runalloc+0x62>
+ ab5:	b9 b4 12 00 00       	mov    $0x12b4,%ecx
+    if(r->npages < n)
+ aba:	39 73 04             	cmp    %esi,0x4(%ebx)
+ abd:	72 39                	jb     af8 <runalloc+0x58>
+      continue;
+    if(r->npages == n){
+ abf:	0f 84 9b 00 00 00    	je     b60 <runalloc+0xc0>
+      *pp = r->next;
+    } else {
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ ac5:	89 f0                	mov    %esi,%eax
+      rest->kind = PFREE;
+ ac7:	ba 03 00 00 00       	mov    $0x3,%edx
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ acc:	c1 e0 0c             	shl    $0xc,%eax
+ acf:	01 d8                	add    %ebx,%eax
+      rest->kind = PFREE;
+ ad1:	66 89 10             	mov    %dx,(%eax)
+      rest->npages = r->npages - n;
+ ad4:	8b 53 04             	mov    0x4(%ebx),%edx
+ ad7:	29 f2                	sub    %esi,%edx
+ ad9:	89 50 04             	mov    %edx,0x4(%eax)
+      rest->next = r->next;
+ adc:	8b 53 14             	mov    0x14(%ebx),%edx
+ adf:	89 50 14             	mov    %edx,0x14(%eax)
+      *pp = rest;
+ ae2:	89 01                	mov    %eax,(%ecx)
+      r->npages = n;
+ ae4:	89 73 04             	mov    %esi,0x4(%ebx)
+    }
+    return r;
+  }
+  return morecore(n);
+}
+ ae7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ aea:	89 d8                	mov    %ebx,%eax
+ aec:	5b                   	pop    %ebx
+ aed:	5e                   	pop    %esi
+ aee:	5f                   	pop    %edi
+ aef:	5d                   	pop    %ebp
+ af0:	c3                   	ret
+ af1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ af8:	8d 4b 14             	lea    0x14(%ebx),%ecx
+ afb:	8b 5b 14             	mov    0x14(%ebx),%ebx
+ afe:	85 db                	test   %ebx,%ebx
+ b00:	75 b8                	jne    aba <runalloc+0x1a>
+  m = n < MINCORE ? MINCORE : n;
+ b02:	bf 08 00 00 00       	mov    $0x8,%edi
+ b07:	39 fe                	cmp    %edi,%esi
+ b09:	0f 43 fe             	cmovae %esi,%edi
+  brk = sbrk(0);
+ b0c:	83 ec 0c             	sub    $0xc,%esp
+ b0f:	6a 00                	push   $0x0
+ b11:	e8 35 fb ff ff       	call   64b <sbrk>
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ b16:	89 fa                	mov    %edi,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ b18:	89 c3                	mov    %eax,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ b1a:	c1 e2 0c             	shl    $0xc,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ b1d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ b20:	f7 db                	neg    %ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ b22:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ b25:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ b2b:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+ b2e:	89 04 24             	mov    %eax,(%esp)
+ b31:	e8 15 fb ff ff       	call   64b <sbrk>
+ b36:	83 c4 10             	add    $0x10,%esp
+ b39:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ b3c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ b3f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b42:	74 3e                	je     b82 <runalloc+0xe2>
+  r = (struct page*)(brk + pad);
+ b44:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ b46:	01 da                	add    %ebx,%edx
+ b48:	89 15 b0 12 00 00    	mov    %edx,0x12b0
+  if(m > n)
+ b4e:	39 fe                	cmp    %edi,%esi
+ b50:	72 1e                	jb     b70 <runalloc+0xd0>
+  r->npages = n;
+ b52:	89 73 04             	mov    %esi,0x4(%ebx)
+  return r;
+ b55:	eb 90                	jmp    ae7 <runalloc+0x47>
+ b57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b5e:	66 90                	xchg   %ax,%ax
+      *pp = r->next;
+ b60:	8b 43 14             	mov    0x14(%ebx),%eax
+ b63:	89 01                	mov    %eax,(%ecx)
+}
+ b65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b68:	89 d8                	mov    %ebx,%eax
+ b6a:	5b                   	pop    %ebx
+ b6b:	5e                   	pop    %esi
+ b6c:	5f                   	pop    %edi
+ b6d:	5d                   	pop    %ebp
+ b6e:	c3                   	ret
+ b6f:	90                   	nop
+    runfree((struct page*)((char*)r + n*PGSIZE), m - n);
+ b70:	89 f0                	mov    %esi,%eax
+ b72:	29 f7                	sub    %esi,%edi
+ b74:	c1 e0 0c             	shl    $0xc,%eax
+ b77:	89 fa                	mov    %edi,%edx
+ b79:	01 d8                	add    %ebx,%eax
+ b7b:	e8 a0 fd ff ff       	call   920 <runfree>
+ b80:	eb d0                	jmp    b52 <runalloc+0xb2>
+    if(sbrk(pad + m*PGSIZE) == (char*)-1)
+ b82:	89 f7                	mov    %esi,%edi
+ b84:	83 ec 0c             	sub    $0xc,%esp
+ b87:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ b8a:	c1 e7 0c             	shl    $0xc,%edi
+ b8d:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+ b90:	50                   	push   %eax
+ b91:	e8 b5 fa ff ff       	call   64b <sbrk>
+ b96:	83 c4 10             	add    $0x10,%esp
+ b99:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ b9c:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b9f:	74 0c                	je     bad <runalloc+0x10d>
+  r = (struct page*)(brk + pad);
+ ba1:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ ba3:	01 df                	add    %ebx,%edi
+ ba5:	89 3d b0 12 00 00    	mov    %edi,0x12b0
+  if(m > n)
+ bab:	eb a5                	jmp    b52 <runalloc+0xb2>
+      return 0;
+ bad:	31 db                	xor    %ebx,%ebx
+ baf:	e9 33 ff ff ff       	jmp    ae7 <runalloc+0x47>
+ bb4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ bbf:	90                   	nop
+
+00000bc0 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+ bc0:	55                   	push   %ebp
+ bc1:	89 e5                	mov    %esp,%ebp
+ bc3:	56                   	push   %esi
+ bc4:	53                   	push   %ebx
+ bc5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  struct page *p;
+
+  if(ap == 0)
+ bc8:	85 c9                	test   %ecx,%ecx
+ bca:	74 1c                	je     be8 <free+0x28>
+    return;
+  p = (struct page*)((uint)ap & ~(PGSIZE-1));
+ bcc:	89 c8                	mov    %ecx,%eax
+ bce:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  switch(p->kind){
+ bd3:	0f b7 10             	movzwl (%eax),%edx
+ bd6:	66 83 fa 02          	cmp    $0x2,%dx
+ bda:	74 14                	je     bf0 <free+0x30>
+ bdc:	66 83 fa 04          	cmp    $0x4,%dx
+ be0:	74 66                	je     c48 <free+0x88>
+ be2:	66 83 fa 01          	cmp    $0x1,%dx
+ be6:	74 18                	je     c00 <free+0x40>
+    break;
+  case PMAP:
+    munmap(p, p->npages*PGSIZE);
+    break;
+  }
+}
+ be8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ beb:	5b                   	pop    %ebx
+ bec:	5e                   	pop    %esi
+ bed:	5d                   	pop    %ebp
+ bee:	c3                   	ret
+ bef:	90                   	nop
+    runfree(p, p->npages);
+ bf0:	8b 50 04             	mov    0x4(%eax),%edx
+}
+ bf3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ bf6:	5b                   	pop    %ebx
+ bf7:	5e                   	pop    %esi
+ bf8:	5d                   	pop    %ebp
+    runfree(p, p->npages);
+ bf9:	e9 22 fd ff ff       	jmp    920 <runfree>
+ bfe:	66 90                	xchg   %ax,%ax
+  b->next = p->free;
+ c00:	8b 50 0c             	mov    0xc(%eax),%edx
+ c03:	89 11                	mov    %edx,(%ecx)
+  if(p->nfree++ == 0)
+ c05:	8b 50 08             	mov    0x8(%eax),%edx
+  p->free = b;
+ c08:	89 48 0c             	mov    %ecx,0xc(%eax)
+  if(p->nfree++ == 0)
+ c0b:	8d 5a 01             	lea    0x1(%edx),%ebx
+ c0e:	89 58 08             	mov    %ebx,0x8(%eax)
+ c11:	85 d2                	test   %edx,%edx
+ c13:	74 53                	je     c68 <free+0xa8>
+  if(p->nfree == nblocks(p->class)){
+ c15:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ c19:	8d 4e 04             	lea    0x4(%esi),%ecx
+ c1c:	ba e0 0f 00 00       	mov    $0xfe0,%edx
+ c21:	d3 fa                	sar    %cl,%edx
+  if(p->nfree == nblocks(p->class)){
+ c23:	39 da                	cmp    %ebx,%edx
+ c25:	75 c1                	jne    be8 <free+0x28>
+  if(p->prev)
+ c27:	8b 48 18             	mov    0x18(%eax),%ecx
+    p->prev->next = p->next;
+ c2a:	8b 50 14             	mov    0x14(%eax),%edx
+  if(p->prev)
+ c2d:	85 c9                	test   %ecx,%ecx
+ c2f:	74 6f                	je     ca0 <free+0xe0>
+    p->prev->next = p->next;
+ c31:	89 51 14             	mov    %edx,0x14(%ecx)
+  if(p->next)
+ c34:	85 d2                	test   %edx,%edx
+ c36:	74 06                	je     c3e <free+0x7e>
+    p->next->prev = p->prev;
+ c38:	8b 48 18             	mov    0x18(%eax),%ecx
+ c3b:	89 4a 18             	mov    %ecx,0x18(%edx)
+    runfree(p, 1);
+ c3e:	ba 01 00 00 00       	mov    $0x1,%edx
+ c43:	eb ae                	jmp    bf3 <free+0x33>
+ c45:	8d 76 00             	lea    0x0(%esi),%esi
+    munmap(p, p->npages*PGSIZE);
+ c48:	8b 50 04             	mov    0x4(%eax),%edx
+ c4b:	83 ec 08             	sub    $0x8,%esp
+ c4e:	c1 e2 0c             	shl    $0xc,%edx
+ c51:	52                   	push   %edx
+ c52:	50                   	push   %eax
+ c53:	e8 1b fa ff ff       	call   673 <munmap>
+    break;
+ c58:	83 c4 10             	add    $0x10,%esp
+}
+ c5b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ c5e:	5b                   	pop    %ebx
+ c5f:	5e                   	pop    %esi
+ c60:	5d                   	pop    %ebp
+ c61:	c3                   	ret
+ c62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  p->next = partial[p->class];
+ c68:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  p->prev = 0;
+ c6c:	c7 40 18 00 00 00 00 	movl   $0x0,0x18(%eax)
+  p->next = partial[p->class];
+ c73:	bb 01 00 00 00       	mov    $0x1,%ebx
+ c78:	8b 14 b5 b8 12 00 00 	mov    0x12b8(,%esi,4),%edx
+ c7f:	89 50 14             	mov    %edx,0x14(%eax)
+  if(p->next)
+ c82:	85 d2                	test   %edx,%edx
+ c84:	74 0a                	je     c90 <free+0xd0>
+    p->next->prev = p;
+ c86:	89 42 18             	mov    %eax,0x18(%edx)
+  partial[p->class] = p;
+ c89:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  if(p->nfree == nblocks(p->class)){
+ c8d:	8b 58 08             	mov    0x8(%eax),%ebx
+  partial[p->class] = p;
+ c90:	89 04 b5 b8 12 00 00 	mov    %eax,0x12b8(,%esi,4)
+}
+ c97:	eb 80                	jmp    c19 <free+0x59>
+ c99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ ca0:	89 14 b5 b8 12 00 00 	mov    %edx,0x12b8(,%esi,4)
+ ca7:	eb 8b                	jmp    c34 <free+0x74>
+ ca9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000cb0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ cb0:	55                   	push   %ebp
+ cb1:	89 e5                	mov    %esp,%ebp
+ cb3:	56                   	push   %esi
+ cb4:	53                   	push   %ebx
+ cb5:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct page *p;
+  uint n;
+
+  if(nbytes <= MAXSMALL)
+ cb8:	3d 00 04 00 00       	cmp    $0x400,%eax
+ cbd:	76 71                	jbe    d30 <malloc+0x80>
+    return smallalloc(sizeclass(nbytes));
+  if(nbytes > 0x7fffffff)
+ cbf:	85 c0                	test   %eax,%eax
+ cc1:	0f 88 d9 00 00 00    	js     da0 <malloc+0xf0>
+    return 0;
+  n = (nbytes + HDRSIZE + PGSIZE-1) / PGSIZE;
+ cc7:	8d 90 1f 10 00 00    	lea    0x101f(%eax),%edx
+ ccd:	89 d3                	mov    %edx,%ebx
+ ccf:	c1 eb 0c             	shr    $0xc,%ebx
+  if(nbytes >= MAPMIN){
+ cd2:	3d ff ff 00 00       	cmp    $0xffff,%eax
+ cd7:	77 27                	ja     d00 <malloc+0x50>
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    if(p == MAP_FAILED)
+      return 0;
+    p->kind = PMAP;
+  } else {
+    if((p = runalloc(n)) == 0)
+ cd9:	89 d8                	mov    %ebx,%eax
+ cdb:	e8 c0 fd ff ff       	call   aa0 <runalloc>
+ ce0:	85 c0                	test   %eax,%eax
+ ce2:	0f 84 b8 00 00 00    	je     da0 <malloc+0xf0>
+      return 0;
+    p->kind = PRUN;
+ ce8:	ba 02 00 00 00       	mov    $0x2,%edx
+ ced:	66 89 10             	mov    %dx,(%eax)
+  }
+  p->npages = n;
+ cf0:	89 58 04             	mov    %ebx,0x4(%eax)
+  return (char*)p + HDRSIZE;
+ cf3:	8d 58 20             	lea    0x20(%eax),%ebx
+}
+ cf6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ cf9:	89 d8                	mov    %ebx,%eax
+ cfb:	5b                   	pop    %ebx
+ cfc:	5e                   	pop    %esi
+ cfd:	5d                   	pop    %ebp
+ cfe:	c3                   	ret
+ cff:	90                   	nop
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+ d00:	83 ec 08             	sub    $0x8,%esp
+ d03:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+ d09:	6a 00                	push   $0x0
+ d0b:	6a ff                	push   $0xffffffff
+ d0d:	6a 22                	push   $0x22
+ d0f:	6a 03                	push   $0x3
+ d11:	52                   	push   %edx
+ d12:	6a 00                	push   $0x0
+ d14:	e8 52 f9 ff ff       	call   66b <mmap>
+    if(p == MAP_FAILED)
+ d19:	83 c4 20             	add    $0x20,%esp
+ d1c:	83 f8 ff             	cmp    $0xffffffff,%eax
+ d1f:	74 7f                	je     da0 <malloc+0xf0>
+    p->kind = PMAP;
+ d21:	b9 04 00 00 00       	mov    $0x4,%ecx
+ d26:	66 89 08             	mov    %cx,(%eax)
+ d29:	eb c5                	jmp    cf0 <malloc+0x40>
+ d2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d2f:	90                   	nop
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ d30:	83 f8 10             	cmp    $0x10,%eax
+ d33:	0f 86 07 01 00 00    	jbe    e40 <malloc+0x190>
+ d39:	31 db                	xor    %ebx,%ebx
+ d3b:	ba 10 00 00 00       	mov    $0x10,%edx
+ d40:	83 c3 01             	add    $0x1,%ebx
+ d43:	89 d6                	mov    %edx,%esi
+ d45:	89 d9                	mov    %ebx,%ecx
+ d47:	d3 e6                	shl    %cl,%esi
+ d49:	39 c6                	cmp    %eax,%esi
+ d4b:	72 f3                	jb     d40 <malloc+0x90>
+  if((p = partial[c]) == 0){
+ d4d:	8b 14 9d b8 12 00 00 	mov    0x12b8(,%ebx,4),%edx
+ d54:	85 d2                	test   %edx,%edx
+ d56:	74 58                	je     db0 <malloc+0x100>
+  if((b = p->free) != 0){
+ d58:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ d5b:	8b 4a 08             	mov    0x8(%edx),%ecx
+  if((b = p->free) != 0){
+ d5e:	85 db                	test   %ebx,%ebx
+ d60:	0f 84 aa 00 00 00    	je     e10 <malloc+0x160>
+    p->free = b->next;
+ d66:	8b 03                	mov    (%ebx),%eax
+ d68:	89 42 0c             	mov    %eax,0xc(%edx)
+  if(--p->nfree == 0)
+ d6b:	83 e9 01             	sub    $0x1,%ecx
+ d6e:	89 4a 08             	mov    %ecx,0x8(%edx)
+ d71:	75 83                	jne    cf6 <malloc+0x46>
+  if(p->prev)
+ d73:	8b 4a 18             	mov    0x18(%edx),%ecx
+    p->prev->next = p->next;
+ d76:	8b 42 14             	mov    0x14(%edx),%eax
+  if(p->prev)
+ d79:	85 c9                	test   %ecx,%ecx
+ d7b:	0f 84 cf 00 00 00    	je     e50 <malloc+0x1a0>
+    p->prev->next = p->next;
+ d81:	89 41 14             	mov    %eax,0x14(%ecx)
+  if(p->next)
+ d84:	85 c0                	test   %eax,%eax
+ d86:	0f 84 6a ff ff ff    	je     cf6 <malloc+0x46>
+    p->next->prev = p->prev;
+ d8c:	8b 52 18             	mov    0x18(%edx),%edx
+ d8f:	89 50 18             	mov    %edx,0x18(%eax)
+ d92:	e9 5f ff ff ff       	jmp    cf6 <malloc+0x46>
+ d97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d9e:	66 90                	xchg   %ax,%ax
+}
+ da0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+ da3:	31 db                	xor    %ebx,%ebx
+}
+ da5:	89 d8                	mov    %ebx,%eax
+ da7:	5b                   	pop    %ebx
+ da8:	5e                   	pop    %esi
+ da9:	5d                   	pop    %ebp
+ daa:	c3                   	ret
+ dab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ daf:	90                   	nop
+    if((p = runalloc(1)) == 0)
+ db0:	b8 01 00 00 00       	mov    $0x1,%eax
+ db5:	e8 e6 fc ff ff       	call   aa0 <runalloc>
+ dba:	89 c2                	mov    %eax,%edx
+ dbc:	85 c0                	test   %eax,%eax
+ dbe:	74 e0                	je     da0 <malloc+0xf0>
+    p->kind = PSMALL;
+ dc0:	b8 01 00 00 00       	mov    $0x1,%eax
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ dc5:	8d 4b 04             	lea    0x4(%ebx),%ecx
+    p->class = c;
+ dc8:	66 89 5a 02          	mov    %bx,0x2(%edx)
+ dcc:	0f b7 db             	movzwl %bx,%ebx
+    p->kind = PSMALL;
+ dcf:	66 89 02             	mov    %ax,(%edx)
+    p->fresh = (char*)p + HDRSIZE;
+ dd2:	8d 42 20             	lea    0x20(%edx),%eax
+ dd5:	89 42 10             	mov    %eax,0x10(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ dd8:	b8 e0 0f 00 00       	mov    $0xfe0,%eax
+ ddd:	d3 f8                	sar    %cl,%eax
+    p->free = 0;
+ ddf:	c7 42 0c 00 00 00 00 	movl   $0x0,0xc(%edx)
+    p->nfree = nblocks(c);
+ de6:	89 42 08             	mov    %eax,0x8(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ de9:	89 c1                	mov    %eax,%ecx
+  p->next = partial[p->class];
+ deb:	8b 04 9d b8 12 00 00 	mov    0x12b8(,%ebx,4),%eax
+  p->prev = 0;
+ df2:	c7 42 18 00 00 00 00 	movl   $0x0,0x18(%edx)
+  p->next = partial[p->class];
+ df9:	89 42 14             	mov    %eax,0x14(%edx)
+  if(p->next)
+ dfc:	85 c0                	test   %eax,%eax
+ dfe:	75 20                	jne    e20 <malloc+0x170>
+  partial[p->class] = p;
+ e00:	89 14 9d b8 12 00 00 	mov    %edx,0x12b8(,%ebx,4)
+  if((b = p->free) != 0){
+ e07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e0e:	66 90                	xchg   %ax,%ax
+    b = (struct block*)p->fresh;
+ e10:	8b 5a 10             	mov    0x10(%edx),%ebx
+    p->fresh += MINSMALL << c;
+ e13:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+ e16:	89 42 10             	mov    %eax,0x10(%edx)
+ e19:	e9 4d ff ff ff       	jmp    d6b <malloc+0xbb>
+ e1e:	66 90                	xchg   %ax,%ax
+    p->next->prev = p;
+ e20:	89 50 18             	mov    %edx,0x18(%eax)
+  partial[p->class] = p;
+ e23:	0f b7 42 02          	movzwl 0x2(%edx),%eax
+  if((b = p->free) != 0){
+ e27:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ e2a:	8b 4a 08             	mov    0x8(%edx),%ecx
+  partial[p->class] = p;
+ e2d:	89 14 85 b8 12 00 00 	mov    %edx,0x12b8(,%eax,4)
+}
+ e34:	e9 25 ff ff ff       	jmp    d5e <malloc+0xae>
+ e39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ e40:	be 10 00 00 00       	mov    $0x10,%esi
+ e45:	31 db                	xor    %ebx,%ebx
+ e47:	e9 01 ff ff ff       	jmp    d4d <malloc+0x9d>
+ e4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ e50:	0f b7 4a 02          	movzwl 0x2(%edx),%ecx
+ e54:	89 04 8d b8 12 00 00 	mov    %eax,0x12b8(,%ecx,4)
+ e5b:	e9 24 ff ff ff       	jmp    d84 <malloc+0xd4>
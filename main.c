@@ -8,6 +8,8 @@
 
 static void startothers(void);
 static void mpmain(void)  __attribute__((noreturn));
+static void bootmark(char*);
+static void bootreport(void);
 extern pde_t *kpgdir;
 extern char end[]; // first address after kernel loaded from ELF file
 
@@ -17,7 +19,9 @@ extern char end[]; // first address after kernel loaded from ELF file
 int
 main(void)
 {
+  bootmark("start");
   kinit1(end, P2V(4*1024*1024)); // phys page allocator
+  bootmark("kinit1");
   kvmalloc();      // kernel page table
   mpinit();        // detect other processors
   lapicinit();     // interrupt controller
@@ -29,14 +33,57 @@ main(void)
   cinit();         // container table
   tvinit();        // trap vectors
   binit();         // buffer cache
+  pcinit();        // page cache
+  shminit();       // shared memory segments
+  futexinit();     // futex sleep lock
   fileinit();      // file table
   ideinit();       // disk 
+  virtioinit();    // virtio disk, the root disk if there is one
+  bootmark("devices");
   startothers();   // start other processors
+  bootmark("startothers");
   kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+  bootmark("kinit2");
   userinit();      // initialize root container and root process
+  bootmark("userinit");
+  bootreport();
   mpmain();        // finish this processor's setup
 }
 
+// Boot-phase timestamps: the time stamp counter at the end of
+// each phase of main(), reported once the boot processor is done.
+#define NBOOTMARK 8
+
+static struct {
+  char *phase;
+  uint64 tsc;
+} marks[NBOOTMARK];
+static int nmarks;
+
+static void
+bootmark(char *phase)
+{
+  if(nmarks < NBOOTMARK){
+    marks[nmarks].phase = phase;
+    marks[nmarks].tsc = rdtsc();
+    nmarks++;
+  }
+}
+
+// Print how long each phase took, in units of 1024 cycles.
+static void
+bootreport(void)
+{
+  int i;
+
+  cprintf("boot:");
+  for(i = 1; i < nmarks; i++)
+    cprintf(" %s %d", marks[i].phase,
+            (uint)((marks[i].tsc - marks[i-1].tsc) >> 10));
+  cprintf(" total %d Kcycles\n",
+          (uint)((marks[nmarks-1].tsc - marks[0].tsc) >> 10));
+}
+
 // Other CPUs jump here from entryother.S.
 static void
 mpenter(void)
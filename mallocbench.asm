@@ -0,0 +1,1951 @@
+
+_mallocbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "%s: %d ops in %d ticks\n", what, n, uptime() - start);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+
+  brk = sbrk(0);
+
+  start = uptime();
+  for(i = 0; i < NPAIR; i++){
+    p = malloc(1 + i % 100);
+   f:	be 1f 85 eb 51       	mov    $0x51eb851f,%esi
+{
+  14:	53                   	push   %ebx
+  for(i = 0; i < NPAIR; i++){
+  15:	31 db                	xor    %ebx,%ebx
+{
+  17:	51                   	push   %ecx
+  18:	83 ec 24             	sub    $0x24,%esp
+  brk = sbrk(0);
+  1b:	6a 00                	push   $0x0
+  1d:	e8 99 05 00 00       	call   5bb <sbrk>
+  22:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = uptime();
+  25:	e8 a1 05 00 00       	call   5cb <uptime>
+  2a:	83 c4 10             	add    $0x10,%esp
+  2d:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < NPAIR; i++){
+  2f:	90                   	nop
+    p = malloc(1 + i % 100);
+  30:	89 d8                	mov    %ebx,%eax
+  32:	83 ec 0c             	sub    $0xc,%esp
+  35:	f7 e6                	mul    %esi
+  37:	89 d8                	mov    %ebx,%eax
+  39:	c1 ea 05             	shr    $0x5,%edx
+  3c:	6b d2 64             	imul   $0x64,%edx,%edx
+  3f:	29 d0                	sub    %edx,%eax
+  41:	83 c0 01             	add    $0x1,%eax
+  44:	50                   	push   %eax
+  45:	e8 d6 0b 00 00       	call   c20 <malloc>
+    *p = i;
+  4a:	88 18                	mov    %bl,(%eax)
+  for(i = 0; i < NPAIR; i++){
+  4c:	83 c3 01             	add    $0x1,%ebx
+    free(p);
+  4f:	89 04 24             	mov    %eax,(%esp)
+  52:	e8 d9 0a 00 00       	call   b30 <free>
+  for(i = 0; i < NPAIR; i++){
+  57:	83 c4 10             	add    $0x10,%esp
+  5a:	81 fb 40 0d 03 00    	cmp    $0x30d40,%ebx
+  60:	75 ce                	jne    30 <main+0x30>
+  }
+  report("small malloc/free pairs", NPAIR, start);
+  62:	83 ec 04             	sub    $0x4,%esp
+
+  // Keep NLIVE blocks of 1 to 2048 bytes alive, replacing
+  // a random one each round, which fragments a free list.
+  start = uptime();
+  for(i = 0; i < NLIVE; i++)
+  65:	31 db                	xor    %ebx,%ebx
+  report("small malloc/free pairs", NPAIR, start);
+  67:	57                   	push   %edi
+  68:	68 40 0d 03 00       	push   $0x30d40
+  6d:	68 e8 0d 00 00       	push   $0xde8
+  72:	e8 09 02 00 00       	call   280 <report>
+  start = uptime();
+  77:	e8 4f 05 00 00       	call   5cb <uptime>
+  7c:	83 c4 10             	add    $0x10,%esp
+  7f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for(i = 0; i < NLIVE; i++)
+  82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  seed = seed * 1103515245 + 12345;
+  88:	69 05 34 12 00 00 6d 	imul   $0x41c64e6d,0x1234,%eax
+  8f:	4e c6 41 
+    live[i] = malloc(1 + rand() % 2048);
+  92:	83 ec 0c             	sub    $0xc,%esp
+  seed = seed * 1103515245 + 12345;
+  95:	05 39 30 00 00       	add    $0x3039,%eax
+  9a:	a3 34 12 00 00       	mov    %eax,0x1234
+  return seed >> 8;
+  9f:	c1 e8 08             	shr    $0x8,%eax
+    live[i] = malloc(1 + rand() % 2048);
+  a2:	25 ff 07 00 00       	and    $0x7ff,%eax
+  a7:	83 c0 01             	add    $0x1,%eax
+  aa:	50                   	push   %eax
+  ab:	e8 70 0b 00 00       	call   c20 <malloc>
+  for(i = 0; i < NLIVE; i++)
+  b0:	83 c4 10             	add    $0x10,%esp
+    live[i] = malloc(1 + rand() % 2048);
+  b3:	89 04 9d 40 12 00 00 	mov    %eax,0x1240(,%ebx,4)
+  for(i = 0; i < NLIVE; i++)
+  ba:	83 c3 01             	add    $0x1,%ebx
+  bd:	81 fb d0 07 00 00    	cmp    $0x7d0,%ebx
+  c3:	75 c3                	jne    88 <main+0x88>
+  c5:	bb a0 86 01 00       	mov    $0x186a0,%ebx
+  for(i = 0; i < NROUND; i++){
+    j = rand() % NLIVE;
+  ca:	be d3 4d 62 10       	mov    $0x10624dd3,%esi
+  cf:	eb 10                	jmp    e1 <main+0xe1>
+  d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < NROUND; i++){
+  d8:	83 eb 01             	sub    $0x1,%ebx
+  db:	0f 84 84 00 00 00    	je     165 <main+0x165>
+  seed = seed * 1103515245 + 12345;
+  e1:	69 0d 34 12 00 00 6d 	imul   $0x41c64e6d,0x1234,%ecx
+  e8:	4e c6 41 
+    free(live[j]);
+  eb:	83 ec 0c             	sub    $0xc,%esp
+  seed = seed * 1103515245 + 12345;
+  ee:	81 c1 39 30 00 00    	add    $0x3039,%ecx
+  f4:	89 0d 34 12 00 00    	mov    %ecx,0x1234
+  return seed >> 8;
+  fa:	c1 e9 08             	shr    $0x8,%ecx
+    j = rand() % NLIVE;
+  fd:	89 c8                	mov    %ecx,%eax
+  ff:	f7 e6                	mul    %esi
+ 101:	89 d7                	mov    %edx,%edi
+ 103:	c1 ef 07             	shr    $0x7,%edi
+ 106:	69 c7 d0 07 00 00    	imul   $0x7d0,%edi,%eax
+ 10c:	29 c1                	sub    %eax,%ecx
+    free(live[j]);
+ 10e:	ff 34 8d 40 12 00 00 	push   0x1240(,%ecx,4)
+    j = rand() % NLIVE;
+ 115:	89 cf                	mov    %ecx,%edi
+    free(live[j]);
+ 117:	e8 14 0a 00 00       	call   b30 <free>
+  seed = seed * 1103515245 + 12345;
+ 11c:	69 05 34 12 00 00 6d 	imul   $0x41c64e6d,0x1234,%eax
+ 123:	4e c6 41 
+ 126:	05 39 30 00 00       	add    $0x3039,%eax
+ 12b:	a3 34 12 00 00       	mov    %eax,0x1234
+  return seed >> 8;
+ 130:	c1 e8 08             	shr    $0x8,%eax
+    if((live[j] = malloc(1 + rand() % 2048)) == 0){
+ 133:	25 ff 07 00 00       	and    $0x7ff,%eax
+ 138:	83 c0 01             	add    $0x1,%eax
+ 13b:	89 04 24             	mov    %eax,(%esp)
+ 13e:	e8 dd 0a 00 00       	call   c20 <malloc>
+ 143:	83 c4 10             	add    $0x10,%esp
+ 146:	89 04 bd 40 12 00 00 	mov    %eax,0x1240(,%edi,4)
+ 14d:	85 c0                	test   %eax,%eax
+ 14f:	75 87                	jne    d8 <main+0xd8>
+      printf(1, "mallocbench: out of memory\n");
+ 151:	83 ec 08             	sub    $0x8,%esp
+ 154:	68 00 0e 00 00       	push   $0xe00
+ 159:	6a 01                	push   $0x1
+ 15b:	e8 80 05 00 00       	call   6e0 <printf>
+      exit();
+ 160:	e8 ce 03 00 00       	call   533 <exit>
+    }
+  }
+  report("random replace, mixed sizes", NROUND, start);
+ 165:	52                   	push   %edx
+  printf(1, "heap grew by %d KB\n", (sbrk(0) - brk) / 1024);
+  for(i = 0; i < NLIVE; i++)
+ 166:	31 db                	xor    %ebx,%ebx
+  report("random replace, mixed sizes", NROUND, start);
+ 168:	ff 75 e0             	push   -0x20(%ebp)
+ 16b:	68 a0 86 01 00       	push   $0x186a0
+ 170:	68 1c 0e 00 00       	push   $0xe1c
+ 175:	e8 06 01 00 00       	call   280 <report>
+  printf(1, "heap grew by %d KB\n", (sbrk(0) - brk) / 1024);
+ 17a:	31 c9                	xor    %ecx,%ecx
+ 17c:	89 0c 24             	mov    %ecx,(%esp)
+ 17f:	e8 37 04 00 00       	call   5bb <sbrk>
+ 184:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ 187:	b9 00 04 00 00       	mov    $0x400,%ecx
+ 18c:	83 c4 0c             	add    $0xc,%esp
+ 18f:	29 f0                	sub    %esi,%eax
+ 191:	99                   	cltd
+ 192:	f7 f9                	idiv   %ecx
+ 194:	50                   	push   %eax
+ 195:	68 38 0e 00 00       	push   $0xe38
+ 19a:	6a 01                	push   $0x1
+ 19c:	e8 3f 05 00 00       	call   6e0 <printf>
+ 1a1:	83 c4 10             	add    $0x10,%esp
+ 1a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(live[i]);
+ 1a8:	83 ec 0c             	sub    $0xc,%esp
+ 1ab:	ff 34 9d 40 12 00 00 	push   0x1240(,%ebx,4)
+  for(i = 0; i < NLIVE; i++)
+ 1b2:	83 c3 01             	add    $0x1,%ebx
+    free(live[i]);
+ 1b5:	e8 76 09 00 00       	call   b30 <free>
+  for(i = 0; i < NLIVE; i++)
+ 1ba:	83 c4 10             	add    $0x10,%esp
+ 1bd:	81 fb d0 07 00 00    	cmp    $0x7d0,%ebx
+ 1c3:	75 e3                	jne    1a8 <main+0x1a8>
+  printf(1, "after freeing everything: %d KB\n", (sbrk(0) - brk) / 1024);
+ 1c5:	83 ec 0c             	sub    $0xc,%esp
+ 1c8:	6a 00                	push   $0x0
+ 1ca:	e8 ec 03 00 00       	call   5bb <sbrk>
+ 1cf:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ 1d2:	b9 00 04 00 00       	mov    $0x400,%ecx
+ 1d7:	83 c4 0c             	add    $0xc,%esp
+ 1da:	29 f0                	sub    %esi,%eax
+ 1dc:	99                   	cltd
+ 1dd:	f7 f9                	idiv   %ecx
+ 1df:	50                   	push   %eax
+ 1e0:	68 64 0e 00 00       	push   $0xe64
+ 1e5:	6a 01                	push   $0x1
+ 1e7:	e8 f4 04 00 00       	call   6e0 <printf>
+
+  start = uptime();
+ 1ec:	e8 da 03 00 00       	call   5cb <uptime>
+ 1f1:	83 c4 10             	add    $0x10,%esp
+ 1f4:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < NLARGE; i++){
+ 1f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fd:	8d 76 00             	lea    0x0(%esi),%esi
+  seed = seed * 1103515245 + 12345;
+ 200:	69 05 34 12 00 00 6d 	imul   $0x41c64e6d,0x1234,%eax
+ 207:	4e c6 41 
+    p = malloc(8192 + rand() % (128*1024));
+ 20a:	83 ec 0c             	sub    $0xc,%esp
+  seed = seed * 1103515245 + 12345;
+ 20d:	05 39 30 00 00       	add    $0x3039,%eax
+ 212:	a3 34 12 00 00       	mov    %eax,0x1234
+  return seed >> 8;
+ 217:	c1 e8 08             	shr    $0x8,%eax
+    p = malloc(8192 + rand() % (128*1024));
+ 21a:	25 ff ff 01 00       	and    $0x1ffff,%eax
+ 21f:	05 00 20 00 00       	add    $0x2000,%eax
+ 224:	50                   	push   %eax
+ 225:	e8 f6 09 00 00       	call   c20 <malloc>
+    p[0] = 1;
+ 22a:	c6 00 01             	movb   $0x1,(%eax)
+    free(p);
+ 22d:	89 04 24             	mov    %eax,(%esp)
+ 230:	e8 fb 08 00 00       	call   b30 <free>
+  for(i = 0; i < NLARGE; i++){
+ 235:	83 c4 10             	add    $0x10,%esp
+ 238:	83 eb 01             	sub    $0x1,%ebx
+ 23b:	75 c3                	jne    200 <main+0x200>
+  }
+  report("large malloc/free pairs", NLARGE, start);
+ 23d:	50                   	push   %eax
+ 23e:	56                   	push   %esi
+ 23f:	68 d0 07 00 00       	push   $0x7d0
+ 244:	68 4c 0e 00 00       	push   $0xe4c
+ 249:	e8 32 00 00 00       	call   280 <report>
+  exit();
+ 24e:	e8 e0 02 00 00       	call   533 <exit>
+ 253:	66 90                	xchg   %ax,%ax
+ 255:	66 90                	xchg   %ax,%ax
+ 257:	66 90                	xchg   %ax,%ax
+ 259:	66 90                	xchg   %ax,%ax
+ 25b:	66 90                	xchg   %ax,%ax
+ 25d:	66 90                	xchg   %ax,%ax
+ 25f:	90                   	nop
+
+00000260 <rand>:
+  seed = seed * 1103515245 + 12345;
+ 260:	69 05 34 12 00 00 6d 	imul   $0x41c64e6d,0x1234,%eax
+ 267:	4e c6 41 
+ 26a:	05 39 30 00 00       	add    $0x3039,%eax
+ 26f:	a3 34 12 00 00       	mov    %eax,0x1234
+  return seed >> 8;
+ 274:	c1 e8 08             	shr    $0x8,%eax
+}
+ 277:	c3                   	ret
+ 278:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27f:	90                   	nop
+
+00000280 <report>:
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "%s: %d ops in %d ticks\n", what, n, uptime() - start);
+ 286:	e8 40 03 00 00       	call   5cb <uptime>
+ 28b:	83 ec 0c             	sub    $0xc,%esp
+ 28e:	2b 45 10             	sub    0x10(%ebp),%eax
+ 291:	50                   	push   %eax
+ 292:	ff 75 0c             	push   0xc(%ebp)
+ 295:	ff 75 08             	push   0x8(%ebp)
+ 298:	68 d0 0d 00 00       	push   $0xdd0
+ 29d:	6a 01                	push   $0x1
+ 29f:	e8 3c 04 00 00       	call   6e0 <printf>
+}
+ 2a4:	83 c4 20             	add    $0x20,%esp
+ 2a7:	c9                   	leave
+ 2a8:	c3                   	ret
+ 2a9:	66 90                	xchg   %ax,%ax
+ 2ab:	66 90                	xchg   %ax,%ax
+ 2ad:	66 90                	xchg   %ax,%ax
+ 2af:	90                   	nop
+
+000002b0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 2b0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 2b1:	31 c0                	xor    %eax,%eax
+{
+ 2b3:	89 e5                	mov    %esp,%ebp
+ 2b5:	53                   	push   %ebx
+ 2b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 2c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 2c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 2c7:	83 c0 01             	add    $0x1,%eax
+ 2ca:	84 d2                	test   %dl,%dl
+ 2cc:	75 f2                	jne    2c0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 2ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2d1:	89 c8                	mov    %ecx,%eax
+ 2d3:	c9                   	leave
+ 2d4:	c3                   	ret
+ 2d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002e0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	53                   	push   %ebx
+ 2e4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 2ea:	0f b6 02             	movzbl (%edx),%eax
+ 2ed:	84 c0                	test   %al,%al
+ 2ef:	75 17                	jne    308 <strcmp+0x28>
+ 2f1:	eb 3a                	jmp    32d <strcmp+0x4d>
+ 2f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2f7:	90                   	nop
+ 2f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 2fc:	83 c2 01             	add    $0x1,%edx
+ 2ff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 302:	84 c0                	test   %al,%al
+ 304:	74 1a                	je     320 <strcmp+0x40>
+    p++, q++;
+ 306:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 308:	0f b6 19             	movzbl (%ecx),%ebx
+ 30b:	38 c3                	cmp    %al,%bl
+ 30d:	74 e9                	je     2f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 30f:	29 d8                	sub    %ebx,%eax
+}
+ 311:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 314:	c9                   	leave
+ 315:	c3                   	ret
+ 316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 320:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 324:	31 c0                	xor    %eax,%eax
+ 326:	29 d8                	sub    %ebx,%eax
+}
+ 328:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 32b:	c9                   	leave
+ 32c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 32d:	0f b6 19             	movzbl (%ecx),%ebx
+ 330:	31 c0                	xor    %eax,%eax
+ 332:	eb db                	jmp    30f <strcmp+0x2f>
+ 334:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 33f:	90                   	nop
+
+00000340 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 346:	80 3a 00             	cmpb   $0x0,(%edx)
+ 349:	74 15                	je     360 <strlen+0x20>
+ 34b:	31 c0                	xor    %eax,%eax
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+ 350:	83 c0 01             	add    $0x1,%eax
+ 353:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 357:	89 c1                	mov    %eax,%ecx
+ 359:	75 f5                	jne    350 <strlen+0x10>
+    ;
+  return n;
+}
+ 35b:	89 c8                	mov    %ecx,%eax
+ 35d:	5d                   	pop    %ebp
+ 35e:	c3                   	ret
+ 35f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 360:	31 c9                	xor    %ecx,%ecx
+}
+ 362:	5d                   	pop    %ebp
+ 363:	89 c8                	mov    %ecx,%eax
+ 365:	c3                   	ret
+ 366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000370 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	57                   	push   %edi
+ 374:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 377:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 37a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 37d:	89 d7                	mov    %edx,%edi
+ 37f:	fc                   	cld
+ 380:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 382:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 385:	89 d0                	mov    %edx,%eax
+ 387:	c9                   	leave
+ 388:	c3                   	ret
+ 389:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	8b 45 08             	mov    0x8(%ebp),%eax
+ 396:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 39a:	0f b6 10             	movzbl (%eax),%edx
+ 39d:	84 d2                	test   %dl,%dl
+ 39f:	75 12                	jne    3b3 <strchr+0x23>
+ 3a1:	eb 1d                	jmp    3c0 <strchr+0x30>
+ 3a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3a7:	90                   	nop
+ 3a8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 3ac:	83 c0 01             	add    $0x1,%eax
+ 3af:	84 d2                	test   %dl,%dl
+ 3b1:	74 0d                	je     3c0 <strchr+0x30>
+    if(*s == c)
+ 3b3:	38 d1                	cmp    %dl,%cl
+ 3b5:	75 f1                	jne    3a8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 3b7:	5d                   	pop    %ebp
+ 3b8:	c3                   	ret
+ 3b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 3c0:	31 c0                	xor    %eax,%eax
+}
+ 3c2:	5d                   	pop    %ebp
+ 3c3:	c3                   	ret
+ 3c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3cf:	90                   	nop
+
+000003d0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	57                   	push   %edi
+ 3d4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 3d5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 3d8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 3d9:	31 db                	xor    %ebx,%ebx
+{
+ 3db:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 3de:	eb 27                	jmp    407 <gets+0x37>
+    cc = read(0, &c, 1);
+ 3e0:	83 ec 04             	sub    $0x4,%esp
+ 3e3:	6a 01                	push   $0x1
+ 3e5:	56                   	push   %esi
+ 3e6:	6a 00                	push   $0x0
+ 3e8:	e8 5e 01 00 00       	call   54b <read>
+    if(cc < 1)
+ 3ed:	83 c4 10             	add    $0x10,%esp
+ 3f0:	85 c0                	test   %eax,%eax
+ 3f2:	7e 1d                	jle    411 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 3f4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 3f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3fb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 3ff:	3c 0a                	cmp    $0xa,%al
+ 401:	74 10                	je     413 <gets+0x43>
+ 403:	3c 0d                	cmp    $0xd,%al
+ 405:	74 0c                	je     413 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 407:	89 df                	mov    %ebx,%edi
+ 409:	83 c3 01             	add    $0x1,%ebx
+ 40c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 40f:	7c cf                	jl     3e0 <gets+0x10>
+ 411:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 413:	8b 45 08             	mov    0x8(%ebp),%eax
+ 416:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 41a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 41d:	5b                   	pop    %ebx
+ 41e:	5e                   	pop    %esi
+ 41f:	5f                   	pop    %edi
+ 420:	5d                   	pop    %ebp
+ 421:	c3                   	ret
+ 422:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 429:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000430 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	56                   	push   %esi
+ 434:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 435:	83 ec 08             	sub    $0x8,%esp
+ 438:	6a 00                	push   $0x0
+ 43a:	ff 75 08             	push   0x8(%ebp)
+ 43d:	e8 31 01 00 00       	call   573 <open>
+  if(fd < 0)
+ 442:	83 c4 10             	add    $0x10,%esp
+ 445:	85 c0                	test   %eax,%eax
+ 447:	78 27                	js     470 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 449:	83 ec 08             	sub    $0x8,%esp
+ 44c:	ff 75 0c             	push   0xc(%ebp)
+ 44f:	89 c3                	mov    %eax,%ebx
+ 451:	50                   	push   %eax
+ 452:	e8 34 01 00 00       	call   58b <fstat>
+  close(fd);
+ 457:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 45a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 45c:	e8 fa 00 00 00       	call   55b <close>
+  return r;
+ 461:	83 c4 10             	add    $0x10,%esp
+}
+ 464:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 467:	89 f0                	mov    %esi,%eax
+ 469:	5b                   	pop    %ebx
+ 46a:	5e                   	pop    %esi
+ 46b:	5d                   	pop    %ebp
+ 46c:	c3                   	ret
+ 46d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 470:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 475:	eb ed                	jmp    464 <stat+0x34>
+ 477:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47e:	66 90                	xchg   %ax,%ax
+
+00000480 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	53                   	push   %ebx
+ 484:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 487:	0f be 02             	movsbl (%edx),%eax
+ 48a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 48d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 490:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 495:	77 1e                	ja     4b5 <atoi+0x35>
+ 497:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 4a0:	83 c2 01             	add    $0x1,%edx
+ 4a3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 4a6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 4aa:	0f be 02             	movsbl (%edx),%eax
+ 4ad:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 4b0:	80 fb 09             	cmp    $0x9,%bl
+ 4b3:	76 eb                	jbe    4a0 <atoi+0x20>
+  return n;
+}
+ 4b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4b8:	89 c8                	mov    %ecx,%eax
+ 4ba:	c9                   	leave
+ 4bb:	c3                   	ret
+ 4bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	57                   	push   %edi
+ 4c4:	56                   	push   %esi
+ 4c5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 4ce:	85 c0                	test   %eax,%eax
+ 4d0:	7e 13                	jle    4e5 <memmove+0x25>
+ 4d2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4d4:	89 d7                	mov    %edx,%edi
+ 4d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4dd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4e0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4e1:	39 f8                	cmp    %edi,%eax
+ 4e3:	75 fb                	jne    4e0 <memmove+0x20>
+  return vdst;
+}
+ 4e5:	5e                   	pop    %esi
+ 4e6:	89 d0                	mov    %edx,%eax
+ 4e8:	5f                   	pop    %edi
+ 4e9:	5d                   	pop    %ebp
+ 4ea:	c3                   	ret
+
+000004eb <ccreate>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(ccreate)
+ 4eb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <cfork>:
+SYSCALL(cfork)
+ 4f3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <cgetrootdir>:
+SYSCALL(cgetrootdir)
+ 4fb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <getcontrootdir>:
+SYSCALL(getcontrootdir)
+ 503:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <cpause>:
+SYSCALL(cpause)
+ 50b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <cresume>:
+SYSCALL(cresume)
+ 513:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <cstart>:
+SYSCALL(cstart)
+ 51b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <cstop>:
+SYSCALL(cstop)
+ 523:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <fork>:
+SYSCALL(fork)
+ 52b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <exit>:
+SYSCALL(exit)
+ 533:	b8 02 00 00 00       	mov    $0x2,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <wait>:
+SYSCALL(wait)
+ 53b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <pipe>:
+SYSCALL(pipe)
+ 543:	b8 04 00 00 00       	mov    $0x4,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <read>:
+SYSCALL(read)
+ 54b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <write>:
+SYSCALL(write)
+ 553:	b8 10 00 00 00       	mov    $0x10,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <close>:
+SYSCALL(close)
+ 55b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <kill>:
+SYSCALL(kill)
+ 563:	b8 06 00 00 00       	mov    $0x6,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <exec>:
+SYSCALL(exec)
+ 56b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <open>:
+SYSCALL(open)
+ 573:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <mknod>:
+SYSCALL(mknod)
+ 57b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <unlink>:
+SYSCALL(unlink)
+ 583:	b8 12 00 00 00       	mov    $0x12,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <fstat>:
+SYSCALL(fstat)
+ 58b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <link>:
+SYSCALL(link)
+ 593:	b8 13 00 00 00       	mov    $0x13,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <mkdir>:
+SYSCALL(mkdir)
+ 59b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <chdir>:
+SYSCALL(chdir)
+ 5a3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <dup>:
+SYSCALL(dup)
+ 5ab:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <getpid>:
+SYSCALL(getpid)
+ 5b3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <sbrk>:
+SYSCALL(sbrk)
+ 5bb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <sleep>:
+SYSCALL(sleep)
+ 5c3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <uptime>:
+SYSCALL(uptime)
+ 5cb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <cps>:
+SYSCALL(cps)
+ 5d3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <mmap>:
+SYSCALL(mmap)
+ 5db:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <munmap>:
+SYSCALL(munmap)
+ 5e3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <shmget>:
+SYSCALL(shmget)
+ 5eb:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <climit>:
+SYSCALL(climit)
+ 5f3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <spawn>:
+SYSCALL(spawn)
+ 5fb:	b8 23 00 00 00       	mov    $0x23,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <clone>:
+SYSCALL(clone)
+ 603:	b8 24 00 00 00       	mov    $0x24,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <join>:
+SYSCALL(join)
+ 60b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <futex>:
+SYSCALL(futex)
+ 613:	b8 26 00 00 00       	mov    $0x26,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <ccheckpoint>:
+SYSCALL(ccheckpoint)
+ 61b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <crestore>:
+SYSCALL(crestore)
+ 623:	b8 28 00 00 00       	mov    $0x28,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <czygote>:
+SYSCALL(czygote)
+ 62b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <memstats>:
+SYSCALL(memstats)
+ 633:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+ 63b:	66 90                	xchg   %ax,%ax
+ 63d:	66 90                	xchg   %ax,%ax
+ 63f:	90                   	nop
+
+00000640 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+ 643:	57                   	push   %edi
+ 644:	56                   	push   %esi
+ 645:	53                   	push   %ebx
+ 646:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 648:	89 d1                	mov    %edx,%ecx
+{
+ 64a:	83 ec 3c             	sub    $0x3c,%esp
+ 64d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 650:	85 d2                	test   %edx,%edx
+ 652:	0f 89 80 00 00 00    	jns    6d8 <printint+0x98>
+ 658:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 65c:	74 7a                	je     6d8 <printint+0x98>
+    x = -xx;
+ 65e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 660:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 665:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 668:	31 f6                	xor    %esi,%esi
+ 66a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 670:	89 c8                	mov    %ecx,%eax
+ 672:	31 d2                	xor    %edx,%edx
+ 674:	89 f7                	mov    %esi,%edi
+ 676:	f7 f3                	div    %ebx
+ 678:	8d 76 01             	lea    0x1(%esi),%esi
+ 67b:	0f b6 92 e4 0e 00 00 	movzbl 0xee4(%edx),%edx
+ 682:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 686:	89 ca                	mov    %ecx,%edx
+ 688:	89 c1                	mov    %eax,%ecx
+ 68a:	39 da                	cmp    %ebx,%edx
+ 68c:	73 e2                	jae    670 <printint+0x30>
+  if(neg)
+ 68e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 691:	85 c0                	test   %eax,%eax
+ 693:	74 07                	je     69c <printint+0x5c>
+    buf[i++] = '-';
+ 695:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 69a:	89 f7                	mov    %esi,%edi
+ 69c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 69f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 6a2:	01 df                	add    %ebx,%edi
+ 6a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 6a8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 6ab:	83 ec 04             	sub    $0x4,%esp
+ 6ae:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 6b1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 6b4:	6a 01                	push   $0x1
+ 6b6:	50                   	push   %eax
+ 6b7:	56                   	push   %esi
+ 6b8:	e8 96 fe ff ff       	call   553 <write>
+  while(--i >= 0)
+ 6bd:	89 f8                	mov    %edi,%eax
+ 6bf:	83 c4 10             	add    $0x10,%esp
+ 6c2:	83 ef 01             	sub    $0x1,%edi
+ 6c5:	39 d8                	cmp    %ebx,%eax
+ 6c7:	75 df                	jne    6a8 <printint+0x68>
+}
+ 6c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6cc:	5b                   	pop    %ebx
+ 6cd:	5e                   	pop    %esi
+ 6ce:	5f                   	pop    %edi
+ 6cf:	5d                   	pop    %ebp
+ 6d0:	c3                   	ret
+ 6d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 6d8:	31 c0                	xor    %eax,%eax
+ 6da:	eb 89                	jmp    665 <printint+0x25>
+ 6dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006e0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 6e0:	55                   	push   %ebp
+ 6e1:	89 e5                	mov    %esp,%ebp
+ 6e3:	57                   	push   %edi
+ 6e4:	56                   	push   %esi
+ 6e5:	53                   	push   %ebx
+ 6e6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 6e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 6ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 6ef:	0f b6 1e             	movzbl (%esi),%ebx
+ 6f2:	83 c6 01             	add    $0x1,%esi
+ 6f5:	84 db                	test   %bl,%bl
+ 6f7:	74 67                	je     760 <printf+0x80>
+ 6f9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 6fc:	31 d2                	xor    %edx,%edx
+ 6fe:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 701:	eb 34                	jmp    737 <printf+0x57>
+ 703:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 707:	90                   	nop
+ 708:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 70b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 710:	83 f8 25             	cmp    $0x25,%eax
+ 713:	74 18                	je     72d <printf+0x4d>
+  write(fd, &c, 1);
+ 715:	83 ec 04             	sub    $0x4,%esp
+ 718:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 71b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 71e:	6a 01                	push   $0x1
+ 720:	50                   	push   %eax
+ 721:	57                   	push   %edi
+ 722:	e8 2c fe ff ff       	call   553 <write>
+ 727:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 72a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 72d:	0f b6 1e             	movzbl (%esi),%ebx
+ 730:	83 c6 01             	add    $0x1,%esi
+ 733:	84 db                	test   %bl,%bl
+ 735:	74 29                	je     760 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 737:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 73a:	85 d2                	test   %edx,%edx
+ 73c:	74 ca                	je     708 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 73e:	83 fa 25             	cmp    $0x25,%edx
+ 741:	75 ea                	jne    72d <printf+0x4d>
+      if(c == 'd'){
+ 743:	83 f8 25             	cmp    $0x25,%eax
+ 746:	0f 84 24 01 00 00    	je     870 <printf+0x190>
+ 74c:	83 e8 63             	sub    $0x63,%eax
+ 74f:	83 f8 15             	cmp    $0x15,%eax
+ 752:	77 1c                	ja     770 <printf+0x90>
+ 754:	ff 24 85 8c 0e 00 00 	jmp    *0xe8c(,%eax,4)
+ 75b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 75f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 760:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 763:	5b                   	pop    %ebx
+ 764:	5e                   	pop    %esi
+ 765:	5f                   	pop    %edi
+ 766:	5d                   	pop    %ebp
+ 767:	c3                   	ret
+ 768:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76f:	90                   	nop
+  write(fd, &c, 1);
+ 770:	83 ec 04             	sub    $0x4,%esp
+ 773:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 776:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 77a:	6a 01                	push   $0x1
+ 77c:	52                   	push   %edx
+ 77d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 780:	57                   	push   %edi
+ 781:	e8 cd fd ff ff       	call   553 <write>
+ 786:	83 c4 0c             	add    $0xc,%esp
+ 789:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 78c:	6a 01                	push   $0x1
+ 78e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 791:	52                   	push   %edx
+ 792:	57                   	push   %edi
+ 793:	e8 bb fd ff ff       	call   553 <write>
+        putc(fd, c);
+ 798:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 79b:	31 d2                	xor    %edx,%edx
+ 79d:	eb 8e                	jmp    72d <printf+0x4d>
+ 79f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 7a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7a3:	83 ec 0c             	sub    $0xc,%esp
+ 7a6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 7ab:	8b 13                	mov    (%ebx),%edx
+ 7ad:	6a 00                	push   $0x0
+ 7af:	89 f8                	mov    %edi,%eax
+        ap++;
+ 7b1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 7b4:	e8 87 fe ff ff       	call   640 <printint>
+        ap++;
+ 7b9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7bc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7bf:	31 d2                	xor    %edx,%edx
+ 7c1:	e9 67 ff ff ff       	jmp    72d <printf+0x4d>
+ 7c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7cd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 7d0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 7d3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 7d5:	83 c0 04             	add    $0x4,%eax
+ 7d8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 7db:	85 db                	test   %ebx,%ebx
+ 7dd:	0f 84 9d 00 00 00    	je     880 <printf+0x1a0>
+        while(*s != 0){
+ 7e3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 7e6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 7e8:	84 c0                	test   %al,%al
+ 7ea:	0f 84 3d ff ff ff    	je     72d <printf+0x4d>
+ 7f0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7f3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 7f6:	89 de                	mov    %ebx,%esi
+ 7f8:	89 d3                	mov    %edx,%ebx
+ 7fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 800:	83 ec 04             	sub    $0x4,%esp
+ 803:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 806:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 809:	6a 01                	push   $0x1
+ 80b:	53                   	push   %ebx
+ 80c:	57                   	push   %edi
+ 80d:	e8 41 fd ff ff       	call   553 <write>
+        while(*s != 0){
+ 812:	0f b6 06             	movzbl (%esi),%eax
+ 815:	83 c4 10             	add    $0x10,%esp
+ 818:	84 c0                	test   %al,%al
+ 81a:	75 e4                	jne    800 <printf+0x120>
+      state = 0;
+ 81c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 81f:	31 d2                	xor    %edx,%edx
+ 821:	e9 07 ff ff ff       	jmp    72d <printf+0x4d>
+ 826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 82d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 830:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 833:	83 ec 0c             	sub    $0xc,%esp
+ 836:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 83b:	8b 13                	mov    (%ebx),%edx
+ 83d:	6a 01                	push   $0x1
+ 83f:	e9 6b ff ff ff       	jmp    7af <printf+0xcf>
+ 844:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 848:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 84b:	83 ec 04             	sub    $0x4,%esp
+ 84e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 851:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 853:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 856:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 859:	6a 01                	push   $0x1
+ 85b:	52                   	push   %edx
+ 85c:	57                   	push   %edi
+ 85d:	e8 f1 fc ff ff       	call   553 <write>
+        ap++;
+ 862:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 865:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 868:	31 d2                	xor    %edx,%edx
+ 86a:	e9 be fe ff ff       	jmp    72d <printf+0x4d>
+ 86f:	90                   	nop
+  write(fd, &c, 1);
+ 870:	83 ec 04             	sub    $0x4,%esp
+ 873:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 876:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 879:	6a 01                	push   $0x1
+ 87b:	e9 11 ff ff ff       	jmp    791 <printf+0xb1>
+ 880:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 885:	bb 85 0e 00 00       	mov    $0xe85,%ebx
+ 88a:	e9 61 ff ff ff       	jmp    7f0 <printf+0x110>
+ 88f:	90                   	nop
+
+00000890 <runfree>:
+
+// Give the n pages at r back to the free runs, merging them with
+// adjacent runs, and shrink the heap if the end of it is free.
+static void
+runfree(struct page *r, uint n)
+{
+ 890:	55                   	push   %ebp
+  struct page **pp, *prev;
+
+  r->kind = PFREE;
+ 891:	b9 03 00 00 00       	mov    $0x3,%ecx
+{
+ 896:	89 e5                	mov    %esp,%ebp
+ 898:	57                   	push   %edi
+ 899:	56                   	push   %esi
+ 89a:	53                   	push   %ebx
+ 89b:	89 c3                	mov    %eax,%ebx
+ 89d:	83 ec 0c             	sub    $0xc,%esp
+  r->kind = PFREE;
+ 8a0:	66 89 08             	mov    %cx,(%eax)
+  r->npages = n;
+  prev = 0;
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 8a3:	8b 0d 84 31 00 00    	mov    0x3184,%ecx
+  r->npages = n;
+ 8a9:	89 50 04             	mov    %edx,0x4(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 8ac:	85 c9                	test   %ecx,%ecx
+ 8ae:	0f 84 1f 01 00 00    	je     9d3 <runfree+0x143>
+ 8b4:	39 c1                	cmp    %eax,%ecx
+ 8b6:	0f 83 f7 00 00 00    	jae    9b3 <runfree+0x123>
+ 8bc:	89 c8                	mov    %ecx,%eax
+ 8be:	eb 04                	jmp    8c4 <runfree+0x34>
+ 8c0:	39 d8                	cmp    %ebx,%eax
+ 8c2:	73 09                	jae    8cd <runfree+0x3d>
+ 8c4:	89 c2                	mov    %eax,%edx
+ 8c6:	8b 40 14             	mov    0x14(%eax),%eax
+ 8c9:	85 c0                	test   %eax,%eax
+ 8cb:	75 f3                	jne    8c0 <runfree+0x30>
+    prev = *pp;
+  r->next = *pp;
+ 8cd:	89 43 14             	mov    %eax,0x14(%ebx)
+  *pp = r;
+ 8d0:	89 5a 14             	mov    %ebx,0x14(%edx)
+
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 8d3:	8b 43 14             	mov    0x14(%ebx),%eax
+ 8d6:	85 c0                	test   %eax,%eax
+ 8d8:	74 12                	je     8ec <runfree+0x5c>
+ 8da:	8b 7b 04             	mov    0x4(%ebx),%edi
+ 8dd:	89 fe                	mov    %edi,%esi
+ 8df:	c1 e6 0c             	shl    $0xc,%esi
+ 8e2:	01 de                	add    %ebx,%esi
+ 8e4:	39 f0                	cmp    %esi,%eax
+ 8e6:	0f 84 a4 00 00 00    	je     990 <runfree+0x100>
+    r->npages += r->next->npages;
+    r->next = r->next->next;
+  }
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 8ec:	8b 72 04             	mov    0x4(%edx),%esi
+ 8ef:	89 f0                	mov    %esi,%eax
+ 8f1:	c1 e0 0c             	shl    $0xc,%eax
+ 8f4:	01 d0                	add    %edx,%eax
+ 8f6:	39 c3                	cmp    %eax,%ebx
+ 8f8:	74 16                	je     910 <runfree+0x80>
+    pp = &runs;
+    while(*pp != r)
+      pp = &(*pp)->next;
+  }
+
+  if(r->next == 0 && r->npages >= TRIM &&
+ 8fa:	8b 43 14             	mov    0x14(%ebx),%eax
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 8fd:	8d 72 14             	lea    0x14(%edx),%esi
+  if(r->next == 0 && r->npages >= TRIM &&
+ 900:	85 c0                	test   %eax,%eax
+ 902:	74 3c                	je     940 <runfree+0xb0>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+    *pp = 0;
+    sbrk(-(int)(r->npages*PGSIZE));
+    heapend = (char*)r;
+  }
+}
+ 904:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 907:	5b                   	pop    %ebx
+ 908:	5e                   	pop    %esi
+ 909:	5f                   	pop    %edi
+ 90a:	5d                   	pop    %ebp
+ 90b:	c3                   	ret
+ 90c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    prev->npages += r->npages;
+ 910:	03 73 04             	add    0x4(%ebx),%esi
+ 913:	89 72 04             	mov    %esi,0x4(%edx)
+    prev->next = r->next;
+ 916:	8b 43 14             	mov    0x14(%ebx),%eax
+ 919:	89 42 14             	mov    %eax,0x14(%edx)
+    while(*pp != r)
+ 91c:	39 d1                	cmp    %edx,%ecx
+ 91e:	0f 84 c5 00 00 00    	je     9e9 <runfree+0x159>
+ 924:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      pp = &(*pp)->next;
+ 928:	89 cb                	mov    %ecx,%ebx
+ 92a:	8b 49 14             	mov    0x14(%ecx),%ecx
+    while(*pp != r)
+ 92d:	39 d1                	cmp    %edx,%ecx
+ 92f:	75 f7                	jne    928 <runfree+0x98>
+      pp = &(*pp)->next;
+ 931:	8d 73 14             	lea    0x14(%ebx),%esi
+ 934:	89 cb                	mov    %ecx,%ebx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 936:	85 c0                	test   %eax,%eax
+ 938:	75 ca                	jne    904 <runfree+0x74>
+ 93a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 940:	8b 53 04             	mov    0x4(%ebx),%edx
+ 943:	83 fa 1f             	cmp    $0x1f,%edx
+ 946:	76 bc                	jbe    904 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 948:	c1 e2 0c             	shl    $0xc,%edx
+ 94b:	01 da                	add    %ebx,%edx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 94d:	39 15 80 31 00 00    	cmp    %edx,0x3180
+ 953:	75 af                	jne    904 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 955:	83 ec 0c             	sub    $0xc,%esp
+ 958:	6a 00                	push   $0x0
+ 95a:	e8 5c fc ff ff       	call   5bb <sbrk>
+ 95f:	83 c4 10             	add    $0x10,%esp
+ 962:	39 05 80 31 00 00    	cmp    %eax,0x3180
+ 968:	75 9a                	jne    904 <runfree+0x74>
+    *pp = 0;
+ 96a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    sbrk(-(int)(r->npages*PGSIZE));
+ 970:	8b 43 04             	mov    0x4(%ebx),%eax
+ 973:	83 ec 0c             	sub    $0xc,%esp
+ 976:	c1 e0 0c             	shl    $0xc,%eax
+ 979:	f7 d8                	neg    %eax
+ 97b:	50                   	push   %eax
+ 97c:	e8 3a fc ff ff       	call   5bb <sbrk>
+    heapend = (char*)r;
+ 981:	89 1d 80 31 00 00    	mov    %ebx,0x3180
+ 987:	83 c4 10             	add    $0x10,%esp
+}
+ 98a:	e9 75 ff ff ff       	jmp    904 <runfree+0x74>
+ 98f:	90                   	nop
+    r->npages += r->next->npages;
+ 990:	03 78 04             	add    0x4(%eax),%edi
+ 993:	89 7b 04             	mov    %edi,0x4(%ebx)
+    r->next = r->next->next;
+ 996:	8b 40 14             	mov    0x14(%eax),%eax
+ 999:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 99c:	8b 72 04             	mov    0x4(%edx),%esi
+ 99f:	89 f0                	mov    %esi,%eax
+ 9a1:	c1 e0 0c             	shl    $0xc,%eax
+ 9a4:	01 d0                	add    %edx,%eax
+ 9a6:	39 c3                	cmp    %eax,%ebx
+ 9a8:	0f 85 4c ff ff ff    	jne    8fa <runfree+0x6a>
+ 9ae:	e9 5d ff ff ff       	jmp    910 <runfree+0x80>
+  r->next = *pp;
+ 9b3:	89 48 14             	mov    %ecx,0x14(%eax)
+  *pp = r;
+ 9b6:	a3 84 31 00 00       	mov    %eax,0x3184
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 9bb:	89 d0                	mov    %edx,%eax
+ 9bd:	c1 e0 0c             	shl    $0xc,%eax
+ 9c0:	01 d8                	add    %ebx,%eax
+ 9c2:	39 c1                	cmp    %eax,%ecx
+ 9c4:	74 2f                	je     9f5 <runfree+0x165>
+  if(r->next == 0 && r->npages >= TRIM &&
+ 9c6:	8b 43 14             	mov    0x14(%ebx),%eax
+ 9c9:	be 84 31 00 00       	mov    $0x3184,%esi
+ 9ce:	e9 2d ff ff ff       	jmp    900 <runfree+0x70>
+  r->next = *pp;
+ 9d3:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 9da:	be 84 31 00 00       	mov    $0x3184,%esi
+  *pp = r;
+ 9df:	a3 84 31 00 00       	mov    %eax,0x3184
+  if(r->next == 0 && r->npages >= TRIM &&
+ 9e4:	e9 5a ff ff ff       	jmp    943 <runfree+0xb3>
+    while(*pp != r)
+ 9e9:	89 cb                	mov    %ecx,%ebx
+    pp = &runs;
+ 9eb:	be 84 31 00 00       	mov    $0x3184,%esi
+ 9f0:	e9 0b ff ff ff       	jmp    900 <runfree+0x70>
+    r->npages += r->next->npages;
+ 9f5:	03 51 04             	add    0x4(%ecx),%edx
+ 9f8:	89 53 04             	mov    %edx,0x4(%ebx)
+    r->next = r->next->next;
+ 9fb:	8b 41 14             	mov    0x14(%ecx),%eax
+ 9fe:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ a01:	eb c3                	jmp    9c6 <runfree+0x136>
+ a03:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a10 <runalloc>:
+
+// Take a run of n pages from the start of the first free run
+// long enough, which keeps the end of the heap free to trim.
+static struct page*
+runalloc(uint n)
+{
+ a10:	55                   	push   %ebp
+ a11:	89 e5                	mov    %esp,%ebp
+ a13:	57                   	push   %edi
+ a14:	56                   	push   %esi
+ a15:	89 c6                	mov    %eax,%esi
+ a17:	53                   	push   %ebx
+ a18:	83 ec 1c             	sub    $0x1c,%esp
+  struct page **pp, *r, *rest;
+
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ a1b:	8b 1d 84 31 00 00    	mov    0x3184,%ebx
+ a21:	85 db                	test   %ebx,%ebx
+ a23:	74 4d                	je     a72 <runalloc+0x62>
+ a25:	b9 84 31 00 00       	mov    $0x3184,%ecx
+    if(r->npages < n)
+ a2a:	39 73 04             	cmp    %esi,0x4(%ebx)
+ a2d:	72 39                	jb     a68 <runalloc+0x58>
+      continue;
+    if(r->npages == n){
+ a2f:	0f 84 9b 00 00 00    	je     ad0 <runalloc+0xc0>
+      *pp = r->next;
+    } else {
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ a35:	89 f0                	mov    %esi,%eax
+      rest->kind = PFREE;
+ a37:	ba 03 00 00 00       	mov    $0x3,%edx
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ a3c:	c1 e0 0c             	shl    $0xc,%eax
+ a3f:	01 d8                	add    %ebx,%eax
+      rest->kind = PFREE;
+ a41:	66 89 10             	mov    %dx,(%eax)
+      rest->npages = r->npages - n;
+ a44:	8b 53 04             	mov    0x4(%ebx),%edx
+ a47:	29 f2                	sub    %esi,%edx
+ a49:	89 50 04             	mov    %edx,0x4(%eax)
+      rest->next = r->next;
+ a4c:	8b 53 14             	mov    0x14(%ebx),%edx
+ a4f:	89 50 14             	mov    %edx,0x14(%eax)
+      *pp = rest;
+ a52:	89 01                	mov    %eax,(%ecx)
+      r->npages = n;
+ a54:	89 73 04             	mov    %esi,0x4(%ebx)
+    }
+    return r;
+  }
+  return morecore(n);
+}
+ a57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a5a:	89 d8                	mov    %ebx,%eax
+ a5c:	5b                   	pop    %ebx
+ a5d:	5e                   	pop    %esi
+ a5e:	5f                   	pop    %edi
+ a5f:	5d                   	pop    %ebp
+ a60:	c3                   	ret
+ a61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ a68:	8d 4b 14             	lea    0x14(%ebx),%ecx
+ a6b:	8b 5b 14             	mov    0x14(%ebx),%ebx
+ a6e:	85 db                	test   %ebx,%ebx
+ a70:	75 b8                	jne    a2a <runalloc+0x1a>
+  m = n < MINCORE ? MINCORE : n;
+ a72:	bf 08 00 00 00       	mov    $0x8,%edi
+ a77:	39 fe                	cmp    %edi,%esi
+ a79:	0f 43 fe             	cmovae %esi,%edi
+  brk = sbrk(0);
+ a7c:	83 ec 0c             	sub    $0xc,%esp
+ a7f:	6a 00                	push   $0x0
+ a81:	e8 35 fb ff ff       	call   5bb <sbrk>
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ a86:	89 fa                	mov    %edi,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ a88:	89 c3                	mov    %eax,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ a8a:	c1 e2 0c             	shl    $0xc,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ a8d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ a90:	f7 db                	neg    %ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ a92:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ a95:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ a9b:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+ a9e:	89 04 24             	mov    %eax,(%esp)
+ aa1:	e8 15 fb ff ff       	call   5bb <sbrk>
+ aa6:	83 c4 10             	add    $0x10,%esp
+ aa9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ aac:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ aaf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ ab2:	74 3e                	je     af2 <runalloc+0xe2>
+  r = (struct page*)(brk + pad);
+ ab4:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ ab6:	01 da                	add    %ebx,%edx
+ ab8:	89 15 80 31 00 00    	mov    %edx,0x3180
+  if(m > n)
+ abe:	39 fe                	cmp    %edi,%esi
+ ac0:	72 1e                	jb     ae0 <runalloc+0xd0>
+  r->npages = n;
+ ac2:	89 73 04             	mov    %esi,0x4(%ebx)
+  return r;
+ ac5:	eb 90                	jmp    a57 <runalloc+0x47>
+ ac7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ace:	66 90                	xchg   %ax,%ax
+      *pp = r->next;
+ ad0:	8b 43 14             	mov    0x14(%ebx),%eax
+ ad3:	89 01                	mov    %eax,(%ecx)
+}
+ ad5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ad8:	89 d8                	mov    %ebx,%eax
+ ada:	5b                   	pop    %ebx
+ adb:	5e                   	pop    %esi
+ adc:	5f                   	pop    %edi
+ add:	5d                   	pop    %ebp
+ ade:	c3                   	ret
+ adf:	90                   	nop
+    runfree((struct page*)((char*)r + n*PGSIZE), m - n);
+ ae0:	89 f0                	mov    %esi,%eax
+ ae2:	29 f7                	sub    %esi,%edi
+ ae4:	c1 e0 0c             	shl    $0xc,%eax
+ ae7:	89 fa                	mov    %edi,%edx
+ ae9:	01 d8                	add    %ebx,%eax
+ aeb:	e8 a0 fd ff ff       	call   890 <runfree>
+ af0:	eb d0                	jmp    ac2 <runalloc+0xb2>
+    if(sbrk(pad + m*PGSIZE) == (char*)-1)
+ af2:	89 f7                	mov    %esi,%edi
+ af4:	83 ec 0c             	sub    $0xc,%esp
+ af7:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ afa:	c1 e7 0c             	shl    $0xc,%edi
+ afd:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+ b00:	50                   	push   %eax
+ b01:	e8 b5 fa ff ff       	call   5bb <sbrk>
+ b06:	83 c4 10             	add    $0x10,%esp
+ b09:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ b0c:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b0f:	74 0c                	je     b1d <runalloc+0x10d>
+  r = (struct page*)(brk + pad);
+ b11:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ b13:	01 df                	add    %ebx,%edi
+ b15:	89 3d 80 31 00 00    	mov    %edi,0x3180
+  if(m > n)
+ b1b:	eb a5                	jmp    ac2 <runalloc+0xb2>
+      return 0;
+ b1d:	31 db                	xor    %ebx,%ebx
+ b1f:	e9 33 ff ff ff       	jmp    a57 <runalloc+0x47>
+ b24:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b2f:	90                   	nop
+
+00000b30 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+ b30:	55                   	push   %ebp
+ b31:	89 e5                	mov    %esp,%ebp
+ b33:	56                   	push   %esi
+ b34:	53                   	push   %ebx
+ b35:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  struct page *p;
+
+  if(ap == 0)
+ b38:	85 c9                	test   %ecx,%ecx
+ b3a:	74 1c                	je     b58 <free+0x28>
+    return;
+  p = (struct page*)((uint)ap & ~(PGSIZE-1));
+ b3c:	89 c8                	mov    %ecx,%eax
+ b3e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  switch(p->kind){
+ b43:	0f b7 10             	movzwl (%eax),%edx
+ b46:	66 83 fa 02          	cmp    $0x2,%dx
+ b4a:	74 14                	je     b60 <free+0x30>
+ b4c:	66 83 fa 04          	cmp    $0x4,%dx
+ b50:	74 66                	je     bb8 <free+0x88>
+ b52:	66 83 fa 01          	cmp    $0x1,%dx
+ b56:	74 18                	je     b70 <free+0x40>
+    break;
+  case PMAP:
+    munmap(p, p->npages*PGSIZE);
+    break;
+  }
+}
+ b58:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ b5b:	5b                   	pop    %ebx
+ b5c:	5e                   	pop    %esi
+ b5d:	5d                   	pop    %ebp
+ b5e:	c3                   	ret
+ b5f:	90                   	nop
+    runfree(p, p->npages);
+ b60:	8b 50 04             	mov    0x4(%eax),%edx
+}
+ b63:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ b66:	5b                   	pop    %ebx
+ b67:	5e                   	pop    %esi
+ b68:	5d                   	pop    %ebp
+    runfree(p, p->npages);
+ b69:	e9 22 fd ff ff       	jmp    890 <runfree>
+ b6e:	66 90                	xchg   %ax,%ax
+  b->next = p->free;
+ b70:	8b 50 0c             	mov    0xc(%eax),%edx
+ b73:	89 11                	mov    %edx,(%ecx)
+  if(p->nfree++ == 0)
+ b75:	8b 50 08             	mov    0x8(%eax),%edx
+  p->free = b;
+ b78:	89 48 0c             	mov    %ecx,0xc(%eax)
+  if(p->nfree++ == 0)
+ b7b:	8d 5a 01             	lea    0x1(%edx),%ebx
+ b7e:	89 58 08             	mov    %ebx,0x8(%eax)
+ b81:	85 d2                	test   %edx,%edx
+ b83:	74 53                	je     bd8 <free+0xa8>
+  if(p->nfree == nblocks(p->class)){
+ b85:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ b89:	8d 4e 04             	lea    0x4(%esi),%ecx
+ b8c:	ba e0 0f 00 00       	mov    $0xfe0,%edx
+ b91:	d3 fa                	sar    %cl,%edx
+  if(p->nfree == nblocks(p->class)){
+ b93:	39 da                	cmp    %ebx,%edx
+ b95:	75 c1                	jne    b58 <free+0x28>
+  if(p->prev)
+ b97:	8b 48 18             	mov    0x18(%eax),%ecx
+    p->prev->next = p->next;
+ b9a:	8b 50 14             	mov    0x14(%eax),%edx
+  if(p->prev)
+ b9d:	85 c9                	test   %ecx,%ecx
+ b9f:	74 6f                	je     c10 <free+0xe0>
+    p->prev->next = p->next;
+ ba1:	89 51 14             	mov    %edx,0x14(%ecx)
+  if(p->next)
+ ba4:	85 d2                	test   %edx,%edx
+ ba6:	74 06                	je     bae <free+0x7e>
+    p->next->prev = p->prev;
+ ba8:	8b 48 18             	mov    0x18(%eax),%ecx
+ bab:	89 4a 18             	mov    %ecx,0x18(%edx)
+    runfree(p, 1);
+ bae:	ba 01 00 00 00       	mov    $0x1,%edx
+ bb3:	eb ae                	jmp    b63 <free+0x33>
+ bb5:	8d 76 00             	lea    0x0(%esi),%esi
+    munmap(p, p->npages*PGSIZE);
+ bb8:	8b 50 04             	mov    0x4(%eax),%edx
+ bbb:	83 ec 08             	sub    $0x8,%esp
+ bbe:	c1 e2 0c             	shl    $0xc,%edx
+ bc1:	52                   	push   %edx
+ bc2:	50                   	push   %eax
+ bc3:	e8 1b fa ff ff       	call   5e3 <munmap>
+    break;
+ bc8:	83 c4 10             	add    $0x10,%esp
+}
+ bcb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ bce:	5b                   	pop    %ebx
+ bcf:	5e                   	pop    %esi
+ bd0:	5d                   	pop    %ebp
+ bd1:	c3                   	ret
+ bd2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  p->next = partial[p->class];
+ bd8:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  p->prev = 0;
+ bdc:	c7 40 18 00 00 00 00 	movl   $0x0,0x18(%eax)
+  p->next = partial[p->class];
+ be3:	bb 01 00 00 00       	mov    $0x1,%ebx
+ be8:	8b 14 b5 88 31 00 00 	mov    0x3188(,%esi,4),%edx
+ bef:	89 50 14             	mov    %edx,0x14(%eax)
+  if(p->next)
+ bf2:	85 d2                	test   %edx,%edx
+ bf4:	74 0a                	je     c00 <free+0xd0>
+    p->next->prev = p;
+ bf6:	89 42 18             	mov    %eax,0x18(%edx)
+  partial[p->class] = p;
+ bf9:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  if(p->nfree == nblocks(p->class)){
+ bfd:	8b 58 08             	mov    0x8(%eax),%ebx
+  partial[p->class] = p;
+ c00:	89 04 b5 88 31 00 00 	mov    %eax,0x3188(,%esi,4)
+}
+ c07:	eb 80                	jmp    b89 <free+0x59>
+ c09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ c10:	89 14 b5 88 31 00 00 	mov    %edx,0x3188(,%esi,4)
+ c17:	eb 8b                	jmp    ba4 <free+0x74>
+ c19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000c20 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ c20:	55                   	push   %ebp
+ c21:	89 e5                	mov    %esp,%ebp
+ c23:	56                   	push   %esi
+ c24:	53                   	push   %ebx
+ c25:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct page *p;
+  uint n;
+
+  if(nbytes <= MAXSMALL)
+ c28:	3d 00 04 00 00       	cmp    $0x400,%eax
+ c2d:	76 71                	jbe    ca0 <malloc+0x80>
+    return smallalloc(sizeclass(nbytes));
+  if(nbytes > 0x7fffffff)
+ c2f:	85 c0                	test   %eax,%eax
+ c31:	0f 88 d9 00 00 00    	js     d10 <malloc+0xf0>
+    return 0;
+  n = (nbytes + HDRSIZE + PGSIZE-1) / PGSIZE;
+ c37:	8d 90 1f 10 00 00    	lea    0x101f(%eax),%edx
+ c3d:	89 d3                	mov    %edx,%ebx
+ c3f:	c1 eb 0c             	shr    $0xc,%ebx
+  if(nbytes >= MAPMIN){
+ c42:	3d ff ff 00 00       	cmp    $0xffff,%eax
+ c47:	77 27                	ja     c70 <malloc+0x50>
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    if(p == MAP_FAILED)
+      return 0;
+    p->kind = PMAP;
+  } else {
+    if((p = runalloc(n)) == 0)
+ c49:	89 d8                	mov    %ebx,%eax
+ c4b:	e8 c0 fd ff ff       	call   a10 <runalloc>
+ c50:	85 c0                	test   %eax,%eax
+ c52:	0f 84 b8 00 00 00    	je     d10 <malloc+0xf0>
+      return 0;
+    p->kind = PRUN;
+ c58:	ba 02 00 00 00       	mov    $0x2,%edx
+ c5d:	66 89 10             	mov    %dx,(%eax)
+  }
+  p->npages = n;
+ c60:	89 58 04             	mov    %ebx,0x4(%eax)
+  return (char*)p + HDRSIZE;
+ c63:	8d 58 20             	lea    0x20(%eax),%ebx
+}
+ c66:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ c69:	89 d8                	mov    %ebx,%eax
+ c6b:	5b                   	pop    %ebx
+ c6c:	5e                   	pop    %esi
+ c6d:	5d                   	pop    %ebp
+ c6e:	c3                   	ret
+ c6f:	90                   	nop
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+ c70:	83 ec 08             	sub    $0x8,%esp
+ c73:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+ c79:	6a 00                	push   $0x0
+ c7b:	6a ff                	push   $0xffffffff
+ c7d:	6a 22                	push   $0x22
+ c7f:	6a 03                	push   $0x3
+ c81:	52                   	push   %edx
+ c82:	6a 00                	push   $0x0
+ c84:	e8 52 f9 ff ff       	call   5db <mmap>
+    if(p == MAP_FAILED)
+ c89:	83 c4 20             	add    $0x20,%esp
+ c8c:	83 f8 ff             	cmp    $0xffffffff,%eax
+ c8f:	74 7f                	je     d10 <malloc+0xf0>
+    p->kind = PMAP;
+ c91:	b9 04 00 00 00       	mov    $0x4,%ecx
+ c96:	66 89 08             	mov    %cx,(%eax)
+ c99:	eb c5                	jmp    c60 <malloc+0x40>
+ c9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c9f:	90                   	nop
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ ca0:	83 f8 10             	cmp    $0x10,%eax
+ ca3:	0f 86 07 01 00 00    	jbe    db0 <malloc+0x190>
+ ca9:	31 db                	xor    %ebx,%ebx
+ cab:	ba 10 00 00 00       	mov    $0x10,%edx
+ cb0:	83 c3 01             	add    $0x1,%ebx
+ cb3:	89 d6                	mov    %edx,%esi
+ cb5:	89 d9                	mov    %ebx,%ecx
+ cb7:	d3 e6                	shl    %cl,%esi
+ cb9:	39 c6                	cmp    %eax,%esi
+ cbb:	72 f3                	jb     cb0 <malloc+0x90>
+  if((p = partial[c]) == 0){
+ cbd:	8b 14 9d 88 31 00 00 	mov    0x3188(,%ebx,4),%edx
+ cc4:	85 d2                	test   %edx,%edx
+ cc6:	74 58                	je     d20 <malloc+0x100>
+  if((b = p->free) != 0){
+ cc8:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ ccb:	8b 4a 08             	mov    0x8(%edx),%ecx
+  if((b = p->free) != 0){
+ cce:	85 db                	test   %ebx,%ebx
+ cd0:	0f 84 aa 00 00 00    	je     d80 <malloc+0x160>
+    p->free = b->next;
+ cd6:	8b 03                	mov    (%ebx),%eax
+ cd8:	89 42 0c             	mov    %eax,0xc(%edx)
+  if(--p->nfree == 0)
+ cdb:	83 e9 01             	sub    $0x1,%ecx
+ cde:	89 4a 08             	mov    %ecx,0x8(%edx)
+ ce1:	75 83                	jne    c66 <malloc+0x46>
+  if(p->prev)
+ ce3:	8b 4a 18             	mov    0x18(%edx),%ecx
+    p->prev->next = p->next;
+ ce6:	8b 42 14             	mov    0x14(%edx),%eax
+  if(p->prev)
+ ce9:	85 c9                	test   %ecx,%ecx
+ ceb:	0f 84 cf 00 00 00    	je     dc0 <malloc+0x1a0>
+    p->prev->next = p->next;
+ cf1:	89 41 14             	mov    %eax,0x14(%ecx)
+  if(p->next)
+ cf4:	85 c0                	test   %eax,%eax
+ cf6:	0f 84 6a ff ff ff    	je     c66 <malloc+0x46>
+    p->next->prev = p->prev;
+ cfc:	8b 52 18             	mov    0x18(%edx),%edx
+ cff:	89 50 18             	mov    %edx,0x18(%eax)
+ d02:	e9 5f ff ff ff       	jmp    c66 <malloc+0x46>
+ d07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d0e:	66 90                	xchg   %ax,%ax
+}
+ d10:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+ d13:	31 db                	xor    %ebx,%ebx
+}
+ d15:	89 d8                	mov    %ebx,%eax
+ d17:	5b                   	pop    %ebx
+ d18:	5e                   	pop    %esi
+ d19:	5d                   	pop    %ebp
+ d1a:	c3                   	ret
+ d1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d1f:	90                   	nop
+    if((p = runalloc(1)) == 0)
+ d20:	b8 01 00 00 00       	mov    $0x1,%eax
+ d25:	e8 e6 fc ff ff       	call   a10 <runalloc>
+ d2a:	89 c2                	mov    %eax,%edx
+ d2c:	85 c0                	test   %eax,%eax
+ d2e:	74 e0                	je     d10 <malloc+0xf0>
+    p->kind = PSMALL;
+ d30:	b8 01 00 00 00       	mov    $0x1,%eax
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ d35:	8d 4b 04             	lea    0x4(%ebx),%ecx
+    p->class = c;
+ d38:	66 89 5a 02          	mov    %bx,0x2(%edx)
+ d3c:	0f b7 db             	movzwl %bx,%ebx
+    p->kind = PSMALL;
+ d3f:	66 89 02             	mov    %ax,(%edx)
+    p->fresh = (char*)p + HDRSIZE;
+ d42:	8d 42 20             	lea    0x20(%edx),%eax
+ d45:	89 42 10             	mov    %eax,0x10(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ d48:	b8 e0 0f 00 00       	mov    $0xfe0,%eax
+ d4d:	d3 f8                	sar    %cl,%eax
+    p->free = 0;
+ d4f:	c7 42 0c 00 00 00 00 	movl   $0x0,0xc(%edx)
+    p->nfree = nblocks(c);
+ d56:	89 42 08             	mov    %eax,0x8(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ d59:	89 c1                	mov    %eax,%ecx
+  p->next = partial[p->class];
+ d5b:	8b 04 9d 88 31 00 00 	mov    0x3188(,%ebx,4),%eax
+  p->prev = 0;
+ d62:	c7 42 18 00 00 00 00 	movl   $0x0,0x18(%edx)
+  p->next = partial[p->class];
+ d69:	89 42 14             	mov    %eax,0x14(%edx)
+  if(p->next)
+ d6c:	85 c0                	test   %eax,%eax
+ d6e:	75 20                	jne    d90 <malloc+0x170>
+  partial[p->class] = p;
+ d70:	89 14 9d 88 31 00 00 	mov    %edx,0x3188(,%ebx,4)
+  if((b = p->free) != 0){
+ d77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d7e:	66 90                	xchg   %ax,%ax
+    b = (struct block*)p->fresh;
+ d80:	8b 5a 10             	mov    0x10(%edx),%ebx
+    p->fresh += MINSMALL << c;
+ d83:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+ d86:	89 42 10             	mov    %eax,0x10(%edx)
+ d89:	e9 4d ff ff ff       	jmp    cdb <malloc+0xbb>
+ d8e:	66 90                	xchg   %ax,%ax
+    p->next->prev = p;
+ d90:	89 50 18             	mov    %edx,0x18(%eax)
+  partial[p->class] = p;
+ d93:	0f b7 42 02          	movzwl 0x2(%edx),%eax
+  if((b = p->free) != 0){
+ d97:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ d9a:	8b 4a 08             	mov    0x8(%edx),%ecx
+  partial[p->class] = p;
+ d9d:	89 14 85 88 31 00 00 	mov    %edx,0x3188(,%eax,4)
+}
+ da4:	e9 25 ff ff ff       	jmp    cce <malloc+0xae>
+ da9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ db0:	be 10 00 00 00       	mov    $0x10,%esi
+ db5:	31 db                	xor    %ebx,%ebx
+ db7:	e9 01 ff ff ff       	jmp    cbd <malloc+0x9d>
+ dbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ dc0:	0f b7 4a 02          	movzwl 0x2(%edx),%ecx
+ dc4:	89 04 8d 88 31 00 00 	mov    %eax,0x3188(,%ecx,4)
+ dcb:	e9 24 ff ff ff       	jmp    cf4 <malloc+0xd4>
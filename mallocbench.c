@@ -0,0 +1,73 @@
+// Time malloc and free: pairs of small blocks, a pool of live
+// blocks of mixed sizes freed in random order, and large blocks.
+// Also report how much of the heap is given back to the kernel.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define NPAIR  200000
+#define NLIVE  2000
+#define NROUND 100000
+#define NLARGE 2000
+
+char *live[NLIVE];
+uint seed = 1;
+
+uint
+rand(void)
+{
+  seed = seed * 1103515245 + 12345;
+  return seed >> 8;
+}
+
+void
+report(char *what, int n, int start)
+{
+  printf(1, "%s: %d ops in %d ticks\n", what, n, uptime() - start);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, j, start;
+  char *p, *brk;
+
+  brk = sbrk(0);
+
+  start = uptime();
+  for(i = 0; i < NPAIR; i++){
+    p = malloc(1 + i % 100);
+    *p = i;
+    free(p);
+  }
+  report("small malloc/free pairs", NPAIR, start);
+
+  // Keep NLIVE blocks of 1 to 2048 bytes alive, replacing
+  // a random one each round, which fragments a free list.
+  start = uptime();
+  for(i = 0; i < NLIVE; i++)
+    live[i] = malloc(1 + rand() % 2048);
+  for(i = 0; i < NROUND; i++){
+    j = rand() % NLIVE;
+    free(live[j]);
+    if((live[j] = malloc(1 + rand() % 2048)) == 0){
+      printf(1, "mallocbench: out of memory\n");
+      exit();
+    }
+  }
+  report("random replace, mixed sizes", NROUND, start);
+  printf(1, "heap grew by %d KB\n", (sbrk(0) - brk) / 1024);
+  for(i = 0; i < NLIVE; i++)
+    free(live[i]);
+  printf(1, "after freeing everything: %d KB\n", (sbrk(0) - brk) / 1024);
+
+  start = uptime();
+  for(i = 0; i < NLARGE; i++){
+    p = malloc(8192 + rand() % (128*1024));
+    p[0] = 1;
+    free(p);
+  }
+  report("large malloc/free pairs", NLARGE, start);
+  exit();
+}
@@ -58,3 +58,11 @@ iderw(struct buf *b)
     memmove(b->data, p, BSIZE);
   b->flags |= B_VALID;
 }
+
+// The memory disk is synchronous: do the request now.
+void
+iderwasync(struct buf *b)
+{
+  iderw(b);
+  bdone(b);
+}
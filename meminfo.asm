@@ -0,0 +1,2014 @@
+
+_meminfo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+   f:	51                   	push   %ecx
+  10:	83 ec 0c             	sub    $0xc,%esp
+  13:	8b 11                	mov    (%ecx),%edx
+  15:	8b 71 04             	mov    0x4(%ecx),%esi
+  if(argc > 1)
+  18:	83 fa 01             	cmp    $0x1,%edx
+  1b:	7e 35                	jle    52 <main+0x52>
+    watch(atoi(argv[1]), argc > 2 ? atoi(argv[2]) : 0);
+  1d:	31 db                	xor    %ebx,%ebx
+  1f:	83 fa 02             	cmp    $0x2,%edx
+  22:	75 1c                	jne    40 <main+0x40>
+  24:	83 ec 0c             	sub    $0xc,%esp
+  27:	ff 76 04             	push   0x4(%esi)
+  2a:	e8 d1 04 00 00       	call   500 <atoi>
+  2f:	5a                   	pop    %edx
+  30:	59                   	pop    %ecx
+  31:	53                   	push   %ebx
+  32:	50                   	push   %eax
+  33:	e8 18 02 00 00       	call   250 <watch>
+  38:	83 c4 10             	add    $0x10,%esp
+  else
+    report();
+  exit();
+  3b:	e8 73 05 00 00       	call   5b3 <exit>
+    watch(atoi(argv[1]), argc > 2 ? atoi(argv[2]) : 0);
+  40:	83 ec 0c             	sub    $0xc,%esp
+  43:	ff 76 08             	push   0x8(%esi)
+  46:	e8 b5 04 00 00       	call   500 <atoi>
+  4b:	83 c4 10             	add    $0x10,%esp
+  4e:	89 c3                	mov    %eax,%ebx
+  50:	eb d2                	jmp    24 <main+0x24>
+    report();
+  52:	e8 19 00 00 00       	call   70 <report>
+  57:	eb e2                	jmp    3b <main+0x3b>
+  59:	66 90                	xchg   %ax,%ax
+  5b:	66 90                	xchg   %ax,%ax
+  5d:	66 90                	xchg   %ax,%ax
+  5f:	90                   	nop
+
+00000060 <kb>:
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  return pages * 4;
+  63:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+  66:	5d                   	pop    %ebp
+  return pages * 4;
+  67:	c1 e0 02             	shl    $0x2,%eax
+}
+  6a:	c3                   	ret
+  6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  6f:	90                   	nop
+
+00000070 <report>:
+{
+  70:	55                   	push   %ebp
+  71:	89 e5                	mov    %esp,%ebp
+  73:	57                   	push   %edi
+  74:	56                   	push   %esi
+  75:	53                   	push   %ebx
+  76:	83 ec 10             	sub    $0x10,%esp
+  if((n = memstats(&ms, pm, MAXPROC)) < 0){
+  79:	68 80 00 00 00       	push   $0x80
+  7e:	68 20 14 00 00       	push   $0x1420
+  83:	68 20 24 00 00       	push   $0x2420
+  88:	e8 26 06 00 00       	call   6b3 <memstats>
+  8d:	83 c4 10             	add    $0x10,%esp
+  90:	85 c0                	test   %eax,%eax
+  92:	0f 88 a1 01 00 00    	js     239 <report+0x1c9>
+  98:	89 c6                	mov    %eax,%esi
+  return pages * 4;
+  9a:	a1 20 24 00 00       	mov    0x2420,%eax
+  printf(1, "total       %d KB\n", kb(ms.total));
+  9f:	83 ec 04             	sub    $0x4,%esp
+  return pages * 4;
+  a2:	c1 e0 02             	shl    $0x2,%eax
+  printf(1, "total       %d KB\n", kb(ms.total));
+  a5:	50                   	push   %eax
+  a6:	68 6a 0e 00 00       	push   $0xe6a
+  ab:	6a 01                	push   $0x1
+  ad:	e8 ae 06 00 00       	call   760 <printf>
+  return pages * 4;
+  b2:	a1 2c 24 00 00       	mov    0x242c,%eax
+  b7:	c1 e0 02             	shl    $0x2,%eax
+  printf(1, "free        %d KB (%d KB zeroed, %d KB in 4MB pages)\n",
+  ba:	89 04 24             	mov    %eax,(%esp)
+  return pages * 4;
+  bd:	a1 28 24 00 00       	mov    0x2428,%eax
+  c2:	c1 e0 02             	shl    $0x2,%eax
+  printf(1, "free        %d KB (%d KB zeroed, %d KB in 4MB pages)\n",
+  c5:	50                   	push   %eax
+  return pages * 4;
+  c6:	a1 24 24 00 00       	mov    0x2424,%eax
+  cb:	c1 e0 02             	shl    $0x2,%eax
+  printf(1, "free        %d KB (%d KB zeroed, %d KB in 4MB pages)\n",
+  ce:	50                   	push   %eax
+  cf:	68 10 0f 00 00       	push   $0xf10
+  d4:	6a 01                	push   $0x1
+  d6:	e8 85 06 00 00       	call   760 <printf>
+  printf(1, "used        %d KB\n", kb(ms.total - ms.free));
+  db:	a1 20 24 00 00       	mov    0x2420,%eax
+  e0:	83 c4 1c             	add    $0x1c,%esp
+  e3:	2b 05 24 24 00 00    	sub    0x2424,%eax
+  return pages * 4;
+  e9:	c1 e0 02             	shl    $0x2,%eax
+  printf(1, "used        %d KB\n", kb(ms.total - ms.free));
+  ec:	50                   	push   %eax
+  ed:	68 7d 0e 00 00       	push   $0xe7d
+  f2:	6a 01                	push   $0x1
+  f4:	e8 67 06 00 00       	call   760 <printf>
+  return pages * 4;
+  f9:	a1 30 24 00 00       	mov    0x2430,%eax
+  printf(1, "  user      %d KB\n", kb(ms.user));
+  fe:	83 c4 0c             	add    $0xc,%esp
+  return pages * 4;
+ 101:	c1 e0 02             	shl    $0x2,%eax
+  printf(1, "  user      %d KB\n", kb(ms.user));
+ 104:	50                   	push   %eax
+ 105:	68 90 0e 00 00       	push   $0xe90
+ 10a:	6a 01                	push   $0x1
+ 10c:	e8 4f 06 00 00       	call   760 <printf>
+  return pages * 4;
+ 111:	a1 34 24 00 00       	mov    0x2434,%eax
+  printf(1, "  pagetable %d KB\n", kb(ms.ptpages));
+ 116:	83 c4 0c             	add    $0xc,%esp
+  return pages * 4;
+ 119:	c1 e0 02             	shl    $0x2,%eax
+  printf(1, "  pagetable %d KB\n", kb(ms.ptpages));
+ 11c:	50                   	push   %eax
+ 11d:	68 a3 0e 00 00       	push   $0xea3
+ 122:	6a 01                	push   $0x1
+ 124:	e8 37 06 00 00       	call   760 <printf>
+  return pages * 4;
+ 129:	a1 38 24 00 00       	mov    0x2438,%eax
+  printf(1, "  kstack    %d KB\n", kb(ms.kstacks));
+ 12e:	83 c4 0c             	add    $0xc,%esp
+  return pages * 4;
+ 131:	c1 e0 02             	shl    $0x2,%eax
+  printf(1, "  kstack    %d KB\n", kb(ms.kstacks));
+ 134:	50                   	push   %eax
+ 135:	68 b6 0e 00 00       	push   $0xeb6
+ 13a:	6a 01                	push   $0x1
+ 13c:	e8 1f 06 00 00       	call   760 <printf>
+  printf(1, "  bcache    %d KB, %d buffers\n", kb(ms.bufpages), ms.nbuf);
+ 141:	ff 35 40 24 00 00    	push   0x2440
+  return pages * 4;
+ 147:	a1 3c 24 00 00       	mov    0x243c,%eax
+ 14c:	c1 e0 02             	shl    $0x2,%eax
+  printf(1, "  bcache    %d KB, %d buffers\n", kb(ms.bufpages), ms.nbuf);
+ 14f:	50                   	push   %eax
+ 150:	68 48 0f 00 00       	push   $0xf48
+ 155:	6a 01                	push   $0x1
+ 157:	e8 04 06 00 00       	call   760 <printf>
+  printf(1, "bcache hits %d misses %d\n", ms.bhits, ms.bmisses);
+ 15c:	83 c4 20             	add    $0x20,%esp
+ 15f:	ff 35 48 24 00 00    	push   0x2448
+ 165:	ff 35 44 24 00 00    	push   0x2444
+ 16b:	68 c9 0e 00 00       	push   $0xec9
+ 170:	6a 01                	push   $0x1
+ 172:	e8 e9 05 00 00       	call   760 <printf>
+  printf(1, "\ncid name            procs    mem KB   peak KB  limit KB\n");
+ 177:	58                   	pop    %eax
+ 178:	5a                   	pop    %edx
+ 179:	68 68 0f 00 00       	push   $0xf68
+ 17e:	6a 01                	push   $0x1
+ 180:	e8 db 05 00 00       	call   760 <printf>
+  for(i = 0; i < ms.ncont; i++){
+ 185:	8b 0d 4c 24 00 00    	mov    0x244c,%ecx
+ 18b:	83 c4 10             	add    $0x10,%esp
+ 18e:	85 c9                	test   %ecx,%ecx
+ 190:	7e 47                	jle    1d9 <report+0x169>
+ 192:	bb 54 24 00 00       	mov    $0x2454,%ebx
+ 197:	31 ff                	xor    %edi,%edi
+ 199:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return pages * 4;
+ 1a0:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  for(i = 0; i < ms.ncont; i++){
+ 1a3:	83 c7 01             	add    $0x1,%edi
+  return pages * 4;
+ 1a6:	c1 e0 02             	shl    $0x2,%eax
+    printf(1, "%d   %s  %d  %d  %d  %d\n", cm->cid, cm->name, cm->nproc,
+ 1a9:	50                   	push   %eax
+  return pages * 4;
+ 1aa:	8b 43 18             	mov    0x18(%ebx),%eax
+ 1ad:	c1 e0 02             	shl    $0x2,%eax
+    printf(1, "%d   %s  %d  %d  %d  %d\n", cm->cid, cm->name, cm->nproc,
+ 1b0:	50                   	push   %eax
+  return pages * 4;
+ 1b1:	8b 43 14             	mov    0x14(%ebx),%eax
+ 1b4:	c1 e0 02             	shl    $0x2,%eax
+    printf(1, "%d   %s  %d  %d  %d  %d\n", cm->cid, cm->name, cm->nproc,
+ 1b7:	50                   	push   %eax
+ 1b8:	ff 73 10             	push   0x10(%ebx)
+ 1bb:	53                   	push   %ebx
+  for(i = 0; i < ms.ncont; i++){
+ 1bc:	83 c3 24             	add    $0x24,%ebx
+    printf(1, "%d   %s  %d  %d  %d  %d\n", cm->cid, cm->name, cm->nproc,
+ 1bf:	ff 73 d8             	push   -0x28(%ebx)
+ 1c2:	68 e3 0e 00 00       	push   $0xee3
+ 1c7:	6a 01                	push   $0x1
+ 1c9:	e8 92 05 00 00       	call   760 <printf>
+  for(i = 0; i < ms.ncont; i++){
+ 1ce:	83 c4 20             	add    $0x20,%esp
+ 1d1:	39 3d 4c 24 00 00    	cmp    %edi,0x244c
+ 1d7:	7f c7                	jg     1a0 <report+0x130>
+  printf(1, "\npid  cid  name          rss KB  pagetable KB\n");
+ 1d9:	83 ec 08             	sub    $0x8,%esp
+ 1dc:	68 a4 0f 00 00       	push   $0xfa4
+ 1e1:	6a 01                	push   $0x1
+ 1e3:	e8 78 05 00 00       	call   760 <printf>
+  for(i = 0; i < n; i++)
+ 1e8:	83 c4 10             	add    $0x10,%esp
+ 1eb:	85 f6                	test   %esi,%esi
+ 1ed:	74 42                	je     231 <report+0x1c1>
+ 1ef:	bb 28 14 00 00       	mov    $0x1428,%ebx
+ 1f4:	31 ff                	xor    %edi,%edi
+ 1f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fd:	8d 76 00             	lea    0x0(%esi),%esi
+  return pages * 4;
+ 200:	8b 43 14             	mov    0x14(%ebx),%eax
+    printf(1, "%d  %d  %s  %d  %d\n", pm[i].pid, pm[i].cid, pm[i].name,
+ 203:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < n; i++)
+ 206:	83 c7 01             	add    $0x1,%edi
+  return pages * 4;
+ 209:	c1 e0 02             	shl    $0x2,%eax
+    printf(1, "%d  %d  %s  %d  %d\n", pm[i].pid, pm[i].cid, pm[i].name,
+ 20c:	50                   	push   %eax
+  return pages * 4;
+ 20d:	8b 43 10             	mov    0x10(%ebx),%eax
+ 210:	c1 e0 02             	shl    $0x2,%eax
+    printf(1, "%d  %d  %s  %d  %d\n", pm[i].pid, pm[i].cid, pm[i].name,
+ 213:	50                   	push   %eax
+ 214:	53                   	push   %ebx
+  for(i = 0; i < n; i++)
+ 215:	83 c3 20             	add    $0x20,%ebx
+    printf(1, "%d  %d  %s  %d  %d\n", pm[i].pid, pm[i].cid, pm[i].name,
+ 218:	ff 73 dc             	push   -0x24(%ebx)
+ 21b:	ff 73 d8             	push   -0x28(%ebx)
+ 21e:	68 fc 0e 00 00       	push   $0xefc
+ 223:	6a 01                	push   $0x1
+ 225:	e8 36 05 00 00       	call   760 <printf>
+  for(i = 0; i < n; i++)
+ 22a:	83 c4 20             	add    $0x20,%esp
+ 22d:	39 fe                	cmp    %edi,%esi
+ 22f:	75 cf                	jne    200 <report+0x190>
+}
+ 231:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 234:	5b                   	pop    %ebx
+ 235:	5e                   	pop    %esi
+ 236:	5f                   	pop    %edi
+ 237:	5d                   	pop    %ebp
+ 238:	c3                   	ret
+    printf(2, "meminfo: memstats failed\n");
+ 239:	53                   	push   %ebx
+ 23a:	53                   	push   %ebx
+ 23b:	68 50 0e 00 00       	push   $0xe50
+ 240:	6a 02                	push   $0x2
+ 242:	e8 19 05 00 00       	call   760 <printf>
+    exit();
+ 247:	e8 67 03 00 00       	call   5b3 <exit>
+ 24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000250 <watch>:
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	57                   	push   %edi
+ 254:	56                   	push   %esi
+ 255:	53                   	push   %ebx
+ 256:	83 ec 1c             	sub    $0x1c,%esp
+  for(i = 0; count == 0 || i < count; i++){
+ 259:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 25c:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 25f:	85 c0                	test   %eax,%eax
+ 261:	0f 94 45 db          	sete   -0x25(%ebp)
+ 265:	85 d2                	test   %edx,%edx
+ 267:	0f 88 a5 00 00 00    	js     312 <watch+0xc2>
+ 26d:	31 db                	xor    %ebx,%ebx
+ 26f:	90                   	nop
+    if(memstats(&ms, 0, 0) < 0){
+ 270:	83 ec 04             	sub    $0x4,%esp
+ 273:	6a 00                	push   $0x0
+ 275:	6a 00                	push   $0x0
+ 277:	68 20 24 00 00       	push   $0x2420
+ 27c:	e8 32 04 00 00       	call   6b3 <memstats>
+ 281:	83 c4 10             	add    $0x10,%esp
+ 284:	85 c0                	test   %eax,%eax
+ 286:	0f 88 8e 00 00 00    	js     31a <watch+0xca>
+  return pages * 4;
+ 28c:	a1 3c 24 00 00       	mov    0x243c,%eax
+ 291:	8b 35 30 24 00 00    	mov    0x2430,%esi
+  for(i = 0; count == 0 || i < count; i++){
+ 297:	83 c3 01             	add    $0x1,%ebx
+  return pages * 4;
+ 29a:	8d 0c 85 00 00 00 00 	lea    0x0(,%eax,4),%ecx
+ 2a1:	a1 38 24 00 00       	mov    0x2438,%eax
+ 2a6:	8d 3c b5 00 00 00 00 	lea    0x0(,%esi,4),%edi
+ 2ad:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+ 2b0:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 2b7:	a1 34 24 00 00       	mov    0x2434,%eax
+ 2bc:	89 55 e0             	mov    %edx,-0x20(%ebp)
+ 2bf:	8b 15 24 24 00 00    	mov    0x2424,%edx
+ 2c5:	c1 e0 02             	shl    $0x2,%eax
+ 2c8:	8d 34 95 00 00 00 00 	lea    0x0(,%edx,4),%esi
+ 2cf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    printf(1, "%d: free %d KB user %d KB pagetable %d KB kstack %d KB bcache %d KB\n",
+ 2d2:	e8 74 03 00 00       	call   64b <uptime>
+ 2d7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+ 2da:	51                   	push   %ecx
+ 2db:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 2de:	52                   	push   %edx
+ 2df:	ff 75 e4             	push   -0x1c(%ebp)
+ 2e2:	57                   	push   %edi
+ 2e3:	56                   	push   %esi
+ 2e4:	50                   	push   %eax
+ 2e5:	68 d4 0f 00 00       	push   $0xfd4
+ 2ea:	6a 01                	push   $0x1
+ 2ec:	e8 6f 04 00 00       	call   760 <printf>
+    sleep(ticks);
+ 2f1:	83 c4 14             	add    $0x14,%esp
+ 2f4:	ff 75 08             	push   0x8(%ebp)
+ 2f7:	e8 47 03 00 00       	call   643 <sleep>
+  for(i = 0; count == 0 || i < count; i++){
+ 2fc:	83 c4 10             	add    $0x10,%esp
+ 2ff:	39 5d 0c             	cmp    %ebx,0xc(%ebp)
+ 302:	0f 8f 68 ff ff ff    	jg     270 <watch+0x20>
+ 308:	80 7d db 00          	cmpb   $0x0,-0x25(%ebp)
+ 30c:	0f 85 5e ff ff ff    	jne    270 <watch+0x20>
+}
+ 312:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 315:	5b                   	pop    %ebx
+ 316:	5e                   	pop    %esi
+ 317:	5f                   	pop    %edi
+ 318:	5d                   	pop    %ebp
+ 319:	c3                   	ret
+      printf(2, "meminfo: memstats failed\n");
+ 31a:	83 ec 08             	sub    $0x8,%esp
+ 31d:	68 50 0e 00 00       	push   $0xe50
+ 322:	6a 02                	push   $0x2
+ 324:	e8 37 04 00 00       	call   760 <printf>
+      exit();
+ 329:	e8 85 02 00 00       	call   5b3 <exit>
+ 32e:	66 90                	xchg   %ax,%ax
+
+00000330 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 330:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 331:	31 c0                	xor    %eax,%eax
+{
+ 333:	89 e5                	mov    %esp,%ebp
+ 335:	53                   	push   %ebx
+ 336:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 339:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 33c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 340:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 344:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 347:	83 c0 01             	add    $0x1,%eax
+ 34a:	84 d2                	test   %dl,%dl
+ 34c:	75 f2                	jne    340 <strcpy+0x10>
+    ;
+  return os;
+}
+ 34e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 351:	89 c8                	mov    %ecx,%eax
+ 353:	c9                   	leave
+ 354:	c3                   	ret
+ 355:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000360 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	53                   	push   %ebx
+ 364:	8b 55 08             	mov    0x8(%ebp),%edx
+ 367:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 36a:	0f b6 02             	movzbl (%edx),%eax
+ 36d:	84 c0                	test   %al,%al
+ 36f:	75 17                	jne    388 <strcmp+0x28>
+ 371:	eb 3a                	jmp    3ad <strcmp+0x4d>
+ 373:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 377:	90                   	nop
+ 378:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 37c:	83 c2 01             	add    $0x1,%edx
+ 37f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 382:	84 c0                	test   %al,%al
+ 384:	74 1a                	je     3a0 <strcmp+0x40>
+    p++, q++;
+ 386:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 388:	0f b6 19             	movzbl (%ecx),%ebx
+ 38b:	38 c3                	cmp    %al,%bl
+ 38d:	74 e9                	je     378 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 38f:	29 d8                	sub    %ebx,%eax
+}
+ 391:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 394:	c9                   	leave
+ 395:	c3                   	ret
+ 396:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 3a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 3a4:	31 c0                	xor    %eax,%eax
+ 3a6:	29 d8                	sub    %ebx,%eax
+}
+ 3a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3ab:	c9                   	leave
+ 3ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 3ad:	0f b6 19             	movzbl (%ecx),%ebx
+ 3b0:	31 c0                	xor    %eax,%eax
+ 3b2:	eb db                	jmp    38f <strcmp+0x2f>
+ 3b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3bf:	90                   	nop
+
+000003c0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 3c6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 3c9:	74 15                	je     3e0 <strlen+0x20>
+ 3cb:	31 c0                	xor    %eax,%eax
+ 3cd:	8d 76 00             	lea    0x0(%esi),%esi
+ 3d0:	83 c0 01             	add    $0x1,%eax
+ 3d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 3d7:	89 c1                	mov    %eax,%ecx
+ 3d9:	75 f5                	jne    3d0 <strlen+0x10>
+    ;
+  return n;
+}
+ 3db:	89 c8                	mov    %ecx,%eax
+ 3dd:	5d                   	pop    %ebp
+ 3de:	c3                   	ret
+ 3df:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 3e0:	31 c9                	xor    %ecx,%ecx
+}
+ 3e2:	5d                   	pop    %ebp
+ 3e3:	89 c8                	mov    %ecx,%eax
+ 3e5:	c3                   	ret
+ 3e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	57                   	push   %edi
+ 3f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 3f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3fd:	89 d7                	mov    %edx,%edi
+ 3ff:	fc                   	cld
+ 400:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 402:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 405:	89 d0                	mov    %edx,%eax
+ 407:	c9                   	leave
+ 408:	c3                   	ret
+ 409:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000410 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	8b 45 08             	mov    0x8(%ebp),%eax
+ 416:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 41a:	0f b6 10             	movzbl (%eax),%edx
+ 41d:	84 d2                	test   %dl,%dl
+ 41f:	75 12                	jne    433 <strchr+0x23>
+ 421:	eb 1d                	jmp    440 <strchr+0x30>
+ 423:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 427:	90                   	nop
+ 428:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 42c:	83 c0 01             	add    $0x1,%eax
+ 42f:	84 d2                	test   %dl,%dl
+ 431:	74 0d                	je     440 <strchr+0x30>
+    if(*s == c)
+ 433:	38 d1                	cmp    %dl,%cl
+ 435:	75 f1                	jne    428 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 437:	5d                   	pop    %ebp
+ 438:	c3                   	ret
+ 439:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 440:	31 c0                	xor    %eax,%eax
+}
+ 442:	5d                   	pop    %ebp
+ 443:	c3                   	ret
+ 444:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 44f:	90                   	nop
+
+00000450 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	57                   	push   %edi
+ 454:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 455:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 458:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 459:	31 db                	xor    %ebx,%ebx
+{
+ 45b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 45e:	eb 27                	jmp    487 <gets+0x37>
+    cc = read(0, &c, 1);
+ 460:	83 ec 04             	sub    $0x4,%esp
+ 463:	6a 01                	push   $0x1
+ 465:	56                   	push   %esi
+ 466:	6a 00                	push   $0x0
+ 468:	e8 5e 01 00 00       	call   5cb <read>
+    if(cc < 1)
+ 46d:	83 c4 10             	add    $0x10,%esp
+ 470:	85 c0                	test   %eax,%eax
+ 472:	7e 1d                	jle    491 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 474:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 478:	8b 55 08             	mov    0x8(%ebp),%edx
+ 47b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 47f:	3c 0a                	cmp    $0xa,%al
+ 481:	74 10                	je     493 <gets+0x43>
+ 483:	3c 0d                	cmp    $0xd,%al
+ 485:	74 0c                	je     493 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 487:	89 df                	mov    %ebx,%edi
+ 489:	83 c3 01             	add    $0x1,%ebx
+ 48c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 48f:	7c cf                	jl     460 <gets+0x10>
+ 491:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 493:	8b 45 08             	mov    0x8(%ebp),%eax
+ 496:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 49a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 49d:	5b                   	pop    %ebx
+ 49e:	5e                   	pop    %esi
+ 49f:	5f                   	pop    %edi
+ 4a0:	5d                   	pop    %ebp
+ 4a1:	c3                   	ret
+ 4a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004b0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	56                   	push   %esi
+ 4b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4b5:	83 ec 08             	sub    $0x8,%esp
+ 4b8:	6a 00                	push   $0x0
+ 4ba:	ff 75 08             	push   0x8(%ebp)
+ 4bd:	e8 31 01 00 00       	call   5f3 <open>
+  if(fd < 0)
+ 4c2:	83 c4 10             	add    $0x10,%esp
+ 4c5:	85 c0                	test   %eax,%eax
+ 4c7:	78 27                	js     4f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 4c9:	83 ec 08             	sub    $0x8,%esp
+ 4cc:	ff 75 0c             	push   0xc(%ebp)
+ 4cf:	89 c3                	mov    %eax,%ebx
+ 4d1:	50                   	push   %eax
+ 4d2:	e8 34 01 00 00       	call   60b <fstat>
+  close(fd);
+ 4d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 4da:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 4dc:	e8 fa 00 00 00       	call   5db <close>
+  return r;
+ 4e1:	83 c4 10             	add    $0x10,%esp
+}
+ 4e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4e7:	89 f0                	mov    %esi,%eax
+ 4e9:	5b                   	pop    %ebx
+ 4ea:	5e                   	pop    %esi
+ 4eb:	5d                   	pop    %ebp
+ 4ec:	c3                   	ret
+ 4ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 4f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 4f5:	eb ed                	jmp    4e4 <stat+0x34>
+ 4f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4fe:	66 90                	xchg   %ax,%ax
+
+00000500 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 500:	55                   	push   %ebp
+ 501:	89 e5                	mov    %esp,%ebp
+ 503:	53                   	push   %ebx
+ 504:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 507:	0f be 02             	movsbl (%edx),%eax
+ 50a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 50d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 510:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 515:	77 1e                	ja     535 <atoi+0x35>
+ 517:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 51e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 520:	83 c2 01             	add    $0x1,%edx
+ 523:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 526:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 52a:	0f be 02             	movsbl (%edx),%eax
+ 52d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 530:	80 fb 09             	cmp    $0x9,%bl
+ 533:	76 eb                	jbe    520 <atoi+0x20>
+  return n;
+}
+ 535:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 538:	89 c8                	mov    %ecx,%eax
+ 53a:	c9                   	leave
+ 53b:	c3                   	ret
+ 53c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000540 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	57                   	push   %edi
+ 544:	56                   	push   %esi
+ 545:	8b 45 10             	mov    0x10(%ebp),%eax
+ 548:	8b 55 08             	mov    0x8(%ebp),%edx
+ 54b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 54e:	85 c0                	test   %eax,%eax
+ 550:	7e 13                	jle    565 <memmove+0x25>
+ 552:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 554:	89 d7                	mov    %edx,%edi
+ 556:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 560:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 561:	39 f8                	cmp    %edi,%eax
+ 563:	75 fb                	jne    560 <memmove+0x20>
+  return vdst;
+}
+ 565:	5e                   	pop    %esi
+ 566:	89 d0                	mov    %edx,%eax
+ 568:	5f                   	pop    %edi
+ 569:	5d                   	pop    %ebp
+ 56a:	c3                   	ret
+
+0000056b <ccreate>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(ccreate)
+ 56b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <cfork>:
+SYSCALL(cfork)
+ 573:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <cgetrootdir>:
+SYSCALL(cgetrootdir)
+ 57b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <getcontrootdir>:
+SYSCALL(getcontrootdir)
+ 583:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <cpause>:
+SYSCALL(cpause)
+ 58b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <cresume>:
+SYSCALL(cresume)
+ 593:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <cstart>:
+SYSCALL(cstart)
+ 59b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <cstop>:
+SYSCALL(cstop)
+ 5a3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <fork>:
+SYSCALL(fork)
+ 5ab:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <exit>:
+SYSCALL(exit)
+ 5b3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <wait>:
+SYSCALL(wait)
+ 5bb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <pipe>:
+SYSCALL(pipe)
+ 5c3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <read>:
+SYSCALL(read)
+ 5cb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <write>:
+SYSCALL(write)
+ 5d3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <close>:
+SYSCALL(close)
+ 5db:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <kill>:
+SYSCALL(kill)
+ 5e3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <exec>:
+SYSCALL(exec)
+ 5eb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <open>:
+SYSCALL(open)
+ 5f3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <mknod>:
+SYSCALL(mknod)
+ 5fb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <unlink>:
+SYSCALL(unlink)
+ 603:	b8 12 00 00 00       	mov    $0x12,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <fstat>:
+SYSCALL(fstat)
+ 60b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <link>:
+SYSCALL(link)
+ 613:	b8 13 00 00 00       	mov    $0x13,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <mkdir>:
+SYSCALL(mkdir)
+ 61b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <chdir>:
+SYSCALL(chdir)
+ 623:	b8 09 00 00 00       	mov    $0x9,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <dup>:
+SYSCALL(dup)
+ 62b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <getpid>:
+SYSCALL(getpid)
+ 633:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <sbrk>:
+SYSCALL(sbrk)
+ 63b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <sleep>:
+SYSCALL(sleep)
+ 643:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <uptime>:
+SYSCALL(uptime)
+ 64b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <cps>:
+SYSCALL(cps)
+ 653:	b8 16 00 00 00       	mov    $0x16,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <mmap>:
+SYSCALL(mmap)
+ 65b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <munmap>:
+SYSCALL(munmap)
+ 663:	b8 20 00 00 00       	mov    $0x20,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <shmget>:
+SYSCALL(shmget)
+ 66b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <climit>:
+SYSCALL(climit)
+ 673:	b8 22 00 00 00       	mov    $0x22,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <spawn>:
+SYSCALL(spawn)
+ 67b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <clone>:
+SYSCALL(clone)
+ 683:	b8 24 00 00 00       	mov    $0x24,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <join>:
+SYSCALL(join)
+ 68b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <futex>:
+SYSCALL(futex)
+ 693:	b8 26 00 00 00       	mov    $0x26,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <ccheckpoint>:
+SYSCALL(ccheckpoint)
+ 69b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <crestore>:
+SYSCALL(crestore)
+ 6a3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <czygote>:
+SYSCALL(czygote)
+ 6ab:	b8 29 00 00 00       	mov    $0x29,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <memstats>:
+SYSCALL(memstats)
+ 6b3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+ 6bb:	66 90                	xchg   %ax,%ax
+ 6bd:	66 90                	xchg   %ax,%ax
+ 6bf:	90                   	nop
+
+000006c0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6c0:	55                   	push   %ebp
+ 6c1:	89 e5                	mov    %esp,%ebp
+ 6c3:	57                   	push   %edi
+ 6c4:	56                   	push   %esi
+ 6c5:	53                   	push   %ebx
+ 6c6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 6c8:	89 d1                	mov    %edx,%ecx
+{
+ 6ca:	83 ec 3c             	sub    $0x3c,%esp
+ 6cd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 6d0:	85 d2                	test   %edx,%edx
+ 6d2:	0f 89 80 00 00 00    	jns    758 <printint+0x98>
+ 6d8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 6dc:	74 7a                	je     758 <printint+0x98>
+    x = -xx;
+ 6de:	f7 d9                	neg    %ecx
+    neg = 1;
+ 6e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 6e5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 6e8:	31 f6                	xor    %esi,%esi
+ 6ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 6f0:	89 c8                	mov    %ecx,%eax
+ 6f2:	31 d2                	xor    %edx,%edx
+ 6f4:	89 f7                	mov    %esi,%edi
+ 6f6:	f7 f3                	div    %ebx
+ 6f8:	8d 76 01             	lea    0x1(%esi),%esi
+ 6fb:	0f b6 92 78 10 00 00 	movzbl 0x1078(%edx),%edx
+ 702:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 706:	89 ca                	mov    %ecx,%edx
+ 708:	89 c1                	mov    %eax,%ecx
+ 70a:	39 da                	cmp    %ebx,%edx
+ 70c:	73 e2                	jae    6f0 <printint+0x30>
+  if(neg)
+ 70e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 711:	85 c0                	test   %eax,%eax
+ 713:	74 07                	je     71c <printint+0x5c>
+    buf[i++] = '-';
+ 715:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 71a:	89 f7                	mov    %esi,%edi
+ 71c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 71f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 722:	01 df                	add    %ebx,%edi
+ 724:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 728:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 72b:	83 ec 04             	sub    $0x4,%esp
+ 72e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 731:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 734:	6a 01                	push   $0x1
+ 736:	50                   	push   %eax
+ 737:	56                   	push   %esi
+ 738:	e8 96 fe ff ff       	call   5d3 <write>
+  while(--i >= 0)
+ 73d:	89 f8                	mov    %edi,%eax
+ 73f:	83 c4 10             	add    $0x10,%esp
+ 742:	83 ef 01             	sub    $0x1,%edi
+ 745:	39 d8                	cmp    %ebx,%eax
+ 747:	75 df                	jne    728 <printint+0x68>
+}
+ 749:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 74c:	5b                   	pop    %ebx
+ 74d:	5e                   	pop    %esi
+ 74e:	5f                   	pop    %edi
+ 74f:	5d                   	pop    %ebp
+ 750:	c3                   	ret
+ 751:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 758:	31 c0                	xor    %eax,%eax
+ 75a:	eb 89                	jmp    6e5 <printint+0x25>
+ 75c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000760 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 760:	55                   	push   %ebp
+ 761:	89 e5                	mov    %esp,%ebp
+ 763:	57                   	push   %edi
+ 764:	56                   	push   %esi
+ 765:	53                   	push   %ebx
+ 766:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 769:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 76c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 76f:	0f b6 1e             	movzbl (%esi),%ebx
+ 772:	83 c6 01             	add    $0x1,%esi
+ 775:	84 db                	test   %bl,%bl
+ 777:	74 67                	je     7e0 <printf+0x80>
+ 779:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 77c:	31 d2                	xor    %edx,%edx
+ 77e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 781:	eb 34                	jmp    7b7 <printf+0x57>
+ 783:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 787:	90                   	nop
+ 788:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 78b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 790:	83 f8 25             	cmp    $0x25,%eax
+ 793:	74 18                	je     7ad <printf+0x4d>
+  write(fd, &c, 1);
+ 795:	83 ec 04             	sub    $0x4,%esp
+ 798:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 79b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 79e:	6a 01                	push   $0x1
+ 7a0:	50                   	push   %eax
+ 7a1:	57                   	push   %edi
+ 7a2:	e8 2c fe ff ff       	call   5d3 <write>
+ 7a7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 7aa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 7ad:	0f b6 1e             	movzbl (%esi),%ebx
+ 7b0:	83 c6 01             	add    $0x1,%esi
+ 7b3:	84 db                	test   %bl,%bl
+ 7b5:	74 29                	je     7e0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 7b7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 7ba:	85 d2                	test   %edx,%edx
+ 7bc:	74 ca                	je     788 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 7be:	83 fa 25             	cmp    $0x25,%edx
+ 7c1:	75 ea                	jne    7ad <printf+0x4d>
+      if(c == 'd'){
+ 7c3:	83 f8 25             	cmp    $0x25,%eax
+ 7c6:	0f 84 24 01 00 00    	je     8f0 <printf+0x190>
+ 7cc:	83 e8 63             	sub    $0x63,%eax
+ 7cf:	83 f8 15             	cmp    $0x15,%eax
+ 7d2:	77 1c                	ja     7f0 <printf+0x90>
+ 7d4:	ff 24 85 20 10 00 00 	jmp    *0x1020(,%eax,4)
+ 7db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7df:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 7e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7e3:	5b                   	pop    %ebx
+ 7e4:	5e                   	pop    %esi
+ 7e5:	5f                   	pop    %edi
+ 7e6:	5d                   	pop    %ebp
+ 7e7:	c3                   	ret
+ 7e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ef:	90                   	nop
+  write(fd, &c, 1);
+ 7f0:	83 ec 04             	sub    $0x4,%esp
+ 7f3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7f6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 7fa:	6a 01                	push   $0x1
+ 7fc:	52                   	push   %edx
+ 7fd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 800:	57                   	push   %edi
+ 801:	e8 cd fd ff ff       	call   5d3 <write>
+ 806:	83 c4 0c             	add    $0xc,%esp
+ 809:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 80c:	6a 01                	push   $0x1
+ 80e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 811:	52                   	push   %edx
+ 812:	57                   	push   %edi
+ 813:	e8 bb fd ff ff       	call   5d3 <write>
+        putc(fd, c);
+ 818:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 81b:	31 d2                	xor    %edx,%edx
+ 81d:	eb 8e                	jmp    7ad <printf+0x4d>
+ 81f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 820:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 823:	83 ec 0c             	sub    $0xc,%esp
+ 826:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 82b:	8b 13                	mov    (%ebx),%edx
+ 82d:	6a 00                	push   $0x0
+ 82f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 831:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 834:	e8 87 fe ff ff       	call   6c0 <printint>
+        ap++;
+ 839:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 83c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 83f:	31 d2                	xor    %edx,%edx
+ 841:	e9 67 ff ff ff       	jmp    7ad <printf+0x4d>
+ 846:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 84d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 850:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 853:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 855:	83 c0 04             	add    $0x4,%eax
+ 858:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 85b:	85 db                	test   %ebx,%ebx
+ 85d:	0f 84 9d 00 00 00    	je     900 <printf+0x1a0>
+        while(*s != 0){
+ 863:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 866:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 868:	84 c0                	test   %al,%al
+ 86a:	0f 84 3d ff ff ff    	je     7ad <printf+0x4d>
+ 870:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 873:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 876:	89 de                	mov    %ebx,%esi
+ 878:	89 d3                	mov    %edx,%ebx
+ 87a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 880:	83 ec 04             	sub    $0x4,%esp
+ 883:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 886:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 889:	6a 01                	push   $0x1
+ 88b:	53                   	push   %ebx
+ 88c:	57                   	push   %edi
+ 88d:	e8 41 fd ff ff       	call   5d3 <write>
+        while(*s != 0){
+ 892:	0f b6 06             	movzbl (%esi),%eax
+ 895:	83 c4 10             	add    $0x10,%esp
+ 898:	84 c0                	test   %al,%al
+ 89a:	75 e4                	jne    880 <printf+0x120>
+      state = 0;
+ 89c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 89f:	31 d2                	xor    %edx,%edx
+ 8a1:	e9 07 ff ff ff       	jmp    7ad <printf+0x4d>
+ 8a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ad:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 8b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8b3:	83 ec 0c             	sub    $0xc,%esp
+ 8b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 8bb:	8b 13                	mov    (%ebx),%edx
+ 8bd:	6a 01                	push   $0x1
+ 8bf:	e9 6b ff ff ff       	jmp    82f <printf+0xcf>
+ 8c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 8c8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 8cb:	83 ec 04             	sub    $0x4,%esp
+ 8ce:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 8d1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 8d3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 8d6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 8d9:	6a 01                	push   $0x1
+ 8db:	52                   	push   %edx
+ 8dc:	57                   	push   %edi
+ 8dd:	e8 f1 fc ff ff       	call   5d3 <write>
+        ap++;
+ 8e2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8e5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8e8:	31 d2                	xor    %edx,%edx
+ 8ea:	e9 be fe ff ff       	jmp    7ad <printf+0x4d>
+ 8ef:	90                   	nop
+  write(fd, &c, 1);
+ 8f0:	83 ec 04             	sub    $0x4,%esp
+ 8f3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8f6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8f9:	6a 01                	push   $0x1
+ 8fb:	e9 11 ff ff ff       	jmp    811 <printf+0xb1>
+ 900:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 905:	bb 19 10 00 00       	mov    $0x1019,%ebx
+ 90a:	e9 61 ff ff ff       	jmp    870 <printf+0x110>
+ 90f:	90                   	nop
+
+00000910 <runfree>:
+
+// Give the n pages at r back to the free runs, merging them with
+// adjacent runs, and shrink the heap if the end of it is free.
+static void
+runfree(struct page *r, uint n)
+{
+ 910:	55                   	push   %ebp
+  struct page **pp, *prev;
+
+  r->kind = PFREE;
+ 911:	b9 03 00 00 00       	mov    $0x3,%ecx
+{
+ 916:	89 e5                	mov    %esp,%ebp
+ 918:	57                   	push   %edi
+ 919:	56                   	push   %esi
+ 91a:	53                   	push   %ebx
+ 91b:	89 c3                	mov    %eax,%ebx
+ 91d:	83 ec 0c             	sub    $0xc,%esp
+  r->kind = PFREE;
+ 920:	66 89 08             	mov    %cx,(%eax)
+  r->npages = n;
+  prev = 0;
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 923:	8b 0d 74 25 00 00    	mov    0x2574,%ecx
+  r->npages = n;
+ 929:	89 50 04             	mov    %edx,0x4(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 92c:	85 c9                	test   %ecx,%ecx
+ 92e:	0f 84 1f 01 00 00    	je     a53 <runfree+0x143>
+ 934:	39 c1                	cmp    %eax,%ecx
+ 936:	0f 83 f7 00 00 00    	jae    a33 <runfree+0x123>
+ 93c:	89 c8                	mov    %ecx,%eax
+ 93e:	eb 04                	jmp    944 <runfree+0x34>
+ 940:	39 d8                	cmp    %ebx,%eax
+ 942:	73 09                	jae    94d <runfree+0x3d>
+ 944:	89 c2                	mov    %eax,%edx
+ 946:	8b 40 14             	mov    0x14(%eax),%eax
+ 949:	85 c0                	test   %eax,%eax
+ 94b:	75 f3                	jne    940 <runfree+0x30>
+    prev = *pp;
+  r->next = *pp;
+ 94d:	89 43 14             	mov    %eax,0x14(%ebx)
+  *pp = r;
+ 950:	89 5a 14             	mov    %ebx,0x14(%edx)
+
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 953:	8b 43 14             	mov    0x14(%ebx),%eax
+ 956:	85 c0                	test   %eax,%eax
+ 958:	74 12                	je     96c <runfree+0x5c>
+ 95a:	8b 7b 04             	mov    0x4(%ebx),%edi
+ 95d:	89 fe                	mov    %edi,%esi
+ 95f:	c1 e6 0c             	shl    $0xc,%esi
+ 962:	01 de                	add    %ebx,%esi
+ 964:	39 f0                	cmp    %esi,%eax
+ 966:	0f 84 a4 00 00 00    	je     a10 <runfree+0x100>
+    r->npages += r->next->npages;
+    r->next = r->next->next;
+  }
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 96c:	8b 72 04             	mov    0x4(%edx),%esi
+ 96f:	89 f0                	mov    %esi,%eax
+ 971:	c1 e0 0c             	shl    $0xc,%eax
+ 974:	01 d0                	add    %edx,%eax
+ 976:	39 c3                	cmp    %eax,%ebx
+ 978:	74 16                	je     990 <runfree+0x80>
+    pp = &runs;
+    while(*pp != r)
+      pp = &(*pp)->next;
+  }
+
+  if(r->next == 0 && r->npages >= TRIM &&
+ 97a:	8b 43 14             	mov    0x14(%ebx),%eax
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 97d:	8d 72 14             	lea    0x14(%edx),%esi
+  if(r->next == 0 && r->npages >= TRIM &&
+ 980:	85 c0                	test   %eax,%eax
+ 982:	74 3c                	je     9c0 <runfree+0xb0>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+    *pp = 0;
+    sbrk(-(int)(r->npages*PGSIZE));
+    heapend = (char*)r;
+  }
+}
+ 984:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 987:	5b                   	pop    %ebx
+ 988:	5e                   	pop    %esi
+ 989:	5f                   	pop    %edi
+ 98a:	5d                   	pop    %ebp
+ 98b:	c3                   	ret
+ 98c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    prev->npages += r->npages;
+ 990:	03 73 04             	add    0x4(%ebx),%esi
+ 993:	89 72 04             	mov    %esi,0x4(%edx)
+    prev->next = r->next;
+ 996:	8b 43 14             	mov    0x14(%ebx),%eax
+ 999:	89 42 14             	mov    %eax,0x14(%edx)
+    while(*pp != r)
+ 99c:	39 d1                	cmp    %edx,%ecx
+ 99e:	0f 84 c5 00 00 00    	je     a69 <runfree+0x159>
+ 9a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      pp = &(*pp)->next;
+ 9a8:	89 cb                	mov    %ecx,%ebx
+ 9aa:	8b 49 14             	mov    0x14(%ecx),%ecx
+    while(*pp != r)
+ 9ad:	39 d1                	cmp    %edx,%ecx
+ 9af:	75 f7                	jne    9a8 <runfree+0x98>
+      pp = &(*pp)->next;
+ 9b1:	8d 73 14             	lea    0x14(%ebx),%esi
+ 9b4:	89 cb                	mov    %ecx,%ebx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 9b6:	85 c0                	test   %eax,%eax
+ 9b8:	75 ca                	jne    984 <runfree+0x74>
+ 9ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 9c0:	8b 53 04             	mov    0x4(%ebx),%edx
+ 9c3:	83 fa 1f             	cmp    $0x1f,%edx
+ 9c6:	76 bc                	jbe    984 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 9c8:	c1 e2 0c             	shl    $0xc,%edx
+ 9cb:	01 da                	add    %ebx,%edx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 9cd:	39 15 70 25 00 00    	cmp    %edx,0x2570
+ 9d3:	75 af                	jne    984 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 9d5:	83 ec 0c             	sub    $0xc,%esp
+ 9d8:	6a 00                	push   $0x0
+ 9da:	e8 5c fc ff ff       	call   63b <sbrk>
+ 9df:	83 c4 10             	add    $0x10,%esp
+ 9e2:	39 05 70 25 00 00    	cmp    %eax,0x2570
+ 9e8:	75 9a                	jne    984 <runfree+0x74>
+    *pp = 0;
+ 9ea:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    sbrk(-(int)(r->npages*PGSIZE));
+ 9f0:	8b 43 04             	mov    0x4(%ebx),%eax
+ 9f3:	83 ec 0c             	sub    $0xc,%esp
+ 9f6:	c1 e0 0c             	shl    $0xc,%eax
+ 9f9:	f7 d8                	neg    %eax
+ 9fb:	50                   	push   %eax
+ 9fc:	e8 3a fc ff ff       	call   63b <sbrk>
+    heapend = (char*)r;
+ a01:	89 1d 70 25 00 00    	mov    %ebx,0x2570
+ a07:	83 c4 10             	add    $0x10,%esp
+}
+ a0a:	e9 75 ff ff ff       	jmp    984 <runfree+0x74>
+ a0f:	90                   	nop
+    r->npages += r->next->npages;
+ a10:	03 78 04             	add    0x4(%eax),%edi
+ a13:	89 7b 04             	mov    %edi,0x4(%ebx)
+    r->next = r->next->next;
+ a16:	8b 40 14             	mov    0x14(%eax),%eax
+ a19:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ a1c:	8b 72 04             	mov    0x4(%edx),%esi
+ a1f:	89 f0                	mov    %esi,%eax
+ a21:	c1 e0 0c             	shl    $0xc,%eax
+ a24:	01 d0                	add    %edx,%eax
+ a26:	39 c3                	cmp    %eax,%ebx
+ a28:	0f 85 4c ff ff ff    	jne    97a <runfree+0x6a>
+ a2e:	e9 5d ff ff ff       	jmp    990 <runfree+0x80>
+  r->next = *pp;
+ a33:	89 48 14             	mov    %ecx,0x14(%eax)
+  *pp = r;
+ a36:	a3 74 25 00 00       	mov    %eax,0x2574
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ a3b:	89 d0                	mov    %edx,%eax
+ a3d:	c1 e0 0c             	shl    $0xc,%eax
+ a40:	01 d8                	add    %ebx,%eax
+ a42:	39 c1                	cmp    %eax,%ecx
+ a44:	74 2f                	je     a75 <runfree+0x165>
+  if(r->next == 0 && r->npages >= TRIM &&
+ a46:	8b 43 14             	mov    0x14(%ebx),%eax
+ a49:	be 74 25 00 00       	mov    $0x2574,%esi
+ a4e:	e9 2d ff ff ff       	jmp    980 <runfree+0x70>
+  r->next = *pp;
+ a53:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ a5a:	be 74 25 00 00       	mov    $0x2574,%esi
+  *pp = r;
+ a5f:	a3 74 25 00 00       	mov    %eax,0x2574
+  if(r->next == 0 && r->npages >= TRIM &&
+ a64:	e9 5a ff ff ff       	jmp    9c3 <runfree+0xb3>
+    while(*pp != r)
+ a69:	89 cb                	mov    %ecx,%ebx
+    pp = &runs;
+ a6b:	be 74 25 00 00       	mov    $0x2574,%esi
+ a70:	e9 0b ff ff ff       	jmp    980 <runfree+0x70>
+    r->npages += r->next->npages;
+ a75:	03 51 04             	add    0x4(%ecx),%edx
+ a78:	89 53 04             	mov    %edx,0x4(%ebx)
+    r->next = r->next->next;
+ a7b:	8b 41 14             	mov    0x14(%ecx),%eax
+ a7e:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ a81:	eb c3                	jmp    a46 <runfree+0x136>
+ a83:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a90 <runalloc>:
+
+// Take a run of n pages from the start of the first free run
+// long enough, which keeps the end of the heap free to trim.
+static struct page*
+runalloc(uint n)
+{
+ a90:	55                   	push   %ebp
+ a91:	89 e5                	mov    %esp,%ebp
+ a93:	57                   	push   %edi
+ a94:	56                   	push   %esi
+ a95:	89 c6                	mov    %eax,%esi
+ a97:	53                   	push   %ebx
+ a98:	83 ec 1c             	sub    $0x1c,%esp
+  struct page **pp, *r, *rest;
+
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ a9b:	8b 1d 74 25 00 00    	mov    0x2574,%ebx
+ aa1:	85 db                	test   %ebx,%ebx
+ aa3:	74 4d                	je     af2 <runalloc+0x62>
+ aa5:	b9 74 25 00 00       	mov    $0x2574,%ecx
+    if(r->npages < n)
+ aaa:	39 73 04             	cmp    %esi,0x4(%ebx)
+ aad:	72 39                	jb     ae8 <runalloc+0x58>
+      continue;
+    if(r->npages == n){
+ aaf:	0f 84 9b 00 00 00    	je     b50 <runalloc+0xc0>
+      *pp = r->next;
+    } else {
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ ab5:	89 f0                	mov    %esi,%eax
+      rest->kind = PFREE;
+ ab7:	ba 03 00 00 00       	mov    $0x3,%edx
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ abc:	c1 e0 0c             	shl    $0xc,%eax
+ abf:	01 d8                	add    %ebx,%eax
+      rest->kind = PFREE;
+ ac1:	66 89 10             	mov    %dx,(%eax)
+      rest->npages = r->npages - n;
+ ac4:	8b 53 04             	mov    0x4(%ebx),%edx
+ ac7:	29 f2                	sub    %esi,%edx
+ ac9:	89 50 04             	mov    %edx,0x4(%eax)
+      rest->next = r->next;
+ acc:	8b 53 14             	mov    0x14(%ebx),%edx
+ acf:	89 50 14             	mov    %edx,0x14(%eax)
+      *pp = rest;
+ ad2:	89 01                	mov    %eax,(%ecx)
+      r->npages = n;
+ ad4:	89 73 04             	mov    %esi,0x4(%ebx)
+    }
+    return r;
+  }
+  return morecore(n);
+}
+ ad7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ada:	89 d8                	mov    %ebx,%eax
+ adc:	5b                   	pop    %ebx
+ add:	5e                   	pop    %esi
+ ade:	5f                   	pop    %edi
+ adf:	5d                   	pop    %ebp
+ ae0:	c3                   	ret
+ ae1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ ae8:	8d 4b 14             	lea    0x14(%ebx),%ecx
+ aeb:	8b 5b 14             	mov    0x14(%ebx),%ebx
+ aee:	85 db                	test   %ebx,%ebx
+ af0:	75 b8                	jne    aaa <runalloc+0x1a>
+  m = n < MINCORE ? MINCORE : n;
+ af2:	bf 08 00 00 00       	mov    $0x8,%edi
+ af7:	39 fe                	cmp    %edi,%esi
+ af9:	0f 43 fe             	cmovae %esi,%edi
+  brk = sbrk(0);
+ afc:	83 ec 0c             	sub    $0xc,%esp
+ aff:	6a 00                	push   $0x0
+ b01:	e8 35 fb ff ff       	call   63b <sbrk>
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ b06:	89 fa                	mov    %edi,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ b08:	89 c3                	mov    %eax,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ b0a:	c1 e2 0c             	shl    $0xc,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ b0d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ b10:	f7 db                	neg    %ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ b12:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ b15:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ b1b:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+ b1e:	89 04 24             	mov    %eax,(%esp)
+ b21:	e8 15 fb ff ff       	call   63b <sbrk>
+ b26:	83 c4 10             	add    $0x10,%esp
+ b29:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ b2c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ b2f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b32:	74 3e                	je     b72 <runalloc+0xe2>
+  r = (struct page*)(brk + pad);
+ b34:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ b36:	01 da                	add    %ebx,%edx
+ b38:	89 15 70 25 00 00    	mov    %edx,0x2570
+  if(m > n)
+ b3e:	39 fe                	cmp    %edi,%esi
+ b40:	72 1e                	jb     b60 <runalloc+0xd0>
+  r->npages = n;
+ b42:	89 73 04             	mov    %esi,0x4(%ebx)
+  return r;
+ b45:	eb 90                	jmp    ad7 <runalloc+0x47>
+ b47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b4e:	66 90                	xchg   %ax,%ax
+      *pp = r->next;
+ b50:	8b 43 14             	mov    0x14(%ebx),%eax
+ b53:	89 01                	mov    %eax,(%ecx)
+}
+ b55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b58:	89 d8                	mov    %ebx,%eax
+ b5a:	5b                   	pop    %ebx
+ b5b:	5e                   	pop    %esi
+ b5c:	5f                   	pop    %edi
+ b5d:	5d                   	pop    %ebp
+ b5e:	c3                   	ret
+ b5f:	90                   	nop
+    runfree((struct page*)((char*)r + n*PGSIZE), m - n);
+ b60:	89 f0                	mov    %esi,%eax
+ b62:	29 f7                	sub    %esi,%edi
+ b64:	c1 e0 0c             	shl    $0xc,%eax
+ b67:	89 fa                	mov    %edi,%edx
+ b69:	01 d8                	add    %ebx,%eax
+ b6b:	e8 a0 fd ff ff       	call   910 <runfree>
+ b70:	eb d0                	jmp    b42 <runalloc+0xb2>
+    if(sbrk(pad + m*PGSIZE) == (char*)-1)
+ b72:	89 f7                	mov    %esi,%edi
+ b74:	83 ec 0c             	sub    $0xc,%esp
+ b77:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ b7a:	c1 e7 0c             	shl    $0xc,%edi
+ b7d:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+ b80:	50                   	push   %eax
+ b81:	e8 b5 fa ff ff       	call   63b <sbrk>
+ b86:	83 c4 10             	add    $0x10,%esp
+ b89:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ b8c:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b8f:	74 0c                	je     b9d <runalloc+0x10d>
+  r = (struct page*)(brk + pad);
+ b91:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ b93:	01 df                	add    %ebx,%edi
+ b95:	89 3d 70 25 00 00    	mov    %edi,0x2570
+  if(m > n)
+ b9b:	eb a5                	jmp    b42 <runalloc+0xb2>
+      return 0;
+ b9d:	31 db                	xor    %ebx,%ebx
+ b9f:	e9 33 ff ff ff       	jmp    ad7 <runalloc+0x47>
+ ba4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ baf:	90                   	nop
+
+00000bb0 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+ bb0:	55                   	push   %ebp
+ bb1:	89 e5                	mov    %esp,%ebp
+ bb3:	56                   	push   %esi
+ bb4:	53                   	push   %ebx
+ bb5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  struct page *p;
+
+  if(ap == 0)
+ bb8:	85 c9                	test   %ecx,%ecx
+ bba:	74 1c                	je     bd8 <free+0x28>
+    return;
+  p = (struct page*)((uint)ap & ~(PGSIZE-1));
+ bbc:	89 c8                	mov    %ecx,%eax
+ bbe:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  switch(p->kind){
+ bc3:	0f b7 10             	movzwl (%eax),%edx
+ bc6:	66 83 fa 02          	cmp    $0x2,%dx
+ bca:	74 14                	je     be0 <free+0x30>
+ bcc:	66 83 fa 04          	cmp    $0x4,%dx
+ bd0:	74 66                	je     c38 <free+0x88>
+ bd2:	66 83 fa 01          	cmp    $0x1,%dx
+ bd6:	74 18                	je     bf0 <free+0x40>
+    break;
+  case PMAP:
+    munmap(p, p->npages*PGSIZE);
+    break;
+  }
+}
+ bd8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ bdb:	5b                   	pop    %ebx
+ bdc:	5e                   	pop    %esi
+ bdd:	5d                   	pop    %ebp
+ bde:	c3                   	ret
+ bdf:	90                   	nop
+    runfree(p, p->npages);
+ be0:	8b 50 04             	mov    0x4(%eax),%edx
+}
+ be3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ be6:	5b                   	pop    %ebx
+ be7:	5e                   	pop    %esi
+ be8:	5d                   	pop    %ebp
+    runfree(p, p->npages);
+ be9:	e9 22 fd ff ff       	jmp    910 <runfree>
+ bee:	66 90                	xchg   %ax,%ax
+  b->next = p->free;
+ bf0:	8b 50 0c             	mov    0xc(%eax),%edx
+ bf3:	89 11                	mov    %edx,(%ecx)
+  if(p->nfree++ == 0)
+ bf5:	8b 50 08             	mov    0x8(%eax),%edx
+  p->free = b;
+ bf8:	89 48 0c             	mov    %ecx,0xc(%eax)
+  if(p->nfree++ == 0)
+ bfb:	8d 5a 01             	lea    0x1(%edx),%ebx
+ bfe:	89 58 08             	mov    %ebx,0x8(%eax)
+ c01:	85 d2                	test   %edx,%edx
+ c03:	74 53                	je     c58 <free+0xa8>
+  if(p->nfree == nblocks(p->class)){
+ c05:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ c09:	8d 4e 04             	lea    0x4(%esi),%ecx
+ c0c:	ba e0 0f 00 00       	mov    $0xfe0,%edx
+ c11:	d3 fa                	sar    %cl,%edx
+  if(p->nfree == nblocks(p->class)){
+ c13:	39 da                	cmp    %ebx,%edx
+ c15:	75 c1                	jne    bd8 <free+0x28>
+  if(p->prev)
+ c17:	8b 48 18             	mov    0x18(%eax),%ecx
+    p->prev->next = p->next;
+ c1a:	8b 50 14             	mov    0x14(%eax),%edx
+  if(p->prev)
+ c1d:	85 c9                	test   %ecx,%ecx
+ c1f:	74 6f                	je     c90 <free+0xe0>
+    p->prev->next = p->next;
+ c21:	89 51 14             	mov    %edx,0x14(%ecx)
+  if(p->next)
+ c24:	85 d2                	test   %edx,%edx
+ c26:	74 06                	je     c2e <free+0x7e>
+    p->next->prev = p->prev;
+ c28:	8b 48 18             	mov    0x18(%eax),%ecx
+ c2b:	89 4a 18             	mov    %ecx,0x18(%edx)
+    runfree(p, 1);
+ c2e:	ba 01 00 00 00       	mov    $0x1,%edx
+ c33:	eb ae                	jmp    be3 <free+0x33>
+ c35:	8d 76 00             	lea    0x0(%esi),%esi
+    munmap(p, p->npages*PGSIZE);
+ c38:	8b 50 04             	mov    0x4(%eax),%edx
+ c3b:	83 ec 08             	sub    $0x8,%esp
+ c3e:	c1 e2 0c             	shl    $0xc,%edx
+ c41:	52                   	push   %edx
+ c42:	50                   	push   %eax
+ c43:	e8 1b fa ff ff       	call   663 <munmap>
+    break;
+ c48:	83 c4 10             	add    $0x10,%esp
+}
+ c4b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ c4e:	5b                   	pop    %ebx
+ c4f:	5e                   	pop    %esi
+ c50:	5d                   	pop    %ebp
+ c51:	c3                   	ret
+ c52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  p->next = partial[p->class];
+ c58:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  p->prev = 0;
+ c5c:	c7 40 18 00 00 00 00 	movl   $0x0,0x18(%eax)
+  p->next = partial[p->class];
+ c63:	bb 01 00 00 00       	mov    $0x1,%ebx
+ c68:	8b 14 b5 78 25 00 00 	mov    0x2578(,%esi,4),%edx
+ c6f:	89 50 14             	mov    %edx,0x14(%eax)
+  if(p->next)
+ c72:	85 d2                	test   %edx,%edx
+ c74:	74 0a                	je     c80 <free+0xd0>
+    p->next->prev = p;
+ c76:	89 42 18             	mov    %eax,0x18(%edx)
+  partial[p->class] = p;
+ c79:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  if(p->nfree == nblocks(p->class)){
+ c7d:	8b 58 08             	mov    0x8(%eax),%ebx
+  partial[p->class] = p;
+ c80:	89 04 b5 78 25 00 00 	mov    %eax,0x2578(,%esi,4)
+}
+ c87:	eb 80                	jmp    c09 <free+0x59>
+ c89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ c90:	89 14 b5 78 25 00 00 	mov    %edx,0x2578(,%esi,4)
+ c97:	eb 8b                	jmp    c24 <free+0x74>
+ c99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000ca0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ ca0:	55                   	push   %ebp
+ ca1:	89 e5                	mov    %esp,%ebp
+ ca3:	56                   	push   %esi
+ ca4:	53                   	push   %ebx
+ ca5:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct page *p;
+  uint n;
+
+  if(nbytes <= MAXSMALL)
+ ca8:	3d 00 04 00 00       	cmp    $0x400,%eax
+ cad:	76 71                	jbe    d20 <malloc+0x80>
+    return smallalloc(sizeclass(nbytes));
+  if(nbytes > 0x7fffffff)
+ caf:	85 c0                	test   %eax,%eax
+ cb1:	0f 88 d9 00 00 00    	js     d90 <malloc+0xf0>
+    return 0;
+  n = (nbytes + HDRSIZE + PGSIZE-1) / PGSIZE;
+ cb7:	8d 90 1f 10 00 00    	lea    0x101f(%eax),%edx
+ cbd:	89 d3                	mov    %edx,%ebx
+ cbf:	c1 eb 0c             	shr    $0xc,%ebx
+  if(nbytes >= MAPMIN){
+ cc2:	3d ff ff 00 00       	cmp    $0xffff,%eax
+ cc7:	77 27                	ja     cf0 <malloc+0x50>
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    if(p == MAP_FAILED)
+      return 0;
+    p->kind = PMAP;
+  } else {
+    if((p = runalloc(n)) == 0)
+ cc9:	89 d8                	mov    %ebx,%eax
+ ccb:	e8 c0 fd ff ff       	call   a90 <runalloc>
+ cd0:	85 c0                	test   %eax,%eax
+ cd2:	0f 84 b8 00 00 00    	je     d90 <malloc+0xf0>
+      return 0;
+    p->kind = PRUN;
+ cd8:	ba 02 00 00 00       	mov    $0x2,%edx
+ cdd:	66 89 10             	mov    %dx,(%eax)
+  }
+  p->npages = n;
+ ce0:	89 58 04             	mov    %ebx,0x4(%eax)
+  return (char*)p + HDRSIZE;
+ ce3:	8d 58 20             	lea    0x20(%eax),%ebx
+}
+ ce6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ ce9:	89 d8                	mov    %ebx,%eax
+ ceb:	5b                   	pop    %ebx
+ cec:	5e                   	pop    %esi
+ ced:	5d                   	pop    %ebp
+ cee:	c3                   	ret
+ cef:	90                   	nop
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+ cf0:	83 ec 08             	sub    $0x8,%esp
+ cf3:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+ cf9:	6a 00                	push   $0x0
+ cfb:	6a ff                	push   $0xffffffff
+ cfd:	6a 22                	push   $0x22
+ cff:	6a 03                	push   $0x3
+ d01:	52                   	push   %edx
+ d02:	6a 00                	push   $0x0
+ d04:	e8 52 f9 ff ff       	call   65b <mmap>
+    if(p == MAP_FAILED)
+ d09:	83 c4 20             	add    $0x20,%esp
+ d0c:	83 f8 ff             	cmp    $0xffffffff,%eax
+ d0f:	74 7f                	je     d90 <malloc+0xf0>
+    p->kind = PMAP;
+ d11:	b9 04 00 00 00       	mov    $0x4,%ecx
+ d16:	66 89 08             	mov    %cx,(%eax)
+ d19:	eb c5                	jmp    ce0 <malloc+0x40>
+ d1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d1f:	90                   	nop
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ d20:	83 f8 10             	cmp    $0x10,%eax
+ d23:	0f 86 07 01 00 00    	jbe    e30 <malloc+0x190>
+ d29:	31 db                	xor    %ebx,%ebx
+ d2b:	ba 10 00 00 00       	mov    $0x10,%edx
+ d30:	83 c3 01             	add    $0x1,%ebx
+ d33:	89 d6                	mov    %edx,%esi
+ d35:	89 d9                	mov    %ebx,%ecx
+ d37:	d3 e6                	shl    %cl,%esi
+ d39:	39 c6                	cmp    %eax,%esi
+ d3b:	72 f3                	jb     d30 <malloc+0x90>
+  if((p = partial[c]) == 0){
+ d3d:	8b 14 9d 78 25 00 00 	mov    0x2578(,%ebx,4),%edx
+ d44:	85 d2                	test   %edx,%edx
+ d46:	74 58                	je     da0 <malloc+0x100>
+  if((b = p->free) != 0){
+ d48:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ d4b:	8b 4a 08             	mov    0x8(%edx),%ecx
+  if((b = p->free) != 0){
+ d4e:	85 db                	test   %ebx,%ebx
+ d50:	0f 84 aa 00 00 00    	je     e00 <malloc+0x160>
+    p->free = b->next;
+ d56:	8b 03                	mov    (%ebx),%eax
+ d58:	89 42 0c             	mov    %eax,0xc(%edx)
+  if(--p->nfree == 0)
+ d5b:	83 e9 01             	sub    $0x1,%ecx
+ d5e:	89 4a 08             	mov    %ecx,0x8(%edx)
+ d61:	75 83                	jne    ce6 <malloc+0x46>
+  if(p->prev)
+ d63:	8b 4a 18             	mov    0x18(%edx),%ecx
+    p->prev->next = p->next;
+ d66:	8b 42 14             	mov    0x14(%edx),%eax
+  if(p->prev)
+ d69:	85 c9                	test   %ecx,%ecx
+ d6b:	0f 84 cf 00 00 00    	je     e40 <malloc+0x1a0>
+    p->prev->next = p->next;
+ d71:	89 41 14             	mov    %eax,0x14(%ecx)
+  if(p->next)
+ d74:	85 c0                	test   %eax,%eax
+ d76:	0f 84 6a ff ff ff    	je     ce6 <malloc+0x46>
+    p->next->prev = p->prev;
+ d7c:	8b 52 18             	mov    0x18(%edx),%edx
+ d7f:	89 50 18             	mov    %edx,0x18(%eax)
+ d82:	e9 5f ff ff ff       	jmp    ce6 <malloc+0x46>
+ d87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d8e:	66 90                	xchg   %ax,%ax
+}
+ d90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+ d93:	31 db                	xor    %ebx,%ebx
+}
+ d95:	89 d8                	mov    %ebx,%eax
+ d97:	5b                   	pop    %ebx
+ d98:	5e                   	pop    %esi
+ d99:	5d                   	pop    %ebp
+ d9a:	c3                   	ret
+ d9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d9f:	90                   	nop
+    if((p = runalloc(1)) == 0)
+ da0:	b8 01 00 00 00       	mov    $0x1,%eax
+ da5:	e8 e6 fc ff ff       	call   a90 <runalloc>
+ daa:	89 c2                	mov    %eax,%edx
+ dac:	85 c0                	test   %eax,%eax
+ dae:	74 e0                	je     d90 <malloc+0xf0>
+    p->kind = PSMALL;
+ db0:	b8 01 00 00 00       	mov    $0x1,%eax
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ db5:	8d 4b 04             	lea    0x4(%ebx),%ecx
+    p->class = c;
+ db8:	66 89 5a 02          	mov    %bx,0x2(%edx)
+ dbc:	0f b7 db             	movzwl %bx,%ebx
+    p->kind = PSMALL;
+ dbf:	66 89 02             	mov    %ax,(%edx)
+    p->fresh = (char*)p + HDRSIZE;
+ dc2:	8d 42 20             	lea    0x20(%edx),%eax
+ dc5:	89 42 10             	mov    %eax,0x10(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ dc8:	b8 e0 0f 00 00       	mov    $0xfe0,%eax
+ dcd:	d3 f8                	sar    %cl,%eax
+    p->free = 0;
+ dcf:	c7 42 0c 00 00 00 00 	movl   $0x0,0xc(%edx)
+    p->nfree = nblocks(c);
+ dd6:	89 42 08             	mov    %eax,0x8(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ dd9:	89 c1                	mov    %eax,%ecx
+  p->next = partial[p->class];
+ ddb:	8b 04 9d 78 25 00 00 	mov    0x2578(,%ebx,4),%eax
+  p->prev = 0;
+ de2:	c7 42 18 00 00 00 00 	movl   $0x0,0x18(%edx)
+  p->next = partial[p->class];
+ de9:	89 42 14             	mov    %eax,0x14(%edx)
+  if(p->next)
+ dec:	85 c0                	test   %eax,%eax
+ dee:	75 20                	jne    e10 <malloc+0x170>
+  partial[p->class] = p;
+ df0:	89 14 9d 78 25 00 00 	mov    %edx,0x2578(,%ebx,4)
+  if((b = p->free) != 0){
+ df7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dfe:	66 90                	xchg   %ax,%ax
+    b = (struct block*)p->fresh;
+ e00:	8b 5a 10             	mov    0x10(%edx),%ebx
+    p->fresh += MINSMALL << c;
+ e03:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+ e06:	89 42 10             	mov    %eax,0x10(%edx)
+ e09:	e9 4d ff ff ff       	jmp    d5b <malloc+0xbb>
+ e0e:	66 90                	xchg   %ax,%ax
+    p->next->prev = p;
+ e10:	89 50 18             	mov    %edx,0x18(%eax)
+  partial[p->class] = p;
+ e13:	0f b7 42 02          	movzwl 0x2(%edx),%eax
+  if((b = p->free) != 0){
+ e17:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ e1a:	8b 4a 08             	mov    0x8(%edx),%ecx
+  partial[p->class] = p;
+ e1d:	89 14 85 78 25 00 00 	mov    %edx,0x2578(,%eax,4)
+}
+ e24:	e9 25 ff ff ff       	jmp    d4e <malloc+0xae>
+ e29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ e30:	be 10 00 00 00       	mov    $0x10,%esi
+ e35:	31 db                	xor    %ebx,%ebx
+ e37:	e9 01 ff ff ff       	jmp    d3d <malloc+0x9d>
+ e3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ e40:	0f b7 4a 02          	movzwl 0x2(%edx),%ecx
+ e44:	89 04 8d 78 25 00 00 	mov    %eax,0x2578(,%ecx,4)
+ e4b:	e9 24 ff ff ff       	jmp    d74 <malloc+0xd4>
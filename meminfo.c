@@ -0,0 +1,84 @@
+// Show how physical memory is used: by the allocator, by each
+// container and by each process. With an interval in ticks,
+// print a one-line summary that often instead, to watch memory
+// pressure while something else runs.
+//
+// usage: meminfo [ticks [count]]
+
+#include "param.h"
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "memstats.h"
+
+#define MAXPROC 128
+
+struct memstats ms;
+struct procmem pm[MAXPROC];
+
+// Pages to KB.
+uint
+kb(uint pages)
+{
+  return pages * 4;
+}
+
+void
+report(void)
+{
+  struct contmem *cm;
+  int i, n;
+
+  if((n = memstats(&ms, pm, MAXPROC)) < 0){
+    printf(2, "meminfo: memstats failed\n");
+    exit();
+  }
+  printf(1, "total       %d KB\n", kb(ms.total));
+  printf(1, "free        %d KB (%d KB zeroed, %d KB in 4MB pages)\n",
+         kb(ms.free), kb(ms.zeroed), kb(ms.largefree));
+  printf(1, "used        %d KB\n", kb(ms.total - ms.free));
+  printf(1, "  user      %d KB\n", kb(ms.user));
+  printf(1, "  pagetable %d KB\n", kb(ms.ptpages));
+  printf(1, "  kstack    %d KB\n", kb(ms.kstacks));
+  printf(1, "  bcache    %d KB, %d buffers\n", kb(ms.bufpages), ms.nbuf);
+  printf(1, "bcache hits %d misses %d\n", ms.bhits, ms.bmisses);
+
+  printf(1, "\ncid name            procs    mem KB   peak KB  limit KB\n");
+  for(i = 0; i < ms.ncont; i++){
+    cm = &ms.cont[i];
+    printf(1, "%d   %s  %d  %d  %d  %d\n", cm->cid, cm->name, cm->nproc,
+           kb(cm->mem), kb(cm->peakmem), kb(cm->memlimit));
+  }
+
+  printf(1, "\npid  cid  name          rss KB  pagetable KB\n");
+  for(i = 0; i < n; i++)
+    printf(1, "%d  %d  %s  %d  %d\n", pm[i].pid, pm[i].cid, pm[i].name,
+           kb(pm[i].rss), kb(pm[i].ptpages));
+}
+
+void
+watch(int ticks, int count)
+{
+  int i;
+
+  for(i = 0; count == 0 || i < count; i++){
+    if(memstats(&ms, 0, 0) < 0){
+      printf(2, "meminfo: memstats failed\n");
+      exit();
+    }
+    printf(1, "%d: free %d KB user %d KB pagetable %d KB kstack %d KB bcache %d KB\n",
+           uptime(), kb(ms.free), kb(ms.user), kb(ms.ptpages), kb(ms.kstacks),
+           kb(ms.bufpages));
+    sleep(ticks);
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  if(argc > 1)
+    watch(atoi(argv[1]), argc > 2 ? atoi(argv[2]) : 0);
+  else
+    report();
+  exit();
+}
@@ -0,0 +1,38 @@
+// Memory statistics from memstats(), in pages.
+// Include param.h first.
+
+// One container's user memory.
+struct contmem {
+  int cid;
+  char name[16];
+  int nproc;          // Processes, threads included
+  uint mem;           // Pages charged to it (see kcharge)
+  uint peakmem;       // Most pages ever charged at once
+  uint memlimit;      // 0 if no limit
+};
+
+struct memstats {
+  uint total;         // Pages of physical memory the allocator manages
+  uint free;          // Of those, free, including the two below
+  uint zeroed;        // Free pages zeroed in advance
+  uint largefree;     // Free 4MB pages kept whole, in 4KB pages
+  uint user;          // Pages charged to containers
+  uint ptpages;       // Page directories and page tables
+  uint kstacks;       // Kernel stacks
+  uint bufpages;      // Buffer cache, data and headers
+  uint nbuf;          // Buffers in the cache
+  uint bhits;         // Buffer cache lookups that found the block
+  uint bmisses;       // and that had to read it
+  int ncont;
+  struct contmem cont[NCONT];
+};
+
+// One process's memory. Its threads share its page table and
+// show no pages of their own.
+struct procmem {
+  int pid;
+  int cid;
+  char name[16];
+  uint rss;           // User pages mapped, shared ones included
+  uint ptpages;       // Page directory and page tables
+};
@@ -0,0 +1,1727 @@
+
+_mkdir:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	bf 01 00 00 00       	mov    $0x1,%edi
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1c:	8b 31                	mov    (%ecx),%esi
+  1e:	83 c3 04             	add    $0x4,%ebx
+  int i;
+
+  if(argc < 2){
+  21:	83 fe 01             	cmp    $0x1,%esi
+  24:	7f 14                	jg     3a <main+0x3a>
+  26:	eb 3a                	jmp    62 <main+0x62>
+  28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+    printf(2, "Usage: mkdir files...\n");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  30:	83 c7 01             	add    $0x1,%edi
+  33:	83 c3 04             	add    $0x4,%ebx
+  36:	39 fe                	cmp    %edi,%esi
+  38:	74 23                	je     5d <main+0x5d>
+    if(mkdir(argv[i]) < 0){
+  3a:	83 ec 0c             	sub    $0xc,%esp
+  3d:	ff 33                	push   (%ebx)
+  3f:	e8 27 03 00 00       	call   36b <mkdir>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	85 c0                	test   %eax,%eax
+  49:	79 e5                	jns    30 <main+0x30>
+      printf(2, "mkdir: %s failed to create\n", argv[i]);
+  4b:	50                   	push   %eax
+  4c:	ff 33                	push   (%ebx)
+  4e:	68 b7 0b 00 00       	push   $0xbb7
+  53:	6a 02                	push   $0x2
+  55:	e8 56 04 00 00       	call   4b0 <printf>
+      break;
+  5a:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+
+  exit();
+  5d:	e8 a1 02 00 00       	call   303 <exit>
+    printf(2, "Usage: mkdir files...\n");
+  62:	52                   	push   %edx
+  63:	52                   	push   %edx
+  64:	68 a0 0b 00 00       	push   $0xba0
+  69:	6a 02                	push   $0x2
+  6b:	e8 40 04 00 00       	call   4b0 <printf>
+    exit();
+  70:	e8 8e 02 00 00       	call   303 <exit>
+  75:	66 90                	xchg   %ax,%ax
+  77:	66 90                	xchg   %ax,%ax
+  79:	66 90                	xchg   %ax,%ax
+  7b:	66 90                	xchg   %ax,%ax
+  7d:	66 90                	xchg   %ax,%ax
+  7f:	90                   	nop
+
+00000080 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  80:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  81:	31 c0                	xor    %eax,%eax
+{
+  83:	89 e5                	mov    %esp,%ebp
+  85:	53                   	push   %ebx
+  86:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  89:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  90:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  94:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  97:	83 c0 01             	add    $0x1,%eax
+  9a:	84 d2                	test   %dl,%dl
+  9c:	75 f2                	jne    90 <strcpy+0x10>
+    ;
+  return os;
+}
+  9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  a1:	89 c8                	mov    %ecx,%eax
+  a3:	c9                   	leave
+  a4:	c3                   	ret
+  a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  b0:	55                   	push   %ebp
+  b1:	89 e5                	mov    %esp,%ebp
+  b3:	53                   	push   %ebx
+  b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  ba:	0f b6 02             	movzbl (%edx),%eax
+  bd:	84 c0                	test   %al,%al
+  bf:	75 17                	jne    d8 <strcmp+0x28>
+  c1:	eb 3a                	jmp    fd <strcmp+0x4d>
+  c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  c7:	90                   	nop
+  c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  cc:	83 c2 01             	add    $0x1,%edx
+  cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  d2:	84 c0                	test   %al,%al
+  d4:	74 1a                	je     f0 <strcmp+0x40>
+    p++, q++;
+  d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  d8:	0f b6 19             	movzbl (%ecx),%ebx
+  db:	38 c3                	cmp    %al,%bl
+  dd:	74 e9                	je     c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  df:	29 d8                	sub    %ebx,%eax
+}
+  e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  e4:	c9                   	leave
+  e5:	c3                   	ret
+  e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  f4:	31 c0                	xor    %eax,%eax
+  f6:	29 d8                	sub    %ebx,%eax
+}
+  f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  fb:	c9                   	leave
+  fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 100:	31 c0                	xor    %eax,%eax
+ 102:	eb db                	jmp    df <strcmp+0x2f>
+ 104:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 10f:	90                   	nop
+
+00000110 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 116:	80 3a 00             	cmpb   $0x0,(%edx)
+ 119:	74 15                	je     130 <strlen+0x20>
+ 11b:	31 c0                	xor    %eax,%eax
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+ 120:	83 c0 01             	add    $0x1,%eax
+ 123:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 127:	89 c1                	mov    %eax,%ecx
+ 129:	75 f5                	jne    120 <strlen+0x10>
+    ;
+  return n;
+}
+ 12b:	89 c8                	mov    %ecx,%eax
+ 12d:	5d                   	pop    %ebp
+ 12e:	c3                   	ret
+ 12f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 130:	31 c9                	xor    %ecx,%ecx
+}
+ 132:	5d                   	pop    %ebp
+ 133:	89 c8                	mov    %ecx,%eax
+ 135:	c3                   	ret
+ 136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000140 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	57                   	push   %edi
+ 144:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 147:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 14a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 14d:	89 d7                	mov    %edx,%edi
+ 14f:	fc                   	cld
+ 150:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 152:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 155:	89 d0                	mov    %edx,%eax
+ 157:	c9                   	leave
+ 158:	c3                   	ret
+ 159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000160 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	8b 45 08             	mov    0x8(%ebp),%eax
+ 166:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 16a:	0f b6 10             	movzbl (%eax),%edx
+ 16d:	84 d2                	test   %dl,%dl
+ 16f:	75 12                	jne    183 <strchr+0x23>
+ 171:	eb 1d                	jmp    190 <strchr+0x30>
+ 173:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 177:	90                   	nop
+ 178:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 17c:	83 c0 01             	add    $0x1,%eax
+ 17f:	84 d2                	test   %dl,%dl
+ 181:	74 0d                	je     190 <strchr+0x30>
+    if(*s == c)
+ 183:	38 d1                	cmp    %dl,%cl
+ 185:	75 f1                	jne    178 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 187:	5d                   	pop    %ebp
+ 188:	c3                   	ret
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 190:	31 c0                	xor    %eax,%eax
+}
+ 192:	5d                   	pop    %ebp
+ 193:	c3                   	ret
+ 194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+
+000001a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1a9:	31 db                	xor    %ebx,%ebx
+{
+ 1ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1ae:	eb 27                	jmp    1d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1b0:	83 ec 04             	sub    $0x4,%esp
+ 1b3:	6a 01                	push   $0x1
+ 1b5:	56                   	push   %esi
+ 1b6:	6a 00                	push   $0x0
+ 1b8:	e8 5e 01 00 00       	call   31b <read>
+    if(cc < 1)
+ 1bd:	83 c4 10             	add    $0x10,%esp
+ 1c0:	85 c0                	test   %eax,%eax
+ 1c2:	7e 1d                	jle    1e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1cf:	3c 0a                	cmp    $0xa,%al
+ 1d1:	74 10                	je     1e3 <gets+0x43>
+ 1d3:	3c 0d                	cmp    $0xd,%al
+ 1d5:	74 0c                	je     1e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1d7:	89 df                	mov    %ebx,%edi
+ 1d9:	83 c3 01             	add    $0x1,%ebx
+ 1dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1df:	7c cf                	jl     1b0 <gets+0x10>
+ 1e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1ed:	5b                   	pop    %ebx
+ 1ee:	5e                   	pop    %esi
+ 1ef:	5f                   	pop    %edi
+ 1f0:	5d                   	pop    %ebp
+ 1f1:	c3                   	ret
+ 1f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	56                   	push   %esi
+ 204:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 205:	83 ec 08             	sub    $0x8,%esp
+ 208:	6a 00                	push   $0x0
+ 20a:	ff 75 08             	push   0x8(%ebp)
+ 20d:	e8 31 01 00 00       	call   343 <open>
+  if(fd < 0)
+ 212:	83 c4 10             	add    $0x10,%esp
+ 215:	85 c0                	test   %eax,%eax
+ 217:	78 27                	js     240 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 219:	83 ec 08             	sub    $0x8,%esp
+ 21c:	ff 75 0c             	push   0xc(%ebp)
+ 21f:	89 c3                	mov    %eax,%ebx
+ 221:	50                   	push   %eax
+ 222:	e8 34 01 00 00       	call   35b <fstat>
+  close(fd);
+ 227:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 22a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 22c:	e8 fa 00 00 00       	call   32b <close>
+  return r;
+ 231:	83 c4 10             	add    $0x10,%esp
+}
+ 234:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 237:	89 f0                	mov    %esi,%eax
+ 239:	5b                   	pop    %ebx
+ 23a:	5e                   	pop    %esi
+ 23b:	5d                   	pop    %ebp
+ 23c:	c3                   	ret
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 240:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 245:	eb ed                	jmp    234 <stat+0x34>
+ 247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24e:	66 90                	xchg   %ax,%ax
+
+00000250 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	53                   	push   %ebx
+ 254:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 257:	0f be 02             	movsbl (%edx),%eax
+ 25a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 25d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 260:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 265:	77 1e                	ja     285 <atoi+0x35>
+ 267:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 270:	83 c2 01             	add    $0x1,%edx
+ 273:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 276:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 27a:	0f be 02             	movsbl (%edx),%eax
+ 27d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 280:	80 fb 09             	cmp    $0x9,%bl
+ 283:	76 eb                	jbe    270 <atoi+0x20>
+  return n;
+}
+ 285:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 288:	89 c8                	mov    %ecx,%eax
+ 28a:	c9                   	leave
+ 28b:	c3                   	ret
+ 28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	56                   	push   %esi
+ 295:	8b 45 10             	mov    0x10(%ebp),%eax
+ 298:	8b 55 08             	mov    0x8(%ebp),%edx
+ 29b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 29e:	85 c0                	test   %eax,%eax
+ 2a0:	7e 13                	jle    2b5 <memmove+0x25>
+ 2a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2a4:	89 d7                	mov    %edx,%edi
+ 2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2b1:	39 f8                	cmp    %edi,%eax
+ 2b3:	75 fb                	jne    2b0 <memmove+0x20>
+  return vdst;
+}
+ 2b5:	5e                   	pop    %esi
+ 2b6:	89 d0                	mov    %edx,%eax
+ 2b8:	5f                   	pop    %edi
+ 2b9:	5d                   	pop    %ebp
+ 2ba:	c3                   	ret
+
+000002bb <ccreate>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(ccreate)
+ 2bb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 2c0:	cd 40                	int    $0x40
+ 2c2:	c3                   	ret
+
+000002c3 <cfork>:
+SYSCALL(cfork)
+ 2c3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 2c8:	cd 40                	int    $0x40
+ 2ca:	c3                   	ret
+
+000002cb <cgetrootdir>:
+SYSCALL(cgetrootdir)
+ 2cb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 2d0:	cd 40                	int    $0x40
+ 2d2:	c3                   	ret
+
+000002d3 <getcontrootdir>:
+SYSCALL(getcontrootdir)
+ 2d3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 2d8:	cd 40                	int    $0x40
+ 2da:	c3                   	ret
+
+000002db <cpause>:
+SYSCALL(cpause)
+ 2db:	b8 19 00 00 00       	mov    $0x19,%eax
+ 2e0:	cd 40                	int    $0x40
+ 2e2:	c3                   	ret
+
+000002e3 <cresume>:
+SYSCALL(cresume)
+ 2e3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 2e8:	cd 40                	int    $0x40
+ 2ea:	c3                   	ret
+
+000002eb <cstart>:
+SYSCALL(cstart)
+ 2eb:	b8 18 00 00 00       	mov    $0x18,%eax
+ 2f0:	cd 40                	int    $0x40
+ 2f2:	c3                   	ret
+
+000002f3 <cstop>:
+SYSCALL(cstop)
+ 2f3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 2f8:	cd 40                	int    $0x40
+ 2fa:	c3                   	ret
+
+000002fb <fork>:
+SYSCALL(fork)
+ 2fb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <exit>:
+SYSCALL(exit)
+ 303:	b8 02 00 00 00       	mov    $0x2,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <wait>:
+SYSCALL(wait)
+ 30b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <pipe>:
+SYSCALL(pipe)
+ 313:	b8 04 00 00 00       	mov    $0x4,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <read>:
+SYSCALL(read)
+ 31b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <write>:
+SYSCALL(write)
+ 323:	b8 10 00 00 00       	mov    $0x10,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <close>:
+SYSCALL(close)
+ 32b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <kill>:
+SYSCALL(kill)
+ 333:	b8 06 00 00 00       	mov    $0x6,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <exec>:
+SYSCALL(exec)
+ 33b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <open>:
+SYSCALL(open)
+ 343:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <mknod>:
+SYSCALL(mknod)
+ 34b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <unlink>:
+SYSCALL(unlink)
+ 353:	b8 12 00 00 00       	mov    $0x12,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <fstat>:
+SYSCALL(fstat)
+ 35b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <link>:
+SYSCALL(link)
+ 363:	b8 13 00 00 00       	mov    $0x13,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <mkdir>:
+SYSCALL(mkdir)
+ 36b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <chdir>:
+SYSCALL(chdir)
+ 373:	b8 09 00 00 00       	mov    $0x9,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <dup>:
+SYSCALL(dup)
+ 37b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <getpid>:
+SYSCALL(getpid)
+ 383:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <sbrk>:
+SYSCALL(sbrk)
+ 38b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <sleep>:
+SYSCALL(sleep)
+ 393:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <uptime>:
+SYSCALL(uptime)
+ 39b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <cps>:
+SYSCALL(cps)
+ 3a3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <mmap>:
+SYSCALL(mmap)
+ 3ab:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <munmap>:
+SYSCALL(munmap)
+ 3b3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <shmget>:
+SYSCALL(shmget)
+ 3bb:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <climit>:
+SYSCALL(climit)
+ 3c3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <spawn>:
+SYSCALL(spawn)
+ 3cb:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <clone>:
+SYSCALL(clone)
+ 3d3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <join>:
+SYSCALL(join)
+ 3db:	b8 25 00 00 00       	mov    $0x25,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <futex>:
+SYSCALL(futex)
+ 3e3:	b8 26 00 00 00       	mov    $0x26,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <ccheckpoint>:
+SYSCALL(ccheckpoint)
+ 3eb:	b8 27 00 00 00       	mov    $0x27,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <crestore>:
+SYSCALL(crestore)
+ 3f3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <czygote>:
+SYSCALL(czygote)
+ 3fb:	b8 29 00 00 00       	mov    $0x29,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <memstats>:
+SYSCALL(memstats)
+ 403:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+ 40b:	66 90                	xchg   %ax,%ax
+ 40d:	66 90                	xchg   %ax,%ax
+ 40f:	90                   	nop
+
+00000410 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	57                   	push   %edi
+ 414:	56                   	push   %esi
+ 415:	53                   	push   %ebx
+ 416:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 418:	89 d1                	mov    %edx,%ecx
+{
+ 41a:	83 ec 3c             	sub    $0x3c,%esp
+ 41d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 420:	85 d2                	test   %edx,%edx
+ 422:	0f 89 80 00 00 00    	jns    4a8 <printint+0x98>
+ 428:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 42c:	74 7a                	je     4a8 <printint+0x98>
+    x = -xx;
+ 42e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 430:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 435:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 438:	31 f6                	xor    %esi,%esi
+ 43a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 440:	89 c8                	mov    %ecx,%eax
+ 442:	31 d2                	xor    %edx,%edx
+ 444:	89 f7                	mov    %esi,%edi
+ 446:	f7 f3                	div    %ebx
+ 448:	8d 76 01             	lea    0x1(%esi),%esi
+ 44b:	0f b6 92 34 0c 00 00 	movzbl 0xc34(%edx),%edx
+ 452:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 456:	89 ca                	mov    %ecx,%edx
+ 458:	89 c1                	mov    %eax,%ecx
+ 45a:	39 da                	cmp    %ebx,%edx
+ 45c:	73 e2                	jae    440 <printint+0x30>
+  if(neg)
+ 45e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 461:	85 c0                	test   %eax,%eax
+ 463:	74 07                	je     46c <printint+0x5c>
+    buf[i++] = '-';
+ 465:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 46a:	89 f7                	mov    %esi,%edi
+ 46c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 46f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 472:	01 df                	add    %ebx,%edi
+ 474:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 478:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 47b:	83 ec 04             	sub    $0x4,%esp
+ 47e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 481:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 484:	6a 01                	push   $0x1
+ 486:	50                   	push   %eax
+ 487:	56                   	push   %esi
+ 488:	e8 96 fe ff ff       	call   323 <write>
+  while(--i >= 0)
+ 48d:	89 f8                	mov    %edi,%eax
+ 48f:	83 c4 10             	add    $0x10,%esp
+ 492:	83 ef 01             	sub    $0x1,%edi
+ 495:	39 d8                	cmp    %ebx,%eax
+ 497:	75 df                	jne    478 <printint+0x68>
+}
+ 499:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 49c:	5b                   	pop    %ebx
+ 49d:	5e                   	pop    %esi
+ 49e:	5f                   	pop    %edi
+ 49f:	5d                   	pop    %ebp
+ 4a0:	c3                   	ret
+ 4a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 4a8:	31 c0                	xor    %eax,%eax
+ 4aa:	eb 89                	jmp    435 <printint+0x25>
+ 4ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	57                   	push   %edi
+ 4b4:	56                   	push   %esi
+ 4b5:	53                   	push   %ebx
+ 4b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 4b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 4bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 4bf:	0f b6 1e             	movzbl (%esi),%ebx
+ 4c2:	83 c6 01             	add    $0x1,%esi
+ 4c5:	84 db                	test   %bl,%bl
+ 4c7:	74 67                	je     530 <printf+0x80>
+ 4c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 4cc:	31 d2                	xor    %edx,%edx
+ 4ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 4d1:	eb 34                	jmp    507 <printf+0x57>
+ 4d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4d7:	90                   	nop
+ 4d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 4db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 4e0:	83 f8 25             	cmp    $0x25,%eax
+ 4e3:	74 18                	je     4fd <printf+0x4d>
+  write(fd, &c, 1);
+ 4e5:	83 ec 04             	sub    $0x4,%esp
+ 4e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 4eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 4ee:	6a 01                	push   $0x1
+ 4f0:	50                   	push   %eax
+ 4f1:	57                   	push   %edi
+ 4f2:	e8 2c fe ff ff       	call   323 <write>
+ 4f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 4fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 4fd:	0f b6 1e             	movzbl (%esi),%ebx
+ 500:	83 c6 01             	add    $0x1,%esi
+ 503:	84 db                	test   %bl,%bl
+ 505:	74 29                	je     530 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 507:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 50a:	85 d2                	test   %edx,%edx
+ 50c:	74 ca                	je     4d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 50e:	83 fa 25             	cmp    $0x25,%edx
+ 511:	75 ea                	jne    4fd <printf+0x4d>
+      if(c == 'd'){
+ 513:	83 f8 25             	cmp    $0x25,%eax
+ 516:	0f 84 24 01 00 00    	je     640 <printf+0x190>
+ 51c:	83 e8 63             	sub    $0x63,%eax
+ 51f:	83 f8 15             	cmp    $0x15,%eax
+ 522:	77 1c                	ja     540 <printf+0x90>
+ 524:	ff 24 85 dc 0b 00 00 	jmp    *0xbdc(,%eax,4)
+ 52b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 52f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 530:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 533:	5b                   	pop    %ebx
+ 534:	5e                   	pop    %esi
+ 535:	5f                   	pop    %edi
+ 536:	5d                   	pop    %ebp
+ 537:	c3                   	ret
+ 538:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53f:	90                   	nop
+  write(fd, &c, 1);
+ 540:	83 ec 04             	sub    $0x4,%esp
+ 543:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 546:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 54a:	6a 01                	push   $0x1
+ 54c:	52                   	push   %edx
+ 54d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 550:	57                   	push   %edi
+ 551:	e8 cd fd ff ff       	call   323 <write>
+ 556:	83 c4 0c             	add    $0xc,%esp
+ 559:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 55c:	6a 01                	push   $0x1
+ 55e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 561:	52                   	push   %edx
+ 562:	57                   	push   %edi
+ 563:	e8 bb fd ff ff       	call   323 <write>
+        putc(fd, c);
+ 568:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 56b:	31 d2                	xor    %edx,%edx
+ 56d:	eb 8e                	jmp    4fd <printf+0x4d>
+ 56f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 570:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 573:	83 ec 0c             	sub    $0xc,%esp
+ 576:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 57b:	8b 13                	mov    (%ebx),%edx
+ 57d:	6a 00                	push   $0x0
+ 57f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 581:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 584:	e8 87 fe ff ff       	call   410 <printint>
+        ap++;
+ 589:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 58c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 58f:	31 d2                	xor    %edx,%edx
+ 591:	e9 67 ff ff ff       	jmp    4fd <printf+0x4d>
+ 596:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 5a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 5a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 5a5:	83 c0 04             	add    $0x4,%eax
+ 5a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 5ab:	85 db                	test   %ebx,%ebx
+ 5ad:	0f 84 9d 00 00 00    	je     650 <printf+0x1a0>
+        while(*s != 0){
+ 5b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 5b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 5b8:	84 c0                	test   %al,%al
+ 5ba:	0f 84 3d ff ff ff    	je     4fd <printf+0x4d>
+ 5c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 5c6:	89 de                	mov    %ebx,%esi
+ 5c8:	89 d3                	mov    %edx,%ebx
+ 5ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 5d0:	83 ec 04             	sub    $0x4,%esp
+ 5d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 5d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 5d9:	6a 01                	push   $0x1
+ 5db:	53                   	push   %ebx
+ 5dc:	57                   	push   %edi
+ 5dd:	e8 41 fd ff ff       	call   323 <write>
+        while(*s != 0){
+ 5e2:	0f b6 06             	movzbl (%esi),%eax
+ 5e5:	83 c4 10             	add    $0x10,%esp
+ 5e8:	84 c0                	test   %al,%al
+ 5ea:	75 e4                	jne    5d0 <printf+0x120>
+      state = 0;
+ 5ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 5ef:	31 d2                	xor    %edx,%edx
+ 5f1:	e9 07 ff ff ff       	jmp    4fd <printf+0x4d>
+ 5f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 600:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 603:	83 ec 0c             	sub    $0xc,%esp
+ 606:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 60b:	8b 13                	mov    (%ebx),%edx
+ 60d:	6a 01                	push   $0x1
+ 60f:	e9 6b ff ff ff       	jmp    57f <printf+0xcf>
+ 614:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 618:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 61b:	83 ec 04             	sub    $0x4,%esp
+ 61e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 621:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 623:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 626:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 629:	6a 01                	push   $0x1
+ 62b:	52                   	push   %edx
+ 62c:	57                   	push   %edi
+ 62d:	e8 f1 fc ff ff       	call   323 <write>
+        ap++;
+ 632:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 635:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 638:	31 d2                	xor    %edx,%edx
+ 63a:	e9 be fe ff ff       	jmp    4fd <printf+0x4d>
+ 63f:	90                   	nop
+  write(fd, &c, 1);
+ 640:	83 ec 04             	sub    $0x4,%esp
+ 643:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 646:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 649:	6a 01                	push   $0x1
+ 64b:	e9 11 ff ff ff       	jmp    561 <printf+0xb1>
+ 650:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 655:	bb d3 0b 00 00       	mov    $0xbd3,%ebx
+ 65a:	e9 61 ff ff ff       	jmp    5c0 <printf+0x110>
+ 65f:	90                   	nop
+
+00000660 <runfree>:
+
+// Give the n pages at r back to the free runs, merging them with
+// adjacent runs, and shrink the heap if the end of it is free.
+static void
+runfree(struct page *r, uint n)
+{
+ 660:	55                   	push   %ebp
+  struct page **pp, *prev;
+
+  r->kind = PFREE;
+ 661:	b9 03 00 00 00       	mov    $0x3,%ecx
+{
+ 666:	89 e5                	mov    %esp,%ebp
+ 668:	57                   	push   %edi
+ 669:	56                   	push   %esi
+ 66a:	53                   	push   %ebx
+ 66b:	89 c3                	mov    %eax,%ebx
+ 66d:	83 ec 0c             	sub    $0xc,%esp
+  r->kind = PFREE;
+ 670:	66 89 08             	mov    %cx,(%eax)
+  r->npages = n;
+  prev = 0;
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 673:	8b 0d 54 0f 00 00    	mov    0xf54,%ecx
+  r->npages = n;
+ 679:	89 50 04             	mov    %edx,0x4(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 67c:	85 c9                	test   %ecx,%ecx
+ 67e:	0f 84 1f 01 00 00    	je     7a3 <runfree+0x143>
+ 684:	39 c1                	cmp    %eax,%ecx
+ 686:	0f 83 f7 00 00 00    	jae    783 <runfree+0x123>
+ 68c:	89 c8                	mov    %ecx,%eax
+ 68e:	eb 04                	jmp    694 <runfree+0x34>
+ 690:	39 d8                	cmp    %ebx,%eax
+ 692:	73 09                	jae    69d <runfree+0x3d>
+ 694:	89 c2                	mov    %eax,%edx
+ 696:	8b 40 14             	mov    0x14(%eax),%eax
+ 699:	85 c0                	test   %eax,%eax
+ 69b:	75 f3                	jne    690 <runfree+0x30>
+    prev = *pp;
+  r->next = *pp;
+ 69d:	89 43 14             	mov    %eax,0x14(%ebx)
+  *pp = r;
+ 6a0:	89 5a 14             	mov    %ebx,0x14(%edx)
+
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 6a3:	8b 43 14             	mov    0x14(%ebx),%eax
+ 6a6:	85 c0                	test   %eax,%eax
+ 6a8:	74 12                	je     6bc <runfree+0x5c>
+ 6aa:	8b 7b 04             	mov    0x4(%ebx),%edi
+ 6ad:	89 fe                	mov    %edi,%esi
+ 6af:	c1 e6 0c             	shl    $0xc,%esi
+ 6b2:	01 de                	add    %ebx,%esi
+ 6b4:	39 f0                	cmp    %esi,%eax
+ 6b6:	0f 84 a4 00 00 00    	je     760 <runfree+0x100>
+    r->npages += r->next->npages;
+    r->next = r->next->next;
+  }
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 6bc:	8b 72 04             	mov    0x4(%edx),%esi
+ 6bf:	89 f0                	mov    %esi,%eax
+ 6c1:	c1 e0 0c             	shl    $0xc,%eax
+ 6c4:	01 d0                	add    %edx,%eax
+ 6c6:	39 c3                	cmp    %eax,%ebx
+ 6c8:	74 16                	je     6e0 <runfree+0x80>
+    pp = &runs;
+    while(*pp != r)
+      pp = &(*pp)->next;
+  }
+
+  if(r->next == 0 && r->npages >= TRIM &&
+ 6ca:	8b 43 14             	mov    0x14(%ebx),%eax
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 6cd:	8d 72 14             	lea    0x14(%edx),%esi
+  if(r->next == 0 && r->npages >= TRIM &&
+ 6d0:	85 c0                	test   %eax,%eax
+ 6d2:	74 3c                	je     710 <runfree+0xb0>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+    *pp = 0;
+    sbrk(-(int)(r->npages*PGSIZE));
+    heapend = (char*)r;
+  }
+}
+ 6d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6d7:	5b                   	pop    %ebx
+ 6d8:	5e                   	pop    %esi
+ 6d9:	5f                   	pop    %edi
+ 6da:	5d                   	pop    %ebp
+ 6db:	c3                   	ret
+ 6dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    prev->npages += r->npages;
+ 6e0:	03 73 04             	add    0x4(%ebx),%esi
+ 6e3:	89 72 04             	mov    %esi,0x4(%edx)
+    prev->next = r->next;
+ 6e6:	8b 43 14             	mov    0x14(%ebx),%eax
+ 6e9:	89 42 14             	mov    %eax,0x14(%edx)
+    while(*pp != r)
+ 6ec:	39 d1                	cmp    %edx,%ecx
+ 6ee:	0f 84 c5 00 00 00    	je     7b9 <runfree+0x159>
+ 6f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      pp = &(*pp)->next;
+ 6f8:	89 cb                	mov    %ecx,%ebx
+ 6fa:	8b 49 14             	mov    0x14(%ecx),%ecx
+    while(*pp != r)
+ 6fd:	39 d1                	cmp    %edx,%ecx
+ 6ff:	75 f7                	jne    6f8 <runfree+0x98>
+      pp = &(*pp)->next;
+ 701:	8d 73 14             	lea    0x14(%ebx),%esi
+ 704:	89 cb                	mov    %ecx,%ebx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 706:	85 c0                	test   %eax,%eax
+ 708:	75 ca                	jne    6d4 <runfree+0x74>
+ 70a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 710:	8b 53 04             	mov    0x4(%ebx),%edx
+ 713:	83 fa 1f             	cmp    $0x1f,%edx
+ 716:	76 bc                	jbe    6d4 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 718:	c1 e2 0c             	shl    $0xc,%edx
+ 71b:	01 da                	add    %ebx,%edx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 71d:	39 15 50 0f 00 00    	cmp    %edx,0xf50
+ 723:	75 af                	jne    6d4 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 725:	83 ec 0c             	sub    $0xc,%esp
+ 728:	6a 00                	push   $0x0
+ 72a:	e8 5c fc ff ff       	call   38b <sbrk>
+ 72f:	83 c4 10             	add    $0x10,%esp
+ 732:	39 05 50 0f 00 00    	cmp    %eax,0xf50
+ 738:	75 9a                	jne    6d4 <runfree+0x74>
+    *pp = 0;
+ 73a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    sbrk(-(int)(r->npages*PGSIZE));
+ 740:	8b 43 04             	mov    0x4(%ebx),%eax
+ 743:	83 ec 0c             	sub    $0xc,%esp
+ 746:	c1 e0 0c             	shl    $0xc,%eax
+ 749:	f7 d8                	neg    %eax
+ 74b:	50                   	push   %eax
+ 74c:	e8 3a fc ff ff       	call   38b <sbrk>
+    heapend = (char*)r;
+ 751:	89 1d 50 0f 00 00    	mov    %ebx,0xf50
+ 757:	83 c4 10             	add    $0x10,%esp
+}
+ 75a:	e9 75 ff ff ff       	jmp    6d4 <runfree+0x74>
+ 75f:	90                   	nop
+    r->npages += r->next->npages;
+ 760:	03 78 04             	add    0x4(%eax),%edi
+ 763:	89 7b 04             	mov    %edi,0x4(%ebx)
+    r->next = r->next->next;
+ 766:	8b 40 14             	mov    0x14(%eax),%eax
+ 769:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 76c:	8b 72 04             	mov    0x4(%edx),%esi
+ 76f:	89 f0                	mov    %esi,%eax
+ 771:	c1 e0 0c             	shl    $0xc,%eax
+ 774:	01 d0                	add    %edx,%eax
+ 776:	39 c3                	cmp    %eax,%ebx
+ 778:	0f 85 4c ff ff ff    	jne    6ca <runfree+0x6a>
+ 77e:	e9 5d ff ff ff       	jmp    6e0 <runfree+0x80>
+  r->next = *pp;
+ 783:	89 48 14             	mov    %ecx,0x14(%eax)
+  *pp = r;
+ 786:	a3 54 0f 00 00       	mov    %eax,0xf54
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 78b:	89 d0                	mov    %edx,%eax
+ 78d:	c1 e0 0c             	shl    $0xc,%eax
+ 790:	01 d8                	add    %ebx,%eax
+ 792:	39 c1                	cmp    %eax,%ecx
+ 794:	74 2f                	je     7c5 <runfree+0x165>
+  if(r->next == 0 && r->npages >= TRIM &&
+ 796:	8b 43 14             	mov    0x14(%ebx),%eax
+ 799:	be 54 0f 00 00       	mov    $0xf54,%esi
+ 79e:	e9 2d ff ff ff       	jmp    6d0 <runfree+0x70>
+  r->next = *pp;
+ 7a3:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 7aa:	be 54 0f 00 00       	mov    $0xf54,%esi
+  *pp = r;
+ 7af:	a3 54 0f 00 00       	mov    %eax,0xf54
+  if(r->next == 0 && r->npages >= TRIM &&
+ 7b4:	e9 5a ff ff ff       	jmp    713 <runfree+0xb3>
+    while(*pp != r)
+ 7b9:	89 cb                	mov    %ecx,%ebx
+    pp = &runs;
+ 7bb:	be 54 0f 00 00       	mov    $0xf54,%esi
+ 7c0:	e9 0b ff ff ff       	jmp    6d0 <runfree+0x70>
+    r->npages += r->next->npages;
+ 7c5:	03 51 04             	add    0x4(%ecx),%edx
+ 7c8:	89 53 04             	mov    %edx,0x4(%ebx)
+    r->next = r->next->next;
+ 7cb:	8b 41 14             	mov    0x14(%ecx),%eax
+ 7ce:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 7d1:	eb c3                	jmp    796 <runfree+0x136>
+ 7d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000007e0 <runalloc>:
+
+// Take a run of n pages from the start of the first free run
+// long enough, which keeps the end of the heap free to trim.
+static struct page*
+runalloc(uint n)
+{
+ 7e0:	55                   	push   %ebp
+ 7e1:	89 e5                	mov    %esp,%ebp
+ 7e3:	57                   	push   %edi
+ 7e4:	56                   	push   %esi
+ 7e5:	89 c6                	mov    %eax,%esi
+ 7e7:	53                   	push   %ebx
+ 7e8:	83 ec 1c             	sub    $0x1c,%esp
+  struct page **pp, *r, *rest;
+
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ 7eb:	8b 1d 54 0f 00 00    	mov    0xf54,%ebx
+ 7f1:	85 db                	test   %ebx,%ebx
+ 7f3:	74 4d                	je     842 <runalloc+0x62>
+ 7f5:	b9 54 0f 00 00       	mov    $0xf54,%ecx
+    if(r->npages < n)
+ 7fa:	39 73 04             	cmp    %esi,0x4(%ebx)
+ 7fd:	72 39                	jb     838 <runalloc+0x58>
+      continue;
+    if(r->npages == n){
+ 7ff:	0f 84 9b 00 00 00    	je     8a0 <runalloc+0xc0>
+      *pp = r->next;
+    } else {
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ 805:	89 f0                	mov    %esi,%eax
+      rest->kind = PFREE;
+ 807:	ba 03 00 00 00       	mov    $0x3,%edx
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ 80c:	c1 e0 0c             	shl    $0xc,%eax
+ 80f:	01 d8                	add    %ebx,%eax
+      rest->kind = PFREE;
+ 811:	66 89 10             	mov    %dx,(%eax)
+      rest->npages = r->npages - n;
+ 814:	8b 53 04             	mov    0x4(%ebx),%edx
+ 817:	29 f2                	sub    %esi,%edx
+ 819:	89 50 04             	mov    %edx,0x4(%eax)
+      rest->next = r->next;
+ 81c:	8b 53 14             	mov    0x14(%ebx),%edx
+ 81f:	89 50 14             	mov    %edx,0x14(%eax)
+      *pp = rest;
+ 822:	89 01                	mov    %eax,(%ecx)
+      r->npages = n;
+ 824:	89 73 04             	mov    %esi,0x4(%ebx)
+    }
+    return r;
+  }
+  return morecore(n);
+}
+ 827:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 82a:	89 d8                	mov    %ebx,%eax
+ 82c:	5b                   	pop    %ebx
+ 82d:	5e                   	pop    %esi
+ 82e:	5f                   	pop    %edi
+ 82f:	5d                   	pop    %ebp
+ 830:	c3                   	ret
+ 831:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ 838:	8d 4b 14             	lea    0x14(%ebx),%ecx
+ 83b:	8b 5b 14             	mov    0x14(%ebx),%ebx
+ 83e:	85 db                	test   %ebx,%ebx
+ 840:	75 b8                	jne    7fa <runalloc+0x1a>
+  m = n < MINCORE ? MINCORE : n;
+ 842:	bf 08 00 00 00       	mov    $0x8,%edi
+ 847:	39 fe                	cmp    %edi,%esi
+ 849:	0f 43 fe             	cmovae %esi,%edi
+  brk = sbrk(0);
+ 84c:	83 ec 0c             	sub    $0xc,%esp
+ 84f:	6a 00                	push   $0x0
+ 851:	e8 35 fb ff ff       	call   38b <sbrk>
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 856:	89 fa                	mov    %edi,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 858:	89 c3                	mov    %eax,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 85a:	c1 e2 0c             	shl    $0xc,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 85d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 860:	f7 db                	neg    %ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 862:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 865:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 86b:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+ 86e:	89 04 24             	mov    %eax,(%esp)
+ 871:	e8 15 fb ff ff       	call   38b <sbrk>
+ 876:	83 c4 10             	add    $0x10,%esp
+ 879:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 87c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 87f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 882:	74 3e                	je     8c2 <runalloc+0xe2>
+  r = (struct page*)(brk + pad);
+ 884:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ 886:	01 da                	add    %ebx,%edx
+ 888:	89 15 50 0f 00 00    	mov    %edx,0xf50
+  if(m > n)
+ 88e:	39 fe                	cmp    %edi,%esi
+ 890:	72 1e                	jb     8b0 <runalloc+0xd0>
+  r->npages = n;
+ 892:	89 73 04             	mov    %esi,0x4(%ebx)
+  return r;
+ 895:	eb 90                	jmp    827 <runalloc+0x47>
+ 897:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89e:	66 90                	xchg   %ax,%ax
+      *pp = r->next;
+ 8a0:	8b 43 14             	mov    0x14(%ebx),%eax
+ 8a3:	89 01                	mov    %eax,(%ecx)
+}
+ 8a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8a8:	89 d8                	mov    %ebx,%eax
+ 8aa:	5b                   	pop    %ebx
+ 8ab:	5e                   	pop    %esi
+ 8ac:	5f                   	pop    %edi
+ 8ad:	5d                   	pop    %ebp
+ 8ae:	c3                   	ret
+ 8af:	90                   	nop
+    runfree((struct page*)((char*)r + n*PGSIZE), m - n);
+ 8b0:	89 f0                	mov    %esi,%eax
+ 8b2:	29 f7                	sub    %esi,%edi
+ 8b4:	c1 e0 0c             	shl    $0xc,%eax
+ 8b7:	89 fa                	mov    %edi,%edx
+ 8b9:	01 d8                	add    %ebx,%eax
+ 8bb:	e8 a0 fd ff ff       	call   660 <runfree>
+ 8c0:	eb d0                	jmp    892 <runalloc+0xb2>
+    if(sbrk(pad + m*PGSIZE) == (char*)-1)
+ 8c2:	89 f7                	mov    %esi,%edi
+ 8c4:	83 ec 0c             	sub    $0xc,%esp
+ 8c7:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 8ca:	c1 e7 0c             	shl    $0xc,%edi
+ 8cd:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+ 8d0:	50                   	push   %eax
+ 8d1:	e8 b5 fa ff ff       	call   38b <sbrk>
+ 8d6:	83 c4 10             	add    $0x10,%esp
+ 8d9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 8dc:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8df:	74 0c                	je     8ed <runalloc+0x10d>
+  r = (struct page*)(brk + pad);
+ 8e1:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ 8e3:	01 df                	add    %ebx,%edi
+ 8e5:	89 3d 50 0f 00 00    	mov    %edi,0xf50
+  if(m > n)
+ 8eb:	eb a5                	jmp    892 <runalloc+0xb2>
+      return 0;
+ 8ed:	31 db                	xor    %ebx,%ebx
+ 8ef:	e9 33 ff ff ff       	jmp    827 <runalloc+0x47>
+ 8f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8ff:	90                   	nop
+
+00000900 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+ 900:	55                   	push   %ebp
+ 901:	89 e5                	mov    %esp,%ebp
+ 903:	56                   	push   %esi
+ 904:	53                   	push   %ebx
+ 905:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  struct page *p;
+
+  if(ap == 0)
+ 908:	85 c9                	test   %ecx,%ecx
+ 90a:	74 1c                	je     928 <free+0x28>
+    return;
+  p = (struct page*)((uint)ap & ~(PGSIZE-1));
+ 90c:	89 c8                	mov    %ecx,%eax
+ 90e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  switch(p->kind){
+ 913:	0f b7 10             	movzwl (%eax),%edx
+ 916:	66 83 fa 02          	cmp    $0x2,%dx
+ 91a:	74 14                	je     930 <free+0x30>
+ 91c:	66 83 fa 04          	cmp    $0x4,%dx
+ 920:	74 66                	je     988 <free+0x88>
+ 922:	66 83 fa 01          	cmp    $0x1,%dx
+ 926:	74 18                	je     940 <free+0x40>
+    break;
+  case PMAP:
+    munmap(p, p->npages*PGSIZE);
+    break;
+  }
+}
+ 928:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 92b:	5b                   	pop    %ebx
+ 92c:	5e                   	pop    %esi
+ 92d:	5d                   	pop    %ebp
+ 92e:	c3                   	ret
+ 92f:	90                   	nop
+    runfree(p, p->npages);
+ 930:	8b 50 04             	mov    0x4(%eax),%edx
+}
+ 933:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 936:	5b                   	pop    %ebx
+ 937:	5e                   	pop    %esi
+ 938:	5d                   	pop    %ebp
+    runfree(p, p->npages);
+ 939:	e9 22 fd ff ff       	jmp    660 <runfree>
+ 93e:	66 90                	xchg   %ax,%ax
+  b->next = p->free;
+ 940:	8b 50 0c             	mov    0xc(%eax),%edx
+ 943:	89 11                	mov    %edx,(%ecx)
+  if(p->nfree++ == 0)
+ 945:	8b 50 08             	mov    0x8(%eax),%edx
+  p->free = b;
+ 948:	89 48 0c             	mov    %ecx,0xc(%eax)
+  if(p->nfree++ == 0)
+ 94b:	8d 5a 01             	lea    0x1(%edx),%ebx
+ 94e:	89 58 08             	mov    %ebx,0x8(%eax)
+ 951:	85 d2                	test   %edx,%edx
+ 953:	74 53                	je     9a8 <free+0xa8>
+  if(p->nfree == nblocks(p->class)){
+ 955:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ 959:	8d 4e 04             	lea    0x4(%esi),%ecx
+ 95c:	ba e0 0f 00 00       	mov    $0xfe0,%edx
+ 961:	d3 fa                	sar    %cl,%edx
+  if(p->nfree == nblocks(p->class)){
+ 963:	39 da                	cmp    %ebx,%edx
+ 965:	75 c1                	jne    928 <free+0x28>
+  if(p->prev)
+ 967:	8b 48 18             	mov    0x18(%eax),%ecx
+    p->prev->next = p->next;
+ 96a:	8b 50 14             	mov    0x14(%eax),%edx
+  if(p->prev)
+ 96d:	85 c9                	test   %ecx,%ecx
+ 96f:	74 6f                	je     9e0 <free+0xe0>
+    p->prev->next = p->next;
+ 971:	89 51 14             	mov    %edx,0x14(%ecx)
+  if(p->next)
+ 974:	85 d2                	test   %edx,%edx
+ 976:	74 06                	je     97e <free+0x7e>
+    p->next->prev = p->prev;
+ 978:	8b 48 18             	mov    0x18(%eax),%ecx
+ 97b:	89 4a 18             	mov    %ecx,0x18(%edx)
+    runfree(p, 1);
+ 97e:	ba 01 00 00 00       	mov    $0x1,%edx
+ 983:	eb ae                	jmp    933 <free+0x33>
+ 985:	8d 76 00             	lea    0x0(%esi),%esi
+    munmap(p, p->npages*PGSIZE);
+ 988:	8b 50 04             	mov    0x4(%eax),%edx
+ 98b:	83 ec 08             	sub    $0x8,%esp
+ 98e:	c1 e2 0c             	shl    $0xc,%edx
+ 991:	52                   	push   %edx
+ 992:	50                   	push   %eax
+ 993:	e8 1b fa ff ff       	call   3b3 <munmap>
+    break;
+ 998:	83 c4 10             	add    $0x10,%esp
+}
+ 99b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 99e:	5b                   	pop    %ebx
+ 99f:	5e                   	pop    %esi
+ 9a0:	5d                   	pop    %ebp
+ 9a1:	c3                   	ret
+ 9a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  p->next = partial[p->class];
+ 9a8:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  p->prev = 0;
+ 9ac:	c7 40 18 00 00 00 00 	movl   $0x0,0x18(%eax)
+  p->next = partial[p->class];
+ 9b3:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 9b8:	8b 14 b5 58 0f 00 00 	mov    0xf58(,%esi,4),%edx
+ 9bf:	89 50 14             	mov    %edx,0x14(%eax)
+  if(p->next)
+ 9c2:	85 d2                	test   %edx,%edx
+ 9c4:	74 0a                	je     9d0 <free+0xd0>
+    p->next->prev = p;
+ 9c6:	89 42 18             	mov    %eax,0x18(%edx)
+  partial[p->class] = p;
+ 9c9:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  if(p->nfree == nblocks(p->class)){
+ 9cd:	8b 58 08             	mov    0x8(%eax),%ebx
+  partial[p->class] = p;
+ 9d0:	89 04 b5 58 0f 00 00 	mov    %eax,0xf58(,%esi,4)
+}
+ 9d7:	eb 80                	jmp    959 <free+0x59>
+ 9d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ 9e0:	89 14 b5 58 0f 00 00 	mov    %edx,0xf58(,%esi,4)
+ 9e7:	eb 8b                	jmp    974 <free+0x74>
+ 9e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000009f0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 9f0:	55                   	push   %ebp
+ 9f1:	89 e5                	mov    %esp,%ebp
+ 9f3:	56                   	push   %esi
+ 9f4:	53                   	push   %ebx
+ 9f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct page *p;
+  uint n;
+
+  if(nbytes <= MAXSMALL)
+ 9f8:	3d 00 04 00 00       	cmp    $0x400,%eax
+ 9fd:	76 71                	jbe    a70 <malloc+0x80>
+    return smallalloc(sizeclass(nbytes));
+  if(nbytes > 0x7fffffff)
+ 9ff:	85 c0                	test   %eax,%eax
+ a01:	0f 88 d9 00 00 00    	js     ae0 <malloc+0xf0>
+    return 0;
+  n = (nbytes + HDRSIZE + PGSIZE-1) / PGSIZE;
+ a07:	8d 90 1f 10 00 00    	lea    0x101f(%eax),%edx
+ a0d:	89 d3                	mov    %edx,%ebx
+ a0f:	c1 eb 0c             	shr    $0xc,%ebx
+  if(nbytes >= MAPMIN){
+ a12:	3d ff ff 00 00       	cmp    $0xffff,%eax
+ a17:	77 27                	ja     a40 <malloc+0x50>
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    if(p == MAP_FAILED)
+      return 0;
+    p->kind = PMAP;
+  } else {
+    if((p = runalloc(n)) == 0)
+ a19:	89 d8                	mov    %ebx,%eax
+ a1b:	e8 c0 fd ff ff       	call   7e0 <runalloc>
+ a20:	85 c0                	test   %eax,%eax
+ a22:	0f 84 b8 00 00 00    	je     ae0 <malloc+0xf0>
+      return 0;
+    p->kind = PRUN;
+ a28:	ba 02 00 00 00       	mov    $0x2,%edx
+ a2d:	66 89 10             	mov    %dx,(%eax)
+  }
+  p->npages = n;
+ a30:	89 58 04             	mov    %ebx,0x4(%eax)
+  return (char*)p + HDRSIZE;
+ a33:	8d 58 20             	lea    0x20(%eax),%ebx
+}
+ a36:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a39:	89 d8                	mov    %ebx,%eax
+ a3b:	5b                   	pop    %ebx
+ a3c:	5e                   	pop    %esi
+ a3d:	5d                   	pop    %ebp
+ a3e:	c3                   	ret
+ a3f:	90                   	nop
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+ a40:	83 ec 08             	sub    $0x8,%esp
+ a43:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+ a49:	6a 00                	push   $0x0
+ a4b:	6a ff                	push   $0xffffffff
+ a4d:	6a 22                	push   $0x22
+ a4f:	6a 03                	push   $0x3
+ a51:	52                   	push   %edx
+ a52:	6a 00                	push   $0x0
+ a54:	e8 52 f9 ff ff       	call   3ab <mmap>
+    if(p == MAP_FAILED)
+ a59:	83 c4 20             	add    $0x20,%esp
+ a5c:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a5f:	74 7f                	je     ae0 <malloc+0xf0>
+    p->kind = PMAP;
+ a61:	b9 04 00 00 00       	mov    $0x4,%ecx
+ a66:	66 89 08             	mov    %cx,(%eax)
+ a69:	eb c5                	jmp    a30 <malloc+0x40>
+ a6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a6f:	90                   	nop
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ a70:	83 f8 10             	cmp    $0x10,%eax
+ a73:	0f 86 07 01 00 00    	jbe    b80 <malloc+0x190>
+ a79:	31 db                	xor    %ebx,%ebx
+ a7b:	ba 10 00 00 00       	mov    $0x10,%edx
+ a80:	83 c3 01             	add    $0x1,%ebx
+ a83:	89 d6                	mov    %edx,%esi
+ a85:	89 d9                	mov    %ebx,%ecx
+ a87:	d3 e6                	shl    %cl,%esi
+ a89:	39 c6                	cmp    %eax,%esi
+ a8b:	72 f3                	jb     a80 <malloc+0x90>
+  if((p = partial[c]) == 0){
+ a8d:	8b 14 9d 58 0f 00 00 	mov    0xf58(,%ebx,4),%edx
+ a94:	85 d2                	test   %edx,%edx
+ a96:	74 58                	je     af0 <malloc+0x100>
+  if((b = p->free) != 0){
+ a98:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ a9b:	8b 4a 08             	mov    0x8(%edx),%ecx
+  if((b = p->free) != 0){
+ a9e:	85 db                	test   %ebx,%ebx
+ aa0:	0f 84 aa 00 00 00    	je     b50 <malloc+0x160>
+    p->free = b->next;
+ aa6:	8b 03                	mov    (%ebx),%eax
+ aa8:	89 42 0c             	mov    %eax,0xc(%edx)
+  if(--p->nfree == 0)
+ aab:	83 e9 01             	sub    $0x1,%ecx
+ aae:	89 4a 08             	mov    %ecx,0x8(%edx)
+ ab1:	75 83                	jne    a36 <malloc+0x46>
+  if(p->prev)
+ ab3:	8b 4a 18             	mov    0x18(%edx),%ecx
+    p->prev->next = p->next;
+ ab6:	8b 42 14             	mov    0x14(%edx),%eax
+  if(p->prev)
+ ab9:	85 c9                	test   %ecx,%ecx
+ abb:	0f 84 cf 00 00 00    	je     b90 <malloc+0x1a0>
+    p->prev->next = p->next;
+ ac1:	89 41 14             	mov    %eax,0x14(%ecx)
+  if(p->next)
+ ac4:	85 c0                	test   %eax,%eax
+ ac6:	0f 84 6a ff ff ff    	je     a36 <malloc+0x46>
+    p->next->prev = p->prev;
+ acc:	8b 52 18             	mov    0x18(%edx),%edx
+ acf:	89 50 18             	mov    %edx,0x18(%eax)
+ ad2:	e9 5f ff ff ff       	jmp    a36 <malloc+0x46>
+ ad7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ade:	66 90                	xchg   %ax,%ax
+}
+ ae0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+ ae3:	31 db                	xor    %ebx,%ebx
+}
+ ae5:	89 d8                	mov    %ebx,%eax
+ ae7:	5b                   	pop    %ebx
+ ae8:	5e                   	pop    %esi
+ ae9:	5d                   	pop    %ebp
+ aea:	c3                   	ret
+ aeb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ aef:	90                   	nop
+    if((p = runalloc(1)) == 0)
+ af0:	b8 01 00 00 00       	mov    $0x1,%eax
+ af5:	e8 e6 fc ff ff       	call   7e0 <runalloc>
+ afa:	89 c2                	mov    %eax,%edx
+ afc:	85 c0                	test   %eax,%eax
+ afe:	74 e0                	je     ae0 <malloc+0xf0>
+    p->kind = PSMALL;
+ b00:	b8 01 00 00 00       	mov    $0x1,%eax
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ b05:	8d 4b 04             	lea    0x4(%ebx),%ecx
+    p->class = c;
+ b08:	66 89 5a 02          	mov    %bx,0x2(%edx)
+ b0c:	0f b7 db             	movzwl %bx,%ebx
+    p->kind = PSMALL;
+ b0f:	66 89 02             	mov    %ax,(%edx)
+    p->fresh = (char*)p + HDRSIZE;
+ b12:	8d 42 20             	lea    0x20(%edx),%eax
+ b15:	89 42 10             	mov    %eax,0x10(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ b18:	b8 e0 0f 00 00       	mov    $0xfe0,%eax
+ b1d:	d3 f8                	sar    %cl,%eax
+    p->free = 0;
+ b1f:	c7 42 0c 00 00 00 00 	movl   $0x0,0xc(%edx)
+    p->nfree = nblocks(c);
+ b26:	89 42 08             	mov    %eax,0x8(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ b29:	89 c1                	mov    %eax,%ecx
+  p->next = partial[p->class];
+ b2b:	8b 04 9d 58 0f 00 00 	mov    0xf58(,%ebx,4),%eax
+  p->prev = 0;
+ b32:	c7 42 18 00 00 00 00 	movl   $0x0,0x18(%edx)
+  p->next = partial[p->class];
+ b39:	89 42 14             	mov    %eax,0x14(%edx)
+  if(p->next)
+ b3c:	85 c0                	test   %eax,%eax
+ b3e:	75 20                	jne    b60 <malloc+0x170>
+  partial[p->class] = p;
+ b40:	89 14 9d 58 0f 00 00 	mov    %edx,0xf58(,%ebx,4)
+  if((b = p->free) != 0){
+ b47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b4e:	66 90                	xchg   %ax,%ax
+    b = (struct block*)p->fresh;
+ b50:	8b 5a 10             	mov    0x10(%edx),%ebx
+    p->fresh += MINSMALL << c;
+ b53:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+ b56:	89 42 10             	mov    %eax,0x10(%edx)
+ b59:	e9 4d ff ff ff       	jmp    aab <malloc+0xbb>
+ b5e:	66 90                	xchg   %ax,%ax
+    p->next->prev = p;
+ b60:	89 50 18             	mov    %edx,0x18(%eax)
+  partial[p->class] = p;
+ b63:	0f b7 42 02          	movzwl 0x2(%edx),%eax
+  if((b = p->free) != 0){
+ b67:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ b6a:	8b 4a 08             	mov    0x8(%edx),%ecx
+  partial[p->class] = p;
+ b6d:	89 14 85 58 0f 00 00 	mov    %edx,0xf58(,%eax,4)
+}
+ b74:	e9 25 ff ff ff       	jmp    a9e <malloc+0xae>
+ b79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ b80:	be 10 00 00 00       	mov    $0x10,%esi
+ b85:	31 db                	xor    %ebx,%ebx
+ b87:	e9 01 ff ff ff       	jmp    a8d <malloc+0x9d>
+ b8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ b90:	0f b7 4a 02          	movzwl 0x2(%edx),%ecx
+ b94:	89 04 8d 58 0f 00 00 	mov    %eax,0xf58(,%ecx,4)
+ b9b:	e9 24 ff ff ff       	jmp    ac4 <malloc+0xd4>
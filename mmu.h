@@ -83,6 +83,7 @@ struct segdesc {
 #define NPDENTRIES      1024    // # directory entries per page directory
 #define NPTENTRIES      1024    // # PTEs per page table
 #define PGSIZE          4096    // bytes mapped by a page
+#define LPGSIZE         (PGSIZE*NPTENTRIES) // bytes mapped by a 4MB page
 
 #define PTXSHIFT        12      // offset of PTX in a linear address
 #define PDXSHIFT        22      // offset of PDX in a linear address
@@ -94,7 +95,17 @@ struct segdesc {
 #define PTE_P           0x001   // Present
 #define PTE_W           0x002   // Writeable
 #define PTE_U           0x004   // User
+#define PTE_A           0x020   // Accessed
+#define PTE_D           0x040   // Dirty
 #define PTE_PS          0x080   // Page Size
+#define PTE_COW         0x200   // Copy-on-write (available to software)
+#define PTE_SH          0x400   // Shared, not copied by fork (software)
+#define PTE_SWAP        0x800   // Not present, address is a swap slot (software)
+
+// Page fault error code bits
+#define FEC_PR          0x1     // Fault on a present page (protection)
+#define FEC_WR          0x2     // Fault caused by a write
+#define FEC_U           0x4     // Fault occurred in user mode
 
 // Address in page table or page directory entry
 #define PTE_ADDR(pte)   ((uint)(pte) & ~0xFFF)
@@ -9,7 +9,18 @@
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
-#define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
+#define LOGSIZE      (MAXOPBLOCKS*6)  // max data blocks in on-disk log
 #define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
+#define RAMIN         4  // first read-ahead window, in blocks
+#define RAMAX        32  // largest read-ahead window, in blocks
 #define FSSIZE       1000  // size of file system in blocks
+#define SWAPSIZE     8192  // size of swap area in blocks, after the file system
+#define NVMA         16  // demand-paged memory areas per process
+#define NPIN          4  // user memory ranges one system call keeps mapped
+#define NPCACHE     256  // pages in the file page cache
+#define NSHM         16  // shared memory segments
+#define NSHMPAGE   1024  // maximum pages per shared memory segment (a page of pointers)
+#define NZEROPAGE    64  // free pages kept zeroed by idle CPUs
+#define KCHUNK      256  // pages put on the free list at a time after boot
+#define NZYGOTE       8  // maximum pre-loaded processes per container
 
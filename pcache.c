@@ -0,0 +1,213 @@
+// Page cache.
+//
+// The page cache holds page-sized runs of file contents so that
+// processes mapping the same file, above all the text of a program
+// that many processes run at once, share one physical copy instead
+// of each reading the file into private pages.
+//
+// A cached page is named by (dev, inum, off), where off is the
+// file offset of its first byte. off need not be page aligned:
+// xv6 binaries put their one loadable segment at a small file
+// offset, and every process running the binary asks for the same
+// offsets, so they still share.
+//
+// The cache holds one reference (see kref in kalloc.c) to every
+// page it caches and each page table mapping the page holds
+// another, so a page with a single reference is mapped nowhere
+// and can be evicted.
+//
+// Interface:
+// * pcget returns a referenced page of file contents,
+//     reading it from the file on a miss.
+// * pcupdate copies data written by writei into cached pages.
+// * pcread copies cached pages over data read by readi, since
+//     stores through a shared mapping reach the file only when
+//     it is unmapped (see vmasync in vm.c).
+// * pcinval drops an inode's pages once its contents are freed.
+//
+// Callers hold the inode's sleep-lock, so two processes never
+// race to fill the same page. pcache.lock protects the table.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+
+#define NPCHASH 61
+#define PCHASH(dev, inum) (((dev) * 31 + (inum)) % NPCHASH)
+
+struct pcpage {
+  uint dev;
+  uint inum;
+  uint off;              // file offset of the first byte
+  char *page;            // cached contents; 0 if slot is free
+  struct pcpage *next;   // hash chain
+};
+
+struct {
+  struct spinlock lock;
+  struct pcpage page[NPCACHE];
+  struct pcpage *hash[NPCHASH];  // chains of pages, by inode
+  int hand;                      // next slot to consider for reuse
+} pcache;
+
+void
+pcinit(void)
+{
+  initlock(&pcache.lock, "pcache");
+}
+
+// Unlink pp from its hash chain.  Caller holds pcache.lock.
+static void
+pcunhash(struct pcpage *pp)
+{
+  struct pcpage **pq;
+
+  for(pq = &pcache.hash[PCHASH(pp->dev, pp->inum)]; *pq; pq = &(*pq)->next){
+    if(*pq == pp){
+      *pq = pp->next;
+      return;
+    }
+  }
+  panic("pcunhash");
+}
+
+// Find a slot for a new page, evicting a page that no
+// process maps if every slot is taken. Returns 0 if all
+// cached pages are in use.  Caller holds pcache.lock.
+static struct pcpage*
+pcslot(void)
+{
+  struct pcpage *pp;
+  int i;
+
+  for(i = 0; i < NPCACHE; i++){
+    pp = &pcache.page[pcache.hand];
+    pcache.hand = (pcache.hand + 1) % NPCACHE;
+    if(pp->page == 0)
+      return pp;
+    if(krefcnt(pp->page) == 1){
+      pcunhash(pp);
+      kfree(pp->page);
+      pp->page = 0;
+      return pp;
+    }
+  }
+  return 0;
+}
+
+// Return a page holding the PGSIZE bytes of ip at off.
+// The caller owns a reference to the page and must kfree()
+// it when done.  The page may be shared, so the caller
+// must not write it.  Returns 0 if the file is too short
+// or memory is exhausted.  Caller must hold ip->lock.
+char*
+pcget(struct inode *ip, uint off)
+{
+  struct pcpage *pp;
+  char *mem;
+
+  if(!holdingsleep(&ip->lock))
+    panic("pcget");
+
+  acquire(&pcache.lock);
+  for(pp = pcache.hash[PCHASH(ip->dev, ip->inum)]; pp; pp = pp->next){
+    if(pp->dev == ip->dev && pp->inum == ip->inum && pp->off == off){
+      kref(pp->page);
+      release(&pcache.lock);
+      return pp->page;
+    }
+  }
+  release(&pcache.lock);
+
+  if((mem = kalloc()) == 0)
+    return 0;
+  if(readi(ip, mem, off, PGSIZE) != PGSIZE){
+    kfree(mem);
+    return 0;
+  }
+  ireadahead(ip, &ip->ra, off, PGSIZE);
+
+  // If the cache is full of mapped pages, hand out
+  // an uncached copy instead.
+  acquire(&pcache.lock);
+  if((pp = pcslot()) != 0){
+    pp->dev = ip->dev;
+    pp->inum = ip->inum;
+    pp->off = off;
+    pp->page = mem;
+    pp->next = pcache.hash[PCHASH(ip->dev, ip->inum)];
+    pcache.hash[PCHASH(ip->dev, ip->inum)] = pp;
+    kref(mem);
+  }
+  release(&pcache.lock);
+  return mem;
+}
+
+// Copy n bytes at src, just written to ip at off,
+// into any cached pages that overlap them.
+// Caller must hold ip->lock.
+void
+pcupdate(struct inode *ip, uint off, char *src, uint n)
+{
+  struct pcpage *pp;
+  uint lo, hi;
+
+  acquire(&pcache.lock);
+  for(pp = pcache.hash[PCHASH(ip->dev, ip->inum)]; pp; pp = pp->next){
+    if(pp->dev != ip->dev || pp->inum != ip->inum)
+      continue;
+    lo = off > pp->off ? off : pp->off;
+    hi = off + n < pp->off + PGSIZE ? off + n : pp->off + PGSIZE;
+    if(lo < hi)
+      memmove(pp->page + (lo - pp->off), src + (lo - off), hi - lo);
+  }
+  release(&pcache.lock);
+}
+
+// Copy the cached pages of ip that overlap the n bytes at
+// off, just read by readi into dst, over dst, so that readers
+// see stores made through shared mappings before they reach
+// the file. Caller must hold ip->lock.
+void
+pcread(struct inode *ip, char *dst, uint off, uint n)
+{
+  struct pcpage *pp;
+  uint lo, hi;
+
+  acquire(&pcache.lock);
+  for(pp = pcache.hash[PCHASH(ip->dev, ip->inum)]; pp; pp = pp->next){
+    if(pp->dev != ip->dev || pp->inum != ip->inum)
+      continue;
+    lo = off > pp->off ? off : pp->off;
+    hi = off + n < pp->off + PGSIZE ? off + n : pp->off + PGSIZE;
+    if(lo < hi)
+      memmove(dst + (lo - off), pp->page + (lo - pp->off), hi - lo);
+  }
+  release(&pcache.lock);
+}
+
+// Drop every cached page of ip.  Pages still mapped
+// by processes stay valid until they are unmapped.
+void
+pcinval(struct inode *ip)
+{
+  struct pcpage *pp, **pq;
+
+  acquire(&pcache.lock);
+  pq = &pcache.hash[PCHASH(ip->dev, ip->inum)];
+  while((pp = *pq) != 0){
+    if(pp->dev == ip->dev && pp->inum == ip->inum){
+      *pq = pp->next;
+      kfree(pp->page);
+      pp->page = 0;
+    } else {
+      pq = &pp->next;
+    }
+  }
+  release(&pcache.lock);
+}
@@ -0,0 +1,73 @@
+// PCI configuration space, through configuration mechanism #1
+// (I/O ports 0xCF8 and 0xCFC).
+//
+// A function is named by its address, bus<<8 | device<<3 | function,
+// as the PCI specification numbers them. Drivers find their
+// device with pcifindclass or pcifindid and read its base
+// address registers with pciread.
+
+#include "types.h"
+#include "defs.h"
+#include "x86.h"
+
+#define PCI_ADDR   0xcf8
+#define PCI_DATA   0xcfc
+
+#define PCI_ID     0x00   // vendor id, device id
+#define PCI_CLASS  0x08   // revision, prog if, subclass, class
+#define PCI_HEADER 0x0c   // bit 23 of the word: multi-function
+
+// Read the configuration word at offset off of function f.
+uint
+pciread(uint f, uint off)
+{
+  outl(PCI_ADDR, 0x80000000 | f << 8 | (off & 0xfc));
+  return inl(PCI_DATA);
+}
+
+// Write the configuration word at offset off of function f.
+void
+pciwrite(uint f, uint off, uint v)
+{
+  outl(PCI_ADDR, 0x80000000 | f << 8 | (off & 0xfc));
+  outl(PCI_DATA, v);
+}
+
+// Return the first function whose configuration word at off,
+// masked with mask, is val, or -1 if there is none.
+static int
+pcifind(uint off, uint mask, uint val)
+{
+  uint bus, dev, fn, nfn;
+
+  for(bus = 0; bus < 256; bus++){
+    for(dev = 0; dev < 32; dev++){
+      if((pciread(bus<<8 | dev<<3, PCI_ID) & 0xffff) == 0xffff)
+        continue;  // no device
+      nfn = pciread(bus<<8 | dev<<3, PCI_HEADER) & (1<<23) ? 8 : 1;
+      for(fn = 0; fn < nfn; fn++){
+        if((pciread(bus<<8 | dev<<3 | fn, PCI_ID) & 0xffff) == 0xffff)
+          continue;
+        if((pciread(bus<<8 | dev<<3 | fn, off) & mask) == val)
+          return bus<<8 | dev<<3 | fn;
+      }
+    }
+  }
+  return -1;
+}
+
+// Return the first function of the given class and subclass,
+// or -1 if there is none.
+int
+pcifindclass(uint class, uint subclass)
+{
+  return pcifind(PCI_CLASS, 0xffff0000, class << 24 | subclass << 16);
+}
+
+// Return the first function with the given vendor and device
+// ids, or -1 if there is none.
+int
+pcifindid(uint vendor, uint device)
+{
+  return pcifind(PCI_ID, 0xffffffff, device << 16 | vendor);
+}
@@ -40,6 +40,7 @@
 #include "x86.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "memstats.h"
 
 struct {
   struct spinlock lock;
@@ -64,6 +65,7 @@ extern void forkret(void);
 extern void trapret(void);
 
 static void wakeup1(void *chan);
+static struct container *get_container_by_cid(int cid);
 
 void
 cinit(void)
@@ -121,7 +123,7 @@ mycont(void) {
 // Look in the parent container's process table for an UNUSED proc.
 // If found, change state to EMBRYO and initialize state required to 
 // run in the kernel. Otherwise return 0.
-static struct proc*
+struct proc*
 allocproc(struct container *cont)
 {
   struct proc *p;
@@ -149,6 +151,12 @@ allocproc(struct container *cont)
 found:
   p->state = EMBRYO;
   p->pid = nextpid++;
+  p->insyscall = 0;
+  p->infault = 0;
+  p->npin = 0;
+  p->leader = p;
+  p->nthread = 1;
+  p->vmbusy = 0;
 
   release(&ptable.lock);
 
@@ -219,6 +227,28 @@ initprocess(struct container *cont)
   return p;  
 }
 
+// Start a kernel thread in the root container running fn,
+// which must never return. It has no user memory, and is a
+// child of init so that it has a parent.
+void
+kthread(char *name, void (*fn)(void))
+{
+  struct proc *p;
+
+  if((p = allocproc(initproc->cont)) == 0 || (p->pgdir = setupkvm()) == 0)
+    panic("kthread");
+  // forkret returns to fn instead of trapret (see allocproc).
+  *(uint*)((char*)p->context + sizeof(*p->context)) = (uint)fn;
+  p->sz = 0;
+  p->parent = initproc;
+  p->cwd = idup(initproc->cwd);
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  acquire(&ptable.lock);
+  p->state = RUNNABLE;
+  release(&ptable.lock);
+}
+
 // Look-up for CUNUSED container in ctable, and set its status to CEMBRYO.
 static struct container*
 alloccont(void) {
@@ -235,6 +265,7 @@ alloccont(void) {
 found:
   cont->state = CEMBRYO;
   cont->cid = nextcid++;
+  kresetcont(cont);
   release(&ctable.lock);
   return cont;
 }
@@ -283,22 +314,58 @@ userinit(void) {
 int
 growproc(int n)
 {
-  uint sz;
+  int sz;
   struct proc *curproc = myproc();
 
-  sz = curproc->sz;
+  if(n < 0){
+    // Another thread's system call may be using the pages
+    // that go; sz may change while waiting for it.
+    for(;;){
+      sz = curproc->leader->sz;
+      vmlockrange(curproc, sz + n, sz);
+      if(curproc->leader->sz == sz)
+        break;
+      vmunlock(curproc);
+    }
+  } else
+    vmlock(curproc);
+  sz = curproc->leader->sz;
   if(n > 0){
-    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    if(sz + n > MMAPBASE ||
+       (sz = allocuvm(curproc->pgdir, sz, sz + n, curproc->cont)) == 0){
+      vmunlock(curproc);
       return -1;
+    }
   } else if(n < 0){
-    if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) < 0){
+      vmunlock(curproc);
       return -1;
+    }
   }
-  curproc->sz = sz;
+  curproc->leader->sz = sz;
   switchuvm(curproc);
+  vmunlock(curproc);
   return 0;
 }
 
+// Choose the container and the parent of a new child of the
+// current process.
+static struct container*
+childcont(struct container *parentcont, struct proc **parent)
+{
+  // If container assigned, use that container and initproc.
+  // Otherwise, use current container(after cont start) if possible.
+  if (parentcont != 0) {
+    *parent = initproc;
+    return parentcont;
+  } else if (curcont != 0) {
+    *parent = initproc;
+    return curcont;
+  }
+  *parent = myproc();
+  return myproc()->cont;
+}
+
 // Create a new process copying p as the parent.
 // Sets up stack to return as if from system call.
 // Caller must set state of returned proc to RUNNABLE.
@@ -311,32 +378,28 @@ fork(struct container *parentcont)
   struct proc *parent;
   struct container *cont;
 
-  // If container assigned, use that container and initproc.
-  // Otherwise, use current container(after cont start) if possible.
-  if (parentcont != 0) {
-    cont = parentcont;
-    parent = initproc;
-  } else if (curcont != 0) {
-    cont = curcont;
-    parent = initproc;
-  } else {
-    cont = curproc->cont;
-    parent = curproc;
-  }
+  cont = childcont(parentcont, &parent);
 
   // Allocate process.
   if((np = allocproc(cont)) == 0){
     return -1;
   }
 
-  // Copy process state from proc.
-  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
+  // Copy process state from proc. Pages of shared mappings
+  // that neither has touched yet come from the same cached
+  // page or segment when the child touches them.
+  vmlock(curproc);
+  np->pgdir = copyuvm(curproc->pgdir, curproc->leader->sz, np->cont);
+  if(np->pgdir == 0){
+    vmunlock(curproc);
     kfree(np->kstack);
     np->kstack = 0;
     np->state = UNUSED;
     return -1;
   }
-  np->sz = curproc->sz;
+  np->sz = curproc->leader->sz;
+  vmadup(np->vma, curproc->leader->vma);
+  vmunlock(curproc);
   np->parent = parent;
   *np->tf = *curproc->tf;
 
@@ -361,6 +424,437 @@ fork(struct container *parentcont)
   return pid;
 }
 
+// Make a process in cont running the program at path with argv,
+// or loaded but without arguments if argv is 0. Returns it as an
+// embryo, with no files and no working directory, or 0.
+static struct proc*
+allocexec(struct container *cont, char *path, char **argv)
+{
+  struct proc *np;
+
+  if((np = allocproc(cont)) == 0)
+    return 0;
+  memset(np->tf, 0, sizeof(*np->tf));
+  np->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+  np->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+  np->tf->es = np->tf->ds;
+  np->tf->ss = np->tf->ds;
+  np->tf->eflags = FL_IF;
+  np->pgdir = 0;
+  if(execinto(np, path, argv) < 0){
+    kfree(np->kstack);
+    np->kstack = 0;
+    np->state = UNUSED;
+    return 0;
+  }
+  return np;
+}
+
+// Free a zygote that will not be started.
+static void
+zfree(struct proc *p)
+{
+  freevm(p->pgdir);
+  p->pgdir = 0;
+  vmaput(p->vma);
+  kfree(p->kstack);
+  p->kstack = 0;
+  acquire(&ptable.lock);
+  p->state = UNUSED;
+  release(&ptable.lock);
+}
+
+// Empty cont's pool and keep no zygotes from now on.
+static void
+zdrain(struct container *cont)
+{
+  struct proc *old[NZYGOTE];
+  int i, n;
+
+  acquire(&ctable.lock);
+  n = cont->nzygote;
+  memmove(old, cont->zygote, sizeof(old));
+  cont->nzygote = 0;
+  cont->zwant = 0;
+  cont->zrefill = 0;
+  release(&ctable.lock);
+  for (i = 0; i < n; i++)
+    zfree(old[i]);
+}
+
+// Take a zygote of the program at path from cont's pool and give
+// it argv, and have zfiller load a replacement. Returns it as an
+// embryo like allocexec, or 0 if the pool has none.
+static struct proc*
+zygote(struct container *cont, char *path, char **argv)
+{
+  struct proc *np = 0;
+
+  acquire(&ctable.lock);
+  if (cont->nzygote > 0 && strncmp(cont->zpath, path, sizeof(cont->zpath)) == 0) {
+    np = cont->zygote[--cont->nzygote];
+    cont->zrefill = 1;
+    wakeup(&ctable);
+  }
+  release(&ctable.lock);
+  if (np && execargs(np, argv) < 0) {
+    zfree(np);
+    return 0;
+  }
+  return np;
+}
+
+// Load zygotes until cont's pool holds as many as it should.
+// Stops early if the container runs out of process slots.
+static void
+zfill(struct container *cont)
+{
+  char path[sizeof(cont->zpath)];
+  struct proc *np;
+
+  for (;;) {
+    acquire(&ctable.lock);
+    if (cont->nzygote >= cont->zwant) {
+      release(&ctable.lock);
+      return;
+    }
+    safestrcpy(path, cont->zpath, sizeof(path));
+    release(&ctable.lock);
+
+    if ((np = allocexec(cont, path, 0)) == 0)
+      return;
+
+    // The pool may have changed while the program loaded.
+    acquire(&ctable.lock);
+    if (cont->nzygote < cont->zwant &&
+        strncmp(cont->zpath, path, sizeof(path)) == 0) {
+      cont->zygote[cont->nzygote++] = np;
+      np = 0;
+    }
+    release(&ctable.lock);
+    if (np) {
+      zfree(np);
+      return;
+    }
+  }
+}
+
+// Zygote filler kernel thread: refill the pools that spawn took
+// zygotes from, so that the launcher never waits for a program
+// to load. A pool that cannot be filled is left until the next
+// spawn from it.
+static void
+zfiller(void)
+{
+  struct container *cont;
+
+  acquire(&ctable.lock);
+  for (;;) {
+    for (cont = ctable.cont; cont < &ctable.cont[NCONT]; cont++)
+      if (cont->zrefill)
+        break;
+    if (cont == &ctable.cont[NCONT]) {
+      sleep(&ctable, &ctable.lock);
+      continue;
+    }
+    cont->zrefill = 0;
+    release(&ctable.lock);
+    zfill(cont);
+    acquire(&ctable.lock);
+  }
+}
+
+// Start the program at path with argv in a new process, as fork
+// followed by exec would but without copying the caller's address
+// space. The child takes over the file references in ofile (NOFILE
+// entries) on success; on failure the caller keeps them. The child
+// goes into the container with cid, or where fork would put it if
+// cid is -1, and starts in that container's root directory. A
+// relative path is looked up from the caller's working directory.
+// If the container keeps zygotes of the program, the child is one
+// of them, and zfiller loads a replacement in the background.
+int
+spawn(char *path, char **argv, struct file **ofile, int cid)
+{
+  int i, pid;
+  struct proc *np;
+  struct proc *parent;
+  struct container *cont = 0;
+
+  if (cid >= 0 && (cont = get_container_by_cid(cid)) == 0) {
+    cprintf("Container with cid %d doesn't exist\n", cid);
+    return -1;
+  }
+  cont = childcont(cont, &parent);
+
+  if((np = zygote(cont, path, argv)) == 0 &&
+     (np = allocexec(cont, path, argv)) == 0)
+    return -1;
+  np->parent = parent;
+
+  for(i = 0; i < NOFILE; i++)
+    np->ofile[i] = ofile[i];
+  np->cwd = idup(cid >= 0 ? cont->rootdir : myproc()->cwd);
+
+  pid = np->pid;
+
+  acquire(&ptable.lock);
+
+  np->state = RUNNABLE;
+
+  release(&ptable.lock);
+
+  return pid;
+}
+
+// Create a thread of the current process that runs fn(arg) on
+// the user stack ending at stack. The thread shares the page table,
+// size and vmas of the process and starts with the caller's open
+// files. Returns the thread's pid.
+int
+clone(uint fn, uint arg, uint stack)
+{
+  int i;
+  uint sp, ustack[2];
+  struct proc *np;
+  struct proc *curproc = myproc();
+
+  ustack[0] = 0xffffffff;  // fake return PC
+  ustack[1] = arg;
+  sp = stack - sizeof(ustack);
+  if(sp > stack || sp % 4 != 0 || touchuvm(sp, sizeof(ustack), 1) < 0 ||
+     copyout(curproc->pgdir, sp, ustack, sizeof(ustack)) < 0)
+    return -1;
+
+  if((np = allocproc(curproc->cont)) == 0)
+    return -1;
+  np->pgdir = curproc->pgdir;
+  np->leader = curproc->leader;
+  np->parent = curproc->leader;
+  np->ustack = stack;
+  *np->tf = *curproc->tf;
+  np->tf->eip = fn;
+  np->tf->esp = sp;
+
+  for(i = 0; i < NOFILE; i++)
+    if(curproc->ofile[i])
+      np->ofile[i] = filedup(curproc->ofile[i]);
+  np->cwd = idup(curproc->cwd);
+
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+
+  acquire(&ptable.lock);
+
+  curproc->leader->nthread++;
+  np->state = RUNNABLE;
+
+  release(&ptable.lock);
+
+  return np->pid;
+}
+
+// Free p, an exited thread. Caller must hold ptable.lock.
+static void
+freethread(struct proc *p)
+{
+  kfree(p->kstack);
+  p->kstack = 0;
+  p->pid = 0;
+  p->parent = 0;
+  p->name[0] = 0;
+  p->killed = 0;
+  p->state = UNUSED;
+}
+
+// Wait for the thread tid of the current process to exit, or for
+// any of its threads if tid is -1, and free it. Sets *stack to the
+// stack the thread was given. Returns the thread's pid, or -1 if
+// there is no such thread.
+int
+join(int tid, uint *stack)
+{
+  struct proc *p;
+  struct proc *curproc = myproc();
+  struct proc *ptab = curproc->cont->ptable;
+  int havethreads, pid;
+
+  acquire(&ptable.lock);
+  for(;;){
+    havethreads = 0;
+    for(p = ptab; p < &ptab[NPROC]; p++){
+      if(p->state == UNUSED || p->leader != curproc->leader ||
+         p == p->leader || p == curproc || (tid != -1 && p->pid != tid))
+        continue;
+      havethreads = 1;
+      if(p->state == ZOMBIE){
+        pid = p->pid;
+        *stack = p->ustack;
+        freethread(p);
+        release(&ptable.lock);
+        return pid;
+      }
+    }
+
+    if(!havethreads || curproc->killed){
+      release(&ptable.lock);
+      return -1;
+    }
+
+    // Exiting threads wake up their leader, their parent.
+    sleep(curproc->leader, &ptable.lock);
+  }
+}
+
+// Kill the other threads of curproc, which is exiting, and
+// wait for them to exit and free them.
+static void
+endthreads(struct proc *curproc)
+{
+  struct proc *p;
+  struct proc *ptab = curproc->cont->ptable;
+  int left;
+
+  acquire(&ptable.lock);
+  for(;;){
+    left = 0;
+    for(p = ptab; p < &ptab[NPROC]; p++){
+      if(p->state == UNUSED || p->leader != curproc || p == curproc)
+        continue;
+      if(p->state == ZOMBIE){
+        freethread(p);
+        continue;
+      }
+      left = 1;
+      p->killed = 1;
+      if(p->state == SLEEPING)
+        p->state = RUNNABLE;
+    }
+    if(!left)
+      break;
+    sleep(curproc, &ptable.lock);
+  }
+  release(&ptable.lock);
+}
+
+// Serialize changes to the page table, size and vmas that the
+// threads of p share: page faults, sbrk, mmap and munmap. Sleeps,
+// so the caller must not hold spinlocks.
+void
+vmlock(struct proc *p)
+{
+  p = p->leader;
+  acquire(&ptable.lock);
+  while(p->vmbusy)
+    sleep(&p->vmbusy, &ptable.lock);
+  p->vmbusy = 1;
+  release(&ptable.lock);
+}
+
+void
+vmunlock(struct proc *p)
+{
+  p = p->leader;
+  acquire(&ptable.lock);
+  p->vmbusy = 0;
+  wakeup1(&p->vmbusy);
+  release(&ptable.lock);
+}
+
+// Record that the current system call uses the user memory
+// from va to va+n, so that no other thread unmaps it until the
+// call returns: the kernel copies to and from user memory
+// directly, and a missing page there is a kernel fault. Waits
+// for a change to the address space to finish first.
+void
+pinuvm(uint va, uint n)
+{
+  struct proc *p = myproc();
+  uint end = va + n;
+  int i;
+
+  if(p->leader->nthread == 1 || n == 0)
+    return;
+  if(end < va)
+    end = KERNBASE;
+  acquire(&ptable.lock);
+  while(p->leader->vmbusy)
+    sleep(&p->leader->vmbusy, &ptable.lock);
+  // Arguments are next to each other on the stack.
+  for(i = 0; i < p->npin; i++){
+    if(va <= p->pin[i][1] && p->pin[i][0] <= end){
+      if(va < p->pin[i][0])
+        p->pin[i][0] = va;
+      if(end > p->pin[i][1])
+        p->pin[i][1] = end;
+      release(&ptable.lock);
+      return;
+    }
+  }
+  if(p->npin < NPIN){
+    p->pin[p->npin][0] = va;
+    p->pin[p->npin][1] = end;
+    p->npin++;
+  } else {
+    // Out of entries: cover this range with the last one.
+    if(va < p->pin[NPIN-1][0])
+      p->pin[NPIN-1][0] = va;
+    if(end > p->pin[NPIN-1][1])
+      p->pin[NPIN-1][1] = end;
+  }
+  release(&ptable.lock);
+}
+
+// Drop the current process's pins, at the end of a system call.
+void
+unpinuvm(void)
+{
+  struct proc *p = myproc();
+
+  if(p->npin == 0)
+    return;
+  acquire(&ptable.lock);
+  p->npin = 0;
+  wakeup1(&p->leader->vmbusy);
+  release(&ptable.lock);
+}
+
+// Is memory between lo and hi pinned by another thread of p?
+// Caller must hold ptable.lock.
+static int
+pinned(struct proc *p, uint lo, uint hi)
+{
+  struct proc *q;
+  struct proc *ptab = p->cont->ptable;
+  int i;
+
+  for(q = ptab; q < &ptab[NPROC]; q++){
+    if(q == p || q->leader != p->leader ||
+       q->state == UNUSED || q->state == ZOMBIE)
+      continue;
+    for(i = 0; i < q->npin; i++)
+      if(q->pin[i][0] < hi && lo < q->pin[i][1])
+        return 1;
+  }
+  return 0;
+}
+
+// Like vmlock, for removing the memory between lo and hi: also
+// wait until no other thread's system call uses it. Drops the
+// caller's own pins, so that two threads unmapping each other's
+// buffers cannot wait for each other.
+void
+vmlockrange(struct proc *p, uint lo, uint hi)
+{
+  struct proc *l = p->leader;
+
+  unpinuvm();
+  acquire(&ptable.lock);
+  while(l->vmbusy || pinned(p, lo, hi))
+    sleep(&l->vmbusy, &ptable.lock);
+  l->vmbusy = 1;
+  release(&ptable.lock);
+}
+
 // Exit the current process.  Does not return.
 // An exited process remains in the zombie state
 // until its parent calls wait() to find out it exited.
@@ -375,6 +869,15 @@ exit(void)
   if(curproc == initproc)
     panic("init exiting");
 
+  // A thread unmapping memory this call's arguments are in
+  // would wait for a return that does not come.
+  unpinuvm();
+
+  // The other threads go first: they use the address space
+  // torn down below.
+  if(curproc->leader == curproc && curproc->nthread > 1)
+    endthreads(curproc);
+
   // Close all open files.
   for(fd = 0; fd < NOFILE; fd++){
     if(curproc->ofile[fd]){
@@ -388,11 +891,22 @@ exit(void)
   end_op();
   curproc->cwd = 0;
 
+  // Write back shared mappings before the files are released.
+  if(curproc->leader == curproc){
+    // As in exec, this can only fail to write a mapping back.
+    if(munmapuvm(curproc->pgdir, curproc->vma, MMAPBASE, KERNBASE) < 0)
+      cprintf("exit: %s: writing back a shared mapping failed\n", curproc->name);
+    vmaput(curproc->vma);
+  }
+
   acquire(&ptable.lock);
 
   ptab = curproc->cont->ptable;
 
-  // Parent might be sleeping in wait().
+  // Parent might be sleeping in wait(), or for a thread,
+  // any thread of the process in join().
+  if(curproc->leader != curproc)
+    curproc->leader->nthread--;
   wakeup1(curproc->parent);
 
   // Pass abandoned children to initproc of the running container.
@@ -434,7 +948,7 @@ wait(void)
       }
       ptab = cont->ptable;
       for(p = ptab; p < &ptab[NPROC]; p++) {
-        if(p->parent != curproc)
+        if(p->parent != curproc || p->leader != p)
           continue;
         havekids = 1;
         if(p->state == ZOMBIE){
@@ -491,11 +1005,13 @@ scheduler(void)
   struct proc *p;
   struct container *cont;
   struct cpu *c = mycpu();
+  int ran;
   c->proc = 0;
 
   for(;;){
     // Enable interrupts on this processor.
     sti();
+    ran = 0;
 
     // Loop over container table looking for process to run.
     acquire(&ptable.lock);
@@ -523,6 +1039,7 @@ scheduler(void)
       switchuvm(p);
       p->state = RUNNING;
       cont->state = CRUNNING;
+      ran = 1;
 
       swtch(&(c->scheduler), p->context);
       switchkvm();
@@ -530,12 +1047,17 @@ scheduler(void)
       // Process is done running for now.
       // It should have changed its p->state before coming back.
       c->proc = 0;
-      if (cont->state != CSTOPPING && cont->state != CPAUSED) {
+      if (cont->state != CSTOPPING && cont->state != CPAUSED &&
+          cont->state != CCHECKPOINT) {
         cont->state = CRUNNABLE;
       }
       
     }
     release(&ptable.lock);
+
+    // Nothing to run: tend to the page allocator.
+    if(!ran)
+      kidle();
   }
 }
 
@@ -591,6 +1113,8 @@ forkret(void)
     first = 0;
     iinit(ROOTDEV);
     initlog(ROOTDEV);
+    swapinit(ROOTDEV);
+    kthread("zfiller", zfiller);
   }
 
   // Return to "caller", actually trapret (see allocproc).
@@ -664,6 +1188,25 @@ wakeup(void *chan)
   release(&ptable.lock);
 }
 
+// Wake up at most n processes sleeping on chan.
+// Returns the number woken.
+int
+wakeupn(void *chan, int n)
+{
+  struct proc *p;
+  int woken = 0;
+
+  acquire(&ptable.lock);
+  for(p = &ptable.proc[0][0]; p < &ptable.proc[0][0] + NCONT*NPROC && woken < n; p++){
+    if(p->state == SLEEPING && p->chan == chan){
+      p->state = RUNNABLE;
+      woken++;
+    }
+  }
+  release(&ptable.lock);
+  return woken;
+}
+
 // Kill process could be called in either within kill() or cstop(), in both
 // cases it should be guarentee the lock has been held.
 int
@@ -698,6 +1241,120 @@ kill(int pid)
   return ret;
 }
 
+// Give p the page table pgdir and return its old one, which
+// the caller frees. Done under ptable.lock so that memstats()
+// never walks a page table as it is freed.
+pde_t*
+setpgdir(struct proc *p, pde_t *pgdir)
+{
+  pde_t *old;
+
+  acquire(&ptable.lock);
+  old = p->pgdir;
+  p->pgdir = pgdir;
+  release(&ptable.lock);
+  return old;
+}
+
+// Fill in the container and process parts of ms, and up to n
+// entries of pm, one per process. Processes being created,
+// zygotes among them, only count for their kernel stacks.
+// Returns the number of entries of pm filled in.
+int
+memstats(struct memstats *ms, struct procmem *pm, int n)
+{
+  struct container *cont;
+  struct contmem *cm;
+  struct proc *p;
+  uint rss, pt;
+  int ii, i;
+
+  pgdirstats(0, &rss, &ms->ptpages);
+  ms->user = 0;
+  ms->kstacks = 0;
+  ms->ncont = 0;
+  i = 0;
+  acquire(&ptable.lock);
+  for (ii = 0; ii < NCONT; ++ii) {
+    cont = &ctable.cont[ii];
+    if (cont->state == CUNUSED)
+      continue;
+    cm = &ms->cont[ms->ncont++];
+    cm->cid = cont->cid;
+    safestrcpy(cm->name, cont->name, sizeof(cm->name));
+    cm->nproc = 0;
+    cm->mem = cont->mem;
+    cm->peakmem = cont->peakmem;
+    cm->memlimit = cont->memlimit;
+    ms->user += cont->mem;
+
+    for (p = cont->ptable; p < &cont->ptable[NPROC]; p++) {
+      if (p->kstack)
+        ms->kstacks++;
+      if (p->state == UNUSED || p->state == EMBRYO)
+        continue;
+      cm->nproc++;
+      rss = pt = 0;
+      if (p->leader == p && p->pgdir) {
+        pgdirstats(p->pgdir, &rss, &pt);
+        ms->ptpages += pt;
+      }
+      if (i < n) {
+        pm[i].pid = p->pid;
+        pm[i].cid = cont->cid;
+        safestrcpy(pm[i].name, p->name, sizeof(pm[i].name));
+        pm[i].rss = rss;
+        pm[i].ptpages = pt;
+        i++;
+      }
+    }
+  }
+  release(&ptable.lock);
+  return i;
+}
+
+// Clock hand for swapvictim: the process slot, counting across
+// all containers, and the user address in it to look at next.
+static struct {
+  int proc;
+  uint va;
+} swaphand;
+
+// Choose a user page that has not been used recently, unmap it
+// leaving swap slot slot in its PTE, and return it (see swapscan).
+// Only processes that are runnable and not in a system call or
+// the page fault handler are considered: a running process may
+// be using the page, the kernel may hold on to user addresses
+// until a system call returns, and a process woken inside the
+// fault handler may be filling in the very page. Returns 0 if no page is found in two sweeps.
+char*
+swapvictim(uint slot)
+{
+  struct proc *p;
+  char *mem;
+  int n;
+
+  acquire(&ptable.lock);
+  for(n = 0; n <= 2*NCONT*NPROC; n++){
+    p = &ptable.proc[0][0] + swaphand.proc;
+    // Another thread might be using the page on another CPU.
+    // A paused container's pages stay put for checkpoint.
+    // A killed process may be in exit(), called from trap()
+    // rather than a system call, tearing its pages down.
+    if(p->state == RUNNABLE && !p->insyscall && !p->infault && !p->killed &&
+       p->nthread == 1 && p->leader == p && p->cont->state != CPAUSED &&
+       p->cont->state != CCHECKPOINT &&
+       (mem = swapscan(p->pgdir, p->sz, &swaphand.va, slot)) != 0){
+      release(&ptable.lock);
+      return mem;
+    }
+    swaphand.proc = (swaphand.proc + 1) % (NCONT*NPROC);
+    swaphand.va = 0;
+  }
+  release(&ptable.lock);
+  return 0;
+}
+
 //PAGEBREAK: 36
 // Print a process listing to console.  For debugging.
 // Runs when user types ^P on console.
@@ -712,7 +1369,8 @@ procdump(void)
   [CRUNNABLE]  "runnable",
   [CRUNNING]   "running ",
   [CPAUSED]    "paused  ",
-  [CSTOPPING]  "stopping" 
+  [CSTOPPING]  "stopping",
+  [CCHECKPOINT] "saving  "
   };
   static char *pstates[] = {
   [UNUSED]    "unused",
@@ -757,7 +1415,8 @@ int cps(void) {
   [CRUNNABLE]  "runnable",
   [CRUNNING]   "running ",
   [CPAUSED]    "paused  ",
-  [CSTOPPING]  "stopping" 
+  [CSTOPPING]  "stopping",
+  [CCHECKPOINT] "saving  "
   };
   static char *pstates[] = {
   [UNUSED]    "unused  ",
@@ -779,6 +1438,13 @@ int cps(void) {
     }
     cprintf("\nContainer %d : %s %s, root path = %s\n", 
       cont->cid, cont->name, cstates[cont->state], cont->rootpath);
+    cprintf("Memory %d KB, peak %d KB, limit ", cont->mem * (PGSIZE / 1024),
+      cont->peakmem * (PGSIZE / 1024));
+    if (cont->memlimit == 0) {
+      cprintf("none\n");
+    } else {
+      cprintf("%d KB\n", cont->memlimit * (PGSIZE / 1024));
+    }
     cprintf("Process \tPID \t Real PID \t Status \t Container\n");
 
     // Fake initproc for every non-root container.
@@ -979,18 +1645,125 @@ cresume(char *cont_name) {
     return -1;
   }
 
-  // Check whether the container's status is CPAUSED.
+  // Check whether the container's status is CPAUSED; it is
+  // CCHECKPOINT while ccheckpoint saves it.
+  acquire(&ctable.lock);
   if (cont->state != CPAUSED) {
+    release(&ctable.lock);
     cprintf("Container %s's state is not CPAUSED\n", cont_name);
     return -1;
   }
-
-  acquire(&ctable.lock);
   cont->state = CRUNNABLE;
   release(&ctable.lock);
   return 0;
 }
 
+// Keep n processes of the container cont_name loaded with the
+// program at path and parked, so that spawn() of that program in
+// the container only has to give one its arguments and files.
+// n of 0 empties the pool. Returns the number of zygotes loaded.
+// Later replacements are loaded by zfiller, which looks a relative
+// path up from the root directory, so path should be absolute.
+int
+czygote(char *cont_name, char *path, int n) {
+  struct container *cont = 0;
+
+  if ((cont = get_container_by_name(cont_name)) == 0) {
+    cprintf("Container %s doesn't exist\n", cont_name);
+    return -1;
+  }
+  if (n < 0 || n > NZYGOTE || strlen(path) >= sizeof(cont->zpath)) {
+    return -1;
+  }
+
+  zdrain(cont);
+  acquire(&ctable.lock);
+  cont->zwant = n;
+  safestrcpy(cont->zpath, path, sizeof(cont->zpath));
+  release(&ctable.lock);
+
+  zfill(cont);
+  return cont->nzygote;
+}
+
+// Save the processes of the paused container cont_name to f.
+// Returns the number of processes saved. See ckpt.c.
+// The container is CCHECKPOINT meanwhile, which keeps cresume
+// and cstop off it until the save is done; checkpoint fails if
+// a restore or spawn adds a process to it.
+int
+ccheckpoint(char *cont_name, struct file *f) {
+  struct container *cont = 0;
+  struct proc *p;
+  int running, n;
+
+  if ((cont = get_container_by_name(cont_name)) == 0) {
+    cprintf("Container %s doesn't exist\n", cont_name);
+    return -1;
+  }
+  acquire(&ctable.lock);
+  if (cont->state != CPAUSED || cont == myproc()->cont) {
+    release(&ctable.lock);
+    cprintf("Container %s's state is not CPAUSED\n", cont_name);
+    return -1;
+  }
+  cont->state = CCHECKPOINT;
+  release(&ctable.lock);
+
+  // A process that was running when the container paused
+  // stops when it next gives up its CPU.
+  for (;;) {
+    running = 0;
+    acquire(&ptable.lock);
+    for (p = cont->ptable; p < &cont->ptable[NPROC]; p++)
+      if (p->state == RUNNING)
+        running = 1;
+    release(&ptable.lock);
+    if (!running)
+      break;
+    yield();
+  }
+  n = checkpoint(cont, f);
+
+  acquire(&ctable.lock);
+  cont->state = CPAUSED;
+  release(&ctable.lock);
+  return n;
+}
+
+// Start the processes saved in f in container cont_name.
+// Returns the number of processes started. See ckpt.c.
+int
+crestore(char *cont_name, struct file *f) {
+  struct container *cont = 0;
+  struct proc *np[NPROC];
+  int i, n;
+
+  if ((cont = get_container_by_name(cont_name)) == 0) {
+    cprintf("Container %s doesn't exist\n", cont_name);
+    return -1;
+  }
+  if (cont->state == CCHECKPOINT) {
+    cprintf("Container %s is being checkpointed\n", cont_name);
+    return -1;
+  }
+  if ((n = restore(cont, f, initproc, np)) < 0) {
+    cprintf("Restore into container %s fails\n", cont_name);
+    return -1;
+  }
+
+  acquire(&ptable.lock);
+  for (i = 0; i < n; i++)
+    np[i]->state = RUNNABLE;
+  release(&ptable.lock);
+
+  acquire(&ctable.lock);
+  if (cont->state == CREADY)
+    cont->state = CRUNNABLE;
+  release(&ctable.lock);
+  return n;
+}
+
 // Set container status to CSTOPPING, scheduler will kill processes inside.
 // There're two cases:
 // (1) There's no processes inside the container, mark it as CUNUSED.
@@ -1006,10 +1779,23 @@ cstop(char *cont_name) {
     return -1;
   }
 
+  if (cont->state == CCHECKPOINT) {
+    cprintf("Container %s is being checkpointed\n", cont_name);
+    return -1;
+  }
+
+  // Zygotes never ran, so they can simply be freed.
+  zdrain(cont);
+
   // Newly created container is bound to have 'sh' and 'init' proc, kill them
   // then exit.
   struct proc *p = 0;
   acquire(&ctable.lock);
+  if (cont->state == CCHECKPOINT) {
+    release(&ctable.lock);
+    cprintf("Container %s is being checkpointed\n", cont_name);
+    return -1;
+  }
   for (int ii = 0; ii < NPROC; ++ii) {
     p = &cont->ptable[ii];
     if (p->state != UNUSED) {
@@ -1023,6 +1809,24 @@ cstop(char *cont_name) {
   return 0;
 }
 
+// Limit the user memory of a container to kb kilobytes; 0 removes the
+// limit. Allocations that would go past the limit fail: sbrk() returns an
+// error, and a page fault that cannot be filled kills the process.
+int
+climit(char *cont_name, int kb) {
+  struct container *cont = 0;
+
+  if ((cont = get_container_by_name(cont_name)) == 0) {
+    cprintf("Container %s doesn't exist\n", cont_name);
+    return -1;
+  }
+  if (kb < 0) {
+    return -1;
+  }
+  ksetlimit(cont, (kb + PGSIZE / 1024 - 1) / (PGSIZE / 1024));
+  return 0;
+}
+
 // Allow the scheduler to schedule the container.
 int
 cstart(char *cont_name) {
@@ -8,6 +8,8 @@ struct cpu {
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
   struct proc *proc;           // The process running on this cpu or null
+  volatile uint tlbreq;        // TLB flushes asked for by tlbshootdown
+  volatile uint tlbdone;       // TLB flushes done; see tlbflushintr
 };
 
 extern struct cpu cpus[NCPU];
@@ -36,6 +38,24 @@ enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
 // Forward declaration.
 struct container;
+struct shm;
+
+// A range of user memory whose pages are filled in by the page
+// fault handler on first touch instead of up front, either from
+// a file through the page cache, from a shared memory segment,
+// or with zeroes.
+struct vma {
+  uint start;                  // First address, page aligned
+  uint end;                    // End address; 0 if slot is unused
+  int flags;                   // VM_ flags below
+  struct inode *ip;            // Backing file, or 0 for zero-fill
+  struct shm *shm;             // Backing shared memory segment, or 0
+  uint off;                    // File offset corresponding to start
+  uint filesz;                 // Bytes at off backed by the file
+};
+
+#define VM_WRITE  0x1          // Mapping may be written
+#define VM_SHARED 0x2          // Pages are shared, writes reach the file
 
 // Per-process state
 struct proc {
@@ -53,6 +73,15 @@ struct proc {
   struct inode *cwd;           // Current directory
   char name[16];               // Process name (debugging)
   struct container *cont;      // Parent container
+  struct vma vma[NVMA];        // Demand-paged memory areas
+  int insyscall;               // In a system call, so pages may be in use
+  int infault;                 // In pagefault, which may sleep; see swapvictim
+  uint pin[NPIN][2];           // User memory the current system call uses; see pinuvm
+  int npin;                    // Entries of pin in use
+  struct proc *leader;         // Thread holding the shared sz and vma; p if p is not a thread
+  int nthread;                 // Leader only: threads, itself included
+  int vmbusy;                  // Leader only: address space being changed; see vmlock
+  uint ustack;                 // Thread only: top of its user stack, for join
 };
 
 // Process memory is laid out contiguously, low addresses first:
@@ -62,7 +91,7 @@ struct proc {
 //   expandable heap
 
 // Per-container state
-enum contstate { CUNUSED, CEMBRYO, CREADY, CRUNNABLE, CRUNNING, CPAUSED, CSTOPPING };
+enum contstate { CUNUSED, CEMBRYO, CREADY, CRUNNABLE, CRUNNING, CPAUSED, CSTOPPING, CCHECKPOINT };
 
 struct container {
   int cid;               // Container ID
@@ -72,4 +101,12 @@ struct container {
   struct proc *ptable;   // Table of processes owned by container
   int nextproc;          // Next process to schedule
   char name[16];         // Container name (debugging)
+  uint mem;              // Pages of user memory charged (see kcharge)
+  uint peakmem;          // Highest value of mem
+  uint memlimit;         // Most pages mem may reach; 0 if no limit
+  char zpath[32];        // Program of the zygote pool (see czygote)
+  int zwant;             // Zygotes to keep loaded; 0 if no pool
+  int nzygote;           // Zygotes loaded, in zygote[]
+  struct proc *zygote[NZYGOTE];
+  int zrefill;           // spawn took a zygote; see zfiller
 };
\ No newline at end of file
@@ -0,0 +1,1690 @@
+
+_ps:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "types.h"
+#include "user.h"
+ 
+int main(int argc, char *argv[]) {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+	if (argc != 1) {
+  11:	83 39 01             	cmpl   $0x1,(%ecx)
+  14:	74 13                	je     29 <main+0x29>
+    printf(1, "Usage: ps\n");
+  16:	50                   	push   %eax
+  17:	50                   	push   %eax
+  18:	68 60 0b 00 00       	push   $0xb60
+  1d:	6a 01                	push   $0x1
+  1f:	e8 4c 04 00 00       	call   470 <printf>
+    exit();
+  24:	e8 9a 02 00 00       	call   2c3 <exit>
+  }
+	cps();
+  29:	e8 35 03 00 00       	call   363 <cps>
+	exit();
+  2e:	e8 90 02 00 00       	call   2c3 <exit>
+  33:	66 90                	xchg   %ax,%ax
+  35:	66 90                	xchg   %ax,%ax
+  37:	66 90                	xchg   %ax,%ax
+  39:	66 90                	xchg   %ax,%ax
+  3b:	66 90                	xchg   %ax,%ax
+  3d:	66 90                	xchg   %ax,%ax
+  3f:	90                   	nop
+
+00000040 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  40:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  41:	31 c0                	xor    %eax,%eax
+{
+  43:	89 e5                	mov    %esp,%ebp
+  45:	53                   	push   %ebx
+  46:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  49:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  50:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  54:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  57:	83 c0 01             	add    $0x1,%eax
+  5a:	84 d2                	test   %dl,%dl
+  5c:	75 f2                	jne    50 <strcpy+0x10>
+    ;
+  return os;
+}
+  5e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  61:	89 c8                	mov    %ecx,%eax
+  63:	c9                   	leave
+  64:	c3                   	ret
+  65:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000070 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  70:	55                   	push   %ebp
+  71:	89 e5                	mov    %esp,%ebp
+  73:	53                   	push   %ebx
+  74:	8b 55 08             	mov    0x8(%ebp),%edx
+  77:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  7a:	0f b6 02             	movzbl (%edx),%eax
+  7d:	84 c0                	test   %al,%al
+  7f:	75 17                	jne    98 <strcmp+0x28>
+  81:	eb 3a                	jmp    bd <strcmp+0x4d>
+  83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  87:	90                   	nop
+  88:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  8c:	83 c2 01             	add    $0x1,%edx
+  8f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  92:	84 c0                	test   %al,%al
+  94:	74 1a                	je     b0 <strcmp+0x40>
+    p++, q++;
+  96:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  98:	0f b6 19             	movzbl (%ecx),%ebx
+  9b:	38 c3                	cmp    %al,%bl
+  9d:	74 e9                	je     88 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  9f:	29 d8                	sub    %ebx,%eax
+}
+  a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  a4:	c9                   	leave
+  a5:	c3                   	ret
+  a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  b4:	31 c0                	xor    %eax,%eax
+  b6:	29 d8                	sub    %ebx,%eax
+}
+  b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  bb:	c9                   	leave
+  bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  bd:	0f b6 19             	movzbl (%ecx),%ebx
+  c0:	31 c0                	xor    %eax,%eax
+  c2:	eb db                	jmp    9f <strcmp+0x2f>
+  c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  cf:	90                   	nop
+
+000000d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  d0:	55                   	push   %ebp
+  d1:	89 e5                	mov    %esp,%ebp
+  d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  d6:	80 3a 00             	cmpb   $0x0,(%edx)
+  d9:	74 15                	je     f0 <strlen+0x20>
+  db:	31 c0                	xor    %eax,%eax
+  dd:	8d 76 00             	lea    0x0(%esi),%esi
+  e0:	83 c0 01             	add    $0x1,%eax
+  e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  e7:	89 c1                	mov    %eax,%ecx
+  e9:	75 f5                	jne    e0 <strlen+0x10>
+    ;
+  return n;
+}
+  eb:	89 c8                	mov    %ecx,%eax
+  ed:	5d                   	pop    %ebp
+  ee:	c3                   	ret
+  ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+  f0:	31 c9                	xor    %ecx,%ecx
+}
+  f2:	5d                   	pop    %ebp
+  f3:	89 c8                	mov    %ecx,%eax
+  f5:	c3                   	ret
+  f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000100 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	57                   	push   %edi
+ 104:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 107:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 10a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 10d:	89 d7                	mov    %edx,%edi
+ 10f:	fc                   	cld
+ 110:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 112:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 115:	89 d0                	mov    %edx,%eax
+ 117:	c9                   	leave
+ 118:	c3                   	ret
+ 119:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000120 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	8b 45 08             	mov    0x8(%ebp),%eax
+ 126:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 12a:	0f b6 10             	movzbl (%eax),%edx
+ 12d:	84 d2                	test   %dl,%dl
+ 12f:	75 12                	jne    143 <strchr+0x23>
+ 131:	eb 1d                	jmp    150 <strchr+0x30>
+ 133:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 137:	90                   	nop
+ 138:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 13c:	83 c0 01             	add    $0x1,%eax
+ 13f:	84 d2                	test   %dl,%dl
+ 141:	74 0d                	je     150 <strchr+0x30>
+    if(*s == c)
+ 143:	38 d1                	cmp    %dl,%cl
+ 145:	75 f1                	jne    138 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 147:	5d                   	pop    %ebp
+ 148:	c3                   	ret
+ 149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 150:	31 c0                	xor    %eax,%eax
+}
+ 152:	5d                   	pop    %ebp
+ 153:	c3                   	ret
+ 154:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 15f:	90                   	nop
+
+00000160 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	57                   	push   %edi
+ 164:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 165:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 168:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 169:	31 db                	xor    %ebx,%ebx
+{
+ 16b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 16e:	eb 27                	jmp    197 <gets+0x37>
+    cc = read(0, &c, 1);
+ 170:	83 ec 04             	sub    $0x4,%esp
+ 173:	6a 01                	push   $0x1
+ 175:	56                   	push   %esi
+ 176:	6a 00                	push   $0x0
+ 178:	e8 5e 01 00 00       	call   2db <read>
+    if(cc < 1)
+ 17d:	83 c4 10             	add    $0x10,%esp
+ 180:	85 c0                	test   %eax,%eax
+ 182:	7e 1d                	jle    1a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 184:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 188:	8b 55 08             	mov    0x8(%ebp),%edx
+ 18b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 18f:	3c 0a                	cmp    $0xa,%al
+ 191:	74 10                	je     1a3 <gets+0x43>
+ 193:	3c 0d                	cmp    $0xd,%al
+ 195:	74 0c                	je     1a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 197:	89 df                	mov    %ebx,%edi
+ 199:	83 c3 01             	add    $0x1,%ebx
+ 19c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 19f:	7c cf                	jl     170 <gets+0x10>
+ 1a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1ad:	5b                   	pop    %ebx
+ 1ae:	5e                   	pop    %esi
+ 1af:	5f                   	pop    %edi
+ 1b0:	5d                   	pop    %ebp
+ 1b1:	c3                   	ret
+ 1b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001c0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	56                   	push   %esi
+ 1c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1c5:	83 ec 08             	sub    $0x8,%esp
+ 1c8:	6a 00                	push   $0x0
+ 1ca:	ff 75 08             	push   0x8(%ebp)
+ 1cd:	e8 31 01 00 00       	call   303 <open>
+  if(fd < 0)
+ 1d2:	83 c4 10             	add    $0x10,%esp
+ 1d5:	85 c0                	test   %eax,%eax
+ 1d7:	78 27                	js     200 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1d9:	83 ec 08             	sub    $0x8,%esp
+ 1dc:	ff 75 0c             	push   0xc(%ebp)
+ 1df:	89 c3                	mov    %eax,%ebx
+ 1e1:	50                   	push   %eax
+ 1e2:	e8 34 01 00 00       	call   31b <fstat>
+  close(fd);
+ 1e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 1ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1ec:	e8 fa 00 00 00       	call   2eb <close>
+  return r;
+ 1f1:	83 c4 10             	add    $0x10,%esp
+}
+ 1f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1f7:	89 f0                	mov    %esi,%eax
+ 1f9:	5b                   	pop    %ebx
+ 1fa:	5e                   	pop    %esi
+ 1fb:	5d                   	pop    %ebp
+ 1fc:	c3                   	ret
+ 1fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 200:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 205:	eb ed                	jmp    1f4 <stat+0x34>
+ 207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20e:	66 90                	xchg   %ax,%ax
+
+00000210 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	53                   	push   %ebx
+ 214:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 217:	0f be 02             	movsbl (%edx),%eax
+ 21a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 21d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 220:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 225:	77 1e                	ja     245 <atoi+0x35>
+ 227:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 230:	83 c2 01             	add    $0x1,%edx
+ 233:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 236:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 23a:	0f be 02             	movsbl (%edx),%eax
+ 23d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 240:	80 fb 09             	cmp    $0x9,%bl
+ 243:	76 eb                	jbe    230 <atoi+0x20>
+  return n;
+}
+ 245:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 248:	89 c8                	mov    %ecx,%eax
+ 24a:	c9                   	leave
+ 24b:	c3                   	ret
+ 24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000250 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	57                   	push   %edi
+ 254:	56                   	push   %esi
+ 255:	8b 45 10             	mov    0x10(%ebp),%eax
+ 258:	8b 55 08             	mov    0x8(%ebp),%edx
+ 25b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 25e:	85 c0                	test   %eax,%eax
+ 260:	7e 13                	jle    275 <memmove+0x25>
+ 262:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 264:	89 d7                	mov    %edx,%edi
+ 266:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 270:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 271:	39 f8                	cmp    %edi,%eax
+ 273:	75 fb                	jne    270 <memmove+0x20>
+  return vdst;
+}
+ 275:	5e                   	pop    %esi
+ 276:	89 d0                	mov    %edx,%eax
+ 278:	5f                   	pop    %edi
+ 279:	5d                   	pop    %ebp
+ 27a:	c3                   	ret
+
+0000027b <ccreate>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(ccreate)
+ 27b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 280:	cd 40                	int    $0x40
+ 282:	c3                   	ret
+
+00000283 <cfork>:
+SYSCALL(cfork)
+ 283:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 288:	cd 40                	int    $0x40
+ 28a:	c3                   	ret
+
+0000028b <cgetrootdir>:
+SYSCALL(cgetrootdir)
+ 28b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 290:	cd 40                	int    $0x40
+ 292:	c3                   	ret
+
+00000293 <getcontrootdir>:
+SYSCALL(getcontrootdir)
+ 293:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 298:	cd 40                	int    $0x40
+ 29a:	c3                   	ret
+
+0000029b <cpause>:
+SYSCALL(cpause)
+ 29b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 2a0:	cd 40                	int    $0x40
+ 2a2:	c3                   	ret
+
+000002a3 <cresume>:
+SYSCALL(cresume)
+ 2a3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 2a8:	cd 40                	int    $0x40
+ 2aa:	c3                   	ret
+
+000002ab <cstart>:
+SYSCALL(cstart)
+ 2ab:	b8 18 00 00 00       	mov    $0x18,%eax
+ 2b0:	cd 40                	int    $0x40
+ 2b2:	c3                   	ret
+
+000002b3 <cstop>:
+SYSCALL(cstop)
+ 2b3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 2b8:	cd 40                	int    $0x40
+ 2ba:	c3                   	ret
+
+000002bb <fork>:
+SYSCALL(fork)
+ 2bb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2c0:	cd 40                	int    $0x40
+ 2c2:	c3                   	ret
+
+000002c3 <exit>:
+SYSCALL(exit)
+ 2c3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2c8:	cd 40                	int    $0x40
+ 2ca:	c3                   	ret
+
+000002cb <wait>:
+SYSCALL(wait)
+ 2cb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2d0:	cd 40                	int    $0x40
+ 2d2:	c3                   	ret
+
+000002d3 <pipe>:
+SYSCALL(pipe)
+ 2d3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2d8:	cd 40                	int    $0x40
+ 2da:	c3                   	ret
+
+000002db <read>:
+SYSCALL(read)
+ 2db:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2e0:	cd 40                	int    $0x40
+ 2e2:	c3                   	ret
+
+000002e3 <write>:
+SYSCALL(write)
+ 2e3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2e8:	cd 40                	int    $0x40
+ 2ea:	c3                   	ret
+
+000002eb <close>:
+SYSCALL(close)
+ 2eb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2f0:	cd 40                	int    $0x40
+ 2f2:	c3                   	ret
+
+000002f3 <kill>:
+SYSCALL(kill)
+ 2f3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2f8:	cd 40                	int    $0x40
+ 2fa:	c3                   	ret
+
+000002fb <exec>:
+SYSCALL(exec)
+ 2fb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <open>:
+SYSCALL(open)
+ 303:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <mknod>:
+SYSCALL(mknod)
+ 30b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <unlink>:
+SYSCALL(unlink)
+ 313:	b8 12 00 00 00       	mov    $0x12,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <fstat>:
+SYSCALL(fstat)
+ 31b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <link>:
+SYSCALL(link)
+ 323:	b8 13 00 00 00       	mov    $0x13,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <mkdir>:
+SYSCALL(mkdir)
+ 32b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <chdir>:
+SYSCALL(chdir)
+ 333:	b8 09 00 00 00       	mov    $0x9,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <dup>:
+SYSCALL(dup)
+ 33b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <getpid>:
+SYSCALL(getpid)
+ 343:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <sbrk>:
+SYSCALL(sbrk)
+ 34b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <sleep>:
+SYSCALL(sleep)
+ 353:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <uptime>:
+SYSCALL(uptime)
+ 35b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <cps>:
+SYSCALL(cps)
+ 363:	b8 16 00 00 00       	mov    $0x16,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <mmap>:
+SYSCALL(mmap)
+ 36b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <munmap>:
+SYSCALL(munmap)
+ 373:	b8 20 00 00 00       	mov    $0x20,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <shmget>:
+SYSCALL(shmget)
+ 37b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <climit>:
+SYSCALL(climit)
+ 383:	b8 22 00 00 00       	mov    $0x22,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <spawn>:
+SYSCALL(spawn)
+ 38b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <clone>:
+SYSCALL(clone)
+ 393:	b8 24 00 00 00       	mov    $0x24,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <join>:
+SYSCALL(join)
+ 39b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <futex>:
+SYSCALL(futex)
+ 3a3:	b8 26 00 00 00       	mov    $0x26,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <ccheckpoint>:
+SYSCALL(ccheckpoint)
+ 3ab:	b8 27 00 00 00       	mov    $0x27,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <crestore>:
+SYSCALL(crestore)
+ 3b3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <czygote>:
+SYSCALL(czygote)
+ 3bb:	b8 29 00 00 00       	mov    $0x29,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <memstats>:
+SYSCALL(memstats)
+ 3c3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+ 3cb:	66 90                	xchg   %ax,%ax
+ 3cd:	66 90                	xchg   %ax,%ax
+ 3cf:	90                   	nop
+
+000003d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	57                   	push   %edi
+ 3d4:	56                   	push   %esi
+ 3d5:	53                   	push   %ebx
+ 3d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 3d8:	89 d1                	mov    %edx,%ecx
+{
+ 3da:	83 ec 3c             	sub    $0x3c,%esp
+ 3dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 3e0:	85 d2                	test   %edx,%edx
+ 3e2:	0f 89 80 00 00 00    	jns    468 <printint+0x98>
+ 3e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 3ec:	74 7a                	je     468 <printint+0x98>
+    x = -xx;
+ 3ee:	f7 d9                	neg    %ecx
+    neg = 1;
+ 3f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 3f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 3f8:	31 f6                	xor    %esi,%esi
+ 3fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 400:	89 c8                	mov    %ecx,%eax
+ 402:	31 d2                	xor    %edx,%edx
+ 404:	89 f7                	mov    %esi,%edi
+ 406:	f7 f3                	div    %ebx
+ 408:	8d 76 01             	lea    0x1(%esi),%esi
+ 40b:	0f b6 92 cc 0b 00 00 	movzbl 0xbcc(%edx),%edx
+ 412:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 416:	89 ca                	mov    %ecx,%edx
+ 418:	89 c1                	mov    %eax,%ecx
+ 41a:	39 da                	cmp    %ebx,%edx
+ 41c:	73 e2                	jae    400 <printint+0x30>
+  if(neg)
+ 41e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 421:	85 c0                	test   %eax,%eax
+ 423:	74 07                	je     42c <printint+0x5c>
+    buf[i++] = '-';
+ 425:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 42a:	89 f7                	mov    %esi,%edi
+ 42c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 42f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 432:	01 df                	add    %ebx,%edi
+ 434:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 438:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 43b:	83 ec 04             	sub    $0x4,%esp
+ 43e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 441:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 444:	6a 01                	push   $0x1
+ 446:	50                   	push   %eax
+ 447:	56                   	push   %esi
+ 448:	e8 96 fe ff ff       	call   2e3 <write>
+  while(--i >= 0)
+ 44d:	89 f8                	mov    %edi,%eax
+ 44f:	83 c4 10             	add    $0x10,%esp
+ 452:	83 ef 01             	sub    $0x1,%edi
+ 455:	39 d8                	cmp    %ebx,%eax
+ 457:	75 df                	jne    438 <printint+0x68>
+}
+ 459:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 45c:	5b                   	pop    %ebx
+ 45d:	5e                   	pop    %esi
+ 45e:	5f                   	pop    %edi
+ 45f:	5d                   	pop    %ebp
+ 460:	c3                   	ret
+ 461:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 468:	31 c0                	xor    %eax,%eax
+ 46a:	eb 89                	jmp    3f5 <printint+0x25>
+ 46c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000470 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	57                   	push   %edi
+ 474:	56                   	push   %esi
+ 475:	53                   	push   %ebx
+ 476:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 479:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 47c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 47f:	0f b6 1e             	movzbl (%esi),%ebx
+ 482:	83 c6 01             	add    $0x1,%esi
+ 485:	84 db                	test   %bl,%bl
+ 487:	74 67                	je     4f0 <printf+0x80>
+ 489:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 48c:	31 d2                	xor    %edx,%edx
+ 48e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 491:	eb 34                	jmp    4c7 <printf+0x57>
+ 493:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 497:	90                   	nop
+ 498:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 49b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 4a0:	83 f8 25             	cmp    $0x25,%eax
+ 4a3:	74 18                	je     4bd <printf+0x4d>
+  write(fd, &c, 1);
+ 4a5:	83 ec 04             	sub    $0x4,%esp
+ 4a8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 4ab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 4ae:	6a 01                	push   $0x1
+ 4b0:	50                   	push   %eax
+ 4b1:	57                   	push   %edi
+ 4b2:	e8 2c fe ff ff       	call   2e3 <write>
+ 4b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 4ba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 4bd:	0f b6 1e             	movzbl (%esi),%ebx
+ 4c0:	83 c6 01             	add    $0x1,%esi
+ 4c3:	84 db                	test   %bl,%bl
+ 4c5:	74 29                	je     4f0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 4c7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 4ca:	85 d2                	test   %edx,%edx
+ 4cc:	74 ca                	je     498 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 4ce:	83 fa 25             	cmp    $0x25,%edx
+ 4d1:	75 ea                	jne    4bd <printf+0x4d>
+      if(c == 'd'){
+ 4d3:	83 f8 25             	cmp    $0x25,%eax
+ 4d6:	0f 84 24 01 00 00    	je     600 <printf+0x190>
+ 4dc:	83 e8 63             	sub    $0x63,%eax
+ 4df:	83 f8 15             	cmp    $0x15,%eax
+ 4e2:	77 1c                	ja     500 <printf+0x90>
+ 4e4:	ff 24 85 74 0b 00 00 	jmp    *0xb74(,%eax,4)
+ 4eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4ef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 4f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4f3:	5b                   	pop    %ebx
+ 4f4:	5e                   	pop    %esi
+ 4f5:	5f                   	pop    %edi
+ 4f6:	5d                   	pop    %ebp
+ 4f7:	c3                   	ret
+ 4f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ff:	90                   	nop
+  write(fd, &c, 1);
+ 500:	83 ec 04             	sub    $0x4,%esp
+ 503:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 506:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 50a:	6a 01                	push   $0x1
+ 50c:	52                   	push   %edx
+ 50d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 510:	57                   	push   %edi
+ 511:	e8 cd fd ff ff       	call   2e3 <write>
+ 516:	83 c4 0c             	add    $0xc,%esp
+ 519:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 51c:	6a 01                	push   $0x1
+ 51e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 521:	52                   	push   %edx
+ 522:	57                   	push   %edi
+ 523:	e8 bb fd ff ff       	call   2e3 <write>
+        putc(fd, c);
+ 528:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 52b:	31 d2                	xor    %edx,%edx
+ 52d:	eb 8e                	jmp    4bd <printf+0x4d>
+ 52f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 530:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 533:	83 ec 0c             	sub    $0xc,%esp
+ 536:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 53b:	8b 13                	mov    (%ebx),%edx
+ 53d:	6a 00                	push   $0x0
+ 53f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 541:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 544:	e8 87 fe ff ff       	call   3d0 <printint>
+        ap++;
+ 549:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 54c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 54f:	31 d2                	xor    %edx,%edx
+ 551:	e9 67 ff ff ff       	jmp    4bd <printf+0x4d>
+ 556:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 560:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 563:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 565:	83 c0 04             	add    $0x4,%eax
+ 568:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 56b:	85 db                	test   %ebx,%ebx
+ 56d:	0f 84 9d 00 00 00    	je     610 <printf+0x1a0>
+        while(*s != 0){
+ 573:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 576:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 578:	84 c0                	test   %al,%al
+ 57a:	0f 84 3d ff ff ff    	je     4bd <printf+0x4d>
+ 580:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 583:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 586:	89 de                	mov    %ebx,%esi
+ 588:	89 d3                	mov    %edx,%ebx
+ 58a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 590:	83 ec 04             	sub    $0x4,%esp
+ 593:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 596:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 599:	6a 01                	push   $0x1
+ 59b:	53                   	push   %ebx
+ 59c:	57                   	push   %edi
+ 59d:	e8 41 fd ff ff       	call   2e3 <write>
+        while(*s != 0){
+ 5a2:	0f b6 06             	movzbl (%esi),%eax
+ 5a5:	83 c4 10             	add    $0x10,%esp
+ 5a8:	84 c0                	test   %al,%al
+ 5aa:	75 e4                	jne    590 <printf+0x120>
+      state = 0;
+ 5ac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 5af:	31 d2                	xor    %edx,%edx
+ 5b1:	e9 07 ff ff ff       	jmp    4bd <printf+0x4d>
+ 5b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5bd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 5c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5c3:	83 ec 0c             	sub    $0xc,%esp
+ 5c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5cb:	8b 13                	mov    (%ebx),%edx
+ 5cd:	6a 01                	push   $0x1
+ 5cf:	e9 6b ff ff ff       	jmp    53f <printf+0xcf>
+ 5d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 5d8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 5db:	83 ec 04             	sub    $0x4,%esp
+ 5de:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 5e1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 5e3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 5e6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5e9:	6a 01                	push   $0x1
+ 5eb:	52                   	push   %edx
+ 5ec:	57                   	push   %edi
+ 5ed:	e8 f1 fc ff ff       	call   2e3 <write>
+        ap++;
+ 5f2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 5f5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5f8:	31 d2                	xor    %edx,%edx
+ 5fa:	e9 be fe ff ff       	jmp    4bd <printf+0x4d>
+ 5ff:	90                   	nop
+  write(fd, &c, 1);
+ 600:	83 ec 04             	sub    $0x4,%esp
+ 603:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 606:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 609:	6a 01                	push   $0x1
+ 60b:	e9 11 ff ff ff       	jmp    521 <printf+0xb1>
+ 610:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 615:	bb 6b 0b 00 00       	mov    $0xb6b,%ebx
+ 61a:	e9 61 ff ff ff       	jmp    580 <printf+0x110>
+ 61f:	90                   	nop
+
+00000620 <runfree>:
+
+// Give the n pages at r back to the free runs, merging them with
+// adjacent runs, and shrink the heap if the end of it is free.
+static void
+runfree(struct page *r, uint n)
+{
+ 620:	55                   	push   %ebp
+  struct page **pp, *prev;
+
+  r->kind = PFREE;
+ 621:	b9 03 00 00 00       	mov    $0x3,%ecx
+{
+ 626:	89 e5                	mov    %esp,%ebp
+ 628:	57                   	push   %edi
+ 629:	56                   	push   %esi
+ 62a:	53                   	push   %ebx
+ 62b:	89 c3                	mov    %eax,%ebx
+ 62d:	83 ec 0c             	sub    $0xc,%esp
+  r->kind = PFREE;
+ 630:	66 89 08             	mov    %cx,(%eax)
+  r->npages = n;
+  prev = 0;
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 633:	8b 0d dc 0e 00 00    	mov    0xedc,%ecx
+  r->npages = n;
+ 639:	89 50 04             	mov    %edx,0x4(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 63c:	85 c9                	test   %ecx,%ecx
+ 63e:	0f 84 1f 01 00 00    	je     763 <runfree+0x143>
+ 644:	39 c1                	cmp    %eax,%ecx
+ 646:	0f 83 f7 00 00 00    	jae    743 <runfree+0x123>
+ 64c:	89 c8                	mov    %ecx,%eax
+ 64e:	eb 04                	jmp    654 <runfree+0x34>
+ 650:	39 d8                	cmp    %ebx,%eax
+ 652:	73 09                	jae    65d <runfree+0x3d>
+ 654:	89 c2                	mov    %eax,%edx
+ 656:	8b 40 14             	mov    0x14(%eax),%eax
+ 659:	85 c0                	test   %eax,%eax
+ 65b:	75 f3                	jne    650 <runfree+0x30>
+    prev = *pp;
+  r->next = *pp;
+ 65d:	89 43 14             	mov    %eax,0x14(%ebx)
+  *pp = r;
+ 660:	89 5a 14             	mov    %ebx,0x14(%edx)
+
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 663:	8b 43 14             	mov    0x14(%ebx),%eax
+ 666:	85 c0                	test   %eax,%eax
+ 668:	74 12                	je     67c <runfree+0x5c>
+ 66a:	8b 7b 04             	mov    0x4(%ebx),%edi
+ 66d:	89 fe                	mov    %edi,%esi
+ 66f:	c1 e6 0c             	shl    $0xc,%esi
+ 672:	01 de                	add    %ebx,%esi
+ 674:	39 f0                	cmp    %esi,%eax
+ 676:	0f 84 a4 00 00 00    	je     720 <runfree+0x100>
+    r->npages += r->next->npages;
+    r->next = r->next->next;
+  }
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 67c:	8b 72 04             	mov    0x4(%edx),%esi
+ 67f:	89 f0                	mov    %esi,%eax
+ 681:	c1 e0 0c             	shl    $0xc,%eax
+ 684:	01 d0                	add    %edx,%eax
+ 686:	39 c3                	cmp    %eax,%ebx
+ 688:	74 16                	je     6a0 <runfree+0x80>
+    pp = &runs;
+    while(*pp != r)
+      pp = &(*pp)->next;
+  }
+
+  if(r->next == 0 && r->npages >= TRIM &&
+ 68a:	8b 43 14             	mov    0x14(%ebx),%eax
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 68d:	8d 72 14             	lea    0x14(%edx),%esi
+  if(r->next == 0 && r->npages >= TRIM &&
+ 690:	85 c0                	test   %eax,%eax
+ 692:	74 3c                	je     6d0 <runfree+0xb0>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+    *pp = 0;
+    sbrk(-(int)(r->npages*PGSIZE));
+    heapend = (char*)r;
+  }
+}
+ 694:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 697:	5b                   	pop    %ebx
+ 698:	5e                   	pop    %esi
+ 699:	5f                   	pop    %edi
+ 69a:	5d                   	pop    %ebp
+ 69b:	c3                   	ret
+ 69c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    prev->npages += r->npages;
+ 6a0:	03 73 04             	add    0x4(%ebx),%esi
+ 6a3:	89 72 04             	mov    %esi,0x4(%edx)
+    prev->next = r->next;
+ 6a6:	8b 43 14             	mov    0x14(%ebx),%eax
+ 6a9:	89 42 14             	mov    %eax,0x14(%edx)
+    while(*pp != r)
+ 6ac:	39 d1                	cmp    %edx,%ecx
+ 6ae:	0f 84 c5 00 00 00    	je     779 <runfree+0x159>
+ 6b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      pp = &(*pp)->next;
+ 6b8:	89 cb                	mov    %ecx,%ebx
+ 6ba:	8b 49 14             	mov    0x14(%ecx),%ecx
+    while(*pp != r)
+ 6bd:	39 d1                	cmp    %edx,%ecx
+ 6bf:	75 f7                	jne    6b8 <runfree+0x98>
+      pp = &(*pp)->next;
+ 6c1:	8d 73 14             	lea    0x14(%ebx),%esi
+ 6c4:	89 cb                	mov    %ecx,%ebx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 6c6:	85 c0                	test   %eax,%eax
+ 6c8:	75 ca                	jne    694 <runfree+0x74>
+ 6ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 6d0:	8b 53 04             	mov    0x4(%ebx),%edx
+ 6d3:	83 fa 1f             	cmp    $0x1f,%edx
+ 6d6:	76 bc                	jbe    694 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 6d8:	c1 e2 0c             	shl    $0xc,%edx
+ 6db:	01 da                	add    %ebx,%edx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 6dd:	39 15 d8 0e 00 00    	cmp    %edx,0xed8
+ 6e3:	75 af                	jne    694 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 6e5:	83 ec 0c             	sub    $0xc,%esp
+ 6e8:	6a 00                	push   $0x0
+ 6ea:	e8 5c fc ff ff       	call   34b <sbrk>
+ 6ef:	83 c4 10             	add    $0x10,%esp
+ 6f2:	39 05 d8 0e 00 00    	cmp    %eax,0xed8
+ 6f8:	75 9a                	jne    694 <runfree+0x74>
+    *pp = 0;
+ 6fa:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    sbrk(-(int)(r->npages*PGSIZE));
+ 700:	8b 43 04             	mov    0x4(%ebx),%eax
+ 703:	83 ec 0c             	sub    $0xc,%esp
+ 706:	c1 e0 0c             	shl    $0xc,%eax
+ 709:	f7 d8                	neg    %eax
+ 70b:	50                   	push   %eax
+ 70c:	e8 3a fc ff ff       	call   34b <sbrk>
+    heapend = (char*)r;
+ 711:	89 1d d8 0e 00 00    	mov    %ebx,0xed8
+ 717:	83 c4 10             	add    $0x10,%esp
+}
+ 71a:	e9 75 ff ff ff       	jmp    694 <runfree+0x74>
+ 71f:	90                   	nop
+    r->npages += r->next->npages;
+ 720:	03 78 04             	add    0x4(%eax),%edi
+ 723:	89 7b 04             	mov    %edi,0x4(%ebx)
+    r->next = r->next->next;
+ 726:	8b 40 14             	mov    0x14(%eax),%eax
+ 729:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 72c:	8b 72 04             	mov    0x4(%edx),%esi
+ 72f:	89 f0                	mov    %esi,%eax
+ 731:	c1 e0 0c             	shl    $0xc,%eax
+ 734:	01 d0                	add    %edx,%eax
+ 736:	39 c3                	cmp    %eax,%ebx
+ 738:	0f 85 4c ff ff ff    	jne    68a <runfree+0x6a>
+ 73e:	e9 5d ff ff ff       	jmp    6a0 <runfree+0x80>
+  r->next = *pp;
+ 743:	89 48 14             	mov    %ecx,0x14(%eax)
+  *pp = r;
+ 746:	a3 dc 0e 00 00       	mov    %eax,0xedc
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 74b:	89 d0                	mov    %edx,%eax
+ 74d:	c1 e0 0c             	shl    $0xc,%eax
+ 750:	01 d8                	add    %ebx,%eax
+ 752:	39 c1                	cmp    %eax,%ecx
+ 754:	74 2f                	je     785 <runfree+0x165>
+  if(r->next == 0 && r->npages >= TRIM &&
+ 756:	8b 43 14             	mov    0x14(%ebx),%eax
+ 759:	be dc 0e 00 00       	mov    $0xedc,%esi
+ 75e:	e9 2d ff ff ff       	jmp    690 <runfree+0x70>
+  r->next = *pp;
+ 763:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 76a:	be dc 0e 00 00       	mov    $0xedc,%esi
+  *pp = r;
+ 76f:	a3 dc 0e 00 00       	mov    %eax,0xedc
+  if(r->next == 0 && r->npages >= TRIM &&
+ 774:	e9 5a ff ff ff       	jmp    6d3 <runfree+0xb3>
+    while(*pp != r)
+ 779:	89 cb                	mov    %ecx,%ebx
+    pp = &runs;
+ 77b:	be dc 0e 00 00       	mov    $0xedc,%esi
+ 780:	e9 0b ff ff ff       	jmp    690 <runfree+0x70>
+    r->npages += r->next->npages;
+ 785:	03 51 04             	add    0x4(%ecx),%edx
+ 788:	89 53 04             	mov    %edx,0x4(%ebx)
+    r->next = r->next->next;
+ 78b:	8b 41 14             	mov    0x14(%ecx),%eax
+ 78e:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 791:	eb c3                	jmp    756 <runfree+0x136>
+ 793:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 79a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000007a0 <runalloc>:
+
+// Take a run of n pages from the start of the first free run
+// long enough, which keeps the end of the heap free to trim.
+static struct page*
+runalloc(uint n)
+{
+ 7a0:	55                   	push   %ebp
+ 7a1:	89 e5                	mov    %esp,%ebp
+ 7a3:	57                   	push   %edi
+ 7a4:	56                   	push   %esi
+ 7a5:	89 c6                	mov    %eax,%esi
+ 7a7:	53                   	push   %ebx
+ 7a8:	83 ec 1c             	sub    $0x1c,%esp
+  struct page **pp, *r, *rest;
+
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ 7ab:	8b 1d dc 0e 00 00    	mov    0xedc,%ebx
+ 7b1:	85 db                	test   %ebx,%ebx
+ 7b3:	74 4d                	je     802 <runalloc+0x62>
+ 7b5:	b9 dc 0e 00 00       	mov    $0xedc,%ecx
+    if(r->npages < n)
+ 7ba:	39 73 04             	cmp    %esi,0x4(%ebx)
+ 7bd:	72 39                	jb     7f8 <runalloc+0x58>
+      continue;
+    if(r->npages == n){
+ 7bf:	0f 84 9b 00 00 00    	je     860 <runalloc+0xc0>
+      *pp = r->next;
+    } else {
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ 7c5:	89 f0                	mov    %esi,%eax
+      rest->kind = PFREE;
+ 7c7:	ba 03 00 00 00       	mov    $0x3,%edx
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ 7cc:	c1 e0 0c             	shl    $0xc,%eax
+ 7cf:	01 d8                	add    %ebx,%eax
+      rest->kind = PFREE;
+ 7d1:	66 89 10             	mov    %dx,(%eax)
+      rest->npages = r->npages - n;
+ 7d4:	8b 53 04             	mov    0x4(%ebx),%edx
+ 7d7:	29 f2                	sub    %esi,%edx
+ 7d9:	89 50 04             	mov    %edx,0x4(%eax)
+      rest->next = r->next;
+ 7dc:	8b 53 14             	mov    0x14(%ebx),%edx
+ 7df:	89 50 14             	mov    %edx,0x14(%eax)
+      *pp = rest;
+ 7e2:	89 01                	mov    %eax,(%ecx)
+      r->npages = n;
+ 7e4:	89 73 04             	mov    %esi,0x4(%ebx)
+    }
+    return r;
+  }
+  return morecore(n);
+}
+ 7e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7ea:	89 d8                	mov    %ebx,%eax
+ 7ec:	5b                   	pop    %ebx
+ 7ed:	5e                   	pop    %esi
+ 7ee:	5f                   	pop    %edi
+ 7ef:	5d                   	pop    %ebp
+ 7f0:	c3                   	ret
+ 7f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ 7f8:	8d 4b 14             	lea    0x14(%ebx),%ecx
+ 7fb:	8b 5b 14             	mov    0x14(%ebx),%ebx
+ 7fe:	85 db                	test   %ebx,%ebx
+ 800:	75 b8                	jne    7ba <runalloc+0x1a>
+  m = n < MINCORE ? MINCORE : n;
+ 802:	bf 08 00 00 00       	mov    $0x8,%edi
+ 807:	39 fe                	cmp    %edi,%esi
+ 809:	0f 43 fe             	cmovae %esi,%edi
+  brk = sbrk(0);
+ 80c:	83 ec 0c             	sub    $0xc,%esp
+ 80f:	6a 00                	push   $0x0
+ 811:	e8 35 fb ff ff       	call   34b <sbrk>
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 816:	89 fa                	mov    %edi,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 818:	89 c3                	mov    %eax,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 81a:	c1 e2 0c             	shl    $0xc,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 81d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 820:	f7 db                	neg    %ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 822:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 825:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 82b:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+ 82e:	89 04 24             	mov    %eax,(%esp)
+ 831:	e8 15 fb ff ff       	call   34b <sbrk>
+ 836:	83 c4 10             	add    $0x10,%esp
+ 839:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 83c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 83f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 842:	74 3e                	je     882 <runalloc+0xe2>
+  r = (struct page*)(brk + pad);
+ 844:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ 846:	01 da                	add    %ebx,%edx
+ 848:	89 15 d8 0e 00 00    	mov    %edx,0xed8
+  if(m > n)
+ 84e:	39 fe                	cmp    %edi,%esi
+ 850:	72 1e                	jb     870 <runalloc+0xd0>
+  r->npages = n;
+ 852:	89 73 04             	mov    %esi,0x4(%ebx)
+  return r;
+ 855:	eb 90                	jmp    7e7 <runalloc+0x47>
+ 857:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 85e:	66 90                	xchg   %ax,%ax
+      *pp = r->next;
+ 860:	8b 43 14             	mov    0x14(%ebx),%eax
+ 863:	89 01                	mov    %eax,(%ecx)
+}
+ 865:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 868:	89 d8                	mov    %ebx,%eax
+ 86a:	5b                   	pop    %ebx
+ 86b:	5e                   	pop    %esi
+ 86c:	5f                   	pop    %edi
+ 86d:	5d                   	pop    %ebp
+ 86e:	c3                   	ret
+ 86f:	90                   	nop
+    runfree((struct page*)((char*)r + n*PGSIZE), m - n);
+ 870:	89 f0                	mov    %esi,%eax
+ 872:	29 f7                	sub    %esi,%edi
+ 874:	c1 e0 0c             	shl    $0xc,%eax
+ 877:	89 fa                	mov    %edi,%edx
+ 879:	01 d8                	add    %ebx,%eax
+ 87b:	e8 a0 fd ff ff       	call   620 <runfree>
+ 880:	eb d0                	jmp    852 <runalloc+0xb2>
+    if(sbrk(pad + m*PGSIZE) == (char*)-1)
+ 882:	89 f7                	mov    %esi,%edi
+ 884:	83 ec 0c             	sub    $0xc,%esp
+ 887:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 88a:	c1 e7 0c             	shl    $0xc,%edi
+ 88d:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+ 890:	50                   	push   %eax
+ 891:	e8 b5 fa ff ff       	call   34b <sbrk>
+ 896:	83 c4 10             	add    $0x10,%esp
+ 899:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 89c:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 89f:	74 0c                	je     8ad <runalloc+0x10d>
+  r = (struct page*)(brk + pad);
+ 8a1:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ 8a3:	01 df                	add    %ebx,%edi
+ 8a5:	89 3d d8 0e 00 00    	mov    %edi,0xed8
+  if(m > n)
+ 8ab:	eb a5                	jmp    852 <runalloc+0xb2>
+      return 0;
+ 8ad:	31 db                	xor    %ebx,%ebx
+ 8af:	e9 33 ff ff ff       	jmp    7e7 <runalloc+0x47>
+ 8b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8bf:	90                   	nop
+
+000008c0 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+ 8c0:	55                   	push   %ebp
+ 8c1:	89 e5                	mov    %esp,%ebp
+ 8c3:	56                   	push   %esi
+ 8c4:	53                   	push   %ebx
+ 8c5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  struct page *p;
+
+  if(ap == 0)
+ 8c8:	85 c9                	test   %ecx,%ecx
+ 8ca:	74 1c                	je     8e8 <free+0x28>
+    return;
+  p = (struct page*)((uint)ap & ~(PGSIZE-1));
+ 8cc:	89 c8                	mov    %ecx,%eax
+ 8ce:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  switch(p->kind){
+ 8d3:	0f b7 10             	movzwl (%eax),%edx
+ 8d6:	66 83 fa 02          	cmp    $0x2,%dx
+ 8da:	74 14                	je     8f0 <free+0x30>
+ 8dc:	66 83 fa 04          	cmp    $0x4,%dx
+ 8e0:	74 66                	je     948 <free+0x88>
+ 8e2:	66 83 fa 01          	cmp    $0x1,%dx
+ 8e6:	74 18                	je     900 <free+0x40>
+    break;
+  case PMAP:
+    munmap(p, p->npages*PGSIZE);
+    break;
+  }
+}
+ 8e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 8eb:	5b                   	pop    %ebx
+ 8ec:	5e                   	pop    %esi
+ 8ed:	5d                   	pop    %ebp
+ 8ee:	c3                   	ret
+ 8ef:	90                   	nop
+    runfree(p, p->npages);
+ 8f0:	8b 50 04             	mov    0x4(%eax),%edx
+}
+ 8f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 8f6:	5b                   	pop    %ebx
+ 8f7:	5e                   	pop    %esi
+ 8f8:	5d                   	pop    %ebp
+    runfree(p, p->npages);
+ 8f9:	e9 22 fd ff ff       	jmp    620 <runfree>
+ 8fe:	66 90                	xchg   %ax,%ax
+  b->next = p->free;
+ 900:	8b 50 0c             	mov    0xc(%eax),%edx
+ 903:	89 11                	mov    %edx,(%ecx)
+  if(p->nfree++ == 0)
+ 905:	8b 50 08             	mov    0x8(%eax),%edx
+  p->free = b;
+ 908:	89 48 0c             	mov    %ecx,0xc(%eax)
+  if(p->nfree++ == 0)
+ 90b:	8d 5a 01             	lea    0x1(%edx),%ebx
+ 90e:	89 58 08             	mov    %ebx,0x8(%eax)
+ 911:	85 d2                	test   %edx,%edx
+ 913:	74 53                	je     968 <free+0xa8>
+  if(p->nfree == nblocks(p->class)){
+ 915:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ 919:	8d 4e 04             	lea    0x4(%esi),%ecx
+ 91c:	ba e0 0f 00 00       	mov    $0xfe0,%edx
+ 921:	d3 fa                	sar    %cl,%edx
+  if(p->nfree == nblocks(p->class)){
+ 923:	39 da                	cmp    %ebx,%edx
+ 925:	75 c1                	jne    8e8 <free+0x28>
+  if(p->prev)
+ 927:	8b 48 18             	mov    0x18(%eax),%ecx
+    p->prev->next = p->next;
+ 92a:	8b 50 14             	mov    0x14(%eax),%edx
+  if(p->prev)
+ 92d:	85 c9                	test   %ecx,%ecx
+ 92f:	74 6f                	je     9a0 <free+0xe0>
+    p->prev->next = p->next;
+ 931:	89 51 14             	mov    %edx,0x14(%ecx)
+  if(p->next)
+ 934:	85 d2                	test   %edx,%edx
+ 936:	74 06                	je     93e <free+0x7e>
+    p->next->prev = p->prev;
+ 938:	8b 48 18             	mov    0x18(%eax),%ecx
+ 93b:	89 4a 18             	mov    %ecx,0x18(%edx)
+    runfree(p, 1);
+ 93e:	ba 01 00 00 00       	mov    $0x1,%edx
+ 943:	eb ae                	jmp    8f3 <free+0x33>
+ 945:	8d 76 00             	lea    0x0(%esi),%esi
+    munmap(p, p->npages*PGSIZE);
+ 948:	8b 50 04             	mov    0x4(%eax),%edx
+ 94b:	83 ec 08             	sub    $0x8,%esp
+ 94e:	c1 e2 0c             	shl    $0xc,%edx
+ 951:	52                   	push   %edx
+ 952:	50                   	push   %eax
+ 953:	e8 1b fa ff ff       	call   373 <munmap>
+    break;
+ 958:	83 c4 10             	add    $0x10,%esp
+}
+ 95b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 95e:	5b                   	pop    %ebx
+ 95f:	5e                   	pop    %esi
+ 960:	5d                   	pop    %ebp
+ 961:	c3                   	ret
+ 962:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  p->next = partial[p->class];
+ 968:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  p->prev = 0;
+ 96c:	c7 40 18 00 00 00 00 	movl   $0x0,0x18(%eax)
+  p->next = partial[p->class];
+ 973:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 978:	8b 14 b5 e0 0e 00 00 	mov    0xee0(,%esi,4),%edx
+ 97f:	89 50 14             	mov    %edx,0x14(%eax)
+  if(p->next)
+ 982:	85 d2                	test   %edx,%edx
+ 984:	74 0a                	je     990 <free+0xd0>
+    p->next->prev = p;
+ 986:	89 42 18             	mov    %eax,0x18(%edx)
+  partial[p->class] = p;
+ 989:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  if(p->nfree == nblocks(p->class)){
+ 98d:	8b 58 08             	mov    0x8(%eax),%ebx
+  partial[p->class] = p;
+ 990:	89 04 b5 e0 0e 00 00 	mov    %eax,0xee0(,%esi,4)
+}
+ 997:	eb 80                	jmp    919 <free+0x59>
+ 999:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ 9a0:	89 14 b5 e0 0e 00 00 	mov    %edx,0xee0(,%esi,4)
+ 9a7:	eb 8b                	jmp    934 <free+0x74>
+ 9a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000009b0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 9b0:	55                   	push   %ebp
+ 9b1:	89 e5                	mov    %esp,%ebp
+ 9b3:	56                   	push   %esi
+ 9b4:	53                   	push   %ebx
+ 9b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct page *p;
+  uint n;
+
+  if(nbytes <= MAXSMALL)
+ 9b8:	3d 00 04 00 00       	cmp    $0x400,%eax
+ 9bd:	76 71                	jbe    a30 <malloc+0x80>
+    return smallalloc(sizeclass(nbytes));
+  if(nbytes > 0x7fffffff)
+ 9bf:	85 c0                	test   %eax,%eax
+ 9c1:	0f 88 d9 00 00 00    	js     aa0 <malloc+0xf0>
+    return 0;
+  n = (nbytes + HDRSIZE + PGSIZE-1) / PGSIZE;
+ 9c7:	8d 90 1f 10 00 00    	lea    0x101f(%eax),%edx
+ 9cd:	89 d3                	mov    %edx,%ebx
+ 9cf:	c1 eb 0c             	shr    $0xc,%ebx
+  if(nbytes >= MAPMIN){
+ 9d2:	3d ff ff 00 00       	cmp    $0xffff,%eax
+ 9d7:	77 27                	ja     a00 <malloc+0x50>
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    if(p == MAP_FAILED)
+      return 0;
+    p->kind = PMAP;
+  } else {
+    if((p = runalloc(n)) == 0)
+ 9d9:	89 d8                	mov    %ebx,%eax
+ 9db:	e8 c0 fd ff ff       	call   7a0 <runalloc>
+ 9e0:	85 c0                	test   %eax,%eax
+ 9e2:	0f 84 b8 00 00 00    	je     aa0 <malloc+0xf0>
+      return 0;
+    p->kind = PRUN;
+ 9e8:	ba 02 00 00 00       	mov    $0x2,%edx
+ 9ed:	66 89 10             	mov    %dx,(%eax)
+  }
+  p->npages = n;
+ 9f0:	89 58 04             	mov    %ebx,0x4(%eax)
+  return (char*)p + HDRSIZE;
+ 9f3:	8d 58 20             	lea    0x20(%eax),%ebx
+}
+ 9f6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 9f9:	89 d8                	mov    %ebx,%eax
+ 9fb:	5b                   	pop    %ebx
+ 9fc:	5e                   	pop    %esi
+ 9fd:	5d                   	pop    %ebp
+ 9fe:	c3                   	ret
+ 9ff:	90                   	nop
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+ a00:	83 ec 08             	sub    $0x8,%esp
+ a03:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+ a09:	6a 00                	push   $0x0
+ a0b:	6a ff                	push   $0xffffffff
+ a0d:	6a 22                	push   $0x22
+ a0f:	6a 03                	push   $0x3
+ a11:	52                   	push   %edx
+ a12:	6a 00                	push   $0x0
+ a14:	e8 52 f9 ff ff       	call   36b <mmap>
+    if(p == MAP_FAILED)
+ a19:	83 c4 20             	add    $0x20,%esp
+ a1c:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a1f:	74 7f                	je     aa0 <malloc+0xf0>
+    p->kind = PMAP;
+ a21:	b9 04 00 00 00       	mov    $0x4,%ecx
+ a26:	66 89 08             	mov    %cx,(%eax)
+ a29:	eb c5                	jmp    9f0 <malloc+0x40>
+ a2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a2f:	90                   	nop
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ a30:	83 f8 10             	cmp    $0x10,%eax
+ a33:	0f 86 07 01 00 00    	jbe    b40 <malloc+0x190>
+ a39:	31 db                	xor    %ebx,%ebx
+ a3b:	ba 10 00 00 00       	mov    $0x10,%edx
+ a40:	83 c3 01             	add    $0x1,%ebx
+ a43:	89 d6                	mov    %edx,%esi
+ a45:	89 d9                	mov    %ebx,%ecx
+ a47:	d3 e6                	shl    %cl,%esi
+ a49:	39 c6                	cmp    %eax,%esi
+ a4b:	72 f3                	jb     a40 <malloc+0x90>
+  if((p = partial[c]) == 0){
+ a4d:	8b 14 9d e0 0e 00 00 	mov    0xee0(,%ebx,4),%edx
+ a54:	85 d2                	test   %edx,%edx
+ a56:	74 58                	je     ab0 <malloc+0x100>
+  if((b = p->free) != 0){
+ a58:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ a5b:	8b 4a 08             	mov    0x8(%edx),%ecx
+  if((b = p->free) != 0){
+ a5e:	85 db                	test   %ebx,%ebx
+ a60:	0f 84 aa 00 00 00    	je     b10 <malloc+0x160>
+    p->free = b->next;
+ a66:	8b 03                	mov    (%ebx),%eax
+ a68:	89 42 0c             	mov    %eax,0xc(%edx)
+  if(--p->nfree == 0)
+ a6b:	83 e9 01             	sub    $0x1,%ecx
+ a6e:	89 4a 08             	mov    %ecx,0x8(%edx)
+ a71:	75 83                	jne    9f6 <malloc+0x46>
+  if(p->prev)
+ a73:	8b 4a 18             	mov    0x18(%edx),%ecx
+    p->prev->next = p->next;
+ a76:	8b 42 14             	mov    0x14(%edx),%eax
+  if(p->prev)
+ a79:	85 c9                	test   %ecx,%ecx
+ a7b:	0f 84 cf 00 00 00    	je     b50 <malloc+0x1a0>
+    p->prev->next = p->next;
+ a81:	89 41 14             	mov    %eax,0x14(%ecx)
+  if(p->next)
+ a84:	85 c0                	test   %eax,%eax
+ a86:	0f 84 6a ff ff ff    	je     9f6 <malloc+0x46>
+    p->next->prev = p->prev;
+ a8c:	8b 52 18             	mov    0x18(%edx),%edx
+ a8f:	89 50 18             	mov    %edx,0x18(%eax)
+ a92:	e9 5f ff ff ff       	jmp    9f6 <malloc+0x46>
+ a97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a9e:	66 90                	xchg   %ax,%ax
+}
+ aa0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+ aa3:	31 db                	xor    %ebx,%ebx
+}
+ aa5:	89 d8                	mov    %ebx,%eax
+ aa7:	5b                   	pop    %ebx
+ aa8:	5e                   	pop    %esi
+ aa9:	5d                   	pop    %ebp
+ aaa:	c3                   	ret
+ aab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ aaf:	90                   	nop
+    if((p = runalloc(1)) == 0)
+ ab0:	b8 01 00 00 00       	mov    $0x1,%eax
+ ab5:	e8 e6 fc ff ff       	call   7a0 <runalloc>
+ aba:	89 c2                	mov    %eax,%edx
+ abc:	85 c0                	test   %eax,%eax
+ abe:	74 e0                	je     aa0 <malloc+0xf0>
+    p->kind = PSMALL;
+ ac0:	b8 01 00 00 00       	mov    $0x1,%eax
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ ac5:	8d 4b 04             	lea    0x4(%ebx),%ecx
+    p->class = c;
+ ac8:	66 89 5a 02          	mov    %bx,0x2(%edx)
+ acc:	0f b7 db             	movzwl %bx,%ebx
+    p->kind = PSMALL;
+ acf:	66 89 02             	mov    %ax,(%edx)
+    p->fresh = (char*)p + HDRSIZE;
+ ad2:	8d 42 20             	lea    0x20(%edx),%eax
+ ad5:	89 42 10             	mov    %eax,0x10(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ ad8:	b8 e0 0f 00 00       	mov    $0xfe0,%eax
+ add:	d3 f8                	sar    %cl,%eax
+    p->free = 0;
+ adf:	c7 42 0c 00 00 00 00 	movl   $0x0,0xc(%edx)
+    p->nfree = nblocks(c);
+ ae6:	89 42 08             	mov    %eax,0x8(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ ae9:	89 c1                	mov    %eax,%ecx
+  p->next = partial[p->class];
+ aeb:	8b 04 9d e0 0e 00 00 	mov    0xee0(,%ebx,4),%eax
+  p->prev = 0;
+ af2:	c7 42 18 00 00 00 00 	movl   $0x0,0x18(%edx)
+  p->next = partial[p->class];
+ af9:	89 42 14             	mov    %eax,0x14(%edx)
+  if(p->next)
+ afc:	85 c0                	test   %eax,%eax
+ afe:	75 20                	jne    b20 <malloc+0x170>
+  partial[p->class] = p;
+ b00:	89 14 9d e0 0e 00 00 	mov    %edx,0xee0(,%ebx,4)
+  if((b = p->free) != 0){
+ b07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b0e:	66 90                	xchg   %ax,%ax
+    b = (struct block*)p->fresh;
+ b10:	8b 5a 10             	mov    0x10(%edx),%ebx
+    p->fresh += MINSMALL << c;
+ b13:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+ b16:	89 42 10             	mov    %eax,0x10(%edx)
+ b19:	e9 4d ff ff ff       	jmp    a6b <malloc+0xbb>
+ b1e:	66 90                	xchg   %ax,%ax
+    p->next->prev = p;
+ b20:	89 50 18             	mov    %edx,0x18(%eax)
+  partial[p->class] = p;
+ b23:	0f b7 42 02          	movzwl 0x2(%edx),%eax
+  if((b = p->free) != 0){
+ b27:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ b2a:	8b 4a 08             	mov    0x8(%edx),%ecx
+  partial[p->class] = p;
+ b2d:	89 14 85 e0 0e 00 00 	mov    %edx,0xee0(,%eax,4)
+}
+ b34:	e9 25 ff ff ff       	jmp    a5e <malloc+0xae>
+ b39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ b40:	be 10 00 00 00       	mov    $0x10,%esi
+ b45:	31 db                	xor    %ebx,%ebx
+ b47:	e9 01 ff ff ff       	jmp    a4d <malloc+0x9d>
+ b4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ b50:	0f b7 4a 02          	movzwl 0x2(%edx),%ecx
+ b54:	89 04 8d e0 0e 00 00 	mov    %eax,0xee0(,%ecx,4)
+ b5b:	e9 24 ff ff ff       	jmp    a84 <malloc+0xd4>
@@ -0,0 +1,2265 @@
+
+_pwd:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+    cont_path[fidx] = fpath[idx];
+  }
+  return 0;
+}
+
+int main(int argc, char **argv) {
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+  // Get current working directory.
+  char fpath[MAX_PATH_LEN];
+  memset(fpath, '\0', MAX_PATH_LEN);
+      10:	8d 9d e8 fb ff ff    	lea    -0x418(%ebp),%ebx
+int main(int argc, char **argv) {
+      16:	51                   	push   %ecx
+      17:	81 ec dc 04 00 00    	sub    $0x4dc,%esp
+  memset(fpath, '\0', MAX_PATH_LEN);
+      1d:	68 00 02 00 00       	push   $0x200
+      22:	6a 00                	push   $0x0
+      24:	53                   	push   %ebx
+      25:	e8 e6 05 00 00       	call   610 <memset>
+  if (getcwd(fpath) != 0) {
+      2a:	89 1c 24             	mov    %ebx,(%esp)
+      2d:	e8 be 01 00 00       	call   1f0 <getcwd>
+      32:	83 c4 10             	add    $0x10,%esp
+      35:	85 c0                	test   %eax,%eax
+      37:	74 13                	je     4c <main+0x4c>
+    printf(2, "Getting current working directory error\n");
+      39:	57                   	push   %edi
+      3a:	57                   	push   %edi
+      3b:	68 f8 10 00 00       	push   $0x10f8
+      40:	6a 02                	push   $0x2
+      42:	e8 39 09 00 00       	call   980 <printf>
+    exit();
+      47:	e8 87 07 00 00       	call   7d3 <exit>
+  }
+  printf(1, "Full path is %s\n", fpath);
+      4c:	56                   	push   %esi
+
+  // Get root directory for the CRUNNING container.
+  char cont_rootdir[200];
+  memset(cont_rootdir, '\0', 200);
+      4d:	8d b5 20 fb ff ff    	lea    -0x4e0(%ebp),%esi
+  printf(1, "Full path is %s\n", fpath);
+      53:	53                   	push   %ebx
+      54:	68 76 10 00 00       	push   $0x1076
+      59:	6a 01                	push   $0x1
+      5b:	e8 20 09 00 00       	call   980 <printf>
+  memset(cont_rootdir, '\0', 200);
+      60:	83 c4 0c             	add    $0xc,%esp
+      63:	68 c8 00 00 00       	push   $0xc8
+      68:	6a 00                	push   $0x0
+      6a:	56                   	push   %esi
+      6b:	e8 a0 05 00 00       	call   610 <memset>
+  if (cgetrootdir(cont_rootdir) != 0) {
+      70:	89 34 24             	mov    %esi,(%esp)
+      73:	e8 23 07 00 00       	call   79b <cgetrootdir>
+      78:	83 c4 10             	add    $0x10,%esp
+      7b:	85 c0                	test   %eax,%eax
+      7d:	74 13                	je     92 <main+0x92>
+    printf(2, "Getting root directory of current running container error\n");
+      7f:	53                   	push   %ebx
+      80:	53                   	push   %ebx
+      81:	68 24 11 00 00       	push   $0x1124
+      86:	6a 02                	push   $0x2
+      88:	e8 f3 08 00 00       	call   980 <printf>
+    exit();
+      8d:	e8 41 07 00 00       	call   7d3 <exit>
+  }
+  printf(1, "Current running directory is %s\n", cont_rootdir);
+      92:	51                   	push   %ecx
+
+  // Extract the relative path inside the container.
+  char cont_path[MAX_PATH_LEN];
+  memset(cont_path, '\0', MAX_PATH_LEN);
+      93:	8d bd e8 fd ff ff    	lea    -0x218(%ebp),%edi
+  printf(1, "Current running directory is %s\n", cont_rootdir);
+      99:	56                   	push   %esi
+      9a:	68 60 11 00 00       	push   $0x1160
+      9f:	6a 01                	push   $0x1
+      a1:	e8 da 08 00 00       	call   980 <printf>
+  memset(cont_path, '\0', MAX_PATH_LEN);
+      a6:	83 c4 0c             	add    $0xc,%esp
+      a9:	68 00 02 00 00       	push   $0x200
+      ae:	6a 00                	push   $0x0
+      b0:	57                   	push   %edi
+      b1:	e8 5a 05 00 00       	call   610 <memset>
+  if (extract_cont_path(cont_path, fpath, cont_rootdir) != 0) {
+      b6:	83 c4 0c             	add    $0xc,%esp
+      b9:	56                   	push   %esi
+      ba:	53                   	push   %ebx
+      bb:	57                   	push   %edi
+      bc:	e8 df 03 00 00       	call   4a0 <extract_cont_path>
+      c1:	83 c4 10             	add    $0x10,%esp
+      c4:	85 c0                	test   %eax,%eax
+      c6:	74 13                	je     db <main+0xdb>
+    printf(2, "Extracting relative path inside the container error\n");
+      c8:	52                   	push   %edx
+      c9:	52                   	push   %edx
+      ca:	68 84 11 00 00       	push   $0x1184
+      cf:	6a 02                	push   $0x2
+      d1:	e8 aa 08 00 00       	call   980 <printf>
+    exit();
+      d6:	e8 f8 06 00 00       	call   7d3 <exit>
+  }
+
+  printf(1, "%s\n", cont_path);
+      db:	50                   	push   %eax
+      dc:	57                   	push   %edi
+      dd:	68 83 10 00 00       	push   $0x1083
+      e2:	6a 01                	push   $0x1
+      e4:	e8 97 08 00 00       	call   980 <printf>
+  exit();
+      e9:	e8 e5 06 00 00       	call   7d3 <exit>
+      ee:	66 90                	xchg   %ax,%ax
+
+000000f0 <search_upward>:
+  return 0;
+      f0:	55                   	push   %ebp
+      f1:	89 e5                	mov    %esp,%ebp
+      f3:	57                   	push   %edi
+      f4:	56                   	push   %esi
+      f5:	89 c6                	mov    %eax,%esi
+      f7:	53                   	push   %ebx
+      f8:	89 d3                	mov    %edx,%ebx
+      fa:	83 ec 58             	sub    $0x58,%esp
+      fd:	89 4d b4             	mov    %ecx,-0x4c(%ebp)
+
+     100:	52                   	push   %edx
+     101:	e8 da 04 00 00       	call   5e0 <strlen>
+     106:	5a                   	pop    %edx
+     107:	59                   	pop    %ecx
+     108:	68 70 10 00 00       	push   $0x1070
+     10d:	01 d8                	add    %ebx,%eax
+     10f:	50                   	push   %eax
+     110:	e8 3b 04 00 00       	call   550 <strcpy>
+  // Get current working directory.
+     115:	5f                   	pop    %edi
+     116:	58                   	pop    %eax
+     117:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     11a:	50                   	push   %eax
+     11b:	53                   	push   %ebx
+     11c:	e8 af 05 00 00       	call   6d0 <stat>
+     121:	83 c4 10             	add    $0x10,%esp
+     124:	85 c0                	test   %eax,%eax
+     126:	78 6c                	js     194 <search_upward+0xa4>
+  }
+     128:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+    exit();
+     12b:	39 75 dc             	cmp    %esi,-0x24(%ebp)
+     12e:	74 66                	je     196 <search_upward+0xa6>
+  char cont_rootdir[200];
+     130:	83 ec 08             	sub    $0x8,%esp
+     133:	6a 00                	push   $0x0
+     135:	53                   	push   %ebx
+     136:	e8 d8 06 00 00       	call   813 <open>
+  memset(cont_rootdir, '\0', 200);
+     13b:	83 c4 10             	add    $0x10,%esp
+  char cont_rootdir[200];
+     13e:	89 c7                	mov    %eax,%edi
+  memset(cont_rootdir, '\0', 200);
+     140:	85 c0                	test   %eax,%eax
+     142:	78 50                	js     194 <search_upward+0xa4>
+  if (cgetrootdir(cont_rootdir) != 0) {
+     144:	8b 4d b4             	mov    -0x4c(%ebp),%ecx
+     147:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     14a:	89 da                	mov    %ebx,%edx
+     14c:	e8 9f ff ff ff       	call   f0 <search_upward>
+     151:	89 c2                	mov    %eax,%edx
+    printf(2, "Getting root directory of current running container error\n");
+     153:	85 c0                	test   %eax,%eax
+     155:	74 70                	je     1c7 <search_upward+0xd7>
+  }
+     157:	83 ec 08             	sub    $0x8,%esp
+     15a:	8d 40 01             	lea    0x1(%eax),%eax
+     15d:	8d 5d c4             	lea    -0x3c(%ebp),%ebx
+     160:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+     163:	68 74 10 00 00       	push   $0x1074
+     168:	52                   	push   %edx
+     169:	e8 e2 03 00 00       	call   550 <strcpy>
+  }
+     16e:	83 c4 10             	add    $0x10,%esp
+     171:	eb 0d                	jmp    180 <search_upward+0x90>
+     173:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     177:	90                   	nop
+
+     178:	0f b7 45 c4          	movzwl -0x3c(%ebp),%eax
+     17c:	39 c6                	cmp    %eax,%esi
+     17e:	74 20                	je     1a0 <search_upward+0xb0>
+  }
+     180:	83 ec 04             	sub    $0x4,%esp
+     183:	6a 10                	push   $0x10
+     185:	53                   	push   %ebx
+     186:	57                   	push   %edi
+     187:	e8 5f 06 00 00       	call   7eb <read>
+     18c:	83 c4 10             	add    $0x10,%esp
+     18f:	83 f8 10             	cmp    $0x10,%eax
+     192:	74 e4                	je     178 <search_upward+0x88>
+  char fpath[MAX_PATH_LEN];
+     194:	31 d2                	xor    %edx,%edx
+
+     196:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     199:	89 d0                	mov    %edx,%eax
+     19b:	5b                   	pop    %ebx
+     19c:	5e                   	pop    %esi
+     19d:	5f                   	pop    %edi
+     19e:	5d                   	pop    %ebp
+     19f:	c3                   	ret
+  // Corner case: container root directory and full path are of the same.
+     1a0:	83 ec 0c             	sub    $0xc,%esp
+     1a3:	8d 75 c6             	lea    -0x3a(%ebp),%esi
+     1a6:	56                   	push   %esi
+     1a7:	e8 34 04 00 00       	call   5e0 <strlen>
+  if (fpath[idx] == '\0' && cont_rootdir[idx] == '\0') {
+     1ac:	83 c4 0c             	add    $0xc,%esp
+     1af:	50                   	push   %eax
+  // Corner case: container root directory and full path are of the same.
+     1b0:	89 c3                	mov    %eax,%ebx
+  if (fpath[idx] == '\0' && cont_rootdir[idx] == '\0') {
+     1b2:	56                   	push   %esi
+     1b3:	ff 75 b4             	push   -0x4c(%ebp)
+     1b6:	e8 a5 05 00 00       	call   760 <memmove>
+
+     1bb:	83 c4 10             	add    $0x10,%esp
+     1be:	85 db                	test   %ebx,%ebx
+     1c0:	78 d2                	js     194 <search_upward+0xa4>
+  memset(cont_path, '\0', MAX_PATH_LEN);
+     1c2:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     1c5:	01 da                	add    %ebx,%edx
+    printf(2, "Extracting relative path inside the container error\n");
+     1c7:	83 ec 0c             	sub    $0xc,%esp
+     1ca:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+     1cd:	57                   	push   %edi
+     1ce:	e8 28 06 00 00       	call   7fb <close>
+     1d3:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     1d6:	83 c4 10             	add    $0x10,%esp
+
+     1d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     1dc:	5b                   	pop    %ebx
+     1dd:	5e                   	pop    %esi
+     1de:	89 d0                	mov    %edx,%eax
+     1e0:	5f                   	pop    %edi
+     1e1:	5d                   	pop    %ebp
+     1e2:	c3                   	ret
+     1e3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000001f0 <getcwd>:
+  exit();
+     1f0:	55                   	push   %ebp
+     1f1:	89 e5                	mov    %esp,%ebp
+     1f3:	56                   	push   %esi
+     1f4:	53                   	push   %ebx
+     1f5:	8d 9d f8 fd ff ff    	lea    -0x208(%ebp),%ebx
+  exit();
+     1fb:	81 ec 24 02 00 00    	sub    $0x224,%esp
+     201:	8b 75 08             	mov    0x8(%ebp),%esi
+     204:	68 00 02 00 00       	push   $0x200
+     209:	6a 00                	push   $0x0
+     20b:	53                   	push   %ebx
+     20c:	e8 ff 03 00 00       	call   610 <memset>
+     211:	c6 85 f8 fd ff ff 2e 	movb   $0x2e,-0x208(%ebp)
+     218:	58                   	pop    %eax
+     219:	8d 85 e4 fd ff ff    	lea    -0x21c(%ebp),%eax
+     21f:	5a                   	pop    %edx
+     220:	50                   	push   %eax
+     221:	53                   	push   %ebx
+     222:	e8 a9 04 00 00       	call   6d0 <stat>
+     227:	83 c4 10             	add    $0x10,%esp
+     22a:	85 c0                	test   %eax,%eax
+     22c:	78 2a                	js     258 <getcwd+0x68>
+     22e:	8b 85 ec fd ff ff    	mov    -0x214(%ebp),%eax
+     234:	89 f1                	mov    %esi,%ecx
+     236:	89 da                	mov    %ebx,%edx
+     238:	e8 b3 fe ff ff       	call   f0 <search_upward>
+     23d:	85 c0                	test   %eax,%eax
+     23f:	74 17                	je     258 <getcwd+0x68>
+     241:	80 3e 00             	cmpb   $0x0,(%esi)
+     244:	74 0a                	je     250 <getcwd+0x60>
+     246:	31 c0                	xor    %eax,%eax
+     248:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     24b:	5b                   	pop    %ebx
+     24c:	5e                   	pop    %esi
+     24d:	5d                   	pop    %ebp
+     24e:	c3                   	ret
+     24f:	90                   	nop
+     250:	c6 06 2f             	movb   $0x2f,(%esi)
+     253:	eb f1                	jmp    246 <getcwd+0x56>
+     255:	8d 76 00             	lea    0x0(%esi),%esi
+     258:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     25d:	eb e9                	jmp    248 <getcwd+0x58>
+     25f:	90                   	nop
+
+00000260 <parse_subdirectory>:
+     260:	55                   	push   %ebp
+     261:	89 e5                	mov    %esp,%ebp
+     263:	57                   	push   %edi
+     264:	56                   	push   %esi
+     265:	53                   	push   %ebx
+     266:	83 ec 0c             	sub    $0xc,%esp
+     269:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     26c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     26f:	0f b6 13             	movzbl (%ebx),%edx
+     272:	84 d2                	test   %dl,%dl
+     274:	74 4a                	je     2c0 <parse_subdirectory+0x60>
+     276:	89 d8                	mov    %ebx,%eax
+     278:	31 f6                	xor    %esi,%esi
+     27a:	31 c9                	xor    %ecx,%ecx
+     27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     280:	83 c1 01             	add    $0x1,%ecx
+     283:	80 fa 2f             	cmp    $0x2f,%dl
+     286:	75 09                	jne    291 <parse_subdirectory+0x31>
+     288:	89 c6                	mov    %eax,%esi
+     28a:	b9 01 00 00 00       	mov    $0x1,%ecx
+     28f:	29 de                	sub    %ebx,%esi
+     291:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     295:	83 c0 01             	add    $0x1,%eax
+     298:	84 d2                	test   %dl,%dl
+     29a:	75 e4                	jne    280 <parse_subdirectory+0x20>
+     29c:	01 f3                	add    %esi,%ebx
+     29e:	8d 34 0f             	lea    (%edi,%ecx,1),%esi
+     2a1:	83 ec 04             	sub    $0x4,%esp
+     2a4:	51                   	push   %ecx
+     2a5:	53                   	push   %ebx
+     2a6:	57                   	push   %edi
+     2a7:	e8 b4 04 00 00       	call   760 <memmove>
+     2ac:	c6 06 00             	movb   $0x0,(%esi)
+     2af:	83 c4 10             	add    $0x10,%esp
+     2b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     2b5:	5b                   	pop    %ebx
+     2b6:	5e                   	pop    %esi
+     2b7:	5f                   	pop    %edi
+     2b8:	5d                   	pop    %ebp
+     2b9:	c3                   	ret
+     2ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     2c0:	89 fe                	mov    %edi,%esi
+     2c2:	31 c9                	xor    %ecx,%ecx
+     2c4:	eb db                	jmp    2a1 <parse_subdirectory+0x41>
+     2c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002d0 <concatenate_path>:
+     2d0:	55                   	push   %ebp
+     2d1:	89 e5                	mov    %esp,%ebp
+     2d3:	57                   	push   %edi
+     2d4:	56                   	push   %esi
+     2d5:	53                   	push   %ebx
+     2d6:	83 ec 28             	sub    $0x28,%esp
+     2d9:	8b 75 10             	mov    0x10(%ebp),%esi
+     2dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+     2df:	ff 75 0c             	push   0xc(%ebp)
+     2e2:	e8 f9 02 00 00       	call   5e0 <strlen>
+     2e7:	89 34 24             	mov    %esi,(%esp)
+     2ea:	89 c3                	mov    %eax,%ebx
+     2ec:	e8 ef 02 00 00       	call   5e0 <strlen>
+     2f1:	83 c4 10             	add    $0x10,%esp
+     2f4:	80 3e 2f             	cmpb   $0x2f,(%esi)
+     2f7:	0f 84 03 01 00 00    	je     400 <concatenate_path+0x130>
+     2fd:	83 ec 04             	sub    $0x4,%esp
+     300:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     303:	53                   	push   %ebx
+     304:	ff 75 0c             	push   0xc(%ebp)
+     307:	57                   	push   %edi
+     308:	e8 53 04 00 00       	call   760 <memmove>
+     30d:	83 c4 10             	add    $0x10,%esp
+     310:	83 fb 01             	cmp    $0x1,%ebx
+     313:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     316:	74 78                	je     390 <concatenate_path+0xc0>
+     318:	83 ec 04             	sub    $0x4,%esp
+     31b:	8d 44 1f 01          	lea    0x1(%edi,%ebx,1),%eax
+     31f:	c6 04 1f 2f          	movb   $0x2f,(%edi,%ebx,1)
+     323:	51                   	push   %ecx
+     324:	56                   	push   %esi
+     325:	50                   	push   %eax
+     326:	e8 35 04 00 00       	call   760 <memmove>
+     32b:	83 c4 10             	add    $0x10,%esp
+     32e:	0f b6 0f             	movzbl (%edi),%ecx
+     331:	31 db                	xor    %ebx,%ebx
+     333:	31 c0                	xor    %eax,%eax
+     335:	31 f6                	xor    %esi,%esi
+     337:	84 c9                	test   %cl,%cl
+     339:	75 1a                	jne    355 <concatenate_path+0x85>
+     33b:	eb 45                	jmp    382 <concatenate_path+0xb2>
+     33d:	8d 76 00             	lea    0x0(%esi),%esi
+     340:	89 de                	mov    %ebx,%esi
+     342:	88 0c 37             	mov    %cl,(%edi,%esi,1)
+     345:	83 c3 01             	add    $0x1,%ebx
+     348:	83 c0 01             	add    $0x1,%eax
+     34b:	0f b6 0c 07          	movzbl (%edi,%eax,1),%ecx
+     34f:	89 c6                	mov    %eax,%esi
+     351:	84 c9                	test   %cl,%cl
+     353:	74 2b                	je     380 <concatenate_path+0xb0>
+     355:	80 f9 2f             	cmp    $0x2f,%cl
+     358:	75 e6                	jne    340 <concatenate_path+0x70>
+     35a:	80 7c 37 01 2e       	cmpb   $0x2e,0x1(%edi,%esi,1)
+     35f:	74 4f                	je     3b0 <concatenate_path+0xe0>
+     361:	85 db                	test   %ebx,%ebx
+     363:	74 43                	je     3a8 <concatenate_path+0xd8>
+     365:	80 7c 1f ff 2f       	cmpb   $0x2f,-0x1(%edi,%ebx,1)
+     36a:	89 de                	mov    %ebx,%esi
+     36c:	75 d4                	jne    342 <concatenate_path+0x72>
+     36e:	83 c0 01             	add    $0x1,%eax
+     371:	0f b6 0c 07          	movzbl (%edi,%eax,1),%ecx
+     375:	89 c6                	mov    %eax,%esi
+     377:	84 c9                	test   %cl,%cl
+     379:	75 da                	jne    355 <concatenate_path+0x85>
+     37b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     37f:	90                   	nop
+     380:	01 df                	add    %ebx,%edi
+     382:	c6 07 00             	movb   $0x0,(%edi)
+     385:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     388:	5b                   	pop    %ebx
+     389:	5e                   	pop    %esi
+     38a:	5f                   	pop    %edi
+     38b:	5d                   	pop    %ebp
+     38c:	c3                   	ret
+     38d:	8d 76 00             	lea    0x0(%esi),%esi
+     390:	83 ec 04             	sub    $0x4,%esp
+     393:	8d 47 01             	lea    0x1(%edi),%eax
+     396:	51                   	push   %ecx
+     397:	56                   	push   %esi
+     398:	50                   	push   %eax
+     399:	e8 c2 03 00 00       	call   760 <memmove>
+     39e:	83 c4 10             	add    $0x10,%esp
+     3a1:	eb 8b                	jmp    32e <concatenate_path+0x5e>
+     3a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3a7:	90                   	nop
+     3a8:	31 f6                	xor    %esi,%esi
+     3aa:	eb 96                	jmp    342 <concatenate_path+0x72>
+     3ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3b0:	0f b6 54 37 02       	movzbl 0x2(%edi,%esi,1),%edx
+     3b5:	80 fa 2f             	cmp    $0x2f,%dl
+     3b8:	74 36                	je     3f0 <concatenate_path+0x120>
+     3ba:	84 d2                	test   %dl,%dl
+     3bc:	74 32                	je     3f0 <concatenate_path+0x120>
+     3be:	80 fa 2e             	cmp    $0x2e,%dl
+     3c1:	75 9e                	jne    361 <concatenate_path+0x91>
+     3c3:	85 db                	test   %ebx,%ebx
+     3c5:	75 0e                	jne    3d5 <concatenate_path+0x105>
+     3c7:	eb 1b                	jmp    3e4 <concatenate_path+0x114>
+     3c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3d0:	83 eb 01             	sub    $0x1,%ebx
+     3d3:	74 0f                	je     3e4 <concatenate_path+0x114>
+     3d5:	80 7c 1f ff 2f       	cmpb   $0x2f,-0x1(%edi,%ebx,1)
+     3da:	75 f4                	jne    3d0 <concatenate_path+0x100>
+     3dc:	83 fb 01             	cmp    $0x1,%ebx
+     3df:	74 03                	je     3e4 <concatenate_path+0x114>
+     3e1:	83 eb 01             	sub    $0x1,%ebx
+     3e4:	83 c0 02             	add    $0x2,%eax
+     3e7:	e9 5c ff ff ff       	jmp    348 <concatenate_path+0x78>
+     3ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3f0:	83 c0 01             	add    $0x1,%eax
+     3f3:	e9 50 ff ff ff       	jmp    348 <concatenate_path+0x78>
+     3f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ff:	90                   	nop
+     400:	83 ec 04             	sub    $0x4,%esp
+     403:	50                   	push   %eax
+     404:	56                   	push   %esi
+     405:	57                   	push   %edi
+     406:	e8 55 03 00 00       	call   760 <memmove>
+     40b:	83 c4 10             	add    $0x10,%esp
+     40e:	e9 1b ff ff ff       	jmp    32e <concatenate_path+0x5e>
+     413:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     41a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000420 <is_prefix_path>:
+     420:	55                   	push   %ebp
+     421:	89 e5                	mov    %esp,%ebp
+     423:	56                   	push   %esi
+     424:	53                   	push   %ebx
+     425:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     428:	8b 75 08             	mov    0x8(%ebp),%esi
+     42b:	0f b6 13             	movzbl (%ebx),%edx
+     42e:	80 fa 2f             	cmp    $0x2f,%dl
+     431:	74 4d                	je     480 <is_prefix_path+0x60>
+     433:	0f b6 0e             	movzbl (%esi),%ecx
+     436:	84 c9                	test   %cl,%cl
+     438:	74 36                	je     470 <is_prefix_path+0x50>
+     43a:	31 c0                	xor    %eax,%eax
+     43c:	eb 15                	jmp    453 <is_prefix_path+0x33>
+     43e:	66 90                	xchg   %ax,%ax
+     440:	38 ca                	cmp    %cl,%dl
+     442:	75 30                	jne    474 <is_prefix_path+0x54>
+     444:	83 c0 01             	add    $0x1,%eax
+     447:	0f b6 0c 06          	movzbl (%esi,%eax,1),%ecx
+     44b:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     44f:	84 c9                	test   %cl,%cl
+     451:	74 1d                	je     470 <is_prefix_path+0x50>
+     453:	84 d2                	test   %dl,%dl
+     455:	75 e9                	jne    440 <is_prefix_path+0x20>
+     457:	84 c9                	test   %cl,%cl
+     459:	5b                   	pop    %ebx
+     45a:	5e                   	pop    %esi
+     45b:	0f 94 c0             	sete   %al
+     45e:	80 f9 2f             	cmp    $0x2f,%cl
+     461:	5d                   	pop    %ebp
+     462:	0f 94 c2             	sete   %dl
+     465:	09 d0                	or     %edx,%eax
+     467:	0f b6 c0             	movzbl %al,%eax
+     46a:	c3                   	ret
+     46b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     46f:	90                   	nop
+     470:	84 d2                	test   %dl,%dl
+     472:	74 20                	je     494 <is_prefix_path+0x74>
+     474:	31 c0                	xor    %eax,%eax
+     476:	5b                   	pop    %ebx
+     477:	5e                   	pop    %esi
+     478:	5d                   	pop    %ebp
+     479:	c3                   	ret
+     47a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     480:	80 7b 01 00          	cmpb   $0x0,0x1(%ebx)
+     484:	b8 01 00 00 00       	mov    $0x1,%eax
+     489:	74 eb                	je     476 <is_prefix_path+0x56>
+     48b:	0f b6 0e             	movzbl (%esi),%ecx
+     48e:	84 c9                	test   %cl,%cl
+     490:	75 a8                	jne    43a <is_prefix_path+0x1a>
+     492:	eb e0                	jmp    474 <is_prefix_path+0x54>
+     494:	31 c9                	xor    %ecx,%ecx
+     496:	eb bf                	jmp    457 <is_prefix_path+0x37>
+     498:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     49f:	90                   	nop
+
+000004a0 <extract_cont_path>:
+int extract_cont_path(char *cont_path, char *fpath, char *cont_rootdir) {
+     4a0:	55                   	push   %ebp
+     4a1:	31 c0                	xor    %eax,%eax
+     4a3:	89 e5                	mov    %esp,%ebp
+     4a5:	56                   	push   %esi
+     4a6:	53                   	push   %ebx
+     4a7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     4aa:	8b 75 10             	mov    0x10(%ebp),%esi
+  for (; fpath[idx] != '\0' && cont_rootdir[idx] != '\0'; ++idx) {
+     4ad:	0f b6 13             	movzbl (%ebx),%edx
+     4b0:	84 d2                	test   %dl,%dl
+     4b2:	75 1b                	jne    4cf <extract_cont_path+0x2f>
+     4b4:	eb 5c                	jmp    512 <extract_cont_path+0x72>
+     4b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4bd:	8d 76 00             	lea    0x0(%esi),%esi
+    if (fpath[idx] != cont_rootdir[idx]) {
+     4c0:	38 d1                	cmp    %dl,%cl
+     4c2:	75 5c                	jne    520 <extract_cont_path+0x80>
+  for (; fpath[idx] != '\0' && cont_rootdir[idx] != '\0'; ++idx) {
+     4c4:	83 c0 01             	add    $0x1,%eax
+     4c7:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     4cb:	84 d2                	test   %dl,%dl
+     4cd:	74 41                	je     510 <extract_cont_path+0x70>
+     4cf:	0f b6 0c 06          	movzbl (%esi,%eax,1),%ecx
+     4d3:	84 c9                	test   %cl,%cl
+     4d5:	75 e9                	jne    4c0 <extract_cont_path+0x20>
+  for (int fidx = 0; fpath[idx] != '\0'; ++idx, ++fidx) {
+     4d7:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     4db:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     4de:	8d 44 03 01          	lea    0x1(%ebx,%eax,1),%eax
+     4e2:	84 d2                	test   %dl,%dl
+     4e4:	74 19                	je     4ff <extract_cont_path+0x5f>
+     4e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ed:	8d 76 00             	lea    0x0(%esi),%esi
+    cont_path[fidx] = fpath[idx];
+     4f0:	88 11                	mov    %dl,(%ecx)
+  for (int fidx = 0; fpath[idx] != '\0'; ++idx, ++fidx) {
+     4f2:	0f b6 10             	movzbl (%eax),%edx
+     4f5:	83 c1 01             	add    $0x1,%ecx
+     4f8:	83 c0 01             	add    $0x1,%eax
+     4fb:	84 d2                	test   %dl,%dl
+     4fd:	75 f1                	jne    4f0 <extract_cont_path+0x50>
+    return 0;
+     4ff:	31 c0                	xor    %eax,%eax
+}
+     501:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     504:	5b                   	pop    %ebx
+     505:	5e                   	pop    %esi
+     506:	5d                   	pop    %ebp
+     507:	c3                   	ret
+     508:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     50f:	90                   	nop
+  if (fpath[idx] == '\0' && cont_rootdir[idx] != '\0') {
+     510:	01 c6                	add    %eax,%esi
+     512:	80 3e 00             	cmpb   $0x0,(%esi)
+     515:	75 22                	jne    539 <extract_cont_path+0x99>
+    cont_path[0] = '/';
+     517:	8b 45 08             	mov    0x8(%ebp),%eax
+     51a:	c6 00 2f             	movb   $0x2f,(%eax)
+    return 0;
+     51d:	eb e0                	jmp    4ff <extract_cont_path+0x5f>
+     51f:	90                   	nop
+      printf(2, "Container root directory is not the prefix of full path.\n");
+     520:	83 ec 08             	sub    $0x8,%esp
+     523:	68 88 10 00 00       	push   $0x1088
+     528:	6a 02                	push   $0x2
+     52a:	e8 51 04 00 00       	call   980 <printf>
+      return -1;
+     52f:	83 c4 10             	add    $0x10,%esp
+     532:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     537:	eb c8                	jmp    501 <extract_cont_path+0x61>
+    printf(2, "Container root directory is longer than full path.\n");
+     539:	83 ec 08             	sub    $0x8,%esp
+     53c:	68 c4 10 00 00       	push   $0x10c4
+     541:	6a 02                	push   $0x2
+     543:	e8 38 04 00 00       	call   980 <printf>
+    return -1;
+     548:	83 c4 10             	add    $0x10,%esp
+     54b:	eb e5                	jmp    532 <extract_cont_path+0x92>
+     54d:	66 90                	xchg   %ax,%ax
+     54f:	90                   	nop
+
+00000550 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     550:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     551:	31 c0                	xor    %eax,%eax
+{
+     553:	89 e5                	mov    %esp,%ebp
+     555:	53                   	push   %ebx
+     556:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     559:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     55c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     560:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     564:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     567:	83 c0 01             	add    $0x1,%eax
+     56a:	84 d2                	test   %dl,%dl
+     56c:	75 f2                	jne    560 <strcpy+0x10>
+    ;
+  return os;
+}
+     56e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     571:	89 c8                	mov    %ecx,%eax
+     573:	c9                   	leave
+     574:	c3                   	ret
+     575:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     57c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000580 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     580:	55                   	push   %ebp
+     581:	89 e5                	mov    %esp,%ebp
+     583:	53                   	push   %ebx
+     584:	8b 55 08             	mov    0x8(%ebp),%edx
+     587:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     58a:	0f b6 02             	movzbl (%edx),%eax
+     58d:	84 c0                	test   %al,%al
+     58f:	75 17                	jne    5a8 <strcmp+0x28>
+     591:	eb 3a                	jmp    5cd <strcmp+0x4d>
+     593:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     597:	90                   	nop
+     598:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     59c:	83 c2 01             	add    $0x1,%edx
+     59f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     5a2:	84 c0                	test   %al,%al
+     5a4:	74 1a                	je     5c0 <strcmp+0x40>
+    p++, q++;
+     5a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     5a8:	0f b6 19             	movzbl (%ecx),%ebx
+     5ab:	38 c3                	cmp    %al,%bl
+     5ad:	74 e9                	je     598 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     5af:	29 d8                	sub    %ebx,%eax
+}
+     5b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5b4:	c9                   	leave
+     5b5:	c3                   	ret
+     5b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     5c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     5c4:	31 c0                	xor    %eax,%eax
+     5c6:	29 d8                	sub    %ebx,%eax
+}
+     5c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5cb:	c9                   	leave
+     5cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     5cd:	0f b6 19             	movzbl (%ecx),%ebx
+     5d0:	31 c0                	xor    %eax,%eax
+     5d2:	eb db                	jmp    5af <strcmp+0x2f>
+     5d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5df:	90                   	nop
+
+000005e0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     5e0:	55                   	push   %ebp
+     5e1:	89 e5                	mov    %esp,%ebp
+     5e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     5e6:	80 3a 00             	cmpb   $0x0,(%edx)
+     5e9:	74 15                	je     600 <strlen+0x20>
+     5eb:	31 c0                	xor    %eax,%eax
+     5ed:	8d 76 00             	lea    0x0(%esi),%esi
+     5f0:	83 c0 01             	add    $0x1,%eax
+     5f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     5f7:	89 c1                	mov    %eax,%ecx
+     5f9:	75 f5                	jne    5f0 <strlen+0x10>
+    ;
+  return n;
+}
+     5fb:	89 c8                	mov    %ecx,%eax
+     5fd:	5d                   	pop    %ebp
+     5fe:	c3                   	ret
+     5ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+     600:	31 c9                	xor    %ecx,%ecx
+}
+     602:	5d                   	pop    %ebp
+     603:	89 c8                	mov    %ecx,%eax
+     605:	c3                   	ret
+     606:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     60d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000610 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     610:	55                   	push   %ebp
+     611:	89 e5                	mov    %esp,%ebp
+     613:	57                   	push   %edi
+     614:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     617:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     61a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     61d:	89 d7                	mov    %edx,%edi
+     61f:	fc                   	cld
+     620:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     622:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     625:	89 d0                	mov    %edx,%eax
+     627:	c9                   	leave
+     628:	c3                   	ret
+     629:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000630 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     630:	55                   	push   %ebp
+     631:	89 e5                	mov    %esp,%ebp
+     633:	8b 45 08             	mov    0x8(%ebp),%eax
+     636:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     63a:	0f b6 10             	movzbl (%eax),%edx
+     63d:	84 d2                	test   %dl,%dl
+     63f:	75 12                	jne    653 <strchr+0x23>
+     641:	eb 1d                	jmp    660 <strchr+0x30>
+     643:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     647:	90                   	nop
+     648:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     64c:	83 c0 01             	add    $0x1,%eax
+     64f:	84 d2                	test   %dl,%dl
+     651:	74 0d                	je     660 <strchr+0x30>
+    if(*s == c)
+     653:	38 d1                	cmp    %dl,%cl
+     655:	75 f1                	jne    648 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     657:	5d                   	pop    %ebp
+     658:	c3                   	ret
+     659:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     660:	31 c0                	xor    %eax,%eax
+}
+     662:	5d                   	pop    %ebp
+     663:	c3                   	ret
+     664:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     66b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     66f:	90                   	nop
+
+00000670 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     670:	55                   	push   %ebp
+     671:	89 e5                	mov    %esp,%ebp
+     673:	57                   	push   %edi
+     674:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     675:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     678:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     679:	31 db                	xor    %ebx,%ebx
+{
+     67b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     67e:	eb 27                	jmp    6a7 <gets+0x37>
+    cc = read(0, &c, 1);
+     680:	83 ec 04             	sub    $0x4,%esp
+     683:	6a 01                	push   $0x1
+     685:	56                   	push   %esi
+     686:	6a 00                	push   $0x0
+     688:	e8 5e 01 00 00       	call   7eb <read>
+    if(cc < 1)
+     68d:	83 c4 10             	add    $0x10,%esp
+     690:	85 c0                	test   %eax,%eax
+     692:	7e 1d                	jle    6b1 <gets+0x41>
+      break;
+    buf[i++] = c;
+     694:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     698:	8b 55 08             	mov    0x8(%ebp),%edx
+     69b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     69f:	3c 0a                	cmp    $0xa,%al
+     6a1:	74 10                	je     6b3 <gets+0x43>
+     6a3:	3c 0d                	cmp    $0xd,%al
+     6a5:	74 0c                	je     6b3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     6a7:	89 df                	mov    %ebx,%edi
+     6a9:	83 c3 01             	add    $0x1,%ebx
+     6ac:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     6af:	7c cf                	jl     680 <gets+0x10>
+     6b1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     6b3:	8b 45 08             	mov    0x8(%ebp),%eax
+     6b6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     6ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     6bd:	5b                   	pop    %ebx
+     6be:	5e                   	pop    %esi
+     6bf:	5f                   	pop    %edi
+     6c0:	5d                   	pop    %ebp
+     6c1:	c3                   	ret
+     6c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000006d0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     6d0:	55                   	push   %ebp
+     6d1:	89 e5                	mov    %esp,%ebp
+     6d3:	56                   	push   %esi
+     6d4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     6d5:	83 ec 08             	sub    $0x8,%esp
+     6d8:	6a 00                	push   $0x0
+     6da:	ff 75 08             	push   0x8(%ebp)
+     6dd:	e8 31 01 00 00       	call   813 <open>
+  if(fd < 0)
+     6e2:	83 c4 10             	add    $0x10,%esp
+     6e5:	85 c0                	test   %eax,%eax
+     6e7:	78 27                	js     710 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     6e9:	83 ec 08             	sub    $0x8,%esp
+     6ec:	ff 75 0c             	push   0xc(%ebp)
+     6ef:	89 c3                	mov    %eax,%ebx
+     6f1:	50                   	push   %eax
+     6f2:	e8 34 01 00 00       	call   82b <fstat>
+  close(fd);
+     6f7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     6fa:	89 c6                	mov    %eax,%esi
+  close(fd);
+     6fc:	e8 fa 00 00 00       	call   7fb <close>
+  return r;
+     701:	83 c4 10             	add    $0x10,%esp
+}
+     704:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     707:	89 f0                	mov    %esi,%eax
+     709:	5b                   	pop    %ebx
+     70a:	5e                   	pop    %esi
+     70b:	5d                   	pop    %ebp
+     70c:	c3                   	ret
+     70d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     710:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     715:	eb ed                	jmp    704 <stat+0x34>
+     717:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     71e:	66 90                	xchg   %ax,%ax
+
+00000720 <atoi>:
+
+int
+atoi(const char *s)
+{
+     720:	55                   	push   %ebp
+     721:	89 e5                	mov    %esp,%ebp
+     723:	53                   	push   %ebx
+     724:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     727:	0f be 02             	movsbl (%edx),%eax
+     72a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     72d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     730:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     735:	77 1e                	ja     755 <atoi+0x35>
+     737:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     73e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     740:	83 c2 01             	add    $0x1,%edx
+     743:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     746:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     74a:	0f be 02             	movsbl (%edx),%eax
+     74d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     750:	80 fb 09             	cmp    $0x9,%bl
+     753:	76 eb                	jbe    740 <atoi+0x20>
+  return n;
+}
+     755:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     758:	89 c8                	mov    %ecx,%eax
+     75a:	c9                   	leave
+     75b:	c3                   	ret
+     75c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000760 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     760:	55                   	push   %ebp
+     761:	89 e5                	mov    %esp,%ebp
+     763:	57                   	push   %edi
+     764:	56                   	push   %esi
+     765:	8b 45 10             	mov    0x10(%ebp),%eax
+     768:	8b 55 08             	mov    0x8(%ebp),%edx
+     76b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     76e:	85 c0                	test   %eax,%eax
+     770:	7e 13                	jle    785 <memmove+0x25>
+     772:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     774:	89 d7                	mov    %edx,%edi
+     776:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     77d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     780:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     781:	39 f8                	cmp    %edi,%eax
+     783:	75 fb                	jne    780 <memmove+0x20>
+  return vdst;
+}
+     785:	5e                   	pop    %esi
+     786:	89 d0                	mov    %edx,%eax
+     788:	5f                   	pop    %edi
+     789:	5d                   	pop    %ebp
+     78a:	c3                   	ret
+
+0000078b <ccreate>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(ccreate)
+     78b:	b8 17 00 00 00       	mov    $0x17,%eax
+     790:	cd 40                	int    $0x40
+     792:	c3                   	ret
+
+00000793 <cfork>:
+SYSCALL(cfork)
+     793:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     798:	cd 40                	int    $0x40
+     79a:	c3                   	ret
+
+0000079b <cgetrootdir>:
+SYSCALL(cgetrootdir)
+     79b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     7a0:	cd 40                	int    $0x40
+     7a2:	c3                   	ret
+
+000007a3 <getcontrootdir>:
+SYSCALL(getcontrootdir)
+     7a3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     7a8:	cd 40                	int    $0x40
+     7aa:	c3                   	ret
+
+000007ab <cpause>:
+SYSCALL(cpause)
+     7ab:	b8 19 00 00 00       	mov    $0x19,%eax
+     7b0:	cd 40                	int    $0x40
+     7b2:	c3                   	ret
+
+000007b3 <cresume>:
+SYSCALL(cresume)
+     7b3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     7b8:	cd 40                	int    $0x40
+     7ba:	c3                   	ret
+
+000007bb <cstart>:
+SYSCALL(cstart)
+     7bb:	b8 18 00 00 00       	mov    $0x18,%eax
+     7c0:	cd 40                	int    $0x40
+     7c2:	c3                   	ret
+
+000007c3 <cstop>:
+SYSCALL(cstop)
+     7c3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     7c8:	cd 40                	int    $0x40
+     7ca:	c3                   	ret
+
+000007cb <fork>:
+SYSCALL(fork)
+     7cb:	b8 01 00 00 00       	mov    $0x1,%eax
+     7d0:	cd 40                	int    $0x40
+     7d2:	c3                   	ret
+
+000007d3 <exit>:
+SYSCALL(exit)
+     7d3:	b8 02 00 00 00       	mov    $0x2,%eax
+     7d8:	cd 40                	int    $0x40
+     7da:	c3                   	ret
+
+000007db <wait>:
+SYSCALL(wait)
+     7db:	b8 03 00 00 00       	mov    $0x3,%eax
+     7e0:	cd 40                	int    $0x40
+     7e2:	c3                   	ret
+
+000007e3 <pipe>:
+SYSCALL(pipe)
+     7e3:	b8 04 00 00 00       	mov    $0x4,%eax
+     7e8:	cd 40                	int    $0x40
+     7ea:	c3                   	ret
+
+000007eb <read>:
+SYSCALL(read)
+     7eb:	b8 05 00 00 00       	mov    $0x5,%eax
+     7f0:	cd 40                	int    $0x40
+     7f2:	c3                   	ret
+
+000007f3 <write>:
+SYSCALL(write)
+     7f3:	b8 10 00 00 00       	mov    $0x10,%eax
+     7f8:	cd 40                	int    $0x40
+     7fa:	c3                   	ret
+
+000007fb <close>:
+SYSCALL(close)
+     7fb:	b8 15 00 00 00       	mov    $0x15,%eax
+     800:	cd 40                	int    $0x40
+     802:	c3                   	ret
+
+00000803 <kill>:
+SYSCALL(kill)
+     803:	b8 06 00 00 00       	mov    $0x6,%eax
+     808:	cd 40                	int    $0x40
+     80a:	c3                   	ret
+
+0000080b <exec>:
+SYSCALL(exec)
+     80b:	b8 07 00 00 00       	mov    $0x7,%eax
+     810:	cd 40                	int    $0x40
+     812:	c3                   	ret
+
+00000813 <open>:
+SYSCALL(open)
+     813:	b8 0f 00 00 00       	mov    $0xf,%eax
+     818:	cd 40                	int    $0x40
+     81a:	c3                   	ret
+
+0000081b <mknod>:
+SYSCALL(mknod)
+     81b:	b8 11 00 00 00       	mov    $0x11,%eax
+     820:	cd 40                	int    $0x40
+     822:	c3                   	ret
+
+00000823 <unlink>:
+SYSCALL(unlink)
+     823:	b8 12 00 00 00       	mov    $0x12,%eax
+     828:	cd 40                	int    $0x40
+     82a:	c3                   	ret
+
+0000082b <fstat>:
+SYSCALL(fstat)
+     82b:	b8 08 00 00 00       	mov    $0x8,%eax
+     830:	cd 40                	int    $0x40
+     832:	c3                   	ret
+
+00000833 <link>:
+SYSCALL(link)
+     833:	b8 13 00 00 00       	mov    $0x13,%eax
+     838:	cd 40                	int    $0x40
+     83a:	c3                   	ret
+
+0000083b <mkdir>:
+SYSCALL(mkdir)
+     83b:	b8 14 00 00 00       	mov    $0x14,%eax
+     840:	cd 40                	int    $0x40
+     842:	c3                   	ret
+
+00000843 <chdir>:
+SYSCALL(chdir)
+     843:	b8 09 00 00 00       	mov    $0x9,%eax
+     848:	cd 40                	int    $0x40
+     84a:	c3                   	ret
+
+0000084b <dup>:
+SYSCALL(dup)
+     84b:	b8 0a 00 00 00       	mov    $0xa,%eax
+     850:	cd 40                	int    $0x40
+     852:	c3                   	ret
+
+00000853 <getpid>:
+SYSCALL(getpid)
+     853:	b8 0b 00 00 00       	mov    $0xb,%eax
+     858:	cd 40                	int    $0x40
+     85a:	c3                   	ret
+
+0000085b <sbrk>:
+SYSCALL(sbrk)
+     85b:	b8 0c 00 00 00       	mov    $0xc,%eax
+     860:	cd 40                	int    $0x40
+     862:	c3                   	ret
+
+00000863 <sleep>:
+SYSCALL(sleep)
+     863:	b8 0d 00 00 00       	mov    $0xd,%eax
+     868:	cd 40                	int    $0x40
+     86a:	c3                   	ret
+
+0000086b <uptime>:
+SYSCALL(uptime)
+     86b:	b8 0e 00 00 00       	mov    $0xe,%eax
+     870:	cd 40                	int    $0x40
+     872:	c3                   	ret
+
+00000873 <cps>:
+SYSCALL(cps)
+     873:	b8 16 00 00 00       	mov    $0x16,%eax
+     878:	cd 40                	int    $0x40
+     87a:	c3                   	ret
+
+0000087b <mmap>:
+SYSCALL(mmap)
+     87b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     880:	cd 40                	int    $0x40
+     882:	c3                   	ret
+
+00000883 <munmap>:
+SYSCALL(munmap)
+     883:	b8 20 00 00 00       	mov    $0x20,%eax
+     888:	cd 40                	int    $0x40
+     88a:	c3                   	ret
+
+0000088b <shmget>:
+SYSCALL(shmget)
+     88b:	b8 21 00 00 00       	mov    $0x21,%eax
+     890:	cd 40                	int    $0x40
+     892:	c3                   	ret
+
+00000893 <climit>:
+SYSCALL(climit)
+     893:	b8 22 00 00 00       	mov    $0x22,%eax
+     898:	cd 40                	int    $0x40
+     89a:	c3                   	ret
+
+0000089b <spawn>:
+SYSCALL(spawn)
+     89b:	b8 23 00 00 00       	mov    $0x23,%eax
+     8a0:	cd 40                	int    $0x40
+     8a2:	c3                   	ret
+
+000008a3 <clone>:
+SYSCALL(clone)
+     8a3:	b8 24 00 00 00       	mov    $0x24,%eax
+     8a8:	cd 40                	int    $0x40
+     8aa:	c3                   	ret
+
+000008ab <join>:
+SYSCALL(join)
+     8ab:	b8 25 00 00 00       	mov    $0x25,%eax
+     8b0:	cd 40                	int    $0x40
+     8b2:	c3                   	ret
+
+000008b3 <futex>:
+SYSCALL(futex)
+     8b3:	b8 26 00 00 00       	mov    $0x26,%eax
+     8b8:	cd 40                	int    $0x40
+     8ba:	c3                   	ret
+
+000008bb <ccheckpoint>:
+SYSCALL(ccheckpoint)
+     8bb:	b8 27 00 00 00       	mov    $0x27,%eax
+     8c0:	cd 40                	int    $0x40
+     8c2:	c3                   	ret
+
+000008c3 <crestore>:
+SYSCALL(crestore)
+     8c3:	b8 28 00 00 00       	mov    $0x28,%eax
+     8c8:	cd 40                	int    $0x40
+     8ca:	c3                   	ret
+
+000008cb <czygote>:
+SYSCALL(czygote)
+     8cb:	b8 29 00 00 00       	mov    $0x29,%eax
+     8d0:	cd 40                	int    $0x40
+     8d2:	c3                   	ret
+
+000008d3 <memstats>:
+SYSCALL(memstats)
+     8d3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     8d8:	cd 40                	int    $0x40
+     8da:	c3                   	ret
+     8db:	66 90                	xchg   %ax,%ax
+     8dd:	66 90                	xchg   %ax,%ax
+     8df:	90                   	nop
+
+000008e0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     8e0:	55                   	push   %ebp
+     8e1:	89 e5                	mov    %esp,%ebp
+     8e3:	57                   	push   %edi
+     8e4:	56                   	push   %esi
+     8e5:	53                   	push   %ebx
+     8e6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     8e8:	89 d1                	mov    %edx,%ecx
+{
+     8ea:	83 ec 3c             	sub    $0x3c,%esp
+     8ed:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     8f0:	85 d2                	test   %edx,%edx
+     8f2:	0f 89 80 00 00 00    	jns    978 <printint+0x98>
+     8f8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     8fc:	74 7a                	je     978 <printint+0x98>
+    x = -xx;
+     8fe:	f7 d9                	neg    %ecx
+    neg = 1;
+     900:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     905:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     908:	31 f6                	xor    %esi,%esi
+     90a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     910:	89 c8                	mov    %ecx,%eax
+     912:	31 d2                	xor    %edx,%edx
+     914:	89 f7                	mov    %esi,%edi
+     916:	f7 f3                	div    %ebx
+     918:	8d 76 01             	lea    0x1(%esi),%esi
+     91b:	0f b6 92 18 12 00 00 	movzbl 0x1218(%edx),%edx
+     922:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     926:	89 ca                	mov    %ecx,%edx
+     928:	89 c1                	mov    %eax,%ecx
+     92a:	39 da                	cmp    %ebx,%edx
+     92c:	73 e2                	jae    910 <printint+0x30>
+  if(neg)
+     92e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     931:	85 c0                	test   %eax,%eax
+     933:	74 07                	je     93c <printint+0x5c>
+    buf[i++] = '-';
+     935:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     93a:	89 f7                	mov    %esi,%edi
+     93c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     93f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     942:	01 df                	add    %ebx,%edi
+     944:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     948:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+     94b:	83 ec 04             	sub    $0x4,%esp
+     94e:	88 45 d7             	mov    %al,-0x29(%ebp)
+     951:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     954:	6a 01                	push   $0x1
+     956:	50                   	push   %eax
+     957:	56                   	push   %esi
+     958:	e8 96 fe ff ff       	call   7f3 <write>
+  while(--i >= 0)
+     95d:	89 f8                	mov    %edi,%eax
+     95f:	83 c4 10             	add    $0x10,%esp
+     962:	83 ef 01             	sub    $0x1,%edi
+     965:	39 d8                	cmp    %ebx,%eax
+     967:	75 df                	jne    948 <printint+0x68>
+}
+     969:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     96c:	5b                   	pop    %ebx
+     96d:	5e                   	pop    %esi
+     96e:	5f                   	pop    %edi
+     96f:	5d                   	pop    %ebp
+     970:	c3                   	ret
+     971:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     978:	31 c0                	xor    %eax,%eax
+     97a:	eb 89                	jmp    905 <printint+0x25>
+     97c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000980 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     980:	55                   	push   %ebp
+     981:	89 e5                	mov    %esp,%ebp
+     983:	57                   	push   %edi
+     984:	56                   	push   %esi
+     985:	53                   	push   %ebx
+     986:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     989:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+     98c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+     98f:	0f b6 1e             	movzbl (%esi),%ebx
+     992:	83 c6 01             	add    $0x1,%esi
+     995:	84 db                	test   %bl,%bl
+     997:	74 67                	je     a00 <printf+0x80>
+     999:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     99c:	31 d2                	xor    %edx,%edx
+     99e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     9a1:	eb 34                	jmp    9d7 <printf+0x57>
+     9a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     9a7:	90                   	nop
+     9a8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+     9ab:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+     9b0:	83 f8 25             	cmp    $0x25,%eax
+     9b3:	74 18                	je     9cd <printf+0x4d>
+  write(fd, &c, 1);
+     9b5:	83 ec 04             	sub    $0x4,%esp
+     9b8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     9bb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     9be:	6a 01                	push   $0x1
+     9c0:	50                   	push   %eax
+     9c1:	57                   	push   %edi
+     9c2:	e8 2c fe ff ff       	call   7f3 <write>
+     9c7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+     9ca:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     9cd:	0f b6 1e             	movzbl (%esi),%ebx
+     9d0:	83 c6 01             	add    $0x1,%esi
+     9d3:	84 db                	test   %bl,%bl
+     9d5:	74 29                	je     a00 <printf+0x80>
+    c = fmt[i] & 0xff;
+     9d7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     9da:	85 d2                	test   %edx,%edx
+     9dc:	74 ca                	je     9a8 <printf+0x28>
+      }
+    } else if(state == '%'){
+     9de:	83 fa 25             	cmp    $0x25,%edx
+     9e1:	75 ea                	jne    9cd <printf+0x4d>
+      if(c == 'd'){
+     9e3:	83 f8 25             	cmp    $0x25,%eax
+     9e6:	0f 84 24 01 00 00    	je     b10 <printf+0x190>
+     9ec:	83 e8 63             	sub    $0x63,%eax
+     9ef:	83 f8 15             	cmp    $0x15,%eax
+     9f2:	77 1c                	ja     a10 <printf+0x90>
+     9f4:	ff 24 85 c0 11 00 00 	jmp    *0x11c0(,%eax,4)
+     9fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     9ff:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+     a00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a03:	5b                   	pop    %ebx
+     a04:	5e                   	pop    %esi
+     a05:	5f                   	pop    %edi
+     a06:	5d                   	pop    %ebp
+     a07:	c3                   	ret
+     a08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a0f:	90                   	nop
+  write(fd, &c, 1);
+     a10:	83 ec 04             	sub    $0x4,%esp
+     a13:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     a16:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+     a1a:	6a 01                	push   $0x1
+     a1c:	52                   	push   %edx
+     a1d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     a20:	57                   	push   %edi
+     a21:	e8 cd fd ff ff       	call   7f3 <write>
+     a26:	83 c4 0c             	add    $0xc,%esp
+     a29:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     a2c:	6a 01                	push   $0x1
+     a2e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     a31:	52                   	push   %edx
+     a32:	57                   	push   %edi
+     a33:	e8 bb fd ff ff       	call   7f3 <write>
+        putc(fd, c);
+     a38:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     a3b:	31 d2                	xor    %edx,%edx
+     a3d:	eb 8e                	jmp    9cd <printf+0x4d>
+     a3f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+     a40:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     a43:	83 ec 0c             	sub    $0xc,%esp
+     a46:	b9 10 00 00 00       	mov    $0x10,%ecx
+     a4b:	8b 13                	mov    (%ebx),%edx
+     a4d:	6a 00                	push   $0x0
+     a4f:	89 f8                	mov    %edi,%eax
+        ap++;
+     a51:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+     a54:	e8 87 fe ff ff       	call   8e0 <printint>
+        ap++;
+     a59:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     a5c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     a5f:	31 d2                	xor    %edx,%edx
+     a61:	e9 67 ff ff ff       	jmp    9cd <printf+0x4d>
+     a66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a6d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     a70:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     a73:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     a75:	83 c0 04             	add    $0x4,%eax
+     a78:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+     a7b:	85 db                	test   %ebx,%ebx
+     a7d:	0f 84 9d 00 00 00    	je     b20 <printf+0x1a0>
+        while(*s != 0){
+     a83:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+     a86:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+     a88:	84 c0                	test   %al,%al
+     a8a:	0f 84 3d ff ff ff    	je     9cd <printf+0x4d>
+     a90:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     a93:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+     a96:	89 de                	mov    %ebx,%esi
+     a98:	89 d3                	mov    %edx,%ebx
+     a9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+     aa0:	83 ec 04             	sub    $0x4,%esp
+     aa3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+     aa6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+     aa9:	6a 01                	push   $0x1
+     aab:	53                   	push   %ebx
+     aac:	57                   	push   %edi
+     aad:	e8 41 fd ff ff       	call   7f3 <write>
+        while(*s != 0){
+     ab2:	0f b6 06             	movzbl (%esi),%eax
+     ab5:	83 c4 10             	add    $0x10,%esp
+     ab8:	84 c0                	test   %al,%al
+     aba:	75 e4                	jne    aa0 <printf+0x120>
+      state = 0;
+     abc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     abf:	31 d2                	xor    %edx,%edx
+     ac1:	e9 07 ff ff ff       	jmp    9cd <printf+0x4d>
+     ac6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     acd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+     ad0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     ad3:	83 ec 0c             	sub    $0xc,%esp
+     ad6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     adb:	8b 13                	mov    (%ebx),%edx
+     add:	6a 01                	push   $0x1
+     adf:	e9 6b ff ff ff       	jmp    a4f <printf+0xcf>
+     ae4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+     ae8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+     aeb:	83 ec 04             	sub    $0x4,%esp
+     aee:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+     af1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+     af3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+     af6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+     af9:	6a 01                	push   $0x1
+     afb:	52                   	push   %edx
+     afc:	57                   	push   %edi
+     afd:	e8 f1 fc ff ff       	call   7f3 <write>
+        ap++;
+     b02:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     b05:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     b08:	31 d2                	xor    %edx,%edx
+     b0a:	e9 be fe ff ff       	jmp    9cd <printf+0x4d>
+     b0f:	90                   	nop
+  write(fd, &c, 1);
+     b10:	83 ec 04             	sub    $0x4,%esp
+     b13:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     b16:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     b19:	6a 01                	push   $0x1
+     b1b:	e9 11 ff ff ff       	jmp    a31 <printf+0xb1>
+     b20:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     b25:	bb b9 11 00 00       	mov    $0x11b9,%ebx
+     b2a:	e9 61 ff ff ff       	jmp    a90 <printf+0x110>
+     b2f:	90                   	nop
+
+00000b30 <runfree>:
+
+// Give the n pages at r back to the free runs, merging them with
+// adjacent runs, and shrink the heap if the end of it is free.
+static void
+runfree(struct page *r, uint n)
+{
+     b30:	55                   	push   %ebp
+  struct page **pp, *prev;
+
+  r->kind = PFREE;
+     b31:	b9 03 00 00 00       	mov    $0x3,%ecx
+{
+     b36:	89 e5                	mov    %esp,%ebp
+     b38:	57                   	push   %edi
+     b39:	56                   	push   %esi
+     b3a:	53                   	push   %ebx
+     b3b:	89 c3                	mov    %eax,%ebx
+     b3d:	83 ec 0c             	sub    $0xc,%esp
+  r->kind = PFREE;
+     b40:	66 89 08             	mov    %cx,(%eax)
+  r->npages = n;
+  prev = 0;
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+     b43:	8b 0d 64 16 00 00    	mov    0x1664,%ecx
+  r->npages = n;
+     b49:	89 50 04             	mov    %edx,0x4(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+     b4c:	85 c9                	test   %ecx,%ecx
+     b4e:	0f 84 1f 01 00 00    	je     c73 <runfree+0x143>
+     b54:	39 c1                	cmp    %eax,%ecx
+     b56:	0f 83 f7 00 00 00    	jae    c53 <runfree+0x123>
+     b5c:	89 c8                	mov    %ecx,%eax
+     b5e:	eb 04                	jmp    b64 <runfree+0x34>
+     b60:	39 d8                	cmp    %ebx,%eax
+     b62:	73 09                	jae    b6d <runfree+0x3d>
+     b64:	89 c2                	mov    %eax,%edx
+     b66:	8b 40 14             	mov    0x14(%eax),%eax
+     b69:	85 c0                	test   %eax,%eax
+     b6b:	75 f3                	jne    b60 <runfree+0x30>
+    prev = *pp;
+  r->next = *pp;
+     b6d:	89 43 14             	mov    %eax,0x14(%ebx)
+  *pp = r;
+     b70:	89 5a 14             	mov    %ebx,0x14(%edx)
+
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+     b73:	8b 43 14             	mov    0x14(%ebx),%eax
+     b76:	85 c0                	test   %eax,%eax
+     b78:	74 12                	je     b8c <runfree+0x5c>
+     b7a:	8b 7b 04             	mov    0x4(%ebx),%edi
+     b7d:	89 fe                	mov    %edi,%esi
+     b7f:	c1 e6 0c             	shl    $0xc,%esi
+     b82:	01 de                	add    %ebx,%esi
+     b84:	39 f0                	cmp    %esi,%eax
+     b86:	0f 84 a4 00 00 00    	je     c30 <runfree+0x100>
+    r->npages += r->next->npages;
+    r->next = r->next->next;
+  }
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+     b8c:	8b 72 04             	mov    0x4(%edx),%esi
+     b8f:	89 f0                	mov    %esi,%eax
+     b91:	c1 e0 0c             	shl    $0xc,%eax
+     b94:	01 d0                	add    %edx,%eax
+     b96:	39 c3                	cmp    %eax,%ebx
+     b98:	74 16                	je     bb0 <runfree+0x80>
+    pp = &runs;
+    while(*pp != r)
+      pp = &(*pp)->next;
+  }
+
+  if(r->next == 0 && r->npages >= TRIM &&
+     b9a:	8b 43 14             	mov    0x14(%ebx),%eax
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+     b9d:	8d 72 14             	lea    0x14(%edx),%esi
+  if(r->next == 0 && r->npages >= TRIM &&
+     ba0:	85 c0                	test   %eax,%eax
+     ba2:	74 3c                	je     be0 <runfree+0xb0>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+    *pp = 0;
+    sbrk(-(int)(r->npages*PGSIZE));
+    heapend = (char*)r;
+  }
+}
+     ba4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ba7:	5b                   	pop    %ebx
+     ba8:	5e                   	pop    %esi
+     ba9:	5f                   	pop    %edi
+     baa:	5d                   	pop    %ebp
+     bab:	c3                   	ret
+     bac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    prev->npages += r->npages;
+     bb0:	03 73 04             	add    0x4(%ebx),%esi
+     bb3:	89 72 04             	mov    %esi,0x4(%edx)
+    prev->next = r->next;
+     bb6:	8b 43 14             	mov    0x14(%ebx),%eax
+     bb9:	89 42 14             	mov    %eax,0x14(%edx)
+    while(*pp != r)
+     bbc:	39 d1                	cmp    %edx,%ecx
+     bbe:	0f 84 c5 00 00 00    	je     c89 <runfree+0x159>
+     bc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      pp = &(*pp)->next;
+     bc8:	89 cb                	mov    %ecx,%ebx
+     bca:	8b 49 14             	mov    0x14(%ecx),%ecx
+    while(*pp != r)
+     bcd:	39 d1                	cmp    %edx,%ecx
+     bcf:	75 f7                	jne    bc8 <runfree+0x98>
+      pp = &(*pp)->next;
+     bd1:	8d 73 14             	lea    0x14(%ebx),%esi
+     bd4:	89 cb                	mov    %ecx,%ebx
+  if(r->next == 0 && r->npages >= TRIM &&
+     bd6:	85 c0                	test   %eax,%eax
+     bd8:	75 ca                	jne    ba4 <runfree+0x74>
+     bda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     be0:	8b 53 04             	mov    0x4(%ebx),%edx
+     be3:	83 fa 1f             	cmp    $0x1f,%edx
+     be6:	76 bc                	jbe    ba4 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+     be8:	c1 e2 0c             	shl    $0xc,%edx
+     beb:	01 da                	add    %ebx,%edx
+  if(r->next == 0 && r->npages >= TRIM &&
+     bed:	39 15 60 16 00 00    	cmp    %edx,0x1660
+     bf3:	75 af                	jne    ba4 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+     bf5:	83 ec 0c             	sub    $0xc,%esp
+     bf8:	6a 00                	push   $0x0
+     bfa:	e8 5c fc ff ff       	call   85b <sbrk>
+     bff:	83 c4 10             	add    $0x10,%esp
+     c02:	39 05 60 16 00 00    	cmp    %eax,0x1660
+     c08:	75 9a                	jne    ba4 <runfree+0x74>
+    *pp = 0;
+     c0a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    sbrk(-(int)(r->npages*PGSIZE));
+     c10:	8b 43 04             	mov    0x4(%ebx),%eax
+     c13:	83 ec 0c             	sub    $0xc,%esp
+     c16:	c1 e0 0c             	shl    $0xc,%eax
+     c19:	f7 d8                	neg    %eax
+     c1b:	50                   	push   %eax
+     c1c:	e8 3a fc ff ff       	call   85b <sbrk>
+    heapend = (char*)r;
+     c21:	89 1d 60 16 00 00    	mov    %ebx,0x1660
+     c27:	83 c4 10             	add    $0x10,%esp
+}
+     c2a:	e9 75 ff ff ff       	jmp    ba4 <runfree+0x74>
+     c2f:	90                   	nop
+    r->npages += r->next->npages;
+     c30:	03 78 04             	add    0x4(%eax),%edi
+     c33:	89 7b 04             	mov    %edi,0x4(%ebx)
+    r->next = r->next->next;
+     c36:	8b 40 14             	mov    0x14(%eax),%eax
+     c39:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+     c3c:	8b 72 04             	mov    0x4(%edx),%esi
+     c3f:	89 f0                	mov    %esi,%eax
+     c41:	c1 e0 0c             	shl    $0xc,%eax
+     c44:	01 d0                	add    %edx,%eax
+     c46:	39 c3                	cmp    %eax,%ebx
+     c48:	0f 85 4c ff ff ff    	jne    b9a <runfree+0x6a>
+     c4e:	e9 5d ff ff ff       	jmp    bb0 <runfree+0x80>
+  r->next = *pp;
+     c53:	89 48 14             	mov    %ecx,0x14(%eax)
+  *pp = r;
+     c56:	a3 64 16 00 00       	mov    %eax,0x1664
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+     c5b:	89 d0                	mov    %edx,%eax
+     c5d:	c1 e0 0c             	shl    $0xc,%eax
+     c60:	01 d8                	add    %ebx,%eax
+     c62:	39 c1                	cmp    %eax,%ecx
+     c64:	74 2f                	je     c95 <runfree+0x165>
+  if(r->next == 0 && r->npages >= TRIM &&
+     c66:	8b 43 14             	mov    0x14(%ebx),%eax
+     c69:	be 64 16 00 00       	mov    $0x1664,%esi
+     c6e:	e9 2d ff ff ff       	jmp    ba0 <runfree+0x70>
+  r->next = *pp;
+     c73:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+     c7a:	be 64 16 00 00       	mov    $0x1664,%esi
+  *pp = r;
+     c7f:	a3 64 16 00 00       	mov    %eax,0x1664
+  if(r->next == 0 && r->npages >= TRIM &&
+     c84:	e9 5a ff ff ff       	jmp    be3 <runfree+0xb3>
+    while(*pp != r)
+     c89:	89 cb                	mov    %ecx,%ebx
+    pp = &runs;
+     c8b:	be 64 16 00 00       	mov    $0x1664,%esi
+     c90:	e9 0b ff ff ff       	jmp    ba0 <runfree+0x70>
+    r->npages += r->next->npages;
+     c95:	03 51 04             	add    0x4(%ecx),%edx
+     c98:	89 53 04             	mov    %edx,0x4(%ebx)
+    r->next = r->next->next;
+     c9b:	8b 41 14             	mov    0x14(%ecx),%eax
+     c9e:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+     ca1:	eb c3                	jmp    c66 <runfree+0x136>
+     ca3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     caa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000cb0 <runalloc>:
+
+// Take a run of n pages from the start of the first free run
+// long enough, which keeps the end of the heap free to trim.
+static struct page*
+runalloc(uint n)
+{
+     cb0:	55                   	push   %ebp
+     cb1:	89 e5                	mov    %esp,%ebp
+     cb3:	57                   	push   %edi
+     cb4:	56                   	push   %esi
+     cb5:	89 c6                	mov    %eax,%esi
+     cb7:	53                   	push   %ebx
+     cb8:	83 ec 1c             	sub    $0x1c,%esp
+  struct page **pp, *r, *rest;
+
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+     cbb:	8b 1d 64 16 00 00    	mov    0x1664,%ebx
+     cc1:	85 db                	test   %ebx,%ebx
+     cc3:	74 4d                	je     d12 <runalloc+0x62>
+     cc5:	b9 64 16 00 00       	mov    $0x1664,%ecx
+    if(r->npages < n)
+     cca:	39 73 04             	cmp    %esi,0x4(%ebx)
+     ccd:	72 39                	jb     d08 <runalloc+0x58>
+      continue;
+    if(r->npages == n){
+     ccf:	0f 84 9b 00 00 00    	je     d70 <runalloc+0xc0>
+      *pp = r->next;
+    } else {
+      rest = (struct page*)((char*)r + n*PGSIZE);
+     cd5:	89 f0                	mov    %esi,%eax
+      rest->kind = PFREE;
+     cd7:	ba 03 00 00 00       	mov    $0x3,%edx
+      rest = (struct page*)((char*)r + n*PGSIZE);
+     cdc:	c1 e0 0c             	shl    $0xc,%eax
+     cdf:	01 d8                	add    %ebx,%eax
+      rest->kind = PFREE;
+     ce1:	66 89 10             	mov    %dx,(%eax)
+      rest->npages = r->npages - n;
+     ce4:	8b 53 04             	mov    0x4(%ebx),%edx
+     ce7:	29 f2                	sub    %esi,%edx
+     ce9:	89 50 04             	mov    %edx,0x4(%eax)
+      rest->next = r->next;
+     cec:	8b 53 14             	mov    0x14(%ebx),%edx
+     cef:	89 50 14             	mov    %edx,0x14(%eax)
+      *pp = rest;
+     cf2:	89 01                	mov    %eax,(%ecx)
+      r->npages = n;
+     cf4:	89 73 04             	mov    %esi,0x4(%ebx)
+    }
+    return r;
+  }
+  return morecore(n);
+}
+     cf7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cfa:	89 d8                	mov    %ebx,%eax
+     cfc:	5b                   	pop    %ebx
+     cfd:	5e                   	pop    %esi
+     cfe:	5f                   	pop    %edi
+     cff:	5d                   	pop    %ebp
+     d00:	c3                   	ret
+     d01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+     d08:	8d 4b 14             	lea    0x14(%ebx),%ecx
+     d0b:	8b 5b 14             	mov    0x14(%ebx),%ebx
+     d0e:	85 db                	test   %ebx,%ebx
+     d10:	75 b8                	jne    cca <runalloc+0x1a>
+  m = n < MINCORE ? MINCORE : n;
+     d12:	bf 08 00 00 00       	mov    $0x8,%edi
+     d17:	39 fe                	cmp    %edi,%esi
+     d19:	0f 43 fe             	cmovae %esi,%edi
+  brk = sbrk(0);
+     d1c:	83 ec 0c             	sub    $0xc,%esp
+     d1f:	6a 00                	push   $0x0
+     d21:	e8 35 fb ff ff       	call   85b <sbrk>
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+     d26:	89 fa                	mov    %edi,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+     d28:	89 c3                	mov    %eax,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+     d2a:	c1 e2 0c             	shl    $0xc,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+     d2d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     d30:	f7 db                	neg    %ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+     d32:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+     d35:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+     d3b:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+     d3e:	89 04 24             	mov    %eax,(%esp)
+     d41:	e8 15 fb ff ff       	call   85b <sbrk>
+     d46:	83 c4 10             	add    $0x10,%esp
+     d49:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     d4c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     d4f:	83 f8 ff             	cmp    $0xffffffff,%eax
+     d52:	74 3e                	je     d92 <runalloc+0xe2>
+  r = (struct page*)(brk + pad);
+     d54:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+     d56:	01 da                	add    %ebx,%edx
+     d58:	89 15 60 16 00 00    	mov    %edx,0x1660
+  if(m > n)
+     d5e:	39 fe                	cmp    %edi,%esi
+     d60:	72 1e                	jb     d80 <runalloc+0xd0>
+  r->npages = n;
+     d62:	89 73 04             	mov    %esi,0x4(%ebx)
+  return r;
+     d65:	eb 90                	jmp    cf7 <runalloc+0x47>
+     d67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d6e:	66 90                	xchg   %ax,%ax
+      *pp = r->next;
+     d70:	8b 43 14             	mov    0x14(%ebx),%eax
+     d73:	89 01                	mov    %eax,(%ecx)
+}
+     d75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d78:	89 d8                	mov    %ebx,%eax
+     d7a:	5b                   	pop    %ebx
+     d7b:	5e                   	pop    %esi
+     d7c:	5f                   	pop    %edi
+     d7d:	5d                   	pop    %ebp
+     d7e:	c3                   	ret
+     d7f:	90                   	nop
+    runfree((struct page*)((char*)r + n*PGSIZE), m - n);
+     d80:	89 f0                	mov    %esi,%eax
+     d82:	29 f7                	sub    %esi,%edi
+     d84:	c1 e0 0c             	shl    $0xc,%eax
+     d87:	89 fa                	mov    %edi,%edx
+     d89:	01 d8                	add    %ebx,%eax
+     d8b:	e8 a0 fd ff ff       	call   b30 <runfree>
+     d90:	eb d0                	jmp    d62 <runalloc+0xb2>
+    if(sbrk(pad + m*PGSIZE) == (char*)-1)
+     d92:	89 f7                	mov    %esi,%edi
+     d94:	83 ec 0c             	sub    $0xc,%esp
+     d97:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+     d9a:	c1 e7 0c             	shl    $0xc,%edi
+     d9d:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+     da0:	50                   	push   %eax
+     da1:	e8 b5 fa ff ff       	call   85b <sbrk>
+     da6:	83 c4 10             	add    $0x10,%esp
+     da9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     dac:	83 f8 ff             	cmp    $0xffffffff,%eax
+     daf:	74 0c                	je     dbd <runalloc+0x10d>
+  r = (struct page*)(brk + pad);
+     db1:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+     db3:	01 df                	add    %ebx,%edi
+     db5:	89 3d 60 16 00 00    	mov    %edi,0x1660
+  if(m > n)
+     dbb:	eb a5                	jmp    d62 <runalloc+0xb2>
+      return 0;
+     dbd:	31 db                	xor    %ebx,%ebx
+     dbf:	e9 33 ff ff ff       	jmp    cf7 <runalloc+0x47>
+     dc4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dcb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     dcf:	90                   	nop
+
+00000dd0 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+     dd0:	55                   	push   %ebp
+     dd1:	89 e5                	mov    %esp,%ebp
+     dd3:	56                   	push   %esi
+     dd4:	53                   	push   %ebx
+     dd5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  struct page *p;
+
+  if(ap == 0)
+     dd8:	85 c9                	test   %ecx,%ecx
+     dda:	74 1c                	je     df8 <free+0x28>
+    return;
+  p = (struct page*)((uint)ap & ~(PGSIZE-1));
+     ddc:	89 c8                	mov    %ecx,%eax
+     dde:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  switch(p->kind){
+     de3:	0f b7 10             	movzwl (%eax),%edx
+     de6:	66 83 fa 02          	cmp    $0x2,%dx
+     dea:	74 14                	je     e00 <free+0x30>
+     dec:	66 83 fa 04          	cmp    $0x4,%dx
+     df0:	74 66                	je     e58 <free+0x88>
+     df2:	66 83 fa 01          	cmp    $0x1,%dx
+     df6:	74 18                	je     e10 <free+0x40>
+    break;
+  case PMAP:
+    munmap(p, p->npages*PGSIZE);
+    break;
+  }
+}
+     df8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     dfb:	5b                   	pop    %ebx
+     dfc:	5e                   	pop    %esi
+     dfd:	5d                   	pop    %ebp
+     dfe:	c3                   	ret
+     dff:	90                   	nop
+    runfree(p, p->npages);
+     e00:	8b 50 04             	mov    0x4(%eax),%edx
+}
+     e03:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e06:	5b                   	pop    %ebx
+     e07:	5e                   	pop    %esi
+     e08:	5d                   	pop    %ebp
+    runfree(p, p->npages);
+     e09:	e9 22 fd ff ff       	jmp    b30 <runfree>
+     e0e:	66 90                	xchg   %ax,%ax
+  b->next = p->free;
+     e10:	8b 50 0c             	mov    0xc(%eax),%edx
+     e13:	89 11                	mov    %edx,(%ecx)
+  if(p->nfree++ == 0)
+     e15:	8b 50 08             	mov    0x8(%eax),%edx
+  p->free = b;
+     e18:	89 48 0c             	mov    %ecx,0xc(%eax)
+  if(p->nfree++ == 0)
+     e1b:	8d 5a 01             	lea    0x1(%edx),%ebx
+     e1e:	89 58 08             	mov    %ebx,0x8(%eax)
+     e21:	85 d2                	test   %edx,%edx
+     e23:	74 53                	je     e78 <free+0xa8>
+  if(p->nfree == nblocks(p->class)){
+     e25:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+     e29:	8d 4e 04             	lea    0x4(%esi),%ecx
+     e2c:	ba e0 0f 00 00       	mov    $0xfe0,%edx
+     e31:	d3 fa                	sar    %cl,%edx
+  if(p->nfree == nblocks(p->class)){
+     e33:	39 da                	cmp    %ebx,%edx
+     e35:	75 c1                	jne    df8 <free+0x28>
+  if(p->prev)
+     e37:	8b 48 18             	mov    0x18(%eax),%ecx
+    p->prev->next = p->next;
+     e3a:	8b 50 14             	mov    0x14(%eax),%edx
+  if(p->prev)
+     e3d:	85 c9                	test   %ecx,%ecx
+     e3f:	74 6f                	je     eb0 <free+0xe0>
+    p->prev->next = p->next;
+     e41:	89 51 14             	mov    %edx,0x14(%ecx)
+  if(p->next)
+     e44:	85 d2                	test   %edx,%edx
+     e46:	74 06                	je     e4e <free+0x7e>
+    p->next->prev = p->prev;
+     e48:	8b 48 18             	mov    0x18(%eax),%ecx
+     e4b:	89 4a 18             	mov    %ecx,0x18(%edx)
+    runfree(p, 1);
+     e4e:	ba 01 00 00 00       	mov    $0x1,%edx
+     e53:	eb ae                	jmp    e03 <free+0x33>
+     e55:	8d 76 00             	lea    0x0(%esi),%esi
+    munmap(p, p->npages*PGSIZE);
+     e58:	8b 50 04             	mov    0x4(%eax),%edx
+     e5b:	83 ec 08             	sub    $0x8,%esp
+     e5e:	c1 e2 0c             	shl    $0xc,%edx
+     e61:	52                   	push   %edx
+     e62:	50                   	push   %eax
+     e63:	e8 1b fa ff ff       	call   883 <munmap>
+    break;
+     e68:	83 c4 10             	add    $0x10,%esp
+}
+     e6b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e6e:	5b                   	pop    %ebx
+     e6f:	5e                   	pop    %esi
+     e70:	5d                   	pop    %ebp
+     e71:	c3                   	ret
+     e72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  p->next = partial[p->class];
+     e78:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  p->prev = 0;
+     e7c:	c7 40 18 00 00 00 00 	movl   $0x0,0x18(%eax)
+  p->next = partial[p->class];
+     e83:	bb 01 00 00 00       	mov    $0x1,%ebx
+     e88:	8b 14 b5 68 16 00 00 	mov    0x1668(,%esi,4),%edx
+     e8f:	89 50 14             	mov    %edx,0x14(%eax)
+  if(p->next)
+     e92:	85 d2                	test   %edx,%edx
+     e94:	74 0a                	je     ea0 <free+0xd0>
+    p->next->prev = p;
+     e96:	89 42 18             	mov    %eax,0x18(%edx)
+  partial[p->class] = p;
+     e99:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  if(p->nfree == nblocks(p->class)){
+     e9d:	8b 58 08             	mov    0x8(%eax),%ebx
+  partial[p->class] = p;
+     ea0:	89 04 b5 68 16 00 00 	mov    %eax,0x1668(,%esi,4)
+}
+     ea7:	eb 80                	jmp    e29 <free+0x59>
+     ea9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+     eb0:	89 14 b5 68 16 00 00 	mov    %edx,0x1668(,%esi,4)
+     eb7:	eb 8b                	jmp    e44 <free+0x74>
+     eb9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000ec0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     ec0:	55                   	push   %ebp
+     ec1:	89 e5                	mov    %esp,%ebp
+     ec3:	56                   	push   %esi
+     ec4:	53                   	push   %ebx
+     ec5:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct page *p;
+  uint n;
+
+  if(nbytes <= MAXSMALL)
+     ec8:	3d 00 04 00 00       	cmp    $0x400,%eax
+     ecd:	76 71                	jbe    f40 <malloc+0x80>
+    return smallalloc(sizeclass(nbytes));
+  if(nbytes > 0x7fffffff)
+     ecf:	85 c0                	test   %eax,%eax
+     ed1:	0f 88 d9 00 00 00    	js     fb0 <malloc+0xf0>
+    return 0;
+  n = (nbytes + HDRSIZE + PGSIZE-1) / PGSIZE;
+     ed7:	8d 90 1f 10 00 00    	lea    0x101f(%eax),%edx
+     edd:	89 d3                	mov    %edx,%ebx
+     edf:	c1 eb 0c             	shr    $0xc,%ebx
+  if(nbytes >= MAPMIN){
+     ee2:	3d ff ff 00 00       	cmp    $0xffff,%eax
+     ee7:	77 27                	ja     f10 <malloc+0x50>
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    if(p == MAP_FAILED)
+      return 0;
+    p->kind = PMAP;
+  } else {
+    if((p = runalloc(n)) == 0)
+     ee9:	89 d8                	mov    %ebx,%eax
+     eeb:	e8 c0 fd ff ff       	call   cb0 <runalloc>
+     ef0:	85 c0                	test   %eax,%eax
+     ef2:	0f 84 b8 00 00 00    	je     fb0 <malloc+0xf0>
+      return 0;
+    p->kind = PRUN;
+     ef8:	ba 02 00 00 00       	mov    $0x2,%edx
+     efd:	66 89 10             	mov    %dx,(%eax)
+  }
+  p->npages = n;
+     f00:	89 58 04             	mov    %ebx,0x4(%eax)
+  return (char*)p + HDRSIZE;
+     f03:	8d 58 20             	lea    0x20(%eax),%ebx
+}
+     f06:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f09:	89 d8                	mov    %ebx,%eax
+     f0b:	5b                   	pop    %ebx
+     f0c:	5e                   	pop    %esi
+     f0d:	5d                   	pop    %ebp
+     f0e:	c3                   	ret
+     f0f:	90                   	nop
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+     f10:	83 ec 08             	sub    $0x8,%esp
+     f13:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+     f19:	6a 00                	push   $0x0
+     f1b:	6a ff                	push   $0xffffffff
+     f1d:	6a 22                	push   $0x22
+     f1f:	6a 03                	push   $0x3
+     f21:	52                   	push   %edx
+     f22:	6a 00                	push   $0x0
+     f24:	e8 52 f9 ff ff       	call   87b <mmap>
+    if(p == MAP_FAILED)
+     f29:	83 c4 20             	add    $0x20,%esp
+     f2c:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f2f:	74 7f                	je     fb0 <malloc+0xf0>
+    p->kind = PMAP;
+     f31:	b9 04 00 00 00       	mov    $0x4,%ecx
+     f36:	66 89 08             	mov    %cx,(%eax)
+     f39:	eb c5                	jmp    f00 <malloc+0x40>
+     f3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f3f:	90                   	nop
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+     f40:	83 f8 10             	cmp    $0x10,%eax
+     f43:	0f 86 07 01 00 00    	jbe    1050 <malloc+0x190>
+     f49:	31 db                	xor    %ebx,%ebx
+     f4b:	ba 10 00 00 00       	mov    $0x10,%edx
+     f50:	83 c3 01             	add    $0x1,%ebx
+     f53:	89 d6                	mov    %edx,%esi
+     f55:	89 d9                	mov    %ebx,%ecx
+     f57:	d3 e6                	shl    %cl,%esi
+     f59:	39 c6                	cmp    %eax,%esi
+     f5b:	72 f3                	jb     f50 <malloc+0x90>
+  if((p = partial[c]) == 0){
+     f5d:	8b 14 9d 68 16 00 00 	mov    0x1668(,%ebx,4),%edx
+     f64:	85 d2                	test   %edx,%edx
+     f66:	74 58                	je     fc0 <malloc+0x100>
+  if((b = p->free) != 0){
+     f68:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+     f6b:	8b 4a 08             	mov    0x8(%edx),%ecx
+  if((b = p->free) != 0){
+     f6e:	85 db                	test   %ebx,%ebx
+     f70:	0f 84 aa 00 00 00    	je     1020 <malloc+0x160>
+    p->free = b->next;
+     f76:	8b 03                	mov    (%ebx),%eax
+     f78:	89 42 0c             	mov    %eax,0xc(%edx)
+  if(--p->nfree == 0)
+     f7b:	83 e9 01             	sub    $0x1,%ecx
+     f7e:	89 4a 08             	mov    %ecx,0x8(%edx)
+     f81:	75 83                	jne    f06 <malloc+0x46>
+  if(p->prev)
+     f83:	8b 4a 18             	mov    0x18(%edx),%ecx
+    p->prev->next = p->next;
+     f86:	8b 42 14             	mov    0x14(%edx),%eax
+  if(p->prev)
+     f89:	85 c9                	test   %ecx,%ecx
+     f8b:	0f 84 cf 00 00 00    	je     1060 <malloc+0x1a0>
+    p->prev->next = p->next;
+     f91:	89 41 14             	mov    %eax,0x14(%ecx)
+  if(p->next)
+     f94:	85 c0                	test   %eax,%eax
+     f96:	0f 84 6a ff ff ff    	je     f06 <malloc+0x46>
+    p->next->prev = p->prev;
+     f9c:	8b 52 18             	mov    0x18(%edx),%edx
+     f9f:	89 50 18             	mov    %edx,0x18(%eax)
+     fa2:	e9 5f ff ff ff       	jmp    f06 <malloc+0x46>
+     fa7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fae:	66 90                	xchg   %ax,%ax
+}
+     fb0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+     fb3:	31 db                	xor    %ebx,%ebx
+}
+     fb5:	89 d8                	mov    %ebx,%eax
+     fb7:	5b                   	pop    %ebx
+     fb8:	5e                   	pop    %esi
+     fb9:	5d                   	pop    %ebp
+     fba:	c3                   	ret
+     fbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     fbf:	90                   	nop
+    if((p = runalloc(1)) == 0)
+     fc0:	b8 01 00 00 00       	mov    $0x1,%eax
+     fc5:	e8 e6 fc ff ff       	call   cb0 <runalloc>
+     fca:	89 c2                	mov    %eax,%edx
+     fcc:	85 c0                	test   %eax,%eax
+     fce:	74 e0                	je     fb0 <malloc+0xf0>
+    p->kind = PSMALL;
+     fd0:	b8 01 00 00 00       	mov    $0x1,%eax
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+     fd5:	8d 4b 04             	lea    0x4(%ebx),%ecx
+    p->class = c;
+     fd8:	66 89 5a 02          	mov    %bx,0x2(%edx)
+     fdc:	0f b7 db             	movzwl %bx,%ebx
+    p->kind = PSMALL;
+     fdf:	66 89 02             	mov    %ax,(%edx)
+    p->fresh = (char*)p + HDRSIZE;
+     fe2:	8d 42 20             	lea    0x20(%edx),%eax
+     fe5:	89 42 10             	mov    %eax,0x10(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+     fe8:	b8 e0 0f 00 00       	mov    $0xfe0,%eax
+     fed:	d3 f8                	sar    %cl,%eax
+    p->free = 0;
+     fef:	c7 42 0c 00 00 00 00 	movl   $0x0,0xc(%edx)
+    p->nfree = nblocks(c);
+     ff6:	89 42 08             	mov    %eax,0x8(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+     ff9:	89 c1                	mov    %eax,%ecx
+  p->next = partial[p->class];
+     ffb:	8b 04 9d 68 16 00 00 	mov    0x1668(,%ebx,4),%eax
+  p->prev = 0;
+    1002:	c7 42 18 00 00 00 00 	movl   $0x0,0x18(%edx)
+  p->next = partial[p->class];
+    1009:	89 42 14             	mov    %eax,0x14(%edx)
+  if(p->next)
+    100c:	85 c0                	test   %eax,%eax
+    100e:	75 20                	jne    1030 <malloc+0x170>
+  partial[p->class] = p;
+    1010:	89 14 9d 68 16 00 00 	mov    %edx,0x1668(,%ebx,4)
+  if((b = p->free) != 0){
+    1017:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    101e:	66 90                	xchg   %ax,%ax
+    b = (struct block*)p->fresh;
+    1020:	8b 5a 10             	mov    0x10(%edx),%ebx
+    p->fresh += MINSMALL << c;
+    1023:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+    1026:	89 42 10             	mov    %eax,0x10(%edx)
+    1029:	e9 4d ff ff ff       	jmp    f7b <malloc+0xbb>
+    102e:	66 90                	xchg   %ax,%ax
+    p->next->prev = p;
+    1030:	89 50 18             	mov    %edx,0x18(%eax)
+  partial[p->class] = p;
+    1033:	0f b7 42 02          	movzwl 0x2(%edx),%eax
+  if((b = p->free) != 0){
+    1037:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+    103a:	8b 4a 08             	mov    0x8(%edx),%ecx
+  partial[p->class] = p;
+    103d:	89 14 85 68 16 00 00 	mov    %edx,0x1668(,%eax,4)
+}
+    1044:	e9 25 ff ff ff       	jmp    f6e <malloc+0xae>
+    1049:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+    1050:	be 10 00 00 00       	mov    $0x10,%esi
+    1055:	31 db                	xor    %ebx,%ebx
+    1057:	e9 01 ff ff ff       	jmp    f5d <malloc+0x9d>
+    105c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+    1060:	0f b7 4a 02          	movzwl 0x2(%edx),%ecx
+    1064:	89 04 8d 68 16 00 00 	mov    %eax,0x1668(,%ecx,4)
+    106b:	e9 24 ff ff ff       	jmp    f94 <malloc+0xd4>
@@ -0,0 +1,1927 @@
+
+_readbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return uptime() - start;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	8d 75 dd             	lea    -0x23(%ebp),%esi
+  12:	53                   	push   %ebx
+  char path[] = "readbench0";
+  13:	bb 04 00 00 00       	mov    $0x4,%ebx
+{
+  18:	51                   	push   %ecx
+  19:	83 ec 28             	sub    $0x28,%esp
+  char path[] = "readbench0";
+  1c:	c7 45 e1 62 65 6e 63 	movl   $0x636e6562,-0x1f(%ebp)
+  23:	c7 45 dd 72 65 61 64 	movl   $0x64616572,-0x23(%ebp)
+  2a:	c7 45 e4 63 68 30 00 	movl   $0x306863,-0x1c(%ebp)
+  int i, n, ticks;
+
+  for(i = 0; i < MAXREADER; i++){
+    mkfile(path);
+  31:	83 ec 0c             	sub    $0xc,%esp
+  34:	56                   	push   %esi
+  35:	e8 76 00 00 00       	call   b0 <mkfile>
+    path[9]++;
+  3a:	80 45 e6 01          	addb   $0x1,-0x1a(%ebp)
+  for(i = 0; i < MAXREADER; i++){
+  3e:	83 c4 10             	add    $0x10,%esp
+  41:	83 eb 01             	sub    $0x1,%ebx
+  44:	75 eb                	jne    31 <main+0x31>
+  46:	c7 45 d4 03 00 00 00 	movl   $0x3,-0x2c(%ebp)
+  }
+  for(n = 1; n <= MAXREADER; n *= 2){
+  4d:	bb 01 00 00 00       	mov    $0x1,%ebx
+    ticks = run(n);
+  52:	83 ec 0c             	sub    $0xc,%esp
+    printf(1, "%d readers: %d block reads in %d ticks, %d reads/tick\n",
+           n, n*NPASS*NBLK, ticks, n*NPASS*NBLK / (ticks ? ticks : 1));
+  55:	69 fb 40 1f 00 00    	imul   $0x1f40,%ebx,%edi
+    ticks = run(n);
+  5b:	53                   	push   %ebx
+  5c:	e8 4f 01 00 00       	call   1b0 <run>
+           n, n*NPASS*NBLK, ticks, n*NPASS*NBLK / (ticks ? ticks : 1));
+  61:	83 c4 10             	add    $0x10,%esp
+    ticks = run(n);
+  64:	89 c1                	mov    %eax,%ecx
+    printf(1, "%d readers: %d block reads in %d ticks, %d reads/tick\n",
+  66:	89 f8                	mov    %edi,%eax
+           n, n*NPASS*NBLK, ticks, n*NPASS*NBLK / (ticks ? ticks : 1));
+  68:	85 c9                	test   %ecx,%ecx
+  6a:	74 03                	je     6f <main+0x6f>
+    printf(1, "%d readers: %d block reads in %d ticks, %d reads/tick\n",
+  6c:	99                   	cltd
+  6d:	f7 f9                	idiv   %ecx
+  6f:	83 ec 08             	sub    $0x8,%esp
+  72:	50                   	push   %eax
+  73:	51                   	push   %ecx
+  74:	57                   	push   %edi
+  75:	53                   	push   %ebx
+  for(n = 1; n <= MAXREADER; n *= 2){
+  76:	01 db                	add    %ebx,%ebx
+    printf(1, "%d readers: %d block reads in %d ticks, %d reads/tick\n",
+  78:	68 88 0d 00 00       	push   $0xd88
+  7d:	6a 01                	push   $0x1
+  7f:	e8 dc 05 00 00       	call   660 <printf>
+  for(n = 1; n <= MAXREADER; n *= 2){
+  84:	83 c4 20             	add    $0x20,%esp
+  87:	83 6d d4 01          	subl   $0x1,-0x2c(%ebp)
+  8b:	75 c5                	jne    52 <main+0x52>
+  }
+  path[9] = '0';
+  8d:	c6 45 e6 30          	movb   $0x30,-0x1a(%ebp)
+  91:	bb 04 00 00 00       	mov    $0x4,%ebx
+  for(i = 0; i < MAXREADER; i++){
+    unlink(path);
+  96:	83 ec 0c             	sub    $0xc,%esp
+  99:	56                   	push   %esi
+  9a:	e8 64 04 00 00       	call   503 <unlink>
+    path[9]++;
+  9f:	80 45 e6 01          	addb   $0x1,-0x1a(%ebp)
+  for(i = 0; i < MAXREADER; i++){
+  a3:	83 c4 10             	add    $0x10,%esp
+  a6:	83 eb 01             	sub    $0x1,%ebx
+  a9:	75 eb                	jne    96 <main+0x96>
+  }
+  exit();
+  ab:	e8 03 04 00 00       	call   4b3 <exit>
+
+000000b0 <mkfile>:
+{
+  b0:	55                   	push   %ebp
+  b1:	89 e5                	mov    %esp,%ebp
+  b3:	56                   	push   %esi
+  b4:	53                   	push   %ebx
+  b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((fd = open(path, O_CREATE | O_RDWR)) < 0){
+  b8:	83 ec 08             	sub    $0x8,%esp
+  bb:	68 02 02 00 00       	push   $0x202
+  c0:	53                   	push   %ebx
+  c1:	e8 2d 04 00 00       	call   4f3 <open>
+  c6:	83 c4 10             	add    $0x10,%esp
+  c9:	85 c0                	test   %eax,%eax
+  cb:	78 47                	js     114 <mkfile+0x64>
+  memset(data, 'r', sizeof(data));
+  cd:	83 ec 04             	sub    $0x4,%esp
+  d0:	89 c6                	mov    %eax,%esi
+  d2:	bb 04 00 00 00       	mov    $0x4,%ebx
+  d7:	68 00 02 00 00       	push   $0x200
+  dc:	6a 72                	push   $0x72
+  de:	68 e0 11 00 00       	push   $0x11e0
+  e3:	e8 08 02 00 00       	call   2f0 <memset>
+  e8:	83 c4 10             	add    $0x10,%esp
+    write(fd, data, sizeof(data));
+  eb:	83 ec 04             	sub    $0x4,%esp
+  ee:	68 00 02 00 00       	push   $0x200
+  f3:	68 e0 11 00 00       	push   $0x11e0
+  f8:	56                   	push   %esi
+  f9:	e8 d5 03 00 00       	call   4d3 <write>
+  for(i = 0; i < NBLK; i++)
+  fe:	83 c4 10             	add    $0x10,%esp
+ 101:	83 eb 01             	sub    $0x1,%ebx
+ 104:	75 e5                	jne    eb <mkfile+0x3b>
+  close(fd);
+ 106:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+ 109:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 10c:	5b                   	pop    %ebx
+ 10d:	5e                   	pop    %esi
+ 10e:	5d                   	pop    %ebp
+  close(fd);
+ 10f:	e9 c7 03 00 00       	jmp    4db <close>
+    printf(1, "readbench: cannot create %s\n", path);
+ 114:	50                   	push   %eax
+ 115:	53                   	push   %ebx
+ 116:	68 50 0d 00 00       	push   $0xd50
+ 11b:	6a 01                	push   $0x1
+ 11d:	e8 3e 05 00 00       	call   660 <printf>
+    exit();
+ 122:	e8 8c 03 00 00       	call   4b3 <exit>
+ 127:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12e:	66 90                	xchg   %ax,%ax
+
+00000130 <reader>:
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	57                   	push   %edi
+ 134:	bf d0 07 00 00       	mov    $0x7d0,%edi
+ 139:	56                   	push   %esi
+ 13a:	53                   	push   %ebx
+ 13b:	83 ec 0c             	sub    $0xc,%esp
+ 13e:	66 90                	xchg   %ax,%ax
+    if((fd = open(path, O_RDONLY)) < 0){
+ 140:	83 ec 08             	sub    $0x8,%esp
+ 143:	6a 00                	push   $0x0
+ 145:	ff 75 08             	push   0x8(%ebp)
+ 148:	e8 a6 03 00 00       	call   4f3 <open>
+ 14d:	83 c4 10             	add    $0x10,%esp
+ 150:	89 c6                	mov    %eax,%esi
+ 152:	85 c0                	test   %eax,%eax
+ 154:	78 39                	js     18f <reader+0x5f>
+ 156:	bb 04 00 00 00       	mov    $0x4,%ebx
+      read(fd, data, sizeof(data));
+ 15b:	83 ec 04             	sub    $0x4,%esp
+ 15e:	68 00 02 00 00       	push   $0x200
+ 163:	68 e0 11 00 00       	push   $0x11e0
+ 168:	56                   	push   %esi
+ 169:	e8 5d 03 00 00       	call   4cb <read>
+    for(j = 0; j < NBLK; j++)
+ 16e:	83 c4 10             	add    $0x10,%esp
+ 171:	83 eb 01             	sub    $0x1,%ebx
+ 174:	75 e5                	jne    15b <reader+0x2b>
+    close(fd);
+ 176:	83 ec 0c             	sub    $0xc,%esp
+ 179:	56                   	push   %esi
+ 17a:	e8 5c 03 00 00       	call   4db <close>
+  for(i = 0; i < NPASS; i++){
+ 17f:	83 c4 10             	add    $0x10,%esp
+ 182:	83 ef 01             	sub    $0x1,%edi
+ 185:	75 b9                	jne    140 <reader+0x10>
+}
+ 187:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 18a:	5b                   	pop    %ebx
+ 18b:	5e                   	pop    %esi
+ 18c:	5f                   	pop    %edi
+ 18d:	5d                   	pop    %ebp
+ 18e:	c3                   	ret
+      printf(1, "readbench: cannot open %s\n", path);
+ 18f:	83 ec 04             	sub    $0x4,%esp
+ 192:	ff 75 08             	push   0x8(%ebp)
+ 195:	68 6d 0d 00 00       	push   $0xd6d
+ 19a:	6a 01                	push   $0x1
+ 19c:	e8 bf 04 00 00       	call   660 <printf>
+      exit();
+ 1a1:	e8 0d 03 00 00       	call   4b3 <exit>
+ 1a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001b0 <run>:
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	57                   	push   %edi
+ 1b4:	56                   	push   %esi
+ 1b5:	53                   	push   %ebx
+ 1b6:	83 ec 1c             	sub    $0x1c,%esp
+ 1b9:	8b 75 08             	mov    0x8(%ebp),%esi
+  char path[] = "readbench0";
+ 1bc:	c7 45 e1 62 65 6e 63 	movl   $0x636e6562,-0x1f(%ebp)
+ 1c3:	c7 45 dd 72 65 61 64 	movl   $0x64616572,-0x23(%ebp)
+ 1ca:	c7 45 e4 63 68 30 00 	movl   $0x306863,-0x1c(%ebp)
+  start = uptime();
+ 1d1:	e8 75 03 00 00       	call   54b <uptime>
+ 1d6:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < nreader; i++){
+ 1d8:	85 f6                	test   %esi,%esi
+ 1da:	7e 2a                	jle    206 <run+0x56>
+ 1dc:	31 db                	xor    %ebx,%ebx
+ 1de:	eb 02                	jmp    1e2 <run+0x32>
+ 1e0:	89 c3                	mov    %eax,%ebx
+    if(fork() == 0){
+ 1e2:	e8 c4 02 00 00       	call   4ab <fork>
+ 1e7:	85 c0                	test   %eax,%eax
+ 1e9:	74 2a                	je     215 <run+0x65>
+  for(i = 0; i < nreader; i++){
+ 1eb:	8d 43 01             	lea    0x1(%ebx),%eax
+ 1ee:	39 c6                	cmp    %eax,%esi
+ 1f0:	75 ee                	jne    1e0 <run+0x30>
+  for(i = 0; i < nreader; i++)
+ 1f2:	31 f6                	xor    %esi,%esi
+ 1f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    wait();
+ 1f8:	e8 be 02 00 00       	call   4bb <wait>
+  for(i = 0; i < nreader; i++)
+ 1fd:	89 f0                	mov    %esi,%eax
+ 1ff:	83 c6 01             	add    $0x1,%esi
+ 202:	39 c3                	cmp    %eax,%ebx
+ 204:	75 f2                	jne    1f8 <run+0x48>
+  return uptime() - start;
+ 206:	e8 40 03 00 00       	call   54b <uptime>
+}
+ 20b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 20e:	5b                   	pop    %ebx
+  return uptime() - start;
+ 20f:	29 f8                	sub    %edi,%eax
+}
+ 211:	5e                   	pop    %esi
+ 212:	5f                   	pop    %edi
+ 213:	5d                   	pop    %ebp
+ 214:	c3                   	ret
+      reader(path);
+ 215:	83 ec 0c             	sub    $0xc,%esp
+ 218:	8d 45 dd             	lea    -0x23(%ebp),%eax
+      path[9] += i;
+ 21b:	00 5d e6             	add    %bl,-0x1a(%ebp)
+      reader(path);
+ 21e:	50                   	push   %eax
+ 21f:	e8 0c ff ff ff       	call   130 <reader>
+      exit();
+ 224:	e8 8a 02 00 00       	call   4b3 <exit>
+ 229:	66 90                	xchg   %ax,%ax
+ 22b:	66 90                	xchg   %ax,%ax
+ 22d:	66 90                	xchg   %ax,%ax
+ 22f:	90                   	nop
+
+00000230 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 230:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 231:	31 c0                	xor    %eax,%eax
+{
+ 233:	89 e5                	mov    %esp,%ebp
+ 235:	53                   	push   %ebx
+ 236:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 239:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 23c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 240:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 244:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 247:	83 c0 01             	add    $0x1,%eax
+ 24a:	84 d2                	test   %dl,%dl
+ 24c:	75 f2                	jne    240 <strcpy+0x10>
+    ;
+  return os;
+}
+ 24e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 251:	89 c8                	mov    %ecx,%eax
+ 253:	c9                   	leave
+ 254:	c3                   	ret
+ 255:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	53                   	push   %ebx
+ 264:	8b 55 08             	mov    0x8(%ebp),%edx
+ 267:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 26a:	0f b6 02             	movzbl (%edx),%eax
+ 26d:	84 c0                	test   %al,%al
+ 26f:	75 17                	jne    288 <strcmp+0x28>
+ 271:	eb 3a                	jmp    2ad <strcmp+0x4d>
+ 273:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 277:	90                   	nop
+ 278:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 27c:	83 c2 01             	add    $0x1,%edx
+ 27f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 282:	84 c0                	test   %al,%al
+ 284:	74 1a                	je     2a0 <strcmp+0x40>
+    p++, q++;
+ 286:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 288:	0f b6 19             	movzbl (%ecx),%ebx
+ 28b:	38 c3                	cmp    %al,%bl
+ 28d:	74 e9                	je     278 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 28f:	29 d8                	sub    %ebx,%eax
+}
+ 291:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 294:	c9                   	leave
+ 295:	c3                   	ret
+ 296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2a4:	31 c0                	xor    %eax,%eax
+ 2a6:	29 d8                	sub    %ebx,%eax
+}
+ 2a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2ab:	c9                   	leave
+ 2ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2ad:	0f b6 19             	movzbl (%ecx),%ebx
+ 2b0:	31 c0                	xor    %eax,%eax
+ 2b2:	eb db                	jmp    28f <strcmp+0x2f>
+ 2b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2bf:	90                   	nop
+
+000002c0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2c6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 2c9:	74 15                	je     2e0 <strlen+0x20>
+ 2cb:	31 c0                	xor    %eax,%eax
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+ 2d0:	83 c0 01             	add    $0x1,%eax
+ 2d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 2d7:	89 c1                	mov    %eax,%ecx
+ 2d9:	75 f5                	jne    2d0 <strlen+0x10>
+    ;
+  return n;
+}
+ 2db:	89 c8                	mov    %ecx,%eax
+ 2dd:	5d                   	pop    %ebp
+ 2de:	c3                   	ret
+ 2df:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 2e0:	31 c9                	xor    %ecx,%ecx
+}
+ 2e2:	5d                   	pop    %ebp
+ 2e3:	89 c8                	mov    %ecx,%eax
+ 2e5:	c3                   	ret
+ 2e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	57                   	push   %edi
+ 2f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2fd:	89 d7                	mov    %edx,%edi
+ 2ff:	fc                   	cld
+ 300:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 302:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 305:	89 d0                	mov    %edx,%eax
+ 307:	c9                   	leave
+ 308:	c3                   	ret
+ 309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	8b 45 08             	mov    0x8(%ebp),%eax
+ 316:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 31a:	0f b6 10             	movzbl (%eax),%edx
+ 31d:	84 d2                	test   %dl,%dl
+ 31f:	75 12                	jne    333 <strchr+0x23>
+ 321:	eb 1d                	jmp    340 <strchr+0x30>
+ 323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 327:	90                   	nop
+ 328:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 32c:	83 c0 01             	add    $0x1,%eax
+ 32f:	84 d2                	test   %dl,%dl
+ 331:	74 0d                	je     340 <strchr+0x30>
+    if(*s == c)
+ 333:	38 d1                	cmp    %dl,%cl
+ 335:	75 f1                	jne    328 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 337:	5d                   	pop    %ebp
+ 338:	c3                   	ret
+ 339:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 340:	31 c0                	xor    %eax,%eax
+}
+ 342:	5d                   	pop    %ebp
+ 343:	c3                   	ret
+ 344:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 34f:	90                   	nop
+
+00000350 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	57                   	push   %edi
+ 354:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 355:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 358:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 359:	31 db                	xor    %ebx,%ebx
+{
+ 35b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 35e:	eb 27                	jmp    387 <gets+0x37>
+    cc = read(0, &c, 1);
+ 360:	83 ec 04             	sub    $0x4,%esp
+ 363:	6a 01                	push   $0x1
+ 365:	56                   	push   %esi
+ 366:	6a 00                	push   $0x0
+ 368:	e8 5e 01 00 00       	call   4cb <read>
+    if(cc < 1)
+ 36d:	83 c4 10             	add    $0x10,%esp
+ 370:	85 c0                	test   %eax,%eax
+ 372:	7e 1d                	jle    391 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 374:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 378:	8b 55 08             	mov    0x8(%ebp),%edx
+ 37b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 37f:	3c 0a                	cmp    $0xa,%al
+ 381:	74 10                	je     393 <gets+0x43>
+ 383:	3c 0d                	cmp    $0xd,%al
+ 385:	74 0c                	je     393 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 387:	89 df                	mov    %ebx,%edi
+ 389:	83 c3 01             	add    $0x1,%ebx
+ 38c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 38f:	7c cf                	jl     360 <gets+0x10>
+ 391:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 393:	8b 45 08             	mov    0x8(%ebp),%eax
+ 396:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 39a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 39d:	5b                   	pop    %ebx
+ 39e:	5e                   	pop    %esi
+ 39f:	5f                   	pop    %edi
+ 3a0:	5d                   	pop    %ebp
+ 3a1:	c3                   	ret
+ 3a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003b0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	56                   	push   %esi
+ 3b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3b5:	83 ec 08             	sub    $0x8,%esp
+ 3b8:	6a 00                	push   $0x0
+ 3ba:	ff 75 08             	push   0x8(%ebp)
+ 3bd:	e8 31 01 00 00       	call   4f3 <open>
+  if(fd < 0)
+ 3c2:	83 c4 10             	add    $0x10,%esp
+ 3c5:	85 c0                	test   %eax,%eax
+ 3c7:	78 27                	js     3f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 3c9:	83 ec 08             	sub    $0x8,%esp
+ 3cc:	ff 75 0c             	push   0xc(%ebp)
+ 3cf:	89 c3                	mov    %eax,%ebx
+ 3d1:	50                   	push   %eax
+ 3d2:	e8 34 01 00 00       	call   50b <fstat>
+  close(fd);
+ 3d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 3da:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3dc:	e8 fa 00 00 00       	call   4db <close>
+  return r;
+ 3e1:	83 c4 10             	add    $0x10,%esp
+}
+ 3e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3e7:	89 f0                	mov    %esi,%eax
+ 3e9:	5b                   	pop    %ebx
+ 3ea:	5e                   	pop    %esi
+ 3eb:	5d                   	pop    %ebp
+ 3ec:	c3                   	ret
+ 3ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3f5:	eb ed                	jmp    3e4 <stat+0x34>
+ 3f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fe:	66 90                	xchg   %ax,%ax
+
+00000400 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	53                   	push   %ebx
+ 404:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 407:	0f be 02             	movsbl (%edx),%eax
+ 40a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 40d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 410:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 415:	77 1e                	ja     435 <atoi+0x35>
+ 417:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 420:	83 c2 01             	add    $0x1,%edx
+ 423:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 426:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 42a:	0f be 02             	movsbl (%edx),%eax
+ 42d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 430:	80 fb 09             	cmp    $0x9,%bl
+ 433:	76 eb                	jbe    420 <atoi+0x20>
+  return n;
+}
+ 435:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 438:	89 c8                	mov    %ecx,%eax
+ 43a:	c9                   	leave
+ 43b:	c3                   	ret
+ 43c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000440 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	57                   	push   %edi
+ 444:	56                   	push   %esi
+ 445:	8b 45 10             	mov    0x10(%ebp),%eax
+ 448:	8b 55 08             	mov    0x8(%ebp),%edx
+ 44b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 44e:	85 c0                	test   %eax,%eax
+ 450:	7e 13                	jle    465 <memmove+0x25>
+ 452:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 454:	89 d7                	mov    %edx,%edi
+ 456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 460:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 461:	39 f8                	cmp    %edi,%eax
+ 463:	75 fb                	jne    460 <memmove+0x20>
+  return vdst;
+}
+ 465:	5e                   	pop    %esi
+ 466:	89 d0                	mov    %edx,%eax
+ 468:	5f                   	pop    %edi
+ 469:	5d                   	pop    %ebp
+ 46a:	c3                   	ret
+
+0000046b <ccreate>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(ccreate)
+ 46b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <cfork>:
+SYSCALL(cfork)
+ 473:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <cgetrootdir>:
+SYSCALL(cgetrootdir)
+ 47b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <getcontrootdir>:
+SYSCALL(getcontrootdir)
+ 483:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <cpause>:
+SYSCALL(cpause)
+ 48b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <cresume>:
+SYSCALL(cresume)
+ 493:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <cstart>:
+SYSCALL(cstart)
+ 49b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <cstop>:
+SYSCALL(cstop)
+ 4a3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <fork>:
+SYSCALL(fork)
+ 4ab:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <exit>:
+SYSCALL(exit)
+ 4b3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <wait>:
+SYSCALL(wait)
+ 4bb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <pipe>:
+SYSCALL(pipe)
+ 4c3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <read>:
+SYSCALL(read)
+ 4cb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <write>:
+SYSCALL(write)
+ 4d3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <close>:
+SYSCALL(close)
+ 4db:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <kill>:
+SYSCALL(kill)
+ 4e3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <exec>:
+SYSCALL(exec)
+ 4eb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <open>:
+SYSCALL(open)
+ 4f3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <mknod>:
+SYSCALL(mknod)
+ 4fb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <unlink>:
+SYSCALL(unlink)
+ 503:	b8 12 00 00 00       	mov    $0x12,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <fstat>:
+SYSCALL(fstat)
+ 50b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <link>:
+SYSCALL(link)
+ 513:	b8 13 00 00 00       	mov    $0x13,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <mkdir>:
+SYSCALL(mkdir)
+ 51b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <chdir>:
+SYSCALL(chdir)
+ 523:	b8 09 00 00 00       	mov    $0x9,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <dup>:
+SYSCALL(dup)
+ 52b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <getpid>:
+SYSCALL(getpid)
+ 533:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <sbrk>:
+SYSCALL(sbrk)
+ 53b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <sleep>:
+SYSCALL(sleep)
+ 543:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <uptime>:
+SYSCALL(uptime)
+ 54b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <cps>:
+SYSCALL(cps)
+ 553:	b8 16 00 00 00       	mov    $0x16,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <mmap>:
+SYSCALL(mmap)
+ 55b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <munmap>:
+SYSCALL(munmap)
+ 563:	b8 20 00 00 00       	mov    $0x20,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <shmget>:
+SYSCALL(shmget)
+ 56b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <climit>:
+SYSCALL(climit)
+ 573:	b8 22 00 00 00       	mov    $0x22,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <spawn>:
+SYSCALL(spawn)
+ 57b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <clone>:
+SYSCALL(clone)
+ 583:	b8 24 00 00 00       	mov    $0x24,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <join>:
+SYSCALL(join)
+ 58b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <futex>:
+SYSCALL(futex)
+ 593:	b8 26 00 00 00       	mov    $0x26,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <ccheckpoint>:
+SYSCALL(ccheckpoint)
+ 59b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <crestore>:
+SYSCALL(crestore)
+ 5a3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <czygote>:
+SYSCALL(czygote)
+ 5ab:	b8 29 00 00 00       	mov    $0x29,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <memstats>:
+SYSCALL(memstats)
+ 5b3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+ 5bb:	66 90                	xchg   %ax,%ax
+ 5bd:	66 90                	xchg   %ax,%ax
+ 5bf:	90                   	nop
+
+000005c0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	57                   	push   %edi
+ 5c4:	56                   	push   %esi
+ 5c5:	53                   	push   %ebx
+ 5c6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5c8:	89 d1                	mov    %edx,%ecx
+{
+ 5ca:	83 ec 3c             	sub    $0x3c,%esp
+ 5cd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 5d0:	85 d2                	test   %edx,%edx
+ 5d2:	0f 89 80 00 00 00    	jns    658 <printint+0x98>
+ 5d8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5dc:	74 7a                	je     658 <printint+0x98>
+    x = -xx;
+ 5de:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5e5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5e8:	31 f6                	xor    %esi,%esi
+ 5ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 5f0:	89 c8                	mov    %ecx,%eax
+ 5f2:	31 d2                	xor    %edx,%edx
+ 5f4:	89 f7                	mov    %esi,%edi
+ 5f6:	f7 f3                	div    %ebx
+ 5f8:	8d 76 01             	lea    0x1(%esi),%esi
+ 5fb:	0f b6 92 20 0e 00 00 	movzbl 0xe20(%edx),%edx
+ 602:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 606:	89 ca                	mov    %ecx,%edx
+ 608:	89 c1                	mov    %eax,%ecx
+ 60a:	39 da                	cmp    %ebx,%edx
+ 60c:	73 e2                	jae    5f0 <printint+0x30>
+  if(neg)
+ 60e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 611:	85 c0                	test   %eax,%eax
+ 613:	74 07                	je     61c <printint+0x5c>
+    buf[i++] = '-';
+ 615:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 61a:	89 f7                	mov    %esi,%edi
+ 61c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 61f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 622:	01 df                	add    %ebx,%edi
+ 624:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 628:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 62b:	83 ec 04             	sub    $0x4,%esp
+ 62e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 631:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 634:	6a 01                	push   $0x1
+ 636:	50                   	push   %eax
+ 637:	56                   	push   %esi
+ 638:	e8 96 fe ff ff       	call   4d3 <write>
+  while(--i >= 0)
+ 63d:	89 f8                	mov    %edi,%eax
+ 63f:	83 c4 10             	add    $0x10,%esp
+ 642:	83 ef 01             	sub    $0x1,%edi
+ 645:	39 d8                	cmp    %ebx,%eax
+ 647:	75 df                	jne    628 <printint+0x68>
+}
+ 649:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 64c:	5b                   	pop    %ebx
+ 64d:	5e                   	pop    %esi
+ 64e:	5f                   	pop    %edi
+ 64f:	5d                   	pop    %ebp
+ 650:	c3                   	ret
+ 651:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 658:	31 c0                	xor    %eax,%eax
+ 65a:	eb 89                	jmp    5e5 <printint+0x25>
+ 65c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000660 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 660:	55                   	push   %ebp
+ 661:	89 e5                	mov    %esp,%ebp
+ 663:	57                   	push   %edi
+ 664:	56                   	push   %esi
+ 665:	53                   	push   %ebx
+ 666:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 669:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 66c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 66f:	0f b6 1e             	movzbl (%esi),%ebx
+ 672:	83 c6 01             	add    $0x1,%esi
+ 675:	84 db                	test   %bl,%bl
+ 677:	74 67                	je     6e0 <printf+0x80>
+ 679:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 67c:	31 d2                	xor    %edx,%edx
+ 67e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 681:	eb 34                	jmp    6b7 <printf+0x57>
+ 683:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 687:	90                   	nop
+ 688:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 68b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 690:	83 f8 25             	cmp    $0x25,%eax
+ 693:	74 18                	je     6ad <printf+0x4d>
+  write(fd, &c, 1);
+ 695:	83 ec 04             	sub    $0x4,%esp
+ 698:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 69b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 69e:	6a 01                	push   $0x1
+ 6a0:	50                   	push   %eax
+ 6a1:	57                   	push   %edi
+ 6a2:	e8 2c fe ff ff       	call   4d3 <write>
+ 6a7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 6aa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 6ad:	0f b6 1e             	movzbl (%esi),%ebx
+ 6b0:	83 c6 01             	add    $0x1,%esi
+ 6b3:	84 db                	test   %bl,%bl
+ 6b5:	74 29                	je     6e0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 6b7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 6ba:	85 d2                	test   %edx,%edx
+ 6bc:	74 ca                	je     688 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 6be:	83 fa 25             	cmp    $0x25,%edx
+ 6c1:	75 ea                	jne    6ad <printf+0x4d>
+      if(c == 'd'){
+ 6c3:	83 f8 25             	cmp    $0x25,%eax
+ 6c6:	0f 84 24 01 00 00    	je     7f0 <printf+0x190>
+ 6cc:	83 e8 63             	sub    $0x63,%eax
+ 6cf:	83 f8 15             	cmp    $0x15,%eax
+ 6d2:	77 1c                	ja     6f0 <printf+0x90>
+ 6d4:	ff 24 85 c8 0d 00 00 	jmp    *0xdc8(,%eax,4)
+ 6db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6df:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6e3:	5b                   	pop    %ebx
+ 6e4:	5e                   	pop    %esi
+ 6e5:	5f                   	pop    %edi
+ 6e6:	5d                   	pop    %ebp
+ 6e7:	c3                   	ret
+ 6e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ef:	90                   	nop
+  write(fd, &c, 1);
+ 6f0:	83 ec 04             	sub    $0x4,%esp
+ 6f3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6f6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 6fa:	6a 01                	push   $0x1
+ 6fc:	52                   	push   %edx
+ 6fd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 700:	57                   	push   %edi
+ 701:	e8 cd fd ff ff       	call   4d3 <write>
+ 706:	83 c4 0c             	add    $0xc,%esp
+ 709:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 70c:	6a 01                	push   $0x1
+ 70e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 711:	52                   	push   %edx
+ 712:	57                   	push   %edi
+ 713:	e8 bb fd ff ff       	call   4d3 <write>
+        putc(fd, c);
+ 718:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 71b:	31 d2                	xor    %edx,%edx
+ 71d:	eb 8e                	jmp    6ad <printf+0x4d>
+ 71f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 720:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 723:	83 ec 0c             	sub    $0xc,%esp
+ 726:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 72b:	8b 13                	mov    (%ebx),%edx
+ 72d:	6a 00                	push   $0x0
+ 72f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 731:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 734:	e8 87 fe ff ff       	call   5c0 <printint>
+        ap++;
+ 739:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 73c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 73f:	31 d2                	xor    %edx,%edx
+ 741:	e9 67 ff ff ff       	jmp    6ad <printf+0x4d>
+ 746:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 74d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 750:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 753:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 755:	83 c0 04             	add    $0x4,%eax
+ 758:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 75b:	85 db                	test   %ebx,%ebx
+ 75d:	0f 84 9d 00 00 00    	je     800 <printf+0x1a0>
+        while(*s != 0){
+ 763:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 766:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 768:	84 c0                	test   %al,%al
+ 76a:	0f 84 3d ff ff ff    	je     6ad <printf+0x4d>
+ 770:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 773:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 776:	89 de                	mov    %ebx,%esi
+ 778:	89 d3                	mov    %edx,%ebx
+ 77a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 780:	83 ec 04             	sub    $0x4,%esp
+ 783:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 786:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 789:	6a 01                	push   $0x1
+ 78b:	53                   	push   %ebx
+ 78c:	57                   	push   %edi
+ 78d:	e8 41 fd ff ff       	call   4d3 <write>
+        while(*s != 0){
+ 792:	0f b6 06             	movzbl (%esi),%eax
+ 795:	83 c4 10             	add    $0x10,%esp
+ 798:	84 c0                	test   %al,%al
+ 79a:	75 e4                	jne    780 <printf+0x120>
+      state = 0;
+ 79c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 79f:	31 d2                	xor    %edx,%edx
+ 7a1:	e9 07 ff ff ff       	jmp    6ad <printf+0x4d>
+ 7a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ad:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 7b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7b3:	83 ec 0c             	sub    $0xc,%esp
+ 7b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7bb:	8b 13                	mov    (%ebx),%edx
+ 7bd:	6a 01                	push   $0x1
+ 7bf:	e9 6b ff ff ff       	jmp    72f <printf+0xcf>
+ 7c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 7c8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 7cb:	83 ec 04             	sub    $0x4,%esp
+ 7ce:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 7d1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 7d3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 7d6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7d9:	6a 01                	push   $0x1
+ 7db:	52                   	push   %edx
+ 7dc:	57                   	push   %edi
+ 7dd:	e8 f1 fc ff ff       	call   4d3 <write>
+        ap++;
+ 7e2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7e5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7e8:	31 d2                	xor    %edx,%edx
+ 7ea:	e9 be fe ff ff       	jmp    6ad <printf+0x4d>
+ 7ef:	90                   	nop
+  write(fd, &c, 1);
+ 7f0:	83 ec 04             	sub    $0x4,%esp
+ 7f3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7f6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7f9:	6a 01                	push   $0x1
+ 7fb:	e9 11 ff ff ff       	jmp    711 <printf+0xb1>
+ 800:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 805:	bb bf 0d 00 00       	mov    $0xdbf,%ebx
+ 80a:	e9 61 ff ff ff       	jmp    770 <printf+0x110>
+ 80f:	90                   	nop
+
+00000810 <runfree>:
+
+// Give the n pages at r back to the free runs, merging them with
+// adjacent runs, and shrink the heap if the end of it is free.
+static void
+runfree(struct page *r, uint n)
+{
+ 810:	55                   	push   %ebp
+  struct page **pp, *prev;
+
+  r->kind = PFREE;
+ 811:	b9 03 00 00 00       	mov    $0x3,%ecx
+{
+ 816:	89 e5                	mov    %esp,%ebp
+ 818:	57                   	push   %edi
+ 819:	56                   	push   %esi
+ 81a:	53                   	push   %ebx
+ 81b:	89 c3                	mov    %eax,%ebx
+ 81d:	83 ec 0c             	sub    $0xc,%esp
+  r->kind = PFREE;
+ 820:	66 89 08             	mov    %cx,(%eax)
+  r->npages = n;
+  prev = 0;
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 823:	8b 0d e4 13 00 00    	mov    0x13e4,%ecx
+  r->npages = n;
+ 829:	89 50 04             	mov    %edx,0x4(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 82c:	85 c9                	test   %ecx,%ecx
+ 82e:	0f 84 1f 01 00 00    	je     953 <runfree+0x143>
+ 834:	39 c1                	cmp    %eax,%ecx
+ 836:	0f 83 f7 00 00 00    	jae    933 <runfree+0x123>
+ 83c:	89 c8                	mov    %ecx,%eax
+ 83e:	eb 04                	jmp    844 <runfree+0x34>
+ 840:	39 d8                	cmp    %ebx,%eax
+ 842:	73 09                	jae    84d <runfree+0x3d>
+ 844:	89 c2                	mov    %eax,%edx
+ 846:	8b 40 14             	mov    0x14(%eax),%eax
+ 849:	85 c0                	test   %eax,%eax
+ 84b:	75 f3                	jne    840 <runfree+0x30>
+    prev = *pp;
+  r->next = *pp;
+ 84d:	89 43 14             	mov    %eax,0x14(%ebx)
+  *pp = r;
+ 850:	89 5a 14             	mov    %ebx,0x14(%edx)
+
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 853:	8b 43 14             	mov    0x14(%ebx),%eax
+ 856:	85 c0                	test   %eax,%eax
+ 858:	74 12                	je     86c <runfree+0x5c>
+ 85a:	8b 7b 04             	mov    0x4(%ebx),%edi
+ 85d:	89 fe                	mov    %edi,%esi
+ 85f:	c1 e6 0c             	shl    $0xc,%esi
+ 862:	01 de                	add    %ebx,%esi
+ 864:	39 f0                	cmp    %esi,%eax
+ 866:	0f 84 a4 00 00 00    	je     910 <runfree+0x100>
+    r->npages += r->next->npages;
+    r->next = r->next->next;
+  }
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 86c:	8b 72 04             	mov    0x4(%edx),%esi
+ 86f:	89 f0                	mov    %esi,%eax
+ 871:	c1 e0 0c             	shl    $0xc,%eax
+ 874:	01 d0                	add    %edx,%eax
+ 876:	39 c3                	cmp    %eax,%ebx
+ 878:	74 16                	je     890 <runfree+0x80>
+    pp = &runs;
+    while(*pp != r)
+      pp = &(*pp)->next;
+  }
+
+  if(r->next == 0 && r->npages >= TRIM &&
+ 87a:	8b 43 14             	mov    0x14(%ebx),%eax
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 87d:	8d 72 14             	lea    0x14(%edx),%esi
+  if(r->next == 0 && r->npages >= TRIM &&
+ 880:	85 c0                	test   %eax,%eax
+ 882:	74 3c                	je     8c0 <runfree+0xb0>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+    *pp = 0;
+    sbrk(-(int)(r->npages*PGSIZE));
+    heapend = (char*)r;
+  }
+}
+ 884:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 887:	5b                   	pop    %ebx
+ 888:	5e                   	pop    %esi
+ 889:	5f                   	pop    %edi
+ 88a:	5d                   	pop    %ebp
+ 88b:	c3                   	ret
+ 88c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    prev->npages += r->npages;
+ 890:	03 73 04             	add    0x4(%ebx),%esi
+ 893:	89 72 04             	mov    %esi,0x4(%edx)
+    prev->next = r->next;
+ 896:	8b 43 14             	mov    0x14(%ebx),%eax
+ 899:	89 42 14             	mov    %eax,0x14(%edx)
+    while(*pp != r)
+ 89c:	39 d1                	cmp    %edx,%ecx
+ 89e:	0f 84 c5 00 00 00    	je     969 <runfree+0x159>
+ 8a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      pp = &(*pp)->next;
+ 8a8:	89 cb                	mov    %ecx,%ebx
+ 8aa:	8b 49 14             	mov    0x14(%ecx),%ecx
+    while(*pp != r)
+ 8ad:	39 d1                	cmp    %edx,%ecx
+ 8af:	75 f7                	jne    8a8 <runfree+0x98>
+      pp = &(*pp)->next;
+ 8b1:	8d 73 14             	lea    0x14(%ebx),%esi
+ 8b4:	89 cb                	mov    %ecx,%ebx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 8b6:	85 c0                	test   %eax,%eax
+ 8b8:	75 ca                	jne    884 <runfree+0x74>
+ 8ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 8c0:	8b 53 04             	mov    0x4(%ebx),%edx
+ 8c3:	83 fa 1f             	cmp    $0x1f,%edx
+ 8c6:	76 bc                	jbe    884 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 8c8:	c1 e2 0c             	shl    $0xc,%edx
+ 8cb:	01 da                	add    %ebx,%edx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 8cd:	39 15 e0 13 00 00    	cmp    %edx,0x13e0
+ 8d3:	75 af                	jne    884 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 8d5:	83 ec 0c             	sub    $0xc,%esp
+ 8d8:	6a 00                	push   $0x0
+ 8da:	e8 5c fc ff ff       	call   53b <sbrk>
+ 8df:	83 c4 10             	add    $0x10,%esp
+ 8e2:	39 05 e0 13 00 00    	cmp    %eax,0x13e0
+ 8e8:	75 9a                	jne    884 <runfree+0x74>
+    *pp = 0;
+ 8ea:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    sbrk(-(int)(r->npages*PGSIZE));
+ 8f0:	8b 43 04             	mov    0x4(%ebx),%eax
+ 8f3:	83 ec 0c             	sub    $0xc,%esp
+ 8f6:	c1 e0 0c             	shl    $0xc,%eax
+ 8f9:	f7 d8                	neg    %eax
+ 8fb:	50                   	push   %eax
+ 8fc:	e8 3a fc ff ff       	call   53b <sbrk>
+    heapend = (char*)r;
+ 901:	89 1d e0 13 00 00    	mov    %ebx,0x13e0
+ 907:	83 c4 10             	add    $0x10,%esp
+}
+ 90a:	e9 75 ff ff ff       	jmp    884 <runfree+0x74>
+ 90f:	90                   	nop
+    r->npages += r->next->npages;
+ 910:	03 78 04             	add    0x4(%eax),%edi
+ 913:	89 7b 04             	mov    %edi,0x4(%ebx)
+    r->next = r->next->next;
+ 916:	8b 40 14             	mov    0x14(%eax),%eax
+ 919:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 91c:	8b 72 04             	mov    0x4(%edx),%esi
+ 91f:	89 f0                	mov    %esi,%eax
+ 921:	c1 e0 0c             	shl    $0xc,%eax
+ 924:	01 d0                	add    %edx,%eax
+ 926:	39 c3                	cmp    %eax,%ebx
+ 928:	0f 85 4c ff ff ff    	jne    87a <runfree+0x6a>
+ 92e:	e9 5d ff ff ff       	jmp    890 <runfree+0x80>
+  r->next = *pp;
+ 933:	89 48 14             	mov    %ecx,0x14(%eax)
+  *pp = r;
+ 936:	a3 e4 13 00 00       	mov    %eax,0x13e4
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 93b:	89 d0                	mov    %edx,%eax
+ 93d:	c1 e0 0c             	shl    $0xc,%eax
+ 940:	01 d8                	add    %ebx,%eax
+ 942:	39 c1                	cmp    %eax,%ecx
+ 944:	74 2f                	je     975 <runfree+0x165>
+  if(r->next == 0 && r->npages >= TRIM &&
+ 946:	8b 43 14             	mov    0x14(%ebx),%eax
+ 949:	be e4 13 00 00       	mov    $0x13e4,%esi
+ 94e:	e9 2d ff ff ff       	jmp    880 <runfree+0x70>
+  r->next = *pp;
+ 953:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 95a:	be e4 13 00 00       	mov    $0x13e4,%esi
+  *pp = r;
+ 95f:	a3 e4 13 00 00       	mov    %eax,0x13e4
+  if(r->next == 0 && r->npages >= TRIM &&
+ 964:	e9 5a ff ff ff       	jmp    8c3 <runfree+0xb3>
+    while(*pp != r)
+ 969:	89 cb                	mov    %ecx,%ebx
+    pp = &runs;
+ 96b:	be e4 13 00 00       	mov    $0x13e4,%esi
+ 970:	e9 0b ff ff ff       	jmp    880 <runfree+0x70>
+    r->npages += r->next->npages;
+ 975:	03 51 04             	add    0x4(%ecx),%edx
+ 978:	89 53 04             	mov    %edx,0x4(%ebx)
+    r->next = r->next->next;
+ 97b:	8b 41 14             	mov    0x14(%ecx),%eax
+ 97e:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 981:	eb c3                	jmp    946 <runfree+0x136>
+ 983:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 98a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000990 <runalloc>:
+
+// Take a run of n pages from the start of the first free run
+// long enough, which keeps the end of the heap free to trim.
+static struct page*
+runalloc(uint n)
+{
+ 990:	55                   	push   %ebp
+ 991:	89 e5                	mov    %esp,%ebp
+ 993:	57                   	push   %edi
+ 994:	56                   	push   %esi
+ 995:	89 c6                	mov    %eax,%esi
+ 997:	53                   	push   %ebx
+ 998:	83 ec 1c             	sub    $0x1c,%esp
+  struct page **pp, *r, *rest;
+
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ 99b:	8b 1d e4 13 00 00    	mov    0x13e4,%ebx
+ 9a1:	85 db                	test   %ebx,%ebx
+ 9a3:	74 4d                	je     9f2 <runalloc+0x62>
+ 9a5:	b9 e4 13 00 00       	mov    $0x13e4,%ecx
+    if(r->npages < n)
+ 9aa:	39 73 04             	cmp    %esi,0x4(%ebx)
+ 9ad:	72 39                	jb     9e8 <runalloc+0x58>
+      continue;
+    if(r->npages == n){
+ 9af:	0f 84 9b 00 00 00    	je     a50 <runalloc+0xc0>
+      *pp = r->next;
+    } else {
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ 9b5:	89 f0                	mov    %esi,%eax
+      rest->kind = PFREE;
+ 9b7:	ba 03 00 00 00       	mov    $0x3,%edx
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ 9bc:	c1 e0 0c             	shl    $0xc,%eax
+ 9bf:	01 d8                	add    %ebx,%eax
+      rest->kind = PFREE;
+ 9c1:	66 89 10             	mov    %dx,(%eax)
+      rest->npages = r->npages - n;
+ 9c4:	8b 53 04             	mov    0x4(%ebx),%edx
+ 9c7:	29 f2                	sub    %esi,%edx
+ 9c9:	89 50 04             	mov    %edx,0x4(%eax)
+      rest->next = r->next;
+ 9cc:	8b 53 14             	mov    0x14(%ebx),%edx
+ 9cf:	89 50 14             	mov    %edx,0x14(%eax)
+      *pp = rest;
+ 9d2:	89 01                	mov    %eax,(%ecx)
+      r->npages = n;
+ 9d4:	89 73 04             	mov    %esi,0x4(%ebx)
+    }
+    return r;
+  }
+  return morecore(n);
+}
+ 9d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9da:	89 d8                	mov    %ebx,%eax
+ 9dc:	5b                   	pop    %ebx
+ 9dd:	5e                   	pop    %esi
+ 9de:	5f                   	pop    %edi
+ 9df:	5d                   	pop    %ebp
+ 9e0:	c3                   	ret
+ 9e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ 9e8:	8d 4b 14             	lea    0x14(%ebx),%ecx
+ 9eb:	8b 5b 14             	mov    0x14(%ebx),%ebx
+ 9ee:	85 db                	test   %ebx,%ebx
+ 9f0:	75 b8                	jne    9aa <runalloc+0x1a>
+  m = n < MINCORE ? MINCORE : n;
+ 9f2:	bf 08 00 00 00       	mov    $0x8,%edi
+ 9f7:	39 fe                	cmp    %edi,%esi
+ 9f9:	0f 43 fe             	cmovae %esi,%edi
+  brk = sbrk(0);
+ 9fc:	83 ec 0c             	sub    $0xc,%esp
+ 9ff:	6a 00                	push   $0x0
+ a01:	e8 35 fb ff ff       	call   53b <sbrk>
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ a06:	89 fa                	mov    %edi,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ a08:	89 c3                	mov    %eax,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ a0a:	c1 e2 0c             	shl    $0xc,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ a0d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ a10:	f7 db                	neg    %ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ a12:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ a15:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ a1b:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+ a1e:	89 04 24             	mov    %eax,(%esp)
+ a21:	e8 15 fb ff ff       	call   53b <sbrk>
+ a26:	83 c4 10             	add    $0x10,%esp
+ a29:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ a2c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ a2f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a32:	74 3e                	je     a72 <runalloc+0xe2>
+  r = (struct page*)(brk + pad);
+ a34:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ a36:	01 da                	add    %ebx,%edx
+ a38:	89 15 e0 13 00 00    	mov    %edx,0x13e0
+  if(m > n)
+ a3e:	39 fe                	cmp    %edi,%esi
+ a40:	72 1e                	jb     a60 <runalloc+0xd0>
+  r->npages = n;
+ a42:	89 73 04             	mov    %esi,0x4(%ebx)
+  return r;
+ a45:	eb 90                	jmp    9d7 <runalloc+0x47>
+ a47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a4e:	66 90                	xchg   %ax,%ax
+      *pp = r->next;
+ a50:	8b 43 14             	mov    0x14(%ebx),%eax
+ a53:	89 01                	mov    %eax,(%ecx)
+}
+ a55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a58:	89 d8                	mov    %ebx,%eax
+ a5a:	5b                   	pop    %ebx
+ a5b:	5e                   	pop    %esi
+ a5c:	5f                   	pop    %edi
+ a5d:	5d                   	pop    %ebp
+ a5e:	c3                   	ret
+ a5f:	90                   	nop
+    runfree((struct page*)((char*)r + n*PGSIZE), m - n);
+ a60:	89 f0                	mov    %esi,%eax
+ a62:	29 f7                	sub    %esi,%edi
+ a64:	c1 e0 0c             	shl    $0xc,%eax
+ a67:	89 fa                	mov    %edi,%edx
+ a69:	01 d8                	add    %ebx,%eax
+ a6b:	e8 a0 fd ff ff       	call   810 <runfree>
+ a70:	eb d0                	jmp    a42 <runalloc+0xb2>
+    if(sbrk(pad + m*PGSIZE) == (char*)-1)
+ a72:	89 f7                	mov    %esi,%edi
+ a74:	83 ec 0c             	sub    $0xc,%esp
+ a77:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ a7a:	c1 e7 0c             	shl    $0xc,%edi
+ a7d:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+ a80:	50                   	push   %eax
+ a81:	e8 b5 fa ff ff       	call   53b <sbrk>
+ a86:	83 c4 10             	add    $0x10,%esp
+ a89:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ a8c:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a8f:	74 0c                	je     a9d <runalloc+0x10d>
+  r = (struct page*)(brk + pad);
+ a91:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ a93:	01 df                	add    %ebx,%edi
+ a95:	89 3d e0 13 00 00    	mov    %edi,0x13e0
+  if(m > n)
+ a9b:	eb a5                	jmp    a42 <runalloc+0xb2>
+      return 0;
+ a9d:	31 db                	xor    %ebx,%ebx
+ a9f:	e9 33 ff ff ff       	jmp    9d7 <runalloc+0x47>
+ aa4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ aaf:	90                   	nop
+
+00000ab0 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+ ab0:	55                   	push   %ebp
+ ab1:	89 e5                	mov    %esp,%ebp
+ ab3:	56                   	push   %esi
+ ab4:	53                   	push   %ebx
+ ab5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  struct page *p;
+
+  if(ap == 0)
+ ab8:	85 c9                	test   %ecx,%ecx
+ aba:	74 1c                	je     ad8 <free+0x28>
+    return;
+  p = (struct page*)((uint)ap & ~(PGSIZE-1));
+ abc:	89 c8                	mov    %ecx,%eax
+ abe:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  switch(p->kind){
+ ac3:	0f b7 10             	movzwl (%eax),%edx
+ ac6:	66 83 fa 02          	cmp    $0x2,%dx
+ aca:	74 14                	je     ae0 <free+0x30>
+ acc:	66 83 fa 04          	cmp    $0x4,%dx
+ ad0:	74 66                	je     b38 <free+0x88>
+ ad2:	66 83 fa 01          	cmp    $0x1,%dx
+ ad6:	74 18                	je     af0 <free+0x40>
+    break;
+  case PMAP:
+    munmap(p, p->npages*PGSIZE);
+    break;
+  }
+}
+ ad8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ adb:	5b                   	pop    %ebx
+ adc:	5e                   	pop    %esi
+ add:	5d                   	pop    %ebp
+ ade:	c3                   	ret
+ adf:	90                   	nop
+    runfree(p, p->npages);
+ ae0:	8b 50 04             	mov    0x4(%eax),%edx
+}
+ ae3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ ae6:	5b                   	pop    %ebx
+ ae7:	5e                   	pop    %esi
+ ae8:	5d                   	pop    %ebp
+    runfree(p, p->npages);
+ ae9:	e9 22 fd ff ff       	jmp    810 <runfree>
+ aee:	66 90                	xchg   %ax,%ax
+  b->next = p->free;
+ af0:	8b 50 0c             	mov    0xc(%eax),%edx
+ af3:	89 11                	mov    %edx,(%ecx)
+  if(p->nfree++ == 0)
+ af5:	8b 50 08             	mov    0x8(%eax),%edx
+  p->free = b;
+ af8:	89 48 0c             	mov    %ecx,0xc(%eax)
+  if(p->nfree++ == 0)
+ afb:	8d 5a 01             	lea    0x1(%edx),%ebx
+ afe:	89 58 08             	mov    %ebx,0x8(%eax)
+ b01:	85 d2                	test   %edx,%edx
+ b03:	74 53                	je     b58 <free+0xa8>
+  if(p->nfree == nblocks(p->class)){
+ b05:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ b09:	8d 4e 04             	lea    0x4(%esi),%ecx
+ b0c:	ba e0 0f 00 00       	mov    $0xfe0,%edx
+ b11:	d3 fa                	sar    %cl,%edx
+  if(p->nfree == nblocks(p->class)){
+ b13:	39 da                	cmp    %ebx,%edx
+ b15:	75 c1                	jne    ad8 <free+0x28>
+  if(p->prev)
+ b17:	8b 48 18             	mov    0x18(%eax),%ecx
+    p->prev->next = p->next;
+ b1a:	8b 50 14             	mov    0x14(%eax),%edx
+  if(p->prev)
+ b1d:	85 c9                	test   %ecx,%ecx
+ b1f:	74 6f                	je     b90 <free+0xe0>
+    p->prev->next = p->next;
+ b21:	89 51 14             	mov    %edx,0x14(%ecx)
+  if(p->next)
+ b24:	85 d2                	test   %edx,%edx
+ b26:	74 06                	je     b2e <free+0x7e>
+    p->next->prev = p->prev;
+ b28:	8b 48 18             	mov    0x18(%eax),%ecx
+ b2b:	89 4a 18             	mov    %ecx,0x18(%edx)
+    runfree(p, 1);
+ b2e:	ba 01 00 00 00       	mov    $0x1,%edx
+ b33:	eb ae                	jmp    ae3 <free+0x33>
+ b35:	8d 76 00             	lea    0x0(%esi),%esi
+    munmap(p, p->npages*PGSIZE);
+ b38:	8b 50 04             	mov    0x4(%eax),%edx
+ b3b:	83 ec 08             	sub    $0x8,%esp
+ b3e:	c1 e2 0c             	shl    $0xc,%edx
+ b41:	52                   	push   %edx
+ b42:	50                   	push   %eax
+ b43:	e8 1b fa ff ff       	call   563 <munmap>
+    break;
+ b48:	83 c4 10             	add    $0x10,%esp
+}
+ b4b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ b4e:	5b                   	pop    %ebx
+ b4f:	5e                   	pop    %esi
+ b50:	5d                   	pop    %ebp
+ b51:	c3                   	ret
+ b52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  p->next = partial[p->class];
+ b58:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  p->prev = 0;
+ b5c:	c7 40 18 00 00 00 00 	movl   $0x0,0x18(%eax)
+  p->next = partial[p->class];
+ b63:	bb 01 00 00 00       	mov    $0x1,%ebx
+ b68:	8b 14 b5 e8 13 00 00 	mov    0x13e8(,%esi,4),%edx
+ b6f:	89 50 14             	mov    %edx,0x14(%eax)
+  if(p->next)
+ b72:	85 d2                	test   %edx,%edx
+ b74:	74 0a                	je     b80 <free+0xd0>
+    p->next->prev = p;
+ b76:	89 42 18             	mov    %eax,0x18(%edx)
+  partial[p->class] = p;
+ b79:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  if(p->nfree == nblocks(p->class)){
+ b7d:	8b 58 08             	mov    0x8(%eax),%ebx
+  partial[p->class] = p;
+ b80:	89 04 b5 e8 13 00 00 	mov    %eax,0x13e8(,%esi,4)
+}
+ b87:	eb 80                	jmp    b09 <free+0x59>
+ b89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ b90:	89 14 b5 e8 13 00 00 	mov    %edx,0x13e8(,%esi,4)
+ b97:	eb 8b                	jmp    b24 <free+0x74>
+ b99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000ba0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ ba0:	55                   	push   %ebp
+ ba1:	89 e5                	mov    %esp,%ebp
+ ba3:	56                   	push   %esi
+ ba4:	53                   	push   %ebx
+ ba5:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct page *p;
+  uint n;
+
+  if(nbytes <= MAXSMALL)
+ ba8:	3d 00 04 00 00       	cmp    $0x400,%eax
+ bad:	76 71                	jbe    c20 <malloc+0x80>
+    return smallalloc(sizeclass(nbytes));
+  if(nbytes > 0x7fffffff)
+ baf:	85 c0                	test   %eax,%eax
+ bb1:	0f 88 d9 00 00 00    	js     c90 <malloc+0xf0>
+    return 0;
+  n = (nbytes + HDRSIZE + PGSIZE-1) / PGSIZE;
+ bb7:	8d 90 1f 10 00 00    	lea    0x101f(%eax),%edx
+ bbd:	89 d3                	mov    %edx,%ebx
+ bbf:	c1 eb 0c             	shr    $0xc,%ebx
+  if(nbytes >= MAPMIN){
+ bc2:	3d ff ff 00 00       	cmp    $0xffff,%eax
+ bc7:	77 27                	ja     bf0 <malloc+0x50>
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    if(p == MAP_FAILED)
+      return 0;
+    p->kind = PMAP;
+  } else {
+    if((p = runalloc(n)) == 0)
+ bc9:	89 d8                	mov    %ebx,%eax
+ bcb:	e8 c0 fd ff ff       	call   990 <runalloc>
+ bd0:	85 c0                	test   %eax,%eax
+ bd2:	0f 84 b8 00 00 00    	je     c90 <malloc+0xf0>
+      return 0;
+    p->kind = PRUN;
+ bd8:	ba 02 00 00 00       	mov    $0x2,%edx
+ bdd:	66 89 10             	mov    %dx,(%eax)
+  }
+  p->npages = n;
+ be0:	89 58 04             	mov    %ebx,0x4(%eax)
+  return (char*)p + HDRSIZE;
+ be3:	8d 58 20             	lea    0x20(%eax),%ebx
+}
+ be6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ be9:	89 d8                	mov    %ebx,%eax
+ beb:	5b                   	pop    %ebx
+ bec:	5e                   	pop    %esi
+ bed:	5d                   	pop    %ebp
+ bee:	c3                   	ret
+ bef:	90                   	nop
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+ bf0:	83 ec 08             	sub    $0x8,%esp
+ bf3:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+ bf9:	6a 00                	push   $0x0
+ bfb:	6a ff                	push   $0xffffffff
+ bfd:	6a 22                	push   $0x22
+ bff:	6a 03                	push   $0x3
+ c01:	52                   	push   %edx
+ c02:	6a 00                	push   $0x0
+ c04:	e8 52 f9 ff ff       	call   55b <mmap>
+    if(p == MAP_FAILED)
+ c09:	83 c4 20             	add    $0x20,%esp
+ c0c:	83 f8 ff             	cmp    $0xffffffff,%eax
+ c0f:	74 7f                	je     c90 <malloc+0xf0>
+    p->kind = PMAP;
+ c11:	b9 04 00 00 00       	mov    $0x4,%ecx
+ c16:	66 89 08             	mov    %cx,(%eax)
+ c19:	eb c5                	jmp    be0 <malloc+0x40>
+ c1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c1f:	90                   	nop
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ c20:	83 f8 10             	cmp    $0x10,%eax
+ c23:	0f 86 07 01 00 00    	jbe    d30 <malloc+0x190>
+ c29:	31 db                	xor    %ebx,%ebx
+ c2b:	ba 10 00 00 00       	mov    $0x10,%edx
+ c30:	83 c3 01             	add    $0x1,%ebx
+ c33:	89 d6                	mov    %edx,%esi
+ c35:	89 d9                	mov    %ebx,%ecx
+ c37:	d3 e6                	shl    %cl,%esi
+ c39:	39 c6                	cmp    %eax,%esi
+ c3b:	72 f3                	jb     c30 <malloc+0x90>
+  if((p = partial[c]) == 0){
+ c3d:	8b 14 9d e8 13 00 00 	mov    0x13e8(,%ebx,4),%edx
+ c44:	85 d2                	test   %edx,%edx
+ c46:	74 58                	je     ca0 <malloc+0x100>
+  if((b = p->free) != 0){
+ c48:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ c4b:	8b 4a 08             	mov    0x8(%edx),%ecx
+  if((b = p->free) != 0){
+ c4e:	85 db                	test   %ebx,%ebx
+ c50:	0f 84 aa 00 00 00    	je     d00 <malloc+0x160>
+    p->free = b->next;
+ c56:	8b 03                	mov    (%ebx),%eax
+ c58:	89 42 0c             	mov    %eax,0xc(%edx)
+  if(--p->nfree == 0)
+ c5b:	83 e9 01             	sub    $0x1,%ecx
+ c5e:	89 4a 08             	mov    %ecx,0x8(%edx)
+ c61:	75 83                	jne    be6 <malloc+0x46>
+  if(p->prev)
+ c63:	8b 4a 18             	mov    0x18(%edx),%ecx
+    p->prev->next = p->next;
+ c66:	8b 42 14             	mov    0x14(%edx),%eax
+  if(p->prev)
+ c69:	85 c9                	test   %ecx,%ecx
+ c6b:	0f 84 cf 00 00 00    	je     d40 <malloc+0x1a0>
+    p->prev->next = p->next;
+ c71:	89 41 14             	mov    %eax,0x14(%ecx)
+  if(p->next)
+ c74:	85 c0                	test   %eax,%eax
+ c76:	0f 84 6a ff ff ff    	je     be6 <malloc+0x46>
+    p->next->prev = p->prev;
+ c7c:	8b 52 18             	mov    0x18(%edx),%edx
+ c7f:	89 50 18             	mov    %edx,0x18(%eax)
+ c82:	e9 5f ff ff ff       	jmp    be6 <malloc+0x46>
+ c87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c8e:	66 90                	xchg   %ax,%ax
+}
+ c90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+ c93:	31 db                	xor    %ebx,%ebx
+}
+ c95:	89 d8                	mov    %ebx,%eax
+ c97:	5b                   	pop    %ebx
+ c98:	5e                   	pop    %esi
+ c99:	5d                   	pop    %ebp
+ c9a:	c3                   	ret
+ c9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c9f:	90                   	nop
+    if((p = runalloc(1)) == 0)
+ ca0:	b8 01 00 00 00       	mov    $0x1,%eax
+ ca5:	e8 e6 fc ff ff       	call   990 <runalloc>
+ caa:	89 c2                	mov    %eax,%edx
+ cac:	85 c0                	test   %eax,%eax
+ cae:	74 e0                	je     c90 <malloc+0xf0>
+    p->kind = PSMALL;
+ cb0:	b8 01 00 00 00       	mov    $0x1,%eax
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ cb5:	8d 4b 04             	lea    0x4(%ebx),%ecx
+    p->class = c;
+ cb8:	66 89 5a 02          	mov    %bx,0x2(%edx)
+ cbc:	0f b7 db             	movzwl %bx,%ebx
+    p->kind = PSMALL;
+ cbf:	66 89 02             	mov    %ax,(%edx)
+    p->fresh = (char*)p + HDRSIZE;
+ cc2:	8d 42 20             	lea    0x20(%edx),%eax
+ cc5:	89 42 10             	mov    %eax,0x10(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ cc8:	b8 e0 0f 00 00       	mov    $0xfe0,%eax
+ ccd:	d3 f8                	sar    %cl,%eax
+    p->free = 0;
+ ccf:	c7 42 0c 00 00 00 00 	movl   $0x0,0xc(%edx)
+    p->nfree = nblocks(c);
+ cd6:	89 42 08             	mov    %eax,0x8(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ cd9:	89 c1                	mov    %eax,%ecx
+  p->next = partial[p->class];
+ cdb:	8b 04 9d e8 13 00 00 	mov    0x13e8(,%ebx,4),%eax
+  p->prev = 0;
+ ce2:	c7 42 18 00 00 00 00 	movl   $0x0,0x18(%edx)
+  p->next = partial[p->class];
+ ce9:	89 42 14             	mov    %eax,0x14(%edx)
+  if(p->next)
+ cec:	85 c0                	test   %eax,%eax
+ cee:	75 20                	jne    d10 <malloc+0x170>
+  partial[p->class] = p;
+ cf0:	89 14 9d e8 13 00 00 	mov    %edx,0x13e8(,%ebx,4)
+  if((b = p->free) != 0){
+ cf7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cfe:	66 90                	xchg   %ax,%ax
+    b = (struct block*)p->fresh;
+ d00:	8b 5a 10             	mov    0x10(%edx),%ebx
+    p->fresh += MINSMALL << c;
+ d03:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+ d06:	89 42 10             	mov    %eax,0x10(%edx)
+ d09:	e9 4d ff ff ff       	jmp    c5b <malloc+0xbb>
+ d0e:	66 90                	xchg   %ax,%ax
+    p->next->prev = p;
+ d10:	89 50 18             	mov    %edx,0x18(%eax)
+  partial[p->class] = p;
+ d13:	0f b7 42 02          	movzwl 0x2(%edx),%eax
+  if((b = p->free) != 0){
+ d17:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ d1a:	8b 4a 08             	mov    0x8(%edx),%ecx
+  partial[p->class] = p;
+ d1d:	89 14 85 e8 13 00 00 	mov    %edx,0x13e8(,%eax,4)
+}
+ d24:	e9 25 ff ff ff       	jmp    c4e <malloc+0xae>
+ d29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ d30:	be 10 00 00 00       	mov    $0x10,%esi
+ d35:	31 db                	xor    %ebx,%ebx
+ d37:	e9 01 ff ff ff       	jmp    c3d <malloc+0x9d>
+ d3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ d40:	0f b7 4a 02          	movzwl 0x2(%edx),%ecx
+ d44:	89 04 8d e8 13 00 00 	mov    %eax,0x13e8(,%ecx,4)
+ d4b:	e9 24 ff ff ff       	jmp    c74 <malloc+0xd4>
@@ -0,0 +1,90 @@
+// Measure buffer cache lookups from parallel readers, in the
+// manner of stressfs: each reader process rereads its own small
+// file, which stays cached, so the time goes to bread and brelse.
+// With a scalable cache, more readers get more reads per tick.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fs.h"
+#include "fcntl.h"
+
+#define MAXREADER 4
+#define NBLK      4       // blocks per file
+#define NPASS     2000    // rereads of the file per reader
+
+char data[BSIZE];
+
+void
+mkfile(char *path)
+{
+  int fd, i;
+
+  if((fd = open(path, O_CREATE | O_RDWR)) < 0){
+    printf(1, "readbench: cannot create %s\n", path);
+    exit();
+  }
+  memset(data, 'r', sizeof(data));
+  for(i = 0; i < NBLK; i++)
+    write(fd, data, sizeof(data));
+  close(fd);
+}
+
+void
+reader(char *path)
+{
+  int fd, i, j;
+
+  for(i = 0; i < NPASS; i++){
+    if((fd = open(path, O_RDONLY)) < 0){
+      printf(1, "readbench: cannot open %s\n", path);
+      exit();
+    }
+    for(j = 0; j < NBLK; j++)
+      read(fd, data, sizeof(data));
+    close(fd);
+  }
+}
+
+// Run nreader readers at once and return the ticks they took.
+int
+run(int nreader)
+{
+  char path[] = "readbench0";
+  int i, start;
+
+  start = uptime();
+  for(i = 0; i < nreader; i++){
+    if(fork() == 0){
+      path[9] += i;
+      reader(path);
+      exit();
+    }
+  }
+  for(i = 0; i < nreader; i++)
+    wait();
+  return uptime() - start;
+}
+
+int
+main(int argc, char *argv[])
+{
+  char path[] = "readbench0";
+  int i, n, ticks;
+
+  for(i = 0; i < MAXREADER; i++){
+    mkfile(path);
+    path[9]++;
+  }
+  for(n = 1; n <= MAXREADER; n *= 2){
+    ticks = run(n);
+    printf(1, "%d readers: %d block reads in %d ticks, %d reads/tick\n",
+           n, n*NPASS*NBLK, ticks, n*NPASS*NBLK / (ticks ? ticks : 1));
+  }
+  path[9] = '0';
+  for(i = 0; i < MAXREADER; i++){
+    unlink(path);
+    path[9]++;
+  }
+  exit();
+}
@@ -0,0 +1,4150 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return 0;
+}
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	56                   	push   %esi
+       e:	53                   	push   %ebx
+       f:	51                   	push   %ecx
+      10:	81 ec 0c 06 00 00    	sub    $0x60c,%esp
+  static char buf[100];
+  int fd;
+  struct cmd *cmd;
+
+  // Ensure that three file descriptors are open.
+  while((fd = open("console", O_RDWR)) >= 0){
+      16:	eb 11                	jmp    29 <main+0x29>
+      18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      1f:	90                   	nop
+    if(fd >= 3){
+      20:	83 f8 02             	cmp    $0x2,%eax
+      23:	0f 8f ac 01 00 00    	jg     1d5 <main+0x1d5>
+  while((fd = open("console", O_RDWR)) >= 0){
+      29:	83 ec 08             	sub    $0x8,%esp
+      2c:	6a 02                	push   $0x2
+      2e:	68 87 1e 00 00       	push   $0x1e87
+      33:	e8 4b 15 00 00       	call   1583 <open>
+      38:	83 c4 10             	add    $0x10,%esp
+      3b:	85 c0                	test   %eax,%eax
+      3d:	79 e1                	jns    20 <main+0x20>
+      3f:	90                   	nop
+  printf(2, "$ ");
+      40:	83 ec 08             	sub    $0x8,%esp
+      43:	68 e6 1d 00 00       	push   $0x1de6
+      48:	6a 02                	push   $0x2
+      4a:	e8 a1 16 00 00       	call   16f0 <printf>
+  memset(buf, 0, nbuf);
+      4f:	83 c4 0c             	add    $0xc,%esp
+      52:	6a 64                	push   $0x64
+      54:	6a 00                	push   $0x0
+      56:	68 20 28 00 00       	push   $0x2820
+      5b:	e8 20 13 00 00       	call   1380 <memset>
+  gets(buf, nbuf);
+      60:	58                   	pop    %eax
+      61:	5a                   	pop    %edx
+      62:	6a 64                	push   $0x64
+      64:	68 20 28 00 00       	push   $0x2820
+      69:	e8 72 13 00 00       	call   13e0 <gets>
+  if(buf[0] == 0) // EOF
+      6e:	0f b6 05 20 28 00 00 	movzbl 0x2820,%eax
+      75:	83 c4 10             	add    $0x10,%esp
+      78:	84 c0                	test   %al,%al
+      7a:	0f 84 50 01 00 00    	je     1d0 <main+0x1d0>
+    }
+  }
+
+  // Read and run input commands.
+  while(getcmd(buf, sizeof(buf)) >= 0){
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+      80:	3c 63                	cmp    $0x63,%al
+      82:	75 09                	jne    8d <main+0x8d>
+      84:	80 3d 21 28 00 00 64 	cmpb   $0x64,0x2821
+      8b:	74 53                	je     e0 <main+0xe0>
+
+      if(chdir(buf+3) < 0)
+        printf(2, "cannot cd %s\n", buf+3);
+      continue;
+    }
+    if((cmd = parsecmd(buf)) == 0)
+      8d:	83 ec 0c             	sub    $0xc,%esp
+      90:	68 20 28 00 00       	push   $0x2820
+      95:	e8 56 11 00 00       	call   11f0 <parsecmd>
+      9a:	83 c4 10             	add    $0x10,%esp
+      9d:	89 c3                	mov    %eax,%ebx
+      9f:	85 c0                	test   %eax,%eax
+      a1:	74 9d                	je     40 <main+0x40>
+      continue;
+    if(!spawncmd(cmd)){
+      a3:	83 ec 0c             	sub    $0xc,%esp
+      a6:	50                   	push   %eax
+      a7:	e8 a4 05 00 00       	call   650 <spawncmd>
+      ac:	83 c4 10             	add    $0x10,%esp
+      af:	85 c0                	test   %eax,%eax
+      b1:	75 1b                	jne    ce <main+0xce>
+int
+fork1(void)
+{
+  int pid;
+
+  pid = fork();
+      b3:	e8 83 14 00 00       	call   153b <fork>
+  if(pid == -1)
+      b8:	83 f8 ff             	cmp    $0xffffffff,%eax
+      bb:	0f 84 8c 01 00 00    	je     24d <main+0x24d>
+      if(fork1() == 0)
+      c1:	85 c0                	test   %eax,%eax
+      c3:	0f 84 1d 01 00 00    	je     1e6 <main+0x1e6>
+      wait();
+      c9:	e8 7d 14 00 00       	call   154b <wait>
+    freecmd(cmd);
+      ce:	83 ec 0c             	sub    $0xc,%esp
+      d1:	53                   	push   %ebx
+      d2:	e8 99 10 00 00       	call   1170 <freecmd>
+      d7:	83 c4 10             	add    $0x10,%esp
+      da:	e9 61 ff ff ff       	jmp    40 <main+0x40>
+      df:	90                   	nop
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+      e0:	80 3d 22 28 00 00 20 	cmpb   $0x20,0x2822
+      e7:	75 a4                	jne    8d <main+0x8d>
+      buf[strlen(buf) - 1] = 0;  // chop \n
+      e9:	83 ec 0c             	sub    $0xc,%esp
+      memset(cwd, '\0', MAX_PATH_LEN);
+      ec:	8d 9d e8 f9 ff ff    	lea    -0x618(%ebp),%ebx
+      buf[strlen(buf) - 1] = 0;  // chop \n
+      f2:	68 20 28 00 00       	push   $0x2820
+      f7:	e8 54 12 00 00       	call   1350 <strlen>
+      memset(cwd, '\0', MAX_PATH_LEN);
+      fc:	83 c4 0c             	add    $0xc,%esp
+      ff:	68 00 02 00 00       	push   $0x200
+     104:	6a 00                	push   $0x0
+     106:	53                   	push   %ebx
+      buf[strlen(buf) - 1] = 0;  // chop \n
+     107:	c6 80 1f 28 00 00 00 	movb   $0x0,0x281f(%eax)
+      memset(cwd, '\0', MAX_PATH_LEN);
+     10e:	e8 6d 12 00 00       	call   1380 <memset>
+      if (getcwd(cwd) != 0) {
+     113:	89 1c 24             	mov    %ebx,(%esp)
+     116:	e8 45 02 00 00       	call   360 <getcwd>
+     11b:	83 c4 10             	add    $0x10,%esp
+     11e:	85 c0                	test   %eax,%eax
+     120:	0f 85 fb 00 00 00    	jne    221 <main+0x221>
+      memset(fpath, '\0', MAX_PATH_LEN);
+     126:	56                   	push   %esi
+     127:	8d b5 e8 fb ff ff    	lea    -0x418(%ebp),%esi
+     12d:	68 00 02 00 00       	push   $0x200
+     132:	6a 00                	push   $0x0
+     134:	56                   	push   %esi
+     135:	e8 46 12 00 00       	call   1380 <memset>
+      concatenate_path(fpath, cwd, buf + 3);
+     13a:	83 c4 0c             	add    $0xc,%esp
+     13d:	68 23 28 00 00       	push   $0x2823
+     142:	53                   	push   %ebx
+      memset(crootdir, '\0', MAX_PATH_LEN);
+     143:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+      concatenate_path(fpath, cwd, buf + 3);
+     149:	56                   	push   %esi
+     14a:	e8 f1 02 00 00       	call   440 <concatenate_path>
+      memset(crootdir, '\0', MAX_PATH_LEN);
+     14f:	83 c4 0c             	add    $0xc,%esp
+     152:	68 00 02 00 00       	push   $0x200
+     157:	6a 00                	push   $0x0
+     159:	53                   	push   %ebx
+     15a:	e8 21 12 00 00       	call   1380 <memset>
+      if (cgetrootdir(crootdir) != 0) {
+     15f:	89 1c 24             	mov    %ebx,(%esp)
+     162:	e8 a4 13 00 00       	call   150b <cgetrootdir>
+     167:	83 c4 10             	add    $0x10,%esp
+     16a:	85 c0                	test   %eax,%eax
+     16c:	0f 85 c5 00 00 00    	jne    237 <main+0x237>
+      printf(2, "Ready to call sys_chdir...\n");
+     172:	50                   	push   %eax
+     173:	50                   	push   %eax
+     174:	68 ad 1e 00 00       	push   $0x1ead
+     179:	6a 02                	push   $0x2
+     17b:	e8 70 15 00 00       	call   16f0 <printf>
+      printf(2, "Full path = %s\n", fpath);
+     180:	83 c4 0c             	add    $0xc,%esp
+     183:	56                   	push   %esi
+     184:	68 c9 1e 00 00       	push   $0x1ec9
+     189:	6a 02                	push   $0x2
+     18b:	e8 60 15 00 00       	call   16f0 <printf>
+      printf(2, "Container's rootdir = %s\n", crootdir);
+     190:	83 c4 0c             	add    $0xc,%esp
+     193:	53                   	push   %ebx
+     194:	68 d9 1e 00 00       	push   $0x1ed9
+     199:	6a 02                	push   $0x2
+     19b:	e8 50 15 00 00       	call   16f0 <printf>
+      if (!is_prefix_path(fpath, crootdir)) {
+     1a0:	58                   	pop    %eax
+     1a1:	5a                   	pop    %edx
+     1a2:	53                   	push   %ebx
+     1a3:	56                   	push   %esi
+     1a4:	e8 e7 03 00 00       	call   590 <is_prefix_path>
+     1a9:	83 c4 10             	add    $0x10,%esp
+     1ac:	85 c0                	test   %eax,%eax
+     1ae:	75 3f                	jne    1ef <main+0x1ef>
+        printf(2, "Current working directory is not within scope of container\n");
+     1b0:	53                   	push   %ebx
+     1b1:	53                   	push   %ebx
+     1b2:	68 5c 1f 00 00       	push   $0x1f5c
+     1b7:	6a 02                	push   $0x2
+     1b9:	e8 32 15 00 00       	call   16f0 <printf>
+        continue;
+     1be:	83 c4 10             	add    $0x10,%esp
+     1c1:	e9 7a fe ff ff       	jmp    40 <main+0x40>
+     1c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1cd:	8d 76 00             	lea    0x0(%esi),%esi
+  exit();
+     1d0:	e8 6e 13 00 00       	call   1543 <exit>
+      close(fd);
+     1d5:	83 ec 0c             	sub    $0xc,%esp
+     1d8:	50                   	push   %eax
+     1d9:	e8 8d 13 00 00       	call   156b <close>
+      break;
+     1de:	83 c4 10             	add    $0x10,%esp
+     1e1:	e9 5a fe ff ff       	jmp    40 <main+0x40>
+        runcmd(cmd);
+     1e6:	83 ec 0c             	sub    $0xc,%esp
+     1e9:	53                   	push   %ebx
+     1ea:	e8 51 05 00 00       	call   740 <runcmd>
+      if(chdir(buf+3) < 0)
+     1ef:	83 ec 0c             	sub    $0xc,%esp
+     1f2:	68 23 28 00 00       	push   $0x2823
+     1f7:	e8 b7 13 00 00       	call   15b3 <chdir>
+     1fc:	83 c4 10             	add    $0x10,%esp
+     1ff:	85 c0                	test   %eax,%eax
+     201:	0f 89 39 fe ff ff    	jns    40 <main+0x40>
+        printf(2, "cannot cd %s\n", buf+3);
+     207:	51                   	push   %ecx
+     208:	68 23 28 00 00       	push   $0x2823
+     20d:	68 f3 1e 00 00       	push   $0x1ef3
+     212:	6a 02                	push   $0x2
+     214:	e8 d7 14 00 00       	call   16f0 <printf>
+     219:	83 c4 10             	add    $0x10,%esp
+     21c:	e9 1f fe ff ff       	jmp    40 <main+0x40>
+        printf(2, "Get full path at shell error\n");
+     221:	50                   	push   %eax
+     222:	50                   	push   %eax
+     223:	68 8f 1e 00 00       	push   $0x1e8f
+     228:	6a 02                	push   $0x2
+     22a:	e8 c1 14 00 00       	call   16f0 <printf>
+        continue;
+     22f:	83 c4 10             	add    $0x10,%esp
+     232:	e9 09 fe ff ff       	jmp    40 <main+0x40>
+        printf(2, "Get container rootdir at shell error\n");
+     237:	51                   	push   %ecx
+     238:	51                   	push   %ecx
+     239:	68 34 1f 00 00       	push   $0x1f34
+     23e:	6a 02                	push   $0x2
+     240:	e8 ab 14 00 00       	call   16f0 <printf>
+        continue;
+     245:	83 c4 10             	add    $0x10,%esp
+     248:	e9 f3 fd ff ff       	jmp    40 <main+0x40>
+    panic("fork");
+     24d:	83 ec 0c             	sub    $0xc,%esp
+     250:	68 f9 1d 00 00       	push   $0x1df9
+     255:	e8 a6 04 00 00       	call   700 <panic>
+     25a:	66 90                	xchg   %ax,%ax
+     25c:	66 90                	xchg   %ax,%ax
+     25e:	66 90                	xchg   %ax,%ax
+
+00000260 <search_upward>:
+  char *efile;
+     260:	55                   	push   %ebp
+     261:	89 e5                	mov    %esp,%ebp
+     263:	57                   	push   %edi
+     264:	56                   	push   %esi
+     265:	89 c6                	mov    %eax,%esi
+     267:	53                   	push   %ebx
+     268:	89 d3                	mov    %edx,%ebx
+     26a:	83 ec 58             	sub    $0x58,%esp
+     26d:	89 4d b4             	mov    %ecx,-0x4c(%ebp)
+  int fd;
+     270:	52                   	push   %edx
+     271:	e8 da 10 00 00       	call   1350 <strlen>
+     276:	5a                   	pop    %edx
+     277:	59                   	pop    %ecx
+     278:	68 e0 1d 00 00       	push   $0x1de0
+     27d:	01 d8                	add    %ebx,%eax
+     27f:	50                   	push   %eax
+     280:	e8 3b 10 00 00       	call   12c0 <strcpy>
+
+     285:	5f                   	pop    %edi
+     286:	58                   	pop    %eax
+     287:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     28a:	50                   	push   %eax
+     28b:	53                   	push   %ebx
+     28c:	e8 af 11 00 00       	call   1440 <stat>
+     291:	83 c4 10             	add    $0x10,%esp
+     294:	85 c0                	test   %eax,%eax
+     296:	78 6c                	js     304 <search_upward+0xa4>
+
+     298:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+};
+     29b:	39 75 dc             	cmp    %esi,-0x24(%ebp)
+     29e:	74 66                	je     306 <search_upward+0xa6>
+  struct cmd *right;
+     2a0:	83 ec 08             	sub    $0x8,%esp
+     2a3:	6a 00                	push   $0x0
+     2a5:	53                   	push   %ebx
+     2a6:	e8 d8 12 00 00       	call   1583 <open>
+};
+     2ab:	83 c4 10             	add    $0x10,%esp
+  struct cmd *right;
+     2ae:	89 c7                	mov    %eax,%edi
+};
+     2b0:	85 c0                	test   %eax,%eax
+     2b2:	78 50                	js     304 <search_upward+0xa4>
+
+     2b4:	8b 4d b4             	mov    -0x4c(%ebp),%ecx
+     2b7:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     2ba:	89 da                	mov    %ebx,%edx
+     2bc:	e8 9f ff ff ff       	call   260 <search_upward>
+     2c1:	89 c2                	mov    %eax,%edx
+struct backcmd {
+     2c3:	85 c0                	test   %eax,%eax
+     2c5:	74 70                	je     337 <search_upward+0xd7>
+  struct cmd *cmd;
+     2c7:	83 ec 08             	sub    $0x8,%esp
+     2ca:	8d 40 01             	lea    0x1(%eax),%eax
+     2cd:	8d 5d c4             	lea    -0x3c(%ebp),%ebx
+     2d0:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+     2d3:	68 e4 1d 00 00       	push   $0x1de4
+     2d8:	52                   	push   %edx
+     2d9:	e8 e2 0f 00 00       	call   12c0 <strcpy>
+
+     2de:	83 c4 10             	add    $0x10,%esp
+     2e1:	eb 0d                	jmp    2f0 <search_upward+0x90>
+     2e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2e7:	90                   	nop
+struct execcmd {
+     2e8:	0f b7 45 c4          	movzwl -0x3c(%ebp),%eax
+     2ec:	39 c6                	cmp    %eax,%esi
+     2ee:	74 20                	je     310 <search_upward+0xb0>
+
+     2f0:	83 ec 04             	sub    $0x4,%esp
+     2f3:	6a 10                	push   $0x10
+     2f5:	53                   	push   %ebx
+     2f6:	57                   	push   %edi
+     2f7:	e8 5f 12 00 00       	call   155b <read>
+     2fc:	83 c4 10             	add    $0x10,%esp
+     2ff:	83 f8 10             	cmp    $0x10,%eax
+     302:	74 e4                	je     2e8 <search_upward+0x88>
+struct pipecmd {
+     304:	31 d2                	xor    %edx,%edx
+void
+     306:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     309:	89 d0                	mov    %edx,%eax
+     30b:	5b                   	pop    %ebx
+     30c:	5e                   	pop    %esi
+     30d:	5f                   	pop    %edi
+     30e:	5d                   	pop    %ebp
+     30f:	c3                   	ret
+  int type;
+     310:	83 ec 0c             	sub    $0xc,%esp
+     313:	8d 75 c6             	lea    -0x3a(%ebp),%esi
+     316:	56                   	push   %esi
+     317:	e8 34 10 00 00       	call   1350 <strlen>
+  char *argv[MAXARGS];
+     31c:	83 c4 0c             	add    $0xc,%esp
+     31f:	50                   	push   %eax
+  int type;
+     320:	89 c3                	mov    %eax,%ebx
+  char *argv[MAXARGS];
+     322:	56                   	push   %esi
+     323:	ff 75 b4             	push   -0x4c(%ebp)
+     326:	e8 a5 11 00 00       	call   14d0 <memmove>
+
+     32b:	83 c4 10             	add    $0x10,%esp
+     32e:	85 db                	test   %ebx,%ebx
+     330:	78 d2                	js     304 <search_upward+0xa4>
+void panic(char*);
+     332:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     335:	01 da                	add    %ebx,%edx
+void freecmd(struct cmd*);
+     337:	83 ec 0c             	sub    $0xc,%esp
+     33a:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+     33d:	57                   	push   %edi
+     33e:	e8 28 12 00 00       	call   156b <close>
+     343:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     346:	83 c4 10             	add    $0x10,%esp
+void
+     349:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     34c:	5b                   	pop    %ebx
+     34d:	5e                   	pop    %esi
+     34e:	89 d0                	mov    %edx,%eax
+     350:	5f                   	pop    %edi
+     351:	5d                   	pop    %ebp
+     352:	c3                   	ret
+     353:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     35a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000360 <getcwd>:
+{
+     360:	55                   	push   %ebp
+     361:	89 e5                	mov    %esp,%ebp
+     363:	56                   	push   %esi
+     364:	53                   	push   %ebx
+  struct backcmd *bcmd;
+     365:	8d 9d f8 fd ff ff    	lea    -0x208(%ebp),%ebx
+{
+     36b:	81 ec 24 02 00 00    	sub    $0x224,%esp
+     371:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct backcmd *bcmd;
+     374:	68 00 02 00 00       	push   $0x200
+     379:	6a 00                	push   $0x0
+     37b:	53                   	push   %ebx
+     37c:	e8 ff 0f 00 00       	call   1380 <memset>
+  struct execcmd *ecmd;
+     381:	c6 85 f8 fd ff ff 2e 	movb   $0x2e,-0x208(%ebp)
+  struct redircmd *rcmd;
+     388:	58                   	pop    %eax
+     389:	8d 85 e4 fd ff ff    	lea    -0x21c(%ebp),%eax
+     38f:	5a                   	pop    %edx
+     390:	50                   	push   %eax
+     391:	53                   	push   %ebx
+     392:	e8 a9 10 00 00       	call   1440 <stat>
+     397:	83 c4 10             	add    $0x10,%esp
+     39a:	85 c0                	test   %eax,%eax
+     39c:	78 2a                	js     3c8 <getcwd+0x68>
+  switch(cmd->type){
+     39e:	8b 85 ec fd ff ff    	mov    -0x214(%ebp),%eax
+     3a4:	89 f1                	mov    %esi,%ecx
+     3a6:	89 da                	mov    %ebx,%edx
+     3a8:	e8 b3 fe ff ff       	call   260 <search_upward>
+  default:
+     3ad:	85 c0                	test   %eax,%eax
+     3af:	74 17                	je     3c8 <getcwd+0x68>
+  case EXEC:
+     3b1:	80 3e 00             	cmpb   $0x0,(%esi)
+     3b4:	74 0a                	je     3c0 <getcwd+0x60>
+      exit();
+     3b6:	31 c0                	xor    %eax,%eax
+    exec(ecmd->argv[0], ecmd->argv);
+     3b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     3bb:	5b                   	pop    %ebx
+     3bc:	5e                   	pop    %esi
+     3bd:	5d                   	pop    %ebp
+     3be:	c3                   	ret
+     3bf:	90                   	nop
+    ecmd = (struct execcmd*)cmd;
+     3c0:	c6 06 2f             	movb   $0x2f,(%esi)
+     3c3:	eb f1                	jmp    3b6 <getcwd+0x56>
+     3c5:	8d 76 00             	lea    0x0(%esi),%esi
+
+     3c8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     3cd:	eb e9                	jmp    3b8 <getcwd+0x58>
+     3cf:	90                   	nop
+
+000003d0 <parse_subdirectory>:
+    break;
+     3d0:	55                   	push   %ebp
+     3d1:	89 e5                	mov    %esp,%ebp
+     3d3:	57                   	push   %edi
+     3d4:	56                   	push   %esi
+     3d5:	53                   	push   %ebx
+     3d6:	83 ec 0c             	sub    $0xc,%esp
+     3d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     3dc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    rcmd = (struct redircmd*)cmd;
+     3df:	0f b6 13             	movzbl (%ebx),%edx
+     3e2:	84 d2                	test   %dl,%dl
+     3e4:	74 4a                	je     430 <parse_subdirectory+0x60>
+     3e6:	89 d8                	mov    %ebx,%eax
+  case REDIR:
+     3e8:	31 f6                	xor    %esi,%esi
+
+     3ea:	31 c9                	xor    %ecx,%ecx
+     3ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    }
+     3f0:	83 c1 01             	add    $0x1,%ecx
+    close(rcmd->fd);
+     3f3:	80 fa 2f             	cmp    $0x2f,%dl
+     3f6:	75 09                	jne    401 <parse_subdirectory+0x31>
+      printf(2, "open %s failed\n", rcmd->file);
+     3f8:	89 c6                	mov    %eax,%esi
+    if(open(rcmd->file, rcmd->mode) < 0){
+     3fa:	b9 01 00 00 00       	mov    $0x1,%ecx
+      printf(2, "open %s failed\n", rcmd->file);
+     3ff:	29 de                	sub    %ebx,%esi
+    rcmd = (struct redircmd*)cmd;
+     401:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     405:	83 c0 01             	add    $0x1,%eax
+     408:	84 d2                	test   %dl,%dl
+     40a:	75 e4                	jne    3f0 <parse_subdirectory+0x20>
+
+     40c:	01 f3                	add    %esi,%ebx
+  case LIST:
+     40e:	8d 34 0f             	lea    (%edi,%ecx,1),%esi
+
+     411:	83 ec 04             	sub    $0x4,%esp
+     414:	51                   	push   %ecx
+     415:	53                   	push   %ebx
+     416:	57                   	push   %edi
+     417:	e8 b4 10 00 00       	call   14d0 <memmove>
+  case LIST:
+     41c:	c6 06 00             	movb   $0x0,(%esi)
+    lcmd = (struct listcmd*)cmd;
+     41f:	83 c4 10             	add    $0x10,%esp
+     422:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     425:	5b                   	pop    %ebx
+     426:	5e                   	pop    %esi
+     427:	5f                   	pop    %edi
+     428:	5d                   	pop    %ebp
+     429:	c3                   	ret
+     42a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    rcmd = (struct redircmd*)cmd;
+     430:	89 fe                	mov    %edi,%esi
+
+     432:	31 c9                	xor    %ecx,%ecx
+     434:	eb db                	jmp    411 <parse_subdirectory+0x41>
+     436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     43d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000440 <concatenate_path>:
+  }
+     440:	55                   	push   %ebp
+     441:	89 e5                	mov    %esp,%ebp
+     443:	57                   	push   %edi
+     444:	56                   	push   %esi
+     445:	53                   	push   %ebx
+     446:	83 ec 28             	sub    $0x28,%esp
+     449:	8b 75 10             	mov    0x10(%ebp),%esi
+     44c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  exit();
+     44f:	ff 75 0c             	push   0xc(%ebp)
+     452:	e8 f9 0e 00 00       	call   1350 <strlen>
+}
+     457:	89 34 24             	mov    %esi,(%esp)
+  exit();
+     45a:	89 c3                	mov    %eax,%ebx
+}
+     45c:	e8 ef 0e 00 00       	call   1350 <strlen>
+getcmd(char *buf, int nbuf)
+     461:	83 c4 10             	add    $0x10,%esp
+     464:	80 3e 2f             	cmpb   $0x2f,(%esi)
+     467:	0f 84 03 01 00 00    	je     570 <concatenate_path+0x130>
+  if(buf[0] == 0) // EOF
+     46d:	83 ec 04             	sub    $0x4,%esp
+     470:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     473:	53                   	push   %ebx
+     474:	ff 75 0c             	push   0xc(%ebp)
+     477:	57                   	push   %edi
+     478:	e8 53 10 00 00       	call   14d0 <memmove>
+}
+     47d:	83 c4 10             	add    $0x10,%esp
+     480:	83 fb 01             	cmp    $0x1,%ebx
+     483:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     486:	74 78                	je     500 <concatenate_path+0xc0>
+  int fd;
+     488:	83 ec 04             	sub    $0x4,%esp
+     48b:	8d 44 1f 01          	lea    0x1(%edi,%ebx,1),%eax
+  static char buf[100];
+     48f:	c6 04 1f 2f          	movb   $0x2f,(%edi,%ebx,1)
+  int fd;
+     493:	51                   	push   %ecx
+     494:	56                   	push   %esi
+     495:	50                   	push   %eax
+     496:	e8 35 10 00 00       	call   14d0 <memmove>
+     49b:	83 c4 10             	add    $0x10,%esp
+    break;
+     49e:	0f b6 0f             	movzbl (%edi),%ecx
+     4a1:	31 db                	xor    %ebx,%ebx
+     4a3:	31 c0                	xor    %eax,%eax
+     4a5:	31 f6                	xor    %esi,%esi
+     4a7:	84 c9                	test   %cl,%cl
+     4a9:	75 1a                	jne    4c5 <concatenate_path+0x85>
+     4ab:	eb 45                	jmp    4f2 <concatenate_path+0xb2>
+     4ad:	8d 76 00             	lea    0x0(%esi),%esi
+      runcmd(pcmd->right);
+     4b0:	89 de                	mov    %ebx,%esi
+    wait();
+     4b2:	88 0c 37             	mov    %cl,(%edi,%esi,1)
+     4b5:	83 c3 01             	add    $0x1,%ebx
+    break;
+     4b8:	83 c0 01             	add    $0x1,%eax
+     4bb:	0f b6 0c 07          	movzbl (%edi,%eax,1),%ecx
+     4bf:	89 c6                	mov    %eax,%esi
+     4c1:	84 c9                	test   %cl,%cl
+     4c3:	74 2b                	je     4f0 <concatenate_path+0xb0>
+  case PIPE:
+     4c5:	80 f9 2f             	cmp    $0x2f,%cl
+     4c8:	75 e6                	jne    4b0 <concatenate_path+0x70>
+     4ca:	80 7c 37 01 2e       	cmpb   $0x2e,0x1(%edi,%esi,1)
+     4cf:	74 4f                	je     520 <concatenate_path+0xe0>
+      runcmd(pcmd->right);
+     4d1:	85 db                	test   %ebx,%ebx
+     4d3:	74 43                	je     518 <concatenate_path+0xd8>
+     4d5:	80 7c 1f ff 2f       	cmpb   $0x2f,-0x1(%edi,%ebx,1)
+     4da:	89 de                	mov    %ebx,%esi
+     4dc:	75 d4                	jne    4b2 <concatenate_path+0x72>
+    break;
+     4de:	83 c0 01             	add    $0x1,%eax
+     4e1:	0f b6 0c 07          	movzbl (%edi,%eax,1),%ecx
+     4e5:	89 c6                	mov    %eax,%esi
+     4e7:	84 c9                	test   %cl,%cl
+     4e9:	75 da                	jne    4c5 <concatenate_path+0x85>
+     4eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4ef:	90                   	nop
+  case BACK:
+     4f0:	01 df                	add    %ebx,%edi
+     4f2:	c6 07 00             	movb   $0x0,(%edi)
+      close(fd);
+     4f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4f8:	5b                   	pop    %ebx
+     4f9:	5e                   	pop    %esi
+     4fa:	5f                   	pop    %edi
+     4fb:	5d                   	pop    %ebp
+     4fc:	c3                   	ret
+     4fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+     500:	83 ec 04             	sub    $0x4,%esp
+     503:	8d 47 01             	lea    0x1(%edi),%eax
+     506:	51                   	push   %ecx
+     507:	56                   	push   %esi
+     508:	50                   	push   %eax
+     509:	e8 c2 0f 00 00       	call   14d0 <memmove>
+     50e:	83 c4 10             	add    $0x10,%esp
+     511:	eb 8b                	jmp    49e <concatenate_path+0x5e>
+     513:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     517:	90                   	nop
+      runcmd(pcmd->right);
+     518:	31 f6                	xor    %esi,%esi
+     51a:	eb 96                	jmp    4b2 <concatenate_path+0x72>
+     51c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  case PIPE:
+     520:	0f b6 54 37 02       	movzbl 0x2(%edi,%esi,1),%edx
+     525:	80 fa 2f             	cmp    $0x2f,%dl
+     528:	74 36                	je     560 <concatenate_path+0x120>
+     52a:	84 d2                	test   %dl,%dl
+     52c:	74 32                	je     560 <concatenate_path+0x120>
+      close(1);
+     52e:	80 fa 2e             	cmp    $0x2e,%dl
+     531:	75 9e                	jne    4d1 <concatenate_path+0x91>
+      dup(p[1]);
+     533:	85 db                	test   %ebx,%ebx
+     535:	75 0e                	jne    545 <concatenate_path+0x105>
+     537:	eb 1b                	jmp    554 <concatenate_path+0x114>
+     539:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     540:	83 eb 01             	sub    $0x1,%ebx
+     543:	74 0f                	je     554 <concatenate_path+0x114>
+     545:	80 7c 1f ff 2f       	cmpb   $0x2f,-0x1(%edi,%ebx,1)
+     54a:	75 f4                	jne    540 <concatenate_path+0x100>
+      runcmd(pcmd->left);
+     54c:	83 fb 01             	cmp    $0x1,%ebx
+     54f:	74 03                	je     554 <concatenate_path+0x114>
+    }
+     551:	83 eb 01             	sub    $0x1,%ebx
+      close(0);
+     554:	83 c0 02             	add    $0x2,%eax
+     557:	e9 5c ff ff ff       	jmp    4b8 <concatenate_path+0x78>
+     55c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    pcmd = (struct pipecmd*)cmd;
+     560:	83 c0 01             	add    $0x1,%eax
+     563:	e9 50 ff ff ff       	jmp    4b8 <concatenate_path+0x78>
+     568:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     56f:	90                   	nop
+{
+     570:	83 ec 04             	sub    $0x4,%esp
+     573:	50                   	push   %eax
+     574:	56                   	push   %esi
+     575:	57                   	push   %edi
+     576:	e8 55 0f 00 00       	call   14d0 <memmove>
+     57b:	83 c4 10             	add    $0x10,%esp
+     57e:	e9 1b ff ff ff       	jmp    49e <concatenate_path+0x5e>
+     583:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     58a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000590 <is_prefix_path>:
+  }
+     590:	55                   	push   %ebp
+     591:	89 e5                	mov    %esp,%ebp
+     593:	56                   	push   %esi
+     594:	53                   	push   %ebx
+     595:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     598:	8b 75 08             	mov    0x8(%ebp),%esi
+  // Read and run input commands.
+     59b:	0f b6 13             	movzbl (%ebx),%edx
+     59e:	80 fa 2f             	cmp    $0x2f,%dl
+     5a1:	74 4d                	je     5f0 <is_prefix_path+0x60>
+
+     5a3:	0f b6 0e             	movzbl (%esi),%ecx
+     5a6:	84 c9                	test   %cl,%cl
+     5a8:	74 36                	je     5e0 <is_prefix_path+0x50>
+  }
+     5aa:	31 c0                	xor    %eax,%eax
+     5ac:	eb 15                	jmp    5c3 <is_prefix_path+0x33>
+     5ae:	66 90                	xchg   %ax,%ax
+      // Get current working directory, and then full path; compare with 
+     5b0:	38 ca                	cmp    %cl,%dl
+     5b2:	75 30                	jne    5e4 <is_prefix_path+0x54>
+      memset(cwd, '\0', MAX_PATH_LEN);
+     5b4:	83 c0 01             	add    $0x1,%eax
+
+     5b7:	0f b6 0c 06          	movzbl (%esi,%eax,1),%ecx
+        printf(2, "Get full path at shell error\n");
+     5bb:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+
+     5bf:	84 c9                	test   %cl,%cl
+     5c1:	74 1d                	je     5e0 <is_prefix_path+0x50>
+     5c3:	84 d2                	test   %dl,%dl
+     5c5:	75 e9                	jne    5b0 <is_prefix_path+0x20>
+        printf(2, "Get full path at shell error\n");
+     5c7:	84 c9                	test   %cl,%cl
+        continue;
+     5c9:	5b                   	pop    %ebx
+     5ca:	5e                   	pop    %esi
+        printf(2, "Get full path at shell error\n");
+     5cb:	0f 94 c0             	sete   %al
+     5ce:	80 f9 2f             	cmp    $0x2f,%cl
+        continue;
+     5d1:	5d                   	pop    %ebp
+        printf(2, "Get full path at shell error\n");
+     5d2:	0f 94 c2             	sete   %dl
+     5d5:	09 d0                	or     %edx,%eax
+     5d7:	0f b6 c0             	movzbl %al,%eax
+        continue;
+     5da:	c3                   	ret
+     5db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5df:	90                   	nop
+        printf(2, "Get full path at shell error\n");
+     5e0:	84 d2                	test   %dl,%dl
+     5e2:	74 20                	je     604 <is_prefix_path+0x74>
+      // container root directory to decide if path-switching allowed.
+     5e4:	31 c0                	xor    %eax,%eax
+        continue;
+     5e6:	5b                   	pop    %ebx
+     5e7:	5e                   	pop    %esi
+     5e8:	5d                   	pop    %ebp
+     5e9:	c3                   	ret
+     5ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  // Read and run input commands.
+     5f0:	80 7b 01 00          	cmpb   $0x0,0x1(%ebx)
+  while(getcmd(buf, sizeof(buf)) >= 0){
+     5f4:	b8 01 00 00 00       	mov    $0x1,%eax
+  // Read and run input commands.
+     5f9:	74 eb                	je     5e6 <is_prefix_path+0x56>
+
+     5fb:	0f b6 0e             	movzbl (%esi),%ecx
+     5fe:	84 c9                	test   %cl,%cl
+     600:	75 a8                	jne    5aa <is_prefix_path+0x1a>
+     602:	eb e0                	jmp    5e4 <is_prefix_path+0x54>
+     604:	31 c9                	xor    %ecx,%ecx
+     606:	eb bf                	jmp    5c7 <is_prefix_path+0x37>
+     608:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     60f:	90                   	nop
+
+00000610 <getcmd>:
+{
+     610:	55                   	push   %ebp
+     611:	89 e5                	mov    %esp,%ebp
+     613:	56                   	push   %esi
+     614:	53                   	push   %ebx
+     615:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     618:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(2, "$ ");
+     61b:	83 ec 08             	sub    $0x8,%esp
+     61e:	68 e6 1d 00 00       	push   $0x1de6
+     623:	6a 02                	push   $0x2
+     625:	e8 c6 10 00 00       	call   16f0 <printf>
+  memset(buf, 0, nbuf);
+     62a:	83 c4 0c             	add    $0xc,%esp
+     62d:	56                   	push   %esi
+     62e:	6a 00                	push   $0x0
+     630:	53                   	push   %ebx
+     631:	e8 4a 0d 00 00       	call   1380 <memset>
+  gets(buf, nbuf);
+     636:	58                   	pop    %eax
+     637:	5a                   	pop    %edx
+     638:	56                   	push   %esi
+     639:	53                   	push   %ebx
+     63a:	e8 a1 0d 00 00       	call   13e0 <gets>
+  if(buf[0] == 0) // EOF
+     63f:	83 c4 10             	add    $0x10,%esp
+     642:	80 3b 01             	cmpb   $0x1,(%ebx)
+     645:	19 c0                	sbb    %eax,%eax
+}
+     647:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     64a:	5b                   	pop    %ebx
+     64b:	5e                   	pop    %esi
+     64c:	5d                   	pop    %ebp
+     64d:	c3                   	ret
+     64e:	66 90                	xchg   %ax,%ax
+
+00000650 <spawncmd>:
+{
+     650:	55                   	push   %ebp
+     651:	89 e5                	mov    %esp,%ebp
+     653:	56                   	push   %esi
+     654:	53                   	push   %ebx
+     655:	83 c4 80             	add    $0xffffff80,%esp
+     658:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  for(n = 0; cmd->type == REDIR; n++){
+     65b:	8b 33                	mov    (%ebx),%esi
+     65d:	83 fe 02             	cmp    $0x2,%esi
+     660:	75 46                	jne    6a8 <spawncmd+0x58>
+     662:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+     668:	31 d2                	xor    %edx,%edx
+     66a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    act[n].op = SPAWN_OPEN;
+     670:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+    act[n].fd = rcmd->fd;
+     676:	8b 4b 14             	mov    0x14(%ebx),%ecx
+  for(n = 0; cmd->type == REDIR; n++){
+     679:	83 c2 01             	add    $0x1,%edx
+    act[n].fd = rcmd->fd;
+     67c:	89 48 04             	mov    %ecx,0x4(%eax)
+    act[n].arg = rcmd->mode;
+     67f:	8b 4b 10             	mov    0x10(%ebx),%ecx
+     682:	89 48 08             	mov    %ecx,0x8(%eax)
+    act[n].path = rcmd->file;
+     685:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     688:	89 48 0c             	mov    %ecx,0xc(%eax)
+    cmd = rcmd->cmd;
+     68b:	8b 5b 04             	mov    0x4(%ebx),%ebx
+  for(n = 0; cmd->type == REDIR; n++){
+     68e:	8b 33                	mov    (%ebx),%esi
+     690:	83 fe 02             	cmp    $0x2,%esi
+     693:	75 1b                	jne    6b0 <spawncmd+0x60>
+    if(n == SPAWN_MAXACT)
+     695:	83 c0 10             	add    $0x10,%eax
+     698:	83 fa 08             	cmp    $0x8,%edx
+     69b:	75 d3                	jne    670 <spawncmd+0x20>
+      return 0;
+     69d:	31 f6                	xor    %esi,%esi
+}
+     69f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     6a2:	89 f0                	mov    %esi,%eax
+     6a4:	5b                   	pop    %ebx
+     6a5:	5e                   	pop    %esi
+     6a6:	5d                   	pop    %ebp
+     6a7:	c3                   	ret
+  for(n = 0; cmd->type == REDIR; n++){
+     6a8:	31 d2                	xor    %edx,%edx
+     6aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(cmd->type != EXEC)
+     6b0:	83 fe 01             	cmp    $0x1,%esi
+     6b3:	75 e8                	jne    69d <spawncmd+0x4d>
+  if(ecmd->argv[0] == 0)
+     6b5:	8b 43 04             	mov    0x4(%ebx),%eax
+     6b8:	85 c0                	test   %eax,%eax
+     6ba:	74 e3                	je     69f <spawncmd+0x4f>
+  if(spawn(ecmd->argv[0], ecmd->argv, act, n, -1) < 0){
+     6bc:	83 ec 0c             	sub    $0xc,%esp
+     6bf:	6a ff                	push   $0xffffffff
+     6c1:	52                   	push   %edx
+     6c2:	8d 95 78 ff ff ff    	lea    -0x88(%ebp),%edx
+     6c8:	52                   	push   %edx
+     6c9:	8d 53 04             	lea    0x4(%ebx),%edx
+     6cc:	52                   	push   %edx
+     6cd:	50                   	push   %eax
+     6ce:	e8 38 0f 00 00       	call   160b <spawn>
+     6d3:	83 c4 20             	add    $0x20,%esp
+     6d6:	85 c0                	test   %eax,%eax
+     6d8:	78 07                	js     6e1 <spawncmd+0x91>
+  wait();
+     6da:	e8 6c 0e 00 00       	call   154b <wait>
+  return 1;
+     6df:	eb be                	jmp    69f <spawncmd+0x4f>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+     6e1:	83 ec 04             	sub    $0x4,%esp
+     6e4:	ff 73 04             	push   0x4(%ebx)
+     6e7:	68 e9 1d 00 00       	push   $0x1de9
+     6ec:	6a 02                	push   $0x2
+     6ee:	e8 fd 0f 00 00       	call   16f0 <printf>
+    return 1;
+     6f3:	83 c4 10             	add    $0x10,%esp
+     6f6:	eb a7                	jmp    69f <spawncmd+0x4f>
+     6f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ff:	90                   	nop
+
+00000700 <panic>:
+{
+     700:	55                   	push   %ebp
+     701:	89 e5                	mov    %esp,%ebp
+     703:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "%s\n", s);
+     706:	ff 75 08             	push   0x8(%ebp)
+     709:	68 83 1e 00 00       	push   $0x1e83
+     70e:	6a 02                	push   $0x2
+     710:	e8 db 0f 00 00       	call   16f0 <printf>
+  exit();
+     715:	e8 29 0e 00 00       	call   1543 <exit>
+     71a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000720 <fork1>:
+{
+     720:	55                   	push   %ebp
+     721:	89 e5                	mov    %esp,%ebp
+     723:	83 ec 08             	sub    $0x8,%esp
+  pid = fork();
+     726:	e8 10 0e 00 00       	call   153b <fork>
+  if(pid == -1)
+     72b:	83 f8 ff             	cmp    $0xffffffff,%eax
+     72e:	74 02                	je     732 <fork1+0x12>
+  return pid;
+}
+     730:	c9                   	leave
+     731:	c3                   	ret
+    panic("fork");
+     732:	83 ec 0c             	sub    $0xc,%esp
+     735:	68 f9 1d 00 00       	push   $0x1df9
+     73a:	e8 c1 ff ff ff       	call   700 <panic>
+     73f:	90                   	nop
+
+00000740 <runcmd>:
+{
+     740:	55                   	push   %ebp
+     741:	89 e5                	mov    %esp,%ebp
+     743:	53                   	push   %ebx
+     744:	83 ec 14             	sub    $0x14,%esp
+     747:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd == 0)
+     74a:	85 db                	test   %ebx,%ebx
+     74c:	74 42                	je     790 <runcmd+0x50>
+  switch(cmd->type){
+     74e:	83 3b 05             	cmpl   $0x5,(%ebx)
+     751:	0f 87 e3 00 00 00    	ja     83a <runcmd+0xfa>
+     757:	8b 03                	mov    (%ebx),%eax
+     759:	ff 24 85 04 1f 00 00 	jmp    *0x1f04(,%eax,4)
+    if(ecmd->argv[0] == 0)
+     760:	8b 43 04             	mov    0x4(%ebx),%eax
+     763:	85 c0                	test   %eax,%eax
+     765:	74 29                	je     790 <runcmd+0x50>
+    exec(ecmd->argv[0], ecmd->argv);
+     767:	8d 53 04             	lea    0x4(%ebx),%edx
+     76a:	51                   	push   %ecx
+     76b:	51                   	push   %ecx
+     76c:	52                   	push   %edx
+     76d:	50                   	push   %eax
+     76e:	e8 08 0e 00 00       	call   157b <exec>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+     773:	83 c4 0c             	add    $0xc,%esp
+     776:	ff 73 04             	push   0x4(%ebx)
+     779:	68 e9 1d 00 00       	push   $0x1de9
+     77e:	6a 02                	push   $0x2
+     780:	e8 6b 0f 00 00       	call   16f0 <printf>
+    break;
+     785:	83 c4 10             	add    $0x10,%esp
+     788:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     78f:	90                   	nop
+    exit();
+     790:	e8 ae 0d 00 00       	call   1543 <exit>
+    if(fork1() == 0)
+     795:	e8 86 ff ff ff       	call   720 <fork1>
+     79a:	85 c0                	test   %eax,%eax
+     79c:	75 f2                	jne    790 <runcmd+0x50>
+     79e:	e9 8c 00 00 00       	jmp    82f <runcmd+0xef>
+    if(pipe(p) < 0)
+     7a3:	83 ec 0c             	sub    $0xc,%esp
+     7a6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     7a9:	50                   	push   %eax
+     7aa:	e8 a4 0d 00 00       	call   1553 <pipe>
+     7af:	83 c4 10             	add    $0x10,%esp
+     7b2:	85 c0                	test   %eax,%eax
+     7b4:	0f 88 a2 00 00 00    	js     85c <runcmd+0x11c>
+    if(fork1() == 0){
+     7ba:	e8 61 ff ff ff       	call   720 <fork1>
+     7bf:	85 c0                	test   %eax,%eax
+     7c1:	0f 84 a2 00 00 00    	je     869 <runcmd+0x129>
+    if(fork1() == 0){
+     7c7:	e8 54 ff ff ff       	call   720 <fork1>
+     7cc:	85 c0                	test   %eax,%eax
+     7ce:	0f 84 c3 00 00 00    	je     897 <runcmd+0x157>
+    close(p[0]);
+     7d4:	83 ec 0c             	sub    $0xc,%esp
+     7d7:	ff 75 f0             	push   -0x10(%ebp)
+     7da:	e8 8c 0d 00 00       	call   156b <close>
+    close(p[1]);
+     7df:	58                   	pop    %eax
+     7e0:	ff 75 f4             	push   -0xc(%ebp)
+     7e3:	e8 83 0d 00 00       	call   156b <close>
+    wait();
+     7e8:	e8 5e 0d 00 00       	call   154b <wait>
+    wait();
+     7ed:	e8 59 0d 00 00       	call   154b <wait>
+    break;
+     7f2:	83 c4 10             	add    $0x10,%esp
+     7f5:	eb 99                	jmp    790 <runcmd+0x50>
+    if(fork1() == 0)
+     7f7:	e8 24 ff ff ff       	call   720 <fork1>
+     7fc:	85 c0                	test   %eax,%eax
+     7fe:	74 2f                	je     82f <runcmd+0xef>
+    wait();
+     800:	e8 46 0d 00 00       	call   154b <wait>
+    runcmd(lcmd->right);
+     805:	83 ec 0c             	sub    $0xc,%esp
+     808:	ff 73 08             	push   0x8(%ebx)
+     80b:	e8 30 ff ff ff       	call   740 <runcmd>
+    close(rcmd->fd);
+     810:	83 ec 0c             	sub    $0xc,%esp
+     813:	ff 73 14             	push   0x14(%ebx)
+     816:	e8 50 0d 00 00       	call   156b <close>
+    if(open(rcmd->file, rcmd->mode) < 0){
+     81b:	58                   	pop    %eax
+     81c:	5a                   	pop    %edx
+     81d:	ff 73 10             	push   0x10(%ebx)
+     820:	ff 73 08             	push   0x8(%ebx)
+     823:	e8 5b 0d 00 00       	call   1583 <open>
+     828:	83 c4 10             	add    $0x10,%esp
+     82b:	85 c0                	test   %eax,%eax
+     82d:	78 18                	js     847 <runcmd+0x107>
+      runcmd(bcmd->cmd);
+     82f:	83 ec 0c             	sub    $0xc,%esp
+     832:	ff 73 04             	push   0x4(%ebx)
+     835:	e8 06 ff ff ff       	call   740 <runcmd>
+    panic("runcmd");
+     83a:	83 ec 0c             	sub    $0xc,%esp
+     83d:	68 fe 1d 00 00       	push   $0x1dfe
+     842:	e8 b9 fe ff ff       	call   700 <panic>
+      printf(2, "open %s failed\n", rcmd->file);
+     847:	51                   	push   %ecx
+     848:	ff 73 08             	push   0x8(%ebx)
+     84b:	68 05 1e 00 00       	push   $0x1e05
+     850:	6a 02                	push   $0x2
+     852:	e8 99 0e 00 00       	call   16f0 <printf>
+      exit();
+     857:	e8 e7 0c 00 00       	call   1543 <exit>
+      panic("pipe");
+     85c:	83 ec 0c             	sub    $0xc,%esp
+     85f:	68 15 1e 00 00       	push   $0x1e15
+     864:	e8 97 fe ff ff       	call   700 <panic>
+      close(1);
+     869:	83 ec 0c             	sub    $0xc,%esp
+     86c:	6a 01                	push   $0x1
+     86e:	e8 f8 0c 00 00       	call   156b <close>
+      dup(p[1]);
+     873:	58                   	pop    %eax
+     874:	ff 75 f4             	push   -0xc(%ebp)
+     877:	e8 3f 0d 00 00       	call   15bb <dup>
+      close(p[0]);
+     87c:	58                   	pop    %eax
+     87d:	ff 75 f0             	push   -0x10(%ebp)
+     880:	e8 e6 0c 00 00       	call   156b <close>
+      close(p[1]);
+     885:	58                   	pop    %eax
+     886:	ff 75 f4             	push   -0xc(%ebp)
+     889:	e8 dd 0c 00 00       	call   156b <close>
+      runcmd(pcmd->left);
+     88e:	5a                   	pop    %edx
+     88f:	ff 73 04             	push   0x4(%ebx)
+     892:	e8 a9 fe ff ff       	call   740 <runcmd>
+      close(0);
+     897:	83 ec 0c             	sub    $0xc,%esp
+     89a:	6a 00                	push   $0x0
+     89c:	e8 ca 0c 00 00       	call   156b <close>
+      dup(p[0]);
+     8a1:	5a                   	pop    %edx
+     8a2:	ff 75 f0             	push   -0x10(%ebp)
+     8a5:	e8 11 0d 00 00       	call   15bb <dup>
+      close(p[0]);
+     8aa:	59                   	pop    %ecx
+     8ab:	ff 75 f0             	push   -0x10(%ebp)
+     8ae:	e8 b8 0c 00 00       	call   156b <close>
+      close(p[1]);
+     8b3:	58                   	pop    %eax
+     8b4:	ff 75 f4             	push   -0xc(%ebp)
+     8b7:	e8 af 0c 00 00       	call   156b <close>
+      runcmd(pcmd->right);
+     8bc:	58                   	pop    %eax
+     8bd:	ff 73 08             	push   0x8(%ebx)
+     8c0:	e8 7b fe ff ff       	call   740 <runcmd>
+     8c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008d0 <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+     8d0:	55                   	push   %ebp
+     8d1:	89 e5                	mov    %esp,%ebp
+     8d3:	53                   	push   %ebx
+     8d4:	83 ec 10             	sub    $0x10,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     8d7:	6a 54                	push   $0x54
+     8d9:	e8 52 13 00 00       	call   1c30 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     8de:	83 c4 0c             	add    $0xc,%esp
+     8e1:	6a 54                	push   $0x54
+  cmd = malloc(sizeof(*cmd));
+     8e3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     8e5:	6a 00                	push   $0x0
+     8e7:	50                   	push   %eax
+     8e8:	e8 93 0a 00 00       	call   1380 <memset>
+  cmd->type = EXEC;
+     8ed:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  return (struct cmd*)cmd;
+}
+     8f3:	89 d8                	mov    %ebx,%eax
+     8f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     8f8:	c9                   	leave
+     8f9:	c3                   	ret
+     8fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000900 <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     900:	55                   	push   %ebp
+     901:	89 e5                	mov    %esp,%ebp
+     903:	53                   	push   %ebx
+     904:	83 ec 10             	sub    $0x10,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     907:	6a 18                	push   $0x18
+     909:	e8 22 13 00 00       	call   1c30 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     90e:	83 c4 0c             	add    $0xc,%esp
+     911:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     913:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     915:	6a 00                	push   $0x0
+     917:	50                   	push   %eax
+     918:	e8 63 0a 00 00       	call   1380 <memset>
+  cmd->type = REDIR;
+  cmd->cmd = subcmd;
+     91d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = REDIR;
+     920:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  cmd->cmd = subcmd;
+     926:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->file = file;
+     929:	8b 45 0c             	mov    0xc(%ebp),%eax
+     92c:	89 43 08             	mov    %eax,0x8(%ebx)
+  cmd->efile = efile;
+     92f:	8b 45 10             	mov    0x10(%ebp),%eax
+     932:	89 43 0c             	mov    %eax,0xc(%ebx)
+  cmd->mode = mode;
+     935:	8b 45 14             	mov    0x14(%ebp),%eax
+     938:	89 43 10             	mov    %eax,0x10(%ebx)
+  cmd->fd = fd;
+     93b:	8b 45 18             	mov    0x18(%ebp),%eax
+     93e:	89 43 14             	mov    %eax,0x14(%ebx)
+  return (struct cmd*)cmd;
+}
+     941:	89 d8                	mov    %ebx,%eax
+     943:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     946:	c9                   	leave
+     947:	c3                   	ret
+     948:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     94f:	90                   	nop
+
+00000950 <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     950:	55                   	push   %ebp
+     951:	89 e5                	mov    %esp,%ebp
+     953:	53                   	push   %ebx
+     954:	83 ec 10             	sub    $0x10,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     957:	6a 0c                	push   $0xc
+     959:	e8 d2 12 00 00       	call   1c30 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     95e:	83 c4 0c             	add    $0xc,%esp
+     961:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     963:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     965:	6a 00                	push   $0x0
+     967:	50                   	push   %eax
+     968:	e8 13 0a 00 00       	call   1380 <memset>
+  cmd->type = PIPE;
+  cmd->left = left;
+     96d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = PIPE;
+     970:	c7 03 03 00 00 00    	movl   $0x3,(%ebx)
+  cmd->left = left;
+     976:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     979:	8b 45 0c             	mov    0xc(%ebp),%eax
+     97c:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     97f:	89 d8                	mov    %ebx,%eax
+     981:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     984:	c9                   	leave
+     985:	c3                   	ret
+     986:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     98d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000990 <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+     990:	55                   	push   %ebp
+     991:	89 e5                	mov    %esp,%ebp
+     993:	53                   	push   %ebx
+     994:	83 ec 10             	sub    $0x10,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     997:	6a 0c                	push   $0xc
+     999:	e8 92 12 00 00       	call   1c30 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     99e:	83 c4 0c             	add    $0xc,%esp
+     9a1:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     9a3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     9a5:	6a 00                	push   $0x0
+     9a7:	50                   	push   %eax
+     9a8:	e8 d3 09 00 00       	call   1380 <memset>
+  cmd->type = LIST;
+  cmd->left = left;
+     9ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = LIST;
+     9b0:	c7 03 04 00 00 00    	movl   $0x4,(%ebx)
+  cmd->left = left;
+     9b6:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     9b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     9bc:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     9bf:	89 d8                	mov    %ebx,%eax
+     9c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     9c4:	c9                   	leave
+     9c5:	c3                   	ret
+     9c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009d0 <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+     9d0:	55                   	push   %ebp
+     9d1:	89 e5                	mov    %esp,%ebp
+     9d3:	53                   	push   %ebx
+     9d4:	83 ec 10             	sub    $0x10,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     9d7:	6a 08                	push   $0x8
+     9d9:	e8 52 12 00 00       	call   1c30 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     9de:	83 c4 0c             	add    $0xc,%esp
+     9e1:	6a 08                	push   $0x8
+  cmd = malloc(sizeof(*cmd));
+     9e3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     9e5:	6a 00                	push   $0x0
+     9e7:	50                   	push   %eax
+     9e8:	e8 93 09 00 00       	call   1380 <memset>
+  cmd->type = BACK;
+  cmd->cmd = subcmd;
+     9ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = BACK;
+     9f0:	c7 03 05 00 00 00    	movl   $0x5,(%ebx)
+  cmd->cmd = subcmd;
+     9f6:	89 43 04             	mov    %eax,0x4(%ebx)
+  return (struct cmd*)cmd;
+}
+     9f9:	89 d8                	mov    %ebx,%eax
+     9fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     9fe:	c9                   	leave
+     9ff:	c3                   	ret
+
+00000a00 <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+     a00:	55                   	push   %ebp
+     a01:	89 e5                	mov    %esp,%ebp
+     a03:	57                   	push   %edi
+     a04:	56                   	push   %esi
+     a05:	53                   	push   %ebx
+     a06:	83 ec 0c             	sub    $0xc,%esp
+  char *s;
+  int ret;
+
+  s = *ps;
+     a09:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+     a0c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     a0f:	8b 75 10             	mov    0x10(%ebp),%esi
+  s = *ps;
+     a12:	8b 38                	mov    (%eax),%edi
+  while(s < es && strchr(whitespace, *s))
+     a14:	39 df                	cmp    %ebx,%edi
+     a16:	72 0f                	jb     a27 <gettoken+0x27>
+     a18:	eb 25                	jmp    a3f <gettoken+0x3f>
+     a1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    s++;
+     a20:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     a23:	39 fb                	cmp    %edi,%ebx
+     a25:	74 18                	je     a3f <gettoken+0x3f>
+     a27:	0f be 07             	movsbl (%edi),%eax
+     a2a:	83 ec 08             	sub    $0x8,%esp
+     a2d:	50                   	push   %eax
+     a2e:	68 e0 27 00 00       	push   $0x27e0
+     a33:	e8 68 09 00 00       	call   13a0 <strchr>
+     a38:	83 c4 10             	add    $0x10,%esp
+     a3b:	85 c0                	test   %eax,%eax
+     a3d:	75 e1                	jne    a20 <gettoken+0x20>
+  if(q)
+     a3f:	85 f6                	test   %esi,%esi
+     a41:	74 02                	je     a45 <gettoken+0x45>
+    *q = s;
+     a43:	89 3e                	mov    %edi,(%esi)
+  ret = *s;
+     a45:	0f b6 07             	movzbl (%edi),%eax
+  switch(*s){
+     a48:	3c 3c                	cmp    $0x3c,%al
+     a4a:	0f 8f d0 00 00 00    	jg     b20 <gettoken+0x120>
+     a50:	3c 3a                	cmp    $0x3a,%al
+     a52:	0f 8f bc 00 00 00    	jg     b14 <gettoken+0x114>
+     a58:	84 c0                	test   %al,%al
+     a5a:	75 44                	jne    aa0 <gettoken+0xa0>
+     a5c:	31 f6                	xor    %esi,%esi
+    ret = 'a';
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+      s++;
+    break;
+  }
+  if(eq)
+     a5e:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     a61:	85 c9                	test   %ecx,%ecx
+     a63:	74 05                	je     a6a <gettoken+0x6a>
+    *eq = s;
+     a65:	8b 45 14             	mov    0x14(%ebp),%eax
+     a68:	89 38                	mov    %edi,(%eax)
+
+  while(s < es && strchr(whitespace, *s))
+     a6a:	39 df                	cmp    %ebx,%edi
+     a6c:	72 09                	jb     a77 <gettoken+0x77>
+     a6e:	eb 1f                	jmp    a8f <gettoken+0x8f>
+    s++;
+     a70:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     a73:	39 fb                	cmp    %edi,%ebx
+     a75:	74 18                	je     a8f <gettoken+0x8f>
+     a77:	0f be 07             	movsbl (%edi),%eax
+     a7a:	83 ec 08             	sub    $0x8,%esp
+     a7d:	50                   	push   %eax
+     a7e:	68 e0 27 00 00       	push   $0x27e0
+     a83:	e8 18 09 00 00       	call   13a0 <strchr>
+     a88:	83 c4 10             	add    $0x10,%esp
+     a8b:	85 c0                	test   %eax,%eax
+     a8d:	75 e1                	jne    a70 <gettoken+0x70>
+  *ps = s;
+     a8f:	8b 45 08             	mov    0x8(%ebp),%eax
+     a92:	89 38                	mov    %edi,(%eax)
+  return ret;
+}
+     a94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a97:	89 f0                	mov    %esi,%eax
+     a99:	5b                   	pop    %ebx
+     a9a:	5e                   	pop    %esi
+     a9b:	5f                   	pop    %edi
+     a9c:	5d                   	pop    %ebp
+     a9d:	c3                   	ret
+     a9e:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     aa0:	79 66                	jns    b08 <gettoken+0x108>
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     aa2:	39 df                	cmp    %ebx,%edi
+     aa4:	72 39                	jb     adf <gettoken+0xdf>
+  if(eq)
+     aa6:	8b 55 14             	mov    0x14(%ebp),%edx
+     aa9:	85 d2                	test   %edx,%edx
+     aab:	0f 84 b3 00 00 00    	je     b64 <gettoken+0x164>
+    *eq = s;
+     ab1:	8b 45 14             	mov    0x14(%ebp),%eax
+     ab4:	89 38                	mov    %edi,(%eax)
+  while(s < es && strchr(whitespace, *s))
+     ab6:	e9 a9 00 00 00       	jmp    b64 <gettoken+0x164>
+     abb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     abf:	90                   	nop
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     ac0:	0f be 07             	movsbl (%edi),%eax
+     ac3:	83 ec 08             	sub    $0x8,%esp
+     ac6:	50                   	push   %eax
+     ac7:	68 d8 27 00 00       	push   $0x27d8
+     acc:	e8 cf 08 00 00       	call   13a0 <strchr>
+     ad1:	83 c4 10             	add    $0x10,%esp
+     ad4:	85 c0                	test   %eax,%eax
+     ad6:	75 1f                	jne    af7 <gettoken+0xf7>
+      s++;
+     ad8:	83 c7 01             	add    $0x1,%edi
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     adb:	39 fb                	cmp    %edi,%ebx
+     add:	74 77                	je     b56 <gettoken+0x156>
+     adf:	0f be 07             	movsbl (%edi),%eax
+     ae2:	83 ec 08             	sub    $0x8,%esp
+     ae5:	50                   	push   %eax
+     ae6:	68 e0 27 00 00       	push   $0x27e0
+     aeb:	e8 b0 08 00 00       	call   13a0 <strchr>
+     af0:	83 c4 10             	add    $0x10,%esp
+     af3:	85 c0                	test   %eax,%eax
+     af5:	74 c9                	je     ac0 <gettoken+0xc0>
+    ret = 'a';
+     af7:	be 61 00 00 00       	mov    $0x61,%esi
+     afc:	e9 5d ff ff ff       	jmp    a5e <gettoken+0x5e>
+     b01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  switch(*s){
+     b08:	3c 26                	cmp    $0x26,%al
+     b0a:	74 08                	je     b14 <gettoken+0x114>
+     b0c:	8d 48 d8             	lea    -0x28(%eax),%ecx
+     b0f:	80 f9 01             	cmp    $0x1,%cl
+     b12:	77 8e                	ja     aa2 <gettoken+0xa2>
+  ret = *s;
+     b14:	0f be f0             	movsbl %al,%esi
+    s++;
+     b17:	83 c7 01             	add    $0x1,%edi
+    break;
+     b1a:	e9 3f ff ff ff       	jmp    a5e <gettoken+0x5e>
+     b1f:	90                   	nop
+  switch(*s){
+     b20:	3c 3e                	cmp    $0x3e,%al
+     b22:	75 1c                	jne    b40 <gettoken+0x140>
+    if(*s == '>'){
+     b24:	80 7f 01 3e          	cmpb   $0x3e,0x1(%edi)
+     b28:	74 1f                	je     b49 <gettoken+0x149>
+    s++;
+     b2a:	83 c7 01             	add    $0x1,%edi
+  ret = *s;
+     b2d:	be 3e 00 00 00       	mov    $0x3e,%esi
+     b32:	e9 27 ff ff ff       	jmp    a5e <gettoken+0x5e>
+     b37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b3e:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     b40:	3c 7c                	cmp    $0x7c,%al
+     b42:	74 d0                	je     b14 <gettoken+0x114>
+     b44:	e9 59 ff ff ff       	jmp    aa2 <gettoken+0xa2>
+      s++;
+     b49:	83 c7 02             	add    $0x2,%edi
+      ret = '+';
+     b4c:	be 2b 00 00 00       	mov    $0x2b,%esi
+     b51:	e9 08 ff ff ff       	jmp    a5e <gettoken+0x5e>
+  if(eq)
+     b56:	8b 45 14             	mov    0x14(%ebp),%eax
+     b59:	85 c0                	test   %eax,%eax
+     b5b:	74 05                	je     b62 <gettoken+0x162>
+    *eq = s;
+     b5d:	8b 45 14             	mov    0x14(%ebp),%eax
+     b60:	89 18                	mov    %ebx,(%eax)
+      s++;
+     b62:	89 df                	mov    %ebx,%edi
+    ret = 'a';
+     b64:	be 61 00 00 00       	mov    $0x61,%esi
+     b69:	e9 21 ff ff ff       	jmp    a8f <gettoken+0x8f>
+     b6e:	66 90                	xchg   %ax,%ax
+
+00000b70 <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+     b70:	55                   	push   %ebp
+     b71:	89 e5                	mov    %esp,%ebp
+     b73:	57                   	push   %edi
+     b74:	56                   	push   %esi
+     b75:	53                   	push   %ebx
+     b76:	83 ec 0c             	sub    $0xc,%esp
+     b79:	8b 7d 08             	mov    0x8(%ebp),%edi
+     b7c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *s;
+
+  s = *ps;
+     b7f:	8b 1f                	mov    (%edi),%ebx
+  while(s < es && strchr(whitespace, *s))
+     b81:	39 f3                	cmp    %esi,%ebx
+     b83:	72 12                	jb     b97 <peek+0x27>
+     b85:	eb 28                	jmp    baf <peek+0x3f>
+     b87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b8e:	66 90                	xchg   %ax,%ax
+    s++;
+     b90:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     b93:	39 de                	cmp    %ebx,%esi
+     b95:	74 18                	je     baf <peek+0x3f>
+     b97:	0f be 03             	movsbl (%ebx),%eax
+     b9a:	83 ec 08             	sub    $0x8,%esp
+     b9d:	50                   	push   %eax
+     b9e:	68 e0 27 00 00       	push   $0x27e0
+     ba3:	e8 f8 07 00 00       	call   13a0 <strchr>
+     ba8:	83 c4 10             	add    $0x10,%esp
+     bab:	85 c0                	test   %eax,%eax
+     bad:	75 e1                	jne    b90 <peek+0x20>
+  *ps = s;
+     baf:	89 1f                	mov    %ebx,(%edi)
+  return *s && strchr(toks, *s);
+     bb1:	0f be 03             	movsbl (%ebx),%eax
+     bb4:	31 d2                	xor    %edx,%edx
+     bb6:	84 c0                	test   %al,%al
+     bb8:	75 0e                	jne    bc8 <peek+0x58>
+}
+     bba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bbd:	89 d0                	mov    %edx,%eax
+     bbf:	5b                   	pop    %ebx
+     bc0:	5e                   	pop    %esi
+     bc1:	5f                   	pop    %edi
+     bc2:	5d                   	pop    %ebp
+     bc3:	c3                   	ret
+     bc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return *s && strchr(toks, *s);
+     bc8:	83 ec 08             	sub    $0x8,%esp
+     bcb:	50                   	push   %eax
+     bcc:	ff 75 10             	push   0x10(%ebp)
+     bcf:	e8 cc 07 00 00       	call   13a0 <strchr>
+     bd4:	83 c4 10             	add    $0x10,%esp
+     bd7:	31 d2                	xor    %edx,%edx
+     bd9:	85 c0                	test   %eax,%eax
+     bdb:	0f 95 c2             	setne  %dl
+}
+     bde:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     be1:	5b                   	pop    %ebx
+     be2:	89 d0                	mov    %edx,%eax
+     be4:	5e                   	pop    %esi
+     be5:	5f                   	pop    %edi
+     be6:	5d                   	pop    %ebp
+     be7:	c3                   	ret
+     be8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bef:	90                   	nop
+
+00000bf0 <syntax>:
+char *syntaxerr;
+
+void
+syntax(char *s)
+{
+  if(syntaxerr == 0)
+     bf0:	a1 00 28 00 00       	mov    0x2800,%eax
+     bf5:	85 c0                	test   %eax,%eax
+     bf7:	74 07                	je     c00 <syntax+0x10>
+     bf9:	c3                   	ret
+     bfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+{
+     c00:	55                   	push   %ebp
+     c01:	89 e5                	mov    %esp,%ebp
+    syntaxerr = s;
+     c03:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     c06:	5d                   	pop    %ebp
+    syntaxerr = s;
+     c07:	a3 00 28 00 00       	mov    %eax,0x2800
+}
+     c0c:	c3                   	ret
+     c0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c10 <parseredirs>:
+  return cmd;
+}
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     c10:	55                   	push   %ebp
+     c11:	89 e5                	mov    %esp,%ebp
+     c13:	57                   	push   %edi
+     c14:	56                   	push   %esi
+     c15:	53                   	push   %ebx
+     c16:	83 ec 2c             	sub    $0x2c,%esp
+     c19:	8b 75 0c             	mov    0xc(%ebp),%esi
+     c1c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+     c1f:	90                   	nop
+     c20:	83 ec 04             	sub    $0x4,%esp
+     c23:	68 37 1e 00 00       	push   $0x1e37
+     c28:	53                   	push   %ebx
+     c29:	56                   	push   %esi
+     c2a:	e8 41 ff ff ff       	call   b70 <peek>
+     c2f:	83 c4 10             	add    $0x10,%esp
+     c32:	85 c0                	test   %eax,%eax
+     c34:	0f 84 ff 00 00 00    	je     d39 <parseredirs+0x129>
+    tok = gettoken(ps, es, 0, 0);
+     c3a:	6a 00                	push   $0x0
+     c3c:	6a 00                	push   $0x0
+     c3e:	53                   	push   %ebx
+     c3f:	56                   	push   %esi
+     c40:	e8 bb fd ff ff       	call   a00 <gettoken>
+     c45:	89 c7                	mov    %eax,%edi
+    if(gettoken(ps, es, &q, &eq) != 'a'){
+     c47:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     c4a:	50                   	push   %eax
+     c4b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     c4e:	50                   	push   %eax
+     c4f:	53                   	push   %ebx
+     c50:	56                   	push   %esi
+     c51:	e8 aa fd ff ff       	call   a00 <gettoken>
+     c56:	83 c4 20             	add    $0x20,%esp
+     c59:	83 f8 61             	cmp    $0x61,%eax
+     c5c:	0f 85 ce 00 00 00    	jne    d30 <parseredirs+0x120>
+      syntax("missing file for redirection");
+      break;
+    }
+    switch(tok){
+     c62:	83 ff 3c             	cmp    $0x3c,%edi
+     c65:	74 69                	je     cd0 <parseredirs+0xc0>
+     c67:	83 ff 3e             	cmp    $0x3e,%edi
+     c6a:	74 05                	je     c71 <parseredirs+0x61>
+     c6c:	83 ff 2b             	cmp    $0x2b,%edi
+     c6f:	75 af                	jne    c20 <parseredirs+0x10>
+      break;
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+      break;
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     c71:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     c74:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     c77:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     c7a:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     c7d:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     c80:	6a 18                	push   $0x18
+     c82:	e8 a9 0f 00 00       	call   1c30 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     c87:	83 c4 0c             	add    $0xc,%esp
+     c8a:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     c8c:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     c8e:	6a 00                	push   $0x0
+     c90:	50                   	push   %eax
+     c91:	e8 ea 06 00 00       	call   1380 <memset>
+  cmd->type = REDIR;
+     c96:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  cmd->cmd = subcmd;
+     c9c:	8b 45 08             	mov    0x8(%ebp),%eax
+      break;
+     c9f:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     ca2:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     ca5:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     ca8:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     cab:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->mode = mode;
+     cae:	c7 47 10 01 02 00 00 	movl   $0x201,0x10(%edi)
+  cmd->efile = efile;
+     cb5:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->fd = fd;
+     cb8:	c7 47 14 01 00 00 00 	movl   $0x1,0x14(%edi)
+      break;
+     cbf:	89 7d 08             	mov    %edi,0x8(%ebp)
+     cc2:	e9 59 ff ff ff       	jmp    c20 <parseredirs+0x10>
+     cc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cce:	66 90                	xchg   %ax,%ax
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     cd0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     cd3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     cd6:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     cd9:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     cdc:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     cdf:	6a 18                	push   $0x18
+     ce1:	e8 4a 0f 00 00       	call   1c30 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     ce6:	83 c4 0c             	add    $0xc,%esp
+     ce9:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     ceb:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     ced:	6a 00                	push   $0x0
+     cef:	50                   	push   %eax
+     cf0:	e8 8b 06 00 00       	call   1380 <memset>
+  cmd->cmd = subcmd;
+     cf5:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->file = file;
+     cf8:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+      break;
+     cfb:	89 7d 08             	mov    %edi,0x8(%ebp)
+  cmd->efile = efile;
+     cfe:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->type = REDIR;
+     d01:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+      break;
+     d07:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     d0a:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     d0d:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     d10:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->mode = mode;
+     d13:	c7 47 10 00 00 00 00 	movl   $0x0,0x10(%edi)
+  cmd->fd = fd;
+     d1a:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+      break;
+     d21:	e9 fa fe ff ff       	jmp    c20 <parseredirs+0x10>
+     d26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d2d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(syntaxerr == 0)
+     d30:	a1 00 28 00 00       	mov    0x2800,%eax
+     d35:	85 c0                	test   %eax,%eax
+     d37:	74 0b                	je     d44 <parseredirs+0x134>
+    }
+  }
+  return cmd;
+}
+     d39:	8b 45 08             	mov    0x8(%ebp),%eax
+     d3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d3f:	5b                   	pop    %ebx
+     d40:	5e                   	pop    %esi
+     d41:	5f                   	pop    %edi
+     d42:	5d                   	pop    %ebp
+     d43:	c3                   	ret
+    syntaxerr = s;
+     d44:	c7 05 00 28 00 00 1a 	movl   $0x1e1a,0x2800
+     d4b:	1e 00 00 
+}
+     d4e:	8b 45 08             	mov    0x8(%ebp),%eax
+     d51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d54:	5b                   	pop    %ebx
+     d55:	5e                   	pop    %esi
+     d56:	5f                   	pop    %edi
+     d57:	5d                   	pop    %ebp
+     d58:	c3                   	ret
+     d59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000d60 <parseexec>:
+  return cmd;
+}
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+     d60:	55                   	push   %ebp
+     d61:	89 e5                	mov    %esp,%ebp
+     d63:	57                   	push   %edi
+     d64:	56                   	push   %esi
+     d65:	53                   	push   %ebx
+     d66:	83 ec 30             	sub    $0x30,%esp
+     d69:	8b 75 08             	mov    0x8(%ebp),%esi
+     d6c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if(peek(ps, es, "("))
+     d6f:	68 3a 1e 00 00       	push   $0x1e3a
+     d74:	57                   	push   %edi
+     d75:	56                   	push   %esi
+     d76:	e8 f5 fd ff ff       	call   b70 <peek>
+     d7b:	83 c4 10             	add    $0x10,%esp
+     d7e:	85 c0                	test   %eax,%eax
+     d80:	0f 85 ca 00 00 00    	jne    e50 <parseexec+0xf0>
+  cmd = malloc(sizeof(*cmd));
+     d86:	83 ec 0c             	sub    $0xc,%esp
+     d89:	89 c3                	mov    %eax,%ebx
+     d8b:	6a 54                	push   $0x54
+     d8d:	e8 9e 0e 00 00       	call   1c30 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     d92:	83 c4 0c             	add    $0xc,%esp
+     d95:	6a 54                	push   $0x54
+     d97:	6a 00                	push   $0x0
+     d99:	50                   	push   %eax
+     d9a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     d9d:	e8 de 05 00 00       	call   1380 <memset>
+  cmd->type = EXEC;
+     da2:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+
+  ret = execcmd();
+  cmd = (struct execcmd*)ret;
+
+  argc = 0;
+  ret = parseredirs(ret, ps, es);
+     da5:	83 c4 0c             	add    $0xc,%esp
+  cmd->type = EXEC;
+     da8:	c7 02 01 00 00 00    	movl   $0x1,(%edx)
+  ret = parseredirs(ret, ps, es);
+     dae:	57                   	push   %edi
+     daf:	56                   	push   %esi
+     db0:	52                   	push   %edx
+     db1:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     db4:	e8 57 fe ff ff       	call   c10 <parseredirs>
+  while(!peek(ps, es, "|)&;")){
+     db9:	83 c4 10             	add    $0x10,%esp
+  ret = parseredirs(ret, ps, es);
+     dbc:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     dbf:	eb 2e                	jmp    def <parseexec+0x8f>
+     dc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    }
+    if(argc >= MAXARGS-1){
+      syntax("too many args");
+      break;
+    }
+    cmd->argv[argc] = q;
+     dc8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     dcb:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+    cmd->eargv[argc] = eq;
+    argc++;
+    ret = parseredirs(ret, ps, es);
+     dce:	83 ec 04             	sub    $0x4,%esp
+    cmd->argv[argc] = q;
+     dd1:	89 44 99 04          	mov    %eax,0x4(%ecx,%ebx,4)
+    cmd->eargv[argc] = eq;
+     dd5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     dd8:	89 44 99 2c          	mov    %eax,0x2c(%ecx,%ebx,4)
+    argc++;
+     ddc:	83 c3 01             	add    $0x1,%ebx
+    ret = parseredirs(ret, ps, es);
+     ddf:	57                   	push   %edi
+     de0:	56                   	push   %esi
+     de1:	ff 75 d4             	push   -0x2c(%ebp)
+     de4:	e8 27 fe ff ff       	call   c10 <parseredirs>
+     de9:	83 c4 10             	add    $0x10,%esp
+     dec:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     def:	83 ec 04             	sub    $0x4,%esp
+     df2:	68 51 1e 00 00       	push   $0x1e51
+     df7:	57                   	push   %edi
+     df8:	56                   	push   %esi
+     df9:	e8 72 fd ff ff       	call   b70 <peek>
+     dfe:	83 c4 10             	add    $0x10,%esp
+     e01:	85 c0                	test   %eax,%eax
+     e03:	75 63                	jne    e68 <parseexec+0x108>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     e05:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     e08:	50                   	push   %eax
+     e09:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     e0c:	50                   	push   %eax
+     e0d:	57                   	push   %edi
+     e0e:	56                   	push   %esi
+     e0f:	e8 ec fb ff ff       	call   a00 <gettoken>
+     e14:	83 c4 10             	add    $0x10,%esp
+     e17:	85 c0                	test   %eax,%eax
+     e19:	74 4d                	je     e68 <parseexec+0x108>
+    if(tok != 'a'){
+     e1b:	83 f8 61             	cmp    $0x61,%eax
+     e1e:	75 60                	jne    e80 <parseexec+0x120>
+    if(argc >= MAXARGS-1){
+     e20:	83 fb 09             	cmp    $0x9,%ebx
+     e23:	75 a3                	jne    dc8 <parseexec+0x68>
+  if(syntaxerr == 0)
+     e25:	a1 00 28 00 00       	mov    0x2800,%eax
+     e2a:	8b 55 d0             	mov    -0x30(%ebp),%edx
+     e2d:	85 c0                	test   %eax,%eax
+     e2f:	74 3f                	je     e70 <parseexec+0x110>
+  }
+  cmd->argv[argc] = 0;
+     e31:	c7 44 9a 04 00 00 00 	movl   $0x0,0x4(%edx,%ebx,4)
+     e38:	00 
+  cmd->eargv[argc] = 0;
+  return ret;
+}
+     e39:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  cmd->eargv[argc] = 0;
+     e3c:	c7 44 9a 2c 00 00 00 	movl   $0x0,0x2c(%edx,%ebx,4)
+     e43:	00 
+}
+     e44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e47:	5b                   	pop    %ebx
+     e48:	5e                   	pop    %esi
+     e49:	5f                   	pop    %edi
+     e4a:	5d                   	pop    %ebp
+     e4b:	c3                   	ret
+     e4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return parseblock(ps, es);
+     e50:	89 7d 0c             	mov    %edi,0xc(%ebp)
+     e53:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+     e56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e59:	5b                   	pop    %ebx
+     e5a:	5e                   	pop    %esi
+     e5b:	5f                   	pop    %edi
+     e5c:	5d                   	pop    %ebp
+    return parseblock(ps, es);
+     e5d:	e9 ae 01 00 00       	jmp    1010 <parseblock>
+     e62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     e68:	8b 55 d0             	mov    -0x30(%ebp),%edx
+     e6b:	eb c4                	jmp    e31 <parseexec+0xd1>
+     e6d:	8d 76 00             	lea    0x0(%esi),%esi
+    syntaxerr = s;
+     e70:	c7 05 00 28 00 00 43 	movl   $0x1e43,0x2800
+     e77:	1e 00 00 
+     e7a:	eb b5                	jmp    e31 <parseexec+0xd1>
+     e7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(syntaxerr == 0)
+     e80:	8b 0d 00 28 00 00    	mov    0x2800,%ecx
+     e86:	8b 55 d0             	mov    -0x30(%ebp),%edx
+     e89:	85 c9                	test   %ecx,%ecx
+     e8b:	75 a4                	jne    e31 <parseexec+0xd1>
+    syntaxerr = s;
+     e8d:	c7 05 00 28 00 00 3c 	movl   $0x1e3c,0x2800
+     e94:	1e 00 00 
+     e97:	eb 98                	jmp    e31 <parseexec+0xd1>
+     e99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000ea0 <parsepipe>:
+{
+     ea0:	55                   	push   %ebp
+     ea1:	89 e5                	mov    %esp,%ebp
+     ea3:	57                   	push   %edi
+     ea4:	56                   	push   %esi
+     ea5:	53                   	push   %ebx
+     ea6:	83 ec 14             	sub    $0x14,%esp
+     ea9:	8b 75 08             	mov    0x8(%ebp),%esi
+     eac:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parseexec(ps, es);
+     eaf:	57                   	push   %edi
+     eb0:	56                   	push   %esi
+     eb1:	e8 aa fe ff ff       	call   d60 <parseexec>
+  if(peek(ps, es, "|")){
+     eb6:	83 c4 0c             	add    $0xc,%esp
+     eb9:	68 56 1e 00 00       	push   $0x1e56
+  cmd = parseexec(ps, es);
+     ebe:	89 c3                	mov    %eax,%ebx
+  if(peek(ps, es, "|")){
+     ec0:	57                   	push   %edi
+     ec1:	56                   	push   %esi
+     ec2:	e8 a9 fc ff ff       	call   b70 <peek>
+     ec7:	83 c4 10             	add    $0x10,%esp
+     eca:	85 c0                	test   %eax,%eax
+     ecc:	75 12                	jne    ee0 <parsepipe+0x40>
+}
+     ece:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ed1:	89 d8                	mov    %ebx,%eax
+     ed3:	5b                   	pop    %ebx
+     ed4:	5e                   	pop    %esi
+     ed5:	5f                   	pop    %edi
+     ed6:	5d                   	pop    %ebp
+     ed7:	c3                   	ret
+     ed8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     edf:	90                   	nop
+    gettoken(ps, es, 0, 0);
+     ee0:	6a 00                	push   $0x0
+     ee2:	6a 00                	push   $0x0
+     ee4:	57                   	push   %edi
+     ee5:	56                   	push   %esi
+     ee6:	e8 15 fb ff ff       	call   a00 <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     eeb:	58                   	pop    %eax
+     eec:	5a                   	pop    %edx
+     eed:	57                   	push   %edi
+     eee:	56                   	push   %esi
+     eef:	e8 ac ff ff ff       	call   ea0 <parsepipe>
+  cmd = malloc(sizeof(*cmd));
+     ef4:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     efb:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     efd:	e8 2e 0d 00 00       	call   1c30 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     f02:	83 c4 0c             	add    $0xc,%esp
+     f05:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     f07:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     f09:	6a 00                	push   $0x0
+     f0b:	50                   	push   %eax
+     f0c:	e8 6f 04 00 00       	call   1380 <memset>
+  cmd->left = left;
+     f11:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     f14:	83 c4 10             	add    $0x10,%esp
+     f17:	89 f3                	mov    %esi,%ebx
+  cmd->type = PIPE;
+     f19:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+}
+     f1f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     f21:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     f24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f27:	5b                   	pop    %ebx
+     f28:	5e                   	pop    %esi
+     f29:	5f                   	pop    %edi
+     f2a:	5d                   	pop    %ebp
+     f2b:	c3                   	ret
+     f2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000f30 <parseline>:
+{
+     f30:	55                   	push   %ebp
+     f31:	89 e5                	mov    %esp,%ebp
+     f33:	57                   	push   %edi
+     f34:	56                   	push   %esi
+     f35:	53                   	push   %ebx
+     f36:	83 ec 24             	sub    $0x24,%esp
+     f39:	8b 75 08             	mov    0x8(%ebp),%esi
+     f3c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parsepipe(ps, es);
+     f3f:	57                   	push   %edi
+     f40:	56                   	push   %esi
+     f41:	e8 5a ff ff ff       	call   ea0 <parsepipe>
+  while(peek(ps, es, "&")){
+     f46:	83 c4 10             	add    $0x10,%esp
+  cmd = parsepipe(ps, es);
+     f49:	89 c3                	mov    %eax,%ebx
+  while(peek(ps, es, "&")){
+     f4b:	eb 3b                	jmp    f88 <parseline+0x58>
+     f4d:	8d 76 00             	lea    0x0(%esi),%esi
+    gettoken(ps, es, 0, 0);
+     f50:	6a 00                	push   $0x0
+     f52:	6a 00                	push   $0x0
+     f54:	57                   	push   %edi
+     f55:	56                   	push   %esi
+     f56:	e8 a5 fa ff ff       	call   a00 <gettoken>
+  cmd = malloc(sizeof(*cmd));
+     f5b:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+     f62:	e8 c9 0c 00 00       	call   1c30 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     f67:	83 c4 0c             	add    $0xc,%esp
+     f6a:	6a 08                	push   $0x8
+     f6c:	6a 00                	push   $0x0
+     f6e:	50                   	push   %eax
+     f6f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     f72:	e8 09 04 00 00       	call   1380 <memset>
+  cmd->type = BACK;
+     f77:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  cmd->cmd = subcmd;
+     f7a:	83 c4 10             	add    $0x10,%esp
+  cmd->type = BACK;
+     f7d:	c7 02 05 00 00 00    	movl   $0x5,(%edx)
+  cmd->cmd = subcmd;
+     f83:	89 5a 04             	mov    %ebx,0x4(%edx)
+     f86:	89 d3                	mov    %edx,%ebx
+  while(peek(ps, es, "&")){
+     f88:	83 ec 04             	sub    $0x4,%esp
+     f8b:	68 58 1e 00 00       	push   $0x1e58
+     f90:	57                   	push   %edi
+     f91:	56                   	push   %esi
+     f92:	e8 d9 fb ff ff       	call   b70 <peek>
+     f97:	83 c4 10             	add    $0x10,%esp
+     f9a:	85 c0                	test   %eax,%eax
+     f9c:	75 b2                	jne    f50 <parseline+0x20>
+  if(peek(ps, es, ";")){
+     f9e:	83 ec 04             	sub    $0x4,%esp
+     fa1:	68 54 1e 00 00       	push   $0x1e54
+     fa6:	57                   	push   %edi
+     fa7:	56                   	push   %esi
+     fa8:	e8 c3 fb ff ff       	call   b70 <peek>
+     fad:	83 c4 10             	add    $0x10,%esp
+     fb0:	85 c0                	test   %eax,%eax
+     fb2:	75 0c                	jne    fc0 <parseline+0x90>
+}
+     fb4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     fb7:	89 d8                	mov    %ebx,%eax
+     fb9:	5b                   	pop    %ebx
+     fba:	5e                   	pop    %esi
+     fbb:	5f                   	pop    %edi
+     fbc:	5d                   	pop    %ebp
+     fbd:	c3                   	ret
+     fbe:	66 90                	xchg   %ax,%ax
+    gettoken(ps, es, 0, 0);
+     fc0:	6a 00                	push   $0x0
+     fc2:	6a 00                	push   $0x0
+     fc4:	57                   	push   %edi
+     fc5:	56                   	push   %esi
+     fc6:	e8 35 fa ff ff       	call   a00 <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+     fcb:	58                   	pop    %eax
+     fcc:	5a                   	pop    %edx
+     fcd:	57                   	push   %edi
+     fce:	56                   	push   %esi
+     fcf:	e8 5c ff ff ff       	call   f30 <parseline>
+  cmd = malloc(sizeof(*cmd));
+     fd4:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = listcmd(cmd, parseline(ps, es));
+     fdb:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     fdd:	e8 4e 0c 00 00       	call   1c30 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     fe2:	83 c4 0c             	add    $0xc,%esp
+     fe5:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     fe7:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     fe9:	6a 00                	push   $0x0
+     feb:	50                   	push   %eax
+     fec:	e8 8f 03 00 00       	call   1380 <memset>
+  cmd->left = left;
+     ff1:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     ff4:	83 c4 10             	add    $0x10,%esp
+     ff7:	89 f3                	mov    %esi,%ebx
+  cmd->type = LIST;
+     ff9:	c7 06 04 00 00 00    	movl   $0x4,(%esi)
+}
+     fff:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+    1001:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+    1004:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1007:	5b                   	pop    %ebx
+    1008:	5e                   	pop    %esi
+    1009:	5f                   	pop    %edi
+    100a:	5d                   	pop    %ebp
+    100b:	c3                   	ret
+    100c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001010 <parseblock>:
+{
+    1010:	55                   	push   %ebp
+    1011:	89 e5                	mov    %esp,%ebp
+    1013:	57                   	push   %edi
+    1014:	56                   	push   %esi
+    1015:	53                   	push   %ebx
+    1016:	83 ec 10             	sub    $0x10,%esp
+    1019:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    101c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(!peek(ps, es, "("))
+    101f:	68 3a 1e 00 00       	push   $0x1e3a
+    1024:	56                   	push   %esi
+    1025:	53                   	push   %ebx
+    1026:	e8 45 fb ff ff       	call   b70 <peek>
+    102b:	83 c4 10             	add    $0x10,%esp
+    102e:	85 c0                	test   %eax,%eax
+    1030:	0f 84 7e 00 00 00    	je     10b4 <parseblock+0xa4>
+  gettoken(ps, es, 0, 0);
+    1036:	6a 00                	push   $0x0
+    1038:	6a 00                	push   $0x0
+    103a:	56                   	push   %esi
+    103b:	53                   	push   %ebx
+    103c:	e8 bf f9 ff ff       	call   a00 <gettoken>
+  cmd = parseline(ps, es);
+    1041:	5a                   	pop    %edx
+    1042:	59                   	pop    %ecx
+    1043:	56                   	push   %esi
+    1044:	53                   	push   %ebx
+    1045:	e8 e6 fe ff ff       	call   f30 <parseline>
+  if(!peek(ps, es, ")")){
+    104a:	83 c4 0c             	add    $0xc,%esp
+    104d:	68 76 1e 00 00       	push   $0x1e76
+  cmd = parseline(ps, es);
+    1052:	89 c7                	mov    %eax,%edi
+  if(!peek(ps, es, ")")){
+    1054:	56                   	push   %esi
+    1055:	53                   	push   %ebx
+    1056:	e8 15 fb ff ff       	call   b70 <peek>
+    105b:	83 c4 10             	add    $0x10,%esp
+    105e:	85 c0                	test   %eax,%eax
+    1060:	75 16                	jne    1078 <parseblock+0x68>
+  if(syntaxerr == 0)
+    1062:	a1 00 28 00 00       	mov    0x2800,%eax
+    1067:	85 c0                	test   %eax,%eax
+    1069:	74 35                	je     10a0 <parseblock+0x90>
+}
+    106b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    106e:	89 f8                	mov    %edi,%eax
+    1070:	5b                   	pop    %ebx
+    1071:	5e                   	pop    %esi
+    1072:	5f                   	pop    %edi
+    1073:	5d                   	pop    %ebp
+    1074:	c3                   	ret
+    1075:	8d 76 00             	lea    0x0(%esi),%esi
+  gettoken(ps, es, 0, 0);
+    1078:	6a 00                	push   $0x0
+    107a:	6a 00                	push   $0x0
+    107c:	56                   	push   %esi
+    107d:	53                   	push   %ebx
+    107e:	e8 7d f9 ff ff       	call   a00 <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+    1083:	83 c4 0c             	add    $0xc,%esp
+    1086:	56                   	push   %esi
+    1087:	53                   	push   %ebx
+    1088:	57                   	push   %edi
+    1089:	e8 82 fb ff ff       	call   c10 <parseredirs>
+  return cmd;
+    108e:	83 c4 10             	add    $0x10,%esp
+}
+    1091:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  cmd = parseredirs(cmd, ps, es);
+    1094:	89 c7                	mov    %eax,%edi
+}
+    1096:	5b                   	pop    %ebx
+    1097:	5e                   	pop    %esi
+    1098:	89 f8                	mov    %edi,%eax
+    109a:	5f                   	pop    %edi
+    109b:	5d                   	pop    %ebp
+    109c:	c3                   	ret
+    109d:	8d 76 00             	lea    0x0(%esi),%esi
+    syntaxerr = s;
+    10a0:	c7 05 00 28 00 00 65 	movl   $0x1e65,0x2800
+    10a7:	1e 00 00 
+}
+    10aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    10ad:	89 f8                	mov    %edi,%eax
+    10af:	5b                   	pop    %ebx
+    10b0:	5e                   	pop    %esi
+    10b1:	5f                   	pop    %edi
+    10b2:	5d                   	pop    %ebp
+    10b3:	c3                   	ret
+    panic("parseblock");
+    10b4:	83 ec 0c             	sub    $0xc,%esp
+    10b7:	68 5a 1e 00 00       	push   $0x1e5a
+    10bc:	e8 3f f6 ff ff       	call   700 <panic>
+    10c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10cf:	90                   	nop
+
+000010d0 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+    10d0:	55                   	push   %ebp
+    10d1:	89 e5                	mov    %esp,%ebp
+    10d3:	53                   	push   %ebx
+    10d4:	83 ec 04             	sub    $0x4,%esp
+    10d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+    10da:	85 db                	test   %ebx,%ebx
+    10dc:	0f 84 7e 00 00 00    	je     1160 <nulterminate+0x90>
+    return 0;
+
+  switch(cmd->type){
+    10e2:	83 3b 05             	cmpl   $0x5,(%ebx)
+    10e5:	77 20                	ja     1107 <nulterminate+0x37>
+    10e7:	8b 03                	mov    (%ebx),%eax
+    10e9:	ff 24 85 1c 1f 00 00 	jmp    *0x1f1c(,%eax,4)
+    nulterminate(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    nulterminate(lcmd->left);
+    10f0:	83 ec 0c             	sub    $0xc,%esp
+    10f3:	ff 73 04             	push   0x4(%ebx)
+    10f6:	e8 d5 ff ff ff       	call   10d0 <nulterminate>
+    nulterminate(lcmd->right);
+    10fb:	58                   	pop    %eax
+    10fc:	ff 73 08             	push   0x8(%ebx)
+    10ff:	e8 cc ff ff ff       	call   10d0 <nulterminate>
+    break;
+    1104:	83 c4 10             	add    $0x10,%esp
+    return 0;
+    1107:	89 d8                	mov    %ebx,%eax
+    bcmd = (struct backcmd*)cmd;
+    nulterminate(bcmd->cmd);
+    break;
+  }
+  return cmd;
+}
+    1109:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    110c:	c9                   	leave
+    110d:	c3                   	ret
+    110e:	66 90                	xchg   %ax,%ax
+    nulterminate(bcmd->cmd);
+    1110:	83 ec 0c             	sub    $0xc,%esp
+    1113:	ff 73 04             	push   0x4(%ebx)
+    1116:	e8 b5 ff ff ff       	call   10d0 <nulterminate>
+    break;
+    111b:	83 c4 10             	add    $0x10,%esp
+    111e:	eb e7                	jmp    1107 <nulterminate+0x37>
+    for(i=0; ecmd->argv[i]; i++)
+    1120:	8b 4b 04             	mov    0x4(%ebx),%ecx
+    1123:	8d 43 08             	lea    0x8(%ebx),%eax
+    1126:	85 c9                	test   %ecx,%ecx
+    1128:	74 dd                	je     1107 <nulterminate+0x37>
+    112a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      *ecmd->eargv[i] = 0;
+    1130:	8b 50 24             	mov    0x24(%eax),%edx
+    for(i=0; ecmd->argv[i]; i++)
+    1133:	83 c0 04             	add    $0x4,%eax
+      *ecmd->eargv[i] = 0;
+    1136:	c6 02 00             	movb   $0x0,(%edx)
+    for(i=0; ecmd->argv[i]; i++)
+    1139:	8b 50 fc             	mov    -0x4(%eax),%edx
+    113c:	85 d2                	test   %edx,%edx
+    113e:	75 f0                	jne    1130 <nulterminate+0x60>
+    1140:	eb c5                	jmp    1107 <nulterminate+0x37>
+    1142:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    nulterminate(rcmd->cmd);
+    1148:	83 ec 0c             	sub    $0xc,%esp
+    114b:	ff 73 04             	push   0x4(%ebx)
+    114e:	e8 7d ff ff ff       	call   10d0 <nulterminate>
+    *rcmd->efile = 0;
+    1153:	8b 43 0c             	mov    0xc(%ebx),%eax
+    break;
+    1156:	83 c4 10             	add    $0x10,%esp
+    *rcmd->efile = 0;
+    1159:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+    115c:	eb a9                	jmp    1107 <nulterminate+0x37>
+    115e:	66 90                	xchg   %ax,%ax
+    return 0;
+    1160:	31 c0                	xor    %eax,%eax
+    1162:	eb a5                	jmp    1109 <nulterminate+0x39>
+    1164:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    116b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    116f:	90                   	nop
+
+00001170 <freecmd>:
+
+// Free the tree that parsecmd built.
+void
+freecmd(struct cmd *cmd)
+{
+    1170:	55                   	push   %ebp
+    1171:	89 e5                	mov    %esp,%ebp
+    1173:	53                   	push   %ebx
+    1174:	83 ec 04             	sub    $0x4,%esp
+    1177:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct backcmd *bcmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+    117a:	85 db                	test   %ebx,%ebx
+    117c:	74 62                	je     11e0 <freecmd+0x70>
+    return;
+
+  switch(cmd->type){
+    117e:	8b 03                	mov    (%ebx),%eax
+    1180:	83 f8 04             	cmp    $0x4,%eax
+    1183:	74 0c                	je     1191 <freecmd+0x21>
+    1185:	7f 31                	jg     11b8 <freecmd+0x48>
+    1187:	83 f8 02             	cmp    $0x2,%eax
+    118a:	74 31                	je     11bd <freecmd+0x4d>
+    118c:	83 f8 03             	cmp    $0x3,%eax
+    118f:	75 17                	jne    11a8 <freecmd+0x38>
+    freecmd(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    freecmd(lcmd->left);
+    1191:	83 ec 0c             	sub    $0xc,%esp
+    1194:	ff 73 04             	push   0x4(%ebx)
+    1197:	e8 d4 ff ff ff       	call   1170 <freecmd>
+    freecmd(lcmd->right);
+    119c:	58                   	pop    %eax
+    119d:	ff 73 08             	push   0x8(%ebx)
+    11a0:	e8 cb ff ff ff       	call   1170 <freecmd>
+    break;
+    11a5:	83 c4 10             	add    $0x10,%esp
+  case BACK:
+    bcmd = (struct backcmd*)cmd;
+    freecmd(bcmd->cmd);
+    break;
+  }
+  free(cmd);
+    11a8:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    11ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    11ae:	c9                   	leave
+  free(cmd);
+    11af:	e9 8c 09 00 00       	jmp    1b40 <free>
+    11b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  switch(cmd->type){
+    11b8:	83 f8 05             	cmp    $0x5,%eax
+    11bb:	75 eb                	jne    11a8 <freecmd+0x38>
+    freecmd(bcmd->cmd);
+    11bd:	83 ec 0c             	sub    $0xc,%esp
+    11c0:	ff 73 04             	push   0x4(%ebx)
+    11c3:	e8 a8 ff ff ff       	call   1170 <freecmd>
+  free(cmd);
+    11c8:	89 5d 08             	mov    %ebx,0x8(%ebp)
+    break;
+    11cb:	83 c4 10             	add    $0x10,%esp
+}
+    11ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    11d1:	c9                   	leave
+  free(cmd);
+    11d2:	e9 69 09 00 00       	jmp    1b40 <free>
+    11d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11de:	66 90                	xchg   %ax,%ax
+}
+    11e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    11e3:	c9                   	leave
+    11e4:	c3                   	ret
+    11e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000011f0 <parsecmd>:
+{
+    11f0:	55                   	push   %ebp
+    11f1:	89 e5                	mov    %esp,%ebp
+    11f3:	57                   	push   %edi
+    11f4:	56                   	push   %esi
+  cmd = parseline(&s, es);
+    11f5:	8d 7d 08             	lea    0x8(%ebp),%edi
+{
+    11f8:	53                   	push   %ebx
+    11f9:	83 ec 18             	sub    $0x18,%esp
+  es = s + strlen(s);
+    11fc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  syntaxerr = 0;
+    11ff:	c7 05 00 28 00 00 00 	movl   $0x0,0x2800
+    1206:	00 00 00 
+  es = s + strlen(s);
+    1209:	53                   	push   %ebx
+    120a:	e8 41 01 00 00       	call   1350 <strlen>
+    120f:	01 c3                	add    %eax,%ebx
+  cmd = parseline(&s, es);
+    1211:	58                   	pop    %eax
+    1212:	5a                   	pop    %edx
+    1213:	53                   	push   %ebx
+    1214:	57                   	push   %edi
+    1215:	e8 16 fd ff ff       	call   f30 <parseline>
+  peek(&s, es, "");
+    121a:	83 c4 0c             	add    $0xc,%esp
+    121d:	68 c8 1e 00 00       	push   $0x1ec8
+  cmd = parseline(&s, es);
+    1222:	89 c6                	mov    %eax,%esi
+  peek(&s, es, "");
+    1224:	53                   	push   %ebx
+    1225:	57                   	push   %edi
+    1226:	e8 45 f9 ff ff       	call   b70 <peek>
+  if(s != es && syntaxerr == 0){
+    122b:	8b 55 08             	mov    0x8(%ebp),%edx
+    122e:	a1 00 28 00 00       	mov    0x2800,%eax
+    1233:	83 c4 10             	add    $0x10,%esp
+    1236:	39 da                	cmp    %ebx,%edx
+    1238:	74 2e                	je     1268 <parsecmd+0x78>
+    123a:	85 c0                	test   %eax,%eax
+    123c:	74 4a                	je     1288 <parsecmd+0x98>
+    printf(2, "%s\n", syntaxerr);
+    123e:	83 ec 04             	sub    $0x4,%esp
+    1241:	50                   	push   %eax
+    1242:	68 83 1e 00 00       	push   $0x1e83
+    1247:	6a 02                	push   $0x2
+    1249:	e8 a2 04 00 00       	call   16f0 <printf>
+    freecmd(cmd);
+    124e:	89 34 24             	mov    %esi,(%esp)
+    return 0;
+    1251:	31 f6                	xor    %esi,%esi
+    freecmd(cmd);
+    1253:	e8 18 ff ff ff       	call   1170 <freecmd>
+    return 0;
+    1258:	83 c4 10             	add    $0x10,%esp
+}
+    125b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    125e:	89 f0                	mov    %esi,%eax
+    1260:	5b                   	pop    %ebx
+    1261:	5e                   	pop    %esi
+    1262:	5f                   	pop    %edi
+    1263:	5d                   	pop    %ebp
+    1264:	c3                   	ret
+    1265:	8d 76 00             	lea    0x0(%esi),%esi
+  if(syntaxerr){
+    1268:	85 c0                	test   %eax,%eax
+    126a:	75 d2                	jne    123e <parsecmd+0x4e>
+  nulterminate(cmd);
+    126c:	83 ec 0c             	sub    $0xc,%esp
+    126f:	56                   	push   %esi
+    1270:	e8 5b fe ff ff       	call   10d0 <nulterminate>
+  return cmd;
+    1275:	83 c4 10             	add    $0x10,%esp
+}
+    1278:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    127b:	89 f0                	mov    %esi,%eax
+    127d:	5b                   	pop    %ebx
+    127e:	5e                   	pop    %esi
+    127f:	5f                   	pop    %edi
+    1280:	5d                   	pop    %ebp
+    1281:	c3                   	ret
+    1282:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(2, "leftovers: %s\n", s);
+    1288:	83 ec 04             	sub    $0x4,%esp
+    128b:	52                   	push   %edx
+    128c:	68 78 1e 00 00       	push   $0x1e78
+    1291:	6a 02                	push   $0x2
+    1293:	e8 58 04 00 00       	call   16f0 <printf>
+  if(syntaxerr == 0)
+    1298:	a1 00 28 00 00       	mov    0x2800,%eax
+    129d:	83 c4 10             	add    $0x10,%esp
+    12a0:	85 c0                	test   %eax,%eax
+    12a2:	75 9a                	jne    123e <parsecmd+0x4e>
+    syntaxerr = s;
+    12a4:	c7 05 00 28 00 00 3c 	movl   $0x1e3c,0x2800
+    12ab:	1e 00 00 
+    12ae:	b8 3c 1e 00 00       	mov    $0x1e3c,%eax
+    12b3:	eb 89                	jmp    123e <parsecmd+0x4e>
+    12b5:	66 90                	xchg   %ax,%ax
+    12b7:	66 90                	xchg   %ax,%ax
+    12b9:	66 90                	xchg   %ax,%ax
+    12bb:	66 90                	xchg   %ax,%ax
+    12bd:	66 90                	xchg   %ax,%ax
+    12bf:	90                   	nop
+
+000012c0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    12c0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    12c1:	31 c0                	xor    %eax,%eax
+{
+    12c3:	89 e5                	mov    %esp,%ebp
+    12c5:	53                   	push   %ebx
+    12c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    12c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    12cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    12d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    12d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    12d7:	83 c0 01             	add    $0x1,%eax
+    12da:	84 d2                	test   %dl,%dl
+    12dc:	75 f2                	jne    12d0 <strcpy+0x10>
+    ;
+  return os;
+}
+    12de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    12e1:	89 c8                	mov    %ecx,%eax
+    12e3:	c9                   	leave
+    12e4:	c3                   	ret
+    12e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000012f0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    12f0:	55                   	push   %ebp
+    12f1:	89 e5                	mov    %esp,%ebp
+    12f3:	53                   	push   %ebx
+    12f4:	8b 55 08             	mov    0x8(%ebp),%edx
+    12f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    12fa:	0f b6 02             	movzbl (%edx),%eax
+    12fd:	84 c0                	test   %al,%al
+    12ff:	75 17                	jne    1318 <strcmp+0x28>
+    1301:	eb 3a                	jmp    133d <strcmp+0x4d>
+    1303:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1307:	90                   	nop
+    1308:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    130c:	83 c2 01             	add    $0x1,%edx
+    130f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1312:	84 c0                	test   %al,%al
+    1314:	74 1a                	je     1330 <strcmp+0x40>
+    p++, q++;
+    1316:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1318:	0f b6 19             	movzbl (%ecx),%ebx
+    131b:	38 c3                	cmp    %al,%bl
+    131d:	74 e9                	je     1308 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    131f:	29 d8                	sub    %ebx,%eax
+}
+    1321:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1324:	c9                   	leave
+    1325:	c3                   	ret
+    1326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    132d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1330:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1334:	31 c0                	xor    %eax,%eax
+    1336:	29 d8                	sub    %ebx,%eax
+}
+    1338:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    133b:	c9                   	leave
+    133c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    133d:	0f b6 19             	movzbl (%ecx),%ebx
+    1340:	31 c0                	xor    %eax,%eax
+    1342:	eb db                	jmp    131f <strcmp+0x2f>
+    1344:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    134b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    134f:	90                   	nop
+
+00001350 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1350:	55                   	push   %ebp
+    1351:	89 e5                	mov    %esp,%ebp
+    1353:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1356:	80 3a 00             	cmpb   $0x0,(%edx)
+    1359:	74 15                	je     1370 <strlen+0x20>
+    135b:	31 c0                	xor    %eax,%eax
+    135d:	8d 76 00             	lea    0x0(%esi),%esi
+    1360:	83 c0 01             	add    $0x1,%eax
+    1363:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1367:	89 c1                	mov    %eax,%ecx
+    1369:	75 f5                	jne    1360 <strlen+0x10>
+    ;
+  return n;
+}
+    136b:	89 c8                	mov    %ecx,%eax
+    136d:	5d                   	pop    %ebp
+    136e:	c3                   	ret
+    136f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1370:	31 c9                	xor    %ecx,%ecx
+}
+    1372:	5d                   	pop    %ebp
+    1373:	89 c8                	mov    %ecx,%eax
+    1375:	c3                   	ret
+    1376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    137d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001380 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1380:	55                   	push   %ebp
+    1381:	89 e5                	mov    %esp,%ebp
+    1383:	57                   	push   %edi
+    1384:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1387:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    138a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    138d:	89 d7                	mov    %edx,%edi
+    138f:	fc                   	cld
+    1390:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1392:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1395:	89 d0                	mov    %edx,%eax
+    1397:	c9                   	leave
+    1398:	c3                   	ret
+    1399:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000013a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    13a0:	55                   	push   %ebp
+    13a1:	89 e5                	mov    %esp,%ebp
+    13a3:	8b 45 08             	mov    0x8(%ebp),%eax
+    13a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    13aa:	0f b6 10             	movzbl (%eax),%edx
+    13ad:	84 d2                	test   %dl,%dl
+    13af:	75 12                	jne    13c3 <strchr+0x23>
+    13b1:	eb 1d                	jmp    13d0 <strchr+0x30>
+    13b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    13b7:	90                   	nop
+    13b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    13bc:	83 c0 01             	add    $0x1,%eax
+    13bf:	84 d2                	test   %dl,%dl
+    13c1:	74 0d                	je     13d0 <strchr+0x30>
+    if(*s == c)
+    13c3:	38 d1                	cmp    %dl,%cl
+    13c5:	75 f1                	jne    13b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    13c7:	5d                   	pop    %ebp
+    13c8:	c3                   	ret
+    13c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    13d0:	31 c0                	xor    %eax,%eax
+}
+    13d2:	5d                   	pop    %ebp
+    13d3:	c3                   	ret
+    13d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    13df:	90                   	nop
+
+000013e0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    13e0:	55                   	push   %ebp
+    13e1:	89 e5                	mov    %esp,%ebp
+    13e3:	57                   	push   %edi
+    13e4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    13e5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    13e8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    13e9:	31 db                	xor    %ebx,%ebx
+{
+    13eb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    13ee:	eb 27                	jmp    1417 <gets+0x37>
+    cc = read(0, &c, 1);
+    13f0:	83 ec 04             	sub    $0x4,%esp
+    13f3:	6a 01                	push   $0x1
+    13f5:	56                   	push   %esi
+    13f6:	6a 00                	push   $0x0
+    13f8:	e8 5e 01 00 00       	call   155b <read>
+    if(cc < 1)
+    13fd:	83 c4 10             	add    $0x10,%esp
+    1400:	85 c0                	test   %eax,%eax
+    1402:	7e 1d                	jle    1421 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1404:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1408:	8b 55 08             	mov    0x8(%ebp),%edx
+    140b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    140f:	3c 0a                	cmp    $0xa,%al
+    1411:	74 10                	je     1423 <gets+0x43>
+    1413:	3c 0d                	cmp    $0xd,%al
+    1415:	74 0c                	je     1423 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1417:	89 df                	mov    %ebx,%edi
+    1419:	83 c3 01             	add    $0x1,%ebx
+    141c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    141f:	7c cf                	jl     13f0 <gets+0x10>
+    1421:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1423:	8b 45 08             	mov    0x8(%ebp),%eax
+    1426:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    142a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    142d:	5b                   	pop    %ebx
+    142e:	5e                   	pop    %esi
+    142f:	5f                   	pop    %edi
+    1430:	5d                   	pop    %ebp
+    1431:	c3                   	ret
+    1432:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1439:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001440 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1440:	55                   	push   %ebp
+    1441:	89 e5                	mov    %esp,%ebp
+    1443:	56                   	push   %esi
+    1444:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1445:	83 ec 08             	sub    $0x8,%esp
+    1448:	6a 00                	push   $0x0
+    144a:	ff 75 08             	push   0x8(%ebp)
+    144d:	e8 31 01 00 00       	call   1583 <open>
+  if(fd < 0)
+    1452:	83 c4 10             	add    $0x10,%esp
+    1455:	85 c0                	test   %eax,%eax
+    1457:	78 27                	js     1480 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1459:	83 ec 08             	sub    $0x8,%esp
+    145c:	ff 75 0c             	push   0xc(%ebp)
+    145f:	89 c3                	mov    %eax,%ebx
+    1461:	50                   	push   %eax
+    1462:	e8 34 01 00 00       	call   159b <fstat>
+  close(fd);
+    1467:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    146a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    146c:	e8 fa 00 00 00       	call   156b <close>
+  return r;
+    1471:	83 c4 10             	add    $0x10,%esp
+}
+    1474:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1477:	89 f0                	mov    %esi,%eax
+    1479:	5b                   	pop    %ebx
+    147a:	5e                   	pop    %esi
+    147b:	5d                   	pop    %ebp
+    147c:	c3                   	ret
+    147d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1480:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1485:	eb ed                	jmp    1474 <stat+0x34>
+    1487:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    148e:	66 90                	xchg   %ax,%ax
+
+00001490 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1490:	55                   	push   %ebp
+    1491:	89 e5                	mov    %esp,%ebp
+    1493:	53                   	push   %ebx
+    1494:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1497:	0f be 02             	movsbl (%edx),%eax
+    149a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    149d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    14a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    14a5:	77 1e                	ja     14c5 <atoi+0x35>
+    14a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    14b0:	83 c2 01             	add    $0x1,%edx
+    14b3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    14b6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    14ba:	0f be 02             	movsbl (%edx),%eax
+    14bd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    14c0:	80 fb 09             	cmp    $0x9,%bl
+    14c3:	76 eb                	jbe    14b0 <atoi+0x20>
+  return n;
+}
+    14c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    14c8:	89 c8                	mov    %ecx,%eax
+    14ca:	c9                   	leave
+    14cb:	c3                   	ret
+    14cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000014d0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    14d0:	55                   	push   %ebp
+    14d1:	89 e5                	mov    %esp,%ebp
+    14d3:	57                   	push   %edi
+    14d4:	56                   	push   %esi
+    14d5:	8b 45 10             	mov    0x10(%ebp),%eax
+    14d8:	8b 55 08             	mov    0x8(%ebp),%edx
+    14db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    14de:	85 c0                	test   %eax,%eax
+    14e0:	7e 13                	jle    14f5 <memmove+0x25>
+    14e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    14e4:	89 d7                	mov    %edx,%edi
+    14e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    14f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    14f1:	39 f8                	cmp    %edi,%eax
+    14f3:	75 fb                	jne    14f0 <memmove+0x20>
+  return vdst;
+}
+    14f5:	5e                   	pop    %esi
+    14f6:	89 d0                	mov    %edx,%eax
+    14f8:	5f                   	pop    %edi
+    14f9:	5d                   	pop    %ebp
+    14fa:	c3                   	ret
+
+000014fb <ccreate>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(ccreate)
+    14fb:	b8 17 00 00 00       	mov    $0x17,%eax
+    1500:	cd 40                	int    $0x40
+    1502:	c3                   	ret
+
+00001503 <cfork>:
+SYSCALL(cfork)
+    1503:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1508:	cd 40                	int    $0x40
+    150a:	c3                   	ret
+
+0000150b <cgetrootdir>:
+SYSCALL(cgetrootdir)
+    150b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1510:	cd 40                	int    $0x40
+    1512:	c3                   	ret
+
+00001513 <getcontrootdir>:
+SYSCALL(getcontrootdir)
+    1513:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1518:	cd 40                	int    $0x40
+    151a:	c3                   	ret
+
+0000151b <cpause>:
+SYSCALL(cpause)
+    151b:	b8 19 00 00 00       	mov    $0x19,%eax
+    1520:	cd 40                	int    $0x40
+    1522:	c3                   	ret
+
+00001523 <cresume>:
+SYSCALL(cresume)
+    1523:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1528:	cd 40                	int    $0x40
+    152a:	c3                   	ret
+
+0000152b <cstart>:
+SYSCALL(cstart)
+    152b:	b8 18 00 00 00       	mov    $0x18,%eax
+    1530:	cd 40                	int    $0x40
+    1532:	c3                   	ret
+
+00001533 <cstop>:
+SYSCALL(cstop)
+    1533:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1538:	cd 40                	int    $0x40
+    153a:	c3                   	ret
+
+0000153b <fork>:
+SYSCALL(fork)
+    153b:	b8 01 00 00 00       	mov    $0x1,%eax
+    1540:	cd 40                	int    $0x40
+    1542:	c3                   	ret
+
+00001543 <exit>:
+SYSCALL(exit)
+    1543:	b8 02 00 00 00       	mov    $0x2,%eax
+    1548:	cd 40                	int    $0x40
+    154a:	c3                   	ret
+
+0000154b <wait>:
+SYSCALL(wait)
+    154b:	b8 03 00 00 00       	mov    $0x3,%eax
+    1550:	cd 40                	int    $0x40
+    1552:	c3                   	ret
+
+00001553 <pipe>:
+SYSCALL(pipe)
+    1553:	b8 04 00 00 00       	mov    $0x4,%eax
+    1558:	cd 40                	int    $0x40
+    155a:	c3                   	ret
+
+0000155b <read>:
+SYSCALL(read)
+    155b:	b8 05 00 00 00       	mov    $0x5,%eax
+    1560:	cd 40                	int    $0x40
+    1562:	c3                   	ret
+
+00001563 <write>:
+SYSCALL(write)
+    1563:	b8 10 00 00 00       	mov    $0x10,%eax
+    1568:	cd 40                	int    $0x40
+    156a:	c3                   	ret
+
+0000156b <close>:
+SYSCALL(close)
+    156b:	b8 15 00 00 00       	mov    $0x15,%eax
+    1570:	cd 40                	int    $0x40
+    1572:	c3                   	ret
+
+00001573 <kill>:
+SYSCALL(kill)
+    1573:	b8 06 00 00 00       	mov    $0x6,%eax
+    1578:	cd 40                	int    $0x40
+    157a:	c3                   	ret
+
+0000157b <exec>:
+SYSCALL(exec)
+    157b:	b8 07 00 00 00       	mov    $0x7,%eax
+    1580:	cd 40                	int    $0x40
+    1582:	c3                   	ret
+
+00001583 <open>:
+SYSCALL(open)
+    1583:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1588:	cd 40                	int    $0x40
+    158a:	c3                   	ret
+
+0000158b <mknod>:
+SYSCALL(mknod)
+    158b:	b8 11 00 00 00       	mov    $0x11,%eax
+    1590:	cd 40                	int    $0x40
+    1592:	c3                   	ret
+
+00001593 <unlink>:
+SYSCALL(unlink)
+    1593:	b8 12 00 00 00       	mov    $0x12,%eax
+    1598:	cd 40                	int    $0x40
+    159a:	c3                   	ret
+
+0000159b <fstat>:
+SYSCALL(fstat)
+    159b:	b8 08 00 00 00       	mov    $0x8,%eax
+    15a0:	cd 40                	int    $0x40
+    15a2:	c3                   	ret
+
+000015a3 <link>:
+SYSCALL(link)
+    15a3:	b8 13 00 00 00       	mov    $0x13,%eax
+    15a8:	cd 40                	int    $0x40
+    15aa:	c3                   	ret
+
+000015ab <mkdir>:
+SYSCALL(mkdir)
+    15ab:	b8 14 00 00 00       	mov    $0x14,%eax
+    15b0:	cd 40                	int    $0x40
+    15b2:	c3                   	ret
+
+000015b3 <chdir>:
+SYSCALL(chdir)
+    15b3:	b8 09 00 00 00       	mov    $0x9,%eax
+    15b8:	cd 40                	int    $0x40
+    15ba:	c3                   	ret
+
+000015bb <dup>:
+SYSCALL(dup)
+    15bb:	b8 0a 00 00 00       	mov    $0xa,%eax
+    15c0:	cd 40                	int    $0x40
+    15c2:	c3                   	ret
+
+000015c3 <getpid>:
+SYSCALL(getpid)
+    15c3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    15c8:	cd 40                	int    $0x40
+    15ca:	c3                   	ret
+
+000015cb <sbrk>:
+SYSCALL(sbrk)
+    15cb:	b8 0c 00 00 00       	mov    $0xc,%eax
+    15d0:	cd 40                	int    $0x40
+    15d2:	c3                   	ret
+
+000015d3 <sleep>:
+SYSCALL(sleep)
+    15d3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    15d8:	cd 40                	int    $0x40
+    15da:	c3                   	ret
+
+000015db <uptime>:
+SYSCALL(uptime)
+    15db:	b8 0e 00 00 00       	mov    $0xe,%eax
+    15e0:	cd 40                	int    $0x40
+    15e2:	c3                   	ret
+
+000015e3 <cps>:
+SYSCALL(cps)
+    15e3:	b8 16 00 00 00       	mov    $0x16,%eax
+    15e8:	cd 40                	int    $0x40
+    15ea:	c3                   	ret
+
+000015eb <mmap>:
+SYSCALL(mmap)
+    15eb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    15f0:	cd 40                	int    $0x40
+    15f2:	c3                   	ret
+
+000015f3 <munmap>:
+SYSCALL(munmap)
+    15f3:	b8 20 00 00 00       	mov    $0x20,%eax
+    15f8:	cd 40                	int    $0x40
+    15fa:	c3                   	ret
+
+000015fb <shmget>:
+SYSCALL(shmget)
+    15fb:	b8 21 00 00 00       	mov    $0x21,%eax
+    1600:	cd 40                	int    $0x40
+    1602:	c3                   	ret
+
+00001603 <climit>:
+SYSCALL(climit)
+    1603:	b8 22 00 00 00       	mov    $0x22,%eax
+    1608:	cd 40                	int    $0x40
+    160a:	c3                   	ret
+
+0000160b <spawn>:
+SYSCALL(spawn)
+    160b:	b8 23 00 00 00       	mov    $0x23,%eax
+    1610:	cd 40                	int    $0x40
+    1612:	c3                   	ret
+
+00001613 <clone>:
+SYSCALL(clone)
+    1613:	b8 24 00 00 00       	mov    $0x24,%eax
+    1618:	cd 40                	int    $0x40
+    161a:	c3                   	ret
+
+0000161b <join>:
+SYSCALL(join)
+    161b:	b8 25 00 00 00       	mov    $0x25,%eax
+    1620:	cd 40                	int    $0x40
+    1622:	c3                   	ret
+
+00001623 <futex>:
+SYSCALL(futex)
+    1623:	b8 26 00 00 00       	mov    $0x26,%eax
+    1628:	cd 40                	int    $0x40
+    162a:	c3                   	ret
+
+0000162b <ccheckpoint>:
+SYSCALL(ccheckpoint)
+    162b:	b8 27 00 00 00       	mov    $0x27,%eax
+    1630:	cd 40                	int    $0x40
+    1632:	c3                   	ret
+
+00001633 <crestore>:
+SYSCALL(crestore)
+    1633:	b8 28 00 00 00       	mov    $0x28,%eax
+    1638:	cd 40                	int    $0x40
+    163a:	c3                   	ret
+
+0000163b <czygote>:
+SYSCALL(czygote)
+    163b:	b8 29 00 00 00       	mov    $0x29,%eax
+    1640:	cd 40                	int    $0x40
+    1642:	c3                   	ret
+
+00001643 <memstats>:
+SYSCALL(memstats)
+    1643:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1648:	cd 40                	int    $0x40
+    164a:	c3                   	ret
+    164b:	66 90                	xchg   %ax,%ax
+    164d:	66 90                	xchg   %ax,%ax
+    164f:	90                   	nop
+
+00001650 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1650:	55                   	push   %ebp
+    1651:	89 e5                	mov    %esp,%ebp
+    1653:	57                   	push   %edi
+    1654:	56                   	push   %esi
+    1655:	53                   	push   %ebx
+    1656:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1658:	89 d1                	mov    %edx,%ecx
+{
+    165a:	83 ec 3c             	sub    $0x3c,%esp
+    165d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1660:	85 d2                	test   %edx,%edx
+    1662:	0f 89 80 00 00 00    	jns    16e8 <printint+0x98>
+    1668:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    166c:	74 7a                	je     16e8 <printint+0x98>
+    x = -xx;
+    166e:	f7 d9                	neg    %ecx
+    neg = 1;
+    1670:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1675:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1678:	31 f6                	xor    %esi,%esi
+    167a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    1680:	89 c8                	mov    %ecx,%eax
+    1682:	31 d2                	xor    %edx,%edx
+    1684:	89 f7                	mov    %esi,%edi
+    1686:	f7 f3                	div    %ebx
+    1688:	8d 76 01             	lea    0x1(%esi),%esi
+    168b:	0f b6 92 f8 1f 00 00 	movzbl 0x1ff8(%edx),%edx
+    1692:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1696:	89 ca                	mov    %ecx,%edx
+    1698:	89 c1                	mov    %eax,%ecx
+    169a:	39 da                	cmp    %ebx,%edx
+    169c:	73 e2                	jae    1680 <printint+0x30>
+  if(neg)
+    169e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    16a1:	85 c0                	test   %eax,%eax
+    16a3:	74 07                	je     16ac <printint+0x5c>
+    buf[i++] = '-';
+    16a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    16aa:	89 f7                	mov    %esi,%edi
+    16ac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    16af:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    16b2:	01 df                	add    %ebx,%edi
+    16b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    16b8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    16bb:	83 ec 04             	sub    $0x4,%esp
+    16be:	88 45 d7             	mov    %al,-0x29(%ebp)
+    16c1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    16c4:	6a 01                	push   $0x1
+    16c6:	50                   	push   %eax
+    16c7:	56                   	push   %esi
+    16c8:	e8 96 fe ff ff       	call   1563 <write>
+  while(--i >= 0)
+    16cd:	89 f8                	mov    %edi,%eax
+    16cf:	83 c4 10             	add    $0x10,%esp
+    16d2:	83 ef 01             	sub    $0x1,%edi
+    16d5:	39 d8                	cmp    %ebx,%eax
+    16d7:	75 df                	jne    16b8 <printint+0x68>
+}
+    16d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    16dc:	5b                   	pop    %ebx
+    16dd:	5e                   	pop    %esi
+    16de:	5f                   	pop    %edi
+    16df:	5d                   	pop    %ebp
+    16e0:	c3                   	ret
+    16e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    16e8:	31 c0                	xor    %eax,%eax
+    16ea:	eb 89                	jmp    1675 <printint+0x25>
+    16ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000016f0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    16f0:	55                   	push   %ebp
+    16f1:	89 e5                	mov    %esp,%ebp
+    16f3:	57                   	push   %edi
+    16f4:	56                   	push   %esi
+    16f5:	53                   	push   %ebx
+    16f6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    16f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    16fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    16ff:	0f b6 1e             	movzbl (%esi),%ebx
+    1702:	83 c6 01             	add    $0x1,%esi
+    1705:	84 db                	test   %bl,%bl
+    1707:	74 67                	je     1770 <printf+0x80>
+    1709:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    170c:	31 d2                	xor    %edx,%edx
+    170e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1711:	eb 34                	jmp    1747 <printf+0x57>
+    1713:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1717:	90                   	nop
+    1718:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    171b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1720:	83 f8 25             	cmp    $0x25,%eax
+    1723:	74 18                	je     173d <printf+0x4d>
+  write(fd, &c, 1);
+    1725:	83 ec 04             	sub    $0x4,%esp
+    1728:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    172b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    172e:	6a 01                	push   $0x1
+    1730:	50                   	push   %eax
+    1731:	57                   	push   %edi
+    1732:	e8 2c fe ff ff       	call   1563 <write>
+    1737:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    173a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    173d:	0f b6 1e             	movzbl (%esi),%ebx
+    1740:	83 c6 01             	add    $0x1,%esi
+    1743:	84 db                	test   %bl,%bl
+    1745:	74 29                	je     1770 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1747:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    174a:	85 d2                	test   %edx,%edx
+    174c:	74 ca                	je     1718 <printf+0x28>
+      }
+    } else if(state == '%'){
+    174e:	83 fa 25             	cmp    $0x25,%edx
+    1751:	75 ea                	jne    173d <printf+0x4d>
+      if(c == 'd'){
+    1753:	83 f8 25             	cmp    $0x25,%eax
+    1756:	0f 84 24 01 00 00    	je     1880 <printf+0x190>
+    175c:	83 e8 63             	sub    $0x63,%eax
+    175f:	83 f8 15             	cmp    $0x15,%eax
+    1762:	77 1c                	ja     1780 <printf+0x90>
+    1764:	ff 24 85 a0 1f 00 00 	jmp    *0x1fa0(,%eax,4)
+    176b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    176f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    1770:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1773:	5b                   	pop    %ebx
+    1774:	5e                   	pop    %esi
+    1775:	5f                   	pop    %edi
+    1776:	5d                   	pop    %ebp
+    1777:	c3                   	ret
+    1778:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    177f:	90                   	nop
+  write(fd, &c, 1);
+    1780:	83 ec 04             	sub    $0x4,%esp
+    1783:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1786:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    178a:	6a 01                	push   $0x1
+    178c:	52                   	push   %edx
+    178d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1790:	57                   	push   %edi
+    1791:	e8 cd fd ff ff       	call   1563 <write>
+    1796:	83 c4 0c             	add    $0xc,%esp
+    1799:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    179c:	6a 01                	push   $0x1
+    179e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    17a1:	52                   	push   %edx
+    17a2:	57                   	push   %edi
+    17a3:	e8 bb fd ff ff       	call   1563 <write>
+        putc(fd, c);
+    17a8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    17ab:	31 d2                	xor    %edx,%edx
+    17ad:	eb 8e                	jmp    173d <printf+0x4d>
+    17af:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    17b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    17b3:	83 ec 0c             	sub    $0xc,%esp
+    17b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    17bb:	8b 13                	mov    (%ebx),%edx
+    17bd:	6a 00                	push   $0x0
+    17bf:	89 f8                	mov    %edi,%eax
+        ap++;
+    17c1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    17c4:	e8 87 fe ff ff       	call   1650 <printint>
+        ap++;
+    17c9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    17cc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    17cf:	31 d2                	xor    %edx,%edx
+    17d1:	e9 67 ff ff ff       	jmp    173d <printf+0x4d>
+    17d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17dd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    17e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    17e3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    17e5:	83 c0 04             	add    $0x4,%eax
+    17e8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    17eb:	85 db                	test   %ebx,%ebx
+    17ed:	0f 84 9d 00 00 00    	je     1890 <printf+0x1a0>
+        while(*s != 0){
+    17f3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    17f6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    17f8:	84 c0                	test   %al,%al
+    17fa:	0f 84 3d ff ff ff    	je     173d <printf+0x4d>
+    1800:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1803:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1806:	89 de                	mov    %ebx,%esi
+    1808:	89 d3                	mov    %edx,%ebx
+    180a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1810:	83 ec 04             	sub    $0x4,%esp
+    1813:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1816:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1819:	6a 01                	push   $0x1
+    181b:	53                   	push   %ebx
+    181c:	57                   	push   %edi
+    181d:	e8 41 fd ff ff       	call   1563 <write>
+        while(*s != 0){
+    1822:	0f b6 06             	movzbl (%esi),%eax
+    1825:	83 c4 10             	add    $0x10,%esp
+    1828:	84 c0                	test   %al,%al
+    182a:	75 e4                	jne    1810 <printf+0x120>
+      state = 0;
+    182c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    182f:	31 d2                	xor    %edx,%edx
+    1831:	e9 07 ff ff ff       	jmp    173d <printf+0x4d>
+    1836:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    183d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1840:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1843:	83 ec 0c             	sub    $0xc,%esp
+    1846:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    184b:	8b 13                	mov    (%ebx),%edx
+    184d:	6a 01                	push   $0x1
+    184f:	e9 6b ff ff ff       	jmp    17bf <printf+0xcf>
+    1854:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1858:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    185b:	83 ec 04             	sub    $0x4,%esp
+    185e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1861:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1863:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1866:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1869:	6a 01                	push   $0x1
+    186b:	52                   	push   %edx
+    186c:	57                   	push   %edi
+    186d:	e8 f1 fc ff ff       	call   1563 <write>
+        ap++;
+    1872:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1875:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1878:	31 d2                	xor    %edx,%edx
+    187a:	e9 be fe ff ff       	jmp    173d <printf+0x4d>
+    187f:	90                   	nop
+  write(fd, &c, 1);
+    1880:	83 ec 04             	sub    $0x4,%esp
+    1883:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1886:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1889:	6a 01                	push   $0x1
+    188b:	e9 11 ff ff ff       	jmp    17a1 <printf+0xb1>
+    1890:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1895:	bb 98 1f 00 00       	mov    $0x1f98,%ebx
+    189a:	e9 61 ff ff ff       	jmp    1800 <printf+0x110>
+    189f:	90                   	nop
+
+000018a0 <runfree>:
+
+// Give the n pages at r back to the free runs, merging them with
+// adjacent runs, and shrink the heap if the end of it is free.
+static void
+runfree(struct page *r, uint n)
+{
+    18a0:	55                   	push   %ebp
+  struct page **pp, *prev;
+
+  r->kind = PFREE;
+    18a1:	b9 03 00 00 00       	mov    $0x3,%ecx
+{
+    18a6:	89 e5                	mov    %esp,%ebp
+    18a8:	57                   	push   %edi
+    18a9:	56                   	push   %esi
+    18aa:	53                   	push   %ebx
+    18ab:	89 c3                	mov    %eax,%ebx
+    18ad:	83 ec 0c             	sub    $0xc,%esp
+  r->kind = PFREE;
+    18b0:	66 89 08             	mov    %cx,(%eax)
+  r->npages = n;
+  prev = 0;
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+    18b3:	8b 0d 88 28 00 00    	mov    0x2888,%ecx
+  r->npages = n;
+    18b9:	89 50 04             	mov    %edx,0x4(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+    18bc:	85 c9                	test   %ecx,%ecx
+    18be:	0f 84 1f 01 00 00    	je     19e3 <runfree+0x143>
+    18c4:	39 c1                	cmp    %eax,%ecx
+    18c6:	0f 83 f7 00 00 00    	jae    19c3 <runfree+0x123>
+    18cc:	89 c8                	mov    %ecx,%eax
+    18ce:	eb 04                	jmp    18d4 <runfree+0x34>
+    18d0:	39 d8                	cmp    %ebx,%eax
+    18d2:	73 09                	jae    18dd <runfree+0x3d>
+    18d4:	89 c2                	mov    %eax,%edx
+    18d6:	8b 40 14             	mov    0x14(%eax),%eax
+    18d9:	85 c0                	test   %eax,%eax
+    18db:	75 f3                	jne    18d0 <runfree+0x30>
+    prev = *pp;
+  r->next = *pp;
+    18dd:	89 43 14             	mov    %eax,0x14(%ebx)
+  *pp = r;
+    18e0:	89 5a 14             	mov    %ebx,0x14(%edx)
+
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+    18e3:	8b 43 14             	mov    0x14(%ebx),%eax
+    18e6:	85 c0                	test   %eax,%eax
+    18e8:	74 12                	je     18fc <runfree+0x5c>
+    18ea:	8b 7b 04             	mov    0x4(%ebx),%edi
+    18ed:	89 fe                	mov    %edi,%esi
+    18ef:	c1 e6 0c             	shl    $0xc,%esi
+    18f2:	01 de                	add    %ebx,%esi
+    18f4:	39 f0                	cmp    %esi,%eax
+    18f6:	0f 84 a4 00 00 00    	je     19a0 <runfree+0x100>
+    r->npages += r->next->npages;
+    r->next = r->next->next;
+  }
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+    18fc:	8b 72 04             	mov    0x4(%edx),%esi
+    18ff:	89 f0                	mov    %esi,%eax
+    1901:	c1 e0 0c             	shl    $0xc,%eax
+    1904:	01 d0                	add    %edx,%eax
+    1906:	39 c3                	cmp    %eax,%ebx
+    1908:	74 16                	je     1920 <runfree+0x80>
+    pp = &runs;
+    while(*pp != r)
+      pp = &(*pp)->next;
+  }
+
+  if(r->next == 0 && r->npages >= TRIM &&
+    190a:	8b 43 14             	mov    0x14(%ebx),%eax
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+    190d:	8d 72 14             	lea    0x14(%edx),%esi
+  if(r->next == 0 && r->npages >= TRIM &&
+    1910:	85 c0                	test   %eax,%eax
+    1912:	74 3c                	je     1950 <runfree+0xb0>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+    *pp = 0;
+    sbrk(-(int)(r->npages*PGSIZE));
+    heapend = (char*)r;
+  }
+}
+    1914:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1917:	5b                   	pop    %ebx
+    1918:	5e                   	pop    %esi
+    1919:	5f                   	pop    %edi
+    191a:	5d                   	pop    %ebp
+    191b:	c3                   	ret
+    191c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    prev->npages += r->npages;
+    1920:	03 73 04             	add    0x4(%ebx),%esi
+    1923:	89 72 04             	mov    %esi,0x4(%edx)
+    prev->next = r->next;
+    1926:	8b 43 14             	mov    0x14(%ebx),%eax
+    1929:	89 42 14             	mov    %eax,0x14(%edx)
+    while(*pp != r)
+    192c:	39 d1                	cmp    %edx,%ecx
+    192e:	0f 84 c5 00 00 00    	je     19f9 <runfree+0x159>
+    1934:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      pp = &(*pp)->next;
+    1938:	89 cb                	mov    %ecx,%ebx
+    193a:	8b 49 14             	mov    0x14(%ecx),%ecx
+    while(*pp != r)
+    193d:	39 d1                	cmp    %edx,%ecx
+    193f:	75 f7                	jne    1938 <runfree+0x98>
+      pp = &(*pp)->next;
+    1941:	8d 73 14             	lea    0x14(%ebx),%esi
+    1944:	89 cb                	mov    %ecx,%ebx
+  if(r->next == 0 && r->npages >= TRIM &&
+    1946:	85 c0                	test   %eax,%eax
+    1948:	75 ca                	jne    1914 <runfree+0x74>
+    194a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1950:	8b 53 04             	mov    0x4(%ebx),%edx
+    1953:	83 fa 1f             	cmp    $0x1f,%edx
+    1956:	76 bc                	jbe    1914 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+    1958:	c1 e2 0c             	shl    $0xc,%edx
+    195b:	01 da                	add    %ebx,%edx
+  if(r->next == 0 && r->npages >= TRIM &&
+    195d:	39 15 84 28 00 00    	cmp    %edx,0x2884
+    1963:	75 af                	jne    1914 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+    1965:	83 ec 0c             	sub    $0xc,%esp
+    1968:	6a 00                	push   $0x0
+    196a:	e8 5c fc ff ff       	call   15cb <sbrk>
+    196f:	83 c4 10             	add    $0x10,%esp
+    1972:	39 05 84 28 00 00    	cmp    %eax,0x2884
+    1978:	75 9a                	jne    1914 <runfree+0x74>
+    *pp = 0;
+    197a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    sbrk(-(int)(r->npages*PGSIZE));
+    1980:	8b 43 04             	mov    0x4(%ebx),%eax
+    1983:	83 ec 0c             	sub    $0xc,%esp
+    1986:	c1 e0 0c             	shl    $0xc,%eax
+    1989:	f7 d8                	neg    %eax
+    198b:	50                   	push   %eax
+    198c:	e8 3a fc ff ff       	call   15cb <sbrk>
+    heapend = (char*)r;
+    1991:	89 1d 84 28 00 00    	mov    %ebx,0x2884
+    1997:	83 c4 10             	add    $0x10,%esp
+}
+    199a:	e9 75 ff ff ff       	jmp    1914 <runfree+0x74>
+    199f:	90                   	nop
+    r->npages += r->next->npages;
+    19a0:	03 78 04             	add    0x4(%eax),%edi
+    19a3:	89 7b 04             	mov    %edi,0x4(%ebx)
+    r->next = r->next->next;
+    19a6:	8b 40 14             	mov    0x14(%eax),%eax
+    19a9:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+    19ac:	8b 72 04             	mov    0x4(%edx),%esi
+    19af:	89 f0                	mov    %esi,%eax
+    19b1:	c1 e0 0c             	shl    $0xc,%eax
+    19b4:	01 d0                	add    %edx,%eax
+    19b6:	39 c3                	cmp    %eax,%ebx
+    19b8:	0f 85 4c ff ff ff    	jne    190a <runfree+0x6a>
+    19be:	e9 5d ff ff ff       	jmp    1920 <runfree+0x80>
+  r->next = *pp;
+    19c3:	89 48 14             	mov    %ecx,0x14(%eax)
+  *pp = r;
+    19c6:	a3 88 28 00 00       	mov    %eax,0x2888
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+    19cb:	89 d0                	mov    %edx,%eax
+    19cd:	c1 e0 0c             	shl    $0xc,%eax
+    19d0:	01 d8                	add    %ebx,%eax
+    19d2:	39 c1                	cmp    %eax,%ecx
+    19d4:	74 2f                	je     1a05 <runfree+0x165>
+  if(r->next == 0 && r->npages >= TRIM &&
+    19d6:	8b 43 14             	mov    0x14(%ebx),%eax
+    19d9:	be 88 28 00 00       	mov    $0x2888,%esi
+    19de:	e9 2d ff ff ff       	jmp    1910 <runfree+0x70>
+  r->next = *pp;
+    19e3:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+    19ea:	be 88 28 00 00       	mov    $0x2888,%esi
+  *pp = r;
+    19ef:	a3 88 28 00 00       	mov    %eax,0x2888
+  if(r->next == 0 && r->npages >= TRIM &&
+    19f4:	e9 5a ff ff ff       	jmp    1953 <runfree+0xb3>
+    while(*pp != r)
+    19f9:	89 cb                	mov    %ecx,%ebx
+    pp = &runs;
+    19fb:	be 88 28 00 00       	mov    $0x2888,%esi
+    1a00:	e9 0b ff ff ff       	jmp    1910 <runfree+0x70>
+    r->npages += r->next->npages;
+    1a05:	03 51 04             	add    0x4(%ecx),%edx
+    1a08:	89 53 04             	mov    %edx,0x4(%ebx)
+    r->next = r->next->next;
+    1a0b:	8b 41 14             	mov    0x14(%ecx),%eax
+    1a0e:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+    1a11:	eb c3                	jmp    19d6 <runfree+0x136>
+    1a13:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001a20 <runalloc>:
+
+// Take a run of n pages from the start of the first free run
+// long enough, which keeps the end of the heap free to trim.
+static struct page*
+runalloc(uint n)
+{
+    1a20:	55                   	push   %ebp
+    1a21:	89 e5                	mov    %esp,%ebp
+    1a23:	57                   	push   %edi
+    1a24:	56                   	push   %esi
+    1a25:	89 c6                	mov    %eax,%esi
+    1a27:	53                   	push   %ebx
+    1a28:	83 ec 1c             	sub    $0x1c,%esp
+  struct page **pp, *r, *rest;
+
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+    1a2b:	8b 1d 88 28 00 00    	mov    0x2888,%ebx
+    1a31:	85 db                	test   %ebx,%ebx
+    1a33:	74 4d                	je     1a82 <runalloc+0x62>
+    1a35:	b9 88 28 00 00       	mov    $0x2888,%ecx
+    if(r->npages < n)
+    1a3a:	39 73 04             	cmp    %esi,0x4(%ebx)
+    1a3d:	72 39                	jb     1a78 <runalloc+0x58>
+      continue;
+    if(r->npages == n){
+    1a3f:	0f 84 9b 00 00 00    	je     1ae0 <runalloc+0xc0>
+      *pp = r->next;
+    } else {
+      rest = (struct page*)((char*)r + n*PGSIZE);
+    1a45:	89 f0                	mov    %esi,%eax
+      rest->kind = PFREE;
+    1a47:	ba 03 00 00 00       	mov    $0x3,%edx
+      rest = (struct page*)((char*)r + n*PGSIZE);
+    1a4c:	c1 e0 0c             	shl    $0xc,%eax
+    1a4f:	01 d8                	add    %ebx,%eax
+      rest->kind = PFREE;
+    1a51:	66 89 10             	mov    %dx,(%eax)
+      rest->npages = r->npages - n;
+    1a54:	8b 53 04             	mov    0x4(%ebx),%edx
+    1a57:	29 f2                	sub    %esi,%edx
+    1a59:	89 50 04             	mov    %edx,0x4(%eax)
+      rest->next = r->next;
+    1a5c:	8b 53 14             	mov    0x14(%ebx),%edx
+    1a5f:	89 50 14             	mov    %edx,0x14(%eax)
+      *pp = rest;
+    1a62:	89 01                	mov    %eax,(%ecx)
+      r->npages = n;
+    1a64:	89 73 04             	mov    %esi,0x4(%ebx)
+    }
+    return r;
+  }
+  return morecore(n);
+}
+    1a67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a6a:	89 d8                	mov    %ebx,%eax
+    1a6c:	5b                   	pop    %ebx
+    1a6d:	5e                   	pop    %esi
+    1a6e:	5f                   	pop    %edi
+    1a6f:	5d                   	pop    %ebp
+    1a70:	c3                   	ret
+    1a71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+    1a78:	8d 4b 14             	lea    0x14(%ebx),%ecx
+    1a7b:	8b 5b 14             	mov    0x14(%ebx),%ebx
+    1a7e:	85 db                	test   %ebx,%ebx
+    1a80:	75 b8                	jne    1a3a <runalloc+0x1a>
+  m = n < MINCORE ? MINCORE : n;
+    1a82:	bf 08 00 00 00       	mov    $0x8,%edi
+    1a87:	39 fe                	cmp    %edi,%esi
+    1a89:	0f 43 fe             	cmovae %esi,%edi
+  brk = sbrk(0);
+    1a8c:	83 ec 0c             	sub    $0xc,%esp
+    1a8f:	6a 00                	push   $0x0
+    1a91:	e8 35 fb ff ff       	call   15cb <sbrk>
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+    1a96:	89 fa                	mov    %edi,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+    1a98:	89 c3                	mov    %eax,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+    1a9a:	c1 e2 0c             	shl    $0xc,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+    1a9d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    1aa0:	f7 db                	neg    %ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+    1aa2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+    1aa5:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+    1aab:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+    1aae:	89 04 24             	mov    %eax,(%esp)
+    1ab1:	e8 15 fb ff ff       	call   15cb <sbrk>
+    1ab6:	83 c4 10             	add    $0x10,%esp
+    1ab9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1abc:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1abf:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1ac2:	74 3e                	je     1b02 <runalloc+0xe2>
+  r = (struct page*)(brk + pad);
+    1ac4:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+    1ac6:	01 da                	add    %ebx,%edx
+    1ac8:	89 15 84 28 00 00    	mov    %edx,0x2884
+  if(m > n)
+    1ace:	39 fe                	cmp    %edi,%esi
+    1ad0:	72 1e                	jb     1af0 <runalloc+0xd0>
+  r->npages = n;
+    1ad2:	89 73 04             	mov    %esi,0x4(%ebx)
+  return r;
+    1ad5:	eb 90                	jmp    1a67 <runalloc+0x47>
+    1ad7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ade:	66 90                	xchg   %ax,%ax
+      *pp = r->next;
+    1ae0:	8b 43 14             	mov    0x14(%ebx),%eax
+    1ae3:	89 01                	mov    %eax,(%ecx)
+}
+    1ae5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ae8:	89 d8                	mov    %ebx,%eax
+    1aea:	5b                   	pop    %ebx
+    1aeb:	5e                   	pop    %esi
+    1aec:	5f                   	pop    %edi
+    1aed:	5d                   	pop    %ebp
+    1aee:	c3                   	ret
+    1aef:	90                   	nop
+    runfree((struct page*)((char*)r + n*PGSIZE), m - n);
+    1af0:	89 f0                	mov    %esi,%eax
+    1af2:	29 f7                	sub    %esi,%edi
+    1af4:	c1 e0 0c             	shl    $0xc,%eax
+    1af7:	89 fa                	mov    %edi,%edx
+    1af9:	01 d8                	add    %ebx,%eax
+    1afb:	e8 a0 fd ff ff       	call   18a0 <runfree>
+    1b00:	eb d0                	jmp    1ad2 <runalloc+0xb2>
+    if(sbrk(pad + m*PGSIZE) == (char*)-1)
+    1b02:	89 f7                	mov    %esi,%edi
+    1b04:	83 ec 0c             	sub    $0xc,%esp
+    1b07:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1b0a:	c1 e7 0c             	shl    $0xc,%edi
+    1b0d:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+    1b10:	50                   	push   %eax
+    1b11:	e8 b5 fa ff ff       	call   15cb <sbrk>
+    1b16:	83 c4 10             	add    $0x10,%esp
+    1b19:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1b1c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1b1f:	74 0c                	je     1b2d <runalloc+0x10d>
+  r = (struct page*)(brk + pad);
+    1b21:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+    1b23:	01 df                	add    %ebx,%edi
+    1b25:	89 3d 84 28 00 00    	mov    %edi,0x2884
+  if(m > n)
+    1b2b:	eb a5                	jmp    1ad2 <runalloc+0xb2>
+      return 0;
+    1b2d:	31 db                	xor    %ebx,%ebx
+    1b2f:	e9 33 ff ff ff       	jmp    1a67 <runalloc+0x47>
+    1b34:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1b3f:	90                   	nop
+
+00001b40 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+    1b40:	55                   	push   %ebp
+    1b41:	89 e5                	mov    %esp,%ebp
+    1b43:	56                   	push   %esi
+    1b44:	53                   	push   %ebx
+    1b45:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  struct page *p;
+
+  if(ap == 0)
+    1b48:	85 c9                	test   %ecx,%ecx
+    1b4a:	74 1c                	je     1b68 <free+0x28>
+    return;
+  p = (struct page*)((uint)ap & ~(PGSIZE-1));
+    1b4c:	89 c8                	mov    %ecx,%eax
+    1b4e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  switch(p->kind){
+    1b53:	0f b7 10             	movzwl (%eax),%edx
+    1b56:	66 83 fa 02          	cmp    $0x2,%dx
+    1b5a:	74 14                	je     1b70 <free+0x30>
+    1b5c:	66 83 fa 04          	cmp    $0x4,%dx
+    1b60:	74 66                	je     1bc8 <free+0x88>
+    1b62:	66 83 fa 01          	cmp    $0x1,%dx
+    1b66:	74 18                	je     1b80 <free+0x40>
+    break;
+  case PMAP:
+    munmap(p, p->npages*PGSIZE);
+    break;
+  }
+}
+    1b68:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1b6b:	5b                   	pop    %ebx
+    1b6c:	5e                   	pop    %esi
+    1b6d:	5d                   	pop    %ebp
+    1b6e:	c3                   	ret
+    1b6f:	90                   	nop
+    runfree(p, p->npages);
+    1b70:	8b 50 04             	mov    0x4(%eax),%edx
+}
+    1b73:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1b76:	5b                   	pop    %ebx
+    1b77:	5e                   	pop    %esi
+    1b78:	5d                   	pop    %ebp
+    runfree(p, p->npages);
+    1b79:	e9 22 fd ff ff       	jmp    18a0 <runfree>
+    1b7e:	66 90                	xchg   %ax,%ax
+  b->next = p->free;
+    1b80:	8b 50 0c             	mov    0xc(%eax),%edx
+    1b83:	89 11                	mov    %edx,(%ecx)
+  if(p->nfree++ == 0)
+    1b85:	8b 50 08             	mov    0x8(%eax),%edx
+  p->free = b;
+    1b88:	89 48 0c             	mov    %ecx,0xc(%eax)
+  if(p->nfree++ == 0)
+    1b8b:	8d 5a 01             	lea    0x1(%edx),%ebx
+    1b8e:	89 58 08             	mov    %ebx,0x8(%eax)
+    1b91:	85 d2                	test   %edx,%edx
+    1b93:	74 53                	je     1be8 <free+0xa8>
+  if(p->nfree == nblocks(p->class)){
+    1b95:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+    1b99:	8d 4e 04             	lea    0x4(%esi),%ecx
+    1b9c:	ba e0 0f 00 00       	mov    $0xfe0,%edx
+    1ba1:	d3 fa                	sar    %cl,%edx
+  if(p->nfree == nblocks(p->class)){
+    1ba3:	39 da                	cmp    %ebx,%edx
+    1ba5:	75 c1                	jne    1b68 <free+0x28>
+  if(p->prev)
+    1ba7:	8b 48 18             	mov    0x18(%eax),%ecx
+    p->prev->next = p->next;
+    1baa:	8b 50 14             	mov    0x14(%eax),%edx
+  if(p->prev)
+    1bad:	85 c9                	test   %ecx,%ecx
+    1baf:	74 6f                	je     1c20 <free+0xe0>
+    p->prev->next = p->next;
+    1bb1:	89 51 14             	mov    %edx,0x14(%ecx)
+  if(p->next)
+    1bb4:	85 d2                	test   %edx,%edx
+    1bb6:	74 06                	je     1bbe <free+0x7e>
+    p->next->prev = p->prev;
+    1bb8:	8b 48 18             	mov    0x18(%eax),%ecx
+    1bbb:	89 4a 18             	mov    %ecx,0x18(%edx)
+    runfree(p, 1);
+    1bbe:	ba 01 00 00 00       	mov    $0x1,%edx
+    1bc3:	eb ae                	jmp    1b73 <free+0x33>
+    1bc5:	8d 76 00             	lea    0x0(%esi),%esi
+    munmap(p, p->npages*PGSIZE);
+    1bc8:	8b 50 04             	mov    0x4(%eax),%edx
+    1bcb:	83 ec 08             	sub    $0x8,%esp
+    1bce:	c1 e2 0c             	shl    $0xc,%edx
+    1bd1:	52                   	push   %edx
+    1bd2:	50                   	push   %eax
+    1bd3:	e8 1b fa ff ff       	call   15f3 <munmap>
+    break;
+    1bd8:	83 c4 10             	add    $0x10,%esp
+}
+    1bdb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1bde:	5b                   	pop    %ebx
+    1bdf:	5e                   	pop    %esi
+    1be0:	5d                   	pop    %ebp
+    1be1:	c3                   	ret
+    1be2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  p->next = partial[p->class];
+    1be8:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  p->prev = 0;
+    1bec:	c7 40 18 00 00 00 00 	movl   $0x0,0x18(%eax)
+  p->next = partial[p->class];
+    1bf3:	bb 01 00 00 00       	mov    $0x1,%ebx
+    1bf8:	8b 14 b5 8c 28 00 00 	mov    0x288c(,%esi,4),%edx
+    1bff:	89 50 14             	mov    %edx,0x14(%eax)
+  if(p->next)
+    1c02:	85 d2                	test   %edx,%edx
+    1c04:	74 0a                	je     1c10 <free+0xd0>
+    p->next->prev = p;
+    1c06:	89 42 18             	mov    %eax,0x18(%edx)
+  partial[p->class] = p;
+    1c09:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  if(p->nfree == nblocks(p->class)){
+    1c0d:	8b 58 08             	mov    0x8(%eax),%ebx
+  partial[p->class] = p;
+    1c10:	89 04 b5 8c 28 00 00 	mov    %eax,0x288c(,%esi,4)
+}
+    1c17:	eb 80                	jmp    1b99 <free+0x59>
+    1c19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+    1c20:	89 14 b5 8c 28 00 00 	mov    %edx,0x288c(,%esi,4)
+    1c27:	eb 8b                	jmp    1bb4 <free+0x74>
+    1c29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001c30 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1c30:	55                   	push   %ebp
+    1c31:	89 e5                	mov    %esp,%ebp
+    1c33:	56                   	push   %esi
+    1c34:	53                   	push   %ebx
+    1c35:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct page *p;
+  uint n;
+
+  if(nbytes <= MAXSMALL)
+    1c38:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1c3d:	76 71                	jbe    1cb0 <malloc+0x80>
+    return smallalloc(sizeclass(nbytes));
+  if(nbytes > 0x7fffffff)
+    1c3f:	85 c0                	test   %eax,%eax
+    1c41:	0f 88 d9 00 00 00    	js     1d20 <malloc+0xf0>
+    return 0;
+  n = (nbytes + HDRSIZE + PGSIZE-1) / PGSIZE;
+    1c47:	8d 90 1f 10 00 00    	lea    0x101f(%eax),%edx
+    1c4d:	89 d3                	mov    %edx,%ebx
+    1c4f:	c1 eb 0c             	shr    $0xc,%ebx
+  if(nbytes >= MAPMIN){
+    1c52:	3d ff ff 00 00       	cmp    $0xffff,%eax
+    1c57:	77 27                	ja     1c80 <malloc+0x50>
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    if(p == MAP_FAILED)
+      return 0;
+    p->kind = PMAP;
+  } else {
+    if((p = runalloc(n)) == 0)
+    1c59:	89 d8                	mov    %ebx,%eax
+    1c5b:	e8 c0 fd ff ff       	call   1a20 <runalloc>
+    1c60:	85 c0                	test   %eax,%eax
+    1c62:	0f 84 b8 00 00 00    	je     1d20 <malloc+0xf0>
+      return 0;
+    p->kind = PRUN;
+    1c68:	ba 02 00 00 00       	mov    $0x2,%edx
+    1c6d:	66 89 10             	mov    %dx,(%eax)
+  }
+  p->npages = n;
+    1c70:	89 58 04             	mov    %ebx,0x4(%eax)
+  return (char*)p + HDRSIZE;
+    1c73:	8d 58 20             	lea    0x20(%eax),%ebx
+}
+    1c76:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1c79:	89 d8                	mov    %ebx,%eax
+    1c7b:	5b                   	pop    %ebx
+    1c7c:	5e                   	pop    %esi
+    1c7d:	5d                   	pop    %ebp
+    1c7e:	c3                   	ret
+    1c7f:	90                   	nop
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    1c80:	83 ec 08             	sub    $0x8,%esp
+    1c83:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+    1c89:	6a 00                	push   $0x0
+    1c8b:	6a ff                	push   $0xffffffff
+    1c8d:	6a 22                	push   $0x22
+    1c8f:	6a 03                	push   $0x3
+    1c91:	52                   	push   %edx
+    1c92:	6a 00                	push   $0x0
+    1c94:	e8 52 f9 ff ff       	call   15eb <mmap>
+    if(p == MAP_FAILED)
+    1c99:	83 c4 20             	add    $0x20,%esp
+    1c9c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1c9f:	74 7f                	je     1d20 <malloc+0xf0>
+    p->kind = PMAP;
+    1ca1:	b9 04 00 00 00       	mov    $0x4,%ecx
+    1ca6:	66 89 08             	mov    %cx,(%eax)
+    1ca9:	eb c5                	jmp    1c70 <malloc+0x40>
+    1cab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1caf:	90                   	nop
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+    1cb0:	83 f8 10             	cmp    $0x10,%eax
+    1cb3:	0f 86 07 01 00 00    	jbe    1dc0 <malloc+0x190>
+    1cb9:	31 db                	xor    %ebx,%ebx
+    1cbb:	ba 10 00 00 00       	mov    $0x10,%edx
+    1cc0:	83 c3 01             	add    $0x1,%ebx
+    1cc3:	89 d6                	mov    %edx,%esi
+    1cc5:	89 d9                	mov    %ebx,%ecx
+    1cc7:	d3 e6                	shl    %cl,%esi
+    1cc9:	39 c6                	cmp    %eax,%esi
+    1ccb:	72 f3                	jb     1cc0 <malloc+0x90>
+  if((p = partial[c]) == 0){
+    1ccd:	8b 14 9d 8c 28 00 00 	mov    0x288c(,%ebx,4),%edx
+    1cd4:	85 d2                	test   %edx,%edx
+    1cd6:	74 58                	je     1d30 <malloc+0x100>
+  if((b = p->free) != 0){
+    1cd8:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+    1cdb:	8b 4a 08             	mov    0x8(%edx),%ecx
+  if((b = p->free) != 0){
+    1cde:	85 db                	test   %ebx,%ebx
+    1ce0:	0f 84 aa 00 00 00    	je     1d90 <malloc+0x160>
+    p->free = b->next;
+    1ce6:	8b 03                	mov    (%ebx),%eax
+    1ce8:	89 42 0c             	mov    %eax,0xc(%edx)
+  if(--p->nfree == 0)
+    1ceb:	83 e9 01             	sub    $0x1,%ecx
+    1cee:	89 4a 08             	mov    %ecx,0x8(%edx)
+    1cf1:	75 83                	jne    1c76 <malloc+0x46>
+  if(p->prev)
+    1cf3:	8b 4a 18             	mov    0x18(%edx),%ecx
+    p->prev->next = p->next;
+    1cf6:	8b 42 14             	mov    0x14(%edx),%eax
+  if(p->prev)
+    1cf9:	85 c9                	test   %ecx,%ecx
+    1cfb:	0f 84 cf 00 00 00    	je     1dd0 <malloc+0x1a0>
+    p->prev->next = p->next;
+    1d01:	89 41 14             	mov    %eax,0x14(%ecx)
+  if(p->next)
+    1d04:	85 c0                	test   %eax,%eax
+    1d06:	0f 84 6a ff ff ff    	je     1c76 <malloc+0x46>
+    p->next->prev = p->prev;
+    1d0c:	8b 52 18             	mov    0x18(%edx),%edx
+    1d0f:	89 50 18             	mov    %edx,0x18(%eax)
+    1d12:	e9 5f ff ff ff       	jmp    1c76 <malloc+0x46>
+    1d17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d1e:	66 90                	xchg   %ax,%ax
+}
+    1d20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+    1d23:	31 db                	xor    %ebx,%ebx
+}
+    1d25:	89 d8                	mov    %ebx,%eax
+    1d27:	5b                   	pop    %ebx
+    1d28:	5e                   	pop    %esi
+    1d29:	5d                   	pop    %ebp
+    1d2a:	c3                   	ret
+    1d2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1d2f:	90                   	nop
+    if((p = runalloc(1)) == 0)
+    1d30:	b8 01 00 00 00       	mov    $0x1,%eax
+    1d35:	e8 e6 fc ff ff       	call   1a20 <runalloc>
+    1d3a:	89 c2                	mov    %eax,%edx
+    1d3c:	85 c0                	test   %eax,%eax
+    1d3e:	74 e0                	je     1d20 <malloc+0xf0>
+    p->kind = PSMALL;
+    1d40:	b8 01 00 00 00       	mov    $0x1,%eax
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+    1d45:	8d 4b 04             	lea    0x4(%ebx),%ecx
+    p->class = c;
+    1d48:	66 89 5a 02          	mov    %bx,0x2(%edx)
+    1d4c:	0f b7 db             	movzwl %bx,%ebx
+    p->kind = PSMALL;
+    1d4f:	66 89 02             	mov    %ax,(%edx)
+    p->fresh = (char*)p + HDRSIZE;
+    1d52:	8d 42 20             	lea    0x20(%edx),%eax
+    1d55:	89 42 10             	mov    %eax,0x10(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+    1d58:	b8 e0 0f 00 00       	mov    $0xfe0,%eax
+    1d5d:	d3 f8                	sar    %cl,%eax
+    p->free = 0;
+    1d5f:	c7 42 0c 00 00 00 00 	movl   $0x0,0xc(%edx)
+    p->nfree = nblocks(c);
+    1d66:	89 42 08             	mov    %eax,0x8(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+    1d69:	89 c1                	mov    %eax,%ecx
+  p->next = partial[p->class];
+    1d6b:	8b 04 9d 8c 28 00 00 	mov    0x288c(,%ebx,4),%eax
+  p->prev = 0;
+    1d72:	c7 42 18 00 00 00 00 	movl   $0x0,0x18(%edx)
+  p->next = partial[p->class];
+    1d79:	89 42 14             	mov    %eax,0x14(%edx)
+  if(p->next)
+    1d7c:	85 c0                	test   %eax,%eax
+    1d7e:	75 20                	jne    1da0 <malloc+0x170>
+  partial[p->class] = p;
+    1d80:	89 14 9d 8c 28 00 00 	mov    %edx,0x288c(,%ebx,4)
+  if((b = p->free) != 0){
+    1d87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d8e:	66 90                	xchg   %ax,%ax
+    b = (struct block*)p->fresh;
+    1d90:	8b 5a 10             	mov    0x10(%edx),%ebx
+    p->fresh += MINSMALL << c;
+    1d93:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+    1d96:	89 42 10             	mov    %eax,0x10(%edx)
+    1d99:	e9 4d ff ff ff       	jmp    1ceb <malloc+0xbb>
+    1d9e:	66 90                	xchg   %ax,%ax
+    p->next->prev = p;
+    1da0:	89 50 18             	mov    %edx,0x18(%eax)
+  partial[p->class] = p;
+    1da3:	0f b7 42 02          	movzwl 0x2(%edx),%eax
+  if((b = p->free) != 0){
+    1da7:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+    1daa:	8b 4a 08             	mov    0x8(%edx),%ecx
+  partial[p->class] = p;
+    1dad:	89 14 85 8c 28 00 00 	mov    %edx,0x288c(,%eax,4)
+}
+    1db4:	e9 25 ff ff ff       	jmp    1cde <malloc+0xae>
+    1db9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+    1dc0:	be 10 00 00 00       	mov    $0x10,%esi
+    1dc5:	31 db                	xor    %ebx,%ebx
+    1dc7:	e9 01 ff ff ff       	jmp    1ccd <malloc+0x9d>
+    1dcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+    1dd0:	0f b7 4a 02          	movzwl 0x2(%edx),%ecx
+    1dd4:	89 04 8d 8c 28 00 00 	mov    %eax,0x288c(,%ecx,4)
+    1ddb:	e9 24 ff ff ff       	jmp    1d04 <malloc+0xd4>
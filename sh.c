@@ -3,6 +3,7 @@
 #include "types.h"
 #include "user.h"
 #include "fcntl.h"
+#include "spawn.h"
 #include "path_util.h"
 
 // Parsed command representation
@@ -51,8 +52,10 @@ struct backcmd {
 };
 
 int fork1(void);  // Fork but panics on failure.
+int spawncmd(struct cmd*);
 void panic(char*);
 struct cmd *parsecmd(char*);
+void freecmd(struct cmd*);
 
 // Execute cmd.  Never returns.
 void
@@ -147,6 +150,7 @@ main(void)
 {
   static char buf[100];
   int fd;
+  struct cmd *cmd;
 
   // Ensure that three file descriptors are open.
   while((fd = open("console", O_RDWR)) >= 0){
@@ -198,13 +202,53 @@ main(void)
         printf(2, "cannot cd %s\n", buf+3);
       continue;
     }
-    if(fork1() == 0)
-      runcmd(parsecmd(buf));
-    wait();
+    if((cmd = parsecmd(buf)) == 0)
+      continue;
+    if(!spawncmd(cmd)){
+      if(fork1() == 0)
+        runcmd(cmd);
+      wait();
+    }
+    freecmd(cmd);
   }
   exit();
 }
 
+// Run cmd with spawn, which does not copy the shell, if it is a
+// single program with redirections, and wait for it. Returns 0 if
+// cmd is something else, for the caller to fork and run.
+int
+spawncmd(struct cmd *cmd)
+{
+  struct spawnact act[SPAWN_MAXACT];
+  struct execcmd *ecmd;
+  struct redircmd *rcmd;
+  int n;
+
+  // Redirections apply outermost first, as in runcmd.
+  for(n = 0; cmd->type == REDIR; n++){
+    if(n == SPAWN_MAXACT)
+      return 0;
+    rcmd = (struct redircmd*)cmd;
+    act[n].op = SPAWN_OPEN;
+    act[n].fd = rcmd->fd;
+    act[n].arg = rcmd->mode;
+    act[n].path = rcmd->file;
+    cmd = rcmd->cmd;
+  }
+  if(cmd->type != EXEC)
+    return 0;
+  ecmd = (struct execcmd*)cmd;
+  if(ecmd->argv[0] == 0)
+    return 1;
+  if(spawn(ecmd->argv[0], ecmd->argv, act, n, -1) < 0){
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+    return 1;
+  }
+  wait();
+  return 1;
+}
+
 void
 panic(char *s)
 {
@@ -358,18 +402,37 @@ struct cmd *parsepipe(char**, char*);
 struct cmd *parseexec(char**, char*);
 struct cmd *nulterminate(struct cmd*);
 
+// The first syntax error in the line being parsed. Parsing
+// runs in the shell itself, so an error must not exit; the
+// parsers note it here and stop with a well-formed tree.
+char *syntaxerr;
+
+void
+syntax(char *s)
+{
+  if(syntaxerr == 0)
+    syntaxerr = s;
+}
+
+// Parse s. Prints the error and returns 0 if s is malformed.
 struct cmd*
 parsecmd(char *s)
 {
   char *es;
   struct cmd *cmd;
 
+  syntaxerr = 0;
   es = s + strlen(s);
   cmd = parseline(&s, es);
   peek(&s, es, "");
-  if(s != es){
+  if(s != es && syntaxerr == 0){
     printf(2, "leftovers: %s\n", s);
-    panic("syntax");
+    syntax("syntax");
+  }
+  if(syntaxerr){
+    printf(2, "%s\n", syntaxerr);
+    freecmd(cmd);
+    return 0;
   }
   nulterminate(cmd);
   return cmd;
@@ -413,8 +476,10 @@ parseredirs(struct cmd *cmd, char **ps, char *es)
 
   while(peek(ps, es, "<>")){
     tok = gettoken(ps, es, 0, 0);
-    if(gettoken(ps, es, &q, &eq) != 'a')
-      panic("missing file for redirection");
+    if(gettoken(ps, es, &q, &eq) != 'a'){
+      syntax("missing file for redirection");
+      break;
+    }
     switch(tok){
     case '<':
       cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
@@ -439,8 +504,10 @@ parseblock(char **ps, char *es)
     panic("parseblock");
   gettoken(ps, es, 0, 0);
   cmd = parseline(ps, es);
-  if(!peek(ps, es, ")"))
-    panic("syntax - missing )");
+  if(!peek(ps, es, ")")){
+    syntax("syntax - missing )");
+    return cmd;
+  }
   gettoken(ps, es, 0, 0);
   cmd = parseredirs(cmd, ps, es);
   return cmd;
@@ -465,13 +532,17 @@ parseexec(char **ps, char *es)
   while(!peek(ps, es, "|)&;")){
     if((tok=gettoken(ps, es, &q, &eq)) == 0)
       break;
-    if(tok != 'a')
-      panic("syntax");
+    if(tok != 'a'){
+      syntax("syntax");
+      break;
+    }
+    if(argc >= MAXARGS-1){
+      syntax("too many args");
+      break;
+    }
     cmd->argv[argc] = q;
     cmd->eargv[argc] = eq;
     argc++;
-    if(argc >= MAXARGS)
-      panic("too many args");
     ret = parseredirs(ret, ps, es);
   }
   cmd->argv[argc] = 0;
@@ -525,3 +596,41 @@ nulterminate(struct cmd *cmd)
   }
   return cmd;
 }
+
+// Free the tree that parsecmd built.
+void
+freecmd(struct cmd *cmd)
+{
+  struct backcmd *bcmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+    return;
+
+  switch(cmd->type){
+  case REDIR:
+    rcmd = (struct redircmd*)cmd;
+    freecmd(rcmd->cmd);
+    break;
+
+  case PIPE:
+    pcmd = (struct pipecmd*)cmd;
+    freecmd(pcmd->left);
+    freecmd(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    freecmd(lcmd->left);
+    freecmd(lcmd->right);
+    break;
+
+  case BACK:
+    bcmd = (struct backcmd*)cmd;
+    freecmd(bcmd->cmd);
+    break;
+  }
+  free(cmd);
+}
@@ -0,0 +1,175 @@
+// Shared memory segments.
+//
+// A segment is a named run of zero-filled pages that processes
+// map with shmget() to pass data without copying it through the
+// kernel. Names are private to a container: a process only finds
+// segments created by processes of its own container, so two
+// containers may use the same name without seeing each other.
+// An anonymous MAP_SHARED mapping is backed by a segment with no
+// name or container, which only its mappers and their fork
+// children reach.
+//
+// Every vma mapping a segment holds a reference to it, and the
+// segment holds one kalloc reference (see kref) to each of its
+// pages. A segment and its pages go away with the last mapping.
+// shm.lock protects the table and the segments' fields.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+
+struct shm {
+  struct container *cont;   // Container the name belongs to
+  char name[16];
+  int ref;                  // Mappings of the segment; 0 if unused
+  uint npages;
+  char **page;              // NSHMPAGE pages, allocated on first touch
+};
+
+struct {
+  struct spinlock lock;
+  struct shm shm[NSHM];
+} shmtable;
+
+void
+shminit(void)
+{
+  initlock(&shmtable.lock, "shm");
+}
+
+// Take a free slot for a segment of npages pages and return
+// it with one reference, or 0 if the table is full. Caller
+// holds shmtable.lock.
+static struct shm*
+shmalloc(struct container *cont, char *name, uint npages)
+{
+  struct shm *s;
+
+  for(s = shmtable.shm; s < &shmtable.shm[NSHM]; s++){
+    if(s->ref == 0){
+      if((s->page = (char**)kzalloc()) == 0)
+        return 0;
+      s->cont = cont;
+      safestrcpy(s->name, name, sizeof(s->name));
+      s->ref = 1;
+      s->npages = npages;
+      return s;
+    }
+  }
+  return 0;
+}
+
+// Find the segment called name in the current container,
+// creating it with size bytes if there is none, and return
+// it with a new reference. Returns 0 if the segment exists
+// but is smaller than size, or if the table is full.
+struct shm*
+shmget(char *name, uint size)
+{
+  struct container *cont = myproc()->cont;
+  struct shm *s;
+  uint npages;
+
+  npages = PGROUNDUP(size) / PGSIZE;
+  if(npages == 0 || npages > NSHMPAGE)
+    return 0;
+
+  acquire(&shmtable.lock);
+  for(s = shmtable.shm; s < &shmtable.shm[NSHM]; s++){
+    if(s->ref == 0)
+      continue;
+    if(s->cont == cont && strncmp(s->name, name, sizeof(s->name)) == 0){
+      if(npages > s->npages){
+        release(&shmtable.lock);
+        return 0;
+      }
+      s->ref++;
+      release(&shmtable.lock);
+      return s;
+    }
+  }
+  s = shmalloc(cont, name, npages);
+  release(&shmtable.lock);
+  return s;
+}
+
+// Make a segment of size bytes that no name finds, to back
+// an anonymous shared mapping, and return it with a new
+// reference. Returns 0 if it is too big or the table is full.
+struct shm*
+shmanon(uint size)
+{
+  struct shm *s;
+  uint npages;
+
+  npages = PGROUNDUP(size) / PGSIZE;
+  if(npages == 0 || npages > NSHMPAGE)
+    return 0;
+
+  acquire(&shmtable.lock);
+  s = shmalloc(0, "", npages);
+  release(&shmtable.lock);
+  return s;
+}
+
+// Add a reference to s, for a new mapping of it.
+void
+shmdup(struct shm *s)
+{
+  acquire(&shmtable.lock);
+  s->ref++;
+  release(&shmtable.lock);
+}
+
+// Drop a reference to s, freeing the segment's pages
+// when the last mapping goes away.
+void
+shmput(struct shm *s)
+{
+  uint i;
+
+  acquire(&shmtable.lock);
+  if(s->ref < 1)
+    panic("shmput");
+  if(--s->ref == 0){
+    for(i = 0; i < s->npages; i++){
+      if(s->page[i])
+        kfree(s->page[i]);
+      s->page[i] = 0;
+    }
+    kfree((char*)s->page);
+    s->page = 0;
+  }
+  release(&shmtable.lock);
+}
+
+// Return page n of s with a reference for the caller's
+// mapping, allocating it if this is the first touch.
+// Returns 0 if n is past the end or memory is exhausted.
+char*
+shmpage(struct shm *s, uint n)
+{
+  char *mem;
+
+  acquire(&shmtable.lock);
+  if(n >= s->npages){
+    release(&shmtable.lock);
+    return 0;
+  }
+  if(s->page[n] == 0){
+    if((mem = kzalloc()) == 0 || kcharge(mem, myproc()->cont) < 0){
+      if(mem)
+        kfree(mem);
+      release(&shmtable.lock);
+      return 0;
+    }
+    s->page[n] = mem;
+  }
+  mem = s->page[n];
+  kref(mem);
+  release(&shmtable.lock);
+  return mem;
+}
@@ -0,0 +1,1997 @@
+
+_shmbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  munmap(r, sizeof(*r));
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 e4 f0             	and    $0xfffffff0,%esp
+  pipetest();
+   6:	e8 95 00 00 00       	call   a0 <pipetest>
+  shmtest();
+   b:	e8 d0 01 00 00       	call   1e0 <shmtest>
+  exit();
+  10:	e8 6e 05 00 00       	call   583 <exit>
+  15:	66 90                	xchg   %ax,%ax
+  17:	66 90                	xchg   %ax,%ax
+  19:	66 90                	xchg   %ax,%ax
+  1b:	66 90                	xchg   %ax,%ax
+  1d:	66 90                	xchg   %ax,%ax
+  1f:	90                   	nop
+
+00000020 <sum>:
+{
+  20:	55                   	push   %ebp
+  21:	89 e5                	mov    %esp,%ebp
+  23:	53                   	push   %ebx
+  24:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  for(i = 0; i < n; i++)
+  27:	85 db                	test   %ebx,%ebx
+  29:	7e 25                	jle    50 <sum+0x30>
+  2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  s = 0;
+  2e:	31 d2                	xor    %edx,%edx
+  30:	01 c3                	add    %eax,%ebx
+  32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    s += p[i];
+  38:	0f be 08             	movsbl (%eax),%ecx
+  for(i = 0; i < n; i++)
+  3b:	83 c0 01             	add    $0x1,%eax
+    s += p[i];
+  3e:	01 ca                	add    %ecx,%edx
+  for(i = 0; i < n; i++)
+  40:	39 d8                	cmp    %ebx,%eax
+  42:	75 f4                	jne    38 <sum+0x18>
+}
+  44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  47:	89 d0                	mov    %edx,%eax
+  49:	c9                   	leave
+  4a:	c3                   	ret
+  4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  4f:	90                   	nop
+  s = 0;
+  50:	31 d2                	xor    %edx,%edx
+}
+  52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  55:	c9                   	leave
+  56:	89 d0                	mov    %edx,%eax
+  58:	c3                   	ret
+  59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000060 <report>:
+{
+  60:	55                   	push   %ebp
+  61:	b8 00 10 00 00       	mov    $0x1000,%eax
+  66:	89 e5                	mov    %esp,%ebp
+  68:	83 ec 08             	sub    $0x8,%esp
+  6b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  if(ticks == 0)
+  6e:	85 c9                	test   %ecx,%ecx
+  70:	74 26                	je     98 <report+0x38>
+  printf(1, "%s: %d KB in %d ticks, %d KB/tick\n",
+  72:	31 d2                	xor    %edx,%edx
+  74:	f7 f9                	idiv   %ecx
+  76:	83 ec 08             	sub    $0x8,%esp
+  79:	50                   	push   %eax
+  7a:	51                   	push   %ecx
+  7b:	68 00 10 00 00       	push   $0x1000
+  80:	ff 75 08             	push   0x8(%ebp)
+  83:	68 20 0e 00 00       	push   $0xe20
+  88:	6a 01                	push   $0x1
+  8a:	e8 a1 06 00 00       	call   730 <printf>
+}
+  8f:	83 c4 20             	add    $0x20,%esp
+  92:	c9                   	leave
+  93:	c3                   	ret
+  94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    ticks = 1;
+  98:	b9 01 00 00 00       	mov    $0x1,%ecx
+  9d:	eb d7                	jmp    76 <report+0x16>
+  9f:	90                   	nop
+
+000000a0 <pipetest>:
+{
+  a0:	55                   	push   %ebp
+  a1:	89 e5                	mov    %esp,%ebp
+  a3:	56                   	push   %esi
+  a4:	53                   	push   %ebx
+  if(pipe(fd) < 0){
+  a5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+{
+  a8:	83 ec 1c             	sub    $0x1c,%esp
+  if(pipe(fd) < 0){
+  ab:	50                   	push   %eax
+  ac:	e8 e2 04 00 00       	call   593 <pipe>
+  b1:	83 c4 10             	add    $0x10,%esp
+  b4:	85 c0                	test   %eax,%eax
+  b6:	0f 88 04 01 00 00    	js     1c0 <pipetest+0x120>
+  start = uptime();
+  bc:	e8 5a 05 00 00       	call   61b <uptime>
+  c1:	89 c6                	mov    %eax,%esi
+  if(fork() == 0){
+  c3:	e8 b3 04 00 00       	call   57b <fork>
+  c8:	85 c0                	test   %eax,%eax
+  ca:	0f 84 a7 00 00 00    	je     177 <pipetest+0xd7>
+  close(fd[1]);
+  d0:	83 ec 0c             	sub    $0xc,%esp
+  d3:	ff 75 f4             	push   -0xc(%ebp)
+  got = 0;
+  d6:	31 db                	xor    %ebx,%ebx
+  close(fd[1]);
+  d8:	e8 ce 04 00 00       	call   5ab <close>
+  while((n = read(fd[0], buf, sizeof(buf))) > 0){
+  dd:	83 c4 10             	add    $0x10,%esp
+  e0:	eb 08                	jmp    ea <pipetest+0x4a>
+  e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    got += n;
+  e8:	01 c3                	add    %eax,%ebx
+  while((n = read(fd[0], buf, sizeof(buf))) > 0){
+  ea:	83 ec 04             	sub    $0x4,%esp
+  ed:	68 00 10 00 00       	push   $0x1000
+  f2:	68 c0 12 00 00       	push   $0x12c0
+  f7:	ff 75 f0             	push   -0x10(%ebp)
+  fa:	e8 9c 04 00 00       	call   59b <read>
+  ff:	83 c4 10             	add    $0x10,%esp
+ 102:	85 c0                	test   %eax,%eax
+ 104:	7f e2                	jg     e8 <pipetest+0x48>
+  close(fd[0]);
+ 106:	83 ec 0c             	sub    $0xc,%esp
+ 109:	ff 75 f0             	push   -0x10(%ebp)
+ 10c:	e8 9a 04 00 00       	call   5ab <close>
+  wait();
+ 111:	e8 75 04 00 00       	call   58b <wait>
+  if(got != TOTAL)
+ 116:	83 c4 10             	add    $0x10,%esp
+ 119:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+ 11f:	74 13                	je     134 <pipetest+0x94>
+    printf(1, "shmbench: pipe moved %d bytes\n", got);
+ 121:	83 ec 04             	sub    $0x4,%esp
+ 124:	53                   	push   %ebx
+ 125:	68 44 0e 00 00       	push   $0xe44
+ 12a:	6a 01                	push   $0x1
+ 12c:	e8 ff 05 00 00       	call   730 <printf>
+ 131:	83 c4 10             	add    $0x10,%esp
+  report("pipe", uptime() - start);
+ 134:	e8 e2 04 00 00       	call   61b <uptime>
+  if(ticks == 0)
+ 139:	29 f0                	sub    %esi,%eax
+ 13b:	89 c1                	mov    %eax,%ecx
+ 13d:	b8 00 10 00 00       	mov    $0x1000,%eax
+ 142:	74 2c                	je     170 <pipetest+0xd0>
+  printf(1, "%s: %d KB in %d ticks, %d KB/tick\n",
+ 144:	31 d2                	xor    %edx,%edx
+ 146:	f7 f9                	idiv   %ecx
+ 148:	83 ec 08             	sub    $0x8,%esp
+ 14b:	50                   	push   %eax
+ 14c:	51                   	push   %ecx
+ 14d:	68 00 10 00 00       	push   $0x1000
+ 152:	68 7a 0e 00 00       	push   $0xe7a
+ 157:	68 20 0e 00 00       	push   $0xe20
+ 15c:	6a 01                	push   $0x1
+ 15e:	e8 cd 05 00 00       	call   730 <printf>
+}
+ 163:	83 c4 20             	add    $0x20,%esp
+ 166:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 169:	5b                   	pop    %ebx
+ 16a:	5e                   	pop    %esi
+ 16b:	5d                   	pop    %ebp
+ 16c:	c3                   	ret
+ 16d:	8d 76 00             	lea    0x0(%esi),%esi
+    ticks = 1;
+ 170:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 175:	eb d1                	jmp    148 <pipetest+0xa8>
+    close(fd[0]);
+ 177:	83 ec 0c             	sub    $0xc,%esp
+ 17a:	ff 75 f0             	push   -0x10(%ebp)
+    memset(buf, 'p', sizeof(buf));
+ 17d:	bb 00 04 00 00       	mov    $0x400,%ebx
+    close(fd[0]);
+ 182:	e8 24 04 00 00       	call   5ab <close>
+    memset(buf, 'p', sizeof(buf));
+ 187:	83 c4 0c             	add    $0xc,%esp
+ 18a:	68 00 10 00 00       	push   $0x1000
+ 18f:	6a 70                	push   $0x70
+ 191:	68 c0 12 00 00       	push   $0x12c0
+ 196:	e8 25 02 00 00       	call   3c0 <memset>
+ 19b:	83 c4 10             	add    $0x10,%esp
+      write(fd[1], buf, CHUNK);
+ 19e:	83 ec 04             	sub    $0x4,%esp
+ 1a1:	68 00 10 00 00       	push   $0x1000
+ 1a6:	68 c0 12 00 00       	push   $0x12c0
+ 1ab:	ff 75 f4             	push   -0xc(%ebp)
+ 1ae:	e8 f0 03 00 00       	call   5a3 <write>
+    for(n = 0; n < TOTAL; n += CHUNK)
+ 1b3:	83 c4 10             	add    $0x10,%esp
+ 1b6:	83 eb 01             	sub    $0x1,%ebx
+ 1b9:	75 e3                	jne    19e <pipetest+0xfe>
+    exit();
+ 1bb:	e8 c3 03 00 00       	call   583 <exit>
+    printf(1, "shmbench: pipe failed\n");
+ 1c0:	50                   	push   %eax
+ 1c1:	50                   	push   %eax
+ 1c2:	68 63 0e 00 00       	push   $0xe63
+ 1c7:	6a 01                	push   $0x1
+ 1c9:	e8 62 05 00 00       	call   730 <printf>
+    exit();
+ 1ce:	e8 b0 03 00 00       	call   583 <exit>
+ 1d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000001e0 <shmtest>:
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	56                   	push   %esi
+ 1e4:	53                   	push   %ebx
+  r = shmget("shmbench", sizeof(*r));
+ 1e5:	83 ec 08             	sub    $0x8,%esp
+ 1e8:	68 08 80 00 00       	push   $0x8008
+ 1ed:	68 7f 0e 00 00       	push   $0xe7f
+ 1f2:	e8 44 04 00 00       	call   63b <shmget>
+  if(r == (struct ring*)-1){
+ 1f7:	83 c4 10             	add    $0x10,%esp
+ 1fa:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 1fd:	0f 84 e5 00 00 00    	je     2e8 <shmtest+0x108>
+  r->head = r->tail = 0;
+ 203:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+ 20a:	89 c3                	mov    %eax,%ebx
+ 20c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  start = uptime();
+ 212:	e8 04 04 00 00       	call   61b <uptime>
+ 217:	89 c6                	mov    %eax,%esi
+  if(fork() == 0){
+ 219:	e8 5d 03 00 00       	call   57b <fork>
+ 21e:	85 c0                	test   %eax,%eax
+ 220:	0f 84 7c 00 00 00    	je     2a2 <shmtest+0xc2>
+ 226:	b9 00 04 00 00       	mov    $0x400,%ecx
+ 22b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 22f:	90                   	nop
+    while(r->head == r->tail)
+ 230:	8b 13                	mov    (%ebx),%edx
+ 232:	8b 43 04             	mov    0x4(%ebx),%eax
+ 235:	39 c2                	cmp    %eax,%edx
+ 237:	74 f7                	je     230 <shmtest+0x50>
+    sum(r->slot[r->tail % NSLOT], CHUNK);
+ 239:	8b 43 04             	mov    0x4(%ebx),%eax
+    __sync_synchronize();
+ 23c:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    r->tail++;
+ 241:	8b 43 04             	mov    0x4(%ebx),%eax
+ 244:	83 c0 01             	add    $0x1,%eax
+ 247:	89 43 04             	mov    %eax,0x4(%ebx)
+  for(n = 0; n < TOTAL; n += CHUNK){
+ 24a:	83 e9 01             	sub    $0x1,%ecx
+ 24d:	75 e1                	jne    230 <shmtest+0x50>
+  wait();
+ 24f:	e8 37 03 00 00       	call   58b <wait>
+  report("shm", uptime() - start);
+ 254:	e8 c2 03 00 00       	call   61b <uptime>
+  if(ticks == 0)
+ 259:	29 f0                	sub    %esi,%eax
+ 25b:	89 c1                	mov    %eax,%ecx
+ 25d:	b8 00 10 00 00       	mov    $0x1000,%eax
+ 262:	74 37                	je     29b <shmtest+0xbb>
+  printf(1, "%s: %d KB in %d ticks, %d KB/tick\n",
+ 264:	31 d2                	xor    %edx,%edx
+ 266:	f7 f9                	idiv   %ecx
+ 268:	83 ec 08             	sub    $0x8,%esp
+ 26b:	50                   	push   %eax
+ 26c:	51                   	push   %ecx
+ 26d:	68 00 10 00 00       	push   $0x1000
+ 272:	68 a1 0e 00 00       	push   $0xea1
+ 277:	68 20 0e 00 00       	push   $0xe20
+ 27c:	6a 01                	push   $0x1
+ 27e:	e8 ad 04 00 00       	call   730 <printf>
+  munmap(r, sizeof(*r));
+ 283:	83 c4 18             	add    $0x18,%esp
+ 286:	68 08 80 00 00       	push   $0x8008
+ 28b:	53                   	push   %ebx
+ 28c:	e8 a2 03 00 00       	call   633 <munmap>
+}
+ 291:	83 c4 10             	add    $0x10,%esp
+ 294:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 297:	5b                   	pop    %ebx
+ 298:	5e                   	pop    %esi
+ 299:	5d                   	pop    %ebp
+ 29a:	c3                   	ret
+    ticks = 1;
+ 29b:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 2a0:	eb c6                	jmp    268 <shmtest+0x88>
+ 2a2:	be 00 04 00 00       	mov    $0x400,%esi
+      while(r->head - r->tail == NSLOT)
+ 2a7:	8b 03                	mov    (%ebx),%eax
+ 2a9:	8b 53 04             	mov    0x4(%ebx),%edx
+ 2ac:	29 d0                	sub    %edx,%eax
+ 2ae:	83 f8 08             	cmp    $0x8,%eax
+ 2b1:	74 f4                	je     2a7 <shmtest+0xc7>
+      memset(r->slot[r->head % NSLOT], 's', CHUNK);
+ 2b3:	8b 03                	mov    (%ebx),%eax
+ 2b5:	83 ec 04             	sub    $0x4,%esp
+ 2b8:	68 00 10 00 00       	push   $0x1000
+ 2bd:	83 e0 07             	and    $0x7,%eax
+ 2c0:	6a 73                	push   $0x73
+ 2c2:	c1 e0 0c             	shl    $0xc,%eax
+ 2c5:	8d 44 03 08          	lea    0x8(%ebx,%eax,1),%eax
+ 2c9:	50                   	push   %eax
+ 2ca:	e8 f1 00 00 00       	call   3c0 <memset>
+    for(n = 0; n < TOTAL; n += CHUNK){
+ 2cf:	83 c4 10             	add    $0x10,%esp
+      __sync_synchronize();
+ 2d2:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+      r->head++;
+ 2d7:	8b 03                	mov    (%ebx),%eax
+ 2d9:	83 c0 01             	add    $0x1,%eax
+ 2dc:	89 03                	mov    %eax,(%ebx)
+    for(n = 0; n < TOTAL; n += CHUNK){
+ 2de:	83 ee 01             	sub    $0x1,%esi
+ 2e1:	75 c4                	jne    2a7 <shmtest+0xc7>
+    exit();
+ 2e3:	e8 9b 02 00 00       	call   583 <exit>
+    printf(1, "shmbench: shmget failed\n");
+ 2e8:	50                   	push   %eax
+ 2e9:	50                   	push   %eax
+ 2ea:	68 88 0e 00 00       	push   $0xe88
+ 2ef:	6a 01                	push   $0x1
+ 2f1:	e8 3a 04 00 00       	call   730 <printf>
+    exit();
+ 2f6:	e8 88 02 00 00       	call   583 <exit>
+ 2fb:	66 90                	xchg   %ax,%ax
+ 2fd:	66 90                	xchg   %ax,%ax
+ 2ff:	90                   	nop
+
+00000300 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 300:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 301:	31 c0                	xor    %eax,%eax
+{
+ 303:	89 e5                	mov    %esp,%ebp
+ 305:	53                   	push   %ebx
+ 306:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 309:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 310:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 314:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 317:	83 c0 01             	add    $0x1,%eax
+ 31a:	84 d2                	test   %dl,%dl
+ 31c:	75 f2                	jne    310 <strcpy+0x10>
+    ;
+  return os;
+}
+ 31e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 321:	89 c8                	mov    %ecx,%eax
+ 323:	c9                   	leave
+ 324:	c3                   	ret
+ 325:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	53                   	push   %ebx
+ 334:	8b 55 08             	mov    0x8(%ebp),%edx
+ 337:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 33a:	0f b6 02             	movzbl (%edx),%eax
+ 33d:	84 c0                	test   %al,%al
+ 33f:	75 17                	jne    358 <strcmp+0x28>
+ 341:	eb 3a                	jmp    37d <strcmp+0x4d>
+ 343:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 347:	90                   	nop
+ 348:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 34c:	83 c2 01             	add    $0x1,%edx
+ 34f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 352:	84 c0                	test   %al,%al
+ 354:	74 1a                	je     370 <strcmp+0x40>
+    p++, q++;
+ 356:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 358:	0f b6 19             	movzbl (%ecx),%ebx
+ 35b:	38 c3                	cmp    %al,%bl
+ 35d:	74 e9                	je     348 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 35f:	29 d8                	sub    %ebx,%eax
+}
+ 361:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 364:	c9                   	leave
+ 365:	c3                   	ret
+ 366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 370:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 374:	31 c0                	xor    %eax,%eax
+ 376:	29 d8                	sub    %ebx,%eax
+}
+ 378:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 37b:	c9                   	leave
+ 37c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 37d:	0f b6 19             	movzbl (%ecx),%ebx
+ 380:	31 c0                	xor    %eax,%eax
+ 382:	eb db                	jmp    35f <strcmp+0x2f>
+ 384:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 38f:	90                   	nop
+
+00000390 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 396:	80 3a 00             	cmpb   $0x0,(%edx)
+ 399:	74 15                	je     3b0 <strlen+0x20>
+ 39b:	31 c0                	xor    %eax,%eax
+ 39d:	8d 76 00             	lea    0x0(%esi),%esi
+ 3a0:	83 c0 01             	add    $0x1,%eax
+ 3a3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 3a7:	89 c1                	mov    %eax,%ecx
+ 3a9:	75 f5                	jne    3a0 <strlen+0x10>
+    ;
+  return n;
+}
+ 3ab:	89 c8                	mov    %ecx,%eax
+ 3ad:	5d                   	pop    %ebp
+ 3ae:	c3                   	ret
+ 3af:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 3b0:	31 c9                	xor    %ecx,%ecx
+}
+ 3b2:	5d                   	pop    %ebp
+ 3b3:	89 c8                	mov    %ecx,%eax
+ 3b5:	c3                   	ret
+ 3b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003c0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	57                   	push   %edi
+ 3c4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 3c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3cd:	89 d7                	mov    %edx,%edi
+ 3cf:	fc                   	cld
+ 3d0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 3d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 3d5:	89 d0                	mov    %edx,%eax
+ 3d7:	c9                   	leave
+ 3d8:	c3                   	ret
+ 3d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3ea:	0f b6 10             	movzbl (%eax),%edx
+ 3ed:	84 d2                	test   %dl,%dl
+ 3ef:	75 12                	jne    403 <strchr+0x23>
+ 3f1:	eb 1d                	jmp    410 <strchr+0x30>
+ 3f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3f7:	90                   	nop
+ 3f8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 3fc:	83 c0 01             	add    $0x1,%eax
+ 3ff:	84 d2                	test   %dl,%dl
+ 401:	74 0d                	je     410 <strchr+0x30>
+    if(*s == c)
+ 403:	38 d1                	cmp    %dl,%cl
+ 405:	75 f1                	jne    3f8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 407:	5d                   	pop    %ebp
+ 408:	c3                   	ret
+ 409:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 410:	31 c0                	xor    %eax,%eax
+}
+ 412:	5d                   	pop    %ebp
+ 413:	c3                   	ret
+ 414:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 41f:	90                   	nop
+
+00000420 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	57                   	push   %edi
+ 424:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 425:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 428:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 429:	31 db                	xor    %ebx,%ebx
+{
+ 42b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 42e:	eb 27                	jmp    457 <gets+0x37>
+    cc = read(0, &c, 1);
+ 430:	83 ec 04             	sub    $0x4,%esp
+ 433:	6a 01                	push   $0x1
+ 435:	56                   	push   %esi
+ 436:	6a 00                	push   $0x0
+ 438:	e8 5e 01 00 00       	call   59b <read>
+    if(cc < 1)
+ 43d:	83 c4 10             	add    $0x10,%esp
+ 440:	85 c0                	test   %eax,%eax
+ 442:	7e 1d                	jle    461 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 444:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 448:	8b 55 08             	mov    0x8(%ebp),%edx
+ 44b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 44f:	3c 0a                	cmp    $0xa,%al
+ 451:	74 10                	je     463 <gets+0x43>
+ 453:	3c 0d                	cmp    $0xd,%al
+ 455:	74 0c                	je     463 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 457:	89 df                	mov    %ebx,%edi
+ 459:	83 c3 01             	add    $0x1,%ebx
+ 45c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 45f:	7c cf                	jl     430 <gets+0x10>
+ 461:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 463:	8b 45 08             	mov    0x8(%ebp),%eax
+ 466:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 46a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 46d:	5b                   	pop    %ebx
+ 46e:	5e                   	pop    %esi
+ 46f:	5f                   	pop    %edi
+ 470:	5d                   	pop    %ebp
+ 471:	c3                   	ret
+ 472:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	56                   	push   %esi
+ 484:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 485:	83 ec 08             	sub    $0x8,%esp
+ 488:	6a 00                	push   $0x0
+ 48a:	ff 75 08             	push   0x8(%ebp)
+ 48d:	e8 31 01 00 00       	call   5c3 <open>
+  if(fd < 0)
+ 492:	83 c4 10             	add    $0x10,%esp
+ 495:	85 c0                	test   %eax,%eax
+ 497:	78 27                	js     4c0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 499:	83 ec 08             	sub    $0x8,%esp
+ 49c:	ff 75 0c             	push   0xc(%ebp)
+ 49f:	89 c3                	mov    %eax,%ebx
+ 4a1:	50                   	push   %eax
+ 4a2:	e8 34 01 00 00       	call   5db <fstat>
+  close(fd);
+ 4a7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 4aa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 4ac:	e8 fa 00 00 00       	call   5ab <close>
+  return r;
+ 4b1:	83 c4 10             	add    $0x10,%esp
+}
+ 4b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4b7:	89 f0                	mov    %esi,%eax
+ 4b9:	5b                   	pop    %ebx
+ 4ba:	5e                   	pop    %esi
+ 4bb:	5d                   	pop    %ebp
+ 4bc:	c3                   	ret
+ 4bd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 4c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 4c5:	eb ed                	jmp    4b4 <stat+0x34>
+ 4c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ce:	66 90                	xchg   %ax,%ax
+
+000004d0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	53                   	push   %ebx
+ 4d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 4d7:	0f be 02             	movsbl (%edx),%eax
+ 4da:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 4dd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 4e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 4e5:	77 1e                	ja     505 <atoi+0x35>
+ 4e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ee:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 4f0:	83 c2 01             	add    $0x1,%edx
+ 4f3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 4f6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 4fa:	0f be 02             	movsbl (%edx),%eax
+ 4fd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 500:	80 fb 09             	cmp    $0x9,%bl
+ 503:	76 eb                	jbe    4f0 <atoi+0x20>
+  return n;
+}
+ 505:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 508:	89 c8                	mov    %ecx,%eax
+ 50a:	c9                   	leave
+ 50b:	c3                   	ret
+ 50c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000510 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	57                   	push   %edi
+ 514:	56                   	push   %esi
+ 515:	8b 45 10             	mov    0x10(%ebp),%eax
+ 518:	8b 55 08             	mov    0x8(%ebp),%edx
+ 51b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 51e:	85 c0                	test   %eax,%eax
+ 520:	7e 13                	jle    535 <memmove+0x25>
+ 522:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 524:	89 d7                	mov    %edx,%edi
+ 526:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 530:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 531:	39 f8                	cmp    %edi,%eax
+ 533:	75 fb                	jne    530 <memmove+0x20>
+  return vdst;
+}
+ 535:	5e                   	pop    %esi
+ 536:	89 d0                	mov    %edx,%eax
+ 538:	5f                   	pop    %edi
+ 539:	5d                   	pop    %ebp
+ 53a:	c3                   	ret
+
+0000053b <ccreate>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(ccreate)
+ 53b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <cfork>:
+SYSCALL(cfork)
+ 543:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <cgetrootdir>:
+SYSCALL(cgetrootdir)
+ 54b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <getcontrootdir>:
+SYSCALL(getcontrootdir)
+ 553:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <cpause>:
+SYSCALL(cpause)
+ 55b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <cresume>:
+SYSCALL(cresume)
+ 563:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <cstart>:
+SYSCALL(cstart)
+ 56b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <cstop>:
+SYSCALL(cstop)
+ 573:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <fork>:
+SYSCALL(fork)
+ 57b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <exit>:
+SYSCALL(exit)
+ 583:	b8 02 00 00 00       	mov    $0x2,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <wait>:
+SYSCALL(wait)
+ 58b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <pipe>:
+SYSCALL(pipe)
+ 593:	b8 04 00 00 00       	mov    $0x4,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <read>:
+SYSCALL(read)
+ 59b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <write>:
+SYSCALL(write)
+ 5a3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <close>:
+SYSCALL(close)
+ 5ab:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <kill>:
+SYSCALL(kill)
+ 5b3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <exec>:
+SYSCALL(exec)
+ 5bb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <open>:
+SYSCALL(open)
+ 5c3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <mknod>:
+SYSCALL(mknod)
+ 5cb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <unlink>:
+SYSCALL(unlink)
+ 5d3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <fstat>:
+SYSCALL(fstat)
+ 5db:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <link>:
+SYSCALL(link)
+ 5e3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <mkdir>:
+SYSCALL(mkdir)
+ 5eb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <chdir>:
+SYSCALL(chdir)
+ 5f3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <dup>:
+SYSCALL(dup)
+ 5fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <getpid>:
+SYSCALL(getpid)
+ 603:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <sbrk>:
+SYSCALL(sbrk)
+ 60b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <sleep>:
+SYSCALL(sleep)
+ 613:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <uptime>:
+SYSCALL(uptime)
+ 61b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <cps>:
+SYSCALL(cps)
+ 623:	b8 16 00 00 00       	mov    $0x16,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <mmap>:
+SYSCALL(mmap)
+ 62b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <munmap>:
+SYSCALL(munmap)
+ 633:	b8 20 00 00 00       	mov    $0x20,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <shmget>:
+SYSCALL(shmget)
+ 63b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <climit>:
+SYSCALL(climit)
+ 643:	b8 22 00 00 00       	mov    $0x22,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <spawn>:
+SYSCALL(spawn)
+ 64b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <clone>:
+SYSCALL(clone)
+ 653:	b8 24 00 00 00       	mov    $0x24,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <join>:
+SYSCALL(join)
+ 65b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <futex>:
+SYSCALL(futex)
+ 663:	b8 26 00 00 00       	mov    $0x26,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <ccheckpoint>:
+SYSCALL(ccheckpoint)
+ 66b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <crestore>:
+SYSCALL(crestore)
+ 673:	b8 28 00 00 00       	mov    $0x28,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <czygote>:
+SYSCALL(czygote)
+ 67b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <memstats>:
+SYSCALL(memstats)
+ 683:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+ 68b:	66 90                	xchg   %ax,%ax
+ 68d:	66 90                	xchg   %ax,%ax
+ 68f:	90                   	nop
+
+00000690 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 690:	55                   	push   %ebp
+ 691:	89 e5                	mov    %esp,%ebp
+ 693:	57                   	push   %edi
+ 694:	56                   	push   %esi
+ 695:	53                   	push   %ebx
+ 696:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 698:	89 d1                	mov    %edx,%ecx
+{
+ 69a:	83 ec 3c             	sub    $0x3c,%esp
+ 69d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 6a0:	85 d2                	test   %edx,%edx
+ 6a2:	0f 89 80 00 00 00    	jns    728 <printint+0x98>
+ 6a8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 6ac:	74 7a                	je     728 <printint+0x98>
+    x = -xx;
+ 6ae:	f7 d9                	neg    %ecx
+    neg = 1;
+ 6b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 6b5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 6b8:	31 f6                	xor    %esi,%esi
+ 6ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 6c0:	89 c8                	mov    %ecx,%eax
+ 6c2:	31 d2                	xor    %edx,%edx
+ 6c4:	89 f7                	mov    %esi,%edi
+ 6c6:	f7 f3                	div    %ebx
+ 6c8:	8d 76 01             	lea    0x1(%esi),%esi
+ 6cb:	0f b6 92 04 0f 00 00 	movzbl 0xf04(%edx),%edx
+ 6d2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 6d6:	89 ca                	mov    %ecx,%edx
+ 6d8:	89 c1                	mov    %eax,%ecx
+ 6da:	39 da                	cmp    %ebx,%edx
+ 6dc:	73 e2                	jae    6c0 <printint+0x30>
+  if(neg)
+ 6de:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 6e1:	85 c0                	test   %eax,%eax
+ 6e3:	74 07                	je     6ec <printint+0x5c>
+    buf[i++] = '-';
+ 6e5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 6ea:	89 f7                	mov    %esi,%edi
+ 6ec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 6ef:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 6f2:	01 df                	add    %ebx,%edi
+ 6f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 6f8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 6fb:	83 ec 04             	sub    $0x4,%esp
+ 6fe:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 701:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 704:	6a 01                	push   $0x1
+ 706:	50                   	push   %eax
+ 707:	56                   	push   %esi
+ 708:	e8 96 fe ff ff       	call   5a3 <write>
+  while(--i >= 0)
+ 70d:	89 f8                	mov    %edi,%eax
+ 70f:	83 c4 10             	add    $0x10,%esp
+ 712:	83 ef 01             	sub    $0x1,%edi
+ 715:	39 d8                	cmp    %ebx,%eax
+ 717:	75 df                	jne    6f8 <printint+0x68>
+}
+ 719:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 71c:	5b                   	pop    %ebx
+ 71d:	5e                   	pop    %esi
+ 71e:	5f                   	pop    %edi
+ 71f:	5d                   	pop    %ebp
+ 720:	c3                   	ret
+ 721:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 728:	31 c0                	xor    %eax,%eax
+ 72a:	eb 89                	jmp    6b5 <printint+0x25>
+ 72c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000730 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 730:	55                   	push   %ebp
+ 731:	89 e5                	mov    %esp,%ebp
+ 733:	57                   	push   %edi
+ 734:	56                   	push   %esi
+ 735:	53                   	push   %ebx
+ 736:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 739:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 73c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 73f:	0f b6 1e             	movzbl (%esi),%ebx
+ 742:	83 c6 01             	add    $0x1,%esi
+ 745:	84 db                	test   %bl,%bl
+ 747:	74 67                	je     7b0 <printf+0x80>
+ 749:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 74c:	31 d2                	xor    %edx,%edx
+ 74e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 751:	eb 34                	jmp    787 <printf+0x57>
+ 753:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 757:	90                   	nop
+ 758:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 75b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 760:	83 f8 25             	cmp    $0x25,%eax
+ 763:	74 18                	je     77d <printf+0x4d>
+  write(fd, &c, 1);
+ 765:	83 ec 04             	sub    $0x4,%esp
+ 768:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 76b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 76e:	6a 01                	push   $0x1
+ 770:	50                   	push   %eax
+ 771:	57                   	push   %edi
+ 772:	e8 2c fe ff ff       	call   5a3 <write>
+ 777:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 77a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 77d:	0f b6 1e             	movzbl (%esi),%ebx
+ 780:	83 c6 01             	add    $0x1,%esi
+ 783:	84 db                	test   %bl,%bl
+ 785:	74 29                	je     7b0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 787:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 78a:	85 d2                	test   %edx,%edx
+ 78c:	74 ca                	je     758 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 78e:	83 fa 25             	cmp    $0x25,%edx
+ 791:	75 ea                	jne    77d <printf+0x4d>
+      if(c == 'd'){
+ 793:	83 f8 25             	cmp    $0x25,%eax
+ 796:	0f 84 24 01 00 00    	je     8c0 <printf+0x190>
+ 79c:	83 e8 63             	sub    $0x63,%eax
+ 79f:	83 f8 15             	cmp    $0x15,%eax
+ 7a2:	77 1c                	ja     7c0 <printf+0x90>
+ 7a4:	ff 24 85 ac 0e 00 00 	jmp    *0xeac(,%eax,4)
+ 7ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7af:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 7b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7b3:	5b                   	pop    %ebx
+ 7b4:	5e                   	pop    %esi
+ 7b5:	5f                   	pop    %edi
+ 7b6:	5d                   	pop    %ebp
+ 7b7:	c3                   	ret
+ 7b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7bf:	90                   	nop
+  write(fd, &c, 1);
+ 7c0:	83 ec 04             	sub    $0x4,%esp
+ 7c3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7c6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 7ca:	6a 01                	push   $0x1
+ 7cc:	52                   	push   %edx
+ 7cd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 7d0:	57                   	push   %edi
+ 7d1:	e8 cd fd ff ff       	call   5a3 <write>
+ 7d6:	83 c4 0c             	add    $0xc,%esp
+ 7d9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7dc:	6a 01                	push   $0x1
+ 7de:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 7e1:	52                   	push   %edx
+ 7e2:	57                   	push   %edi
+ 7e3:	e8 bb fd ff ff       	call   5a3 <write>
+        putc(fd, c);
+ 7e8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7eb:	31 d2                	xor    %edx,%edx
+ 7ed:	eb 8e                	jmp    77d <printf+0x4d>
+ 7ef:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 7f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7f3:	83 ec 0c             	sub    $0xc,%esp
+ 7f6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 7fb:	8b 13                	mov    (%ebx),%edx
+ 7fd:	6a 00                	push   $0x0
+ 7ff:	89 f8                	mov    %edi,%eax
+        ap++;
+ 801:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 804:	e8 87 fe ff ff       	call   690 <printint>
+        ap++;
+ 809:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 80c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 80f:	31 d2                	xor    %edx,%edx
+ 811:	e9 67 ff ff ff       	jmp    77d <printf+0x4d>
+ 816:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 81d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 820:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 823:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 825:	83 c0 04             	add    $0x4,%eax
+ 828:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 82b:	85 db                	test   %ebx,%ebx
+ 82d:	0f 84 9d 00 00 00    	je     8d0 <printf+0x1a0>
+        while(*s != 0){
+ 833:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 836:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 838:	84 c0                	test   %al,%al
+ 83a:	0f 84 3d ff ff ff    	je     77d <printf+0x4d>
+ 840:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 843:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 846:	89 de                	mov    %ebx,%esi
+ 848:	89 d3                	mov    %edx,%ebx
+ 84a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 850:	83 ec 04             	sub    $0x4,%esp
+ 853:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 856:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 859:	6a 01                	push   $0x1
+ 85b:	53                   	push   %ebx
+ 85c:	57                   	push   %edi
+ 85d:	e8 41 fd ff ff       	call   5a3 <write>
+        while(*s != 0){
+ 862:	0f b6 06             	movzbl (%esi),%eax
+ 865:	83 c4 10             	add    $0x10,%esp
+ 868:	84 c0                	test   %al,%al
+ 86a:	75 e4                	jne    850 <printf+0x120>
+      state = 0;
+ 86c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 86f:	31 d2                	xor    %edx,%edx
+ 871:	e9 07 ff ff ff       	jmp    77d <printf+0x4d>
+ 876:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 87d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 880:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 883:	83 ec 0c             	sub    $0xc,%esp
+ 886:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 88b:	8b 13                	mov    (%ebx),%edx
+ 88d:	6a 01                	push   $0x1
+ 88f:	e9 6b ff ff ff       	jmp    7ff <printf+0xcf>
+ 894:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 898:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 89b:	83 ec 04             	sub    $0x4,%esp
+ 89e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 8a1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 8a3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 8a6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 8a9:	6a 01                	push   $0x1
+ 8ab:	52                   	push   %edx
+ 8ac:	57                   	push   %edi
+ 8ad:	e8 f1 fc ff ff       	call   5a3 <write>
+        ap++;
+ 8b2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8b5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8b8:	31 d2                	xor    %edx,%edx
+ 8ba:	e9 be fe ff ff       	jmp    77d <printf+0x4d>
+ 8bf:	90                   	nop
+  write(fd, &c, 1);
+ 8c0:	83 ec 04             	sub    $0x4,%esp
+ 8c3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8c6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8c9:	6a 01                	push   $0x1
+ 8cb:	e9 11 ff ff ff       	jmp    7e1 <printf+0xb1>
+ 8d0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 8d5:	bb a5 0e 00 00       	mov    $0xea5,%ebx
+ 8da:	e9 61 ff ff ff       	jmp    840 <printf+0x110>
+ 8df:	90                   	nop
+
+000008e0 <runfree>:
+
+// Give the n pages at r back to the free runs, merging them with
+// adjacent runs, and shrink the heap if the end of it is free.
+static void
+runfree(struct page *r, uint n)
+{
+ 8e0:	55                   	push   %ebp
+  struct page **pp, *prev;
+
+  r->kind = PFREE;
+ 8e1:	b9 03 00 00 00       	mov    $0x3,%ecx
+{
+ 8e6:	89 e5                	mov    %esp,%ebp
+ 8e8:	57                   	push   %edi
+ 8e9:	56                   	push   %esi
+ 8ea:	53                   	push   %ebx
+ 8eb:	89 c3                	mov    %eax,%ebx
+ 8ed:	83 ec 0c             	sub    $0xc,%esp
+  r->kind = PFREE;
+ 8f0:	66 89 08             	mov    %cx,(%eax)
+  r->npages = n;
+  prev = 0;
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 8f3:	8b 0d c4 22 00 00    	mov    0x22c4,%ecx
+  r->npages = n;
+ 8f9:	89 50 04             	mov    %edx,0x4(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 8fc:	85 c9                	test   %ecx,%ecx
+ 8fe:	0f 84 1f 01 00 00    	je     a23 <runfree+0x143>
+ 904:	39 c1                	cmp    %eax,%ecx
+ 906:	0f 83 f7 00 00 00    	jae    a03 <runfree+0x123>
+ 90c:	89 c8                	mov    %ecx,%eax
+ 90e:	eb 04                	jmp    914 <runfree+0x34>
+ 910:	39 d8                	cmp    %ebx,%eax
+ 912:	73 09                	jae    91d <runfree+0x3d>
+ 914:	89 c2                	mov    %eax,%edx
+ 916:	8b 40 14             	mov    0x14(%eax),%eax
+ 919:	85 c0                	test   %eax,%eax
+ 91b:	75 f3                	jne    910 <runfree+0x30>
+    prev = *pp;
+  r->next = *pp;
+ 91d:	89 43 14             	mov    %eax,0x14(%ebx)
+  *pp = r;
+ 920:	89 5a 14             	mov    %ebx,0x14(%edx)
+
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 923:	8b 43 14             	mov    0x14(%ebx),%eax
+ 926:	85 c0                	test   %eax,%eax
+ 928:	74 12                	je     93c <runfree+0x5c>
+ 92a:	8b 7b 04             	mov    0x4(%ebx),%edi
+ 92d:	89 fe                	mov    %edi,%esi
+ 92f:	c1 e6 0c             	shl    $0xc,%esi
+ 932:	01 de                	add    %ebx,%esi
+ 934:	39 f0                	cmp    %esi,%eax
+ 936:	0f 84 a4 00 00 00    	je     9e0 <runfree+0x100>
+    r->npages += r->next->npages;
+    r->next = r->next->next;
+  }
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 93c:	8b 72 04             	mov    0x4(%edx),%esi
+ 93f:	89 f0                	mov    %esi,%eax
+ 941:	c1 e0 0c             	shl    $0xc,%eax
+ 944:	01 d0                	add    %edx,%eax
+ 946:	39 c3                	cmp    %eax,%ebx
+ 948:	74 16                	je     960 <runfree+0x80>
+    pp = &runs;
+    while(*pp != r)
+      pp = &(*pp)->next;
+  }
+
+  if(r->next == 0 && r->npages >= TRIM &&
+ 94a:	8b 43 14             	mov    0x14(%ebx),%eax
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 94d:	8d 72 14             	lea    0x14(%edx),%esi
+  if(r->next == 0 && r->npages >= TRIM &&
+ 950:	85 c0                	test   %eax,%eax
+ 952:	74 3c                	je     990 <runfree+0xb0>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+    *pp = 0;
+    sbrk(-(int)(r->npages*PGSIZE));
+    heapend = (char*)r;
+  }
+}
+ 954:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 957:	5b                   	pop    %ebx
+ 958:	5e                   	pop    %esi
+ 959:	5f                   	pop    %edi
+ 95a:	5d                   	pop    %ebp
+ 95b:	c3                   	ret
+ 95c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    prev->npages += r->npages;
+ 960:	03 73 04             	add    0x4(%ebx),%esi
+ 963:	89 72 04             	mov    %esi,0x4(%edx)
+    prev->next = r->next;
+ 966:	8b 43 14             	mov    0x14(%ebx),%eax
+ 969:	89 42 14             	mov    %eax,0x14(%edx)
+    while(*pp != r)
+ 96c:	39 d1                	cmp    %edx,%ecx
+ 96e:	0f 84 c5 00 00 00    	je     a39 <runfree+0x159>
+ 974:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      pp = &(*pp)->next;
+ 978:	89 cb                	mov    %ecx,%ebx
+ 97a:	8b 49 14             	mov    0x14(%ecx),%ecx
+    while(*pp != r)
+ 97d:	39 d1                	cmp    %edx,%ecx
+ 97f:	75 f7                	jne    978 <runfree+0x98>
+      pp = &(*pp)->next;
+ 981:	8d 73 14             	lea    0x14(%ebx),%esi
+ 984:	89 cb                	mov    %ecx,%ebx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 986:	85 c0                	test   %eax,%eax
+ 988:	75 ca                	jne    954 <runfree+0x74>
+ 98a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 990:	8b 53 04             	mov    0x4(%ebx),%edx
+ 993:	83 fa 1f             	cmp    $0x1f,%edx
+ 996:	76 bc                	jbe    954 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 998:	c1 e2 0c             	shl    $0xc,%edx
+ 99b:	01 da                	add    %ebx,%edx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 99d:	39 15 c0 22 00 00    	cmp    %edx,0x22c0
+ 9a3:	75 af                	jne    954 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 9a5:	83 ec 0c             	sub    $0xc,%esp
+ 9a8:	6a 00                	push   $0x0
+ 9aa:	e8 5c fc ff ff       	call   60b <sbrk>
+ 9af:	83 c4 10             	add    $0x10,%esp
+ 9b2:	39 05 c0 22 00 00    	cmp    %eax,0x22c0
+ 9b8:	75 9a                	jne    954 <runfree+0x74>
+    *pp = 0;
+ 9ba:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    sbrk(-(int)(r->npages*PGSIZE));
+ 9c0:	8b 43 04             	mov    0x4(%ebx),%eax
+ 9c3:	83 ec 0c             	sub    $0xc,%esp
+ 9c6:	c1 e0 0c             	shl    $0xc,%eax
+ 9c9:	f7 d8                	neg    %eax
+ 9cb:	50                   	push   %eax
+ 9cc:	e8 3a fc ff ff       	call   60b <sbrk>
+    heapend = (char*)r;
+ 9d1:	89 1d c0 22 00 00    	mov    %ebx,0x22c0
+ 9d7:	83 c4 10             	add    $0x10,%esp
+}
+ 9da:	e9 75 ff ff ff       	jmp    954 <runfree+0x74>
+ 9df:	90                   	nop
+    r->npages += r->next->npages;
+ 9e0:	03 78 04             	add    0x4(%eax),%edi
+ 9e3:	89 7b 04             	mov    %edi,0x4(%ebx)
+    r->next = r->next->next;
+ 9e6:	8b 40 14             	mov    0x14(%eax),%eax
+ 9e9:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 9ec:	8b 72 04             	mov    0x4(%edx),%esi
+ 9ef:	89 f0                	mov    %esi,%eax
+ 9f1:	c1 e0 0c             	shl    $0xc,%eax
+ 9f4:	01 d0                	add    %edx,%eax
+ 9f6:	39 c3                	cmp    %eax,%ebx
+ 9f8:	0f 85 4c ff ff ff    	jne    94a <runfree+0x6a>
+ 9fe:	e9 5d ff ff ff       	jmp    960 <runfree+0x80>
+  r->next = *pp;
+ a03:	89 48 14             	mov    %ecx,0x14(%eax)
+  *pp = r;
+ a06:	a3 c4 22 00 00       	mov    %eax,0x22c4
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ a0b:	89 d0                	mov    %edx,%eax
+ a0d:	c1 e0 0c             	shl    $0xc,%eax
+ a10:	01 d8                	add    %ebx,%eax
+ a12:	39 c1                	cmp    %eax,%ecx
+ a14:	74 2f                	je     a45 <runfree+0x165>
+  if(r->next == 0 && r->npages >= TRIM &&
+ a16:	8b 43 14             	mov    0x14(%ebx),%eax
+ a19:	be c4 22 00 00       	mov    $0x22c4,%esi
+ a1e:	e9 2d ff ff ff       	jmp    950 <runfree+0x70>
+  r->next = *pp;
+ a23:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ a2a:	be c4 22 00 00       	mov    $0x22c4,%esi
+  *pp = r;
+ a2f:	a3 c4 22 00 00       	mov    %eax,0x22c4
+  if(r->next == 0 && r->npages >= TRIM &&
+ a34:	e9 5a ff ff ff       	jmp    993 <runfree+0xb3>
+    while(*pp != r)
+ a39:	89 cb                	mov    %ecx,%ebx
+    pp = &runs;
+ a3b:	be c4 22 00 00       	mov    $0x22c4,%esi
+ a40:	e9 0b ff ff ff       	jmp    950 <runfree+0x70>
+    r->npages += r->next->npages;
+ a45:	03 51 04             	add    0x4(%ecx),%edx
+ a48:	89 53 04             	mov    %edx,0x4(%ebx)
+    r->next = r->next->next;
+ a4b:	8b 41 14             	mov    0x14(%ecx),%eax
+ a4e:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ a51:	eb c3                	jmp    a16 <runfree+0x136>
+ a53:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a60 <runalloc>:
+
+// Take a run of n pages from the start of the first free run
+// long enough, which keeps the end of the heap free to trim.
+static struct page*
+runalloc(uint n)
+{
+ a60:	55                   	push   %ebp
+ a61:	89 e5                	mov    %esp,%ebp
+ a63:	57                   	push   %edi
+ a64:	56                   	push   %esi
+ a65:	89 c6                	mov    %eax,%esi
+ a67:	53                   	push   %ebx
+ a68:	83 ec 1c             	sub    $0x1c,%esp
+  struct page **pp, *r, *rest;
+
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ a6b:	8b 1d c4 22 00 00    	mov    0x22c4,%ebx
+ a71:	85 db                	test   %ebx,%ebx
+ a73:	74 4d                	je     ac2 <runalloc+0x62>
+ a75:	b9 c4 22 00 00       	mov    $0x22c4,%ecx
+    if(r->npages < n)
+ a7a:	39 73 04             	cmp    %esi,0x4(%ebx)
+ a7d:	72 39                	jb     ab8 <runalloc+0x58>
+      continue;
+    if(r->npages == n){
+ a7f:	0f 84 9b 00 00 00    	je     b20 <runalloc+0xc0>
+      *pp = r->next;
+    } else {
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ a85:	89 f0                	mov    %esi,%eax
+      rest->kind = PFREE;
+ a87:	ba 03 00 00 00       	mov    $0x3,%edx
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ a8c:	c1 e0 0c             	shl    $0xc,%eax
+ a8f:	01 d8                	add    %ebx,%eax
+      rest->kind = PFREE;
+ a91:	66 89 10             	mov    %dx,(%eax)
+      rest->npages = r->npages - n;
+ a94:	8b 53 04             	mov    0x4(%ebx),%edx
+ a97:	29 f2                	sub    %esi,%edx
+ a99:	89 50 04             	mov    %edx,0x4(%eax)
+      rest->next = r->next;
+ a9c:	8b 53 14             	mov    0x14(%ebx),%edx
+ a9f:	89 50 14             	mov    %edx,0x14(%eax)
+      *pp = rest;
+ aa2:	89 01                	mov    %eax,(%ecx)
+      r->npages = n;
+ aa4:	89 73 04             	mov    %esi,0x4(%ebx)
+    }
+    return r;
+  }
+  return morecore(n);
+}
+ aa7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ aaa:	89 d8                	mov    %ebx,%eax
+ aac:	5b                   	pop    %ebx
+ aad:	5e                   	pop    %esi
+ aae:	5f                   	pop    %edi
+ aaf:	5d                   	pop    %ebp
+ ab0:	c3                   	ret
+ ab1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ ab8:	8d 4b 14             	lea    0x14(%ebx),%ecx
+ abb:	8b 5b 14             	mov    0x14(%ebx),%ebx
+ abe:	85 db                	test   %ebx,%ebx
+ ac0:	75 b8                	jne    a7a <runalloc+0x1a>
+  m = n < MINCORE ? MINCORE : n;
+ ac2:	bf 08 00 00 00       	mov    $0x8,%edi
+ ac7:	39 fe                	cmp    %edi,%esi
+ ac9:	0f 43 fe             	cmovae %esi,%edi
+  brk = sbrk(0);
+ acc:	83 ec 0c             	sub    $0xc,%esp
+ acf:	6a 00                	push   $0x0
+ ad1:	e8 35 fb ff ff       	call   60b <sbrk>
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ ad6:	89 fa                	mov    %edi,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ ad8:	89 c3                	mov    %eax,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ ada:	c1 e2 0c             	shl    $0xc,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ add:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ ae0:	f7 db                	neg    %ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ ae2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ ae5:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ aeb:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+ aee:	89 04 24             	mov    %eax,(%esp)
+ af1:	e8 15 fb ff ff       	call   60b <sbrk>
+ af6:	83 c4 10             	add    $0x10,%esp
+ af9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ afc:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ aff:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b02:	74 3e                	je     b42 <runalloc+0xe2>
+  r = (struct page*)(brk + pad);
+ b04:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ b06:	01 da                	add    %ebx,%edx
+ b08:	89 15 c0 22 00 00    	mov    %edx,0x22c0
+  if(m > n)
+ b0e:	39 fe                	cmp    %edi,%esi
+ b10:	72 1e                	jb     b30 <runalloc+0xd0>
+  r->npages = n;
+ b12:	89 73 04             	mov    %esi,0x4(%ebx)
+  return r;
+ b15:	eb 90                	jmp    aa7 <runalloc+0x47>
+ b17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b1e:	66 90                	xchg   %ax,%ax
+      *pp = r->next;
+ b20:	8b 43 14             	mov    0x14(%ebx),%eax
+ b23:	89 01                	mov    %eax,(%ecx)
+}
+ b25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b28:	89 d8                	mov    %ebx,%eax
+ b2a:	5b                   	pop    %ebx
+ b2b:	5e                   	pop    %esi
+ b2c:	5f                   	pop    %edi
+ b2d:	5d                   	pop    %ebp
+ b2e:	c3                   	ret
+ b2f:	90                   	nop
+    runfree((struct page*)((char*)r + n*PGSIZE), m - n);
+ b30:	89 f0                	mov    %esi,%eax
+ b32:	29 f7                	sub    %esi,%edi
+ b34:	c1 e0 0c             	shl    $0xc,%eax
+ b37:	89 fa                	mov    %edi,%edx
+ b39:	01 d8                	add    %ebx,%eax
+ b3b:	e8 a0 fd ff ff       	call   8e0 <runfree>
+ b40:	eb d0                	jmp    b12 <runalloc+0xb2>
+    if(sbrk(pad + m*PGSIZE) == (char*)-1)
+ b42:	89 f7                	mov    %esi,%edi
+ b44:	83 ec 0c             	sub    $0xc,%esp
+ b47:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ b4a:	c1 e7 0c             	shl    $0xc,%edi
+ b4d:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+ b50:	50                   	push   %eax
+ b51:	e8 b5 fa ff ff       	call   60b <sbrk>
+ b56:	83 c4 10             	add    $0x10,%esp
+ b59:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ b5c:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b5f:	74 0c                	je     b6d <runalloc+0x10d>
+  r = (struct page*)(brk + pad);
+ b61:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ b63:	01 df                	add    %ebx,%edi
+ b65:	89 3d c0 22 00 00    	mov    %edi,0x22c0
+  if(m > n)
+ b6b:	eb a5                	jmp    b12 <runalloc+0xb2>
+      return 0;
+ b6d:	31 db                	xor    %ebx,%ebx
+ b6f:	e9 33 ff ff ff       	jmp    aa7 <runalloc+0x47>
+ b74:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b7f:	90                   	nop
+
+00000b80 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+ b80:	55                   	push   %ebp
+ b81:	89 e5                	mov    %esp,%ebp
+ b83:	56                   	push   %esi
+ b84:	53                   	push   %ebx
+ b85:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  struct page *p;
+
+  if(ap == 0)
+ b88:	85 c9                	test   %ecx,%ecx
+ b8a:	74 1c                	je     ba8 <free+0x28>
+    return;
+  p = (struct page*)((uint)ap & ~(PGSIZE-1));
+ b8c:	89 c8                	mov    %ecx,%eax
+ b8e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  switch(p->kind){
+ b93:	0f b7 10             	movzwl (%eax),%edx
+ b96:	66 83 fa 02          	cmp    $0x2,%dx
+ b9a:	74 14                	je     bb0 <free+0x30>
+ b9c:	66 83 fa 04          	cmp    $0x4,%dx
+ ba0:	74 66                	je     c08 <free+0x88>
+ ba2:	66 83 fa 01          	cmp    $0x1,%dx
+ ba6:	74 18                	je     bc0 <free+0x40>
+    break;
+  case PMAP:
+    munmap(p, p->npages*PGSIZE);
+    break;
+  }
+}
+ ba8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ bab:	5b                   	pop    %ebx
+ bac:	5e                   	pop    %esi
+ bad:	5d                   	pop    %ebp
+ bae:	c3                   	ret
+ baf:	90                   	nop
+    runfree(p, p->npages);
+ bb0:	8b 50 04             	mov    0x4(%eax),%edx
+}
+ bb3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ bb6:	5b                   	pop    %ebx
+ bb7:	5e                   	pop    %esi
+ bb8:	5d                   	pop    %ebp
+    runfree(p, p->npages);
+ bb9:	e9 22 fd ff ff       	jmp    8e0 <runfree>
+ bbe:	66 90                	xchg   %ax,%ax
+  b->next = p->free;
+ bc0:	8b 50 0c             	mov    0xc(%eax),%edx
+ bc3:	89 11                	mov    %edx,(%ecx)
+  if(p->nfree++ == 0)
+ bc5:	8b 50 08             	mov    0x8(%eax),%edx
+  p->free = b;
+ bc8:	89 48 0c             	mov    %ecx,0xc(%eax)
+  if(p->nfree++ == 0)
+ bcb:	8d 5a 01             	lea    0x1(%edx),%ebx
+ bce:	89 58 08             	mov    %ebx,0x8(%eax)
+ bd1:	85 d2                	test   %edx,%edx
+ bd3:	74 53                	je     c28 <free+0xa8>
+  if(p->nfree == nblocks(p->class)){
+ bd5:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ bd9:	8d 4e 04             	lea    0x4(%esi),%ecx
+ bdc:	ba e0 0f 00 00       	mov    $0xfe0,%edx
+ be1:	d3 fa                	sar    %cl,%edx
+  if(p->nfree == nblocks(p->class)){
+ be3:	39 da                	cmp    %ebx,%edx
+ be5:	75 c1                	jne    ba8 <free+0x28>
+  if(p->prev)
+ be7:	8b 48 18             	mov    0x18(%eax),%ecx
+    p->prev->next = p->next;
+ bea:	8b 50 14             	mov    0x14(%eax),%edx
+  if(p->prev)
+ bed:	85 c9                	test   %ecx,%ecx
+ bef:	74 6f                	je     c60 <free+0xe0>
+    p->prev->next = p->next;
+ bf1:	89 51 14             	mov    %edx,0x14(%ecx)
+  if(p->next)
+ bf4:	85 d2                	test   %edx,%edx
+ bf6:	74 06                	je     bfe <free+0x7e>
+    p->next->prev = p->prev;
+ bf8:	8b 48 18             	mov    0x18(%eax),%ecx
+ bfb:	89 4a 18             	mov    %ecx,0x18(%edx)
+    runfree(p, 1);
+ bfe:	ba 01 00 00 00       	mov    $0x1,%edx
+ c03:	eb ae                	jmp    bb3 <free+0x33>
+ c05:	8d 76 00             	lea    0x0(%esi),%esi
+    munmap(p, p->npages*PGSIZE);
+ c08:	8b 50 04             	mov    0x4(%eax),%edx
+ c0b:	83 ec 08             	sub    $0x8,%esp
+ c0e:	c1 e2 0c             	shl    $0xc,%edx
+ c11:	52                   	push   %edx
+ c12:	50                   	push   %eax
+ c13:	e8 1b fa ff ff       	call   633 <munmap>
+    break;
+ c18:	83 c4 10             	add    $0x10,%esp
+}
+ c1b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ c1e:	5b                   	pop    %ebx
+ c1f:	5e                   	pop    %esi
+ c20:	5d                   	pop    %ebp
+ c21:	c3                   	ret
+ c22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  p->next = partial[p->class];
+ c28:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  p->prev = 0;
+ c2c:	c7 40 18 00 00 00 00 	movl   $0x0,0x18(%eax)
+  p->next = partial[p->class];
+ c33:	bb 01 00 00 00       	mov    $0x1,%ebx
+ c38:	8b 14 b5 c8 22 00 00 	mov    0x22c8(,%esi,4),%edx
+ c3f:	89 50 14             	mov    %edx,0x14(%eax)
+  if(p->next)
+ c42:	85 d2                	test   %edx,%edx
+ c44:	74 0a                	je     c50 <free+0xd0>
+    p->next->prev = p;
+ c46:	89 42 18             	mov    %eax,0x18(%edx)
+  partial[p->class] = p;
+ c49:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  if(p->nfree == nblocks(p->class)){
+ c4d:	8b 58 08             	mov    0x8(%eax),%ebx
+  partial[p->class] = p;
+ c50:	89 04 b5 c8 22 00 00 	mov    %eax,0x22c8(,%esi,4)
+}
+ c57:	eb 80                	jmp    bd9 <free+0x59>
+ c59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ c60:	89 14 b5 c8 22 00 00 	mov    %edx,0x22c8(,%esi,4)
+ c67:	eb 8b                	jmp    bf4 <free+0x74>
+ c69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000c70 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ c70:	55                   	push   %ebp
+ c71:	89 e5                	mov    %esp,%ebp
+ c73:	56                   	push   %esi
+ c74:	53                   	push   %ebx
+ c75:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct page *p;
+  uint n;
+
+  if(nbytes <= MAXSMALL)
+ c78:	3d 00 04 00 00       	cmp    $0x400,%eax
+ c7d:	76 71                	jbe    cf0 <malloc+0x80>
+    return smallalloc(sizeclass(nbytes));
+  if(nbytes > 0x7fffffff)
+ c7f:	85 c0                	test   %eax,%eax
+ c81:	0f 88 d9 00 00 00    	js     d60 <malloc+0xf0>
+    return 0;
+  n = (nbytes + HDRSIZE + PGSIZE-1) / PGSIZE;
+ c87:	8d 90 1f 10 00 00    	lea    0x101f(%eax),%edx
+ c8d:	89 d3                	mov    %edx,%ebx
+ c8f:	c1 eb 0c             	shr    $0xc,%ebx
+  if(nbytes >= MAPMIN){
+ c92:	3d ff ff 00 00       	cmp    $0xffff,%eax
+ c97:	77 27                	ja     cc0 <malloc+0x50>
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    if(p == MAP_FAILED)
+      return 0;
+    p->kind = PMAP;
+  } else {
+    if((p = runalloc(n)) == 0)
+ c99:	89 d8                	mov    %ebx,%eax
+ c9b:	e8 c0 fd ff ff       	call   a60 <runalloc>
+ ca0:	85 c0                	test   %eax,%eax
+ ca2:	0f 84 b8 00 00 00    	je     d60 <malloc+0xf0>
+      return 0;
+    p->kind = PRUN;
+ ca8:	ba 02 00 00 00       	mov    $0x2,%edx
+ cad:	66 89 10             	mov    %dx,(%eax)
+  }
+  p->npages = n;
+ cb0:	89 58 04             	mov    %ebx,0x4(%eax)
+  return (char*)p + HDRSIZE;
+ cb3:	8d 58 20             	lea    0x20(%eax),%ebx
+}
+ cb6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ cb9:	89 d8                	mov    %ebx,%eax
+ cbb:	5b                   	pop    %ebx
+ cbc:	5e                   	pop    %esi
+ cbd:	5d                   	pop    %ebp
+ cbe:	c3                   	ret
+ cbf:	90                   	nop
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+ cc0:	83 ec 08             	sub    $0x8,%esp
+ cc3:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+ cc9:	6a 00                	push   $0x0
+ ccb:	6a ff                	push   $0xffffffff
+ ccd:	6a 22                	push   $0x22
+ ccf:	6a 03                	push   $0x3
+ cd1:	52                   	push   %edx
+ cd2:	6a 00                	push   $0x0
+ cd4:	e8 52 f9 ff ff       	call   62b <mmap>
+    if(p == MAP_FAILED)
+ cd9:	83 c4 20             	add    $0x20,%esp
+ cdc:	83 f8 ff             	cmp    $0xffffffff,%eax
+ cdf:	74 7f                	je     d60 <malloc+0xf0>
+    p->kind = PMAP;
+ ce1:	b9 04 00 00 00       	mov    $0x4,%ecx
+ ce6:	66 89 08             	mov    %cx,(%eax)
+ ce9:	eb c5                	jmp    cb0 <malloc+0x40>
+ ceb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ cef:	90                   	nop
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ cf0:	83 f8 10             	cmp    $0x10,%eax
+ cf3:	0f 86 07 01 00 00    	jbe    e00 <malloc+0x190>
+ cf9:	31 db                	xor    %ebx,%ebx
+ cfb:	ba 10 00 00 00       	mov    $0x10,%edx
+ d00:	83 c3 01             	add    $0x1,%ebx
+ d03:	89 d6                	mov    %edx,%esi
+ d05:	89 d9                	mov    %ebx,%ecx
+ d07:	d3 e6                	shl    %cl,%esi
+ d09:	39 c6                	cmp    %eax,%esi
+ d0b:	72 f3                	jb     d00 <malloc+0x90>
+  if((p = partial[c]) == 0){
+ d0d:	8b 14 9d c8 22 00 00 	mov    0x22c8(,%ebx,4),%edx
+ d14:	85 d2                	test   %edx,%edx
+ d16:	74 58                	je     d70 <malloc+0x100>
+  if((b = p->free) != 0){
+ d18:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ d1b:	8b 4a 08             	mov    0x8(%edx),%ecx
+  if((b = p->free) != 0){
+ d1e:	85 db                	test   %ebx,%ebx
+ d20:	0f 84 aa 00 00 00    	je     dd0 <malloc+0x160>
+    p->free = b->next;
+ d26:	8b 03                	mov    (%ebx),%eax
+ d28:	89 42 0c             	mov    %eax,0xc(%edx)
+  if(--p->nfree == 0)
+ d2b:	83 e9 01             	sub    $0x1,%ecx
+ d2e:	89 4a 08             	mov    %ecx,0x8(%edx)
+ d31:	75 83                	jne    cb6 <malloc+0x46>
+  if(p->prev)
+ d33:	8b 4a 18             	mov    0x18(%edx),%ecx
+    p->prev->next = p->next;
+ d36:	8b 42 14             	mov    0x14(%edx),%eax
+  if(p->prev)
+ d39:	85 c9                	test   %ecx,%ecx
+ d3b:	0f 84 cf 00 00 00    	je     e10 <malloc+0x1a0>
+    p->prev->next = p->next;
+ d41:	89 41 14             	mov    %eax,0x14(%ecx)
+  if(p->next)
+ d44:	85 c0                	test   %eax,%eax
+ d46:	0f 84 6a ff ff ff    	je     cb6 <malloc+0x46>
+    p->next->prev = p->prev;
+ d4c:	8b 52 18             	mov    0x18(%edx),%edx
+ d4f:	89 50 18             	mov    %edx,0x18(%eax)
+ d52:	e9 5f ff ff ff       	jmp    cb6 <malloc+0x46>
+ d57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d5e:	66 90                	xchg   %ax,%ax
+}
+ d60:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+ d63:	31 db                	xor    %ebx,%ebx
+}
+ d65:	89 d8                	mov    %ebx,%eax
+ d67:	5b                   	pop    %ebx
+ d68:	5e                   	pop    %esi
+ d69:	5d                   	pop    %ebp
+ d6a:	c3                   	ret
+ d6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d6f:	90                   	nop
+    if((p = runalloc(1)) == 0)
+ d70:	b8 01 00 00 00       	mov    $0x1,%eax
+ d75:	e8 e6 fc ff ff       	call   a60 <runalloc>
+ d7a:	89 c2                	mov    %eax,%edx
+ d7c:	85 c0                	test   %eax,%eax
+ d7e:	74 e0                	je     d60 <malloc+0xf0>
+    p->kind = PSMALL;
+ d80:	b8 01 00 00 00       	mov    $0x1,%eax
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ d85:	8d 4b 04             	lea    0x4(%ebx),%ecx
+    p->class = c;
+ d88:	66 89 5a 02          	mov    %bx,0x2(%edx)
+ d8c:	0f b7 db             	movzwl %bx,%ebx
+    p->kind = PSMALL;
+ d8f:	66 89 02             	mov    %ax,(%edx)
+    p->fresh = (char*)p + HDRSIZE;
+ d92:	8d 42 20             	lea    0x20(%edx),%eax
+ d95:	89 42 10             	mov    %eax,0x10(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ d98:	b8 e0 0f 00 00       	mov    $0xfe0,%eax
+ d9d:	d3 f8                	sar    %cl,%eax
+    p->free = 0;
+ d9f:	c7 42 0c 00 00 00 00 	movl   $0x0,0xc(%edx)
+    p->nfree = nblocks(c);
+ da6:	89 42 08             	mov    %eax,0x8(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ da9:	89 c1                	mov    %eax,%ecx
+  p->next = partial[p->class];
+ dab:	8b 04 9d c8 22 00 00 	mov    0x22c8(,%ebx,4),%eax
+  p->prev = 0;
+ db2:	c7 42 18 00 00 00 00 	movl   $0x0,0x18(%edx)
+  p->next = partial[p->class];
+ db9:	89 42 14             	mov    %eax,0x14(%edx)
+  if(p->next)
+ dbc:	85 c0                	test   %eax,%eax
+ dbe:	75 20                	jne    de0 <malloc+0x170>
+  partial[p->class] = p;
+ dc0:	89 14 9d c8 22 00 00 	mov    %edx,0x22c8(,%ebx,4)
+  if((b = p->free) != 0){
+ dc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dce:	66 90                	xchg   %ax,%ax
+    b = (struct block*)p->fresh;
+ dd0:	8b 5a 10             	mov    0x10(%edx),%ebx
+    p->fresh += MINSMALL << c;
+ dd3:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+ dd6:	89 42 10             	mov    %eax,0x10(%edx)
+ dd9:	e9 4d ff ff ff       	jmp    d2b <malloc+0xbb>
+ dde:	66 90                	xchg   %ax,%ax
+    p->next->prev = p;
+ de0:	89 50 18             	mov    %edx,0x18(%eax)
+  partial[p->class] = p;
+ de3:	0f b7 42 02          	movzwl 0x2(%edx),%eax
+  if((b = p->free) != 0){
+ de7:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ dea:	8b 4a 08             	mov    0x8(%edx),%ecx
+  partial[p->class] = p;
+ ded:	89 14 85 c8 22 00 00 	mov    %edx,0x22c8(,%eax,4)
+}
+ df4:	e9 25 ff ff ff       	jmp    d1e <malloc+0xae>
+ df9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ e00:	be 10 00 00 00       	mov    $0x10,%esi
+ e05:	31 db                	xor    %ebx,%ebx
+ e07:	e9 01 ff ff ff       	jmp    d0d <malloc+0x9d>
+ e0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ e10:	0f b7 4a 02          	movzwl 0x2(%edx),%ecx
+ e14:	89 04 8d c8 22 00 00 	mov    %eax,0x22c8(,%ecx,4)
+ e1b:	e9 24 ff ff ff       	jmp    d44 <malloc+0xd4>
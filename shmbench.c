@@ -0,0 +1,115 @@
+// Compare the throughput of a pipe and of a shared memory
+// segment by moving the same bytes from a child to its parent.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define TOTAL (4*1024*1024)   // bytes moved by each test
+#define CHUNK 4096
+#define NSLOT 8
+
+// A ring of chunks in shared memory. The child fills slot
+// head % NSLOT and advances head; the parent drains slot
+// tail % NSLOT and advances tail.
+struct ring {
+  volatile uint head;
+  volatile uint tail;
+  char slot[NSLOT][CHUNK];
+};
+
+char buf[CHUNK];
+
+uint
+sum(char *p, int n)
+{
+  uint s;
+  int i;
+
+  s = 0;
+  for(i = 0; i < n; i++)
+    s += p[i];
+  return s;
+}
+
+void
+report(char *what, int ticks)
+{
+  if(ticks == 0)
+    ticks = 1;
+  printf(1, "%s: %d KB in %d ticks, %d KB/tick\n",
+         what, TOTAL/1024, ticks, TOTAL/1024/ticks);
+}
+
+void
+pipetest(void)
+{
+  int fd[2], n, got, start;
+
+  if(pipe(fd) < 0){
+    printf(1, "shmbench: pipe failed\n");
+    exit();
+  }
+  start = uptime();
+  if(fork() == 0){
+    close(fd[0]);
+    memset(buf, 'p', sizeof(buf));
+    for(n = 0; n < TOTAL; n += CHUNK)
+      write(fd[1], buf, CHUNK);
+    exit();
+  }
+  close(fd[1]);
+  got = 0;
+  while((n = read(fd[0], buf, sizeof(buf))) > 0){
+    sum(buf, n);
+    got += n;
+  }
+  close(fd[0]);
+  wait();
+  if(got != TOTAL)
+    printf(1, "shmbench: pipe moved %d bytes\n", got);
+  report("pipe", uptime() - start);
+}
+
+void
+shmtest(void)
+{
+  struct ring *r;
+  int n, start;
+
+  r = shmget("shmbench", sizeof(*r));
+  if(r == (struct ring*)-1){
+    printf(1, "shmbench: shmget failed\n");
+    exit();
+  }
+  r->head = r->tail = 0;
+  start = uptime();
+  if(fork() == 0){
+    for(n = 0; n < TOTAL; n += CHUNK){
+      while(r->head - r->tail == NSLOT)
+        ;
+      memset(r->slot[r->head % NSLOT], 's', CHUNK);
+      __sync_synchronize();
+      r->head++;
+    }
+    exit();
+  }
+  for(n = 0; n < TOTAL; n += CHUNK){
+    while(r->head == r->tail)
+      ;
+    sum(r->slot[r->tail % NSLOT], CHUNK);
+    __sync_synchronize();
+    r->tail++;
+  }
+  wait();
+  report("shm", uptime() - start);
+  munmap(r, sizeof(*r));
+}
+
+int
+main(int argc, char *argv[])
+{
+  pipetest();
+  shmtest();
+  exit();
+}
@@ -0,0 +1,16 @@
+// File actions for spawn(), applied in order to the child's copy
+// of the caller's open files before the program starts.
+// Both the kernel and user programs use this header file.
+
+#define SPAWN_CLOSE 1   // close fd
+#define SPAWN_DUP   2   // make fd a duplicate of fd arg
+#define SPAWN_OPEN  3   // open path with mode arg as fd
+
+#define SPAWN_MAXACT 8  // most actions one spawn() takes
+
+struct spawnact {
+  int op;
+  int fd;
+  int arg;
+  char *path;   // SPAWN_OPEN only
+};
@@ -0,0 +1,1791 @@
+
+_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fs.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+  int fd, i;
+  char path[] = "stressfs0";
+   7:	b8 30 00 00 00       	mov    $0x30,%eax
+{
+   c:	ff 71 fc             	push   -0x4(%ecx)
+   f:	55                   	push   %ebp
+  10:	89 e5                	mov    %esp,%ebp
+  12:	57                   	push   %edi
+  13:	56                   	push   %esi
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+  memset(data, 'a', sizeof(data));
+  14:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+{
+  1a:	53                   	push   %ebx
+
+  for(i = 0; i < 4; i++)
+  1b:	31 db                	xor    %ebx,%ebx
+{
+  1d:	51                   	push   %ecx
+  1e:	81 ec 20 02 00 00    	sub    $0x220,%esp
+  char path[] = "stressfs0";
+  24:	66 89 85 e6 fd ff ff 	mov    %ax,-0x21a(%ebp)
+  2b:	c7 85 de fd ff ff 73 	movl   $0x65727473,-0x222(%ebp)
+  32:	74 72 65 
+  35:	c7 85 e2 fd ff ff 73 	movl   $0x73667373,-0x21e(%ebp)
+  3c:	73 66 73 
+  printf(1, "stressfs starting\n");
+  3f:	68 40 0c 00 00       	push   $0xc40
+  44:	6a 01                	push   $0x1
+  46:	e8 05 05 00 00       	call   550 <printf>
+  memset(data, 'a', sizeof(data));
+  4b:	83 c4 0c             	add    $0xc,%esp
+  4e:	68 00 02 00 00       	push   $0x200
+  53:	6a 61                	push   $0x61
+  55:	56                   	push   %esi
+  56:	e8 85 01 00 00       	call   1e0 <memset>
+  5b:	83 c4 10             	add    $0x10,%esp
+    if(fork() > 0)
+  5e:	e8 38 03 00 00       	call   39b <fork>
+  63:	85 c0                	test   %eax,%eax
+  65:	7f 08                	jg     6f <main+0x6f>
+  for(i = 0; i < 4; i++)
+  67:	83 c3 01             	add    $0x1,%ebx
+  6a:	83 fb 04             	cmp    $0x4,%ebx
+  6d:	75 ef                	jne    5e <main+0x5e>
+      break;
+
+  printf(1, "write %d\n", i);
+  6f:	83 ec 04             	sub    $0x4,%esp
+  72:	53                   	push   %ebx
+  73:	68 53 0c 00 00       	push   $0xc53
+  78:	6a 01                	push   $0x1
+  7a:	e8 d1 04 00 00       	call   550 <printf>
+
+  path[8] += i;
+  7f:	00 9d e6 fd ff ff    	add    %bl,-0x21a(%ebp)
+  fd = open(path, O_CREATE | O_RDWR);
+  85:	5f                   	pop    %edi
+  86:	bb 14 00 00 00       	mov    $0x14,%ebx
+  8b:	58                   	pop    %eax
+  8c:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  92:	68 02 02 00 00       	push   $0x202
+  97:	50                   	push   %eax
+  98:	e8 46 03 00 00       	call   3e3 <open>
+  9d:	83 c4 10             	add    $0x10,%esp
+  a0:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < 20; i++)
+  a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+  a8:	83 ec 04             	sub    $0x4,%esp
+  ab:	68 00 02 00 00       	push   $0x200
+  b0:	56                   	push   %esi
+  b1:	57                   	push   %edi
+  b2:	e8 0c 03 00 00       	call   3c3 <write>
+  for(i = 0; i < 20; i++)
+  b7:	83 c4 10             	add    $0x10,%esp
+  ba:	83 eb 01             	sub    $0x1,%ebx
+  bd:	75 e9                	jne    a8 <main+0xa8>
+  close(fd);
+  bf:	83 ec 0c             	sub    $0xc,%esp
+  c2:	57                   	push   %edi
+  c3:	e8 03 03 00 00       	call   3cb <close>
+
+  printf(1, "read\n");
+  c8:	58                   	pop    %eax
+  c9:	5a                   	pop    %edx
+  ca:	68 5d 0c 00 00       	push   $0xc5d
+  cf:	6a 01                	push   $0x1
+  d1:	e8 7a 04 00 00       	call   550 <printf>
+
+  fd = open(path, O_RDONLY);
+  d6:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  dc:	59                   	pop    %ecx
+  dd:	5b                   	pop    %ebx
+  de:	6a 00                	push   $0x0
+  e0:	bb 14 00 00 00       	mov    $0x14,%ebx
+  e5:	50                   	push   %eax
+  e6:	e8 f8 02 00 00       	call   3e3 <open>
+  eb:	83 c4 10             	add    $0x10,%esp
+  ee:	89 c7                	mov    %eax,%edi
+  for (i = 0; i < 20; i++)
+    read(fd, data, sizeof(data));
+  f0:	83 ec 04             	sub    $0x4,%esp
+  f3:	68 00 02 00 00       	push   $0x200
+  f8:	56                   	push   %esi
+  f9:	57                   	push   %edi
+  fa:	e8 bc 02 00 00       	call   3bb <read>
+  for (i = 0; i < 20; i++)
+  ff:	83 c4 10             	add    $0x10,%esp
+ 102:	83 eb 01             	sub    $0x1,%ebx
+ 105:	75 e9                	jne    f0 <main+0xf0>
+  close(fd);
+ 107:	83 ec 0c             	sub    $0xc,%esp
+ 10a:	57                   	push   %edi
+ 10b:	e8 bb 02 00 00       	call   3cb <close>
+
+  wait();
+ 110:	e8 96 02 00 00       	call   3ab <wait>
+
+  exit();
+ 115:	e8 89 02 00 00       	call   3a3 <exit>
+ 11a:	66 90                	xchg   %ax,%ax
+ 11c:	66 90                	xchg   %ax,%ax
+ 11e:	66 90                	xchg   %ax,%ax
+
+00000120 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 120:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 121:	31 c0                	xor    %eax,%eax
+{
+ 123:	89 e5                	mov    %esp,%ebp
+ 125:	53                   	push   %ebx
+ 126:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 129:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 130:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 134:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 137:	83 c0 01             	add    $0x1,%eax
+ 13a:	84 d2                	test   %dl,%dl
+ 13c:	75 f2                	jne    130 <strcpy+0x10>
+    ;
+  return os;
+}
+ 13e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 141:	89 c8                	mov    %ecx,%eax
+ 143:	c9                   	leave
+ 144:	c3                   	ret
+ 145:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	53                   	push   %ebx
+ 154:	8b 55 08             	mov    0x8(%ebp),%edx
+ 157:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 15a:	0f b6 02             	movzbl (%edx),%eax
+ 15d:	84 c0                	test   %al,%al
+ 15f:	75 17                	jne    178 <strcmp+0x28>
+ 161:	eb 3a                	jmp    19d <strcmp+0x4d>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 16c:	83 c2 01             	add    $0x1,%edx
+ 16f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 172:	84 c0                	test   %al,%al
+ 174:	74 1a                	je     190 <strcmp+0x40>
+    p++, q++;
+ 176:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 178:	0f b6 19             	movzbl (%ecx),%ebx
+ 17b:	38 c3                	cmp    %al,%bl
+ 17d:	74 e9                	je     168 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 17f:	29 d8                	sub    %ebx,%eax
+}
+ 181:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 184:	c9                   	leave
+ 185:	c3                   	ret
+ 186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 190:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 194:	31 c0                	xor    %eax,%eax
+ 196:	29 d8                	sub    %ebx,%eax
+}
+ 198:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 19b:	c9                   	leave
+ 19c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 19d:	0f b6 19             	movzbl (%ecx),%ebx
+ 1a0:	31 c0                	xor    %eax,%eax
+ 1a2:	eb db                	jmp    17f <strcmp+0x2f>
+ 1a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1af:	90                   	nop
+
+000001b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1b6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1b9:	74 15                	je     1d0 <strlen+0x20>
+ 1bb:	31 c0                	xor    %eax,%eax
+ 1bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1c0:	83 c0 01             	add    $0x1,%eax
+ 1c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1c7:	89 c1                	mov    %eax,%ecx
+ 1c9:	75 f5                	jne    1c0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1cb:	89 c8                	mov    %ecx,%eax
+ 1cd:	5d                   	pop    %ebp
+ 1ce:	c3                   	ret
+ 1cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1d0:	31 c9                	xor    %ecx,%ecx
+}
+ 1d2:	5d                   	pop    %ebp
+ 1d3:	89 c8                	mov    %ecx,%eax
+ 1d5:	c3                   	ret
+ 1d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ed:	89 d7                	mov    %edx,%edi
+ 1ef:	fc                   	cld
+ 1f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1f5:	89 d0                	mov    %edx,%eax
+ 1f7:	c9                   	leave
+ 1f8:	c3                   	ret
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	8b 45 08             	mov    0x8(%ebp),%eax
+ 206:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 20a:	0f b6 10             	movzbl (%eax),%edx
+ 20d:	84 d2                	test   %dl,%dl
+ 20f:	75 12                	jne    223 <strchr+0x23>
+ 211:	eb 1d                	jmp    230 <strchr+0x30>
+ 213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 217:	90                   	nop
+ 218:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 21c:	83 c0 01             	add    $0x1,%eax
+ 21f:	84 d2                	test   %dl,%dl
+ 221:	74 0d                	je     230 <strchr+0x30>
+    if(*s == c)
+ 223:	38 d1                	cmp    %dl,%cl
+ 225:	75 f1                	jne    218 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 227:	5d                   	pop    %ebp
+ 228:	c3                   	ret
+ 229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 230:	31 c0                	xor    %eax,%eax
+}
+ 232:	5d                   	pop    %ebp
+ 233:	c3                   	ret
+ 234:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 23f:	90                   	nop
+
+00000240 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 245:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 248:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 249:	31 db                	xor    %ebx,%ebx
+{
+ 24b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 24e:	eb 27                	jmp    277 <gets+0x37>
+    cc = read(0, &c, 1);
+ 250:	83 ec 04             	sub    $0x4,%esp
+ 253:	6a 01                	push   $0x1
+ 255:	56                   	push   %esi
+ 256:	6a 00                	push   $0x0
+ 258:	e8 5e 01 00 00       	call   3bb <read>
+    if(cc < 1)
+ 25d:	83 c4 10             	add    $0x10,%esp
+ 260:	85 c0                	test   %eax,%eax
+ 262:	7e 1d                	jle    281 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 264:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 268:	8b 55 08             	mov    0x8(%ebp),%edx
+ 26b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 26f:	3c 0a                	cmp    $0xa,%al
+ 271:	74 10                	je     283 <gets+0x43>
+ 273:	3c 0d                	cmp    $0xd,%al
+ 275:	74 0c                	je     283 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 277:	89 df                	mov    %ebx,%edi
+ 279:	83 c3 01             	add    $0x1,%ebx
+ 27c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 27f:	7c cf                	jl     250 <gets+0x10>
+ 281:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 283:	8b 45 08             	mov    0x8(%ebp),%eax
+ 286:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 28a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 28d:	5b                   	pop    %ebx
+ 28e:	5e                   	pop    %esi
+ 28f:	5f                   	pop    %edi
+ 290:	5d                   	pop    %ebp
+ 291:	c3                   	ret
+ 292:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	56                   	push   %esi
+ 2a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2a5:	83 ec 08             	sub    $0x8,%esp
+ 2a8:	6a 00                	push   $0x0
+ 2aa:	ff 75 08             	push   0x8(%ebp)
+ 2ad:	e8 31 01 00 00       	call   3e3 <open>
+  if(fd < 0)
+ 2b2:	83 c4 10             	add    $0x10,%esp
+ 2b5:	85 c0                	test   %eax,%eax
+ 2b7:	78 27                	js     2e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2b9:	83 ec 08             	sub    $0x8,%esp
+ 2bc:	ff 75 0c             	push   0xc(%ebp)
+ 2bf:	89 c3                	mov    %eax,%ebx
+ 2c1:	50                   	push   %eax
+ 2c2:	e8 34 01 00 00       	call   3fb <fstat>
+  close(fd);
+ 2c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2cc:	e8 fa 00 00 00       	call   3cb <close>
+  return r;
+ 2d1:	83 c4 10             	add    $0x10,%esp
+}
+ 2d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2d7:	89 f0                	mov    %esi,%eax
+ 2d9:	5b                   	pop    %ebx
+ 2da:	5e                   	pop    %esi
+ 2db:	5d                   	pop    %ebp
+ 2dc:	c3                   	ret
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2e5:	eb ed                	jmp    2d4 <stat+0x34>
+ 2e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ee:	66 90                	xchg   %ax,%ax
+
+000002f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	53                   	push   %ebx
+ 2f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2f7:	0f be 02             	movsbl (%edx),%eax
+ 2fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 300:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 305:	77 1e                	ja     325 <atoi+0x35>
+ 307:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 310:	83 c2 01             	add    $0x1,%edx
+ 313:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 316:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 31a:	0f be 02             	movsbl (%edx),%eax
+ 31d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 320:	80 fb 09             	cmp    $0x9,%bl
+ 323:	76 eb                	jbe    310 <atoi+0x20>
+  return n;
+}
+ 325:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 328:	89 c8                	mov    %ecx,%eax
+ 32a:	c9                   	leave
+ 32b:	c3                   	ret
+ 32c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	57                   	push   %edi
+ 334:	56                   	push   %esi
+ 335:	8b 45 10             	mov    0x10(%ebp),%eax
+ 338:	8b 55 08             	mov    0x8(%ebp),%edx
+ 33b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 33e:	85 c0                	test   %eax,%eax
+ 340:	7e 13                	jle    355 <memmove+0x25>
+ 342:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 344:	89 d7                	mov    %edx,%edi
+ 346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 350:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 351:	39 f8                	cmp    %edi,%eax
+ 353:	75 fb                	jne    350 <memmove+0x20>
+  return vdst;
+}
+ 355:	5e                   	pop    %esi
+ 356:	89 d0                	mov    %edx,%eax
+ 358:	5f                   	pop    %edi
+ 359:	5d                   	pop    %ebp
+ 35a:	c3                   	ret
+
+0000035b <ccreate>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(ccreate)
+ 35b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <cfork>:
+SYSCALL(cfork)
+ 363:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <cgetrootdir>:
+SYSCALL(cgetrootdir)
+ 36b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <getcontrootdir>:
+SYSCALL(getcontrootdir)
+ 373:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <cpause>:
+SYSCALL(cpause)
+ 37b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <cresume>:
+SYSCALL(cresume)
+ 383:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <cstart>:
+SYSCALL(cstart)
+ 38b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <cstop>:
+SYSCALL(cstop)
+ 393:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <fork>:
+SYSCALL(fork)
+ 39b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <exit>:
+SYSCALL(exit)
+ 3a3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <wait>:
+SYSCALL(wait)
+ 3ab:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <pipe>:
+SYSCALL(pipe)
+ 3b3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <read>:
+SYSCALL(read)
+ 3bb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <write>:
+SYSCALL(write)
+ 3c3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <close>:
+SYSCALL(close)
+ 3cb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <kill>:
+SYSCALL(kill)
+ 3d3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <exec>:
+SYSCALL(exec)
+ 3db:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <open>:
+SYSCALL(open)
+ 3e3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <mknod>:
+SYSCALL(mknod)
+ 3eb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <unlink>:
+SYSCALL(unlink)
+ 3f3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <fstat>:
+SYSCALL(fstat)
+ 3fb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <link>:
+SYSCALL(link)
+ 403:	b8 13 00 00 00       	mov    $0x13,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <mkdir>:
+SYSCALL(mkdir)
+ 40b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <chdir>:
+SYSCALL(chdir)
+ 413:	b8 09 00 00 00       	mov    $0x9,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <dup>:
+SYSCALL(dup)
+ 41b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <getpid>:
+SYSCALL(getpid)
+ 423:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <sbrk>:
+SYSCALL(sbrk)
+ 42b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <sleep>:
+SYSCALL(sleep)
+ 433:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <uptime>:
+SYSCALL(uptime)
+ 43b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <cps>:
+SYSCALL(cps)
+ 443:	b8 16 00 00 00       	mov    $0x16,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <mmap>:
+SYSCALL(mmap)
+ 44b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <munmap>:
+SYSCALL(munmap)
+ 453:	b8 20 00 00 00       	mov    $0x20,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <shmget>:
+SYSCALL(shmget)
+ 45b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <climit>:
+SYSCALL(climit)
+ 463:	b8 22 00 00 00       	mov    $0x22,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <spawn>:
+SYSCALL(spawn)
+ 46b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <clone>:
+SYSCALL(clone)
+ 473:	b8 24 00 00 00       	mov    $0x24,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <join>:
+SYSCALL(join)
+ 47b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <futex>:
+SYSCALL(futex)
+ 483:	b8 26 00 00 00       	mov    $0x26,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <ccheckpoint>:
+SYSCALL(ccheckpoint)
+ 48b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <crestore>:
+SYSCALL(crestore)
+ 493:	b8 28 00 00 00       	mov    $0x28,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <czygote>:
+SYSCALL(czygote)
+ 49b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <memstats>:
+SYSCALL(memstats)
+ 4a3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+ 4ab:	66 90                	xchg   %ax,%ax
+ 4ad:	66 90                	xchg   %ax,%ax
+ 4af:	90                   	nop
+
+000004b0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	57                   	push   %edi
+ 4b4:	56                   	push   %esi
+ 4b5:	53                   	push   %ebx
+ 4b6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 4b8:	89 d1                	mov    %edx,%ecx
+{
+ 4ba:	83 ec 3c             	sub    $0x3c,%esp
+ 4bd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 4c0:	85 d2                	test   %edx,%edx
+ 4c2:	0f 89 80 00 00 00    	jns    548 <printint+0x98>
+ 4c8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 4cc:	74 7a                	je     548 <printint+0x98>
+    x = -xx;
+ 4ce:	f7 d9                	neg    %ecx
+    neg = 1;
+ 4d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 4d5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 4d8:	31 f6                	xor    %esi,%esi
+ 4da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 4e0:	89 c8                	mov    %ecx,%eax
+ 4e2:	31 d2                	xor    %edx,%edx
+ 4e4:	89 f7                	mov    %esi,%edi
+ 4e6:	f7 f3                	div    %ebx
+ 4e8:	8d 76 01             	lea    0x1(%esi),%esi
+ 4eb:	0f b6 92 c4 0c 00 00 	movzbl 0xcc4(%edx),%edx
+ 4f2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 4f6:	89 ca                	mov    %ecx,%edx
+ 4f8:	89 c1                	mov    %eax,%ecx
+ 4fa:	39 da                	cmp    %ebx,%edx
+ 4fc:	73 e2                	jae    4e0 <printint+0x30>
+  if(neg)
+ 4fe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 501:	85 c0                	test   %eax,%eax
+ 503:	74 07                	je     50c <printint+0x5c>
+    buf[i++] = '-';
+ 505:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 50a:	89 f7                	mov    %esi,%edi
+ 50c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 50f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 512:	01 df                	add    %ebx,%edi
+ 514:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 518:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 51b:	83 ec 04             	sub    $0x4,%esp
+ 51e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 521:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 524:	6a 01                	push   $0x1
+ 526:	50                   	push   %eax
+ 527:	56                   	push   %esi
+ 528:	e8 96 fe ff ff       	call   3c3 <write>
+  while(--i >= 0)
+ 52d:	89 f8                	mov    %edi,%eax
+ 52f:	83 c4 10             	add    $0x10,%esp
+ 532:	83 ef 01             	sub    $0x1,%edi
+ 535:	39 d8                	cmp    %ebx,%eax
+ 537:	75 df                	jne    518 <printint+0x68>
+}
+ 539:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 53c:	5b                   	pop    %ebx
+ 53d:	5e                   	pop    %esi
+ 53e:	5f                   	pop    %edi
+ 53f:	5d                   	pop    %ebp
+ 540:	c3                   	ret
+ 541:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 548:	31 c0                	xor    %eax,%eax
+ 54a:	eb 89                	jmp    4d5 <printint+0x25>
+ 54c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	56                   	push   %esi
+ 555:	53                   	push   %ebx
+ 556:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 559:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 55c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 55f:	0f b6 1e             	movzbl (%esi),%ebx
+ 562:	83 c6 01             	add    $0x1,%esi
+ 565:	84 db                	test   %bl,%bl
+ 567:	74 67                	je     5d0 <printf+0x80>
+ 569:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 56c:	31 d2                	xor    %edx,%edx
+ 56e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 571:	eb 34                	jmp    5a7 <printf+0x57>
+ 573:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 577:	90                   	nop
+ 578:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 57b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 580:	83 f8 25             	cmp    $0x25,%eax
+ 583:	74 18                	je     59d <printf+0x4d>
+  write(fd, &c, 1);
+ 585:	83 ec 04             	sub    $0x4,%esp
+ 588:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 58b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 58e:	6a 01                	push   $0x1
+ 590:	50                   	push   %eax
+ 591:	57                   	push   %edi
+ 592:	e8 2c fe ff ff       	call   3c3 <write>
+ 597:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 59a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 59d:	0f b6 1e             	movzbl (%esi),%ebx
+ 5a0:	83 c6 01             	add    $0x1,%esi
+ 5a3:	84 db                	test   %bl,%bl
+ 5a5:	74 29                	je     5d0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 5a7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 5aa:	85 d2                	test   %edx,%edx
+ 5ac:	74 ca                	je     578 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 5ae:	83 fa 25             	cmp    $0x25,%edx
+ 5b1:	75 ea                	jne    59d <printf+0x4d>
+      if(c == 'd'){
+ 5b3:	83 f8 25             	cmp    $0x25,%eax
+ 5b6:	0f 84 24 01 00 00    	je     6e0 <printf+0x190>
+ 5bc:	83 e8 63             	sub    $0x63,%eax
+ 5bf:	83 f8 15             	cmp    $0x15,%eax
+ 5c2:	77 1c                	ja     5e0 <printf+0x90>
+ 5c4:	ff 24 85 6c 0c 00 00 	jmp    *0xc6c(,%eax,4)
+ 5cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5cf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 5d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5d3:	5b                   	pop    %ebx
+ 5d4:	5e                   	pop    %esi
+ 5d5:	5f                   	pop    %edi
+ 5d6:	5d                   	pop    %ebp
+ 5d7:	c3                   	ret
+ 5d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5df:	90                   	nop
+  write(fd, &c, 1);
+ 5e0:	83 ec 04             	sub    $0x4,%esp
+ 5e3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5e6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 5ea:	6a 01                	push   $0x1
+ 5ec:	52                   	push   %edx
+ 5ed:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 5f0:	57                   	push   %edi
+ 5f1:	e8 cd fd ff ff       	call   3c3 <write>
+ 5f6:	83 c4 0c             	add    $0xc,%esp
+ 5f9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5fc:	6a 01                	push   $0x1
+ 5fe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 601:	52                   	push   %edx
+ 602:	57                   	push   %edi
+ 603:	e8 bb fd ff ff       	call   3c3 <write>
+        putc(fd, c);
+ 608:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 60b:	31 d2                	xor    %edx,%edx
+ 60d:	eb 8e                	jmp    59d <printf+0x4d>
+ 60f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 610:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 613:	83 ec 0c             	sub    $0xc,%esp
+ 616:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 61b:	8b 13                	mov    (%ebx),%edx
+ 61d:	6a 00                	push   $0x0
+ 61f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 621:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 624:	e8 87 fe ff ff       	call   4b0 <printint>
+        ap++;
+ 629:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 62c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 62f:	31 d2                	xor    %edx,%edx
+ 631:	e9 67 ff ff ff       	jmp    59d <printf+0x4d>
+ 636:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 63d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 640:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 643:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 645:	83 c0 04             	add    $0x4,%eax
+ 648:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 64b:	85 db                	test   %ebx,%ebx
+ 64d:	0f 84 9d 00 00 00    	je     6f0 <printf+0x1a0>
+        while(*s != 0){
+ 653:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 656:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 658:	84 c0                	test   %al,%al
+ 65a:	0f 84 3d ff ff ff    	je     59d <printf+0x4d>
+ 660:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 663:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 666:	89 de                	mov    %ebx,%esi
+ 668:	89 d3                	mov    %edx,%ebx
+ 66a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 670:	83 ec 04             	sub    $0x4,%esp
+ 673:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 676:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 679:	6a 01                	push   $0x1
+ 67b:	53                   	push   %ebx
+ 67c:	57                   	push   %edi
+ 67d:	e8 41 fd ff ff       	call   3c3 <write>
+        while(*s != 0){
+ 682:	0f b6 06             	movzbl (%esi),%eax
+ 685:	83 c4 10             	add    $0x10,%esp
+ 688:	84 c0                	test   %al,%al
+ 68a:	75 e4                	jne    670 <printf+0x120>
+      state = 0;
+ 68c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 68f:	31 d2                	xor    %edx,%edx
+ 691:	e9 07 ff ff ff       	jmp    59d <printf+0x4d>
+ 696:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 69d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 6a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6a3:	83 ec 0c             	sub    $0xc,%esp
+ 6a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 6ab:	8b 13                	mov    (%ebx),%edx
+ 6ad:	6a 01                	push   $0x1
+ 6af:	e9 6b ff ff ff       	jmp    61f <printf+0xcf>
+ 6b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 6b8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 6bb:	83 ec 04             	sub    $0x4,%esp
+ 6be:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 6c1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 6c3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 6c6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6c9:	6a 01                	push   $0x1
+ 6cb:	52                   	push   %edx
+ 6cc:	57                   	push   %edi
+ 6cd:	e8 f1 fc ff ff       	call   3c3 <write>
+        ap++;
+ 6d2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6d5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6d8:	31 d2                	xor    %edx,%edx
+ 6da:	e9 be fe ff ff       	jmp    59d <printf+0x4d>
+ 6df:	90                   	nop
+  write(fd, &c, 1);
+ 6e0:	83 ec 04             	sub    $0x4,%esp
+ 6e3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6e6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6e9:	6a 01                	push   $0x1
+ 6eb:	e9 11 ff ff ff       	jmp    601 <printf+0xb1>
+ 6f0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 6f5:	bb 63 0c 00 00       	mov    $0xc63,%ebx
+ 6fa:	e9 61 ff ff ff       	jmp    660 <printf+0x110>
+ 6ff:	90                   	nop
+
+00000700 <runfree>:
+
+// Give the n pages at r back to the free runs, merging them with
+// adjacent runs, and shrink the heap if the end of it is free.
+static void
+runfree(struct page *r, uint n)
+{
+ 700:	55                   	push   %ebp
+  struct page **pp, *prev;
+
+  r->kind = PFREE;
+ 701:	b9 03 00 00 00       	mov    $0x3,%ecx
+{
+ 706:	89 e5                	mov    %esp,%ebp
+ 708:	57                   	push   %edi
+ 709:	56                   	push   %esi
+ 70a:	53                   	push   %ebx
+ 70b:	89 c3                	mov    %eax,%ebx
+ 70d:	83 ec 0c             	sub    $0xc,%esp
+  r->kind = PFREE;
+ 710:	66 89 08             	mov    %cx,(%eax)
+  r->npages = n;
+  prev = 0;
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 713:	8b 0d e4 0f 00 00    	mov    0xfe4,%ecx
+  r->npages = n;
+ 719:	89 50 04             	mov    %edx,0x4(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 71c:	85 c9                	test   %ecx,%ecx
+ 71e:	0f 84 1f 01 00 00    	je     843 <runfree+0x143>
+ 724:	39 c1                	cmp    %eax,%ecx
+ 726:	0f 83 f7 00 00 00    	jae    823 <runfree+0x123>
+ 72c:	89 c8                	mov    %ecx,%eax
+ 72e:	eb 04                	jmp    734 <runfree+0x34>
+ 730:	39 d8                	cmp    %ebx,%eax
+ 732:	73 09                	jae    73d <runfree+0x3d>
+ 734:	89 c2                	mov    %eax,%edx
+ 736:	8b 40 14             	mov    0x14(%eax),%eax
+ 739:	85 c0                	test   %eax,%eax
+ 73b:	75 f3                	jne    730 <runfree+0x30>
+    prev = *pp;
+  r->next = *pp;
+ 73d:	89 43 14             	mov    %eax,0x14(%ebx)
+  *pp = r;
+ 740:	89 5a 14             	mov    %ebx,0x14(%edx)
+
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 743:	8b 43 14             	mov    0x14(%ebx),%eax
+ 746:	85 c0                	test   %eax,%eax
+ 748:	74 12                	je     75c <runfree+0x5c>
+ 74a:	8b 7b 04             	mov    0x4(%ebx),%edi
+ 74d:	89 fe                	mov    %edi,%esi
+ 74f:	c1 e6 0c             	shl    $0xc,%esi
+ 752:	01 de                	add    %ebx,%esi
+ 754:	39 f0                	cmp    %esi,%eax
+ 756:	0f 84 a4 00 00 00    	je     800 <runfree+0x100>
+    r->npages += r->next->npages;
+    r->next = r->next->next;
+  }
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 75c:	8b 72 04             	mov    0x4(%edx),%esi
+ 75f:	89 f0                	mov    %esi,%eax
+ 761:	c1 e0 0c             	shl    $0xc,%eax
+ 764:	01 d0                	add    %edx,%eax
+ 766:	39 c3                	cmp    %eax,%ebx
+ 768:	74 16                	je     780 <runfree+0x80>
+    pp = &runs;
+    while(*pp != r)
+      pp = &(*pp)->next;
+  }
+
+  if(r->next == 0 && r->npages >= TRIM &&
+ 76a:	8b 43 14             	mov    0x14(%ebx),%eax
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 76d:	8d 72 14             	lea    0x14(%edx),%esi
+  if(r->next == 0 && r->npages >= TRIM &&
+ 770:	85 c0                	test   %eax,%eax
+ 772:	74 3c                	je     7b0 <runfree+0xb0>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+    *pp = 0;
+    sbrk(-(int)(r->npages*PGSIZE));
+    heapend = (char*)r;
+  }
+}
+ 774:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 777:	5b                   	pop    %ebx
+ 778:	5e                   	pop    %esi
+ 779:	5f                   	pop    %edi
+ 77a:	5d                   	pop    %ebp
+ 77b:	c3                   	ret
+ 77c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    prev->npages += r->npages;
+ 780:	03 73 04             	add    0x4(%ebx),%esi
+ 783:	89 72 04             	mov    %esi,0x4(%edx)
+    prev->next = r->next;
+ 786:	8b 43 14             	mov    0x14(%ebx),%eax
+ 789:	89 42 14             	mov    %eax,0x14(%edx)
+    while(*pp != r)
+ 78c:	39 d1                	cmp    %edx,%ecx
+ 78e:	0f 84 c5 00 00 00    	je     859 <runfree+0x159>
+ 794:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      pp = &(*pp)->next;
+ 798:	89 cb                	mov    %ecx,%ebx
+ 79a:	8b 49 14             	mov    0x14(%ecx),%ecx
+    while(*pp != r)
+ 79d:	39 d1                	cmp    %edx,%ecx
+ 79f:	75 f7                	jne    798 <runfree+0x98>
+      pp = &(*pp)->next;
+ 7a1:	8d 73 14             	lea    0x14(%ebx),%esi
+ 7a4:	89 cb                	mov    %ecx,%ebx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 7a6:	85 c0                	test   %eax,%eax
+ 7a8:	75 ca                	jne    774 <runfree+0x74>
+ 7aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 7b0:	8b 53 04             	mov    0x4(%ebx),%edx
+ 7b3:	83 fa 1f             	cmp    $0x1f,%edx
+ 7b6:	76 bc                	jbe    774 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 7b8:	c1 e2 0c             	shl    $0xc,%edx
+ 7bb:	01 da                	add    %ebx,%edx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 7bd:	39 15 e0 0f 00 00    	cmp    %edx,0xfe0
+ 7c3:	75 af                	jne    774 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 7c5:	83 ec 0c             	sub    $0xc,%esp
+ 7c8:	6a 00                	push   $0x0
+ 7ca:	e8 5c fc ff ff       	call   42b <sbrk>
+ 7cf:	83 c4 10             	add    $0x10,%esp
+ 7d2:	39 05 e0 0f 00 00    	cmp    %eax,0xfe0
+ 7d8:	75 9a                	jne    774 <runfree+0x74>
+    *pp = 0;
+ 7da:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    sbrk(-(int)(r->npages*PGSIZE));
+ 7e0:	8b 43 04             	mov    0x4(%ebx),%eax
+ 7e3:	83 ec 0c             	sub    $0xc,%esp
+ 7e6:	c1 e0 0c             	shl    $0xc,%eax
+ 7e9:	f7 d8                	neg    %eax
+ 7eb:	50                   	push   %eax
+ 7ec:	e8 3a fc ff ff       	call   42b <sbrk>
+    heapend = (char*)r;
+ 7f1:	89 1d e0 0f 00 00    	mov    %ebx,0xfe0
+ 7f7:	83 c4 10             	add    $0x10,%esp
+}
+ 7fa:	e9 75 ff ff ff       	jmp    774 <runfree+0x74>
+ 7ff:	90                   	nop
+    r->npages += r->next->npages;
+ 800:	03 78 04             	add    0x4(%eax),%edi
+ 803:	89 7b 04             	mov    %edi,0x4(%ebx)
+    r->next = r->next->next;
+ 806:	8b 40 14             	mov    0x14(%eax),%eax
+ 809:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 80c:	8b 72 04             	mov    0x4(%edx),%esi
+ 80f:	89 f0                	mov    %esi,%eax
+ 811:	c1 e0 0c             	shl    $0xc,%eax
+ 814:	01 d0                	add    %edx,%eax
+ 816:	39 c3                	cmp    %eax,%ebx
+ 818:	0f 85 4c ff ff ff    	jne    76a <runfree+0x6a>
+ 81e:	e9 5d ff ff ff       	jmp    780 <runfree+0x80>
+  r->next = *pp;
+ 823:	89 48 14             	mov    %ecx,0x14(%eax)
+  *pp = r;
+ 826:	a3 e4 0f 00 00       	mov    %eax,0xfe4
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 82b:	89 d0                	mov    %edx,%eax
+ 82d:	c1 e0 0c             	shl    $0xc,%eax
+ 830:	01 d8                	add    %ebx,%eax
+ 832:	39 c1                	cmp    %eax,%ecx
+ 834:	74 2f                	je     865 <runfree+0x165>
+  if(r->next == 0 && r->npages >= TRIM &&
+ 836:	8b 43 14             	mov    0x14(%ebx),%eax
+ 839:	be e4 0f 00 00       	mov    $0xfe4,%esi
+ 83e:	e9 2d ff ff ff       	jmp    770 <runfree+0x70>
+  r->next = *pp;
+ 843:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 84a:	be e4 0f 00 00       	mov    $0xfe4,%esi
+  *pp = r;
+ 84f:	a3 e4 0f 00 00       	mov    %eax,0xfe4
+  if(r->next == 0 && r->npages >= TRIM &&
+ 854:	e9 5a ff ff ff       	jmp    7b3 <runfree+0xb3>
+    while(*pp != r)
+ 859:	89 cb                	mov    %ecx,%ebx
+    pp = &runs;
+ 85b:	be e4 0f 00 00       	mov    $0xfe4,%esi
+ 860:	e9 0b ff ff ff       	jmp    770 <runfree+0x70>
+    r->npages += r->next->npages;
+ 865:	03 51 04             	add    0x4(%ecx),%edx
+ 868:	89 53 04             	mov    %edx,0x4(%ebx)
+    r->next = r->next->next;
+ 86b:	8b 41 14             	mov    0x14(%ecx),%eax
+ 86e:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 871:	eb c3                	jmp    836 <runfree+0x136>
+ 873:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 87a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000880 <runalloc>:
+
+// Take a run of n pages from the start of the first free run
+// long enough, which keeps the end of the heap free to trim.
+static struct page*
+runalloc(uint n)
+{
+ 880:	55                   	push   %ebp
+ 881:	89 e5                	mov    %esp,%ebp
+ 883:	57                   	push   %edi
+ 884:	56                   	push   %esi
+ 885:	89 c6                	mov    %eax,%esi
+ 887:	53                   	push   %ebx
+ 888:	83 ec 1c             	sub    $0x1c,%esp
+  struct page **pp, *r, *rest;
+
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ 88b:	8b 1d e4 0f 00 00    	mov    0xfe4,%ebx
+ 891:	85 db                	test   %ebx,%ebx
+ 893:	74 4d                	je     8e2 <runalloc+0x62>
+ 895:	b9 e4 0f 00 00       	mov    $0xfe4,%ecx
+    if(r->npages < n)
+ 89a:	39 73 04             	cmp    %esi,0x4(%ebx)
+ 89d:	72 39                	jb     8d8 <runalloc+0x58>
+      continue;
+    if(r->npages == n){
+ 89f:	0f 84 9b 00 00 00    	je     940 <runalloc+0xc0>
+      *pp = r->next;
+    } else {
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ 8a5:	89 f0                	mov    %esi,%eax
+      rest->kind = PFREE;
+ 8a7:	ba 03 00 00 00       	mov    $0x3,%edx
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ 8ac:	c1 e0 0c             	shl    $0xc,%eax
+ 8af:	01 d8                	add    %ebx,%eax
+      rest->kind = PFREE;
+ 8b1:	66 89 10             	mov    %dx,(%eax)
+      rest->npages = r->npages - n;
+ 8b4:	8b 53 04             	mov    0x4(%ebx),%edx
+ 8b7:	29 f2                	sub    %esi,%edx
+ 8b9:	89 50 04             	mov    %edx,0x4(%eax)
+      rest->next = r->next;
+ 8bc:	8b 53 14             	mov    0x14(%ebx),%edx
+ 8bf:	89 50 14             	mov    %edx,0x14(%eax)
+      *pp = rest;
+ 8c2:	89 01                	mov    %eax,(%ecx)
+      r->npages = n;
+ 8c4:	89 73 04             	mov    %esi,0x4(%ebx)
+    }
+    return r;
+  }
+  return morecore(n);
+}
+ 8c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8ca:	89 d8                	mov    %ebx,%eax
+ 8cc:	5b                   	pop    %ebx
+ 8cd:	5e                   	pop    %esi
+ 8ce:	5f                   	pop    %edi
+ 8cf:	5d                   	pop    %ebp
+ 8d0:	c3                   	ret
+ 8d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ 8d8:	8d 4b 14             	lea    0x14(%ebx),%ecx
+ 8db:	8b 5b 14             	mov    0x14(%ebx),%ebx
+ 8de:	85 db                	test   %ebx,%ebx
+ 8e0:	75 b8                	jne    89a <runalloc+0x1a>
+  m = n < MINCORE ? MINCORE : n;
+ 8e2:	bf 08 00 00 00       	mov    $0x8,%edi
+ 8e7:	39 fe                	cmp    %edi,%esi
+ 8e9:	0f 43 fe             	cmovae %esi,%edi
+  brk = sbrk(0);
+ 8ec:	83 ec 0c             	sub    $0xc,%esp
+ 8ef:	6a 00                	push   $0x0
+ 8f1:	e8 35 fb ff ff       	call   42b <sbrk>
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 8f6:	89 fa                	mov    %edi,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 8f8:	89 c3                	mov    %eax,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 8fa:	c1 e2 0c             	shl    $0xc,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 8fd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 900:	f7 db                	neg    %ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 902:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 905:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 90b:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+ 90e:	89 04 24             	mov    %eax,(%esp)
+ 911:	e8 15 fb ff ff       	call   42b <sbrk>
+ 916:	83 c4 10             	add    $0x10,%esp
+ 919:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 91c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 91f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 922:	74 3e                	je     962 <runalloc+0xe2>
+  r = (struct page*)(brk + pad);
+ 924:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ 926:	01 da                	add    %ebx,%edx
+ 928:	89 15 e0 0f 00 00    	mov    %edx,0xfe0
+  if(m > n)
+ 92e:	39 fe                	cmp    %edi,%esi
+ 930:	72 1e                	jb     950 <runalloc+0xd0>
+  r->npages = n;
+ 932:	89 73 04             	mov    %esi,0x4(%ebx)
+  return r;
+ 935:	eb 90                	jmp    8c7 <runalloc+0x47>
+ 937:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93e:	66 90                	xchg   %ax,%ax
+      *pp = r->next;
+ 940:	8b 43 14             	mov    0x14(%ebx),%eax
+ 943:	89 01                	mov    %eax,(%ecx)
+}
+ 945:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 948:	89 d8                	mov    %ebx,%eax
+ 94a:	5b                   	pop    %ebx
+ 94b:	5e                   	pop    %esi
+ 94c:	5f                   	pop    %edi
+ 94d:	5d                   	pop    %ebp
+ 94e:	c3                   	ret
+ 94f:	90                   	nop
+    runfree((struct page*)((char*)r + n*PGSIZE), m - n);
+ 950:	89 f0                	mov    %esi,%eax
+ 952:	29 f7                	sub    %esi,%edi
+ 954:	c1 e0 0c             	shl    $0xc,%eax
+ 957:	89 fa                	mov    %edi,%edx
+ 959:	01 d8                	add    %ebx,%eax
+ 95b:	e8 a0 fd ff ff       	call   700 <runfree>
+ 960:	eb d0                	jmp    932 <runalloc+0xb2>
+    if(sbrk(pad + m*PGSIZE) == (char*)-1)
+ 962:	89 f7                	mov    %esi,%edi
+ 964:	83 ec 0c             	sub    $0xc,%esp
+ 967:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 96a:	c1 e7 0c             	shl    $0xc,%edi
+ 96d:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+ 970:	50                   	push   %eax
+ 971:	e8 b5 fa ff ff       	call   42b <sbrk>
+ 976:	83 c4 10             	add    $0x10,%esp
+ 979:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 97c:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 97f:	74 0c                	je     98d <runalloc+0x10d>
+  r = (struct page*)(brk + pad);
+ 981:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ 983:	01 df                	add    %ebx,%edi
+ 985:	89 3d e0 0f 00 00    	mov    %edi,0xfe0
+  if(m > n)
+ 98b:	eb a5                	jmp    932 <runalloc+0xb2>
+      return 0;
+ 98d:	31 db                	xor    %ebx,%ebx
+ 98f:	e9 33 ff ff ff       	jmp    8c7 <runalloc+0x47>
+ 994:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 99b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 99f:	90                   	nop
+
+000009a0 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+ 9a0:	55                   	push   %ebp
+ 9a1:	89 e5                	mov    %esp,%ebp
+ 9a3:	56                   	push   %esi
+ 9a4:	53                   	push   %ebx
+ 9a5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  struct page *p;
+
+  if(ap == 0)
+ 9a8:	85 c9                	test   %ecx,%ecx
+ 9aa:	74 1c                	je     9c8 <free+0x28>
+    return;
+  p = (struct page*)((uint)ap & ~(PGSIZE-1));
+ 9ac:	89 c8                	mov    %ecx,%eax
+ 9ae:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  switch(p->kind){
+ 9b3:	0f b7 10             	movzwl (%eax),%edx
+ 9b6:	66 83 fa 02          	cmp    $0x2,%dx
+ 9ba:	74 14                	je     9d0 <free+0x30>
+ 9bc:	66 83 fa 04          	cmp    $0x4,%dx
+ 9c0:	74 66                	je     a28 <free+0x88>
+ 9c2:	66 83 fa 01          	cmp    $0x1,%dx
+ 9c6:	74 18                	je     9e0 <free+0x40>
+    break;
+  case PMAP:
+    munmap(p, p->npages*PGSIZE);
+    break;
+  }
+}
+ 9c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 9cb:	5b                   	pop    %ebx
+ 9cc:	5e                   	pop    %esi
+ 9cd:	5d                   	pop    %ebp
+ 9ce:	c3                   	ret
+ 9cf:	90                   	nop
+    runfree(p, p->npages);
+ 9d0:	8b 50 04             	mov    0x4(%eax),%edx
+}
+ 9d3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 9d6:	5b                   	pop    %ebx
+ 9d7:	5e                   	pop    %esi
+ 9d8:	5d                   	pop    %ebp
+    runfree(p, p->npages);
+ 9d9:	e9 22 fd ff ff       	jmp    700 <runfree>
+ 9de:	66 90                	xchg   %ax,%ax
+  b->next = p->free;
+ 9e0:	8b 50 0c             	mov    0xc(%eax),%edx
+ 9e3:	89 11                	mov    %edx,(%ecx)
+  if(p->nfree++ == 0)
+ 9e5:	8b 50 08             	mov    0x8(%eax),%edx
+  p->free = b;
+ 9e8:	89 48 0c             	mov    %ecx,0xc(%eax)
+  if(p->nfree++ == 0)
+ 9eb:	8d 5a 01             	lea    0x1(%edx),%ebx
+ 9ee:	89 58 08             	mov    %ebx,0x8(%eax)
+ 9f1:	85 d2                	test   %edx,%edx
+ 9f3:	74 53                	je     a48 <free+0xa8>
+  if(p->nfree == nblocks(p->class)){
+ 9f5:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ 9f9:	8d 4e 04             	lea    0x4(%esi),%ecx
+ 9fc:	ba e0 0f 00 00       	mov    $0xfe0,%edx
+ a01:	d3 fa                	sar    %cl,%edx
+  if(p->nfree == nblocks(p->class)){
+ a03:	39 da                	cmp    %ebx,%edx
+ a05:	75 c1                	jne    9c8 <free+0x28>
+  if(p->prev)
+ a07:	8b 48 18             	mov    0x18(%eax),%ecx
+    p->prev->next = p->next;
+ a0a:	8b 50 14             	mov    0x14(%eax),%edx
+  if(p->prev)
+ a0d:	85 c9                	test   %ecx,%ecx
+ a0f:	74 6f                	je     a80 <free+0xe0>
+    p->prev->next = p->next;
+ a11:	89 51 14             	mov    %edx,0x14(%ecx)
+  if(p->next)
+ a14:	85 d2                	test   %edx,%edx
+ a16:	74 06                	je     a1e <free+0x7e>
+    p->next->prev = p->prev;
+ a18:	8b 48 18             	mov    0x18(%eax),%ecx
+ a1b:	89 4a 18             	mov    %ecx,0x18(%edx)
+    runfree(p, 1);
+ a1e:	ba 01 00 00 00       	mov    $0x1,%edx
+ a23:	eb ae                	jmp    9d3 <free+0x33>
+ a25:	8d 76 00             	lea    0x0(%esi),%esi
+    munmap(p, p->npages*PGSIZE);
+ a28:	8b 50 04             	mov    0x4(%eax),%edx
+ a2b:	83 ec 08             	sub    $0x8,%esp
+ a2e:	c1 e2 0c             	shl    $0xc,%edx
+ a31:	52                   	push   %edx
+ a32:	50                   	push   %eax
+ a33:	e8 1b fa ff ff       	call   453 <munmap>
+    break;
+ a38:	83 c4 10             	add    $0x10,%esp
+}
+ a3b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a3e:	5b                   	pop    %ebx
+ a3f:	5e                   	pop    %esi
+ a40:	5d                   	pop    %ebp
+ a41:	c3                   	ret
+ a42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  p->next = partial[p->class];
+ a48:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  p->prev = 0;
+ a4c:	c7 40 18 00 00 00 00 	movl   $0x0,0x18(%eax)
+  p->next = partial[p->class];
+ a53:	bb 01 00 00 00       	mov    $0x1,%ebx
+ a58:	8b 14 b5 e8 0f 00 00 	mov    0xfe8(,%esi,4),%edx
+ a5f:	89 50 14             	mov    %edx,0x14(%eax)
+  if(p->next)
+ a62:	85 d2                	test   %edx,%edx
+ a64:	74 0a                	je     a70 <free+0xd0>
+    p->next->prev = p;
+ a66:	89 42 18             	mov    %eax,0x18(%edx)
+  partial[p->class] = p;
+ a69:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  if(p->nfree == nblocks(p->class)){
+ a6d:	8b 58 08             	mov    0x8(%eax),%ebx
+  partial[p->class] = p;
+ a70:	89 04 b5 e8 0f 00 00 	mov    %eax,0xfe8(,%esi,4)
+}
+ a77:	eb 80                	jmp    9f9 <free+0x59>
+ a79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ a80:	89 14 b5 e8 0f 00 00 	mov    %edx,0xfe8(,%esi,4)
+ a87:	eb 8b                	jmp    a14 <free+0x74>
+ a89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000a90 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ a90:	55                   	push   %ebp
+ a91:	89 e5                	mov    %esp,%ebp
+ a93:	56                   	push   %esi
+ a94:	53                   	push   %ebx
+ a95:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct page *p;
+  uint n;
+
+  if(nbytes <= MAXSMALL)
+ a98:	3d 00 04 00 00       	cmp    $0x400,%eax
+ a9d:	76 71                	jbe    b10 <malloc+0x80>
+    return smallalloc(sizeclass(nbytes));
+  if(nbytes > 0x7fffffff)
+ a9f:	85 c0                	test   %eax,%eax
+ aa1:	0f 88 d9 00 00 00    	js     b80 <malloc+0xf0>
+    return 0;
+  n = (nbytes + HDRSIZE + PGSIZE-1) / PGSIZE;
+ aa7:	8d 90 1f 10 00 00    	lea    0x101f(%eax),%edx
+ aad:	89 d3                	mov    %edx,%ebx
+ aaf:	c1 eb 0c             	shr    $0xc,%ebx
+  if(nbytes >= MAPMIN){
+ ab2:	3d ff ff 00 00       	cmp    $0xffff,%eax
+ ab7:	77 27                	ja     ae0 <malloc+0x50>
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    if(p == MAP_FAILED)
+      return 0;
+    p->kind = PMAP;
+  } else {
+    if((p = runalloc(n)) == 0)
+ ab9:	89 d8                	mov    %ebx,%eax
+ abb:	e8 c0 fd ff ff       	call   880 <runalloc>
+ ac0:	85 c0                	test   %eax,%eax
+ ac2:	0f 84 b8 00 00 00    	je     b80 <malloc+0xf0>
+      return 0;
+    p->kind = PRUN;
+ ac8:	ba 02 00 00 00       	mov    $0x2,%edx
+ acd:	66 89 10             	mov    %dx,(%eax)
+  }
+  p->npages = n;
+ ad0:	89 58 04             	mov    %ebx,0x4(%eax)
+  return (char*)p + HDRSIZE;
+ ad3:	8d 58 20             	lea    0x20(%eax),%ebx
+}
+ ad6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ ad9:	89 d8                	mov    %ebx,%eax
+ adb:	5b                   	pop    %ebx
+ adc:	5e                   	pop    %esi
+ add:	5d                   	pop    %ebp
+ ade:	c3                   	ret
+ adf:	90                   	nop
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+ ae0:	83 ec 08             	sub    $0x8,%esp
+ ae3:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+ ae9:	6a 00                	push   $0x0
+ aeb:	6a ff                	push   $0xffffffff
+ aed:	6a 22                	push   $0x22
+ aef:	6a 03                	push   $0x3
+ af1:	52                   	push   %edx
+ af2:	6a 00                	push   $0x0
+ af4:	e8 52 f9 ff ff       	call   44b <mmap>
+    if(p == MAP_FAILED)
+ af9:	83 c4 20             	add    $0x20,%esp
+ afc:	83 f8 ff             	cmp    $0xffffffff,%eax
+ aff:	74 7f                	je     b80 <malloc+0xf0>
+    p->kind = PMAP;
+ b01:	b9 04 00 00 00       	mov    $0x4,%ecx
+ b06:	66 89 08             	mov    %cx,(%eax)
+ b09:	eb c5                	jmp    ad0 <malloc+0x40>
+ b0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b0f:	90                   	nop
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ b10:	83 f8 10             	cmp    $0x10,%eax
+ b13:	0f 86 07 01 00 00    	jbe    c20 <malloc+0x190>
+ b19:	31 db                	xor    %ebx,%ebx
+ b1b:	ba 10 00 00 00       	mov    $0x10,%edx
+ b20:	83 c3 01             	add    $0x1,%ebx
+ b23:	89 d6                	mov    %edx,%esi
+ b25:	89 d9                	mov    %ebx,%ecx
+ b27:	d3 e6                	shl    %cl,%esi
+ b29:	39 c6                	cmp    %eax,%esi
+ b2b:	72 f3                	jb     b20 <malloc+0x90>
+  if((p = partial[c]) == 0){
+ b2d:	8b 14 9d e8 0f 00 00 	mov    0xfe8(,%ebx,4),%edx
+ b34:	85 d2                	test   %edx,%edx
+ b36:	74 58                	je     b90 <malloc+0x100>
+  if((b = p->free) != 0){
+ b38:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ b3b:	8b 4a 08             	mov    0x8(%edx),%ecx
+  if((b = p->free) != 0){
+ b3e:	85 db                	test   %ebx,%ebx
+ b40:	0f 84 aa 00 00 00    	je     bf0 <malloc+0x160>
+    p->free = b->next;
+ b46:	8b 03                	mov    (%ebx),%eax
+ b48:	89 42 0c             	mov    %eax,0xc(%edx)
+  if(--p->nfree == 0)
+ b4b:	83 e9 01             	sub    $0x1,%ecx
+ b4e:	89 4a 08             	mov    %ecx,0x8(%edx)
+ b51:	75 83                	jne    ad6 <malloc+0x46>
+  if(p->prev)
+ b53:	8b 4a 18             	mov    0x18(%edx),%ecx
+    p->prev->next = p->next;
+ b56:	8b 42 14             	mov    0x14(%edx),%eax
+  if(p->prev)
+ b59:	85 c9                	test   %ecx,%ecx
+ b5b:	0f 84 cf 00 00 00    	je     c30 <malloc+0x1a0>
+    p->prev->next = p->next;
+ b61:	89 41 14             	mov    %eax,0x14(%ecx)
+  if(p->next)
+ b64:	85 c0                	test   %eax,%eax
+ b66:	0f 84 6a ff ff ff    	je     ad6 <malloc+0x46>
+    p->next->prev = p->prev;
+ b6c:	8b 52 18             	mov    0x18(%edx),%edx
+ b6f:	89 50 18             	mov    %edx,0x18(%eax)
+ b72:	e9 5f ff ff ff       	jmp    ad6 <malloc+0x46>
+ b77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b7e:	66 90                	xchg   %ax,%ax
+}
+ b80:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+ b83:	31 db                	xor    %ebx,%ebx
+}
+ b85:	89 d8                	mov    %ebx,%eax
+ b87:	5b                   	pop    %ebx
+ b88:	5e                   	pop    %esi
+ b89:	5d                   	pop    %ebp
+ b8a:	c3                   	ret
+ b8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b8f:	90                   	nop
+    if((p = runalloc(1)) == 0)
+ b90:	b8 01 00 00 00       	mov    $0x1,%eax
+ b95:	e8 e6 fc ff ff       	call   880 <runalloc>
+ b9a:	89 c2                	mov    %eax,%edx
+ b9c:	85 c0                	test   %eax,%eax
+ b9e:	74 e0                	je     b80 <malloc+0xf0>
+    p->kind = PSMALL;
+ ba0:	b8 01 00 00 00       	mov    $0x1,%eax
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ ba5:	8d 4b 04             	lea    0x4(%ebx),%ecx
+    p->class = c;
+ ba8:	66 89 5a 02          	mov    %bx,0x2(%edx)
+ bac:	0f b7 db             	movzwl %bx,%ebx
+    p->kind = PSMALL;
+ baf:	66 89 02             	mov    %ax,(%edx)
+    p->fresh = (char*)p + HDRSIZE;
+ bb2:	8d 42 20             	lea    0x20(%edx),%eax
+ bb5:	89 42 10             	mov    %eax,0x10(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ bb8:	b8 e0 0f 00 00       	mov    $0xfe0,%eax
+ bbd:	d3 f8                	sar    %cl,%eax
+    p->free = 0;
+ bbf:	c7 42 0c 00 00 00 00 	movl   $0x0,0xc(%edx)
+    p->nfree = nblocks(c);
+ bc6:	89 42 08             	mov    %eax,0x8(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ bc9:	89 c1                	mov    %eax,%ecx
+  p->next = partial[p->class];
+ bcb:	8b 04 9d e8 0f 00 00 	mov    0xfe8(,%ebx,4),%eax
+  p->prev = 0;
+ bd2:	c7 42 18 00 00 00 00 	movl   $0x0,0x18(%edx)
+  p->next = partial[p->class];
+ bd9:	89 42 14             	mov    %eax,0x14(%edx)
+  if(p->next)
+ bdc:	85 c0                	test   %eax,%eax
+ bde:	75 20                	jne    c00 <malloc+0x170>
+  partial[p->class] = p;
+ be0:	89 14 9d e8 0f 00 00 	mov    %edx,0xfe8(,%ebx,4)
+  if((b = p->free) != 0){
+ be7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bee:	66 90                	xchg   %ax,%ax
+    b = (struct block*)p->fresh;
+ bf0:	8b 5a 10             	mov    0x10(%edx),%ebx
+    p->fresh += MINSMALL << c;
+ bf3:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+ bf6:	89 42 10             	mov    %eax,0x10(%edx)
+ bf9:	e9 4d ff ff ff       	jmp    b4b <malloc+0xbb>
+ bfe:	66 90                	xchg   %ax,%ax
+    p->next->prev = p;
+ c00:	89 50 18             	mov    %edx,0x18(%eax)
+  partial[p->class] = p;
+ c03:	0f b7 42 02          	movzwl 0x2(%edx),%eax
+  if((b = p->free) != 0){
+ c07:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ c0a:	8b 4a 08             	mov    0x8(%edx),%ecx
+  partial[p->class] = p;
+ c0d:	89 14 85 e8 0f 00 00 	mov    %edx,0xfe8(,%eax,4)
+}
+ c14:	e9 25 ff ff ff       	jmp    b3e <malloc+0xae>
+ c19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ c20:	be 10 00 00 00       	mov    $0x10,%esi
+ c25:	31 db                	xor    %ebx,%ebx
+ c27:	e9 01 ff ff ff       	jmp    b2d <malloc+0x9d>
+ c2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ c30:	0f b7 4a 02          	movzwl 0x2(%edx),%ecx
+ c34:	89 04 8d e8 0f 00 00 	mov    %eax,0xfe8(,%ecx,4)
+ c3b:	e9 24 ff ff ff       	jmp    b64 <malloc+0xd4>
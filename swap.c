@@ -0,0 +1,153 @@
+// Swap space.
+//
+// When memory runs out, user pages that have not been used
+// recently are written to a swap area on the root disk, after
+// the file system (see sb.swapstart), and read back in by the
+// page fault handler. The area is divided into page-sized slots.
+//
+// A swapped-out page's PTE is not present and holds its slot
+// number in place of the physical address, marked PTE_SWAP
+// (see swapvictim in proc.c and swapin in vm.c).
+//
+// A slot is in use from swapout until the page is read back in
+// or its page table goes away. While the page is being written
+// to the slot it is busy, and swapin waits for the write to
+// finish before reading it back. swap.lock protects the slots.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+
+#define NSWAPSLOT (SWAPSIZE / (PGSIZE / BSIZE))
+
+// Slot states.
+#define SFREE     0
+#define SUSED     1
+#define SBUSY     2   // being written
+#define SBUSYFREE 3   // being written, free it when done
+
+struct {
+  struct spinlock lock;
+  int dev;
+  uint start;              // first block of the swap area
+  int nslot;               // slots that fit in the area
+  uchar state[NSWAPSLOT];
+} swap;
+
+void
+swapinit(int dev)
+{
+  struct superblock sb;
+
+  initlock(&swap.lock, "swap");
+  readsb(dev, &sb);
+  swap.dev = dev;
+  swap.start = sb.swapstart;
+  swap.nslot = sb.nswap / (PGSIZE / BSIZE);
+  if(swap.nslot > NSWAPSLOT)
+    swap.nslot = NSWAPSLOT;
+}
+
+// Read or write the page at mem from or to slot. The disk
+// moves the data straight to or from the page, through a
+// buf of swaprw's own: swap blocks are of no use to anyone
+// else, so they stay out of the buffer cache.
+static void
+swaprw(uint slot, char *mem, int write)
+{
+  struct buf b;
+  int i;
+
+  memset(&b, 0, sizeof(b));
+  initsleeplock(&b.lock, "swapbuf");
+  acquiresleep(&b.lock);
+  for(i = 0; i < PGSIZE / BSIZE; i++){
+    b.dev = swap.dev;
+    b.blockno = swap.start + slot * (PGSIZE / BSIZE) + i;
+    b.data = (uchar*)mem + i * BSIZE;
+    b.flags = write ? B_DIRTY : 0;
+    iderw(&b);
+  }
+  releasesleep(&b.lock);
+}
+
+// Write one cold user page out to swap and free it.
+// Returns 0 if a page was freed, -1 if swap is full or
+// no page could be found. Caller must not hold any locks.
+int
+swapout(void)
+{
+  uint slot;
+  char *mem;
+
+  acquire(&swap.lock);
+  for(slot = 0; slot < swap.nslot; slot++)
+    if(swap.state[slot] == SFREE)
+      break;
+  if(slot == swap.nslot){
+    release(&swap.lock);
+    return -1;
+  }
+  swap.state[slot] = SBUSY;
+  release(&swap.lock);
+
+  if((mem = swapvictim(slot)) == 0){
+    acquire(&swap.lock);
+    swap.state[slot] = SFREE;
+    release(&swap.lock);
+    return -1;
+  }
+  swaprw(slot, mem, 1);
+  kfree(mem);
+
+  acquire(&swap.lock);
+  swap.state[slot] = swap.state[slot] == SBUSYFREE ? SFREE : SUSED;
+  wakeup(&swap.state[slot]);
+  release(&swap.lock);
+  return 0;
+}
+
+// Read slot into the page at mem, waiting if it is still
+// being written, and leave the slot in use.
+void
+swappeek(uint slot, char *mem)
+{
+  acquire(&swap.lock);
+  while(swap.state[slot] == SBUSY)
+    sleep(&swap.state[slot], &swap.lock);
+  if(swap.state[slot] != SUSED)
+    panic("swappeek");
+  release(&swap.lock);
+
+  swaprw(slot, mem, 0);
+}
+
+// Read slot into the page at mem, waiting if it is still
+// being written, and free the slot.
+void
+swapread(uint slot, char *mem)
+{
+  swappeek(slot, mem);
+
+  acquire(&swap.lock);
+  swap.state[slot] = SFREE;
+  release(&swap.lock);
+}
+
+// Free slot, whose page is no longer wanted. Does not
+// sleep, so it may be called with locks held.
+void
+swapfree(uint slot)
+{
+  acquire(&swap.lock);
+  if(swap.state[slot] == SBUSY)
+    swap.state[slot] = SBUSYFREE;
+  else
+    swap.state[slot] = SFREE;
+  release(&swap.lock);
+}
@@ -17,9 +17,11 @@
 int
 fetchint(uint addr, int *ip)
 {
-  struct proc *curproc = myproc();
+  uint end;
 
-  if(addr >= curproc->sz || addr+4 > curproc->sz)
+  pinuvm(addr, 4);
+  end = uvaend(myproc(), addr);
+  if(addr >= end || addr+4 > end)
     return -1;
   *ip = *(int*)(addr);
   return 0;
@@ -32,12 +34,17 @@ int
 fetchstr(uint addr, char **pp)
 {
   char *s, *ep;
-  struct proc *curproc = myproc();
+  uint end = uvaend(myproc(), addr);
 
-  if(addr >= curproc->sz)
+  if(addr >= end)
+    return -1;
+  // The string's length is not known yet: keep all of the
+  // memory it may be in, and check it is still there.
+  pinuvm(addr, end - addr);
+  if(uvaend(myproc(), addr) < end)
     return -1;
   *pp = (char*)addr;
-  ep = (char*)curproc->sz;
+  ep = (char*)end;
   for(s = *pp; s < ep; s++){
     if(*s == 0)
       return s - *pp;
@@ -52,27 +59,48 @@ argint(int n, int *ip)
   return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
 }
 
-// Fetch the nth word-sized system call argument as a pointer
-// to a block of memory of size bytes.  Check that the pointer
-// lies within the process address space.
-int
-argptr(int n, char **pp, int size)
+static int
+argbuf(int n, char **pp, int size, int write)
 {
   int i;
-  struct proc *curproc = myproc();
+  uint end;
  
   if(argint(n, &i) < 0)
     return -1;
-  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+  end = uvaend(myproc(), i);
+  if(size < 0 || (uint)i >= end || (uint)i+size > end)
+    return -1;
+  // The kernel may use the buffer while holding a spinlock,
+  // when it cannot wait for a page to be read in.
+  if(touchuvm(i, size, write) < 0)
     return -1;
   *pp = (char*)i;
   return 0;
 }
 
+// Fetch the nth word-sized system call argument as a pointer
+// to a block of memory of size bytes.  Check that the pointer
+// lies within the process address space.
+int
+argptr(int n, char **pp, int size)
+{
+  return argbuf(n, pp, size, 0);
+}
+
+// Like argptr, for a block the kernel writes to: check that
+// the process may write it too. The kernel writes user memory
+// through the user's page table, so a read-only page would
+// make it fault.
+int
+argoutptr(int n, char **pp, int size)
+{
+  return argbuf(n, pp, size, 1);
+}
+
 // Fetch the nth word-sized system call argument as a string pointer.
 // Check that the pointer is valid and the string is nul-terminated.
-// (There is no shared writable memory, so the string can't change
-// between this check and being used by the kernel.)
+// (Only a string in a MAP_SHARED mapping, written by another
+// process, can change between this check and its use.)
 int
 argstr(int n, char **pp)
 {
@@ -112,6 +140,18 @@ extern int sys_cpause(void);
 extern int sys_cresume(void);
 extern int sys_cstop(void);
 extern int sys_cstart(void);
+extern int sys_mmap(void);
+extern int sys_munmap(void);
+extern int sys_shmget(void);
+extern int sys_climit(void);
+extern int sys_spawn(void);
+extern int sys_clone(void);
+extern int sys_join(void);
+extern int sys_futex(void);
+extern int sys_ccheckpoint(void);
+extern int sys_crestore(void);
+extern int sys_czygote(void);
+extern int sys_memstats(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]            sys_fork,
@@ -144,6 +184,18 @@ static int (*syscalls[])(void) = {
 [SYS_cresume]         sys_cresume,
 [SYS_cstart]          sys_cstart,
 [SYS_cstop]           sys_cstop,
+[SYS_mmap]            sys_mmap,
+[SYS_munmap]          sys_munmap,
+[SYS_shmget]          sys_shmget,
+[SYS_climit]          sys_climit,
+[SYS_spawn]           sys_spawn,
+[SYS_clone]           sys_clone,
+[SYS_join]            sys_join,
+[SYS_futex]           sys_futex,
+[SYS_ccheckpoint]     sys_ccheckpoint,
+[SYS_crestore]        sys_crestore,
+[SYS_czygote]         sys_czygote,
+[SYS_memstats]        sys_memstats,
 };
     
 void
@@ -154,7 +206,12 @@ syscall(void)
 
   num = curproc->tf->eax;
   if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
+    // The kernel may use the process's pages until the call
+    // returns, so they must stay in memory; see swapvictim().
+    curproc->insyscall = 1;
     curproc->tf->eax = syscalls[num]();
+    unpinuvm();
+    curproc->insyscall = 0;
   } else {
     cprintf("%d %s: unknown sys call %d\n",
             curproc->pid, curproc->name, num);
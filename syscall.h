@@ -28,4 +28,16 @@
 #define SYS_cresume        27
 #define SYS_cfork          28
 #define SYS_cgetrootdir    29
-#define SYS_getcontrootdir 30
\ No newline at end of file
+#define SYS_getcontrootdir 30
+#define SYS_mmap           31
+#define SYS_munmap         32
+#define SYS_shmget         33
+#define SYS_climit         34
+#define SYS_spawn          35
+#define SYS_clone          36
+#define SYS_join           37
+#define SYS_futex          38
+#define SYS_ccheckpoint    39
+#define SYS_crestore       40
+#define SYS_czygote        41
+#define SYS_memstats       42
@@ -15,6 +15,8 @@
 #include "sleeplock.h"
 #include "file.h"
 #include "fcntl.h"
+#include "mman.h"
+#include "spawn.h"
 
 // Fetch the nth word-sized system call argument as a file descriptor
 // and return both the descriptor and the corresponding struct file.
@@ -73,7 +75,7 @@ sys_read(void)
   int n;
   char *p;
 
-  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argoutptr(1, &p, n) < 0)
     return -1;
   return fileread(f, p, n);
 }
@@ -109,7 +111,7 @@ sys_fstat(void)
   struct file *f;
   struct stat *st;
 
-  if(argfd(0, 0, &f) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+  if(argfd(0, 0, &f) < 0 || argoutptr(1, (void*)&st, sizeof(*st)) < 0)
     return -1;
   return filestat(f, st);
 }
@@ -282,44 +284,39 @@ create(char *path, short type, short major, short minor)
   return ip;
 }
 
-int
-sys_open(void)
+// Open the file at path with omode and return a new
+// file for it, or 0 on failure.
+static struct file*
+openfile(char *path, int omode)
 {
-  char *path;
-  int fd, omode;
   struct file *f;
   struct inode *ip;
 
-  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
-    return -1;
-
   begin_op();
 
   if(omode & O_CREATE){
     ip = create(path, T_FILE, 0, 0);
     if(ip == 0){
       end_op();
-      return -1;
+      return 0;
     }
   } else {
     if((ip = namei(path)) == 0){
       end_op();
-      return -1;
+      return 0;
     }
     ilock(ip);
     if(ip->type == T_DIR && omode != O_RDONLY){
       iunlockput(ip);
       end_op();
-      return -1;
+      return 0;
     }
   }
 
-  if((f = filealloc()) == 0 || (fd = fdalloc(f)) < 0){
-    if(f)
-      fileclose(f);
+  if((f = filealloc()) == 0){
     iunlockput(ip);
     end_op();
-    return -1;
+    return 0;
   }
   iunlock(ip);
   end_op();
@@ -329,6 +326,24 @@ sys_open(void)
   f->off = 0;
   f->readable = !(omode & O_WRONLY);
   f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+  return f;
+}
+
+int
+sys_open(void)
+{
+  char *path;
+  int fd, omode;
+  struct file *f;
+
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+    return -1;
+  if((f = openfile(path, omode)) == 0)
+    return -1;
+  if((fd = fdalloc(f)) < 0){
+    fileclose(f);
+    return -1;
+  }
   return fd;
 }
 
@@ -397,32 +412,100 @@ sys_chdir(void)
   return 0;
 }
 
-int
-sys_exec(void)
+// Fetch the null-terminated array of strings at user address
+// uargv into argv, which has room for MAXARG pointers.
+static int
+fetchargv(uint uargv, char **argv)
 {
-  char *path, *argv[MAXARG];
   int i;
-  uint uargv, uarg;
+  uint uarg;
 
-  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
-    return -1;
-  }
-  memset(argv, 0, sizeof(argv));
+  memset(argv, 0, MAXARG*sizeof(argv[0]));
   for(i=0;; i++){
-    if(i >= NELEM(argv))
+    if(i >= MAXARG)
       return -1;
     if(fetchint(uargv+4*i, (int*)&uarg) < 0)
       return -1;
     if(uarg == 0){
       argv[i] = 0;
-      break;
+      return 0;
     }
     if(fetchstr(uarg, &argv[i]) < 0)
       return -1;
   }
+}
+
+int
+sys_exec(void)
+{
+  char *path, *argv[MAXARG];
+  uint uargv;
+
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0 ||
+     fetchargv(uargv, argv) < 0){
+    return -1;
+  }
   return exec(path, argv);
 }
 
+// Start a program in a new process: spawn(path, argv, act, nact,
+// cid). The child gets copies of the caller's open files, changed
+// by the nact file actions at act (see spawn.h), and goes into the
+// container with cid, or where fork would put it if cid is -1.
+// Returns the child's pid.
+int
+sys_spawn(void)
+{
+  char *path, *apath, *argv[MAXARG];
+  struct file *ofile[NOFILE], *f;
+  struct spawnact *act, *a;
+  struct proc *curproc = myproc();
+  int i, nact, cid, pid;
+  uint uargv;
+
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0 ||
+     fetchargv(uargv, argv) < 0 || argint(3, &nact) < 0 ||
+     nact < 0 || nact > SPAWN_MAXACT ||
+     argptr(2, (char**)&act, nact*sizeof(*act)) < 0 || argint(4, &cid) < 0)
+    return -1;
+
+  for(i = 0; i < NOFILE; i++)
+    ofile[i] = curproc->ofile[i] ? filedup(curproc->ofile[i]) : 0;
+  for(a = act; a < &act[nact]; a++){
+    if(a->fd < 0 || a->fd >= NOFILE)
+      goto bad;
+    switch(a->op){
+    case SPAWN_CLOSE:
+      f = 0;
+      break;
+    case SPAWN_DUP:
+      if(a->arg < 0 || a->arg >= NOFILE || ofile[a->arg] == 0)
+        goto bad;
+      f = filedup(ofile[a->arg]);
+      break;
+    case SPAWN_OPEN:
+      if(fetchstr((uint)a->path, &apath) < 0 || (f = openfile(apath, a->arg)) == 0)
+        goto bad;
+      break;
+    default:
+      goto bad;
+    }
+    if(ofile[a->fd])
+      fileclose(ofile[a->fd]);
+    ofile[a->fd] = f;
+  }
+
+  if((pid = spawn(path, argv, ofile, cid)) < 0)
+    goto bad;
+  return pid;
+
+ bad:
+  for(i = 0; i < NOFILE; i++)
+    if(ofile[i])
+      fileclose(ofile[i]);
+  return -1;
+}
+
 int
 sys_pipe(void)
 {
@@ -430,7 +513,7 @@ sys_pipe(void)
   struct file *rf, *wf;
   int fd0, fd1;
 
-  if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+  if(argoutptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
     return -1;
   if(pipealloc(&rf, &wf) < 0)
     return -1;
@@ -446,3 +529,108 @@ sys_pipe(void)
   fd[1] = fd1;
   return 0;
 }
+
+// Map len bytes of the file open as fd, starting at offset off,
+// or zero-filled memory for MAP_ANON, into the mmap area.
+// The address hint is ignored.
+int
+sys_mmap(void)
+{
+  int len, prot, flags, fd, off, vmflags, r;
+  uint filesz;
+  struct file *f;
+  struct inode *ip;
+  struct shm *s;
+
+  if(argint(1, &len) < 0 || argint(2, &prot) < 0 ||
+     argint(3, &flags) < 0 || argint(5, &off) < 0)
+    return -1;
+  if(len <= 0 || off < 0 || off % PGSIZE != 0)
+    return -1;
+  if(!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE))
+    return -1;
+  vmflags = 0;
+  if(prot & PROT_WRITE)
+    vmflags |= VM_WRITE;
+  if(flags & MAP_SHARED)
+    vmflags |= VM_SHARED;
+
+  if(flags & MAP_ANON){
+    // A shared mapping needs pages that stay put whoever
+    // touches them first, so it gets a segment of its own.
+    s = 0;
+    if((flags & MAP_SHARED) && (s = shmanon(len)) == 0)
+      return -1;
+    vmlock(myproc());
+    r = mmapuvm(0, s, 0, 0, len, vmflags);
+    vmunlock(myproc());
+    if(s)
+      shmput(s);
+    return r;
+  }
+
+  if(argfd(4, &fd, &f) < 0)
+    return -1;
+  if(f->type != FD_INODE || !f->readable)
+    return -1;
+  if((flags & MAP_SHARED) && (prot & PROT_WRITE) && !f->writable)
+    return -1;
+  ip = f->ip;
+  ilock(ip);
+  if(ip->type != T_FILE){
+    iunlock(ip);
+    return -1;
+  }
+  filesz = 0;
+  if(off < ip->size)
+    filesz = ip->size - off < len ? ip->size - off : len;
+  if(vmflags == (VM_WRITE|VM_SHARED))
+    ip->mapshared = 1;
+  iunlock(ip);
+  vmlock(myproc());
+  r = mmapuvm(ip, 0, off, filesz, len, vmflags);
+  vmunlock(myproc());
+  return r;
+}
+
+// Save the processes of a paused container to a new file:
+// ccheckpoint(name, path). See ckpt.c.
+int
+sys_ccheckpoint(void)
+{
+  char *name, *path;
+  struct file *f;
+  int r;
+
+  if(argstr(0, &name) < 0 || argstr(1, &path) < 0)
+    return -1;
+  if((f = openfile(path, O_CREATE|O_RDWR)) == 0)
+    return -1;
+  // Never write over an image: processes restored from
+  // it may still fault pages in from it.
+  ilock(f->ip);
+  r = f->ip->size == 0 ? 0 : -1;
+  iunlock(f->ip);
+  if(r == 0)
+    r = ccheckpoint(name, f);
+  fileclose(f);
+  return r;
+}
+
+// Start the processes saved in a file in a container:
+// crestore(name, path).
+int
+sys_crestore(void)
+{
+  char *name, *path;
+  struct file *f;
+  int r;
+
+  if(argstr(0, &name) < 0 || argstr(1, &path) < 0)
+    return -1;
+  if((f = openfile(path, O_RDONLY)) == 0)
+    return -1;
+  r = crestore(name, f);
+  fileclose(f);
+  return r;
+}
@@ -6,6 +6,8 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "futex.h"
+#include "memstats.h"
 
 int
 sys_fork(void)
@@ -50,7 +52,7 @@ sys_sbrk(void)
 
   if(argint(0, &n) < 0)
     return -1;
-  addr = myproc()->sz;
+  addr = myproc()->leader->sz;
   if(growproc(n) < 0)
     return -1;
   return addr;
@@ -90,6 +92,48 @@ sys_uptime(void)
   return xticks;
 }
 
+// Unmap the pages from addr to addr+len in the mmap area.
+int
+sys_munmap(void)
+{
+  int addr, len, r;
+  struct proc *curproc = myproc();
+
+  if(argint(0, &addr) < 0 || argint(1, &len) < 0)
+    return -1;
+  if(addr % PGSIZE != 0 || len <= 0)
+    return -1;
+  if((uint)addr < MMAPBASE || (uint)addr + len > KERNBASE ||
+     (uint)addr + len < (uint)addr)
+    return -1;
+  vmlockrange(curproc, addr, PGROUNDUP((uint)addr + len));
+  r = munmapuvm(curproc->pgdir, curproc->leader->vma, addr,
+                PGROUNDUP((uint)addr + len));
+  vmunlock(curproc);
+  return r;
+}
+
+// Map the shared memory segment called name, at least size
+// bytes long, creating it if this container has none by that
+// name. Unmap it with munmap().
+int
+sys_shmget(void)
+{
+  char *name;
+  int size, addr;
+  struct shm *s;
+
+  if(argstr(0, &name) < 0 || argint(1, &size) < 0 || size <= 0)
+    return -1;
+  if((s = shmget(name, size)) == 0)
+    return -1;
+  vmlock(myproc());
+  addr = mmapuvm(0, s, 0, 0, size, VM_WRITE|VM_SHARED);
+  vmunlock(myproc());
+  shmput(s);
+  return addr;
+}
+
 // Print process status on the console.
 int sys_cps(void) {
   return cps();
@@ -113,7 +157,7 @@ int sys_cfork(void) {
 
 int sys_cgetrootdir(void) {
   char *rootdir = 0;
-  if (argstr(0, &rootdir) < 0) {
+  if (argoutptr(0, &rootdir, sizeof(myproc()->cont->rootpath)) < 0) {
     return -1;
   }
   return cgetrootdir(rootdir);
@@ -122,7 +166,8 @@ int sys_cgetrootdir(void) {
 int sys_getcontrootdir(void) {
   char *cont_name = 0;
   char *rootdir = 0;
-  if (argstr(0, &cont_name) < 0 || argstr(1, &rootdir) < 0) {
+  if (argstr(0, &cont_name) < 0 ||
+      argoutptr(1, &rootdir, sizeof(myproc()->cont->rootpath)) < 0) {
     return -1;
   }
   return getcontrootdir(cont_name, rootdir);
@@ -152,10 +197,93 @@ int sys_cstop(void) {
   return cstop(cont_name);
 }
 
+int sys_climit(void) {
+  char *cont_name = 0;
+  int kb = 0;
+  if (argstr(0, &cont_name) < 0 || argint(1, &kb) < 0) {
+    return -1;
+  }
+  return climit(cont_name, kb);
+}
+
+int sys_czygote(void) {
+  char *cont_name = 0;
+  char *path = 0;
+  int n = 0;
+  if (argstr(0, &cont_name) < 0 || argstr(1, &path) < 0 || argint(2, &n) < 0) {
+    return -1;
+  }
+  return czygote(cont_name, path, n);
+}
+
 int sys_cresume(void) {
   char *cont_name = 0;
   if (argstr(0, &cont_name) < 0) {
     return -1;
   }
   return cresume(cont_name);
-}
\ No newline at end of file
+}
+
+// Sleep on or wake up sleepers on a user word: futex(addr, op, val).
+// See futex.c.
+int
+sys_futex(void)
+{
+  int addr, op, val;
+
+  if(argint(0, &addr) < 0 || argint(1, &op) < 0 || argint(2, &val) < 0)
+    return -1;
+  switch(op){
+  case FUTEX_WAIT:
+    return futexwait(addr, val);
+  case FUTEX_WAKE:
+    return futexwake(addr, val);
+  }
+  return -1;
+}
+
+// Start a thread running fn(arg) on the stack ending at stack:
+// clone(fn, arg, stack). Returns the thread's pid.
+int
+sys_clone(void)
+{
+  int fn, arg, stack;
+
+  if(argint(0, &fn) < 0 || argint(1, &arg) < 0 || argint(2, &stack) < 0)
+    return -1;
+  return clone(fn, arg, stack);
+}
+
+// Wait for a thread to exit: join(tid, &stack), where tid -1
+// means any thread. Returns the thread's pid and sets stack to
+// the stack given to clone, for the caller to free.
+int
+sys_join(void)
+{
+  int tid, pid;
+  uint *stack, s;
+
+  if(argint(0, &tid) < 0 || argoutptr(1, (char**)&stack, sizeof(*stack)) < 0)
+    return -1;
+  if((pid = join(tid, &s)) >= 0)
+    *stack = s;
+  return pid;
+}
+
+// Report memory use: memstats(ms, pm, n) fills in *ms and up
+// to n per-process entries of pm, and returns how many.
+int
+sys_memstats(void)
+{
+  struct memstats *ms;
+  struct procmem *pm;
+  int n;
+
+  if(argint(2, &n) < 0 || n < 0 || n > NCONT*NPROC ||
+     argoutptr(0, (char**)&ms, sizeof(*ms)) < 0 ||
+     argoutptr(1, (char**)&pm, n*sizeof(*pm)) < 0)
+    return -1;
+  kmemstats(ms);
+  bstats(ms);
+  return memstats(ms, pm, n);
+}
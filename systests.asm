@@ -0,0 +1,5017 @@
+
+_systests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(stdout, "swap test ok\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 04             	sub    $0x4,%esp
+  if(argc > 1 && strcmp(argv[1], "ckptchild") == 0)
+      11:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+      14:	8b 41 04             	mov    0x4(%ecx),%eax
+  if(argc > 1 && strcmp(argv[1], "ckptchild") == 0)
+      17:	7e 16                	jle    2f <main+0x2f>
+      19:	51                   	push   %ecx
+      1a:	51                   	push   %ecx
+      1b:	68 39 2f 00 00       	push   $0x2f39
+      20:	ff 70 04             	push   0x4(%eax)
+      23:	e8 98 1e 00 00       	call   1ec0 <strcmp>
+      28:	83 c4 10             	add    $0x10,%esp
+      2b:	85 c0                	test   %eax,%eax
+      2d:	74 54                	je     83 <main+0x83>
+    ckptchild();
+  printf(1, "systests starting\n");
+      2f:	83 ec 08             	sub    $0x8,%esp
+      32:	68 8d 30 00 00       	push   $0x308d
+      37:	6a 01                	push   $0x1
+      39:	e8 82 22 00 00       	call   22c0 <printf>
+
+  demandtest();
+      3e:	e8 1d 02 00 00       	call   260 <demandtest>
+  mmaptest();
+      43:	e8 08 03 00 00       	call   350 <mmaptest>
+  shmtest();
+      48:	e8 83 06 00 00       	call   6d0 <shmtest>
+  spawntest();
+      4d:	e8 4e 07 00 00       	call   7a0 <spawntest>
+  threadtest();
+      52:	e8 e9 08 00 00       	call   940 <threadtest>
+  racetest();
+      57:	e8 54 0a 00 00       	call   ab0 <racetest>
+  futextest();
+      5c:	e8 0f 0c 00 00       	call   c70 <futextest>
+  climittest();
+      61:	e8 9a 10 00 00       	call   1100 <climittest>
+  ckpttest();
+      66:	e8 55 16 00 00       	call   16c0 <ckpttest>
+  swaptest();  // last: it runs memory out
+      6b:	e8 f0 19 00 00       	call   1a60 <swaptest>
+
+  printf(1, "ALL SYSTEM TESTS PASSED\n");
+      70:	58                   	pop    %eax
+      71:	5a                   	pop    %edx
+      72:	68 a0 30 00 00       	push   $0x30a0
+      77:	6a 01                	push   $0x1
+      79:	e8 42 22 00 00       	call   22c0 <printf>
+  exit();
+      7e:	e8 90 20 00 00       	call   2113 <exit>
+    ckptchild();
+      83:	e8 38 14 00 00       	call   14c0 <ckptchild>
+      88:	66 90                	xchg   %ax,%ax
+      8a:	66 90                	xchg   %ax,%ax
+      8c:	66 90                	xchg   %ax,%ax
+      8e:	66 90                	xchg   %ax,%ax
+
+00000090 <racereader>:
+  while(!racedone){
+      90:	a1 08 3f 00 00       	mov    0x3f08,%eax
+      95:	85 c0                	test   %eax,%eax
+      97:	75 78                	jne    111 <racereader+0x81>
+{
+      99:	55                   	push   %ebp
+      9a:	89 e5                	mov    %esp,%ebp
+      9c:	53                   	push   %ebx
+      9d:	83 ec 04             	sub    $0x4,%esp
+      a0:	eb 48                	jmp    ea <racereader+0x5a>
+      a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    n = read(fd, rbuf, 4096);
+      a8:	a1 00 3f 00 00       	mov    0x3f00,%eax
+      ad:	83 ec 04             	sub    $0x4,%esp
+      b0:	68 00 10 00 00       	push   $0x1000
+      b5:	50                   	push   %eax
+      b6:	53                   	push   %ebx
+      b7:	e8 6f 20 00 00       	call   212b <read>
+    if(n != 4096 && n != -1)
+      bc:	83 c4 10             	add    $0x10,%esp
+      bf:	3d 00 10 00 00       	cmp    $0x1000,%eax
+      c4:	74 0f                	je     d5 <racereader+0x45>
+      c6:	83 f8 ff             	cmp    $0xffffffff,%eax
+      c9:	74 0a                	je     d5 <racereader+0x45>
+      racebad = 1;
+      cb:	c7 05 04 3f 00 00 01 	movl   $0x1,0x3f04
+      d2:	00 00 00 
+    close(fd);
+      d5:	83 ec 0c             	sub    $0xc,%esp
+      d8:	53                   	push   %ebx
+      d9:	e8 5d 20 00 00       	call   213b <close>
+  while(!racedone){
+      de:	a1 08 3f 00 00       	mov    0x3f08,%eax
+      e3:	83 c4 10             	add    $0x10,%esp
+      e6:	85 c0                	test   %eax,%eax
+      e8:	75 22                	jne    10c <racereader+0x7c>
+    if((fd = open("racefile", 0)) < 0){
+      ea:	83 ec 08             	sub    $0x8,%esp
+      ed:	6a 00                	push   $0x0
+      ef:	68 f0 2b 00 00       	push   $0x2bf0
+      f4:	e8 5a 20 00 00       	call   2153 <open>
+      f9:	83 c4 10             	add    $0x10,%esp
+      fc:	89 c3                	mov    %eax,%ebx
+      fe:	85 c0                	test   %eax,%eax
+     100:	79 a6                	jns    a8 <racereader+0x18>
+      racebad = 1;
+     102:	c7 05 04 3f 00 00 01 	movl   $0x1,0x3f04
+     109:	00 00 00 
+}
+     10c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     10f:	c9                   	leave
+     110:	c3                   	ret
+     111:	c3                   	ret
+     112:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     119:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000120 <threadfn>:
+{
+     120:	55                   	push   %ebp
+     121:	89 e5                	mov    %esp,%ebp
+     123:	8b 55 08             	mov    0x8(%ebp),%edx
+    tbuf[n][i] = n;
+     126:	89 d1                	mov    %edx,%ecx
+     128:	69 d2 e8 03 00 00    	imul   $0x3e8,%edx,%edx
+     12e:	8d 82 20 3f 00 00    	lea    0x3f20(%edx),%eax
+     134:	81 c2 08 43 00 00    	add    $0x4308,%edx
+     13a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     140:	88 08                	mov    %cl,(%eax)
+    __sync_fetch_and_add(&tcount, 1);
+     142:	f0 83 05 c0 4e 00 00 	lock addl $0x1,0x4ec0
+     149:	01 
+  for(i = 0; i < sizeof(tbuf[n]); i++){
+     14a:	83 c0 01             	add    $0x1,%eax
+     14d:	39 d0                	cmp    %edx,%eax
+     14f:	75 ef                	jne    140 <threadfn+0x20>
+}
+     151:	5d                   	pop    %ebp
+     152:	c3                   	ret
+     153:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     15a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000160 <fwaiter>:
+{
+     160:	55                   	push   %ebp
+     161:	89 e5                	mov    %esp,%ebp
+     163:	83 ec 0c             	sub    $0xc,%esp
+  __sync_fetch_and_add(&fready, 1);
+     166:	f0 83 05 f8 3e 00 00 	lock addl $0x1,0x3ef8
+     16d:	01 
+  futex(&fword, FUTEX_WAIT, 0);
+     16e:	6a 00                	push   $0x0
+     170:	6a 00                	push   $0x0
+     172:	68 fc 3e 00 00       	push   $0x3efc
+     177:	e8 77 20 00 00       	call   21f3 <futex>
+  __sync_fetch_and_add(&fwoken, 1);
+     17c:	f0 83 05 f4 3e 00 00 	lock addl $0x1,0x3ef4
+     183:	01 
+}
+     184:	83 c4 10             	add    $0x10,%esp
+     187:	c9                   	leave
+     188:	c3                   	ret
+     189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000190 <mworker>:
+{
+     190:	55                   	push   %ebp
+     191:	89 e5                	mov    %esp,%ebp
+     193:	53                   	push   %ebx
+     194:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+     199:	83 ec 04             	sub    $0x4,%esp
+     19c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&mlock);
+     1a0:	83 ec 0c             	sub    $0xc,%esp
+     1a3:	68 e8 3e 00 00       	push   $0x3ee8
+     1a8:	e8 e3 28 00 00       	call   2a90 <mutex_lock>
+    n = mcount;
+     1ad:	a1 f0 3e 00 00       	mov    0x3ef0,%eax
+    mcount = n + 1;
+     1b2:	83 c0 01             	add    $0x1,%eax
+     1b5:	a3 f0 3e 00 00       	mov    %eax,0x3ef0
+    mutex_unlock(&mlock);
+     1ba:	c7 04 24 e8 3e 00 00 	movl   $0x3ee8,(%esp)
+     1c1:	e8 5a 29 00 00       	call   2b20 <mutex_unlock>
+  for(i = 0; i < 1000; i++){
+     1c6:	83 c4 10             	add    $0x10,%esp
+     1c9:	83 eb 01             	sub    $0x1,%ebx
+     1cc:	75 d2                	jne    1a0 <mworker+0x10>
+}
+     1ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1d1:	c9                   	leave
+     1d2:	c3                   	ret
+     1d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000001e0 <producer>:
+{
+     1e0:	55                   	push   %ebp
+     1e1:	89 e5                	mov    %esp,%ebp
+     1e3:	53                   	push   %ebx
+  for(i = 1; i <= NITEM; i++){
+     1e4:	bb 01 00 00 00       	mov    $0x1,%ebx
+{
+     1e9:	83 ec 04             	sub    $0x4,%esp
+     1ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&mlock);
+     1f0:	83 ec 0c             	sub    $0xc,%esp
+     1f3:	68 e8 3e 00 00       	push   $0x3ee8
+     1f8:	e8 93 28 00 00       	call   2a90 <mutex_lock>
+    while(item != 0)
+     1fd:	a1 ec 3e 00 00       	mov    0x3eec,%eax
+     202:	83 c4 10             	add    $0x10,%esp
+     205:	85 c0                	test   %eax,%eax
+     207:	74 25                	je     22e <producer+0x4e>
+     209:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      cond_wait(&notfull, &mlock);
+     210:	83 ec 08             	sub    $0x8,%esp
+     213:	68 e8 3e 00 00       	push   $0x3ee8
+     218:	68 e4 3e 00 00       	push   $0x3ee4
+     21d:	e8 3e 29 00 00       	call   2b60 <cond_wait>
+    while(item != 0)
+     222:	a1 ec 3e 00 00       	mov    0x3eec,%eax
+     227:	83 c4 10             	add    $0x10,%esp
+     22a:	85 c0                	test   %eax,%eax
+     22c:	75 e2                	jne    210 <producer+0x30>
+    cond_signal(&notempty);
+     22e:	83 ec 0c             	sub    $0xc,%esp
+    item = i;
+     231:	89 1d ec 3e 00 00    	mov    %ebx,0x3eec
+  for(i = 1; i <= NITEM; i++){
+     237:	83 c3 01             	add    $0x1,%ebx
+    cond_signal(&notempty);
+     23a:	68 e0 3e 00 00       	push   $0x3ee0
+     23f:	e8 6c 29 00 00       	call   2bb0 <cond_signal>
+    mutex_unlock(&mlock);
+     244:	c7 04 24 e8 3e 00 00 	movl   $0x3ee8,(%esp)
+     24b:	e8 d0 28 00 00       	call   2b20 <mutex_unlock>
+  for(i = 1; i <= NITEM; i++){
+     250:	83 c4 10             	add    $0x10,%esp
+     253:	83 fb 65             	cmp    $0x65,%ebx
+     256:	75 98                	jne    1f0 <producer+0x10>
+}
+     258:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     25b:	c9                   	leave
+     25c:	c3                   	ret
+     25d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000260 <demandtest>:
+{
+     260:	55                   	push   %ebp
+     261:	89 e5                	mov    %esp,%ebp
+     263:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "demand paging test\n");
+     266:	68 f9 2b 00 00       	push   $0x2bf9
+     26b:	ff 35 c0 3e 00 00    	push   0x3ec0
+     271:	e8 4a 20 00 00       	call   22c0 <printf>
+  pid = fork();
+     276:	e8 90 1e 00 00       	call   210b <fork>
+  if(pid < 0){
+     27b:	83 c4 10             	add    $0x10,%esp
+     27e:	85 c0                	test   %eax,%eax
+     280:	0f 88 b0 00 00 00    	js     336 <demandtest+0xd6>
+  if(pid == 0){
+     286:	74 50                	je     2d8 <demandtest+0x78>
+  wait();
+     288:	e8 8e 1e 00 00       	call   211b <wait>
+  if(cowdata[0] != 1 || cowdata[sizeof(cowdata)/sizeof(cowdata[0])-1] != 0){
+     28d:	83 3d 80 3e 00 00 01 	cmpl   $0x1,0x3e80
+     294:	0f 85 85 00 00 00    	jne    31f <demandtest+0xbf>
+     29a:	8b 15 bc 3e 00 00    	mov    0x3ebc,%edx
+     2a0:	85 d2                	test   %edx,%edx
+     2a2:	75 7b                	jne    31f <demandtest+0xbf>
+  cowdata[0] = 2;
+     2a4:	c7 05 80 3e 00 00 02 	movl   $0x2,0x3e80
+     2ab:	00 00 00 
+  pid = fork();
+     2ae:	e8 58 1e 00 00       	call   210b <fork>
+  if(pid == 0){
+     2b3:	85 c0                	test   %eax,%eax
+     2b5:	75 41                	jne    2f8 <demandtest+0x98>
+    if(cowdata[0] != 2){
+     2b7:	83 3d 80 3e 00 00 02 	cmpl   $0x2,0x3e80
+     2be:	74 30                	je     2f0 <demandtest+0x90>
+      printf(stdout, "demand paging test failed: parent write lost\n");
+     2c0:	83 ec 08             	sub    $0x8,%esp
+     2c3:	68 ec 30 00 00       	push   $0x30ec
+     2c8:	ff 35 c0 3e 00 00    	push   0x3ec0
+     2ce:	e8 ed 1f 00 00       	call   22c0 <printf>
+      exit();
+     2d3:	e8 3b 1e 00 00       	call   2113 <exit>
+      cowdata[i] = 99;
+     2d8:	c7 04 85 80 3e 00 00 	movl   $0x63,0x3e80(,%eax,4)
+     2df:	63 00 00 00 
+    for(i = 0; i < sizeof(cowdata)/sizeof(cowdata[0]); i++)
+     2e3:	83 c0 01             	add    $0x1,%eax
+     2e6:	83 f8 10             	cmp    $0x10,%eax
+     2e9:	75 ed                	jne    2d8 <demandtest+0x78>
+     2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2ef:	90                   	nop
+    exit();
+     2f0:	e8 1e 1e 00 00       	call   2113 <exit>
+     2f5:	8d 76 00             	lea    0x0(%esi),%esi
+  wait();
+     2f8:	e8 1e 1e 00 00       	call   211b <wait>
+  printf(stdout, "demand paging test ok\n");
+     2fd:	83 ec 08             	sub    $0x8,%esp
+  cowdata[0] = 1;
+     300:	c7 05 80 3e 00 00 01 	movl   $0x1,0x3e80
+     307:	00 00 00 
+  printf(stdout, "demand paging test ok\n");
+     30a:	68 0d 2c 00 00       	push   $0x2c0d
+     30f:	ff 35 c0 3e 00 00    	push   0x3ec0
+     315:	e8 a6 1f 00 00       	call   22c0 <printf>
+}
+     31a:	83 c4 10             	add    $0x10,%esp
+     31d:	c9                   	leave
+     31e:	c3                   	ret
+    printf(stdout, "demand paging test failed: child write visible\n");
+     31f:	50                   	push   %eax
+     320:	50                   	push   %eax
+     321:	68 bc 30 00 00       	push   $0x30bc
+     326:	ff 35 c0 3e 00 00    	push   0x3ec0
+     32c:	e8 8f 1f 00 00       	call   22c0 <printf>
+    exit();
+     331:	e8 dd 1d 00 00       	call   2113 <exit>
+    printf(stdout, "fork failed\n");
+     336:	51                   	push   %ecx
+     337:	51                   	push   %ecx
+     338:	68 ef 2e 00 00       	push   $0x2eef
+     33d:	ff 35 c0 3e 00 00    	push   0x3ec0
+     343:	e8 78 1f 00 00       	call   22c0 <printf>
+    exit();
+     348:	e8 c6 1d 00 00       	call   2113 <exit>
+     34d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000350 <mmaptest>:
+{
+     350:	55                   	push   %ebp
+     351:	89 e5                	mov    %esp,%ebp
+     353:	57                   	push   %edi
+     354:	56                   	push   %esi
+     355:	53                   	push   %ebx
+     356:	83 ec 14             	sub    $0x14,%esp
+  printf(stdout, "mmap test\n");
+     359:	68 24 2c 00 00       	push   $0x2c24
+     35e:	ff 35 c0 3e 00 00    	push   0x3ec0
+     364:	e8 57 1f 00 00       	call   22c0 <printf>
+  memset(buf, 'a', 4096);
+     369:	83 c4 0c             	add    $0xc,%esp
+     36c:	68 00 10 00 00       	push   $0x1000
+     371:	6a 61                	push   $0x61
+     373:	68 e0 4e 00 00       	push   $0x4ee0
+     378:	e8 d3 1b 00 00       	call   1f50 <memset>
+  fd = open("mmapfile", O_CREATE|O_RDWR);
+     37d:	58                   	pop    %eax
+     37e:	5a                   	pop    %edx
+     37f:	68 02 02 00 00       	push   $0x202
+     384:	68 2f 2c 00 00       	push   $0x2c2f
+     389:	e8 c5 1d 00 00       	call   2153 <open>
+  if(fd < 0 || write(fd, buf, 4096) != 4096){
+     38e:	83 c4 10             	add    $0x10,%esp
+     391:	85 c0                	test   %eax,%eax
+     393:	0f 88 df 02 00 00    	js     678 <mmaptest+0x328>
+     399:	83 ec 04             	sub    $0x4,%esp
+     39c:	89 c3                	mov    %eax,%ebx
+     39e:	68 00 10 00 00       	push   $0x1000
+     3a3:	68 e0 4e 00 00       	push   $0x4ee0
+     3a8:	50                   	push   %eax
+     3a9:	e8 85 1d 00 00       	call   2133 <write>
+     3ae:	83 c4 10             	add    $0x10,%esp
+     3b1:	3d 00 10 00 00       	cmp    $0x1000,%eax
+     3b6:	0f 85 bc 02 00 00    	jne    678 <mmaptest+0x328>
+  p = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+     3bc:	83 ec 08             	sub    $0x8,%esp
+     3bf:	6a 00                	push   $0x0
+     3c1:	53                   	push   %ebx
+     3c2:	6a 01                	push   $0x1
+     3c4:	6a 03                	push   $0x3
+     3c6:	68 00 10 00 00       	push   $0x1000
+     3cb:	6a 00                	push   $0x0
+     3cd:	e8 e9 1d 00 00       	call   21bb <mmap>
+  if(p == MAP_FAILED || p[4095] != 'a'){
+     3d2:	83 c4 20             	add    $0x20,%esp
+  p = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+     3d5:	89 c6                	mov    %eax,%esi
+  if(p == MAP_FAILED || p[4095] != 'a'){
+     3d7:	83 f8 ff             	cmp    $0xffffffff,%eax
+     3da:	0f 84 53 02 00 00    	je     633 <mmaptest+0x2e3>
+     3e0:	80 b8 ff 0f 00 00 61 	cmpb   $0x61,0xfff(%eax)
+     3e7:	0f 85 46 02 00 00    	jne    633 <mmaptest+0x2e3>
+  fd2 = open("mmapfile", 0);
+     3ed:	83 ec 08             	sub    $0x8,%esp
+  p[0] = 'b';
+     3f0:	c6 00 62             	movb   $0x62,(%eax)
+  fd2 = open("mmapfile", 0);
+     3f3:	6a 00                	push   $0x0
+     3f5:	68 2f 2c 00 00       	push   $0x2c2f
+     3fa:	e8 54 1d 00 00       	call   2153 <open>
+  if(fd2 < 0 || read(fd2, buf, 1) != 1 || buf[0] != 'b'){
+     3ff:	83 c4 10             	add    $0x10,%esp
+  fd2 = open("mmapfile", 0);
+     402:	89 c7                	mov    %eax,%edi
+  if(fd2 < 0 || read(fd2, buf, 1) != 1 || buf[0] != 'b'){
+     404:	85 c0                	test   %eax,%eax
+     406:	0f 88 df 01 00 00    	js     5eb <mmaptest+0x29b>
+     40c:	83 ec 04             	sub    $0x4,%esp
+     40f:	6a 01                	push   $0x1
+     411:	68 e0 4e 00 00       	push   $0x4ee0
+     416:	50                   	push   %eax
+     417:	e8 0f 1d 00 00       	call   212b <read>
+     41c:	83 c4 10             	add    $0x10,%esp
+     41f:	83 f8 01             	cmp    $0x1,%eax
+     422:	0f 85 c3 01 00 00    	jne    5eb <mmaptest+0x29b>
+     428:	80 3d e0 4e 00 00 62 	cmpb   $0x62,0x4ee0
+     42f:	0f 85 b6 01 00 00    	jne    5eb <mmaptest+0x29b>
+  close(fd2);
+     435:	83 ec 0c             	sub    $0xc,%esp
+     438:	57                   	push   %edi
+     439:	e8 fd 1c 00 00       	call   213b <close>
+  munmap(p, 4096);
+     43e:	58                   	pop    %eax
+     43f:	5a                   	pop    %edx
+     440:	68 00 10 00 00       	push   $0x1000
+     445:	56                   	push   %esi
+     446:	e8 78 1d 00 00       	call   21c3 <munmap>
+  p = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+     44b:	59                   	pop    %ecx
+     44c:	5e                   	pop    %esi
+     44d:	6a 00                	push   $0x0
+     44f:	53                   	push   %ebx
+     450:	6a 02                	push   $0x2
+     452:	6a 03                	push   $0x3
+     454:	68 00 10 00 00       	push   $0x1000
+     459:	6a 00                	push   $0x0
+     45b:	e8 5b 1d 00 00       	call   21bb <mmap>
+  if(p == MAP_FAILED || p[0] != 'b'){
+     460:	83 c4 20             	add    $0x20,%esp
+     463:	83 f8 ff             	cmp    $0xffffffff,%eax
+     466:	0f 84 f5 01 00 00    	je     661 <mmaptest+0x311>
+     46c:	80 38 62             	cmpb   $0x62,(%eax)
+     46f:	0f 85 ec 01 00 00    	jne    661 <mmaptest+0x311>
+  munmap(p, 4096);
+     475:	83 ec 08             	sub    $0x8,%esp
+  p[0] = 'c';
+     478:	c6 00 63             	movb   $0x63,(%eax)
+  munmap(p, 4096);
+     47b:	68 00 10 00 00       	push   $0x1000
+     480:	50                   	push   %eax
+     481:	e8 3d 1d 00 00       	call   21c3 <munmap>
+  close(fd);
+     486:	89 1c 24             	mov    %ebx,(%esp)
+     489:	e8 ad 1c 00 00       	call   213b <close>
+  fd = open("mmapfile", 0);
+     48e:	5b                   	pop    %ebx
+     48f:	5e                   	pop    %esi
+     490:	6a 00                	push   $0x0
+     492:	68 2f 2c 00 00       	push   $0x2c2f
+     497:	e8 b7 1c 00 00       	call   2153 <open>
+  if(read(fd, buf, 1) != 1 || buf[0] != 'b'){
+     49c:	83 c4 0c             	add    $0xc,%esp
+     49f:	6a 01                	push   $0x1
+  fd = open("mmapfile", 0);
+     4a1:	89 c3                	mov    %eax,%ebx
+  if(read(fd, buf, 1) != 1 || buf[0] != 'b'){
+     4a3:	68 e0 4e 00 00       	push   $0x4ee0
+     4a8:	50                   	push   %eax
+     4a9:	e8 7d 1c 00 00       	call   212b <read>
+     4ae:	83 c4 10             	add    $0x10,%esp
+     4b1:	83 f8 01             	cmp    $0x1,%eax
+     4b4:	0f 85 90 01 00 00    	jne    64a <mmaptest+0x2fa>
+     4ba:	80 3d e0 4e 00 00 62 	cmpb   $0x62,0x4ee0
+     4c1:	0f 85 83 01 00 00    	jne    64a <mmaptest+0x2fa>
+  p = mmap(0, 4096, PROT_READ, MAP_PRIVATE, fd, 0);
+     4c7:	83 ec 08             	sub    $0x8,%esp
+     4ca:	6a 00                	push   $0x0
+     4cc:	53                   	push   %ebx
+     4cd:	6a 02                	push   $0x2
+     4cf:	6a 01                	push   $0x1
+     4d1:	68 00 10 00 00       	push   $0x1000
+     4d6:	6a 00                	push   $0x0
+     4d8:	e8 de 1c 00 00       	call   21bb <mmap>
+  if(p == MAP_FAILED || read(fd, p, 1) != -1 || p[0] != 'b'){
+     4dd:	83 c4 20             	add    $0x20,%esp
+  p = mmap(0, 4096, PROT_READ, MAP_PRIVATE, fd, 0);
+     4e0:	89 c6                	mov    %eax,%esi
+  if(p == MAP_FAILED || read(fd, p, 1) != -1 || p[0] != 'b'){
+     4e2:	83 f8 ff             	cmp    $0xffffffff,%eax
+     4e5:	0f 84 30 01 00 00    	je     61b <mmaptest+0x2cb>
+     4eb:	83 ec 04             	sub    $0x4,%esp
+     4ee:	6a 01                	push   $0x1
+     4f0:	50                   	push   %eax
+     4f1:	53                   	push   %ebx
+     4f2:	e8 34 1c 00 00       	call   212b <read>
+     4f7:	83 c4 10             	add    $0x10,%esp
+     4fa:	83 f8 ff             	cmp    $0xffffffff,%eax
+     4fd:	0f 85 18 01 00 00    	jne    61b <mmaptest+0x2cb>
+     503:	80 3e 62             	cmpb   $0x62,(%esi)
+     506:	0f 85 0f 01 00 00    	jne    61b <mmaptest+0x2cb>
+  munmap(p, 4096);
+     50c:	83 ec 08             	sub    $0x8,%esp
+     50f:	68 00 10 00 00       	push   $0x1000
+     514:	56                   	push   %esi
+     515:	e8 a9 1c 00 00       	call   21c3 <munmap>
+  p = mmap(0, 4096, PROT_READ, MAP_PRIVATE|MAP_ANON, -1, 0);
+     51a:	58                   	pop    %eax
+     51b:	5a                   	pop    %edx
+     51c:	6a 00                	push   $0x0
+     51e:	6a ff                	push   $0xffffffff
+     520:	6a 22                	push   $0x22
+     522:	6a 01                	push   $0x1
+     524:	68 00 10 00 00       	push   $0x1000
+     529:	6a 00                	push   $0x0
+     52b:	e8 8b 1c 00 00       	call   21bb <mmap>
+  if(p == MAP_FAILED || read(fd, p, 1) != -1 || p[0] != 0){
+     530:	83 c4 20             	add    $0x20,%esp
+  p = mmap(0, 4096, PROT_READ, MAP_PRIVATE|MAP_ANON, -1, 0);
+     533:	89 c6                	mov    %eax,%esi
+  if(p == MAP_FAILED || read(fd, p, 1) != -1 || p[0] != 0){
+     535:	83 f8 ff             	cmp    $0xffffffff,%eax
+     538:	0f 84 c5 00 00 00    	je     603 <mmaptest+0x2b3>
+     53e:	83 ec 04             	sub    $0x4,%esp
+     541:	6a 01                	push   $0x1
+     543:	50                   	push   %eax
+     544:	53                   	push   %ebx
+     545:	e8 e1 1b 00 00       	call   212b <read>
+     54a:	83 c4 10             	add    $0x10,%esp
+     54d:	83 f8 ff             	cmp    $0xffffffff,%eax
+     550:	0f 85 ad 00 00 00    	jne    603 <mmaptest+0x2b3>
+     556:	80 3e 00             	cmpb   $0x0,(%esi)
+     559:	0f 85 a4 00 00 00    	jne    603 <mmaptest+0x2b3>
+  munmap(p, 4096);
+     55f:	83 ec 08             	sub    $0x8,%esp
+     562:	68 00 10 00 00       	push   $0x1000
+     567:	56                   	push   %esi
+     568:	e8 56 1c 00 00       	call   21c3 <munmap>
+  close(fd);
+     56d:	89 1c 24             	mov    %ebx,(%esp)
+     570:	e8 c6 1b 00 00       	call   213b <close>
+  unlink("mmapfile");
+     575:	c7 04 24 2f 2c 00 00 	movl   $0x2c2f,(%esp)
+     57c:	e8 e2 1b 00 00       	call   2163 <unlink>
+  p = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANON, -1, 0);
+     581:	5e                   	pop    %esi
+     582:	5f                   	pop    %edi
+     583:	6a 00                	push   $0x0
+     585:	6a ff                	push   $0xffffffff
+     587:	6a 21                	push   $0x21
+     589:	6a 03                	push   $0x3
+     58b:	68 00 10 00 00       	push   $0x1000
+     590:	6a 00                	push   $0x0
+     592:	e8 24 1c 00 00       	call   21bb <mmap>
+  if(p == MAP_FAILED){
+     597:	83 c4 20             	add    $0x20,%esp
+  p = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANON, -1, 0);
+     59a:	89 c3                	mov    %eax,%ebx
+  if(p == MAP_FAILED){
+     59c:	83 f8 ff             	cmp    $0xffffffff,%eax
+     59f:	0f 84 09 01 00 00    	je     6ae <mmaptest+0x35e>
+  pid = fork();
+     5a5:	e8 61 1b 00 00       	call   210b <fork>
+  if(pid == 0){
+     5aa:	85 c0                	test   %eax,%eax
+     5ac:	0f 84 f4 00 00 00    	je     6a6 <mmaptest+0x356>
+  wait();
+     5b2:	e8 64 1b 00 00       	call   211b <wait>
+  if(p[0] != 7){
+     5b7:	80 3b 07             	cmpb   $0x7,(%ebx)
+     5ba:	0f 85 cf 00 00 00    	jne    68f <mmaptest+0x33f>
+  munmap(p, 4096);
+     5c0:	83 ec 08             	sub    $0x8,%esp
+     5c3:	68 00 10 00 00       	push   $0x1000
+     5c8:	53                   	push   %ebx
+     5c9:	e8 f5 1b 00 00       	call   21c3 <munmap>
+  printf(stdout, "mmap test ok\n");
+     5ce:	58                   	pop    %eax
+     5cf:	5a                   	pop    %edx
+     5d0:	68 aa 2c 00 00       	push   $0x2caa
+     5d5:	ff 35 c0 3e 00 00    	push   0x3ec0
+     5db:	e8 e0 1c 00 00       	call   22c0 <printf>
+}
+     5e0:	83 c4 10             	add    $0x10,%esp
+     5e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     5e6:	5b                   	pop    %ebx
+     5e7:	5e                   	pop    %esi
+     5e8:	5f                   	pop    %edi
+     5e9:	5d                   	pop    %ebp
+     5ea:	c3                   	ret
+    printf(stdout, "mmap test: read missed shared store\n");
+     5eb:	83 ec 08             	sub    $0x8,%esp
+     5ee:	68 1c 31 00 00       	push   $0x311c
+     5f3:	ff 35 c0 3e 00 00    	push   0x3ec0
+     5f9:	e8 c2 1c 00 00       	call   22c0 <printf>
+    exit();
+     5fe:	e8 10 1b 00 00       	call   2113 <exit>
+    printf(stdout, "mmap test: read into read-only anon mapping\n");
+     603:	83 ec 08             	sub    $0x8,%esp
+     606:	68 9c 31 00 00       	push   $0x319c
+     60b:	ff 35 c0 3e 00 00    	push   0x3ec0
+     611:	e8 aa 1c 00 00       	call   22c0 <printf>
+    exit();
+     616:	e8 f8 1a 00 00       	call   2113 <exit>
+    printf(stdout, "mmap test: read into read-only file mapping\n");
+     61b:	83 ec 08             	sub    $0x8,%esp
+     61e:	68 6c 31 00 00       	push   $0x316c
+     623:	ff 35 c0 3e 00 00    	push   0x3ec0
+     629:	e8 92 1c 00 00       	call   22c0 <printf>
+    exit();
+     62e:	e8 e0 1a 00 00       	call   2113 <exit>
+    printf(stdout, "mmap test: shared map failed\n");
+     633:	57                   	push   %edi
+     634:	57                   	push   %edi
+     635:	68 52 2c 00 00       	push   $0x2c52
+     63a:	ff 35 c0 3e 00 00    	push   0x3ec0
+     640:	e8 7b 1c 00 00       	call   22c0 <printf>
+    exit();
+     645:	e8 c9 1a 00 00       	call   2113 <exit>
+    printf(stdout, "mmap test: private write reached file\n");
+     64a:	51                   	push   %ecx
+     64b:	51                   	push   %ecx
+     64c:	68 44 31 00 00       	push   $0x3144
+     651:	ff 35 c0 3e 00 00    	push   0x3ec0
+     657:	e8 64 1c 00 00       	call   22c0 <printf>
+    exit();
+     65c:	e8 b2 1a 00 00       	call   2113 <exit>
+    printf(stdout, "mmap test: shared write lost\n");
+     661:	57                   	push   %edi
+     662:	57                   	push   %edi
+     663:	68 70 2c 00 00       	push   $0x2c70
+     668:	ff 35 c0 3e 00 00    	push   0x3ec0
+     66e:	e8 4d 1c 00 00       	call   22c0 <printf>
+    exit();
+     673:	e8 9b 1a 00 00       	call   2113 <exit>
+    printf(stdout, "mmap test: create failed\n");
+     678:	50                   	push   %eax
+     679:	50                   	push   %eax
+     67a:	68 38 2c 00 00       	push   $0x2c38
+     67f:	ff 35 c0 3e 00 00    	push   0x3ec0
+     685:	e8 36 1c 00 00       	call   22c0 <printf>
+    exit();
+     68a:	e8 84 1a 00 00       	call   2113 <exit>
+    printf(stdout, "mmap test: shared page not shared\n");
+     68f:	51                   	push   %ecx
+     690:	51                   	push   %ecx
+     691:	68 cc 31 00 00       	push   $0x31cc
+     696:	ff 35 c0 3e 00 00    	push   0x3ec0
+     69c:	e8 1f 1c 00 00       	call   22c0 <printf>
+    exit();
+     6a1:	e8 6d 1a 00 00       	call   2113 <exit>
+    p[0] = 7;
+     6a6:	c6 03 07             	movb   $0x7,(%ebx)
+    exit();
+     6a9:	e8 65 1a 00 00       	call   2113 <exit>
+    printf(stdout, "mmap test: anon map failed\n");
+     6ae:	53                   	push   %ebx
+     6af:	53                   	push   %ebx
+     6b0:	68 8e 2c 00 00       	push   $0x2c8e
+     6b5:	ff 35 c0 3e 00 00    	push   0x3ec0
+     6bb:	e8 00 1c 00 00       	call   22c0 <printf>
+    exit();
+     6c0:	e8 4e 1a 00 00       	call   2113 <exit>
+     6c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006d0 <shmtest>:
+{
+     6d0:	55                   	push   %ebp
+     6d1:	89 e5                	mov    %esp,%ebp
+     6d3:	53                   	push   %ebx
+     6d4:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "shm test\n");
+     6d7:	68 b8 2c 00 00       	push   $0x2cb8
+     6dc:	ff 35 c0 3e 00 00    	push   0x3ec0
+     6e2:	e8 d9 1b 00 00       	call   22c0 <printf>
+  p = shmget("shmtest", 4096);
+     6e7:	58                   	pop    %eax
+     6e8:	5a                   	pop    %edx
+     6e9:	68 00 10 00 00       	push   $0x1000
+     6ee:	68 c2 2c 00 00       	push   $0x2cc2
+     6f3:	e8 d3 1a 00 00       	call   21cb <shmget>
+  if(p == (char*)-1){
+     6f8:	83 c4 10             	add    $0x10,%esp
+     6fb:	83 f8 ff             	cmp    $0xffffffff,%eax
+     6fe:	74 63                	je     763 <shmtest+0x93>
+     700:	89 c3                	mov    %eax,%ebx
+  if(fork() == 0){
+     702:	e8 04 1a 00 00       	call   210b <fork>
+     707:	85 c0                	test   %eax,%eax
+     709:	75 25                	jne    730 <shmtest+0x60>
+    q = shmget("shmtest", 100);
+     70b:	83 ec 08             	sub    $0x8,%esp
+     70e:	6a 64                	push   $0x64
+     710:	68 c2 2c 00 00       	push   $0x2cc2
+     715:	e8 b1 1a 00 00       	call   21cb <shmget>
+    if(q == (char*)-1)
+     71a:	83 c4 10             	add    $0x10,%esp
+     71d:	83 f8 ff             	cmp    $0xffffffff,%eax
+     720:	74 04                	je     726 <shmtest+0x56>
+    q[10] = 42;
+     722:	c6 40 0a 2a          	movb   $0x2a,0xa(%eax)
+    exit();
+     726:	e8 e8 19 00 00       	call   2113 <exit>
+     72b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     72f:	90                   	nop
+  wait();
+     730:	e8 e6 19 00 00       	call   211b <wait>
+  if(p[10] != 42){
+     735:	80 7b 0a 2a          	cmpb   $0x2a,0xa(%ebx)
+     739:	75 3f                	jne    77a <shmtest+0xaa>
+  munmap(p, 4096);
+     73b:	83 ec 08             	sub    $0x8,%esp
+     73e:	68 00 10 00 00       	push   $0x1000
+     743:	53                   	push   %ebx
+     744:	e8 7a 1a 00 00       	call   21c3 <munmap>
+  printf(stdout, "shm test ok\n");
+     749:	58                   	pop    %eax
+     74a:	5a                   	pop    %edx
+     74b:	68 f4 2c 00 00       	push   $0x2cf4
+     750:	ff 35 c0 3e 00 00    	push   0x3ec0
+     756:	e8 65 1b 00 00       	call   22c0 <printf>
+}
+     75b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     75e:	83 c4 10             	add    $0x10,%esp
+     761:	c9                   	leave
+     762:	c3                   	ret
+    printf(stdout, "shm test: shmget failed\n");
+     763:	53                   	push   %ebx
+     764:	53                   	push   %ebx
+     765:	68 ca 2c 00 00       	push   $0x2cca
+     76a:	ff 35 c0 3e 00 00    	push   0x3ec0
+     770:	e8 4b 1b 00 00       	call   22c0 <printf>
+    exit();
+     775:	e8 99 19 00 00       	call   2113 <exit>
+    printf(stdout, "shm test failed\n");
+     77a:	51                   	push   %ecx
+     77b:	51                   	push   %ecx
+     77c:	68 e3 2c 00 00       	push   $0x2ce3
+     781:	ff 35 c0 3e 00 00    	push   0x3ec0
+     787:	e8 34 1b 00 00       	call   22c0 <printf>
+    exit();
+     78c:	e8 82 19 00 00       	call   2113 <exit>
+     791:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     798:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     79f:	90                   	nop
+
+000007a0 <spawntest>:
+{
+     7a0:	55                   	push   %ebp
+     7a1:	89 e5                	mov    %esp,%ebp
+     7a3:	57                   	push   %edi
+     7a4:	56                   	push   %esi
+     7a5:	53                   	push   %ebx
+     7a6:	83 ec 64             	sub    $0x64,%esp
+  char *args[] = { "echo", "spawned", 0 };
+     7a9:	c7 45 ac 01 2d 00 00 	movl   $0x2d01,-0x54(%ebp)
+     7b0:	c7 45 b0 06 2d 00 00 	movl   $0x2d06,-0x50(%ebp)
+     7b7:	c7 45 b4 00 00 00 00 	movl   $0x0,-0x4c(%ebp)
+  char *bad[] = { "nosuchprog", 0 };
+     7be:	c7 45 a4 0e 2d 00 00 	movl   $0x2d0e,-0x5c(%ebp)
+     7c5:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%ebp)
+  printf(stdout, "spawn test\n");
+     7cc:	68 19 2d 00 00       	push   $0x2d19
+     7d1:	ff 35 c0 3e 00 00    	push   0x3ec0
+     7d7:	e8 e4 1a 00 00       	call   22c0 <printf>
+  if(spawn("echo", args, act, 2, -1) < 0){
+     7dc:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  act[0].op = SPAWN_OPEN;
+     7df:	c7 45 c8 03 00 00 00 	movl   $0x3,-0x38(%ebp)
+  act[0].fd = 1;
+     7e6:	c7 45 cc 01 00 00 00 	movl   $0x1,-0x34(%ebp)
+  act[0].arg = O_CREATE|O_WRONLY;
+     7ed:	c7 45 d0 01 02 00 00 	movl   $0x201,-0x30(%ebp)
+  act[0].path = "spawnout";
+     7f4:	c7 45 d4 25 2d 00 00 	movl   $0x2d25,-0x2c(%ebp)
+  act[1].op = SPAWN_CLOSE;
+     7fb:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  act[1].fd = 0;
+     802:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  act[1].arg = 0;
+     809:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  act[1].path = 0;
+     810:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  if(spawn("echo", args, act, 2, -1) < 0){
+     817:	c7 04 24 ff ff ff ff 	movl   $0xffffffff,(%esp)
+     81e:	6a 02                	push   $0x2
+     820:	50                   	push   %eax
+     821:	8d 45 ac             	lea    -0x54(%ebp),%eax
+     824:	50                   	push   %eax
+     825:	68 01 2d 00 00       	push   $0x2d01
+     82a:	e8 ac 19 00 00       	call   21db <spawn>
+     82f:	83 c4 20             	add    $0x20,%esp
+     832:	85 c0                	test   %eax,%eax
+     834:	0f 88 ed 00 00 00    	js     927 <spawntest+0x187>
+  if(wait() < 0){
+     83a:	e8 dc 18 00 00       	call   211b <wait>
+     83f:	85 c0                	test   %eax,%eax
+     841:	0f 88 c9 00 00 00    	js     910 <spawntest+0x170>
+  fd = open("spawnout", O_RDONLY);
+     847:	83 ec 08             	sub    $0x8,%esp
+  n = read(fd, buf, sizeof(buf) - 1);
+     84a:	8d 7d b8             	lea    -0x48(%ebp),%edi
+  fd = open("spawnout", O_RDONLY);
+     84d:	6a 00                	push   $0x0
+     84f:	68 25 2d 00 00       	push   $0x2d25
+     854:	e8 fa 18 00 00       	call   2153 <open>
+  n = read(fd, buf, sizeof(buf) - 1);
+     859:	83 c4 0c             	add    $0xc,%esp
+     85c:	6a 0f                	push   $0xf
+  fd = open("spawnout", O_RDONLY);
+     85e:	89 c6                	mov    %eax,%esi
+  n = read(fd, buf, sizeof(buf) - 1);
+     860:	57                   	push   %edi
+     861:	50                   	push   %eax
+     862:	e8 c4 18 00 00       	call   212b <read>
+  close(fd);
+     867:	89 34 24             	mov    %esi,(%esp)
+  n = read(fd, buf, sizeof(buf) - 1);
+     86a:	89 c3                	mov    %eax,%ebx
+  close(fd);
+     86c:	e8 ca 18 00 00       	call   213b <close>
+  unlink("spawnout");
+     871:	c7 04 24 25 2d 00 00 	movl   $0x2d25,(%esp)
+     878:	e8 e6 18 00 00       	call   2163 <unlink>
+  buf[n < 0 ? 0 : n] = 0;
+     87d:	31 c0                	xor    %eax,%eax
+     87f:	85 db                	test   %ebx,%ebx
+     881:	0f 48 d8             	cmovs  %eax,%ebx
+     884:	c6 44 1d b8 00       	movb   $0x0,-0x48(%ebp,%ebx,1)
+  if(strcmp(buf, "spawned\n") != 0){
+     889:	59                   	pop    %ecx
+     88a:	5b                   	pop    %ebx
+     88b:	68 5e 2d 00 00       	push   $0x2d5e
+     890:	57                   	push   %edi
+     891:	e8 2a 16 00 00       	call   1ec0 <strcmp>
+     896:	83 c4 10             	add    $0x10,%esp
+     899:	85 c0                	test   %eax,%eax
+     89b:	75 5c                	jne    8f9 <spawntest+0x159>
+  if(spawn("nosuchprog", bad, 0, 0, -1) >= 0 || wait() >= 0){
+     89d:	83 ec 0c             	sub    $0xc,%esp
+     8a0:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+     8a3:	6a ff                	push   $0xffffffff
+     8a5:	6a 00                	push   $0x0
+     8a7:	6a 00                	push   $0x0
+     8a9:	50                   	push   %eax
+     8aa:	68 0e 2d 00 00       	push   $0x2d0e
+     8af:	e8 27 19 00 00       	call   21db <spawn>
+     8b4:	83 c4 20             	add    $0x20,%esp
+     8b7:	85 c0                	test   %eax,%eax
+     8b9:	79 27                	jns    8e2 <spawntest+0x142>
+     8bb:	e8 5b 18 00 00       	call   211b <wait>
+     8c0:	85 c0                	test   %eax,%eax
+     8c2:	79 1e                	jns    8e2 <spawntest+0x142>
+  printf(stdout, "spawn test ok\n");
+     8c4:	83 ec 08             	sub    $0x8,%esp
+     8c7:	68 81 2d 00 00       	push   $0x2d81
+     8cc:	ff 35 c0 3e 00 00    	push   0x3ec0
+     8d2:	e8 e9 19 00 00       	call   22c0 <printf>
+}
+     8d7:	83 c4 10             	add    $0x10,%esp
+     8da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8dd:	5b                   	pop    %ebx
+     8de:	5e                   	pop    %esi
+     8df:	5f                   	pop    %edi
+     8e0:	5d                   	pop    %ebp
+     8e1:	c3                   	ret
+    printf(stdout, "spawn test: bad program spawned\n");
+     8e2:	50                   	push   %eax
+     8e3:	50                   	push   %eax
+     8e4:	68 f0 31 00 00       	push   $0x31f0
+     8e9:	ff 35 c0 3e 00 00    	push   0x3ec0
+     8ef:	e8 cc 19 00 00       	call   22c0 <printf>
+    exit();
+     8f4:	e8 1a 18 00 00       	call   2113 <exit>
+    printf(stdout, "spawn test: wrong output\n");
+     8f9:	52                   	push   %edx
+     8fa:	52                   	push   %edx
+     8fb:	68 67 2d 00 00       	push   $0x2d67
+     900:	ff 35 c0 3e 00 00    	push   0x3ec0
+     906:	e8 b5 19 00 00       	call   22c0 <printf>
+    exit();
+     90b:	e8 03 18 00 00       	call   2113 <exit>
+    printf(stdout, "spawn test: no child\n");
+     910:	56                   	push   %esi
+     911:	56                   	push   %esi
+     912:	68 48 2d 00 00       	push   $0x2d48
+     917:	ff 35 c0 3e 00 00    	push   0x3ec0
+     91d:	e8 9e 19 00 00       	call   22c0 <printf>
+    exit();
+     922:	e8 ec 17 00 00       	call   2113 <exit>
+    printf(stdout, "spawn test: spawn failed\n");
+     927:	57                   	push   %edi
+     928:	57                   	push   %edi
+     929:	68 2e 2d 00 00       	push   $0x2d2e
+     92e:	ff 35 c0 3e 00 00    	push   0x3ec0
+     934:	e8 87 19 00 00       	call   22c0 <printf>
+    exit();
+     939:	e8 d5 17 00 00       	call   2113 <exit>
+     93e:	66 90                	xchg   %ax,%ax
+
+00000940 <threadtest>:
+{
+     940:	55                   	push   %ebp
+     941:	89 e5                	mov    %esp,%ebp
+     943:	57                   	push   %edi
+     944:	56                   	push   %esi
+     945:	53                   	push   %ebx
+  for(i = 0; i < NTHREAD; i++){
+     946:	31 db                	xor    %ebx,%ebx
+{
+     948:	83 ec 24             	sub    $0x24,%esp
+  printf(stdout, "thread test\n");
+     94b:	68 90 2d 00 00       	push   $0x2d90
+     950:	ff 35 c0 3e 00 00    	push   0x3ec0
+     956:	e8 65 19 00 00       	call   22c0 <printf>
+  tcount = 0;
+     95b:	83 c4 10             	add    $0x10,%esp
+     95e:	c7 05 c0 4e 00 00 00 	movl   $0x0,0x4ec0
+     965:	00 00 00 
+    if((tid[i] = thread_create(threadfn, (void*)i)) < 0){
+     968:	83 ec 08             	sub    $0x8,%esp
+     96b:	53                   	push   %ebx
+     96c:	68 20 01 00 00       	push   $0x120
+     971:	e8 5a 20 00 00       	call   29d0 <thread_create>
+     976:	83 c4 10             	add    $0x10,%esp
+     979:	89 44 9d d8          	mov    %eax,-0x28(%ebp,%ebx,4)
+     97d:	85 c0                	test   %eax,%eax
+     97f:	0f 88 0a 01 00 00    	js     a8f <threadtest+0x14f>
+  for(i = 0; i < NTHREAD; i++){
+     985:	83 c3 01             	add    $0x1,%ebx
+     988:	83 fb 04             	cmp    $0x4,%ebx
+     98b:	75 db                	jne    968 <threadtest+0x28>
+     98d:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     990:	8d 7d c8             	lea    -0x38(%ebp),%edi
+    if(thread_join(tid[i]) != tid[i]){
+     993:	8b 73 0c             	mov    0xc(%ebx),%esi
+     996:	83 ec 0c             	sub    $0xc,%esp
+     999:	56                   	push   %esi
+     99a:	e8 a1 20 00 00       	call   2a40 <thread_join>
+     99f:	83 c4 10             	add    $0x10,%esp
+     9a2:	39 c6                	cmp    %eax,%esi
+     9a4:	0f 85 cd 00 00 00    	jne    a77 <threadtest+0x137>
+  for(i = NTHREAD-1; i >= 0; i--){
+     9aa:	83 eb 04             	sub    $0x4,%ebx
+     9ad:	39 fb                	cmp    %edi,%ebx
+     9af:	75 e2                	jne    993 <threadtest+0x53>
+  if(thread_join(-1) != -1 || wait() != -1){
+     9b1:	83 ec 0c             	sub    $0xc,%esp
+     9b4:	6a ff                	push   $0xffffffff
+     9b6:	e8 85 20 00 00       	call   2a40 <thread_join>
+     9bb:	83 c4 10             	add    $0x10,%esp
+     9be:	83 f8 ff             	cmp    $0xffffffff,%eax
+     9c1:	0f 85 99 00 00 00    	jne    a60 <threadtest+0x120>
+     9c7:	e8 4f 17 00 00       	call   211b <wait>
+     9cc:	83 f8 ff             	cmp    $0xffffffff,%eax
+     9cf:	0f 85 8b 00 00 00    	jne    a60 <threadtest+0x120>
+     9d5:	bb 08 43 00 00       	mov    $0x4308,%ebx
+  for(i = 0; i < NTHREAD; i++)
+     9da:	31 c9                	xor    %ecx,%ecx
+    for(j = 0; j < sizeof(tbuf[i]); j++)
+     9dc:	8d 83 18 fc ff ff    	lea    -0x3e8(%ebx),%eax
+     9e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(tbuf[i][j] != i){
+     9e8:	0f be 10             	movsbl (%eax),%edx
+     9eb:	39 ca                	cmp    %ecx,%edx
+     9ed:	75 41                	jne    a30 <threadtest+0xf0>
+    for(j = 0; j < sizeof(tbuf[i]); j++)
+     9ef:	83 c0 01             	add    $0x1,%eax
+     9f2:	39 d8                	cmp    %ebx,%eax
+     9f4:	75 f2                	jne    9e8 <threadtest+0xa8>
+  for(i = 0; i < NTHREAD; i++)
+     9f6:	83 c1 01             	add    $0x1,%ecx
+     9f9:	8d 98 e8 03 00 00    	lea    0x3e8(%eax),%ebx
+     9ff:	83 f9 04             	cmp    $0x4,%ecx
+     a02:	75 d8                	jne    9dc <threadtest+0x9c>
+  if(tcount != NTHREAD*sizeof(tbuf[0])){
+     a04:	8b 15 c0 4e 00 00    	mov    0x4ec0,%edx
+        printf(stdout, "thread test: bad memory\n");
+     a0a:	a1 c0 3e 00 00       	mov    0x3ec0,%eax
+  if(tcount != NTHREAD*sizeof(tbuf[0])){
+     a0f:	81 fa a0 0f 00 00    	cmp    $0xfa0,%edx
+     a15:	75 31                	jne    a48 <threadtest+0x108>
+  printf(stdout, "thread test ok\n");
+     a17:	83 ec 08             	sub    $0x8,%esp
+     a1a:	68 e8 2d 00 00       	push   $0x2de8
+     a1f:	50                   	push   %eax
+     a20:	e8 9b 18 00 00       	call   22c0 <printf>
+}
+     a25:	83 c4 10             	add    $0x10,%esp
+     a28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a2b:	5b                   	pop    %ebx
+     a2c:	5e                   	pop    %esi
+     a2d:	5f                   	pop    %edi
+     a2e:	5d                   	pop    %ebp
+     a2f:	c3                   	ret
+        printf(stdout, "thread test: bad memory\n");
+     a30:	83 ec 08             	sub    $0x8,%esp
+     a33:	68 b8 2d 00 00       	push   $0x2db8
+     a38:	ff 35 c0 3e 00 00    	push   0x3ec0
+     a3e:	e8 7d 18 00 00       	call   22c0 <printf>
+        exit();
+     a43:	e8 cb 16 00 00       	call   2113 <exit>
+    printf(stdout, "thread test: count %d\n", tcount);
+     a48:	8b 15 c0 4e 00 00    	mov    0x4ec0,%edx
+     a4e:	51                   	push   %ecx
+     a4f:	52                   	push   %edx
+     a50:	68 d1 2d 00 00       	push   $0x2dd1
+     a55:	50                   	push   %eax
+     a56:	e8 65 18 00 00       	call   22c0 <printf>
+    exit();
+     a5b:	e8 b3 16 00 00       	call   2113 <exit>
+    printf(stdout, "thread test: extra thread\n");
+     a60:	53                   	push   %ebx
+     a61:	53                   	push   %ebx
+     a62:	68 9d 2d 00 00       	push   $0x2d9d
+     a67:	ff 35 c0 3e 00 00    	push   0x3ec0
+     a6d:	e8 4e 18 00 00       	call   22c0 <printf>
+    exit();
+     a72:	e8 9c 16 00 00       	call   2113 <exit>
+      printf(stdout, "thread test: thread_join failed\n");
+     a77:	83 ec 08             	sub    $0x8,%esp
+     a7a:	68 38 32 00 00       	push   $0x3238
+     a7f:	ff 35 c0 3e 00 00    	push   0x3ec0
+     a85:	e8 36 18 00 00       	call   22c0 <printf>
+      exit();
+     a8a:	e8 84 16 00 00       	call   2113 <exit>
+      printf(stdout, "thread test: thread_create failed\n");
+     a8f:	83 ec 08             	sub    $0x8,%esp
+     a92:	68 14 32 00 00       	push   $0x3214
+     a97:	ff 35 c0 3e 00 00    	push   0x3ec0
+     a9d:	e8 1e 18 00 00       	call   22c0 <printf>
+      exit();
+     aa2:	e8 6c 16 00 00       	call   2113 <exit>
+     aa7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aae:	66 90                	xchg   %ax,%ax
+
+00000ab0 <racetest>:
+{
+     ab0:	55                   	push   %ebp
+     ab1:	89 e5                	mov    %esp,%ebp
+     ab3:	56                   	push   %esi
+     ab4:	53                   	push   %ebx
+  printf(stdout, "race test\n");
+     ab5:	83 ec 08             	sub    $0x8,%esp
+     ab8:	68 f8 2d 00 00       	push   $0x2df8
+     abd:	ff 35 c0 3e 00 00    	push   0x3ec0
+     ac3:	e8 f8 17 00 00       	call   22c0 <printf>
+  memset(buf, 'r', 4096);
+     ac8:	83 c4 0c             	add    $0xc,%esp
+     acb:	68 00 10 00 00       	push   $0x1000
+     ad0:	6a 72                	push   $0x72
+     ad2:	68 e0 4e 00 00       	push   $0x4ee0
+     ad7:	e8 74 14 00 00       	call   1f50 <memset>
+  fd = open("racefile", O_CREATE|O_RDWR);
+     adc:	58                   	pop    %eax
+     add:	5a                   	pop    %edx
+     ade:	68 02 02 00 00       	push   $0x202
+     ae3:	68 f0 2b 00 00       	push   $0x2bf0
+     ae8:	e8 66 16 00 00       	call   2153 <open>
+  if(fd < 0 || write(fd, buf, 4096) != 4096){
+     aed:	83 c4 10             	add    $0x10,%esp
+     af0:	85 c0                	test   %eax,%eax
+     af2:	0f 88 58 01 00 00    	js     c50 <racetest+0x1a0>
+     af8:	83 ec 04             	sub    $0x4,%esp
+     afb:	89 c3                	mov    %eax,%ebx
+     afd:	68 00 10 00 00       	push   $0x1000
+     b02:	68 e0 4e 00 00       	push   $0x4ee0
+     b07:	50                   	push   %eax
+     b08:	e8 26 16 00 00       	call   2133 <write>
+     b0d:	83 c4 10             	add    $0x10,%esp
+     b10:	3d 00 10 00 00       	cmp    $0x1000,%eax
+     b15:	0f 85 35 01 00 00    	jne    c50 <racetest+0x1a0>
+  close(fd);
+     b1b:	83 ec 0c             	sub    $0xc,%esp
+     b1e:	53                   	push   %ebx
+     b1f:	e8 17 16 00 00       	call   213b <close>
+  racedone = racebad = 0;
+     b24:	c7 05 04 3f 00 00 00 	movl   $0x0,0x3f04
+     b2b:	00 00 00 
+     b2e:	c7 05 08 3f 00 00 00 	movl   $0x0,0x3f08
+     b35:	00 00 00 
+  rbuf = buf;
+     b38:	c7 05 00 3f 00 00 e0 	movl   $0x4ee0,0x3f00
+     b3f:	4e 00 00 
+  if((tid = thread_create(racereader, 0)) < 0){
+     b42:	5e                   	pop    %esi
+     b43:	58                   	pop    %eax
+     b44:	6a 00                	push   $0x0
+     b46:	68 90 00 00 00       	push   $0x90
+     b4b:	e8 80 1e 00 00       	call   29d0 <thread_create>
+     b50:	83 c4 10             	add    $0x10,%esp
+     b53:	89 c6                	mov    %eax,%esi
+     b55:	85 c0                	test   %eax,%eax
+     b57:	0f 88 dc 00 00 00    	js     c39 <racetest+0x189>
+     b5d:	bb c8 00 00 00       	mov    $0xc8,%ebx
+     b62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    p = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+     b68:	83 ec 08             	sub    $0x8,%esp
+     b6b:	6a 00                	push   $0x0
+     b6d:	6a ff                	push   $0xffffffff
+     b6f:	6a 22                	push   $0x22
+     b71:	6a 03                	push   $0x3
+     b73:	68 00 10 00 00       	push   $0x1000
+     b78:	6a 00                	push   $0x0
+     b7a:	e8 3c 16 00 00       	call   21bb <mmap>
+    if(p == MAP_FAILED){
+     b7f:	83 c4 20             	add    $0x20,%esp
+     b82:	83 f8 ff             	cmp    $0xffffffff,%eax
+     b85:	74 6b                	je     bf2 <racetest+0x142>
+    if(munmap(p, 4096) < 0){
+     b87:	83 ec 08             	sub    $0x8,%esp
+    rbuf = p;
+     b8a:	a3 00 3f 00 00       	mov    %eax,0x3f00
+    if(munmap(p, 4096) < 0){
+     b8f:	68 00 10 00 00       	push   $0x1000
+     b94:	50                   	push   %eax
+     b95:	e8 29 16 00 00       	call   21c3 <munmap>
+     b9a:	83 c4 10             	add    $0x10,%esp
+     b9d:	85 c0                	test   %eax,%eax
+     b9f:	78 69                	js     c0a <racetest+0x15a>
+  for(i = 0; i < 200; i++){
+     ba1:	83 eb 01             	sub    $0x1,%ebx
+     ba4:	75 c2                	jne    b68 <racetest+0xb8>
+  racedone = 1;
+     ba6:	c7 05 08 3f 00 00 01 	movl   $0x1,0x3f08
+     bad:	00 00 00 
+  if(thread_join(tid) != tid || racebad){
+     bb0:	83 ec 0c             	sub    $0xc,%esp
+     bb3:	56                   	push   %esi
+     bb4:	e8 87 1e 00 00       	call   2a40 <thread_join>
+     bb9:	83 c4 10             	add    $0x10,%esp
+     bbc:	39 f0                	cmp    %esi,%eax
+     bbe:	75 62                	jne    c22 <racetest+0x172>
+     bc0:	a1 04 3f 00 00       	mov    0x3f04,%eax
+     bc5:	85 c0                	test   %eax,%eax
+     bc7:	75 59                	jne    c22 <racetest+0x172>
+  unlink("racefile");
+     bc9:	83 ec 0c             	sub    $0xc,%esp
+     bcc:	68 f0 2b 00 00       	push   $0x2bf0
+     bd1:	e8 8d 15 00 00       	call   2163 <unlink>
+  printf(stdout, "race test ok\n");
+     bd6:	58                   	pop    %eax
+     bd7:	5a                   	pop    %edx
+     bd8:	68 67 2e 00 00       	push   $0x2e67
+     bdd:	ff 35 c0 3e 00 00    	push   0x3ec0
+     be3:	e8 d8 16 00 00       	call   22c0 <printf>
+}
+     be8:	83 c4 10             	add    $0x10,%esp
+     beb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     bee:	5b                   	pop    %ebx
+     bef:	5e                   	pop    %esi
+     bf0:	5d                   	pop    %ebp
+     bf1:	c3                   	ret
+      printf(stdout, "race test: mmap failed\n");
+     bf2:	83 ec 08             	sub    $0x8,%esp
+     bf5:	68 1d 2e 00 00       	push   $0x2e1d
+     bfa:	ff 35 c0 3e 00 00    	push   0x3ec0
+     c00:	e8 bb 16 00 00       	call   22c0 <printf>
+      exit();
+     c05:	e8 09 15 00 00       	call   2113 <exit>
+      printf(stdout, "race test: munmap failed\n");
+     c0a:	83 ec 08             	sub    $0x8,%esp
+     c0d:	68 35 2e 00 00       	push   $0x2e35
+     c12:	ff 35 c0 3e 00 00    	push   0x3ec0
+     c18:	e8 a3 16 00 00       	call   22c0 <printf>
+      exit();
+     c1d:	e8 f1 14 00 00       	call   2113 <exit>
+    printf(stdout, "race test: read failed\n");
+     c22:	51                   	push   %ecx
+     c23:	51                   	push   %ecx
+     c24:	68 4f 2e 00 00       	push   $0x2e4f
+     c29:	ff 35 c0 3e 00 00    	push   0x3ec0
+     c2f:	e8 8c 16 00 00       	call   22c0 <printf>
+    exit();
+     c34:	e8 da 14 00 00       	call   2113 <exit>
+    printf(stdout, "race test: thread_create failed\n");
+     c39:	53                   	push   %ebx
+     c3a:	53                   	push   %ebx
+     c3b:	68 5c 32 00 00       	push   $0x325c
+     c40:	ff 35 c0 3e 00 00    	push   0x3ec0
+     c46:	e8 75 16 00 00       	call   22c0 <printf>
+    exit();
+     c4b:	e8 c3 14 00 00       	call   2113 <exit>
+    printf(stdout, "race test: create failed\n");
+     c50:	50                   	push   %eax
+     c51:	50                   	push   %eax
+     c52:	68 03 2e 00 00       	push   $0x2e03
+     c57:	ff 35 c0 3e 00 00    	push   0x3ec0
+     c5d:	e8 5e 16 00 00       	call   22c0 <printf>
+    exit();
+     c62:	e8 ac 14 00 00       	call   2113 <exit>
+     c67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c6e:	66 90                	xchg   %ax,%ax
+
+00000c70 <futextest>:
+{
+     c70:	55                   	push   %ebp
+     c71:	89 e5                	mov    %esp,%ebp
+     c73:	57                   	push   %edi
+     c74:	56                   	push   %esi
+     c75:	53                   	push   %ebx
+     c76:	83 ec 34             	sub    $0x34,%esp
+  printf(stdout, "futex test\n");
+     c79:	68 75 2e 00 00       	push   $0x2e75
+     c7e:	ff 35 c0 3e 00 00    	push   0x3ec0
+     c84:	e8 37 16 00 00       	call   22c0 <printf>
+  if(futex(&fword, FUTEX_WAIT, 0) != -1 ||
+     c89:	83 c4 0c             	add    $0xc,%esp
+  fword = 1;
+     c8c:	c7 05 fc 3e 00 00 01 	movl   $0x1,0x3efc
+     c93:	00 00 00 
+  if(futex(&fword, FUTEX_WAIT, 0) != -1 ||
+     c96:	6a 00                	push   $0x0
+     c98:	6a 00                	push   $0x0
+     c9a:	68 fc 3e 00 00       	push   $0x3efc
+     c9f:	e8 4f 15 00 00       	call   21f3 <futex>
+     ca4:	83 c4 10             	add    $0x10,%esp
+     ca7:	83 f8 ff             	cmp    $0xffffffff,%eax
+     caa:	0f 85 ec 02 00 00    	jne    f9c <futextest+0x32c>
+     futex((uint*)((char*)&fword + 1), FUTEX_WAIT, 1) != -1){
+     cb0:	83 ec 04             	sub    $0x4,%esp
+     cb3:	6a 01                	push   $0x1
+     cb5:	6a 00                	push   $0x0
+     cb7:	68 fd 3e 00 00       	push   $0x3efd
+     cbc:	e8 32 15 00 00       	call   21f3 <futex>
+  if(futex(&fword, FUTEX_WAIT, 0) != -1 ||
+     cc1:	83 c4 10             	add    $0x10,%esp
+     cc4:	83 f8 ff             	cmp    $0xffffffff,%eax
+     cc7:	0f 85 cf 02 00 00    	jne    f9c <futextest+0x32c>
+  if(futex(&fword, FUTEX_WAKE, 5) != 0){
+     ccd:	83 ec 04             	sub    $0x4,%esp
+     cd0:	6a 05                	push   $0x5
+     cd2:	6a 01                	push   $0x1
+     cd4:	68 fc 3e 00 00       	push   $0x3efc
+     cd9:	e8 15 15 00 00       	call   21f3 <futex>
+     cde:	83 c4 10             	add    $0x10,%esp
+     ce1:	89 c3                	mov    %eax,%ebx
+     ce3:	85 c0                	test   %eax,%eax
+     ce5:	0f 85 86 03 00 00    	jne    1071 <futextest+0x401>
+  fword = 0;
+     ceb:	c7 05 fc 3e 00 00 00 	movl   $0x0,0x3efc
+     cf2:	00 00 00 
+  fready = fwoken = 0;
+     cf5:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     cf8:	c7 05 f4 3e 00 00 00 	movl   $0x0,0x3ef4
+     cff:	00 00 00 
+     d02:	89 c6                	mov    %eax,%esi
+     d04:	c7 05 f8 3e 00 00 00 	movl   $0x0,0x3ef8
+     d0b:	00 00 00 
+  for(i = 0; i < NTHREAD; i++){
+     d0e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    if((tid[i] = thread_create(fwaiter, 0)) < 0){
+     d11:	83 ec 08             	sub    $0x8,%esp
+     d14:	6a 00                	push   $0x0
+     d16:	68 60 01 00 00       	push   $0x160
+     d1b:	e8 b0 1c 00 00       	call   29d0 <thread_create>
+     d20:	83 c4 10             	add    $0x10,%esp
+     d23:	89 06                	mov    %eax,(%esi)
+     d25:	85 c0                	test   %eax,%eax
+     d27:	0f 88 2c 03 00 00    	js     1059 <futextest+0x3e9>
+  for(i = 0; i < NTHREAD; i++){
+     d2d:	83 c6 04             	add    $0x4,%esi
+     d30:	8d 45 e8             	lea    -0x18(%ebp),%eax
+     d33:	39 f0                	cmp    %esi,%eax
+     d35:	75 da                	jne    d11 <futextest+0xa1>
+  while(fready < NTHREAD)
+     d37:	a1 f8 3e 00 00       	mov    0x3ef8,%eax
+     d3c:	83 f8 03             	cmp    $0x3,%eax
+     d3f:	7f 1f                	jg     d60 <futextest+0xf0>
+    sleep(1);
+     d41:	83 ec 0c             	sub    $0xc,%esp
+     d44:	6a 01                	push   $0x1
+     d46:	e8 58 14 00 00       	call   21a3 <sleep>
+  while(fready < NTHREAD)
+     d4b:	a1 f8 3e 00 00       	mov    0x3ef8,%eax
+     d50:	83 c4 10             	add    $0x10,%esp
+     d53:	83 f8 03             	cmp    $0x3,%eax
+     d56:	7e e9                	jle    d41 <futextest+0xd1>
+     d58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d5f:	90                   	nop
+    if((r = futex(&fword, FUTEX_WAKE, 2 - n)) < 0 || r > 2 - n){
+     d60:	be 02 00 00 00       	mov    $0x2,%esi
+     d65:	83 ec 04             	sub    $0x4,%esp
+     d68:	29 de                	sub    %ebx,%esi
+     d6a:	56                   	push   %esi
+     d6b:	6a 01                	push   $0x1
+     d6d:	68 fc 3e 00 00       	push   $0x3efc
+     d72:	e8 7c 14 00 00       	call   21f3 <futex>
+     d77:	83 c4 10             	add    $0x10,%esp
+     d7a:	89 c7                	mov    %eax,%edi
+     d7c:	39 c6                	cmp    %eax,%esi
+     d7e:	0f 82 bc 02 00 00    	jb     1040 <futextest+0x3d0>
+    sleep(1);
+     d84:	83 ec 0c             	sub    $0xc,%esp
+  for(n = 0; n < 2; n += r){
+     d87:	01 fb                	add    %edi,%ebx
+    sleep(1);
+     d89:	6a 01                	push   $0x1
+     d8b:	e8 13 14 00 00       	call   21a3 <sleep>
+  for(n = 0; n < 2; n += r){
+     d90:	83 c4 10             	add    $0x10,%esp
+     d93:	83 fb 01             	cmp    $0x1,%ebx
+     d96:	7e c8                	jle    d60 <futextest+0xf0>
+  while(fwoken < 2)
+     d98:	a1 f4 3e 00 00       	mov    0x3ef4,%eax
+     d9d:	83 f8 01             	cmp    $0x1,%eax
+     da0:	7f 17                	jg     db9 <futextest+0x149>
+    sleep(1);
+     da2:	83 ec 0c             	sub    $0xc,%esp
+     da5:	6a 01                	push   $0x1
+     da7:	e8 f7 13 00 00       	call   21a3 <sleep>
+  while(fwoken < 2)
+     dac:	a1 f4 3e 00 00       	mov    0x3ef4,%eax
+     db1:	83 c4 10             	add    $0x10,%esp
+     db4:	83 f8 01             	cmp    $0x1,%eax
+     db7:	7e e9                	jle    da2 <futextest+0x132>
+  sleep(10);
+     db9:	83 ec 0c             	sub    $0xc,%esp
+     dbc:	6a 0a                	push   $0xa
+     dbe:	e8 e0 13 00 00       	call   21a3 <sleep>
+  if(fwoken != 2){
+     dc3:	a1 f4 3e 00 00       	mov    0x3ef4,%eax
+     dc8:	83 c4 10             	add    $0x10,%esp
+     dcb:	83 f8 02             	cmp    $0x2,%eax
+     dce:	0f 85 46 02 00 00    	jne    101a <futextest+0x3aa>
+  fword = 1;
+     dd4:	c7 05 fc 3e 00 00 01 	movl   $0x1,0x3efc
+     ddb:	00 00 00 
+  futex(&fword, FUTEX_WAKE, NTHREAD);
+     dde:	83 ec 04             	sub    $0x4,%esp
+     de1:	6a 04                	push   $0x4
+     de3:	6a 01                	push   $0x1
+     de5:	68 fc 3e 00 00       	push   $0x3efc
+     dea:	e8 04 14 00 00       	call   21f3 <futex>
+     def:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+     df2:	83 c4 10             	add    $0x10,%esp
+    if(thread_join(tid[i]) != tid[i]){
+     df5:	8b 33                	mov    (%ebx),%esi
+     df7:	83 ec 0c             	sub    $0xc,%esp
+     dfa:	56                   	push   %esi
+     dfb:	e8 40 1c 00 00       	call   2a40 <thread_join>
+     e00:	83 c4 10             	add    $0x10,%esp
+     e03:	39 c6                	cmp    %eax,%esi
+     e05:	0f 85 f7 01 00 00    	jne    1002 <futextest+0x392>
+  for(i = 0; i < NTHREAD; i++){
+     e0b:	83 c3 04             	add    $0x4,%ebx
+     e0e:	8d 45 e8             	lea    -0x18(%ebp),%eax
+     e11:	39 c3                	cmp    %eax,%ebx
+     e13:	75 e0                	jne    df5 <futextest+0x185>
+  mutex_init(&mlock);
+     e15:	83 ec 0c             	sub    $0xc,%esp
+     e18:	68 e8 3e 00 00       	push   $0x3ee8
+     e1d:	e8 5e 1c 00 00       	call   2a80 <mutex_init>
+  mcount = 0;
+     e22:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+     e25:	83 c4 10             	add    $0x10,%esp
+     e28:	c7 05 f0 3e 00 00 00 	movl   $0x0,0x3ef0
+     e2f:	00 00 00 
+    if((tid[i] = thread_create(mworker, 0)) < 0){
+     e32:	83 ec 08             	sub    $0x8,%esp
+     e35:	6a 00                	push   $0x0
+     e37:	68 90 01 00 00       	push   $0x190
+     e3c:	e8 8f 1b 00 00       	call   29d0 <thread_create>
+     e41:	83 c4 10             	add    $0x10,%esp
+     e44:	89 03                	mov    %eax,(%ebx)
+     e46:	85 c0                	test   %eax,%eax
+     e48:	0f 88 0b 02 00 00    	js     1059 <futextest+0x3e9>
+  for(i = 0; i < NTHREAD; i++){
+     e4e:	83 c3 04             	add    $0x4,%ebx
+     e51:	8d 45 e8             	lea    -0x18(%ebp),%eax
+     e54:	39 c3                	cmp    %eax,%ebx
+     e56:	75 da                	jne    e32 <futextest+0x1c2>
+    thread_join(tid[i]);
+     e58:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     e5b:	83 ec 0c             	sub    $0xc,%esp
+     e5e:	ff 36                	push   (%esi)
+     e60:	e8 db 1b 00 00       	call   2a40 <thread_join>
+  for(i = 0; i < NTHREAD; i++)
+     e65:	89 f0                	mov    %esi,%eax
+     e67:	8d 55 e8             	lea    -0x18(%ebp),%edx
+     e6a:	83 c4 10             	add    $0x10,%esp
+     e6d:	83 c0 04             	add    $0x4,%eax
+     e70:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     e73:	39 d0                	cmp    %edx,%eax
+     e75:	75 e1                	jne    e58 <futextest+0x1e8>
+  if(mcount != NTHREAD*1000){
+     e77:	a1 f0 3e 00 00       	mov    0x3ef0,%eax
+     e7c:	3d a0 0f 00 00       	cmp    $0xfa0,%eax
+     e81:	0f 85 5f 01 00 00    	jne    fe6 <futextest+0x376>
+  mutex_lock(&mlock);
+     e87:	83 ec 0c             	sub    $0xc,%esp
+     e8a:	68 e8 3e 00 00       	push   $0x3ee8
+     e8f:	e8 fc 1b 00 00       	call   2a90 <mutex_lock>
+  if(mutex_trylock(&mlock) != -1){
+     e94:	c7 04 24 e8 3e 00 00 	movl   $0x3ee8,(%esp)
+     e9b:	e8 60 1c 00 00       	call   2b00 <mutex_trylock>
+     ea0:	83 c4 10             	add    $0x10,%esp
+     ea3:	83 f8 ff             	cmp    $0xffffffff,%eax
+     ea6:	0f 85 23 01 00 00    	jne    fcf <futextest+0x35f>
+  mutex_unlock(&mlock);
+     eac:	83 ec 0c             	sub    $0xc,%esp
+     eaf:	68 e8 3e 00 00       	push   $0x3ee8
+     eb4:	e8 67 1c 00 00       	call   2b20 <mutex_unlock>
+  cond_init(&notfull);
+     eb9:	c7 04 24 e4 3e 00 00 	movl   $0x3ee4,(%esp)
+     ec0:	e8 8b 1c 00 00       	call   2b50 <cond_init>
+  cond_init(&notempty);
+     ec5:	c7 04 24 e0 3e 00 00 	movl   $0x3ee0,(%esp)
+     ecc:	e8 7f 1c 00 00       	call   2b50 <cond_init>
+  item = 0;
+     ed1:	c7 05 ec 3e 00 00 00 	movl   $0x0,0x3eec
+     ed8:	00 00 00 
+  if((tid[0] = thread_create(producer, 0)) < 0){
+     edb:	59                   	pop    %ecx
+     edc:	5b                   	pop    %ebx
+     edd:	6a 00                	push   $0x0
+     edf:	68 e0 01 00 00       	push   $0x1e0
+     ee4:	e8 e7 1a 00 00       	call   29d0 <thread_create>
+     ee9:	83 c4 10             	add    $0x10,%esp
+     eec:	89 c6                	mov    %eax,%esi
+     eee:	85 c0                	test   %eax,%eax
+     ef0:	0f 88 63 01 00 00    	js     1059 <futextest+0x3e9>
+  for(i = 1; i <= NITEM; i++){
+     ef6:	bb 01 00 00 00       	mov    $0x1,%ebx
+     efb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     eff:	90                   	nop
+    mutex_lock(&mlock);
+     f00:	83 ec 0c             	sub    $0xc,%esp
+     f03:	68 e8 3e 00 00       	push   $0x3ee8
+     f08:	e8 83 1b 00 00       	call   2a90 <mutex_lock>
+    while(item == 0)
+     f0d:	a1 ec 3e 00 00       	mov    0x3eec,%eax
+     f12:	83 c4 10             	add    $0x10,%esp
+     f15:	85 c0                	test   %eax,%eax
+     f17:	75 25                	jne    f3e <futextest+0x2ce>
+     f19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      cond_wait(&notempty, &mlock);
+     f20:	83 ec 08             	sub    $0x8,%esp
+     f23:	68 e8 3e 00 00       	push   $0x3ee8
+     f28:	68 e0 3e 00 00       	push   $0x3ee0
+     f2d:	e8 2e 1c 00 00       	call   2b60 <cond_wait>
+    while(item == 0)
+     f32:	a1 ec 3e 00 00       	mov    0x3eec,%eax
+     f37:	83 c4 10             	add    $0x10,%esp
+     f3a:	85 c0                	test   %eax,%eax
+     f3c:	74 e2                	je     f20 <futextest+0x2b0>
+    cond_signal(&notfull);
+     f3e:	83 ec 0c             	sub    $0xc,%esp
+    n = item;
+     f41:	8b 3d ec 3e 00 00    	mov    0x3eec,%edi
+    item = 0;
+     f47:	c7 05 ec 3e 00 00 00 	movl   $0x0,0x3eec
+     f4e:	00 00 00 
+    cond_signal(&notfull);
+     f51:	68 e4 3e 00 00       	push   $0x3ee4
+     f56:	e8 55 1c 00 00       	call   2bb0 <cond_signal>
+    mutex_unlock(&mlock);
+     f5b:	c7 04 24 e8 3e 00 00 	movl   $0x3ee8,(%esp)
+     f62:	e8 b9 1b 00 00       	call   2b20 <mutex_unlock>
+    if(n != i){
+     f67:	83 c4 10             	add    $0x10,%esp
+     f6a:	39 df                	cmp    %ebx,%edi
+     f6c:	75 4a                	jne    fb8 <futextest+0x348>
+  for(i = 1; i <= NITEM; i++){
+     f6e:	83 c3 01             	add    $0x1,%ebx
+     f71:	83 fb 65             	cmp    $0x65,%ebx
+     f74:	75 8a                	jne    f00 <futextest+0x290>
+  thread_join(tid[0]);
+     f76:	83 ec 0c             	sub    $0xc,%esp
+     f79:	56                   	push   %esi
+     f7a:	e8 c1 1a 00 00       	call   2a40 <thread_join>
+  printf(stdout, "futex test ok\n");
+     f7f:	58                   	pop    %eax
+     f80:	5a                   	pop    %edx
+     f81:	68 b9 2e 00 00       	push   $0x2eb9
+     f86:	ff 35 c0 3e 00 00    	push   0x3ec0
+     f8c:	e8 2f 13 00 00       	call   22c0 <printf>
+}
+     f91:	83 c4 10             	add    $0x10,%esp
+     f94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f97:	5b                   	pop    %ebx
+     f98:	5e                   	pop    %esi
+     f99:	5f                   	pop    %edi
+     f9a:	5d                   	pop    %ebp
+     f9b:	c3                   	ret
+    printf(stdout, "futex test: wait on a stale value slept\n");
+     f9c:	53                   	push   %ebx
+     f9d:	53                   	push   %ebx
+     f9e:	68 80 32 00 00       	push   $0x3280
+     fa3:	ff 35 c0 3e 00 00    	push   0x3ec0
+     fa9:	e8 12 13 00 00       	call   22c0 <printf>
+    exit();
+     fae:	e8 60 11 00 00       	call   2113 <exit>
+     fb3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     fb7:	90                   	nop
+      printf(stdout, "futex test: got item %d, want %d\n", n, i);
+     fb8:	53                   	push   %ebx
+     fb9:	57                   	push   %edi
+     fba:	68 68 33 00 00       	push   $0x3368
+     fbf:	ff 35 c0 3e 00 00    	push   0x3ec0
+     fc5:	e8 f6 12 00 00       	call   22c0 <printf>
+      exit();
+     fca:	e8 44 11 00 00       	call   2113 <exit>
+    printf(stdout, "futex test: trylock took a held mutex\n");
+     fcf:	56                   	push   %esi
+     fd0:	56                   	push   %esi
+     fd1:	68 40 33 00 00       	push   $0x3340
+     fd6:	ff 35 c0 3e 00 00    	push   0x3ec0
+     fdc:	e8 df 12 00 00       	call   22c0 <printf>
+    exit();
+     fe1:	e8 2d 11 00 00       	call   2113 <exit>
+    printf(stdout, "futex test: mutex count %d\n", mcount);
+     fe6:	a1 f0 3e 00 00       	mov    0x3ef0,%eax
+     feb:	57                   	push   %edi
+     fec:	50                   	push   %eax
+     fed:	68 9d 2e 00 00       	push   $0x2e9d
+     ff2:	ff 35 c0 3e 00 00    	push   0x3ec0
+     ff8:	e8 c3 12 00 00       	call   22c0 <printf>
+    exit();
+     ffd:	e8 11 11 00 00       	call   2113 <exit>
+      printf(stdout, "futex test: thread_join failed\n");
+    1002:	83 ec 08             	sub    $0x8,%esp
+    1005:	68 20 33 00 00       	push   $0x3320
+    100a:	ff 35 c0 3e 00 00    	push   0x3ec0
+    1010:	e8 ab 12 00 00       	call   22c0 <printf>
+      exit();
+    1015:	e8 f9 10 00 00       	call   2113 <exit>
+    printf(stdout, "futex test: wake 2 woke %d\n", fwoken);
+    101a:	a1 f4 3e 00 00       	mov    0x3ef4,%eax
+    101f:	52                   	push   %edx
+    1020:	50                   	push   %eax
+    1021:	68 81 2e 00 00       	push   $0x2e81
+    1026:	ff 35 c0 3e 00 00    	push   0x3ec0
+    102c:	e8 8f 12 00 00       	call   22c0 <printf>
+    exit();
+    1031:	e8 dd 10 00 00       	call   2113 <exit>
+    1036:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    103d:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(stdout, "futex test: wake 2 returned %d\n", r);
+    1040:	83 ec 04             	sub    $0x4,%esp
+    1043:	50                   	push   %eax
+    1044:	68 00 33 00 00       	push   $0x3300
+    1049:	ff 35 c0 3e 00 00    	push   0x3ec0
+    104f:	e8 6c 12 00 00       	call   22c0 <printf>
+      exit();
+    1054:	e8 ba 10 00 00       	call   2113 <exit>
+    printf(stdout, "futex test: thread_create failed\n");
+    1059:	83 ec 08             	sub    $0x8,%esp
+    105c:	68 dc 32 00 00       	push   $0x32dc
+    1061:	ff 35 c0 3e 00 00    	push   0x3ec0
+    1067:	e8 54 12 00 00       	call   22c0 <printf>
+    exit();
+    106c:	e8 a2 10 00 00       	call   2113 <exit>
+    printf(stdout, "futex test: woke a sleeper that is not there\n");
+    1071:	51                   	push   %ecx
+    1072:	51                   	push   %ecx
+    1073:	68 ac 32 00 00       	push   $0x32ac
+    1078:	ff 35 c0 3e 00 00    	push   0x3ec0
+    107e:	e8 3d 12 00 00       	call   22c0 <printf>
+    exit();
+    1083:	e8 8b 10 00 00       	call   2113 <exit>
+    1088:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    108f:	90                   	nop
+
+00001090 <contmem>:
+{
+    1090:	55                   	push   %ebp
+    1091:	89 e5                	mov    %esp,%ebp
+    1093:	57                   	push   %edi
+    1094:	56                   	push   %esi
+    1095:	53                   	push   %ebx
+    1096:	83 ec 10             	sub    $0x10,%esp
+    1099:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(memstats(ms, 0, 0) < 0)
+    109c:	6a 00                	push   $0x0
+    109e:	6a 00                	push   $0x0
+    10a0:	56                   	push   %esi
+    10a1:	e8 6d 11 00 00       	call   2213 <memstats>
+    10a6:	83 c4 10             	add    $0x10,%esp
+    10a9:	85 c0                	test   %eax,%eax
+    10ab:	78 43                	js     10f0 <contmem+0x60>
+  for(i = 0; i < ms->ncont; i++)
+    10ad:	8b 46 2c             	mov    0x2c(%esi),%eax
+    10b0:	85 c0                	test   %eax,%eax
+    10b2:	7e 3c                	jle    10f0 <contmem+0x60>
+    10b4:	8d 7e 34             	lea    0x34(%esi),%edi
+    10b7:	31 db                	xor    %ebx,%ebx
+    10b9:	eb 10                	jmp    10cb <contmem+0x3b>
+    10bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10bf:	90                   	nop
+    10c0:	83 c3 01             	add    $0x1,%ebx
+    10c3:	83 c7 24             	add    $0x24,%edi
+    10c6:	39 5e 2c             	cmp    %ebx,0x2c(%esi)
+    10c9:	7e 25                	jle    10f0 <contmem+0x60>
+    if(strcmp(ms->cont[i].name, name) == 0)
+    10cb:	83 ec 08             	sub    $0x8,%esp
+    10ce:	ff 75 0c             	push   0xc(%ebp)
+    10d1:	57                   	push   %edi
+    10d2:	e8 e9 0d 00 00       	call   1ec0 <strcmp>
+    10d7:	83 c4 10             	add    $0x10,%esp
+    10da:	85 c0                	test   %eax,%eax
+    10dc:	75 e2                	jne    10c0 <contmem+0x30>
+}
+    10de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return &ms->cont[i];
+    10e1:	8d 04 db             	lea    (%ebx,%ebx,8),%eax
+    10e4:	8d 44 86 30          	lea    0x30(%esi,%eax,4),%eax
+}
+    10e8:	5b                   	pop    %ebx
+    10e9:	5e                   	pop    %esi
+    10ea:	5f                   	pop    %edi
+    10eb:	5d                   	pop    %ebp
+    10ec:	c3                   	ret
+    10ed:	8d 76 00             	lea    0x0(%esi),%esi
+    10f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    10f3:	31 c0                	xor    %eax,%eax
+}
+    10f5:	5b                   	pop    %ebx
+    10f6:	5e                   	pop    %esi
+    10f7:	5f                   	pop    %edi
+    10f8:	5d                   	pop    %ebp
+    10f9:	c3                   	ret
+    10fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001100 <climittest>:
+{
+    1100:	55                   	push   %ebp
+    1101:	89 e5                	mov    %esp,%ebp
+    1103:	57                   	push   %edi
+    1104:	56                   	push   %esi
+    1105:	53                   	push   %ebx
+    1106:	83 ec 24             	sub    $0x24,%esp
+  printf(stdout, "climit test\n");
+    1109:	68 c8 2e 00 00       	push   $0x2ec8
+    110e:	ff 35 c0 3e 00 00    	push   0x3ec0
+    1114:	e8 a7 11 00 00       	call   22c0 <printf>
+  if(mkdir("/climittest") < 0 || ccreate("/climittest") < 0 ||
+    1119:	c7 04 24 d5 2e 00 00 	movl   $0x2ed5,(%esp)
+    1120:	e8 56 10 00 00       	call   217b <mkdir>
+    1125:	83 c4 10             	add    $0x10,%esp
+    1128:	85 c0                	test   %eax,%eax
+    112a:	0f 88 b4 01 00 00    	js     12e4 <climittest+0x1e4>
+    1130:	83 ec 0c             	sub    $0xc,%esp
+    1133:	68 d5 2e 00 00       	push   $0x2ed5
+    1138:	e8 8e 0f 00 00       	call   20cb <ccreate>
+    113d:	83 c4 10             	add    $0x10,%esp
+    1140:	85 c0                	test   %eax,%eax
+    1142:	0f 88 9c 01 00 00    	js     12e4 <climittest+0x1e4>
+     climit("climittest", CLIMITKB) < 0){
+    1148:	83 ec 08             	sub    $0x8,%esp
+    114b:	68 00 02 00 00       	push   $0x200
+    1150:	68 d6 2e 00 00       	push   $0x2ed6
+    1155:	e8 79 10 00 00       	call   21d3 <climit>
+  if(mkdir("/climittest") < 0 || ccreate("/climittest") < 0 ||
+    115a:	83 c4 10             	add    $0x10,%esp
+    115d:	85 c0                	test   %eax,%eax
+    115f:	0f 88 7f 01 00 00    	js     12e4 <climittest+0x1e4>
+  if((cid = cstart("climittest")) < 0 || pipe(fds) < 0){
+    1165:	83 ec 0c             	sub    $0xc,%esp
+    1168:	68 d6 2e 00 00       	push   $0x2ed6
+    116d:	e8 89 0f 00 00       	call   20fb <cstart>
+    1172:	83 c4 10             	add    $0x10,%esp
+    1175:	89 c3                	mov    %eax,%ebx
+    1177:	85 c0                	test   %eax,%eax
+    1179:	0f 88 45 02 00 00    	js     13c4 <climittest+0x2c4>
+    117f:	83 ec 0c             	sub    $0xc,%esp
+    1182:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    1185:	50                   	push   %eax
+    1186:	e8 98 0f 00 00       	call   2123 <pipe>
+    118b:	83 c4 10             	add    $0x10,%esp
+    118e:	85 c0                	test   %eax,%eax
+    1190:	0f 88 2e 02 00 00    	js     13c4 <climittest+0x2c4>
+  pid = cfork(cid);
+    1196:	83 ec 0c             	sub    $0xc,%esp
+    1199:	53                   	push   %ebx
+    119a:	e8 34 0f 00 00       	call   20d3 <cfork>
+  if(pid < 0){
+    119f:	83 c4 10             	add    $0x10,%esp
+    11a2:	85 c0                	test   %eax,%eax
+    11a4:	0f 88 03 02 00 00    	js     13ad <climittest+0x2ad>
+  if(pid == 0){
+    11aa:	0f 84 af 01 00 00    	je     135f <climittest+0x25f>
+  close(fds[1]);
+    11b0:	83 ec 0c             	sub    $0xc,%esp
+    11b3:	ff 75 e4             	push   -0x1c(%ebp)
+    11b6:	e8 80 0f 00 00       	call   213b <close>
+  if(read(fds[0], &n, sizeof(n)) != sizeof(n)){
+    11bb:	83 c4 0c             	add    $0xc,%esp
+    11be:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    11c1:	6a 04                	push   $0x4
+    11c3:	50                   	push   %eax
+    11c4:	ff 75 e0             	push   -0x20(%ebp)
+    11c7:	e8 5f 0f 00 00       	call   212b <read>
+    11cc:	83 c4 10             	add    $0x10,%esp
+    11cf:	83 f8 04             	cmp    $0x4,%eax
+    11d2:	0f 85 70 01 00 00    	jne    1348 <climittest+0x248>
+  close(fds[0]);
+    11d8:	83 ec 0c             	sub    $0xc,%esp
+    11db:	ff 75 e0             	push   -0x20(%ebp)
+    11de:	e8 58 0f 00 00       	call   213b <close>
+  if(n == 2*CLIMITKB/4){
+    11e3:	83 c4 10             	add    $0x10,%esp
+    11e6:	81 7d dc 00 01 00 00 	cmpl   $0x100,-0x24(%ebp)
+    11ed:	0f 84 3e 01 00 00    	je     1331 <climittest+0x231>
+    11f3:	bf 64 00 00 00       	mov    $0x64,%edi
+    11f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11ff:	90                   	nop
+  if(memstats(ms, 0, 0) < 0)
+    1200:	83 ec 04             	sub    $0x4,%esp
+    1203:	6a 00                	push   $0x0
+    1205:	6a 00                	push   $0x0
+    1207:	68 40 70 00 00       	push   $0x7040
+    120c:	e8 02 10 00 00       	call   2213 <memstats>
+    1211:	83 c4 10             	add    $0x10,%esp
+    1214:	85 c0                	test   %eax,%eax
+    1216:	0f 88 fe 00 00 00    	js     131a <climittest+0x21a>
+  for(i = 0; i < ms->ncont; i++)
+    121c:	a1 6c 70 00 00       	mov    0x706c,%eax
+    1221:	85 c0                	test   %eax,%eax
+    1223:	0f 8e f1 00 00 00    	jle    131a <climittest+0x21a>
+    1229:	31 f6                	xor    %esi,%esi
+    122b:	31 db                	xor    %ebx,%ebx
+    122d:	eb 13                	jmp    1242 <climittest+0x142>
+    122f:	90                   	nop
+    1230:	83 c3 01             	add    $0x1,%ebx
+    1233:	83 c6 24             	add    $0x24,%esi
+    1236:	3b 1d 6c 70 00 00    	cmp    0x706c,%ebx
+    123c:	0f 8d d8 00 00 00    	jge    131a <climittest+0x21a>
+    if(strcmp(ms->cont[i].name, name) == 0)
+    1242:	83 ec 08             	sub    $0x8,%esp
+    1245:	8d 86 74 70 00 00    	lea    0x7074(%esi),%eax
+    124b:	68 d6 2e 00 00       	push   $0x2ed6
+    1250:	50                   	push   %eax
+    1251:	e8 6a 0c 00 00       	call   1ec0 <strcmp>
+    1256:	83 c4 10             	add    $0x10,%esp
+    1259:	85 c0                	test   %eax,%eax
+    125b:	75 d3                	jne    1230 <climittest+0x130>
+    if((cm = contmem(&ms, "climittest")) == 0 || cm->nproc == 0)
+    125d:	8d 04 db             	lea    (%ebx,%ebx,8),%eax
+    1260:	8b 04 85 84 70 00 00 	mov    0x7084(,%eax,4),%eax
+    1267:	85 c0                	test   %eax,%eax
+    1269:	74 12                	je     127d <climittest+0x17d>
+    sleep(1);
+    126b:	83 ec 0c             	sub    $0xc,%esp
+    126e:	6a 01                	push   $0x1
+    1270:	e8 2e 0f 00 00       	call   21a3 <sleep>
+  for(i = 0; i < 100; i++){
+    1275:	83 c4 10             	add    $0x10,%esp
+    1278:	83 ef 01             	sub    $0x1,%edi
+    127b:	75 83                	jne    1200 <climittest+0x100>
+  if(cm == 0 || cm->nproc != 0){
+    127d:	8b 9e 84 70 00 00    	mov    0x7084(%esi),%ebx
+      return &ms->cont[i];
+    1283:	8d 86 70 70 00 00    	lea    0x7070(%esi),%eax
+  if(cm == 0 || cm->nproc != 0){
+    1289:	85 db                	test   %ebx,%ebx
+    128b:	0f 85 89 00 00 00    	jne    131a <climittest+0x21a>
+  if(cm->memlimit != CLIMITKB/4 || cm->peakmem != cm->memlimit || cm->mem != 0){
+    1291:	8b 50 20             	mov    0x20(%eax),%edx
+    1294:	8b 48 1c             	mov    0x1c(%eax),%ecx
+    1297:	8b 40 18             	mov    0x18(%eax),%eax
+    129a:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+    12a0:	75 5a                	jne    12fc <climittest+0x1fc>
+    12a2:	81 f9 80 00 00 00    	cmp    $0x80,%ecx
+    12a8:	75 52                	jne    12fc <climittest+0x1fc>
+    12aa:	85 c0                	test   %eax,%eax
+    12ac:	75 4e                	jne    12fc <climittest+0x1fc>
+  cstop("climittest");
+    12ae:	83 ec 0c             	sub    $0xc,%esp
+    12b1:	68 d6 2e 00 00       	push   $0x2ed6
+    12b6:	e8 48 0e 00 00       	call   2103 <cstop>
+  unlink("/climittest");
+    12bb:	c7 04 24 d5 2e 00 00 	movl   $0x2ed5,(%esp)
+    12c2:	e8 9c 0e 00 00       	call   2163 <unlink>
+  printf(stdout, "climit test ok\n");
+    12c7:	58                   	pop    %eax
+    12c8:	5a                   	pop    %edx
+    12c9:	68 fc 2e 00 00       	push   $0x2efc
+    12ce:	ff 35 c0 3e 00 00    	push   0x3ec0
+    12d4:	e8 e7 0f 00 00       	call   22c0 <printf>
+}
+    12d9:	83 c4 10             	add    $0x10,%esp
+    12dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12df:	5b                   	pop    %ebx
+    12e0:	5e                   	pop    %esi
+    12e1:	5f                   	pop    %edi
+    12e2:	5d                   	pop    %ebp
+    12e3:	c3                   	ret
+    printf(stdout, "climit test: cannot make container\n");
+    12e4:	83 ec 08             	sub    $0x8,%esp
+    12e7:	68 8c 33 00 00       	push   $0x338c
+    12ec:	ff 35 c0 3e 00 00    	push   0x3ec0
+    12f2:	e8 c9 0f 00 00       	call   22c0 <printf>
+    exit();
+    12f7:	e8 17 0e 00 00       	call   2113 <exit>
+    printf(stdout, "climit test: limit %d peak %d mem %d pages\n",
+    12fc:	83 ec 0c             	sub    $0xc,%esp
+    12ff:	50                   	push   %eax
+    1300:	51                   	push   %ecx
+    1301:	52                   	push   %edx
+    1302:	68 48 34 00 00       	push   $0x3448
+    1307:	ff 35 c0 3e 00 00    	push   0x3ec0
+    130d:	e8 ae 0f 00 00       	call   22c0 <printf>
+    exit();
+    1312:	83 c4 20             	add    $0x20,%esp
+    1315:	e8 f9 0d 00 00       	call   2113 <exit>
+    printf(stdout, "climit test: child did not go away\n");
+    131a:	51                   	push   %ecx
+    131b:	51                   	push   %ecx
+    131c:	68 24 34 00 00       	push   $0x3424
+    1321:	ff 35 c0 3e 00 00    	push   0x3ec0
+    1327:	e8 94 0f 00 00       	call   22c0 <printf>
+    exit();
+    132c:	e8 e2 0d 00 00       	call   2113 <exit>
+    printf(stdout, "climit test: allocated past the limit\n");
+    1331:	50                   	push   %eax
+    1332:	50                   	push   %eax
+    1333:	68 fc 33 00 00       	push   $0x33fc
+    1338:	ff 35 c0 3e 00 00    	push   0x3ec0
+    133e:	e8 7d 0f 00 00       	call   22c0 <printf>
+    exit();
+    1343:	e8 cb 0d 00 00       	call   2113 <exit>
+    printf(stdout, "climit test: no count from child\n");
+    1348:	50                   	push   %eax
+    1349:	50                   	push   %eax
+    134a:	68 d8 33 00 00       	push   $0x33d8
+    134f:	ff 35 c0 3e 00 00    	push   0x3ec0
+    1355:	e8 66 0f 00 00       	call   22c0 <printf>
+    exit();
+    135a:	e8 b4 0d 00 00       	call   2113 <exit>
+    close(fds[0]);
+    135f:	83 ec 0c             	sub    $0xc,%esp
+    1362:	ff 75 e0             	push   -0x20(%ebp)
+    1365:	e8 d1 0d 00 00       	call   213b <close>
+    for(n = 0; n < 2*CLIMITKB/4; n++)
+    136a:	31 d2                	xor    %edx,%edx
+    136c:	83 c4 10             	add    $0x10,%esp
+    136f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    1372:	eb 10                	jmp    1384 <climittest+0x284>
+    1374:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    1377:	83 c0 01             	add    $0x1,%eax
+    137a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    137d:	3d ff 00 00 00       	cmp    $0xff,%eax
+    1382:	7f 15                	jg     1399 <climittest+0x299>
+      if(sbrk(4096) == (char*)-1)
+    1384:	83 ec 0c             	sub    $0xc,%esp
+    1387:	68 00 10 00 00       	push   $0x1000
+    138c:	e8 0a 0e 00 00       	call   219b <sbrk>
+    1391:	83 c4 10             	add    $0x10,%esp
+    1394:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1397:	75 db                	jne    1374 <climittest+0x274>
+    write(fds[1], &n, sizeof(n));
+    1399:	50                   	push   %eax
+    139a:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    139d:	6a 04                	push   $0x4
+    139f:	50                   	push   %eax
+    13a0:	ff 75 e4             	push   -0x1c(%ebp)
+    13a3:	e8 8b 0d 00 00       	call   2133 <write>
+    exit();
+    13a8:	e8 66 0d 00 00       	call   2113 <exit>
+    printf(stdout, "climit test: cfork failed\n");
+    13ad:	51                   	push   %ecx
+    13ae:	51                   	push   %ecx
+    13af:	68 e1 2e 00 00       	push   $0x2ee1
+    13b4:	ff 35 c0 3e 00 00    	push   0x3ec0
+    13ba:	e8 01 0f 00 00       	call   22c0 <printf>
+    exit();
+    13bf:	e8 4f 0d 00 00       	call   2113 <exit>
+    printf(stdout, "climit test: cannot start container\n");
+    13c4:	53                   	push   %ebx
+    13c5:	53                   	push   %ebx
+    13c6:	68 b0 33 00 00       	push   $0x33b0
+    13cb:	ff 35 c0 3e 00 00    	push   0x3ec0
+    13d1:	e8 ea 0e 00 00       	call   22c0 <printf>
+    exit();
+    13d6:	e8 38 0d 00 00       	call   2113 <exit>
+    13db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    13df:	90                   	nop
+
+000013e0 <pattern>:
+{
+    13e0:	55                   	push   %ebp
+    13e1:	89 e5                	mov    %esp,%ebp
+    13e3:	57                   	push   %edi
+    13e4:	56                   	push   %esi
+    13e5:	53                   	push   %ebx
+    13e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    13e9:	8b 75 14             	mov    0x14(%ebp),%esi
+  for(i = 0; i < n; i++){
+    13ec:	85 c9                	test   %ecx,%ecx
+    13ee:	7e 60                	jle    1450 <pattern+0x70>
+    13f0:	8b 45 10             	mov    0x10(%ebp),%eax
+    13f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  bad = 0;
+    13f6:	31 db                	xor    %ebx,%ebx
+    13f8:	01 c1                	add    %eax,%ecx
+    13fa:	eb 1d                	jmp    1419 <pattern+0x39>
+    13fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      w[1023] = ~(seed + i);
+    1400:	89 c7                	mov    %eax,%edi
+      w[0] = seed + i;
+    1402:	89 02                	mov    %eax,(%edx)
+      w[1023] = ~(seed + i);
+    1404:	f7 d7                	not    %edi
+    1406:	89 ba fc 0f 00 00    	mov    %edi,0xffc(%edx)
+  for(i = 0; i < n; i++){
+    140c:	83 c0 01             	add    $0x1,%eax
+    140f:	81 c2 00 10 00 00    	add    $0x1000,%edx
+    1415:	39 c1                	cmp    %eax,%ecx
+    1417:	74 18                	je     1431 <pattern+0x51>
+    if(!check){
+    1419:	85 f6                	test   %esi,%esi
+    141b:	74 e3                	je     1400 <pattern+0x20>
+    } else if(w[0] != seed + i || w[1023] != ~(seed + i))
+    141d:	39 02                	cmp    %eax,(%edx)
+    141f:	74 1f                	je     1440 <pattern+0x60>
+  for(i = 0; i < n; i++){
+    1421:	83 c0 01             	add    $0x1,%eax
+      bad++;
+    1424:	83 c3 01             	add    $0x1,%ebx
+  for(i = 0; i < n; i++){
+    1427:	81 c2 00 10 00 00    	add    $0x1000,%edx
+    142d:	39 c1                	cmp    %eax,%ecx
+    142f:	75 e8                	jne    1419 <pattern+0x39>
+}
+    1431:	89 d8                	mov    %ebx,%eax
+    1433:	5b                   	pop    %ebx
+    1434:	5e                   	pop    %esi
+    1435:	5f                   	pop    %edi
+    1436:	5d                   	pop    %ebp
+    1437:	c3                   	ret
+    1438:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    143f:	90                   	nop
+    } else if(w[0] != seed + i || w[1023] != ~(seed + i))
+    1440:	89 c7                	mov    %eax,%edi
+    1442:	f7 d7                	not    %edi
+    1444:	39 ba fc 0f 00 00    	cmp    %edi,0xffc(%edx)
+    144a:	75 d5                	jne    1421 <pattern+0x41>
+    144c:	eb be                	jmp    140c <pattern+0x2c>
+    144e:	66 90                	xchg   %ax,%ax
+  bad = 0;
+    1450:	31 db                	xor    %ebx,%ebx
+}
+    1452:	89 d8                	mov    %ebx,%eax
+    1454:	5b                   	pop    %ebx
+    1455:	5e                   	pop    %esi
+    1456:	5f                   	pop    %edi
+    1457:	5d                   	pop    %ebp
+    1458:	c3                   	ret
+    1459:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001460 <growpages>:
+{
+    1460:	55                   	push   %ebp
+    1461:	89 e5                	mov    %esp,%ebp
+    1463:	57                   	push   %edi
+    1464:	56                   	push   %esi
+    1465:	53                   	push   %ebx
+    1466:	83 ec 18             	sub    $0x18,%esp
+    1469:	8b 7d 08             	mov    0x8(%ebp),%edi
+  start = sbrk(0);
+    146c:	6a 00                	push   $0x0
+    146e:	e8 28 0d 00 00       	call   219b <sbrk>
+  for(; n > 0; n -= step){
+    1473:	83 c4 10             	add    $0x10,%esp
+  start = sbrk(0);
+    1476:	89 c6                	mov    %eax,%esi
+  for(; n > 0; n -= step){
+    1478:	85 ff                	test   %edi,%edi
+    147a:	7f 0a                	jg     1486 <growpages+0x26>
+    147c:	eb 2a                	jmp    14a8 <growpages+0x48>
+    147e:	66 90                	xchg   %ax,%ax
+    1480:	29 df                	sub    %ebx,%edi
+    1482:	85 ff                	test   %edi,%edi
+    1484:	7e 22                	jle    14a8 <growpages+0x48>
+    step = n < 256 ? n : 256;
+    1486:	b8 00 01 00 00       	mov    $0x100,%eax
+    148b:	39 c7                	cmp    %eax,%edi
+    148d:	0f 4e c7             	cmovle %edi,%eax
+    if(sbrk(step*4096) == (char*)-1)
+    1490:	83 ec 0c             	sub    $0xc,%esp
+    step = n < 256 ? n : 256;
+    1493:	89 c3                	mov    %eax,%ebx
+    if(sbrk(step*4096) == (char*)-1)
+    1495:	c1 e0 0c             	shl    $0xc,%eax
+    1498:	50                   	push   %eax
+    1499:	e8 fd 0c 00 00       	call   219b <sbrk>
+    149e:	83 c4 10             	add    $0x10,%esp
+    14a1:	83 f8 ff             	cmp    $0xffffffff,%eax
+    14a4:	75 da                	jne    1480 <growpages+0x20>
+      return 0;
+    14a6:	31 f6                	xor    %esi,%esi
+}
+    14a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    14ab:	89 f0                	mov    %esi,%eax
+    14ad:	5b                   	pop    %ebx
+    14ae:	5e                   	pop    %esi
+    14af:	5f                   	pop    %edi
+    14b0:	5d                   	pop    %ebp
+    14b1:	c3                   	ret
+    14b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000014c0 <ckptchild>:
+{
+    14c0:	55                   	push   %ebp
+    14c1:	89 e5                	mov    %esp,%ebp
+    14c3:	57                   	push   %edi
+    14c4:	56                   	push   %esi
+    14c5:	53                   	push   %ebx
+    14c6:	83 ec 28             	sub    $0x28,%esp
+  heap = sbrk(4096);
+    14c9:	68 00 10 00 00       	push   $0x1000
+    14ce:	e8 c8 0c 00 00       	call   219b <sbrk>
+      w[1023] = ~(seed + i);
+    14d3:	c7 05 dc 5e 00 00 f4 	movl   $0xfffffff4,0x5edc
+    14da:	ff ff ff 
+      w[0] = seed + i;
+    14dd:	c7 05 e0 5e 00 00 0c 	movl   $0xc,0x5ee0
+    14e4:	00 00 00 
+  heap = sbrk(4096);
+    14e7:	89 c3                	mov    %eax,%ebx
+      w[1023] = ~(seed + i);
+    14e9:	c7 05 dc 6e 00 00 f3 	movl   $0xfffffff3,0x6edc
+    14f0:	ff ff ff 
+      w[0] = seed + i;
+    14f3:	c7 05 e0 4e 00 00 0b 	movl   $0xb,0x4ee0
+    14fa:	00 00 00 
+      w[1023] = ~(seed + i);
+    14fd:	c7 80 fc 0f 00 00 e9 	movl   $0xffffffe9,0xffc(%eax)
+    1504:	ff ff ff 
+      w[0] = seed + i;
+    1507:	c7 00 16 00 00 00    	movl   $0x16,(%eax)
+  if((fd = open("data", O_CREATE|O_RDWR)) < 0 ||
+    150d:	58                   	pop    %eax
+    150e:	5a                   	pop    %edx
+    150f:	68 02 02 00 00       	push   $0x202
+    1514:	68 e6 2f 00 00       	push   $0x2fe6
+    1519:	e8 35 0c 00 00       	call   2153 <open>
+    151e:	83 c4 10             	add    $0x10,%esp
+    1521:	85 c0                	test   %eax,%eax
+    1523:	78 18                	js     153d <ckptchild+0x7d>
+    1525:	89 c6                	mov    %eax,%esi
+     write(fd, "0123456789", 10) != 10 || (fd2 = dup(fd)) < 0)
+    1527:	50                   	push   %eax
+    1528:	6a 0a                	push   $0xa
+    152a:	68 13 2f 00 00       	push   $0x2f13
+    152f:	56                   	push   %esi
+    1530:	e8 fe 0b 00 00       	call   2133 <write>
+  if((fd = open("data", O_CREATE|O_RDWR)) < 0 ||
+    1535:	83 c4 10             	add    $0x10,%esp
+    1538:	83 f8 0a             	cmp    $0xa,%eax
+    153b:	74 05                	je     1542 <ckptchild+0x82>
+    exit();
+    153d:	e8 d1 0b 00 00       	call   2113 <exit>
+     write(fd, "0123456789", 10) != 10 || (fd2 = dup(fd)) < 0)
+    1542:	83 ec 0c             	sub    $0xc,%esp
+    1545:	56                   	push   %esi
+    1546:	e8 40 0c 00 00       	call   218b <dup>
+    154b:	83 c4 10             	add    $0x10,%esp
+    154e:	89 c7                	mov    %eax,%edi
+    1550:	85 c0                	test   %eax,%eax
+    1552:	78 e9                	js     153d <ckptchild+0x7d>
+  bad = open("ready", O_CREATE|O_RDWR);
+    1554:	50                   	push   %eax
+    1555:	50                   	push   %eax
+    1556:	68 02 02 00 00       	push   $0x202
+    155b:	68 8f 2f 00 00       	push   $0x2f8f
+    1560:	e8 ee 0b 00 00       	call   2153 <open>
+  write(bad, "r", 1);
+    1565:	83 c4 0c             	add    $0xc,%esp
+    1568:	6a 01                	push   $0x1
+    156a:	68 7a 2f 00 00       	push   $0x2f7a
+    156f:	50                   	push   %eax
+    1570:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1573:	e8 bb 0b 00 00       	call   2133 <write>
+  close(bad);
+    1578:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    157b:	89 14 24             	mov    %edx,(%esp)
+    157e:	e8 b8 0b 00 00       	call   213b <close>
+  while((bad = open("go", O_RDONLY)) < 0)
+    1583:	83 c4 10             	add    $0x10,%esp
+    1586:	eb 0d                	jmp    1595 <ckptchild+0xd5>
+    sleep(1);
+    1588:	83 ec 0c             	sub    $0xc,%esp
+    158b:	6a 01                	push   $0x1
+    158d:	e8 11 0c 00 00       	call   21a3 <sleep>
+    1592:	83 c4 10             	add    $0x10,%esp
+  while((bad = open("go", O_RDONLY)) < 0)
+    1595:	51                   	push   %ecx
+    1596:	51                   	push   %ecx
+    1597:	6a 00                	push   $0x0
+    1599:	68 b6 2f 00 00       	push   $0x2fb6
+    159e:	e8 b0 0b 00 00       	call   2153 <open>
+    15a3:	83 c4 10             	add    $0x10,%esp
+    15a6:	85 c0                	test   %eax,%eax
+    15a8:	78 de                	js     1588 <ckptchild+0xc8>
+  close(bad);
+    15aa:	83 ec 0c             	sub    $0xc,%esp
+    15ad:	50                   	push   %eax
+    15ae:	e8 88 0b 00 00       	call   213b <close>
+  bad = pattern(buf, 2, 11, 1) + pattern(heap, 1, 22, 1);
+    15b3:	6a 01                	push   $0x1
+    15b5:	6a 0b                	push   $0xb
+    15b7:	6a 02                	push   $0x2
+    15b9:	68 e0 4e 00 00       	push   $0x4ee0
+    15be:	e8 1d fe ff ff       	call   13e0 <pattern>
+    15c3:	83 c4 20             	add    $0x20,%esp
+    15c6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    15c9:	6a 01                	push   $0x1
+    15cb:	6a 16                	push   $0x16
+    15cd:	6a 01                	push   $0x1
+    15cf:	53                   	push   %ebx
+    15d0:	e8 0b fe ff ff       	call   13e0 <pattern>
+  if(write(fd, "A", 1) != 1 || write(fd2, "B", 1) != 1)
+    15d5:	83 c4 0c             	add    $0xc,%esp
+  bad = pattern(buf, 2, 11, 1) + pattern(heap, 1, 22, 1);
+    15d8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  if(write(fd, "A", 1) != 1 || write(fd2, "B", 1) != 1)
+    15db:	6a 01                	push   $0x1
+    15dd:	68 1e 2f 00 00       	push   $0x2f1e
+  bad = pattern(buf, 2, 11, 1) + pattern(heap, 1, 22, 1);
+    15e2:	01 c3                	add    %eax,%ebx
+  if(write(fd, "A", 1) != 1 || write(fd2, "B", 1) != 1)
+    15e4:	56                   	push   %esi
+    15e5:	e8 49 0b 00 00       	call   2133 <write>
+    15ea:	83 c4 10             	add    $0x10,%esp
+    15ed:	83 e8 01             	sub    $0x1,%eax
+    15f0:	74 45                	je     1637 <ckptchild+0x177>
+    bad++;
+    15f2:	83 c3 01             	add    $0x1,%ebx
+  fd = open("result", O_CREATE|O_RDWR);
+    15f5:	50                   	push   %eax
+    15f6:	50                   	push   %eax
+    15f7:	68 02 02 00 00       	push   $0x202
+    15fc:	68 cc 2f 00 00       	push   $0x2fcc
+    1601:	e8 4d 0b 00 00       	call   2153 <open>
+  write(fd, bad ? "bad" : "ok", bad ? 3 : 2);
+    1606:	83 c4 0c             	add    $0xc,%esp
+    1609:	83 fb 01             	cmp    $0x1,%ebx
+    160c:	b9 0c 2f 00 00       	mov    $0x2f0c,%ecx
+    1611:	19 d2                	sbb    %edx,%edx
+  fd = open("result", O_CREATE|O_RDWR);
+    1613:	89 c6                	mov    %eax,%esi
+  write(fd, bad ? "bad" : "ok", bad ? 3 : 2);
+    1615:	b8 10 2f 00 00       	mov    $0x2f10,%eax
+    161a:	83 c2 03             	add    $0x3,%edx
+    161d:	85 db                	test   %ebx,%ebx
+    161f:	0f 45 c1             	cmovne %ecx,%eax
+    1622:	52                   	push   %edx
+    1623:	50                   	push   %eax
+    1624:	56                   	push   %esi
+    1625:	e8 09 0b 00 00       	call   2133 <write>
+  close(fd);
+    162a:	89 34 24             	mov    %esi,(%esp)
+    162d:	e8 09 0b 00 00       	call   213b <close>
+  exit();
+    1632:	e8 dc 0a 00 00       	call   2113 <exit>
+  if(write(fd, "A", 1) != 1 || write(fd2, "B", 1) != 1)
+    1637:	52                   	push   %edx
+    1638:	6a 01                	push   $0x1
+    163a:	68 f6 2f 00 00       	push   $0x2ff6
+    163f:	57                   	push   %edi
+    1640:	e8 ee 0a 00 00       	call   2133 <write>
+    1645:	83 c4 10             	add    $0x10,%esp
+    1648:	83 e8 01             	sub    $0x1,%eax
+    164b:	75 a5                	jne    15f2 <ckptchild+0x132>
+    164d:	eb a6                	jmp    15f5 <ckptchild+0x135>
+    164f:	90                   	nop
+
+00001650 <waitfile>:
+{
+    1650:	55                   	push   %ebp
+    1651:	89 e5                	mov    %esp,%ebp
+    1653:	57                   	push   %edi
+    1654:	56                   	push   %esi
+    1655:	53                   	push   %ebx
+    1656:	bb 64 00 00 00       	mov    $0x64,%ebx
+    165b:	83 ec 0c             	sub    $0xc,%esp
+    165e:	eb 12                	jmp    1672 <waitfile+0x22>
+    sleep(10);
+    1660:	83 ec 0c             	sub    $0xc,%esp
+    1663:	6a 0a                	push   $0xa
+    1665:	e8 39 0b 00 00       	call   21a3 <sleep>
+  for(i = 0; i < 100; i++){
+    166a:	83 c4 10             	add    $0x10,%esp
+    166d:	83 eb 01             	sub    $0x1,%ebx
+    1670:	74 40                	je     16b2 <waitfile+0x62>
+    if((fd = open(path, O_RDONLY)) >= 0){
+    1672:	83 ec 08             	sub    $0x8,%esp
+    1675:	6a 00                	push   $0x0
+    1677:	ff 75 08             	push   0x8(%ebp)
+    167a:	e8 d4 0a 00 00       	call   2153 <open>
+    167f:	83 c4 10             	add    $0x10,%esp
+    1682:	89 c6                	mov    %eax,%esi
+    1684:	85 c0                	test   %eax,%eax
+    1686:	78 d8                	js     1660 <waitfile+0x10>
+      r = read(fd, b, n);
+    1688:	83 ec 04             	sub    $0x4,%esp
+    168b:	ff 75 10             	push   0x10(%ebp)
+    168e:	ff 75 0c             	push   0xc(%ebp)
+    1691:	50                   	push   %eax
+    1692:	e8 94 0a 00 00       	call   212b <read>
+      close(fd);
+    1697:	89 34 24             	mov    %esi,(%esp)
+      r = read(fd, b, n);
+    169a:	89 c7                	mov    %eax,%edi
+      close(fd);
+    169c:	e8 9a 0a 00 00       	call   213b <close>
+      if(r > 0)
+    16a1:	83 c4 10             	add    $0x10,%esp
+    16a4:	85 ff                	test   %edi,%edi
+    16a6:	7e b8                	jle    1660 <waitfile+0x10>
+}
+    16a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    16ab:	89 f8                	mov    %edi,%eax
+    16ad:	5b                   	pop    %ebx
+    16ae:	5e                   	pop    %esi
+    16af:	5f                   	pop    %edi
+    16b0:	5d                   	pop    %ebp
+    16b1:	c3                   	ret
+    16b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+    16b5:	31 ff                	xor    %edi,%edi
+}
+    16b7:	5b                   	pop    %ebx
+    16b8:	89 f8                	mov    %edi,%eax
+    16ba:	5e                   	pop    %esi
+    16bb:	5f                   	pop    %edi
+    16bc:	5d                   	pop    %ebp
+    16bd:	c3                   	ret
+    16be:	66 90                	xchg   %ax,%ax
+
+000016c0 <ckpttest>:
+{
+    16c0:	55                   	push   %ebp
+    16c1:	89 e5                	mov    %esp,%ebp
+    16c3:	53                   	push   %ebx
+    16c4:	83 ec 2c             	sub    $0x2c,%esp
+  char *args[] = { "systests", "ckptchild", 0 };
+    16c7:	c7 45 dc 30 2f 00 00 	movl   $0x2f30,-0x24(%ebp)
+    16ce:	c7 45 e0 39 2f 00 00 	movl   $0x2f39,-0x20(%ebp)
+    16d5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  printf(stdout, "checkpoint test\n");
+    16dc:	68 43 2f 00 00       	push   $0x2f43
+    16e1:	ff 35 c0 3e 00 00    	push   0x3ec0
+    16e7:	e8 d4 0b 00 00       	call   22c0 <printf>
+  if(mkdir("/ckptload") < 0 || ccreate("/ckptload") < 0 ||
+    16ec:	c7 04 24 54 2f 00 00 	movl   $0x2f54,(%esp)
+    16f3:	e8 83 0a 00 00       	call   217b <mkdir>
+    16f8:	83 c4 10             	add    $0x10,%esp
+    16fb:	85 c0                	test   %eax,%eax
+    16fd:	0f 88 61 02 00 00    	js     1964 <ckpttest+0x2a4>
+    1703:	83 ec 0c             	sub    $0xc,%esp
+    1706:	68 54 2f 00 00       	push   $0x2f54
+    170b:	e8 bb 09 00 00       	call   20cb <ccreate>
+    1710:	83 c4 10             	add    $0x10,%esp
+    1713:	85 c0                	test   %eax,%eax
+    1715:	0f 88 49 02 00 00    	js     1964 <ckpttest+0x2a4>
+     mkdir("/ckptload/ckptsave") < 0 || ccreate("/ckptload/ckptsave") < 0 ||
+    171b:	83 ec 0c             	sub    $0xc,%esp
+    171e:	68 5e 2f 00 00       	push   $0x2f5e
+    1723:	e8 53 0a 00 00       	call   217b <mkdir>
+  if(mkdir("/ckptload") < 0 || ccreate("/ckptload") < 0 ||
+    1728:	83 c4 10             	add    $0x10,%esp
+    172b:	85 c0                	test   %eax,%eax
+    172d:	0f 88 31 02 00 00    	js     1964 <ckpttest+0x2a4>
+     mkdir("/ckptload/ckptsave") < 0 || ccreate("/ckptload/ckptsave") < 0 ||
+    1733:	83 ec 0c             	sub    $0xc,%esp
+    1736:	68 5e 2f 00 00       	push   $0x2f5e
+    173b:	e8 8b 09 00 00       	call   20cb <ccreate>
+    1740:	83 c4 10             	add    $0x10,%esp
+    1743:	85 c0                	test   %eax,%eax
+    1745:	0f 88 19 02 00 00    	js     1964 <ckpttest+0x2a4>
+     mkdir("/ckptother") < 0 || ccreate("/ckptother") < 0 ||
+    174b:	83 ec 0c             	sub    $0xc,%esp
+    174e:	68 71 2f 00 00       	push   $0x2f71
+    1753:	e8 23 0a 00 00       	call   217b <mkdir>
+     mkdir("/ckptload/ckptsave") < 0 || ccreate("/ckptload/ckptsave") < 0 ||
+    1758:	83 c4 10             	add    $0x10,%esp
+    175b:	85 c0                	test   %eax,%eax
+    175d:	0f 88 01 02 00 00    	js     1964 <ckpttest+0x2a4>
+     mkdir("/ckptother") < 0 || ccreate("/ckptother") < 0 ||
+    1763:	83 ec 0c             	sub    $0xc,%esp
+    1766:	68 71 2f 00 00       	push   $0x2f71
+    176b:	e8 5b 09 00 00       	call   20cb <ccreate>
+    1770:	83 c4 10             	add    $0x10,%esp
+    1773:	85 c0                	test   %eax,%eax
+    1775:	0f 88 e9 01 00 00    	js     1964 <ckpttest+0x2a4>
+     (cid = cstart("ckptsave")) < 0){
+    177b:	83 ec 0c             	sub    $0xc,%esp
+    177e:	68 68 2f 00 00       	push   $0x2f68
+    1783:	e8 73 09 00 00       	call   20fb <cstart>
+     mkdir("/ckptother") < 0 || ccreate("/ckptother") < 0 ||
+    1788:	83 c4 10             	add    $0x10,%esp
+    178b:	85 c0                	test   %eax,%eax
+    178d:	0f 88 d1 01 00 00    	js     1964 <ckpttest+0x2a4>
+  if(spawn("systests", args, 0, 0, cid) < 0){
+    1793:	83 ec 0c             	sub    $0xc,%esp
+    1796:	50                   	push   %eax
+    1797:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    179a:	6a 00                	push   $0x0
+    179c:	6a 00                	push   $0x0
+    179e:	50                   	push   %eax
+    179f:	68 30 2f 00 00       	push   $0x2f30
+    17a4:	e8 32 0a 00 00       	call   21db <spawn>
+    17a9:	83 c4 20             	add    $0x20,%esp
+    17ac:	85 c0                	test   %eax,%eax
+    17ae:	0f 88 90 02 00 00    	js     1a44 <ckpttest+0x384>
+  if(waitfile("/ckptload/ckptsave/ready", b, sizeof(b)) != 1){
+    17b4:	83 ec 04             	sub    $0x4,%esp
+    17b7:	8d 5d e8             	lea    -0x18(%ebp),%ebx
+    17ba:	6a 10                	push   $0x10
+    17bc:	53                   	push   %ebx
+    17bd:	68 7c 2f 00 00       	push   $0x2f7c
+    17c2:	e8 89 fe ff ff       	call   1650 <waitfile>
+    17c7:	83 c4 10             	add    $0x10,%esp
+    17ca:	83 f8 01             	cmp    $0x1,%eax
+    17cd:	0f 85 5a 02 00 00    	jne    1a2d <ckpttest+0x36d>
+  if(cpause("ckptsave") < 0){
+    17d3:	83 ec 0c             	sub    $0xc,%esp
+    17d6:	68 68 2f 00 00       	push   $0x2f68
+    17db:	e8 0b 09 00 00       	call   20eb <cpause>
+    17e0:	83 c4 10             	add    $0x10,%esp
+    17e3:	85 c0                	test   %eax,%eax
+    17e5:	0f 88 2b 02 00 00    	js     1a16 <ckpttest+0x356>
+  if((n = ccheckpoint("ckptsave", "/ckptsave.img")) != 1){
+    17eb:	83 ec 08             	sub    $0x8,%esp
+    17ee:	68 95 2f 00 00       	push   $0x2f95
+    17f3:	68 68 2f 00 00       	push   $0x2f68
+    17f8:	e8 fe 09 00 00       	call   21fb <ccheckpoint>
+    17fd:	83 c4 10             	add    $0x10,%esp
+    1800:	83 f8 01             	cmp    $0x1,%eax
+    1803:	0f 85 e6 01 00 00    	jne    19ef <ckpttest+0x32f>
+  if(cstop("ckptsave") < 0){
+    1809:	83 ec 0c             	sub    $0xc,%esp
+    180c:	68 68 2f 00 00       	push   $0x2f68
+    1811:	e8 ed 08 00 00       	call   2103 <cstop>
+    1816:	83 c4 10             	add    $0x10,%esp
+    1819:	85 c0                	test   %eax,%eax
+    181b:	0f 88 b7 01 00 00    	js     19d8 <ckpttest+0x318>
+  if(crestore("ckptother", "/ckptsave.img") != -1){
+    1821:	83 ec 08             	sub    $0x8,%esp
+    1824:	68 95 2f 00 00       	push   $0x2f95
+    1829:	68 72 2f 00 00       	push   $0x2f72
+    182e:	e8 d0 09 00 00       	call   2203 <crestore>
+    1833:	83 c4 10             	add    $0x10,%esp
+    1836:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1839:	0f 85 82 01 00 00    	jne    19c1 <ckpttest+0x301>
+  cstop("ckptother");
+    183f:	83 ec 0c             	sub    $0xc,%esp
+    1842:	68 72 2f 00 00       	push   $0x2f72
+    1847:	e8 b7 08 00 00       	call   2103 <cstop>
+  if(crestore("ckptload", "/ckptsave.img") != 1){
+    184c:	58                   	pop    %eax
+    184d:	5a                   	pop    %edx
+    184e:	68 95 2f 00 00       	push   $0x2f95
+    1853:	68 55 2f 00 00       	push   $0x2f55
+    1858:	e8 a6 09 00 00       	call   2203 <crestore>
+    185d:	83 c4 10             	add    $0x10,%esp
+    1860:	83 f8 01             	cmp    $0x1,%eax
+    1863:	0f 85 41 01 00 00    	jne    19aa <ckpttest+0x2ea>
+  close(open("/ckptload/ckptsave/go", O_CREATE|O_RDWR));
+    1869:	83 ec 08             	sub    $0x8,%esp
+    186c:	68 02 02 00 00       	push   $0x202
+    1871:	68 a3 2f 00 00       	push   $0x2fa3
+    1876:	e8 d8 08 00 00       	call   2153 <open>
+    187b:	89 04 24             	mov    %eax,(%esp)
+    187e:	e8 b8 08 00 00       	call   213b <close>
+  n = waitfile("/ckptload/ckptsave/result", b, sizeof(b)-1);
+    1883:	83 c4 0c             	add    $0xc,%esp
+    1886:	6a 0f                	push   $0xf
+    1888:	53                   	push   %ebx
+    1889:	68 b9 2f 00 00       	push   $0x2fb9
+    188e:	e8 bd fd ff ff       	call   1650 <waitfile>
+  b[n] = 0;
+    1893:	c6 44 05 e8 00       	movb   $0x0,-0x18(%ebp,%eax,1)
+  if(strcmp(b, "ok") != 0){
+    1898:	58                   	pop    %eax
+    1899:	5a                   	pop    %edx
+    189a:	68 10 2f 00 00       	push   $0x2f10
+    189f:	53                   	push   %ebx
+    18a0:	e8 1b 06 00 00       	call   1ec0 <strcmp>
+    18a5:	83 c4 10             	add    $0x10,%esp
+    18a8:	85 c0                	test   %eax,%eax
+    18aa:	0f 85 e3 00 00 00    	jne    1993 <ckpttest+0x2d3>
+  n = waitfile("/ckptload/ckptsave/data", b, sizeof(b)-1);
+    18b0:	83 ec 04             	sub    $0x4,%esp
+    18b3:	6a 0f                	push   $0xf
+    18b5:	53                   	push   %ebx
+    18b6:	68 d3 2f 00 00       	push   $0x2fd3
+    18bb:	e8 90 fd ff ff       	call   1650 <waitfile>
+  b[n] = 0;
+    18c0:	c6 44 05 e8 00       	movb   $0x0,-0x18(%ebp,%eax,1)
+  if(strcmp(b, "0123456789AB") != 0){
+    18c5:	58                   	pop    %eax
+    18c6:	5a                   	pop    %edx
+    18c7:	68 eb 2f 00 00       	push   $0x2feb
+    18cc:	53                   	push   %ebx
+    18cd:	e8 ee 05 00 00       	call   1ec0 <strcmp>
+    18d2:	83 c4 10             	add    $0x10,%esp
+    18d5:	85 c0                	test   %eax,%eax
+    18d7:	0f 85 9f 00 00 00    	jne    197c <ckpttest+0x2bc>
+  cstop("ckptload");
+    18dd:	83 ec 0c             	sub    $0xc,%esp
+    18e0:	68 55 2f 00 00       	push   $0x2f55
+    18e5:	e8 19 08 00 00       	call   2103 <cstop>
+  unlink("/ckptload/ckptsave/data");
+    18ea:	c7 04 24 d3 2f 00 00 	movl   $0x2fd3,(%esp)
+    18f1:	e8 6d 08 00 00       	call   2163 <unlink>
+  unlink("/ckptload/ckptsave/ready");
+    18f6:	c7 04 24 7c 2f 00 00 	movl   $0x2f7c,(%esp)
+    18fd:	e8 61 08 00 00       	call   2163 <unlink>
+  unlink("/ckptload/ckptsave/go");
+    1902:	c7 04 24 a3 2f 00 00 	movl   $0x2fa3,(%esp)
+    1909:	e8 55 08 00 00       	call   2163 <unlink>
+  unlink("/ckptload/ckptsave/result");
+    190e:	c7 04 24 b9 2f 00 00 	movl   $0x2fb9,(%esp)
+    1915:	e8 49 08 00 00       	call   2163 <unlink>
+  unlink("/ckptload/ckptsave");
+    191a:	c7 04 24 5e 2f 00 00 	movl   $0x2f5e,(%esp)
+    1921:	e8 3d 08 00 00       	call   2163 <unlink>
+  unlink("/ckptload");
+    1926:	c7 04 24 54 2f 00 00 	movl   $0x2f54,(%esp)
+    192d:	e8 31 08 00 00       	call   2163 <unlink>
+  unlink("/ckptother");
+    1932:	c7 04 24 71 2f 00 00 	movl   $0x2f71,(%esp)
+    1939:	e8 25 08 00 00       	call   2163 <unlink>
+  unlink("/ckptsave.img");
+    193e:	c7 04 24 95 2f 00 00 	movl   $0x2f95,(%esp)
+    1945:	e8 19 08 00 00       	call   2163 <unlink>
+  printf(stdout, "checkpoint test ok\n");
+    194a:	58                   	pop    %eax
+    194b:	5a                   	pop    %edx
+    194c:	68 f8 2f 00 00       	push   $0x2ff8
+    1951:	ff 35 c0 3e 00 00    	push   0x3ec0
+    1957:	e8 64 09 00 00       	call   22c0 <printf>
+}
+    195c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    195f:	83 c4 10             	add    $0x10,%esp
+    1962:	c9                   	leave
+    1963:	c3                   	ret
+    printf(stdout, "checkpoint test: cannot make containers\n");
+    1964:	83 ec 08             	sub    $0x8,%esp
+    1967:	68 74 34 00 00       	push   $0x3474
+    196c:	ff 35 c0 3e 00 00    	push   0x3ec0
+    1972:	e8 49 09 00 00       	call   22c0 <printf>
+    exit();
+    1977:	e8 97 07 00 00       	call   2113 <exit>
+    printf(stdout, "checkpoint test: restored descriptors wrong\n");
+    197c:	51                   	push   %ecx
+    197d:	51                   	push   %ecx
+    197e:	68 d0 35 00 00       	push   $0x35d0
+    1983:	ff 35 c0 3e 00 00    	push   0x3ec0
+    1989:	e8 32 09 00 00       	call   22c0 <printf>
+    exit();
+    198e:	e8 80 07 00 00       	call   2113 <exit>
+    printf(stdout, "checkpoint test: restored process failed\n");
+    1993:	51                   	push   %ecx
+    1994:	51                   	push   %ecx
+    1995:	68 a4 35 00 00       	push   $0x35a4
+    199a:	ff 35 c0 3e 00 00    	push   0x3ec0
+    19a0:	e8 1b 09 00 00       	call   22c0 <printf>
+    exit();
+    19a5:	e8 69 07 00 00       	call   2113 <exit>
+    printf(stdout, "checkpoint test: restore failed\n");
+    19aa:	51                   	push   %ecx
+    19ab:	51                   	push   %ecx
+    19ac:	68 80 35 00 00       	push   $0x3580
+    19b1:	ff 35 c0 3e 00 00    	push   0x3ec0
+    19b7:	e8 04 09 00 00       	call   22c0 <printf>
+    exit();
+    19bc:	e8 52 07 00 00       	call   2113 <exit>
+    printf(stdout, "checkpoint test: restored files outside the root\n");
+    19c1:	51                   	push   %ecx
+    19c2:	51                   	push   %ecx
+    19c3:	68 4c 35 00 00       	push   $0x354c
+    19c8:	ff 35 c0 3e 00 00    	push   0x3ec0
+    19ce:	e8 ed 08 00 00       	call   22c0 <printf>
+    exit();
+    19d3:	e8 3b 07 00 00       	call   2113 <exit>
+    printf(stdout, "checkpoint test: cstop failed\n");
+    19d8:	53                   	push   %ebx
+    19d9:	53                   	push   %ebx
+    19da:	68 2c 35 00 00       	push   $0x352c
+    19df:	ff 35 c0 3e 00 00    	push   0x3ec0
+    19e5:	e8 d6 08 00 00       	call   22c0 <printf>
+    exit();
+    19ea:	e8 24 07 00 00       	call   2113 <exit>
+    printf(stdout, "checkpoint test: saved %d processes%s\n", n,
+    19ef:	83 f8 fe             	cmp    $0xfffffffe,%eax
+    19f2:	b9 b8 30 00 00       	mov    $0x30b8,%ecx
+    19f7:	ba 20 2f 00 00       	mov    $0x2f20,%edx
+    19fc:	0f 45 d1             	cmovne %ecx,%edx
+    19ff:	52                   	push   %edx
+    1a00:	50                   	push   %eax
+    1a01:	68 04 35 00 00       	push   $0x3504
+    1a06:	ff 35 c0 3e 00 00    	push   0x3ec0
+    1a0c:	e8 af 08 00 00       	call   22c0 <printf>
+    exit();
+    1a11:	e8 fd 06 00 00       	call   2113 <exit>
+    printf(stdout, "checkpoint test: cpause failed\n");
+    1a16:	50                   	push   %eax
+    1a17:	50                   	push   %eax
+    1a18:	68 e4 34 00 00       	push   $0x34e4
+    1a1d:	ff 35 c0 3e 00 00    	push   0x3ec0
+    1a23:	e8 98 08 00 00       	call   22c0 <printf>
+    exit();
+    1a28:	e8 e6 06 00 00       	call   2113 <exit>
+    printf(stdout, "checkpoint test: child not ready\n");
+    1a2d:	50                   	push   %eax
+    1a2e:	50                   	push   %eax
+    1a2f:	68 c0 34 00 00       	push   $0x34c0
+    1a34:	ff 35 c0 3e 00 00    	push   0x3ec0
+    1a3a:	e8 81 08 00 00       	call   22c0 <printf>
+    exit();
+    1a3f:	e8 cf 06 00 00       	call   2113 <exit>
+    printf(stdout, "checkpoint test: spawn failed\n");
+    1a44:	50                   	push   %eax
+    1a45:	50                   	push   %eax
+    1a46:	68 a0 34 00 00       	push   $0x34a0
+    1a4b:	ff 35 c0 3e 00 00    	push   0x3ec0
+    1a51:	e8 6a 08 00 00       	call   22c0 <printf>
+    exit();
+    1a56:	e8 b8 06 00 00       	call   2113 <exit>
+    1a5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1a5f:	90                   	nop
+
+00001a60 <swaptest>:
+{
+    1a60:	55                   	push   %ebp
+    1a61:	89 e5                	mov    %esp,%ebp
+    1a63:	57                   	push   %edi
+    1a64:	56                   	push   %esi
+    1a65:	53                   	push   %ebx
+    1a66:	83 ec 44             	sub    $0x44,%esp
+  printf(stdout, "swap test\n");
+    1a69:	68 0c 30 00 00       	push   $0x300c
+    1a6e:	ff 35 c0 3e 00 00    	push   0x3ec0
+    1a74:	e8 47 08 00 00       	call   22c0 <printf>
+  state = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANON, -1, 0);
+    1a79:	58                   	pop    %eax
+    1a7a:	5a                   	pop    %edx
+    1a7b:	6a 00                	push   $0x0
+    1a7d:	6a ff                	push   $0xffffffff
+    1a7f:	6a 21                	push   $0x21
+    1a81:	6a 03                	push   $0x3
+    1a83:	68 00 10 00 00       	push   $0x1000
+    1a88:	6a 00                	push   $0x0
+    1a8a:	e8 2c 07 00 00       	call   21bb <mmap>
+  if(state == MAP_FAILED || pipe(fds) < 0 || memstats(&ms, 0, 0) < 0){
+    1a8f:	83 c4 20             	add    $0x20,%esp
+  state = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANON, -1, 0);
+    1a92:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  if(state == MAP_FAILED || pipe(fds) < 0 || memstats(&ms, 0, 0) < 0){
+    1a95:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1a98:	0f 84 ad 03 00 00    	je     1e4b <swaptest+0x3eb>
+    1a9e:	83 ec 0c             	sub    $0xc,%esp
+    1aa1:	8d 45 d0             	lea    -0x30(%ebp),%eax
+    1aa4:	50                   	push   %eax
+    1aa5:	e8 79 06 00 00       	call   2123 <pipe>
+    1aaa:	83 c4 10             	add    $0x10,%esp
+    1aad:	85 c0                	test   %eax,%eax
+    1aaf:	0f 88 96 03 00 00    	js     1e4b <swaptest+0x3eb>
+    1ab5:	83 ec 04             	sub    $0x4,%esp
+    1ab8:	6a 00                	push   $0x0
+    1aba:	6a 00                	push   $0x0
+    1abc:	68 e0 6e 00 00       	push   $0x6ee0
+    1ac1:	e8 4d 07 00 00       	call   2213 <memstats>
+    1ac6:	83 c4 10             	add    $0x10,%esp
+    1ac9:	85 c0                	test   %eax,%eax
+    1acb:	0f 88 7a 03 00 00    	js     1e4b <swaptest+0x3eb>
+  state[0] = 0;  // children filled
+    1ad1:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  each = ms.free / 2 / NSWAPKID;
+    1ad4:	8b 35 e4 6e 00 00    	mov    0x6ee4,%esi
+  for(i = 0; i < NSWAPKID; i++){
+    1ada:	31 ff                	xor    %edi,%edi
+  state[0] = 0;  // children filled
+    1adc:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  each = ms.free / 2 / NSWAPKID;
+    1ae2:	c1 ee 03             	shr    $0x3,%esi
+  state[1] = 0;  // go and check
+    1ae5:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  state[2] = 0;  // a child's sbrk failed
+    1aec:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+    if((pids[i] = fork()) == 0){
+    1af3:	e8 13 06 00 00       	call   210b <fork>
+    1af8:	89 44 bd d8          	mov    %eax,-0x28(%ebp,%edi,4)
+    1afc:	85 c0                	test   %eax,%eax
+    1afe:	0f 84 44 02 00 00    	je     1d48 <swaptest+0x2e8>
+  for(i = 0; i < NSWAPKID; i++){
+    1b04:	83 c7 01             	add    $0x1,%edi
+    1b07:	83 ff 04             	cmp    $0x4,%edi
+    1b0a:	75 e7                	jne    1af3 <swaptest+0x93>
+  close(fds[1]);
+    1b0c:	83 ec 0c             	sub    $0xc,%esp
+    1b0f:	ff 75 d4             	push   -0x2c(%ebp)
+    1b12:	e8 24 06 00 00       	call   213b <close>
+  while(state[0] < NSWAPKID)
+    1b17:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1b1a:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+    1b1d:	83 c4 10             	add    $0x10,%esp
+    1b20:	8b 00                	mov    (%eax),%eax
+    1b22:	83 f8 03             	cmp    $0x3,%eax
+    1b25:	7f 1d                	jg     1b44 <swaptest+0xe4>
+    1b27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b2e:	66 90                	xchg   %ax,%ax
+    sleep(1);
+    1b30:	83 ec 0c             	sub    $0xc,%esp
+    1b33:	6a 01                	push   $0x1
+    1b35:	e8 69 06 00 00       	call   21a3 <sleep>
+  while(state[0] < NSWAPKID)
+    1b3a:	8b 03                	mov    (%ebx),%eax
+    1b3c:	83 c4 10             	add    $0x10,%esp
+    1b3f:	83 f8 03             	cmp    $0x3,%eax
+    1b42:	7e ec                	jle    1b30 <swaptest+0xd0>
+  n = ms.free - each*NSWAPKID + SWAPOVER;
+    1b44:	a1 e4 6e 00 00       	mov    0x6ee4,%eax
+    1b49:	c1 e6 02             	shl    $0x2,%esi
+    1b4c:	8d 98 00 01 00 00    	lea    0x100(%eax),%ebx
+  if(state[2] || (p = growpages(n)) == 0){
+    1b52:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  n = ms.free - each*NSWAPKID + SWAPOVER;
+    1b55:	29 f3                	sub    %esi,%ebx
+  if(state[2] || (p = growpages(n)) == 0){
+    1b57:	8b 40 08             	mov    0x8(%eax),%eax
+  n = ms.free - each*NSWAPKID + SWAPOVER;
+    1b5a:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+  if(state[2] || (p = growpages(n)) == 0){
+    1b5d:	85 c0                	test   %eax,%eax
+    1b5f:	75 4d                	jne    1bae <swaptest+0x14e>
+  start = sbrk(0);
+    1b61:	83 ec 0c             	sub    $0xc,%esp
+    1b64:	6a 00                	push   $0x0
+    1b66:	e8 30 06 00 00       	call   219b <sbrk>
+  for(; n > 0; n -= step){
+    1b6b:	83 c4 10             	add    $0x10,%esp
+  start = sbrk(0);
+    1b6e:	89 c2                	mov    %eax,%edx
+  for(; n > 0; n -= step){
+    1b70:	8b 45 c0             	mov    -0x40(%ebp),%eax
+    1b73:	85 c0                	test   %eax,%eax
+    1b75:	0f 8e 9e 01 00 00    	jle    1d19 <swaptest+0x2b9>
+  n = ms.free - each*NSWAPKID + SWAPOVER;
+    1b7b:	89 c6                	mov    %eax,%esi
+    1b7d:	89 d7                	mov    %edx,%edi
+    1b7f:	eb 0d                	jmp    1b8e <swaptest+0x12e>
+    1b81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(; n > 0; n -= step){
+    1b88:	29 de                	sub    %ebx,%esi
+    1b8a:	85 f6                	test   %esi,%esi
+    1b8c:	7e 5a                	jle    1be8 <swaptest+0x188>
+    step = n < 256 ? n : 256;
+    1b8e:	b8 00 01 00 00       	mov    $0x100,%eax
+    1b93:	39 c6                	cmp    %eax,%esi
+    1b95:	0f 4e c6             	cmovle %esi,%eax
+    if(sbrk(step*4096) == (char*)-1)
+    1b98:	83 ec 0c             	sub    $0xc,%esp
+    step = n < 256 ? n : 256;
+    1b9b:	89 c3                	mov    %eax,%ebx
+    if(sbrk(step*4096) == (char*)-1)
+    1b9d:	c1 e0 0c             	shl    $0xc,%eax
+    1ba0:	50                   	push   %eax
+    1ba1:	e8 f5 05 00 00       	call   219b <sbrk>
+    1ba6:	83 c4 10             	add    $0x10,%esp
+    1ba9:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1bac:	75 da                	jne    1b88 <swaptest+0x128>
+    printf(stdout, "swap test: sbrk failed\n");
+    1bae:	57                   	push   %edi
+    1baf:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    1bb2:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    1bb5:	57                   	push   %edi
+    1bb6:	68 30 30 00 00       	push   $0x3030
+    1bbb:	ff 35 c0 3e 00 00    	push   0x3ec0
+    1bc1:	e8 fa 06 00 00       	call   22c0 <printf>
+    for(i = 0; i < NSWAPKID; i++)
+    1bc6:	83 c4 10             	add    $0x10,%esp
+      kill(pids[i]);
+    1bc9:	83 ec 0c             	sub    $0xc,%esp
+    1bcc:	ff 33                	push   (%ebx)
+    for(i = 0; i < NSWAPKID; i++)
+    1bce:	83 c3 04             	add    $0x4,%ebx
+      kill(pids[i]);
+    1bd1:	e8 6d 05 00 00       	call   2143 <kill>
+    for(i = 0; i < NSWAPKID; i++)
+    1bd6:	83 c4 10             	add    $0x10,%esp
+    1bd9:	39 f3                	cmp    %esi,%ebx
+    1bdb:	75 ec                	jne    1bc9 <swaptest+0x169>
+    exit();
+    1bdd:	e8 31 05 00 00       	call   2113 <exit>
+    1be2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1be8:	89 fa                	mov    %edi,%edx
+  if(state[2] || (p = growpages(n)) == 0){
+    1bea:	85 ff                	test   %edi,%edi
+    1bec:	74 c0                	je     1bae <swaptest+0x14e>
+    1bee:	8b 45 c0             	mov    -0x40(%ebp),%eax
+    1bf1:	8d b8 00 00 70 00    	lea    0x700000(%eax),%edi
+    1bf7:	b8 00 00 70 00       	mov    $0x700000,%eax
+    1bfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      w[0] = seed + i;
+    1c00:	89 c1                	mov    %eax,%ecx
+      w[1023] = ~(seed + i);
+    1c02:	89 c3                	mov    %eax,%ebx
+    1c04:	c1 e1 0c             	shl    $0xc,%ecx
+    1c07:	f7 d3                	not    %ebx
+      w[0] = seed + i;
+    1c09:	89 04 0a             	mov    %eax,(%edx,%ecx,1)
+  for(i = 0; i < n; i++){
+    1c0c:	83 c0 01             	add    $0x1,%eax
+      w[1023] = ~(seed + i);
+    1c0f:	89 9c 0a fc 0f 00 00 	mov    %ebx,0xffc(%edx,%ecx,1)
+  for(i = 0; i < n; i++){
+    1c16:	39 f8                	cmp    %edi,%eax
+    1c18:	75 e6                	jne    1c00 <swaptest+0x1a0>
+  state[1] = 1;
+    1c1a:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1c1d:	89 55 bc             	mov    %edx,-0x44(%ebp)
+    1c20:	be 04 00 00 00       	mov    $0x4,%esi
+    1c25:	8d 7d cc             	lea    -0x34(%ebp),%edi
+    1c28:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+    if(read(fds[0], &bad, sizeof(bad)) != sizeof(bad) || bad != 0){
+    1c2f:	83 ec 04             	sub    $0x4,%esp
+    1c32:	6a 04                	push   $0x4
+    1c34:	57                   	push   %edi
+    1c35:	ff 75 d0             	push   -0x30(%ebp)
+    1c38:	e8 ee 04 00 00       	call   212b <read>
+    1c3d:	83 c4 10             	add    $0x10,%esp
+    1c40:	83 f8 04             	cmp    $0x4,%eax
+    1c43:	0f 85 e7 00 00 00    	jne    1d30 <swaptest+0x2d0>
+    1c49:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+    1c4c:	85 db                	test   %ebx,%ebx
+    1c4e:	0f 85 dc 00 00 00    	jne    1d30 <swaptest+0x2d0>
+    wait();
+    1c54:	e8 c2 04 00 00       	call   211b <wait>
+  for(i = 0; i < NSWAPKID; i++){
+    1c59:	83 ee 01             	sub    $0x1,%esi
+    1c5c:	75 d1                	jne    1c2f <swaptest+0x1cf>
+  close(fds[0]);
+    1c5e:	83 ec 0c             	sub    $0xc,%esp
+    1c61:	ff 75 d0             	push   -0x30(%ebp)
+    1c64:	e8 d2 04 00 00       	call   213b <close>
+  for(i = 0; i < n; i++){
+    1c69:	8b 45 c0             	mov    -0x40(%ebp),%eax
+    1c6c:	83 c4 10             	add    $0x10,%esp
+    1c6f:	85 c0                	test   %eax,%eax
+    1c71:	0f 8e 99 00 00 00    	jle    1d10 <swaptest+0x2b0>
+    1c77:	8d b0 00 00 70 00    	lea    0x700000(%eax),%esi
+    1c7d:	8b 55 bc             	mov    -0x44(%ebp),%edx
+    1c80:	b8 00 00 70 00       	mov    $0x700000,%eax
+    1c85:	eb 19                	jmp    1ca0 <swaptest+0x240>
+    1c87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c8e:	66 90                	xchg   %ax,%ax
+    1c90:	83 c0 01             	add    $0x1,%eax
+      bad++;
+    1c93:	83 c3 01             	add    $0x1,%ebx
+  for(i = 0; i < n; i++){
+    1c96:	81 c2 00 10 00 00    	add    $0x1000,%edx
+    1c9c:	39 f0                	cmp    %esi,%eax
+    1c9e:	74 20                	je     1cc0 <swaptest+0x260>
+    } else if(w[0] != seed + i || w[1023] != ~(seed + i))
+    1ca0:	39 02                	cmp    %eax,(%edx)
+    1ca2:	75 ec                	jne    1c90 <swaptest+0x230>
+    1ca4:	89 c1                	mov    %eax,%ecx
+    1ca6:	f7 d1                	not    %ecx
+    1ca8:	39 8a fc 0f 00 00    	cmp    %ecx,0xffc(%edx)
+    1cae:	75 e0                	jne    1c90 <swaptest+0x230>
+  for(i = 0; i < n; i++){
+    1cb0:	83 c0 01             	add    $0x1,%eax
+    1cb3:	81 c2 00 10 00 00    	add    $0x1000,%edx
+    1cb9:	39 f0                	cmp    %esi,%eax
+    1cbb:	75 e3                	jne    1ca0 <swaptest+0x240>
+    1cbd:	8d 76 00             	lea    0x0(%esi),%esi
+  if((bad = pattern(p, n, 7 << 20, 1)) != 0){
+    1cc0:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+    1cc3:	85 db                	test   %ebx,%ebx
+    1cc5:	0f 85 98 01 00 00    	jne    1e63 <swaptest+0x403>
+  sbrk(-n*4096);
+    1ccb:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+    1cce:	83 ec 0c             	sub    $0xc,%esp
+    1cd1:	f7 db                	neg    %ebx
+    1cd3:	c1 e3 0c             	shl    $0xc,%ebx
+    1cd6:	53                   	push   %ebx
+    1cd7:	e8 bf 04 00 00       	call   219b <sbrk>
+  munmap((void*)state, 4096);
+    1cdc:	58                   	pop    %eax
+    1cdd:	5a                   	pop    %edx
+    1cde:	68 00 10 00 00       	push   $0x1000
+    1ce3:	ff 75 c4             	push   -0x3c(%ebp)
+    1ce6:	e8 d8 04 00 00       	call   21c3 <munmap>
+  printf(stdout, "swap test ok\n");
+    1ceb:	59                   	pop    %ecx
+    1cec:	5b                   	pop    %ebx
+    1ced:	68 7f 30 00 00       	push   $0x307f
+    1cf2:	ff 35 c0 3e 00 00    	push   0x3ec0
+    1cf8:	e8 c3 05 00 00       	call   22c0 <printf>
+}
+    1cfd:	83 c4 10             	add    $0x10,%esp
+    1d00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1d03:	5b                   	pop    %ebx
+    1d04:	5e                   	pop    %esi
+    1d05:	5f                   	pop    %edi
+    1d06:	5d                   	pop    %ebp
+    1d07:	c3                   	ret
+    1d08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d0f:	90                   	nop
+  if((bad = pattern(p, n, 7 << 20, 1)) != 0){
+    1d10:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+    1d17:	eb b2                	jmp    1ccb <swaptest+0x26b>
+  if(state[2] || (p = growpages(n)) == 0){
+    1d19:	85 d2                	test   %edx,%edx
+    1d1b:	0f 85 f9 fe ff ff    	jne    1c1a <swaptest+0x1ba>
+    1d21:	e9 88 fe ff ff       	jmp    1bae <swaptest+0x14e>
+    1d26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d2d:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(stdout, "swap test: child lost pages\n");
+    1d30:	83 ec 08             	sub    $0x8,%esp
+    1d33:	68 48 30 00 00       	push   $0x3048
+    1d38:	ff 35 c0 3e 00 00    	push   0x3ec0
+    1d3e:	e8 7d 05 00 00       	call   22c0 <printf>
+      exit();
+    1d43:	e8 cb 03 00 00       	call   2113 <exit>
+      close(fds[0]);
+    1d48:	83 ec 0c             	sub    $0xc,%esp
+    1d4b:	ff 75 d0             	push   -0x30(%ebp)
+    1d4e:	89 c3                	mov    %eax,%ebx
+    1d50:	e8 e6 03 00 00       	call   213b <close>
+  start = sbrk(0);
+    1d55:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    1d5c:	e8 3a 04 00 00       	call   219b <sbrk>
+  for(; n > 0; n -= step){
+    1d61:	83 c4 10             	add    $0x10,%esp
+  start = sbrk(0);
+    1d64:	89 c2                	mov    %eax,%edx
+  for(; n > 0; n -= step){
+    1d66:	85 f6                	test   %esi,%esi
+    1d68:	0f 84 0c 01 00 00    	je     1e7a <swaptest+0x41a>
+  each = ms.free / 2 / NSWAPKID;
+    1d6e:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+    1d71:	89 f3                	mov    %esi,%ebx
+    1d73:	89 45 bc             	mov    %eax,-0x44(%ebp)
+    1d76:	eb 0d                	jmp    1d85 <swaptest+0x325>
+  for(; n > 0; n -= step){
+    1d78:	8b 55 b8             	mov    -0x48(%ebp),%edx
+    1d7b:	29 d3                	sub    %edx,%ebx
+    1d7d:	85 db                	test   %ebx,%ebx
+    1d7f:	0f 8e 8b 00 00 00    	jle    1e10 <swaptest+0x3b0>
+    step = n < 256 ? n : 256;
+    1d85:	b8 00 01 00 00       	mov    $0x100,%eax
+    1d8a:	39 c3                	cmp    %eax,%ebx
+    1d8c:	0f 4e c3             	cmovle %ebx,%eax
+    if(sbrk(step*4096) == (char*)-1)
+    1d8f:	83 ec 0c             	sub    $0xc,%esp
+    1d92:	89 45 b8             	mov    %eax,-0x48(%ebp)
+    1d95:	c1 e0 0c             	shl    $0xc,%eax
+    1d98:	50                   	push   %eax
+    1d99:	e8 fd 03 00 00       	call   219b <sbrk>
+    1d9e:	83 c4 10             	add    $0x10,%esp
+    1da1:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1da4:	75 d2                	jne    1d78 <swaptest+0x318>
+    1da6:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+        state[2] = 1;
+    1da9:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1dac:	31 d2                	xor    %edx,%edx
+    1dae:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+      __sync_fetch_and_add(&state[0], 1);
+    1db5:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1db8:	f0 83 00 01          	lock addl $0x1,(%eax)
+      while(state[1] == 0)
+    1dbc:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1dbf:	8b 40 04             	mov    0x4(%eax),%eax
+    1dc2:	85 c0                	test   %eax,%eax
+    1dc4:	74 f6                	je     1dbc <swaptest+0x35c>
+      bad = pattern(p, each, i << 20, 1);
+    1dc6:	89 f8                	mov    %edi,%eax
+    1dc8:	c1 e0 14             	shl    $0x14,%eax
+  for(i = 0; i < n; i++){
+    1dcb:	85 f6                	test   %esi,%esi
+    1dcd:	74 26                	je     1df5 <swaptest+0x395>
+    1dcf:	01 c6                	add    %eax,%esi
+    1dd1:	eb 10                	jmp    1de3 <swaptest+0x383>
+      bad++;
+    1dd3:	83 c3 01             	add    $0x1,%ebx
+  for(i = 0; i < n; i++){
+    1dd6:	83 c0 01             	add    $0x1,%eax
+    1dd9:	81 c2 00 10 00 00    	add    $0x1000,%edx
+    1ddf:	39 c6                	cmp    %eax,%esi
+    1de1:	74 14                	je     1df7 <swaptest+0x397>
+    } else if(w[0] != seed + i || w[1023] != ~(seed + i))
+    1de3:	3b 02                	cmp    (%edx),%eax
+    1de5:	75 ec                	jne    1dd3 <swaptest+0x373>
+    1de7:	89 c1                	mov    %eax,%ecx
+    1de9:	f7 d1                	not    %ecx
+    1deb:	3b 8a fc 0f 00 00    	cmp    0xffc(%edx),%ecx
+    1df1:	75 e0                	jne    1dd3 <swaptest+0x373>
+    1df3:	eb e1                	jmp    1dd6 <swaptest+0x376>
+  bad = 0;
+    1df5:	31 db                	xor    %ebx,%ebx
+      write(fds[1], &bad, sizeof(bad));
+    1df7:	83 ec 04             	sub    $0x4,%esp
+    1dfa:	8d 45 cc             	lea    -0x34(%ebp),%eax
+      bad = pattern(p, each, i << 20, 1);
+    1dfd:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+      write(fds[1], &bad, sizeof(bad));
+    1e00:	6a 04                	push   $0x4
+    1e02:	50                   	push   %eax
+    1e03:	ff 75 d4             	push   -0x2c(%ebp)
+    1e06:	e8 28 03 00 00       	call   2133 <write>
+      exit();
+    1e0b:	e8 03 03 00 00       	call   2113 <exit>
+    1e10:	8b 55 bc             	mov    -0x44(%ebp),%edx
+    1e13:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+      if((p = growpages(each)) == 0)
+    1e16:	85 d2                	test   %edx,%edx
+    1e18:	74 8f                	je     1da9 <swaptest+0x349>
+      bad = pattern(p, each, i << 20, 1);
+    1e1a:	89 f8                	mov    %edi,%eax
+    1e1c:	89 55 bc             	mov    %edx,-0x44(%ebp)
+    1e1f:	c1 e0 14             	shl    $0x14,%eax
+    1e22:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+    1e25:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+    1e28:	89 d1                	mov    %edx,%ecx
+      w[1023] = ~(seed + i);
+    1e2a:	89 c2                	mov    %eax,%edx
+      w[0] = seed + i;
+    1e2c:	89 01                	mov    %eax,(%ecx)
+  for(i = 0; i < n; i++){
+    1e2e:	83 c0 01             	add    $0x1,%eax
+    1e31:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+      w[1023] = ~(seed + i);
+    1e37:	f7 d2                	not    %edx
+    1e39:	89 51 fc             	mov    %edx,-0x4(%ecx)
+  for(i = 0; i < n; i++){
+    1e3c:	8b 55 c0             	mov    -0x40(%ebp),%edx
+    1e3f:	39 d0                	cmp    %edx,%eax
+    1e41:	75 e7                	jne    1e2a <swaptest+0x3ca>
+    1e43:	8b 55 bc             	mov    -0x44(%ebp),%edx
+    1e46:	e9 6a ff ff ff       	jmp    1db5 <swaptest+0x355>
+    printf(stdout, "swap test: setup failed\n");
+    1e4b:	83 ec 08             	sub    $0x8,%esp
+    1e4e:	68 17 30 00 00       	push   $0x3017
+    1e53:	ff 35 c0 3e 00 00    	push   0x3ec0
+    1e59:	e8 62 04 00 00       	call   22c0 <printf>
+    exit();
+    1e5e:	e8 b0 02 00 00       	call   2113 <exit>
+    printf(stdout, "swap test: lost %d pages\n", bad);
+    1e63:	56                   	push   %esi
+    1e64:	53                   	push   %ebx
+    1e65:	68 65 30 00 00       	push   $0x3065
+    1e6a:	ff 35 c0 3e 00 00    	push   0x3ec0
+    1e70:	e8 4b 04 00 00       	call   22c0 <printf>
+    exit();
+    1e75:	e8 99 02 00 00       	call   2113 <exit>
+      if((p = growpages(each)) == 0)
+    1e7a:	85 c0                	test   %eax,%eax
+    1e7c:	0f 85 33 ff ff ff    	jne    1db5 <swaptest+0x355>
+    1e82:	e9 22 ff ff ff       	jmp    1da9 <swaptest+0x349>
+    1e87:	66 90                	xchg   %ax,%ax
+    1e89:	66 90                	xchg   %ax,%ax
+    1e8b:	66 90                	xchg   %ax,%ax
+    1e8d:	66 90                	xchg   %ax,%ax
+    1e8f:	90                   	nop
+
+00001e90 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    1e90:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1e91:	31 c0                	xor    %eax,%eax
+{
+    1e93:	89 e5                	mov    %esp,%ebp
+    1e95:	53                   	push   %ebx
+    1e96:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1e99:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    1e9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1ea0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1ea4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1ea7:	83 c0 01             	add    $0x1,%eax
+    1eaa:	84 d2                	test   %dl,%dl
+    1eac:	75 f2                	jne    1ea0 <strcpy+0x10>
+    ;
+  return os;
+}
+    1eae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1eb1:	89 c8                	mov    %ecx,%eax
+    1eb3:	c9                   	leave
+    1eb4:	c3                   	ret
+    1eb5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ebc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001ec0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1ec0:	55                   	push   %ebp
+    1ec1:	89 e5                	mov    %esp,%ebp
+    1ec3:	53                   	push   %ebx
+    1ec4:	8b 55 08             	mov    0x8(%ebp),%edx
+    1ec7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    1eca:	0f b6 02             	movzbl (%edx),%eax
+    1ecd:	84 c0                	test   %al,%al
+    1ecf:	75 17                	jne    1ee8 <strcmp+0x28>
+    1ed1:	eb 3a                	jmp    1f0d <strcmp+0x4d>
+    1ed3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1ed7:	90                   	nop
+    1ed8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    1edc:	83 c2 01             	add    $0x1,%edx
+    1edf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1ee2:	84 c0                	test   %al,%al
+    1ee4:	74 1a                	je     1f00 <strcmp+0x40>
+    p++, q++;
+    1ee6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1ee8:	0f b6 19             	movzbl (%ecx),%ebx
+    1eeb:	38 c3                	cmp    %al,%bl
+    1eed:	74 e9                	je     1ed8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    1eef:	29 d8                	sub    %ebx,%eax
+}
+    1ef1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1ef4:	c9                   	leave
+    1ef5:	c3                   	ret
+    1ef6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1efd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1f00:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1f04:	31 c0                	xor    %eax,%eax
+    1f06:	29 d8                	sub    %ebx,%eax
+}
+    1f08:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1f0b:	c9                   	leave
+    1f0c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    1f0d:	0f b6 19             	movzbl (%ecx),%ebx
+    1f10:	31 c0                	xor    %eax,%eax
+    1f12:	eb db                	jmp    1eef <strcmp+0x2f>
+    1f14:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1f1f:	90                   	nop
+
+00001f20 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1f20:	55                   	push   %ebp
+    1f21:	89 e5                	mov    %esp,%ebp
+    1f23:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1f26:	80 3a 00             	cmpb   $0x0,(%edx)
+    1f29:	74 15                	je     1f40 <strlen+0x20>
+    1f2b:	31 c0                	xor    %eax,%eax
+    1f2d:	8d 76 00             	lea    0x0(%esi),%esi
+    1f30:	83 c0 01             	add    $0x1,%eax
+    1f33:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1f37:	89 c1                	mov    %eax,%ecx
+    1f39:	75 f5                	jne    1f30 <strlen+0x10>
+    ;
+  return n;
+}
+    1f3b:	89 c8                	mov    %ecx,%eax
+    1f3d:	5d                   	pop    %ebp
+    1f3e:	c3                   	ret
+    1f3f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1f40:	31 c9                	xor    %ecx,%ecx
+}
+    1f42:	5d                   	pop    %ebp
+    1f43:	89 c8                	mov    %ecx,%eax
+    1f45:	c3                   	ret
+    1f46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001f50 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1f50:	55                   	push   %ebp
+    1f51:	89 e5                	mov    %esp,%ebp
+    1f53:	57                   	push   %edi
+    1f54:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1f57:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    1f5a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1f5d:	89 d7                	mov    %edx,%edi
+    1f5f:	fc                   	cld
+    1f60:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1f62:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1f65:	89 d0                	mov    %edx,%eax
+    1f67:	c9                   	leave
+    1f68:	c3                   	ret
+    1f69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001f70 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1f70:	55                   	push   %ebp
+    1f71:	89 e5                	mov    %esp,%ebp
+    1f73:	8b 45 08             	mov    0x8(%ebp),%eax
+    1f76:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    1f7a:	0f b6 10             	movzbl (%eax),%edx
+    1f7d:	84 d2                	test   %dl,%dl
+    1f7f:	75 12                	jne    1f93 <strchr+0x23>
+    1f81:	eb 1d                	jmp    1fa0 <strchr+0x30>
+    1f83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1f87:	90                   	nop
+    1f88:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    1f8c:	83 c0 01             	add    $0x1,%eax
+    1f8f:	84 d2                	test   %dl,%dl
+    1f91:	74 0d                	je     1fa0 <strchr+0x30>
+    if(*s == c)
+    1f93:	38 d1                	cmp    %dl,%cl
+    1f95:	75 f1                	jne    1f88 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1f97:	5d                   	pop    %ebp
+    1f98:	c3                   	ret
+    1f99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1fa0:	31 c0                	xor    %eax,%eax
+}
+    1fa2:	5d                   	pop    %ebp
+    1fa3:	c3                   	ret
+    1fa4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1fab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1faf:	90                   	nop
+
+00001fb0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1fb0:	55                   	push   %ebp
+    1fb1:	89 e5                	mov    %esp,%ebp
+    1fb3:	57                   	push   %edi
+    1fb4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1fb5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1fb8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1fb9:	31 db                	xor    %ebx,%ebx
+{
+    1fbb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    1fbe:	eb 27                	jmp    1fe7 <gets+0x37>
+    cc = read(0, &c, 1);
+    1fc0:	83 ec 04             	sub    $0x4,%esp
+    1fc3:	6a 01                	push   $0x1
+    1fc5:	56                   	push   %esi
+    1fc6:	6a 00                	push   $0x0
+    1fc8:	e8 5e 01 00 00       	call   212b <read>
+    if(cc < 1)
+    1fcd:	83 c4 10             	add    $0x10,%esp
+    1fd0:	85 c0                	test   %eax,%eax
+    1fd2:	7e 1d                	jle    1ff1 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1fd4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1fd8:	8b 55 08             	mov    0x8(%ebp),%edx
+    1fdb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    1fdf:	3c 0a                	cmp    $0xa,%al
+    1fe1:	74 10                	je     1ff3 <gets+0x43>
+    1fe3:	3c 0d                	cmp    $0xd,%al
+    1fe5:	74 0c                	je     1ff3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1fe7:	89 df                	mov    %ebx,%edi
+    1fe9:	83 c3 01             	add    $0x1,%ebx
+    1fec:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    1fef:	7c cf                	jl     1fc0 <gets+0x10>
+    1ff1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1ff3:	8b 45 08             	mov    0x8(%ebp),%eax
+    1ff6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    1ffa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ffd:	5b                   	pop    %ebx
+    1ffe:	5e                   	pop    %esi
+    1fff:	5f                   	pop    %edi
+    2000:	5d                   	pop    %ebp
+    2001:	c3                   	ret
+    2002:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2009:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002010 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    2010:	55                   	push   %ebp
+    2011:	89 e5                	mov    %esp,%ebp
+    2013:	56                   	push   %esi
+    2014:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    2015:	83 ec 08             	sub    $0x8,%esp
+    2018:	6a 00                	push   $0x0
+    201a:	ff 75 08             	push   0x8(%ebp)
+    201d:	e8 31 01 00 00       	call   2153 <open>
+  if(fd < 0)
+    2022:	83 c4 10             	add    $0x10,%esp
+    2025:	85 c0                	test   %eax,%eax
+    2027:	78 27                	js     2050 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    2029:	83 ec 08             	sub    $0x8,%esp
+    202c:	ff 75 0c             	push   0xc(%ebp)
+    202f:	89 c3                	mov    %eax,%ebx
+    2031:	50                   	push   %eax
+    2032:	e8 34 01 00 00       	call   216b <fstat>
+  close(fd);
+    2037:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    203a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    203c:	e8 fa 00 00 00       	call   213b <close>
+  return r;
+    2041:	83 c4 10             	add    $0x10,%esp
+}
+    2044:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2047:	89 f0                	mov    %esi,%eax
+    2049:	5b                   	pop    %ebx
+    204a:	5e                   	pop    %esi
+    204b:	5d                   	pop    %ebp
+    204c:	c3                   	ret
+    204d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    2050:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    2055:	eb ed                	jmp    2044 <stat+0x34>
+    2057:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    205e:	66 90                	xchg   %ax,%ax
+
+00002060 <atoi>:
+
+int
+atoi(const char *s)
+{
+    2060:	55                   	push   %ebp
+    2061:	89 e5                	mov    %esp,%ebp
+    2063:	53                   	push   %ebx
+    2064:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    2067:	0f be 02             	movsbl (%edx),%eax
+    206a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    206d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    2070:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    2075:	77 1e                	ja     2095 <atoi+0x35>
+    2077:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    207e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    2080:	83 c2 01             	add    $0x1,%edx
+    2083:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    2086:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    208a:	0f be 02             	movsbl (%edx),%eax
+    208d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    2090:	80 fb 09             	cmp    $0x9,%bl
+    2093:	76 eb                	jbe    2080 <atoi+0x20>
+  return n;
+}
+    2095:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2098:	89 c8                	mov    %ecx,%eax
+    209a:	c9                   	leave
+    209b:	c3                   	ret
+    209c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000020a0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    20a0:	55                   	push   %ebp
+    20a1:	89 e5                	mov    %esp,%ebp
+    20a3:	57                   	push   %edi
+    20a4:	56                   	push   %esi
+    20a5:	8b 45 10             	mov    0x10(%ebp),%eax
+    20a8:	8b 55 08             	mov    0x8(%ebp),%edx
+    20ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    20ae:	85 c0                	test   %eax,%eax
+    20b0:	7e 13                	jle    20c5 <memmove+0x25>
+    20b2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    20b4:	89 d7                	mov    %edx,%edi
+    20b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20bd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    20c0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    20c1:	39 f8                	cmp    %edi,%eax
+    20c3:	75 fb                	jne    20c0 <memmove+0x20>
+  return vdst;
+}
+    20c5:	5e                   	pop    %esi
+    20c6:	89 d0                	mov    %edx,%eax
+    20c8:	5f                   	pop    %edi
+    20c9:	5d                   	pop    %ebp
+    20ca:	c3                   	ret
+
+000020cb <ccreate>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(ccreate)
+    20cb:	b8 17 00 00 00       	mov    $0x17,%eax
+    20d0:	cd 40                	int    $0x40
+    20d2:	c3                   	ret
+
+000020d3 <cfork>:
+SYSCALL(cfork)
+    20d3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    20d8:	cd 40                	int    $0x40
+    20da:	c3                   	ret
+
+000020db <cgetrootdir>:
+SYSCALL(cgetrootdir)
+    20db:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    20e0:	cd 40                	int    $0x40
+    20e2:	c3                   	ret
+
+000020e3 <getcontrootdir>:
+SYSCALL(getcontrootdir)
+    20e3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    20e8:	cd 40                	int    $0x40
+    20ea:	c3                   	ret
+
+000020eb <cpause>:
+SYSCALL(cpause)
+    20eb:	b8 19 00 00 00       	mov    $0x19,%eax
+    20f0:	cd 40                	int    $0x40
+    20f2:	c3                   	ret
+
+000020f3 <cresume>:
+SYSCALL(cresume)
+    20f3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    20f8:	cd 40                	int    $0x40
+    20fa:	c3                   	ret
+
+000020fb <cstart>:
+SYSCALL(cstart)
+    20fb:	b8 18 00 00 00       	mov    $0x18,%eax
+    2100:	cd 40                	int    $0x40
+    2102:	c3                   	ret
+
+00002103 <cstop>:
+SYSCALL(cstop)
+    2103:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    2108:	cd 40                	int    $0x40
+    210a:	c3                   	ret
+
+0000210b <fork>:
+SYSCALL(fork)
+    210b:	b8 01 00 00 00       	mov    $0x1,%eax
+    2110:	cd 40                	int    $0x40
+    2112:	c3                   	ret
+
+00002113 <exit>:
+SYSCALL(exit)
+    2113:	b8 02 00 00 00       	mov    $0x2,%eax
+    2118:	cd 40                	int    $0x40
+    211a:	c3                   	ret
+
+0000211b <wait>:
+SYSCALL(wait)
+    211b:	b8 03 00 00 00       	mov    $0x3,%eax
+    2120:	cd 40                	int    $0x40
+    2122:	c3                   	ret
+
+00002123 <pipe>:
+SYSCALL(pipe)
+    2123:	b8 04 00 00 00       	mov    $0x4,%eax
+    2128:	cd 40                	int    $0x40
+    212a:	c3                   	ret
+
+0000212b <read>:
+SYSCALL(read)
+    212b:	b8 05 00 00 00       	mov    $0x5,%eax
+    2130:	cd 40                	int    $0x40
+    2132:	c3                   	ret
+
+00002133 <write>:
+SYSCALL(write)
+    2133:	b8 10 00 00 00       	mov    $0x10,%eax
+    2138:	cd 40                	int    $0x40
+    213a:	c3                   	ret
+
+0000213b <close>:
+SYSCALL(close)
+    213b:	b8 15 00 00 00       	mov    $0x15,%eax
+    2140:	cd 40                	int    $0x40
+    2142:	c3                   	ret
+
+00002143 <kill>:
+SYSCALL(kill)
+    2143:	b8 06 00 00 00       	mov    $0x6,%eax
+    2148:	cd 40                	int    $0x40
+    214a:	c3                   	ret
+
+0000214b <exec>:
+SYSCALL(exec)
+    214b:	b8 07 00 00 00       	mov    $0x7,%eax
+    2150:	cd 40                	int    $0x40
+    2152:	c3                   	ret
+
+00002153 <open>:
+SYSCALL(open)
+    2153:	b8 0f 00 00 00       	mov    $0xf,%eax
+    2158:	cd 40                	int    $0x40
+    215a:	c3                   	ret
+
+0000215b <mknod>:
+SYSCALL(mknod)
+    215b:	b8 11 00 00 00       	mov    $0x11,%eax
+    2160:	cd 40                	int    $0x40
+    2162:	c3                   	ret
+
+00002163 <unlink>:
+SYSCALL(unlink)
+    2163:	b8 12 00 00 00       	mov    $0x12,%eax
+    2168:	cd 40                	int    $0x40
+    216a:	c3                   	ret
+
+0000216b <fstat>:
+SYSCALL(fstat)
+    216b:	b8 08 00 00 00       	mov    $0x8,%eax
+    2170:	cd 40                	int    $0x40
+    2172:	c3                   	ret
+
+00002173 <link>:
+SYSCALL(link)
+    2173:	b8 13 00 00 00       	mov    $0x13,%eax
+    2178:	cd 40                	int    $0x40
+    217a:	c3                   	ret
+
+0000217b <mkdir>:
+SYSCALL(mkdir)
+    217b:	b8 14 00 00 00       	mov    $0x14,%eax
+    2180:	cd 40                	int    $0x40
+    2182:	c3                   	ret
+
+00002183 <chdir>:
+SYSCALL(chdir)
+    2183:	b8 09 00 00 00       	mov    $0x9,%eax
+    2188:	cd 40                	int    $0x40
+    218a:	c3                   	ret
+
+0000218b <dup>:
+SYSCALL(dup)
+    218b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    2190:	cd 40                	int    $0x40
+    2192:	c3                   	ret
+
+00002193 <getpid>:
+SYSCALL(getpid)
+    2193:	b8 0b 00 00 00       	mov    $0xb,%eax
+    2198:	cd 40                	int    $0x40
+    219a:	c3                   	ret
+
+0000219b <sbrk>:
+SYSCALL(sbrk)
+    219b:	b8 0c 00 00 00       	mov    $0xc,%eax
+    21a0:	cd 40                	int    $0x40
+    21a2:	c3                   	ret
+
+000021a3 <sleep>:
+SYSCALL(sleep)
+    21a3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    21a8:	cd 40                	int    $0x40
+    21aa:	c3                   	ret
+
+000021ab <uptime>:
+SYSCALL(uptime)
+    21ab:	b8 0e 00 00 00       	mov    $0xe,%eax
+    21b0:	cd 40                	int    $0x40
+    21b2:	c3                   	ret
+
+000021b3 <cps>:
+SYSCALL(cps)
+    21b3:	b8 16 00 00 00       	mov    $0x16,%eax
+    21b8:	cd 40                	int    $0x40
+    21ba:	c3                   	ret
+
+000021bb <mmap>:
+SYSCALL(mmap)
+    21bb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    21c0:	cd 40                	int    $0x40
+    21c2:	c3                   	ret
+
+000021c3 <munmap>:
+SYSCALL(munmap)
+    21c3:	b8 20 00 00 00       	mov    $0x20,%eax
+    21c8:	cd 40                	int    $0x40
+    21ca:	c3                   	ret
+
+000021cb <shmget>:
+SYSCALL(shmget)
+    21cb:	b8 21 00 00 00       	mov    $0x21,%eax
+    21d0:	cd 40                	int    $0x40
+    21d2:	c3                   	ret
+
+000021d3 <climit>:
+SYSCALL(climit)
+    21d3:	b8 22 00 00 00       	mov    $0x22,%eax
+    21d8:	cd 40                	int    $0x40
+    21da:	c3                   	ret
+
+000021db <spawn>:
+SYSCALL(spawn)
+    21db:	b8 23 00 00 00       	mov    $0x23,%eax
+    21e0:	cd 40                	int    $0x40
+    21e2:	c3                   	ret
+
+000021e3 <clone>:
+SYSCALL(clone)
+    21e3:	b8 24 00 00 00       	mov    $0x24,%eax
+    21e8:	cd 40                	int    $0x40
+    21ea:	c3                   	ret
+
+000021eb <join>:
+SYSCALL(join)
+    21eb:	b8 25 00 00 00       	mov    $0x25,%eax
+    21f0:	cd 40                	int    $0x40
+    21f2:	c3                   	ret
+
+000021f3 <futex>:
+SYSCALL(futex)
+    21f3:	b8 26 00 00 00       	mov    $0x26,%eax
+    21f8:	cd 40                	int    $0x40
+    21fa:	c3                   	ret
+
+000021fb <ccheckpoint>:
+SYSCALL(ccheckpoint)
+    21fb:	b8 27 00 00 00       	mov    $0x27,%eax
+    2200:	cd 40                	int    $0x40
+    2202:	c3                   	ret
+
+00002203 <crestore>:
+SYSCALL(crestore)
+    2203:	b8 28 00 00 00       	mov    $0x28,%eax
+    2208:	cd 40                	int    $0x40
+    220a:	c3                   	ret
+
+0000220b <czygote>:
+SYSCALL(czygote)
+    220b:	b8 29 00 00 00       	mov    $0x29,%eax
+    2210:	cd 40                	int    $0x40
+    2212:	c3                   	ret
+
+00002213 <memstats>:
+SYSCALL(memstats)
+    2213:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    2218:	cd 40                	int    $0x40
+    221a:	c3                   	ret
+    221b:	66 90                	xchg   %ax,%ax
+    221d:	66 90                	xchg   %ax,%ax
+    221f:	90                   	nop
+
+00002220 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    2220:	55                   	push   %ebp
+    2221:	89 e5                	mov    %esp,%ebp
+    2223:	57                   	push   %edi
+    2224:	56                   	push   %esi
+    2225:	53                   	push   %ebx
+    2226:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    2228:	89 d1                	mov    %edx,%ecx
+{
+    222a:	83 ec 3c             	sub    $0x3c,%esp
+    222d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    2230:	85 d2                	test   %edx,%edx
+    2232:	0f 89 80 00 00 00    	jns    22b8 <printint+0x98>
+    2238:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    223c:	74 7a                	je     22b8 <printint+0x98>
+    x = -xx;
+    223e:	f7 d9                	neg    %ecx
+    neg = 1;
+    2240:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    2245:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    2248:	31 f6                	xor    %esi,%esi
+    224a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    2250:	89 c8                	mov    %ecx,%eax
+    2252:	31 d2                	xor    %edx,%edx
+    2254:	89 f7                	mov    %esi,%edi
+    2256:	f7 f3                	div    %ebx
+    2258:	8d 76 01             	lea    0x1(%esi),%esi
+    225b:	0f b6 92 5c 36 00 00 	movzbl 0x365c(%edx),%edx
+    2262:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    2266:	89 ca                	mov    %ecx,%edx
+    2268:	89 c1                	mov    %eax,%ecx
+    226a:	39 da                	cmp    %ebx,%edx
+    226c:	73 e2                	jae    2250 <printint+0x30>
+  if(neg)
+    226e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    2271:	85 c0                	test   %eax,%eax
+    2273:	74 07                	je     227c <printint+0x5c>
+    buf[i++] = '-';
+    2275:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    227a:	89 f7                	mov    %esi,%edi
+    227c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    227f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    2282:	01 df                	add    %ebx,%edi
+    2284:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    2288:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    228b:	83 ec 04             	sub    $0x4,%esp
+    228e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    2291:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    2294:	6a 01                	push   $0x1
+    2296:	50                   	push   %eax
+    2297:	56                   	push   %esi
+    2298:	e8 96 fe ff ff       	call   2133 <write>
+  while(--i >= 0)
+    229d:	89 f8                	mov    %edi,%eax
+    229f:	83 c4 10             	add    $0x10,%esp
+    22a2:	83 ef 01             	sub    $0x1,%edi
+    22a5:	39 d8                	cmp    %ebx,%eax
+    22a7:	75 df                	jne    2288 <printint+0x68>
+}
+    22a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    22ac:	5b                   	pop    %ebx
+    22ad:	5e                   	pop    %esi
+    22ae:	5f                   	pop    %edi
+    22af:	5d                   	pop    %ebp
+    22b0:	c3                   	ret
+    22b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    22b8:	31 c0                	xor    %eax,%eax
+    22ba:	eb 89                	jmp    2245 <printint+0x25>
+    22bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000022c0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    22c0:	55                   	push   %ebp
+    22c1:	89 e5                	mov    %esp,%ebp
+    22c3:	57                   	push   %edi
+    22c4:	56                   	push   %esi
+    22c5:	53                   	push   %ebx
+    22c6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    22c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    22cc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    22cf:	0f b6 1e             	movzbl (%esi),%ebx
+    22d2:	83 c6 01             	add    $0x1,%esi
+    22d5:	84 db                	test   %bl,%bl
+    22d7:	74 67                	je     2340 <printf+0x80>
+    22d9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    22dc:	31 d2                	xor    %edx,%edx
+    22de:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    22e1:	eb 34                	jmp    2317 <printf+0x57>
+    22e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    22e7:	90                   	nop
+    22e8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    22eb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    22f0:	83 f8 25             	cmp    $0x25,%eax
+    22f3:	74 18                	je     230d <printf+0x4d>
+  write(fd, &c, 1);
+    22f5:	83 ec 04             	sub    $0x4,%esp
+    22f8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    22fb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    22fe:	6a 01                	push   $0x1
+    2300:	50                   	push   %eax
+    2301:	57                   	push   %edi
+    2302:	e8 2c fe ff ff       	call   2133 <write>
+    2307:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    230a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    230d:	0f b6 1e             	movzbl (%esi),%ebx
+    2310:	83 c6 01             	add    $0x1,%esi
+    2313:	84 db                	test   %bl,%bl
+    2315:	74 29                	je     2340 <printf+0x80>
+    c = fmt[i] & 0xff;
+    2317:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    231a:	85 d2                	test   %edx,%edx
+    231c:	74 ca                	je     22e8 <printf+0x28>
+      }
+    } else if(state == '%'){
+    231e:	83 fa 25             	cmp    $0x25,%edx
+    2321:	75 ea                	jne    230d <printf+0x4d>
+      if(c == 'd'){
+    2323:	83 f8 25             	cmp    $0x25,%eax
+    2326:	0f 84 24 01 00 00    	je     2450 <printf+0x190>
+    232c:	83 e8 63             	sub    $0x63,%eax
+    232f:	83 f8 15             	cmp    $0x15,%eax
+    2332:	77 1c                	ja     2350 <printf+0x90>
+    2334:	ff 24 85 04 36 00 00 	jmp    *0x3604(,%eax,4)
+    233b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    233f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    2340:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2343:	5b                   	pop    %ebx
+    2344:	5e                   	pop    %esi
+    2345:	5f                   	pop    %edi
+    2346:	5d                   	pop    %ebp
+    2347:	c3                   	ret
+    2348:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    234f:	90                   	nop
+  write(fd, &c, 1);
+    2350:	83 ec 04             	sub    $0x4,%esp
+    2353:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    2356:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    235a:	6a 01                	push   $0x1
+    235c:	52                   	push   %edx
+    235d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    2360:	57                   	push   %edi
+    2361:	e8 cd fd ff ff       	call   2133 <write>
+    2366:	83 c4 0c             	add    $0xc,%esp
+    2369:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    236c:	6a 01                	push   $0x1
+    236e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    2371:	52                   	push   %edx
+    2372:	57                   	push   %edi
+    2373:	e8 bb fd ff ff       	call   2133 <write>
+        putc(fd, c);
+    2378:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    237b:	31 d2                	xor    %edx,%edx
+    237d:	eb 8e                	jmp    230d <printf+0x4d>
+    237f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    2380:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    2383:	83 ec 0c             	sub    $0xc,%esp
+    2386:	b9 10 00 00 00       	mov    $0x10,%ecx
+    238b:	8b 13                	mov    (%ebx),%edx
+    238d:	6a 00                	push   $0x0
+    238f:	89 f8                	mov    %edi,%eax
+        ap++;
+    2391:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    2394:	e8 87 fe ff ff       	call   2220 <printint>
+        ap++;
+    2399:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    239c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    239f:	31 d2                	xor    %edx,%edx
+    23a1:	e9 67 ff ff ff       	jmp    230d <printf+0x4d>
+    23a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    23ad:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    23b0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    23b3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    23b5:	83 c0 04             	add    $0x4,%eax
+    23b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    23bb:	85 db                	test   %ebx,%ebx
+    23bd:	0f 84 9d 00 00 00    	je     2460 <printf+0x1a0>
+        while(*s != 0){
+    23c3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    23c6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    23c8:	84 c0                	test   %al,%al
+    23ca:	0f 84 3d ff ff ff    	je     230d <printf+0x4d>
+    23d0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    23d3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    23d6:	89 de                	mov    %ebx,%esi
+    23d8:	89 d3                	mov    %edx,%ebx
+    23da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    23e0:	83 ec 04             	sub    $0x4,%esp
+    23e3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    23e6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    23e9:	6a 01                	push   $0x1
+    23eb:	53                   	push   %ebx
+    23ec:	57                   	push   %edi
+    23ed:	e8 41 fd ff ff       	call   2133 <write>
+        while(*s != 0){
+    23f2:	0f b6 06             	movzbl (%esi),%eax
+    23f5:	83 c4 10             	add    $0x10,%esp
+    23f8:	84 c0                	test   %al,%al
+    23fa:	75 e4                	jne    23e0 <printf+0x120>
+      state = 0;
+    23fc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    23ff:	31 d2                	xor    %edx,%edx
+    2401:	e9 07 ff ff ff       	jmp    230d <printf+0x4d>
+    2406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    240d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    2410:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    2413:	83 ec 0c             	sub    $0xc,%esp
+    2416:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    241b:	8b 13                	mov    (%ebx),%edx
+    241d:	6a 01                	push   $0x1
+    241f:	e9 6b ff ff ff       	jmp    238f <printf+0xcf>
+    2424:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    2428:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    242b:	83 ec 04             	sub    $0x4,%esp
+    242e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    2431:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    2433:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    2436:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    2439:	6a 01                	push   $0x1
+    243b:	52                   	push   %edx
+    243c:	57                   	push   %edi
+    243d:	e8 f1 fc ff ff       	call   2133 <write>
+        ap++;
+    2442:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    2445:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    2448:	31 d2                	xor    %edx,%edx
+    244a:	e9 be fe ff ff       	jmp    230d <printf+0x4d>
+    244f:	90                   	nop
+  write(fd, &c, 1);
+    2450:	83 ec 04             	sub    $0x4,%esp
+    2453:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    2456:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    2459:	6a 01                	push   $0x1
+    245b:	e9 11 ff ff ff       	jmp    2371 <printf+0xb1>
+    2460:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    2465:	bb fd 35 00 00       	mov    $0x35fd,%ebx
+    246a:	e9 61 ff ff ff       	jmp    23d0 <printf+0x110>
+    246f:	90                   	nop
+
+00002470 <runfree>:
+
+// Give the n pages at r back to the free runs, merging them with
+// adjacent runs, and shrink the heap if the end of it is free.
+static void
+runfree(struct page *r, uint n)
+{
+    2470:	55                   	push   %ebp
+  struct page **pp, *prev;
+
+  r->kind = PFREE;
+    2471:	b9 03 00 00 00       	mov    $0x3,%ecx
+{
+    2476:	89 e5                	mov    %esp,%ebp
+    2478:	57                   	push   %edi
+    2479:	56                   	push   %esi
+    247a:	53                   	push   %ebx
+    247b:	89 c3                	mov    %eax,%ebx
+    247d:	83 ec 0c             	sub    $0xc,%esp
+  r->kind = PFREE;
+    2480:	66 89 08             	mov    %cx,(%eax)
+  r->npages = n;
+  prev = 0;
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+    2483:	8b 0d 94 71 00 00    	mov    0x7194,%ecx
+  r->npages = n;
+    2489:	89 50 04             	mov    %edx,0x4(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+    248c:	85 c9                	test   %ecx,%ecx
+    248e:	0f 84 1f 01 00 00    	je     25b3 <runfree+0x143>
+    2494:	39 c1                	cmp    %eax,%ecx
+    2496:	0f 83 f7 00 00 00    	jae    2593 <runfree+0x123>
+    249c:	89 c8                	mov    %ecx,%eax
+    249e:	eb 04                	jmp    24a4 <runfree+0x34>
+    24a0:	39 d8                	cmp    %ebx,%eax
+    24a2:	73 09                	jae    24ad <runfree+0x3d>
+    24a4:	89 c2                	mov    %eax,%edx
+    24a6:	8b 40 14             	mov    0x14(%eax),%eax
+    24a9:	85 c0                	test   %eax,%eax
+    24ab:	75 f3                	jne    24a0 <runfree+0x30>
+    prev = *pp;
+  r->next = *pp;
+    24ad:	89 43 14             	mov    %eax,0x14(%ebx)
+  *pp = r;
+    24b0:	89 5a 14             	mov    %ebx,0x14(%edx)
+
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+    24b3:	8b 43 14             	mov    0x14(%ebx),%eax
+    24b6:	85 c0                	test   %eax,%eax
+    24b8:	74 12                	je     24cc <runfree+0x5c>
+    24ba:	8b 7b 04             	mov    0x4(%ebx),%edi
+    24bd:	89 fe                	mov    %edi,%esi
+    24bf:	c1 e6 0c             	shl    $0xc,%esi
+    24c2:	01 de                	add    %ebx,%esi
+    24c4:	39 f0                	cmp    %esi,%eax
+    24c6:	0f 84 a4 00 00 00    	je     2570 <runfree+0x100>
+    r->npages += r->next->npages;
+    r->next = r->next->next;
+  }
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+    24cc:	8b 72 04             	mov    0x4(%edx),%esi
+    24cf:	89 f0                	mov    %esi,%eax
+    24d1:	c1 e0 0c             	shl    $0xc,%eax
+    24d4:	01 d0                	add    %edx,%eax
+    24d6:	39 c3                	cmp    %eax,%ebx
+    24d8:	74 16                	je     24f0 <runfree+0x80>
+    pp = &runs;
+    while(*pp != r)
+      pp = &(*pp)->next;
+  }
+
+  if(r->next == 0 && r->npages >= TRIM &&
+    24da:	8b 43 14             	mov    0x14(%ebx),%eax
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+    24dd:	8d 72 14             	lea    0x14(%edx),%esi
+  if(r->next == 0 && r->npages >= TRIM &&
+    24e0:	85 c0                	test   %eax,%eax
+    24e2:	74 3c                	je     2520 <runfree+0xb0>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+    *pp = 0;
+    sbrk(-(int)(r->npages*PGSIZE));
+    heapend = (char*)r;
+  }
+}
+    24e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    24e7:	5b                   	pop    %ebx
+    24e8:	5e                   	pop    %esi
+    24e9:	5f                   	pop    %edi
+    24ea:	5d                   	pop    %ebp
+    24eb:	c3                   	ret
+    24ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    prev->npages += r->npages;
+    24f0:	03 73 04             	add    0x4(%ebx),%esi
+    24f3:	89 72 04             	mov    %esi,0x4(%edx)
+    prev->next = r->next;
+    24f6:	8b 43 14             	mov    0x14(%ebx),%eax
+    24f9:	89 42 14             	mov    %eax,0x14(%edx)
+    while(*pp != r)
+    24fc:	39 d1                	cmp    %edx,%ecx
+    24fe:	0f 84 c5 00 00 00    	je     25c9 <runfree+0x159>
+    2504:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      pp = &(*pp)->next;
+    2508:	89 cb                	mov    %ecx,%ebx
+    250a:	8b 49 14             	mov    0x14(%ecx),%ecx
+    while(*pp != r)
+    250d:	39 d1                	cmp    %edx,%ecx
+    250f:	75 f7                	jne    2508 <runfree+0x98>
+      pp = &(*pp)->next;
+    2511:	8d 73 14             	lea    0x14(%ebx),%esi
+    2514:	89 cb                	mov    %ecx,%ebx
+  if(r->next == 0 && r->npages >= TRIM &&
+    2516:	85 c0                	test   %eax,%eax
+    2518:	75 ca                	jne    24e4 <runfree+0x74>
+    251a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    2520:	8b 53 04             	mov    0x4(%ebx),%edx
+    2523:	83 fa 1f             	cmp    $0x1f,%edx
+    2526:	76 bc                	jbe    24e4 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+    2528:	c1 e2 0c             	shl    $0xc,%edx
+    252b:	01 da                	add    %ebx,%edx
+  if(r->next == 0 && r->npages >= TRIM &&
+    252d:	39 15 90 71 00 00    	cmp    %edx,0x7190
+    2533:	75 af                	jne    24e4 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+    2535:	83 ec 0c             	sub    $0xc,%esp
+    2538:	6a 00                	push   $0x0
+    253a:	e8 5c fc ff ff       	call   219b <sbrk>
+    253f:	83 c4 10             	add    $0x10,%esp
+    2542:	39 05 90 71 00 00    	cmp    %eax,0x7190
+    2548:	75 9a                	jne    24e4 <runfree+0x74>
+    *pp = 0;
+    254a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    sbrk(-(int)(r->npages*PGSIZE));
+    2550:	8b 43 04             	mov    0x4(%ebx),%eax
+    2553:	83 ec 0c             	sub    $0xc,%esp
+    2556:	c1 e0 0c             	shl    $0xc,%eax
+    2559:	f7 d8                	neg    %eax
+    255b:	50                   	push   %eax
+    255c:	e8 3a fc ff ff       	call   219b <sbrk>
+    heapend = (char*)r;
+    2561:	89 1d 90 71 00 00    	mov    %ebx,0x7190
+    2567:	83 c4 10             	add    $0x10,%esp
+}
+    256a:	e9 75 ff ff ff       	jmp    24e4 <runfree+0x74>
+    256f:	90                   	nop
+    r->npages += r->next->npages;
+    2570:	03 78 04             	add    0x4(%eax),%edi
+    2573:	89 7b 04             	mov    %edi,0x4(%ebx)
+    r->next = r->next->next;
+    2576:	8b 40 14             	mov    0x14(%eax),%eax
+    2579:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+    257c:	8b 72 04             	mov    0x4(%edx),%esi
+    257f:	89 f0                	mov    %esi,%eax
+    2581:	c1 e0 0c             	shl    $0xc,%eax
+    2584:	01 d0                	add    %edx,%eax
+    2586:	39 c3                	cmp    %eax,%ebx
+    2588:	0f 85 4c ff ff ff    	jne    24da <runfree+0x6a>
+    258e:	e9 5d ff ff ff       	jmp    24f0 <runfree+0x80>
+  r->next = *pp;
+    2593:	89 48 14             	mov    %ecx,0x14(%eax)
+  *pp = r;
+    2596:	a3 94 71 00 00       	mov    %eax,0x7194
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+    259b:	89 d0                	mov    %edx,%eax
+    259d:	c1 e0 0c             	shl    $0xc,%eax
+    25a0:	01 d8                	add    %ebx,%eax
+    25a2:	39 c1                	cmp    %eax,%ecx
+    25a4:	74 2f                	je     25d5 <runfree+0x165>
+  if(r->next == 0 && r->npages >= TRIM &&
+    25a6:	8b 43 14             	mov    0x14(%ebx),%eax
+    25a9:	be 94 71 00 00       	mov    $0x7194,%esi
+    25ae:	e9 2d ff ff ff       	jmp    24e0 <runfree+0x70>
+  r->next = *pp;
+    25b3:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+    25ba:	be 94 71 00 00       	mov    $0x7194,%esi
+  *pp = r;
+    25bf:	a3 94 71 00 00       	mov    %eax,0x7194
+  if(r->next == 0 && r->npages >= TRIM &&
+    25c4:	e9 5a ff ff ff       	jmp    2523 <runfree+0xb3>
+    while(*pp != r)
+    25c9:	89 cb                	mov    %ecx,%ebx
+    pp = &runs;
+    25cb:	be 94 71 00 00       	mov    $0x7194,%esi
+    25d0:	e9 0b ff ff ff       	jmp    24e0 <runfree+0x70>
+    r->npages += r->next->npages;
+    25d5:	03 51 04             	add    0x4(%ecx),%edx
+    25d8:	89 53 04             	mov    %edx,0x4(%ebx)
+    r->next = r->next->next;
+    25db:	8b 41 14             	mov    0x14(%ecx),%eax
+    25de:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+    25e1:	eb c3                	jmp    25a6 <runfree+0x136>
+    25e3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    25ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000025f0 <runalloc>:
+
+// Take a run of n pages from the start of the first free run
+// long enough, which keeps the end of the heap free to trim.
+static struct page*
+runalloc(uint n)
+{
+    25f0:	55                   	push   %ebp
+    25f1:	89 e5                	mov    %esp,%ebp
+    25f3:	57                   	push   %edi
+    25f4:	56                   	push   %esi
+    25f5:	89 c6                	mov    %eax,%esi
+    25f7:	53                   	push   %ebx
+    25f8:	83 ec 1c             	sub    $0x1c,%esp
+  struct page **pp, *r, *rest;
+
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+    25fb:	8b 1d 94 71 00 00    	mov    0x7194,%ebx
+    2601:	85 db                	test   %ebx,%ebx
+    2603:	74 4d                	je     2652 <runalloc+0x62>
+    2605:	b9 94 71 00 00       	mov    $0x7194,%ecx
+    if(r->npages < n)
+    260a:	39 73 04             	cmp    %esi,0x4(%ebx)
+    260d:	72 39                	jb     2648 <runalloc+0x58>
+      continue;
+    if(r->npages == n){
+    260f:	0f 84 9b 00 00 00    	je     26b0 <runalloc+0xc0>
+      *pp = r->next;
+    } else {
+      rest = (struct page*)((char*)r + n*PGSIZE);
+    2615:	89 f0                	mov    %esi,%eax
+      rest->kind = PFREE;
+    2617:	ba 03 00 00 00       	mov    $0x3,%edx
+      rest = (struct page*)((char*)r + n*PGSIZE);
+    261c:	c1 e0 0c             	shl    $0xc,%eax
+    261f:	01 d8                	add    %ebx,%eax
+      rest->kind = PFREE;
+    2621:	66 89 10             	mov    %dx,(%eax)
+      rest->npages = r->npages - n;
+    2624:	8b 53 04             	mov    0x4(%ebx),%edx
+    2627:	29 f2                	sub    %esi,%edx
+    2629:	89 50 04             	mov    %edx,0x4(%eax)
+      rest->next = r->next;
+    262c:	8b 53 14             	mov    0x14(%ebx),%edx
+    262f:	89 50 14             	mov    %edx,0x14(%eax)
+      *pp = rest;
+    2632:	89 01                	mov    %eax,(%ecx)
+      r->npages = n;
+    2634:	89 73 04             	mov    %esi,0x4(%ebx)
+    }
+    return r;
+  }
+  return morecore(n);
+}
+    2637:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    263a:	89 d8                	mov    %ebx,%eax
+    263c:	5b                   	pop    %ebx
+    263d:	5e                   	pop    %esi
+    263e:	5f                   	pop    %edi
+    263f:	5d                   	pop    %ebp
+    2640:	c3                   	ret
+    2641:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+    2648:	8d 4b 14             	lea    0x14(%ebx),%ecx
+    264b:	8b 5b 14             	mov    0x14(%ebx),%ebx
+    264e:	85 db                	test   %ebx,%ebx
+    2650:	75 b8                	jne    260a <runalloc+0x1a>
+  m = n < MINCORE ? MINCORE : n;
+    2652:	bf 08 00 00 00       	mov    $0x8,%edi
+    2657:	39 fe                	cmp    %edi,%esi
+    2659:	0f 43 fe             	cmovae %esi,%edi
+  brk = sbrk(0);
+    265c:	83 ec 0c             	sub    $0xc,%esp
+    265f:	6a 00                	push   $0x0
+    2661:	e8 35 fb ff ff       	call   219b <sbrk>
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+    2666:	89 fa                	mov    %edi,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+    2668:	89 c3                	mov    %eax,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+    266a:	c1 e2 0c             	shl    $0xc,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+    266d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    2670:	f7 db                	neg    %ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+    2672:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+    2675:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+    267b:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+    267e:	89 04 24             	mov    %eax,(%esp)
+    2681:	e8 15 fb ff ff       	call   219b <sbrk>
+    2686:	83 c4 10             	add    $0x10,%esp
+    2689:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    268c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    268f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2692:	74 3e                	je     26d2 <runalloc+0xe2>
+  r = (struct page*)(brk + pad);
+    2694:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+    2696:	01 da                	add    %ebx,%edx
+    2698:	89 15 90 71 00 00    	mov    %edx,0x7190
+  if(m > n)
+    269e:	39 fe                	cmp    %edi,%esi
+    26a0:	72 1e                	jb     26c0 <runalloc+0xd0>
+  r->npages = n;
+    26a2:	89 73 04             	mov    %esi,0x4(%ebx)
+  return r;
+    26a5:	eb 90                	jmp    2637 <runalloc+0x47>
+    26a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    26ae:	66 90                	xchg   %ax,%ax
+      *pp = r->next;
+    26b0:	8b 43 14             	mov    0x14(%ebx),%eax
+    26b3:	89 01                	mov    %eax,(%ecx)
+}
+    26b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    26b8:	89 d8                	mov    %ebx,%eax
+    26ba:	5b                   	pop    %ebx
+    26bb:	5e                   	pop    %esi
+    26bc:	5f                   	pop    %edi
+    26bd:	5d                   	pop    %ebp
+    26be:	c3                   	ret
+    26bf:	90                   	nop
+    runfree((struct page*)((char*)r + n*PGSIZE), m - n);
+    26c0:	89 f0                	mov    %esi,%eax
+    26c2:	29 f7                	sub    %esi,%edi
+    26c4:	c1 e0 0c             	shl    $0xc,%eax
+    26c7:	89 fa                	mov    %edi,%edx
+    26c9:	01 d8                	add    %ebx,%eax
+    26cb:	e8 a0 fd ff ff       	call   2470 <runfree>
+    26d0:	eb d0                	jmp    26a2 <runalloc+0xb2>
+    if(sbrk(pad + m*PGSIZE) == (char*)-1)
+    26d2:	89 f7                	mov    %esi,%edi
+    26d4:	83 ec 0c             	sub    $0xc,%esp
+    26d7:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    26da:	c1 e7 0c             	shl    $0xc,%edi
+    26dd:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+    26e0:	50                   	push   %eax
+    26e1:	e8 b5 fa ff ff       	call   219b <sbrk>
+    26e6:	83 c4 10             	add    $0x10,%esp
+    26e9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    26ec:	83 f8 ff             	cmp    $0xffffffff,%eax
+    26ef:	74 0c                	je     26fd <runalloc+0x10d>
+  r = (struct page*)(brk + pad);
+    26f1:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+    26f3:	01 df                	add    %ebx,%edi
+    26f5:	89 3d 90 71 00 00    	mov    %edi,0x7190
+  if(m > n)
+    26fb:	eb a5                	jmp    26a2 <runalloc+0xb2>
+      return 0;
+    26fd:	31 db                	xor    %ebx,%ebx
+    26ff:	e9 33 ff ff ff       	jmp    2637 <runalloc+0x47>
+    2704:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    270b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    270f:	90                   	nop
+
+00002710 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+    2710:	55                   	push   %ebp
+    2711:	89 e5                	mov    %esp,%ebp
+    2713:	56                   	push   %esi
+    2714:	53                   	push   %ebx
+    2715:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  struct page *p;
+
+  if(ap == 0)
+    2718:	85 c9                	test   %ecx,%ecx
+    271a:	74 1c                	je     2738 <free+0x28>
+    return;
+  p = (struct page*)((uint)ap & ~(PGSIZE-1));
+    271c:	89 c8                	mov    %ecx,%eax
+    271e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  switch(p->kind){
+    2723:	0f b7 10             	movzwl (%eax),%edx
+    2726:	66 83 fa 02          	cmp    $0x2,%dx
+    272a:	74 14                	je     2740 <free+0x30>
+    272c:	66 83 fa 04          	cmp    $0x4,%dx
+    2730:	74 66                	je     2798 <free+0x88>
+    2732:	66 83 fa 01          	cmp    $0x1,%dx
+    2736:	74 18                	je     2750 <free+0x40>
+    break;
+  case PMAP:
+    munmap(p, p->npages*PGSIZE);
+    break;
+  }
+}
+    2738:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    273b:	5b                   	pop    %ebx
+    273c:	5e                   	pop    %esi
+    273d:	5d                   	pop    %ebp
+    273e:	c3                   	ret
+    273f:	90                   	nop
+    runfree(p, p->npages);
+    2740:	8b 50 04             	mov    0x4(%eax),%edx
+}
+    2743:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2746:	5b                   	pop    %ebx
+    2747:	5e                   	pop    %esi
+    2748:	5d                   	pop    %ebp
+    runfree(p, p->npages);
+    2749:	e9 22 fd ff ff       	jmp    2470 <runfree>
+    274e:	66 90                	xchg   %ax,%ax
+  b->next = p->free;
+    2750:	8b 50 0c             	mov    0xc(%eax),%edx
+    2753:	89 11                	mov    %edx,(%ecx)
+  if(p->nfree++ == 0)
+    2755:	8b 50 08             	mov    0x8(%eax),%edx
+  p->free = b;
+    2758:	89 48 0c             	mov    %ecx,0xc(%eax)
+  if(p->nfree++ == 0)
+    275b:	8d 5a 01             	lea    0x1(%edx),%ebx
+    275e:	89 58 08             	mov    %ebx,0x8(%eax)
+    2761:	85 d2                	test   %edx,%edx
+    2763:	74 53                	je     27b8 <free+0xa8>
+  if(p->nfree == nblocks(p->class)){
+    2765:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+    2769:	8d 4e 04             	lea    0x4(%esi),%ecx
+    276c:	ba e0 0f 00 00       	mov    $0xfe0,%edx
+    2771:	d3 fa                	sar    %cl,%edx
+  if(p->nfree == nblocks(p->class)){
+    2773:	39 da                	cmp    %ebx,%edx
+    2775:	75 c1                	jne    2738 <free+0x28>
+  if(p->prev)
+    2777:	8b 48 18             	mov    0x18(%eax),%ecx
+    p->prev->next = p->next;
+    277a:	8b 50 14             	mov    0x14(%eax),%edx
+  if(p->prev)
+    277d:	85 c9                	test   %ecx,%ecx
+    277f:	74 6f                	je     27f0 <free+0xe0>
+    p->prev->next = p->next;
+    2781:	89 51 14             	mov    %edx,0x14(%ecx)
+  if(p->next)
+    2784:	85 d2                	test   %edx,%edx
+    2786:	74 06                	je     278e <free+0x7e>
+    p->next->prev = p->prev;
+    2788:	8b 48 18             	mov    0x18(%eax),%ecx
+    278b:	89 4a 18             	mov    %ecx,0x18(%edx)
+    runfree(p, 1);
+    278e:	ba 01 00 00 00       	mov    $0x1,%edx
+    2793:	eb ae                	jmp    2743 <free+0x33>
+    2795:	8d 76 00             	lea    0x0(%esi),%esi
+    munmap(p, p->npages*PGSIZE);
+    2798:	8b 50 04             	mov    0x4(%eax),%edx
+    279b:	83 ec 08             	sub    $0x8,%esp
+    279e:	c1 e2 0c             	shl    $0xc,%edx
+    27a1:	52                   	push   %edx
+    27a2:	50                   	push   %eax
+    27a3:	e8 1b fa ff ff       	call   21c3 <munmap>
+    break;
+    27a8:	83 c4 10             	add    $0x10,%esp
+}
+    27ab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    27ae:	5b                   	pop    %ebx
+    27af:	5e                   	pop    %esi
+    27b0:	5d                   	pop    %ebp
+    27b1:	c3                   	ret
+    27b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  p->next = partial[p->class];
+    27b8:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  p->prev = 0;
+    27bc:	c7 40 18 00 00 00 00 	movl   $0x0,0x18(%eax)
+  p->next = partial[p->class];
+    27c3:	bb 01 00 00 00       	mov    $0x1,%ebx
+    27c8:	8b 14 b5 98 71 00 00 	mov    0x7198(,%esi,4),%edx
+    27cf:	89 50 14             	mov    %edx,0x14(%eax)
+  if(p->next)
+    27d2:	85 d2                	test   %edx,%edx
+    27d4:	74 0a                	je     27e0 <free+0xd0>
+    p->next->prev = p;
+    27d6:	89 42 18             	mov    %eax,0x18(%edx)
+  partial[p->class] = p;
+    27d9:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  if(p->nfree == nblocks(p->class)){
+    27dd:	8b 58 08             	mov    0x8(%eax),%ebx
+  partial[p->class] = p;
+    27e0:	89 04 b5 98 71 00 00 	mov    %eax,0x7198(,%esi,4)
+}
+    27e7:	eb 80                	jmp    2769 <free+0x59>
+    27e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+    27f0:	89 14 b5 98 71 00 00 	mov    %edx,0x7198(,%esi,4)
+    27f7:	eb 8b                	jmp    2784 <free+0x74>
+    27f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002800 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    2800:	55                   	push   %ebp
+    2801:	89 e5                	mov    %esp,%ebp
+    2803:	56                   	push   %esi
+    2804:	53                   	push   %ebx
+    2805:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct page *p;
+  uint n;
+
+  if(nbytes <= MAXSMALL)
+    2808:	3d 00 04 00 00       	cmp    $0x400,%eax
+    280d:	76 71                	jbe    2880 <malloc+0x80>
+    return smallalloc(sizeclass(nbytes));
+  if(nbytes > 0x7fffffff)
+    280f:	85 c0                	test   %eax,%eax
+    2811:	0f 88 d9 00 00 00    	js     28f0 <malloc+0xf0>
+    return 0;
+  n = (nbytes + HDRSIZE + PGSIZE-1) / PGSIZE;
+    2817:	8d 90 1f 10 00 00    	lea    0x101f(%eax),%edx
+    281d:	89 d3                	mov    %edx,%ebx
+    281f:	c1 eb 0c             	shr    $0xc,%ebx
+  if(nbytes >= MAPMIN){
+    2822:	3d ff ff 00 00       	cmp    $0xffff,%eax
+    2827:	77 27                	ja     2850 <malloc+0x50>
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    if(p == MAP_FAILED)
+      return 0;
+    p->kind = PMAP;
+  } else {
+    if((p = runalloc(n)) == 0)
+    2829:	89 d8                	mov    %ebx,%eax
+    282b:	e8 c0 fd ff ff       	call   25f0 <runalloc>
+    2830:	85 c0                	test   %eax,%eax
+    2832:	0f 84 b8 00 00 00    	je     28f0 <malloc+0xf0>
+      return 0;
+    p->kind = PRUN;
+    2838:	ba 02 00 00 00       	mov    $0x2,%edx
+    283d:	66 89 10             	mov    %dx,(%eax)
+  }
+  p->npages = n;
+    2840:	89 58 04             	mov    %ebx,0x4(%eax)
+  return (char*)p + HDRSIZE;
+    2843:	8d 58 20             	lea    0x20(%eax),%ebx
+}
+    2846:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2849:	89 d8                	mov    %ebx,%eax
+    284b:	5b                   	pop    %ebx
+    284c:	5e                   	pop    %esi
+    284d:	5d                   	pop    %ebp
+    284e:	c3                   	ret
+    284f:	90                   	nop
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    2850:	83 ec 08             	sub    $0x8,%esp
+    2853:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+    2859:	6a 00                	push   $0x0
+    285b:	6a ff                	push   $0xffffffff
+    285d:	6a 22                	push   $0x22
+    285f:	6a 03                	push   $0x3
+    2861:	52                   	push   %edx
+    2862:	6a 00                	push   $0x0
+    2864:	e8 52 f9 ff ff       	call   21bb <mmap>
+    if(p == MAP_FAILED)
+    2869:	83 c4 20             	add    $0x20,%esp
+    286c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    286f:	74 7f                	je     28f0 <malloc+0xf0>
+    p->kind = PMAP;
+    2871:	b9 04 00 00 00       	mov    $0x4,%ecx
+    2876:	66 89 08             	mov    %cx,(%eax)
+    2879:	eb c5                	jmp    2840 <malloc+0x40>
+    287b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    287f:	90                   	nop
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+    2880:	83 f8 10             	cmp    $0x10,%eax
+    2883:	0f 86 07 01 00 00    	jbe    2990 <malloc+0x190>
+    2889:	31 db                	xor    %ebx,%ebx
+    288b:	ba 10 00 00 00       	mov    $0x10,%edx
+    2890:	83 c3 01             	add    $0x1,%ebx
+    2893:	89 d6                	mov    %edx,%esi
+    2895:	89 d9                	mov    %ebx,%ecx
+    2897:	d3 e6                	shl    %cl,%esi
+    2899:	39 c6                	cmp    %eax,%esi
+    289b:	72 f3                	jb     2890 <malloc+0x90>
+  if((p = partial[c]) == 0){
+    289d:	8b 14 9d 98 71 00 00 	mov    0x7198(,%ebx,4),%edx
+    28a4:	85 d2                	test   %edx,%edx
+    28a6:	74 58                	je     2900 <malloc+0x100>
+  if((b = p->free) != 0){
+    28a8:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+    28ab:	8b 4a 08             	mov    0x8(%edx),%ecx
+  if((b = p->free) != 0){
+    28ae:	85 db                	test   %ebx,%ebx
+    28b0:	0f 84 aa 00 00 00    	je     2960 <malloc+0x160>
+    p->free = b->next;
+    28b6:	8b 03                	mov    (%ebx),%eax
+    28b8:	89 42 0c             	mov    %eax,0xc(%edx)
+  if(--p->nfree == 0)
+    28bb:	83 e9 01             	sub    $0x1,%ecx
+    28be:	89 4a 08             	mov    %ecx,0x8(%edx)
+    28c1:	75 83                	jne    2846 <malloc+0x46>
+  if(p->prev)
+    28c3:	8b 4a 18             	mov    0x18(%edx),%ecx
+    p->prev->next = p->next;
+    28c6:	8b 42 14             	mov    0x14(%edx),%eax
+  if(p->prev)
+    28c9:	85 c9                	test   %ecx,%ecx
+    28cb:	0f 84 cf 00 00 00    	je     29a0 <malloc+0x1a0>
+    p->prev->next = p->next;
+    28d1:	89 41 14             	mov    %eax,0x14(%ecx)
+  if(p->next)
+    28d4:	85 c0                	test   %eax,%eax
+    28d6:	0f 84 6a ff ff ff    	je     2846 <malloc+0x46>
+    p->next->prev = p->prev;
+    28dc:	8b 52 18             	mov    0x18(%edx),%edx
+    28df:	89 50 18             	mov    %edx,0x18(%eax)
+    28e2:	e9 5f ff ff ff       	jmp    2846 <malloc+0x46>
+    28e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    28ee:	66 90                	xchg   %ax,%ax
+}
+    28f0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+    28f3:	31 db                	xor    %ebx,%ebx
+}
+    28f5:	89 d8                	mov    %ebx,%eax
+    28f7:	5b                   	pop    %ebx
+    28f8:	5e                   	pop    %esi
+    28f9:	5d                   	pop    %ebp
+    28fa:	c3                   	ret
+    28fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    28ff:	90                   	nop
+    if((p = runalloc(1)) == 0)
+    2900:	b8 01 00 00 00       	mov    $0x1,%eax
+    2905:	e8 e6 fc ff ff       	call   25f0 <runalloc>
+    290a:	89 c2                	mov    %eax,%edx
+    290c:	85 c0                	test   %eax,%eax
+    290e:	74 e0                	je     28f0 <malloc+0xf0>
+    p->kind = PSMALL;
+    2910:	b8 01 00 00 00       	mov    $0x1,%eax
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+    2915:	8d 4b 04             	lea    0x4(%ebx),%ecx
+    p->class = c;
+    2918:	66 89 5a 02          	mov    %bx,0x2(%edx)
+    291c:	0f b7 db             	movzwl %bx,%ebx
+    p->kind = PSMALL;
+    291f:	66 89 02             	mov    %ax,(%edx)
+    p->fresh = (char*)p + HDRSIZE;
+    2922:	8d 42 20             	lea    0x20(%edx),%eax
+    2925:	89 42 10             	mov    %eax,0x10(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+    2928:	b8 e0 0f 00 00       	mov    $0xfe0,%eax
+    292d:	d3 f8                	sar    %cl,%eax
+    p->free = 0;
+    292f:	c7 42 0c 00 00 00 00 	movl   $0x0,0xc(%edx)
+    p->nfree = nblocks(c);
+    2936:	89 42 08             	mov    %eax,0x8(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+    2939:	89 c1                	mov    %eax,%ecx
+  p->next = partial[p->class];
+    293b:	8b 04 9d 98 71 00 00 	mov    0x7198(,%ebx,4),%eax
+  p->prev = 0;
+    2942:	c7 42 18 00 00 00 00 	movl   $0x0,0x18(%edx)
+  p->next = partial[p->class];
+    2949:	89 42 14             	mov    %eax,0x14(%edx)
+  if(p->next)
+    294c:	85 c0                	test   %eax,%eax
+    294e:	75 20                	jne    2970 <malloc+0x170>
+  partial[p->class] = p;
+    2950:	89 14 9d 98 71 00 00 	mov    %edx,0x7198(,%ebx,4)
+  if((b = p->free) != 0){
+    2957:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    295e:	66 90                	xchg   %ax,%ax
+    b = (struct block*)p->fresh;
+    2960:	8b 5a 10             	mov    0x10(%edx),%ebx
+    p->fresh += MINSMALL << c;
+    2963:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+    2966:	89 42 10             	mov    %eax,0x10(%edx)
+    2969:	e9 4d ff ff ff       	jmp    28bb <malloc+0xbb>
+    296e:	66 90                	xchg   %ax,%ax
+    p->next->prev = p;
+    2970:	89 50 18             	mov    %edx,0x18(%eax)
+  partial[p->class] = p;
+    2973:	0f b7 42 02          	movzwl 0x2(%edx),%eax
+  if((b = p->free) != 0){
+    2977:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+    297a:	8b 4a 08             	mov    0x8(%edx),%ecx
+  partial[p->class] = p;
+    297d:	89 14 85 98 71 00 00 	mov    %edx,0x7198(,%eax,4)
+}
+    2984:	e9 25 ff ff ff       	jmp    28ae <malloc+0xae>
+    2989:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+    2990:	be 10 00 00 00       	mov    $0x10,%esi
+    2995:	31 db                	xor    %ebx,%ebx
+    2997:	e9 01 ff ff ff       	jmp    289d <malloc+0x9d>
+    299c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+    29a0:	0f b7 4a 02          	movzwl 0x2(%edx),%ecx
+    29a4:	89 04 8d 98 71 00 00 	mov    %eax,0x7198(,%ecx,4)
+    29ab:	e9 24 ff ff ff       	jmp    28d4 <malloc+0xd4>
+
+000029b0 <tmain>:
+  void *arg;
+};
+
+static void
+tmain(void *a)
+{
+    29b0:	55                   	push   %ebp
+    29b1:	89 e5                	mov    %esp,%ebp
+    29b3:	83 ec 14             	sub    $0x14,%esp
+    29b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+    29b9:	ff 70 04             	push   0x4(%eax)
+    29bc:	ff 10                	call   *(%eax)
+  exit();
+    29be:	e8 50 f7 ff ff       	call   2113 <exit>
+    29c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    29ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000029d0 <thread_create>:
+// Start a thread running fn(arg), and return its id for
+// thread_join, or -1. A thread that returns from fn exits.
+// Uses malloc, which only one thread may call at a time.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    29d0:	55                   	push   %ebp
+    29d1:	89 e5                	mov    %esp,%ebp
+    29d3:	53                   	push   %ebx
+    29d4:	83 ec 20             	sub    $0x20,%esp
+  char *stack;
+  struct tstart *t;
+  int tid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    29d7:	68 00 20 00 00       	push   $0x2000
+    29dc:	e8 1f fe ff ff       	call   2800 <malloc>
+    29e1:	83 c4 10             	add    $0x10,%esp
+    29e4:	85 c0                	test   %eax,%eax
+    29e6:	74 4f                	je     2a37 <thread_create+0x67>
+    return -1;
+  t = (struct tstart*)(stack + TSTACK) - 1;
+  t->fn = fn;
+    29e8:	8b 55 08             	mov    0x8(%ebp),%edx
+    29eb:	89 c3                	mov    %eax,%ebx
+  t->arg = arg;
+  if((tid = clone(tmain, t, t)) < 0)
+    29ed:	83 ec 04             	sub    $0x4,%esp
+  t = (struct tstart*)(stack + TSTACK) - 1;
+    29f0:	8d 80 f8 1f 00 00    	lea    0x1ff8(%eax),%eax
+  t->fn = fn;
+    29f6:	89 93 f8 1f 00 00    	mov    %edx,0x1ff8(%ebx)
+  t->arg = arg;
+    29fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+    29ff:	89 93 fc 1f 00 00    	mov    %edx,0x1ffc(%ebx)
+  if((tid = clone(tmain, t, t)) < 0)
+    2a05:	50                   	push   %eax
+    2a06:	50                   	push   %eax
+    2a07:	68 b0 29 00 00       	push   $0x29b0
+    2a0c:	e8 d2 f7 ff ff       	call   21e3 <clone>
+    2a11:	83 c4 10             	add    $0x10,%esp
+    2a14:	85 c0                	test   %eax,%eax
+    2a16:	78 08                	js     2a20 <thread_create+0x50>
+    free(stack);
+  return tid;
+}
+    2a18:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2a1b:	c9                   	leave
+    2a1c:	c3                   	ret
+    2a1d:	8d 76 00             	lea    0x0(%esi),%esi
+    free(stack);
+    2a20:	83 ec 0c             	sub    $0xc,%esp
+    2a23:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    2a26:	53                   	push   %ebx
+    2a27:	e8 e4 fc ff ff       	call   2710 <free>
+    2a2c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    2a2f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(stack);
+    2a32:	83 c4 10             	add    $0x10,%esp
+}
+    2a35:	c9                   	leave
+    2a36:	c3                   	ret
+    return -1;
+    2a37:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2a3c:	eb da                	jmp    2a18 <thread_create+0x48>
+    2a3e:	66 90                	xchg   %ax,%ax
+
+00002a40 <thread_join>:
+// Wait for the thread tid to exit, or for any thread if tid
+// is -1, and free its stack. Returns the thread's id, or -1
+// if there is no such thread.
+int
+thread_join(int tid)
+{
+    2a40:	55                   	push   %ebp
+    2a41:	89 e5                	mov    %esp,%ebp
+    2a43:	53                   	push   %ebx
+  void *top;
+
+  if((tid = join(tid, &top)) >= 0)
+    2a44:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    2a47:	83 ec 1c             	sub    $0x1c,%esp
+  if((tid = join(tid, &top)) >= 0)
+    2a4a:	50                   	push   %eax
+    2a4b:	ff 75 08             	push   0x8(%ebp)
+    2a4e:	e8 98 f7 ff ff       	call   21eb <join>
+    2a53:	83 c4 10             	add    $0x10,%esp
+    2a56:	89 c3                	mov    %eax,%ebx
+    2a58:	85 c0                	test   %eax,%eax
+    2a5a:	78 14                	js     2a70 <thread_join+0x30>
+    free((char*)top + sizeof(struct tstart) - TSTACK);
+    2a5c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2a5f:	83 ec 0c             	sub    $0xc,%esp
+    2a62:	2d f8 1f 00 00       	sub    $0x1ff8,%eax
+    2a67:	50                   	push   %eax
+    2a68:	e8 a3 fc ff ff       	call   2710 <free>
+    2a6d:	83 c4 10             	add    $0x10,%esp
+  return tid;
+}
+    2a70:	89 d8                	mov    %ebx,%eax
+    2a72:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2a75:	c9                   	leave
+    2a76:	c3                   	ret
+    2a77:	66 90                	xchg   %ax,%ax
+    2a79:	66 90                	xchg   %ax,%ax
+    2a7b:	66 90                	xchg   %ax,%ax
+    2a7d:	66 90                	xchg   %ax,%ax
+    2a7f:	90                   	nop
+
+00002a80 <mutex_init>:
+#define LOCKED    1   // no one is waiting
+#define CONTENDED 2   // someone may be sleeping in futex()
+
+void
+mutex_init(struct mutex *m)
+{
+    2a80:	55                   	push   %ebp
+    2a81:	89 e5                	mov    %esp,%ebp
+  m->state = UNLOCKED;
+    2a83:	8b 45 08             	mov    0x8(%ebp),%eax
+    2a86:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    2a8c:	5d                   	pop    %ebp
+    2a8d:	c3                   	ret
+    2a8e:	66 90                	xchg   %ax,%ax
+
+00002a90 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+    2a90:	55                   	push   %ebp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, UNLOCKED, LOCKED)) == UNLOCKED)
+    2a91:	31 c0                	xor    %eax,%eax
+    2a93:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+    2a98:	89 e5                	mov    %esp,%ebp
+    2a9a:	56                   	push   %esi
+    2a9b:	53                   	push   %ebx
+    2a9c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->state, UNLOCKED, LOCKED)) == UNLOCKED)
+    2a9f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+    2aa3:	85 c0                	test   %eax,%eax
+    2aa5:	74 29                	je     2ad0 <mutex_lock+0x40>
+    return;
+  // Mark the mutex contended, so that the holder wakes us
+  // when it unlocks, and sleep until it is free.
+  if(c != CONTENDED)
+    2aa7:	83 f8 02             	cmp    $0x2,%eax
+    2aaa:	75 34                	jne    2ae0 <mutex_lock+0x50>
+    c = __sync_lock_test_and_set(&m->state, CONTENDED);
+  while(c != UNLOCKED){
+    futex(&m->state, FUTEX_WAIT, CONTENDED);
+    c = __sync_lock_test_and_set(&m->state, CONTENDED);
+    2aac:	be 02 00 00 00       	mov    $0x2,%esi
+    2ab1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAIT, CONTENDED);
+    2ab8:	83 ec 04             	sub    $0x4,%esp
+    2abb:	6a 02                	push   $0x2
+    2abd:	6a 00                	push   $0x0
+    2abf:	53                   	push   %ebx
+    2ac0:	e8 2e f7 ff ff       	call   21f3 <futex>
+    c = __sync_lock_test_and_set(&m->state, CONTENDED);
+    2ac5:	89 f0                	mov    %esi,%eax
+    2ac7:	87 03                	xchg   %eax,(%ebx)
+  while(c != UNLOCKED){
+    2ac9:	83 c4 10             	add    $0x10,%esp
+    2acc:	85 c0                	test   %eax,%eax
+    2ace:	75 e8                	jne    2ab8 <mutex_lock+0x28>
+  }
+}
+    2ad0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2ad3:	5b                   	pop    %ebx
+    2ad4:	5e                   	pop    %esi
+    2ad5:	5d                   	pop    %ebp
+    2ad6:	c3                   	ret
+    2ad7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2ade:	66 90                	xchg   %ax,%ax
+    c = __sync_lock_test_and_set(&m->state, CONTENDED);
+    2ae0:	b8 02 00 00 00       	mov    $0x2,%eax
+    2ae5:	87 03                	xchg   %eax,(%ebx)
+  while(c != UNLOCKED){
+    2ae7:	85 c0                	test   %eax,%eax
+    2ae9:	75 c1                	jne    2aac <mutex_lock+0x1c>
+}
+    2aeb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2aee:	5b                   	pop    %ebx
+    2aef:	5e                   	pop    %esi
+    2af0:	5d                   	pop    %ebp
+    2af1:	c3                   	ret
+    2af2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2af9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002b00 <mutex_trylock>:
+
+// Returns 0 if it got the mutex, -1 if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+    2b00:	55                   	push   %ebp
+  if(__sync_val_compare_and_swap(&m->state, UNLOCKED, LOCKED) == UNLOCKED)
+    2b01:	31 c0                	xor    %eax,%eax
+    2b03:	b9 01 00 00 00       	mov    $0x1,%ecx
+{
+    2b08:	89 e5                	mov    %esp,%ebp
+    2b0a:	8b 55 08             	mov    0x8(%ebp),%edx
+  if(__sync_val_compare_and_swap(&m->state, UNLOCKED, LOCKED) == UNLOCKED)
+    2b0d:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+    return 0;
+  return -1;
+}
+    2b11:	5d                   	pop    %ebp
+  if(__sync_val_compare_and_swap(&m->state, UNLOCKED, LOCKED) == UNLOCKED)
+    2b12:	f7 d8                	neg    %eax
+    2b14:	19 c0                	sbb    %eax,%eax
+}
+    2b16:	c3                   	ret
+    2b17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2b1e:	66 90                	xchg   %ax,%ax
+
+00002b20 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+    2b20:	55                   	push   %ebp
+    2b21:	89 e5                	mov    %esp,%ebp
+    2b23:	83 ec 08             	sub    $0x8,%esp
+    2b26:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != LOCKED){
+    2b29:	f0 83 28 01          	lock subl $0x1,(%eax)
+    2b2d:	75 09                	jne    2b38 <mutex_unlock+0x18>
+    m->state = UNLOCKED;
+    futex(&m->state, FUTEX_WAKE, 1);
+  }
+}
+    2b2f:	c9                   	leave
+    2b30:	c3                   	ret
+    2b31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+    2b38:	83 ec 04             	sub    $0x4,%esp
+    m->state = UNLOCKED;
+    2b3b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex(&m->state, FUTEX_WAKE, 1);
+    2b41:	6a 01                	push   $0x1
+    2b43:	6a 01                	push   $0x1
+    2b45:	50                   	push   %eax
+    2b46:	e8 a8 f6 ff ff       	call   21f3 <futex>
+    2b4b:	83 c4 10             	add    $0x10,%esp
+}
+    2b4e:	c9                   	leave
+    2b4f:	c3                   	ret
+
+00002b50 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+    2b50:	55                   	push   %ebp
+    2b51:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    2b53:	8b 45 08             	mov    0x8(%ebp),%eax
+    2b56:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    2b5c:	5d                   	pop    %ebp
+    2b5d:	c3                   	ret
+    2b5e:	66 90                	xchg   %ax,%ax
+
+00002b60 <cond_wait>:
+
+// Unlock m, wait for a signal, and lock m again. As with any
+// condition variable, the caller should recheck its condition.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+    2b60:	55                   	push   %ebp
+    2b61:	89 e5                	mov    %esp,%ebp
+    2b63:	57                   	push   %edi
+    2b64:	56                   	push   %esi
+    2b65:	53                   	push   %ebx
+    2b66:	83 ec 0c             	sub    $0xc,%esp
+    2b69:	8b 75 08             	mov    0x8(%ebp),%esi
+    2b6c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    2b6f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->state, 1) != LOCKED){
+    2b71:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+    2b75:	75 21                	jne    2b98 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+    2b77:	83 ec 04             	sub    $0x4,%esp
+    2b7a:	57                   	push   %edi
+    2b7b:	6a 00                	push   $0x0
+    2b7d:	56                   	push   %esi
+    2b7e:	e8 70 f6 ff ff       	call   21f3 <futex>
+  mutex_lock(m);
+    2b83:	89 5d 08             	mov    %ebx,0x8(%ebp)
+    2b86:	83 c4 10             	add    $0x10,%esp
+}
+    2b89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2b8c:	5b                   	pop    %ebx
+    2b8d:	5e                   	pop    %esi
+    2b8e:	5f                   	pop    %edi
+    2b8f:	5d                   	pop    %ebp
+  mutex_lock(m);
+    2b90:	e9 fb fe ff ff       	jmp    2a90 <mutex_lock>
+    2b95:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+    2b98:	83 ec 04             	sub    $0x4,%esp
+    m->state = UNLOCKED;
+    2b9b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex(&m->state, FUTEX_WAKE, 1);
+    2ba1:	6a 01                	push   $0x1
+    2ba3:	6a 01                	push   $0x1
+    2ba5:	53                   	push   %ebx
+    2ba6:	e8 48 f6 ff ff       	call   21f3 <futex>
+    2bab:	83 c4 10             	add    $0x10,%esp
+    2bae:	eb c7                	jmp    2b77 <cond_wait+0x17>
+
+00002bb0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+    2bb0:	55                   	push   %ebp
+    2bb1:	89 e5                	mov    %esp,%ebp
+    2bb3:	83 ec 0c             	sub    $0xc,%esp
+    2bb6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    2bb9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+    2bbd:	6a 01                	push   $0x1
+    2bbf:	6a 01                	push   $0x1
+    2bc1:	50                   	push   %eax
+    2bc2:	e8 2c f6 ff ff       	call   21f3 <futex>
+}
+    2bc7:	83 c4 10             	add    $0x10,%esp
+    2bca:	c9                   	leave
+    2bcb:	c3                   	ret
+    2bcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00002bd0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+    2bd0:	55                   	push   %ebp
+    2bd1:	89 e5                	mov    %esp,%ebp
+    2bd3:	83 ec 0c             	sub    $0xc,%esp
+    2bd6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    2bd9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 0x7fffffff);
+    2bdd:	68 ff ff ff 7f       	push   $0x7fffffff
+    2be2:	6a 01                	push   $0x1
+    2be4:	50                   	push   %eax
+    2be5:	e8 09 f6 ff ff       	call   21f3 <futex>
+}
+    2bea:	83 c4 10             	add    $0x10,%esp
+    2bed:	c9                   	leave
+    2bee:	c3                   	ret
@@ -0,0 +1,815 @@
+// Tests of the memory, process and container system calls:
+// demand paging, mmap, shared memory, spawn, threads, futexes,
+// container memory limits, checkpoint and swap. They
+// are kept apart from usertests so that each binary fits in a
+// file of MAXFILE blocks.
+
+#include "param.h"
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fs.h"
+#include "fcntl.h"
+#include "memlayout.h"
+#include "mman.h"
+#include "spawn.h"
+#include "memstats.h"
+#include "futex.h"
+#include "usync.h"
+#include "ckpt.h"
+
+char buf[8192];
+int stdout = 1;
+
+// are pages of the program's initialized data private to each
+// process, even though they come from the shared page cache?
+int cowdata[16] = { 1 };
+void
+demandtest(void)
+{
+  int pid, i;
+
+  printf(stdout, "demand paging test\n");
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    for(i = 0; i < sizeof(cowdata)/sizeof(cowdata[0]); i++)
+      cowdata[i] = 99;
+    exit();
+  }
+  wait();
+  if(cowdata[0] != 1 || cowdata[sizeof(cowdata)/sizeof(cowdata[0])-1] != 0){
+    printf(stdout, "demand paging test failed: child write visible\n");
+    exit();
+  }
+  cowdata[0] = 2;
+  pid = fork();
+  if(pid == 0){
+    if(cowdata[0] != 2){
+      printf(stdout, "demand paging test failed: parent write lost\n");
+      exit();
+    }
+    exit();
+  }
+  wait();
+  cowdata[0] = 1;
+  printf(stdout, "demand paging test ok\n");
+}
+
+// do writes through MAP_SHARED reach the file, read(), and
+// other processes, and do MAP_PRIVATE writes stay private?
+void
+mmaptest(void)
+{
+  int fd, fd2, pid;
+  char *p;
+
+  printf(stdout, "mmap test\n");
+  memset(buf, 'a', 4096);
+  fd = open("mmapfile", O_CREATE|O_RDWR);
+  if(fd < 0 || write(fd, buf, 4096) != 4096){
+    printf(stdout, "mmap test: create failed\n");
+    exit();
+  }
+  p = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+  if(p == MAP_FAILED || p[4095] != 'a'){
+    printf(stdout, "mmap test: shared map failed\n");
+    exit();
+  }
+  p[0] = 'b';
+  fd2 = open("mmapfile", 0);
+  if(fd2 < 0 || read(fd2, buf, 1) != 1 || buf[0] != 'b'){
+    printf(stdout, "mmap test: read missed shared store\n");
+    exit();
+  }
+  close(fd2);
+  munmap(p, 4096);
+  p = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+  if(p == MAP_FAILED || p[0] != 'b'){
+    printf(stdout, "mmap test: shared write lost\n");
+    exit();
+  }
+  p[0] = 'c';
+  munmap(p, 4096);
+  close(fd);
+  fd = open("mmapfile", 0);
+  if(read(fd, buf, 1) != 1 || buf[0] != 'b'){
+    printf(stdout, "mmap test: private write reached file\n");
+    exit();
+  }
+  // read() must refuse a buffer the process may not write.
+  p = mmap(0, 4096, PROT_READ, MAP_PRIVATE, fd, 0);
+  if(p == MAP_FAILED || read(fd, p, 1) != -1 || p[0] != 'b'){
+    printf(stdout, "mmap test: read into read-only file mapping\n");
+    exit();
+  }
+  munmap(p, 4096);
+  p = mmap(0, 4096, PROT_READ, MAP_PRIVATE|MAP_ANON, -1, 0);
+  if(p == MAP_FAILED || read(fd, p, 1) != -1 || p[0] != 0){
+    printf(stdout, "mmap test: read into read-only anon mapping\n");
+    exit();
+  }
+  munmap(p, 4096);
+  close(fd);
+  unlink("mmapfile");
+
+  p = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANON, -1, 0);
+  if(p == MAP_FAILED){
+    printf(stdout, "mmap test: anon map failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid == 0){
+    p[0] = 7;
+    exit();
+  }
+  wait();
+  if(p[0] != 7){
+    printf(stdout, "mmap test: shared page not shared\n");
+    exit();
+  }
+  munmap(p, 4096);
+  printf(stdout, "mmap test ok\n");
+}
+
+// does a segment found by name share pages with its creator?
+void
+shmtest(void)
+{
+  char *p, *q;
+
+  printf(stdout, "shm test\n");
+  p = shmget("shmtest", 4096);
+  if(p == (char*)-1){
+    printf(stdout, "shm test: shmget failed\n");
+    exit();
+  }
+  if(fork() == 0){
+    q = shmget("shmtest", 100);
+    if(q == (char*)-1)
+      exit();
+    q[10] = 42;
+    exit();
+  }
+  wait();
+  if(p[10] != 42){
+    printf(stdout, "shm test failed\n");
+    exit();
+  }
+  munmap(p, 4096);
+  printf(stdout, "shm test ok\n");
+}
+
+// spawn with file actions: echo into a file through a
+// redirection, and an exec failure that leaves no child.
+void
+spawntest(void)
+{
+  char *args[] = { "echo", "spawned", 0 };
+  char *bad[] = { "nosuchprog", 0 };
+  struct spawnact act[2];
+  char buf[16];
+  int fd, n;
+
+  printf(stdout, "spawn test\n");
+  act[0].op = SPAWN_OPEN;
+  act[0].fd = 1;
+  act[0].arg = O_CREATE|O_WRONLY;
+  act[0].path = "spawnout";
+  act[1].op = SPAWN_CLOSE;
+  act[1].fd = 0;
+  act[1].arg = 0;
+  act[1].path = 0;
+  if(spawn("echo", args, act, 2, -1) < 0){
+    printf(stdout, "spawn test: spawn failed\n");
+    exit();
+  }
+  if(wait() < 0){
+    printf(stdout, "spawn test: no child\n");
+    exit();
+  }
+  fd = open("spawnout", O_RDONLY);
+  n = read(fd, buf, sizeof(buf) - 1);
+  close(fd);
+  unlink("spawnout");
+  buf[n < 0 ? 0 : n] = 0;
+  if(strcmp(buf, "spawned\n") != 0){
+    printf(stdout, "spawn test: wrong output\n");
+    exit();
+  }
+  if(spawn("nosuchprog", bad, 0, 0, -1) >= 0 || wait() >= 0){
+    printf(stdout, "spawn test: bad program spawned\n");
+    exit();
+  }
+  printf(stdout, "spawn test ok\n");
+}
+
+// Threads share memory: each adds to a counter and writes
+// its own part of a buffer that the main thread then checks.
+#define NTHREAD 4
+volatile int tcount;
+char tbuf[NTHREAD][1000];
+
+void
+threadfn(void *arg)
+{
+  int i, n = (int)arg;
+
+  for(i = 0; i < sizeof(tbuf[n]); i++){
+    tbuf[n][i] = n;
+    __sync_fetch_and_add(&tcount, 1);
+  }
+}
+
+void
+threadtest(void)
+{
+  int i, j, tid[NTHREAD];
+
+  printf(stdout, "thread test\n");
+  tcount = 0;
+  for(i = 0; i < NTHREAD; i++){
+    if((tid[i] = thread_create(threadfn, (void*)i)) < 0){
+      printf(stdout, "thread test: thread_create failed\n");
+      exit();
+    }
+  }
+  for(i = NTHREAD-1; i >= 0; i--){
+    if(thread_join(tid[i]) != tid[i]){
+      printf(stdout, "thread test: thread_join failed\n");
+      exit();
+    }
+  }
+  if(thread_join(-1) != -1 || wait() != -1){
+    printf(stdout, "thread test: extra thread\n");
+    exit();
+  }
+  for(i = 0; i < NTHREAD; i++)
+    for(j = 0; j < sizeof(tbuf[i]); j++)
+      if(tbuf[i][j] != i){
+        printf(stdout, "thread test: bad memory\n");
+        exit();
+      }
+  if(tcount != NTHREAD*sizeof(tbuf[0])){
+    printf(stdout, "thread test: count %d\n", tcount);
+    exit();
+  }
+  printf(stdout, "thread test ok\n");
+}
+
+// Thread for racetest: read racefile into whatever page rbuf
+// points at, until racedone.
+volatile int racedone, racebad;
+char * volatile rbuf;
+
+void
+racereader(void *arg)
+{
+  int fd, n;
+
+  while(!racedone){
+    if((fd = open("racefile", 0)) < 0){
+      racebad = 1;
+      return;
+    }
+    n = read(fd, rbuf, 4096);
+    if(n != 4096 && n != -1)
+      racebad = 1;
+    close(fd);
+  }
+}
+
+// can one thread munmap a page while another reads into it,
+// without crashing the kernel?
+void
+racetest(void)
+{
+  int fd, i, j, tid;
+  char *p;
+
+  printf(stdout, "race test\n");
+  memset(buf, 'r', 4096);
+  fd = open("racefile", O_CREATE|O_RDWR);
+  if(fd < 0 || write(fd, buf, 4096) != 4096){
+    printf(stdout, "race test: create failed\n");
+    exit();
+  }
+  close(fd);
+  racedone = racebad = 0;
+  rbuf = buf;
+  if((tid = thread_create(racereader, 0)) < 0){
+    printf(stdout, "race test: thread_create failed\n");
+    exit();
+  }
+  for(i = 0; i < 200; i++){
+    p = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    if(p == MAP_FAILED){
+      printf(stdout, "race test: mmap failed\n");
+      exit();
+    }
+    rbuf = p;
+    for(j = 0; j < 1000*(i%10); j++)  // unmap at different points
+      ;
+    if(munmap(p, 4096) < 0){
+      printf(stdout, "race test: munmap failed\n");
+      exit();
+    }
+  }
+  racedone = 1;
+  if(thread_join(tid) != tid || racebad){
+    printf(stdout, "race test: read failed\n");
+    exit();
+  }
+  unlink("racefile");
+  printf(stdout, "race test ok\n");
+}
+
+// Threads for futextest. fwaiter waits once on fword and counts
+// itself woken; mworker adds to mcount under mlock; producer
+// hands the numbers 1..NITEM to the main thread one at a time.
+#define NITEM 100
+volatile uint fword;
+volatile int fready, fwoken, mcount, item;
+struct mutex mlock;
+struct cond notfull, notempty;
+
+void
+fwaiter(void *arg)
+{
+  __sync_fetch_and_add(&fready, 1);
+  futex(&fword, FUTEX_WAIT, 0);
+  __sync_fetch_and_add(&fwoken, 1);
+}
+
+void
+mworker(void *arg)
+{
+  int i, j, n;
+
+  for(i = 0; i < 1000; i++){
+    mutex_lock(&mlock);
+    n = mcount;
+    for(j = 0; j < 50; j++)  // widen the race the mutex prevents
+      ;
+    mcount = n + 1;
+    mutex_unlock(&mlock);
+  }
+}
+
+void
+producer(void *arg)
+{
+  int i;
+
+  for(i = 1; i <= NITEM; i++){
+    mutex_lock(&mlock);
+    while(item != 0)
+      cond_wait(&notfull, &mlock);
+    item = i;
+    cond_signal(&notempty);
+    mutex_unlock(&mlock);
+  }
+}
+
+// does FUTEX_WAIT refuse a stale value, does FUTEX_WAKE wake
+// no more than it is asked to, and do mutexes and condition
+// variables hand off between threads?
+void
+futextest(void)
+{
+  int i, n, r, tid[NTHREAD];
+
+  printf(stdout, "futex test\n");
+
+  fword = 1;
+  if(futex(&fword, FUTEX_WAIT, 0) != -1 ||
+     futex((uint*)((char*)&fword + 1), FUTEX_WAIT, 1) != -1){
+    printf(stdout, "futex test: wait on a stale value slept\n");
+    exit();
+  }
+  if(futex(&fword, FUTEX_WAKE, 5) != 0){
+    printf(stdout, "futex test: woke a sleeper that is not there\n");
+    exit();
+  }
+
+  // Wake two of NTHREAD waiters, then the rest. A waiter that
+  // has not gone to sleep yet is not counted by FUTEX_WAKE.
+  fword = 0;
+  fready = fwoken = 0;
+  for(i = 0; i < NTHREAD; i++){
+    if((tid[i] = thread_create(fwaiter, 0)) < 0){
+      printf(stdout, "futex test: thread_create failed\n");
+      exit();
+    }
+  }
+  while(fready < NTHREAD)
+    sleep(1);
+  for(n = 0; n < 2; n += r){
+    if((r = futex(&fword, FUTEX_WAKE, 2 - n)) < 0 || r > 2 - n){
+      printf(stdout, "futex test: wake 2 returned %d\n", r);
+      exit();
+    }
+    sleep(1);
+  }
+  while(fwoken < 2)
+    sleep(1);
+  sleep(10);
+  if(fwoken != 2){
+    printf(stdout, "futex test: wake 2 woke %d\n", fwoken);
+    exit();
+  }
+  fword = 1;
+  futex(&fword, FUTEX_WAKE, NTHREAD);
+  for(i = 0; i < NTHREAD; i++){
+    if(thread_join(tid[i]) != tid[i]){
+      printf(stdout, "futex test: thread_join failed\n");
+      exit();
+    }
+  }
+
+  // Contended mutex.
+  mutex_init(&mlock);
+  mcount = 0;
+  for(i = 0; i < NTHREAD; i++){
+    if((tid[i] = thread_create(mworker, 0)) < 0){
+      printf(stdout, "futex test: thread_create failed\n");
+      exit();
+    }
+  }
+  for(i = 0; i < NTHREAD; i++)
+    thread_join(tid[i]);
+  if(mcount != NTHREAD*1000){
+    printf(stdout, "futex test: mutex count %d\n", mcount);
+    exit();
+  }
+  mutex_lock(&mlock);
+  if(mutex_trylock(&mlock) != -1){
+    printf(stdout, "futex test: trylock took a held mutex\n");
+    exit();
+  }
+  mutex_unlock(&mlock);
+
+  // Condition variable handoff, one item at a time.
+  cond_init(&notfull);
+  cond_init(&notempty);
+  item = 0;
+  if((tid[0] = thread_create(producer, 0)) < 0){
+    printf(stdout, "futex test: thread_create failed\n");
+    exit();
+  }
+  for(i = 1; i <= NITEM; i++){
+    mutex_lock(&mlock);
+    while(item == 0)
+      cond_wait(&notempty, &mlock);
+    n = item;
+    item = 0;
+    cond_signal(&notfull);
+    mutex_unlock(&mlock);
+    if(n != i){
+      printf(stdout, "futex test: got item %d, want %d\n", n, i);
+      exit();
+    }
+  }
+  thread_join(tid[0]);
+  printf(stdout, "futex test ok\n");
+}
+
+// Return the memory use of the container called name,
+// read into ms, or 0 if there is no such container.
+struct contmem*
+contmem(struct memstats *ms, char *name)
+{
+  int i;
+
+  if(memstats(ms, 0, 0) < 0)
+    return 0;
+  for(i = 0; i < ms->ncont; i++)
+    if(strcmp(ms->cont[i].name, name) == 0)
+      return &ms->cont[i];
+  return 0;
+}
+
+// does a container's memory limit stop allocation there, and
+// do mem and peakmem tell what its processes used?
+#define CLIMITKB 512
+void
+climittest(void)
+{
+  static struct memstats ms;
+  struct contmem *cm;
+  int cid, pid, fds[2], n, i;
+
+  printf(stdout, "climit test\n");
+  if(mkdir("/climittest") < 0 || ccreate("/climittest") < 0 ||
+     climit("climittest", CLIMITKB) < 0){
+    printf(stdout, "climit test: cannot make container\n");
+    exit();
+  }
+  if((cid = cstart("climittest")) < 0 || pipe(fds) < 0){
+    printf(stdout, "climit test: cannot start container\n");
+    exit();
+  }
+  pid = cfork(cid);
+  if(pid < 0){
+    printf(stdout, "climit test: cfork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    close(fds[0]);
+    for(n = 0; n < 2*CLIMITKB/4; n++)
+      if(sbrk(4096) == (char*)-1)
+        break;
+    write(fds[1], &n, sizeof(n));
+    exit();
+  }
+  close(fds[1]);
+  if(read(fds[0], &n, sizeof(n)) != sizeof(n)){
+    printf(stdout, "climit test: no count from child\n");
+    exit();
+  }
+  close(fds[0]);
+  if(n == 2*CLIMITKB/4){
+    printf(stdout, "climit test: allocated past the limit\n");
+    exit();
+  }
+
+  // The child belongs to init, which frees its memory.
+  for(i = 0; i < 100; i++){
+    if((cm = contmem(&ms, "climittest")) == 0 || cm->nproc == 0)
+      break;
+    sleep(1);
+  }
+  if(cm == 0 || cm->nproc != 0){
+    printf(stdout, "climit test: child did not go away\n");
+    exit();
+  }
+  if(cm->memlimit != CLIMITKB/4 || cm->peakmem != cm->memlimit || cm->mem != 0){
+    printf(stdout, "climit test: limit %d peak %d mem %d pages\n",
+           cm->memlimit, cm->peakmem, cm->mem);
+    exit();
+  }
+  cstop("climittest");
+  unlink("/climittest");
+  printf(stdout, "climit test ok\n");
+}
+
+// Fill n pages at p with a pattern made from seed, or if check
+// is set, count the pages that do not hold it.
+int
+pattern(char *p, int n, int seed, int check)
+{
+  int i, bad, *w;
+
+  bad = 0;
+  for(i = 0; i < n; i++){
+    w = (int*)(p + i*4096);
+    if(!check){
+      w[0] = seed + i;
+      w[1023] = ~(seed + i);
+    } else if(w[0] != seed + i || w[1023] != ~(seed + i))
+      bad++;
+  }
+  return bad;
+}
+
+// Grow the heap by n pages, 1MB at a time so that none of it
+// gets a 4MB page, which is never swapped. Returns the start,
+// or 0 if sbrk fails.
+char*
+growpages(int n)
+{
+  char *start;
+  int step;
+
+  start = sbrk(0);
+  for(; n > 0; n -= step){
+    step = n < 256 ? n : 256;
+    if(sbrk(step*4096) == (char*)-1)
+      return 0;
+  }
+  return start;
+}
+
+// The process that ckpttest saves, run as "systests ckptchild"
+// so that its image is small. It fills memory and opens a file,
+// says it is ready, and waits for go, which only the restored
+// copy sees. That copy checks its memory, writes through both
+// descriptors, and leaves the outcome in result.
+void
+ckptchild(void)
+{
+  char *heap;
+  int fd, fd2, bad;
+
+  heap = sbrk(4096);
+  pattern(buf, 2, 11, 0);
+  pattern(heap, 1, 22, 0);
+  if((fd = open("data", O_CREATE|O_RDWR)) < 0 ||
+     write(fd, "0123456789", 10) != 10 || (fd2 = dup(fd)) < 0)
+    exit();
+  bad = open("ready", O_CREATE|O_RDWR);
+  write(bad, "r", 1);
+  close(bad);
+  while((bad = open("go", O_RDONLY)) < 0)
+    sleep(1);
+  close(bad);
+
+  bad = pattern(buf, 2, 11, 1) + pattern(heap, 1, 22, 1);
+  if(write(fd, "A", 1) != 1 || write(fd2, "B", 1) != 1)
+    bad++;
+  fd = open("result", O_CREATE|O_RDWR);
+  write(fd, bad ? "bad" : "ok", bad ? 3 : 2);
+  close(fd);
+  exit();
+}
+
+// Wait up to 10 seconds for path to exist and have something
+// in it, and read it into b. Returns the number of bytes read.
+int
+waitfile(char *path, char *b, int n)
+{
+  int fd, i, r;
+
+  for(i = 0; i < 100; i++){
+    if((fd = open(path, O_RDONLY)) >= 0){
+      r = read(fd, b, n);
+      close(fd);
+      if(r > 0)
+        return r;
+    }
+    sleep(10);
+  }
+  return 0;
+}
+
+// does a process saved by ccheckpoint come back from crestore,
+// in another container, with its memory, its file offsets and
+// its shared descriptors? The restoring container's root holds
+// the saved one's, so the files are within its reach; a
+// container whose root does not must not get them.
+void
+ckpttest(void)
+{
+  char *args[] = { "systests", "ckptchild", 0 };
+  char b[16];
+  int cid, n;
+
+  printf(stdout, "checkpoint test\n");
+  if(mkdir("/ckptload") < 0 || ccreate("/ckptload") < 0 ||
+     mkdir("/ckptload/ckptsave") < 0 || ccreate("/ckptload/ckptsave") < 0 ||
+     mkdir("/ckptother") < 0 || ccreate("/ckptother") < 0 ||
+     (cid = cstart("ckptsave")) < 0){
+    printf(stdout, "checkpoint test: cannot make containers\n");
+    exit();
+  }
+  if(spawn("systests", args, 0, 0, cid) < 0){
+    printf(stdout, "checkpoint test: spawn failed\n");
+    exit();
+  }
+  if(waitfile("/ckptload/ckptsave/ready", b, sizeof(b)) != 1){
+    printf(stdout, "checkpoint test: child not ready\n");
+    exit();
+  }
+
+  if(cpause("ckptsave") < 0){
+    printf(stdout, "checkpoint test: cpause failed\n");
+    exit();
+  }
+  if((n = ccheckpoint("ckptsave", "/ckptsave.img")) != 1){
+    printf(stdout, "checkpoint test: saved %d processes%s\n", n,
+           n == CKPT_TOOBIG ? ", image too big" : "");
+    exit();
+  }
+  if(cstop("ckptsave") < 0){
+    printf(stdout, "checkpoint test: cstop failed\n");
+    exit();
+  }
+  if(crestore("ckptother", "/ckptsave.img") != -1){
+    printf(stdout, "checkpoint test: restored files outside the root\n");
+    exit();
+  }
+  cstop("ckptother");
+  if(crestore("ckptload", "/ckptsave.img") != 1){
+    printf(stdout, "checkpoint test: restore failed\n");
+    exit();
+  }
+  close(open("/ckptload/ckptsave/go", O_CREATE|O_RDWR));
+
+  n = waitfile("/ckptload/ckptsave/result", b, sizeof(b)-1);
+  b[n] = 0;
+  if(strcmp(b, "ok") != 0){
+    printf(stdout, "checkpoint test: restored process failed\n");
+    exit();
+  }
+  // Written at the saved offset, through one shared file.
+  n = waitfile("/ckptload/ckptsave/data", b, sizeof(b)-1);
+  b[n] = 0;
+  if(strcmp(b, "0123456789AB") != 0){
+    printf(stdout, "checkpoint test: restored descriptors wrong\n");
+    exit();
+  }
+
+  cstop("ckptload");
+  unlink("/ckptload/ckptsave/data");
+  unlink("/ckptload/ckptsave/ready");
+  unlink("/ckptload/ckptsave/go");
+  unlink("/ckptload/ckptsave/result");
+  unlink("/ckptload/ckptsave");
+  unlink("/ckptload");
+  unlink("/ckptother");
+  unlink("/ckptsave.img");
+  printf(stdout, "checkpoint test ok\n");
+}
+
+// are pages written to swap read back unchanged? Children fill
+// half of free memory and spin, out of any system call, so that
+// their pages can be swapped out; then the parent asks for more
+// than the rest, and the children check their pages.
+#define NSWAPKID 4     // more than the CPUs, so some are runnable
+#define SWAPOVER 256   // pages asked for beyond free memory
+void
+swaptest(void)
+{
+  static struct memstats ms;
+  volatile int *state;
+  int pids[NSWAPKID], fds[2], i, n, each, bad;
+  char *p;
+
+  printf(stdout, "swap test\n");
+  state = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANON, -1, 0);
+  if(state == MAP_FAILED || pipe(fds) < 0 || memstats(&ms, 0, 0) < 0){
+    printf(stdout, "swap test: setup failed\n");
+    exit();
+  }
+  each = ms.free / 2 / NSWAPKID;
+  state[0] = 0;  // children filled
+  state[1] = 0;  // go and check
+  state[2] = 0;  // a child's sbrk failed
+  for(i = 0; i < NSWAPKID; i++){
+    if((pids[i] = fork()) == 0){
+      close(fds[0]);
+      if((p = growpages(each)) == 0)
+        state[2] = 1;
+      else
+        pattern(p, each, i << 20, 0);
+      __sync_fetch_and_add(&state[0], 1);
+      while(state[1] == 0)
+        ;
+      bad = pattern(p, each, i << 20, 1);
+      write(fds[1], &bad, sizeof(bad));
+      exit();
+    }
+  }
+  close(fds[1]);
+  while(state[0] < NSWAPKID)
+    sleep(1);
+  n = ms.free - each*NSWAPKID + SWAPOVER;
+  if(state[2] || (p = growpages(n)) == 0){
+    printf(stdout, "swap test: sbrk failed\n");
+    for(i = 0; i < NSWAPKID; i++)
+      kill(pids[i]);
+    exit();
+  }
+  pattern(p, n, 7 << 20, 0);
+  state[1] = 1;
+  for(i = 0; i < NSWAPKID; i++){
+    if(read(fds[0], &bad, sizeof(bad)) != sizeof(bad) || bad != 0){
+      printf(stdout, "swap test: child lost pages\n");
+      exit();
+    }
+    wait();
+  }
+  close(fds[0]);
+  if((bad = pattern(p, n, 7 << 20, 1)) != 0){
+    printf(stdout, "swap test: lost %d pages\n", bad);
+    exit();
+  }
+  sbrk(-n*4096);
+  munmap((void*)state, 4096);
+  printf(stdout, "swap test ok\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  if(argc > 1 && strcmp(argv[1], "ckptchild") == 0)
+    ckptchild();
+  printf(1, "systests starting\n");
+
+  demandtest();
+  mmaptest();
+  shmtest();
+  spawntest();
+  threadtest();
+  racetest();
+  futextest();
+  climittest();
+  ckpttest();
+  swaptest();  // last: it runs memory out
+
+  printf(1, "ALL SYSTEM TESTS PASSED\n");
+  exit();
+}
@@ -77,9 +77,23 @@ trap(struct trapframe *tf)
             cpuid(), tf->cs, tf->eip);
     lapiceoi();
     break;
+  case T_TLBFLUSH:
+    tlbflushintr();
+    lapiceoi();
+    break;
+  case T_PGFLT:
+    // Demand-paged or copy-on-write memory; see vm.c.
+    if(pagefault(rcr2(), tf->err) == 0)
+      break;
+    // fall through
 
   //PAGEBREAK: 13
   default:
+    if(virtioirq >= 0 && tf->trapno == T_IRQ0 + virtioirq){
+      virtiointr();
+      lapiceoi();
+      break;
+    }
     if(myproc() == 0 || (tf->cs&3) == 0){
       // In kernel, it must be our mistake.
       cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
@@ -2,89 +2,270 @@
 #include "stat.h"
 #include "user.h"
 #include "param.h"
+#include "mman.h"
 
-// Memory allocator by Kernighan and Ritchie,
-// The C programming Language, 2nd ed.  Section 8.7.
+// Memory allocator.
+//
+// Small requests, up to MAXSMALL bytes, are rounded up to a power
+// of two size class. Each class carves its blocks out of pages of
+// its own. A page keeps its free blocks on a list in its header,
+// and each class keeps a list of its pages that have free blocks,
+// so allocating or freeing a small block takes constant time. A
+// page whose blocks are all free goes back to the free runs.
+//
+// Larger requests get a run of whole pages from the heap. Free runs
+// are kept in address order and merged with their neighbors, and a
+// large free run at the end of the heap goes back to the kernel with
+// sbrk(). Requests of MAPMIN bytes or more are mapped with mmap()
+// and unmapped by free().
+//
+// Every page of small blocks and every run starts with a header,
+// which free() finds by rounding the address down to a page.
+//
+// Not safe to call from two threads at once.
 
-typedef long Align;
+#define PGSIZE    4096
+#define HDRSIZE   32                // header, rounded up to keep blocks aligned
+#define MINSMALL  16                // smallest size class
+#define NCLASS    7                 // classes 16, 32, ..., 1024 bytes
+#define MAXSMALL  (MINSMALL << (NCLASS-1))
+#define MAPMIN    (64*1024)         // mmap requests this big
+#define MINCORE   8                 // pages to ask sbrk() for at least
+#define TRIM      32                // pages free at the top before shrinking
 
-union header {
-  struct {
-    union header *ptr;
-    uint size;
-  } s;
-  Align x;
+// What a page holds.
+#define PSMALL  1   // blocks of one size class
+#define PRUN    2   // the start of an allocated run
+#define PFREE   3   // the start of a free run
+#define PMAP    4   // the start of an mmap()ed run
+
+struct block {
+  struct block *next;
 };
 
-typedef union header Header;
+struct page {
+  ushort kind;
+  ushort class;          // PSMALL: the size class
+  uint npages;           // runs: length in pages
+  uint nfree;            // PSMALL: number of free blocks
+  struct block *free;    // PSMALL: the freed blocks
+  char *fresh;           // PSMALL: the blocks not handed out yet start here
+  struct page *next;     // PSMALL: next page of the class with free
+                         // blocks; PFREE: next free run
+  struct page *prev;     // PSMALL: previous page of the class
+};
 
-static Header base;
-static Header *freep;
+static struct page *partial[NCLASS];  // pages with free blocks, by class
+static struct page *runs;             // free runs, in address order
+static char *heapend;                 // end of the heap as of the last sbrk()
 
-void
-free(void *ap)
+static int
+sizeclass(uint nbytes)
 {
-  Header *bp, *p;
-
-  bp = (Header*)ap - 1;
-  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
-    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
-      break;
-  if(bp + bp->s.size == p->s.ptr){
-    bp->s.size += p->s.ptr->s.size;
-    bp->s.ptr = p->s.ptr->s.ptr;
-  } else
-    bp->s.ptr = p->s.ptr;
-  if(p + p->s.size == bp){
-    p->s.size += bp->s.size;
-    p->s.ptr = bp->s.ptr;
-  } else
-    p->s.ptr = bp;
-  freep = p;
+  int c;
+
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+    ;
+  return c;
 }
 
-static Header*
-morecore(uint nu)
+// Blocks of class c that fit in a page.
+static uint
+nblocks(int c)
 {
-  char *p;
-  Header *hp;
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+}
 
-  if(nu < 4096)
-    nu = 4096;
-  p = sbrk(nu * sizeof(Header));
-  if(p == (char*)-1)
-    return 0;
-  hp = (Header*)p;
-  hp->s.size = nu;
-  free((void*)(hp + 1));
-  return freep;
+// Give the n pages at r back to the free runs, merging them with
+// adjacent runs, and shrink the heap if the end of it is free.
+static void
+runfree(struct page *r, uint n)
+{
+  struct page **pp, *prev;
+
+  r->kind = PFREE;
+  r->npages = n;
+  prev = 0;
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+    prev = *pp;
+  r->next = *pp;
+  *pp = r;
+
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+    r->npages += r->next->npages;
+    r->next = r->next->next;
+  }
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+    prev->npages += r->npages;
+    prev->next = r->next;
+    r = prev;
+    pp = &runs;
+    while(*pp != r)
+      pp = &(*pp)->next;
+  }
+
+  if(r->next == 0 && r->npages >= TRIM &&
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+    *pp = 0;
+    sbrk(-(int)(r->npages*PGSIZE));
+    heapend = (char*)r;
+  }
 }
 
-void*
-malloc(uint nbytes)
+// Get n pages from the heap.
+static struct page*
+morecore(uint n)
 {
-  Header *p, *prevp;
-  uint nunits;
+  char *brk;
+  uint pad, m;
+  struct page *r;
 
-  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
-  if((prevp = freep) == 0){
-    base.s.ptr = freep = prevp = &base;
-    base.s.size = 0;
+  m = n < MINCORE ? MINCORE : n;
+  brk = sbrk(0);
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+    m = n;
+    if(sbrk(pad + m*PGSIZE) == (char*)-1)
+      return 0;
   }
-  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
-    if(p->s.size >= nunits){
-      if(p->s.size == nunits)
-        prevp->s.ptr = p->s.ptr;
-      else {
-        p->s.size -= nunits;
-        p += p->s.size;
-        p->s.size = nunits;
-      }
-      freep = prevp;
-      return (void*)(p + 1);
+  r = (struct page*)(brk + pad);
+  heapend = (char*)r + m*PGSIZE;
+  if(m > n)
+    runfree((struct page*)((char*)r + n*PGSIZE), m - n);
+  r->npages = n;
+  return r;
+}
+
+// Take a run of n pages from the start of the first free run
+// long enough, which keeps the end of the heap free to trim.
+static struct page*
+runalloc(uint n)
+{
+  struct page **pp, *r, *rest;
+
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+    if(r->npages < n)
+      continue;
+    if(r->npages == n){
+      *pp = r->next;
+    } else {
+      rest = (struct page*)((char*)r + n*PGSIZE);
+      rest->kind = PFREE;
+      rest->npages = r->npages - n;
+      rest->next = r->next;
+      *pp = rest;
+      r->npages = n;
     }
-    if(p == freep)
-      if((p = morecore(nunits)) == 0)
-        return 0;
+    return r;
+  }
+  return morecore(n);
+}
+
+static void
+unlinkpage(struct page *p)
+{
+  if(p->prev)
+    p->prev->next = p->next;
+  else
+    partial[p->class] = p->next;
+  if(p->next)
+    p->next->prev = p->prev;
+}
+
+static void
+linkpage(struct page *p)
+{
+  p->prev = 0;
+  p->next = partial[p->class];
+  if(p->next)
+    p->next->prev = p;
+  partial[p->class] = p;
+}
+
+static void*
+smallalloc(int c)
+{
+  struct page *p;
+  struct block *b;
+
+  if((p = partial[c]) == 0){
+    if((p = runalloc(1)) == 0)
+      return 0;
+    p->kind = PSMALL;
+    p->class = c;
+    p->free = 0;
+    p->fresh = (char*)p + HDRSIZE;
+    p->nfree = nblocks(c);
+    linkpage(p);
+  }
+  if((b = p->free) != 0){
+    p->free = b->next;
+  } else {
+    b = (struct block*)p->fresh;
+    p->fresh += MINSMALL << c;
+  }
+  if(--p->nfree == 0)
+    unlinkpage(p);
+  return b;
+}
+
+static void
+smallfree(struct page *p, void *ap)
+{
+  struct block *b = ap;
+
+  b->next = p->free;
+  p->free = b;
+  if(p->nfree++ == 0)
+    linkpage(p);
+  if(p->nfree == nblocks(p->class)){
+    unlinkpage(p);
+    runfree(p, 1);
+  }
+}
+
+void
+free(void *ap)
+{
+  struct page *p;
+
+  if(ap == 0)
+    return;
+  p = (struct page*)((uint)ap & ~(PGSIZE-1));
+  switch(p->kind){
+  case PSMALL:
+    smallfree(p, ap);
+    break;
+  case PRUN:
+    runfree(p, p->npages);
+    break;
+  case PMAP:
+    munmap(p, p->npages*PGSIZE);
+    break;
+  }
+}
+
+void*
+malloc(uint nbytes)
+{
+  struct page *p;
+  uint n;
+
+  if(nbytes <= MAXSMALL)
+    return smallalloc(sizeclass(nbytes));
+  if(nbytes > 0x7fffffff)
+    return 0;
+  n = (nbytes + HDRSIZE + PGSIZE-1) / PGSIZE;
+  if(nbytes >= MAPMIN){
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    if(p == MAP_FAILED)
+      return 0;
+    p->kind = PMAP;
+  } else {
+    if((p = runalloc(n)) == 0)
+      return 0;
+    p->kind = PRUN;
   }
+  p->npages = n;
+  return (char*)p + HDRSIZE;
 }
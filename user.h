@@ -1,5 +1,10 @@
 struct stat;
 struct rtcdate;
+struct spawnact;
+struct mutex;
+struct cond;
+struct memstats;
+struct procmem;
 
 // system calls
 int fork(void);
@@ -32,6 +37,18 @@ int cstart(char*);
 int cpause(char*);
 int cresume(char*);
 int cstop(char*);
+int climit(char*, int); // Limit a container's memory, in KB
+int ccheckpoint(char*, char*); // Save a paused container's processes to a file
+int crestore(char*, char*); // Start processes saved by ccheckpoint in a container
+int czygote(char*, char*, int); // Keep processes of a program loaded in a container
+int spawn(char*, char**, struct spawnact*, int, int); // Start a program in a new process
+int clone(void(*)(void*), void*, void*); // Start a thread on a stack
+int join(int, void**); // Wait for a thread, and get back its stack
+int futex(volatile uint*, int, int); // Sleep on or wake a user word
+int memstats(struct memstats*, struct procmem*, int); // Memory use; see memstats.h
+void* mmap(void*, uint, int, int, int, int);
+int munmap(void*, uint);
+void* shmget(char*, uint);
 
 // ulib.c
 int stat(const char*, struct stat*);
@@ -46,3 +63,17 @@ void* memset(void*, int, uint);
 void* malloc(uint);
 void free(void*);
 int atoi(const char*);
+
+// uthread.c
+int thread_create(void(*)(void*), void*);
+int thread_join(int);
+
+// usync.c; see usync.h
+void mutex_init(struct mutex*);
+void mutex_lock(struct mutex*);
+int mutex_trylock(struct mutex*);
+void mutex_unlock(struct mutex*);
+void cond_init(struct cond*);
+void cond_wait(struct cond*, struct mutex*);
+void cond_signal(struct cond*);
+void cond_broadcast(struct cond*);
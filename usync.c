@@ -0,0 +1,87 @@
+// Mutexes and condition variables for threads, or for processes
+// sharing memory, on top of futex(). Locking and unlocking a
+// mutex that no one else wants stays in user space.
+
+#include "types.h"
+#include "user.h"
+#include "usync.h"
+#include "futex.h"
+
+// Mutex states.
+#define UNLOCKED  0
+#define LOCKED    1   // no one is waiting
+#define CONTENDED 2   // someone may be sleeping in futex()
+
+void
+mutex_init(struct mutex *m)
+{
+  m->state = UNLOCKED;
+}
+
+void
+mutex_lock(struct mutex *m)
+{
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, UNLOCKED, LOCKED)) == UNLOCKED)
+    return;
+  // Mark the mutex contended, so that the holder wakes us
+  // when it unlocks, and sleep until it is free.
+  if(c != CONTENDED)
+    c = __sync_lock_test_and_set(&m->state, CONTENDED);
+  while(c != UNLOCKED){
+    futex(&m->state, FUTEX_WAIT, CONTENDED);
+    c = __sync_lock_test_and_set(&m->state, CONTENDED);
+  }
+}
+
+// Returns 0 if it got the mutex, -1 if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  if(__sync_val_compare_and_swap(&m->state, UNLOCKED, LOCKED) == UNLOCKED)
+    return 0;
+  return -1;
+}
+
+void
+mutex_unlock(struct mutex *m)
+{
+  if(__sync_fetch_and_sub(&m->state, 1) != LOCKED){
+    m->state = UNLOCKED;
+    futex(&m->state, FUTEX_WAKE, 1);
+  }
+}
+
+void
+cond_init(struct cond *c)
+{
+  c->seq = 0;
+}
+
+// Unlock m, wait for a signal, and lock m again. As with any
+// condition variable, the caller should recheck its condition.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  uint seq;
+
+  seq = c->seq;
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+  mutex_lock(m);
+}
+
+void
+cond_signal(struct cond *c)
+{
+  __sync_fetch_and_add(&c->seq, 1);
+  futex(&c->seq, FUTEX_WAKE, 1);
+}
+
+void
+cond_broadcast(struct cond *c)
+{
+  __sync_fetch_and_add(&c->seq, 1);
+  futex(&c->seq, FUTEX_WAKE, 0x7fffffff);
+}
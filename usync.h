@@ -0,0 +1,9 @@
+// Mutexes and condition variables; see usync.c.
+
+struct mutex {
+  volatile uint state;
+};
+
+struct cond {
+  volatile uint seq;
+};
@@ -0,0 +1,54 @@
+// Threads, on top of clone() and join().
+
+#include "types.h"
+#include "user.h"
+
+#define TSTACK 8192   // bytes of stack per thread
+
+// What a new thread runs, kept at the top of its stack.
+struct tstart {
+  void (*fn)(void*);
+  void *arg;
+};
+
+static void
+tmain(void *a)
+{
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+  exit();
+}
+
+// Start a thread running fn(arg), and return its id for
+// thread_join, or -1. A thread that returns from fn exits.
+// Uses malloc, which only one thread may call at a time.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+  char *stack;
+  struct tstart *t;
+  int tid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    return -1;
+  t = (struct tstart*)(stack + TSTACK) - 1;
+  t->fn = fn;
+  t->arg = arg;
+  if((tid = clone(tmain, t, t)) < 0)
+    free(stack);
+  return tid;
+}
+
+// Wait for the thread tid to exit, or for any thread if tid
+// is -1, and free its stack. Returns the thread's id, or -1
+// if there is no such thread.
+int
+thread_join(int tid)
+{
+  void *top;
+
+  if((tid = join(tid, &top)) >= 0)
+    free((char*)top + sizeof(struct tstart) - TSTACK);
+  return tid;
+}
@@ -0,0 +1,278 @@
+// Virtio block device driver, for the legacy PCI transport.
+//
+// If QEMU has a virtio-blk device (see make qemu-virtio), it is
+// the root disk in place of IDE disk 1: iderw hands requests for
+// ROOTDEV to virtiorw. Unlike the IDE disk it takes many requests
+// at once. Each request is a chain of three descriptors in the
+// device's one virtqueue -- a header naming the sector, the
+// buffer's data, and a status byte the device writes -- put on
+// the available ring. The device puts finished requests on the
+// used ring and interrupts, and virtiointr completes them.
+// virtio.lock protects the queue and the driver's state.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+
+// Legacy virtio PCI registers, from the I/O base in BAR0.
+#define VIRTIO_FEATURES   0x00  // device features
+#define VIRTIO_GFEATURES  0x04  // driver features
+#define VIRTIO_QADDR      0x08  // page number of the queue
+#define VIRTIO_QSIZE      0x0c
+#define VIRTIO_QSEL       0x0e
+#define VIRTIO_QNOTIFY    0x10
+#define VIRTIO_STATUS     0x12
+#define VIRTIO_ISR        0x13
+#define VIRTIO_CAPACITY   0x14  // virtio-blk: sectors, 64 bits
+
+// Device status bits.
+#define VIRTIO_ACK        1
+#define VIRTIO_DRIVER     2
+#define VIRTIO_DRIVER_OK  4
+
+#define VIRTQ_NEXT        1     // descriptor flags
+#define VIRTQ_WRITE       2     // device writes the buffer
+
+#define VIRTIO_BLK_IN     0     // read
+#define VIRTIO_BLK_OUT    1     // write
+
+#define NDESC             256   // largest queue this driver takes
+#define SECTOR_SIZE       512
+
+struct vdesc {
+  uint64 addr;
+  uint len;
+  ushort flags;
+  ushort next;
+};
+
+struct vavail {
+  ushort flags;
+  ushort idx;
+  ushort ring[];
+};
+
+struct vusedelem {
+  uint id;
+  uint len;
+};
+
+struct vused {
+  ushort flags;
+  ushort idx;
+  struct vusedelem ring[];
+};
+
+struct vblkhdr {
+  uint type;
+  uint reserved;
+  uint64 sector;
+};
+
+// Memory for the queue, laid out for the legacy transport:
+// descriptors, then the available ring, then the used ring
+// on the next page boundary.
+static char vqmem[3*PGSIZE] __attribute__((aligned(PGSIZE)));
+
+int virtioirq = -1;
+
+struct {
+  struct spinlock lock;
+  ushort base;              // I/O base; 0 if there is no device
+  uint64 capacity;          // sectors
+  uint n;                   // queue size
+  struct vdesc *desc;
+  struct vavail *avail;
+  struct vused *used;
+  ushort usedidx;           // used ring entries seen so far
+  char free[NDESC];         // descriptor is free
+  int nfree;
+  struct {                  // by the request's first descriptor
+    struct buf *b;
+    struct vblkhdr hdr;
+    uchar status;
+  } req[NDESC];
+} virtio;
+
+// Find and set up the virtio-blk device, if there is one.
+void
+virtioinit(void)
+{
+  int f;
+  uint i, n, availsz;
+
+  initlock(&virtio.lock, "virtio");
+  if((f = pcifindid(0x1af4, 0x1001)) < 0)  // legacy virtio-blk
+    return;
+  pciwrite(f, 0x04, pciread(f, 0x04) | 0x5);  // I/O space, bus master
+  virtio.base = pciread(f, 0x10) & ~3;
+
+  outb(virtio.base + VIRTIO_STATUS, 0);  // reset
+  outb(virtio.base + VIRTIO_STATUS, VIRTIO_ACK);
+  outb(virtio.base + VIRTIO_STATUS, VIRTIO_ACK | VIRTIO_DRIVER);
+  outl(virtio.base + VIRTIO_GFEATURES, 0);  // none needed
+
+  outw(virtio.base + VIRTIO_QSEL, 0);
+  n = inw(virtio.base + VIRTIO_QSIZE);
+  availsz = sizeof(struct vavail) + (n+1) * sizeof(ushort);
+  if(n == 0 || n > NDESC ||
+     PGROUNDUP(n*sizeof(struct vdesc) + availsz) +
+     sizeof(struct vused) + n*sizeof(struct vusedelem) > sizeof(vqmem)){
+    cprintf("virtio: queue size %d not supported\n", n);
+    virtio.base = 0;
+    return;
+  }
+  virtio.n = n;
+  virtio.desc = (struct vdesc*)vqmem;
+  virtio.avail = (struct vavail*)(vqmem + n*sizeof(struct vdesc));
+  virtio.used = (struct vused*)(vqmem + PGROUNDUP(n*sizeof(struct vdesc) + availsz));
+  memset(vqmem, 0, sizeof(vqmem));
+  for(i = 0; i < n; i++)
+    virtio.free[i] = 1;
+  virtio.nfree = n;
+  outl(virtio.base + VIRTIO_QADDR, V2P(vqmem) / PGSIZE);
+
+  virtio.capacity = inl(virtio.base + VIRTIO_CAPACITY) |
+                    (uint64)inl(virtio.base + VIRTIO_CAPACITY + 4) << 32;
+  virtioirq = pciread(f, 0x3c) & 0xff;
+  ioapicenable(virtioirq, ncpu - 1);
+  outb(virtio.base + VIRTIO_STATUS,
+       VIRTIO_ACK | VIRTIO_DRIVER | VIRTIO_DRIVER_OK);
+  cprintf("virtio: disk of %d sectors at irq %d\n",
+          (uint)virtio.capacity, virtioirq);
+}
+
+// Take a free descriptor. Caller holds virtio.lock and has
+// checked there is one.
+static int
+vdalloc(void)
+{
+  int i;
+
+  for(i = 0; i < virtio.n; i++){
+    if(virtio.free[i]){
+      virtio.free[i] = 0;
+      virtio.nfree--;
+      return i;
+    }
+  }
+  panic("vdalloc");
+}
+
+// Free the chain of descriptors starting at i.
+static void
+vdfree(int i)
+{
+  int flags;
+
+  for(;;){
+    flags = virtio.desc[i].flags;
+    virtio.free[i] = 1;
+    virtio.nfree++;
+    if((flags & VIRTQ_NEXT) == 0)
+      break;
+    i = virtio.desc[i].next;
+  }
+  wakeup(&virtio.free);
+}
+
+// Sync b with the virtio disk, as iderw does, or start to and
+// return at once if b has B_ASYNC set; virtiointr calls bdone
+// then. Returns -1 if there is no virtio disk.
+int
+virtiorw(struct buf *b)
+{
+  uint sector;
+  int d[3], i, write;
+
+  if(virtio.base == 0)
+    return -1;
+  if(!holdingsleep(&b->lock))
+    panic("virtiorw: buf not locked");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+    panic("virtiorw: nothing to do");
+  sector = b->blockno * (BSIZE / SECTOR_SIZE);
+  if(sector + BSIZE / SECTOR_SIZE > virtio.capacity)
+    panic("virtiorw: block out of range");
+  write = (b->flags & B_DIRTY) != 0;
+
+  acquire(&virtio.lock);
+  while(virtio.nfree < 3)
+    sleep(&virtio.free, &virtio.lock);
+  for(i = 0; i < 3; i++)
+    d[i] = vdalloc();
+
+  virtio.req[d[0]].b = b;
+  virtio.req[d[0]].hdr.type = write ? VIRTIO_BLK_OUT : VIRTIO_BLK_IN;
+  virtio.req[d[0]].hdr.reserved = 0;
+  virtio.req[d[0]].hdr.sector = sector;
+  virtio.req[d[0]].status = 0xff;  // the device sets 0 on success
+
+  virtio.desc[d[0]].addr = V2P(&virtio.req[d[0]].hdr);
+  virtio.desc[d[0]].len = sizeof(struct vblkhdr);
+  virtio.desc[d[0]].flags = VIRTQ_NEXT;
+  virtio.desc[d[0]].next = d[1];
+
+  virtio.desc[d[1]].addr = V2P(b->data);
+  virtio.desc[d[1]].len = BSIZE;
+  virtio.desc[d[1]].flags = VIRTQ_NEXT | (write ? 0 : VIRTQ_WRITE);
+  virtio.desc[d[1]].next = d[2];
+
+  virtio.desc[d[2]].addr = V2P(&virtio.req[d[0]].status);
+  virtio.desc[d[2]].len = 1;
+  virtio.desc[d[2]].flags = VIRTQ_WRITE;
+  virtio.desc[d[2]].next = 0;
+
+  // The descriptors must be visible before the ring entry,
+  // and the entry before the device is told.
+  virtio.avail->ring[virtio.avail->idx % virtio.n] = d[0];
+  __sync_synchronize();
+  virtio.avail->idx++;
+  __sync_synchronize();
+  outw(virtio.base + VIRTIO_QNOTIFY, 0);
+
+  if((b->flags & B_ASYNC) == 0)
+    while((b->flags & (B_VALID|B_DIRTY)) != B_VALID)
+      sleep(b, &virtio.lock);
+  release(&virtio.lock);
+  return 0;
+}
+
+// Interrupt handler.
+void
+virtiointr(void)
+{
+  struct buf *b;
+  int id;
+
+  acquire(&virtio.lock);
+  // Reading the ISR acknowledges the interrupt, so a request
+  // that finishes after this interrupts again.
+  inb(virtio.base + VIRTIO_ISR);
+  __sync_synchronize();
+  while(virtio.usedidx != *(volatile ushort*)&virtio.used->idx){
+    id = virtio.used->ring[virtio.usedidx % virtio.n].id;
+    b = virtio.req[id].b;
+    if(virtio.req[id].status != 0)
+      cprintf("virtio: error %d, block %d\n", virtio.req[id].status, b->blockno);
+    virtio.req[id].b = 0;
+    vdfree(id);
+    virtio.usedidx++;
+
+    b->flags |= B_VALID;
+    b->flags &= ~B_DIRTY;
+    if(b->flags & B_ASYNC)
+      bdone(b);
+    else
+      wakeup(b);
+  }
+  release(&virtio.lock);
+}
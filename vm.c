@@ -2,10 +2,15 @@
 #include "types.h"
 #include "defs.h"
 #include "x86.h"
+#include "traps.h"
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
 #include "elf.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
 
 extern char data[];  // defined by kernel.ld
 pde_t *kpgdir;  // for use in scheduler()
@@ -31,7 +36,9 @@ seginit(void)
 
 // Return the address of the PTE in page table pgdir
 // that corresponds to virtual address va.  If alloc!=0,
-// create any required page table pages.
+// create any required page table pages. Returns 0 if va
+// lies in a 4MB page, which has no PTE: callers that deal
+// with 4MB pages look at the PDE first.
 static pte_t *
 walkpgdir(pde_t *pgdir, const void *va, int alloc)
 {
@@ -39,13 +46,14 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
   pte_t *pgtab;
 
   pde = &pgdir[PDX(va)];
-  if(*pde & PTE_P){
+  if(*pde & PTE_PS){
+    return 0;
+  } else if(*pde & PTE_P){
     pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
   } else {
-    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
-      return 0;
     // Make sure all those PTE_P bits are zero.
-    memset(pgtab, 0, PGSIZE);
+    if(!alloc || (pgtab = (pte_t*)kzalloc()) == 0)
+      return 0;
     // The permissions here are overly generous, but they can
     // be further restricted by the permissions in the page table
     // entries, if necessary.
@@ -121,9 +129,8 @@ setupkvm(void)
   pde_t *pgdir;
   struct kmap *k;
 
-  if((pgdir = (pde_t*)kalloc()) == 0)
+  if((pgdir = (pde_t*)kzalloc()) == 0)
     return 0;
-  memset(pgdir, 0, PGSIZE);
   if (P2V(PHYSTOP) > (void*)DEVSPACE)
     panic("PHYSTOP too high");
   for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
@@ -177,6 +184,48 @@ switchuvm(struct proc *p)
   popcli();
 }
 
+// Make every CPU drop its TLB entries for pgdir, after some of
+// its mappings were removed and before the pages they mapped are
+// freed. Other CPUs matter only while they run a thread that uses
+// pgdir; they get a T_TLBFLUSH interrupt, and this waits for them,
+// so if pgdir may be in use elsewhere it must be called with
+// interrupts on and no spinlocks held.
+void
+tlbshootdown(pde_t *pgdir)
+{
+  struct cpu *c;
+  uint req[NCPU];
+
+  pushcli();
+  if(rcr3() == V2P(pgdir))
+    lcr3(V2P(pgdir));
+  for(c = cpus; c < cpus+ncpu; c++){
+    req[c-cpus] = 0;
+    if(c == mycpu() || c->proc == 0 || c->proc->pgdir != pgdir)
+      continue;
+    req[c-cpus] = __sync_add_and_fetch(&c->tlbreq, 1);
+    lapicipi(c->apicid, T_TLBFLUSH);
+  }
+  popcli();
+
+  for(c = cpus; c < cpus+ncpu; c++)
+    while(req[c-cpus] != 0 && (int)(c->tlbdone - req[c-cpus]) < 0)
+      ;
+}
+
+// Handle a T_TLBFLUSH interrupt. Every request counted in
+// tlbreq before the flush is done once it returns.
+void
+tlbflushintr(void)
+{
+  struct cpu *c = mycpu();
+  uint req;
+
+  req = c->tlbreq;
+  lcr3(rcr3());
+  c->tlbdone = req;
+}
+
 // Load the initcode into address 0 of pgdir.
 // sz must be less than a page.
 void
@@ -186,43 +235,83 @@ inituvm(pde_t *pgdir, char *init, uint sz)
 
   if(sz >= PGSIZE)
     panic("inituvm: more than a page");
-  mem = kalloc();
-  memset(mem, 0, PGSIZE);
+  mem = kzalloc();
   mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
   memmove(mem, init, sz);
 }
 
-// Load a program segment into pgdir.  addr must be page-aligned
-// and the pages from addr to addr+sz must already be mapped.
-int
-loaduvm(pde_t *pgdir, char *addr, struct inode *ip, uint offset, uint sz)
+// Allocate a page of user memory, zeroed if zero is set, and
+// charge it to container c. If memory is exhausted and the
+// caller can sleep, swap out other processes' pages to make
+// room. Returns 0 if memory is exhausted or c is at its limit.
+static char*
+ualloc(struct container *c, int zero, int cansleep)
 {
-  uint i, pa, n;
-  pte_t *pte;
+  char *mem;
 
-  if((uint) addr % PGSIZE != 0)
-    panic("loaduvm: addr must be page aligned");
-  for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
-      panic("loaduvm: address should exist");
-    pa = PTE_ADDR(*pte);
-    if(sz - i < PGSIZE)
-      n = sz - i;
-    else
-      n = PGSIZE;
-    if(readi(ip, P2V(pa), offset+i, n) != n)
-      return -1;
+  while((mem = zero ? kzalloc() : kalloc()) == 0)
+    if(!cansleep || swapout() < 0)
+      return 0;
+  if(kcharge(mem, c) < 0){
+    kfree(mem);
+    return 0;
+  }
+  return mem;
+}
+
+// Allocate a 4MB page of user memory, not zeroed, and charge its
+// pages to container c. Returns 0 if there is no free 4MB page
+// or c is at its limit; callers fall back to 4KB pages.
+static char*
+ualloclarge(struct container *c)
+{
+  char *mem;
+  int i;
+
+  if((mem = kalloclarge()) == 0)
+    return 0;
+  for(i = 0; i < NPTENTRIES; i++){
+    if(kcharge(mem + i*PGSIZE, c) < 0){
+      kfreelarge(mem);
+      return 0;
+    }
   }
+  return mem;
+}
+
+// Replace the 4MB page mapped by pde with a page table
+// mapping the same memory as 4KB pages, so that part of it
+// can be unmapped. Each page of a 4MB page is allocated on
+// its own (see kalloclarge), so the pages can then be
+// freed one by one. Returns -1 if there is no memory for
+// the page table.
+static int
+demote(pde_t *pde)
+{
+  pte_t *pgtab;
+  uint pa, flags;
+  int i;
+
+  if((pgtab = (pte_t*)kzalloc()) == 0)
+    return -1;
+  pa = PTE_ADDR(*pde);
+  flags = PTE_FLAGS(*pde) & ~PTE_PS;
+  for(i = 0; i < NPTENTRIES; i++)
+    pgtab[i] = (pa + i*PGSIZE) | flags;
+  *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
   return 0;
 }
 
 // Allocate page tables and physical memory to grow process from oldsz to
-// newsz, which need not be page aligned.  Returns new size or 0 on error.
+// newsz, which need not be page aligned, and charge it to container c.
+// Returns new size or 0 on error.
+// Whole 4MB-aligned runs of the new memory get a 4MB page if one is free.
 int
-allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+allocuvm(pde_t *pgdir, uint oldsz, uint newsz, struct container *c)
 {
   char *mem;
   uint a;
+  int r;
 
   if(newsz >= KERNBASE)
     return 0;
@@ -231,14 +320,24 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 
   a = PGROUNDUP(oldsz);
   for(; a < newsz; a += PGSIZE){
-    mem = kalloc();
+    if(a % LPGSIZE == 0 && a + LPGSIZE <= newsz && pgdir[PDX(a)] == 0 &&
+       (mem = ualloclarge(c)) != 0){
+      memset(mem, 0, LPGSIZE);
+      pgdir[PDX(a)] = V2P(mem) | PTE_P | PTE_W | PTE_U | PTE_PS;
+      a += LPGSIZE - PGSIZE;
+      continue;
+    }
+    mem = ualloc(c, 1, 1);
     if(mem == 0){
       cprintf("allocuvm out of memory\n");
       deallocuvm(pgdir, newsz, oldsz);
       return 0;
     }
-    memset(mem, 0, PGSIZE);
-    if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+    // A new page table may be needed too; swap to make room.
+    while((r = mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U)) < 0 &&
+          swapout() == 0)
+      ;
+    if(r < 0){
       cprintf("allocuvm out of memory (2)\n");
       deallocuvm(pgdir, newsz, oldsz);
       kfree(mem);
@@ -248,21 +347,80 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
   return newsz;
 }
 
+// Pages unmapped by deallocuvm, to be freed once no TLB can
+// map them any more. 4MB pages have bit 0 set.
+struct pagebatch {
+  pde_t *pgdir;
+  int n;
+  char *v[32];
+};
+
+static void
+freebatch(struct pagebatch *b)
+{
+  int i;
+
+  if(b->n == 0)
+    return;
+  tlbshootdown(b->pgdir);
+  for(i = 0; i < b->n; i++){
+    if((uint)b->v[i] & 1)
+      kfreelarge(b->v[i] - 1);
+    else
+      kfree(b->v[i]);
+  }
+  b->n = 0;
+}
+
+static void
+batchpage(struct pagebatch *b, char *v)
+{
+  if(b->n == NELEM(b->v))
+    freebatch(b);
+  b->v[b->n++] = v;
+}
+
 // Deallocate user pages to bring the process size from oldsz to
 // newsz.  oldsz and newsz need not be page-aligned, nor does newsz
 // need to be less than oldsz.  oldsz can be larger than the actual
-// process size.  Returns the new process size.
+// process size.  Returns the new process size, or -1, having
+// freed nothing, if part of a 4MB page is to be freed and there
+// is no memory to split it.
+// Pages are freed only after tlbshootdown, since another thread
+// may still have them in its TLB; see tlbshootdown for when
+// that may wait.
 int
 deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 {
+  struct pagebatch b;
+  pde_t *pde;
   pte_t *pte;
-  uint a, pa;
+  uint a, pa, lo;
+  int i;
 
   if(newsz >= oldsz)
     return oldsz;
 
   a = PGROUNDUP(newsz);
+  // Only the 4MB pages at either end can be partly freed.
+  // Split them into 4KB pages first.
+  for(i = 0; i < 2 && a < oldsz; i++){
+    pde = &pgdir[PDX(i == 0 ? a : oldsz - 1)];
+    lo = (i == 0 ? a : oldsz - 1) & ~(LPGSIZE-1);
+    if((*pde & PTE_PS) && (lo < a || lo + LPGSIZE > oldsz) && demote(pde) < 0)
+      return -1;
+  }
+
+  b.pgdir = pgdir;
+  b.n = 0;
   for(; a  < oldsz; a += PGSIZE){
+    pde = &pgdir[PDX(a)];
+    if(*pde & PTE_PS){
+      batchpage(&b, (char*)P2V(PTE_ADDR(*pde)) + 1);
+      *pde = 0;
+      a += LPGSIZE - PGSIZE;
+      continue;
+    }
     pte = walkpgdir(pgdir, (char*)a, 0);
     if(!pte)
       a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
@@ -270,11 +428,14 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
       pa = PTE_ADDR(*pte);
       if(pa == 0)
         panic("kfree");
-      char *v = P2V(pa);
-      kfree(v);
+      batchpage(&b, P2V(pa));
+      *pte = 0;
+    } else if(*pte & PTE_SWAP){
+      swapfree(PTE_ADDR(*pte) >> PTXSHIFT);
       *pte = 0;
     }
   }
+  freebatch(&b);
   return newsz;
 }
 
@@ -297,6 +458,37 @@ freevm(pde_t *pgdir)
   kfree((char*)pgdir);
 }
 
+// Count the user pages mapped in pgdir into *rss, and the
+// page-table pages of pgdir, itself included, into *ptpages.
+// pgdir 0 means the kernel's own page table.
+void
+pgdirstats(pde_t *pgdir, uint *rss, uint *ptpages)
+{
+  pte_t *pgtab;
+  uint i, j;
+
+  if(pgdir == 0)
+    pgdir = kpgdir;
+  *rss = 0;
+  *ptpages = 1;
+  for(i = 0; i < NPDENTRIES; i++){
+    if(!(pgdir[i] & PTE_P))
+      continue;
+    if(pgdir[i] & PTE_PS){
+      if(i < PDX(KERNBASE))
+        *rss += NPTENTRIES;
+      continue;
+    }
+    (*ptpages)++;
+    if(i >= PDX(KERNBASE))
+      continue;
+    pgtab = (pte_t*)P2V(PTE_ADDR(pgdir[i]));
+    for(j = 0; j < NPTENTRIES; j++)
+      if((pgtab[j] & (PTE_P|PTE_U)) == (PTE_P|PTE_U))
+        (*rss)++;
+  }
+}
+
 // Clear PTE_U on a page. Used to create an inaccessible
 // page beneath the user stack.
 void
@@ -310,49 +502,167 @@ clearpteu(pde_t *pgdir, char *uva)
   *pte &= ~PTE_U;
 }
 
-// Given a parent process's page table, create a copy
-// of it for a child.
-pde_t*
-copyuvm(pde_t *pgdir, uint sz)
+// Read the swapped-out page at pte back into memory.
+static int
+swapin(pte_t *pte, int cansleep)
+{
+  char *mem;
+
+  if(!cansleep)
+    return -1;
+  if((mem = ualloc(myproc()->cont, 0, 1)) == 0)
+    return -1;
+  swapread(PTE_ADDR(*pte) >> PTXSHIFT, mem);
+  *pte = V2P(mem) | (PTE_FLAGS(*pte) & ~PTE_SWAP) | PTE_P;
+  return 0;
+}
+
+// Continue a clock sweep over the user pages of pgdir, of a
+// process of size sz, from *va, for a page to swap out. The
+// accessed bit of each private page passed over is cleared;
+// the first one found with the bit already clear is unmapped,
+// its PTE made to name swap slot instead, and the page
+// returned holding the mapping's reference. Returns 0 at the
+// end of the address space. The caller must make sure the
+// process cannot run, so that it does not have the PTEs
+// cached in a TLB.
+char*
+swapscan(pde_t *pgdir, uint sz, uint *va, uint slot)
 {
-  pde_t *d;
   pte_t *pte;
-  uint pa, i, flags;
   char *mem;
+  uint a;
 
-  if((d = setupkvm()) == 0)
+  for(a = *va; a < KERNBASE; a += PGSIZE){
+    if(a >= sz && a < MMAPBASE)
+      a = MMAPBASE;
+    if((pte = walkpgdir(pgdir, (char*)a, 0)) == 0){
+      // No page table, or a 4MB page, which stays in memory.
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
+    if((*pte & (PTE_P|PTE_U)) != (PTE_P|PTE_U) || (*pte & PTE_SH))
+      continue;
+    if(*pte & PTE_A){
+      *pte &= ~PTE_A;
+      continue;
+    }
+    mem = P2V(PTE_ADDR(*pte));
+    if(krefcnt(mem) != 1)
+      continue;
+    *pte = (slot << PTXSHIFT) | PTE_SWAP |
+           (PTE_FLAGS(*pte) & ~(PTE_P|PTE_A|PTE_D));
+    *va = a + PGSIZE;
+    return mem;
+  }
+  *va = KERNBASE;
+  return 0;
+}
+
+// Copy the 4MB page that pde maps at va into d, as a 4MB page
+// if one is free and as 4KB pages if not.
+static int
+copylarge(pde_t *d, uint va, pde_t pde, struct container *c)
+{
+  char *mem, *src;
+  uint off;
+
+  src = P2V(PTE_ADDR(pde));
+  if((mem = ualloclarge(c)) != 0){
+    memmove(mem, src, LPGSIZE);
+    d[PDX(va)] = V2P(mem) | PTE_FLAGS(pde);
     return 0;
-  for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
-      panic("copyuvm: pte should exist");
+  }
+  for(off = 0; off < LPGSIZE; off += PGSIZE){
+    if((mem = ualloc(c, 0, 1)) == 0)
+      return -1;
+    memmove(mem, src + off, PGSIZE);
+    if(mappages(d, (char*)va + off, PGSIZE, V2P(mem),
+                PTE_FLAGS(pde) & ~PTE_PS) < 0){
+      kfree(mem);
+      return -1;
+    }
+  }
+  return 0;
+}
+
+// Copy the user pages of pgdir between start and end
+// into d. Pages the parent has not touched yet are left
+// for the child to fault in from its own vmas, and pages
+// that are read-only or shared are shared, not copied.
+static int
+copyrange(pde_t *d, pde_t *pgdir, uint start, uint end, struct container *c)
+{
+  pte_t *pte;
+  uint pa, i, flags;
+  char *mem;
+
+  for(i = start; i < end; i += PGSIZE){
+    if(pgdir[PDX(i)] & PTE_PS){
+      if(copylarge(d, PGADDR(PDX(i), 0, 0), pgdir[PDX(i)], c) < 0)
+        return -1;
+      i = PGADDR(PDX(i) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0){
+      i = PGADDR(PDX(i) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
+    if((*pte & PTE_SWAP) && swapin(pte, 1) < 0)
+      return -1;
     if(!(*pte & PTE_P))
-      panic("copyuvm: page not present");
+      continue;
     pa = PTE_ADDR(*pte);
     flags = PTE_FLAGS(*pte);
-    if((mem = kalloc()) == 0)
-      goto bad;
+    if(!(flags & PTE_W) || (flags & PTE_SH)){
+      if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
+        return -1;
+      kref(P2V(pa));
+      continue;
+    }
+    if((mem = ualloc(c, 0, 1)) == 0)
+      return -1;
     memmove(mem, (char*)P2V(pa), PGSIZE);
     if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0) {
       kfree(mem);
-      goto bad;
+      return -1;
     }
   }
-  return d;
-
-bad:
-  freevm(d);
   return 0;
 }
 
+// Given a parent process's page table, create a copy
+// of it for a child: the sz bytes of program and heap
+// plus anything mapped in the mmap area. Copied pages
+// are charged to c, the child's container.
+pde_t*
+copyuvm(pde_t *pgdir, uint sz, struct container *c)
+{
+  pde_t *d;
+
+  if((d = setupkvm()) == 0)
+    return 0;
+  if(copyrange(d, pgdir, 0, sz, c) < 0 ||
+     copyrange(d, pgdir, MMAPBASE, KERNBASE, c) < 0){
+    freevm(d);
+    return 0;
+  }
+  return d;
+}
+
 //PAGEBREAK!
 // Map user virtual address to kernel address.
 char*
 uva2ka(pde_t *pgdir, char *uva)
 {
+  pde_t *pde;
   pte_t *pte;
 
+  pde = &pgdir[PDX(uva)];
+  if((*pde & (PTE_P|PTE_PS|PTE_U)) == (PTE_P|PTE_PS|PTE_U))
+    return (char*)P2V(PTE_ADDR(*pde) + (PGROUNDDOWN((uint)uva) & (LPGSIZE-1)));
   pte = walkpgdir(pgdir, uva, 0);
-  if((*pte & PTE_P) == 0)
+  if(pte == 0 || (*pte & PTE_P) == 0)
     return 0;
   if((*pte & PTE_U) == 0)
     return 0;
@@ -386,9 +696,541 @@ copyout(pde_t *pgdir, uint va, void *p, uint len)
 }
 
 //PAGEBREAK!
-// Blank page.
-//PAGEBREAK!
-// Blank page.
+// Demand paging.
+//
+// exec() does not read a program into memory. It records each
+// loadable segment as a vma, and pagefault() fills in a page the
+// first time the process touches it. Pages that hold only file
+// contents come from the page cache (pcache.c), so processes
+// running the same binary share them. A writable mapping of a
+// cached page is marked PTE_COW and read-only, and the first
+// write replaces it with a private copy.
+//
+// mmap() adds vmas in the area from MMAPBASE to KERNBASE, out of
+// the way of the heap. A VM_SHARED vma maps cached pages writable
+// and PTE_SH, so every mapper and every fork child shares them;
+// an anonymous one maps the pages of a segment of its own (see
+// shmanon). There is no msync: munmap() and exit() write modified
+// (PTE_D) pages back to the file, and until then read() sees the
+// stores through the cached pages (see pcread). If the page cache
+// is full of mapped pages, a mapping gets a page of its own, and
+// its stores reach others only at munmap.
+//
+// The threads of a process share its page table. The size and
+// vmas live in the process's first thread, p->leader, and vmlock
+// keeps the threads from changing them or the page table at once.
+
+// Find the vma of p containing va.
+static struct vma*
+findvma(struct proc *p, uint va)
+{
+  struct vma *v;
+
+  p = p->leader;
+  for(v = p->vma; v < &p->vma[NVMA]; v++)
+    if(v->end != 0 && va >= v->start && va < v->end)
+      return v;
+  return 0;
+}
+
+// Give the process at pte a private, writable copy
+// of its copy-on-write page.
+static int
+cowpage(pde_t *pgdir, pte_t *pte, int cansleep)
+{
+  char *mem, *old;
+
+  old = P2V(PTE_ADDR(*pte));
+  if(krefcnt(old) == 1){
+    // No one else maps the page any more; take it over,
+    // and the charge for it with it.
+    if(kcharge(old, myproc()->cont) < 0)
+      return -1;
+    *pte = (*pte & ~PTE_COW) | PTE_W;
+  } else {
+    if((mem = ualloc(myproc()->cont, 0, cansleep)) == 0)
+      return -1;
+    memmove(mem, old, PGSIZE);
+    *pte = V2P(mem) | (PTE_FLAGS(*pte) & ~PTE_COW) | PTE_W;
+    kfree(old);
+  }
+  lcr3(V2P(pgdir));  // flush the stale read-only TLB entry
+  return 0;
+}
+
+// Fill in the missing page at va, which lies in v.
+static int
+vmafill(pde_t *pgdir, struct vma *v, uint va, int write, int cansleep)
+{
+  uint off, n;
+  char *mem, *cached;
+  int perm;
+
+  off = va - v->start;
+  perm = PTE_U;
+  if(v->flags & VM_WRITE)
+    perm |= PTE_W;
+
+  if(v->shm){
+    // Shared memory: off is the offset into the segment.
+    if((mem = shmpage(v->shm, (v->off + off) / PGSIZE)) == 0)
+      return -1;
+  } else if(v->ip && off + PGSIZE <= v->filesz){
+    // The page is file contents only: use the page cache.
+    ilock(v->ip);
+    cached = pcget(v->ip, v->off + off);
+    iunlock(v->ip);
+    if(cached == 0)
+      return -1;
+    if(!(v->flags & VM_WRITE) || (v->flags & VM_SHARED)){
+      mem = cached;
+    } else if(!write){
+      mem = cached;
+      perm = (perm & ~PTE_W) | PTE_COW;
+    } else {
+      if((mem = ualloc(myproc()->cont, 0, cansleep)) == 0){
+        kfree(cached);
+        return -1;
+      }
+      memmove(mem, cached, PGSIZE);
+      kfree(cached);
+    }
+  } else {
+    // Zero-fill, with any tail of the file's bytes read in.
+    if((mem = ualloc(myproc()->cont, 1, cansleep)) == 0)
+      return -1;
+    if(v->ip && off < v->filesz){
+      n = v->filesz - off;
+      ilock(v->ip);
+      if(readi(v->ip, mem, v->off + off, n) != n){
+        iunlock(v->ip);
+        kfree(mem);
+        return -1;
+      }
+      iunlock(v->ip);
+    }
+  }
+
+  if(v->flags & VM_SHARED)
+    perm |= PTE_SH;
+  if(mappages(pgdir, (char*)va, PGSIZE, V2P(mem), perm) < 0){
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
+// Fill the whole 4MB-aligned run around va with a zeroed 4MB
+// page, if the run lies inside v, an anonymous private writable
+// vma, and nothing in it is mapped yet. Returns -1 if not, and
+// the caller falls back to filling a 4KB page.
+static int
+vmalarge(pde_t *pgdir, struct vma *v, uint va)
+{
+  uint a;
+  char *mem;
+
+  a = va & ~(LPGSIZE-1);
+  if(v->ip || v->shm || (v->flags & (VM_WRITE|VM_SHARED)) != VM_WRITE)
+    return -1;
+  if(a < v->start || a + LPGSIZE > v->end || pgdir[PDX(a)] != 0)
+    return -1;
+  if((mem = ualloclarge(myproc()->cont)) == 0)
+    return -1;
+  memset(mem, 0, LPGSIZE);
+  pgdir[PDX(a)] = V2P(mem) | PTE_P | PTE_W | PTE_U | PTE_PS;
+  return 0;
+}
+
+// Make the access to va by p that faulted retryable.
+static int
+uvmfault(struct proc *p, uint va, int write, int cansleep)
+{
+  struct vma *v;
+  pte_t *pte;
+
+  if(va < MMAPBASE ? va >= p->leader->sz : va >= KERNBASE)
+    return -1;
+  va = PGROUNDDOWN(va);
+
+  if(p->pgdir[PDX(va)] & PTE_PS)
+    pte = &p->pgdir[PDX(va)];  // a 4MB page: the PDE is the only entry
+  else
+    pte = walkpgdir(p->pgdir, (char*)va, 0);
+  if(pte && (*pte & PTE_P)){
+    if(write && (*pte & PTE_COW))
+      return cowpage(p->pgdir, pte, cansleep);
+    if((*pte & PTE_U) && (!write || (*pte & PTE_W))){
+      // Another thread filled the page or made it writable
+      // since this CPU cached the old entry.
+      lcr3(V2P(p->pgdir));
+      return 0;
+    }
+    return -1;
+  }
+  if(pte && (*pte & PTE_SWAP))
+    return swapin(pte, cansleep);
+
+  if((v = findvma(p, va)) == 0)
+    return -1;
+  if(write && !(v->flags & VM_WRITE))
+    return -1;
+  if(v->ip && !cansleep)
+    return -1;
+  if(vmalarge(p->pgdir, v, va) == 0)
+    return 0;
+  return vmafill(p->pgdir, v, va, write, cansleep);
+}
+
+// Handle a page fault at va in the current process, with
+// x86 error code err. Returns 0 if the page is now mapped
+// and the access can be retried, -1 if the fault is real.
+// Called from trap() with interrupts off.
+int
+pagefault(uint va, uint err)
+{
+  struct proc *p = myproc();
+  int r;
+
+  if(p == 0)
+    return -1;
+  // Reading a file or swap may sleep, which is not allowed if
+  // the kernel faulted while holding a spinlock; see touchuvm.
+  // Nor is waiting for vmlock, so such a fault takes its chances.
+  if(mycpu()->ncli != 0)
+    return uvmfault(p, va, err & FEC_WR, 0);
+  p->infault = 1;
+  vmlock(p);
+  r = uvmfault(p, va, err & FEC_WR, 1);
+  vmunlock(p);
+  p->infault = 0;
+  return r;
+}
+
+// Fault in any missing pages of the current process
+// between va and va+n, so that the kernel can later use
+// them while holding spinlocks, and if write is set make
+// them writable. Returns -1 if some page cannot be mapped,
+// or if write is set and the process may not write it.
+// The pages stay mapped until the system call returns.
+int
+touchuvm(uint va, uint n, int write)
+{
+  struct proc *p = myproc();
+  pte_t *pte;
+  uint a;
+
+  int r;
+
+  pinuvm(va, n);
+  for(a = PGROUNDDOWN(va); a < va + n; a += PGSIZE){
+    if(p->pgdir[PDX(a)] & PTE_PS)
+      continue;
+    pte = walkpgdir(p->pgdir, (char*)a, 0);
+    if(pte && (*pte & PTE_P) && (!write || (*pte & PTE_W)))
+      continue;
+    vmlock(p);
+    r = uvmfault(p, a, write, 1);
+    vmunlock(p);
+    if(r < 0)
+      return -1;
+  }
+  return 0;
+}
+
+// Return the end of the user memory of p that contains va:
+// the size for the program and heap, the end of the vma for
+// the mmap area. Returns 0 if va is not user memory.
+uint
+uvaend(struct proc *p, uint va)
+{
+  struct vma *v;
+  uint sz = p->leader->sz;
+
+  if(va < MMAPBASE)
+    return va < sz ? sz : 0;
+  if((v = findvma(p, va)) == 0)
+    return 0;
+  return v->end;
+}
+
+// Add a vma of len bytes to the current process at a free
+// address in the mmap area. If ip is not 0, the first filesz
+// bytes come from ip starting at off; if shm is not 0, the
+// pages are those of shm starting at off. The vma takes its
+// own reference to ip or shm. Large anonymous private mappings
+// are aligned to LPGSIZE so that they can use 4MB pages.
+// Returns the address, or -1 if there is no room. The caller
+// must hold vmlock.
+int
+mmapuvm(struct inode *ip, struct shm *shm, uint off, uint filesz, uint len,
+        int flags)
+{
+  struct proc *p = myproc()->leader;
+  struct vma *v, *free;
+  uint a, align;
+
+  len = PGROUNDUP(len);
+  if(len == 0 || len > KERNBASE - MMAPBASE)
+    return -1;
+
+  free = 0;
+  for(v = p->vma; v < &p->vma[NVMA]; v++)
+    if(v->end == 0 && free == 0)
+      free = v;
+  if(free == 0)
+    return -1;
+
+  align = PGSIZE;
+  if(ip == 0 && shm == 0 && (flags & (VM_WRITE|VM_SHARED)) == VM_WRITE &&
+     len >= LPGSIZE)
+    align = LPGSIZE;
+
+  // First fit: slide past every vma that overlaps.
+  a = MMAPBASE;
+again:
+  if(a + len > KERNBASE || a + len < a)
+    return -1;
+  for(v = p->vma; v < &p->vma[NVMA]; v++){
+    if(v->end != 0 && v->start < a + len && a < v->end){
+      a = (v->end + align-1) & ~(align-1);
+      goto again;
+    }
+  }
+
+  free->start = a;
+  free->end = a + len;
+  free->flags = flags;
+  free->ip = ip ? idup(ip) : 0;
+  free->shm = shm;
+  if(shm)
+    shmdup(shm);
+  free->off = off;
+  free->filesz = ip ? filesz : 0;
+  return a;
+}
+
+// Write the modified pages of shared file mapping v
+// between a and b back to the file. Returns -1 if a write
+// fails, leaving that page modified.
+static int
+vmasync(pde_t *pgdir, struct vma *v, uint a, uint b)
+{
+  // Same per-transaction limit as filewrite().
+  int max = ((MAXOPBLOCKS-1-1-2) / 2) * BSIZE;
+  uint va, off, n, i, m;
+  pte_t *pte;
+  char *mem;
+  int r;
+
+  for(va = a; va < b; va += PGSIZE){
+    pte = walkpgdir(pgdir, (char*)va, 0);
+    if(pte == 0 || (*pte & (PTE_P|PTE_D)) != (PTE_P|PTE_D))
+      continue;
+    off = va - v->start;
+    if(off >= v->filesz)
+      continue;
+    n = v->filesz - off < PGSIZE ? v->filesz - off : PGSIZE;
+    mem = P2V(PTE_ADDR(*pte));
+    for(i = 0; i < n; i += m){
+      m = n - i < max ? n - i : max;
+      begin_op();
+      ilock(v->ip);
+      r = writei(v->ip, mem + i, v->off + off + i, m);
+      iunlock(v->ip);
+      end_op();
+      if(r != m)
+        return -1;
+    }
+    *pte &= ~PTE_D;
+  }
+  return 0;
+}
+
+// Remove addresses a to b, which must be page aligned, from
+// the vmas in vma and free their pages in pgdir, writing
+// modified shared file pages back first. Splits a vma that
+// straddles the range. Must be called outside a transaction.
+// Returns -1 if splitting needs a vma slot and none is free,
+// if writing a vma's pages back fails, or if there is no memory
+// to split a 4MB page; vmas before it in vma are unmapped
+// already, the rest are left alone.
+int
+munmapuvm(pde_t *pgdir, struct vma *vma, uint a, uint b)
+{
+  struct vma *v, *nv;
+  uint lo, hi, d;
+
+  for(v = vma; v < &vma[NVMA]; v++){
+    if(v->end == 0 || v->end <= a || b <= v->start)
+      continue;
+    lo = v->start > a ? v->start : a;
+    hi = v->end < b ? v->end : b;
+
+    nv = 0;
+    if(v->start < lo && hi < v->end){
+      // Punching a hole: the tail needs a vma of its own.
+      for(nv = vma; nv < &vma[NVMA] && nv->end != 0; nv++)
+        ;
+      if(nv == &vma[NVMA])
+        return -1;
+    }
+
+    if(v->ip && (v->flags & VM_SHARED) && vmasync(pgdir, v, lo, hi) < 0)
+      return -1;
+    if(deallocuvm(pgdir, hi, lo) < 0)
+      return -1;
+
+    if(nv){
+      *nv = *v;
+      d = hi - v->start;
+      nv->start = hi;
+      nv->off += d;
+      nv->filesz = nv->filesz > d ? nv->filesz - d : 0;
+      if(nv->ip)
+        idup(nv->ip);
+      if(nv->shm)
+        shmdup(nv->shm);
+      v->end = lo;
+    } else if(lo == v->start && hi == v->end){
+      if(v->ip){
+        begin_op();
+        iput(v->ip);
+        end_op();
+      }
+      if(v->shm)
+        shmput(v->shm);
+      memset(v, 0, sizeof(*v));
+    } else if(lo == v->start){
+      d = hi - v->start;
+      v->start = hi;
+      v->off += d;
+      v->filesz = v->filesz > d ? v->filesz - d : 0;
+    } else {
+      v->end = lo;
+    }
+  }
+  return 0;
+}
+
+// Copy the vmas in src into dst for a child process.
+void
+vmadup(struct vma *dst, struct vma *src)
+{
+  int i;
+
+  for(i = 0; i < NVMA; i++){
+    dst[i] = src[i];
+    if(dst[i].end != 0 && dst[i].ip)
+      idup(dst[i].ip);
+    if(dst[i].end != 0 && dst[i].shm)
+      shmdup(dst[i].shm);
+  }
+}
+
+// Release the files and segments behind a process's vmas and
+// mark every slot unused. Must be called outside a transaction.
+void
+vmaput(struct vma *vma)
+{
+  int i;
+
+  begin_op();
+  for(i = 0; i < NVMA; i++){
+    if(vma[i].end != 0 && vma[i].ip)
+      iput(vma[i].ip);
+    if(vma[i].end != 0 && vma[i].shm)
+      shmput(vma[i].shm);
+  }
+  end_op();
+  memset(vma, 0, NVMA * sizeof(struct vma));
+}
+
+// Write the modified pages of every shared file mapping in
+// vma back to the files. Must be called outside a transaction.
+// Returns -1 if some write fails.
+int
+vmaflush(pde_t *pgdir, struct vma *vma)
+{
+  struct vma *v;
+  int r;
+
+  r = 0;
+  for(v = vma; v < &vma[NVMA]; v++)
+    if(v->end != 0 && v->ip && (v->flags & VM_SHARED) &&
+       vmasync(pgdir, v, v->start, v->end) < 0)
+      r = -1;
+  return r;
+}
+
+// Copy the page of p at va, which is not mapped, into mem as
+// p would see it on first touch: from the file or segment of
+// its vma, or zeroes.
+static int
+vmapeek(struct proc *p, uint va, char *mem)
+{
+  struct vma *v;
+  char *page;
+  uint off, n;
+
+  memset(mem, 0, PGSIZE);
+  if((v = findvma(p, va)) == 0)
+    return 0;
+  off = va - v->start;
+  if(v->shm){
+    if((page = shmpage(v->shm, (v->off + off) / PGSIZE)) == 0)
+      return -1;
+    memmove(mem, page, PGSIZE);
+    kfree(page);
+  } else if(v->ip && off < v->filesz){
+    n = v->filesz - off < PGSIZE ? v->filesz - off : PGSIZE;
+    ilock(v->ip);
+    if(readi(v->ip, mem, v->off + off, n) != n){
+      iunlock(v->ip);
+      return -1;
+    }
+    iunlock(v->ip);
+  }
+  return 0;
+}
+
+// Append the pages of p from a to b to f, each as p would read
+// it: from memory, from swap, or as its vma would fill it in.
+// Leaves p's page table alone; p must not run meanwhile.
+// Must be called outside a transaction.
+int
+ckptuvm(struct proc *p, uint a, uint b, struct file *f)
+{
+  char *buf, *mem;
+  pde_t *pde;
+  pte_t *pte;
+  uint va;
+
+  if((buf = kalloc()) == 0)
+    return -1;
+  for(va = a; va < b; va += PGSIZE){
+    mem = buf;
+    pde = &p->pgdir[PDX(va)];
+    pte = 0;
+    if((*pde & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+      mem = (char*)P2V(PTE_ADDR(*pde)) + (va & (LPGSIZE-1));
+    else if((pte = walkpgdir(p->pgdir, (char*)va, 0)) != 0 && (*pte & PTE_P))
+      mem = P2V(PTE_ADDR(*pte));
+    else if(pte && (*pte & PTE_SWAP))
+      swappeek(PTE_ADDR(*pte) >> PTXSHIFT, buf);
+    else if(vmapeek(p, va, buf) < 0)
+      goto bad;
+    if(filewrite(f, mem, PGSIZE) != PGSIZE)
+      goto bad;
+  }
+  kfree(buf);
+  return 0;
+
+ bad:
+  kfree(buf);
+  return -1;
+}
+
 //PAGEBREAK!
 // Blank page.
 
@@ -0,0 +1,1907 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 01 00 00 00       	mov    $0x1,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7f 28                	jg     51 <main+0x51>
+  29:	eb 54                	jmp    7f <main+0x7f>
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "wc: cannot open %s\n", argv[i]);
+      exit();
+    }
+    wc(fd, argv[i]);
+  30:	83 ec 08             	sub    $0x8,%esp
+  33:	ff 33                	push   (%ebx)
+  for(i = 1; i < argc; i++){
+  35:	83 c6 01             	add    $0x1,%esi
+  38:	83 c3 04             	add    $0x4,%ebx
+    wc(fd, argv[i]);
+  3b:	50                   	push   %eax
+  3c:	e8 df 00 00 00       	call   120 <wc>
+    close(fd);
+  41:	89 3c 24             	mov    %edi,(%esp)
+  44:	e8 82 04 00 00       	call   4cb <close>
+  for(i = 1; i < argc; i++){
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  4f:	74 29                	je     7a <main+0x7a>
+    if((fd = open(argv[i], 0)) < 0){
+  51:	83 ec 08             	sub    $0x8,%esp
+  54:	6a 00                	push   $0x0
+  56:	ff 33                	push   (%ebx)
+  58:	e8 86 04 00 00       	call   4e3 <open>
+  5d:	83 c4 10             	add    $0x10,%esp
+  60:	89 c7                	mov    %eax,%edi
+  62:	85 c0                	test   %eax,%eax
+  64:	79 ca                	jns    30 <main+0x30>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+  66:	50                   	push   %eax
+  67:	ff 33                	push   (%ebx)
+  69:	68 63 0d 00 00       	push   $0xd63
+  6e:	6a 01                	push   $0x1
+  70:	e8 db 05 00 00       	call   650 <printf>
+      exit();
+  75:	e8 29 04 00 00       	call   4a3 <exit>
+  }
+  exit();
+  7a:	e8 24 04 00 00       	call   4a3 <exit>
+    wc(0, "");
+  7f:	52                   	push   %edx
+  80:	52                   	push   %edx
+  81:	68 55 0d 00 00       	push   $0xd55
+  86:	6a 00                	push   $0x0
+  88:	e8 93 00 00 00       	call   120 <wc>
+    exit();
+  8d:	e8 11 04 00 00       	call   4a3 <exit>
+  92:	66 90                	xchg   %ax,%ax
+  94:	66 90                	xchg   %ax,%ax
+  96:	66 90                	xchg   %ax,%ax
+  98:	66 90                	xchg   %ax,%ax
+  9a:	66 90                	xchg   %ax,%ax
+  9c:	66 90                	xchg   %ax,%ax
+  9e:	66 90                	xchg   %ax,%ax
+
+000000a0 <count>:
+{
+  a0:	55                   	push   %ebp
+  a1:	89 e5                	mov    %esp,%ebp
+  a3:	56                   	push   %esi
+  a4:	53                   	push   %ebx
+  a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  a8:	8b 75 08             	mov    0x8(%ebp),%esi
+  ab:	8d 1c 06             	lea    (%esi,%eax,1),%ebx
+  for(i=0; i<n; i++){
+  ae:	85 c0                	test   %eax,%eax
+  b0:	7f 17                	jg     c9 <count+0x29>
+  b2:	eb 63                	jmp    117 <count+0x77>
+  b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      inword = 0;
+  b8:	c7 05 60 11 00 00 00 	movl   $0x0,0x1160
+  bf:	00 00 00 
+  for(i=0; i<n; i++){
+  c2:	83 c6 01             	add    $0x1,%esi
+  c5:	39 de                	cmp    %ebx,%esi
+  c7:	74 4e                	je     117 <count+0x77>
+    c++;
+  c9:	83 05 64 11 00 00 01 	addl   $0x1,0x1164
+    if(p[i] == '\n')
+  d0:	0f be 06             	movsbl (%esi),%eax
+  d3:	3c 0a                	cmp    $0xa,%al
+  d5:	75 0a                	jne    e1 <count+0x41>
+      l++;
+  d7:	83 05 6c 11 00 00 01 	addl   $0x1,0x116c
+    if(strchr(" \r\t\n\v", p[i]))
+  de:	0f be 06             	movsbl (%esi),%eax
+  e1:	83 ec 08             	sub    $0x8,%esp
+  e4:	50                   	push   %eax
+  e5:	68 40 0d 00 00       	push   $0xd40
+  ea:	e8 11 02 00 00       	call   300 <strchr>
+  ef:	83 c4 10             	add    $0x10,%esp
+  f2:	85 c0                	test   %eax,%eax
+  f4:	75 c2                	jne    b8 <count+0x18>
+    else if(!inword){
+  f6:	a1 60 11 00 00       	mov    0x1160,%eax
+  fb:	85 c0                	test   %eax,%eax
+  fd:	75 c3                	jne    c2 <count+0x22>
+  for(i=0; i<n; i++){
+  ff:	83 c6 01             	add    $0x1,%esi
+      w++;
+ 102:	83 05 68 11 00 00 01 	addl   $0x1,0x1168
+      inword = 1;
+ 109:	c7 05 60 11 00 00 01 	movl   $0x1,0x1160
+ 110:	00 00 00 
+  for(i=0; i<n; i++){
+ 113:	39 de                	cmp    %ebx,%esi
+ 115:	75 b2                	jne    c9 <count+0x29>
+}
+ 117:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 11a:	5b                   	pop    %ebx
+ 11b:	5e                   	pop    %esi
+ 11c:	5d                   	pop    %ebp
+ 11d:	c3                   	ret
+ 11e:	66 90                	xchg   %ax,%ax
+
+00000120 <wc>:
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	56                   	push   %esi
+ 124:	53                   	push   %ebx
+  if(fstat(fd, &st) >= 0 && st.type == T_FILE && st.size > 0 &&
+ 125:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+{
+ 128:	83 ec 28             	sub    $0x28,%esp
+ 12b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  l = w = c = 0;
+ 12e:	c7 05 64 11 00 00 00 	movl   $0x0,0x1164
+ 135:	00 00 00 
+ 138:	c7 05 68 11 00 00 00 	movl   $0x0,0x1168
+ 13f:	00 00 00 
+ 142:	c7 05 6c 11 00 00 00 	movl   $0x0,0x116c
+ 149:	00 00 00 
+  inword = 0;
+ 14c:	c7 05 60 11 00 00 00 	movl   $0x0,0x1160
+ 153:	00 00 00 
+  if(fstat(fd, &st) >= 0 && st.type == T_FILE && st.size > 0 &&
+ 156:	50                   	push   %eax
+ 157:	53                   	push   %ebx
+ 158:	e8 9e 03 00 00       	call   4fb <fstat>
+ 15d:	83 c4 10             	add    $0x10,%esp
+ 160:	85 c0                	test   %eax,%eax
+ 162:	78 5d                	js     1c1 <wc+0xa1>
+ 164:	66 83 7d e4 02       	cmpw   $0x2,-0x1c(%ebp)
+ 169:	75 56                	jne    1c1 <wc+0xa1>
+ 16b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 16e:	85 c0                	test   %eax,%eax
+ 170:	74 4f                	je     1c1 <wc+0xa1>
+     (p = mmap(0, st.size, PROT_READ, MAP_PRIVATE, fd, 0)) != MAP_FAILED){
+ 172:	83 ec 08             	sub    $0x8,%esp
+ 175:	6a 00                	push   $0x0
+ 177:	53                   	push   %ebx
+ 178:	6a 02                	push   $0x2
+ 17a:	6a 01                	push   $0x1
+ 17c:	50                   	push   %eax
+ 17d:	6a 00                	push   $0x0
+ 17f:	e8 c7 03 00 00       	call   54b <mmap>
+  if(fstat(fd, &st) >= 0 && st.type == T_FILE && st.size > 0 &&
+ 184:	83 c4 20             	add    $0x20,%esp
+     (p = mmap(0, st.size, PROT_READ, MAP_PRIVATE, fd, 0)) != MAP_FAILED){
+ 187:	89 c6                	mov    %eax,%esi
+  if(fstat(fd, &st) >= 0 && st.type == T_FILE && st.size > 0 &&
+ 189:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 18c:	74 33                	je     1c1 <wc+0xa1>
+    count(p, st.size);
+ 18e:	83 ec 08             	sub    $0x8,%esp
+ 191:	ff 75 f4             	push   -0xc(%ebp)
+ 194:	50                   	push   %eax
+ 195:	e8 06 ff ff ff       	call   a0 <count>
+    munmap(p, st.size);
+ 19a:	5a                   	pop    %edx
+ 19b:	59                   	pop    %ecx
+ 19c:	ff 75 f4             	push   -0xc(%ebp)
+ 19f:	56                   	push   %esi
+ 1a0:	e8 ae 03 00 00       	call   553 <munmap>
+ 1a5:	83 c4 10             	add    $0x10,%esp
+ 1a8:	eb 33                	jmp    1dd <wc+0xbd>
+ 1aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      count(buf, n);
+ 1b0:	83 ec 08             	sub    $0x8,%esp
+ 1b3:	50                   	push   %eax
+ 1b4:	68 80 11 00 00       	push   $0x1180
+ 1b9:	e8 e2 fe ff ff       	call   a0 <count>
+ 1be:	83 c4 10             	add    $0x10,%esp
+    while((n = read(fd, buf, sizeof(buf))) > 0)
+ 1c1:	83 ec 04             	sub    $0x4,%esp
+ 1c4:	68 00 02 00 00       	push   $0x200
+ 1c9:	68 80 11 00 00       	push   $0x1180
+ 1ce:	53                   	push   %ebx
+ 1cf:	e8 e7 02 00 00       	call   4bb <read>
+ 1d4:	83 c4 10             	add    $0x10,%esp
+ 1d7:	85 c0                	test   %eax,%eax
+ 1d9:	7f d5                	jg     1b0 <wc+0x90>
+    if(n < 0){
+ 1db:	75 2e                	jne    20b <wc+0xeb>
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+ 1dd:	83 ec 08             	sub    $0x8,%esp
+ 1e0:	ff 75 0c             	push   0xc(%ebp)
+ 1e3:	ff 35 64 11 00 00    	push   0x1164
+ 1e9:	ff 35 68 11 00 00    	push   0x1168
+ 1ef:	ff 35 6c 11 00 00    	push   0x116c
+ 1f5:	68 56 0d 00 00       	push   $0xd56
+ 1fa:	6a 01                	push   $0x1
+ 1fc:	e8 4f 04 00 00       	call   650 <printf>
+}
+ 201:	83 c4 20             	add    $0x20,%esp
+ 204:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 207:	5b                   	pop    %ebx
+ 208:	5e                   	pop    %esi
+ 209:	5d                   	pop    %ebp
+ 20a:	c3                   	ret
+      printf(1, "wc: read error\n");
+ 20b:	50                   	push   %eax
+ 20c:	50                   	push   %eax
+ 20d:	68 46 0d 00 00       	push   $0xd46
+ 212:	6a 01                	push   $0x1
+ 214:	e8 37 04 00 00       	call   650 <printf>
+      exit();
+ 219:	e8 85 02 00 00       	call   4a3 <exit>
+ 21e:	66 90                	xchg   %ax,%ax
+
+00000220 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 220:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 221:	31 c0                	xor    %eax,%eax
+{
+ 223:	89 e5                	mov    %esp,%ebp
+ 225:	53                   	push   %ebx
+ 226:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 229:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 22c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 230:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 234:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 237:	83 c0 01             	add    $0x1,%eax
+ 23a:	84 d2                	test   %dl,%dl
+ 23c:	75 f2                	jne    230 <strcpy+0x10>
+    ;
+  return os;
+}
+ 23e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 241:	89 c8                	mov    %ecx,%eax
+ 243:	c9                   	leave
+ 244:	c3                   	ret
+ 245:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000250 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	53                   	push   %ebx
+ 254:	8b 55 08             	mov    0x8(%ebp),%edx
+ 257:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 25a:	0f b6 02             	movzbl (%edx),%eax
+ 25d:	84 c0                	test   %al,%al
+ 25f:	75 17                	jne    278 <strcmp+0x28>
+ 261:	eb 3a                	jmp    29d <strcmp+0x4d>
+ 263:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 267:	90                   	nop
+ 268:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 26c:	83 c2 01             	add    $0x1,%edx
+ 26f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 272:	84 c0                	test   %al,%al
+ 274:	74 1a                	je     290 <strcmp+0x40>
+    p++, q++;
+ 276:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 278:	0f b6 19             	movzbl (%ecx),%ebx
+ 27b:	38 c3                	cmp    %al,%bl
+ 27d:	74 e9                	je     268 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 27f:	29 d8                	sub    %ebx,%eax
+}
+ 281:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 284:	c9                   	leave
+ 285:	c3                   	ret
+ 286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 290:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 294:	31 c0                	xor    %eax,%eax
+ 296:	29 d8                	sub    %ebx,%eax
+}
+ 298:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 29b:	c9                   	leave
+ 29c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 29d:	0f b6 19             	movzbl (%ecx),%ebx
+ 2a0:	31 c0                	xor    %eax,%eax
+ 2a2:	eb db                	jmp    27f <strcmp+0x2f>
+ 2a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2af:	90                   	nop
+
+000002b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2b6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 2b9:	74 15                	je     2d0 <strlen+0x20>
+ 2bb:	31 c0                	xor    %eax,%eax
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 2c0:	83 c0 01             	add    $0x1,%eax
+ 2c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 2c7:	89 c1                	mov    %eax,%ecx
+ 2c9:	75 f5                	jne    2c0 <strlen+0x10>
+    ;
+  return n;
+}
+ 2cb:	89 c8                	mov    %ecx,%eax
+ 2cd:	5d                   	pop    %ebp
+ 2ce:	c3                   	ret
+ 2cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 2d0:	31 c9                	xor    %ecx,%ecx
+}
+ 2d2:	5d                   	pop    %ebp
+ 2d3:	89 c8                	mov    %ecx,%eax
+ 2d5:	c3                   	ret
+ 2d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	57                   	push   %edi
+ 2e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2ed:	89 d7                	mov    %edx,%edi
+ 2ef:	fc                   	cld
+ 2f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2f5:	89 d0                	mov    %edx,%eax
+ 2f7:	c9                   	leave
+ 2f8:	c3                   	ret
+ 2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	8b 45 08             	mov    0x8(%ebp),%eax
+ 306:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 30a:	0f b6 10             	movzbl (%eax),%edx
+ 30d:	84 d2                	test   %dl,%dl
+ 30f:	75 12                	jne    323 <strchr+0x23>
+ 311:	eb 1d                	jmp    330 <strchr+0x30>
+ 313:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 317:	90                   	nop
+ 318:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 31c:	83 c0 01             	add    $0x1,%eax
+ 31f:	84 d2                	test   %dl,%dl
+ 321:	74 0d                	je     330 <strchr+0x30>
+    if(*s == c)
+ 323:	38 d1                	cmp    %dl,%cl
+ 325:	75 f1                	jne    318 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 327:	5d                   	pop    %ebp
+ 328:	c3                   	ret
+ 329:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 330:	31 c0                	xor    %eax,%eax
+}
+ 332:	5d                   	pop    %ebp
+ 333:	c3                   	ret
+ 334:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 33f:	90                   	nop
+
+00000340 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 345:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 348:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 349:	31 db                	xor    %ebx,%ebx
+{
+ 34b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 34e:	eb 27                	jmp    377 <gets+0x37>
+    cc = read(0, &c, 1);
+ 350:	83 ec 04             	sub    $0x4,%esp
+ 353:	6a 01                	push   $0x1
+ 355:	56                   	push   %esi
+ 356:	6a 00                	push   $0x0
+ 358:	e8 5e 01 00 00       	call   4bb <read>
+    if(cc < 1)
+ 35d:	83 c4 10             	add    $0x10,%esp
+ 360:	85 c0                	test   %eax,%eax
+ 362:	7e 1d                	jle    381 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 364:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 368:	8b 55 08             	mov    0x8(%ebp),%edx
+ 36b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 36f:	3c 0a                	cmp    $0xa,%al
+ 371:	74 10                	je     383 <gets+0x43>
+ 373:	3c 0d                	cmp    $0xd,%al
+ 375:	74 0c                	je     383 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 377:	89 df                	mov    %ebx,%edi
+ 379:	83 c3 01             	add    $0x1,%ebx
+ 37c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 37f:	7c cf                	jl     350 <gets+0x10>
+ 381:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 383:	8b 45 08             	mov    0x8(%ebp),%eax
+ 386:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 38a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 38d:	5b                   	pop    %ebx
+ 38e:	5e                   	pop    %esi
+ 38f:	5f                   	pop    %edi
+ 390:	5d                   	pop    %ebp
+ 391:	c3                   	ret
+ 392:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 399:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003a0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	56                   	push   %esi
+ 3a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3a5:	83 ec 08             	sub    $0x8,%esp
+ 3a8:	6a 00                	push   $0x0
+ 3aa:	ff 75 08             	push   0x8(%ebp)
+ 3ad:	e8 31 01 00 00       	call   4e3 <open>
+  if(fd < 0)
+ 3b2:	83 c4 10             	add    $0x10,%esp
+ 3b5:	85 c0                	test   %eax,%eax
+ 3b7:	78 27                	js     3e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 3b9:	83 ec 08             	sub    $0x8,%esp
+ 3bc:	ff 75 0c             	push   0xc(%ebp)
+ 3bf:	89 c3                	mov    %eax,%ebx
+ 3c1:	50                   	push   %eax
+ 3c2:	e8 34 01 00 00       	call   4fb <fstat>
+  close(fd);
+ 3c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 3ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3cc:	e8 fa 00 00 00       	call   4cb <close>
+  return r;
+ 3d1:	83 c4 10             	add    $0x10,%esp
+}
+ 3d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3d7:	89 f0                	mov    %esi,%eax
+ 3d9:	5b                   	pop    %ebx
+ 3da:	5e                   	pop    %esi
+ 3db:	5d                   	pop    %ebp
+ 3dc:	c3                   	ret
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3e5:	eb ed                	jmp    3d4 <stat+0x34>
+ 3e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ee:	66 90                	xchg   %ax,%ax
+
+000003f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	53                   	push   %ebx
+ 3f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3f7:	0f be 02             	movsbl (%edx),%eax
+ 3fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 400:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 405:	77 1e                	ja     425 <atoi+0x35>
+ 407:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 410:	83 c2 01             	add    $0x1,%edx
+ 413:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 416:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 41a:	0f be 02             	movsbl (%edx),%eax
+ 41d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 420:	80 fb 09             	cmp    $0x9,%bl
+ 423:	76 eb                	jbe    410 <atoi+0x20>
+  return n;
+}
+ 425:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 428:	89 c8                	mov    %ecx,%eax
+ 42a:	c9                   	leave
+ 42b:	c3                   	ret
+ 42c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000430 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	57                   	push   %edi
+ 434:	56                   	push   %esi
+ 435:	8b 45 10             	mov    0x10(%ebp),%eax
+ 438:	8b 55 08             	mov    0x8(%ebp),%edx
+ 43b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 43e:	85 c0                	test   %eax,%eax
+ 440:	7e 13                	jle    455 <memmove+0x25>
+ 442:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 444:	89 d7                	mov    %edx,%edi
+ 446:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 450:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 451:	39 f8                	cmp    %edi,%eax
+ 453:	75 fb                	jne    450 <memmove+0x20>
+  return vdst;
+}
+ 455:	5e                   	pop    %esi
+ 456:	89 d0                	mov    %edx,%eax
+ 458:	5f                   	pop    %edi
+ 459:	5d                   	pop    %ebp
+ 45a:	c3                   	ret
+
+0000045b <ccreate>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(ccreate)
+ 45b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <cfork>:
+SYSCALL(cfork)
+ 463:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <cgetrootdir>:
+SYSCALL(cgetrootdir)
+ 46b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <getcontrootdir>:
+SYSCALL(getcontrootdir)
+ 473:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <cpause>:
+SYSCALL(cpause)
+ 47b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <cresume>:
+SYSCALL(cresume)
+ 483:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <cstart>:
+SYSCALL(cstart)
+ 48b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <cstop>:
+SYSCALL(cstop)
+ 493:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <fork>:
+SYSCALL(fork)
+ 49b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <exit>:
+SYSCALL(exit)
+ 4a3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <wait>:
+SYSCALL(wait)
+ 4ab:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <pipe>:
+SYSCALL(pipe)
+ 4b3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <read>:
+SYSCALL(read)
+ 4bb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <write>:
+SYSCALL(write)
+ 4c3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <close>:
+SYSCALL(close)
+ 4cb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <kill>:
+SYSCALL(kill)
+ 4d3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <exec>:
+SYSCALL(exec)
+ 4db:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <open>:
+SYSCALL(open)
+ 4e3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <mknod>:
+SYSCALL(mknod)
+ 4eb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <unlink>:
+SYSCALL(unlink)
+ 4f3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <fstat>:
+SYSCALL(fstat)
+ 4fb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <link>:
+SYSCALL(link)
+ 503:	b8 13 00 00 00       	mov    $0x13,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <mkdir>:
+SYSCALL(mkdir)
+ 50b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <chdir>:
+SYSCALL(chdir)
+ 513:	b8 09 00 00 00       	mov    $0x9,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <dup>:
+SYSCALL(dup)
+ 51b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <getpid>:
+SYSCALL(getpid)
+ 523:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <sbrk>:
+SYSCALL(sbrk)
+ 52b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <sleep>:
+SYSCALL(sleep)
+ 533:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <uptime>:
+SYSCALL(uptime)
+ 53b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <cps>:
+SYSCALL(cps)
+ 543:	b8 16 00 00 00       	mov    $0x16,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <mmap>:
+SYSCALL(mmap)
+ 54b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <munmap>:
+SYSCALL(munmap)
+ 553:	b8 20 00 00 00       	mov    $0x20,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <shmget>:
+SYSCALL(shmget)
+ 55b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <climit>:
+SYSCALL(climit)
+ 563:	b8 22 00 00 00       	mov    $0x22,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <spawn>:
+SYSCALL(spawn)
+ 56b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <clone>:
+SYSCALL(clone)
+ 573:	b8 24 00 00 00       	mov    $0x24,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <join>:
+SYSCALL(join)
+ 57b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <futex>:
+SYSCALL(futex)
+ 583:	b8 26 00 00 00       	mov    $0x26,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <ccheckpoint>:
+SYSCALL(ccheckpoint)
+ 58b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <crestore>:
+SYSCALL(crestore)
+ 593:	b8 28 00 00 00       	mov    $0x28,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <czygote>:
+SYSCALL(czygote)
+ 59b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <memstats>:
+SYSCALL(memstats)
+ 5a3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+ 5ab:	66 90                	xchg   %ax,%ax
+ 5ad:	66 90                	xchg   %ax,%ax
+ 5af:	90                   	nop
+
+000005b0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+ 5b4:	56                   	push   %esi
+ 5b5:	53                   	push   %ebx
+ 5b6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5b8:	89 d1                	mov    %edx,%ecx
+{
+ 5ba:	83 ec 3c             	sub    $0x3c,%esp
+ 5bd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 5c0:	85 d2                	test   %edx,%edx
+ 5c2:	0f 89 80 00 00 00    	jns    648 <printint+0x98>
+ 5c8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5cc:	74 7a                	je     648 <printint+0x98>
+    x = -xx;
+ 5ce:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5d5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5d8:	31 f6                	xor    %esi,%esi
+ 5da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 5e0:	89 c8                	mov    %ecx,%eax
+ 5e2:	31 d2                	xor    %edx,%edx
+ 5e4:	89 f7                	mov    %esi,%edi
+ 5e6:	f7 f3                	div    %ebx
+ 5e8:	8d 76 01             	lea    0x1(%esi),%esi
+ 5eb:	0f b6 92 d8 0d 00 00 	movzbl 0xdd8(%edx),%edx
+ 5f2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 5f6:	89 ca                	mov    %ecx,%edx
+ 5f8:	89 c1                	mov    %eax,%ecx
+ 5fa:	39 da                	cmp    %ebx,%edx
+ 5fc:	73 e2                	jae    5e0 <printint+0x30>
+  if(neg)
+ 5fe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 601:	85 c0                	test   %eax,%eax
+ 603:	74 07                	je     60c <printint+0x5c>
+    buf[i++] = '-';
+ 605:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 60a:	89 f7                	mov    %esi,%edi
+ 60c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 60f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 612:	01 df                	add    %ebx,%edi
+ 614:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 618:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 61b:	83 ec 04             	sub    $0x4,%esp
+ 61e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 621:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 624:	6a 01                	push   $0x1
+ 626:	50                   	push   %eax
+ 627:	56                   	push   %esi
+ 628:	e8 96 fe ff ff       	call   4c3 <write>
+  while(--i >= 0)
+ 62d:	89 f8                	mov    %edi,%eax
+ 62f:	83 c4 10             	add    $0x10,%esp
+ 632:	83 ef 01             	sub    $0x1,%edi
+ 635:	39 d8                	cmp    %ebx,%eax
+ 637:	75 df                	jne    618 <printint+0x68>
+}
+ 639:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 63c:	5b                   	pop    %ebx
+ 63d:	5e                   	pop    %esi
+ 63e:	5f                   	pop    %edi
+ 63f:	5d                   	pop    %ebp
+ 640:	c3                   	ret
+ 641:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 648:	31 c0                	xor    %eax,%eax
+ 64a:	eb 89                	jmp    5d5 <printint+0x25>
+ 64c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000650 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	57                   	push   %edi
+ 654:	56                   	push   %esi
+ 655:	53                   	push   %ebx
+ 656:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 659:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 65c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 65f:	0f b6 1e             	movzbl (%esi),%ebx
+ 662:	83 c6 01             	add    $0x1,%esi
+ 665:	84 db                	test   %bl,%bl
+ 667:	74 67                	je     6d0 <printf+0x80>
+ 669:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 66c:	31 d2                	xor    %edx,%edx
+ 66e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 671:	eb 34                	jmp    6a7 <printf+0x57>
+ 673:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 677:	90                   	nop
+ 678:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 67b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 680:	83 f8 25             	cmp    $0x25,%eax
+ 683:	74 18                	je     69d <printf+0x4d>
+  write(fd, &c, 1);
+ 685:	83 ec 04             	sub    $0x4,%esp
+ 688:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 68b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 68e:	6a 01                	push   $0x1
+ 690:	50                   	push   %eax
+ 691:	57                   	push   %edi
+ 692:	e8 2c fe ff ff       	call   4c3 <write>
+ 697:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 69a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 69d:	0f b6 1e             	movzbl (%esi),%ebx
+ 6a0:	83 c6 01             	add    $0x1,%esi
+ 6a3:	84 db                	test   %bl,%bl
+ 6a5:	74 29                	je     6d0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 6a7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 6aa:	85 d2                	test   %edx,%edx
+ 6ac:	74 ca                	je     678 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 6ae:	83 fa 25             	cmp    $0x25,%edx
+ 6b1:	75 ea                	jne    69d <printf+0x4d>
+      if(c == 'd'){
+ 6b3:	83 f8 25             	cmp    $0x25,%eax
+ 6b6:	0f 84 24 01 00 00    	je     7e0 <printf+0x190>
+ 6bc:	83 e8 63             	sub    $0x63,%eax
+ 6bf:	83 f8 15             	cmp    $0x15,%eax
+ 6c2:	77 1c                	ja     6e0 <printf+0x90>
+ 6c4:	ff 24 85 80 0d 00 00 	jmp    *0xd80(,%eax,4)
+ 6cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6cf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6d3:	5b                   	pop    %ebx
+ 6d4:	5e                   	pop    %esi
+ 6d5:	5f                   	pop    %edi
+ 6d6:	5d                   	pop    %ebp
+ 6d7:	c3                   	ret
+ 6d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6df:	90                   	nop
+  write(fd, &c, 1);
+ 6e0:	83 ec 04             	sub    $0x4,%esp
+ 6e3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6e6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 6ea:	6a 01                	push   $0x1
+ 6ec:	52                   	push   %edx
+ 6ed:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 6f0:	57                   	push   %edi
+ 6f1:	e8 cd fd ff ff       	call   4c3 <write>
+ 6f6:	83 c4 0c             	add    $0xc,%esp
+ 6f9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6fc:	6a 01                	push   $0x1
+ 6fe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 701:	52                   	push   %edx
+ 702:	57                   	push   %edi
+ 703:	e8 bb fd ff ff       	call   4c3 <write>
+        putc(fd, c);
+ 708:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 70b:	31 d2                	xor    %edx,%edx
+ 70d:	eb 8e                	jmp    69d <printf+0x4d>
+ 70f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 710:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 713:	83 ec 0c             	sub    $0xc,%esp
+ 716:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 71b:	8b 13                	mov    (%ebx),%edx
+ 71d:	6a 00                	push   $0x0
+ 71f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 721:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 724:	e8 87 fe ff ff       	call   5b0 <printint>
+        ap++;
+ 729:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 72c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 72f:	31 d2                	xor    %edx,%edx
+ 731:	e9 67 ff ff ff       	jmp    69d <printf+0x4d>
+ 736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 740:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 743:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 745:	83 c0 04             	add    $0x4,%eax
+ 748:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 74b:	85 db                	test   %ebx,%ebx
+ 74d:	0f 84 9d 00 00 00    	je     7f0 <printf+0x1a0>
+        while(*s != 0){
+ 753:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 756:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 758:	84 c0                	test   %al,%al
+ 75a:	0f 84 3d ff ff ff    	je     69d <printf+0x4d>
+ 760:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 763:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 766:	89 de                	mov    %ebx,%esi
+ 768:	89 d3                	mov    %edx,%ebx
+ 76a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 770:	83 ec 04             	sub    $0x4,%esp
+ 773:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 776:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 779:	6a 01                	push   $0x1
+ 77b:	53                   	push   %ebx
+ 77c:	57                   	push   %edi
+ 77d:	e8 41 fd ff ff       	call   4c3 <write>
+        while(*s != 0){
+ 782:	0f b6 06             	movzbl (%esi),%eax
+ 785:	83 c4 10             	add    $0x10,%esp
+ 788:	84 c0                	test   %al,%al
+ 78a:	75 e4                	jne    770 <printf+0x120>
+      state = 0;
+ 78c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 78f:	31 d2                	xor    %edx,%edx
+ 791:	e9 07 ff ff ff       	jmp    69d <printf+0x4d>
+ 796:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 79d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 7a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7a3:	83 ec 0c             	sub    $0xc,%esp
+ 7a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7ab:	8b 13                	mov    (%ebx),%edx
+ 7ad:	6a 01                	push   $0x1
+ 7af:	e9 6b ff ff ff       	jmp    71f <printf+0xcf>
+ 7b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 7b8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 7bb:	83 ec 04             	sub    $0x4,%esp
+ 7be:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 7c1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 7c3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 7c6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7c9:	6a 01                	push   $0x1
+ 7cb:	52                   	push   %edx
+ 7cc:	57                   	push   %edi
+ 7cd:	e8 f1 fc ff ff       	call   4c3 <write>
+        ap++;
+ 7d2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7d5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7d8:	31 d2                	xor    %edx,%edx
+ 7da:	e9 be fe ff ff       	jmp    69d <printf+0x4d>
+ 7df:	90                   	nop
+  write(fd, &c, 1);
+ 7e0:	83 ec 04             	sub    $0x4,%esp
+ 7e3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7e6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7e9:	6a 01                	push   $0x1
+ 7eb:	e9 11 ff ff ff       	jmp    701 <printf+0xb1>
+ 7f0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 7f5:	bb 77 0d 00 00       	mov    $0xd77,%ebx
+ 7fa:	e9 61 ff ff ff       	jmp    760 <printf+0x110>
+ 7ff:	90                   	nop
+
+00000800 <runfree>:
+
+// Give the n pages at r back to the free runs, merging them with
+// adjacent runs, and shrink the heap if the end of it is free.
+static void
+runfree(struct page *r, uint n)
+{
+ 800:	55                   	push   %ebp
+  struct page **pp, *prev;
+
+  r->kind = PFREE;
+ 801:	b9 03 00 00 00       	mov    $0x3,%ecx
+{
+ 806:	89 e5                	mov    %esp,%ebp
+ 808:	57                   	push   %edi
+ 809:	56                   	push   %esi
+ 80a:	53                   	push   %ebx
+ 80b:	89 c3                	mov    %eax,%ebx
+ 80d:	83 ec 0c             	sub    $0xc,%esp
+  r->kind = PFREE;
+ 810:	66 89 08             	mov    %cx,(%eax)
+  r->npages = n;
+  prev = 0;
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 813:	8b 0d 84 13 00 00    	mov    0x1384,%ecx
+  r->npages = n;
+ 819:	89 50 04             	mov    %edx,0x4(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 81c:	85 c9                	test   %ecx,%ecx
+ 81e:	0f 84 1f 01 00 00    	je     943 <runfree+0x143>
+ 824:	39 c1                	cmp    %eax,%ecx
+ 826:	0f 83 f7 00 00 00    	jae    923 <runfree+0x123>
+ 82c:	89 c8                	mov    %ecx,%eax
+ 82e:	eb 04                	jmp    834 <runfree+0x34>
+ 830:	39 d8                	cmp    %ebx,%eax
+ 832:	73 09                	jae    83d <runfree+0x3d>
+ 834:	89 c2                	mov    %eax,%edx
+ 836:	8b 40 14             	mov    0x14(%eax),%eax
+ 839:	85 c0                	test   %eax,%eax
+ 83b:	75 f3                	jne    830 <runfree+0x30>
+    prev = *pp;
+  r->next = *pp;
+ 83d:	89 43 14             	mov    %eax,0x14(%ebx)
+  *pp = r;
+ 840:	89 5a 14             	mov    %ebx,0x14(%edx)
+
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 843:	8b 43 14             	mov    0x14(%ebx),%eax
+ 846:	85 c0                	test   %eax,%eax
+ 848:	74 12                	je     85c <runfree+0x5c>
+ 84a:	8b 7b 04             	mov    0x4(%ebx),%edi
+ 84d:	89 fe                	mov    %edi,%esi
+ 84f:	c1 e6 0c             	shl    $0xc,%esi
+ 852:	01 de                	add    %ebx,%esi
+ 854:	39 f0                	cmp    %esi,%eax
+ 856:	0f 84 a4 00 00 00    	je     900 <runfree+0x100>
+    r->npages += r->next->npages;
+    r->next = r->next->next;
+  }
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 85c:	8b 72 04             	mov    0x4(%edx),%esi
+ 85f:	89 f0                	mov    %esi,%eax
+ 861:	c1 e0 0c             	shl    $0xc,%eax
+ 864:	01 d0                	add    %edx,%eax
+ 866:	39 c3                	cmp    %eax,%ebx
+ 868:	74 16                	je     880 <runfree+0x80>
+    pp = &runs;
+    while(*pp != r)
+      pp = &(*pp)->next;
+  }
+
+  if(r->next == 0 && r->npages >= TRIM &&
+ 86a:	8b 43 14             	mov    0x14(%ebx),%eax
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 86d:	8d 72 14             	lea    0x14(%edx),%esi
+  if(r->next == 0 && r->npages >= TRIM &&
+ 870:	85 c0                	test   %eax,%eax
+ 872:	74 3c                	je     8b0 <runfree+0xb0>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+    *pp = 0;
+    sbrk(-(int)(r->npages*PGSIZE));
+    heapend = (char*)r;
+  }
+}
+ 874:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 877:	5b                   	pop    %ebx
+ 878:	5e                   	pop    %esi
+ 879:	5f                   	pop    %edi
+ 87a:	5d                   	pop    %ebp
+ 87b:	c3                   	ret
+ 87c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    prev->npages += r->npages;
+ 880:	03 73 04             	add    0x4(%ebx),%esi
+ 883:	89 72 04             	mov    %esi,0x4(%edx)
+    prev->next = r->next;
+ 886:	8b 43 14             	mov    0x14(%ebx),%eax
+ 889:	89 42 14             	mov    %eax,0x14(%edx)
+    while(*pp != r)
+ 88c:	39 d1                	cmp    %edx,%ecx
+ 88e:	0f 84 c5 00 00 00    	je     959 <runfree+0x159>
+ 894:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      pp = &(*pp)->next;
+ 898:	89 cb                	mov    %ecx,%ebx
+ 89a:	8b 49 14             	mov    0x14(%ecx),%ecx
+    while(*pp != r)
+ 89d:	39 d1                	cmp    %edx,%ecx
+ 89f:	75 f7                	jne    898 <runfree+0x98>
+      pp = &(*pp)->next;
+ 8a1:	8d 73 14             	lea    0x14(%ebx),%esi
+ 8a4:	89 cb                	mov    %ecx,%ebx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 8a6:	85 c0                	test   %eax,%eax
+ 8a8:	75 ca                	jne    874 <runfree+0x74>
+ 8aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 8b0:	8b 53 04             	mov    0x4(%ebx),%edx
+ 8b3:	83 fa 1f             	cmp    $0x1f,%edx
+ 8b6:	76 bc                	jbe    874 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 8b8:	c1 e2 0c             	shl    $0xc,%edx
+ 8bb:	01 da                	add    %ebx,%edx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 8bd:	39 15 80 13 00 00    	cmp    %edx,0x1380
+ 8c3:	75 af                	jne    874 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 8c5:	83 ec 0c             	sub    $0xc,%esp
+ 8c8:	6a 00                	push   $0x0
+ 8ca:	e8 5c fc ff ff       	call   52b <sbrk>
+ 8cf:	83 c4 10             	add    $0x10,%esp
+ 8d2:	39 05 80 13 00 00    	cmp    %eax,0x1380
+ 8d8:	75 9a                	jne    874 <runfree+0x74>
+    *pp = 0;
+ 8da:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    sbrk(-(int)(r->npages*PGSIZE));
+ 8e0:	8b 43 04             	mov    0x4(%ebx),%eax
+ 8e3:	83 ec 0c             	sub    $0xc,%esp
+ 8e6:	c1 e0 0c             	shl    $0xc,%eax
+ 8e9:	f7 d8                	neg    %eax
+ 8eb:	50                   	push   %eax
+ 8ec:	e8 3a fc ff ff       	call   52b <sbrk>
+    heapend = (char*)r;
+ 8f1:	89 1d 80 13 00 00    	mov    %ebx,0x1380
+ 8f7:	83 c4 10             	add    $0x10,%esp
+}
+ 8fa:	e9 75 ff ff ff       	jmp    874 <runfree+0x74>
+ 8ff:	90                   	nop
+    r->npages += r->next->npages;
+ 900:	03 78 04             	add    0x4(%eax),%edi
+ 903:	89 7b 04             	mov    %edi,0x4(%ebx)
+    r->next = r->next->next;
+ 906:	8b 40 14             	mov    0x14(%eax),%eax
+ 909:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 90c:	8b 72 04             	mov    0x4(%edx),%esi
+ 90f:	89 f0                	mov    %esi,%eax
+ 911:	c1 e0 0c             	shl    $0xc,%eax
+ 914:	01 d0                	add    %edx,%eax
+ 916:	39 c3                	cmp    %eax,%ebx
+ 918:	0f 85 4c ff ff ff    	jne    86a <runfree+0x6a>
+ 91e:	e9 5d ff ff ff       	jmp    880 <runfree+0x80>
+  r->next = *pp;
+ 923:	89 48 14             	mov    %ecx,0x14(%eax)
+  *pp = r;
+ 926:	a3 84 13 00 00       	mov    %eax,0x1384
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 92b:	89 d0                	mov    %edx,%eax
+ 92d:	c1 e0 0c             	shl    $0xc,%eax
+ 930:	01 d8                	add    %ebx,%eax
+ 932:	39 c1                	cmp    %eax,%ecx
+ 934:	74 2f                	je     965 <runfree+0x165>
+  if(r->next == 0 && r->npages >= TRIM &&
+ 936:	8b 43 14             	mov    0x14(%ebx),%eax
+ 939:	be 84 13 00 00       	mov    $0x1384,%esi
+ 93e:	e9 2d ff ff ff       	jmp    870 <runfree+0x70>
+  r->next = *pp;
+ 943:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 94a:	be 84 13 00 00       	mov    $0x1384,%esi
+  *pp = r;
+ 94f:	a3 84 13 00 00       	mov    %eax,0x1384
+  if(r->next == 0 && r->npages >= TRIM &&
+ 954:	e9 5a ff ff ff       	jmp    8b3 <runfree+0xb3>
+    while(*pp != r)
+ 959:	89 cb                	mov    %ecx,%ebx
+    pp = &runs;
+ 95b:	be 84 13 00 00       	mov    $0x1384,%esi
+ 960:	e9 0b ff ff ff       	jmp    870 <runfree+0x70>
+    r->npages += r->next->npages;
+ 965:	03 51 04             	add    0x4(%ecx),%edx
+ 968:	89 53 04             	mov    %edx,0x4(%ebx)
+    r->next = r->next->next;
+ 96b:	8b 41 14             	mov    0x14(%ecx),%eax
+ 96e:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 971:	eb c3                	jmp    936 <runfree+0x136>
+ 973:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 97a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000980 <runalloc>:
+
+// Take a run of n pages from the start of the first free run
+// long enough, which keeps the end of the heap free to trim.
+static struct page*
+runalloc(uint n)
+{
+ 980:	55                   	push   %ebp
+ 981:	89 e5                	mov    %esp,%ebp
+ 983:	57                   	push   %edi
+ 984:	56                   	push   %esi
+ 985:	89 c6                	mov    %eax,%esi
+ 987:	53                   	push   %ebx
+ 988:	83 ec 1c             	sub    $0x1c,%esp
+  struct page **pp, *r, *rest;
+
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ 98b:	8b 1d 84 13 00 00    	mov    0x1384,%ebx
+ 991:	85 db                	test   %ebx,%ebx
+ 993:	74 4d                	je     9e2 <runalloc+0x62>
+ 995:	b9 84 13 00 00       	mov    $0x1384,%ecx
+    if(r->npages < n)
+ 99a:	39 73 04             	cmp    %esi,0x4(%ebx)
+ 99d:	72 39                	jb     9d8 <runalloc+0x58>
+      continue;
+    if(r->npages == n){
+ 99f:	0f 84 9b 00 00 00    	je     a40 <runalloc+0xc0>
+      *pp = r->next;
+    } else {
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ 9a5:	89 f0                	mov    %esi,%eax
+      rest->kind = PFREE;
+ 9a7:	ba 03 00 00 00       	mov    $0x3,%edx
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ 9ac:	c1 e0 0c             	shl    $0xc,%eax
+ 9af:	01 d8                	add    %ebx,%eax
+      rest->kind = PFREE;
+ 9b1:	66 89 10             	mov    %dx,(%eax)
+      rest->npages = r->npages - n;
+ 9b4:	8b 53 04             	mov    0x4(%ebx),%edx
+ 9b7:	29 f2                	sub    %esi,%edx
+ 9b9:	89 50 04             	mov    %edx,0x4(%eax)
+      rest->next = r->next;
+ 9bc:	8b 53 14             	mov    0x14(%ebx),%edx
+ 9bf:	89 50 14             	mov    %edx,0x14(%eax)
+      *pp = rest;
+ 9c2:	89 01                	mov    %eax,(%ecx)
+      r->npages = n;
+ 9c4:	89 73 04             	mov    %esi,0x4(%ebx)
+    }
+    return r;
+  }
+  return morecore(n);
+}
+ 9c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9ca:	89 d8                	mov    %ebx,%eax
+ 9cc:	5b                   	pop    %ebx
+ 9cd:	5e                   	pop    %esi
+ 9ce:	5f                   	pop    %edi
+ 9cf:	5d                   	pop    %ebp
+ 9d0:	c3                   	ret
+ 9d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ 9d8:	8d 4b 14             	lea    0x14(%ebx),%ecx
+ 9db:	8b 5b 14             	mov    0x14(%ebx),%ebx
+ 9de:	85 db                	test   %ebx,%ebx
+ 9e0:	75 b8                	jne    99a <runalloc+0x1a>
+  m = n < MINCORE ? MINCORE : n;
+ 9e2:	bf 08 00 00 00       	mov    $0x8,%edi
+ 9e7:	39 fe                	cmp    %edi,%esi
+ 9e9:	0f 43 fe             	cmovae %esi,%edi
+  brk = sbrk(0);
+ 9ec:	83 ec 0c             	sub    $0xc,%esp
+ 9ef:	6a 00                	push   $0x0
+ 9f1:	e8 35 fb ff ff       	call   52b <sbrk>
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 9f6:	89 fa                	mov    %edi,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 9f8:	89 c3                	mov    %eax,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 9fa:	c1 e2 0c             	shl    $0xc,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 9fd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ a00:	f7 db                	neg    %ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ a02:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ a05:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ a0b:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+ a0e:	89 04 24             	mov    %eax,(%esp)
+ a11:	e8 15 fb ff ff       	call   52b <sbrk>
+ a16:	83 c4 10             	add    $0x10,%esp
+ a19:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ a1c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ a1f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a22:	74 3e                	je     a62 <runalloc+0xe2>
+  r = (struct page*)(brk + pad);
+ a24:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ a26:	01 da                	add    %ebx,%edx
+ a28:	89 15 80 13 00 00    	mov    %edx,0x1380
+  if(m > n)
+ a2e:	39 fe                	cmp    %edi,%esi
+ a30:	72 1e                	jb     a50 <runalloc+0xd0>
+  r->npages = n;
+ a32:	89 73 04             	mov    %esi,0x4(%ebx)
+  return r;
+ a35:	eb 90                	jmp    9c7 <runalloc+0x47>
+ a37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a3e:	66 90                	xchg   %ax,%ax
+      *pp = r->next;
+ a40:	8b 43 14             	mov    0x14(%ebx),%eax
+ a43:	89 01                	mov    %eax,(%ecx)
+}
+ a45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a48:	89 d8                	mov    %ebx,%eax
+ a4a:	5b                   	pop    %ebx
+ a4b:	5e                   	pop    %esi
+ a4c:	5f                   	pop    %edi
+ a4d:	5d                   	pop    %ebp
+ a4e:	c3                   	ret
+ a4f:	90                   	nop
+    runfree((struct page*)((char*)r + n*PGSIZE), m - n);
+ a50:	89 f0                	mov    %esi,%eax
+ a52:	29 f7                	sub    %esi,%edi
+ a54:	c1 e0 0c             	shl    $0xc,%eax
+ a57:	89 fa                	mov    %edi,%edx
+ a59:	01 d8                	add    %ebx,%eax
+ a5b:	e8 a0 fd ff ff       	call   800 <runfree>
+ a60:	eb d0                	jmp    a32 <runalloc+0xb2>
+    if(sbrk(pad + m*PGSIZE) == (char*)-1)
+ a62:	89 f7                	mov    %esi,%edi
+ a64:	83 ec 0c             	sub    $0xc,%esp
+ a67:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ a6a:	c1 e7 0c             	shl    $0xc,%edi
+ a6d:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+ a70:	50                   	push   %eax
+ a71:	e8 b5 fa ff ff       	call   52b <sbrk>
+ a76:	83 c4 10             	add    $0x10,%esp
+ a79:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ a7c:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a7f:	74 0c                	je     a8d <runalloc+0x10d>
+  r = (struct page*)(brk + pad);
+ a81:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ a83:	01 df                	add    %ebx,%edi
+ a85:	89 3d 80 13 00 00    	mov    %edi,0x1380
+  if(m > n)
+ a8b:	eb a5                	jmp    a32 <runalloc+0xb2>
+      return 0;
+ a8d:	31 db                	xor    %ebx,%ebx
+ a8f:	e9 33 ff ff ff       	jmp    9c7 <runalloc+0x47>
+ a94:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a9f:	90                   	nop
+
+00000aa0 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+ aa0:	55                   	push   %ebp
+ aa1:	89 e5                	mov    %esp,%ebp
+ aa3:	56                   	push   %esi
+ aa4:	53                   	push   %ebx
+ aa5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  struct page *p;
+
+  if(ap == 0)
+ aa8:	85 c9                	test   %ecx,%ecx
+ aaa:	74 1c                	je     ac8 <free+0x28>
+    return;
+  p = (struct page*)((uint)ap & ~(PGSIZE-1));
+ aac:	89 c8                	mov    %ecx,%eax
+ aae:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  switch(p->kind){
+ ab3:	0f b7 10             	movzwl (%eax),%edx
+ ab6:	66 83 fa 02          	cmp    $0x2,%dx
+ aba:	74 14                	je     ad0 <free+0x30>
+ abc:	66 83 fa 04          	cmp    $0x4,%dx
+ ac0:	74 66                	je     b28 <free+0x88>
+ ac2:	66 83 fa 01          	cmp    $0x1,%dx
+ ac6:	74 18                	je     ae0 <free+0x40>
+    break;
+  case PMAP:
+    munmap(p, p->npages*PGSIZE);
+    break;
+  }
+}
+ ac8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ acb:	5b                   	pop    %ebx
+ acc:	5e                   	pop    %esi
+ acd:	5d                   	pop    %ebp
+ ace:	c3                   	ret
+ acf:	90                   	nop
+    runfree(p, p->npages);
+ ad0:	8b 50 04             	mov    0x4(%eax),%edx
+}
+ ad3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ ad6:	5b                   	pop    %ebx
+ ad7:	5e                   	pop    %esi
+ ad8:	5d                   	pop    %ebp
+    runfree(p, p->npages);
+ ad9:	e9 22 fd ff ff       	jmp    800 <runfree>
+ ade:	66 90                	xchg   %ax,%ax
+  b->next = p->free;
+ ae0:	8b 50 0c             	mov    0xc(%eax),%edx
+ ae3:	89 11                	mov    %edx,(%ecx)
+  if(p->nfree++ == 0)
+ ae5:	8b 50 08             	mov    0x8(%eax),%edx
+  p->free = b;
+ ae8:	89 48 0c             	mov    %ecx,0xc(%eax)
+  if(p->nfree++ == 0)
+ aeb:	8d 5a 01             	lea    0x1(%edx),%ebx
+ aee:	89 58 08             	mov    %ebx,0x8(%eax)
+ af1:	85 d2                	test   %edx,%edx
+ af3:	74 53                	je     b48 <free+0xa8>
+  if(p->nfree == nblocks(p->class)){
+ af5:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ af9:	8d 4e 04             	lea    0x4(%esi),%ecx
+ afc:	ba e0 0f 00 00       	mov    $0xfe0,%edx
+ b01:	d3 fa                	sar    %cl,%edx
+  if(p->nfree == nblocks(p->class)){
+ b03:	39 da                	cmp    %ebx,%edx
+ b05:	75 c1                	jne    ac8 <free+0x28>
+  if(p->prev)
+ b07:	8b 48 18             	mov    0x18(%eax),%ecx
+    p->prev->next = p->next;
+ b0a:	8b 50 14             	mov    0x14(%eax),%edx
+  if(p->prev)
+ b0d:	85 c9                	test   %ecx,%ecx
+ b0f:	74 6f                	je     b80 <free+0xe0>
+    p->prev->next = p->next;
+ b11:	89 51 14             	mov    %edx,0x14(%ecx)
+  if(p->next)
+ b14:	85 d2                	test   %edx,%edx
+ b16:	74 06                	je     b1e <free+0x7e>
+    p->next->prev = p->prev;
+ b18:	8b 48 18             	mov    0x18(%eax),%ecx
+ b1b:	89 4a 18             	mov    %ecx,0x18(%edx)
+    runfree(p, 1);
+ b1e:	ba 01 00 00 00       	mov    $0x1,%edx
+ b23:	eb ae                	jmp    ad3 <free+0x33>
+ b25:	8d 76 00             	lea    0x0(%esi),%esi
+    munmap(p, p->npages*PGSIZE);
+ b28:	8b 50 04             	mov    0x4(%eax),%edx
+ b2b:	83 ec 08             	sub    $0x8,%esp
+ b2e:	c1 e2 0c             	shl    $0xc,%edx
+ b31:	52                   	push   %edx
+ b32:	50                   	push   %eax
+ b33:	e8 1b fa ff ff       	call   553 <munmap>
+    break;
+ b38:	83 c4 10             	add    $0x10,%esp
+}
+ b3b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ b3e:	5b                   	pop    %ebx
+ b3f:	5e                   	pop    %esi
+ b40:	5d                   	pop    %ebp
+ b41:	c3                   	ret
+ b42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  p->next = partial[p->class];
+ b48:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  p->prev = 0;
+ b4c:	c7 40 18 00 00 00 00 	movl   $0x0,0x18(%eax)
+  p->next = partial[p->class];
+ b53:	bb 01 00 00 00       	mov    $0x1,%ebx
+ b58:	8b 14 b5 88 13 00 00 	mov    0x1388(,%esi,4),%edx
+ b5f:	89 50 14             	mov    %edx,0x14(%eax)
+  if(p->next)
+ b62:	85 d2                	test   %edx,%edx
+ b64:	74 0a                	je     b70 <free+0xd0>
+    p->next->prev = p;
+ b66:	89 42 18             	mov    %eax,0x18(%edx)
+  partial[p->class] = p;
+ b69:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  if(p->nfree == nblocks(p->class)){
+ b6d:	8b 58 08             	mov    0x8(%eax),%ebx
+  partial[p->class] = p;
+ b70:	89 04 b5 88 13 00 00 	mov    %eax,0x1388(,%esi,4)
+}
+ b77:	eb 80                	jmp    af9 <free+0x59>
+ b79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ b80:	89 14 b5 88 13 00 00 	mov    %edx,0x1388(,%esi,4)
+ b87:	eb 8b                	jmp    b14 <free+0x74>
+ b89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000b90 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ b90:	55                   	push   %ebp
+ b91:	89 e5                	mov    %esp,%ebp
+ b93:	56                   	push   %esi
+ b94:	53                   	push   %ebx
+ b95:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct page *p;
+  uint n;
+
+  if(nbytes <= MAXSMALL)
+ b98:	3d 00 04 00 00       	cmp    $0x400,%eax
+ b9d:	76 71                	jbe    c10 <malloc+0x80>
+    return smallalloc(sizeclass(nbytes));
+  if(nbytes > 0x7fffffff)
+ b9f:	85 c0                	test   %eax,%eax
+ ba1:	0f 88 d9 00 00 00    	js     c80 <malloc+0xf0>
+    return 0;
+  n = (nbytes + HDRSIZE + PGSIZE-1) / PGSIZE;
+ ba7:	8d 90 1f 10 00 00    	lea    0x101f(%eax),%edx
+ bad:	89 d3                	mov    %edx,%ebx
+ baf:	c1 eb 0c             	shr    $0xc,%ebx
+  if(nbytes >= MAPMIN){
+ bb2:	3d ff ff 00 00       	cmp    $0xffff,%eax
+ bb7:	77 27                	ja     be0 <malloc+0x50>
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    if(p == MAP_FAILED)
+      return 0;
+    p->kind = PMAP;
+  } else {
+    if((p = runalloc(n)) == 0)
+ bb9:	89 d8                	mov    %ebx,%eax
+ bbb:	e8 c0 fd ff ff       	call   980 <runalloc>
+ bc0:	85 c0                	test   %eax,%eax
+ bc2:	0f 84 b8 00 00 00    	je     c80 <malloc+0xf0>
+      return 0;
+    p->kind = PRUN;
+ bc8:	ba 02 00 00 00       	mov    $0x2,%edx
+ bcd:	66 89 10             	mov    %dx,(%eax)
+  }
+  p->npages = n;
+ bd0:	89 58 04             	mov    %ebx,0x4(%eax)
+  return (char*)p + HDRSIZE;
+ bd3:	8d 58 20             	lea    0x20(%eax),%ebx
+}
+ bd6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ bd9:	89 d8                	mov    %ebx,%eax
+ bdb:	5b                   	pop    %ebx
+ bdc:	5e                   	pop    %esi
+ bdd:	5d                   	pop    %ebp
+ bde:	c3                   	ret
+ bdf:	90                   	nop
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+ be0:	83 ec 08             	sub    $0x8,%esp
+ be3:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+ be9:	6a 00                	push   $0x0
+ beb:	6a ff                	push   $0xffffffff
+ bed:	6a 22                	push   $0x22
+ bef:	6a 03                	push   $0x3
+ bf1:	52                   	push   %edx
+ bf2:	6a 00                	push   $0x0
+ bf4:	e8 52 f9 ff ff       	call   54b <mmap>
+    if(p == MAP_FAILED)
+ bf9:	83 c4 20             	add    $0x20,%esp
+ bfc:	83 f8 ff             	cmp    $0xffffffff,%eax
+ bff:	74 7f                	je     c80 <malloc+0xf0>
+    p->kind = PMAP;
+ c01:	b9 04 00 00 00       	mov    $0x4,%ecx
+ c06:	66 89 08             	mov    %cx,(%eax)
+ c09:	eb c5                	jmp    bd0 <malloc+0x40>
+ c0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c0f:	90                   	nop
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ c10:	83 f8 10             	cmp    $0x10,%eax
+ c13:	0f 86 07 01 00 00    	jbe    d20 <malloc+0x190>
+ c19:	31 db                	xor    %ebx,%ebx
+ c1b:	ba 10 00 00 00       	mov    $0x10,%edx
+ c20:	83 c3 01             	add    $0x1,%ebx
+ c23:	89 d6                	mov    %edx,%esi
+ c25:	89 d9                	mov    %ebx,%ecx
+ c27:	d3 e6                	shl    %cl,%esi
+ c29:	39 c6                	cmp    %eax,%esi
+ c2b:	72 f3                	jb     c20 <malloc+0x90>
+  if((p = partial[c]) == 0){
+ c2d:	8b 14 9d 88 13 00 00 	mov    0x1388(,%ebx,4),%edx
+ c34:	85 d2                	test   %edx,%edx
+ c36:	74 58                	je     c90 <malloc+0x100>
+  if((b = p->free) != 0){
+ c38:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ c3b:	8b 4a 08             	mov    0x8(%edx),%ecx
+  if((b = p->free) != 0){
+ c3e:	85 db                	test   %ebx,%ebx
+ c40:	0f 84 aa 00 00 00    	je     cf0 <malloc+0x160>
+    p->free = b->next;
+ c46:	8b 03                	mov    (%ebx),%eax
+ c48:	89 42 0c             	mov    %eax,0xc(%edx)
+  if(--p->nfree == 0)
+ c4b:	83 e9 01             	sub    $0x1,%ecx
+ c4e:	89 4a 08             	mov    %ecx,0x8(%edx)
+ c51:	75 83                	jne    bd6 <malloc+0x46>
+  if(p->prev)
+ c53:	8b 4a 18             	mov    0x18(%edx),%ecx
+    p->prev->next = p->next;
+ c56:	8b 42 14             	mov    0x14(%edx),%eax
+  if(p->prev)
+ c59:	85 c9                	test   %ecx,%ecx
+ c5b:	0f 84 cf 00 00 00    	je     d30 <malloc+0x1a0>
+    p->prev->next = p->next;
+ c61:	89 41 14             	mov    %eax,0x14(%ecx)
+  if(p->next)
+ c64:	85 c0                	test   %eax,%eax
+ c66:	0f 84 6a ff ff ff    	je     bd6 <malloc+0x46>
+    p->next->prev = p->prev;
+ c6c:	8b 52 18             	mov    0x18(%edx),%edx
+ c6f:	89 50 18             	mov    %edx,0x18(%eax)
+ c72:	e9 5f ff ff ff       	jmp    bd6 <malloc+0x46>
+ c77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c7e:	66 90                	xchg   %ax,%ax
+}
+ c80:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+ c83:	31 db                	xor    %ebx,%ebx
+}
+ c85:	89 d8                	mov    %ebx,%eax
+ c87:	5b                   	pop    %ebx
+ c88:	5e                   	pop    %esi
+ c89:	5d                   	pop    %ebp
+ c8a:	c3                   	ret
+ c8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c8f:	90                   	nop
+    if((p = runalloc(1)) == 0)
+ c90:	b8 01 00 00 00       	mov    $0x1,%eax
+ c95:	e8 e6 fc ff ff       	call   980 <runalloc>
+ c9a:	89 c2                	mov    %eax,%edx
+ c9c:	85 c0                	test   %eax,%eax
+ c9e:	74 e0                	je     c80 <malloc+0xf0>
+    p->kind = PSMALL;
+ ca0:	b8 01 00 00 00       	mov    $0x1,%eax
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ ca5:	8d 4b 04             	lea    0x4(%ebx),%ecx
+    p->class = c;
+ ca8:	66 89 5a 02          	mov    %bx,0x2(%edx)
+ cac:	0f b7 db             	movzwl %bx,%ebx
+    p->kind = PSMALL;
+ caf:	66 89 02             	mov    %ax,(%edx)
+    p->fresh = (char*)p + HDRSIZE;
+ cb2:	8d 42 20             	lea    0x20(%edx),%eax
+ cb5:	89 42 10             	mov    %eax,0x10(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ cb8:	b8 e0 0f 00 00       	mov    $0xfe0,%eax
+ cbd:	d3 f8                	sar    %cl,%eax
+    p->free = 0;
+ cbf:	c7 42 0c 00 00 00 00 	movl   $0x0,0xc(%edx)
+    p->nfree = nblocks(c);
+ cc6:	89 42 08             	mov    %eax,0x8(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ cc9:	89 c1                	mov    %eax,%ecx
+  p->next = partial[p->class];
+ ccb:	8b 04 9d 88 13 00 00 	mov    0x1388(,%ebx,4),%eax
+  p->prev = 0;
+ cd2:	c7 42 18 00 00 00 00 	movl   $0x0,0x18(%edx)
+  p->next = partial[p->class];
+ cd9:	89 42 14             	mov    %eax,0x14(%edx)
+  if(p->next)
+ cdc:	85 c0                	test   %eax,%eax
+ cde:	75 20                	jne    d00 <malloc+0x170>
+  partial[p->class] = p;
+ ce0:	89 14 9d 88 13 00 00 	mov    %edx,0x1388(,%ebx,4)
+  if((b = p->free) != 0){
+ ce7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cee:	66 90                	xchg   %ax,%ax
+    b = (struct block*)p->fresh;
+ cf0:	8b 5a 10             	mov    0x10(%edx),%ebx
+    p->fresh += MINSMALL << c;
+ cf3:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+ cf6:	89 42 10             	mov    %eax,0x10(%edx)
+ cf9:	e9 4d ff ff ff       	jmp    c4b <malloc+0xbb>
+ cfe:	66 90                	xchg   %ax,%ax
+    p->next->prev = p;
+ d00:	89 50 18             	mov    %edx,0x18(%eax)
+  partial[p->class] = p;
+ d03:	0f b7 42 02          	movzwl 0x2(%edx),%eax
+  if((b = p->free) != 0){
+ d07:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ d0a:	8b 4a 08             	mov    0x8(%edx),%ecx
+  partial[p->class] = p;
+ d0d:	89 14 85 88 13 00 00 	mov    %edx,0x1388(,%eax,4)
+}
+ d14:	e9 25 ff ff ff       	jmp    c3e <malloc+0xae>
+ d19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ d20:	be 10 00 00 00       	mov    $0x10,%esi
+ d25:	31 db                	xor    %ebx,%ebx
+ d27:	e9 01 ff ff ff       	jmp    c2d <malloc+0x9d>
+ d2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ d30:	0f b7 4a 02          	movzwl 0x2(%edx),%ecx
+ d34:	89 04 8d 88 13 00 00 	mov    %eax,0x1388(,%ecx,4)
+ d3b:	e9 24 ff ff ff       	jmp    c64 <malloc+0xd4>
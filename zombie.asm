@@ -0,0 +1,1682 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 95 02 00 00       	call   2ab <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7e 0d                	jle    27 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+  1a:	83 ec 0c             	sub    $0xc,%esp
+  1d:	6a 05                	push   $0x5
+  1f:	e8 1f 03 00 00       	call   343 <sleep>
+  24:	83 c4 10             	add    $0x10,%esp
+  exit();
+  27:	e8 87 02 00 00       	call   2b3 <exit>
+  2c:	66 90                	xchg   %ax,%ax
+  2e:	66 90                	xchg   %ax,%ax
+
+00000030 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  30:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  31:	31 c0                	xor    %eax,%eax
+{
+  33:	89 e5                	mov    %esp,%ebp
+  35:	53                   	push   %ebx
+  36:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  40:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  44:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  47:	83 c0 01             	add    $0x1,%eax
+  4a:	84 d2                	test   %dl,%dl
+  4c:	75 f2                	jne    40 <strcpy+0x10>
+    ;
+  return os;
+}
+  4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  51:	89 c8                	mov    %ecx,%eax
+  53:	c9                   	leave
+  54:	c3                   	ret
+  55:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000060 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	53                   	push   %ebx
+  64:	8b 55 08             	mov    0x8(%ebp),%edx
+  67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  6a:	0f b6 02             	movzbl (%edx),%eax
+  6d:	84 c0                	test   %al,%al
+  6f:	75 17                	jne    88 <strcmp+0x28>
+  71:	eb 3a                	jmp    ad <strcmp+0x4d>
+  73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  77:	90                   	nop
+  78:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  7c:	83 c2 01             	add    $0x1,%edx
+  7f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  82:	84 c0                	test   %al,%al
+  84:	74 1a                	je     a0 <strcmp+0x40>
+    p++, q++;
+  86:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  88:	0f b6 19             	movzbl (%ecx),%ebx
+  8b:	38 c3                	cmp    %al,%bl
+  8d:	74 e9                	je     78 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  8f:	29 d8                	sub    %ebx,%eax
+}
+  91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  94:	c9                   	leave
+  95:	c3                   	ret
+  96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  a4:	31 c0                	xor    %eax,%eax
+  a6:	29 d8                	sub    %ebx,%eax
+}
+  a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  ab:	c9                   	leave
+  ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  ad:	0f b6 19             	movzbl (%ecx),%ebx
+  b0:	31 c0                	xor    %eax,%eax
+  b2:	eb db                	jmp    8f <strcmp+0x2f>
+  b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  bf:	90                   	nop
+
+000000c0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  c6:	80 3a 00             	cmpb   $0x0,(%edx)
+  c9:	74 15                	je     e0 <strlen+0x20>
+  cb:	31 c0                	xor    %eax,%eax
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+  d0:	83 c0 01             	add    $0x1,%eax
+  d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  d7:	89 c1                	mov    %eax,%ecx
+  d9:	75 f5                	jne    d0 <strlen+0x10>
+    ;
+  return n;
+}
+  db:	89 c8                	mov    %ecx,%eax
+  dd:	5d                   	pop    %ebp
+  de:	c3                   	ret
+  df:	90                   	nop
+  for(n = 0; s[n]; n++)
+  e0:	31 c9                	xor    %ecx,%ecx
+}
+  e2:	5d                   	pop    %ebp
+  e3:	89 c8                	mov    %ecx,%eax
+  e5:	c3                   	ret
+  e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000000f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	57                   	push   %edi
+  f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  fd:	89 d7                	mov    %edx,%edi
+  ff:	fc                   	cld
+ 100:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 102:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 105:	89 d0                	mov    %edx,%eax
+ 107:	c9                   	leave
+ 108:	c3                   	ret
+ 109:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000110 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	8b 45 08             	mov    0x8(%ebp),%eax
+ 116:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 11a:	0f b6 10             	movzbl (%eax),%edx
+ 11d:	84 d2                	test   %dl,%dl
+ 11f:	75 12                	jne    133 <strchr+0x23>
+ 121:	eb 1d                	jmp    140 <strchr+0x30>
+ 123:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 127:	90                   	nop
+ 128:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 12c:	83 c0 01             	add    $0x1,%eax
+ 12f:	84 d2                	test   %dl,%dl
+ 131:	74 0d                	je     140 <strchr+0x30>
+    if(*s == c)
+ 133:	38 d1                	cmp    %dl,%cl
+ 135:	75 f1                	jne    128 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 137:	5d                   	pop    %ebp
+ 138:	c3                   	ret
+ 139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 140:	31 c0                	xor    %eax,%eax
+}
+ 142:	5d                   	pop    %ebp
+ 143:	c3                   	ret
+ 144:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 14f:	90                   	nop
+
+00000150 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	57                   	push   %edi
+ 154:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 155:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 158:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 159:	31 db                	xor    %ebx,%ebx
+{
+ 15b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 15e:	eb 27                	jmp    187 <gets+0x37>
+    cc = read(0, &c, 1);
+ 160:	83 ec 04             	sub    $0x4,%esp
+ 163:	6a 01                	push   $0x1
+ 165:	56                   	push   %esi
+ 166:	6a 00                	push   $0x0
+ 168:	e8 5e 01 00 00       	call   2cb <read>
+    if(cc < 1)
+ 16d:	83 c4 10             	add    $0x10,%esp
+ 170:	85 c0                	test   %eax,%eax
+ 172:	7e 1d                	jle    191 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 174:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 178:	8b 55 08             	mov    0x8(%ebp),%edx
+ 17b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 17f:	3c 0a                	cmp    $0xa,%al
+ 181:	74 10                	je     193 <gets+0x43>
+ 183:	3c 0d                	cmp    $0xd,%al
+ 185:	74 0c                	je     193 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 187:	89 df                	mov    %ebx,%edi
+ 189:	83 c3 01             	add    $0x1,%ebx
+ 18c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 18f:	7c cf                	jl     160 <gets+0x10>
+ 191:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 193:	8b 45 08             	mov    0x8(%ebp),%eax
+ 196:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 19a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 19d:	5b                   	pop    %ebx
+ 19e:	5e                   	pop    %esi
+ 19f:	5f                   	pop    %edi
+ 1a0:	5d                   	pop    %ebp
+ 1a1:	c3                   	ret
+ 1a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001b0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	56                   	push   %esi
+ 1b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1b5:	83 ec 08             	sub    $0x8,%esp
+ 1b8:	6a 00                	push   $0x0
+ 1ba:	ff 75 08             	push   0x8(%ebp)
+ 1bd:	e8 31 01 00 00       	call   2f3 <open>
+  if(fd < 0)
+ 1c2:	83 c4 10             	add    $0x10,%esp
+ 1c5:	85 c0                	test   %eax,%eax
+ 1c7:	78 27                	js     1f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1c9:	83 ec 08             	sub    $0x8,%esp
+ 1cc:	ff 75 0c             	push   0xc(%ebp)
+ 1cf:	89 c3                	mov    %eax,%ebx
+ 1d1:	50                   	push   %eax
+ 1d2:	e8 34 01 00 00       	call   30b <fstat>
+  close(fd);
+ 1d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 1da:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1dc:	e8 fa 00 00 00       	call   2db <close>
+  return r;
+ 1e1:	83 c4 10             	add    $0x10,%esp
+}
+ 1e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1e7:	89 f0                	mov    %esi,%eax
+ 1e9:	5b                   	pop    %ebx
+ 1ea:	5e                   	pop    %esi
+ 1eb:	5d                   	pop    %ebp
+ 1ec:	c3                   	ret
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 1f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1f5:	eb ed                	jmp    1e4 <stat+0x34>
+ 1f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fe:	66 90                	xchg   %ax,%ax
+
+00000200 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	53                   	push   %ebx
+ 204:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 207:	0f be 02             	movsbl (%edx),%eax
+ 20a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 20d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 210:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 215:	77 1e                	ja     235 <atoi+0x35>
+ 217:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 220:	83 c2 01             	add    $0x1,%edx
+ 223:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 226:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 22a:	0f be 02             	movsbl (%edx),%eax
+ 22d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 230:	80 fb 09             	cmp    $0x9,%bl
+ 233:	76 eb                	jbe    220 <atoi+0x20>
+  return n;
+}
+ 235:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 238:	89 c8                	mov    %ecx,%eax
+ 23a:	c9                   	leave
+ 23b:	c3                   	ret
+ 23c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000240 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+ 245:	8b 45 10             	mov    0x10(%ebp),%eax
+ 248:	8b 55 08             	mov    0x8(%ebp),%edx
+ 24b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 24e:	85 c0                	test   %eax,%eax
+ 250:	7e 13                	jle    265 <memmove+0x25>
+ 252:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 254:	89 d7                	mov    %edx,%edi
+ 256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 260:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 261:	39 f8                	cmp    %edi,%eax
+ 263:	75 fb                	jne    260 <memmove+0x20>
+  return vdst;
+}
+ 265:	5e                   	pop    %esi
+ 266:	89 d0                	mov    %edx,%eax
+ 268:	5f                   	pop    %edi
+ 269:	5d                   	pop    %ebp
+ 26a:	c3                   	ret
+
+0000026b <ccreate>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(ccreate)
+ 26b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 270:	cd 40                	int    $0x40
+ 272:	c3                   	ret
+
+00000273 <cfork>:
+SYSCALL(cfork)
+ 273:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 278:	cd 40                	int    $0x40
+ 27a:	c3                   	ret
+
+0000027b <cgetrootdir>:
+SYSCALL(cgetrootdir)
+ 27b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 280:	cd 40                	int    $0x40
+ 282:	c3                   	ret
+
+00000283 <getcontrootdir>:
+SYSCALL(getcontrootdir)
+ 283:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 288:	cd 40                	int    $0x40
+ 28a:	c3                   	ret
+
+0000028b <cpause>:
+SYSCALL(cpause)
+ 28b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 290:	cd 40                	int    $0x40
+ 292:	c3                   	ret
+
+00000293 <cresume>:
+SYSCALL(cresume)
+ 293:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 298:	cd 40                	int    $0x40
+ 29a:	c3                   	ret
+
+0000029b <cstart>:
+SYSCALL(cstart)
+ 29b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 2a0:	cd 40                	int    $0x40
+ 2a2:	c3                   	ret
+
+000002a3 <cstop>:
+SYSCALL(cstop)
+ 2a3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 2a8:	cd 40                	int    $0x40
+ 2aa:	c3                   	ret
+
+000002ab <fork>:
+SYSCALL(fork)
+ 2ab:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2b0:	cd 40                	int    $0x40
+ 2b2:	c3                   	ret
+
+000002b3 <exit>:
+SYSCALL(exit)
+ 2b3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2b8:	cd 40                	int    $0x40
+ 2ba:	c3                   	ret
+
+000002bb <wait>:
+SYSCALL(wait)
+ 2bb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2c0:	cd 40                	int    $0x40
+ 2c2:	c3                   	ret
+
+000002c3 <pipe>:
+SYSCALL(pipe)
+ 2c3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2c8:	cd 40                	int    $0x40
+ 2ca:	c3                   	ret
+
+000002cb <read>:
+SYSCALL(read)
+ 2cb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2d0:	cd 40                	int    $0x40
+ 2d2:	c3                   	ret
+
+000002d3 <write>:
+SYSCALL(write)
+ 2d3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2d8:	cd 40                	int    $0x40
+ 2da:	c3                   	ret
+
+000002db <close>:
+SYSCALL(close)
+ 2db:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2e0:	cd 40                	int    $0x40
+ 2e2:	c3                   	ret
+
+000002e3 <kill>:
+SYSCALL(kill)
+ 2e3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2e8:	cd 40                	int    $0x40
+ 2ea:	c3                   	ret
+
+000002eb <exec>:
+SYSCALL(exec)
+ 2eb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2f0:	cd 40                	int    $0x40
+ 2f2:	c3                   	ret
+
+000002f3 <open>:
+SYSCALL(open)
+ 2f3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2f8:	cd 40                	int    $0x40
+ 2fa:	c3                   	ret
+
+000002fb <mknod>:
+SYSCALL(mknod)
+ 2fb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <unlink>:
+SYSCALL(unlink)
+ 303:	b8 12 00 00 00       	mov    $0x12,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <fstat>:
+SYSCALL(fstat)
+ 30b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <link>:
+SYSCALL(link)
+ 313:	b8 13 00 00 00       	mov    $0x13,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <mkdir>:
+SYSCALL(mkdir)
+ 31b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <chdir>:
+SYSCALL(chdir)
+ 323:	b8 09 00 00 00       	mov    $0x9,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <dup>:
+SYSCALL(dup)
+ 32b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <getpid>:
+SYSCALL(getpid)
+ 333:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <sbrk>:
+SYSCALL(sbrk)
+ 33b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <sleep>:
+SYSCALL(sleep)
+ 343:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <uptime>:
+SYSCALL(uptime)
+ 34b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <cps>:
+SYSCALL(cps)
+ 353:	b8 16 00 00 00       	mov    $0x16,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <mmap>:
+SYSCALL(mmap)
+ 35b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <munmap>:
+SYSCALL(munmap)
+ 363:	b8 20 00 00 00       	mov    $0x20,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <shmget>:
+SYSCALL(shmget)
+ 36b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <climit>:
+SYSCALL(climit)
+ 373:	b8 22 00 00 00       	mov    $0x22,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <spawn>:
+SYSCALL(spawn)
+ 37b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <clone>:
+SYSCALL(clone)
+ 383:	b8 24 00 00 00       	mov    $0x24,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <join>:
+SYSCALL(join)
+ 38b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <futex>:
+SYSCALL(futex)
+ 393:	b8 26 00 00 00       	mov    $0x26,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <ccheckpoint>:
+SYSCALL(ccheckpoint)
+ 39b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <crestore>:
+SYSCALL(crestore)
+ 3a3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <czygote>:
+SYSCALL(czygote)
+ 3ab:	b8 29 00 00 00       	mov    $0x29,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <memstats>:
+SYSCALL(memstats)
+ 3b3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+ 3bb:	66 90                	xchg   %ax,%ax
+ 3bd:	66 90                	xchg   %ax,%ax
+ 3bf:	90                   	nop
+
+000003c0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	57                   	push   %edi
+ 3c4:	56                   	push   %esi
+ 3c5:	53                   	push   %ebx
+ 3c6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 3c8:	89 d1                	mov    %edx,%ecx
+{
+ 3ca:	83 ec 3c             	sub    $0x3c,%esp
+ 3cd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 3d0:	85 d2                	test   %edx,%edx
+ 3d2:	0f 89 80 00 00 00    	jns    458 <printint+0x98>
+ 3d8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 3dc:	74 7a                	je     458 <printint+0x98>
+    x = -xx;
+ 3de:	f7 d9                	neg    %ecx
+    neg = 1;
+ 3e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 3e5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 3e8:	31 f6                	xor    %esi,%esi
+ 3ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 3f0:	89 c8                	mov    %ecx,%eax
+ 3f2:	31 d2                	xor    %edx,%edx
+ 3f4:	89 f7                	mov    %esi,%edi
+ 3f6:	f7 f3                	div    %ebx
+ 3f8:	8d 76 01             	lea    0x1(%esi),%esi
+ 3fb:	0f b6 92 b0 0b 00 00 	movzbl 0xbb0(%edx),%edx
+ 402:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 406:	89 ca                	mov    %ecx,%edx
+ 408:	89 c1                	mov    %eax,%ecx
+ 40a:	39 da                	cmp    %ebx,%edx
+ 40c:	73 e2                	jae    3f0 <printint+0x30>
+  if(neg)
+ 40e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 411:	85 c0                	test   %eax,%eax
+ 413:	74 07                	je     41c <printint+0x5c>
+    buf[i++] = '-';
+ 415:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 41a:	89 f7                	mov    %esi,%edi
+ 41c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 41f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 422:	01 df                	add    %ebx,%edi
+ 424:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 428:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 42b:	83 ec 04             	sub    $0x4,%esp
+ 42e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 431:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 434:	6a 01                	push   $0x1
+ 436:	50                   	push   %eax
+ 437:	56                   	push   %esi
+ 438:	e8 96 fe ff ff       	call   2d3 <write>
+  while(--i >= 0)
+ 43d:	89 f8                	mov    %edi,%eax
+ 43f:	83 c4 10             	add    $0x10,%esp
+ 442:	83 ef 01             	sub    $0x1,%edi
+ 445:	39 d8                	cmp    %ebx,%eax
+ 447:	75 df                	jne    428 <printint+0x68>
+}
+ 449:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 44c:	5b                   	pop    %ebx
+ 44d:	5e                   	pop    %esi
+ 44e:	5f                   	pop    %edi
+ 44f:	5d                   	pop    %ebp
+ 450:	c3                   	ret
+ 451:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 458:	31 c0                	xor    %eax,%eax
+ 45a:	eb 89                	jmp    3e5 <printint+0x25>
+ 45c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000460 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+ 465:	53                   	push   %ebx
+ 466:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 469:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 46c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 46f:	0f b6 1e             	movzbl (%esi),%ebx
+ 472:	83 c6 01             	add    $0x1,%esi
+ 475:	84 db                	test   %bl,%bl
+ 477:	74 67                	je     4e0 <printf+0x80>
+ 479:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 47c:	31 d2                	xor    %edx,%edx
+ 47e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 481:	eb 34                	jmp    4b7 <printf+0x57>
+ 483:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 487:	90                   	nop
+ 488:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 48b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 490:	83 f8 25             	cmp    $0x25,%eax
+ 493:	74 18                	je     4ad <printf+0x4d>
+  write(fd, &c, 1);
+ 495:	83 ec 04             	sub    $0x4,%esp
+ 498:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 49b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 49e:	6a 01                	push   $0x1
+ 4a0:	50                   	push   %eax
+ 4a1:	57                   	push   %edi
+ 4a2:	e8 2c fe ff ff       	call   2d3 <write>
+ 4a7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 4aa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 4ad:	0f b6 1e             	movzbl (%esi),%ebx
+ 4b0:	83 c6 01             	add    $0x1,%esi
+ 4b3:	84 db                	test   %bl,%bl
+ 4b5:	74 29                	je     4e0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 4b7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 4ba:	85 d2                	test   %edx,%edx
+ 4bc:	74 ca                	je     488 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 4be:	83 fa 25             	cmp    $0x25,%edx
+ 4c1:	75 ea                	jne    4ad <printf+0x4d>
+      if(c == 'd'){
+ 4c3:	83 f8 25             	cmp    $0x25,%eax
+ 4c6:	0f 84 24 01 00 00    	je     5f0 <printf+0x190>
+ 4cc:	83 e8 63             	sub    $0x63,%eax
+ 4cf:	83 f8 15             	cmp    $0x15,%eax
+ 4d2:	77 1c                	ja     4f0 <printf+0x90>
+ 4d4:	ff 24 85 58 0b 00 00 	jmp    *0xb58(,%eax,4)
+ 4db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4df:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 4e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4e3:	5b                   	pop    %ebx
+ 4e4:	5e                   	pop    %esi
+ 4e5:	5f                   	pop    %edi
+ 4e6:	5d                   	pop    %ebp
+ 4e7:	c3                   	ret
+ 4e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ef:	90                   	nop
+  write(fd, &c, 1);
+ 4f0:	83 ec 04             	sub    $0x4,%esp
+ 4f3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 4f6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 4fa:	6a 01                	push   $0x1
+ 4fc:	52                   	push   %edx
+ 4fd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 500:	57                   	push   %edi
+ 501:	e8 cd fd ff ff       	call   2d3 <write>
+ 506:	83 c4 0c             	add    $0xc,%esp
+ 509:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 50c:	6a 01                	push   $0x1
+ 50e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 511:	52                   	push   %edx
+ 512:	57                   	push   %edi
+ 513:	e8 bb fd ff ff       	call   2d3 <write>
+        putc(fd, c);
+ 518:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 51b:	31 d2                	xor    %edx,%edx
+ 51d:	eb 8e                	jmp    4ad <printf+0x4d>
+ 51f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 520:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 523:	83 ec 0c             	sub    $0xc,%esp
+ 526:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 52b:	8b 13                	mov    (%ebx),%edx
+ 52d:	6a 00                	push   $0x0
+ 52f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 531:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 534:	e8 87 fe ff ff       	call   3c0 <printint>
+        ap++;
+ 539:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 53c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 53f:	31 d2                	xor    %edx,%edx
+ 541:	e9 67 ff ff ff       	jmp    4ad <printf+0x4d>
+ 546:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 54d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 550:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 553:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 555:	83 c0 04             	add    $0x4,%eax
+ 558:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 55b:	85 db                	test   %ebx,%ebx
+ 55d:	0f 84 9d 00 00 00    	je     600 <printf+0x1a0>
+        while(*s != 0){
+ 563:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 566:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 568:	84 c0                	test   %al,%al
+ 56a:	0f 84 3d ff ff ff    	je     4ad <printf+0x4d>
+ 570:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 573:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 576:	89 de                	mov    %ebx,%esi
+ 578:	89 d3                	mov    %edx,%ebx
+ 57a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 580:	83 ec 04             	sub    $0x4,%esp
+ 583:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 586:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 589:	6a 01                	push   $0x1
+ 58b:	53                   	push   %ebx
+ 58c:	57                   	push   %edi
+ 58d:	e8 41 fd ff ff       	call   2d3 <write>
+        while(*s != 0){
+ 592:	0f b6 06             	movzbl (%esi),%eax
+ 595:	83 c4 10             	add    $0x10,%esp
+ 598:	84 c0                	test   %al,%al
+ 59a:	75 e4                	jne    580 <printf+0x120>
+      state = 0;
+ 59c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 59f:	31 d2                	xor    %edx,%edx
+ 5a1:	e9 07 ff ff ff       	jmp    4ad <printf+0x4d>
+ 5a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ad:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 5b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5b3:	83 ec 0c             	sub    $0xc,%esp
+ 5b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5bb:	8b 13                	mov    (%ebx),%edx
+ 5bd:	6a 01                	push   $0x1
+ 5bf:	e9 6b ff ff ff       	jmp    52f <printf+0xcf>
+ 5c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 5c8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 5cb:	83 ec 04             	sub    $0x4,%esp
+ 5ce:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 5d1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 5d3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 5d6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5d9:	6a 01                	push   $0x1
+ 5db:	52                   	push   %edx
+ 5dc:	57                   	push   %edi
+ 5dd:	e8 f1 fc ff ff       	call   2d3 <write>
+        ap++;
+ 5e2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 5e5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5e8:	31 d2                	xor    %edx,%edx
+ 5ea:	e9 be fe ff ff       	jmp    4ad <printf+0x4d>
+ 5ef:	90                   	nop
+  write(fd, &c, 1);
+ 5f0:	83 ec 04             	sub    $0x4,%esp
+ 5f3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5f6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5f9:	6a 01                	push   $0x1
+ 5fb:	e9 11 ff ff ff       	jmp    511 <printf+0xb1>
+ 600:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 605:	bb 50 0b 00 00       	mov    $0xb50,%ebx
+ 60a:	e9 61 ff ff ff       	jmp    570 <printf+0x110>
+ 60f:	90                   	nop
+
+00000610 <runfree>:
+
+// Give the n pages at r back to the free runs, merging them with
+// adjacent runs, and shrink the heap if the end of it is free.
+static void
+runfree(struct page *r, uint n)
+{
+ 610:	55                   	push   %ebp
+  struct page **pp, *prev;
+
+  r->kind = PFREE;
+ 611:	b9 03 00 00 00       	mov    $0x3,%ecx
+{
+ 616:	89 e5                	mov    %esp,%ebp
+ 618:	57                   	push   %edi
+ 619:	56                   	push   %esi
+ 61a:	53                   	push   %ebx
+ 61b:	89 c3                	mov    %eax,%ebx
+ 61d:	83 ec 0c             	sub    $0xc,%esp
+  r->kind = PFREE;
+ 620:	66 89 08             	mov    %cx,(%eax)
+  r->npages = n;
+  prev = 0;
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 623:	8b 0d c0 0e 00 00    	mov    0xec0,%ecx
+  r->npages = n;
+ 629:	89 50 04             	mov    %edx,0x4(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 62c:	85 c9                	test   %ecx,%ecx
+ 62e:	0f 84 1f 01 00 00    	je     753 <runfree+0x143>
+ 634:	39 c1                	cmp    %eax,%ecx
+ 636:	0f 83 f7 00 00 00    	jae    733 <runfree+0x123>
+ 63c:	89 c8                	mov    %ecx,%eax
+ 63e:	eb 04                	jmp    644 <runfree+0x34>
+ 640:	39 d8                	cmp    %ebx,%eax
+ 642:	73 09                	jae    64d <runfree+0x3d>
+ 644:	89 c2                	mov    %eax,%edx
+ 646:	8b 40 14             	mov    0x14(%eax),%eax
+ 649:	85 c0                	test   %eax,%eax
+ 64b:	75 f3                	jne    640 <runfree+0x30>
+    prev = *pp;
+  r->next = *pp;
+ 64d:	89 43 14             	mov    %eax,0x14(%ebx)
+  *pp = r;
+ 650:	89 5a 14             	mov    %ebx,0x14(%edx)
+
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 653:	8b 43 14             	mov    0x14(%ebx),%eax
+ 656:	85 c0                	test   %eax,%eax
+ 658:	74 12                	je     66c <runfree+0x5c>
+ 65a:	8b 7b 04             	mov    0x4(%ebx),%edi
+ 65d:	89 fe                	mov    %edi,%esi
+ 65f:	c1 e6 0c             	shl    $0xc,%esi
+ 662:	01 de                	add    %ebx,%esi
+ 664:	39 f0                	cmp    %esi,%eax
+ 666:	0f 84 a4 00 00 00    	je     710 <runfree+0x100>
+    r->npages += r->next->npages;
+    r->next = r->next->next;
+  }
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 66c:	8b 72 04             	mov    0x4(%edx),%esi
+ 66f:	89 f0                	mov    %esi,%eax
+ 671:	c1 e0 0c             	shl    $0xc,%eax
+ 674:	01 d0                	add    %edx,%eax
+ 676:	39 c3                	cmp    %eax,%ebx
+ 678:	74 16                	je     690 <runfree+0x80>
+    pp = &runs;
+    while(*pp != r)
+      pp = &(*pp)->next;
+  }
+
+  if(r->next == 0 && r->npages >= TRIM &&
+ 67a:	8b 43 14             	mov    0x14(%ebx),%eax
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 67d:	8d 72 14             	lea    0x14(%edx),%esi
+  if(r->next == 0 && r->npages >= TRIM &&
+ 680:	85 c0                	test   %eax,%eax
+ 682:	74 3c                	je     6c0 <runfree+0xb0>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+    *pp = 0;
+    sbrk(-(int)(r->npages*PGSIZE));
+    heapend = (char*)r;
+  }
+}
+ 684:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 687:	5b                   	pop    %ebx
+ 688:	5e                   	pop    %esi
+ 689:	5f                   	pop    %edi
+ 68a:	5d                   	pop    %ebp
+ 68b:	c3                   	ret
+ 68c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    prev->npages += r->npages;
+ 690:	03 73 04             	add    0x4(%ebx),%esi
+ 693:	89 72 04             	mov    %esi,0x4(%edx)
+    prev->next = r->next;
+ 696:	8b 43 14             	mov    0x14(%ebx),%eax
+ 699:	89 42 14             	mov    %eax,0x14(%edx)
+    while(*pp != r)
+ 69c:	39 d1                	cmp    %edx,%ecx
+ 69e:	0f 84 c5 00 00 00    	je     769 <runfree+0x159>
+ 6a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      pp = &(*pp)->next;
+ 6a8:	89 cb                	mov    %ecx,%ebx
+ 6aa:	8b 49 14             	mov    0x14(%ecx),%ecx
+    while(*pp != r)
+ 6ad:	39 d1                	cmp    %edx,%ecx
+ 6af:	75 f7                	jne    6a8 <runfree+0x98>
+      pp = &(*pp)->next;
+ 6b1:	8d 73 14             	lea    0x14(%ebx),%esi
+ 6b4:	89 cb                	mov    %ecx,%ebx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 6b6:	85 c0                	test   %eax,%eax
+ 6b8:	75 ca                	jne    684 <runfree+0x74>
+ 6ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 6c0:	8b 53 04             	mov    0x4(%ebx),%edx
+ 6c3:	83 fa 1f             	cmp    $0x1f,%edx
+ 6c6:	76 bc                	jbe    684 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 6c8:	c1 e2 0c             	shl    $0xc,%edx
+ 6cb:	01 da                	add    %ebx,%edx
+  if(r->next == 0 && r->npages >= TRIM &&
+ 6cd:	39 15 bc 0e 00 00    	cmp    %edx,0xebc
+ 6d3:	75 af                	jne    684 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ 6d5:	83 ec 0c             	sub    $0xc,%esp
+ 6d8:	6a 00                	push   $0x0
+ 6da:	e8 5c fc ff ff       	call   33b <sbrk>
+ 6df:	83 c4 10             	add    $0x10,%esp
+ 6e2:	39 05 bc 0e 00 00    	cmp    %eax,0xebc
+ 6e8:	75 9a                	jne    684 <runfree+0x74>
+    *pp = 0;
+ 6ea:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    sbrk(-(int)(r->npages*PGSIZE));
+ 6f0:	8b 43 04             	mov    0x4(%ebx),%eax
+ 6f3:	83 ec 0c             	sub    $0xc,%esp
+ 6f6:	c1 e0 0c             	shl    $0xc,%eax
+ 6f9:	f7 d8                	neg    %eax
+ 6fb:	50                   	push   %eax
+ 6fc:	e8 3a fc ff ff       	call   33b <sbrk>
+    heapend = (char*)r;
+ 701:	89 1d bc 0e 00 00    	mov    %ebx,0xebc
+ 707:	83 c4 10             	add    $0x10,%esp
+}
+ 70a:	e9 75 ff ff ff       	jmp    684 <runfree+0x74>
+ 70f:	90                   	nop
+    r->npages += r->next->npages;
+ 710:	03 78 04             	add    0x4(%eax),%edi
+ 713:	89 7b 04             	mov    %edi,0x4(%ebx)
+    r->next = r->next->next;
+ 716:	8b 40 14             	mov    0x14(%eax),%eax
+ 719:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 71c:	8b 72 04             	mov    0x4(%edx),%esi
+ 71f:	89 f0                	mov    %esi,%eax
+ 721:	c1 e0 0c             	shl    $0xc,%eax
+ 724:	01 d0                	add    %edx,%eax
+ 726:	39 c3                	cmp    %eax,%ebx
+ 728:	0f 85 4c ff ff ff    	jne    67a <runfree+0x6a>
+ 72e:	e9 5d ff ff ff       	jmp    690 <runfree+0x80>
+  r->next = *pp;
+ 733:	89 48 14             	mov    %ecx,0x14(%eax)
+  *pp = r;
+ 736:	a3 c0 0e 00 00       	mov    %eax,0xec0
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ 73b:	89 d0                	mov    %edx,%eax
+ 73d:	c1 e0 0c             	shl    $0xc,%eax
+ 740:	01 d8                	add    %ebx,%eax
+ 742:	39 c1                	cmp    %eax,%ecx
+ 744:	74 2f                	je     775 <runfree+0x165>
+  if(r->next == 0 && r->npages >= TRIM &&
+ 746:	8b 43 14             	mov    0x14(%ebx),%eax
+ 749:	be c0 0e 00 00       	mov    $0xec0,%esi
+ 74e:	e9 2d ff ff ff       	jmp    680 <runfree+0x70>
+  r->next = *pp;
+ 753:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 75a:	be c0 0e 00 00       	mov    $0xec0,%esi
+  *pp = r;
+ 75f:	a3 c0 0e 00 00       	mov    %eax,0xec0
+  if(r->next == 0 && r->npages >= TRIM &&
+ 764:	e9 5a ff ff ff       	jmp    6c3 <runfree+0xb3>
+    while(*pp != r)
+ 769:	89 cb                	mov    %ecx,%ebx
+    pp = &runs;
+ 76b:	be c0 0e 00 00       	mov    $0xec0,%esi
+ 770:	e9 0b ff ff ff       	jmp    680 <runfree+0x70>
+    r->npages += r->next->npages;
+ 775:	03 51 04             	add    0x4(%ecx),%edx
+ 778:	89 53 04             	mov    %edx,0x4(%ebx)
+    r->next = r->next->next;
+ 77b:	8b 41 14             	mov    0x14(%ecx),%eax
+ 77e:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ 781:	eb c3                	jmp    746 <runfree+0x136>
+ 783:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 78a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000790 <runalloc>:
+
+// Take a run of n pages from the start of the first free run
+// long enough, which keeps the end of the heap free to trim.
+static struct page*
+runalloc(uint n)
+{
+ 790:	55                   	push   %ebp
+ 791:	89 e5                	mov    %esp,%ebp
+ 793:	57                   	push   %edi
+ 794:	56                   	push   %esi
+ 795:	89 c6                	mov    %eax,%esi
+ 797:	53                   	push   %ebx
+ 798:	83 ec 1c             	sub    $0x1c,%esp
+  struct page **pp, *r, *rest;
+
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ 79b:	8b 1d c0 0e 00 00    	mov    0xec0,%ebx
+ 7a1:	85 db                	test   %ebx,%ebx
+ 7a3:	74 4d                	je     7f2 <runalloc+0x62>
+ 7a5:	b9 c0 0e 00 00       	mov    $0xec0,%ecx
+    if(r->npages < n)
+ 7aa:	39 73 04             	cmp    %esi,0x4(%ebx)
+ 7ad:	72 39                	jb     7e8 <runalloc+0x58>
+      continue;
+    if(r->npages == n){
+ 7af:	0f 84 9b 00 00 00    	je     850 <runalloc+0xc0>
+      *pp = r->next;
+    } else {
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ 7b5:	89 f0                	mov    %esi,%eax
+      rest->kind = PFREE;
+ 7b7:	ba 03 00 00 00       	mov    $0x3,%edx
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ 7bc:	c1 e0 0c             	shl    $0xc,%eax
+ 7bf:	01 d8                	add    %ebx,%eax
+      rest->kind = PFREE;
+ 7c1:	66 89 10             	mov    %dx,(%eax)
+      rest->npages = r->npages - n;
+ 7c4:	8b 53 04             	mov    0x4(%ebx),%edx
+ 7c7:	29 f2                	sub    %esi,%edx
+ 7c9:	89 50 04             	mov    %edx,0x4(%eax)
+      rest->next = r->next;
+ 7cc:	8b 53 14             	mov    0x14(%ebx),%edx
+ 7cf:	89 50 14             	mov    %edx,0x14(%eax)
+      *pp = rest;
+ 7d2:	89 01                	mov    %eax,(%ecx)
+      r->npages = n;
+ 7d4:	89 73 04             	mov    %esi,0x4(%ebx)
+    }
+    return r;
+  }
+  return morecore(n);
+}
+ 7d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7da:	89 d8                	mov    %ebx,%eax
+ 7dc:	5b                   	pop    %ebx
+ 7dd:	5e                   	pop    %esi
+ 7de:	5f                   	pop    %edi
+ 7df:	5d                   	pop    %ebp
+ 7e0:	c3                   	ret
+ 7e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ 7e8:	8d 4b 14             	lea    0x14(%ebx),%ecx
+ 7eb:	8b 5b 14             	mov    0x14(%ebx),%ebx
+ 7ee:	85 db                	test   %ebx,%ebx
+ 7f0:	75 b8                	jne    7aa <runalloc+0x1a>
+  m = n < MINCORE ? MINCORE : n;
+ 7f2:	bf 08 00 00 00       	mov    $0x8,%edi
+ 7f7:	39 fe                	cmp    %edi,%esi
+ 7f9:	0f 43 fe             	cmovae %esi,%edi
+  brk = sbrk(0);
+ 7fc:	83 ec 0c             	sub    $0xc,%esp
+ 7ff:	6a 00                	push   $0x0
+ 801:	e8 35 fb ff ff       	call   33b <sbrk>
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 806:	89 fa                	mov    %edi,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 808:	89 c3                	mov    %eax,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 80a:	c1 e2 0c             	shl    $0xc,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 80d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 810:	f7 db                	neg    %ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 812:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ 815:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ 81b:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+ 81e:	89 04 24             	mov    %eax,(%esp)
+ 821:	e8 15 fb ff ff       	call   33b <sbrk>
+ 826:	83 c4 10             	add    $0x10,%esp
+ 829:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 82c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 82f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 832:	74 3e                	je     872 <runalloc+0xe2>
+  r = (struct page*)(brk + pad);
+ 834:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ 836:	01 da                	add    %ebx,%edx
+ 838:	89 15 bc 0e 00 00    	mov    %edx,0xebc
+  if(m > n)
+ 83e:	39 fe                	cmp    %edi,%esi
+ 840:	72 1e                	jb     860 <runalloc+0xd0>
+  r->npages = n;
+ 842:	89 73 04             	mov    %esi,0x4(%ebx)
+  return r;
+ 845:	eb 90                	jmp    7d7 <runalloc+0x47>
+ 847:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 84e:	66 90                	xchg   %ax,%ax
+      *pp = r->next;
+ 850:	8b 43 14             	mov    0x14(%ebx),%eax
+ 853:	89 01                	mov    %eax,(%ecx)
+}
+ 855:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 858:	89 d8                	mov    %ebx,%eax
+ 85a:	5b                   	pop    %ebx
+ 85b:	5e                   	pop    %esi
+ 85c:	5f                   	pop    %edi
+ 85d:	5d                   	pop    %ebp
+ 85e:	c3                   	ret
+ 85f:	90                   	nop
+    runfree((struct page*)((char*)r + n*PGSIZE), m - n);
+ 860:	89 f0                	mov    %esi,%eax
+ 862:	29 f7                	sub    %esi,%edi
+ 864:	c1 e0 0c             	shl    $0xc,%eax
+ 867:	89 fa                	mov    %edi,%edx
+ 869:	01 d8                	add    %ebx,%eax
+ 86b:	e8 a0 fd ff ff       	call   610 <runfree>
+ 870:	eb d0                	jmp    842 <runalloc+0xb2>
+    if(sbrk(pad + m*PGSIZE) == (char*)-1)
+ 872:	89 f7                	mov    %esi,%edi
+ 874:	83 ec 0c             	sub    $0xc,%esp
+ 877:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 87a:	c1 e7 0c             	shl    $0xc,%edi
+ 87d:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+ 880:	50                   	push   %eax
+ 881:	e8 b5 fa ff ff       	call   33b <sbrk>
+ 886:	83 c4 10             	add    $0x10,%esp
+ 889:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 88c:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 88f:	74 0c                	je     89d <runalloc+0x10d>
+  r = (struct page*)(brk + pad);
+ 891:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ 893:	01 df                	add    %ebx,%edi
+ 895:	89 3d bc 0e 00 00    	mov    %edi,0xebc
+  if(m > n)
+ 89b:	eb a5                	jmp    842 <runalloc+0xb2>
+      return 0;
+ 89d:	31 db                	xor    %ebx,%ebx
+ 89f:	e9 33 ff ff ff       	jmp    7d7 <runalloc+0x47>
+ 8a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8af:	90                   	nop
+
+000008b0 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+ 8b0:	55                   	push   %ebp
+ 8b1:	89 e5                	mov    %esp,%ebp
+ 8b3:	56                   	push   %esi
+ 8b4:	53                   	push   %ebx
+ 8b5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  struct page *p;
+
+  if(ap == 0)
+ 8b8:	85 c9                	test   %ecx,%ecx
+ 8ba:	74 1c                	je     8d8 <free+0x28>
+    return;
+  p = (struct page*)((uint)ap & ~(PGSIZE-1));
+ 8bc:	89 c8                	mov    %ecx,%eax
+ 8be:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  switch(p->kind){
+ 8c3:	0f b7 10             	movzwl (%eax),%edx
+ 8c6:	66 83 fa 02          	cmp    $0x2,%dx
+ 8ca:	74 14                	je     8e0 <free+0x30>
+ 8cc:	66 83 fa 04          	cmp    $0x4,%dx
+ 8d0:	74 66                	je     938 <free+0x88>
+ 8d2:	66 83 fa 01          	cmp    $0x1,%dx
+ 8d6:	74 18                	je     8f0 <free+0x40>
+    break;
+  case PMAP:
+    munmap(p, p->npages*PGSIZE);
+    break;
+  }
+}
+ 8d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 8db:	5b                   	pop    %ebx
+ 8dc:	5e                   	pop    %esi
+ 8dd:	5d                   	pop    %ebp
+ 8de:	c3                   	ret
+ 8df:	90                   	nop
+    runfree(p, p->npages);
+ 8e0:	8b 50 04             	mov    0x4(%eax),%edx
+}
+ 8e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 8e6:	5b                   	pop    %ebx
+ 8e7:	5e                   	pop    %esi
+ 8e8:	5d                   	pop    %ebp
+    runfree(p, p->npages);
+ 8e9:	e9 22 fd ff ff       	jmp    610 <runfree>
+ 8ee:	66 90                	xchg   %ax,%ax
+  b->next = p->free;
+ 8f0:	8b 50 0c             	mov    0xc(%eax),%edx
+ 8f3:	89 11                	mov    %edx,(%ecx)
+  if(p->nfree++ == 0)
+ 8f5:	8b 50 08             	mov    0x8(%eax),%edx
+  p->free = b;
+ 8f8:	89 48 0c             	mov    %ecx,0xc(%eax)
+  if(p->nfree++ == 0)
+ 8fb:	8d 5a 01             	lea    0x1(%edx),%ebx
+ 8fe:	89 58 08             	mov    %ebx,0x8(%eax)
+ 901:	85 d2                	test   %edx,%edx
+ 903:	74 53                	je     958 <free+0xa8>
+  if(p->nfree == nblocks(p->class)){
+ 905:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ 909:	8d 4e 04             	lea    0x4(%esi),%ecx
+ 90c:	ba e0 0f 00 00       	mov    $0xfe0,%edx
+ 911:	d3 fa                	sar    %cl,%edx
+  if(p->nfree == nblocks(p->class)){
+ 913:	39 da                	cmp    %ebx,%edx
+ 915:	75 c1                	jne    8d8 <free+0x28>
+  if(p->prev)
+ 917:	8b 48 18             	mov    0x18(%eax),%ecx
+    p->prev->next = p->next;
+ 91a:	8b 50 14             	mov    0x14(%eax),%edx
+  if(p->prev)
+ 91d:	85 c9                	test   %ecx,%ecx
+ 91f:	74 6f                	je     990 <free+0xe0>
+    p->prev->next = p->next;
+ 921:	89 51 14             	mov    %edx,0x14(%ecx)
+  if(p->next)
+ 924:	85 d2                	test   %edx,%edx
+ 926:	74 06                	je     92e <free+0x7e>
+    p->next->prev = p->prev;
+ 928:	8b 48 18             	mov    0x18(%eax),%ecx
+ 92b:	89 4a 18             	mov    %ecx,0x18(%edx)
+    runfree(p, 1);
+ 92e:	ba 01 00 00 00       	mov    $0x1,%edx
+ 933:	eb ae                	jmp    8e3 <free+0x33>
+ 935:	8d 76 00             	lea    0x0(%esi),%esi
+    munmap(p, p->npages*PGSIZE);
+ 938:	8b 50 04             	mov    0x4(%eax),%edx
+ 93b:	83 ec 08             	sub    $0x8,%esp
+ 93e:	c1 e2 0c             	shl    $0xc,%edx
+ 941:	52                   	push   %edx
+ 942:	50                   	push   %eax
+ 943:	e8 1b fa ff ff       	call   363 <munmap>
+    break;
+ 948:	83 c4 10             	add    $0x10,%esp
+}
+ 94b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 94e:	5b                   	pop    %ebx
+ 94f:	5e                   	pop    %esi
+ 950:	5d                   	pop    %ebp
+ 951:	c3                   	ret
+ 952:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  p->next = partial[p->class];
+ 958:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  p->prev = 0;
+ 95c:	c7 40 18 00 00 00 00 	movl   $0x0,0x18(%eax)
+  p->next = partial[p->class];
+ 963:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 968:	8b 14 b5 c4 0e 00 00 	mov    0xec4(,%esi,4),%edx
+ 96f:	89 50 14             	mov    %edx,0x14(%eax)
+  if(p->next)
+ 972:	85 d2                	test   %edx,%edx
+ 974:	74 0a                	je     980 <free+0xd0>
+    p->next->prev = p;
+ 976:	89 42 18             	mov    %eax,0x18(%edx)
+  partial[p->class] = p;
+ 979:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  if(p->nfree == nblocks(p->class)){
+ 97d:	8b 58 08             	mov    0x8(%eax),%ebx
+  partial[p->class] = p;
+ 980:	89 04 b5 c4 0e 00 00 	mov    %eax,0xec4(,%esi,4)
+}
+ 987:	eb 80                	jmp    909 <free+0x59>
+ 989:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ 990:	89 14 b5 c4 0e 00 00 	mov    %edx,0xec4(,%esi,4)
+ 997:	eb 8b                	jmp    924 <free+0x74>
+ 999:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000009a0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 9a0:	55                   	push   %ebp
+ 9a1:	89 e5                	mov    %esp,%ebp
+ 9a3:	56                   	push   %esi
+ 9a4:	53                   	push   %ebx
+ 9a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct page *p;
+  uint n;
+
+  if(nbytes <= MAXSMALL)
+ 9a8:	3d 00 04 00 00       	cmp    $0x400,%eax
+ 9ad:	76 71                	jbe    a20 <malloc+0x80>
+    return smallalloc(sizeclass(nbytes));
+  if(nbytes > 0x7fffffff)
+ 9af:	85 c0                	test   %eax,%eax
+ 9b1:	0f 88 d9 00 00 00    	js     a90 <malloc+0xf0>
+    return 0;
+  n = (nbytes + HDRSIZE + PGSIZE-1) / PGSIZE;
+ 9b7:	8d 90 1f 10 00 00    	lea    0x101f(%eax),%edx
+ 9bd:	89 d3                	mov    %edx,%ebx
+ 9bf:	c1 eb 0c             	shr    $0xc,%ebx
+  if(nbytes >= MAPMIN){
+ 9c2:	3d ff ff 00 00       	cmp    $0xffff,%eax
+ 9c7:	77 27                	ja     9f0 <malloc+0x50>
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    if(p == MAP_FAILED)
+      return 0;
+    p->kind = PMAP;
+  } else {
+    if((p = runalloc(n)) == 0)
+ 9c9:	89 d8                	mov    %ebx,%eax
+ 9cb:	e8 c0 fd ff ff       	call   790 <runalloc>
+ 9d0:	85 c0                	test   %eax,%eax
+ 9d2:	0f 84 b8 00 00 00    	je     a90 <malloc+0xf0>
+      return 0;
+    p->kind = PRUN;
+ 9d8:	ba 02 00 00 00       	mov    $0x2,%edx
+ 9dd:	66 89 10             	mov    %dx,(%eax)
+  }
+  p->npages = n;
+ 9e0:	89 58 04             	mov    %ebx,0x4(%eax)
+  return (char*)p + HDRSIZE;
+ 9e3:	8d 58 20             	lea    0x20(%eax),%ebx
+}
+ 9e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 9e9:	89 d8                	mov    %ebx,%eax
+ 9eb:	5b                   	pop    %ebx
+ 9ec:	5e                   	pop    %esi
+ 9ed:	5d                   	pop    %ebp
+ 9ee:	c3                   	ret
+ 9ef:	90                   	nop
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+ 9f0:	83 ec 08             	sub    $0x8,%esp
+ 9f3:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+ 9f9:	6a 00                	push   $0x0
+ 9fb:	6a ff                	push   $0xffffffff
+ 9fd:	6a 22                	push   $0x22
+ 9ff:	6a 03                	push   $0x3
+ a01:	52                   	push   %edx
+ a02:	6a 00                	push   $0x0
+ a04:	e8 52 f9 ff ff       	call   35b <mmap>
+    if(p == MAP_FAILED)
+ a09:	83 c4 20             	add    $0x20,%esp
+ a0c:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a0f:	74 7f                	je     a90 <malloc+0xf0>
+    p->kind = PMAP;
+ a11:	b9 04 00 00 00       	mov    $0x4,%ecx
+ a16:	66 89 08             	mov    %cx,(%eax)
+ a19:	eb c5                	jmp    9e0 <malloc+0x40>
+ a1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a1f:	90                   	nop
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ a20:	83 f8 10             	cmp    $0x10,%eax
+ a23:	0f 86 07 01 00 00    	jbe    b30 <malloc+0x190>
+ a29:	31 db                	xor    %ebx,%ebx
+ a2b:	ba 10 00 00 00       	mov    $0x10,%edx
+ a30:	83 c3 01             	add    $0x1,%ebx
+ a33:	89 d6                	mov    %edx,%esi
+ a35:	89 d9                	mov    %ebx,%ecx
+ a37:	d3 e6                	shl    %cl,%esi
+ a39:	39 c6                	cmp    %eax,%esi
+ a3b:	72 f3                	jb     a30 <malloc+0x90>
+  if((p = partial[c]) == 0){
+ a3d:	8b 14 9d c4 0e 00 00 	mov    0xec4(,%ebx,4),%edx
+ a44:	85 d2                	test   %edx,%edx
+ a46:	74 58                	je     aa0 <malloc+0x100>
+  if((b = p->free) != 0){
+ a48:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ a4b:	8b 4a 08             	mov    0x8(%edx),%ecx
+  if((b = p->free) != 0){
+ a4e:	85 db                	test   %ebx,%ebx
+ a50:	0f 84 aa 00 00 00    	je     b00 <malloc+0x160>
+    p->free = b->next;
+ a56:	8b 03                	mov    (%ebx),%eax
+ a58:	89 42 0c             	mov    %eax,0xc(%edx)
+  if(--p->nfree == 0)
+ a5b:	83 e9 01             	sub    $0x1,%ecx
+ a5e:	89 4a 08             	mov    %ecx,0x8(%edx)
+ a61:	75 83                	jne    9e6 <malloc+0x46>
+  if(p->prev)
+ a63:	8b 4a 18             	mov    0x18(%edx),%ecx
+    p->prev->next = p->next;
+ a66:	8b 42 14             	mov    0x14(%edx),%eax
+  if(p->prev)
+ a69:	85 c9                	test   %ecx,%ecx
+ a6b:	0f 84 cf 00 00 00    	je     b40 <malloc+0x1a0>
+    p->prev->next = p->next;
+ a71:	89 41 14             	mov    %eax,0x14(%ecx)
+  if(p->next)
+ a74:	85 c0                	test   %eax,%eax
+ a76:	0f 84 6a ff ff ff    	je     9e6 <malloc+0x46>
+    p->next->prev = p->prev;
+ a7c:	8b 52 18             	mov    0x18(%edx),%edx
+ a7f:	89 50 18             	mov    %edx,0x18(%eax)
+ a82:	e9 5f ff ff ff       	jmp    9e6 <malloc+0x46>
+ a87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a8e:	66 90                	xchg   %ax,%ax
+}
+ a90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+ a93:	31 db                	xor    %ebx,%ebx
+}
+ a95:	89 d8                	mov    %ebx,%eax
+ a97:	5b                   	pop    %ebx
+ a98:	5e                   	pop    %esi
+ a99:	5d                   	pop    %ebp
+ a9a:	c3                   	ret
+ a9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a9f:	90                   	nop
+    if((p = runalloc(1)) == 0)
+ aa0:	b8 01 00 00 00       	mov    $0x1,%eax
+ aa5:	e8 e6 fc ff ff       	call   790 <runalloc>
+ aaa:	89 c2                	mov    %eax,%edx
+ aac:	85 c0                	test   %eax,%eax
+ aae:	74 e0                	je     a90 <malloc+0xf0>
+    p->kind = PSMALL;
+ ab0:	b8 01 00 00 00       	mov    $0x1,%eax
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ ab5:	8d 4b 04             	lea    0x4(%ebx),%ecx
+    p->class = c;
+ ab8:	66 89 5a 02          	mov    %bx,0x2(%edx)
+ abc:	0f b7 db             	movzwl %bx,%ebx
+    p->kind = PSMALL;
+ abf:	66 89 02             	mov    %ax,(%edx)
+    p->fresh = (char*)p + HDRSIZE;
+ ac2:	8d 42 20             	lea    0x20(%edx),%eax
+ ac5:	89 42 10             	mov    %eax,0x10(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ ac8:	b8 e0 0f 00 00       	mov    $0xfe0,%eax
+ acd:	d3 f8                	sar    %cl,%eax
+    p->free = 0;
+ acf:	c7 42 0c 00 00 00 00 	movl   $0x0,0xc(%edx)
+    p->nfree = nblocks(c);
+ ad6:	89 42 08             	mov    %eax,0x8(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ ad9:	89 c1                	mov    %eax,%ecx
+  p->next = partial[p->class];
+ adb:	8b 04 9d c4 0e 00 00 	mov    0xec4(,%ebx,4),%eax
+  p->prev = 0;
+ ae2:	c7 42 18 00 00 00 00 	movl   $0x0,0x18(%edx)
+  p->next = partial[p->class];
+ ae9:	89 42 14             	mov    %eax,0x14(%edx)
+  if(p->next)
+ aec:	85 c0                	test   %eax,%eax
+ aee:	75 20                	jne    b10 <malloc+0x170>
+  partial[p->class] = p;
+ af0:	89 14 9d c4 0e 00 00 	mov    %edx,0xec4(,%ebx,4)
+  if((b = p->free) != 0){
+ af7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ afe:	66 90                	xchg   %ax,%ax
+    b = (struct block*)p->fresh;
+ b00:	8b 5a 10             	mov    0x10(%edx),%ebx
+    p->fresh += MINSMALL << c;
+ b03:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+ b06:	89 42 10             	mov    %eax,0x10(%edx)
+ b09:	e9 4d ff ff ff       	jmp    a5b <malloc+0xbb>
+ b0e:	66 90                	xchg   %ax,%ax
+    p->next->prev = p;
+ b10:	89 50 18             	mov    %edx,0x18(%eax)
+  partial[p->class] = p;
+ b13:	0f b7 42 02          	movzwl 0x2(%edx),%eax
+  if((b = p->free) != 0){
+ b17:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ b1a:	8b 4a 08             	mov    0x8(%edx),%ecx
+  partial[p->class] = p;
+ b1d:	89 14 85 c4 0e 00 00 	mov    %edx,0xec4(,%eax,4)
+}
+ b24:	e9 25 ff ff ff       	jmp    a4e <malloc+0xae>
+ b29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ b30:	be 10 00 00 00       	mov    $0x10,%esi
+ b35:	31 db                	xor    %ebx,%ebx
+ b37:	e9 01 ff ff ff       	jmp    a3d <malloc+0x9d>
+ b3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ b40:	0f b7 4a 02          	movzwl 0x2(%edx),%ecx
+ b44:	89 04 8d c4 0e 00 00 	mov    %eax,0xec4(,%ecx,4)
+ b4b:	e9 24 ff ff ff       	jmp    a74 <malloc+0xd4>
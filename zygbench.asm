@@ -0,0 +1,2111 @@
+
+_zygbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+         lat[NRUN*90/100] / 1000, lat[NRUN*99/100] / 1000, lat[NRUN-1] / 1000);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+   f:	51                   	push   %ecx
+  10:	83 ec 1c             	sub    $0x1c,%esp
+  13:	8b 01                	mov    (%ecx),%eax
+  15:	8b 59 04             	mov    0x4(%ecx),%ebx
+  uint d;
+
+  if(argc == 3 && strcmp(argv[1], "-c") == 0){
+  18:	83 f8 03             	cmp    $0x3,%eax
+  1b:	74 3f                	je     5c <main+0x5c>
+    d = rdtsc() - atou(argv[2]);
+    write(3, &d, sizeof(d));
+    exit();
+  }
+  run(argc > 1 ? argv[1] : "root container", 0);
+  1d:	83 f8 01             	cmp    $0x1,%eax
+  20:	7e 22                	jle    44 <main+0x44>
+  22:	50                   	push   %eax
+  23:	50                   	push   %eax
+  24:	6a 00                	push   $0x0
+  26:	ff 73 04             	push   0x4(%ebx)
+  29:	e8 c2 01 00 00       	call   1f0 <run>
+  run(argc > 1 ? argv[1] : "root container", NPOOL);
+  2e:	8b 43 04             	mov    0x4(%ebx),%eax
+  31:	83 c4 10             	add    $0x10,%esp
+  34:	83 ec 08             	sub    $0x8,%esp
+  37:	6a 04                	push   $0x4
+  39:	50                   	push   %eax
+  3a:	e8 b1 01 00 00       	call   1f0 <run>
+  exit();
+  3f:	e8 1f 06 00 00       	call   663 <exit>
+  run(argc > 1 ? argv[1] : "root container", 0);
+  44:	52                   	push   %edx
+  45:	52                   	push   %edx
+  46:	6a 00                	push   $0x0
+  48:	68 39 0f 00 00       	push   $0xf39
+  4d:	e8 9e 01 00 00       	call   1f0 <run>
+  52:	83 c4 10             	add    $0x10,%esp
+  run(argc > 1 ? argv[1] : "root container", NPOOL);
+  55:	b8 39 0f 00 00       	mov    $0xf39,%eax
+  5a:	eb d8                	jmp    34 <main+0x34>
+  if(argc == 3 && strcmp(argv[1], "-c") == 0){
+  5c:	56                   	push   %esi
+  5d:	56                   	push   %esi
+  5e:	68 1d 0f 00 00       	push   $0xf1d
+  63:	ff 73 04             	push   0x4(%ebx)
+  66:	e8 a5 03 00 00       	call   410 <strcmp>
+  6b:	83 c4 10             	add    $0x10,%esp
+  6e:	85 c0                	test   %eax,%eax
+  70:	75 b0                	jne    22 <main+0x22>
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  72:	0f 31                	rdtsc
+    d = rdtsc() - atou(argv[2]);
+  74:	8b 73 08             	mov    0x8(%ebx),%esi
+  while(*s >= '0' && *s <= '9')
+  77:	0f be 16             	movsbl (%esi),%edx
+  7a:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  7d:	80 f9 09             	cmp    $0x9,%cl
+  x = 0;
+  80:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while(*s >= '0' && *s <= '9')
+  85:	77 1e                	ja     a5 <main+0xa5>
+  87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8e:	66 90                	xchg   %ax,%ax
+    x = x*10 + *s++ - '0';
+  90:	83 c6 01             	add    $0x1,%esi
+  93:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  96:	8d 4c 4a d0          	lea    -0x30(%edx,%ecx,2),%ecx
+  while(*s >= '0' && *s <= '9')
+  9a:	0f be 16             	movsbl (%esi),%edx
+  9d:	8d 5a d0             	lea    -0x30(%edx),%ebx
+  a0:	80 fb 09             	cmp    $0x9,%bl
+  a3:	76 eb                	jbe    90 <main+0x90>
+    d = rdtsc() - atou(argv[2]);
+  a5:	29 c8                	sub    %ecx,%eax
+  a7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    write(3, &d, sizeof(d));
+  aa:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  ad:	51                   	push   %ecx
+  ae:	6a 04                	push   $0x4
+  b0:	50                   	push   %eax
+  b1:	6a 03                	push   $0x3
+  b3:	e8 cb 05 00 00       	call   683 <write>
+    exit();
+  b8:	e8 a6 05 00 00       	call   663 <exit>
+  bd:	66 90                	xchg   %ax,%ax
+  bf:	90                   	nop
+
+000000c0 <rdtsc>:
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  c0:	0f 31                	rdtsc
+}
+  c2:	c3                   	ret
+  c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000000d0 <utoa>:
+{
+  d0:	55                   	push   %ebp
+  d1:	89 e5                	mov    %esp,%ebp
+  d3:	57                   	push   %edi
+  d4:	56                   	push   %esi
+  n = 0;
+  d5:	31 f6                	xor    %esi,%esi
+{
+  d7:	53                   	push   %ebx
+  d8:	8d 5d e4             	lea    -0x1c(%ebp),%ebx
+  db:	83 ec 14             	sub    $0x14,%esp
+  de:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    tmp[n++] = '0' + x % 10;
+  e8:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  ed:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  f0:	83 c6 01             	add    $0x1,%esi
+  f3:	f7 e1                	mul    %ecx
+  f5:	89 c8                	mov    %ecx,%eax
+  f7:	c1 ea 03             	shr    $0x3,%edx
+  fa:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+  fd:	01 ff                	add    %edi,%edi
+  ff:	29 f8                	sub    %edi,%eax
+ 101:	83 c0 30             	add    $0x30,%eax
+ 104:	88 44 35 e3          	mov    %al,-0x1d(%ebp,%esi,1)
+    x /= 10;
+ 108:	89 c8                	mov    %ecx,%eax
+ 10a:	89 d1                	mov    %edx,%ecx
+  } while(x);
+ 10c:	83 f8 09             	cmp    $0x9,%eax
+ 10f:	77 d7                	ja     e8 <utoa+0x18>
+ 111:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 114:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 117:	89 f9                	mov    %edi,%ecx
+ 119:	01 da                	add    %ebx,%edx
+ 11b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 11f:	90                   	nop
+    buf[i] = tmp[n-1-i];
+ 120:	0f b6 02             	movzbl (%edx),%eax
+  for(i = 0; i < n; i++)
+ 123:	83 c1 01             	add    $0x1,%ecx
+    buf[i] = tmp[n-1-i];
+ 126:	88 41 ff             	mov    %al,-0x1(%ecx)
+  for(i = 0; i < n; i++)
+ 129:	89 d0                	mov    %edx,%eax
+ 12b:	83 ea 01             	sub    $0x1,%edx
+ 12e:	39 d8                	cmp    %ebx,%eax
+ 130:	75 ee                	jne    120 <utoa+0x50>
+  buf[n] = 0;
+ 132:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+}
+ 136:	83 c4 14             	add    $0x14,%esp
+ 139:	5b                   	pop    %ebx
+ 13a:	5e                   	pop    %esi
+ 13b:	5f                   	pop    %edi
+ 13c:	5d                   	pop    %ebp
+ 13d:	c3                   	ret
+ 13e:	66 90                	xchg   %ax,%ax
+
+00000140 <atou>:
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	53                   	push   %ebx
+ 144:	8b 55 08             	mov    0x8(%ebp),%edx
+  while(*s >= '0' && *s <= '9')
+ 147:	0f be 02             	movsbl (%edx),%eax
+ 14a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 14d:	80 f9 09             	cmp    $0x9,%cl
+  x = 0;
+ 150:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while(*s >= '0' && *s <= '9')
+ 155:	77 1e                	ja     175 <atou+0x35>
+ 157:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15e:	66 90                	xchg   %ax,%ax
+    x = x*10 + *s++ - '0';
+ 160:	83 c2 01             	add    $0x1,%edx
+ 163:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 166:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while(*s >= '0' && *s <= '9')
+ 16a:	0f be 02             	movsbl (%edx),%eax
+ 16d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 170:	80 fb 09             	cmp    $0x9,%bl
+ 173:	76 eb                	jbe    160 <atou+0x20>
+}
+ 175:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 178:	89 c8                	mov    %ecx,%eax
+ 17a:	c9                   	leave
+ 17b:	c3                   	ret
+ 17c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000180 <sort>:
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	57                   	push   %edi
+ 184:	56                   	push   %esi
+ 185:	53                   	push   %ebx
+ 186:	83 ec 04             	sub    $0x4,%esp
+  for(i = 1; i < n; i++){
+ 189:	83 7d 0c 01          	cmpl   $0x1,0xc(%ebp)
+{
+ 18d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  for(i = 1; i < n; i++){
+ 190:	7e 3e                	jle    1d0 <sort+0x50>
+ 192:	bf 01 00 00 00       	mov    $0x1,%edi
+ 197:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19e:	66 90                	xchg   %ax,%ax
+    x = a[i];
+ 1a0:	89 7d f0             	mov    %edi,-0x10(%ebp)
+ 1a3:	8b 34 b9             	mov    (%ecx,%edi,4),%esi
+    for(j = i; j > 0 && a[j-1] > x; j--)
+ 1a6:	8d 04 b9             	lea    (%ecx,%edi,4),%eax
+    x = a[i];
+ 1a9:	89 fa                	mov    %edi,%edx
+ 1ab:	eb 0d                	jmp    1ba <sort+0x3a>
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+      a[j] = a[j-1];
+ 1b0:	89 38                	mov    %edi,(%eax)
+    for(j = i; j > 0 && a[j-1] > x; j--)
+ 1b2:	8d 43 fc             	lea    -0x4(%ebx),%eax
+ 1b5:	83 ea 01             	sub    $0x1,%edx
+ 1b8:	74 26                	je     1e0 <sort+0x60>
+ 1ba:	8b 78 fc             	mov    -0x4(%eax),%edi
+ 1bd:	89 c3                	mov    %eax,%ebx
+ 1bf:	39 fe                	cmp    %edi,%esi
+ 1c1:	72 ed                	jb     1b0 <sort+0x30>
+ 1c3:	8b 7d f0             	mov    -0x10(%ebp),%edi
+    a[j] = x;
+ 1c6:	89 33                	mov    %esi,(%ebx)
+  for(i = 1; i < n; i++){
+ 1c8:	83 c7 01             	add    $0x1,%edi
+ 1cb:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+ 1ce:	75 d0                	jne    1a0 <sort+0x20>
+}
+ 1d0:	83 c4 04             	add    $0x4,%esp
+ 1d3:	5b                   	pop    %ebx
+ 1d4:	5e                   	pop    %esi
+ 1d5:	5f                   	pop    %edi
+ 1d6:	5d                   	pop    %ebp
+ 1d7:	c3                   	ret
+ 1d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1df:	90                   	nop
+ 1e0:	8b 7d f0             	mov    -0x10(%ebp),%edi
+ 1e3:	89 cb                	mov    %ecx,%ebx
+ 1e5:	eb df                	jmp    1c6 <sort+0x46>
+ 1e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ee:	66 90                	xchg   %ax,%ax
+
+000001f0 <run>:
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	57                   	push   %edi
+ 1f4:	56                   	push   %esi
+ 1f5:	53                   	push   %ebx
+ 1f6:	83 ec 50             	sub    $0x50,%esp
+  if(czygote(cont, "zygbench", npool) < 0 || pipe(fd) < 0){
+ 1f9:	ff 75 0c             	push   0xc(%ebp)
+ 1fc:	68 14 0f 00 00       	push   $0xf14
+ 201:	ff 75 08             	push   0x8(%ebp)
+ 204:	e8 52 05 00 00       	call   75b <czygote>
+ 209:	83 c4 10             	add    $0x10,%esp
+ 20c:	85 c0                	test   %eax,%eax
+ 20e:	0f 88 a8 01 00 00    	js     3bc <run+0x1cc>
+ 214:	83 ec 0c             	sub    $0xc,%esp
+ 217:	8d 45 b0             	lea    -0x50(%ebp),%eax
+ 21a:	50                   	push   %eax
+ 21b:	e8 53 04 00 00       	call   673 <pipe>
+ 220:	83 c4 10             	add    $0x10,%esp
+ 223:	85 c0                	test   %eax,%eax
+ 225:	0f 88 91 01 00 00    	js     3bc <run+0x1cc>
+  act.arg = fd[1];
+ 22b:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  args[2] = t0;
+ 22e:	8d 75 d8             	lea    -0x28(%ebp),%esi
+  act.op = SPAWN_DUP;
+ 231:	c7 45 b8 02 00 00 00 	movl   $0x2,-0x48(%ebp)
+  act.fd = 3;
+ 238:	8d 7d b8             	lea    -0x48(%ebp),%edi
+ 23b:	c7 45 bc 03 00 00 00 	movl   $0x3,-0x44(%ebp)
+  args[3] = 0;
+ 242:	bb 00 14 00 00       	mov    $0x1400,%ebx
+  act.arg = fd[1];
+ 247:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  act.path = 0;
+ 24a:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+  args[0] = "zygbench";
+ 251:	c7 45 c8 14 0f 00 00 	movl   $0xf14,-0x38(%ebp)
+  args[1] = "-c";
+ 258:	c7 45 cc 1d 0f 00 00 	movl   $0xf1d,-0x34(%ebp)
+  args[2] = t0;
+ 25f:	89 75 d0             	mov    %esi,-0x30(%ebp)
+  args[3] = 0;
+ 262:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  for(i = 0; i < NRUN; i++){
+ 269:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 270:	0f 31                	rdtsc
+    utoa(rdtsc(), t0);
+ 272:	83 ec 08             	sub    $0x8,%esp
+ 275:	56                   	push   %esi
+ 276:	50                   	push   %eax
+ 277:	e8 54 fe ff ff       	call   d0 <utoa>
+    if(spawn("zygbench", args, &act, 1, -1) < 0 ||
+ 27c:	8d 45 c8             	lea    -0x38(%ebp),%eax
+ 27f:	c7 04 24 ff ff ff ff 	movl   $0xffffffff,(%esp)
+ 286:	6a 01                	push   $0x1
+ 288:	57                   	push   %edi
+ 289:	50                   	push   %eax
+ 28a:	68 14 0f 00 00       	push   $0xf14
+ 28f:	e8 97 04 00 00       	call   72b <spawn>
+ 294:	83 c4 20             	add    $0x20,%esp
+ 297:	85 c0                	test   %eax,%eax
+ 299:	0f 88 09 01 00 00    	js     3a8 <run+0x1b8>
+       read(fd[0], &lat[i], sizeof(lat[i])) != sizeof(lat[i])){
+ 29f:	83 ec 04             	sub    $0x4,%esp
+ 2a2:	6a 04                	push   $0x4
+ 2a4:	53                   	push   %ebx
+ 2a5:	ff 75 b0             	push   -0x50(%ebp)
+ 2a8:	e8 ce 03 00 00       	call   67b <read>
+    if(spawn("zygbench", args, &act, 1, -1) < 0 ||
+ 2ad:	83 c4 10             	add    $0x10,%esp
+ 2b0:	83 f8 04             	cmp    $0x4,%eax
+ 2b3:	0f 85 ef 00 00 00    	jne    3a8 <run+0x1b8>
+    wait();
+ 2b9:	e8 ad 03 00 00       	call   66b <wait>
+  for(i = 0; i < NRUN; i++){
+ 2be:	83 c3 04             	add    $0x4,%ebx
+ 2c1:	b8 a0 14 00 00       	mov    $0x14a0,%eax
+ 2c6:	39 d8                	cmp    %ebx,%eax
+ 2c8:	75 a6                	jne    270 <run+0x80>
+  close(fd[0]);
+ 2ca:	83 ec 0c             	sub    $0xc,%esp
+ 2cd:	ff 75 b0             	push   -0x50(%ebp)
+ 2d0:	be 04 14 00 00       	mov    $0x1404,%esi
+  for(i = 1; i < n; i++){
+ 2d5:	bf 01 00 00 00       	mov    $0x1,%edi
+  close(fd[0]);
+ 2da:	e8 ac 03 00 00       	call   68b <close>
+  close(fd[1]);
+ 2df:	5a                   	pop    %edx
+ 2e0:	ff 75 b4             	push   -0x4c(%ebp)
+ 2e3:	e8 a3 03 00 00       	call   68b <close>
+  czygote(cont, "zygbench", 0);
+ 2e8:	83 c4 0c             	add    $0xc,%esp
+ 2eb:	6a 00                	push   $0x0
+ 2ed:	68 14 0f 00 00       	push   $0xf14
+ 2f2:	ff 75 08             	push   0x8(%ebp)
+ 2f5:	e8 61 04 00 00       	call   75b <czygote>
+  for(i = 1; i < n; i++){
+ 2fa:	83 c4 10             	add    $0x10,%esp
+ 2fd:	8d 76 00             	lea    0x0(%esi),%esi
+    x = a[i];
+ 300:	8b 1e                	mov    (%esi),%ebx
+ 302:	89 f0                	mov    %esi,%eax
+ 304:	eb 17                	jmp    31d <run+0x12d>
+ 306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+      a[j] = a[j-1];
+ 310:	89 08                	mov    %ecx,(%eax)
+    for(j = i; j > 0 && a[j-1] > x; j--)
+ 312:	8d 42 fc             	lea    -0x4(%edx),%eax
+ 315:	81 fa 04 14 00 00    	cmp    $0x1404,%edx
+ 31b:	74 73                	je     390 <run+0x1a0>
+ 31d:	8b 48 fc             	mov    -0x4(%eax),%ecx
+ 320:	89 c2                	mov    %eax,%edx
+ 322:	39 cb                	cmp    %ecx,%ebx
+ 324:	72 ea                	jb     310 <run+0x120>
+  for(i = 1; i < n; i++){
+ 326:	83 c7 01             	add    $0x1,%edi
+    a[j] = x;
+ 329:	89 1a                	mov    %ebx,(%edx)
+  for(i = 1; i < n; i++){
+ 32b:	83 c6 04             	add    $0x4,%esi
+ 32e:	83 ff 28             	cmp    $0x28,%edi
+ 331:	75 cd                	jne    300 <run+0x110>
+  printf(1, "%s: launch latency in Kcycles: p50 %d p90 %d p99 %d max %d\n",
+ 333:	be d3 4d 62 10       	mov    $0x10624dd3,%esi
+ 338:	89 f0                	mov    %esi,%eax
+ 33a:	f7 25 9c 14 00 00    	mull   0x149c
+ 340:	89 f0                	mov    %esi,%eax
+ 342:	89 d1                	mov    %edx,%ecx
+ 344:	f7 25 90 14 00 00    	mull   0x1490
+ 34a:	89 f0                	mov    %esi,%eax
+ 34c:	be 00 0f 00 00       	mov    $0xf00,%esi
+ 351:	c1 e9 06             	shr    $0x6,%ecx
+ 354:	89 d3                	mov    %edx,%ebx
+ 356:	f7 25 50 14 00 00    	mull   0x1450
+ 35c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 35f:	c1 eb 06             	shr    $0x6,%ebx
+ 362:	c1 ea 06             	shr    $0x6,%edx
+ 365:	85 c0                	test   %eax,%eax
+ 367:	b8 0c 0f 00 00       	mov    $0xf0c,%eax
+ 36c:	0f 45 c6             	cmovne %esi,%eax
+ 36f:	83 ec 04             	sub    $0x4,%esp
+ 372:	51                   	push   %ecx
+ 373:	51                   	push   %ecx
+ 374:	53                   	push   %ebx
+ 375:	52                   	push   %edx
+ 376:	50                   	push   %eax
+ 377:	68 6c 0f 00 00       	push   $0xf6c
+ 37c:	6a 01                	push   $0x1
+ 37e:	e8 8d 04 00 00       	call   810 <printf>
+}
+ 383:	83 c4 20             	add    $0x20,%esp
+ 386:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 389:	5b                   	pop    %ebx
+ 38a:	5e                   	pop    %esi
+ 38b:	5f                   	pop    %edi
+ 38c:	5d                   	pop    %ebp
+ 38d:	c3                   	ret
+ 38e:	66 90                	xchg   %ax,%ax
+ 390:	ba 00 14 00 00       	mov    $0x1400,%edx
+  for(i = 1; i < n; i++){
+ 395:	83 c7 01             	add    $0x1,%edi
+ 398:	83 c6 04             	add    $0x4,%esi
+    a[j] = x;
+ 39b:	89 1a                	mov    %ebx,(%edx)
+  for(i = 1; i < n; i++){
+ 39d:	83 ff 28             	cmp    $0x28,%edi
+ 3a0:	0f 85 5a ff ff ff    	jne    300 <run+0x110>
+ 3a6:	eb 8b                	jmp    333 <run+0x143>
+      printf(1, "zygbench: launch failed\n");
+ 3a8:	83 ec 08             	sub    $0x8,%esp
+ 3ab:	68 20 0f 00 00       	push   $0xf20
+ 3b0:	6a 01                	push   $0x1
+ 3b2:	e8 59 04 00 00       	call   810 <printf>
+      exit();
+ 3b7:	e8 a7 02 00 00       	call   663 <exit>
+    printf(1, "zygbench: cannot set up pool in %s\n", cont);
+ 3bc:	51                   	push   %ecx
+ 3bd:	ff 75 08             	push   0x8(%ebp)
+ 3c0:	68 48 0f 00 00       	push   $0xf48
+ 3c5:	6a 01                	push   $0x1
+ 3c7:	e8 44 04 00 00       	call   810 <printf>
+    exit();
+ 3cc:	e8 92 02 00 00       	call   663 <exit>
+ 3d1:	66 90                	xchg   %ax,%ax
+ 3d3:	66 90                	xchg   %ax,%ax
+ 3d5:	66 90                	xchg   %ax,%ax
+ 3d7:	66 90                	xchg   %ax,%ax
+ 3d9:	66 90                	xchg   %ax,%ax
+ 3db:	66 90                	xchg   %ax,%ax
+ 3dd:	66 90                	xchg   %ax,%ax
+ 3df:	90                   	nop
+
+000003e0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 3e0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 3e1:	31 c0                	xor    %eax,%eax
+{
+ 3e3:	89 e5                	mov    %esp,%ebp
+ 3e5:	53                   	push   %ebx
+ 3e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 3f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 3f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 3f7:	83 c0 01             	add    $0x1,%eax
+ 3fa:	84 d2                	test   %dl,%dl
+ 3fc:	75 f2                	jne    3f0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 3fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 401:	89 c8                	mov    %ecx,%eax
+ 403:	c9                   	leave
+ 404:	c3                   	ret
+ 405:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000410 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	53                   	push   %ebx
+ 414:	8b 55 08             	mov    0x8(%ebp),%edx
+ 417:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 41a:	0f b6 02             	movzbl (%edx),%eax
+ 41d:	84 c0                	test   %al,%al
+ 41f:	75 17                	jne    438 <strcmp+0x28>
+ 421:	eb 3a                	jmp    45d <strcmp+0x4d>
+ 423:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 427:	90                   	nop
+ 428:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 42c:	83 c2 01             	add    $0x1,%edx
+ 42f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 432:	84 c0                	test   %al,%al
+ 434:	74 1a                	je     450 <strcmp+0x40>
+    p++, q++;
+ 436:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 438:	0f b6 19             	movzbl (%ecx),%ebx
+ 43b:	38 c3                	cmp    %al,%bl
+ 43d:	74 e9                	je     428 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 43f:	29 d8                	sub    %ebx,%eax
+}
+ 441:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 444:	c9                   	leave
+ 445:	c3                   	ret
+ 446:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 450:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 454:	31 c0                	xor    %eax,%eax
+ 456:	29 d8                	sub    %ebx,%eax
+}
+ 458:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 45b:	c9                   	leave
+ 45c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 45d:	0f b6 19             	movzbl (%ecx),%ebx
+ 460:	31 c0                	xor    %eax,%eax
+ 462:	eb db                	jmp    43f <strcmp+0x2f>
+ 464:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 46f:	90                   	nop
+
+00000470 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 476:	80 3a 00             	cmpb   $0x0,(%edx)
+ 479:	74 15                	je     490 <strlen+0x20>
+ 47b:	31 c0                	xor    %eax,%eax
+ 47d:	8d 76 00             	lea    0x0(%esi),%esi
+ 480:	83 c0 01             	add    $0x1,%eax
+ 483:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 487:	89 c1                	mov    %eax,%ecx
+ 489:	75 f5                	jne    480 <strlen+0x10>
+    ;
+  return n;
+}
+ 48b:	89 c8                	mov    %ecx,%eax
+ 48d:	5d                   	pop    %ebp
+ 48e:	c3                   	ret
+ 48f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 490:	31 c9                	xor    %ecx,%ecx
+}
+ 492:	5d                   	pop    %ebp
+ 493:	89 c8                	mov    %ecx,%eax
+ 495:	c3                   	ret
+ 496:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004a0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	57                   	push   %edi
+ 4a4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 4a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4ad:	89 d7                	mov    %edx,%edi
+ 4af:	fc                   	cld
+ 4b0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 4b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 4b5:	89 d0                	mov    %edx,%eax
+ 4b7:	c9                   	leave
+ 4b8:	c3                   	ret
+ 4b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 4ca:	0f b6 10             	movzbl (%eax),%edx
+ 4cd:	84 d2                	test   %dl,%dl
+ 4cf:	75 12                	jne    4e3 <strchr+0x23>
+ 4d1:	eb 1d                	jmp    4f0 <strchr+0x30>
+ 4d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4d7:	90                   	nop
+ 4d8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 4dc:	83 c0 01             	add    $0x1,%eax
+ 4df:	84 d2                	test   %dl,%dl
+ 4e1:	74 0d                	je     4f0 <strchr+0x30>
+    if(*s == c)
+ 4e3:	38 d1                	cmp    %dl,%cl
+ 4e5:	75 f1                	jne    4d8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 4e7:	5d                   	pop    %ebp
+ 4e8:	c3                   	ret
+ 4e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 4f0:	31 c0                	xor    %eax,%eax
+}
+ 4f2:	5d                   	pop    %ebp
+ 4f3:	c3                   	ret
+ 4f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4ff:	90                   	nop
+
+00000500 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 500:	55                   	push   %ebp
+ 501:	89 e5                	mov    %esp,%ebp
+ 503:	57                   	push   %edi
+ 504:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 505:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 508:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 509:	31 db                	xor    %ebx,%ebx
+{
+ 50b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 50e:	eb 27                	jmp    537 <gets+0x37>
+    cc = read(0, &c, 1);
+ 510:	83 ec 04             	sub    $0x4,%esp
+ 513:	6a 01                	push   $0x1
+ 515:	56                   	push   %esi
+ 516:	6a 00                	push   $0x0
+ 518:	e8 5e 01 00 00       	call   67b <read>
+    if(cc < 1)
+ 51d:	83 c4 10             	add    $0x10,%esp
+ 520:	85 c0                	test   %eax,%eax
+ 522:	7e 1d                	jle    541 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 524:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 528:	8b 55 08             	mov    0x8(%ebp),%edx
+ 52b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 52f:	3c 0a                	cmp    $0xa,%al
+ 531:	74 10                	je     543 <gets+0x43>
+ 533:	3c 0d                	cmp    $0xd,%al
+ 535:	74 0c                	je     543 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 537:	89 df                	mov    %ebx,%edi
+ 539:	83 c3 01             	add    $0x1,%ebx
+ 53c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 53f:	7c cf                	jl     510 <gets+0x10>
+ 541:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 543:	8b 45 08             	mov    0x8(%ebp),%eax
+ 546:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 54a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 54d:	5b                   	pop    %ebx
+ 54e:	5e                   	pop    %esi
+ 54f:	5f                   	pop    %edi
+ 550:	5d                   	pop    %ebp
+ 551:	c3                   	ret
+ 552:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 559:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000560 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	56                   	push   %esi
+ 564:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 565:	83 ec 08             	sub    $0x8,%esp
+ 568:	6a 00                	push   $0x0
+ 56a:	ff 75 08             	push   0x8(%ebp)
+ 56d:	e8 31 01 00 00       	call   6a3 <open>
+  if(fd < 0)
+ 572:	83 c4 10             	add    $0x10,%esp
+ 575:	85 c0                	test   %eax,%eax
+ 577:	78 27                	js     5a0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 579:	83 ec 08             	sub    $0x8,%esp
+ 57c:	ff 75 0c             	push   0xc(%ebp)
+ 57f:	89 c3                	mov    %eax,%ebx
+ 581:	50                   	push   %eax
+ 582:	e8 34 01 00 00       	call   6bb <fstat>
+  close(fd);
+ 587:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 58a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 58c:	e8 fa 00 00 00       	call   68b <close>
+  return r;
+ 591:	83 c4 10             	add    $0x10,%esp
+}
+ 594:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 597:	89 f0                	mov    %esi,%eax
+ 599:	5b                   	pop    %ebx
+ 59a:	5e                   	pop    %esi
+ 59b:	5d                   	pop    %ebp
+ 59c:	c3                   	ret
+ 59d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 5a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 5a5:	eb ed                	jmp    594 <stat+0x34>
+ 5a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ae:	66 90                	xchg   %ax,%ax
+
+000005b0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	53                   	push   %ebx
+ 5b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 5b7:	0f be 02             	movsbl (%edx),%eax
+ 5ba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 5bd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 5c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 5c5:	77 1e                	ja     5e5 <atoi+0x35>
+ 5c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 5d0:	83 c2 01             	add    $0x1,%edx
+ 5d3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 5d6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 5da:	0f be 02             	movsbl (%edx),%eax
+ 5dd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 5e0:	80 fb 09             	cmp    $0x9,%bl
+ 5e3:	76 eb                	jbe    5d0 <atoi+0x20>
+  return n;
+}
+ 5e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5e8:	89 c8                	mov    %ecx,%eax
+ 5ea:	c9                   	leave
+ 5eb:	c3                   	ret
+ 5ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005f0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	57                   	push   %edi
+ 5f4:	56                   	push   %esi
+ 5f5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 5fe:	85 c0                	test   %eax,%eax
+ 600:	7e 13                	jle    615 <memmove+0x25>
+ 602:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 604:	89 d7                	mov    %edx,%edi
+ 606:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 60d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 610:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 611:	39 f8                	cmp    %edi,%eax
+ 613:	75 fb                	jne    610 <memmove+0x20>
+  return vdst;
+}
+ 615:	5e                   	pop    %esi
+ 616:	89 d0                	mov    %edx,%eax
+ 618:	5f                   	pop    %edi
+ 619:	5d                   	pop    %ebp
+ 61a:	c3                   	ret
+
+0000061b <ccreate>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(ccreate)
+ 61b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <cfork>:
+SYSCALL(cfork)
+ 623:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <cgetrootdir>:
+SYSCALL(cgetrootdir)
+ 62b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <getcontrootdir>:
+SYSCALL(getcontrootdir)
+ 633:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <cpause>:
+SYSCALL(cpause)
+ 63b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <cresume>:
+SYSCALL(cresume)
+ 643:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <cstart>:
+SYSCALL(cstart)
+ 64b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <cstop>:
+SYSCALL(cstop)
+ 653:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <fork>:
+SYSCALL(fork)
+ 65b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <exit>:
+SYSCALL(exit)
+ 663:	b8 02 00 00 00       	mov    $0x2,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <wait>:
+SYSCALL(wait)
+ 66b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <pipe>:
+SYSCALL(pipe)
+ 673:	b8 04 00 00 00       	mov    $0x4,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <read>:
+SYSCALL(read)
+ 67b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <write>:
+SYSCALL(write)
+ 683:	b8 10 00 00 00       	mov    $0x10,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <close>:
+SYSCALL(close)
+ 68b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <kill>:
+SYSCALL(kill)
+ 693:	b8 06 00 00 00       	mov    $0x6,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <exec>:
+SYSCALL(exec)
+ 69b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <open>:
+SYSCALL(open)
+ 6a3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <mknod>:
+SYSCALL(mknod)
+ 6ab:	b8 11 00 00 00       	mov    $0x11,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <unlink>:
+SYSCALL(unlink)
+ 6b3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <fstat>:
+SYSCALL(fstat)
+ 6bb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <link>:
+SYSCALL(link)
+ 6c3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <mkdir>:
+SYSCALL(mkdir)
+ 6cb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <chdir>:
+SYSCALL(chdir)
+ 6d3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <dup>:
+SYSCALL(dup)
+ 6db:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <getpid>:
+SYSCALL(getpid)
+ 6e3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <sbrk>:
+SYSCALL(sbrk)
+ 6eb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <sleep>:
+SYSCALL(sleep)
+ 6f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <uptime>:
+SYSCALL(uptime)
+ 6fb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <cps>:
+SYSCALL(cps)
+ 703:	b8 16 00 00 00       	mov    $0x16,%eax
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <mmap>:
+SYSCALL(mmap)
+ 70b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+
+00000713 <munmap>:
+SYSCALL(munmap)
+ 713:	b8 20 00 00 00       	mov    $0x20,%eax
+ 718:	cd 40                	int    $0x40
+ 71a:	c3                   	ret
+
+0000071b <shmget>:
+SYSCALL(shmget)
+ 71b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <climit>:
+SYSCALL(climit)
+ 723:	b8 22 00 00 00       	mov    $0x22,%eax
+ 728:	cd 40                	int    $0x40
+ 72a:	c3                   	ret
+
+0000072b <spawn>:
+SYSCALL(spawn)
+ 72b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <clone>:
+SYSCALL(clone)
+ 733:	b8 24 00 00 00       	mov    $0x24,%eax
+ 738:	cd 40                	int    $0x40
+ 73a:	c3                   	ret
+
+0000073b <join>:
+SYSCALL(join)
+ 73b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 740:	cd 40                	int    $0x40
+ 742:	c3                   	ret
+
+00000743 <futex>:
+SYSCALL(futex)
+ 743:	b8 26 00 00 00       	mov    $0x26,%eax
+ 748:	cd 40                	int    $0x40
+ 74a:	c3                   	ret
+
+0000074b <ccheckpoint>:
+SYSCALL(ccheckpoint)
+ 74b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 750:	cd 40                	int    $0x40
+ 752:	c3                   	ret
+
+00000753 <crestore>:
+SYSCALL(crestore)
+ 753:	b8 28 00 00 00       	mov    $0x28,%eax
+ 758:	cd 40                	int    $0x40
+ 75a:	c3                   	ret
+
+0000075b <czygote>:
+SYSCALL(czygote)
+ 75b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 760:	cd 40                	int    $0x40
+ 762:	c3                   	ret
+
+00000763 <memstats>:
+SYSCALL(memstats)
+ 763:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 768:	cd 40                	int    $0x40
+ 76a:	c3                   	ret
+ 76b:	66 90                	xchg   %ax,%ax
+ 76d:	66 90                	xchg   %ax,%ax
+ 76f:	90                   	nop
+
+00000770 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 770:	55                   	push   %ebp
+ 771:	89 e5                	mov    %esp,%ebp
+ 773:	57                   	push   %edi
+ 774:	56                   	push   %esi
+ 775:	53                   	push   %ebx
+ 776:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 778:	89 d1                	mov    %edx,%ecx
+{
+ 77a:	83 ec 3c             	sub    $0x3c,%esp
+ 77d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 780:	85 d2                	test   %edx,%edx
+ 782:	0f 89 80 00 00 00    	jns    808 <printint+0x98>
+ 788:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 78c:	74 7a                	je     808 <printint+0x98>
+    x = -xx;
+ 78e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 790:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 795:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 798:	31 f6                	xor    %esi,%esi
+ 79a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 7a0:	89 c8                	mov    %ecx,%eax
+ 7a2:	31 d2                	xor    %edx,%edx
+ 7a4:	89 f7                	mov    %esi,%edi
+ 7a6:	f7 f3                	div    %ebx
+ 7a8:	8d 76 01             	lea    0x1(%esi),%esi
+ 7ab:	0f b6 92 08 10 00 00 	movzbl 0x1008(%edx),%edx
+ 7b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 7b6:	89 ca                	mov    %ecx,%edx
+ 7b8:	89 c1                	mov    %eax,%ecx
+ 7ba:	39 da                	cmp    %ebx,%edx
+ 7bc:	73 e2                	jae    7a0 <printint+0x30>
+  if(neg)
+ 7be:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 7c1:	85 c0                	test   %eax,%eax
+ 7c3:	74 07                	je     7cc <printint+0x5c>
+    buf[i++] = '-';
+ 7c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 7ca:	89 f7                	mov    %esi,%edi
+ 7cc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 7cf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 7d2:	01 df                	add    %ebx,%edi
+ 7d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 7d8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 7db:	83 ec 04             	sub    $0x4,%esp
+ 7de:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 7e1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 7e4:	6a 01                	push   $0x1
+ 7e6:	50                   	push   %eax
+ 7e7:	56                   	push   %esi
+ 7e8:	e8 96 fe ff ff       	call   683 <write>
+  while(--i >= 0)
+ 7ed:	89 f8                	mov    %edi,%eax
+ 7ef:	83 c4 10             	add    $0x10,%esp
+ 7f2:	83 ef 01             	sub    $0x1,%edi
+ 7f5:	39 d8                	cmp    %ebx,%eax
+ 7f7:	75 df                	jne    7d8 <printint+0x68>
+}
+ 7f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7fc:	5b                   	pop    %ebx
+ 7fd:	5e                   	pop    %esi
+ 7fe:	5f                   	pop    %edi
+ 7ff:	5d                   	pop    %ebp
+ 800:	c3                   	ret
+ 801:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 808:	31 c0                	xor    %eax,%eax
+ 80a:	eb 89                	jmp    795 <printint+0x25>
+ 80c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000810 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 810:	55                   	push   %ebp
+ 811:	89 e5                	mov    %esp,%ebp
+ 813:	57                   	push   %edi
+ 814:	56                   	push   %esi
+ 815:	53                   	push   %ebx
+ 816:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 819:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 81c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 81f:	0f b6 1e             	movzbl (%esi),%ebx
+ 822:	83 c6 01             	add    $0x1,%esi
+ 825:	84 db                	test   %bl,%bl
+ 827:	74 67                	je     890 <printf+0x80>
+ 829:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 82c:	31 d2                	xor    %edx,%edx
+ 82e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 831:	eb 34                	jmp    867 <printf+0x57>
+ 833:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 837:	90                   	nop
+ 838:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 83b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 840:	83 f8 25             	cmp    $0x25,%eax
+ 843:	74 18                	je     85d <printf+0x4d>
+  write(fd, &c, 1);
+ 845:	83 ec 04             	sub    $0x4,%esp
+ 848:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 84b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 84e:	6a 01                	push   $0x1
+ 850:	50                   	push   %eax
+ 851:	57                   	push   %edi
+ 852:	e8 2c fe ff ff       	call   683 <write>
+ 857:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 85a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 85d:	0f b6 1e             	movzbl (%esi),%ebx
+ 860:	83 c6 01             	add    $0x1,%esi
+ 863:	84 db                	test   %bl,%bl
+ 865:	74 29                	je     890 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 867:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 86a:	85 d2                	test   %edx,%edx
+ 86c:	74 ca                	je     838 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 86e:	83 fa 25             	cmp    $0x25,%edx
+ 871:	75 ea                	jne    85d <printf+0x4d>
+      if(c == 'd'){
+ 873:	83 f8 25             	cmp    $0x25,%eax
+ 876:	0f 84 24 01 00 00    	je     9a0 <printf+0x190>
+ 87c:	83 e8 63             	sub    $0x63,%eax
+ 87f:	83 f8 15             	cmp    $0x15,%eax
+ 882:	77 1c                	ja     8a0 <printf+0x90>
+ 884:	ff 24 85 b0 0f 00 00 	jmp    *0xfb0(,%eax,4)
+ 88b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 88f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 890:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 893:	5b                   	pop    %ebx
+ 894:	5e                   	pop    %esi
+ 895:	5f                   	pop    %edi
+ 896:	5d                   	pop    %ebp
+ 897:	c3                   	ret
+ 898:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89f:	90                   	nop
+  write(fd, &c, 1);
+ 8a0:	83 ec 04             	sub    $0x4,%esp
+ 8a3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8a6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 8aa:	6a 01                	push   $0x1
+ 8ac:	52                   	push   %edx
+ 8ad:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 8b0:	57                   	push   %edi
+ 8b1:	e8 cd fd ff ff       	call   683 <write>
+ 8b6:	83 c4 0c             	add    $0xc,%esp
+ 8b9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8bc:	6a 01                	push   $0x1
+ 8be:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 8c1:	52                   	push   %edx
+ 8c2:	57                   	push   %edi
+ 8c3:	e8 bb fd ff ff       	call   683 <write>
+        putc(fd, c);
+ 8c8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8cb:	31 d2                	xor    %edx,%edx
+ 8cd:	eb 8e                	jmp    85d <printf+0x4d>
+ 8cf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 8d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8d3:	83 ec 0c             	sub    $0xc,%esp
+ 8d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 8db:	8b 13                	mov    (%ebx),%edx
+ 8dd:	6a 00                	push   $0x0
+ 8df:	89 f8                	mov    %edi,%eax
+        ap++;
+ 8e1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 8e4:	e8 87 fe ff ff       	call   770 <printint>
+        ap++;
+ 8e9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8ec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8ef:	31 d2                	xor    %edx,%edx
+ 8f1:	e9 67 ff ff ff       	jmp    85d <printf+0x4d>
+ 8f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8fd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 900:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 903:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 905:	83 c0 04             	add    $0x4,%eax
+ 908:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 90b:	85 db                	test   %ebx,%ebx
+ 90d:	0f 84 9d 00 00 00    	je     9b0 <printf+0x1a0>
+        while(*s != 0){
+ 913:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 916:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 918:	84 c0                	test   %al,%al
+ 91a:	0f 84 3d ff ff ff    	je     85d <printf+0x4d>
+ 920:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 923:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 926:	89 de                	mov    %ebx,%esi
+ 928:	89 d3                	mov    %edx,%ebx
+ 92a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 930:	83 ec 04             	sub    $0x4,%esp
+ 933:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 936:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 939:	6a 01                	push   $0x1
+ 93b:	53                   	push   %ebx
+ 93c:	57                   	push   %edi
+ 93d:	e8 41 fd ff ff       	call   683 <write>
+        while(*s != 0){
+ 942:	0f b6 06             	movzbl (%esi),%eax
+ 945:	83 c4 10             	add    $0x10,%esp
+ 948:	84 c0                	test   %al,%al
+ 94a:	75 e4                	jne    930 <printf+0x120>
+      state = 0;
+ 94c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 94f:	31 d2                	xor    %edx,%edx
+ 951:	e9 07 ff ff ff       	jmp    85d <printf+0x4d>
+ 956:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 95d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 960:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 963:	83 ec 0c             	sub    $0xc,%esp
+ 966:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 96b:	8b 13                	mov    (%ebx),%edx
+ 96d:	6a 01                	push   $0x1
+ 96f:	e9 6b ff ff ff       	jmp    8df <printf+0xcf>
+ 974:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 978:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 97b:	83 ec 04             	sub    $0x4,%esp
+ 97e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 981:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 983:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 986:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 989:	6a 01                	push   $0x1
+ 98b:	52                   	push   %edx
+ 98c:	57                   	push   %edi
+ 98d:	e8 f1 fc ff ff       	call   683 <write>
+        ap++;
+ 992:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 995:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 998:	31 d2                	xor    %edx,%edx
+ 99a:	e9 be fe ff ff       	jmp    85d <printf+0x4d>
+ 99f:	90                   	nop
+  write(fd, &c, 1);
+ 9a0:	83 ec 04             	sub    $0x4,%esp
+ 9a3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9a6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9a9:	6a 01                	push   $0x1
+ 9ab:	e9 11 ff ff ff       	jmp    8c1 <printf+0xb1>
+ 9b0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 9b5:	bb a8 0f 00 00       	mov    $0xfa8,%ebx
+ 9ba:	e9 61 ff ff ff       	jmp    920 <printf+0x110>
+ 9bf:	90                   	nop
+
+000009c0 <runfree>:
+
+// Give the n pages at r back to the free runs, merging them with
+// adjacent runs, and shrink the heap if the end of it is free.
+static void
+runfree(struct page *r, uint n)
+{
+ 9c0:	55                   	push   %ebp
+  struct page **pp, *prev;
+
+  r->kind = PFREE;
+ 9c1:	b9 03 00 00 00       	mov    $0x3,%ecx
+{
+ 9c6:	89 e5                	mov    %esp,%ebp
+ 9c8:	57                   	push   %edi
+ 9c9:	56                   	push   %esi
+ 9ca:	53                   	push   %ebx
+ 9cb:	89 c3                	mov    %eax,%ebx
+ 9cd:	83 ec 0c             	sub    $0xc,%esp
+  r->kind = PFREE;
+ 9d0:	66 89 08             	mov    %cx,(%eax)
+  r->npages = n;
+  prev = 0;
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 9d3:	8b 0d a4 14 00 00    	mov    0x14a4,%ecx
+  r->npages = n;
+ 9d9:	89 50 04             	mov    %edx,0x4(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ 9dc:	85 c9                	test   %ecx,%ecx
+ 9de:	0f 84 1f 01 00 00    	je     b03 <runfree+0x143>
+ 9e4:	39 c1                	cmp    %eax,%ecx
+ 9e6:	0f 83 f7 00 00 00    	jae    ae3 <runfree+0x123>
+ 9ec:	89 c8                	mov    %ecx,%eax
+ 9ee:	eb 04                	jmp    9f4 <runfree+0x34>
+ 9f0:	39 d8                	cmp    %ebx,%eax
+ 9f2:	73 09                	jae    9fd <runfree+0x3d>
+ 9f4:	89 c2                	mov    %eax,%edx
+ 9f6:	8b 40 14             	mov    0x14(%eax),%eax
+ 9f9:	85 c0                	test   %eax,%eax
+ 9fb:	75 f3                	jne    9f0 <runfree+0x30>
+    prev = *pp;
+  r->next = *pp;
+ 9fd:	89 43 14             	mov    %eax,0x14(%ebx)
+  *pp = r;
+ a00:	89 5a 14             	mov    %ebx,0x14(%edx)
+
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ a03:	8b 43 14             	mov    0x14(%ebx),%eax
+ a06:	85 c0                	test   %eax,%eax
+ a08:	74 12                	je     a1c <runfree+0x5c>
+ a0a:	8b 7b 04             	mov    0x4(%ebx),%edi
+ a0d:	89 fe                	mov    %edi,%esi
+ a0f:	c1 e6 0c             	shl    $0xc,%esi
+ a12:	01 de                	add    %ebx,%esi
+ a14:	39 f0                	cmp    %esi,%eax
+ a16:	0f 84 a4 00 00 00    	je     ac0 <runfree+0x100>
+    r->npages += r->next->npages;
+    r->next = r->next->next;
+  }
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ a1c:	8b 72 04             	mov    0x4(%edx),%esi
+ a1f:	89 f0                	mov    %esi,%eax
+ a21:	c1 e0 0c             	shl    $0xc,%eax
+ a24:	01 d0                	add    %edx,%eax
+ a26:	39 c3                	cmp    %eax,%ebx
+ a28:	74 16                	je     a40 <runfree+0x80>
+    pp = &runs;
+    while(*pp != r)
+      pp = &(*pp)->next;
+  }
+
+  if(r->next == 0 && r->npages >= TRIM &&
+ a2a:	8b 43 14             	mov    0x14(%ebx),%eax
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ a2d:	8d 72 14             	lea    0x14(%edx),%esi
+  if(r->next == 0 && r->npages >= TRIM &&
+ a30:	85 c0                	test   %eax,%eax
+ a32:	74 3c                	je     a70 <runfree+0xb0>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+    *pp = 0;
+    sbrk(-(int)(r->npages*PGSIZE));
+    heapend = (char*)r;
+  }
+}
+ a34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a37:	5b                   	pop    %ebx
+ a38:	5e                   	pop    %esi
+ a39:	5f                   	pop    %edi
+ a3a:	5d                   	pop    %ebp
+ a3b:	c3                   	ret
+ a3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    prev->npages += r->npages;
+ a40:	03 73 04             	add    0x4(%ebx),%esi
+ a43:	89 72 04             	mov    %esi,0x4(%edx)
+    prev->next = r->next;
+ a46:	8b 43 14             	mov    0x14(%ebx),%eax
+ a49:	89 42 14             	mov    %eax,0x14(%edx)
+    while(*pp != r)
+ a4c:	39 d1                	cmp    %edx,%ecx
+ a4e:	0f 84 c5 00 00 00    	je     b19 <runfree+0x159>
+ a54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      pp = &(*pp)->next;
+ a58:	89 cb                	mov    %ecx,%ebx
+ a5a:	8b 49 14             	mov    0x14(%ecx),%ecx
+    while(*pp != r)
+ a5d:	39 d1                	cmp    %edx,%ecx
+ a5f:	75 f7                	jne    a58 <runfree+0x98>
+      pp = &(*pp)->next;
+ a61:	8d 73 14             	lea    0x14(%ebx),%esi
+ a64:	89 cb                	mov    %ecx,%ebx
+  if(r->next == 0 && r->npages >= TRIM &&
+ a66:	85 c0                	test   %eax,%eax
+ a68:	75 ca                	jne    a34 <runfree+0x74>
+ a6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ a70:	8b 53 04             	mov    0x4(%ebx),%edx
+ a73:	83 fa 1f             	cmp    $0x1f,%edx
+ a76:	76 bc                	jbe    a34 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ a78:	c1 e2 0c             	shl    $0xc,%edx
+ a7b:	01 da                	add    %ebx,%edx
+  if(r->next == 0 && r->npages >= TRIM &&
+ a7d:	39 15 a0 14 00 00    	cmp    %edx,0x14a0
+ a83:	75 af                	jne    a34 <runfree+0x74>
+     (char*)r + r->npages*PGSIZE == heapend && heapend == sbrk(0)){
+ a85:	83 ec 0c             	sub    $0xc,%esp
+ a88:	6a 00                	push   $0x0
+ a8a:	e8 5c fc ff ff       	call   6eb <sbrk>
+ a8f:	83 c4 10             	add    $0x10,%esp
+ a92:	39 05 a0 14 00 00    	cmp    %eax,0x14a0
+ a98:	75 9a                	jne    a34 <runfree+0x74>
+    *pp = 0;
+ a9a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    sbrk(-(int)(r->npages*PGSIZE));
+ aa0:	8b 43 04             	mov    0x4(%ebx),%eax
+ aa3:	83 ec 0c             	sub    $0xc,%esp
+ aa6:	c1 e0 0c             	shl    $0xc,%eax
+ aa9:	f7 d8                	neg    %eax
+ aab:	50                   	push   %eax
+ aac:	e8 3a fc ff ff       	call   6eb <sbrk>
+    heapend = (char*)r;
+ ab1:	89 1d a0 14 00 00    	mov    %ebx,0x14a0
+ ab7:	83 c4 10             	add    $0x10,%esp
+}
+ aba:	e9 75 ff ff ff       	jmp    a34 <runfree+0x74>
+ abf:	90                   	nop
+    r->npages += r->next->npages;
+ ac0:	03 78 04             	add    0x4(%eax),%edi
+ ac3:	89 7b 04             	mov    %edi,0x4(%ebx)
+    r->next = r->next->next;
+ ac6:	8b 40 14             	mov    0x14(%eax),%eax
+ ac9:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ acc:	8b 72 04             	mov    0x4(%edx),%esi
+ acf:	89 f0                	mov    %esi,%eax
+ ad1:	c1 e0 0c             	shl    $0xc,%eax
+ ad4:	01 d0                	add    %edx,%eax
+ ad6:	39 c3                	cmp    %eax,%ebx
+ ad8:	0f 85 4c ff ff ff    	jne    a2a <runfree+0x6a>
+ ade:	e9 5d ff ff ff       	jmp    a40 <runfree+0x80>
+  r->next = *pp;
+ ae3:	89 48 14             	mov    %ecx,0x14(%eax)
+  *pp = r;
+ ae6:	a3 a4 14 00 00       	mov    %eax,0x14a4
+  if(r->next && (char*)r + r->npages*PGSIZE == (char*)r->next){
+ aeb:	89 d0                	mov    %edx,%eax
+ aed:	c1 e0 0c             	shl    $0xc,%eax
+ af0:	01 d8                	add    %ebx,%eax
+ af2:	39 c1                	cmp    %eax,%ecx
+ af4:	74 2f                	je     b25 <runfree+0x165>
+  if(r->next == 0 && r->npages >= TRIM &&
+ af6:	8b 43 14             	mov    0x14(%ebx),%eax
+ af9:	be a4 14 00 00       	mov    $0x14a4,%esi
+ afe:	e9 2d ff ff ff       	jmp    a30 <runfree+0x70>
+  r->next = *pp;
+ b03:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  for(pp = &runs; *pp != 0 && *pp < r; pp = &(*pp)->next)
+ b0a:	be a4 14 00 00       	mov    $0x14a4,%esi
+  *pp = r;
+ b0f:	a3 a4 14 00 00       	mov    %eax,0x14a4
+  if(r->next == 0 && r->npages >= TRIM &&
+ b14:	e9 5a ff ff ff       	jmp    a73 <runfree+0xb3>
+    while(*pp != r)
+ b19:	89 cb                	mov    %ecx,%ebx
+    pp = &runs;
+ b1b:	be a4 14 00 00       	mov    $0x14a4,%esi
+ b20:	e9 0b ff ff ff       	jmp    a30 <runfree+0x70>
+    r->npages += r->next->npages;
+ b25:	03 51 04             	add    0x4(%ecx),%edx
+ b28:	89 53 04             	mov    %edx,0x4(%ebx)
+    r->next = r->next->next;
+ b2b:	8b 41 14             	mov    0x14(%ecx),%eax
+ b2e:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(prev && (char*)prev + prev->npages*PGSIZE == (char*)r){
+ b31:	eb c3                	jmp    af6 <runfree+0x136>
+ b33:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000b40 <runalloc>:
+
+// Take a run of n pages from the start of the first free run
+// long enough, which keeps the end of the heap free to trim.
+static struct page*
+runalloc(uint n)
+{
+ b40:	55                   	push   %ebp
+ b41:	89 e5                	mov    %esp,%ebp
+ b43:	57                   	push   %edi
+ b44:	56                   	push   %esi
+ b45:	89 c6                	mov    %eax,%esi
+ b47:	53                   	push   %ebx
+ b48:	83 ec 1c             	sub    $0x1c,%esp
+  struct page **pp, *r, *rest;
+
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ b4b:	8b 1d a4 14 00 00    	mov    0x14a4,%ebx
+ b51:	85 db                	test   %ebx,%ebx
+ b53:	74 4d                	je     ba2 <runalloc+0x62>
+ b55:	b9 a4 14 00 00       	mov    $0x14a4,%ecx
+    if(r->npages < n)
+ b5a:	39 73 04             	cmp    %esi,0x4(%ebx)
+ b5d:	72 39                	jb     b98 <runalloc+0x58>
+      continue;
+    if(r->npages == n){
+ b5f:	0f 84 9b 00 00 00    	je     c00 <runalloc+0xc0>
+      *pp = r->next;
+    } else {
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ b65:	89 f0                	mov    %esi,%eax
+      rest->kind = PFREE;
+ b67:	ba 03 00 00 00       	mov    $0x3,%edx
+      rest = (struct page*)((char*)r + n*PGSIZE);
+ b6c:	c1 e0 0c             	shl    $0xc,%eax
+ b6f:	01 d8                	add    %ebx,%eax
+      rest->kind = PFREE;
+ b71:	66 89 10             	mov    %dx,(%eax)
+      rest->npages = r->npages - n;
+ b74:	8b 53 04             	mov    0x4(%ebx),%edx
+ b77:	29 f2                	sub    %esi,%edx
+ b79:	89 50 04             	mov    %edx,0x4(%eax)
+      rest->next = r->next;
+ b7c:	8b 53 14             	mov    0x14(%ebx),%edx
+ b7f:	89 50 14             	mov    %edx,0x14(%eax)
+      *pp = rest;
+ b82:	89 01                	mov    %eax,(%ecx)
+      r->npages = n;
+ b84:	89 73 04             	mov    %esi,0x4(%ebx)
+    }
+    return r;
+  }
+  return morecore(n);
+}
+ b87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b8a:	89 d8                	mov    %ebx,%eax
+ b8c:	5b                   	pop    %ebx
+ b8d:	5e                   	pop    %esi
+ b8e:	5f                   	pop    %edi
+ b8f:	5d                   	pop    %ebp
+ b90:	c3                   	ret
+ b91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(pp = &runs; (r = *pp) != 0; pp = &r->next){
+ b98:	8d 4b 14             	lea    0x14(%ebx),%ecx
+ b9b:	8b 5b 14             	mov    0x14(%ebx),%ebx
+ b9e:	85 db                	test   %ebx,%ebx
+ ba0:	75 b8                	jne    b5a <runalloc+0x1a>
+  m = n < MINCORE ? MINCORE : n;
+ ba2:	bf 08 00 00 00       	mov    $0x8,%edi
+ ba7:	39 fe                	cmp    %edi,%esi
+ ba9:	0f 43 fe             	cmovae %esi,%edi
+  brk = sbrk(0);
+ bac:	83 ec 0c             	sub    $0xc,%esp
+ baf:	6a 00                	push   $0x0
+ bb1:	e8 35 fb ff ff       	call   6eb <sbrk>
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ bb6:	89 fa                	mov    %edi,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ bb8:	89 c3                	mov    %eax,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ bba:	c1 e2 0c             	shl    $0xc,%edx
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ bbd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ bc0:	f7 db                	neg    %ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ bc2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  pad = (PGSIZE - (uint)brk % PGSIZE) % PGSIZE;
+ bc5:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  if(sbrk(pad + m*PGSIZE) == (char*)-1){
+ bcb:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+ bce:	89 04 24             	mov    %eax,(%esp)
+ bd1:	e8 15 fb ff ff       	call   6eb <sbrk>
+ bd6:	83 c4 10             	add    $0x10,%esp
+ bd9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ bdc:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ bdf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ be2:	74 3e                	je     c22 <runalloc+0xe2>
+  r = (struct page*)(brk + pad);
+ be4:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ be6:	01 da                	add    %ebx,%edx
+ be8:	89 15 a0 14 00 00    	mov    %edx,0x14a0
+  if(m > n)
+ bee:	39 fe                	cmp    %edi,%esi
+ bf0:	72 1e                	jb     c10 <runalloc+0xd0>
+  r->npages = n;
+ bf2:	89 73 04             	mov    %esi,0x4(%ebx)
+  return r;
+ bf5:	eb 90                	jmp    b87 <runalloc+0x47>
+ bf7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bfe:	66 90                	xchg   %ax,%ax
+      *pp = r->next;
+ c00:	8b 43 14             	mov    0x14(%ebx),%eax
+ c03:	89 01                	mov    %eax,(%ecx)
+}
+ c05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c08:	89 d8                	mov    %ebx,%eax
+ c0a:	5b                   	pop    %ebx
+ c0b:	5e                   	pop    %esi
+ c0c:	5f                   	pop    %edi
+ c0d:	5d                   	pop    %ebp
+ c0e:	c3                   	ret
+ c0f:	90                   	nop
+    runfree((struct page*)((char*)r + n*PGSIZE), m - n);
+ c10:	89 f0                	mov    %esi,%eax
+ c12:	29 f7                	sub    %esi,%edi
+ c14:	c1 e0 0c             	shl    $0xc,%eax
+ c17:	89 fa                	mov    %edi,%edx
+ c19:	01 d8                	add    %ebx,%eax
+ c1b:	e8 a0 fd ff ff       	call   9c0 <runfree>
+ c20:	eb d0                	jmp    bf2 <runalloc+0xb2>
+    if(sbrk(pad + m*PGSIZE) == (char*)-1)
+ c22:	89 f7                	mov    %esi,%edi
+ c24:	83 ec 0c             	sub    $0xc,%esp
+ c27:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ c2a:	c1 e7 0c             	shl    $0xc,%edi
+ c2d:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+ c30:	50                   	push   %eax
+ c31:	e8 b5 fa ff ff       	call   6eb <sbrk>
+ c36:	83 c4 10             	add    $0x10,%esp
+ c39:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ c3c:	83 f8 ff             	cmp    $0xffffffff,%eax
+ c3f:	74 0c                	je     c4d <runalloc+0x10d>
+  r = (struct page*)(brk + pad);
+ c41:	01 cb                	add    %ecx,%ebx
+  heapend = (char*)r + m*PGSIZE;
+ c43:	01 df                	add    %ebx,%edi
+ c45:	89 3d a0 14 00 00    	mov    %edi,0x14a0
+  if(m > n)
+ c4b:	eb a5                	jmp    bf2 <runalloc+0xb2>
+      return 0;
+ c4d:	31 db                	xor    %ebx,%ebx
+ c4f:	e9 33 ff ff ff       	jmp    b87 <runalloc+0x47>
+ c54:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c5f:	90                   	nop
+
+00000c60 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+ c60:	55                   	push   %ebp
+ c61:	89 e5                	mov    %esp,%ebp
+ c63:	56                   	push   %esi
+ c64:	53                   	push   %ebx
+ c65:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  struct page *p;
+
+  if(ap == 0)
+ c68:	85 c9                	test   %ecx,%ecx
+ c6a:	74 1c                	je     c88 <free+0x28>
+    return;
+  p = (struct page*)((uint)ap & ~(PGSIZE-1));
+ c6c:	89 c8                	mov    %ecx,%eax
+ c6e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  switch(p->kind){
+ c73:	0f b7 10             	movzwl (%eax),%edx
+ c76:	66 83 fa 02          	cmp    $0x2,%dx
+ c7a:	74 14                	je     c90 <free+0x30>
+ c7c:	66 83 fa 04          	cmp    $0x4,%dx
+ c80:	74 66                	je     ce8 <free+0x88>
+ c82:	66 83 fa 01          	cmp    $0x1,%dx
+ c86:	74 18                	je     ca0 <free+0x40>
+    break;
+  case PMAP:
+    munmap(p, p->npages*PGSIZE);
+    break;
+  }
+}
+ c88:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ c8b:	5b                   	pop    %ebx
+ c8c:	5e                   	pop    %esi
+ c8d:	5d                   	pop    %ebp
+ c8e:	c3                   	ret
+ c8f:	90                   	nop
+    runfree(p, p->npages);
+ c90:	8b 50 04             	mov    0x4(%eax),%edx
+}
+ c93:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ c96:	5b                   	pop    %ebx
+ c97:	5e                   	pop    %esi
+ c98:	5d                   	pop    %ebp
+    runfree(p, p->npages);
+ c99:	e9 22 fd ff ff       	jmp    9c0 <runfree>
+ c9e:	66 90                	xchg   %ax,%ax
+  b->next = p->free;
+ ca0:	8b 50 0c             	mov    0xc(%eax),%edx
+ ca3:	89 11                	mov    %edx,(%ecx)
+  if(p->nfree++ == 0)
+ ca5:	8b 50 08             	mov    0x8(%eax),%edx
+  p->free = b;
+ ca8:	89 48 0c             	mov    %ecx,0xc(%eax)
+  if(p->nfree++ == 0)
+ cab:	8d 5a 01             	lea    0x1(%edx),%ebx
+ cae:	89 58 08             	mov    %ebx,0x8(%eax)
+ cb1:	85 d2                	test   %edx,%edx
+ cb3:	74 53                	je     d08 <free+0xa8>
+  if(p->nfree == nblocks(p->class)){
+ cb5:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ cb9:	8d 4e 04             	lea    0x4(%esi),%ecx
+ cbc:	ba e0 0f 00 00       	mov    $0xfe0,%edx
+ cc1:	d3 fa                	sar    %cl,%edx
+  if(p->nfree == nblocks(p->class)){
+ cc3:	39 da                	cmp    %ebx,%edx
+ cc5:	75 c1                	jne    c88 <free+0x28>
+  if(p->prev)
+ cc7:	8b 48 18             	mov    0x18(%eax),%ecx
+    p->prev->next = p->next;
+ cca:	8b 50 14             	mov    0x14(%eax),%edx
+  if(p->prev)
+ ccd:	85 c9                	test   %ecx,%ecx
+ ccf:	74 6f                	je     d40 <free+0xe0>
+    p->prev->next = p->next;
+ cd1:	89 51 14             	mov    %edx,0x14(%ecx)
+  if(p->next)
+ cd4:	85 d2                	test   %edx,%edx
+ cd6:	74 06                	je     cde <free+0x7e>
+    p->next->prev = p->prev;
+ cd8:	8b 48 18             	mov    0x18(%eax),%ecx
+ cdb:	89 4a 18             	mov    %ecx,0x18(%edx)
+    runfree(p, 1);
+ cde:	ba 01 00 00 00       	mov    $0x1,%edx
+ ce3:	eb ae                	jmp    c93 <free+0x33>
+ ce5:	8d 76 00             	lea    0x0(%esi),%esi
+    munmap(p, p->npages*PGSIZE);
+ ce8:	8b 50 04             	mov    0x4(%eax),%edx
+ ceb:	83 ec 08             	sub    $0x8,%esp
+ cee:	c1 e2 0c             	shl    $0xc,%edx
+ cf1:	52                   	push   %edx
+ cf2:	50                   	push   %eax
+ cf3:	e8 1b fa ff ff       	call   713 <munmap>
+    break;
+ cf8:	83 c4 10             	add    $0x10,%esp
+}
+ cfb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ cfe:	5b                   	pop    %ebx
+ cff:	5e                   	pop    %esi
+ d00:	5d                   	pop    %ebp
+ d01:	c3                   	ret
+ d02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  p->next = partial[p->class];
+ d08:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  p->prev = 0;
+ d0c:	c7 40 18 00 00 00 00 	movl   $0x0,0x18(%eax)
+  p->next = partial[p->class];
+ d13:	bb 01 00 00 00       	mov    $0x1,%ebx
+ d18:	8b 14 b5 a8 14 00 00 	mov    0x14a8(,%esi,4),%edx
+ d1f:	89 50 14             	mov    %edx,0x14(%eax)
+  if(p->next)
+ d22:	85 d2                	test   %edx,%edx
+ d24:	74 0a                	je     d30 <free+0xd0>
+    p->next->prev = p;
+ d26:	89 42 18             	mov    %eax,0x18(%edx)
+  partial[p->class] = p;
+ d29:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+  if(p->nfree == nblocks(p->class)){
+ d2d:	8b 58 08             	mov    0x8(%eax),%ebx
+  partial[p->class] = p;
+ d30:	89 04 b5 a8 14 00 00 	mov    %eax,0x14a8(,%esi,4)
+}
+ d37:	eb 80                	jmp    cb9 <free+0x59>
+ d39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ d40:	89 14 b5 a8 14 00 00 	mov    %edx,0x14a8(,%esi,4)
+ d47:	eb 8b                	jmp    cd4 <free+0x74>
+ d49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000d50 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ d50:	55                   	push   %ebp
+ d51:	89 e5                	mov    %esp,%ebp
+ d53:	56                   	push   %esi
+ d54:	53                   	push   %ebx
+ d55:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct page *p;
+  uint n;
+
+  if(nbytes <= MAXSMALL)
+ d58:	3d 00 04 00 00       	cmp    $0x400,%eax
+ d5d:	76 71                	jbe    dd0 <malloc+0x80>
+    return smallalloc(sizeclass(nbytes));
+  if(nbytes > 0x7fffffff)
+ d5f:	85 c0                	test   %eax,%eax
+ d61:	0f 88 d9 00 00 00    	js     e40 <malloc+0xf0>
+    return 0;
+  n = (nbytes + HDRSIZE + PGSIZE-1) / PGSIZE;
+ d67:	8d 90 1f 10 00 00    	lea    0x101f(%eax),%edx
+ d6d:	89 d3                	mov    %edx,%ebx
+ d6f:	c1 eb 0c             	shr    $0xc,%ebx
+  if(nbytes >= MAPMIN){
+ d72:	3d ff ff 00 00       	cmp    $0xffff,%eax
+ d77:	77 27                	ja     da0 <malloc+0x50>
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    if(p == MAP_FAILED)
+      return 0;
+    p->kind = PMAP;
+  } else {
+    if((p = runalloc(n)) == 0)
+ d79:	89 d8                	mov    %ebx,%eax
+ d7b:	e8 c0 fd ff ff       	call   b40 <runalloc>
+ d80:	85 c0                	test   %eax,%eax
+ d82:	0f 84 b8 00 00 00    	je     e40 <malloc+0xf0>
+      return 0;
+    p->kind = PRUN;
+ d88:	ba 02 00 00 00       	mov    $0x2,%edx
+ d8d:	66 89 10             	mov    %dx,(%eax)
+  }
+  p->npages = n;
+ d90:	89 58 04             	mov    %ebx,0x4(%eax)
+  return (char*)p + HDRSIZE;
+ d93:	8d 58 20             	lea    0x20(%eax),%ebx
+}
+ d96:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ d99:	89 d8                	mov    %ebx,%eax
+ d9b:	5b                   	pop    %ebx
+ d9c:	5e                   	pop    %esi
+ d9d:	5d                   	pop    %ebp
+ d9e:	c3                   	ret
+ d9f:	90                   	nop
+    p = mmap(0, n*PGSIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+ da0:	83 ec 08             	sub    $0x8,%esp
+ da3:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+ da9:	6a 00                	push   $0x0
+ dab:	6a ff                	push   $0xffffffff
+ dad:	6a 22                	push   $0x22
+ daf:	6a 03                	push   $0x3
+ db1:	52                   	push   %edx
+ db2:	6a 00                	push   $0x0
+ db4:	e8 52 f9 ff ff       	call   70b <mmap>
+    if(p == MAP_FAILED)
+ db9:	83 c4 20             	add    $0x20,%esp
+ dbc:	83 f8 ff             	cmp    $0xffffffff,%eax
+ dbf:	74 7f                	je     e40 <malloc+0xf0>
+    p->kind = PMAP;
+ dc1:	b9 04 00 00 00       	mov    $0x4,%ecx
+ dc6:	66 89 08             	mov    %cx,(%eax)
+ dc9:	eb c5                	jmp    d90 <malloc+0x40>
+ dcb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ dcf:	90                   	nop
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ dd0:	83 f8 10             	cmp    $0x10,%eax
+ dd3:	0f 86 07 01 00 00    	jbe    ee0 <malloc+0x190>
+ dd9:	31 db                	xor    %ebx,%ebx
+ ddb:	ba 10 00 00 00       	mov    $0x10,%edx
+ de0:	83 c3 01             	add    $0x1,%ebx
+ de3:	89 d6                	mov    %edx,%esi
+ de5:	89 d9                	mov    %ebx,%ecx
+ de7:	d3 e6                	shl    %cl,%esi
+ de9:	39 c6                	cmp    %eax,%esi
+ deb:	72 f3                	jb     de0 <malloc+0x90>
+  if((p = partial[c]) == 0){
+ ded:	8b 14 9d a8 14 00 00 	mov    0x14a8(,%ebx,4),%edx
+ df4:	85 d2                	test   %edx,%edx
+ df6:	74 58                	je     e50 <malloc+0x100>
+  if((b = p->free) != 0){
+ df8:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ dfb:	8b 4a 08             	mov    0x8(%edx),%ecx
+  if((b = p->free) != 0){
+ dfe:	85 db                	test   %ebx,%ebx
+ e00:	0f 84 aa 00 00 00    	je     eb0 <malloc+0x160>
+    p->free = b->next;
+ e06:	8b 03                	mov    (%ebx),%eax
+ e08:	89 42 0c             	mov    %eax,0xc(%edx)
+  if(--p->nfree == 0)
+ e0b:	83 e9 01             	sub    $0x1,%ecx
+ e0e:	89 4a 08             	mov    %ecx,0x8(%edx)
+ e11:	75 83                	jne    d96 <malloc+0x46>
+  if(p->prev)
+ e13:	8b 4a 18             	mov    0x18(%edx),%ecx
+    p->prev->next = p->next;
+ e16:	8b 42 14             	mov    0x14(%edx),%eax
+  if(p->prev)
+ e19:	85 c9                	test   %ecx,%ecx
+ e1b:	0f 84 cf 00 00 00    	je     ef0 <malloc+0x1a0>
+    p->prev->next = p->next;
+ e21:	89 41 14             	mov    %eax,0x14(%ecx)
+  if(p->next)
+ e24:	85 c0                	test   %eax,%eax
+ e26:	0f 84 6a ff ff ff    	je     d96 <malloc+0x46>
+    p->next->prev = p->prev;
+ e2c:	8b 52 18             	mov    0x18(%edx),%edx
+ e2f:	89 50 18             	mov    %edx,0x18(%eax)
+ e32:	e9 5f ff ff ff       	jmp    d96 <malloc+0x46>
+ e37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e3e:	66 90                	xchg   %ax,%ax
+}
+ e40:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+ e43:	31 db                	xor    %ebx,%ebx
+}
+ e45:	89 d8                	mov    %ebx,%eax
+ e47:	5b                   	pop    %ebx
+ e48:	5e                   	pop    %esi
+ e49:	5d                   	pop    %ebp
+ e4a:	c3                   	ret
+ e4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ e4f:	90                   	nop
+    if((p = runalloc(1)) == 0)
+ e50:	b8 01 00 00 00       	mov    $0x1,%eax
+ e55:	e8 e6 fc ff ff       	call   b40 <runalloc>
+ e5a:	89 c2                	mov    %eax,%edx
+ e5c:	85 c0                	test   %eax,%eax
+ e5e:	74 e0                	je     e40 <malloc+0xf0>
+    p->kind = PSMALL;
+ e60:	b8 01 00 00 00       	mov    $0x1,%eax
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ e65:	8d 4b 04             	lea    0x4(%ebx),%ecx
+    p->class = c;
+ e68:	66 89 5a 02          	mov    %bx,0x2(%edx)
+ e6c:	0f b7 db             	movzwl %bx,%ebx
+    p->kind = PSMALL;
+ e6f:	66 89 02             	mov    %ax,(%edx)
+    p->fresh = (char*)p + HDRSIZE;
+ e72:	8d 42 20             	lea    0x20(%edx),%eax
+ e75:	89 42 10             	mov    %eax,0x10(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ e78:	b8 e0 0f 00 00       	mov    $0xfe0,%eax
+ e7d:	d3 f8                	sar    %cl,%eax
+    p->free = 0;
+ e7f:	c7 42 0c 00 00 00 00 	movl   $0x0,0xc(%edx)
+    p->nfree = nblocks(c);
+ e86:	89 42 08             	mov    %eax,0x8(%edx)
+  return (PGSIZE - HDRSIZE) / (MINSMALL << c);
+ e89:	89 c1                	mov    %eax,%ecx
+  p->next = partial[p->class];
+ e8b:	8b 04 9d a8 14 00 00 	mov    0x14a8(,%ebx,4),%eax
+  p->prev = 0;
+ e92:	c7 42 18 00 00 00 00 	movl   $0x0,0x18(%edx)
+  p->next = partial[p->class];
+ e99:	89 42 14             	mov    %eax,0x14(%edx)
+  if(p->next)
+ e9c:	85 c0                	test   %eax,%eax
+ e9e:	75 20                	jne    ec0 <malloc+0x170>
+  partial[p->class] = p;
+ ea0:	89 14 9d a8 14 00 00 	mov    %edx,0x14a8(,%ebx,4)
+  if((b = p->free) != 0){
+ ea7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ eae:	66 90                	xchg   %ax,%ax
+    b = (struct block*)p->fresh;
+ eb0:	8b 5a 10             	mov    0x10(%edx),%ebx
+    p->fresh += MINSMALL << c;
+ eb3:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+ eb6:	89 42 10             	mov    %eax,0x10(%edx)
+ eb9:	e9 4d ff ff ff       	jmp    e0b <malloc+0xbb>
+ ebe:	66 90                	xchg   %ax,%ax
+    p->next->prev = p;
+ ec0:	89 50 18             	mov    %edx,0x18(%eax)
+  partial[p->class] = p;
+ ec3:	0f b7 42 02          	movzwl 0x2(%edx),%eax
+  if((b = p->free) != 0){
+ ec7:	8b 5a 0c             	mov    0xc(%edx),%ebx
+  if(--p->nfree == 0)
+ eca:	8b 4a 08             	mov    0x8(%edx),%ecx
+  partial[p->class] = p;
+ ecd:	89 14 85 a8 14 00 00 	mov    %edx,0x14a8(,%eax,4)
+}
+ ed4:	e9 25 ff ff ff       	jmp    dfe <malloc+0xae>
+ ed9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(c = 0; (MINSMALL << c) < nbytes; c++)
+ ee0:	be 10 00 00 00       	mov    $0x10,%esi
+ ee5:	31 db                	xor    %ebx,%ebx
+ ee7:	e9 01 ff ff ff       	jmp    ded <malloc+0x9d>
+ eec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    partial[p->class] = p->next;
+ ef0:	0f b7 4a 02          	movzwl 0x2(%edx),%ecx
+ ef4:	89 04 8d a8 14 00 00 	mov    %eax,0x14a8(,%ecx,4)
+ efb:	e9 24 ff ff ff       	jmp    e24 <malloc+0xd4>
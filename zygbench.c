@@ -0,0 +1,121 @@
+// Measure how long a spawned program takes to start running,
+// from the spawn() call to the first instruction of its main,
+// with and without a zygote pool in the container (see czygote).
+// The program is zygbench itself, run as a child with -c.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "spawn.h"
+
+#define NRUN  40
+#define NPOOL 4
+
+uint lat[NRUN];
+
+// Low half of the time stamp counter, which is plenty
+// for intervals of well under a second.
+uint
+rdtsc(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  return lo;
+}
+
+void
+utoa(uint x, char *buf)
+{
+  char tmp[16];
+  int i, n;
+
+  n = 0;
+  do {
+    tmp[n++] = '0' + x % 10;
+    x /= 10;
+  } while(x);
+  for(i = 0; i < n; i++)
+    buf[i] = tmp[n-1-i];
+  buf[n] = 0;
+}
+
+uint
+atou(char *s)
+{
+  uint x;
+
+  x = 0;
+  while(*s >= '0' && *s <= '9')
+    x = x*10 + *s++ - '0';
+  return x;
+}
+
+void
+sort(uint *a, int n)
+{
+  int i, j;
+  uint x;
+
+  for(i = 1; i < n; i++){
+    x = a[i];
+    for(j = i; j > 0 && a[j-1] > x; j--)
+      a[j] = a[j-1];
+    a[j] = x;
+  }
+}
+
+// Launch the child NRUN times with a pool of npool zygotes
+// in container cont and print the latency percentiles.
+void
+run(char *cont, int npool)
+{
+  struct spawnact act;
+  char t0[16], *args[4];
+  int fd[2], i;
+
+  if(czygote(cont, "zygbench", npool) < 0 || pipe(fd) < 0){
+    printf(1, "zygbench: cannot set up pool in %s\n", cont);
+    exit();
+  }
+  act.op = SPAWN_DUP;
+  act.fd = 3;
+  act.arg = fd[1];
+  act.path = 0;
+  args[0] = "zygbench";
+  args[1] = "-c";
+  args[2] = t0;
+  args[3] = 0;
+  for(i = 0; i < NRUN; i++){
+    utoa(rdtsc(), t0);
+    if(spawn("zygbench", args, &act, 1, -1) < 0 ||
+       read(fd[0], &lat[i], sizeof(lat[i])) != sizeof(lat[i])){
+      printf(1, "zygbench: launch failed\n");
+      exit();
+    }
+    wait();
+  }
+  close(fd[0]);
+  close(fd[1]);
+  czygote(cont, "zygbench", 0);
+
+  sort(lat, NRUN);
+  printf(1, "%s: launch latency in Kcycles: p50 %d p90 %d p99 %d max %d\n",
+         npool ? "zygote pool" : "no pool", lat[NRUN*50/100] / 1000,
+         lat[NRUN*90/100] / 1000, lat[NRUN*99/100] / 1000, lat[NRUN-1] / 1000);
+}
+
+int
+main(int argc, char *argv[])
+{
+  uint d;
+
+  if(argc == 3 && strcmp(argv[1], "-c") == 0){
+    d = rdtsc() - atou(argv[2]);
+    write(3, &d, sizeof(d));
+    exit();
+  }
+  run(argc > 1 ? argv[1] : "root container", 0);
+  run(argc > 1 ? argv[1] : "root container", NPOOL);
+  exit();
+}